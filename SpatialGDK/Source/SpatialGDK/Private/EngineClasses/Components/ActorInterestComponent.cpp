@@ -4,8 +4,31 @@
 
 #include "Schema/Interest.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "SpatialGDKSettings.h"
 
 void UActorInterestComponent::PopulateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints) const
+{
+	if (!GetDefault<USpatialGDKSettings>()->bCacheActorInterestComponentQueries)
+	{
+		CreateFrequencyToConstraintsMap(ClassInfoManager, OutFrequencyToQueryConstraints);
+		return;
+	}
+
+	// The queries can only be edited on the defaults, and the class component IDs they resolve to don't change once
+	// the class info manager is set up, so the constraints only need building once per component.
+	if (!bHasCachedConstraints)
+	{
+		CreateFrequencyToConstraintsMap(ClassInfoManager, CachedFrequencyToConstraints);
+		bHasCachedConstraints = true;
+	}
+
+	for (const auto& FrequencyConstraints : CachedFrequencyToConstraints)
+	{
+		OutFrequencyToQueryConstraints.FindOrAdd(FrequencyConstraints.Key).Append(FrequencyConstraints.Value);
+	}
+}
+
+void UActorInterestComponent::CreateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints) const
 {
 	// Loop through the user specified queries to extract the constraints and frequencies.
 	// We don't construct the actual query at this point because the interest factory enforces the result types.
@@ -3,9 +3,14 @@
 #include "EngineClasses/Components/SpatialPingComponent.h"
 
 #include "Engine/World.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialPackageMapClient.h"
 #include "GameFramework/PlayerController.h"
+#include "Interop/SpatialRPCService.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "TimerManager.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialPingComponent);
@@ -97,6 +102,7 @@ void USpatialPingComponent::EnablePing()
 
 		LastSentPingID = 0;
 		TimeoutCount = 0;
+		StartEndpointPings();
 		// Send a new ping, which will trigger a self-perpetuating sequence via timers.
 		SendNewPing();
 		// Set looping timer to 'tick' this component, it doesn't send any pings but matches the MinPingInterval for passing updates to the owning controller.
@@ -113,11 +119,56 @@ void USpatialPingComponent::DisablePing()
 		// Clear the timers.
 		World->GetTimerManager().ClearTimer(PingTickHandle);
 		World->GetTimerManager().ClearTimer(PingTimerHandle);
+		StopEndpointPings();
 		// Reset ping output value.
 		RoundTripPing = 0.f;
 	}
 }
 
+void USpatialPingComponent::StartEndpointPings()
+{
+	if (!GetDefault<USpatialGDKSettings>()->bUseEndpointPings)
+	{
+		return;
+	}
+
+	USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(OwningController->GetNetDriver());
+	if (NetDriver == nullptr || !NetDriver->RPCService.IsValid() || NetDriver->PackageMap == nullptr)
+	{
+		return;
+	}
+
+	const Worker_EntityId EntityId = NetDriver->PackageMap->GetEntityIdFromObject(OwningController);
+	if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
+	{
+		UE_LOG(LogSpatialPingComponent, Warning, TEXT("SpatialPingComponent could not find the entity of its owning PlayerController, falling back to pinging with RPCs."));
+		return;
+	}
+
+	EndpointPingNetDriver = NetDriver;
+	EndpointPingEntityId = EntityId;
+	EndpointPingAckedHandle = NetDriver->RPCService->OnPingIdAcked.AddUObject(this, &USpatialPingComponent::OnEndpointPingIdAcked);
+}
+
+void USpatialPingComponent::StopEndpointPings()
+{
+	if (EndpointPingNetDriver.IsValid() && EndpointPingNetDriver->RPCService.IsValid())
+	{
+		EndpointPingNetDriver->RPCService->OnPingIdAcked.Remove(EndpointPingAckedHandle);
+	}
+
+	EndpointPingNetDriver.Reset();
+	EndpointPingAckedHandle.Reset();
+}
+
+void USpatialPingComponent::OnEndpointPingIdAcked(Worker_EntityId EntityId, uint32 PingID)
+{
+	if (EntityId == EndpointPingEntityId)
+	{
+		OnPingReply(static_cast<uint16>(PingID));
+	}
+}
+
 void USpatialPingComponent::TickPingComponent()
 {
 	// Pass latest measured ping to owning controller to be processed by PlayerState.
@@ -132,7 +183,15 @@ void USpatialPingComponent::SendNewPing()
 	LastSentPingID = NewPingID;
 	LastSentPingTimestamp = FPlatformTime::Seconds();
 	// Send new ping ID.
-	SendServerWorkerPingID(NewPingID);
+	if (EndpointPingNetDriver.IsValid() && EndpointPingNetDriver->RPCService.IsValid())
+	{
+		// Sent with the next RPCs or acks from this client, and echoed back by the server without a replicated property.
+		EndpointPingNetDriver->RPCService->SetPingId(EndpointPingEntityId, NewPingID);
+	}
+	else
+	{
+		SendServerWorkerPingID(NewPingID);
+	}
 	if (UWorld* World = GetWorld())
 	{
 		// Set a timeout timer to await a reply.
@@ -151,8 +210,13 @@ void USpatialPingComponent::OnPingTimeout()
 
 void USpatialPingComponent::OnRep_ReplicatedPingID()
 {
-	// Check that replicated ping ID matches the last sent AND check ping is enabled to catch cases where a value is replicated after being locally disabled.
-	if (ReplicatedPingID == LastSentPingID && bIsPingEnabled)
+	OnPingReply(ReplicatedPingID);
+}
+
+void USpatialPingComponent::OnPingReply(uint16 PingID)
+{
+	// Check that the reply matches the last sent ping ID AND check ping is enabled to catch cases where a value is replicated after being locally disabled.
+	if (PingID == LastSentPingID && bIsPingEnabled)
 	{
 		UWorld* World = GetWorld();
 		if (World != nullptr)
@@ -7,6 +7,7 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
+#include "GameFramework/WorldSettings.h"
 #include "Net/DataBunch.h"
 #include "Net/NetworkProfiler.h"
 
@@ -30,12 +31,14 @@
 #include "SpatialGDKSettings.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialActorUtils.h"
+#include "Utils/SubsystemStats.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialActorChannel);
 
 DECLARE_CYCLE_STAT(TEXT("ReplicateActor"), STAT_SpatialActorChannelReplicateActor, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("UpdateSpatialPosition"), STAT_SpatialActorChannelUpdateSpatialPosition, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ReplicateSubobject"), STAT_SpatialActorChannelReplicateSubobject, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("GatherPropertyCompares"), STAT_SpatialActorChannelGatherPropertyCompares, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ServerProcessOwnershipChange"), STAT_ServerProcessOwnershipChange, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ClientProcessOwnershipChange"), STAT_ClientProcessOwnershipChange, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("CallUpdateEntityACLs"), STAT_CallUpdateEntityACLs, STATGROUP_SpatialNet);
@@ -99,42 +102,57 @@ void ForceReplicateOnActorHierarchy(USpatialNetDriver* NetDriver, const AActor*
 
 } // end anonymous namespace
 
-bool FSpatialObjectRepState::MoveMappedObjectToUnmapped_r(const FUnrealObjectRef& ObjRef, FObjectReferencesMap& ObjectReferencesMap)
+bool FSpatialObjectRepState::MoveMappedObjectToUnmapped_r(const FUnrealObjectRef& ObjRef, FObjectReferences& ObjReferences)
 {
-	bool bFoundRef = false;
-
-	for (auto& ObjReferencePair : ObjectReferencesMap)
+	if (ObjReferences.Array != NULL)
 	{
-		FObjectReferences& ObjReferences = ObjReferencePair.Value;
+		bool bFoundRef = false;
 
-		if (ObjReferences.Array != NULL)
+		for (auto& ObjReferencePair : *ObjReferences.Array)
 		{
-			if (MoveMappedObjectToUnmapped_r(ObjRef, *ObjReferences.Array))
+			if (MoveMappedObjectToUnmapped_r(ObjRef, ObjReferencePair.Value))
 			{
 				bFoundRef = true;
 			}
-			continue;
 		}
 
-		if (ObjReferences.MappedRefs.Contains(ObjRef))
-		{
-			ObjReferences.MappedRefs.Remove(ObjRef);
-			ObjReferences.UnresolvedRefs.Add(ObjRef);
-			bFoundRef = true;
-		}
+		return bFoundRef;
 	}
 
-	return bFoundRef;
+	if (ObjReferences.MappedRefs.Contains(ObjRef))
+	{
+		ObjReferences.MappedRefs.Remove(ObjRef);
+		ObjReferences.UnresolvedRefs.Add(ObjRef);
+		return true;
+	}
+
+	return false;
 }
 
 bool FSpatialObjectRepState::MoveMappedObjectToUnmapped(const FUnrealObjectRef& ObjRef)
 {
-	if (MoveMappedObjectToUnmapped_r(ObjRef, ReferenceMap))
+	const TArray<int32>* Offsets = RefToReferenceMapOffsets.Find(ObjRef);
+	if (Offsets == nullptr)
+	{
+		return false;
+	}
+
+	bool bFoundRef = false;
+
+	for (int32 Offset : *Offsets)
+	{
+		FObjectReferences* ObjReferences = ReferenceMap.Find(Offset);
+		if (ObjReferences != nullptr && MoveMappedObjectToUnmapped_r(ObjRef, *ObjReferences))
+		{
+			bFoundRef = true;
+		}
+	}
+
+	if (bFoundRef)
 	{
 		UnresolvedRefs.Add(ObjRef);
-		return true;
 	}
-	return false;
+	return bFoundRef;
 }
 
 void FSpatialObjectRepState::GatherObjectRef(TSet<FUnrealObjectRef>& OutReferenced, TSet<FUnrealObjectRef>& OutUnresolved, const FObjectReferences& CurReferences) const
@@ -160,10 +178,20 @@ void FSpatialObjectRepState::UpdateRefToRepStateMap(FObjectToRepStateMap& RepSta
 	// Inspired by FObjectReplicator::UpdateGuidToReplicatorMap
 	UnresolvedRefs.Empty();
 
+	RefToReferenceMapOffsets.Reset();
+
 	TSet< FUnrealObjectRef > LocalReferencedObj;
+	TSet< FUnrealObjectRef > EntryReferencedObj;
 	for (auto& Entry : ReferenceMap)
 	{
-		GatherObjectRef(LocalReferencedObj, UnresolvedRefs, Entry.Value);
+		EntryReferencedObj.Reset();
+		GatherObjectRef(EntryReferencedObj, UnresolvedRefs, Entry.Value);
+
+		for (const FUnrealObjectRef& Ref : EntryReferencedObj)
+		{
+			RefToReferenceMapOffsets.FindOrAdd(Ref).Add(Entry.Key);
+		}
+		LocalReferencedObj.Append(EntryReferencedObj);
 	}
 
 	// TODO : Support references in structures updated by deltas. UNR-2556
@@ -206,6 +234,8 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	, bCreatingNewEntity(false)
 	, EntityId(SpatialConstants::INVALID_ENTITY_ID)
 	, bInterestDirty(false)
+	, bUsePushModel(false)
+	, bPushModelDirty(false)
 	, bNetOwned(false)
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
@@ -222,21 +252,25 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	bCreatingNewEntity = false;
 	EntityId = SpatialConstants::INVALID_ENTITY_ID;
 	bInterestDirty = false;
+	bUsePushModel = false;
+	bPushModelDirty = false;
 	bNetOwned = false;
 	bIsAuthClient = false;
 	bIsAuthServer = false;
 	LastPositionSinceUpdate = FVector::ZeroVector;
 	TimeWhenPositionLastUpdated = 0.0f;
 	AuthorityReceivedTimestamp = 0;
+	AuthorityMigrationCount = 0;
+	RepeatedAuthorityMigrationCount = 0;
 
-	PendingDynamicSubobjects.Empty();
 	SavedConnectionOwningWorkerId.Empty();
 	SavedInterestBucketComponentID = SpatialConstants::INVALID_COMPONENT_ID;
 
 	FramesTillDormancyAllowed = 0;
 
 	ActorHandoverShadowData = nullptr;
-	HandoverShadowDataMap.Empty();
+	bIsSimpleActor = false;
+	ExtendedState.Reset();
 
 	NetDriver = Cast<USpatialNetDriver>(Connection->Driver);
 	check(NetDriver);
@@ -384,17 +418,110 @@ void USpatialActorChannel::UpdateShadowData()
 		FObjectReplicator& ComponentReplicator = FindOrCreateReplicator(ActorComponent).Get();
 		ResetShadowData(*ComponentReplicator.RepLayout, ComponentReplicator.ChangelistMgr->GetRepChangelistState()->StaticBuffer, ActorComponent);
 	}
+
+	// The handover values were just received from the previous authoritative worker, so only send the ones this worker changes from here.
+	RefreshHandoverShadowData();
+}
+
+void USpatialActorChannel::PreStageAuthority()
+{
+	if (bAuthorityPreStaged || Actor == nullptr || bIsAuthServer)
+	{
+		return;
+	}
+	bAuthorityPreStaged = true;
+
+	auto PreStageReplicator = [](FObjectReplicator& Replicator, UObject* Object)
+	{
+		FRepStateStaticBuffer& StaticBuffer = Replicator.ChangelistMgr->GetRepChangelistState()->StaticBuffer;
+		if (StaticBuffer.Num() == 0)
+		{
+			Replicator.RepLayout->InitRepStateStaticBuffer(StaticBuffer, reinterpret_cast<const uint8*>(Object));
+		}
+	};
+
+	PreStageReplicator(*ActorReplicator, Actor);
+	for (UActorComponent* ActorComponent : Actor->GetReplicatedComponents())
+	{
+		PreStageReplicator(FindOrCreateReplicator(ActorComponent).Get(), ActorComponent);
+	}
+
+	RefreshHandoverShadowData();
+}
+
+void USpatialActorChannel::RefreshHandoverShadowData()
+{
+	if (!ExtendedState.IsValid())
+	{
+		return;
+	}
+
+	for (auto& ShadowDataPair : ExtendedState->HandoverShadowDataMap)
+	{
+		if (UObject* Object = ShadowDataPair.Key.Get())
+		{
+			TArray<uint8>& ShadowData = ShadowDataPair.Value.Get();
+			if (ShadowData.Num() == 0)
+			{
+				InitializeHandoverShadowData(ShadowData, Object);
+			}
+
+			// The returned changes are discarded, this only copies the current values into the shadow data.
+			GetHandoverChangeList(ShadowData, Object);
+		}
+	}
 }
 
 void USpatialActorChannel::UpdateSpatialPositionWithFrequencyCheck()
 {
 	// Check that there has been a sufficient amount of time since the last update.
-	if ((NetDriver->Time - TimeWhenPositionLastUpdated) >= (1.0f / GetDefault<USpatialGDKSettings>()->PositionUpdateFrequency))
+	if (IsPositionUpdateDue())
 	{
 		UpdateSpatialPosition();
 	}
 }
 
+bool USpatialActorChannel::IsPositionUpdateDue() const
+{
+	return (NetDriver->Time - TimeWhenPositionLastUpdated) >= (1.0f / GetPositionUpdateFrequency());
+}
+
+float USpatialActorChannel::GetPositionUpdateFrequency() const
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const float MaxFrequency = SpatialGDKSettings->PositionUpdateFrequency;
+	if (!SpatialGDKSettings->bAdaptivePositionUpdateFrequency || Actor == nullptr)
+	{
+		return MaxFrequency;
+	}
+
+	const float MinFrequency = FMath::Min(SpatialGDKSettings->MinAdaptivePositionUpdateFrequency, MaxFrequency);
+
+	if (SpatialGDKSettings->AdaptivePositionUpdateObserverDistance > 0.0f)
+	{
+		// The viewers of all client connections are gathered once per tick before actors replicate.
+		const AWorldSettings* WorldSettings = Actor->GetWorldSettings();
+		if (WorldSettings != nullptr)
+		{
+			const FVector ActorLocation = Actor->GetActorLocation();
+			const float ObserverDistanceSquared = FMath::Square(SpatialGDKSettings->AdaptivePositionUpdateObserverDistance);
+			const bool bIsObserved = WorldSettings->ReplicationViewers.ContainsByPredicate([&ActorLocation, ObserverDistanceSquared](const FNetViewer& Viewer)
+			{
+				return FVector::DistSquared(Viewer.ViewLocation, ActorLocation) <= ObserverDistanceSquared;
+			});
+
+			if (!bIsObserved)
+			{
+				return MinFrequency;
+			}
+		}
+	}
+
+	const float FullRateSpeed = SpatialGDKSettings->AdaptivePositionUpdateFullRateSpeed;
+	const float SpeedAlpha = FullRateSpeed > 0.0f ? FMath::Clamp(Actor->GetVelocity().Size() / FullRateSpeed, 0.0f, 1.0f) : 1.0f;
+	return FMath::Lerp(MinFrequency, MaxFrequency, SpeedAlpha);
+}
+
 FRepChangeState USpatialActorChannel::CreateInitialRepChangeState(TWeakObjectPtr<UObject> Object)
 {
 	checkf(Object != nullptr, TEXT("Attempted to create initial rep change state on an object which is null."));
@@ -446,6 +573,23 @@ FHandoverChangeState USpatialActorChannel::CreateInitialHandoverChangeState(cons
 	return HandoverChanged;
 }
 
+void USpatialActorChannel::RecordAuthorityMigration(uint64 Timestamp)
+{
+	const bool bIsRepeatedMigration = AuthorityReceivedTimestamp != 0
+		&& double(Timestamp - AuthorityReceivedTimestamp) * FPlatformTime::GetSecondsPerCycle64() < SpatialConstants::AUTHORITY_MIGRATION_REPEAT_WINDOW_SECONDS;
+
+	AuthorityReceivedTimestamp = Timestamp;
+	AuthorityMigrationCount++;
+	RepeatedAuthorityMigrationCount = bIsRepeatedMigration ? RepeatedAuthorityMigrationCount + 1 : 1;
+
+	if (RepeatedAuthorityMigrationCount == SpatialConstants::AUTHORITY_MIGRATION_THRASH_WARNING_COUNT)
+	{
+		UE_LOG(LogSpatialActorChannel, Warning, TEXT("Authority over actor %s is thrashing, gained it %d times within %.0fs of the previous gain (%d times in total). "
+			"Consider increasing the load balancing strategy's boundary hysteresis or the authority migration backoff time."),
+			*GetNameSafe(Actor), RepeatedAuthorityMigrationCount, SpatialConstants::AUTHORITY_MIGRATION_REPEAT_WINDOW_SECONDS, AuthorityMigrationCount);
+	}
+}
+
 void USpatialActorChannel::GetLatestAuthorityChangeFromHierarchy(const AActor* HierarchyActor, uint64& OutTimestamp)
 {
 	if (HierarchyActor->GetIsReplicated())
@@ -468,6 +612,7 @@ void USpatialActorChannel::GetLatestAuthorityChangeFromHierarchy(const AActor* H
 int64 USpatialActorChannel::ReplicateActor()
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelReplicateActor);
+	SPATIALGDK_SUBSYSTEM_SCOPE(ReplicateActor);
 
 	if (!IsReadyForReplication())
 	{
@@ -585,7 +730,11 @@ int64 USpatialActorChannel::ReplicateActor()
 	{
 		if (SpatialGDKSettings->bBatchSpatialPositionUpdates)
 		{
-			Sender->RegisterChannelForPositionUpdate(this);
+			// Batched updates only check the distance threshold, unless the frequency adapts to each actor.
+			if (!SpatialGDKSettings->bAdaptivePositionUpdateFrequency || IsPositionUpdateDue())
+			{
+				Sender->RegisterChannelForPositionUpdate(this);
+			}
 		}
 		else
 		{
@@ -593,10 +742,18 @@ int64 USpatialActorChannel::ReplicateActor()
 		}
 	}
 
+	// With push model enabled, clean actors skip property comparison (including handover and subobjects) entirely.
+	const bool bSkipPropertyCompare = bUsePushModel && !bPushModelDirty && !bCreatingNewEntity && !bForceCompareProperties
+		&& GetDefault<USpatialGDKSettings>()->bEnablePushModelReplication;
+
 	// Update the replicated property change list.
 	FRepChangelistState* ChangelistState = ActorReplicator->ChangelistMgr->GetRepChangelistState();
 
-	ActorReplicator->RepLayout->UpdateChangelistMgr(ActorReplicator->RepState->GetSendingRepState(), *ActorReplicator->ChangelistMgr, Actor, Connection->Driver->ReplicationFrame, RepFlags, bForceCompareProperties);
+	if (!bSkipPropertyCompare)
+	{
+		ActorReplicator->RepLayout->UpdateChangelistMgr(ActorReplicator->RepState->GetSendingRepState(), *ActorReplicator->ChangelistMgr, Actor, Connection->Driver->ReplicationFrame, RepFlags, bForceCompareProperties);
+	}
+
 	FSendingRepState* SendingRepState = ActorReplicator->RepState->GetSendingRepState();
 
 	const int32 PossibleNewHistoryIndex = SendingRepState->HistoryEnd % MaxSendingChangeHistory;
@@ -626,13 +783,32 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	FHandoverChangeState HandoverChangeState;
 
-	if (ActorHandoverShadowData != nullptr)
+	const bool bTrackHandoverData = !bSkipPropertyCompare && (bCreatingNewEntity || ShouldTrackHandoverData());
+
+	if (bTrackHandoverData)
 	{
-		HandoverChangeState = GetHandoverChangeList(*ActorHandoverShadowData, Actor);
+		if (ActorHandoverShadowData != nullptr)
+		{
+			HandoverChangeState = GetHandoverChangeList(*ActorHandoverShadowData, Actor);
+		}
+	}
+	else if (!bSkipPropertyCompare && ExtendedState.IsValid())
+	{
+		for (auto& ShadowDataPair : ExtendedState->HandoverShadowDataMap)
+		{
+			ReleaseHandoverShadowData(ShadowDataPair.Value.Get(), ShadowDataPair.Key.Get());
+		}
 	}
 
 	ReplicationBytesWritten = 0;
 
+	// The updates of the actor and its subobjects all go to the same entity, so they can be created and sent together.
+	const bool bBatchComponentUpdates = !bCreatingNewEntity;
+	if (bBatchComponentUpdates)
+	{
+		Sender->BeginComponentUpdateBatch(this);
+	}
+
 	// If any properties have changed, send a component update.
 	if (bCreatingNewEntity || RepChanged.Num() > 0 || HandoverChangeState.Num() > 0)
 	{
@@ -692,7 +868,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	{
 		bCreatingNewEntity = false;
 	}
-	else
+	else if (!bSkipPropertyCompare)
 	{
 		FOutBunch DummyOutBunch;
 
@@ -701,15 +877,22 @@ int64 USpatialActorChannel::ReplicateActor()
 		// on any of its replicating actor components. This allows the component to replicate any of its subobjects directly via
 		// the same SpatialActorChannel::ReplicateSubobject.
 		Actor->ReplicateSubobjects(this, &DummyOutBunch, &RepFlags);
+		AttachBatchedSubobjects();
 
-		for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+		TMap<UObject*, const FClassInfo*> HandoverSubobjects;
+		if (bTrackHandoverData && !bIsSimpleActor)
+		{
+			HandoverSubobjects = GetHandoverSubobjects();
+		}
+
+		for (auto& SubobjectInfoPair : HandoverSubobjects)
 		{
 			UObject* Subobject = SubobjectInfoPair.Key;
 			const FClassInfo& SubobjectInfo = *SubobjectInfoPair.Value;
 
 			// Handover shadow data should already exist for this object. If it doesn't, it must have
 			// started replicating after SetChannelActor was called on the owning actor.
-			TSharedRef<TArray<uint8>>* SubobjectHandoverShadowData = HandoverShadowDataMap.Find(Subobject);
+			TSharedRef<TArray<uint8>>* SubobjectHandoverShadowData = GetExtendedState().HandoverShadowDataMap.Find(Subobject);
 			if (SubobjectHandoverShadowData == nullptr)
 			{
 				UE_LOG(LogSpatialActorChannel, Warning, TEXT("EntityId: %lld Actor: %s HandoverShadowData not found for Subobject %s"), EntityId, *Actor->GetName(), *Subobject->GetName());
@@ -724,6 +907,8 @@ int64 USpatialActorChannel::ReplicateActor()
 		}
 
 		// Look for deleted subobjects
+		const bool bBatchDetach = GetDefault<USpatialGDKSettings>()->bBatchDynamicSubobjectAttachment;
+		TArray<const FClassInfo*> DeletedSubobjectInfos;
 		for (auto RepComp = ReplicationMap.CreateIterator(); RepComp; ++RepComp)
 		{
 			if (!RepComp.Value()->GetWeakObjectPtr().IsValid())
@@ -734,13 +919,31 @@ int64 USpatialActorChannel::ReplicateActor()
 				{
 					OnSubobjectDeleted(ObjectRef, RepComp.Key());
 
-					Sender->SendRemoveComponentForClassInfo(EntityId, NetDriver->ClassInfoManager->GetClassInfoByComponentId(ObjectRef.Offset));
+					const FClassInfo& SubobjectInfo = NetDriver->ClassInfoManager->GetClassInfoByComponentId(ObjectRef.Offset);
+					if (bBatchDetach)
+					{
+						DeletedSubobjectInfos.Add(&SubobjectInfo);
+					}
+					else
+					{
+						Sender->SendRemoveComponentForClassInfo(EntityId, SubobjectInfo);
+					}
 				}
 
 				RepComp.Value()->CleanUp();
 				RepComp.RemoveCurrent();
 			}
 		}
+
+		if (DeletedSubobjectInfos.Num() > 0)
+		{
+			Sender->SendRemoveComponentsForClassInfos(EntityId, DeletedSubobjectInfos);
+		}
+	}
+
+	if (bBatchComponentUpdates)
+	{
+		Sender->EndComponentUpdateBatch();
 	}
 
 	// TODO: the 'bWroteSomethingImportant' check causes problems for actors that need to transition in groups (ex. Character, PlayerController, PlayerState),
@@ -748,7 +951,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	if (NetDriver->LoadBalanceStrategy != nullptr &&
 		NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID))
 	{
-		if (!NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor) && !NetDriver->LockingPolicy->IsLocked(Actor))
+		if (!ConsumeShouldHaveAuthority() && !NetDriver->LoadBalanceStrategy->ShouldRetainAuthority(*Actor) && !NetDriver->LockingPolicy->IsLocked(Actor))
 		{
 			const AActor* NetOwner = Actor->GetNetOwner();
 
@@ -759,11 +962,12 @@ int64 USpatialActorChannel::ReplicateActor()
 			}
 
 			const float TimeSinceReceivingAuthInSeconds = double(FPlatformTime::Cycles64() - HierarchyAuthorityReceivedTimestamp) * FPlatformTime::GetSecondsPerCycle64();
-			const float MigrationBackoffTimeInSeconds = 1.0f;
+			const uint32 BackoffMultiplier = FMath::Clamp<uint32>(RepeatedAuthorityMigrationCount, 1, SpatialGDKSettings->MaxAuthorityMigrationBackoffMultiplier);
+			const float MigrationBackoffTimeInSeconds = SpatialGDKSettings->AuthorityMigrationBackoffTime * BackoffMultiplier;
 
 			if (TimeSinceReceivingAuthInSeconds < MigrationBackoffTimeInSeconds)
 			{
-				UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Tried to change auth too early for actor %s"), *Actor->GetName());
+				UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Tried to change auth too early for actor %s, backing off for %.2fs"), *Actor->GetName(), MigrationBackoffTimeInSeconds);
 			}
 			else
 			{
@@ -813,6 +1017,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	bIsReplicatingActor = false;
 
 	bForceCompareProperties = false;		// Only do this once per frame when set
+	bPushModelDirty = false;
 
 	if (ReplicationBytesWritten > 0)
 	{
@@ -848,6 +1053,15 @@ void USpatialActorChannel::DynamicallyAttachSubobject(UObject* Object)
 
 	check(Info != nullptr);
 
+	if (GetDefault<USpatialGDKSettings>()->bBatchDynamicSubobjectAttachment)
+	{
+		// Skipped by ReplicateSubobject until it's attached in AttachBatchedSubobjects.
+		FSpatialActorChannelExtendedState& State = GetExtendedState();
+		State.PendingDynamicSubobjects.Add(TWeakObjectPtr<UObject>(Object));
+		State.BatchedDynamicSubobjects.Emplace(Object, Info);
+		return;
+	}
+
 	// Check to see if we already have authority over the subobject to be added
 	if (NetDriver->StaticComponentView->HasAuthority(EntityId, Info->SchemaComponents[SCHEMA_Data]))
 	{
@@ -856,11 +1070,55 @@ void USpatialActorChannel::DynamicallyAttachSubobject(UObject* Object)
 	else
 	{
 		// If we don't, modify the entity ACL to gain authority.
-		PendingDynamicSubobjects.Add(TWeakObjectPtr<UObject>(Object));
+		GetExtendedState().PendingDynamicSubobjects.Add(TWeakObjectPtr<UObject>(Object));
 		Sender->GainAuthorityThenAddComponent(this, Object, Info);
 	}
 }
 
+void USpatialActorChannel::AttachBatchedSubobjects()
+{
+	if (!ExtendedState.IsValid() || ExtendedState->BatchedDynamicSubobjects.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<TPair<TWeakObjectPtr<UObject>, const FClassInfo*>>& BatchedDynamicSubobjects = ExtendedState->BatchedDynamicSubobjects;
+
+	TArray<TPair<UObject*, const FClassInfo*>> AuthoritativeSubobjects;
+	TArray<TPair<UObject*, const FClassInfo*>> SubobjectsToGainAuthorityOver;
+	AuthoritativeSubobjects.Reserve(BatchedDynamicSubobjects.Num());
+
+	for (const TPair<TWeakObjectPtr<UObject>, const FClassInfo*>& SubobjectInfoPair : BatchedDynamicSubobjects)
+	{
+		UObject* Object = SubobjectInfoPair.Key.Get();
+		if (Object == nullptr)
+		{
+			continue;
+		}
+
+		const FClassInfo* Info = SubobjectInfoPair.Value;
+		if (NetDriver->StaticComponentView->HasAuthority(EntityId, Info->SchemaComponents[SCHEMA_Data]))
+		{
+			AuthoritativeSubobjects.Emplace(Object, Info);
+		}
+		else
+		{
+			SubobjectsToGainAuthorityOver.Emplace(Object, Info);
+		}
+	}
+	BatchedDynamicSubobjects.Reset();
+
+	if (AuthoritativeSubobjects.Num() > 0)
+	{
+		Sender->SendAddComponentsForSubobjects(this, AuthoritativeSubobjects, ReplicationBytesWritten);
+	}
+
+	if (SubobjectsToGainAuthorityOver.Num() > 0)
+	{
+		Sender->GainAuthorityThenAddComponents(this, SubobjectsToGainAuthorityOver);
+	}
+}
+
 bool USpatialActorChannel::IsListening() const
 {
 	if (NetDriver->IsServer())
@@ -881,6 +1139,67 @@ bool USpatialActorChannel::IsListening() const
 	return false;
 }
 
+void FSpatialPropertyCompare::Run() const
+{
+	RepLayout->UpdateChangelistMgr(SendingRepState, *ChangelistMgr, Object, ReplicationFrame, RepFlags, bForceCompareProperties);
+}
+
+void USpatialActorChannel::GatherPropertyCompares(TArray<FSpatialPropertyCompare>& OutCompares)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelGatherPropertyCompares);
+
+	check(!bCreatingNewEntity);
+
+	if (Actor == nullptr || bActorIsPendingKill || Actor->IsPendingKillOrUnreachable())
+	{
+		return;
+	}
+
+	// These must match the flags ReplicateActor builds for an existing entity, otherwise the changelists are compared again.
+	FReplicationFlags RepFlags;
+	RepFlags.bNetOwner = true;
+	RepFlags.bNetSimulated = (Actor->GetRemoteRole() == ROLE_SimulatedProxy);
+#if ENGINE_MINOR_VERSION <= 23
+	RepFlags.bRepPhysics = Actor->ReplicatedMovement.bRepPhysics;
+#else
+	RepFlags.bRepPhysics = Actor->GetReplicatedMovement().bRepPhysics;
+#endif
+	const UWorld* const ActorWorld = Actor->GetWorld();
+	RepFlags.bReplay = ActorWorld && ActorWorld->DemoNetDriver == Connection->GetDriver();
+
+	const uint32 ReplicationFrame = Connection->Driver->ReplicationFrame;
+
+	// Only existing replicators are compared, new subobjects are attached by ReplicateSubobject on the game thread.
+	for (auto& ReplicatorPair : ReplicationMap)
+	{
+		UObject* Object = ReplicatorPair.Key;
+		FObjectReplicator& Replicator = ReplicatorPair.Value.Get();
+
+		if (Object == nullptr || Object->IsPendingKill() || !Replicator.RepState.IsValid() || IsDynamicSubobjectPending(Object))
+		{
+			continue;
+		}
+
+		OutCompares.Add(FSpatialPropertyCompare{ Replicator.RepLayout.Get(), Replicator.RepState->GetSendingRepState(), Replicator.ChangelistMgr.Get(),
+			Object, RepFlags, ReplicationFrame, bForceCompareProperties });
+	}
+}
+
+void USpatialActorChannel::SetPrecomputedShouldHaveAuthority(bool bShouldHaveAuthority)
+{
+	bPrecomputedShouldHaveAuthority = bShouldHaveAuthority;
+	bHasPrecomputedShouldHaveAuthority = true;
+	PrecomputedShouldHaveAuthorityFrame = Connection->Driver->ReplicationFrame;
+}
+
+bool USpatialActorChannel::ConsumeShouldHaveAuthority()
+{
+	const bool bHasPrecomputed = bHasPrecomputedShouldHaveAuthority && PrecomputedShouldHaveAuthorityFrame == Connection->Driver->ReplicationFrame;
+	bHasPrecomputedShouldHaveAuthority = false;
+
+	return bHasPrecomputed ? bPrecomputedShouldHaveAuthority : NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor);
+}
+
 bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicationFlags& RepFlags)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelReplicateSubobject);
@@ -912,7 +1231,7 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicatio
 		return false;
 	}
 
-	if (PendingDynamicSubobjects.Contains(Object))
+	if (IsDynamicSubobjectPending(Object))
 	{
 		// Still waiting on subobject to be attached so don't replicate
 		return false;
@@ -1066,6 +1385,13 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 
 	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
 
+	// Shadow data released by ReleaseHandoverShadowData no longer reflects what was last sent, so send everything again.
+	const bool bForceSendAll = bCreatingNewEntity || ShadowData.Num() == 0;
+	if (ShadowData.Num() == 0)
+	{
+		InitializeHandoverShadowData(ShadowData, Object);
+	}
+
 	uint32 ShadowDataOffset = 0;
 	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
 	{
@@ -1074,7 +1400,7 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
 		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
 		// Compare and assign.
-		if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
+		if (bForceSendAll || !PropertyInfo.Property->Identical(StoredData, Data))
 		{
 			HandoverChanged.Add(PropertyInfo.Handle);
 			PropertyInfo.Property->CopySingleValue(StoredData, Data);
@@ -1085,6 +1411,43 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 	return HandoverChanged;
 }
 
+void USpatialActorChannel::ReleaseHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object)
+{
+	if (ShadowData.Num() == 0 || Object == nullptr)
+	{
+		return;
+	}
+
+	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+
+	// Matches the layout set up in InitializeHandoverShadowData.
+	uint32 Offset = 0;
+	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	{
+		if (PropertyInfo.ArrayIdx == 0)
+		{
+			Offset = Align(Offset, PropertyInfo.Property->GetMinAlignment());
+			PropertyInfo.Property->DestroyValue(ShadowData.GetData() + Offset);
+			Offset += PropertyInfo.Property->GetSize();
+		}
+	}
+
+	ShadowData.Empty();
+}
+
+bool USpatialActorChannel::ShouldTrackHandoverData()
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bLazyHandoverShadowData || NetDriver->LoadBalanceStrategy == nullptr)
+	{
+		return true;
+	}
+
+	// An actor leaving the local region will have its authority intent changed in this update, so its handover data must be current.
+	const UAbstractLBStrategy* LBStrategy = NetDriver->LoadBalanceStrategy;
+	return LBStrategy->IsNearWorkerBoundary(*Actor, SpatialGDKSettings->HandoverShadowDataBoundaryDistance) || !LBStrategy->ShouldHaveAuthority(*Actor);
+}
+
 void USpatialActorChannel::SetChannelActor(AActor* InActor, ESetChannelActorFlags Flags)
 {
 	Super::SetChannelActor(InActor, Flags);
@@ -1110,26 +1473,78 @@ void USpatialActorChannel::SetChannelActor(AActor* InActor, ESetChannelActorFlag
 		NetDriver->UnregisterDormantEntityId(EntityId);
 	}
 
-	// Set up the shadow data for the handover properties. This is used later to compare the properties and send only changed ones.
-	check(!HandoverShadowDataMap.Contains(InActor));
-
-	// Create the shadow map, and store a quick access pointer to it
+	// Simple actors have no handover shadow data to set up, and only allocate the extended state if they get dynamic subobjects.
 	const FClassInfo& Info = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(InActor->GetClass());
-	if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
+	bIsSimpleActor = Info.bIsSimpleActor;
+	if (!bIsSimpleActor)
 	{
-		ActorHandoverShadowData = &HandoverShadowDataMap.Add(InActor, MakeShared<TArray<uint8>>()).Get();
-		InitializeHandoverShadowData(*ActorHandoverShadowData, InActor);
+		// Set up the shadow data for the handover properties. This is used later to compare the properties and send only changed ones.
+		TMap<TWeakObjectPtr<UObject>, TSharedRef<TArray<uint8>>>& HandoverShadowDataMap = GetExtendedState().HandoverShadowDataMap;
+		check(!HandoverShadowDataMap.Contains(InActor));
+
+		// Create the shadow map, and store a quick access pointer to it
+		if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
+		{
+			ActorHandoverShadowData = &HandoverShadowDataMap.Add(InActor, MakeShared<TArray<uint8>>()).Get();
+			InitializeHandoverShadowData(*ActorHandoverShadowData, InActor);
+		}
+
+		for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+		{
+			UObject* Subobject = SubobjectInfoPair.Key;
+
+			check(!HandoverShadowDataMap.Contains(Subobject));
+			InitializeHandoverShadowData(HandoverShadowDataMap.Add(Subobject, MakeShared<TArray<uint8>>()).Get(), Subobject);
+		}
 	}
 
-	for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+	SavedConnectionOwningWorkerId = SpatialGDK::GetConnectionOwningWorkerId(InActor);
+}
+
+FSpatialActorChannelExtendedState& USpatialActorChannel::GetExtendedState()
+{
+	if (!ExtendedState.IsValid())
 	{
-		UObject* Subobject = SubobjectInfoPair.Key;
+		ExtendedState = MakeUnique<FSpatialActorChannelExtendedState>();
+	}
+	return *ExtendedState;
+}
 
-		check(!HandoverShadowDataMap.Contains(Subobject));
-		InitializeHandoverShadowData(HandoverShadowDataMap.Add(Subobject, MakeShared<TArray<uint8>>()).Get(), Subobject);
+void USpatialActorChannel::RemovePendingDynamicSubobject(UObject* Object)
+{
+	if (ExtendedState.IsValid())
+	{
+		ExtendedState->PendingDynamicSubobjects.Remove(TWeakObjectPtr<UObject>(Object));
 	}
+}
 
-	SavedConnectionOwningWorkerId = SpatialGDK::GetConnectionOwningWorkerId(InActor);
+SIZE_T USpatialActorChannel::GetShadowDataAllocatedSize() const
+{
+	SIZE_T TotalBytes = LastSentPropertyValues.GetAllocatedSize() + ObjectReferenceMap.GetAllocatedSize();
+
+	for (const auto& Pair : LastSentPropertyValues)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+	}
+	for (const auto& Pair : ObjectReferenceMap)
+	{
+		const FSpatialObjectRepState& RepState = Pair.Value;
+		TotalBytes += RepState.ReferenceMap.GetAllocatedSize() + RepState.ReferencedObj.GetAllocatedSize() + RepState.UnresolvedRefs.GetAllocatedSize()
+			+ RepState.RefToReferenceMapOffsets.GetAllocatedSize();
+	}
+
+	if (ExtendedState.IsValid())
+	{
+		TotalBytes += sizeof(FSpatialActorChannelExtendedState) + ExtendedState->PendingDynamicSubobjects.GetAllocatedSize()
+			+ ExtendedState->BatchedDynamicSubobjects.GetAllocatedSize() + ExtendedState->HandoverShadowDataMap.GetAllocatedSize()
+			+ ExtendedState->FastArrayReplicationKeys.GetAllocatedSize();
+		for (const auto& Pair : ExtendedState->HandoverShadowDataMap)
+		{
+			TotalBytes += sizeof(TArray<uint8>) + Pair.Value->GetAllocatedSize();
+		}
+	}
+
+	return TotalBytes;
 }
 
 bool USpatialActorChannel::TryResolveActor()
@@ -1235,10 +1650,29 @@ void USpatialActorChannel::UpdateSpatialPosition()
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelUpdateSpatialPosition);
 
+	FVector ActorSpatialPosition;
+	FVector LastPosition;
+	if (!GetSpatialPositionForUpdate(ActorSpatialPosition, LastPosition))
+	{
+		return;
+	}
+
+	// Check that the Actor has moved sufficiently far to be updated
+	const float SpatialPositionThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
+	if (FVector::DistSquared(ActorSpatialPosition, LastPosition) < SpatialPositionThresholdSquared)
+	{
+		return;
+	}
+
+	CommitSpatialPositionUpdate(ActorSpatialPosition);
+}
+
+bool USpatialActorChannel::GetSpatialPositionForUpdate(FVector& OutPosition, FVector& OutLastPosition) const
+{
 	// Additional check to validate Actor is still present
 	if (Actor == nullptr || Actor->IsPendingKill())
 	{
-		return;
+		return false;
 	}
 
 	// When we update an Actor's position, we want to update the position of all the children of this Actor.
@@ -1253,19 +1687,18 @@ void USpatialActorChannel::UpdateSpatialPosition()
 		// position updated as this code will never be run for the parent.
 		if (!(Actor->GetNetConnection() == nullptr && ActorOwner != nullptr && !ActorOwner->GetIsReplicated()))
 		{
-			return;
+			return false;
 		}
 	}
 
-	// Check that the Actor has moved sufficiently far to be updated
-	const float SpatialPositionThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
-	FVector ActorSpatialPosition = SpatialGDK::GetActorSpatialPosition(Actor);
-	if (FVector::DistSquared(ActorSpatialPosition, LastPositionSinceUpdate) < SpatialPositionThresholdSquared)
-	{
-		return;
-	}
+	OutPosition = SpatialGDK::GetActorSpatialPosition(Actor);
+	OutLastPosition = LastPositionSinceUpdate;
+	return true;
+}
 
-	LastPositionSinceUpdate = ActorSpatialPosition;
+void USpatialActorChannel::CommitSpatialPositionUpdate(const FVector& NewPosition)
+{
+	LastPositionSinceUpdate = NewPosition;
 	TimeWhenPositionLastUpdated = NetDriver->Time;
 
 	SendPositionUpdate(Actor, EntityId, LastPositionSinceUpdate);
@@ -1350,10 +1783,18 @@ void USpatialActorChannel::ServerProcessOwnershipChange()
 		FWorkerComponentUpdate Update = NetOwningClientWorkerData->CreateNetOwningClientWorkerUpdate();
 		NetDriver->Connection->SendComponentUpdate(EntityId, &Update);
 
-		// Update the EntityACL component (if authoritative).
+		// Update the EntityACL component (if authoritative). The enforcer sends a single ACL update for the entity per tick however
+		// many times its owner changes, and none if the owner ends up where it started.
 		if (NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
 		{
-			Sender->UpdateClientAuthoritativeComponentAclEntries(EntityId, NewClientConnectionWorkerId);
+			if (NetDriver->LoadBalanceEnforcer.IsValid())
+			{
+				NetDriver->LoadBalanceEnforcer->QueueOwnershipAclAssignmentRequest(EntityId);
+			}
+			else
+			{
+				Sender->UpdateClientAuthoritativeComponentAclEntries(EntityId, NewClientConnectionWorkerId);
+			}
 		}
 
 		SavedConnectionOwningWorkerId = NewClientConnectionWorkerId;
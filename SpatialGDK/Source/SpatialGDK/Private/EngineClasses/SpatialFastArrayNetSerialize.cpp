@@ -8,6 +8,17 @@
 namespace SpatialGDK
 {
 
+const FFastArraySerializer* FSpatialNetDeltaSerializeInfo::GetFastArraySerializer(UObject* Object, int32 ArrayIndex, UProperty* ParentProperty)
+{
+	UStructProperty* ParentStruct = Cast<UStructProperty>(ParentProperty);
+	if (ParentStruct == nullptr || !ParentStruct->Struct->IsChildOf(FFastArraySerializer::StaticStruct()))
+	{
+		return nullptr;
+	}
+
+	return ParentStruct->ContainerPtrToValuePtr<FFastArraySerializer>(Object, ArrayIndex);
+}
+
 bool FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct)
 {
 	FSpatialNetDeltaSerializeInfo NetDeltaInfo;
@@ -2,6 +2,7 @@
 
 #include "EngineClasses/SpatialGameInstance.h"
 
+#include "Engine/Engine.h"
 #include "Engine/NetConnection.h"
 #include "GeneralProjectSettings.h"
 #include "Misc/Guid.h"
@@ -16,7 +17,9 @@
 #include "Interop/Connection/SpatialConnectionManager.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/GlobalStateManager.h"
+#include "Interop/SpatialClassInfoManager.h"
 #include "Interop/SpatialStaticComponentView.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialLatencyTracer.h"
 #include "Utils/SpatialMetrics.h"
@@ -82,6 +85,7 @@ bool USpatialGameInstance::HasSpatialNetDriver() const
 void USpatialGameInstance::CreateNewSpatialConnectionManager()
 {
 	SpatialConnectionManager = NewObject<USpatialConnectionManager>(this);
+	bHasSpatialNetworkFailure = false;
 
 	GlobalStateManager = NewObject<UGlobalStateManager>();
 	StaticComponentView = NewObject<USpatialStaticComponentView>();
@@ -106,6 +110,89 @@ void USpatialGameInstance::DestroySpatialConnectionManager()
 		StaticComponentView->ConditionalBeginDestroy();
 		StaticComponentView = nullptr;
 	}
+
+	ClassInfoManagerKeptForTravel = nullptr;
+	HostKeptForTravel.Empty();
+	bIsConnectionKeptForTravel = false;
+}
+
+bool USpatialGameInstance::KeepSpatialConnectionForTravel(USpatialClassInfoManager* InClassInfoManager, const FURL& URL)
+{
+	if (SpatialConnectionManager == nullptr || !SpatialConnectionManager->IsConnected() || bHasSpatialNetworkFailure)
+	{
+		return false;
+	}
+
+	UE_LOG(LogSpatialGameInstance, Log, TEXT("Keeping the connection to SpatialOS for the next map on %s"), *GetHostForTravel(URL));
+	ClassInfoManagerKeptForTravel = InClassInfoManager;
+	HostKeptForTravel = GetHostForTravel(URL);
+	bIsConnectionKeptForTravel = true;
+	return true;
+}
+
+USpatialClassInfoManager* USpatialGameInstance::TakeSpatialConnectionKeptForTravel(const FURL& URL)
+{
+	if (!bIsConnectionKeptForTravel)
+	{
+		return nullptr;
+	}
+
+	if (bHasSpatialNetworkFailure || GetHostForTravel(URL) != HostKeptForTravel)
+	{
+		UE_LOG(LogSpatialGameInstance, Log, TEXT("Not reusing the connection to SpatialOS kept for %s to travel to %s"), *HostKeptForTravel, *GetHostForTravel(URL));
+		DestroySpatialConnectionManager();
+		return nullptr;
+	}
+
+	USpatialClassInfoManager* KeptClassInfoManager = ClassInfoManagerKeptForTravel;
+	ClassInfoManagerKeptForTravel = nullptr;
+	HostKeptForTravel.Empty();
+	bIsConnectionKeptForTravel = false;
+	return KeptClassInfoManager;
+}
+
+void USpatialGameInstance::NotifyPreClientTravel(const FString& PendingURL, ETravelType TravelType, bool bIsSeamlessTravel)
+{
+	Super::NotifyPreClientTravel(PendingURL, TravelType, bIsSeamlessTravel);
+
+	// Seamless travel keeps the net driver, and with it the connection, already.
+	if (bIsSeamlessTravel || !GetDefault<USpatialGDKSettings>()->bKeepClientConnectionAcrossTravel)
+	{
+		return;
+	}
+
+	UWorld* CurrentWorld = GetWorld();
+	USpatialNetDriver* NetDriver = CurrentWorld != nullptr ? Cast<USpatialNetDriver>(CurrentWorld->GetNetDriver()) : nullptr;
+	if (NetDriver != nullptr && !NetDriver->IsServer())
+	{
+		// Decided here rather than when the net driver is destroyed, which only happens on a later garbage collection.
+		NetDriver->KeepSpatialConnectionForTravel(FURL(&CurrentWorld->URL, *PendingURL, TravelType));
+	}
+}
+
+FString USpatialGameInstance::GetHostForTravel(const FURL& URL)
+{
+	return FString::Printf(TEXT("%s:%d"), *URL.Host, URL.Port);
+}
+
+void USpatialGameInstance::OnPostLoadMap(UWorld* LoadedWorld)
+{
+	ReleaseServerTravelMapPackage();
+
+	// A map which connects to SpatialOS takes the kept connection before it's loaded, so one that's still kept won't be used.
+	if (bIsConnectionKeptForTravel && LoadedWorld != nullptr && LoadedWorld->GetGameInstance() == this)
+	{
+		UE_LOG(LogSpatialGameInstance, Log, TEXT("Disconnecting from SpatialOS, %s didn't reuse the connection kept for it"), *LoadedWorld->GetMapName());
+		DestroySpatialConnectionManager();
+	}
+}
+
+void USpatialGameInstance::OnNetworkFailure(UWorld* FailedWorld, UNetDriver* FailedNetDriver, ENetworkFailure::Type FailureType, const FString& ErrorString)
+{
+	if (FailedNetDriver != nullptr && FailedNetDriver->IsA<USpatialNetDriver>() && FailedWorld != nullptr && FailedWorld->GetGameInstance() == this)
+	{
+		bHasSpatialNetworkFailure = true;
+	}
 }
 
 #if WITH_EDITOR
@@ -214,6 +301,13 @@ void USpatialGameInstance::Init()
 	if (HasSpatialNetDriver())
 	{
 		FWorldDelegates::LevelInitializedNetworkActors.AddUObject(this, &USpatialGameInstance::OnLevelInitializedNetworkActors);
+
+		FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USpatialGameInstance::OnPostLoadMap);
+
+		if (GetDefault<USpatialGDKSettings>()->bKeepClientConnectionAcrossTravel)
+		{
+			GEngine->OnNetworkFailure().AddUObject(this, &USpatialGameInstance::OnNetworkFailure);
+		}
 	}
 }
 
@@ -8,6 +8,7 @@
 #include "Schema/NetOwningClientWorker.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/SubsystemStats.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialLoadBalanceEnforcer);
 
@@ -45,7 +46,7 @@ void SpatialLoadBalanceEnforcer::OnLoadBalancingComponentRemoved(const Worker_Re
 		UE_LOG(LogSpatialLoadBalanceEnforcer, Log,
 			TEXT("Component %d for entity %lld removed. Can no longer enforce the previous request for this entity."),
 			Op.component_id, Op.entity_id);
-		AclWriteAuthAssignmentRequests.Remove(Op.entity_id);
+		DequeueAclAssignmentRequest(Op.entity_id);
 	}
 }
 
@@ -55,7 +56,7 @@ void SpatialLoadBalanceEnforcer::OnEntityRemoved(const Worker_RemoveEntityOp& Op
 	{
 		UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Entity %lld removed. Can no longer enforce the previous request for this entity."),
 			Op.entity_id);
-		AclWriteAuthAssignmentRequests.Remove(Op.entity_id);
+		DequeueAclAssignmentRequest(Op.entity_id);
 	}
 }
 
@@ -71,7 +72,7 @@ void SpatialLoadBalanceEnforcer::OnAclAuthorityChanged(const Worker_AuthorityCha
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Log,
 				TEXT("ACL authority lost for entity %lld. Can no longer enforce the previous request for this entity."),
 				AuthOp.entity_id);
-			AclWriteAuthAssignmentRequests.Remove(AuthOp.entity_id);
+			DequeueAclAssignmentRequest(AuthOp.entity_id);
 		}
 		return;
 	}
@@ -123,107 +124,184 @@ void SpatialLoadBalanceEnforcer::MaybeQueueAclAssignmentRequest(const Worker_Ent
 	QueueAclAssignmentRequest(EntityId);
 }
 
+void SpatialLoadBalanceEnforcer::QueueOwnershipAclAssignmentRequest(const Worker_EntityId EntityId)
+{
+	if (!CanEnforce(EntityId) || AclAssignmentRequestIsQueued(EntityId))
+	{
+		return;
+	}
+
+	QueueAclAssignmentRequest(EntityId);
+}
+
 bool SpatialLoadBalanceEnforcer::AclAssignmentRequestIsQueued(const Worker_EntityId EntityId) const
 {
-	return AclWriteAuthAssignmentRequests.Contains(EntityId);
+	return QueuedAclAssignmentEntities.Contains(EntityId);
 }
 
 TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceEnforcer::ProcessQueuedAclAssignmentRequests()
 {
+	SPATIALGDK_SUBSYSTEM_SCOPE(LoadBalanceEnforcement);
+
+	QueueRequestsForRemappedVirtualWorkers();
+
 	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> PendingRequests;
 
-	TArray<Worker_EntityId> CompletedRequests;
+	TSet<Worker_EntityId_Key> CompletedRequests;
 	CompletedRequests.Reserve(AclWriteAuthAssignmentRequests.Num());
 
-	for (Worker_EntityId EntityId : AclWriteAuthAssignmentRequests)
+	auto ProcessRequests = [this, &PendingRequests, &CompletedRequests](TFunctionRef<bool(Worker_EntityId)> Predicate)
 	{
-		const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId);
-		if (AuthorityIntentComponent == nullptr)
+		for (Worker_EntityId EntityId : AclWriteAuthAssignmentRequests)
 		{
-			// This happens if the authority intent component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
-			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as AuthIntent component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
-			continue;
+			if (MaxAclAssignmentsPerTick > 0 && static_cast<uint32>(PendingRequests.Num()) >= MaxAclAssignmentsPerTick)
+			{
+				return;
+			}
+
+			if (!CompletedRequests.Contains(EntityId) && Predicate(EntityId) && ProcessAclAssignmentRequest(EntityId, PendingRequests))
+			{
+				CompletedRequests.Add(EntityId);
+			}
 		}
+	};
 
-		const SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerComponent = StaticComponentView->GetComponentData<SpatialGDK::NetOwningClientWorker>(EntityId);
-		if (NetOwningClientWorkerComponent == nullptr)
-		{
-			// This happens if the NetOwningClientWorker component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
-			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as NetOwningClientWorker component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
-			continue;
-		}
+	if (MaxAclAssignmentsPerTick > 0)
+	{
+		// When a worker takes over a region, migrate the entities players are controlling first.
+		ProcessRequests([this](Worker_EntityId EntityId) { return IsOwnedByClient(EntityId); });
+	}
+	ProcessRequests([](Worker_EntityId) { return true; });
 
-		const SpatialGDK::ComponentPresence* ComponentPresenceComponent = StaticComponentView->GetComponentData<SpatialGDK::ComponentPresence>(EntityId);
-		if (ComponentPresenceComponent == nullptr)
-		{
-			// This happens if the ComponentPresence component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
-			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as ComponentPresence component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
-			continue;
-		}
+	if (CompletedRequests.Num() > 0)
+	{
+		AclWriteAuthAssignmentRequests.RemoveAll([&CompletedRequests](const Worker_EntityId& EntityId) { return CompletedRequests.Contains(EntityId); });
+		QueuedAclAssignmentEntities = QueuedAclAssignmentEntities.Difference(CompletedRequests);
+	}
 
-		if (AuthorityIntentComponent->VirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
-		{
-			UE_LOG(LogSpatialLoadBalanceEnforcer, Warning, TEXT("Entity with invalid virtual worker ID assignment will not be processed. EntityId: %lld. This should not happen - investigate if you see this warning."), EntityId);
-			CompletedRequests.Add(EntityId);
-			continue;
-		}
+	return PendingRequests;
+}
 
-		check(VirtualWorkerTranslator != nullptr);
-		const PhysicalWorkerName* DestinationWorkerId = VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(AuthorityIntentComponent->VirtualWorkerId);
-		if (DestinationWorkerId == nullptr)
-		{
-			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("This worker is not assigned a virtual worker. This shouldn't happen! Worker: %s"), *WorkerId);
-			continue;
-		}
+bool SpatialLoadBalanceEnforcer::ProcessAclAssignmentRequest(Worker_EntityId EntityId, TArray<AclWriteAuthorityRequest>& OutPendingRequests) const
+{
+	const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId);
+	if (AuthorityIntentComponent == nullptr)
+	{
+		// This happens if the authority intent component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as AuthIntent component has been removed since the request was queued. EntityId: %lld"), EntityId);
+		return true;
+	}
 
-		if (!StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
-		{
-			UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Failed to update the EntityACL to match the authority intent; this worker lost authority over the EntityACL since the request was queued."
-				" Source worker ID: %s. Entity ID %lld. Desination worker ID: %s."), *WorkerId, EntityId, **DestinationWorkerId);
-			CompletedRequests.Add(EntityId);
-			continue;
-		}
+	const SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerComponent = StaticComponentView->GetComponentData<SpatialGDK::NetOwningClientWorker>(EntityId);
+	if (NetOwningClientWorkerComponent == nullptr)
+	{
+		// This happens if the NetOwningClientWorker component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as NetOwningClientWorker component has been removed since the request was queued. EntityId: %lld"), EntityId);
+		return true;
+	}
 
-		TArray<Worker_ComponentId> ComponentIds;
+	const SpatialGDK::ComponentPresence* ComponentPresenceComponent = StaticComponentView->GetComponentData<SpatialGDK::ComponentPresence>(EntityId);
+	if (ComponentPresenceComponent == nullptr)
+	{
+		// This happens if the ComponentPresence component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as ComponentPresence component has been removed since the request was queued. EntityId: %lld"), EntityId);
+		return true;
+	}
 
-		EntityAcl* Acl = StaticComponentView->GetComponentData<EntityAcl>(EntityId);
-		Acl->ComponentWriteAcl.GetKeys(ComponentIds);
+	if (AuthorityIntentComponent->VirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Warning, TEXT("Entity with invalid virtual worker ID assignment will not be processed. EntityId: %lld. This should not happen - investigate if you see this warning."), EntityId);
+		return true;
+	}
 
-		// Ensure that every component ID in ComponentPresence is set in the write ACL.
-		for (const auto& RequiredComponentId : ComponentPresenceComponent->ComponentList)
-		{
-			ComponentIds.AddUnique(RequiredComponentId);
-		}
+	check(VirtualWorkerTranslator != nullptr);
+	const PhysicalWorkerName* DestinationWorkerId = VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(AuthorityIntentComponent->VirtualWorkerId);
+	if (DestinationWorkerId == nullptr)
+	{
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("This worker is not assigned a virtual worker. This shouldn't happen! Worker: %s"), *WorkerId);
+		return false;
+	}
 
-		// Get the client worker ID net-owning this Actor from the NetOwningClientWorker.
-		PhysicalWorkerName PossessingClientId = NetOwningClientWorkerComponent->WorkerId.IsSet() ?
-			NetOwningClientWorkerComponent->WorkerId.GetValue() :
-			FString();
+	if (!StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+	{
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Failed to update the EntityACL to match the authority intent; this worker lost authority over the EntityACL since the request was queued."
+			" Source worker ID: %s. Entity ID %lld. Desination worker ID: %s."), *WorkerId, EntityId, **DestinationWorkerId);
+		return true;
+	}
 
-		PendingRequests.Push(
-			AclWriteAuthorityRequest{
-				EntityId,
-				*DestinationWorkerId,
-				Acl->ReadAcl,
-				{ { PossessingClientId } },
-				ComponentIds
-			});
+	TArray<Worker_ComponentId> ComponentIds;
 
-		CompletedRequests.Add(EntityId);
-	}
+	EntityAcl* Acl = StaticComponentView->GetComponentData<EntityAcl>(EntityId);
+	Acl->ComponentWriteAcl.GetKeys(ComponentIds);
 
-	AclWriteAuthAssignmentRequests.RemoveAll([CompletedRequests](const Worker_EntityId& EntityId) { return CompletedRequests.Contains(EntityId); });
+	// Ensure that every component ID in ComponentPresence is set in the write ACL.
+	for (const auto& RequiredComponentId : ComponentPresenceComponent->ComponentList)
+	{
+		ComponentIds.AddUnique(RequiredComponentId);
+	}
 
-	return PendingRequests;
+	// Get the client worker ID net-owning this Actor from the NetOwningClientWorker.
+	PhysicalWorkerName PossessingClientId = NetOwningClientWorkerComponent->WorkerId.IsSet() ?
+		NetOwningClientWorkerComponent->WorkerId.GetValue() :
+		FString();
+
+	OutPendingRequests.Push(
+		AclWriteAuthorityRequest{
+			EntityId,
+			*DestinationWorkerId,
+			Acl->ReadAcl,
+			{ { PossessingClientId } },
+			ComponentIds
+		});
+
+	return true;
 }
 
 void SpatialLoadBalanceEnforcer::QueueAclAssignmentRequest(const Worker_EntityId EntityId)
 {
 	UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("Queueing ACL assignment request for entity %lld on worker %s."), EntityId, *WorkerId);
 	AclWriteAuthAssignmentRequests.Add(EntityId);
+	QueuedAclAssignmentEntities.Add(EntityId);
+}
+
+void SpatialLoadBalanceEnforcer::DequeueAclAssignmentRequest(const Worker_EntityId EntityId)
+{
+	AclWriteAuthAssignmentRequests.Remove(EntityId);
+	QueuedAclAssignmentEntities.Remove(EntityId);
+}
+
+void SpatialLoadBalanceEnforcer::QueueRequestsForRemappedVirtualWorkers()
+{
+	const uint32 MappingVersion = VirtualWorkerTranslator->GetMappingVersion();
+	if (MappingVersion == EnforcedMappingVersion)
+	{
+		return;
+	}
+
+	// Entities enforced before the first mapping was received were queued as soon as it arrived.
+	const bool bIsFirstMapping = EnforcedMappingVersion == 0;
+	EnforcedMappingVersion = MappingVersion;
+	if (bIsFirstMapping || !StaticComponentView.IsValid())
+	{
+		return;
+	}
+
+	TArray<Worker_EntityId_Key> EntityIds;
+	StaticComponentView->GetEntityIds(EntityIds);
+	for (const Worker_EntityId_Key EntityId : EntityIds)
+	{
+		if (!StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+		{
+			continue;
+		}
+
+		// Virtual workers whose server worker left without a standby are enforced once a new server worker takes them over.
+		const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId);
+		if (AuthorityIntentComponent != nullptr && VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(AuthorityIntentComponent->VirtualWorkerId) != nullptr)
+		{
+			MaybeQueueAclAssignmentRequest(EntityId);
+		}
+	}
 }
 
 bool SpatialLoadBalanceEnforcer::CanEnforce(Worker_EntityId EntityId) const
@@ -238,10 +316,13 @@ bool SpatialLoadBalanceEnforcer::CanEnforce(Worker_EntityId EntityId) const
 		&& StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID);
 }
 
+bool SpatialLoadBalanceEnforcer::IsOwnedByClient(Worker_EntityId EntityId) const
+{
+	const SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerComponent = StaticComponentView->GetComponentData<SpatialGDK::NetOwningClientWorker>(EntityId);
+	return NetOwningClientWorkerComponent != nullptr && NetOwningClientWorkerComponent->WorkerId.IsSet() && !NetOwningClientWorkerComponent->WorkerId.GetValue().IsEmpty();
+}
+
 bool SpatialLoadBalanceEnforcer::HandlesComponent(Worker_ComponentId ComponentId) const
 {
-	return ComponentId == SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID
-		|| ComponentId == SpatialConstants::ENTITY_ACL_COMPONENT_ID
-		|| ComponentId == SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID
-		|| ComponentId == SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID;
+	return (SpatialConstants::GetReservedComponentTraits(ComponentId) & SpatialConstants::COMPONENT_TRAIT_LoadBalancing) != 0;
 }
@@ -28,7 +28,7 @@ void FSpatialNetBitReader::DeserializeObjectRef(FUnrealObjectRef& ObjectRef)
 		FString Path;
 		*this << Path;
 
-		ObjectRef.Path = Path;
+		ObjectRef.Path = FUnrealObjectRefPath(Path);
 	}
 
 	uint8 HasOuter;
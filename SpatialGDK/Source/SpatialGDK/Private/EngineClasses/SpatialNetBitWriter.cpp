@@ -12,6 +12,56 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialNetSerialize);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("NetBitWriter Allocations"), STAT_SpatialNetBitWriterAllocations, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NetBitWriter Reuses"), STAT_SpatialNetBitWriterReuses, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NetBitWriter Cached Object Refs"), STAT_SpatialNetBitWriterCachedObjectRefs, STATGROUP_SpatialNet);
+
+namespace
+{
+// Writers beyond this are freed on release rather than kept, nesting is shallow so a thread rarely holds more than a few at once.
+constexpr int32 MaxPooledWritersPerThread = 8;
+// Writers which grew past this, for a large fast array or RPC, are freed on release so the pool doesn't hold on to the memory.
+constexpr int64 MaxPooledWriterBits = 64 * 1024 * 8;
+
+TArray<TUniquePtr<FSpatialNetBitWriter>>& GetThreadFreeWriters()
+{
+	static thread_local TArray<TUniquePtr<FSpatialNetBitWriter>> FreeWriters;
+	return FreeWriters;
+}
+} // anonymous namespace
+
+TUniquePtr<FSpatialNetBitWriter> FSpatialNetBitWriterPool::Acquire(USpatialPackageMapClient* InPackageMap)
+{
+	TArray<TUniquePtr<FSpatialNetBitWriter>>& FreeWriters = GetThreadFreeWriters();
+	if (FreeWriters.Num() == 0)
+	{
+		INC_DWORD_STAT(STAT_SpatialNetBitWriterAllocations);
+		return MakeUnique<FSpatialNetBitWriter>(InPackageMap);
+	}
+
+	INC_DWORD_STAT(STAT_SpatialNetBitWriterReuses);
+	TUniquePtr<FSpatialNetBitWriter> Writer = FreeWriters.Pop(/* bAllowShrinking */ false);
+	Writer->Reset();
+	Writer->PackageMap = InPackageMap;
+	return Writer;
+}
+
+void FSpatialNetBitWriterPool::Release(TUniquePtr<FSpatialNetBitWriter> Writer)
+{
+	if (!Writer.IsValid())
+	{
+		return;
+	}
+
+	TArray<TUniquePtr<FSpatialNetBitWriter>>& FreeWriters = GetThreadFreeWriters();
+	if (FreeWriters.Num() < MaxPooledWritersPerThread && Writer->GetMaxBits() <= MaxPooledWriterBits)
+	{
+		// Pooled writers can outlive the net driver, so don't leave them pointing at its package map.
+		Writer->PackageMap = nullptr;
+		FreeWriters.Push(MoveTemp(Writer));
+	}
+}
+
 FSpatialNetBitWriter::FSpatialNetBitWriter(USpatialPackageMapClient* InPackageMap)
 	: FNetBitWriter(InPackageMap, 0)
 {}
@@ -26,7 +76,8 @@ void FSpatialNetBitWriter::SerializeObjectRef(FUnrealObjectRef& ObjectRef)
 	SerializeBits(&HasPath, 1);
 	if (HasPath)
 	{
-		*this << ObjectRef.Path.GetValue();
+		FString Path = ObjectRef.Path->ToString();
+		*this << Path;
 	}
 
 	uint8 HasOuter = ObjectRef.Outer.IsSet();
@@ -42,7 +93,27 @@ void FSpatialNetBitWriter::SerializeObjectRef(FUnrealObjectRef& ObjectRef)
 
 FArchive& FSpatialNetBitWriter::operator<<(UObject*& Value)
 {
-	FUnrealObjectRef ObjectRef = FUnrealObjectRef::FromObjectPtr(Value, Cast<USpatialPackageMapClient>(PackageMap));
+	USpatialPackageMapClient* SpatialPackageMap = Cast<USpatialPackageMapClient>(PackageMap);
+
+	if (Value != nullptr && SpatialPackageMap != nullptr)
+	{
+		if (const FSerializedObjectRef* CachedRef = SpatialPackageMap->FindSerializedStaticObjectRef(Value))
+		{
+			INC_DWORD_STAT(STAT_SpatialNetBitWriterCachedObjectRefs);
+			SerializeBits(const_cast<uint8*>(CachedRef->Data.GetData()), CachedRef->NumBits);
+			return *this;
+		}
+	}
+
+	FUnrealObjectRef ObjectRef = FUnrealObjectRef::FromObjectPtr(Value, SpatialPackageMap);
+
+	if (Value != nullptr && SpatialPackageMap != nullptr && USpatialPackageMapClient::CanCacheSerializedObjectRef(Value, ObjectRef))
+	{
+		FSpatialNetBitWriterPool::FScopedWriter RefWriter(SpatialPackageMap);
+		RefWriter->SerializeObjectRef(ObjectRef);
+		SpatialPackageMap->AddSerializedStaticObjectRef(Value, FSerializedObjectRef{ TArray<uint8>(RefWriter->GetData(), RefWriter->GetNumBytes()), RefWriter->GetNumBits() });
+	}
+
 	SerializeObjectRef(ObjectRef);
 
 	return *this;
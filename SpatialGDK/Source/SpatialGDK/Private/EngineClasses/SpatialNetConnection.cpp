@@ -10,6 +10,8 @@
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
 
+#include "Engine/LevelBounds.h"
+#include "Engine/LevelStreaming.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "TimerManager.h"
@@ -93,8 +95,23 @@ void USpatialNetConnection::UpdateLevelVisibility(const struct FUpdateLevelVisib
 	UNetConnection::UpdateLevelVisibility(PackageName, bIsVisible);
 #else
 	UNetConnection::UpdateLevelVisibility(LevelVisibility);
+	const FName PackageName = LevelVisibility.PackageName;
+	const bool bIsVisible = LevelVisibility.bIsVisible;
 #endif
 
+	if (GetDefault<USpatialGDKSettings>()->ClientLevelInterestActivationIntervalSeconds > 0.0f && TimerManager != nullptr)
+	{
+		if (bIsVisible)
+		{
+			OnLevelMadeVisible(PackageName);
+		}
+		else
+		{
+			OnLevelMadeInvisible(PackageName);
+		}
+		return;
+	}
+
 	// We want to update our interest as fast as possible
 	// So we send an Interest update immediately.
 
@@ -102,6 +119,74 @@ void USpatialNetConnection::UpdateLevelVisibility(const struct FUpdateLevelVisib
 	Sender->UpdateInterestComponent(Cast<AActor>(PlayerController));
 }
 
+bool USpatialNetConnection::IsLevelInterestPending(FName PackageName) const
+{
+	return PendingLevelInterest.Contains(PackageName);
+}
+
+void USpatialNetConnection::OnLevelMadeVisible(FName PackageName)
+{
+	if (IsLevelInterestPending(PackageName))
+	{
+		return;
+	}
+
+	FBox Bounds(ForceInit);
+	if (UWorld* World = Driver->GetWorld())
+	{
+		for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			if (StreamingLevel != nullptr && StreamingLevel->GetWorldAssetPackageFName() == PackageName && StreamingLevel->GetLoadedLevel() != nullptr)
+			{
+				Bounds = ALevelBounds::CalculateLevelBounds(StreamingLevel->GetLoadedLevel());
+				break;
+			}
+		}
+	}
+	PendingLevelInterest.Add(PackageName, Bounds);
+
+	// The first level is added straight away, the timer then adds the others at the activation interval.
+	if (!TimerManager->IsTimerActive(LevelInterestTimer))
+	{
+		ActivateNextPendingLevelInterest();
+	}
+}
+
+void USpatialNetConnection::OnLevelMadeInvisible(FName PackageName)
+{
+	PendingLevelInterest.Remove(PackageName);
+
+	USpatialSender* Sender = Cast<USpatialNetDriver>(Driver)->Sender;
+	Sender->UpdateInterestComponent(Cast<AActor>(PlayerController));
+}
+
+void USpatialNetConnection::ActivateNextPendingLevelInterest()
+{
+	if (PendingLevelInterest.Num() == 0)
+	{
+		return;
+	}
+
+	// The level the player is moving into is likely the nearest one, levels which aren't loaded on this server go last.
+	const APawn* Pawn = PlayerController != nullptr ? PlayerController->GetPawn() : nullptr;
+	PendingLevelInterest.PopNext(Pawn != nullptr ? TOptional<FVector>(Pawn->GetActorLocation()) : TOptional<FVector>());
+
+	if (PlayerController != nullptr)
+	{
+		USpatialSender* Sender = Cast<USpatialNetDriver>(Driver)->Sender;
+		Sender->UpdateInterestComponent(Cast<AActor>(PlayerController));
+	}
+
+	// The timer is set even when nothing is left pending, so a level made visible within the interval is staged too.
+	TimerManager->SetTimer(LevelInterestTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
+	{
+		if (USpatialNetConnection* Connection = WeakThis.Get())
+		{
+			Connection->ActivateNextPendingLevelInterest();
+		}
+	}, GetDefault<USpatialGDKSettings>()->ClientLevelInterestActivationIntervalSeconds, false);
+}
+
 void USpatialNetConnection::FlushDormancy(AActor* Actor)
 {
 	Super::FlushDormancy(Actor);
@@ -112,6 +197,7 @@ void USpatialNetConnection::FlushDormancy(AActor* Actor)
 	{
 		const bool bMakeDormant = false;
 		Cast<USpatialNetDriver>(Driver)->RefreshActorDormancy(Actor, bMakeDormant);
+		Cast<USpatialNetDriver>(Driver)->ScheduleActorForReplication(Actor);
 	}
 }
 
@@ -150,7 +236,14 @@ void USpatialNetConnection::InitHeartbeat(FTimerManager* InTimerManager, Worker_
 
 	if (Driver->IsServer())
 	{
-		SetHeartbeatTimeoutTimer();
+		if (SpatialGDK::FHeartbeatManager* HeartbeatManager = GetHeartbeatManager())
+		{
+			HeartbeatManager->AddConnection(this, FPlatformTime::Seconds());
+		}
+		else
+		{
+			SetHeartbeatTimeoutTimer();
+		}
 	}
 	else
 	{
@@ -186,7 +279,8 @@ void USpatialNetConnection::SetHeartbeatEventTimer()
 			ComponentUpdate.component_id = SpatialConstants::HEARTBEAT_COMPONENT_ID;
 			ComponentUpdate.schema_type = Schema_CreateComponentUpdate();
 			Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
-			Schema_AddObject(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
+			Schema_Object* HeartbeatEventObject = Schema_AddObject(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
+			Connection->AddBandwidthReport(HeartbeatEventObject);
 
 			USpatialWorkerConnection* WorkerConnection = Cast<USpatialNetDriver>(Connection->Driver)->Connection;
 			if (WorkerConnection != nullptr)
@@ -197,6 +291,53 @@ void USpatialNetConnection::SetHeartbeatEventTimer()
 	}, GetDefault<USpatialGDKSettings>()->HeartbeatIntervalSeconds, true, 0.0f);
 }
 
+void USpatialNetConnection::AddBandwidthReport(Schema_Object* HeartbeatEventObject)
+{
+	const float BudgetBytesPerSecond = GetDefault<USpatialGDKSettings>()->ClientInterestBandwidthBudgetBytesPerSecond;
+	USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(Driver);
+	if (BudgetBytesPerSecond <= 0.0f || NetDriver->Dispatcher == nullptr)
+	{
+		return;
+	}
+
+	const uint64 ReceivedBytes = NetDriver->Dispatcher->GetReceivedBytes();
+	const double Now = FPlatformTime::Seconds();
+	const double Elapsed = Now - LastReportTime;
+
+	// The first heartbeat is sent straight away, before there's an interval to measure the throughput over.
+	if (LastReportTime > 0.0 && Elapsed > 0.0)
+	{
+		const float ReceivedBytesPerSecond = static_cast<float>((ReceivedBytes - LastReportedReceivedBytes) / Elapsed);
+		Schema_AddFloat(HeartbeatEventObject, SpatialConstants::HEARTBEAT_EVENT_RECEIVED_BYTES_PER_SECOND_ID, ReceivedBytesPerSecond);
+		Schema_AddFloat(HeartbeatEventObject, SpatialConstants::HEARTBEAT_EVENT_BUDGET_BYTES_PER_SECOND_ID, BudgetBytesPerSecond);
+	}
+
+	LastReportedReceivedBytes = ReceivedBytes;
+	LastReportTime = Now;
+}
+
+void USpatialNetConnection::OnClientBandwidthReport(float ReceivedBytesPerSecond, float BudgetBytesPerSecond)
+{
+	if (!BandwidthBudget.IsSet())
+	{
+		BandwidthBudget.Emplace(GetDefault<USpatialGDKSettings>()->MinClientInterestFrequencyScale);
+	}
+
+	if (!BandwidthBudget->OnClientReport(ReceivedBytesPerSecond, BudgetBytesPerSecond))
+	{
+		return;
+	}
+
+	UE_LOG(LogSpatialNetConnection, Verbose, TEXT("Client %s received %.0f bytes per second with a budget of %.0f, scaling its interest frequencies by %.3f."),
+		*ConnectionOwningWorkerId, ReceivedBytesPerSecond, BudgetBytesPerSecond, BandwidthBudget->GetFrequencyScale());
+
+	if (PlayerController != nullptr)
+	{
+		USpatialSender* Sender = Cast<USpatialNetDriver>(Driver)->Sender;
+		Sender->UpdateInterestComponent(Cast<AActor>(PlayerController));
+	}
+}
+
 void USpatialNetConnection::DisableHeartbeat()
 {
 	// Remove the heartbeat callback
@@ -204,10 +345,30 @@ void USpatialNetConnection::DisableHeartbeat()
 	{
 		TimerManager->ClearTimer(HeartbeatTimer);
 	}
+	if (SpatialGDK::FHeartbeatManager* HeartbeatManager = GetHeartbeatManager())
+	{
+		HeartbeatManager->RemoveConnection(this);
+	}
 	PlayerControllerEntity = SpatialConstants::INVALID_ENTITY_ID;
 }
 
 void USpatialNetConnection::OnHeartbeat()
 {
+	if (SpatialGDK::FHeartbeatManager* HeartbeatManager = GetHeartbeatManager())
+	{
+		HeartbeatManager->OnHeartbeat(this, FPlatformTime::Seconds());
+		return;
+	}
+
 	SetHeartbeatTimeoutTimer();
 }
+
+SpatialGDK::FHeartbeatManager* USpatialNetConnection::GetHeartbeatManager() const
+{
+	if (USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(Driver))
+	{
+		return SpatialNetDriver->HeartbeatManager.Get();
+	}
+
+	return nullptr;
+}
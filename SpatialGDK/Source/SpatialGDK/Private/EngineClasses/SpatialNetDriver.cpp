@@ -2,6 +2,7 @@
 
 #include "EngineClasses/SpatialNetDriver.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/ChildConnection.h"
 #include "Engine/Engine.h"
@@ -10,7 +11,12 @@
 #include "EngineGlobals.h"
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/GameNetworkManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
 #include "Net/DataReplication.h"
 #include "Net/RepLayout.h"
 #include "SocketSubsystem.h"
@@ -35,6 +41,7 @@
 #include "LoadBalancing/GridBasedLBStrategy.h"
 #include "LoadBalancing/LayeredLBStrategy.h"
 #include "LoadBalancing/OwnershipLockingPolicy.h"
+#include "Schema/ServerWorker.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/ComponentFactory.h"
@@ -42,11 +49,13 @@
 #include "Utils/ErrorCodeRemapping.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/OpUtils.h"
+#include "Utils/PrioritizedEntrySelection.h"
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialLatencyTracer.h"
 #include "Utils/SpatialMetrics.h"
 #include "Utils/SpatialMetricsDisplay.h"
 #include "Utils/SpatialStatics.h"
+#include "Utils/SubsystemStats.h"
 
 #if WITH_EDITOR
 #include "Settings/LevelEditorPlaySettings.h"
@@ -55,8 +64,6 @@
 
 using SpatialGDK::ComponentFactory;
 using SpatialGDK::FindFirstOpOfType;
-using SpatialGDK::AppendAllOpsOfType;
-using SpatialGDK::FindFirstOpOfTypeForComponent;
 using SpatialGDK::InterestFactory;
 using SpatialGDK::RPCPayload;
 
@@ -65,8 +72,14 @@ DEFINE_LOG_CATEGORY(LogSpatialOSNetDriver);
 DECLARE_CYCLE_STAT(TEXT("ServerReplicateActors"), STAT_SpatialServerReplicateActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessPrioritizedActors"), STAT_SpatialProcessPrioritizedActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("PrioritizeActors"), STAT_SpatialPrioritizeActors, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("ParallelCompareProperties"), STAT_SpatialParallelCompareProperties, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("EvaluateAuthority"), STAT_SpatialEvaluateAuthority, STATGROUP_SpatialNet);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Oldest Unreplicated Actor Age"), STAT_SpatialOldestUnreplicatedActorAge, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessOps"), STAT_SpatialProcessOps, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Op Backlog"), STAT_SpatialOpBacklog, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("UpdateAuthority"), STAT_SpatialUpdateAuthority, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Active Actors"), STAT_SpatialActiveActors, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Dormant Actors"), STAT_SpatialDormantActors, STATGROUP_SpatialNet);
 DEFINE_STAT(STAT_SpatialConsiderList);
 DEFINE_STAT(STAT_SpatialActorsRelevant);
 DEFINE_STAT(STAT_SpatialActorsChanged);
@@ -84,6 +97,10 @@ USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer
 	, SessionId(0)
 	, NextRPCIndex(0)
 	, TimeWhenPositionLastUpdated(0.f)
+	, TimeWhenWorkerLoadLastReported(0.f)
+	, TimeWhenAuthorityLastPreStaged(0.f)
+	, TimeWhenServerWorkerHeartbeatLastSent(0.f)
+	, ServerWorkerHeartbeat(0)
 {
 	// Due to changes in 4.23, we now use an outdated flow in ComponentReader::ApplySchemaObject
 	// Native Unreal now iterates over all commands on clients, and no longer has access to a BaseHandleToCmdIndex
@@ -101,9 +118,12 @@ bool USpatialNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 
 	bConnectAsClient = bInitAsClient;
 
+	StartupTimeline.Start();
+
 	FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USpatialNetDriver::OnMapLoaded);
 
 	FWorldDelegates::LevelAddedToWorld.AddUObject(this, &USpatialNetDriver::OnLevelAddedToWorld);
+	FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &USpatialNetDriver::OnLevelRemovedFromWorld);
 
 	if (GetWorld() != nullptr)
 	{
@@ -141,18 +161,51 @@ bool USpatialNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 	// from OnConnectionToSpatialOSSucceeded callback which could be executed with the async
 	// loading thread suspended (e.g. when resuming rendering thread), in which
 	// case we'll crash upon trying to load SchemaDatabase.
-	ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	ClassInfoManager = nullptr;
+	if (bInitAsClient && GetDefault<USpatialGDKSettings>()->bKeepClientConnectionAcrossTravel)
+	{
+		if (USpatialGameInstance* GameInstance = GetGameInstance())
+		{
+			// When traveling within the same deployment, the previous map's connection is reused along with its class info and SchemaDatabase.
+			ClassInfoManager = GameInstance->TakeSpatialConnectionKeptForTravel(URL);
+			bTookSpatialConnectionKeptForTravel = ClassInfoManager != nullptr;
+			bPersistSpatialConnection = bPersistSpatialConnection || bTookSpatialConnectionKeptForTravel;
+		}
+	}
+
+	if (ClassInfoManager == nullptr)
+	{
+		ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	}
+
+#if WITH_EDITOR
+	PlayInEditorID = GPlayInEditorID;
+#endif
+
+	// The connection only reports success through a game thread task, which can't run until InitBase has returned, so the
+	// SchemaDatabase is always loaded by the time OnConnectionToSpatialOSSucceeded is called.
+	const bool bConnectBeforeSchemaLoad = GetDefault<USpatialGDKSettings>()->bOverlapStartupPhases && !ShouldWaitForLocalDeployment();
+	if (bConnectBeforeSchemaLoad)
+	{
+		InitiateConnectionToSpatialOS(URL);
+	}
 
 	// If it fails to load, don't attempt to connect to spatial.
 	if (!ClassInfoManager->TryInit(this))
 	{
+		if (bConnectBeforeSchemaLoad && ConnectionManager != nullptr)
+		{
+			ConnectionManager->OnConnectedCallback.Unbind();
+			ConnectionManager->OnFailedToConnectCallback.Unbind();
+		}
+
 		Error = TEXT("Failed to load Spatial SchemaDatabase! Make sure that schema has been generated for your project");
 		return false;
 	}
 
-#if WITH_EDITOR
-	PlayInEditorID = GPlayInEditorID;
+	StartupTimeline.MarkPhase(TEXT("SchemaDatabaseLoaded"));
 
+#if WITH_EDITOR
 	// If we're launching in PIE then ensure there is a deployment running before connecting.
 	if (FSpatialGDKServicesModule* GDKServices = FModuleManager::GetModulePtr<FSpatialGDKServicesModule>("SpatialGDKServices"))
 	{
@@ -184,11 +237,25 @@ bool USpatialNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 	TombstonedEntities.Reserve(EDITOR_TOMBSTONED_ENTITY_TRACKING_RESERVATION_COUNT);
 #endif
 
-	InitiateConnectionToSpatialOS(URL);
+	if (!bConnectBeforeSchemaLoad)
+	{
+		InitiateConnectionToSpatialOS(URL);
+	}
 
 	return true;
 }
 
+bool USpatialNetDriver::ShouldWaitForLocalDeployment() const
+{
+#if WITH_EDITOR
+	if (FSpatialGDKServicesModule* GDKServices = FModuleManager::GetModulePtr<FSpatialGDKServicesModule>("SpatialGDKServices"))
+	{
+		return GDKServices->GetLocalDeploymentManager()->ShouldWaitForDeployment();
+	}
+#endif
+	return false;
+}
+
 USpatialGameInstance* USpatialNetDriver::GetGameInstance() const
 {
 	USpatialGameInstance* GameInstance = nullptr;
@@ -220,7 +287,7 @@ void USpatialNetDriver::InitiateConnectionToSpatialOS(const FURL& URL)
 
 	if (bConnectAsClient)
 	{
-		bPersistSpatialConnection = URL.HasOption(*SpatialConstants::ClientsStayConnectedURLOption);
+		bPersistSpatialConnection = bPersistSpatialConnection || URL.HasOption(*SpatialConstants::ClientsStayConnectedURLOption);
 	}
 
 	if (GameInstance->GetSpatialConnectionManager() == nullptr)
@@ -238,6 +305,11 @@ void USpatialNetDriver::InitiateConnectionToSpatialOS(const FURL& URL)
 	}
 
 	ConnectionManager = GameInstance->GetSpatialConnectionManager();
+	if (bConnectAsClient && GetDefault<USpatialGDKSettings>()->bKeepClientConnectionAcrossTravel)
+	{
+		// Needed to deliver the view again to the next map's net driver if the connection is kept.
+		GameInstance->GetStaticComponentView()->SetKeepAllComponentData(true);
+	}
 	ConnectionManager->OnConnectedCallback.BindUObject(this, &USpatialNetDriver::OnConnectionToSpatialOSSucceeded);
 	ConnectionManager->OnFailedToConnectCallback.BindUObject(this, &USpatialNetDriver::OnConnectionToSpatialOSFailed);
 
@@ -250,6 +322,7 @@ void USpatialNetDriver::InitiateConnectionToSpatialOS(const FURL& URL)
 	GameInstance->TryInjectSpatialLocatorIntoCommandLine();
 
 	UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Attempting connection to SpatialOS"));
+	StartupTimeline.MarkPhase(TEXT("ConnectionStarted"));
 
 	if (GameInstance->GetShouldConnectUsingCommandLineArgs())
 	{
@@ -288,6 +361,29 @@ void USpatialNetDriver::OnConnectionToSpatialOSSucceeded()
 	Connection = ConnectionManager->GetWorkerConnection();
 	check(Connection);
 
+	if (bClientRejoinConnectionInFlight)
+	{
+		bClientRejoinConnectionInFlight = false;
+		if (!bWaitingForClientRejoinConnection)
+		{
+			// The rejoin was given up on while connecting, and the failure has been reported already.
+			return;
+		}
+
+		// The core classes and the world are kept, so only the player needs to be set up again.
+		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Reconnected to SpatialOS as %s, requesting the player controller back."), *Connection->GetWorkerId());
+
+		bWaitingForClientRejoinConnection = false;
+		bReconcilingClientRejoin = true;
+		ClientRejoinDeadline = FPlatformTime::Seconds() + GetDefault<USpatialGDKSettings>()->ClientRejoinGracePeriod;
+		ClientRejoinSpawnResponseTime = 0.0;
+
+		PlayerSpawner->SendPlayerSpawnRequest();
+		return;
+	}
+
+	StartupTimeline.MarkPhase(TEXT("Connected"));
+
 	// If we're the server, we will spawn the special Spatial connection that will route all updates to SpatialOS.
 	// There may be more than one of these connections in the future for different replication conditions.
 	if (!bConnectAsClient)
@@ -296,6 +392,14 @@ void USpatialNetDriver::OnConnectionToSpatialOSSucceeded()
 	}
 
 	CreateAndInitializeCoreClasses();
+	StartupTimeline.MarkPhase(TEXT("CoreClassesInitialized"));
+
+	if (bTookSpatialConnectionKeptForTravel)
+	{
+		// The runtime won't send the entities already in view again, so they're delivered from the view once the map has loaded.
+		StaticComponentView->CreateViewOps(KeptViewOps, KeptViewComponentData);
+		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Took over the connection kept for travel with %d entities in view."), StaticComponentView->GetNumEntities());
+	}
 
 	// Query the GSM to figure out what map to load
 	if (bConnectAsClient)
@@ -308,8 +412,25 @@ void USpatialNetDriver::OnConnectionToSpatialOSSucceeded()
 	GameInstance->HandleOnConnected();
 }
 
+void USpatialNetDriver::KeepSpatialConnectionForTravel(const FURL& NextURL)
+{
+	USpatialGameInstance* GameInstance = GetGameInstance();
+	if (!bPersistSpatialConnection && GameInstance != nullptr && GameInstance->KeepSpatialConnectionForTravel(ClassInfoManager, NextURL))
+	{
+		bPersistSpatialConnection = true;
+	}
+}
+
 void USpatialNetDriver::OnConnectionToSpatialOSFailed(uint8_t ConnectionStatusCode, const FString& ErrorMessage)
 {
+	if (bClientRejoinConnectionInFlight)
+	{
+		UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("Failed to reconnect to SpatialOS: %s"), *ErrorMessage);
+		bClientRejoinConnectionInFlight = false;
+		NextClientRejoinAttemptTime = FPlatformTime::Seconds() + SpatialConstants::CLIENT_REJOIN_RETRY_INTERVAL_SECONDS;
+		return;
+	}
+
 	if (USpatialGameInstance* GameInstance = GetGameInstance())
 	{
 		if (GEngine != nullptr && GameInstance->GetWorld() != nullptr)
@@ -393,9 +514,21 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 	if (SpatialSettings->UseRPCRingBuffer())
 	{
 		RPCService = MakeUnique<SpatialGDK::SpatialRPCService>(ExtractRPCDelegate::CreateUObject(Receiver, &USpatialReceiver::OnExtractIncomingRPC), StaticComponentView, USpatialLatencyTracer::GetTracer(GetWorld()));
+
+		if (SpatialSettings->bUseRingBufferCrossServerRPCs && IsServer())
+		{
+			CrossServerRPCService = MakeUnique<SpatialGDK::CrossServerRPCService>(ExtractRPCDelegate::CreateUObject(Receiver, &USpatialReceiver::OnExtractIncomingRPC), StaticComponentView);
+			CrossServerRPCService->SetVirtualWorkerTranslator(VirtualWorkerTranslator.Get());
+		}
+	}
+
+	if (SpatialSettings->bCompactStartupActorTombstones)
+	{
+		StartupActorTombstones = MakeUnique<SpatialGDK::FStartupActorTombstones>(this);
 	}
 
 	Dispatcher->Init(Receiver, StaticComponentView, SpatialMetrics, SpatialWorkerFlags);
+	Dispatcher->SetCountReceivedBytes(!IsServer() && SpatialSettings->ClientInterestBandwidthBudgetBytesPerSecond > 0.0f);
 	Sender->Init(this, &TimerManager, RPCService.Get());
 	Receiver->Init(this, &TimerManager, RPCService.Get());
 	GlobalStateManager->Init(this);
@@ -404,6 +537,128 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 	PlayerSpawner->OnPlayerSpawnFailed.BindUObject(GameInstance, &USpatialGameInstance::HandleOnPlayerSpawnFailed);
 	SpatialMetrics->Init(Connection, NetServerMaxTickRate, IsServer());
 	SpatialMetrics->ControllerRefProvider.BindUObject(this, &USpatialNetDriver::GetCurrentPlayerControllerRef);
+	SpatialMetrics->EntityClassNameProvider.BindUObject(this, &USpatialNetDriver::GetEntityClassName);
+	SpatialMetrics->AuthoritativeEntityCountProvider.BindUObject(this, &USpatialNetDriver::GetAuthoritativeEntityCount);
+
+	if (RPCService.IsValid())
+	{
+		RegisterOverflowedRPCMetrics();
+	}
+
+	if (SpatialSettings->bEnableMetrics)
+	{
+		OpsPerTickHistogram = &SpatialMetrics->AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_OPS_PER_TICK,
+			{ 0, 10, 100, 1000, 10000, 100000 });
+		Receiver->SetIncomingRPCQueueTimeHistogram(&SpatialMetrics->AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_INCOMING_RPC_QUEUE_TIME,
+			{ 0.0, 0.01, 0.05, 0.1, 0.5, 1.0, 5.0 }));
+
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_RELIABLE_RPC_RETRIES, UserSuppliedMetric::CreateUObject(Sender, &USpatialSender::GetNumRetriedRPCs));
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_QUEUED_RELIABLE_RPC_RETRIES, UserSuppliedMetric::CreateUObject(Sender, &USpatialSender::GetNumQueuedRetryRPCs));
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_DEDUPLICATED_RELIABLE_RPC_RETRIES, UserSuppliedMetric::CreateUObject(Sender, &USpatialSender::GetNumDeduplicatedRetryRPCs));
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_EXPIRED_RPCS, UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetExpiredRPCCount));
+
+		if (SpatialSettings->bTimeSliceOpProcessing)
+		{
+			SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_OP_BACKLOG, UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetOpBacklogSize));
+		}
+
+		if (IsServer())
+		{
+			SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_PLAYER_SPAWNS_PER_SECOND, UserSuppliedMetric::CreateUObject(PlayerSpawner, &USpatialPlayerSpawner::GetPlayerSpawnsPerSecond));
+			if (SpatialSettings->bQueuePlayerSpawnRequests)
+			{
+				SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_QUEUED_PLAYER_SPAWN_REQUESTS, UserSuppliedMetric::CreateUObject(PlayerSpawner, &USpatialPlayerSpawner::GetNumQueuedPlayerSpawnRequests));
+			}
+		}
+
+		if (LoadBalanceEnforcer.IsValid())
+		{
+			SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_QUEUED_ACL_ASSIGNMENTS,
+				UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetNumQueuedAclAssignments));
+			AclAssignmentsPerTickHistogram = &SpatialMetrics->AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_ACL_ASSIGNMENTS_PER_TICK,
+				{ 0, 10, 100, 1000, 10000 });
+		}
+	}
+
+	if (SpatialSettings->bAsyncLoadNewClassesOnEntityCheckout)
+	{
+		UserSuppliedMetric OldestAsyncLoadWaitTimeDelegate;
+		OldestAsyncLoadWaitTimeDelegate.BindUObject(Receiver, &USpatialReceiver::GetOldestAsyncLoadWaitTime);
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_OLDEST_ASYNC_LOAD_WAIT_TIME, OldestAsyncLoadWaitTimeDelegate);
+	}
+
+	if (IsServer() && SpatialSettings->UseReplicationBudget())
+	{
+		ReplicationBudgetScheduler = MakeUnique<SpatialGDK::FReplicationBudgetScheduler>(SpatialSettings->ReplicationTimeBudgetMs / 1000.f, SpatialSettings->ReplicationByteBudget, SpatialSettings->ReplicationStarvationThresholdSeconds);
+
+		UserSuppliedMetric OldestUnreplicatedActorAgeDelegate;
+		OldestUnreplicatedActorAgeDelegate.BindUObject(this, &USpatialNetDriver::GetOldestUnreplicatedActorAge);
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_OLDEST_UNREPLICATED_ACTOR_AGE, OldestUnreplicatedActorAgeDelegate);
+	}
+
+	if (IsServer() && SpatialSettings->bUseActorReplicationSchedule)
+	{
+		ActorReplicationSchedule = MakeUnique<SpatialGDK::FActorReplicationSchedule>();
+
+		// Actors added to the network object list from now on are scheduled by AddNetworkActor.
+		for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+		{
+			ActorReplicationSchedule->Schedule(ObjectInfo->Actor, 0.0);
+		}
+	}
+
+	if (IsServer() && SpatialSettings->bThrottleUnobservedActors)
+	{
+		ClientObservationTracker = MakeUnique<SpatialGDK::FClientObservationTracker>(SpatialSettings->UnobservedActorWakeUpMargin);
+	}
+
+	if (SpatialSettings->bEnableHitchCapture)
+	{
+		HitchCapture = MakeUnique<SpatialGDK::FHitchCapture>(SpatialSettings->HitchCaptureFrameCount, SpatialSettings->HitchCaptureThresholdMs,
+			SpatialSettings->HitchCaptureMinSecondsBetweenReports);
+		Dispatcher->SetHitchCapture(HitchCapture.Get());
+	}
+
+	if (IsServer() && SpatialSettings->bEnableRuntimeCheckpoints)
+	{
+		const FString CheckpointDirectory = SpatialSettings->RuntimeCheckpointDirectory.IsEmpty() ? SpatialGDK::FFileCheckpointStorage::GetDefaultDirectory() : SpatialSettings->RuntimeCheckpointDirectory;
+		RuntimeCheckpointer = MakeUnique<SpatialGDK::FRuntimeCheckpointer>(MakeUnique<SpatialGDK::FFileCheckpointStorage>(CheckpointDirectory, Connection->GetWorkerId()),
+			SpatialSettings->RuntimeCheckpointIntervalSeconds, SpatialSettings->RuntimeCheckpointChunkSize, SpatialSettings->RuntimeCheckpointMaxEntitiesPerSecond);
+		Dispatcher->SetRuntimeCheckpointer(RuntimeCheckpointer.Get());
+		Connection->SetRuntimeCheckpointer(RuntimeCheckpointer.Get());
+	}
+
+	if (SpatialSettings->bEnableHotEntityTracking)
+	{
+		HotEntityTracker = MakeUnique<SpatialGDK::FHotEntityTracker>(SpatialSettings->HotEntityWindowSeconds);
+		SpatialMetrics->SetHotEntityTracker(HotEntityTracker.Get());
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_HOT_ENTITIES, UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetNumHotEntities));
+	}
+
+	if (IsServer() && SpatialSettings->bAggregateServerHeartbeats)
+	{
+		float HeartbeatTimeout = SpatialSettings->HeartbeatTimeoutSeconds;
+#if WITH_EDITOR
+		HeartbeatTimeout = SpatialSettings->HeartbeatTimeoutWithEditorSeconds;
+#endif
+		HeartbeatManager = MakeUnique<SpatialGDK::FHeartbeatManager>(HeartbeatTimeout);
+
+		FTimerHandle HeartbeatSweepTimer;
+		TimerManager.SetTimer(HeartbeatSweepTimer, [WeakThis = TWeakObjectPtr<USpatialNetDriver>(this)]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->SweepHeartbeats();
+			}
+		}, SpatialConstants::HEARTBEAT_SWEEP_INTERVAL_SECONDS, true);
+	}
+
+	if (Receiver->GetEntityCreationLimiter() != nullptr)
+	{
+		UserSuppliedMetric EntityCreationLimitDelegate;
+		EntityCreationLimitDelegate.BindUObject(this, &USpatialNetDriver::GetEntityCreationLimit);
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_ENTITY_CREATION_LIMIT, EntityCreationLimitDelegate);
+	}
 
 	// PackageMap value has been set earlier in USpatialNetConnection::InitBase
 	// Making sure the value is the same
@@ -418,6 +673,17 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 
 	// The interest factory depends on the package map, so is created last.
 	InterestFactory = MakeUnique<SpatialGDK::InterestFactory>(ClassInfoManager, PackageMap);
+
+	if (SpatialSettings->bEnableMetrics && SpatialSettings->bOptimizeInterestQueries && IsServer())
+	{
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_MAX_CLIENT_INTEREST_QUERIES, UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetMaxClientInterestQueryCount));
+	}
+
+	// Servers have already loaded their map by the time the net driver is created, so OnMapLoaded won't be called for it.
+	if (GetDefault<USpatialGDKSettings>()->bPrewarmClassInfo && GetWorld() != nullptr)
+	{
+		ClassInfoManager->QueueClassInfoPrewarm(GetWorld());
+	}
 }
 
 void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
@@ -435,6 +701,7 @@ void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
 	if (IsServer())
 	{
 		LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(Connection->GetWorkerId(), StaticComponentView, VirtualWorkerTranslator.Get());
+		LoadBalanceEnforcer->SetMaxAclAssignmentsPerTick(GetDefault<USpatialGDKSettings>()->MaxAclAssignmentsPerTick);
 
 		const bool bIsMultiWorkerEnabled = WorldSettings != nullptr && WorldSettings->IsMultiWorkerEnabled();
 		if (!bIsMultiWorkerEnabled)
@@ -688,7 +955,18 @@ void USpatialNetDriver::OnMapLoaded(UWorld* LoadedWorld)
 		}
 	}
 
+	if (GetDefault<USpatialGDKSettings>()->bPrewarmClassInfo)
+	{
+		ClassInfoManager->QueueClassInfoPrewarm(LoadedWorld);
+	}
+
 	bMapLoaded = true;
+
+	if (!IsServer() && !StartupTimeline.HasPhase(TEXT("MapLoaded")))
+	{
+		StartupTimeline.MarkPhase(TEXT("MapLoaded"));
+		StartupTimeline.LogTimeline(TEXT("Client"));
+	}
 }
 
 void USpatialNetDriver::MakePlayerSpawnRequest()
@@ -701,11 +979,26 @@ void USpatialNetDriver::MakePlayerSpawnRequest()
 	}
 }
 
+void USpatialNetDriver::OnLevelRemovedFromWorld(ULevel* RemovedLevel, UWorld* OwningWorld)
+{
+	// RemovedLevel is null when the whole world is cleaned up, which clears the cache too.
+	if (OwningWorld == World && PackageMap != nullptr)
+	{
+		PackageMap->ClearSerializedStaticObjectRefs();
+	}
+}
+
 void USpatialNetDriver::OnLevelAddedToWorld(ULevel* LoadedLevel, UWorld* OwningWorld)
 {
 	UE_LOG(LogSpatialOSNetDriver, Log, TEXT("OnLevelAddedToWorld: Level (%s) OwningWorld (%s) World (%s)"),
 		*GetNameSafe(LoadedLevel), *GetNameSafe(OwningWorld), *GetNameSafe(World));
 
+	if (OwningWorld == World && StartupActorTombstones.IsValid())
+	{
+		// Clients and servers both need to drop the startup actors destroyed while the level wasn't loaded.
+		StartupActorTombstones->DestroyTombstonedActors(LoadedLevel);
+	}
+
 	if (OwningWorld != World
 		|| !IsServer()
 		|| GlobalStateManager == nullptr)
@@ -732,6 +1025,11 @@ void USpatialNetDriver::OnLevelAddedToWorld(ULevel* LoadedLevel, UWorld* OwningW
 			const bool bRoleAuthoritative = LoadBalanceStrategy->ShouldHaveAuthority(*Actor);
 			Actor->Role = bRoleAuthoritative ? ROLE_Authority : ROLE_SimulatedProxy;
 			Actor->RemoteRole = bRoleAuthoritative ? ROLE_SimulatedProxy : ROLE_Authority;
+
+			if (bRoleAuthoritative)
+			{
+				ScheduleActorForReplication(Actor);
+			}
 		}
 	}
 }
@@ -785,6 +1083,11 @@ void USpatialNetDriver::SpatialProcessServerTravel(const FString& URL, bool bAbs
 
 	FGuid NextMapGuid = UEngine::GetPackageGuid(FName(*NextMap), World->IsPlayInEditor());
 
+	if (GetDefault<USpatialGDKSettings>()->bPreloadServerTravelMap && !World->IsPlayInEditor())
+	{
+		PreloadServerTravelMap(World, NextMap);
+	}
+
 	FString NewURL = URL;
 
 	if (!NewURL.Contains(SpatialConstants::SpatialSessionIdURLOption))
@@ -830,12 +1133,42 @@ void USpatialNetDriver::SpatialProcessServerTravel(const FString& URL, bool bAbs
 #endif // WITH_SERVER_CODE
 }
 
+void USpatialNetDriver::PreloadServerTravelMap(UWorld* World, const FString& MapName)
+{
+	FString PackageName = MapName;
+	if (FPackageName::IsShortPackageName(PackageName) && !FPackageName::SearchForPackageOnDisk(MapName, &PackageName))
+	{
+		UE_LOG(LogGameMode, Warning, TEXT("SpatialServerTravel - Could not find %s to preload it"), *MapName);
+		return;
+	}
+
+	// The package is held by the game instance, as loading the map collects garbage once the current world is cleaned up.
+	TWeakObjectPtr<USpatialGameInstance> WeakGameInstance = Cast<USpatialGameInstance>(World->GetGameInstance());
+	LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda([WeakGameInstance](const FName& LoadedPackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+	{
+		if (Result != EAsyncLoadingResult::Succeeded || LoadedPackage == nullptr)
+		{
+			UE_LOG(LogGameMode, Warning, TEXT("SpatialServerTravel - Failed to preload %s, it will be loaded once the world has been wiped"), *LoadedPackageName.ToString());
+			return;
+		}
+
+		UE_LOG(LogGameMode, Log, TEXT("SpatialServerTravel - Preloaded %s"), *LoadedPackageName.ToString());
+		if (WeakGameInstance.IsValid())
+		{
+			WeakGameInstance->HoldServerTravelMapPackage(LoadedPackage);
+		}
+	}));
+}
+
 void USpatialNetDriver::BeginDestroy()
 {
 	Super::BeginDestroy();
 
 	if (Connection != nullptr)
 	{
+		// The connection can outlive the net driver, which owns the checkpointer.
+		Connection->SetRuntimeCheckpointer(nullptr);
+
 		// Cleanup our corresponding worker entity if it exists.
 		if (WorkerEntityId != SpatialConstants::INVALID_ENTITY_ID)
 		{
@@ -847,6 +1180,15 @@ void USpatialNetDriver::BeginDestroy()
 			FPlatformProcess::Sleep(0.1f);
 		}
 
+		if (!GetDefault<USpatialGDKSettings>()->bUseOpListArena)
+		{
+			for (Worker_OpList* OpList : OpBacklog)
+			{
+				Worker_OpList_Destroy(OpList);
+			}
+		}
+		OpBacklog.Empty();
+
 		// Destroy the connection to disconnect from SpatialOS if we aren't meant to persist it.
 		if (!bPersistSpatialConnection)
 		{
@@ -897,6 +1239,11 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 	// Remove the actor from the property tracker map
 	RepChangedPropertyTrackerMap.Remove(ThisActor);
 
+	if (ActorReplicationSchedule.IsValid())
+	{
+		ActorReplicationSchedule->Unschedule(ThisActor);
+	}
+
 	const bool bIsServer = ServerConnection == nullptr;
 	if (bIsServer)
 	{
@@ -906,7 +1253,16 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 			const Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(ThisActor);
 
 			// If the actor is an initially dormant startup actor that has not been replicated.
-			if (EntityId == SpatialConstants::INVALID_ENTITY_ID && ThisActor->IsNetStartupActor() && ThisActor->GetIsReplicated() && ThisActor->HasAuthority())
+			if (EntityId == SpatialConstants::INVALID_ENTITY_ID && ThisActor->IsNetStartupActor() && ThisActor->GetIsReplicated() && ThisActor->HasAuthority()
+				&& StartupActorTombstones.IsValid())
+			{
+				// Actors destroyed because they were already tombstoned don't need adding again.
+				if (!StartupActorTombstones->IsTombstoned(*ThisActor))
+				{
+					StartupActorTombstones->TombstoneActor(*ThisActor);
+				}
+			}
+			else if (EntityId == SpatialConstants::INVALID_ENTITY_ID && ThisActor->IsNetStartupActor() && ThisActor->GetIsReplicated() && ThisActor->HasAuthority())
 			{
 				UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Creating a tombstone entity for initially dormant statup actor. "
 					"Actor: %s."), *ThisActor->GetName());
@@ -962,6 +1318,11 @@ void USpatialNetDriver::Shutdown()
 		}
 	}
 
+	if (SpatialOutputDevice.IsValid())
+	{
+		// Forward the lines still queued while the connection is alive.
+		SpatialOutputDevice->FlushQueuedLogs();
+	}
 	SpatialOutputDevice = nullptr;
 
 	Super::Shutdown();
@@ -992,6 +1353,28 @@ void USpatialNetDriver::Shutdown()
 #endif //WITH_EDITOR
 }
 
+void USpatialNetDriver::AddNetworkActor(AActor* Actor)
+{
+	Super::AddNetworkActor(Actor);
+
+	ScheduleActorForReplication(Actor);
+}
+
+void USpatialNetDriver::ForceNetUpdate(AActor* Actor)
+{
+	Super::ForceNetUpdate(Actor);
+
+	ScheduleActorForReplication(Actor);
+}
+
+void USpatialNetDriver::ScheduleActorForReplication(AActor* Actor)
+{
+	if (ActorReplicationSchedule.IsValid() && Actor != nullptr && World != nullptr)
+	{
+		ActorReplicationSchedule->Schedule(Actor, World->TimeSeconds);
+	}
+}
+
 void USpatialNetDriver::NotifyActorFullyDormantForConnection(AActor* Actor, UNetConnection* NetConnection)
 {
 	// Similar to NetDriver::NotifyActorFullyDormantForConnection, however we only care about a single connection
@@ -1235,7 +1618,9 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 		}
 
 		// Sort by priority
-		Sort(OutPriorityActors, FinalSortedCount, FCompareFActorPriority());
+		// SpatialGDK - With rate limits, only the entries which can be processed this tick need to be in order, so rather than
+		// sorting the whole list, the highest priority entries are selected and sorted, and the rest follow in no particular order.
+		SortPrioritizedActors(OutPriorityActors, FinalSortedCount);
 	}
 
 	UE_LOG(LogNetTraffic, Log, TEXT("ServerReplicateActors_PrioritizeActors: Potential %04i ConsiderList %03i FinalSortedCount %03i"), MaxSortedActors, ConsiderList.Num(), FinalSortedCount);
@@ -1243,73 +1628,334 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 	return FinalSortedCount;
 }
 
-void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated)
+// SpatialGDK: This mirrors UNetDriver::ServerReplicateActors_BuildConsiderList, but only visits the actors due in ActorReplicationSchedule
+// rather than every active network object. Actors we aren't authoritative over are left out of the schedule, as they can't be replicated,
+// until ScheduleActorForReplication is called for them when they gain authority.
+void USpatialNetDriver::ServerReplicateActors_BuildScheduledConsiderList(TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime)
 {
-	SCOPE_CYCLE_COUNTER(STAT_SpatialProcessPrioritizedActors);
+	const bool bUseAdaptiveNetFrequency = IsAdaptiveNetUpdateFrequencyEnabled();
 
-	// Since this function signature is copied from NetworkDriver.cpp, I don't want to change the signature. But we expect
-	// that the input connection will be the SpatialOS server connection to the runtime (the first client connection),
-	// so let's make sure that assumption continues to hold.
-	check(InConnection != nullptr);
-	check(GetSpatialOSNetConnection() != nullptr);
-	check(InConnection == GetSpatialOSNetConnection());
+	TArray<AActor*> DueActors;
+	ActorReplicationSchedule->CollectDue(World->TimeSeconds, DueActors);
 
-	SET_DWORD_STAT(STAT_SpatialActorsRelevant, 0);
-	SET_DWORD_STAT(STAT_SpatialActorsChanged, 0);
+	TArray<AActor*> ActorsToRemove;
 
-	// SpatialGDK - Here Unreal would check if the InConnection was saturated (!IsNetReady) and early out. Removed this as we do not currently use channel saturation.
+	for (AActor* Actor : DueActors)
+	{
+		// Dormant actors are rescheduled when they are woken, and removed actors when they are added again.
+		TSharedPtr<FNetworkObjectInfo>* ObjectInfo = GetNetworkObjectList().Find(Actor);
+		if (ObjectInfo == nullptr || !ObjectInfo->IsValid() || !GetNetworkObjectList().GetActiveObjects().Contains(*ObjectInfo))
+		{
+			continue;
+		}
 
-	int32 ActorUpdatesThisConnection = 0;
-	int32 ActorUpdatesThisConnectionSent = 0;
+		FNetworkObjectInfo* ActorInfo = ObjectInfo->Get();
 
-	// SpatialGDK - Entity creation rate limiting based on config value.
-	uint32 EntityCreationRateLimit = GetDefault<USpatialGDKSettings>()->EntityCreationRateLimit;
-	int32 MaxEntitiesToCreate = (EntityCreationRateLimit > 0) ? EntityCreationRateLimit : INT32_MAX;
-	int32 FinalCreationCount = 0;
+		if (Actor->Role != ROLE_Authority)
+		{
+			continue;
+		}
 
-	// SpatialGDK - Actor replication rate limiting based on config value.
-	uint32 ActorReplicationRateLimit = GetDefault<USpatialGDKSettings>()->ActorReplicationRateLimit;
-	int32 MaxActorsToReplicate = (ActorReplicationRateLimit > 0) ? ActorReplicationRateLimit : INT32_MAX;
-	int32 FinalReplicatedCount = 0;
+		if (!ActorInfo->bPendingNetUpdate && World->TimeSeconds <= ActorInfo->NextUpdateTime)
+		{
+			ActorReplicationSchedule->Schedule(Actor, ActorInfo->NextUpdateTime);
+			continue;
+		}
 
-	for (int32 j = 0; j < FinalSortedCount; j++)
-	{
-		// Deletion entry
-		if (PriorityActors[j]->ActorInfo == NULL && PriorityActors[j]->DestructionInfo)
+		if (Actor->IsPendingKillPending() || Actor->GetRemoteRole() == ROLE_None)
 		{
-			// Make sure client has streaming level loaded
-			if (PriorityActors[j]->DestructionInfo->StreamingLevelName != NAME_None && !InConnection->ClientVisibleLevelNames.Contains(PriorityActors[j]->DestructionInfo->StreamingLevelName))
-			{
-				// This deletion entry is for an actor in a streaming level the connection doesn't have loaded, so skip it
-				continue;
-			}
-			UActorChannel* Channel = (UActorChannel*)InConnection->CreateChannelByName(NAME_Actor, EChannelCreateFlags::OpenedLocally);
-			if (Channel)
-			{
-				UE_LOG(LogNetTraffic, Log, TEXT("Server replicate actor creating destroy channel for NetGUID <%s,%s> Priority: %d"), *PriorityActors[j]->DestructionInfo->NetGUID.ToString(), *PriorityActors[j]->DestructionInfo->PathName, PriorityActors[j]->Priority);
+			ActorsToRemove.Add(Actor);
+			continue;
+		}
 
-				InConnection->GetDestroyedStartupOrDormantActorGUIDs().Remove(PriorityActors[j]->DestructionInfo->NetGUID); // Remove from connections to-be-destroyed list (close bunch of reliable, so it will make it there)
-			}
+		if (Actor->GetNetDriverName() != NetDriverName)
+		{
+			UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Actor %s in wrong network actors list! (Has net driver '%s', expected '%s')"), *Actor->GetName(), *Actor->GetNetDriverName().ToString(), *NetDriverName.ToString());
 			continue;
 		}
 
-#if !( UE_BUILD_SHIPPING || UE_BUILD_TEST )
-		static IConsoleVariable* DebugObjectCvar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.PackageMap.DebugObject"));
-		static IConsoleVariable* DebugAllObjectsCvar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.PackageMap.DebugAll"));
-		if (PriorityActors[j]->ActorInfo &&
-			((DebugObjectCvar && !DebugObjectCvar->GetString().IsEmpty() && PriorityActors[j]->ActorInfo->Actor->GetName().Contains(DebugObjectCvar->GetString())) ||
-			(DebugAllObjectsCvar && DebugAllObjectsCvar->GetInt() != 0)))
+		// The actor may have been spawn deferred, or its level may still be streaming in or out, so try again next tick.
+		const ULevel* Level = Actor->GetLevel();
+		if (!Actor->IsActorInitialized() || Level->HasVisibilityChangeRequestPending() || Level->bIsAssociatingLevel)
 		{
-			UE_LOG(LogNetPackageMap, Log, TEXT("Evaluating actor for replication %s"), *PriorityActors[j]->ActorInfo->Actor->GetName());
+			ActorReplicationSchedule->Schedule(Actor, World->TimeSeconds);
+			continue;
 		}
-#endif
 
-		// Normal actor replication
-		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
-		UE_LOG(LogNetTraffic, Log, TEXT(" Maybe Replicate %s"), *PriorityActors[j]->ActorInfo->Actor->GetName());
-		if (Channel == nullptr || Channel->Actor != nullptr) // Make sure didn't just close this channel.
+		if (Actor->NetDormancy == DORM_Initial && Actor->IsNetStartupActor())
 		{
-			AActor* Actor = PriorityActors[j]->ActorInfo->Actor;
+			ActorsToRemove.Add(Actor);
+			continue;
+		}
+
+		// Set defaults if this actor is replicating for the first time
+		if (ActorInfo->LastNetReplicateTime == 0)
+		{
+			ActorInfo->LastNetReplicateTime = World->TimeSeconds;
+			ActorInfo->OptimalNetUpdateDelta = 1.0f / Actor->NetUpdateFrequency;
+		}
+
+		const float ScaleDownStartTime = 2.0f;
+		const float ScaleDownTimeRange = 5.0f;
+
+		const float LastReplicateDelta = World->TimeSeconds - ActorInfo->LastNetReplicateTime;
+
+		if (LastReplicateDelta > ScaleDownStartTime)
+		{
+			if (Actor->MinNetUpdateFrequency == 0.0f)
+			{
+				Actor->MinNetUpdateFrequency = 2.0f;
+			}
+
+			// Interpolate between the fastest and slowest rates the actor will update, based on how long it's been since it sent anything
+			const float MinOptimalDelta = 1.0f / Actor->NetUpdateFrequency;
+			const float MaxOptimalDelta = FMath::Max(1.0f / Actor->MinNetUpdateFrequency, MinOptimalDelta);
+			const float Alpha = FMath::Clamp((LastReplicateDelta - ScaleDownStartTime) / ScaleDownTimeRange, 0.0f, 1.0f);
+			ActorInfo->OptimalNetUpdateDelta = FMath::Lerp(MinOptimalDelta, MaxOptimalDelta, Alpha);
+		}
+
+		if (!ActorInfo->bPendingNetUpdate)
+		{
+			const float NextUpdateDelta = bUseAdaptiveNetFrequency ? ActorInfo->OptimalNetUpdateDelta : 1.0f / Actor->NetUpdateFrequency;
+			ActorInfo->NextUpdateTime = World->TimeSeconds + FMath::SRand() * ServerTickTime + NextUpdateDelta;
+			ActorInfo->LastNetUpdateTime = Time;
+		}
+
+		ActorInfo->bPendingNetUpdate = false;
+
+		OutConsiderList.Add(ActorInfo);
+
+		// Call PreReplication on all actors that will be considered
+		Actor->CallPreReplication(this);
+	}
+
+	for (AActor* Actor : ActorsToRemove)
+	{
+		RemoveNetworkActor(Actor);
+	}
+}
+
+void USpatialNetDriver::ServerReplicateActors_RescheduleConsideredActors(const TArray<TWeakObjectPtr<AActor>>& ConsideredActors)
+{
+	for (const TWeakObjectPtr<AActor>& WeakActor : ConsideredActors)
+	{
+		AActor* Actor = WeakActor.Get();
+		if (Actor == nullptr || Actor->Role != ROLE_Authority)
+		{
+			continue;
+		}
+
+		if (TSharedPtr<FNetworkObjectInfo>* ObjectInfo = GetNetworkObjectList().Find(Actor))
+		{
+			if (ObjectInfo->IsValid() && GetNetworkObjectList().GetActiveObjects().Contains(*ObjectInfo))
+			{
+				ActorReplicationSchedule->Schedule(Actor, (*ObjectInfo)->NextUpdateTime);
+			}
+		}
+	}
+}
+
+void USpatialNetDriver::SortPrioritizedActors(FActorPriority** PriorityActors, const int32 FinalSortedCount) const
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	// The replication budget scheduler can turn down any actor, so the actors replicated in its place may come from anywhere in the list.
+	if (SpatialGDKSettings->ActorReplicationRateLimit == 0 || SpatialGDKSettings->EntityCreationRateLimit == 0 || ReplicationBudgetScheduler.IsValid())
+	{
+		Sort(PriorityActors, FinalSortedCount, FCompareFActorPriority());
+		return;
+	}
+
+	// Mirrors how ServerReplicateActors_ProcessPrioritizedActors counts each entry towards the rate limits.
+	auto GetKind = [](const FActorPriority* Entry)
+	{
+		const USpatialActorChannel* Channel = Cast<USpatialActorChannel>(Entry->Channel);
+		if (Entry->ActorInfo == nullptr || Entry->ActorInfo->Actor->GetTearOff() || (Channel != nullptr && Channel->Actor == nullptr))
+		{
+			return SpatialGDK::EPrioritizedEntryKind::NotRateLimited;
+		}
+
+		return (Channel == nullptr || Channel->bCreatingNewEntity) ? SpatialGDK::EPrioritizedEntryKind::EntityCreation : SpatialGDK::EPrioritizedEntryKind::Replication;
+	};
+
+	SpatialGDK::SortPrioritizedEntriesWithinRateLimits(PriorityActors, FinalSortedCount, SpatialGDKSettings->EntityCreationRateLimit, SpatialGDKSettings->ActorReplicationRateLimit,
+		GetKind, [](const FActorPriority* A, const FActorPriority* B)
+	{
+		return FCompareFActorPriority()(*A, *B);
+	});
+}
+
+void USpatialNetDriver::ServerReplicateActors_ParallelCompareProperties(FActorPriority** PriorityActors, const int32 FinalSortedCount, const int32 MaxActorsToReplicate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialParallelCompareProperties);
+
+	// Select the channels the loop in ServerReplicateActors_ProcessPrioritizedActors will replicate, in the same order and up to the same
+	// rate limit. Entity creation and torn off actors are left to the serial path. Readiness is checked here since it may resolve the actor.
+	// Everything that reads the actors, their worlds or their replicators is done here on the game thread, only the compares run in parallel.
+	TArray<FSpatialPropertyCompare> Compares;
+	int32 NumChannelsToCompare = 0;
+
+	for (int32 j = 0; j < FinalSortedCount && NumChannelsToCompare < MaxActorsToReplicate; j++)
+	{
+		if (PriorityActors[j]->ActorInfo == nullptr)
+		{
+			continue;
+		}
+
+		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
+		if (Channel == nullptr || Channel->Actor == nullptr || Channel->Closing || Channel->bCreatingNewEntity || Channel->Actor->GetTearOff())
+		{
+			continue;
+		}
+
+		if (Channel->IsReadyForReplication())
+		{
+			Channel->GatherPropertyCompares(Compares);
+			NumChannelsToCompare++;
+		}
+	}
+
+	// Building component updates assigns NetGUIDs through the package map, so it stays in ReplicateActor, which then reuses
+	// the changelists compared here for this replication frame.
+	ParallelFor(Compares.Num(), [&Compares](int32 Index)
+	{
+		Compares[Index].Run();
+	});
+}
+
+void USpatialNetDriver::ServerReplicateActors_EvaluateAuthority(FActorPriority** PriorityActors, const int32 FinalSortedCount, const int32 MaxActorsToReplicate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialEvaluateAuthority);
+
+	// Select the channels which will check whether to hand over authority while replicating, see USpatialActorChannel::ReplicateActor.
+	TArray<USpatialActorChannel*> Channels;
+	TArray<const AActor*> Actors;
+	Channels.Reserve(FMath::Min(FinalSortedCount, MaxActorsToReplicate));
+	Actors.Reserve(FMath::Min(FinalSortedCount, MaxActorsToReplicate));
+
+	for (int32 j = 0; j < FinalSortedCount && Channels.Num() < MaxActorsToReplicate; j++)
+	{
+		if (PriorityActors[j]->ActorInfo == nullptr)
+		{
+			continue;
+		}
+
+		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
+		if (Channel == nullptr || Channel->Actor == nullptr || Channel->Closing || Channel->bCreatingNewEntity)
+		{
+			continue;
+		}
+
+		if (StaticComponentView->HasAuthority(Channel->GetEntityId(), SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID))
+		{
+			Channels.Add(Channel);
+			Actors.Add(Channel->Actor);
+		}
+	}
+
+	TArray<bool> ShouldHaveAuthority;
+	LoadBalanceStrategy->ShouldHaveAuthorityForActors(Actors, ShouldHaveAuthority);
+
+	for (int32 i = 0; i < Channels.Num(); i++)
+	{
+		Channels[i]->SetPrecomputedShouldHaveAuthority(ShouldHaveAuthority[i]);
+	}
+}
+
+void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialProcessPrioritizedActors);
+
+	// Since this function signature is copied from NetworkDriver.cpp, I don't want to change the signature. But we expect
+	// that the input connection will be the SpatialOS server connection to the runtime (the first client connection),
+	// so let's make sure that assumption continues to hold.
+	check(InConnection != nullptr);
+	check(GetSpatialOSNetConnection() != nullptr);
+	check(InConnection == GetSpatialOSNetConnection());
+
+	SET_DWORD_STAT(STAT_SpatialActorsRelevant, 0);
+	SET_DWORD_STAT(STAT_SpatialActorsChanged, 0);
+
+	// SpatialGDK - Here Unreal would check if the InConnection was saturated (!IsNetReady) and early out. Removed this as we do not currently use channel saturation.
+
+	int32 ActorUpdatesThisConnection = 0;
+	int32 ActorUpdatesThisConnectionSent = 0;
+
+	// SpatialGDK - Entity creation rate limiting based on config value.
+	uint32 EntityCreationRateLimit = GetDefault<USpatialGDKSettings>()->EntityCreationRateLimit;
+	int32 MaxEntitiesToCreate = (EntityCreationRateLimit > 0) ? EntityCreationRateLimit : INT32_MAX;
+	int32 FinalCreationCount = 0;
+
+	// SpatialGDK - Bound the number of create entity requests awaiting a response, so a burst of spawns is submitted as responses arrive.
+	// With bAdaptiveEntityCreationLimit, the bound follows the latency and timeouts of recent create entity responses.
+	int32 MaxCreateEntityRequestsInFlight = static_cast<int32>(GetDefault<USpatialGDKSettings>()->MaxCreateEntityRequestsInFlight);
+	if (const SpatialGDK::FEntityCreationLimiter* EntityCreationLimiter = Receiver->GetEntityCreationLimiter())
+	{
+		MaxCreateEntityRequestsInFlight = EntityCreationLimiter->GetLimit();
+	}
+	if (MaxCreateEntityRequestsInFlight > 0)
+	{
+		MaxEntitiesToCreate = FMath::Min(MaxEntitiesToCreate, FMath::Max(MaxCreateEntityRequestsInFlight - Receiver->GetNumPendingActorRequests(), 0));
+	}
+
+	// SpatialGDK - Actor replication rate limiting based on config value.
+	uint32 ActorReplicationRateLimit = GetDefault<USpatialGDKSettings>()->ActorReplicationRateLimit;
+	int32 MaxActorsToReplicate = (ActorReplicationRateLimit > 0) ? ActorReplicationRateLimit : INT32_MAX;
+	int32 FinalReplicatedCount = 0;
+
+	if (ReplicationBudgetScheduler.IsValid())
+	{
+		ReplicationBudgetScheduler->BeginTick(Time);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bParallelCompareProperties)
+	{
+		ServerReplicateActors_ParallelCompareProperties(PriorityActors, FinalSortedCount, MaxActorsToReplicate);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bBatchEvaluateAuthority && LoadBalanceStrategy != nullptr)
+	{
+		ServerReplicateActors_EvaluateAuthority(PriorityActors, FinalSortedCount, MaxActorsToReplicate);
+	}
+
+	for (int32 j = 0; j < FinalSortedCount; j++)
+	{
+		// Deletion entry
+		if (PriorityActors[j]->ActorInfo == NULL && PriorityActors[j]->DestructionInfo)
+		{
+			// Make sure client has streaming level loaded
+			if (PriorityActors[j]->DestructionInfo->StreamingLevelName != NAME_None && !InConnection->ClientVisibleLevelNames.Contains(PriorityActors[j]->DestructionInfo->StreamingLevelName))
+			{
+				// This deletion entry is for an actor in a streaming level the connection doesn't have loaded, so skip it
+				continue;
+			}
+			UActorChannel* Channel = (UActorChannel*)InConnection->CreateChannelByName(NAME_Actor, EChannelCreateFlags::OpenedLocally);
+			if (Channel)
+			{
+				UE_LOG(LogNetTraffic, Log, TEXT("Server replicate actor creating destroy channel for NetGUID <%s,%s> Priority: %d"), *PriorityActors[j]->DestructionInfo->NetGUID.ToString(), *PriorityActors[j]->DestructionInfo->PathName, PriorityActors[j]->Priority);
+
+				InConnection->GetDestroyedStartupOrDormantActorGUIDs().Remove(PriorityActors[j]->DestructionInfo->NetGUID); // Remove from connections to-be-destroyed list (close bunch of reliable, so it will make it there)
+			}
+			continue;
+		}
+
+#if !( UE_BUILD_SHIPPING || UE_BUILD_TEST )
+		static IConsoleVariable* DebugObjectCvar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.PackageMap.DebugObject"));
+		static IConsoleVariable* DebugAllObjectsCvar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.PackageMap.DebugAll"));
+		if (PriorityActors[j]->ActorInfo &&
+			((DebugObjectCvar && !DebugObjectCvar->GetString().IsEmpty() && PriorityActors[j]->ActorInfo->Actor->GetName().Contains(DebugObjectCvar->GetString())) ||
+			(DebugAllObjectsCvar && DebugAllObjectsCvar->GetInt() != 0)))
+		{
+			UE_LOG(LogNetPackageMap, Log, TEXT("Evaluating actor for replication %s"), *PriorityActors[j]->ActorInfo->Actor->GetName());
+		}
+#endif
+
+		// Normal actor replication
+		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
+		UE_LOG(LogNetTraffic, Log, TEXT(" Maybe Replicate %s"), *PriorityActors[j]->ActorInfo->Actor->GetName());
+		if (Channel == nullptr || Channel->Actor != nullptr) // Make sure didn't just close this channel.
+		{
+			AActor* Actor = PriorityActors[j]->ActorInfo->Actor;
 			bool bIsRelevant = false;
 
 			// SpatialGDK: Here, Unreal would check (again) whether an actor is relevant. Removed such checks.
@@ -1335,7 +1981,9 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 			// Actors not replicated this frame will have their priority increased based on the time since the last replicated.
 			// TearOff actors would normally replicate their final tick due to RecentlyRelevant, after which the channel is closed.
 			// With throttling we no longer always replicate when RecentlyRelevant is true, thus we ensure to always replicate a TearOff actor while it still has a channel.
-			else if ((FinalReplicatedCount < MaxActorsToReplicate && !Actor->GetTearOff()) || (Actor->GetTearOff() && Channel != nullptr))
+			// SpatialGDK - When a replication budget is set, the scheduler additionally decides whether the actor fits in this tick's budget.
+			else if ((FinalReplicatedCount < MaxActorsToReplicate && !Actor->GetTearOff() && (!ReplicationBudgetScheduler.IsValid() || ReplicationBudgetScheduler->ShouldReplicate(Actor, Actor->NetPriority)))
+				|| (Actor->GetTearOff() && Channel != nullptr))
 			{
 				bIsRelevant = true;
 				FinalReplicatedCount++;
@@ -1384,7 +2032,15 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 							LastRelevantActors.Add(Actor);
 						}
 
-						if (Channel->ReplicateActor())
+						const double ReplicateStartTime = FPlatformTime::Seconds();
+						const int64 ReplicatedBits = Channel->ReplicateActor();
+
+						if (ReplicationBudgetScheduler.IsValid())
+						{
+							ReplicationBudgetScheduler->ReportCost(Actor, FPlatformTime::Seconds() - ReplicateStartTime, ReplicatedBits / 8);
+						}
+
+						if (ReplicatedBits)
 						{
 							ActorUpdatesThisConnectionSent++;
 							if (DebugRelevantActors)
@@ -1424,6 +2080,12 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 	SET_DWORD_STAT(STAT_SpatialActorsRelevant, ActorUpdatesThisConnection);
 	SET_DWORD_STAT(STAT_SpatialActorsChanged, ActorUpdatesThisConnectionSent);
 
+	if (ReplicationBudgetScheduler.IsValid())
+	{
+		ReplicationBudgetScheduler->EndTick();
+		SET_FLOAT_STAT(STAT_SpatialOldestUnreplicatedActorAge, ReplicationBudgetScheduler->GetOldestUnreplicatedActorAge());
+	}
+
 	// SpatialGDK - Here Unreal would return the position of the last replicated actor in PriorityActors before the channel became saturated.
 	// In Spatial we use ActorReplicationRateLimit and EntityCreationRateLimit to limit replication so this return value is not relevant.
 }
@@ -1435,10 +2097,12 @@ void USpatialNetDriver::ProcessRPC(AActor* Actor, UObject* SubObject, UFunction*
 	// The RPC might have been called by an actor directly, or by a subobject on that actor
 	UObject* CallingObject = SubObject != nullptr ? SubObject : Actor;
 
+	USpatialActorChannel* Channel = nullptr;
 	if (IsServer())
 	{
 		// Creating channel to ensure that object will be resolvable
-		if (GetOrCreateSpatialActorChannel(CallingObject) == nullptr)
+		Channel = GetOrCreateSpatialActorChannel(CallingObject);
+		if (Channel == nullptr)
 		{
 			// No point processing any further since there is no channel, possibly because the actor is being destroyed.
 			return;
@@ -1448,20 +2112,25 @@ void USpatialNetDriver::ProcessRPC(AActor* Actor, UObject* SubObject, UFunction*
 	// If this object's class isn't present in the schema database, we will log an error and tell the
 	// game to quit. Unfortunately, there's one more tick after that during which RPCs could be called.
 	// Check that the class is supported so we don't crash in USpatialClassInfoManager::GetRPCInfo.
-	if (!Sender->ValidateOrExit_IsSupportedClass(CallingObject->GetClass()->GetPathName()))
+	if (!Sender->ValidateOrExit_IsSupportedClass(CallingObject->GetClass()))
 	{
 		return;
 	}
 
-	FUnrealObjectRef CallingObjectRef = PackageMap->GetUnrealObjectRefFromObject(CallingObject);
+	// The actor's own ref is its entity with offset 0, so RPCs on a resolved actor don't need the package map lookups.
+	FUnrealObjectRef CallingObjectRef = (SubObject == nullptr && Channel != nullptr && Channel->GetEntityId() != SpatialConstants::INVALID_ENTITY_ID)
+		? FUnrealObjectRef(Channel->GetEntityId(), 0)
+		: PackageMap->GetUnrealObjectRefFromObject(CallingObject);
 	if (!CallingObjectRef.IsValid())
 	{
 		UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("The target object %s is unresolved; RPC %s will be dropped."), *CallingObject->GetFullName(), *Function->GetName());
 		return;
 	}
-	RPCPayload Payload = Sender->CreateRPCPayloadFromParams(CallingObject, CallingObjectRef, Function, Parameters);
 
-	Sender->ProcessOrQueueOutgoingRPC(CallingObjectRef, MoveTemp(Payload));
+	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(CallingObject, Function);
+	RPCPayload Payload = Sender->CreateRPCPayloadFromParams(CallingObject, CallingObjectRef, Function, RPCInfo, Parameters);
+
+	Sender->ProcessOrQueueOutgoingRPC(CallingObjectRef, RPCInfo.Type, MoveTemp(Payload));
 }
 
 // SpatialGDK: This is a modified and simplified version of UNetDriver::ServerReplicateActors.
@@ -1524,9 +2193,41 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 	ConsiderList.Reserve(GetNetworkObjectList().GetActiveObjects().Num());
 
 	// Build the consider list (actors that are ready to replicate)
-	ServerReplicateActors_BuildConsiderList(ConsiderList, ServerTickTime);
+	if (ActorReplicationSchedule.IsValid())
+	{
+		ServerReplicateActors_BuildScheduledConsiderList(ConsiderList, ServerTickTime);
+	}
+	else
+	{
+		ServerReplicateActors_BuildConsiderList(ConsiderList, ServerTickTime);
+	}
+
+	// Processing the actors may change their NextUpdateTime, so they are put back into the schedule afterwards.
+	TArray<TWeakObjectPtr<AActor>> ConsideredActors;
+	if (ActorReplicationSchedule.IsValid())
+	{
+		ConsideredActors.Reserve(ConsiderList.Num());
+		for (FNetworkObjectInfo* ActorInfo : ConsiderList)
+		{
+			ConsideredActors.Add(ActorInfo->Actor);
+		}
+	}
+
+	// Removed after the considered actors are collected, so that they stay in the replication schedule.
+	// Unobserved actors which have left this worker's region are still replicated, since that is where their authority intent is updated.
+	if (ClientObservationTracker.IsValid() && GetDefault<USpatialGDKSettings>()->bSkipReplicationOfUnobservedActors)
+	{
+		ConsiderList.RemoveAll([this](FNetworkObjectInfo* ActorInfo)
+		{
+			return IsActorUnobservedWithEntity(ActorInfo->Actor)
+				&& (LoadBalanceStrategy == nullptr || LoadBalanceStrategy->ShouldHaveAuthority(*ActorInfo->Actor));
+		});
+	}
 
 	SET_DWORD_STAT(STAT_SpatialConsiderList, ConsiderList.Num());
+	// Fully dormant actors are moved out of the active objects and are not visited here until they are woken.
+	SET_DWORD_STAT(STAT_SpatialActiveActors, GetNetworkObjectList().GetActiveObjects().Num());
+	SET_DWORD_STAT(STAT_SpatialDormantActors, GetNetworkObjectList().GetDormantObjectsOnAllConnections().Num());
 
 	FMemMark Mark(FMemStack::Get());
 
@@ -1572,6 +2273,11 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 	// SpatialGDK - Here Unreal would mark relevant actors that weren't processed this frame as bPendingNetUpdate. This is not used in the SpatialGDK and so has been removed.
 
+	if (ActorReplicationSchedule.IsValid())
+	{
+		ServerReplicateActors_RescheduleConsideredActors(ConsideredActors);
+	}
+
 	RelevantActorMark.Pop();
 	ConnectionViewers.Reset();
 
@@ -1600,61 +2306,181 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 void USpatialNetDriver::TickDispatch(float DeltaTime)
 {
+	SPATIALGDK_SUBSYSTEM_SCOPE(TickDispatch);
+
 	// Not calling Super:: on purpose.
 	UNetDriver::TickDispatch(DeltaTime);
 
+	if (bWaitingForClientRejoinConnection || bReconcilingClientRejoin)
+	{
+		TickClientRejoin();
+		if (bWaitingForClientRejoinConnection)
+		{
+			return;
+		}
+	}
+
 	if (Connection != nullptr)
 	{
+		if (HitchCapture.IsValid())
+		{
+			TickHitchCapture();
+		}
+
 		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 		if (SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread)
 		{
 			Connection->QueueLatestOpList();
 		}
 
-		TArray<Worker_OpList*> OpLists = Connection->GetOpList();
-
 		// Servers will queue ops at startup until we've extracted necessary information from the op stream
 		if (!bIsReadyToStart)
 		{
-			HandleStartupOpQueueing(OpLists);
+			HandleStartupOpQueueing(Connection->GetOpList());
+
+			// Build class info while waiting on the entity pool, GSM and load balancing, rather than after the worker is ready.
+			if (!bIsReadyToStart && SpatialGDKSettings->bOverlapStartupPhases && SpatialGDKSettings->bPrewarmClassInfo)
+			{
+				ClassInfoManager->TickClassInfoPrewarm(SpatialGDKSettings->ClassInfoPrewarmTimeBudgetMs);
+			}
 			return;
 		}
 
+		uint32 NumOpsThisTick = 0;
+		if (SpatialGDKSettings->bTimeSliceOpProcessing)
+		{
+			// The arena batch is only valid until the next one is taken, so only take one once the current one has been processed.
+			if (SpatialGDKSettings->bUseOpListArena)
+			{
+				if (OpBacklog.Num() == 0)
+				{
+					Worker_OpList* OpListBatch = Connection->GetOpListBatch();
+					if (OpListBatch->op_count > 0)
+					{
+						OpBacklog.Add(OpListBatch);
+					}
+				}
+			}
+			else
+			{
+				OpBacklog.Append(Connection->GetOpList());
+			}
+
+			SCOPE_CYCLE_COUNTER(STAT_SpatialProcessOps);
+			NumOpsThisTick = ProcessOpBacklog();
+		}
+		else if (SpatialGDKSettings->bUseOpListArena)
+		{
+			// The batch is owned by the connection and is freed in one go on the next call.
+			Worker_OpList* OpListBatch = Connection->GetOpListBatch();
+
+			SCOPE_CYCLE_COUNTER(STAT_SpatialProcessOps);
+			NumOpsThisTick = OpListBatch->op_count;
+			if (OpListBatch->op_count > 0)
+			{
+				Dispatcher->ProcessOps(OpListBatch);
+			}
+		}
+		else
 		{
+			TArray<Worker_OpList*> OpLists = Connection->GetOpList();
+
 			SCOPE_CYCLE_COUNTER(STAT_SpatialProcessOps);
 			for (Worker_OpList* OpList : OpLists)
 			{
+				NumOpsThisTick += OpList->op_count;
 				Dispatcher->ProcessOps(OpList);
 
 				Worker_OpList_Destroy(OpList);
 			}
 		}
 
-		if (SpatialMetrics != nullptr && SpatialGDKSettings->bEnableMetrics)
+		if (OpsPerTickHistogram != nullptr)
 		{
-			SpatialMetrics->TickMetrics(Time);
+			OpsPerTickHistogram->Record(NumOpsThisTick);
 		}
 
-		if (LoadBalanceEnforcer.IsValid())
+		if (SpatialMetrics != nullptr)
 		{
-			SCOPE_CYCLE_COUNTER(STAT_SpatialUpdateAuthority);
-			for (const auto& AclAssignmentRequest : LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests())
-			{
-				Sender->SetAclWriteAuthority(AclAssignmentRequest);
-			}
+			SpatialMetrics->TrackReceivedOps(NumOpsThisTick);
 		}
-	}
-}
 
-void USpatialNetDriver::ProcessRemoteFunction(
-	AActor* Actor,
-	UFunction* Function,
-	void* Parameters,
-	FOutParmRec* OutParms,
-	FFrame* Stack,
-	UObject* SubObject)
-{
-	if (Connection == nullptr)
+		if (SpatialGDKSettings->bBatchAsyncClassLoads)
+		{
+			Receiver->RequestQueuedAsyncLoads();
+		}
+
+		if (SpatialGDKSettings->bTimeSliceActorSpawning)
+		{
+			Receiver->ProcessDeferredActorSpawns();
+		}
+
+		if (SpatialGDKSettings->bQueuePlayerSpawnRequests && IsServer())
+		{
+			PlayerSpawner->ProcessQueuedPlayerSpawnRequests();
+		}
+
+		if (SpatialGDKSettings->bPrewarmClassInfo)
+		{
+			ClassInfoManager->TickClassInfoPrewarm(SpatialGDKSettings->ClassInfoPrewarmTimeBudgetMs);
+		}
+
+		if (SpatialMetrics != nullptr && SpatialGDKSettings->bEnableMetrics)
+		{
+			SpatialMetrics->TickMetrics(Time);
+		}
+
+		if (HotEntityTracker.IsValid())
+		{
+			TickHotEntities();
+		}
+
+		if (IsServer())
+		{
+			TickWorkerLoadReports();
+
+			if (SpatialGDKSettings->bEnableServerWorkerFailover)
+			{
+				TickServerWorkerHeartbeat();
+			}
+
+			if (ClientObservationTracker.IsValid())
+			{
+				TickClientObservation();
+			}
+
+			if (SpatialGDKSettings->bPreStageAuthorityHandover)
+			{
+				PreStageAuthorityHandover();
+			}
+		}
+
+		if (LoadBalanceEnforcer.IsValid())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SpatialUpdateAuthority);
+			const TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> AclAssignmentRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+			for (const auto& AclAssignmentRequest : AclAssignmentRequests)
+			{
+				Sender->SetAclWriteAuthority(AclAssignmentRequest);
+			}
+
+			if (AclAssignmentsPerTickHistogram != nullptr)
+			{
+				AclAssignmentsPerTickHistogram->Record(AclAssignmentRequests.Num());
+			}
+		}
+	}
+}
+
+void USpatialNetDriver::ProcessRemoteFunction(
+	AActor* Actor,
+	UFunction* Function,
+	void* Parameters,
+	FOutParmRec* OutParms,
+	FFrame* Stack,
+	UObject* SubObject)
+{
+	if (Connection == nullptr)
 	{
 		UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Attempted to call ProcessRemoteFunction before connection was established"));
 		return;
@@ -1763,6 +2589,21 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 
 	PollPendingLoads();
 
+#if TRACE_LIB_ACTIVE
+	if (USpatialGameInstance* GameInstance = GetGameInstance())
+	{
+		if (USpatialLatencyTracer* LatencyTracer = GameInstance->GetSpatialLatencyTracer())
+		{
+			LatencyTracer->FlushPendingTraceEvents();
+		}
+	}
+#endif // TRACE_LIB_ACTIVE
+
+	if (SpatialOutputDevice.IsValid())
+	{
+		SpatialOutputDevice->FlushQueuedLogs();
+	}
+
 	if (IsServer() && GetSpatialOSNetConnection() != nullptr && bIsReadyToStart)
 	{
 		// Update all clients.
@@ -1770,6 +2611,11 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 
 		int32 Updated = ServerReplicateActors(DeltaTime);
 
+		if (Sender != nullptr)
+		{
+			Sender->FlushAuthorityIntentUpdates();
+		}
+
 		static int32 LastUpdateCount = 0;
 		// Only log the zero replicated actors once after replicating an actor
 		if ((LastUpdateCount && !Updated) || Updated)
@@ -1795,18 +2641,51 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 #endif // WITH_SERVER_CODE
 	}
 
+	// Merged before the RPC service is flushed, so that RPCs submitted from other threads are sent this tick.
+	if (Sender != nullptr && bIsReadyToStart)
+	{
+		Sender->MergeSubmittedBatches();
+	}
+
 	if (SpatialGDKSettings->UseRPCRingBuffer() && Sender != nullptr)
 	{
 		Sender->FlushRPCService();
 	}
 
+	if (SpatialGDKSettings->bBatchCrossServerRPCs && Sender != nullptr)
+	{
+		Sender->FlushCrossServerRPCBatches();
+	}
+
+	if (StartupActorTombstones.IsValid() && IsServer())
+	{
+		StartupActorTombstones->Advance(Time);
+	}
+
+	if (RuntimeCheckpointer.IsValid())
+	{
+		RuntimeCheckpointer->Tick(FPlatformTime::Seconds());
+	}
+
 	ProcessPendingDormancy();
 
+	if (SpatialGDKSettings->MemoryAccountingSampleIntervalSeconds > 0.f && (Time - TimeWhenMemoryLastSampled) >= SpatialGDKSettings->MemoryAccountingSampleIntervalSeconds)
+	{
+		TimeWhenMemoryLastSampled = Time;
+		SampleMemoryUsage();
+	}
+
 	TimerManager.Tick(DeltaTime);
 
+	// Messages sent while rejoining are held until there's a connection again.
+	if (Connection != nullptr && !bWaitingForClientRejoinConnection)
+	{
+		Connection->ApplyEndOfTickFlushPolicy();
+	}
+
 	if (SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread)
 	{
-		if (Connection != nullptr)
+		if (Connection != nullptr && !bWaitingForClientRejoinConnection)
 		{
 			Connection->ProcessOutgoingMessages();
 		}
@@ -1817,6 +2696,47 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 	Super::TickFlush(DeltaTime);
 }
 
+void USpatialNetDriver::SampleMemoryUsage()
+{
+	if (StaticComponentView != nullptr)
+	{
+		MemoryAccounting.Record(ESpatialMemorySubsystem::StaticComponentView, StaticComponentView->GetAllocatedSize());
+	}
+
+	SIZE_T RPCContainerBytes = 0;
+	if (Receiver != nullptr)
+	{
+		MemoryAccounting.Record(ESpatialMemorySubsystem::ReceiverPendingState, Receiver->GetPendingStateAllocatedSize());
+		RPCContainerBytes += Receiver->GetIncomingRPCsAllocatedSize();
+	}
+	if (Sender != nullptr)
+	{
+		MemoryAccounting.Record(ESpatialMemorySubsystem::SenderOutgoingQueues, Sender->GetOutgoingQueuesAllocatedSize());
+		RPCContainerBytes += Sender->GetOutgoingRPCsAllocatedSize();
+	}
+	MemoryAccounting.Record(ESpatialMemorySubsystem::RPCContainers, RPCContainerBytes);
+
+	if (RPCService.IsValid())
+	{
+		MemoryAccounting.Record(ESpatialMemorySubsystem::RPCRingBuffers, RPCService->GetAllocatedSize());
+	}
+
+	if (GuidCache.IsValid())
+	{
+		MemoryAccounting.Record(ESpatialMemorySubsystem::NetGUIDCache, static_cast<const FSpatialNetGUIDCache*>(GuidCache.Get())->GetAllocatedSize());
+	}
+
+	SIZE_T ShadowDataBytes = EntityToActorChannel.GetAllocatedSize();
+	for (const auto& Pair : EntityToActorChannel)
+	{
+		if (Pair.Value != nullptr)
+		{
+			ShadowDataBytes += Pair.Value->GetShadowDataAllocatedSize();
+		}
+	}
+	MemoryAccounting.Record(ESpatialMemorySubsystem::ActorChannelShadowData, ShadowDataBytes);
+}
+
 USpatialNetConnection * USpatialNetDriver::GetSpatialOSNetConnection() const
 {
 	if (ServerConnection)
@@ -1966,6 +2886,51 @@ void USpatialNetDriver::ProcessPendingDormancy()
 	PendingDormantChannels = MoveTemp(RemainingChannels);
 }
 
+void USpatialNetDriver::SweepHeartbeats()
+{
+	check(HeartbeatManager.IsValid());
+
+	for (USpatialNetConnection* TimedOutConnection : HeartbeatManager->RemoveTimedOutConnections(FPlatformTime::Seconds()))
+	{
+		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Client connection %s timed out, PlayerController entity %lld"), *TimedOutConnection->GetName(), TimedOutConnection->PlayerControllerEntity);
+
+		// This client timed out. Disconnect it and trigger OnDisconnected logic.
+		TimedOutConnection->CleanUp();
+	}
+}
+
+bool USpatialNetDriver::RejoinClientConnection(const FString& PreviousWorkerId, Worker_EntityId PlayerControllerEntityId, const FString& NewWorkerId)
+{
+	USpatialNetConnection* ClientConnection = FindClientConnectionFromWorkerId(PreviousWorkerId).Get();
+	if (ClientConnection == nullptr || ClientConnection->PlayerControllerEntity != PlayerControllerEntityId)
+	{
+		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("No player controller of worker %s to hand to rejoining worker %s, spawning a new player."), *PreviousWorkerId, *NewWorkerId);
+		return false;
+	}
+
+	USpatialActorChannel* Channel = GetActorChannelByEntityId(PlayerControllerEntityId);
+	if (Channel == nullptr || !Channel->IsAuthoritativeServer())
+	{
+		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Player controller entity %lld of worker %s isn't owned by this server, spawning a new player for rejoining worker %s."),
+			PlayerControllerEntityId, *PreviousWorkerId, *NewWorkerId);
+		return false;
+	}
+
+	UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Handing player controller entity %lld of worker %s to rejoining worker %s."), PlayerControllerEntityId, *PreviousWorkerId, *NewWorkerId);
+
+	WorkerConnections.Remove(PreviousWorkerId);
+	ClientConnection->ConnectionOwningWorkerId = FString::Printf(TEXT("workerId:%s"), *NewWorkerId);
+	WorkerConnections.Add(NewWorkerId, ClientConnection);
+
+	// No heartbeats arrived while the client was away.
+	ClientConnection->OnHeartbeat();
+
+	// Updates the NetOwningClientWorker component and the ACLs of the player controller and everything it owns to the new worker.
+	Channel->ServerProcessOwnershipChange();
+
+	return true;
+}
+
 void USpatialNetDriver::AcceptNewPlayer(const FURL& InUrl, const FUniqueNetIdRepl& UniqueId, const FName& OnlinePlatformName)
 {
 	USpatialNetConnection* SpatialConnection = nullptr;
@@ -2383,6 +3348,14 @@ void USpatialNetDriver::HandleStartupOpQueueing(const TArray<Worker_OpList*>& In
 		return;
 	}
 
+	if (KeptViewOps.Num() > 0)
+	{
+		Worker_OpList KeptViewOpList{ KeptViewOps.GetData(), static_cast<uint32>(KeptViewOps.Num()) };
+		Dispatcher->ProcessOps(&KeptViewOpList);
+		KeptViewOps.Empty();
+		KeptViewComponentData.Empty();
+	}
+
 	for (Worker_OpList* OpList : QueuedStartupOpLists)
 	{
 		Dispatcher->ProcessOps(OpList);
@@ -2398,21 +3371,19 @@ void USpatialNetDriver::HandleStartupOpQueueing(const TArray<Worker_OpList*>& In
 
 bool USpatialNetDriver::FindAndDispatchStartupOpsServer(const TArray<Worker_OpList*>& InOpLists)
 {
+	// Index the new ops once, rather than scanning them again for every op the startup flow looks for.
+	const SpatialGDK::FOpListIndex OpIndex(InOpLists, { WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE });
+
 	TArray<Worker_Op*> FoundOps;
 
-	AppendAllOpsOfType(InOpLists, WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE, FoundOps);
+	OpIndex.AppendAllOpsOfType(WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE, FoundOps);
 
 	// To correctly initialize the ServerWorkerEntity on each server during op queueing, we need to catch several ops here.
 	// Note that this will break if any other CreateEntity requests are issued during the startup flow.
 	{
-		Worker_Op* CreateEntityResponseOp = nullptr;
-		FindFirstOpOfType(InOpLists, WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE, &CreateEntityResponseOp);
-
-		Worker_Op* AddComponentOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_ADD_COMPONENT, SpatialConstants::SERVER_WORKER_COMPONENT_ID, &AddComponentOp);
-
-		Worker_Op* AuthorityChangedOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_AUTHORITY_CHANGE, SpatialConstants::SERVER_WORKER_COMPONENT_ID, &AuthorityChangedOp);
+		Worker_Op* CreateEntityResponseOp = OpIndex.FindFirstOpOfType(WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE);
+		Worker_Op* AddComponentOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_ADD_COMPONENT, SpatialConstants::SERVER_WORKER_COMPONENT_ID);
+		Worker_Op* AuthorityChangedOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_AUTHORITY_CHANGE, SpatialConstants::SERVER_WORKER_COMPONENT_ID);
 
 		if (CreateEntityResponseOp != nullptr)
 		{
@@ -2435,8 +3406,7 @@ bool USpatialNetDriver::FindAndDispatchStartupOpsServer(const TArray<Worker_OpLi
 	// a new query will be sent, and we will process the new response here when it arrives.
 	if (!PackageMap->IsEntityPoolReady())
 	{
-		Worker_Op* EntityIdReservationResponseOp = nullptr;
-		FindFirstOpOfType(InOpLists, WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE, &EntityIdReservationResponseOp);
+		Worker_Op* EntityIdReservationResponseOp = OpIndex.FindFirstOpOfType(WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE);
 
 		if (EntityIdReservationResponseOp != nullptr)
 		{
@@ -2447,14 +3417,9 @@ bool USpatialNetDriver::FindAndDispatchStartupOpsServer(const TArray<Worker_OpLi
 	// Search for StartupActorManager ops we need and process them
 	if (!GlobalStateManager->IsReady())
 	{
-		Worker_Op* AddComponentOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_ADD_COMPONENT, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID, &AddComponentOp);
-
-		Worker_Op* AuthorityChangedOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_AUTHORITY_CHANGE, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID, &AuthorityChangedOp);
-
-		Worker_Op* ComponentUpdateOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_COMPONENT_UPDATE, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID, &ComponentUpdateOp);
+		Worker_Op* AddComponentOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_ADD_COMPONENT, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID);
+		Worker_Op* AuthorityChangedOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_AUTHORITY_CHANGE, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID);
+		Worker_Op* ComponentUpdateOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_COMPONENT_UPDATE, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID);
 
 		if (AddComponentOp != nullptr)
 		{
@@ -2474,14 +3439,9 @@ bool USpatialNetDriver::FindAndDispatchStartupOpsServer(const TArray<Worker_OpLi
 
 	if (VirtualWorkerTranslator.IsValid() && !VirtualWorkerTranslator->IsReady())
 	{
-		Worker_Op* AddComponentOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_ADD_COMPONENT, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID, &AddComponentOp);
-
-		Worker_Op* AuthorityChangedOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_AUTHORITY_CHANGE, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID, &AuthorityChangedOp);
-
-		Worker_Op* ComponentUpdateOp = nullptr;
-		FindFirstOpOfTypeForComponent(InOpLists, WORKER_OP_TYPE_COMPONENT_UPDATE, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID, &ComponentUpdateOp);
+		Worker_Op* AddComponentOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_ADD_COMPONENT, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID);
+		Worker_Op* AuthorityChangedOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_AUTHORITY_CHANGE, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID);
+		Worker_Op* ComponentUpdateOp = OpIndex.FindFirstOpOfTypeForComponent(WORKER_OP_TYPE_COMPONENT_UPDATE, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID);
 
 		if (AddComponentOp != nullptr)
 		{
@@ -2504,6 +3464,19 @@ bool USpatialNetDriver::FindAndDispatchStartupOpsServer(const TArray<Worker_OpLi
 
 	SelectiveProcessOps(FoundOps);
 
+	if (PackageMap->IsEntityPoolReady())
+	{
+		StartupTimeline.MarkPhase(TEXT("EntityPoolReady"));
+	}
+	if (GlobalStateManager->IsReady())
+	{
+		StartupTimeline.MarkPhase(TEXT("GlobalStateManagerReady"));
+	}
+	if (VirtualWorkerTranslator.IsValid() && VirtualWorkerTranslator->IsReady())
+	{
+		StartupTimeline.MarkPhase(TEXT("LoadBalancingReady"));
+	}
+
 	if (!PackageMap->IsEntityPoolReady())
 	{
 		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Waiting for the EntityPool to be ready."));
@@ -2521,6 +3494,8 @@ bool USpatialNetDriver::FindAndDispatchStartupOpsServer(const TArray<Worker_OpLi
 		return false;
 	}
 	UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Ready to begin processing."));
+	StartupTimeline.MarkPhase(TEXT("ReadyToStart"));
+	StartupTimeline.LogTimeline(TEXT("Server"));
 	return true;
 }
 
@@ -2547,7 +3522,7 @@ bool USpatialNetDriver::FindAndDispatchStartupOpsClient(const TArray<Worker_OpLi
 	}
 }
 
-void USpatialNetDriver::SelectiveProcessOps(TArray<Worker_Op*> FoundOps)
+void USpatialNetDriver::SelectiveProcessOps(const TArray<Worker_Op*>& FoundOps)
 {
 	// For each Op we've found, make a Worker_OpList that just contains that Op,
 	// and pass it to the dispatcher for processing. This allows us to avoid copying
@@ -2597,6 +3572,148 @@ void USpatialNetDriver::SetSpatialDebugger(ASpatialDebugger* InSpatialDebugger)
 	SpatialDebugger = InSpatialDebugger;
 }
 
+double USpatialNetDriver::GetOldestUnreplicatedActorAge() const
+{
+	return ReplicationBudgetScheduler.IsValid() ? ReplicationBudgetScheduler->GetOldestUnreplicatedActorAge() : 0.0;
+}
+
+double USpatialNetDriver::GetEntityCreationLimit() const
+{
+	const SpatialGDK::FEntityCreationLimiter* EntityCreationLimiter = Receiver != nullptr ? Receiver->GetEntityCreationLimiter() : nullptr;
+	return EntityCreationLimiter != nullptr ? EntityCreationLimiter->GetLimit() : 0.0;
+}
+
+double USpatialNetDriver::GetMaxClientInterestQueryCount() const
+{
+	return InterestFactory.IsValid() ? InterestFactory->GetMaxClientInterestQueryCount() : 0.0;
+}
+
+double USpatialNetDriver::GetNumQueuedAclAssignments() const
+{
+	return LoadBalanceEnforcer.IsValid() ? LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests() : 0.0;
+}
+
+uint32 USpatialNetDriver::ProcessOpBacklog()
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const double EndTime = SpatialGDKSettings->OpProcessingTimeBudgetMs > 0.f ? FPlatformTime::Seconds() + SpatialGDKSettings->OpProcessingTimeBudgetMs / 1000.0 : 0.0;
+	const uint32 MaxOps = SpatialGDKSettings->MaxOpsProcessedPerTick;
+
+	uint32 NumOpsProcessed = 0;
+	while (OpBacklog.Num() > 0)
+	{
+		Worker_OpList* OpList = OpBacklog[0];
+		const uint32 NextOpIndex = Dispatcher->ProcessOps(OpList, OpBacklogIndex, EndTime, MaxOps > 0 ? MaxOps - NumOpsProcessed : 0);
+		NumOpsProcessed += NextOpIndex - OpBacklogIndex;
+
+		if (NextOpIndex < OpList->op_count)
+		{
+			OpBacklogIndex = NextOpIndex;
+			break;
+		}
+
+		// Arena batches are owned by the connection.
+		if (!SpatialGDKSettings->bUseOpListArena)
+		{
+			Worker_OpList_Destroy(OpList);
+		}
+		OpBacklog.RemoveAt(0, 1, false);
+		OpBacklogIndex = 0;
+
+		if ((MaxOps > 0 && NumOpsProcessed >= MaxOps) || (EndTime > 0.0 && FPlatformTime::Seconds() >= EndTime))
+		{
+			break;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_SpatialOpBacklog, static_cast<uint32>(GetOpBacklogSize()));
+
+	return NumOpsProcessed;
+}
+
+double USpatialNetDriver::GetOpBacklogSize() const
+{
+	uint32 NumOps = 0;
+	for (const Worker_OpList* OpList : OpBacklog)
+	{
+		NumOps += OpList->op_count;
+	}
+	return OpBacklog.Num() > 0 ? NumOps - OpBacklogIndex : 0;
+}
+
+void USpatialNetDriver::RegisterOverflowedRPCMetrics()
+{
+	// Servers send client and multicast RPCs, clients send server RPCs.
+	const TArray<TPair<ERPCType, FString>> SentRPCTypes = IsServer()
+		? TArray<TPair<ERPCType, FString>>{ { ERPCType::ClientReliable, TEXT("ClientReliable") }, { ERPCType::ClientUnreliable, TEXT("ClientUnreliable") }, { ERPCType::NetMulticast, TEXT("NetMulticast") } }
+		: TArray<TPair<ERPCType, FString>>{ { ERPCType::ServerReliable, TEXT("ServerReliable") }, { ERPCType::ServerUnreliable, TEXT("ServerUnreliable") } };
+
+	for (const TPair<ERPCType, FString>& SentRPCType : SentRPCTypes)
+	{
+		SpatialMetrics->SetCustomMetric(FString::Printf(TEXT("%s.%s"), *SpatialConstants::SPATIALOS_METRICS_OVERFLOWED_RPC_QUEUE_DEPTH, *SentRPCType.Value),
+			UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetOverflowedRPCQueueDepth, SentRPCType.Key));
+		SpatialMetrics->SetCustomMetric(FString::Printf(TEXT("%s.%s"), *SpatialConstants::SPATIALOS_METRICS_OLDEST_OVERFLOWED_RPC_AGE, *SentRPCType.Value),
+			UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetOldestOverflowedRPCAge, SentRPCType.Key));
+		SpatialMetrics->SetCustomMetric(FString::Printf(TEXT("%s.%s"), *SpatialConstants::SPATIALOS_METRICS_DROPPED_RPCS, *SentRPCType.Value),
+			UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetDroppedRPCCount, SentRPCType.Key));
+	}
+}
+
+double USpatialNetDriver::GetOverflowedRPCQueueDepth(ERPCType Type) const
+{
+	return RPCService.IsValid() ? RPCService->GetOverflowedRPCQueueDepth(Type) : 0.0;
+}
+
+double USpatialNetDriver::GetOldestOverflowedRPCAge(ERPCType Type) const
+{
+	return RPCService.IsValid() ? RPCService->GetOldestOverflowedRPCAge(Type) : 0.0;
+}
+
+double USpatialNetDriver::GetDesiredServerWorkerCount() const
+{
+	return LoadBalanceStrategy != nullptr ? LoadBalanceStrategy->GetDesiredWorkerCount() : 0.0;
+}
+
+double USpatialNetDriver::GetExpiredRPCCount() const
+{
+	uint32 NumExpired = Sender->GetNumExpiredRPCs() + Receiver->GetNumExpiredRPCs();
+	if (RPCService.IsValid())
+	{
+		NumExpired += RPCService->GetExpiredRPCCount();
+	}
+	return NumExpired;
+}
+
+double USpatialNetDriver::GetDroppedRPCCount(ERPCType Type) const
+{
+	return RPCService.IsValid() ? RPCService->GetDroppedRPCCount(Type) : 0.0;
+}
+
+uint32 USpatialNetDriver::GetAuthoritativeEntityCount()
+{
+	uint32 Count = 0;
+	for (const TPair<Worker_EntityId_Key, USpatialActorChannel*>& EntityChannelPair : EntityToActorChannel)
+	{
+		if (EntityChannelPair.Value != nullptr && EntityChannelPair.Value->IsAuthoritativeServer())
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+FString USpatialNetDriver::GetEntityClassName(Worker_EntityId EntityId)
+{
+	if (PackageMap != nullptr)
+	{
+		if (UObject* Object = PackageMap->GetObjectFromEntityId(EntityId).Get())
+		{
+			return Object->GetClass()->GetName();
+		}
+	}
+	return FString();
+}
+
 FUnrealObjectRef USpatialNetDriver::GetCurrentPlayerControllerRef()
 {
 	if (USpatialNetConnection* NetConnection = GetSpatialOSNetConnection())
@@ -2618,4 +3735,450 @@ void USpatialNetDriver::InitializeVirtualWorkerTranslationManager()
 {
 	VirtualWorkerTranslationManager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Receiver, Connection, VirtualWorkerTranslator.Get());
 	VirtualWorkerTranslationManager->SetNumberOfVirtualWorkers(LoadBalanceStrategy->GetMinimumRequiredWorkers());
+	VirtualWorkerTranslationManager->SetLoadBalanceStrategy(LoadBalanceStrategy);
+	// Other workers update their interest when they receive the new regions, this worker applies them directly.
+	VirtualWorkerTranslationManager->OnRegionsChanged.BindUObject(Sender, &USpatialSender::UpdateServerWorkerEntityInterestAndPosition);
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bEnableServerWorkerFailover)
+	{
+		VirtualWorkerTranslationManager->EnableServerWorkerFailover(SpatialGDKSettings->ServerWorkerHeartbeatTimeout);
+	}
+
+	// Only the worker hosting the manager knows the load of the whole deployment, for scaling the number of server workers.
+	if (SpatialMetrics != nullptr && LoadBalanceStrategy->RequiresWorkerLoadReports())
+	{
+		SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_DESIRED_SERVER_WORKERS, UserSuppliedMetric::CreateUObject(this, &USpatialNetDriver::GetDesiredServerWorkerCount));
+	}
+}
+
+// Strategies which rebalance based on load need every server worker's load. Each worker writes its own load onto its
+// ServerWorker component, and the worker hosting the translation manager gathers them with an entity query.
+void USpatialNetDriver::PreStageAuthorityHandover()
+{
+	if (LoadBalanceStrategy == nullptr || !LoadBalanceStrategy->IsReady())
+	{
+		return;
+	}
+
+	if (Time - TimeWhenAuthorityLastPreStaged < SpatialConstants::AUTHORITY_PRE_STAGE_INTERVAL_SECONDS)
+	{
+		return;
+	}
+	TimeWhenAuthorityLastPreStaged = Time;
+
+	const float PreStageDistance = GetDefault<USpatialGDKSettings>()->AuthorityPreStageDistance;
+	for (const TPair<Worker_EntityId_Key, USpatialActorChannel*>& EntityChannelPair : EntityToActorChannel)
+	{
+		USpatialActorChannel* Channel = EntityChannelPair.Value;
+		if (Channel == nullptr || Channel->Actor == nullptr || Channel->IsAuthoritativeServer() || Channel->IsAuthorityPreStaged())
+		{
+			continue;
+		}
+
+		if (LoadBalanceStrategy->IsNearLocalRegion(*Channel->Actor, PreStageDistance))
+		{
+			Channel->PreStageAuthority();
+		}
+	}
+}
+
+void USpatialNetDriver::TickWorkerLoadReports()
+{
+	if (LoadBalanceStrategy == nullptr || !LoadBalanceStrategy->RequiresWorkerLoadReports() || SpatialMetrics == nullptr)
+	{
+		return;
+	}
+
+	if (Time - TimeWhenWorkerLoadLastReported < SpatialConstants::WORKER_LOAD_REPORT_INTERVAL_SECONDS)
+	{
+		return;
+	}
+	TimeWhenWorkerLoadLastReported = Time;
+
+	if (StaticComponentView->HasAuthority(WorkerEntityId, SpatialConstants::SERVER_WORKER_COMPONENT_ID))
+	{
+		FWorkerComponentUpdate Update = GetDefault<USpatialGDKSettings>()->bReportWorkerLoadVector
+			? SpatialGDK::ServerWorker::CreateServerWorkerLoadUpdate(SpatialMetrics->GetWorkerLoad(), SpatialMetrics->GetWorkerLoadVector())
+			: SpatialGDK::ServerWorker::CreateServerWorkerLoadUpdate(SpatialMetrics->GetWorkerLoad());
+		Connection->SendComponentUpdate(WorkerEntityId, &Update);
+	}
+
+	if (VirtualWorkerTranslationManager.IsValid())
+	{
+		VirtualWorkerTranslationManager->QueryForServerWorkerLoads();
+	}
+}
+
+void USpatialNetDriver::TickHitchCapture()
+{
+	SpatialGDK::FHitchCaptureTotals Totals;
+	if (SpatialMetrics != nullptr)
+	{
+		Totals.RPCsSent = SpatialMetrics->GetSentRPCCount();
+		Totals.RPCsReceived = SpatialMetrics->GetReceivedRPCCount();
+	}
+	Totals.OutgoingMessagesQueued = Connection->GetQueuedOutgoingMessageCount();
+	Totals.OutgoingMessageQueueDepth = Connection->GetOutgoingMessageQueueDepth();
+
+	// Called at the start of a frame, so this closes the previous one. The tick's DeltaTime can be clamped, the engine's isn't.
+	const uint64 PreviousFrame = GFrameCounter - 1;
+	const float PreviousFrameTime = FApp::GetDeltaTime();
+	if (!HitchCapture->EndFrame(PreviousFrame, PreviousFrameTime, Totals, FPlatformTime::Seconds()))
+	{
+		return;
+	}
+
+	const FString Filename = FPaths::Combine(FPaths::ProfilingDir(), TEXT("SpatialHitches"),
+		FString::Printf(TEXT("%s-%s-%llu.csv"), *Connection->GetWorkerId(), *FDateTime::Now().ToString(), PreviousFrame));
+	if (FFileHelper::SaveStringToFile(HitchCapture->ToCsv(), *Filename))
+	{
+		UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("Frame %llu took %.1f ms, wrote the GDK activity of the last frames to %s"),
+			PreviousFrame, PreviousFrameTime * 1000.f, *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*Filename));
+	}
+	else
+	{
+		UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("Frame %llu took %.1f ms, but the hitch capture could not be written to %s"),
+			PreviousFrame, PreviousFrameTime * 1000.f, *Filename);
+	}
+}
+
+void USpatialNetDriver::TickHotEntities()
+{
+	// Rates are averaged over a window of seconds, so checking them every frame wouldn't find anything sooner.
+	if (Time - TimeWhenHotEntitiesLastChecked < 1.f)
+	{
+		return;
+	}
+	TimeWhenHotEntitiesLastChecked = Time;
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const double Now = FPlatformTime::Seconds();
+	HotEntityTracker->RemoveInactiveEntities(Now);
+
+	TSet<Worker_EntityId_Key> EntitiesSendingTooManyUpdates;
+	for (const SpatialGDK::FHotEntity& HotEntity : HotEntityTracker->GetEntitiesAtOrAbove(SpatialGDK::EHotEntityCounter::OutgoingUpdates, SpatialGDKSettings->HotEntityUpdateRateThreshold, Now))
+	{
+		EntitiesSendingTooManyUpdates.Add(HotEntity.EntityId);
+	}
+
+	TSet<Worker_EntityId_Key> NewHotEntities = EntitiesSendingTooManyUpdates;
+	for (const SpatialGDK::FHotEntity& HotEntity : HotEntityTracker->GetEntitiesAtOrAbove(SpatialGDK::EHotEntityCounter::OutgoingRPCs, SpatialGDKSettings->HotEntityRPCRateThreshold, Now))
+	{
+		NewHotEntities.Add(HotEntity.EntityId);
+	}
+
+	for (const Worker_EntityId_Key EntityId : NewHotEntities)
+	{
+		if (!HotEntities.Contains(EntityId))
+		{
+			UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("Entity %lld (%s) is hot, sending %.1f component updates and %.1f RPCs per second"), EntityId, *GetEntityClassName(EntityId),
+				HotEntityTracker->GetRate(EntityId, SpatialGDK::EHotEntityCounter::OutgoingUpdates, Now), HotEntityTracker->GetRate(EntityId, SpatialGDK::EHotEntityCounter::OutgoingRPCs, Now));
+		}
+	}
+	HotEntities = MoveTemp(NewHotEntities);
+
+	if (SpatialGDKSettings->bThrottleHotEntities)
+	{
+		UpdateHotEntityThrottling(EntitiesSendingTooManyUpdates);
+	}
+}
+
+// Throttled actors are released after HotEntityThrottleSeconds rather than once their rate drops, since the throttle itself lowers it.
+void USpatialNetDriver::UpdateHotEntityThrottling(const TSet<Worker_EntityId_Key>& EntitiesSendingTooManyUpdates)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	for (auto It = ThrottledHotActors.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It.Key().Get();
+		if (Actor == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+		else if (Time >= It.Value().ThrottledUntil)
+		{
+			Actor->NetUpdateFrequency = It.Value().NetUpdateFrequency;
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const Worker_EntityId_Key EntityId : EntitiesSendingTooManyUpdates)
+	{
+		AActor* Actor = Cast<AActor>(PackageMap->GetObjectFromEntityId(EntityId).Get());
+		if (Actor == nullptr || !Actor->HasAuthority() || ThrottledHotActors.Contains(Actor)
+			|| Actor->NetUpdateFrequency <= SpatialGDKSettings->HotEntityThrottledNetUpdateFrequency)
+		{
+			continue;
+		}
+
+		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Throttling hot actor %s from %.1f to %.1f updates per second for %.1f seconds"), *Actor->GetName(),
+			Actor->NetUpdateFrequency, SpatialGDKSettings->HotEntityThrottledNetUpdateFrequency, SpatialGDKSettings->HotEntityThrottleSeconds);
+		ThrottledHotActors.Add(Actor, FHotActorThrottle{ Actor->NetUpdateFrequency, Time + SpatialGDKSettings->HotEntityThrottleSeconds });
+		Actor->NetUpdateFrequency = SpatialGDKSettings->HotEntityThrottledNetUpdateFrequency;
+	}
+}
+
+// Each server publishes the view positions of its clients on its ServerWorker component and gathers those of the other servers,
+// so that actors which no client anywhere is near can be throttled.
+void USpatialNetDriver::TickClientObservation()
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (Time - TimeWhenClientObservationLastUpdated < SpatialGDKSettings->ClientObservationUpdateIntervalSeconds)
+	{
+		return;
+	}
+	TimeWhenClientObservationLastUpdated = Time;
+
+	// The first connection is the connection to the runtime itself.
+	TArray<FVector> ViewPositions;
+	for (int32 i = 1; i < ClientConnections.Num(); i++)
+	{
+		const UNetConnection* ClientConnection = ClientConnections[i];
+		if (ClientConnection->PlayerController != nullptr && ClientConnection->PlayerController->HasAuthority() && ClientConnection->ViewTarget != nullptr)
+		{
+			ViewPositions.Add(ClientConnection->ViewTarget->GetActorLocation());
+		}
+	}
+	ClientObservationTracker->SetLocalViewPositions(MoveTemp(ViewPositions));
+
+	// Moves well within the wake-up margin don't need to be shared.
+	if (ClientObservationTracker->HaveLocalViewPositionsMoved(0.25f * SpatialGDKSettings->UnobservedActorWakeUpMargin)
+		&& StaticComponentView->HasAuthority(WorkerEntityId, SpatialConstants::SERVER_WORKER_COMPONENT_ID))
+	{
+		FWorkerComponentUpdate Update = SpatialGDK::ServerWorker::CreateServerWorkerClientViewPositionsUpdate(ClientObservationTracker->GetLocalViewPositions());
+		Connection->SendComponentUpdate(WorkerEntityId, &Update);
+		ClientObservationTracker->MarkLocalViewPositionsPublished();
+	}
+
+	if (!bClientViewPositionsQueryInFlight)
+	{
+		Worker_ComponentConstraint ServerWorkerComponentConstraint{};
+		ServerWorkerComponentConstraint.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+
+		Worker_EntityQuery ServerWorkerQuery{};
+		ServerWorkerQuery.constraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
+		ServerWorkerQuery.constraint.constraint.component_constraint = ServerWorkerComponentConstraint;
+		ServerWorkerQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+
+		const Worker_RequestId RequestId = Connection->SendEntityQueryRequest(&ServerWorkerQuery);
+		bClientViewPositionsQueryInFlight = true;
+
+		EntityQueryDelegate ServerWorkerQueryDelegate;
+		ServerWorkerQueryDelegate.BindUObject(this, &USpatialNetDriver::OnClientViewPositionsQueryResponse);
+		Receiver->AddEntityQueryDelegate(RequestId, ServerWorkerQueryDelegate);
+	}
+
+	if (bReceivedRemoteClientViewPositions)
+	{
+		UpdateUnobservedActors();
+	}
+}
+
+void USpatialNetDriver::OnClientViewPositionsQueryResponse(const Worker_EntityQueryResponseOp& Op)
+{
+	bClientViewPositionsQueryInFlight = false;
+
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS || !ClientObservationTracker.IsValid())
+	{
+		return;
+	}
+
+	TMap<Worker_EntityId_Key, TArray<FVector>> RemoteViewPositions;
+	for (uint32 i = 0; i < Op.result_count; i++)
+	{
+		const Worker_Entity& Entity = Op.results[i];
+		if (Entity.entity_id == WorkerEntityId)
+		{
+			continue;
+		}
+
+		for (uint32 j = 0; j < Entity.component_count; j++)
+		{
+			if (Entity.components[j].component_id == SpatialConstants::SERVER_WORKER_COMPONENT_ID)
+			{
+				Schema_Object* ComponentObject = Schema_GetComponentDataFields(Entity.components[j].schema_type);
+				SpatialGDK::ServerWorker::GetClientViewPositionsFromSchema(ComponentObject, RemoteViewPositions.FindOrAdd(Entity.entity_id));
+			}
+		}
+	}
+
+	ClientObservationTracker->SetRemoteViewPositions(MoveTemp(RemoteViewPositions));
+	bReceivedRemoteClientViewPositions = true;
+}
+
+// Changes to an actor's tick interval made while it is unobserved are overwritten when it is observed again.
+void USpatialNetDriver::UpdateUnobservedActors()
+{
+	const float UnobservedActorTickInterval = GetDefault<USpatialGDKSettings>()->UnobservedActorTickInterval;
+
+	for (auto It = UnobservedActors.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It.Key().Get();
+		if (Actor == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+		else if (!Actor->HasAuthority() || IsActorObserved(*Actor))
+		{
+			Actor->SetActorTickInterval(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+	{
+		AActor* Actor = ObjectInfo->Actor;
+		if (Actor == nullptr || !Actor->HasAuthority() || UnobservedActors.Contains(Actor) || IsActorObserved(*Actor))
+		{
+			continue;
+		}
+
+		const float TickInterval = Actor->GetActorTickInterval();
+		UnobservedActors.Add(Actor, TickInterval);
+		if (UnobservedActorTickInterval > TickInterval)
+		{
+			Actor->SetActorTickInterval(UnobservedActorTickInterval);
+		}
+	}
+
+	UE_LOG(LogSpatialOSNetDriver, Verbose, TEXT("%d actors are unobserved by %d clients"), UnobservedActors.Num(), ClientObservationTracker->GetNumViewPositions());
+}
+
+bool USpatialNetDriver::IsActorObserved(const AActor& Actor) const
+{
+	// Relevancy of these doesn't depend on distance, so they are never throttled.
+	if (Actor.bAlwaysRelevant || Actor.bOnlyRelevantToOwner || Actor.bNetUseOwnerRelevancy)
+	{
+		return true;
+	}
+
+	return ClientObservationTracker->IsObserved(Actor.GetActorLocation(), Actor.NetCullDistanceSquared);
+}
+
+// Unobserved actors without an entity are still replicated, so that they exist in SpatialOS by the time a client is near them.
+bool USpatialNetDriver::IsActorUnobservedWithEntity(AActor* Actor) const
+{
+	return UnobservedActors.Contains(Actor) && PackageMap->GetEntityIdFromObject(Actor) != SpatialConstants::INVALID_ENTITY_ID;
+}
+
+bool USpatialNetDriver::TryBeginClientRejoin(uint8 ConnectionStatusCode, const FString& Reason)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (IsServer() || !SpatialGDKSettings->bEnableClientFastRejoin || bWaitingForClientRejoinConnection)
+	{
+		return false;
+	}
+
+	// Other failures, such as being rejected or the deployment shutting down, would only happen again.
+	if (ConnectionStatusCode != WORKER_CONNECTION_STATUS_CODE_TIMEOUT && ConnectionStatusCode != WORKER_CONNECTION_STATUS_CODE_NETWORK_ERROR)
+	{
+		return false;
+	}
+
+	const FUnrealObjectRef PlayerControllerRef = GetCurrentPlayerControllerRef();
+	if (PlayerControllerRef.Entity == SpatialConstants::INVALID_ENTITY_ID)
+	{
+		return false;
+	}
+
+	UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("Lost the connection to SpatialOS (%s), trying to rejoin for %.1f seconds."), *Reason, SpatialGDKSettings->ClientRejoinGracePeriod);
+
+	bWaitingForClientRejoinConnection = true;
+	bClientRejoinConnectionInFlight = false;
+	bReconcilingClientRejoin = false;
+	ClientRejoinDeadline = FPlatformTime::Seconds() + SpatialGDKSettings->ClientRejoinGracePeriod;
+	NextClientRejoinAttemptTime = 0.0;
+	ClientRejoinFailureStatusCode = ConnectionStatusCode;
+	ClientRejoinFailureReason = Reason;
+
+	Receiver->OnClientRejoinStarted();
+	PlayerSpawner->SetRejoinPlayerController(Connection->GetWorkerId(), PlayerControllerRef.Entity);
+
+	return true;
+}
+
+void USpatialNetDriver::OnClientRejoinSpawnResponse(bool bRejoined)
+{
+	UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Rejoined SpatialOS, %s."), bRejoined ? TEXT("the player controller was kept") : TEXT("a new player was spawned"));
+	ClientRejoinSpawnResponseTime = FPlatformTime::Seconds();
+}
+
+void USpatialNetDriver::TickClientRejoin()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	if (bReconcilingClientRejoin)
+	{
+		// Entities are checked out again over several op lists once the server has handed the player controller over, so the
+		// rejoin is finished once none has been for a while. If the spawn response never comes, what isn't back by the deadline is removed.
+		const bool bSettled = ClientRejoinSpawnResponseTime > 0.0
+			&& Now - FMath::Max(ClientRejoinSpawnResponseTime, Receiver->GetLastRejoinedEntityTime()) >= SpatialConstants::CLIENT_REJOIN_RECONCILE_SETTLE_SECONDS;
+		if (bSettled || Now >= ClientRejoinDeadline)
+		{
+			Receiver->FinishClientRejoinReconcile();
+			bReconcilingClientRejoin = false;
+		}
+		return;
+	}
+
+	if (Now >= ClientRejoinDeadline)
+	{
+		FailClientRejoin();
+		return;
+	}
+
+	if (bClientRejoinConnectionInFlight || Now < NextClientRejoinAttemptTime)
+	{
+		return;
+	}
+
+	// The op lists received on the lost connection are no longer valid once it's destroyed.
+	if (!GetDefault<USpatialGDKSettings>()->bUseOpListArena)
+	{
+		for (Worker_OpList* OpList : OpBacklog)
+		{
+			Worker_OpList_Destroy(OpList);
+		}
+	}
+	OpBacklog.Reset();
+	OpBacklogIndex = 0;
+
+	bClientRejoinConnectionInFlight = true;
+	ConnectionManager->Reconnect();
+}
+
+void USpatialNetDriver::FailClientRejoin()
+{
+	UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Failed to rejoin SpatialOS within %.1f seconds."), GetDefault<USpatialGDKSettings>()->ClientRejoinGracePeriod);
+
+	bWaitingForClientRejoinConnection = false;
+	bReconcilingClientRejoin = false;
+
+	if (GEngine != nullptr)
+	{
+		GEngine->BroadcastNetworkFailure(GetWorld(), this, ENetworkFailure::FromDisconnectOpStatusCode(ClientRejoinFailureStatusCode), ClientRejoinFailureReason);
+	}
+}
+
+// Each server worker counts up a heartbeat on its ServerWorker component, so the worker hosting the translation manager can tell
+// when one stopped even if its entity is still there, and hand its virtual worker to a standby.
+void USpatialNetDriver::TickServerWorkerHeartbeat()
+{
+	if (Time - TimeWhenServerWorkerHeartbeatLastSent < SpatialConstants::SERVER_WORKER_HEARTBEAT_INTERVAL_SECONDS)
+	{
+		return;
+	}
+	TimeWhenServerWorkerHeartbeatLastSent = Time;
+
+	if (StaticComponentView->HasAuthority(WorkerEntityId, SpatialConstants::SERVER_WORKER_COMPONENT_ID))
+	{
+		FWorkerComponentUpdate Update = SpatialGDK::ServerWorker::CreateServerWorkerHeartbeatUpdate(++ServerWorkerHeartbeat);
+		Connection->SendComponentUpdate(WorkerEntityId, &Update);
+	}
+
+	if (VirtualWorkerTranslationManager.IsValid())
+	{
+		VirtualWorkerTranslationManager->QueryForLostServerWorkers();
+	}
 }
@@ -247,6 +247,26 @@ FUnrealObjectRef USpatialPackageMapClient::GetUnrealObjectRefFromObject(const UO
 	return GetUnrealObjectRefFromNetGUID(NetGUID);
 }
 
+const FSerializedObjectRef* USpatialPackageMapClient::FindSerializedStaticObjectRef(const UObject* Object) const
+{
+	return SerializedStaticObjectRefs.Find(Object);
+}
+
+void USpatialPackageMapClient::AddSerializedStaticObjectRef(const UObject* Object, FSerializedObjectRef&& SerializedRef)
+{
+	SerializedStaticObjectRefs.Add(Object, MoveTemp(SerializedRef));
+}
+
+bool USpatialPackageMapClient::CanCacheSerializedObjectRef(const UObject* Object, const FUnrealObjectRef& ObjectRef)
+{
+	// Objects owned by an actor are referred to by path until the actor has an entity, and by entity and offset after that.
+	return ObjectRef.Path.IsSet()
+		&& ObjectRef.Entity == SpatialConstants::INVALID_ENTITY_ID
+		&& Object->IsFullNameStableForNetworking()
+		&& !Object->IsA<AActor>()
+		&& Object->GetTypedOuter<AActor>() == nullptr;
+}
+
 Worker_EntityId USpatialPackageMapClient::GetEntityIdFromObject(const UObject* Object)
 {
 	if (Object == nullptr)
@@ -385,7 +405,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		NetGUID = AssignNewStablyNamedObjectNetGUID(Actor);
 
 		// We register the entity id ref here.
-		UnrealObjectRefToNetGUID.Emplace(EntityObjectRef, NetGUID);
+		AddNetGUID(EntityObjectRef, NetGUID);
 
 		// Once we have an entity id, we should always be using it to refer to entities.
 		// Since the path ref may have been registered previously, we first try to remove it
@@ -427,7 +447,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 			FUnrealObjectRef StablyNamedSubobjectRef(0, 0, Subobject->GetFName().ToString(), StablyNamedRef);
 
 			// This is the only extra object ref that has to be registered for the subobject.
-			UnrealObjectRefToNetGUID.Emplace(StablyNamedSubobjectRef, SubobjectNetGUID);
+			AddNetGUID(StablyNamedSubobjectRef, SubobjectNetGUID);
 
 			// As the subobject may have be referred to previously in replication flow, it would
 			// have it's stable name registered as it's UnrealObjectRef inside NetGUIDToUnrealObjectRef.
@@ -523,14 +543,14 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 		for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 		{
 			FUnrealObjectRef SubobjectRef(EntityId, SubobjectInfoPair.Key);
-			if (FNetworkGUID* SubobjectNetGUID = UnrealObjectRefToNetGUID.Find(SubobjectRef))
+			if (FNetworkGUID* SubobjectNetGUID = FindNetGUID(SubobjectRef))
 			{
 				NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
-				UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+				RemoveNetGUID(SubobjectRef);
 
 				if (StablyNamedRefOption.IsSet())
 				{
-					UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
+					RemoveNetGUID(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
 				}
 			}
 		}
@@ -545,7 +565,7 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 			{
 				if (FUnrealObjectRef* SubobjectRef = NetGUIDToUnrealObjectRef.Find(*SubobjectNetGUID))
 				{
-					UnrealObjectRefToNetGUID.Remove(*SubobjectRef);
+					RemoveNetGUID(*SubobjectRef);
 					NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
 				}
 			}
@@ -557,18 +577,18 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 	// TODO: Figure out why NetGUIDToUnrealObjectRef might not have this GUID. UNR-989
 	if (FUnrealObjectRef* ActorRef = NetGUIDToUnrealObjectRef.Find(EntityNetGUID))
 	{
-		UnrealObjectRefToNetGUID.Remove(*ActorRef);
+		RemoveNetGUID(*ActorRef);
 	}
 	NetGUIDToUnrealObjectRef.Remove(EntityNetGUID);
 	if (StablyNamedRefOption.IsSet())
 	{
-		UnrealObjectRefToNetGUID.Remove(StablyNamedRefOption.GetValue());
+		RemoveNetGUID(StablyNamedRefOption.GetValue());
 	}
 }
 
 void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& SubobjectRef)
 {
-	if (!UnrealObjectRefToNetGUID.Contains(SubobjectRef))
+	if (FindNetGUID(SubobjectRef) == nullptr)
 	{
 		return;
 	}
@@ -604,13 +624,13 @@ void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& Subobj
 
 			if (StablyNamedRefOption.IsSet())
 			{
-				UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
+				RemoveNetGUID(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
 			}
 		}
 	}
-	FNetworkGUID SubobjectNetGUID = UnrealObjectRefToNetGUID[SubobjectRef];
+	FNetworkGUID SubobjectNetGUID = *FindNetGUID(SubobjectRef);
 	NetGUIDToUnrealObjectRef.Remove(SubobjectNetGUID);
-	UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+	RemoveNetGUID(SubobjectRef);
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -620,7 +640,7 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealOb
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID* CachedGUID = UnrealObjectRefToNetGUID.Find(ObjectRef);
+	FNetworkGUID* CachedGUID = FindNetGUID(ObjectRef);
 	FNetworkGUID NetGUID = CachedGUID ? *CachedGUID : FNetworkGUID{};
 	if (!NetGUID.IsValid() && ObjectRef.Path.IsSet())
 	{
@@ -633,7 +653,7 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const F
 		}
 
 		// Once all outer packages have been resolved, assign a new NetGUID for this object
-		NetGUID = RegisterNetGUIDFromPathForStaticObject(ObjectRef.Path.GetValue(), OuterGUID, ObjectRef.bNoLoadOnClient);
+		NetGUID = RegisterNetGUIDFromPathForStaticObject(ObjectRef.Path->ToString(), OuterGUID, ObjectRef.bNoLoadOnClient);
 		RegisterObjectRef(NetGUID, ObjectRef);
 	}
 	return NetGUID;
@@ -652,9 +672,9 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 	{
 		if (Iterator->Path.IsSet())
 		{
-			FString TempPath(*Iterator->Path);
+			FString TempPath = Iterator->Path->ToString();
 			GEngine->NetworkRemapPath(Driver, TempPath, bReading);
-			Iterator->Path = TempPath;
+			Iterator->Path = FUnrealObjectRefPath(TempPath);
 		}
 		if (!Iterator->Outer.IsSet())
 		{
@@ -666,10 +686,17 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 
 void FSpatialNetGUIDCache::UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID& NetGUID = UnrealObjectRefToNetGUID.FindChecked(ObjectRef);
+	const FNetworkGUID* NetGUID = FindNetGUID(ObjectRef);
+	check(NetGUID != nullptr);
 	// Remove ObjectRef first so the reference above isn't destroyed
-	NetGUIDToUnrealObjectRef.Remove(NetGUID);
-	UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	NetGUIDToUnrealObjectRef.Remove(*NetGUID);
+	RemoveNetGUID(ObjectRef);
+}
+
+SIZE_T FSpatialNetGUIDCache::GetAllocatedSize() const
+{
+	return ObjectLookup.GetAllocatedSize() + NetGUIDLookup.GetAllocatedSize() + NetGUIDToUnrealObjectRef.GetAllocatedSize()
+		+ UnrealObjectRefToNetGUID.GetAllocatedSize() + EntityObjectRefToNetGUID.GetAllocatedSize();
 }
 
 FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const
@@ -681,7 +708,7 @@ FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetw
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromEntityId(Worker_EntityId EntityId) const
 {
 	FUnrealObjectRef ObjRef(EntityId, 0);
-	const FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(ObjRef);
+	const FNetworkGUID* NetGUID = FindNetGUID(ObjRef);
 	return (NetGUID == nullptr) ? FNetworkGUID(0) : *NetGUID;
 }
 
@@ -741,6 +768,45 @@ FNetworkGUID FSpatialNetGUIDCache::GetOrAssignNetGUID_SpatialGDK(UObject* Object
 	return NetGUID;
 }
 
+bool FSpatialNetGUIDCache::IsEntityObjectRef(const FUnrealObjectRef& ObjectRef)
+{
+	return !ObjectRef.Path.IsSet() && !ObjectRef.Outer.IsSet() && !ObjectRef.bUseClassPathToLoadObject;
+}
+
+FNetworkGUID* FSpatialNetGUIDCache::FindNetGUID(const FUnrealObjectRef& ObjectRef)
+{
+	return IsEntityObjectRef(ObjectRef) ? EntityObjectRefToNetGUID.Find(ObjectRef.Entity, ObjectRef.Offset) : UnrealObjectRefToNetGUID.Find(ObjectRef);
+}
+
+const FNetworkGUID* FSpatialNetGUIDCache::FindNetGUID(const FUnrealObjectRef& ObjectRef) const
+{
+	return IsEntityObjectRef(ObjectRef) ? EntityObjectRefToNetGUID.Find(ObjectRef.Entity, ObjectRef.Offset) : UnrealObjectRefToNetGUID.Find(ObjectRef);
+}
+
+void FSpatialNetGUIDCache::AddNetGUID(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID)
+{
+	if (IsEntityObjectRef(ObjectRef))
+	{
+		EntityObjectRefToNetGUID.Add(ObjectRef.Entity, ObjectRef.Offset, NetGUID);
+	}
+	else
+	{
+		UnrealObjectRefToNetGUID.Emplace(ObjectRef, NetGUID);
+	}
+}
+
+void FSpatialNetGUIDCache::RemoveNetGUID(const FUnrealObjectRef& ObjectRef)
+{
+	if (IsEntityObjectRef(ObjectRef))
+	{
+		EntityObjectRefToNetGUID.Remove(ObjectRef.Entity, ObjectRef.Offset);
+	}
+	else
+	{
+		UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	}
+}
+
 void FSpatialNetGUIDCache::RegisterObjectRef(FNetworkGUID NetGUID, const FUnrealObjectRef& ObjectRef)
 {
 	// Registered ObjectRefs should never have PIE.
@@ -750,9 +816,9 @@ void FSpatialNetGUIDCache::RegisterObjectRef(FNetworkGUID NetGUID, const FUnreal
 	checkfSlow(!NetGUIDToUnrealObjectRef.Contains(NetGUID) || (NetGUIDToUnrealObjectRef.Contains(NetGUID) && NetGUIDToUnrealObjectRef.FindChecked(NetGUID) == RemappedObjectRef),
 		TEXT("NetGUID to UnrealObjectRef mismatch - NetGUID: %s ObjRef in map: %s ObjRef expected: %s"), *NetGUID.ToString(),
 		*NetGUIDToUnrealObjectRef.FindChecked(NetGUID).ToString(), *RemappedObjectRef.ToString());
-	checkfSlow(!UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) || (UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) && UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef) == NetGUID),
+	checkfSlow(FindNetGUID(RemappedObjectRef) == nullptr || *FindNetGUID(RemappedObjectRef) == NetGUID,
 		TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"), *NetGUID.ToString(),
-		*UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef).ToString(), *RemappedObjectRef.ToString());
+		*FindNetGUID(RemappedObjectRef)->ToString(), *RemappedObjectRef.ToString());
 	NetGUIDToUnrealObjectRef.Emplace(NetGUID, RemappedObjectRef);
-	UnrealObjectRefToNetGUID.Emplace(RemappedObjectRef, NetGUID);
+	AddNetGUID(RemappedObjectRef, NetGUID);
 }
@@ -4,6 +4,237 @@
 
 #include "EngineClasses/SpatialActorChannel.h"
 #include "EngineClasses/SpatialNetDriver.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialReplicationGraph);
+
+USpatialReplicationGraphNode_InterestGrid::USpatialReplicationGraphNode_InterestGrid()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void USpatialReplicationGraphNode_InterestGrid::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (ActorToCells.Contains(Actor))
+	{
+		return;
+	}
+
+	if (AllActors.Num() == 0)
+	{
+		AllActors.PrepareForWrite();
+	}
+	AllActors.Add(Actor);
+
+	FActorCells& ActorCells = ActorToCells.Add(Actor);
+	ActorCells.bUnbounded = false;
+	ActorCells.bStatic = !Actor->IsRootComponentMovable();
+
+	if (GetCellsForActor(*Actor, ActorCells.Cells))
+	{
+		AddActorToCells(Actor, ActorCells.Cells);
+	}
+	else
+	{
+		if (UnboundedActors.Num() == 0)
+		{
+			UnboundedActors.PrepareForWrite();
+		}
+		UnboundedActors.Add(Actor);
+		ActorCells.bUnbounded = true;
+	}
+}
+
+bool USpatialReplicationGraphNode_InterestGrid::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	AActor* Actor = ActorInfo.Actor;
+
+	FActorCells ActorCells;
+	if (!ActorToCells.RemoveAndCopyValue(Actor, ActorCells))
+	{
+		UE_CLOG(bWarnIfNotFound, LogSpatialReplicationGraph, Warning, TEXT("Attempted to remove %s from the interest grid, but it was not in it."), *GetNameSafe(Actor));
+		return false;
+	}
+
+	AllActors.RemoveFast(Actor);
+	if (ActorCells.bUnbounded)
+	{
+		UnboundedActors.RemoveFast(Actor);
+	}
+	else
+	{
+		RemoveActorFromCells(Actor, ActorCells.Cells);
+	}
+
+	return true;
+}
+
+void USpatialReplicationGraphNode_InterestGrid::NotifyResetAllNetworkActors()
+{
+	Cells.Reset();
+	ActorToCells.Reset();
+	UnboundedActors.Reset();
+	AllActors.Reset();
+	GatheredActors.Reset();
+	GatheredActorSet.Reset();
+	NextOutOfRangeActorIndex = 0;
+}
+
+void USpatialReplicationGraphNode_InterestGrid::PrepareForReplication()
+{
+	// Only movable actors can change cells, static actors keep the cells they were added to.
+	for (TPair<FActorRepListType, FActorCells>& ActorCellsPair : ActorToCells)
+	{
+		FActorCells& ActorCells = ActorCellsPair.Value;
+		if (ActorCells.bStatic || ActorCells.bUnbounded)
+		{
+			continue;
+		}
+
+		AActor* Actor = ActorCellsPair.Key;
+		FIntRect NewCells;
+		if (GetCellsForActor(*Actor, NewCells) && NewCells != ActorCells.Cells)
+		{
+			RemoveActorFromCells(Actor, ActorCells.Cells);
+			AddActorToCells(Actor, NewCells);
+			ActorCells.Cells = NewCells;
+		}
+	}
+
+	if (GatheredActors.Num() == 0)
+	{
+		GatheredActors.PrepareForWrite();
+	}
+	GatheredActors.Reset();
+	GatheredActorSet.Reset();
+
+	GatherActorList(UnboundedActors);
+	GatherOutOfRangeSlice();
+
+	// Each actor is added to every cell its cull distance overlaps, so only the viewer's own cell needs to be gathered.
+	TSet<FIntPoint> ViewerCells;
+	for (const FVector& ViewerLocation : ViewerLocations)
+	{
+		bool bAlreadyGathered = false;
+		const FIntPoint ViewerCell = GetCell(ViewerLocation);
+		ViewerCells.Add(ViewerCell, &bAlreadyGathered);
+		if (bAlreadyGathered)
+		{
+			continue;
+		}
+
+		if (const FActorRepListRefView* CellActors = Cells.Find(ViewerCell))
+		{
+			GatherActorList(*CellActors);
+		}
+	}
+}
+
+void USpatialReplicationGraphNode_InterestGrid::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (GatheredActors.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(GatheredActors);
+	}
+}
+
+FIntPoint USpatialReplicationGraphNode_InterestGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+bool USpatialReplicationGraphNode_InterestGrid::GetCellsForActor(const AActor& Actor, FIntRect& OutCells) const
+{
+	const float CullDistance = FMath::Sqrt(Actor.NetCullDistanceSquared);
+	if (CullDistance / CellSize > MaxCellsPerAxis)
+	{
+		return false;
+	}
+
+	const FVector Location = Actor.GetActorLocation();
+	OutCells.Min = GetCell(Location - FVector(CullDistance, CullDistance, 0.0f));
+	// FIntRect is exclusive of Max.
+	OutCells.Max = GetCell(Location + FVector(CullDistance, CullDistance, 0.0f)) + FIntPoint(1, 1);
+	return true;
+}
+
+void USpatialReplicationGraphNode_InterestGrid::AddActorToCells(AActor* Actor, const FIntRect& InCells)
+{
+	for (int32 X = InCells.Min.X; X < InCells.Max.X; X++)
+	{
+		for (int32 Y = InCells.Min.Y; Y < InCells.Max.Y; Y++)
+		{
+			FActorRepListRefView* CellActors = Cells.Find(FIntPoint(X, Y));
+			if (CellActors == nullptr)
+			{
+				CellActors = &Cells.Add(FIntPoint(X, Y));
+				CellActors->PrepareForWrite();
+			}
+			CellActors->Add(Actor);
+		}
+	}
+}
+
+void USpatialReplicationGraphNode_InterestGrid::RemoveActorFromCells(AActor* Actor, const FIntRect& InCells)
+{
+	for (int32 X = InCells.Min.X; X < InCells.Max.X; X++)
+	{
+		for (int32 Y = InCells.Min.Y; Y < InCells.Max.Y; Y++)
+		{
+			const FIntPoint Cell(X, Y);
+			if (FActorRepListRefView* CellActors = Cells.Find(Cell))
+			{
+				CellActors->RemoveFast(Actor);
+				if (CellActors->Num() == 0)
+				{
+					Cells.Remove(Cell);
+				}
+			}
+		}
+	}
+}
+
+void USpatialReplicationGraphNode_InterestGrid::GatherOutOfRangeSlice()
+{
+	const int32 NumActors = AllActors.Num();
+	if (OutOfRangeReplicationPeriodFrames == 0 || NumActors == 0)
+	{
+		return;
+	}
+
+	// Removing actors swaps others into their place, so an actor can occasionally wait an extra period.
+	const int32 SliceSize = FMath::DivideAndRoundUp(NumActors, static_cast<int32>(OutOfRangeReplicationPeriodFrames));
+	for (int32 i = 0; i < SliceSize; i++)
+	{
+		if (NextOutOfRangeActorIndex >= NumActors)
+		{
+			NextOutOfRangeActorIndex = 0;
+		}
+
+		bool bAlreadyGathered = false;
+		AActor* Actor = AllActors[NextOutOfRangeActorIndex++];
+		GatheredActorSet.Add(Actor, &bAlreadyGathered);
+		if (!bAlreadyGathered)
+		{
+			GatheredActors.Add(Actor);
+		}
+	}
+}
+
+void USpatialReplicationGraphNode_InterestGrid::GatherActorList(const FActorRepListRefView& ActorList)
+{
+	for (int32 i = 0; i < ActorList.Num(); i++)
+	{
+		bool bAlreadyGathered = false;
+		GatheredActorSet.Add(ActorList[i], &bAlreadyGathered);
+		if (!bAlreadyGathered)
+		{
+			GatheredActors.Add(ActorList[i]);
+		}
+	}
+}
 
 UActorChannel* USpatialReplicationGraph::GetOrCreateSpatialActorChannel(UObject* TargetObject)
 {
@@ -19,3 +250,116 @@ UActorChannel* USpatialReplicationGraph::GetOrCreateSpatialActorChannel(UObject*
 
 	return nullptr;
 }
+
+void USpatialReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	InitClassReplicationInfo(AActor::StaticClass());
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+		if (ActorCDO == nullptr || !ActorCDO->GetIsReplicated())
+		{
+			continue;
+		}
+
+		if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists) ||
+			Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		InitClassReplicationInfo(Class);
+	}
+}
+
+void USpatialReplicationGraph::InitClassReplicationInfo(UClass* Class)
+{
+	const AActor* ActorCDO = GetDefault<AActor>(Class);
+
+	FClassReplicationInfo ClassInfo;
+	ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(ActorCDO->NetUpdateFrequency);
+	// Distance culling is done by the interest grid against the client viewers. The SpatialOS connection has no view location
+	// of its own, so culling against it would drop every actor away from the world origin.
+	ClassInfo.SetCullDistanceSquared(0.0f);
+
+	GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+}
+
+void USpatialReplicationGraph::InitGlobalGraphNodes()
+{
+	InterestGridNode = CreateNewNode<USpatialReplicationGraphNode_InterestGrid>();
+	InterestGridNode->CellSize = FMath::Max(GridCellSize, 1.0f);
+	InterestGridNode->MaxCellsPerAxis = FMath::Max(GridMaxCellsPerAxis, 1);
+	InterestGridNode->OutOfRangeReplicationPeriodFrames = OutOfRangeReplicationPeriodFrames;
+	AddGlobalGraphNode(InterestGridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+bool USpatialReplicationGraph::IsAlwaysRelevant(const AActor& Actor) const
+{
+	// Owner only relevancy is handled by SpatialOS interest for the owning client, so the server replicates these to SpatialOS
+	// regardless of where its clients are.
+	return Actor.bAlwaysRelevant || Actor.bOnlyRelevantToOwner;
+}
+
+void USpatialReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	if (IsAlwaysRelevant(*ActorInfo.Actor))
+	{
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+	}
+	else
+	{
+		InterestGridNode->NotifyAddNetworkActor(ActorInfo);
+	}
+}
+
+void USpatialReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	// Relevancy flags may have changed since the actor was added, so check both nodes.
+	const bool bWarnIfNotFound = false;
+	if (!InterestGridNode->NotifyRemoveNetworkActor(ActorInfo, bWarnIfNotFound))
+	{
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+	}
+}
+
+int32 USpatialReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	if (InterestGridNode != nullptr)
+	{
+		InterestGridNode->SetViewerLocations(GatherViewerLocations());
+	}
+
+	return Super::ServerReplicateActors(DeltaSeconds);
+}
+
+TArray<FVector> USpatialReplicationGraph::GatherViewerLocations() const
+{
+	TArray<FVector> ViewerLocations;
+
+	// The SpatialOS connection borrows the view targets of the client connections, the first connection is the SpatialOS connection itself.
+	for (int32 i = 1; i < NetDriver->ClientConnections.Num(); i++)
+	{
+		UNetConnection* ClientConnection = NetDriver->ClientConnections[i];
+		if (ClientConnection != nullptr && ClientConnection->ViewTarget != nullptr)
+		{
+			ViewerLocations.Add(FNetViewer(ClientConnection, 0.0f).ViewLocation);
+		}
+	}
+
+	// Clients of other server workers can check out the actors this server replicates, see USpatialNetDriver::TickClientObservation.
+	const USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(NetDriver);
+	if (SpatialNetDriver != nullptr && SpatialNetDriver->ClientObservationTracker.IsValid())
+	{
+		SpatialNetDriver->ClientObservationTracker->AppendRemoteViewPositions(ViewerLocations);
+	}
+
+	return ViewerLocations;
+}
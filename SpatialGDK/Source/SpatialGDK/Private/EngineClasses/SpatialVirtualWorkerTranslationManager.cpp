@@ -4,6 +4,8 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialOSDispatcherInterface.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "Schema/ServerWorker.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
@@ -17,17 +19,53 @@ SpatialVirtualWorkerTranslationManager::SpatialVirtualWorkerTranslationManager(
 	, Connection(InConnection)
 	, Translator(InTranslator)
 	, bWorkerEntityQueryInFlight(false)
+	, bMappingPublished(false)
+	, bMappingDirty(false)
+	, bServerWorkerFailoverEnabled(false)
+	, ServerWorkerHeartbeatTimeout(0.f)
 {}
 
+void SpatialVirtualWorkerTranslationManager::SetLoadBalanceStrategy(UAbstractLBStrategy* InLoadBalanceStrategy)
+{
+	LoadBalanceStrategy = InLoadBalanceStrategy;
+}
+
+void SpatialVirtualWorkerTranslationManager::QueryForServerWorkerLoads()
+{
+	// Loads are only gathered once the mapping is complete, so every load can be attributed to a virtual worker.
+	if (!bMappingPublished || bWorkerEntityQueryInFlight || !LoadBalanceStrategy.IsValid() || !LoadBalanceStrategy->RequiresWorkerLoadReports())
+	{
+		return;
+	}
+
+	QueryForServerWorkerEntities();
+}
+
+void SpatialVirtualWorkerTranslationManager::EnableServerWorkerFailover(float HeartbeatTimeout)
+{
+	bServerWorkerFailoverEnabled = true;
+	ServerWorkerHeartbeatTimeout = HeartbeatTimeout;
+}
+
+void SpatialVirtualWorkerTranslationManager::QueryForLostServerWorkers()
+{
+	if (!bMappingPublished || bWorkerEntityQueryInFlight || !bServerWorkerFailoverEnabled)
+	{
+		return;
+	}
+
+	QueryForServerWorkerEntities();
+}
+
 void SpatialVirtualWorkerTranslationManager::SetNumberOfVirtualWorkers(const uint32 NumVirtualWorkers)
 {
 	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("TranslationManager is configured to look for %d workers"), NumVirtualWorkers);
 
-	// Currently, this should only be called once on startup. In the future we may allow for more
-	// flexibility. 
+	// This should only be called once on startup. Strategies which don't need all of the virtual workers
+	// at once say so through IsVirtualWorkerRequiredToStart instead.
 	for (uint32 i = 1; i <= NumVirtualWorkers; i++)
 	{
-		UnassignedVirtualWorkers.Enqueue(i);
+		UnassignedVirtualWorkers.Add(i);
 	}
 }
 
@@ -63,11 +101,19 @@ void SpatialVirtualWorkerTranslationManager::WriteMappingToSchema(Schema_Object*
 		SpatialGDK::AddStringToSchema(EntryObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, Entry.Value.Key);
 		Schema_AddEntityId(EntryObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID, Entry.Value.Value);
 	}
+
+	for (const auto& Entry : VirtualToStandbyWorkerMapping)
+	{
+		Schema_Object* EntryObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID);
+		Schema_AddUint32(EntryObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID, Entry.Key);
+		SpatialGDK::AddStringToSchema(EntryObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, Entry.Value.Key);
+		Schema_AddEntityId(EntryObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID, Entry.Value.Value);
+	}
 }
 
 // This method is called on the worker who is authoritative over the translation mapping. Based on the results of the
 // system entity query, assign the VirtualWorkerIds to the workers represented by the system entities.
-void SpatialVirtualWorkerTranslationManager::ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op)
+void SpatialVirtualWorkerTranslationManager::ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op, const TSet<PhysicalWorkerName>* LiveWorkers)
 {
 	// The query response is an array of entities. Each of these represents a worker.
 	for (uint32_t i = 0; i < Op.result_count; ++i)
@@ -93,11 +139,10 @@ void SpatialVirtualWorkerTranslationManager::ConstructVirtualWorkerMappingFromQu
 
 				// If we didn't find all our server worker entities the first time, future query responses should
 				// ignore workers that we have already assigned a virtual worker ID.
-				if (!UnassignedVirtualWorkers.IsEmpty())
+				const PhysicalWorkerName WorkerName = SpatialGDK::GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
+				if (UnassignedVirtualWorkers.Num() > 0 && (LiveWorkers == nullptr || LiveWorkers->Contains(WorkerName)))
 				{
-					// TODO(zoning): Currently, this only works if server workers never die. Once we want to support replacing
-					// workers, this will need to process UnassignWorker before processing AssignWorker.
-					AssignWorker(SpatialGDK::GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID), Entity.entity_id);
+					AssignWorker(WorkerName, Entity.entity_id);
 				}
 			}
 		}
@@ -114,7 +159,26 @@ void SpatialVirtualWorkerTranslationManager::SendVirtualWorkerMappingUpdate()
 	Update.schema_type = Schema_CreateComponentUpdate();
 	Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
-	WriteMappingToSchema(UpdateObject);
+	// List fields are replaced as a whole by an update that sets them, and kept when it doesn't, so the mapping is only written
+	// when it changed. Every translator then only re-parses the mapping when there's something new in it.
+	if (bMappingDirty || !bMappingPublished)
+	{
+		WriteMappingToSchema(UpdateObject);
+		bMappingDirty = false;
+
+		// The standby list is written along with the mapping, so an empty one has to be cleared explicitly.
+		if (VirtualToStandbyWorkerMapping.Num() == 0)
+		{
+			Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID);
+		}
+	}
+
+	if (LoadBalanceStrategy.IsValid() && LoadBalanceStrategy->RequiresWorkerLoadReports())
+	{
+		LoadBalanceStrategy->WriteRegionsToSchema(UpdateObject);
+	}
+
+	bMappingPublished = true;
 
 	check(Connection != nullptr);
 	Connection->SendComponentUpdate(SpatialConstants::INITIAL_VIRTUAL_WORKER_TRANSLATOR_ENTITY_ID, &Update);
@@ -167,6 +231,16 @@ void SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate(con
 {
 	bWorkerEntityQueryInFlight = false;
 
+	// Once the mapping has been published, queries are only sent to gather worker loads and find lost server workers.
+	if (bMappingPublished)
+	{
+		if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
+		{
+			RebalanceFromQueryResponse(Op);
+		}
+		return;
+	}
+
 	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 	{
 		UE_LOG(LogSpatialVirtualWorkerTranslationManager, Warning, TEXT("Could not find ServerWorker Entities via entity query: %s, retrying."), UTF8_TO_TCHAR(Op.message));
@@ -178,7 +252,7 @@ void SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate(con
 	}
 
 	// If the translation mapping is complete, publish it. Otherwise retry the server worker entity query.
-	if (UnassignedVirtualWorkers.IsEmpty())
+	if (!HasUnassignedRequiredWorkers())
 	{
 		SendVirtualWorkerMappingUpdate();
 	}
@@ -189,6 +263,153 @@ void SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate(con
 	}
 }
 
+void SpatialVirtualWorkerTranslationManager::RebalanceFromQueryResponse(const Worker_EntityQueryResponseOp& Op)
+{
+	UpdateServerWorkersFromQueryResponse(Op);
+
+	if (LoadBalanceStrategy.IsValid() && LoadBalanceStrategy->RequiresWorkerLoadReports())
+	{
+		WorkerLoadVectors.Reset();
+
+		for (uint32_t i = 0; i < Op.result_count; ++i)
+		{
+			const Worker_Entity& Entity = Op.results[i];
+			for (uint32_t j = 0; j < Entity.component_count; j++)
+			{
+				const Worker_ComponentData& Data = Entity.components[j];
+				if (Data.component_id == SpatialConstants::SERVER_WORKER_COMPONENT_ID)
+				{
+					Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+					const PhysicalWorkerName WorkerName = SpatialGDK::GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
+
+					if (const VirtualWorkerId* Id = PhysicalToVirtualWorkerMapping.Find(WorkerName))
+					{
+						SpatialGDK::FWorkerLoadVector LoadVector;
+						if (SpatialGDK::ServerWorker::GetLoadVectorFromSchema(ComponentObject, LoadVector))
+						{
+							WorkerLoadVectors.Add(*Id, LoadVector);
+							LoadBalanceStrategy->ReportWorkerLoadVector(*Id, LoadVector);
+						}
+						LoadBalanceStrategy->ReportWorkerLoad(*Id, SpatialGDK::ServerWorker::GetLoadFromSchema(ComponentObject));
+					}
+				}
+			}
+		}
+
+		if (LoadBalanceStrategy->RebalanceRegions())
+		{
+			UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Load balancing regions changed, publishing translation update."));
+			SendVirtualWorkerMappingUpdate();
+			OnRegionsChanged.ExecuteIfBound();
+			return;
+		}
+	}
+
+	if (bMappingDirty)
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Server workers joined or left, publishing translation update."));
+		SendVirtualWorkerMappingUpdate();
+	}
+}
+
+void SpatialVirtualWorkerTranslationManager::UpdateServerWorkersFromQueryResponse(const Worker_EntityQueryResponseOp& Op)
+{
+	// Server workers whose entity is gone, or whose heartbeat stopped, have left the deployment.
+	const double Now = FPlatformTime::Seconds();
+	TMap<PhysicalWorkerName, FServerWorkerHeartbeat> Heartbeats;
+	TSet<PhysicalWorkerName> LiveWorkers;
+	TArray<TPair<PhysicalWorkerName, Worker_EntityId>> ReadyWorkers;
+	for (uint32_t i = 0; i < Op.result_count; ++i)
+	{
+		const Worker_Entity& Entity = Op.results[i];
+		for (uint32_t j = 0; j < Entity.component_count; j++)
+		{
+			const Worker_ComponentData& Data = Entity.components[j];
+			if (Data.component_id == SpatialConstants::SERVER_WORKER_COMPONENT_ID)
+			{
+				const Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+				const PhysicalWorkerName WorkerName = SpatialGDK::GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
+
+				if (bServerWorkerFailoverEnabled
+					&& !UpdateServerWorkerHeartbeat(WorkerName, SpatialGDK::ServerWorker::GetHeartbeatFromSchema(ComponentObject), Now, Heartbeats))
+				{
+					continue;
+				}
+
+				LiveWorkers.Add(WorkerName);
+				if (SpatialGDK::GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID))
+				{
+					ReadyWorkers.Add(MakeTuple(WorkerName, Entity.entity_id));
+				}
+			}
+		}
+	}
+	ServerWorkerHeartbeats = MoveTemp(Heartbeats);
+
+	TArray<PhysicalWorkerName> LostStandbyWorkers;
+	for (const auto& Entry : StandbyToVirtualWorkerMapping)
+	{
+		if (!LiveWorkers.Contains(Entry.Key))
+		{
+			LostStandbyWorkers.Add(Entry.Key);
+		}
+	}
+	for (const PhysicalWorkerName& WorkerName : LostStandbyWorkers)
+	{
+		UnassignStandbyWorker(WorkerName);
+	}
+
+	// The virtual workers of lost server workers go to their standby if they have one. The others are freed before
+	// assigning new server workers, so a replacement can take one over.
+	TArray<PhysicalWorkerName> LostWorkers;
+	for (const auto& Entry : PhysicalToVirtualWorkerMapping)
+	{
+		if (!LiveWorkers.Contains(Entry.Key))
+		{
+			LostWorkers.Add(Entry.Key);
+		}
+	}
+	for (const PhysicalWorkerName& WorkerName : LostWorkers)
+	{
+		if (!ReplaceWithStandby(WorkerName))
+		{
+			UnassignWorker(WorkerName);
+		}
+	}
+
+	if (UnassignedVirtualWorkers.Num() > 0)
+	{
+		ConstructVirtualWorkerMappingFromQueryResponse(Op, &LiveWorkers);
+	}
+
+	if (bServerWorkerFailoverEnabled)
+	{
+		for (const TPair<PhysicalWorkerName, Worker_EntityId>& Worker : ReadyWorkers)
+		{
+			if (!PhysicalToVirtualWorkerMapping.Contains(Worker.Key) && !StandbyToVirtualWorkerMapping.Contains(Worker.Key))
+			{
+				AssignStandbyWorker(Worker.Key, Worker.Value);
+			}
+		}
+	}
+}
+
+bool SpatialVirtualWorkerTranslationManager::UpdateServerWorkerHeartbeat(const PhysicalWorkerName& Name, uint64 Heartbeat, double Now, TMap<PhysicalWorkerName, FServerWorkerHeartbeat>& OutHeartbeats) const
+{
+	// The heartbeat is a counter rather than a timestamp, so only the time this worker last saw it change matters.
+	FServerWorkerHeartbeat Entry{ Heartbeat, Now };
+	if (const FServerWorkerHeartbeat* Previous = ServerWorkerHeartbeats.Find(Name))
+	{
+		if (Previous->Heartbeat == Heartbeat)
+		{
+			Entry.LastChangedTime = Previous->LastChangedTime;
+		}
+	}
+	OutHeartbeats.Add(Name, Entry);
+
+	return Now - Entry.LastChangedTime <= ServerWorkerHeartbeatTimeout;
+}
+
 void SpatialVirtualWorkerTranslationManager::AssignWorker(const PhysicalWorkerName& Name, const Worker_EntityId& ServerWorkerEntityId)
 {
 	if (PhysicalToVirtualWorkerMapping.Contains(Name))
@@ -196,12 +417,109 @@ void SpatialVirtualWorkerTranslationManager::AssignWorker(const PhysicalWorkerNa
 		return;
 	}
 
-	// Get a VirtualWorkerId from the list of unassigned work.
-	VirtualWorkerId Id;
-	UnassignedVirtualWorkers.Dequeue(Id);
+	// A standby is the quickest to take over a virtual worker which has no server worker, even if it wasn't the one it had interest on.
+	UnassignStandbyWorker(Name);
+
+	// Get a VirtualWorkerId from the list of unassigned work, preferring the ones required to start.
+	int32 Index = UnassignedVirtualWorkers.IndexOfByPredicate([this](VirtualWorkerId UnassignedId) { return IsRequiredToStart(UnassignedId); });
+	if (Index == INDEX_NONE)
+	{
+		Index = 0;
+	}
+	const VirtualWorkerId Id = UnassignedVirtualWorkers[Index];
+	UnassignedVirtualWorkers.RemoveAt(Index);
 
 	VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
 	PhysicalToVirtualWorkerMapping.Add(Name, Id);
+	bMappingDirty = true;
 
 	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Assigned VirtualWorker %d to simulate on Worker %s"), Id, *Name);
 }
+
+void SpatialVirtualWorkerTranslationManager::UnassignWorker(const PhysicalWorkerName& Name)
+{
+	VirtualWorkerId Id;
+	if (!PhysicalToVirtualWorkerMapping.RemoveAndCopyValue(Name, Id))
+	{
+		return;
+	}
+
+	VirtualToPhysicalWorkerMapping.Remove(Id);
+	UnassignedVirtualWorkers.Add(Id);
+	UnassignedVirtualWorkers.Sort();
+	bMappingDirty = true;
+
+	if (LoadBalanceStrategy.IsValid())
+	{
+		LoadBalanceStrategy->ReportWorkerLost(Id);
+	}
+
+	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Unassigned VirtualWorker %d from Worker %s, which left the deployment"), Id, *Name);
+}
+
+bool SpatialVirtualWorkerTranslationManager::ReplaceWithStandby(const PhysicalWorkerName& Name)
+{
+	const VirtualWorkerId* Id = PhysicalToVirtualWorkerMapping.Find(Name);
+	if (Id == nullptr)
+	{
+		return false;
+	}
+
+	const VirtualWorkerId LostVirtualWorkerId = *Id;
+	TPair<PhysicalWorkerName, Worker_EntityId> Standby;
+	if (!VirtualToStandbyWorkerMapping.RemoveAndCopyValue(LostVirtualWorkerId, Standby))
+	{
+		return false;
+	}
+	StandbyToVirtualWorkerMapping.Remove(Standby.Key);
+
+	PhysicalToVirtualWorkerMapping.Remove(Name);
+	PhysicalToVirtualWorkerMapping.Add(Standby.Key, LostVirtualWorkerId);
+	VirtualToPhysicalWorkerMapping.Add(LostVirtualWorkerId, Standby);
+	bMappingDirty = true;
+
+	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Worker %s left the deployment, its standby %s took over VirtualWorker %d"), *Name, *Standby.Key, LostVirtualWorkerId);
+	return true;
+}
+
+void SpatialVirtualWorkerTranslationManager::AssignStandbyWorker(const PhysicalWorkerName& Name, const Worker_EntityId& ServerWorkerEntityId)
+{
+	// Stand by for the first assigned virtual worker without a standby.
+	TArray<VirtualWorkerId> AssignedVirtualWorkers;
+	VirtualToPhysicalWorkerMapping.GetKeys(AssignedVirtualWorkers);
+	AssignedVirtualWorkers.Sort();
+
+	const VirtualWorkerId* Id = AssignedVirtualWorkers.FindByPredicate([this](VirtualWorkerId AssignedId) { return !VirtualToStandbyWorkerMapping.Contains(AssignedId); });
+	if (Id == nullptr)
+	{
+		return;
+	}
+
+	VirtualToStandbyWorkerMapping.Add(*Id, MakeTuple(Name, ServerWorkerEntityId));
+	StandbyToVirtualWorkerMapping.Add(Name, *Id);
+	bMappingDirty = true;
+
+	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Worker %s is standing by for VirtualWorker %d"), *Name, *Id);
+}
+
+void SpatialVirtualWorkerTranslationManager::UnassignStandbyWorker(const PhysicalWorkerName& Name)
+{
+	VirtualWorkerId Id;
+	if (!StandbyToVirtualWorkerMapping.RemoveAndCopyValue(Name, Id))
+	{
+		return;
+	}
+
+	VirtualToStandbyWorkerMapping.Remove(Id);
+	bMappingDirty = true;
+}
+
+bool SpatialVirtualWorkerTranslationManager::IsRequiredToStart(VirtualWorkerId Id) const
+{
+	return !LoadBalanceStrategy.IsValid() || LoadBalanceStrategy->IsVirtualWorkerRequiredToStart(Id);
+}
+
+bool SpatialVirtualWorkerTranslationManager::HasUnassignedRequiredWorkers() const
+{
+	return UnassignedVirtualWorkers.ContainsByPredicate([this](VirtualWorkerId Id) { return IsRequiredToStart(Id); });
+}
@@ -13,13 +13,14 @@ SpatialVirtualWorkerTranslator::SpatialVirtualWorkerTranslator(UAbstractLBStrate
 	, bIsReady(false)
 	, LocalPhysicalWorkerName(InPhysicalWorkerName)
 	, LocalVirtualWorkerId(SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	, LocalStandbyVirtualWorkerId(SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
 {}
 
 const PhysicalWorkerName* SpatialVirtualWorkerTranslator::GetPhysicalWorkerForVirtualWorker(VirtualWorkerId Id) const
 {
-	if (const TPair<PhysicalWorkerName, Worker_EntityId>* PhysicalWorkerInfo = VirtualToPhysicalWorkerMapping.Find(Id))
+	if (VirtualToPhysicalWorkerMapping.IsValidIndex(Id) && VirtualToPhysicalWorkerMapping[Id].bAssigned)
 	{
-		return &PhysicalWorkerInfo->Key;
+		return &VirtualToPhysicalWorkerMapping[Id].Name;
 	}
 
 	return nullptr;
@@ -27,25 +28,45 @@ const PhysicalWorkerName* SpatialVirtualWorkerTranslator::GetPhysicalWorkerForVi
 
 Worker_EntityId SpatialVirtualWorkerTranslator::GetServerWorkerEntityForVirtualWorker(VirtualWorkerId Id) const
 {
-	if (const TPair<PhysicalWorkerName, Worker_EntityId>* PhysicalWorkerInfo = VirtualToPhysicalWorkerMapping.Find(Id))
+	if (VirtualToPhysicalWorkerMapping.IsValidIndex(Id) && VirtualToPhysicalWorkerMapping[Id].bAssigned)
 	{
-		return PhysicalWorkerInfo->Value;
+		return VirtualToPhysicalWorkerMapping[Id].ServerWorkerEntityId;
 	}
 
 	return SpatialConstants::INVALID_ENTITY_ID;
 }
 
-void SpatialVirtualWorkerTranslator::ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject)
+bool SpatialVirtualWorkerTranslator::ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject)
 {
-    UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("(%d) ApplyVirtualWorkerManagerData"), LocalVirtualWorkerId);
+	// The translation schema is a list of Mappings, where each entry has a virtual and physical worker ID. Updates which only
+	// move load balancing regions don't carry the mapping, so there's nothing to re-parse for them.
+	bool bStandbyChanged = false;
+	if (Schema_GetObjectCount(ComponentObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID) > 0)
+	{
+		const int32 NumChanged = ApplyMappingFromSchema(ComponentObject);
+		bStandbyChanged = ApplyStandbyMappingFromSchema(ComponentObject);
+		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("(%d) ApplyVirtualWorkerManagerData, %d virtual workers changed"), LocalVirtualWorkerId, NumChanged);
 
-	// The translation schema is a list of Mappings, where each entry has a virtual and physical worker ID. 
-	ApplyMappingFromSchema(ComponentObject);
+		if (NumChanged > 0)
+		{
+			MappingVersion++;
+			for (VirtualWorkerId Id = 0; Id < static_cast<VirtualWorkerId>(VirtualToPhysicalWorkerMapping.Num()); Id++)
+			{
+				const FVirtualWorkerMapping& Entry = VirtualToPhysicalWorkerMapping[Id];
+				if (Entry.bAssigned)
+				{
+					UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), Id, *Entry.Name, Entry.ServerWorkerEntityId);
+				}
+			}
+		}
+	}
 
-	for (const auto& Entry : VirtualToPhysicalWorkerMapping)
+	if (LoadBalanceStrategy.IsValid())
 	{
-		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), Entry.Key, *(Entry.Value.Key), Entry.Value.Value);
+		return LoadBalanceStrategy->ApplyRegionsFromSchema(ComponentObject) || bStandbyChanged;
 	}
+
+	return bStandbyChanged;
 }
 
 // Check to see if this worker's physical worker name is in the mapping. If it isn't, it's possibly an old mapping.
@@ -71,42 +92,138 @@ bool SpatialVirtualWorkerTranslator::IsValidMapping(Schema_Object* Object) const
 		}
 	}
 
+	// A mapping handing our virtual worker to another server worker is current, this worker has been replaced.
+	for (int32 i = 0; LocalVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && i < TranslationCount; i++)
+	{
+		Schema_Object* MappingObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID, i);
+		if (Schema_GetUint32(MappingObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID) == LocalVirtualWorkerId)
+		{
+			return true;
+		}
+	}
+
+	// Standby workers aren't in the mapping until they take over a virtual worker.
+	const int32 StandbyCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID);
+	for (int32 i = 0; i < StandbyCount; i++)
+	{
+		Schema_Object* StandbyObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID, i);
+		if (SpatialGDK::GetStringFromSchema(StandbyObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME) == LocalPhysicalWorkerName)
+		{
+			return true;
+		}
+	}
+
 	return false;
 }
 
 // The translation schema is a list of Mappings, where each entry has a virtual and physical worker ID.
 // This method should only be called on workers who are not authoritative over the mapping and also when
 // a worker first becomes authoritative for the mapping.
-void SpatialVirtualWorkerTranslator::ApplyMappingFromSchema(Schema_Object* Object)
+int32 SpatialVirtualWorkerTranslator::ApplyMappingFromSchema(Schema_Object* Object)
 {
 	if (!IsValidMapping(Object))
 	{
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Received invalid mapping, likely due to PiE restart, will wait for a valid version."));
-		return;
+		return 0;
 	}
 
-	// Resize the map to accept the new data.
-	VirtualToPhysicalWorkerMapping.Empty();
+	// The list always holds the full mapping, so it's parsed into a new array and compared entry by entry with the current one.
+	TArray<FVirtualWorkerMapping> NewMapping;
 	int32 TranslationCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
-	VirtualToPhysicalWorkerMapping.Reserve(TranslationCount);
+	NewMapping.SetNum(TranslationCount + 1);
 
 	for (int32 i = 0; i < TranslationCount; i++)
 	{
 		// Get each entry of the list and then unpack the virtual and physical IDs from the entry.
 		Schema_Object* MappingObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID, i);
 		VirtualWorkerId VirtualWorkerId = Schema_GetUint32(MappingObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID);
-		PhysicalWorkerName PhysicalWorkerName = SpatialGDK::GetStringFromSchema(MappingObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME);
-		Worker_EntityId ServerWorkerEntityId = Schema_GetEntityId(MappingObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID);
+		if (VirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			continue;
+		}
+
+		if (static_cast<int32>(VirtualWorkerId) >= NewMapping.Num())
+		{
+			NewMapping.SetNum(VirtualWorkerId + 1);
+		}
+
+		FVirtualWorkerMapping& Entry = NewMapping[VirtualWorkerId];
+		Entry.Name = SpatialGDK::GetStringFromSchema(MappingObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME);
+		Entry.ServerWorkerEntityId = Schema_GetEntityId(MappingObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID);
+		Entry.bAssigned = true;
+	}
+
+	int32 NumChanged = 0;
+	const int32 NumEntries = FMath::Max(NewMapping.Num(), VirtualToPhysicalWorkerMapping.Num());
+	for (int32 Id = 0; Id < NumEntries; Id++)
+	{
+		const bool bWasAssigned = VirtualToPhysicalWorkerMapping.IsValidIndex(Id) && VirtualToPhysicalWorkerMapping[Id].bAssigned;
+		const bool bIsAssigned = NewMapping.IsValidIndex(Id) && NewMapping[Id].bAssigned;
+		if (bWasAssigned != bIsAssigned || (bIsAssigned && !(VirtualToPhysicalWorkerMapping[Id] == NewMapping[Id])))
+		{
+			NumChanged++;
+		}
+	}
 
-		// Insert each into the provided map.
-		UpdateMapping(VirtualWorkerId, PhysicalWorkerName, ServerWorkerEntityId);
+	VirtualToPhysicalWorkerMapping = MoveTemp(NewMapping);
+
+	if (LocalVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		const PhysicalWorkerName* LocalVirtualWorkerName = GetPhysicalWorkerForVirtualWorker(LocalVirtualWorkerId);
+		if (LocalVirtualWorkerName == nullptr || *LocalVirtualWorkerName != LocalPhysicalWorkerName)
+		{
+			ClearLocalVirtualWorkerId();
+		}
+	}
+
+	for (VirtualWorkerId Id = 0; LocalVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID && Id < static_cast<VirtualWorkerId>(VirtualToPhysicalWorkerMapping.Num()); Id++)
+	{
+		if (VirtualToPhysicalWorkerMapping[Id].bAssigned)
+		{
+			UpdateLocalVirtualWorkerId(Id, VirtualToPhysicalWorkerMapping[Id].Name);
+		}
 	}
+
+	return NumChanged;
 }
 
-void SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId)
+// The standby list is written together with the mapping, so an update carrying the mapping without this worker in the standby list
+// means it's no longer a standby, either because it took over its virtual worker or because that virtual worker's standby changed.
+bool SpatialVirtualWorkerTranslator::ApplyStandbyMappingFromSchema(Schema_Object* Object)
 {
-	VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
+	VirtualWorkerId NewStandbyVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	if (LocalVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		const int32 StandbyCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID);
+		for (int32 i = 0; i < StandbyCount; i++)
+		{
+			Schema_Object* StandbyObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID, i);
+			if (SpatialGDK::GetStringFromSchema(StandbyObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME) == LocalPhysicalWorkerName)
+			{
+				NewStandbyVirtualWorkerId = Schema_GetUint32(StandbyObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID);
+				break;
+			}
+		}
+	}
 
+	if (NewStandbyVirtualWorkerId == LocalStandbyVirtualWorkerId)
+	{
+		return false;
+	}
+
+	LocalStandbyVirtualWorkerId = NewStandbyVirtualWorkerId;
+	if (LocalStandbyVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		// A standby can begin play, it just isn't authoritative over anything until it takes over its virtual worker.
+		bIsReady = true;
+		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("This worker is now the standby for Virtual Worker %d."), LocalStandbyVirtualWorkerId);
+	}
+
+	return true;
+}
+
+void SpatialVirtualWorkerTranslator::UpdateLocalVirtualWorkerId(VirtualWorkerId Id, const PhysicalWorkerName& Name)
+{
 	if (LocalVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID && Name == LocalPhysicalWorkerName)
 	{
 		LocalVirtualWorkerId = Id;
@@ -122,3 +239,16 @@ void SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalW
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("VirtualWorkerTranslator is now ready for loadbalancing."));
 	}
 }
+
+void SpatialVirtualWorkerTranslator::ClearLocalVirtualWorkerId()
+{
+	UE_LOG(LogSpatialVirtualWorkerTranslator, Warning, TEXT("Virtual Worker %d is no longer assigned to this worker (%s), dropping it."), LocalVirtualWorkerId, *LocalPhysicalWorkerName);
+	LocalVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+
+	// The strategy stops claiming authority once it has no local virtual worker, and the mapping version change makes the
+	// enforcer hand the ACLs of our actors to the new owner.
+	if (LoadBalanceStrategy.IsValid())
+	{
+		LoadBalanceStrategy->SetLocalVirtualWorkerId(SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	}
+}
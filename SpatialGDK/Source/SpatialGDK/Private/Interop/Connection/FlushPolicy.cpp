@@ -0,0 +1,91 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/FlushPolicy.h"
+
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+
+FFlushPolicy::FFlushPolicy(const FSpatialFlushRule& RPCRule, const FSpatialFlushRule& PropertyUpdateRule)
+{
+	Traffic[static_cast<uint8>(EFlushTraffic::RPC)].Rule = RPCRule;
+	Traffic[static_cast<uint8>(EFlushTraffic::PropertyUpdate)].Rule = PropertyUpdateRule;
+}
+
+EFlushTraffic FFlushPolicy::GetTraffic(Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
+	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
+	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
+	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID_LEGACY:
+		return EFlushTraffic::RPC;
+	default:
+		return EFlushTraffic::PropertyUpdate;
+	}
+}
+
+bool FFlushPolicy::OnMessageQueued(EFlushTraffic InTraffic, uint32 NumBytes, double Now)
+{
+	FTrafficState& State = Traffic[static_cast<uint8>(InTraffic)];
+	if (!State.bHasQueuedMessages)
+	{
+		State.bHasQueuedMessages = true;
+		State.OldestQueuedTime = Now;
+	}
+	State.QueuedBytes += NumBytes;
+
+	if (State.Rule.FlushQueuedBytes > 0 && State.QueuedBytes >= State.Rule.FlushQueuedBytes)
+	{
+		return true;
+	}
+
+	return IsDeadlineReached(State, Now);
+}
+
+bool FFlushPolicy::ShouldFlushAtEndOfTick(double Now) const
+{
+	for (const FTrafficState& State : Traffic)
+	{
+		if (State.bHasQueuedMessages && (State.Rule.bFlushAtEndOfTick || IsDeadlineReached(State, Now)))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FFlushPolicy::OnFlushed()
+{
+	for (FTrafficState& State : Traffic)
+	{
+		State.QueuedBytes = 0;
+		State.bHasQueuedMessages = false;
+	}
+}
+
+double FFlushPolicy::GetShortestDeadline() const
+{
+	uint32 ShortestDeadlineMicroseconds = 0;
+	for (const FTrafficState& State : Traffic)
+	{
+		if (State.Rule.FlushDeadlineMicroseconds > 0 && (ShortestDeadlineMicroseconds == 0 || State.Rule.FlushDeadlineMicroseconds < ShortestDeadlineMicroseconds))
+		{
+			ShortestDeadlineMicroseconds = State.Rule.FlushDeadlineMicroseconds;
+		}
+	}
+
+	return ShortestDeadlineMicroseconds * 1e-6;
+}
+
+bool FFlushPolicy::IsDeadlineReached(const FTrafficState& State, double Now)
+{
+	return State.bHasQueuedMessages && State.Rule.FlushDeadlineMicroseconds > 0 && (Now - State.OldestQueuedTime) * 1e6 >= State.Rule.FlushDeadlineMicroseconds;
+}
+
+} // namespace SpatialGDK
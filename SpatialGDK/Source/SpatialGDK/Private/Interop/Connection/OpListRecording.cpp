@@ -0,0 +1,794 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OpListRecording.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY(LogOpListRecording);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+constexpr uint32 RecordingMagic = 0x4C4F5347; // "GSOL"
+constexpr uint32 RecordingVersion = 1;
+
+enum class ERecordType : uint8
+{
+	OpList,
+	OutgoingMessage
+};
+
+void WriteString(FArchive& Ar, const char* String)
+{
+	int32 Length = String != nullptr ? FCStringAnsi::Strlen(String) : -1;
+	Ar << Length;
+	if (Length > 0)
+	{
+		Ar.Serialize(const_cast<char*>(String), Length);
+	}
+}
+
+void WriteSchemaObject(FArchive& Ar, Schema_Object* Object)
+{
+	uint32 Length = Schema_GetWriteBufferLength(Object);
+	Ar << Length;
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Length);
+	Schema_SerializeToBuffer(Object, Buffer.GetData(), Length);
+	Ar.Serialize(Buffer.GetData(), Length);
+}
+
+bool ReadSchemaObject(FArchive& Ar, Schema_Object* Object)
+{
+	uint32 Length = 0;
+	Ar << Length;
+	if (Ar.IsError() || Length > Ar.TotalSize() - Ar.Tell())
+	{
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Length);
+	Ar.Serialize(Buffer.GetData(), Length);
+	return Length == 0 || Schema_MergeFromBuffer(Object, Buffer.GetData(), Length) != 0;
+}
+
+void WriteComponentData(FArchive& Ar, const Worker_ComponentData& Data)
+{
+	uint32 ComponentId = Data.component_id;
+	Ar << ComponentId;
+	WriteSchemaObject(Ar, Schema_GetComponentDataFields(Data.schema_type));
+}
+
+void WriteComponentUpdate(FArchive& Ar, const Worker_ComponentUpdate& Update)
+{
+	uint32 ComponentId = Update.component_id;
+	Ar << ComponentId;
+	WriteSchemaObject(Ar, Schema_GetComponentUpdateFields(Update.schema_type));
+	WriteSchemaObject(Ar, Schema_GetComponentUpdateEvents(Update.schema_type));
+
+	TArray<Schema_FieldId> ClearedIds;
+	ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(Update.schema_type));
+	Schema_GetComponentUpdateClearedFieldList(Update.schema_type, ClearedIds.GetData());
+	Ar << ClearedIds;
+}
+} // anonymous namespace
+
+FOpListRecorder::~FOpListRecorder()
+{
+	Close();
+}
+
+bool FOpListRecorder::Open(const FString& Filename)
+{
+	FScopeLock Lock(&Mutex);
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogOpListRecording, Error, TEXT("Failed to open %s to record op lists to."), *Filename);
+		return false;
+	}
+
+	uint32 Magic = RecordingMagic;
+	uint32 Version = RecordingVersion;
+	*Writer << Magic;
+	*Writer << Version;
+
+	StartTime = FPlatformTime::Seconds();
+	UE_LOG(LogOpListRecording, Log, TEXT("Recording op lists to %s."), *Filename);
+	return true;
+}
+
+void FOpListRecorder::Close()
+{
+	FScopeLock Lock(&Mutex);
+
+	if (Writer.IsValid())
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+}
+
+void FOpListRecorder::RecordOpList(const Worker_OpList& OpList)
+{
+	FScopeLock Lock(&Mutex);
+
+	if (!Writer.IsValid())
+	{
+		return;
+	}
+
+	uint8 RecordType = static_cast<uint8>(ERecordType::OpList);
+	double Time = FPlatformTime::Seconds() - StartTime;
+	uint32 OpCount = OpList.op_count;
+	*Writer << RecordType;
+	*Writer << Time;
+	*Writer << OpCount;
+
+	for (uint32 i = 0; i < OpList.op_count; i++)
+	{
+		WriteOp(OpList.ops[i]);
+	}
+}
+
+void FOpListRecorder::WriteOp(const Worker_Op& Op)
+{
+	FArchive& Ar = *Writer;
+
+	uint8 OpType = Op.op_type;
+	Ar << OpType;
+
+	switch (Op.op_type)
+	{
+	case WORKER_OP_TYPE_DISCONNECT:
+	{
+		uint8 StatusCode = Op.op.disconnect.connection_status_code;
+		Ar << StatusCode;
+		WriteString(Ar, Op.op.disconnect.reason);
+		break;
+	}
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		WriteString(Ar, Op.op.flag_update.name);
+		WriteString(Ar, Op.op.flag_update.value);
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+	{
+		uint8 Level = Op.op.log_message.level;
+		Ar << Level;
+		WriteString(Ar, Op.op.log_message.message);
+		break;
+	}
+	case WORKER_OP_TYPE_METRICS:
+		// The metrics the runtime reports don't affect the GDK, so only the op itself is kept.
+		break;
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+	{
+		uint8 InCriticalSection = Op.op.critical_section.in_critical_section;
+		Ar << InCriticalSection;
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_ENTITY:
+	{
+		int64 EntityId = Op.op.add_entity.entity_id;
+		Ar << EntityId;
+		break;
+	}
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+	{
+		int64 EntityId = Op.op.remove_entity.entity_id;
+		Ar << EntityId;
+		break;
+	}
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+	{
+		const Worker_ReserveEntityIdsResponseOp& Response = Op.op.reserve_entity_ids_response;
+		int64 RequestId = Response.request_id;
+		uint8 StatusCode = Response.status_code;
+		int64 FirstEntityId = Response.first_entity_id;
+		uint32 NumberOfEntityIds = Response.number_of_entity_ids;
+		Ar << RequestId << StatusCode << FirstEntityId << NumberOfEntityIds;
+		WriteString(Ar, Response.message);
+		break;
+	}
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+	{
+		const Worker_CreateEntityResponseOp& Response = Op.op.create_entity_response;
+		int64 RequestId = Response.request_id;
+		uint8 StatusCode = Response.status_code;
+		int64 EntityId = Response.entity_id;
+		Ar << RequestId << StatusCode << EntityId;
+		WriteString(Ar, Response.message);
+		break;
+	}
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+	{
+		const Worker_DeleteEntityResponseOp& Response = Op.op.delete_entity_response;
+		int64 RequestId = Response.request_id;
+		uint8 StatusCode = Response.status_code;
+		int64 EntityId = Response.entity_id;
+		Ar << RequestId << StatusCode << EntityId;
+		WriteString(Ar, Response.message);
+		break;
+	}
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+	{
+		const Worker_EntityQueryResponseOp& Response = Op.op.entity_query_response;
+		int64 RequestId = Response.request_id;
+		uint8 StatusCode = Response.status_code;
+		uint32 ResultCount = Response.result_count;
+		Ar << RequestId << StatusCode << ResultCount;
+		WriteString(Ar, Response.message);
+
+		// Count queries return a result count without any results.
+		uint8 bHasResults = Response.results != nullptr;
+		Ar << bHasResults;
+		for (uint32 i = 0; bHasResults && i < Response.result_count; i++)
+		{
+			const Worker_Entity& Entity = Response.results[i];
+			int64 EntityId = Entity.entity_id;
+			uint32 ComponentCount = Entity.component_count;
+			Ar << EntityId << ComponentCount;
+			for (uint32 j = 0; j < Entity.component_count; j++)
+			{
+				WriteComponentData(Ar, Entity.components[j]);
+			}
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+	{
+		int64 EntityId = Op.op.add_component.entity_id;
+		Ar << EntityId;
+		WriteComponentData(Ar, Op.op.add_component.data);
+		break;
+	}
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+	{
+		int64 EntityId = Op.op.remove_component.entity_id;
+		uint32 ComponentId = Op.op.remove_component.component_id;
+		Ar << EntityId << ComponentId;
+		break;
+	}
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+	{
+		int64 EntityId = Op.op.authority_change.entity_id;
+		uint32 ComponentId = Op.op.authority_change.component_id;
+		uint8 Authority = Op.op.authority_change.authority;
+		Ar << EntityId << ComponentId << Authority;
+		break;
+	}
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+	{
+		int64 EntityId = Op.op.component_update.entity_id;
+		Ar << EntityId;
+		WriteComponentUpdate(Ar, Op.op.component_update.update);
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	{
+		const Worker_CommandRequestOp& Request = Op.op.command_request;
+		int64 RequestId = Request.request_id;
+		int64 EntityId = Request.entity_id;
+		uint32 TimeoutMillis = Request.timeout_millis;
+		uint32 ComponentId = Request.request.component_id;
+		uint32 CommandIndex = Request.request.command_index;
+		Ar << RequestId << EntityId << TimeoutMillis << ComponentId << CommandIndex;
+		WriteString(Ar, Request.caller_worker_id);
+
+		uint32 AttributeCount = Request.caller_attribute_set.attribute_count;
+		Ar << AttributeCount;
+		for (uint32 i = 0; i < AttributeCount; i++)
+		{
+			WriteString(Ar, Request.caller_attribute_set.attributes[i]);
+		}
+
+		WriteSchemaObject(Ar, Schema_GetCommandRequestObject(Request.request.schema_type));
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+	{
+		const Worker_CommandResponseOp& Response = Op.op.command_response;
+		int64 RequestId = Response.request_id;
+		int64 EntityId = Response.entity_id;
+		uint8 StatusCode = Response.status_code;
+		uint32 CommandId = Response.command_id;
+		uint32 ComponentId = Response.response.component_id;
+		uint32 CommandIndex = Response.response.command_index;
+		Ar << RequestId << EntityId << StatusCode << CommandId << ComponentId << CommandIndex;
+		WriteString(Ar, Response.message);
+
+		// Failed commands have no response object.
+		uint8 bHasResponse = Response.response.schema_type != nullptr;
+		Ar << bHasResponse;
+		if (bHasResponse)
+		{
+			WriteSchemaObject(Ar, Schema_GetCommandResponseObject(Response.response.schema_type));
+		}
+		break;
+	}
+	default:
+		UE_LOG(LogOpListRecording, Warning, TEXT("Recorded op of unknown type %d without its contents."), Op.op_type);
+		break;
+	}
+}
+
+void FOpListRecorder::RecordOutgoingMessage(const FOutgoingMessage& Message)
+{
+	FScopeLock Lock(&Mutex);
+
+	if (!Writer.IsValid())
+	{
+		return;
+	}
+
+	int64 EntityId = 0;
+	uint32 ComponentId = 0;
+
+	switch (Message.Type)
+	{
+	case EOutgoingMessageType::CreateEntityRequest:
+		EntityId = static_cast<const FCreateEntityRequest&>(Message).EntityId.Get(0);
+		break;
+	case EOutgoingMessageType::DeleteEntityRequest:
+		EntityId = static_cast<const FDeleteEntityRequest&>(Message).EntityId;
+		break;
+	case EOutgoingMessageType::AddComponent:
+		EntityId = static_cast<const FAddComponent&>(Message).EntityId;
+		ComponentId = static_cast<const FAddComponent&>(Message).Data.component_id;
+		break;
+	case EOutgoingMessageType::RemoveComponent:
+		EntityId = static_cast<const FRemoveComponent&>(Message).EntityId;
+		ComponentId = static_cast<const FRemoveComponent&>(Message).ComponentId;
+		break;
+	case EOutgoingMessageType::ComponentUpdate:
+		EntityId = static_cast<const FComponentUpdate&>(Message).EntityId;
+		ComponentId = static_cast<const FComponentUpdate&>(Message).Update.component_id;
+		break;
+	case EOutgoingMessageType::CommandRequest:
+		EntityId = static_cast<const FCommandRequest&>(Message).EntityId;
+		ComponentId = static_cast<const FCommandRequest&>(Message).Request.component_id;
+		break;
+	case EOutgoingMessageType::CommandResponse:
+		ComponentId = static_cast<const FCommandResponse&>(Message).Response.component_id;
+		break;
+	case EOutgoingMessageType::ComponentInterest:
+		EntityId = static_cast<const FComponentInterest&>(Message).EntityId;
+		break;
+	default:
+		break;
+	}
+
+	uint8 RecordType = static_cast<uint8>(ERecordType::OutgoingMessage);
+	double Time = FPlatformTime::Seconds() - StartTime;
+	int32 MessageType = static_cast<int32>(Message.Type);
+	*Writer << RecordType << Time << MessageType << EntityId << ComponentId;
+}
+
+RecordedOpList::~RecordedOpList()
+{
+	for (Schema_ComponentData* Data : ComponentDatas)
+	{
+		Schema_DestroyComponentData(Data);
+	}
+	for (Schema_ComponentUpdate* Update : ComponentUpdates)
+	{
+		Schema_DestroyComponentUpdate(Update);
+	}
+	for (Schema_CommandRequest* Request : CommandRequests)
+	{
+		Schema_DestroyCommandRequest(Request);
+	}
+	for (Schema_CommandResponse* Response : CommandResponses)
+	{
+		Schema_DestroyCommandResponse(Response);
+	}
+}
+
+FOpListRecordingReader::~FOpListRecordingReader()
+{
+	Close();
+}
+
+bool FOpListRecordingReader::Open(const FString& Filename)
+{
+	Reader.Reset(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader.IsValid())
+	{
+		UE_LOG(LogOpListRecording, Error, TEXT("Failed to open op list recording %s."), *Filename);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Reader << Magic;
+	*Reader << Version;
+	if (Magic != RecordingMagic || Version != RecordingVersion)
+	{
+		UE_LOG(LogOpListRecording, Error, TEXT("%s is not an op list recording of version %u."), *Filename, RecordingVersion);
+		Reader.Reset();
+		return false;
+	}
+
+	OutgoingMessages.Reset();
+	return true;
+}
+
+void FOpListRecordingReader::Close()
+{
+	if (Reader.IsValid())
+	{
+		Reader->Close();
+		Reader.Reset();
+	}
+}
+
+TUniquePtr<RecordedOpList> FOpListRecordingReader::ReadNextOpList()
+{
+	if (!Reader.IsValid())
+	{
+		return nullptr;
+	}
+
+	FArchive& Ar = *Reader;
+	while (!Ar.AtEnd() && !Ar.IsError())
+	{
+		uint8 RecordType = 0;
+		double Time = 0.0;
+		Ar << RecordType << Time;
+
+		if (RecordType == static_cast<uint8>(ERecordType::OutgoingMessage))
+		{
+			FRecordedOutgoingMessage& Message = OutgoingMessages.AddDefaulted_GetRef();
+			int32 MessageType = 0;
+			int64 EntityId = 0;
+			uint32 ComponentId = 0;
+			Ar << MessageType << EntityId << ComponentId;
+			Message.Time = Time;
+			Message.Type = static_cast<EOutgoingMessageType>(MessageType);
+			Message.EntityId = EntityId;
+			Message.ComponentId = ComponentId;
+			continue;
+		}
+
+		if (RecordType != static_cast<uint8>(ERecordType::OpList))
+		{
+			break;
+		}
+
+		uint32 OpCount = 0;
+		Ar << OpCount;
+
+		TUniquePtr<RecordedOpList> OpList = MakeUnique<RecordedOpList>();
+		OpList->Time = Time;
+		OpList->Ops.SetNumZeroed(OpCount);
+		for (uint32 i = 0; i < OpCount; i++)
+		{
+			if (!ReadOp(*OpList, OpList->Ops[i]))
+			{
+				UE_LOG(LogOpListRecording, Error, TEXT("Op list recording is malformed, stopping at the op list recorded at %.3fs."), Time);
+				Close();
+				return nullptr;
+			}
+		}
+
+		return OpList;
+	}
+
+	return nullptr;
+}
+
+const char* FOpListRecordingReader::ReadString(RecordedOpList& OpList)
+{
+	int32 Length = 0;
+	*Reader << Length;
+	if (Length < 0 || Reader->IsError())
+	{
+		return nullptr;
+	}
+
+	TArray<ANSICHAR>& String = OpList.Strings.AddDefaulted_GetRef();
+	String.SetNumUninitialized(Length + 1);
+	Reader->Serialize(String.GetData(), Length);
+	String[Length] = '\0';
+	return String.GetData();
+}
+
+Schema_ComponentData* FOpListRecordingReader::ReadComponentData(RecordedOpList& OpList)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	OpList.ComponentDatas.Add(Data);
+	return ReadSchemaObject(*Reader, Schema_GetComponentDataFields(Data)) ? Data : nullptr;
+}
+
+bool FOpListRecordingReader::ReadOp(RecordedOpList& OpList, Worker_Op& OutOp)
+{
+	FArchive& Ar = *Reader;
+
+	uint8 OpType = 0;
+	Ar << OpType;
+	OutOp.op_type = OpType;
+
+	switch (OpType)
+	{
+	case WORKER_OP_TYPE_DISCONNECT:
+	{
+		uint8 StatusCode = 0;
+		Ar << StatusCode;
+		OutOp.op.disconnect.connection_status_code = StatusCode;
+		OutOp.op.disconnect.reason = ReadString(OpList);
+		break;
+	}
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		OutOp.op.flag_update.name = ReadString(OpList);
+		OutOp.op.flag_update.value = ReadString(OpList);
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+	{
+		uint8 Level = 0;
+		Ar << Level;
+		OutOp.op.log_message.level = Level;
+		OutOp.op.log_message.message = ReadString(OpList);
+		break;
+	}
+	case WORKER_OP_TYPE_METRICS:
+		break;
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+	{
+		uint8 InCriticalSection = 0;
+		Ar << InCriticalSection;
+		OutOp.op.critical_section.in_critical_section = InCriticalSection;
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_ENTITY:
+	{
+		int64 EntityId = 0;
+		Ar << EntityId;
+		OutOp.op.add_entity.entity_id = EntityId;
+		break;
+	}
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+	{
+		int64 EntityId = 0;
+		Ar << EntityId;
+		OutOp.op.remove_entity.entity_id = EntityId;
+		break;
+	}
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+	{
+		Worker_ReserveEntityIdsResponseOp& Response = OutOp.op.reserve_entity_ids_response;
+		int64 RequestId = 0;
+		uint8 StatusCode = 0;
+		int64 FirstEntityId = 0;
+		uint32 NumberOfEntityIds = 0;
+		Ar << RequestId << StatusCode << FirstEntityId << NumberOfEntityIds;
+		Response.request_id = RequestId;
+		Response.status_code = StatusCode;
+		Response.first_entity_id = FirstEntityId;
+		Response.number_of_entity_ids = NumberOfEntityIds;
+		Response.message = ReadString(OpList);
+		break;
+	}
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+	{
+		Worker_CreateEntityResponseOp& Response = OutOp.op.create_entity_response;
+		int64 RequestId = 0;
+		uint8 StatusCode = 0;
+		int64 EntityId = 0;
+		Ar << RequestId << StatusCode << EntityId;
+		Response.request_id = RequestId;
+		Response.status_code = StatusCode;
+		Response.entity_id = EntityId;
+		Response.message = ReadString(OpList);
+		break;
+	}
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+	{
+		Worker_DeleteEntityResponseOp& Response = OutOp.op.delete_entity_response;
+		int64 RequestId = 0;
+		uint8 StatusCode = 0;
+		int64 EntityId = 0;
+		Ar << RequestId << StatusCode << EntityId;
+		Response.request_id = RequestId;
+		Response.status_code = StatusCode;
+		Response.entity_id = EntityId;
+		Response.message = ReadString(OpList);
+		break;
+	}
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+	{
+		Worker_EntityQueryResponseOp& Response = OutOp.op.entity_query_response;
+		int64 RequestId = 0;
+		uint8 StatusCode = 0;
+		uint32 ResultCount = 0;
+		Ar << RequestId << StatusCode << ResultCount;
+		Response.request_id = RequestId;
+		Response.status_code = StatusCode;
+		Response.result_count = ResultCount;
+		Response.message = ReadString(OpList);
+
+		uint8 bHasResults = 0;
+		Ar << bHasResults;
+		Response.results = nullptr;
+		if (bHasResults)
+		{
+			TArray<Worker_Entity>& Entities = OpList.EntityArrays.AddDefaulted_GetRef();
+			Entities.SetNumZeroed(ResultCount);
+			for (Worker_Entity& Entity : Entities)
+			{
+				int64 EntityId = 0;
+				uint32 ComponentCount = 0;
+				Ar << EntityId << ComponentCount;
+				if (Ar.IsError())
+				{
+					return false;
+				}
+
+				TArray<Worker_ComponentData>& Components = OpList.ComponentDataArrays.AddDefaulted_GetRef();
+				Components.SetNumZeroed(ComponentCount);
+				for (Worker_ComponentData& Component : Components)
+				{
+					uint32 ComponentId = 0;
+					Ar << ComponentId;
+					Component.component_id = ComponentId;
+					Component.schema_type = ReadComponentData(OpList);
+					if (Component.schema_type == nullptr)
+					{
+						return false;
+					}
+				}
+
+				Entity.entity_id = EntityId;
+				Entity.component_count = ComponentCount;
+				Entity.components = Components.GetData();
+			}
+			Response.results = Entities.GetData();
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+	{
+		int64 EntityId = 0;
+		uint32 ComponentId = 0;
+		Ar << EntityId << ComponentId;
+		OutOp.op.add_component.entity_id = EntityId;
+		OutOp.op.add_component.data.component_id = ComponentId;
+		OutOp.op.add_component.data.schema_type = ReadComponentData(OpList);
+		if (OutOp.op.add_component.data.schema_type == nullptr)
+		{
+			return false;
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+	{
+		int64 EntityId = 0;
+		uint32 ComponentId = 0;
+		Ar << EntityId << ComponentId;
+		OutOp.op.remove_component.entity_id = EntityId;
+		OutOp.op.remove_component.component_id = ComponentId;
+		break;
+	}
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+	{
+		int64 EntityId = 0;
+		uint32 ComponentId = 0;
+		uint8 Authority = 0;
+		Ar << EntityId << ComponentId << Authority;
+		OutOp.op.authority_change.entity_id = EntityId;
+		OutOp.op.authority_change.component_id = ComponentId;
+		OutOp.op.authority_change.authority = Authority;
+		break;
+	}
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+	{
+		int64 EntityId = 0;
+		uint32 ComponentId = 0;
+		Ar << EntityId << ComponentId;
+
+		Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+		OpList.ComponentUpdates.Add(Update);
+		if (!ReadSchemaObject(Ar, Schema_GetComponentUpdateFields(Update)) || !ReadSchemaObject(Ar, Schema_GetComponentUpdateEvents(Update)))
+		{
+			return false;
+		}
+
+		TArray<Schema_FieldId> ClearedIds;
+		Ar << ClearedIds;
+		for (Schema_FieldId ClearedId : ClearedIds)
+		{
+			Schema_AddComponentUpdateClearedField(Update, ClearedId);
+		}
+
+		OutOp.op.component_update.entity_id = EntityId;
+		OutOp.op.component_update.update.component_id = ComponentId;
+		OutOp.op.component_update.update.schema_type = Update;
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	{
+		Worker_CommandRequestOp& Request = OutOp.op.command_request;
+		int64 RequestId = 0;
+		int64 EntityId = 0;
+		uint32 TimeoutMillis = 0;
+		uint32 ComponentId = 0;
+		uint32 CommandIndex = 0;
+		Ar << RequestId << EntityId << TimeoutMillis << ComponentId << CommandIndex;
+		Request.request_id = RequestId;
+		Request.entity_id = EntityId;
+		Request.timeout_millis = TimeoutMillis;
+		Request.request.component_id = ComponentId;
+		Request.request.command_index = CommandIndex;
+		Request.caller_worker_id = ReadString(OpList);
+
+		uint32 AttributeCount = 0;
+		Ar << AttributeCount;
+		if (Ar.IsError() || AttributeCount > Ar.TotalSize() - Ar.Tell())
+		{
+			return false;
+		}
+
+		TArray<const char*>& Attributes = OpList.StringArrays.AddDefaulted_GetRef();
+		for (uint32 i = 0; i < AttributeCount; i++)
+		{
+			Attributes.Add(ReadString(OpList));
+		}
+		Request.caller_attribute_set.attribute_count = AttributeCount;
+		Request.caller_attribute_set.attributes = Attributes.GetData();
+
+		Schema_CommandRequest* CommandRequest = Schema_CreateCommandRequest();
+		OpList.CommandRequests.Add(CommandRequest);
+		Request.request.schema_type = CommandRequest;
+		if (!ReadSchemaObject(Ar, Schema_GetCommandRequestObject(CommandRequest)))
+		{
+			return false;
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+	{
+		Worker_CommandResponseOp& Response = OutOp.op.command_response;
+		int64 RequestId = 0;
+		int64 EntityId = 0;
+		uint8 StatusCode = 0;
+		uint32 CommandId = 0;
+		uint32 ComponentId = 0;
+		uint32 CommandIndex = 0;
+		Ar << RequestId << EntityId << StatusCode << CommandId << ComponentId << CommandIndex;
+		Response.request_id = RequestId;
+		Response.entity_id = EntityId;
+		Response.status_code = StatusCode;
+		Response.command_id = CommandId;
+		Response.response.component_id = ComponentId;
+		Response.response.command_index = CommandIndex;
+		Response.message = ReadString(OpList);
+
+		uint8 bHasResponse = 0;
+		Ar << bHasResponse;
+		Response.response.schema_type = nullptr;
+		if (bHasResponse)
+		{
+			Schema_CommandResponse* CommandResponse = Schema_CreateCommandResponse();
+			OpList.CommandResponses.Add(CommandResponse);
+			Response.response.schema_type = CommandResponse;
+			if (!ReadSchemaObject(Ar, Schema_GetCommandResponseObject(CommandResponse)))
+			{
+				return false;
+			}
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	return !Ar.IsError();
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,145 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OutgoingMessageLanes.h"
+
+#include "Interop/Connection/FlushPolicy.h"
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+
+EOutgoingMessageLane FOutgoingMessageLanes::GetLane(const FOutgoingMessage& Message)
+{
+	switch (Message.Type)
+	{
+	case EOutgoingMessageType::ComponentUpdate:
+	{
+		const Worker_ComponentId ComponentId = static_cast<const FComponentUpdate&>(Message).Update.component_id;
+		switch (ComponentId)
+		{
+		case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:
+		case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+		case SpatialConstants::HEARTBEAT_COMPONENT_ID:
+			return EOutgoingMessageLane::Control;
+		default:
+			return FFlushPolicy::GetTraffic(ComponentId) == EFlushTraffic::RPC ? EOutgoingMessageLane::RPC : EOutgoingMessageLane::PropertyUpdate;
+		}
+	}
+	case EOutgoingMessageType::CommandResponse:
+	case EOutgoingMessageType::CommandFailure:
+		return EOutgoingMessageLane::Control;
+	case EOutgoingMessageType::CommandRequest:
+		return EOutgoingMessageLane::RPC;
+	case EOutgoingMessageType::AddComponent:
+	case EOutgoingMessageType::RemoveComponent:
+		return EOutgoingMessageLane::PropertyUpdate;
+	default:
+		return EOutgoingMessageLane::Bulk;
+	}
+}
+
+const TCHAR* FOutgoingMessageLanes::GetLaneName(EOutgoingMessageLane Lane)
+{
+	switch (Lane)
+	{
+	case EOutgoingMessageLane::Control:
+		return TEXT("Control");
+	case EOutgoingMessageLane::RPC:
+		return TEXT("RPC");
+	case EOutgoingMessageLane::PropertyUpdate:
+		return TEXT("PropertyUpdate");
+	case EOutgoingMessageLane::Bulk:
+		return TEXT("Bulk");
+	default:
+		checkNoEntry();
+		return TEXT("Unknown");
+	}
+}
+
+Worker_EntityId FOutgoingMessageLanes::GetEntityId(const FOutgoingMessage& Message)
+{
+	switch (Message.Type)
+	{
+	case EOutgoingMessageType::CreateEntityRequest:
+	{
+		const TOptional<Worker_EntityId>& EntityId = static_cast<const FCreateEntityRequest&>(Message).EntityId;
+		return EntityId.IsSet() ? EntityId.GetValue() : SpatialConstants::INVALID_ENTITY_ID;
+	}
+	case EOutgoingMessageType::DeleteEntityRequest:
+		return static_cast<const FDeleteEntityRequest&>(Message).EntityId;
+	case EOutgoingMessageType::AddComponent:
+		return static_cast<const FAddComponent&>(Message).EntityId;
+	case EOutgoingMessageType::RemoveComponent:
+		return static_cast<const FRemoveComponent&>(Message).EntityId;
+	case EOutgoingMessageType::ComponentUpdate:
+		return static_cast<const FComponentUpdate&>(Message).EntityId;
+	case EOutgoingMessageType::CommandRequest:
+		return static_cast<const FCommandRequest&>(Message).EntityId;
+	case EOutgoingMessageType::ComponentInterest:
+		return static_cast<const FComponentInterest&>(Message).EntityId;
+	default:
+		return SpatialConstants::INVALID_ENTITY_ID;
+	}
+}
+
+bool FOutgoingMessageLanes::IsDrained(const FEntityLastMessage& LastMessage) const
+{
+	return LastMessage.Sequence <= DrainedSequences[static_cast<int32>(LastMessage.Lane)].Load();
+}
+
+void FOutgoingMessageLanes::Enqueue(TUniquePtr<FOutgoingMessage> Message)
+{
+	EOutgoingMessageLane Lane = GetLane(*Message);
+	const Worker_EntityId EntityId = GetEntityId(*Message);
+
+	if (EntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		// Lanes are drained in order but a lane can hold messages across drains, so a message is only sent after an earlier one
+		// for the same entity if they are in the same lane.
+		const FEntityLastMessage* LastMessage = EntityLastMessages.Find(EntityId);
+		if (LastMessage != nullptr && LastMessage->Lane != Lane && !IsDrained(*LastMessage))
+		{
+			Lane = LastMessage->Lane;
+			HeldInOtherLaneCount++;
+		}
+	}
+
+	const int32 LaneIndex = static_cast<int32>(Lane);
+
+	FQueuedMessage Queued;
+	Queued.Message = MoveTemp(Message);
+	Queued.QueueTime = FPlatformTime::Seconds();
+	Queued.Sequence = ++LastSequences[LaneIndex];
+
+	if (EntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		EntityLastMessages.Add(EntityId, FEntityLastMessage{ Lane, Queued.Sequence });
+	}
+
+	Depths[LaneIndex].IncrementExchange();
+	Lanes[LaneIndex].Enqueue(MoveTemp(Queued));
+
+	if (EntityLastMessages.Num() >= NextPruneSize)
+	{
+		for (auto It = EntityLastMessages.CreateIterator(); It; ++It)
+		{
+			if (IsDrained(It.Value()))
+			{
+				It.RemoveCurrent();
+			}
+		}
+		NextPruneSize = FMath::Max(64, EntityLastMessages.Num() * 2);
+	}
+}
+
+int32 FOutgoingMessageLanes::GetTotalDepth() const
+{
+	int32 TotalDepth = 0;
+	for (int32 LaneIndex = 0; LaneIndex < NumLanes; LaneIndex++)
+	{
+		TotalDepth += FMath::Max(Depths[LaneIndex].Load(), 0);
+	}
+	return TotalDepth;
+}
+
+} // namespace SpatialGDK
@@ -72,6 +72,11 @@ struct ConfigureConnection
 		Params.network.modular_kcp.upstream_kcp.flush_interval_millis = Config.UdpUpstreamIntervalMS;
 		Params.network.modular_kcp.downstream_kcp.flush_interval_millis = Config.UdpDownstreamIntervalMS;
 
+		if (Config.NetworkTransportProfile.IsSet())
+		{
+			ApplyNetworkTransportProfile(Config.NetworkTransportProfile.GetValue());
+		}
+
 #if WITH_EDITOR
 		Params.network.modular_tcp.downstream_heartbeat = &HeartbeatParams;
 		Params.network.modular_tcp.upstream_heartbeat = &HeartbeatParams;
@@ -97,6 +102,62 @@ struct ConfigureConnection
 		Params.enable_dynamic_components = true;
 	}
 
+	void ApplyNetworkTransportProfile(const FSpatialNetworkTransportProfile& Profile)
+	{
+		Worker_ModularKcpNetworkParameters& Kcp = Params.network.modular_kcp;
+		Worker_ModularTcpNetworkParameters& Tcp = Params.network.modular_tcp;
+
+		for (Worker_KcpTransportParameters* KcpTransport : { &Kcp.upstream_kcp, &Kcp.downstream_kcp })
+		{
+			KcpTransport->fast_retransmission = Profile.bKcpFastRetransmission;
+			KcpTransport->early_retransmission = Profile.bKcpEarlyRetransmission;
+			KcpTransport->non_concessional_flow_control = Profile.bKcpNonConcessionalFlowControl;
+			if (Profile.KcpMultiplexLevel > 0)
+			{
+				KcpTransport->multiplex_level = static_cast<uint8>(FMath::Min<uint32>(Profile.KcpMultiplexLevel, MAX_uint8));
+			}
+			if (Profile.KcpMinRtoMillis > 0)
+			{
+				KcpTransport->min_rto_millis = Profile.KcpMinRtoMillis;
+			}
+		}
+
+		if (Profile.ErasureCodecOriginalPacketCount > 0 && Profile.ErasureCodecRecoveryPacketCount > 0)
+		{
+			ErasureCodecParams.original_packet_count = static_cast<uint8>(FMath::Min<uint32>(Profile.ErasureCodecOriginalPacketCount, MAX_uint8));
+			ErasureCodecParams.recovery_packet_count = static_cast<uint8>(FMath::Min<uint32>(Profile.ErasureCodecRecoveryPacketCount, MAX_uint8));
+			ErasureCodecParams.window_size = static_cast<uint8>(Profile.ErasureCodecWindowSize > 0 ? FMath::Min<uint32>(Profile.ErasureCodecWindowSize, MAX_uint8) : WORKER_DEFAULTS_ERASURE_CODEC_WINDOW_SIZE);
+			Kcp.upstream_erasure_codec = &ErasureCodecParams;
+			Kcp.downstream_erasure_codec = &ErasureCodecParams;
+		}
+
+		Kcp.upstream_compression = Profile.bCompressUpstream ? &EnableCompressionParams : nullptr;
+		Kcp.downstream_compression = Profile.bCompressDownstream ? &EnableCompressionParams : nullptr;
+		Tcp.upstream_compression = Profile.bCompressUpstream ? &EnableCompressionParams : nullptr;
+		Tcp.downstream_compression = Profile.bCompressDownstream ? &EnableCompressionParams : nullptr;
+
+		if (Profile.DownstreamWindowSizeBytes > 0 || Profile.UpstreamWindowSizeBytes > 0)
+		{
+			FlowControlParams.downstream_window_size_bytes = Profile.DownstreamWindowSizeBytes > 0 ? Profile.DownstreamWindowSizeBytes : WORKER_DEFAULTS_FLOW_CONTROL_DOWNSTREAM_WINDOW_SIZE_BYTES;
+			FlowControlParams.upstream_window_size_bytes = Profile.UpstreamWindowSizeBytes > 0 ? Profile.UpstreamWindowSizeBytes : WORKER_DEFAULTS_FLOW_CONTROL_UPSTREAM_WINDOW_SIZE_BYTES;
+			Kcp.flow_control = &FlowControlParams;
+			Tcp.flow_control = &FlowControlParams;
+		}
+
+		// The editor's own heartbeat parameters stop workers being dropped while paused at a breakpoint, so they're kept.
+#if !WITH_EDITOR
+		if (Profile.HeartbeatIntervalMillis > 0 || Profile.HeartbeatTimeoutMillis > 0)
+		{
+			ProfileHeartbeatParams.interval_millis = Profile.HeartbeatIntervalMillis > 0 ? Profile.HeartbeatIntervalMillis : WORKER_DEFAULTS_HEARTBEAT_INTERVAL_MILLIS;
+			ProfileHeartbeatParams.timeout_millis = Profile.HeartbeatTimeoutMillis > 0 ? Profile.HeartbeatTimeoutMillis : WORKER_DEFAULTS_HEARTBEAT_TIMEOUT_MILLIS;
+			Kcp.upstream_heartbeat = &ProfileHeartbeatParams;
+			Kcp.downstream_heartbeat = &ProfileHeartbeatParams;
+			Tcp.upstream_heartbeat = &ProfileHeartbeatParams;
+			Tcp.downstream_heartbeat = &ProfileHeartbeatParams;
+		}
+#endif
+	}
+
 	FString FormatWorkerSDKLogFilePrefix() const
 	{
 		FString FinalLogFilePrefix = FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir());
@@ -115,12 +176,118 @@ struct ConfigureConnection
 	Worker_ComponentVtable DefaultVtable{};
 	Worker_CompressionParameters EnableCompressionParams{};
 	Worker_LogsinkParameters Logsink{};
+	Worker_ErasureCodecParameters ErasureCodecParams{};
+	Worker_FlowControlParameters FlowControlParams{};
+	Worker_HeartbeatParameters ProfileHeartbeatParams{};
 
 #if WITH_EDITOR
 	Worker_HeartbeatParameters HeartbeatParams{ WORKER_DEFAULTS_HEARTBEAT_INTERVAL_MILLIS, MAX_int64 };
 #endif
 };
 
+namespace
+{
+// Shared by every connection manager, as a new one is created for each reconnect. Only accessed on the game thread.
+struct FDevelopmentAuthTokenCache
+{
+	FString Key;
+	TOptional<FDevelopmentAuthTokens> Tokens;
+	bool bFetchInFlight = false;
+	TArray<TPair<TWeakObjectPtr<USpatialConnectionManager>, FString>> WaitingManagers;
+};
+
+FDevelopmentAuthTokenCache& GetDevelopmentAuthTokenCache()
+{
+	static FDevelopmentAuthTokenCache Cache;
+	return Cache;
+}
+
+// Blocks on both locator requests, so is only called from a background thread.
+FDevelopmentAuthTokens FetchDevelopmentAuthTokensBlocking(const FString& LocatorHost, const FString& DevAuthToken, const FString& PlayerId,
+	const FString& DisplayName, const FString& MetaData, const FString& WorkerType)
+{
+	FDevelopmentAuthTokens Tokens;
+	FTCHARToUTF8 LocatorHostCStr(*LocatorHost);
+
+	{
+		FTCHARToUTF8 DAToken(*DevAuthToken);
+		FTCHARToUTF8 PlayerIdCStr(*PlayerId);
+		FTCHARToUTF8 DisplayNameCStr(*DisplayName);
+		FTCHARToUTF8 MetaDataCStr(*MetaData);
+
+		Worker_Alpha_PlayerIdentityTokenRequest PITParams{};
+		PITParams.development_authentication_token = DAToken.Get();
+		PITParams.player_id = PlayerIdCStr.Get();
+		PITParams.display_name = DisplayNameCStr.Get();
+		PITParams.metadata = MetaDataCStr.Get();
+		PITParams.use_insecure_connection = false;
+
+		Worker_Alpha_PlayerIdentityTokenResponseFuture* PITFuture = Worker_Alpha_CreateDevelopmentPlayerIdentityTokenAsync(LocatorHostCStr.Get(), SpatialConstants::LOCATOR_PORT, &PITParams);
+		if (PITFuture == nullptr)
+		{
+			Tokens.Error = TEXT("Failed to request a PlayerIdentityToken.");
+			return Tokens;
+		}
+
+		Worker_Alpha_PlayerIdentityTokenResponseFuture_Get(PITFuture, nullptr, &Tokens, [](void* UserData, const Worker_Alpha_PlayerIdentityTokenResponse* PIToken)
+		{
+			FDevelopmentAuthTokens& OutTokens = *static_cast<FDevelopmentAuthTokens*>(UserData);
+			if (PIToken->status.code != WORKER_CONNECTION_STATUS_CODE_SUCCESS)
+			{
+				OutTokens.Error = FString::Printf(TEXT("Failed to get PlayerIdentityToken, StatusCode: %d, Error: %s"), PIToken->status.code, UTF8_TO_TCHAR(PIToken->status.detail));
+				return;
+			}
+			OutTokens.PlayerIdentityToken = UTF8_TO_TCHAR(PIToken->player_identity_token);
+		});
+		Worker_Alpha_PlayerIdentityTokenResponseFuture_Destroy(PITFuture);
+	}
+
+	if (!Tokens.Error.IsEmpty())
+	{
+		return Tokens;
+	}
+
+	FTCHARToUTF8 PlayerIdentityTokenCStr(*Tokens.PlayerIdentityToken);
+	FTCHARToUTF8 WorkerTypeCStr(*WorkerType);
+
+	Worker_Alpha_LoginTokensRequest LTParams{};
+	LTParams.player_identity_token = PlayerIdentityTokenCStr.Get();
+	LTParams.worker_type = WorkerTypeCStr.Get();
+	LTParams.use_insecure_connection = false;
+
+	Worker_Alpha_LoginTokensResponseFuture* LTFuture = Worker_Alpha_CreateDevelopmentLoginTokensAsync(LocatorHostCStr.Get(), SpatialConstants::LOCATOR_PORT, &LTParams);
+	if (LTFuture == nullptr)
+	{
+		Tokens.Error = TEXT("Failed to request login tokens.");
+		return Tokens;
+	}
+
+	Worker_Alpha_LoginTokensResponseFuture_Get(LTFuture, nullptr, &Tokens, [](void* UserData, const Worker_Alpha_LoginTokensResponse* LoginTokens)
+	{
+		FDevelopmentAuthTokens& OutTokens = *static_cast<FDevelopmentAuthTokens*>(UserData);
+		if (LoginTokens->status.code != WORKER_CONNECTION_STATUS_CODE_SUCCESS)
+		{
+			OutTokens.Error = FString::Printf(TEXT("Failed to get login token, StatusCode: %d, Error: %s"), LoginTokens->status.code, UTF8_TO_TCHAR(LoginTokens->status.detail));
+			return;
+		}
+
+		if (LoginTokens->login_token_count == 0)
+		{
+			OutTokens.Error = TEXT("No deployment found to connect to. Did you add the 'dev_login' tag to the deployment you want to connect to?");
+			return;
+		}
+
+		for (uint32 i = 0; i < LoginTokens->login_token_count; i++)
+		{
+			OutTokens.LoginTokens.Add({ UTF8_TO_TCHAR(LoginTokens->login_tokens[i].deployment_name), FString(LoginTokens->login_tokens[i].login_token) });
+		}
+	});
+	Worker_Alpha_LoginTokensResponseFuture_Destroy(LTFuture);
+
+	return Tokens;
+}
+} // anonymous namespace
+
 void USpatialConnectionManager::FinishDestroy()
 {
 	UE_LOG(LogSpatialConnectionManager, Log, TEXT("Destroying SpatialConnectionManager."));
@@ -171,6 +338,7 @@ void USpatialConnectionManager::Connect(bool bInitAsClient, uint32 PlayInEditorI
 	}
 
 	bConnectAsClient = bInitAsClient;
+	ConnectedPlayInEditorID = PlayInEditorID;
 
 	const ISpatialGDKEditorModule* SpatialGDKEditorModule = FModuleManager::GetModulePtr<ISpatialGDKEditorModule>("SpatialGDKEditor");
 	if (SpatialGDKEditorModule != nullptr && SpatialGDKEditorModule->ShouldConnectToCloudDeployment() && bInitAsClient)
@@ -196,6 +364,23 @@ void USpatialConnectionManager::Connect(bool bInitAsClient, uint32 PlayInEditorI
 	}
 }
 
+void USpatialConnectionManager::Reconnect()
+{
+	if (WorkerConnection != nullptr)
+	{
+		WorkerConnection->DestroyConnection();
+	}
+
+	bIsConnected = false;
+
+	if (bConnectAsClient)
+	{
+		ReceptionistConfig.WorkerId.Empty();
+	}
+
+	Connect(bConnectAsClient, ConnectedPlayInEditorID);
+}
+
 void USpatialConnectionManager::OnLoginTokens(void* UserData, const Worker_Alpha_LoginTokensResponse* LoginTokens)
 {
 	if (LoginTokens->status.code != WORKER_CONNECTION_STATUS_CODE_SUCCESS)
@@ -223,23 +408,33 @@ void USpatialConnectionManager::ProcessLoginTokensResponse(const Worker_Alpha_Lo
 		return;
 	}
 
+	TArray<FDevelopmentAuthTokens::FLoginToken> Tokens;
+	for (uint32 i = 0; i < LoginTokens->login_token_count; i++)
+	{
+		Tokens.Add({ UTF8_TO_TCHAR(LoginTokens->login_tokens[i].deployment_name), FString(LoginTokens->login_tokens[i].login_token) });
+	}
+
+	ConnectWithLoginTokens(Tokens);
+}
+
+void USpatialConnectionManager::ConnectWithLoginTokens(const TArray<FDevelopmentAuthTokens::FLoginToken>& LoginTokens)
+{
 	FString DeploymentToConnect = DevAuthConfig.Deployment;
 	// If not set, use the first deployment. It can change every query if you have multiple items available, because the order is not guaranteed.
 	if (DeploymentToConnect.IsEmpty())
 	{
-		DevAuthConfig.LoginToken = FString(LoginTokens->login_tokens[0].login_token);
-		DeploymentToConnect = UTF8_TO_TCHAR(LoginTokens->login_tokens[0].deployment_name);
+		DevAuthConfig.LoginToken = LoginTokens[0].LoginToken;
+		DeploymentToConnect = LoginTokens[0].DeploymentName;
 	}
 	else
 	{
 		bool bFoundDeployment = false;
 
-		for (uint32 i = 0; i < LoginTokens->login_token_count; i++)
+		for (const FDevelopmentAuthTokens::FLoginToken& LoginToken : LoginTokens)
 		{
-			FString DeploymentName = UTF8_TO_TCHAR(LoginTokens->login_tokens[i].deployment_name);
-			if (DeploymentToConnect.Compare(DeploymentName) == 0)
+			if (DeploymentToConnect.Compare(LoginToken.DeploymentName) == 0)
 			{
-				DevAuthConfig.LoginToken = FString(LoginTokens->login_tokens[i].login_token);
+				DevAuthConfig.LoginToken = LoginToken.LoginToken;
 				bFoundDeployment = true;
 				break;
 			}
@@ -288,6 +483,31 @@ void USpatialConnectionManager::OnPlayerIdentityToken(void* UserData, const Work
 
 void USpatialConnectionManager::StartDevelopmentAuth(const FString& DevAuthToken)
 {
+	// A registered login tokens callback is given the Worker SDK's response, which is only valid during the SDK's own callback,
+	// so the tokens are fetched on the game thread for it.
+	if (!LoginTokenResCallback)
+	{
+		FDevelopmentAuthTokenCache& Cache = GetDevelopmentAuthTokenCache();
+		if (Cache.Tokens.IsSet() && Cache.Key == GetDevelopmentAuthTokenCacheKey(DevAuthToken))
+		{
+			UE_LOG(LogSpatialConnectionManager, Log, TEXT("Dev auth flow: using previously fetched login tokens."));
+
+			const FDevelopmentAuthTokens Tokens = Cache.Tokens.GetValue();
+			if (!GetDefault<USpatialGDKSettings>()->bCacheDevelopmentAuthTokens)
+			{
+				// Prefetched tokens are only used for one connection unless caching them is enabled.
+				Cache.Tokens.Reset();
+			}
+
+			bConnectingWithCachedTokens = true;
+			OnDevelopmentAuthTokensFetched(Tokens);
+			return;
+		}
+
+		FetchDevelopmentAuthTokens(DevAuthToken, true);
+		return;
+	}
+
 	FTCHARToUTF8 DAToken(*DevAuthToken);
 	FTCHARToUTF8 PlayerId(*DevAuthConfig.PlayerId);
 	FTCHARToUTF8 DisplayName(*DevAuthConfig.DisplayName);
@@ -306,6 +526,102 @@ void USpatialConnectionManager::StartDevelopmentAuth(const FString& DevAuthToken
 	}
 }
 
+void USpatialConnectionManager::PrefetchDevelopmentAuthTokens()
+{
+	const FDevelopmentAuthTokenCache& Cache = GetDevelopmentAuthTokenCache();
+	if (Cache.Tokens.IsSet() && Cache.Key == GetDevelopmentAuthTokenCacheKey(DevAuthConfig.DevelopmentAuthToken))
+	{
+		return;
+	}
+
+	FetchDevelopmentAuthTokens(DevAuthConfig.DevelopmentAuthToken, false);
+}
+
+FString USpatialConnectionManager::GetDevelopmentAuthTokenCacheKey(const FString& DevAuthToken) const
+{
+	return FString::Join(TArray<FString>{ DevAuthConfig.LocatorHost, DevAuthToken, DevAuthConfig.PlayerId, DevAuthConfig.DisplayName, DevAuthConfig.MetaData, DevAuthConfig.WorkerType }, TEXT("|"));
+}
+
+void USpatialConnectionManager::FetchDevelopmentAuthTokens(const FString& DevAuthToken, bool bConnectWhenFetched)
+{
+	FDevelopmentAuthTokenCache& Cache = GetDevelopmentAuthTokenCache();
+	const FString Key = GetDevelopmentAuthTokenCacheKey(DevAuthToken);
+
+	if (bConnectWhenFetched)
+	{
+		Cache.WaitingManagers.Emplace(this, Key);
+	}
+
+	// A prefetch for the same config is already in flight, so its tokens are waited for instead of being requested again.
+	if (Cache.bFetchInFlight && Cache.Key == Key)
+	{
+		return;
+	}
+
+	Cache.Key = Key;
+	Cache.Tokens.Reset();
+	Cache.bFetchInFlight = true;
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Key, LocatorHost = DevAuthConfig.LocatorHost, DevAuthToken, PlayerId = DevAuthConfig.PlayerId,
+		DisplayName = DevAuthConfig.DisplayName, MetaData = DevAuthConfig.MetaData, WorkerType = DevAuthConfig.WorkerType]
+	{
+		FDevelopmentAuthTokens Tokens = FetchDevelopmentAuthTokensBlocking(LocatorHost, DevAuthToken, PlayerId, DisplayName, MetaData, WorkerType);
+
+		AsyncTask(ENamedThreads::GameThread, [Key, Tokens = MoveTemp(Tokens)]
+		{
+			FDevelopmentAuthTokenCache& Cache = GetDevelopmentAuthTokenCache();
+			if (Cache.Key == Key)
+			{
+				Cache.bFetchInFlight = false;
+				if (Tokens.Error.IsEmpty())
+				{
+					Cache.Tokens = Tokens;
+				}
+			}
+
+			TArray<TWeakObjectPtr<USpatialConnectionManager>> Managers;
+			Cache.WaitingManagers.RemoveAll([&Key, &Managers](const TPair<TWeakObjectPtr<USpatialConnectionManager>, FString>& Waiting)
+			{
+				if (Waiting.Value != Key)
+				{
+					return false;
+				}
+				Managers.Add(Waiting.Key);
+				return true;
+			});
+
+			bool bTokensUsed = false;
+			for (const TWeakObjectPtr<USpatialConnectionManager>& Manager : Managers)
+			{
+				if (Manager.IsValid())
+				{
+					Manager->OnDevelopmentAuthTokensFetched(Tokens);
+					bTokensUsed = true;
+				}
+			}
+
+			if (bTokensUsed && Cache.Key == Key && !GetDefault<USpatialGDKSettings>()->bCacheDevelopmentAuthTokens)
+			{
+				Cache.Tokens.Reset();
+			}
+		});
+	});
+}
+
+void USpatialConnectionManager::OnDevelopmentAuthTokensFetched(const FDevelopmentAuthTokens& Tokens)
+{
+	if (!Tokens.Error.IsEmpty())
+	{
+		UE_LOG(LogSpatialConnectionManager, Error, TEXT("%s"), *Tokens.Error);
+		OnConnectionFailure(WORKER_CONNECTION_STATUS_CODE_NETWORK_ERROR, Tokens.Error);
+		return;
+	}
+
+	UE_LOG(LogSpatialConnectionManager, Verbose, TEXT("Successfully received LoginTokens, Count: %d"), Tokens.LoginTokens.Num());
+	DevAuthConfig.PlayerIdentityToken = Tokens.PlayerIdentityToken;
+	ConnectWithLoginTokens(Tokens.LoginTokens);
+}
+
 void USpatialConnectionManager::ConnectToReceptionist(uint32 PlayInEditorID)
 {
 #if WITH_EDITOR
@@ -376,7 +692,11 @@ void USpatialConnectionManager::FinishConnecting(Worker_ConnectionFuture* Connec
 
 			if (Worker_Connection_IsConnected(NewCAPIWorkerConnection))
 			{
-				SpatialConnectionManager->WorkerConnection = NewObject<USpatialWorkerConnection>();
+				// The worker connection is only still set if this replaces a lost connection, see Reconnect.
+				if (SpatialConnectionManager->WorkerConnection == nullptr)
+				{
+					SpatialConnectionManager->WorkerConnection = NewObject<USpatialWorkerConnection>();
+				}
 				SpatialConnectionManager->WorkerConnection->SetConnection(NewCAPIWorkerConnection);
 				SpatialConnectionManager->OnConnectionSuccess();
 			}
@@ -499,5 +819,12 @@ void USpatialConnectionManager::OnConnectionFailure(uint8_t ConnectionStatusCode
 {
 	bIsConnected = false;
 
+	if (bConnectingWithCachedTokens)
+	{
+		// The failure may be down to the tokens having expired, so the next attempt fetches new ones.
+		GetDevelopmentAuthTokenCache().Tokens.Reset();
+		bConnectingWithCachedTokens = false;
+	}
+
 	OnFailedToConnectCallback.ExecuteIfBound(ConnectionStatusCode, ErrorMessage);
 }
@@ -3,25 +3,103 @@
 #include "Interop/Connection/SpatialWorkerConnection.h"
 
 #include "Async/Async.h"
+#include "Interop/RuntimeCheckpoints.h"
+#include "Misc/CommandLine.h"
+#include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/ComponentReader.h"
+#include "Utils/SpatialThreadPolicy.h"
+#include "Utils/SubsystemStats.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialWorkerConnection);
 
 using namespace SpatialGDK;
 
+namespace
+{
+
+// Upper bounds, in seconds, of the buckets of the op queue latency histogram.
+const double OpQueueLatencyBucketBounds[] = { 0.0005, 0.001, 0.002, 0.005, 0.01, 0.02, 0.05, 0.1, TNumericLimits<double>::Max() };
+
+} // anonymous namespace
+
+class FSpatialWorkerConnectionSendRunnable : public FRunnable
+{
+public:
+	explicit FSpatialWorkerConnectionSendRunnable(USpatialWorkerConnection& InConnection)
+		: Connection(InConnection)
+	{}
+
+	virtual uint32 Run() override
+	{
+		Connection.RunOutgoingMessagesLoop();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		Connection.Stop();
+	}
+
+private:
+	USpatialWorkerConnection& Connection;
+};
+
 void USpatialWorkerConnection::SetConnection(Worker_Connection* WorkerConnectionIn)
 {
 	WorkerConnection = WorkerConnectionIn;
 
 	CacheWorkerAttributes();
 
-	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();    
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	bUseOpListArena = SpatialGDKSettings->bUseOpListArena;
+
+	// Parsing ahead only pays off when the connection runs on its own thread.
+	bPredecodeOps = SpatialGDKSettings->bPredecodeOpsOnConnectionThread && !SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread;
+
+	if (SpatialGDKSettings->bUseOutgoingMessagePriorityLanes)
+	{
+		if (!OutgoingMessageLanes.IsValid())
+		{
+			OutgoingMessageLanes = MakeUnique<FOutgoingMessageLanes>();
+		}
+		MaxBulkOutgoingMessagesPerFlush = SpatialGDKSettings->MaxBulkOutgoingMessagesPerFlush;
+	}
+	else if (SpatialGDKSettings->bUseOutgoingMessageRing && !OutgoingMessageRing.IsValid())
+	{
+		OutgoingMessageRing = MakeUnique<FOutgoingMessageRing>(SpatialGDKSettings->OutgoingMessageRingCapacity);
+	}
+
+	bCoalesceComponentUpdates = SpatialGDKSettings->bCoalesceOutgoingComponentUpdates;
+
+	FString RecordingFilename;
+	if (FParse::Value(FCommandLine::Get(), TEXT("recordOpLists="), RecordingFilename) && !OpListRecorder.IsValid())
+	{
+		OpListRecorder = MakeUnique<FOpListRecorder>();
+		if (!OpListRecorder->Open(RecordingFilename))
+		{
+			OpListRecorder.Reset();
+		}
+	}
+
+	if (!SpatialGDKSettings->bWorkerFlushAfterOutgoingNetworkOp && (SpatialGDKSettings->RPCFlushRule.IsSet() || SpatialGDKSettings->PropertyUpdateFlushRule.IsSet()))
+	{
+		FlushPolicy = MakeUnique<FFlushPolicy>(SpatialGDKSettings->RPCFlushRule, SpatialGDKSettings->PropertyUpdateFlushRule);
+	}
+
+	bCountQueuedOutgoingBytes = SpatialGDKSettings->bReportWorkerLoadVector;
+
 	if (!SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread)  
 	{
 		if (OpsProcessingThread == nullptr)
 		{
-			bool bCanWake = SpatialGDKSettings->bWorkerFlushAfterOutgoingNetworkOp;
+			const bool bCanWake = CanWakeConnectionThread(*SpatialGDKSettings, FlushPolicy.IsValid());
 			float WaitTimeS = 1.0f / (GetDefault<USpatialGDKSettings>()->OpsUpdateRate);
+			if (FlushPolicy.IsValid() && FlushPolicy->GetShortestDeadline() > 0.0)
+			{
+				// Deadlines are only checked on the game thread when messages are queued, so also send at least this often.
+				WaitTimeS = FMath::Min(WaitTimeS, static_cast<float>(FlushPolicy->GetShortestDeadline()));
+			}
 			int32 WaitTimeMs = static_cast<int32>(FTimespan::FromSeconds(WaitTimeS).GetTotalMilliseconds());
 			if (WaitTimeMs <= 0)
 			{
@@ -30,6 +108,12 @@ void USpatialWorkerConnection::SetConnection(Worker_Connection* WorkerConnection
 			}
 			ThreadWaitCondition.Emplace(bCanWake, WaitTimeMs);
 
+			bSplitWorkerConnectionThreads = SpatialGDKSettings->bSplitWorkerConnectionThreads;
+			ReceiveTimeoutMillis = static_cast<uint32>(WaitTimeMs);
+
+			bBlockOnWorkerOpList = SpatialGDKSettings->bBlockOnWorkerOpList;
+			WorkerOpListTimeoutMillis = SpatialGDKSettings->WorkerOpListTimeoutMs;
+
 			InitializeOpsProcessingThread();
 		}
 	}
@@ -46,15 +130,42 @@ void USpatialWorkerConnection::FinishDestroy()
 
 void USpatialWorkerConnection::DestroyConnection()
 {
-	Stop(); // Stop OpsProcessingThread
+	Stop(); // Stop OpsProcessingThread and SendThread
 	if (OpsProcessingThread != nullptr)
 	{
 		OpsProcessingThread->WaitForCompletion();
 		OpsProcessingThread = nullptr;
 	}
 
+	if (SendThread != nullptr)
+	{
+		if (ThreadWaitCondition.IsSet())
+		{
+			ThreadWaitCondition->Wake();
+		}
+		SendThread->WaitForCompletion();
+		delete SendThread;
+		SendThread = nullptr;
+	}
+	SendRunnable.Reset();
+
 	ThreadWaitCondition.Reset(); // Set TOptional value to null
 
+	{
+		FScopeLock Lock(&OpListArenaMutex);
+		PendingOpListArena.Reset();
+		PendingOpListReceiveTimes.Reset();
+		PendingOpListArenaFieldIds.Reset();
+	}
+	ConsumedOpListArena.Reset();
+	ConsumedOpListReceiveTimes.Reset();
+	PredecodedFieldIdsByOpList.Empty();
+
+	OutgoingMessageRing.Reset();
+	OutgoingMessageLanes.Reset();
+	FlushPolicy.Reset();
+	OpListRecorder.Reset();
+
 	if (WorkerConnection)
 	{
 		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WorkerConnection = WorkerConnection]
@@ -71,17 +182,133 @@ void USpatialWorkerConnection::DestroyConnection()
 
 TArray<Worker_OpList*> USpatialWorkerConnection::GetOpList()
 {
+	if (bUseOpListArena)
+	{
+		// Ownership of the op lists is handed back to the caller, e.g. for the startup op queueing flow.
+		FScopeLock Lock(&OpListArenaMutex);
+		PendingOpListReceiveTimes.Reset();
+		PendingOpListArenaFieldIds.Reset();
+		return PendingOpListArena.ReleaseSourceOpLists();
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	// Op lists from last tick are destroyed by now, so their entries must not be looked up again.
+	PredecodedFieldIdsByOpList.Reset();
+
 	TArray<Worker_OpList*> OpLists;
 	while (!OpListQueue.IsEmpty())
 	{
-		Worker_OpList* OutOpList;
-		OpListQueue.Dequeue(OutOpList);
-		OpLists.Add(OutOpList);
+		FReceivedOpList ReceivedOpList;
+		OpListQueue.Dequeue(ReceivedOpList);
+		OpLists.Add(ReceivedOpList.OpList);
+		RecordOpQueueLatency(ReceivedOpList.ReceiveTime, Now);
+
+		if (ReceivedOpList.PredecodedFieldIds.Num() > 0)
+		{
+			PredecodedFieldIdsByOpList.Add(ReceivedOpList.OpList, MoveTemp(ReceivedOpList.PredecodedFieldIds));
+		}
 	}
 
 	return OpLists;
 }
 
+Worker_OpList* USpatialWorkerConnection::GetOpListBatch()
+{
+	check(bUseOpListArena);
+
+	// Free everything handed out last tick with a single reset, then take the ops received since.
+	ConsumedOpListArena.Reset();
+	ConsumedOpListReceiveTimes.Reset();
+	PredecodedFieldIdsByOpList.Reset();
+
+	TArray<FPredecodedFieldIds> BatchFieldIds;
+	{
+		FScopeLock Lock(&OpListArenaMutex);
+		ConsumedOpListArena.Swap(PendingOpListArena);
+		Swap(ConsumedOpListReceiveTimes, PendingOpListReceiveTimes);
+		Swap(BatchFieldIds, PendingOpListArenaFieldIds);
+	}
+
+	// The batch copies the ops but not the schema objects they point to, so the field IDs parsed per op list still apply.
+	if (BatchFieldIds.Num() > 0)
+	{
+		PredecodedFieldIdsByOpList.Add(ConsumedOpListArena.GetBatch(), MoveTemp(BatchFieldIds));
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (const double ReceiveTime : ConsumedOpListReceiveTimes)
+	{
+		RecordOpQueueLatency(ReceiveTime, Now);
+	}
+
+	return ConsumedOpListArena.GetBatch();
+}
+
+void USpatialWorkerConnection::RecordOpQueueLatency(double ReceiveTime, double Now)
+{
+	if (OpQueueLatencyBuckets.Num() == 0)
+	{
+		for (const double UpperBound : OpQueueLatencyBucketBounds)
+		{
+			OpQueueLatencyBuckets.Add(HistogramMetricBucket{ UpperBound, 0 });
+		}
+	}
+
+	const double Latency = FMath::Max(Now - ReceiveTime, 0.0);
+
+	// Bucket sample counts are cumulative: each counts the observations less than or equal to its upper bound.
+	for (HistogramMetricBucket& Bucket : OpQueueLatencyBuckets)
+	{
+		if (Latency <= Bucket.UpperBound)
+		{
+			Bucket.Samples++;
+		}
+	}
+
+	OpQueueLatencySum += Latency;
+	OpQueueLatencySamples++;
+}
+
+bool USpatialWorkerConnection::TakePredecodedFieldIds(const Worker_OpList* OpList, TArray<FPredecodedFieldIds>& OutFieldIds)
+{
+	return PredecodedFieldIdsByOpList.RemoveAndCopyValue(OpList, OutFieldIds);
+}
+
+void USpatialWorkerConnection::PredecodeOpList(const Worker_OpList* OpList, TArray<FPredecodedFieldIds>& OutFieldIds)
+{
+	// Only reads the schema objects of the op list, which nothing else touches until the game thread takes it.
+	for (size_t i = 0; i < OpList->op_count; ++i)
+	{
+		const Worker_Op& Op = OpList->ops[i];
+		if (Op.op_type == WORKER_OP_TYPE_COMPONENT_UPDATE && Op.op.component_update.update.component_id >= SpatialConstants::STARTING_GENERATED_COMPONENT_ID)
+		{
+			Schema_ComponentUpdate* Update = Op.op.component_update.update.schema_type;
+			OutFieldIds.Emplace(Update, ComponentReader::GetComponentUpdateFieldIds(Update));
+		}
+	}
+}
+
+bool USpatialWorkerConnection::ConsumeOpQueueLatencyHistogram(HistogramMetric& OutMetric)
+{
+	if (OpQueueLatencySamples == 0)
+	{
+		return false;
+	}
+
+	OutMetric.Sum = OpQueueLatencySum;
+	OutMetric.Buckets = OpQueueLatencyBuckets;
+
+	for (HistogramMetricBucket& Bucket : OpQueueLatencyBuckets)
+	{
+		Bucket.Samples = 0;
+	}
+	OpQueueLatencySum = 0.0;
+	OpQueueLatencySamples = 0;
+
+	return true;
+}
+
 Worker_RequestId USpatialWorkerConnection::SendReserveEntityIdsRequest(uint32_t NumOfEntities)
 {
 	QueueOutgoingMessage<FReserveEntityIdsRequest>(NumOfEntities);
@@ -96,23 +323,59 @@ Worker_RequestId USpatialWorkerConnection::SendCreateEntityRequest(TArray<FWorke
 
 Worker_RequestId USpatialWorkerConnection::SendDeleteEntityRequest(Worker_EntityId EntityId)
 {
+	if (RuntimeCheckpointer != nullptr)
+	{
+		RuntimeCheckpointer->RecordSentDeleteEntity(EntityId);
+	}
+
 	QueueOutgoingMessage<FDeleteEntityRequest>(EntityId);
 	return NextRequestId++;
 }
 
 void USpatialWorkerConnection::SendAddComponent(Worker_EntityId EntityId, FWorkerComponentData* ComponentData)
 {
+	// Measured before queueing, as the connection thread may send and destroy the data as soon as it is queued.
+	const uint32 NumBytes = FlushPolicy.IsValid() || bCountQueuedOutgoingBytes ? Schema_GetWriteBufferLength(Schema_GetComponentDataFields(ComponentData->schema_type)) : 0;
+	QueuedOutgoingByteCount += NumBytes;
+
+	if (RuntimeCheckpointer != nullptr)
+	{
+		RuntimeCheckpointer->RecordSentAddComponent(EntityId, *ComponentData);
+	}
+
 	QueueOutgoingMessage<FAddComponent>(EntityId, *ComponentData);
+
+	OnMessageQueuedForFlushPolicy(EFlushTraffic::PropertyUpdate, NumBytes);
 }
 
 void USpatialWorkerConnection::SendRemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
+	if (RuntimeCheckpointer != nullptr)
+	{
+		RuntimeCheckpointer->RecordSentRemoveComponent(EntityId, ComponentId);
+	}
+
 	QueueOutgoingMessage<FRemoveComponent>(EntityId, ComponentId);
 }
 
 void USpatialWorkerConnection::SendComponentUpdate(Worker_EntityId EntityId, const FWorkerComponentUpdate* ComponentUpdate)
 {
+	// Measured before queueing, as the connection thread may send and destroy the update as soon as it is queued.
+	const uint32 NumBytes = FlushPolicy.IsValid() || bCountQueuedOutgoingBytes
+		? Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(ComponentUpdate->schema_type))
+			+ Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(ComponentUpdate->schema_type))
+		: 0;
+	QueuedOutgoingByteCount += NumBytes;
+
+	// Sent updates aren't looped back, so the checkpointer applies them itself.
+	if (RuntimeCheckpointer != nullptr)
+	{
+		RuntimeCheckpointer->RecordSentComponentUpdate(EntityId, *ComponentUpdate);
+	}
+
 	QueueOutgoingMessage<FComponentUpdate>(EntityId, *ComponentUpdate);
+
+	OnMessageQueuedForFlushPolicy(FFlushPolicy::GetTraffic(ComponentUpdate->component_id), NumBytes);
 }
 
 Worker_RequestId USpatialWorkerConnection::SendCommandRequest(Worker_EntityId EntityId, const Worker_CommandRequest* Request, uint32_t CommandId)
@@ -184,6 +447,46 @@ uint32 USpatialWorkerConnection::Run()
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 	check(!SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread);
 
+	if (bBusyPoll)
+	{
+		// Ops are queued, and outgoing messages sent, as soon as there are any, without waiting in the Worker SDK or sleeping.
+		while (KeepRunning)
+		{
+			QueueLatestOpList(0);
+			if (!bSplitWorkerConnectionThreads)
+			{
+				ProcessOutgoingMessages();
+			}
+			FPlatformProcess::Sleep(0.f);
+		}
+
+		return 0;
+	}
+
+	if (bSplitWorkerConnectionThreads)
+	{
+		// Outgoing messages are sent by SendThread, so this thread can wait in the Worker SDK for ops and queue them as soon as they arrive.
+		while (KeepRunning)
+		{
+			QueueLatestOpList(ReceiveTimeoutMillis);
+		}
+
+		return 0;
+	}
+
+	if (bBlockOnWorkerOpList)
+	{
+		// Waiting in the Worker SDK returns as soon as ops arrive, rather than after a full OpsUpdateRate interval. Outgoing messages
+		// queued meanwhile are sent within WorkerOpListTimeoutMs, so the timeout is kept short.
+		while (KeepRunning)
+		{
+			QueueLatestOpList(WorkerOpListTimeoutMillis);
+			ProcessOutgoingMessages();
+		}
+
+		return 0;
+	}
+
 	while (KeepRunning)
 	{
 		ThreadWaitCondition->Wait();
@@ -194,6 +497,22 @@ uint32 USpatialWorkerConnection::Run()
 	return 0;
 }
 
+void USpatialWorkerConnection::RunOutgoingMessagesLoop()
+{
+	while (KeepRunning)
+	{
+		if (bSendThreadBusyPoll)
+		{
+			FPlatformProcess::Sleep(0.f);
+		}
+		else
+		{
+			ThreadWaitCondition->Wait();
+		}
+		ProcessOutgoingMessages();
+	}
+}
+
 void USpatialWorkerConnection::Stop()
 {
 	KeepRunning.AtomicSet(false);
@@ -203,16 +522,55 @@ void USpatialWorkerConnection::InitializeOpsProcessingThread()
 {
 	check(IsInGameThread());
 
-	OpsProcessingThread = FRunnableThread::Create(this, TEXT("SpatialWorkerConnectionWorker"), 0);
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	bBusyPoll = SpatialGDKSettings->GetThreadPolicy(TEXT("SpatialWorkerConnectionWorker")).bBusyPoll;
+
+	OpsProcessingThread = CreateThreadWithPolicy(this, TEXT("SpatialWorkerConnectionWorker"), TPri_Normal, true);
 	check(OpsProcessingThread);
+
+	if (bSplitWorkerConnectionThreads)
+	{
+		bSendThreadBusyPoll = SpatialGDKSettings->GetThreadPolicy(TEXT("SpatialWorkerConnectionSender")).bBusyPoll;
+
+		SendRunnable = MakeUnique<FSpatialWorkerConnectionSendRunnable>(*this);
+		SendThread = CreateThreadWithPolicy(SendRunnable.Get(), TEXT("SpatialWorkerConnectionSender"), TPri_Normal, true);
+		check(SendThread);
+	}
 }
 
-void USpatialWorkerConnection::QueueLatestOpList()
+void USpatialWorkerConnection::QueueLatestOpList(uint32 TimeoutMillis)
 {
-	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, 0);
+	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, TimeoutMillis);
+
 	if (OpList->op_count > 0)
 	{
-		OpListQueue.Enqueue(OpList);
+		// Started after the Worker SDK call, so time spent waiting for ops is not counted, nor are polls that find no ops.
+		SPATIALGDK_SUBSYSTEM_SCOPE(ConnectionReceive);
+
+		const double ReceiveTime = FPlatformTime::Seconds();
+
+		if (OpListRecorder.IsValid())
+		{
+			OpListRecorder->RecordOpList(*OpList);
+		}
+
+		TArray<FPredecodedFieldIds> PredecodedFieldIds;
+		if (bPredecodeOps)
+		{
+			PredecodeOpList(OpList, PredecodedFieldIds);
+		}
+
+		if (bUseOpListArena)
+		{
+			FScopeLock Lock(&OpListArenaMutex);
+			PendingOpListArena.Append(OpList);
+			PendingOpListReceiveTimes.Add(ReceiveTime);
+			PendingOpListArenaFieldIds.Append(MoveTemp(PredecodedFieldIds));
+		}
+		else
+		{
+			OpListQueue.Enqueue(FReceivedOpList{ OpList, ReceiveTime, MoveTemp(PredecodedFieldIds) });
+		}
 	}
 	else
 	{
@@ -222,215 +580,319 @@ void USpatialWorkerConnection::QueueLatestOpList()
 
 void USpatialWorkerConnection::ProcessOutgoingMessages()
 {
+	SPATIALGDK_SUBSYSTEM_SCOPE(ConnectionSend);
+
 	bool bSentData = false;
-	while (!OutgoingMessagesQueue.IsEmpty())
+	auto SendMessage = [this, &bSentData](FOutgoingMessage* OutgoingMessage)
 	{
 		bSentData = true;
 
-		TUniquePtr<FOutgoingMessage> OutgoingMessage;
-		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
+		OnDequeueMessage.Broadcast(OutgoingMessage);
 
-		OnDequeueMessage.Broadcast(OutgoingMessage.Get());
+		if (bCoalesceComponentUpdates && OutgoingMessage->Type == EOutgoingMessageType::ComponentUpdate)
+		{
+			CoalesceComponentUpdate(*static_cast<FComponentUpdate*>(OutgoingMessage));
+			return;
+		}
 
-		static const Worker_UpdateParameters DisableLoopback{ /*loopback*/ WORKER_COMPONENT_UPDATE_LOOPBACK_NONE };
+		// Any other message may depend on the updates queued before it, so those are sent first.
+		FlushCoalescedComponentUpdates();
+		SendOutgoingMessage(OutgoingMessage);
+	};
 
-		switch (OutgoingMessage->Type)
-		{
-		case EOutgoingMessageType::ReserveEntityIdsRequest:
-		{
-			FReserveEntityIdsRequest* Message = static_cast<FReserveEntityIdsRequest*>(OutgoingMessage.Get());
+	if (OutgoingMessageLanes.IsValid())
+	{
+		OutgoingMessageLanes->Drain(SendMessage, MaxBulkOutgoingMessagesPerFlush);
+	}
 
-			Worker_Connection_SendReserveEntityIdsRequest(WorkerConnection,
-				Message->NumOfEntities,
-				nullptr);
-			break;
-		}
-		case EOutgoingMessageType::CreateEntityRequest:
+	while (true)
+	{
+		// The producer only writes to the ring once the overflow queue has drained, so draining the ring first preserves send order.
+		if (OutgoingMessageRing.IsValid() && OutgoingMessageRing->ConsumeNext(SendMessage))
 		{
-			FCreateEntityRequest* Message = static_cast<FCreateEntityRequest*>(OutgoingMessage.Get());
-
-#if TRACE_LIB_ACTIVE
-			// We have to unpack these as Worker_ComponentData is not the same as FWorkerComponentData
-			TArray<Worker_ComponentData> UnpackedComponentData;
-			UnpackedComponentData.SetNum(Message->Components.Num());
-			for (int i = 0, Num = Message->Components.Num(); i < Num; i++)
-			{
-				UnpackedComponentData[i] = Message->Components[i];
-			}
-			Worker_ComponentData* ComponentData = UnpackedComponentData.GetData();
-			uint32 ComponentCount = UnpackedComponentData.Num();
-#else
-			Worker_ComponentData* ComponentData = Message->Components.GetData();
-			uint32 ComponentCount = Message->Components.Num();
-#endif
-			Worker_Connection_SendCreateEntityRequest(WorkerConnection,
-				ComponentCount,
-				ComponentData,
-				Message->EntityId.IsSet() ? &(Message->EntityId.GetValue()) : nullptr,
-				nullptr);
-			break;
+			continue;
 		}
-		case EOutgoingMessageType::DeleteEntityRequest:
-		{
-			FDeleteEntityRequest* Message = static_cast<FDeleteEntityRequest*>(OutgoingMessage.Get());
 
-			Worker_Connection_SendDeleteEntityRequest(WorkerConnection,
-				Message->EntityId,
-				nullptr);
-			break;
-		}
-		case EOutgoingMessageType::AddComponent:
+		if (OutgoingMessagesQueue.IsEmpty())
 		{
-			FAddComponent* Message = static_cast<FAddComponent*>(OutgoingMessage.Get());
-
-			Worker_Connection_SendAddComponent(WorkerConnection,
-				Message->EntityId,
-				&Message->Data,
-				&DisableLoopback);
 			break;
 		}
-		case EOutgoingMessageType::RemoveComponent:
-		{
-			FRemoveComponent* Message = static_cast<FRemoveComponent*>(OutgoingMessage.Get());
 
-			Worker_Connection_SendRemoveComponent(WorkerConnection,
-				Message->EntityId,
-				Message->ComponentId,
-				&DisableLoopback);
-			break;
-		}
-		case EOutgoingMessageType::ComponentUpdate:
-		{
-			FComponentUpdate* Message = static_cast<FComponentUpdate*>(OutgoingMessage.Get());
+		TUniquePtr<FOutgoingMessage> OutgoingMessage;
+		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
+		OverflowMessageCount.DecrementExchange();
 
-			Worker_Connection_SendComponentUpdate(WorkerConnection,
-				Message->EntityId,
-				&Message->Update,
-				&DisableLoopback);
+		SendMessage(OutgoingMessage.Get());
+	}
 
-			break;
-		}
-		case EOutgoingMessageType::CommandRequest:
+	FlushCoalescedComponentUpdates();
+
+	// Flush worker API calls
+	if (bSentData)
+	{
+		Worker_Connection_Alpha_Flush(WorkerConnection);
+	}
+}
+
+void USpatialWorkerConnection::CoalesceComponentUpdate(const FComponentUpdate& Message)
+{
+	const EntityComponentId Id{ Message.EntityId, Message.Update.component_id };
+	if (const int32* PendingIndex = CoalescedComponentUpdateIndices.Find(Id))
+	{
+		FCoalescedComponentUpdate& PendingUpdate = CoalescedComponentUpdates[*PendingIndex];
+		if (Schema_MergeComponentUpdateIntoUpdate(Message.Update.schema_type, PendingUpdate.Update.schema_type) != 0)
 		{
-			FCommandRequest* Message = static_cast<FCommandRequest*>(OutgoingMessage.Get());
-
-			static const Worker_CommandParameters DefaultCommandParams{};
-			Worker_Connection_SendCommandRequest(WorkerConnection,
-				Message->EntityId,
-				&Message->Request,
-				nullptr,
-				&DefaultCommandParams);
-			break;
+			// The merge copies the source update, which is still owned by us.
+			Schema_DestroyComponentUpdate(Message.Update.schema_type);
+			MergedComponentUpdateCount.IncrementExchange();
+			return;
 		}
-		case EOutgoingMessageType::CommandResponse:
-		{
-			FCommandResponse* Message = static_cast<FCommandResponse*>(OutgoingMessage.Get());
 
-			Worker_Connection_SendCommandResponse(WorkerConnection,
-				Message->RequestId,
-				&Message->Response);
-			break;
-		}
-		case EOutgoingMessageType::CommandFailure:
-		{
-			FCommandFailure* Message = static_cast<FCommandFailure*>(OutgoingMessage.Get());
+		UE_LOG(LogSpatialWorkerConnection, Warning, TEXT("Failed to merge component updates for entity %lld component %d, sending them separately."), Message.EntityId, Message.Update.component_id);
+		FlushCoalescedComponentUpdates();
+	}
 
-			Worker_Connection_SendCommandFailure(WorkerConnection,
-				Message->RequestId,
-				TCHAR_TO_UTF8(*Message->Message));
-			break;
-		}
-		case EOutgoingMessageType::LogMessage:
-		{
-			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage.Get());
+	CoalescedComponentUpdateIndices.Add(Id, CoalescedComponentUpdates.Num());
+	CoalescedComponentUpdates.Add(FCoalescedComponentUpdate{ Message.EntityId, Message.Update });
+}
 
-			FTCHARToUTF8 LoggerName(*Message->LoggerName.ToString());
-			FTCHARToUTF8 LogString(*Message->Message);
+void USpatialWorkerConnection::FlushCoalescedComponentUpdates()
+{
+	if (CoalescedComponentUpdates.Num() == 0)
+	{
+		return;
+	}
 
-			Worker_LogMessage LogMessage{};
-			LogMessage.level = Message->Level;
-			LogMessage.logger_name = LoggerName.Get();
-			LogMessage.message = LogString.Get();
-			Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
-			break;
-		}
-		case EOutgoingMessageType::ComponentInterest:
-		{
-			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage.Get());
+	static const Worker_UpdateParameters DisableLoopback{ /*loopback*/ WORKER_COMPONENT_UPDATE_LOOPBACK_NONE };
 
-			Worker_Connection_SendComponentInterest(WorkerConnection,
-				Message->EntityId,
-				Message->Interests.GetData(),
-				Message->Interests.Num());
-			break;
-		}
-		case EOutgoingMessageType::EntityQueryRequest:
-		{
-			FEntityQueryRequest* Message = static_cast<FEntityQueryRequest*>(OutgoingMessage.Get());
+	for (FCoalescedComponentUpdate& PendingUpdate : CoalescedComponentUpdates)
+	{
+		BandwidthAccounting.RecordComponentUpdate(PendingUpdate.EntityId, PendingUpdate.Update.component_id, PendingUpdate.Update.schema_type);
+		Worker_Connection_SendComponentUpdate(WorkerConnection,
+			PendingUpdate.EntityId,
+			&PendingUpdate.Update,
+			&DisableLoopback);
+	}
 
-			Worker_Connection_SendEntityQueryRequest(WorkerConnection,
-				&Message->EntityQuery,
-				nullptr);
-			break;
-		}
-		case EOutgoingMessageType::Metrics:
-		{
-			FMetrics* Message = static_cast<FMetrics*>(OutgoingMessage.Get());
+	SentComponentUpdateCount.AddExchange(CoalescedComponentUpdates.Num());
 
-			// Do the conversion here so we can store everything on the stack.
-			Worker_Metrics WorkerMetrics;
+	// Keep the allocations around, this is called at least once per flush.
+	CoalescedComponentUpdates.Reset();
+	CoalescedComponentUpdateIndices.Reset();
+}
 
-			WorkerMetrics.load = Message->Metrics.Load.IsSet() ? &Message->Metrics.Load.GetValue() : nullptr;
+void USpatialWorkerConnection::SendOutgoingMessage(FOutgoingMessage* OutgoingMessage)
+{
+	// The GDK applies its own component updates locally, so the runtime never needs to send them back to this worker.
+	static const Worker_UpdateParameters DisableLoopback{ /*loopback*/ WORKER_COMPONENT_UPDATE_LOOPBACK_NONE };
 
-			TArray<Worker_GaugeMetric> WorkerGaugeMetrics;
-			WorkerGaugeMetrics.SetNum(Message->Metrics.GaugeMetrics.Num());
-			for (int i = 0; i < Message->Metrics.GaugeMetrics.Num(); i++)
-			{
-				WorkerGaugeMetrics[i].key = Message->Metrics.GaugeMetrics[i].Key.c_str();
-				WorkerGaugeMetrics[i].value = Message->Metrics.GaugeMetrics[i].Value;
-			}
+	if (OpListRecorder.IsValid())
+	{
+		OpListRecorder->RecordOutgoingMessage(*OutgoingMessage);
+	}
 
-			WorkerMetrics.gauge_metric_count = static_cast<uint32_t>(WorkerGaugeMetrics.Num());
-			WorkerMetrics.gauge_metrics = WorkerGaugeMetrics.GetData();
+	switch (OutgoingMessage->Type)
+	{
+	case EOutgoingMessageType::ReserveEntityIdsRequest:
+	{
+		FReserveEntityIdsRequest* Message = static_cast<FReserveEntityIdsRequest*>(OutgoingMessage);
 
-			TArray<Worker_HistogramMetric> WorkerHistogramMetrics;
-			TArray<TArray<Worker_HistogramMetricBucket>> WorkerHistogramMetricBuckets;
-			WorkerHistogramMetrics.SetNum(Message->Metrics.HistogramMetrics.Num());
-			WorkerHistogramMetricBuckets.SetNum(Message->Metrics.HistogramMetrics.Num());
-			for (int i = 0; i < Message->Metrics.HistogramMetrics.Num(); i++)
+		Worker_Connection_SendReserveEntityIdsRequest(WorkerConnection,
+			Message->NumOfEntities,
+			nullptr);
+		break;
+	}
+	case EOutgoingMessageType::CreateEntityRequest:
+	{
+		FCreateEntityRequest* Message = static_cast<FCreateEntityRequest*>(OutgoingMessage);
+
+		if (BandwidthAccounting.IsEnabled())
+		{
+			const Worker_EntityId EntityId = Message->EntityId.Get(SpatialConstants::INVALID_ENTITY_ID);
+			for (const FWorkerComponentData& Component : Message->Components)
 			{
-				WorkerHistogramMetrics[i].key = Message->Metrics.HistogramMetrics[i].Key.c_str();
-				WorkerHistogramMetrics[i].sum = Message->Metrics.HistogramMetrics[i].Sum;
-
-				WorkerHistogramMetricBuckets[i].SetNum(Message->Metrics.HistogramMetrics[i].Buckets.Num());
-				for (int j = 0; j < Message->Metrics.HistogramMetrics[i].Buckets.Num(); j++)
-				{
-					WorkerHistogramMetricBuckets[i][j].upper_bound = Message->Metrics.HistogramMetrics[i].Buckets[j].UpperBound;
-					WorkerHistogramMetricBuckets[i][j].samples = Message->Metrics.HistogramMetrics[i].Buckets[j].Samples;
-				}
-
-				WorkerHistogramMetrics[i].bucket_count = static_cast<uint32_t>(WorkerHistogramMetricBuckets[i].Num());
-				WorkerHistogramMetrics[i].buckets = WorkerHistogramMetricBuckets[i].GetData();
+				BandwidthAccounting.RecordComponentData(EntityId, Component.component_id, Component.schema_type);
 			}
+		}
 
-			WorkerMetrics.histogram_metric_count = static_cast<uint32_t>(WorkerHistogramMetrics.Num());
-			WorkerMetrics.histogram_metrics = WorkerHistogramMetrics.GetData();
-
-			Worker_Connection_SendMetrics(WorkerConnection, &WorkerMetrics);
-			break;
+#if TRACE_LIB_ACTIVE
+		// We have to unpack these as Worker_ComponentData is not the same as FWorkerComponentData
+		TArray<Worker_ComponentData> UnpackedComponentData;
+		UnpackedComponentData.SetNum(Message->Components.Num());
+		for (int i = 0, Num = Message->Components.Num(); i < Num; i++)
+		{
+			UnpackedComponentData[i] = Message->Components[i];
 		}
-		default:
+		Worker_ComponentData* ComponentData = UnpackedComponentData.GetData();
+		uint32 ComponentCount = UnpackedComponentData.Num();
+#else
+		Worker_ComponentData* ComponentData = Message->Components.GetData();
+		uint32 ComponentCount = Message->Components.Num();
+#endif
+		Worker_Connection_SendCreateEntityRequest(WorkerConnection,
+			ComponentCount,
+			ComponentData,
+			Message->EntityId.IsSet() ? &(Message->EntityId.GetValue()) : nullptr,
+			nullptr);
+		break;
+	}
+	case EOutgoingMessageType::DeleteEntityRequest:
+	{
+		FDeleteEntityRequest* Message = static_cast<FDeleteEntityRequest*>(OutgoingMessage);
+
+		Worker_Connection_SendDeleteEntityRequest(WorkerConnection,
+			Message->EntityId,
+			nullptr);
+		break;
+	}
+	case EOutgoingMessageType::AddComponent:
+	{
+		FAddComponent* Message = static_cast<FAddComponent*>(OutgoingMessage);
+
+		BandwidthAccounting.RecordComponentData(Message->EntityId, Message->Data.component_id, Message->Data.schema_type);
+		Worker_Connection_SendAddComponent(WorkerConnection,
+			Message->EntityId,
+			&Message->Data,
+			&DisableLoopback);
+		break;
+	}
+	case EOutgoingMessageType::RemoveComponent:
+	{
+		FRemoveComponent* Message = static_cast<FRemoveComponent*>(OutgoingMessage);
+
+		Worker_Connection_SendRemoveComponent(WorkerConnection,
+			Message->EntityId,
+			Message->ComponentId,
+			&DisableLoopback);
+		break;
+	}
+	case EOutgoingMessageType::ComponentUpdate:
+	{
+		FComponentUpdate* Message = static_cast<FComponentUpdate*>(OutgoingMessage);
+
+		BandwidthAccounting.RecordComponentUpdate(Message->EntityId, Message->Update.component_id, Message->Update.schema_type);
+		Worker_Connection_SendComponentUpdate(WorkerConnection,
+			Message->EntityId,
+			&Message->Update,
+			&DisableLoopback);
+		SentComponentUpdateCount.IncrementExchange();
+
+		break;
+	}
+	case EOutgoingMessageType::CommandRequest:
+	{
+		FCommandRequest* Message = static_cast<FCommandRequest*>(OutgoingMessage);
+
+		static const Worker_CommandParameters DefaultCommandParams{};
+		Worker_Connection_SendCommandRequest(WorkerConnection,
+			Message->EntityId,
+			&Message->Request,
+			nullptr,
+			&DefaultCommandParams);
+		break;
+	}
+	case EOutgoingMessageType::CommandResponse:
+	{
+		FCommandResponse* Message = static_cast<FCommandResponse*>(OutgoingMessage);
+
+		Worker_Connection_SendCommandResponse(WorkerConnection,
+			Message->RequestId,
+			&Message->Response);
+		break;
+	}
+	case EOutgoingMessageType::CommandFailure:
+	{
+		FCommandFailure* Message = static_cast<FCommandFailure*>(OutgoingMessage);
+
+		Worker_Connection_SendCommandFailure(WorkerConnection,
+			Message->RequestId,
+			TCHAR_TO_UTF8(*Message->Message));
+		break;
+	}
+	case EOutgoingMessageType::LogMessage:
+	{
+		FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage);
+
+		FTCHARToUTF8 LoggerName(*Message->LoggerName.ToString());
+		FTCHARToUTF8 LogString(*Message->Message);
+
+		Worker_LogMessage LogMessage{};
+		LogMessage.level = Message->Level;
+		LogMessage.logger_name = LoggerName.Get();
+		LogMessage.message = LogString.Get();
+		Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
+		break;
+	}
+	case EOutgoingMessageType::ComponentInterest:
+	{
+		FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage);
+
+		Worker_Connection_SendComponentInterest(WorkerConnection,
+			Message->EntityId,
+			Message->Interests.GetData(),
+			Message->Interests.Num());
+		break;
+	}
+	case EOutgoingMessageType::EntityQueryRequest:
+	{
+		FEntityQueryRequest* Message = static_cast<FEntityQueryRequest*>(OutgoingMessage);
+
+		Worker_Connection_SendEntityQueryRequest(WorkerConnection,
+			&Message->EntityQuery,
+			nullptr);
+		break;
+	}
+	case EOutgoingMessageType::Metrics:
+	{
+		FMetrics* Message = static_cast<FMetrics*>(OutgoingMessage);
+
+		// Do the conversion here so we can store everything on the stack.
+		Worker_Metrics WorkerMetrics;
+
+		WorkerMetrics.load = Message->Metrics.Load.IsSet() ? &Message->Metrics.Load.GetValue() : nullptr;
+
+		TArray<Worker_GaugeMetric> WorkerGaugeMetrics;
+		WorkerGaugeMetrics.SetNum(Message->Metrics.GaugeMetrics.Num());
+		for (int i = 0; i < Message->Metrics.GaugeMetrics.Num(); i++)
 		{
-			checkNoEntry();
-			break;
+			WorkerGaugeMetrics[i].key = Message->Metrics.GaugeMetrics[i].Key.c_str();
+			WorkerGaugeMetrics[i].value = Message->Metrics.GaugeMetrics[i].Value;
 		}
+
+		WorkerMetrics.gauge_metric_count = static_cast<uint32_t>(WorkerGaugeMetrics.Num());
+		WorkerMetrics.gauge_metrics = WorkerGaugeMetrics.GetData();
+
+		TArray<Worker_HistogramMetric> WorkerHistogramMetrics;
+		TArray<TArray<Worker_HistogramMetricBucket>> WorkerHistogramMetricBuckets;
+		WorkerHistogramMetrics.SetNum(Message->Metrics.HistogramMetrics.Num());
+		WorkerHistogramMetricBuckets.SetNum(Message->Metrics.HistogramMetrics.Num());
+		for (int i = 0; i < Message->Metrics.HistogramMetrics.Num(); i++)
+		{
+			WorkerHistogramMetrics[i].key = Message->Metrics.HistogramMetrics[i].Key.c_str();
+			WorkerHistogramMetrics[i].sum = Message->Metrics.HistogramMetrics[i].Sum;
+
+			WorkerHistogramMetricBuckets[i].SetNum(Message->Metrics.HistogramMetrics[i].Buckets.Num());
+			for (int j = 0; j < Message->Metrics.HistogramMetrics[i].Buckets.Num(); j++)
+			{
+				WorkerHistogramMetricBuckets[i][j].upper_bound = Message->Metrics.HistogramMetrics[i].Buckets[j].UpperBound;
+				WorkerHistogramMetricBuckets[i][j].samples = Message->Metrics.HistogramMetrics[i].Buckets[j].Samples;
+			}
+
+			WorkerHistogramMetrics[i].bucket_count = static_cast<uint32_t>(WorkerHistogramMetricBuckets[i].Num());
+			WorkerHistogramMetrics[i].buckets = WorkerHistogramMetricBuckets[i].GetData();
 		}
-	}
 
-	// Flush worker API calls
-	if (bSentData)
+		WorkerMetrics.histogram_metric_count = static_cast<uint32_t>(WorkerHistogramMetrics.Num());
+		WorkerMetrics.histogram_metrics = WorkerHistogramMetrics.GetData();
+
+		Worker_Connection_SendMetrics(WorkerConnection, &WorkerMetrics);
+		break;
+	}
+	default:
 	{
-		Worker_Connection_Alpha_Flush(WorkerConnection);
+		checkNoEntry();
+		break;
+	}
 	}
 }
 
@@ -443,8 +905,34 @@ void USpatialWorkerConnection::MaybeFlush()
 	}
 }
 
+bool USpatialWorkerConnection::CanWakeConnectionThread(const USpatialGDKSettings& Settings, bool bHasFlushPolicy)
+{
+	return Settings.bWorkerFlushAfterOutgoingNetworkOp || bHasFlushPolicy || Settings.LatencyCriticalRPCs.Num() > 0;
+}
+
+void USpatialWorkerConnection::ApplyEndOfTickFlushPolicy()
+{
+	if (FlushPolicy.IsValid() && FlushPolicy->ShouldFlushAtEndOfTick(FPlatformTime::Seconds()))
+	{
+		Flush();
+	}
+}
+
+void USpatialWorkerConnection::OnMessageQueuedForFlushPolicy(EFlushTraffic Traffic, uint32 NumBytes)
+{
+	if (FlushPolicy.IsValid() && FlushPolicy->OnMessageQueued(Traffic, NumBytes, FPlatformTime::Seconds()))
+	{
+		Flush();
+	}
+}
+
 void USpatialWorkerConnection::Flush()
 {
+	if (FlushPolicy.IsValid())
+	{
+		FlushPolicy->OnFlushed();
+	}
+
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 	if (Settings->bRunSpatialWorkerConnectionOnGameThread)
 	{
@@ -456,12 +944,47 @@ void USpatialWorkerConnection::Flush()
 	}
 }
 
+uint32 USpatialWorkerConnection::GetOutgoingMessageQueueDepth() const
+{
+	const uint32 RingDepth = OutgoingMessageRing.IsValid() ? OutgoingMessageRing->Num() : 0;
+	const uint32 LanesDepth = OutgoingMessageLanes.IsValid() ? OutgoingMessageLanes->GetTotalDepth() : 0;
+	return RingDepth + LanesDepth + FMath::Max(OverflowMessageCount.Load(), 0);
+}
+
 template <typename T, typename... ArgsType>
 void USpatialWorkerConnection::QueueOutgoingMessage(ArgsType&&... Args)
 {
-	// TODO UNR-1271: As later optimization, we can change the queue to hold a union
-	// of all outgoing message types, rather than having a pointer.
+	QueuedOutgoingMessageCount++;
+
+	if (OutgoingMessageLanes.IsValid())
+	{
+		auto Message = MakeUnique<T>(Forward<ArgsType>(Args)...);
+		OnEnqueueMessage.Broadcast(Message.Get());
+		OutgoingMessageLanes->Enqueue(MoveTemp(Message));
+		return;
+	}
+
+	if (OutgoingMessageRing.IsValid())
+	{
+		// Once the ring has been full, keep using the overflow queue until it drains so messages are sent in order.
+		if (OverflowMessageCount.Load() == 0 && !OutgoingMessageRing->IsFull())
+		{
+			if (!FOutgoingMessageRing::FitsInline<T>())
+			{
+				OutgoingMessageRingOversizedCount++;
+			}
+
+			T* Message = OutgoingMessageRing->Emplace<T>(Forward<ArgsType>(Args)...);
+			OnEnqueueMessage.Broadcast(Message);
+			OutgoingMessageRing->Publish();
+			return;
+		}
+
+		OutgoingMessageRingFullCount++;
+	}
+
 	auto Message = MakeUnique<T>(Forward<ArgsType>(Args)...);
 	OnEnqueueMessage.Broadcast(Message.Get());
+	OverflowMessageCount.IncrementExchange();
 	OutgoingMessagesQueue.Enqueue(MoveTemp(Message));
 }
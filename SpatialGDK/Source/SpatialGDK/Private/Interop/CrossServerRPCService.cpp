@@ -0,0 +1,441 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/CrossServerRPCService.h"
+
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/AuthorityIntent.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/RPCRingBuffer.h"
+
+DEFINE_LOG_CATEGORY(LogCrossServerRPCService);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+uint32 GetCrossServerRingBufferSize()
+{
+	return FMath::Min(RPCRingBufferUtils::GetRingBufferSize(ERPCType::CrossServer), GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize);
+}
+
+} // anonymous namespace
+
+CrossServerRPCService::CrossServerRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View)
+	: ExtractRPCCallback(ExtractRPCCallback)
+	, View(View)
+	, RingBufferSize(GetCrossServerRingBufferSize())
+{
+}
+
+CrossServerRPCService::~CrossServerRPCService()
+{
+	if (PendingUpdate != nullptr)
+	{
+		Schema_DestroyComponentUpdate(PendingUpdate);
+	}
+}
+
+EPushRPCResult CrossServerRPCService::PushRPC(Worker_EntityId TargetEntityId, const RPCPayload& Payload, bool bReliable)
+{
+	if (!IsReady())
+	{
+		return EPushRPCResult::NoRingBufferAuthority;
+	}
+
+	FCrossServerRPC RPC{ TargetEntityId, Payload, bReliable };
+
+	// Queue behind any RPCs already waiting, so cross-server RPCs keep the order they were sent in.
+	if (OverflowedRPCs.Num() > 0 || !CanWriteRPC(RPC))
+	{
+		OverflowedRPCs.Add(MoveTemp(RPC));
+		return EPushRPCResult::QueueOverflowed;
+	}
+
+	WriteRPC(TargetEntityId, Payload);
+	return EPushRPCResult::Success;
+}
+
+void CrossServerRPCService::PushOverflowedRPCs()
+{
+	int32 NumPushed = 0;
+	for (;;)
+	{
+		while (NumPushed < OverflowedRPCs.Num() && CanWriteRPC(OverflowedRPCs[NumPushed]))
+		{
+			WriteRPC(OverflowedRPCs[NumPushed].TargetEntityId, OverflowedRPCs[NumPushed].Payload);
+			NumPushed++;
+		}
+
+		// Once a whole ring buffer of RPCs is waiting on a receiver the others have moved past, stop waiting for it rather than
+		// stalling the RPCs to every other server.
+		if (NumPushed == OverflowedRPCs.Num() || OverflowedRPCs.Num() - NumPushed < static_cast<int32>(RingBufferSize) || !MarkLaggingReceivers())
+		{
+			break;
+		}
+	}
+
+	if (NumPushed > 0)
+	{
+		OverflowedRPCs.RemoveAt(0, NumPushed);
+	}
+}
+
+void CrossServerRPCService::ProcessHeldRPCs()
+{
+	for (auto It = HeldRPCs.CreateIterator(); It; ++It)
+	{
+		const Worker_EntityId TargetEntityId = It.Key();
+		if (View->HasAuthority(TargetEntityId, SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID))
+		{
+			for (const RPCPayload& Payload : It.Value())
+			{
+				ExtractRPCCallback.Execute(TargetEntityId, ERPCType::CrossServer, Payload);
+			}
+			It.RemoveCurrent();
+		}
+		else if (!IsAuthorityIntendedForThisWorker(TargetEntityId))
+		{
+			UE_LOG(LogCrossServerRPCService, Warning, TEXT("CrossServerRPCService::ProcessHeldRPCs: Authority over entity %lld moved away before this server gained it, dropping %d held RPCs."),
+				TargetEntityId, It.Value().Num());
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 CrossServerRPCService::GetNumHeldRPCs() const
+{
+	int32 NumHeldRPCs = 0;
+	for (const TPair<Worker_EntityId_Key, TArray<RPCPayload>>& Held : HeldRPCs)
+	{
+		NumHeldRPCs += Held.Value.Num();
+	}
+	return NumHeldRPCs;
+}
+
+uint64 CrossServerRPCService::GetOldestAckedRPCId() const
+{
+	uint64 OldestAckedRPCId = LastFlushedRPCId;
+	for (const TPair<Worker_EntityId_Key, FReceiverEndpoint>& ReceiverEndpoint : ReceiverEndpoints)
+	{
+		if (!ReceiverEndpoint.Value.bLagging)
+		{
+			OldestAckedRPCId = FMath::Min(OldestAckedRPCId, ReceiverEndpoint.Value.LastAckedRPCId);
+		}
+	}
+	return OldestAckedRPCId;
+}
+
+bool CrossServerRPCService::HasCapacity() const
+{
+	// Slots are only reused once every server that can see this endpoint has acked the RPC in them, and none are written twice in one update.
+	return LastSentRPCId - GetOldestAckedRPCId() < RingBufferSize;
+}
+
+bool CrossServerRPCService::HaveAllReceiversSeenEndpoint() const
+{
+	for (const TPair<Worker_EntityId_Key, FReceiverEndpoint>& ReceiverEndpoint : ReceiverEndpoints)
+	{
+		if (!ReceiverEndpoint.Value.bHasAcked && !ReceiverEndpoint.Value.bLagging)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CrossServerRPCService::CanWriteRPC(const FCrossServerRPC& RPC) const
+{
+	// A server skips the RPCs already in the buffer when it first sees this endpoint, so reliable RPCs wait until every server has.
+	return HasCapacity() && (!RPC.bReliable || HaveAllReceiversSeenEndpoint());
+}
+
+bool CrossServerRPCService::MarkLaggingReceivers()
+{
+	const uint64 OldestAckedRPCId = GetOldestAckedRPCId();
+	uint64 NewestAckedRPCId = 0;
+	for (const TPair<Worker_EntityId_Key, FReceiverEndpoint>& ReceiverEndpoint : ReceiverEndpoints)
+	{
+		if (!ReceiverEndpoint.Value.bLagging)
+		{
+			NewestAckedRPCId = FMath::Max(NewestAckedRPCId, ReceiverEndpoint.Value.LastAckedRPCId);
+		}
+	}
+
+	// When every receiver is equally behind, this server is just sending faster than they can keep up with.
+	if (NewestAckedRPCId <= OldestAckedRPCId)
+	{
+		return false;
+	}
+
+	for (TPair<Worker_EntityId_Key, FReceiverEndpoint>& ReceiverEndpoint : ReceiverEndpoints)
+	{
+		if (!ReceiverEndpoint.Value.bLagging && ReceiverEndpoint.Value.LastAckedRPCId == OldestAckedRPCId)
+		{
+			UE_LOG(LogCrossServerRPCService, Warning, TEXT("CrossServerRPCService::MarkLaggingReceivers: Worker entity %lld stopped acking cross-server RPCs at %llu while others acked up to %llu, no longer waiting for it."),
+				ReceiverEndpoint.Key, OldestAckedRPCId, NewestAckedRPCId);
+			ReceiverEndpoint.Value.bLagging = true;
+		}
+	}
+
+	return true;
+}
+
+void CrossServerRPCService::WriteRPC(Worker_EntityId TargetEntityId, const RPCPayload& Payload)
+{
+	Schema_Object* EndpointObject = GetOrCreatePendingUpdateFields();
+
+	LastSentRPCId++;
+	RPCRingBufferUtils::WriteRPCToSchema(EndpointObject, ERPCType::CrossServer, RingBufferSize, LastSentRPCId, Payload);
+
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::CrossServer, RingBufferSize);
+	Schema_Object* RPCObject = Schema_GetObject(EndpointObject, Descriptor.GetRingBufferElementFieldId(LastSentRPCId));
+	Schema_AddEntityId(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_TARGET_ENTITY_ID, TargetEntityId);
+}
+
+TArray<SpatialRPCService::UpdateToSend> CrossServerRPCService::GetRPCsAndAcksToSend()
+{
+	TArray<SpatialRPCService::UpdateToSend> UpdatesToSend;
+
+	if (!IsReady())
+	{
+		return UpdatesToSend;
+	}
+
+	if (bAcksDirty)
+	{
+		Schema_Object* EndpointObject = GetOrCreatePendingUpdateFields();
+		const Schema_FieldId AckFieldId = RPCRingBufferUtils::GetAckFieldId(ERPCType::CrossServer);
+
+		// Maps in updates replace the whole map, so every ack is written each time.
+		for (const TPair<Worker_EntityId_Key, FSenderEndpoint>& SenderEndpoint : SenderEndpoints)
+		{
+			Schema_Object* PairObject = Schema_AddObject(EndpointObject, AckFieldId);
+			Schema_AddEntityId(PairObject, SCHEMA_MAP_KEY_FIELD_ID, SenderEndpoint.Key);
+			Schema_AddUint64(PairObject, SCHEMA_MAP_VALUE_FIELD_ID, SenderEndpoint.Value.LastSeenRPCId);
+		}
+
+		if (SenderEndpoints.Num() == 0)
+		{
+			Schema_AddComponentUpdateClearedField(PendingUpdate, AckFieldId);
+		}
+
+		bAcksDirty = false;
+	}
+
+	if (PendingUpdate != nullptr)
+	{
+		SpatialRPCService::UpdateToSend& UpdateToSend = UpdatesToSend.AddZeroed_GetRef();
+		UpdateToSend.EntityId = LocalWorkerEntityId;
+		UpdateToSend.Update.component_id = SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID;
+		UpdateToSend.Update.schema_type = PendingUpdate;
+
+		PendingUpdate = nullptr;
+		LastFlushedRPCId = LastSentRPCId;
+	}
+
+	return UpdatesToSend;
+}
+
+FWorkerComponentData CrossServerRPCService::CreateEndpointData()
+{
+	FWorkerComponentData Data{};
+	Data.component_id = SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID;
+	Data.schema_type = Schema_CreateComponentData();
+	Schema_Object* EndpointObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::CrossServer, GetCrossServerRingBufferSize());
+	Schema_AddUint64(EndpointObject, Descriptor.LastSentRPCFieldId, 0);
+	RPCRingBufferUtils::WriteRingBufferSizeToSchema(EndpointObject, ERPCType::CrossServer, Descriptor.RingBufferSize);
+
+	return Data;
+}
+
+void CrossServerRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId)
+{
+	// The endpoint is created empty with the worker entity, which only this worker ever writes to.
+	if (PendingUpdate != nullptr && LocalWorkerEntityId != EntityId)
+	{
+		Schema_DestroyComponentUpdate(PendingUpdate);
+		PendingUpdate = nullptr;
+	}
+	LocalWorkerEntityId = EntityId;
+
+	SenderEndpoints.Remove(EntityId);
+	ReceiverEndpoints.Remove(EntityId);
+}
+
+void CrossServerRPCService::OnEndpointAdded(Worker_EntityId EntityId, Schema_Object* EndpointObject)
+{
+	if (EntityId == LocalWorkerEntityId)
+	{
+		return;
+	}
+
+	// Like multicast RPCs on an entity coming into view, the RPCs already in the buffer are skipped, they were sent before this
+	// server could see them.
+	FSenderEndpoint& SenderEndpoint = SenderEndpoints.FindOrAdd(EntityId);
+	SenderEndpoint.RingBufferSize = RingBufferSize;
+	SenderEndpoint.LastSeenRPCId = 0;
+
+	const Schema_FieldId RingBufferSizeFieldId = RPCRingBufferUtils::GetRingBufferSizeFieldId(ERPCType::CrossServer);
+	if (Schema_GetUint32Count(EndpointObject, RingBufferSizeFieldId) > 0)
+	{
+		SenderEndpoint.RingBufferSize = FMath::Clamp(Schema_GetUint32(EndpointObject, RingBufferSizeFieldId), 1u, GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize);
+	}
+
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::CrossServer, SenderEndpoint.RingBufferSize);
+	if (Schema_GetUint64Count(EndpointObject, Descriptor.LastSentRPCFieldId) > 0)
+	{
+		SenderEndpoint.LastSeenRPCId = Schema_GetUint64(EndpointObject, Descriptor.LastSentRPCFieldId);
+	}
+
+	bAcksDirty = true;
+
+	// Until it acks, assume the server only needs what this server sends from now on, anything already sent it will skip.
+	FReceiverEndpoint& ReceiverEndpoint = ReceiverEndpoints.FindOrAdd(EntityId);
+	ReceiverEndpoint.LastAckedRPCId = LastFlushedRPCId;
+	ReceiverEndpoint.bHasAcked = false;
+	ReceiverEndpoint.bLagging = false;
+
+	ReadAck(EntityId, EndpointObject);
+}
+
+void CrossServerRPCService::OnEndpointUpdated(Worker_EntityId EntityId, Schema_Object* EndpointObject)
+{
+	if (EntityId == LocalWorkerEntityId)
+	{
+		return;
+	}
+
+	ExtractRPCs(EntityId, EndpointObject);
+	ReadAck(EntityId, EndpointObject);
+}
+
+void CrossServerRPCService::OnEndpointRemoved(Worker_EntityId EntityId)
+{
+	if (SenderEndpoints.Remove(EntityId) > 0)
+	{
+		bAcksDirty = true;
+	}
+
+	// A server that went away no longer holds back reusing the ring buffer.
+	ReceiverEndpoints.Remove(EntityId);
+}
+
+void CrossServerRPCService::ReadAck(Worker_EntityId EntityId, Schema_Object* EndpointObject)
+{
+	if (!IsReady())
+	{
+		return;
+	}
+
+	const Schema_FieldId AckFieldId = RPCRingBufferUtils::GetAckFieldId(ERPCType::CrossServer);
+	const uint32 AckCount = Schema_GetObjectCount(EndpointObject, AckFieldId);
+	for (uint32 AckIndex = 0; AckIndex < AckCount; AckIndex++)
+	{
+		Schema_Object* PairObject = Schema_IndexObject(EndpointObject, AckFieldId, AckIndex);
+		if (Schema_GetEntityId(PairObject, SCHEMA_MAP_KEY_FIELD_ID) == LocalWorkerEntityId)
+		{
+			FReceiverEndpoint& ReceiverEndpoint = ReceiverEndpoints.FindOrAdd(EntityId);
+			ReceiverEndpoint.LastAckedRPCId = Schema_GetUint64(PairObject, SCHEMA_MAP_VALUE_FIELD_ID);
+			ReceiverEndpoint.bHasAcked = true;
+
+			// A lagging server is waited for again once it has caught up with the others.
+			if (ReceiverEndpoint.bLagging && ReceiverEndpoint.LastAckedRPCId >= GetOldestAckedRPCId())
+			{
+				ReceiverEndpoint.bLagging = false;
+			}
+			return;
+		}
+	}
+}
+
+void CrossServerRPCService::ExtractRPCs(Worker_EntityId EntityId, Schema_Object* EndpointObject)
+{
+	FSenderEndpoint* SenderEndpoint = SenderEndpoints.Find(EntityId);
+	if (SenderEndpoint == nullptr)
+	{
+		return;
+	}
+
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::CrossServer, SenderEndpoint->RingBufferSize);
+	if (Schema_GetUint64Count(EndpointObject, Descriptor.LastSentRPCFieldId) == 0)
+	{
+		return;
+	}
+
+	const uint64 LastSentRPCIdForSender = Schema_GetUint64(EndpointObject, Descriptor.LastSentRPCFieldId);
+	if (LastSentRPCIdForSender <= SenderEndpoint->LastSeenRPCId)
+	{
+		return;
+	}
+
+	if (LastSentRPCIdForSender - SenderEndpoint->LastSeenRPCId > Descriptor.RingBufferSize)
+	{
+		UE_LOG(LogCrossServerRPCService, Warning, TEXT("CrossServerRPCService::ExtractRPCs: RPCs from worker entity %lld were overwritten before being received. Last seen RPC: %llu, last sent RPC: %llu, ring buffer size: %u"),
+			EntityId, SenderEndpoint->LastSeenRPCId, LastSentRPCIdForSender, Descriptor.RingBufferSize);
+		SenderEndpoint->LastSeenRPCId = LastSentRPCIdForSender - Descriptor.RingBufferSize;
+	}
+
+	for (uint64 RPCId = SenderEndpoint->LastSeenRPCId + 1; RPCId <= LastSentRPCIdForSender; RPCId++)
+	{
+		const Schema_FieldId FieldId = Descriptor.GetRingBufferElementFieldId(RPCId);
+		if (Schema_GetObjectCount(EndpointObject, FieldId) == 0)
+		{
+			UE_LOG(LogCrossServerRPCService, Warning, TEXT("CrossServerRPCService::ExtractRPCs: RPC %llu from worker entity %lld is missing from the update."), RPCId, EntityId);
+			continue;
+		}
+
+		Schema_Object* RPCObject = Schema_GetObject(EndpointObject, FieldId);
+		const Worker_EntityId TargetEntityId = Schema_GetEntityId(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_TARGET_ENTITY_ID);
+
+		// RPCs for an entity this server is gaining authority over wait for the handover, and stay behind the held ones after it.
+		if (TArray<RPCPayload>* TargetHeldRPCs = HeldRPCs.Find(TargetEntityId))
+		{
+			TargetHeldRPCs->Add(RPCPayload(RPCObject));
+			continue;
+		}
+
+		// Every server acks every RPC, but only the server the RPC would have been sent to as a command executes it.
+		if (!View->HasAuthority(TargetEntityId, SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID))
+		{
+			if (IsAuthorityIntendedForThisWorker(TargetEntityId))
+			{
+				HeldRPCs.Add(TargetEntityId).Add(RPCPayload(RPCObject));
+			}
+			continue;
+		}
+
+		// Elements are only in the update they were written in, so unlike SpatialRPCService extraction can't stop partway.
+		ExtractRPCCallback.Execute(TargetEntityId, ERPCType::CrossServer, RPCPayload(RPCObject));
+	}
+
+	SenderEndpoint->LastSeenRPCId = LastSentRPCIdForSender;
+	bAcksDirty = true;
+}
+
+bool CrossServerRPCService::IsAuthorityIntendedForThisWorker(Worker_EntityId TargetEntityId) const
+{
+	if (VirtualWorkerTranslator == nullptr || VirtualWorkerTranslator->GetLocalVirtualWorkerId() == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		return false;
+	}
+
+	const AuthorityIntent* AuthorityIntentComponent = View->GetComponentData<AuthorityIntent>(TargetEntityId);
+	return AuthorityIntentComponent != nullptr && AuthorityIntentComponent->VirtualWorkerId == VirtualWorkerTranslator->GetLocalVirtualWorkerId();
+}
+
+Schema_Object* CrossServerRPCService::GetOrCreatePendingUpdateFields()
+{
+	if (PendingUpdate == nullptr)
+	{
+		PendingUpdate = Schema_CreateComponentUpdate();
+	}
+
+	return Schema_GetComponentUpdateFields(PendingUpdate);
+}
+
+} // namespace SpatialGDK
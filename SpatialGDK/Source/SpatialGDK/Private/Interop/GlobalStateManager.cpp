@@ -7,6 +7,7 @@
 #include "Editor.h"
 #endif
 
+#include "Async/ParallelFor.h"
 #include "Engine/Classes/AI/AISystemBase.h"
 #include "Engine/World.h"
 #include "EngineClasses/SpatialActorChannel.h"
@@ -23,12 +24,15 @@
 #include "Schema/ServerWorker.h"
 #include "Schema/UnrealMetadata.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "UObject/UObjectGlobals.h"
 #include "Utils/EntityPool.h"
 #include "Utils/SpatialStatics.h"
 
 DEFINE_LOG_CATEGORY(LogGlobalStateManager);
 
+DECLARE_CYCLE_STAT(TEXT("SetAllActorRolesBasedOnLBStrategy"), STAT_GlobalStateManagerSetAllActorRoles, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
 void UGlobalStateManager::Init(USpatialNetDriver* InNetDriver)
@@ -367,18 +371,54 @@ void UGlobalStateManager::BeginDestroy()
 
 void UGlobalStateManager::SetAllActorRolesBasedOnLBStrategy()
 {
+	SCOPE_CYCLE_COUNTER(STAT_GlobalStateManagerSetAllActorRoles);
+
+	TArray<AActor*> Actors;
 	for (TActorIterator<AActor> It(NetDriver->World); It; ++It)
 	{
 		AActor* Actor = *It;
-		if (Actor != nullptr && !Actor->IsPendingKill())
+		if (Actor != nullptr && !Actor->IsPendingKill() && Actor->GetIsReplicated())
+		{
+			Actors.Add(Actor);
+		}
+	}
+
+	const TArray<const AActor*> QueryActors(Actors);
+	const UAbstractLBStrategy* LBStrategy = NetDriver->LoadBalanceStrategy;
+	const int32 ActorsPerBatch = SpatialConstants::STARTUP_ROLE_ASSIGNMENT_ACTORS_PER_BATCH;
+
+	TArray<bool> ShouldHaveAuthority;
+	if (GetDefault<USpatialGDKSettings>()->bParallelizeStartupActorRoleAssignment && QueryActors.Num() > ActorsPerBatch && LBStrategy->SupportsParallelAuthorityQueries())
+	{
+		LBStrategy->PrepareParallelAuthorityQueries(QueryActors);
+
+		// Each batch only writes its own range of results.
+		ShouldHaveAuthority.SetNumZeroed(QueryActors.Num());
+		const int32 NumBatches = FMath::DivideAndRoundUp(QueryActors.Num(), ActorsPerBatch);
+		ParallelFor(NumBatches, [&QueryActors, &ShouldHaveAuthority, LBStrategy, ActorsPerBatch](int32 BatchIndex)
 		{
-			if (Actor->GetIsReplicated())
+			const int32 FirstActorIndex = BatchIndex * ActorsPerBatch;
+			const TArray<const AActor*> BatchActors(QueryActors.GetData() + FirstActorIndex, FMath::Min(ActorsPerBatch, QueryActors.Num() - FirstActorIndex));
+
+			TArray<bool> BatchShouldHaveAuthority;
+			LBStrategy->ShouldHaveAuthorityForActors(BatchActors, BatchShouldHaveAuthority);
+			for (int32 i = 0; i < BatchActors.Num(); i++)
 			{
-				const bool bAuthoritative =  NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor);
-				Actor->Role = bAuthoritative ? ROLE_Authority : ROLE_SimulatedProxy;
-				Actor->RemoteRole = bAuthoritative ? ROLE_SimulatedProxy : ROLE_Authority;
+				ShouldHaveAuthority[FirstActorIndex + i] = BatchShouldHaveAuthority[i];
 			}
-		}
+		});
+	}
+	else
+	{
+		LBStrategy->ShouldHaveAuthorityForActors(QueryActors, ShouldHaveAuthority);
+	}
+
+	// Roles are only changed on the game thread.
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		const bool bAuthoritative = ShouldHaveAuthority[i];
+		Actors[i]->Role = bAuthoritative ? ROLE_Authority : ROLE_SimulatedProxy;
+		Actors[i]->RemoteRole = bAuthoritative ? ROLE_SimulatedProxy : ROLE_Authority;
 	}
 }
 
@@ -446,9 +486,6 @@ void UGlobalStateManager::QueryGSM(const QueryDelegate& Callback)
 	GSMQuery.constraint = GSMConstraint;
 	GSMQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
 
-	Worker_RequestId RequestID;
-	RequestID = NetDriver->Connection->SendEntityQueryRequest(&GSMQuery);
-
 	EntityQueryDelegate GSMQueryDelegate;
 	GSMQueryDelegate.BindLambda([this, Callback](const Worker_EntityQueryResponseOp& Op)
 	{
@@ -467,7 +504,8 @@ void UGlobalStateManager::QueryGSM(const QueryDelegate& Callback)
 		}
 	});
 
-	Receiver->AddEntityQueryDelegate(RequestID, GSMQueryDelegate);
+	// Shares the response with identical queries in flight, such as from a retry timer firing before the previous query returned.
+	Receiver->SendEntityQuery(GSMQuery, GSMQueryDelegate);
 }
 
 void UGlobalStateManager::QueryTranslation()
@@ -490,7 +528,6 @@ void UGlobalStateManager::QueryTranslation()
 	TranslationQuery.constraint = TranslationConstraint;
 	TranslationQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
 
-	Worker_RequestId RequestID = NetDriver->Connection->SendEntityQueryRequest(&TranslationQuery);
 	bTranslationQueryInFlight = true;
 
 	TWeakObjectPtr<UGlobalStateManager> WeakGlobalStateManager(this);
@@ -513,7 +550,7 @@ void UGlobalStateManager::QueryTranslation()
 		}
 		GlobalStateManager->bTranslationQueryInFlight = false;
 	});
-	Receiver->AddEntityQueryDelegate(RequestID, TranslationQueryDelegate);
+	Receiver->SendEntityQuery(TranslationQuery, TranslationQueryDelegate);
 }
 
 void UGlobalStateManager::ApplyVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op) const
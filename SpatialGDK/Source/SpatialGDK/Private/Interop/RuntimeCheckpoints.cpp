@@ -0,0 +1,494 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/RuntimeCheckpoints.h"
+
+#include "Containers/Queue.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SpatialThreadPolicy.h"
+
+DEFINE_LOG_CATEGORY(LogRuntimeCheckpoints);
+
+namespace SpatialGDK
+{
+
+class FCheckpointWriter : public FRunnable
+{
+public:
+	explicit FCheckpointWriter(TUniquePtr<FCheckpointStorage> InStorage)
+		: Storage(MoveTemp(InStorage))
+		, WorkEvent(FPlatformProcess::GetSynchEventFromPool())
+	{
+		Thread = CreateThreadWithPolicy(this, TEXT("SpatialCheckpointWriter"), TPri_BelowNormal);
+	}
+
+	virtual ~FCheckpointWriter()
+	{
+		// Run writes out every queued chunk before returning.
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	}
+
+	void Enqueue(TUniquePtr<FCheckpointChunk> Chunk)
+	{
+		NumQueuedChunks.Increment();
+		Chunks.Enqueue(MoveTemp(Chunk));
+		WorkEvent->Trigger();
+	}
+
+	int32 GetNumQueuedChunks() const { return NumQueuedChunks.GetValue(); }
+
+	// Begin FRunnable Interface
+	virtual uint32 Run() override
+	{
+		while (true)
+		{
+			TUniquePtr<FCheckpointChunk> Chunk;
+			while (Chunks.Dequeue(Chunk))
+			{
+				if (!Storage->WriteChunk(*Chunk))
+				{
+					UE_LOG(LogRuntimeCheckpoints, Warning, TEXT("Failed to write checkpoint chunk %llu with %d entities."), Chunk->Sequence, Chunk->Entities.Num());
+				}
+				Chunk.Reset();
+				NumQueuedChunks.Decrement();
+			}
+
+			if (bStopping)
+			{
+				return 0;
+			}
+
+			WorkEvent->Wait(100);
+		}
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		WorkEvent->Trigger();
+	}
+	// End FRunnable Interface
+
+private:
+	TUniquePtr<FCheckpointStorage> Storage;
+	TQueue<TUniquePtr<FCheckpointChunk>, EQueueMode::Spsc> Chunks;
+	FThreadSafeCounter NumQueuedChunks;
+	FEvent* WorkEvent;
+	FThreadSafeBool bStopping;
+	FRunnableThread* Thread = nullptr;
+};
+
+FFileCheckpointStorage::FFileCheckpointStorage(const FString& InDirectory, const FString& InWriterName)
+	: Directory(InDirectory)
+	, WriterName(FPaths::MakeValidFileName(InWriterName))
+{
+	IFileManager::Get().MakeDirectory(*Directory, /* Tree */ true);
+}
+
+FString FFileCheckpointStorage::GetDefaultDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SpatialCheckpoints"));
+}
+
+bool FFileCheckpointStorage::WriteChunk(const FCheckpointChunk& Chunk)
+{
+	// The timestamp comes first so that the files sort in the order the chunks were made, across every worker.
+	const FString BasePath = FPaths::Combine(Directory, FString::Printf(TEXT("%020lld_%s_%llu"), Chunk.TimestampTicks, *WriterName, Chunk.Sequence));
+
+	if (Chunk.DeletedEntityIds.Num() > 0)
+	{
+		FString DeletedEntities;
+		for (Worker_EntityId EntityId : Chunk.DeletedEntityIds)
+		{
+			DeletedEntities += FString::Printf(TEXT("%lld") LINE_TERMINATOR, EntityId);
+		}
+		if (!FFileHelper::SaveStringToFile(DeletedEntities, *(BasePath + TEXT(".deleted"))))
+		{
+			return false;
+		}
+	}
+
+	if (Chunk.Entities.Num() == 0)
+	{
+		return true;
+	}
+
+	Worker_ComponentVtable DefaultVtable{};
+	Worker_SnapshotParameters Parameters{};
+	Parameters.default_component_vtable = &DefaultVtable;
+
+	// Written under a temporary name, so that a restore never reads a partially written chunk.
+	const FString TempPath = BasePath + TEXT(".snapshot.tmp");
+	Worker_SnapshotOutputStream* OutputStream = Worker_SnapshotOutputStream_Create(TCHAR_TO_UTF8(*TempPath), &Parameters);
+	bool bSuccess = Worker_SnapshotOutputStream_GetState(OutputStream).stream_state == WORKER_STREAM_STATE_GOOD;
+
+	TArray<Worker_ComponentData> Components;
+	for (int32 i = 0; bSuccess && i < Chunk.Entities.Num(); i++)
+	{
+		const FCheckpointEntity& CheckpointEntity = Chunk.Entities[i];
+
+		Components.Reset(CheckpointEntity.Components.Num());
+		for (const ComponentData& Component : CheckpointEntity.Components)
+		{
+			Worker_ComponentData& Data = Components.AddZeroed_GetRef();
+			Data.component_id = Component.GetComponentId();
+			Data.schema_type = Component.GetUnderlying();
+		}
+
+		Worker_Entity Entity;
+		Entity.entity_id = CheckpointEntity.EntityId;
+		Entity.component_count = Components.Num();
+		Entity.components = Components.GetData();
+
+		Worker_SnapshotOutputStream_WriteEntity(OutputStream, &Entity);
+		bSuccess = Worker_SnapshotOutputStream_GetState(OutputStream).stream_state == WORKER_STREAM_STATE_GOOD;
+	}
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogRuntimeCheckpoints, Error, TEXT("Error writing checkpoint chunk '%s': %s"), *TempPath, UTF8_TO_TCHAR(Worker_SnapshotOutputStream_GetState(OutputStream).error_message));
+	}
+	Worker_SnapshotOutputStream_Destroy(OutputStream);
+
+	return bSuccess && IFileManager::Get().Move(*(BasePath + TEXT(".snapshot")), *TempPath);
+}
+
+void FFileCheckpointStorage::FindChunks(const FString& Directory, TArray<FString>& OutSnapshotPaths, TSet<Worker_EntityId>& OutDeletedEntityIds)
+{
+	TArray<FString> SnapshotFiles;
+	IFileManager::Get().FindFiles(SnapshotFiles, *FPaths::Combine(Directory, TEXT("*.snapshot")), /* Files */ true, /* Directories */ false);
+	SnapshotFiles.Sort([](const FString& A, const FString& B)
+	{
+		return A > B;
+	});
+
+	OutSnapshotPaths.Reset(SnapshotFiles.Num());
+	for (const FString& SnapshotFile : SnapshotFiles)
+	{
+		OutSnapshotPaths.Add(FPaths::Combine(Directory, SnapshotFile));
+	}
+
+	TArray<FString> DeletedFiles;
+	IFileManager::Get().FindFiles(DeletedFiles, *FPaths::Combine(Directory, TEXT("*.deleted")), /* Files */ true, /* Directories */ false);
+	for (const FString& DeletedFile : DeletedFiles)
+	{
+		TArray<FString> Lines;
+		FFileHelper::LoadFileToStringArray(Lines, *FPaths::Combine(Directory, DeletedFile));
+		for (const FString& Line : Lines)
+		{
+			if (!Line.IsEmpty())
+			{
+				OutDeletedEntityIds.Add(FCString::Atoi64(*Line));
+			}
+		}
+	}
+}
+
+FCheckpointRestoreFilter::FCheckpointRestoreFilter(TSet<Worker_EntityId>&& InDeletedEntityIds)
+	: SkippedEntityIds(MoveTemp(InDeletedEntityIds))
+{
+}
+
+bool FCheckpointRestoreFilter::ShouldRestore(Worker_EntityId EntityId)
+{
+	bool bAlreadySkipped = false;
+	SkippedEntityIds.Add(EntityId, &bAlreadySkipped);
+	return !bAlreadySkipped;
+}
+
+FRuntimeCheckpointer::FRuntimeCheckpointer(TUniquePtr<FCheckpointStorage> InStorage, float InIntervalSeconds, int32 InChunkSize, float InMaxEntitiesPerSecond)
+	: Writer(MakeUnique<FCheckpointWriter>(MoveTemp(InStorage)))
+	, IntervalSeconds(FMath::Max(InIntervalSeconds, 0.f))
+	, ChunkSize(FMath::Max(InChunkSize, 1))
+	, MaxEntitiesPerSecond(FMath::Max(InMaxEntitiesPerSecond, 1.f))
+{
+	// The first checkpoint is made once the worker has had an interval to gain authority.
+	TimeOfLastCheckpoint = FPlatformTime::Seconds();
+	TimeOfLastTick = TimeOfLastCheckpoint;
+}
+
+FRuntimeCheckpointer::~FRuntimeCheckpointer()
+{
+	SubmitChunk();
+}
+
+void FRuntimeCheckpointer::RecordReceivedOp(const Worker_Op& Op)
+{
+	switch (Op.op_type)
+	{
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		Entities.Add(Op.op.add_entity.entity_id);
+		AddedEntityIds.Add(Op.op.add_entity.entity_id);
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		// Leaving the view isn't a deletion, the entity is still in the last checkpoint it was written to.
+		Entities.Remove(Op.op.remove_entity.entity_id);
+		break;
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		if (FEntityRecord* Entity = Entities.Find(Op.op.add_component.entity_id))
+		{
+			SetComponentData(*Entity, Op.op.add_component.data.component_id, Op.op.add_component.data.schema_type);
+		}
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		RemoveComponent(Op.op.remove_component.entity_id, Op.op.remove_component.component_id);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		if (FEntityRecord* Entity = Entities.Find(Op.op.component_update.entity_id))
+		{
+			ApplyComponentUpdate(*Entity, Op.op.component_update.update.component_id, Op.op.component_update.update.schema_type);
+		}
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		if (Op.op.authority_change.component_id != SpatialConstants::POSITION_COMPONENT_ID)
+		{
+			break;
+		}
+		if (FEntityRecord* Entity = Entities.Find(Op.op.authority_change.entity_id))
+		{
+			if (Op.op.authority_change.authority == WORKER_AUTHORITY_AUTHORITATIVE)
+			{
+				// Written by the next checkpoint, as the state may have changed since the previous owner last wrote it.
+				Entity->bAuthoritative = true;
+				MarkDirty(Op.op.authority_change.entity_id, *Entity);
+			}
+			else if (Op.op.authority_change.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+			{
+				Entity->bAuthoritative = false;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+void FRuntimeCheckpointer::RecordSentAddComponent(Worker_EntityId EntityId, const Worker_ComponentData& Data)
+{
+	if (FEntityRecord* Entity = Entities.Find(EntityId))
+	{
+		SetComponentData(*Entity, Data.component_id, Data.schema_type);
+		MarkDirty(EntityId, *Entity);
+	}
+}
+
+void FRuntimeCheckpointer::RecordSentRemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	RemoveComponent(EntityId, ComponentId);
+	if (const FEntityRecord* Entity = Entities.Find(EntityId))
+	{
+		MarkDirty(EntityId, *Entity);
+	}
+}
+
+void FRuntimeCheckpointer::RecordSentComponentUpdate(Worker_EntityId EntityId, const Worker_ComponentUpdate& Update)
+{
+	if (FEntityRecord* Entity = Entities.Find(EntityId))
+	{
+		ApplyComponentUpdate(*Entity, Update.component_id, Update.schema_type);
+		MarkDirty(EntityId, *Entity);
+	}
+}
+
+void FRuntimeCheckpointer::RecordSentDeleteEntity(Worker_EntityId EntityId)
+{
+	const FEntityRecord* Entity = Entities.Find(EntityId);
+	if (Entity != nullptr && Entity->bPersistent)
+	{
+		DeletedEntityIds.Add(EntityId);
+		DirtyEntityIds.Remove(EntityId);
+	}
+}
+
+void FRuntimeCheckpointer::SetComponentData(FEntityRecord& Entity, Worker_ComponentId ComponentId, const Schema_ComponentData* Data)
+{
+	Entity.Components.Add(ComponentId, FComponentRecord{ ComponentData::CreateCopy(Data, ComponentId) });
+	if (ComponentId == SpatialConstants::PERSISTENCE_COMPONENT_ID)
+	{
+		Entity.bPersistent = true;
+	}
+}
+
+void FRuntimeCheckpointer::ApplyComponentUpdate(FEntityRecord& Entity, Worker_ComponentId ComponentId, Schema_ComponentUpdate* Update)
+{
+	FComponentRecord* Component = Entity.Components.Find(ComponentId);
+	if (Component == nullptr || Update == nullptr)
+	{
+		return;
+	}
+
+	if (Schema_ApplyComponentUpdateToData(Update, Component->Data.GetUnderlying()) == 0)
+	{
+		UE_LOG(LogRuntimeCheckpoints, Warning, TEXT("Failed to apply an update of component %d to its checkpoint data."), ComponentId);
+		return;
+	}
+
+	if (++Component->NumUpdatesApplied >= MaxUpdatesBeforeCompaction)
+	{
+		Component->Data = Component->Data.DeepCopy();
+		Component->NumUpdatesApplied = 0;
+	}
+}
+
+void FRuntimeCheckpointer::RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	FEntityRecord* Entity = Entities.Find(EntityId);
+	if (Entity == nullptr)
+	{
+		return;
+	}
+
+	Entity->Components.Remove(ComponentId);
+	if (ComponentId == SpatialConstants::PERSISTENCE_COMPONENT_ID)
+	{
+		// No longer persistent, so it's left out of a restore like a deleted entity.
+		if (Entity->bAuthoritative)
+		{
+			DeletedEntityIds.Add(EntityId);
+		}
+		DirtyEntityIds.Remove(EntityId);
+		Entities.Remove(EntityId);
+	}
+}
+
+void FRuntimeCheckpointer::MarkDirty(Worker_EntityId EntityId, const FEntityRecord& Entity)
+{
+	if (Entity.bPersistent && Entity.bAuthoritative)
+	{
+		DirtyEntityIds.Add(EntityId);
+	}
+}
+
+void FRuntimeCheckpointer::Tick(double Now)
+{
+	// Persistence is added with the rest of an entity's components, so anything without it by now isn't kept.
+	for (Worker_EntityId EntityId : AddedEntityIds)
+	{
+		const FEntityRecord* Entity = Entities.Find(EntityId);
+		if (Entity != nullptr && !Entity->bPersistent)
+		{
+			Entities.Remove(EntityId);
+		}
+	}
+	AddedEntityIds.Reset();
+
+	// Allow up to a second's worth of entities to build up, so a frame never copies more than that.
+	EntityAllowance = FMath::Min(EntityAllowance + MaxEntitiesPerSecond * static_cast<float>(Now - TimeOfLastTick), MaxEntitiesPerSecond);
+	TimeOfLastTick = Now;
+
+	if (!bCheckpointInProgress && (bCheckpointRequested || Now - TimeOfLastCheckpoint >= IntervalSeconds))
+	{
+		bCheckpointRequested = false;
+		TimeOfLastCheckpoint = Now;
+
+		if (DirtyEntityIds.Num() > 0 || DeletedEntityIds.Num() > 0)
+		{
+			// Entities dirtied from now on are written by the next checkpoint.
+			CheckpointEntityIds.Reset(DirtyEntityIds.Num());
+			for (Worker_EntityId_Key EntityId : DirtyEntityIds)
+			{
+				CheckpointEntityIds.Add(EntityId);
+			}
+			DirtyEntityIds.Reset();
+			NextCheckpointEntity = 0;
+			bCheckpointInProgress = true;
+		}
+	}
+
+	if (!bCheckpointInProgress)
+	{
+		return;
+	}
+
+	while (NextCheckpointEntity < CheckpointEntityIds.Num() && EntityAllowance >= 1.f && Writer->GetNumQueuedChunks() < MaxQueuedChunks)
+	{
+		const Worker_EntityId EntityId = CheckpointEntityIds[NextCheckpointEntity++];
+
+		// Entities that left the view, or this worker's authority, since they were dirtied are written by their new owner.
+		const FEntityRecord* Entity = Entities.Find(EntityId);
+		if (Entity == nullptr || !Entity->bAuthoritative)
+		{
+			continue;
+		}
+
+		CopyEntity(EntityId, *Entity);
+		EntityAllowance -= 1.f;
+
+		if (CurrentChunk->Entities.Num() >= ChunkSize)
+		{
+			SubmitChunk();
+		}
+	}
+
+	if (NextCheckpointEntity == CheckpointEntityIds.Num())
+	{
+		if (DeletedEntityIds.Num() > 0)
+		{
+			if (!CurrentChunk.IsValid())
+			{
+				CurrentChunk = MakeUnique<FCheckpointChunk>();
+			}
+			CurrentChunk->DeletedEntityIds = MoveTemp(DeletedEntityIds);
+			DeletedEntityIds.Reset();
+		}
+		SubmitChunk();
+
+		UE_LOG(LogRuntimeCheckpoints, Verbose, TEXT("Finished copying checkpoint of %d entities."), CheckpointEntityIds.Num());
+		CheckpointEntityIds.Reset();
+		NextCheckpointEntity = 0;
+		bCheckpointInProgress = false;
+	}
+}
+
+void FRuntimeCheckpointer::CopyEntity(Worker_EntityId EntityId, const FEntityRecord& Entity)
+{
+	if (!CurrentChunk.IsValid())
+	{
+		CurrentChunk = MakeUnique<FCheckpointChunk>();
+		CurrentChunk->Entities.Reserve(ChunkSize);
+	}
+
+	FCheckpointEntity& CheckpointEntity = CurrentChunk->Entities.AddDefaulted_GetRef();
+	CheckpointEntity.EntityId = EntityId;
+	CheckpointEntity.Components.Reserve(Entity.Components.Num());
+	for (const TPair<Worker_ComponentId, FComponentRecord>& Component : Entity.Components)
+	{
+		CheckpointEntity.Components.Add(Component.Value.Data.DeepCopy());
+	}
+}
+
+void FRuntimeCheckpointer::SubmitChunk()
+{
+	if (!CurrentChunk.IsValid())
+	{
+		return;
+	}
+
+	CurrentChunk->TimestampTicks = FDateTime::UtcNow().GetTicks();
+	CurrentChunk->Sequence = NextChunkSequence++;
+	Writer->Enqueue(MoveTemp(CurrentChunk));
+	CurrentChunk.Reset();
+}
+
+void FRuntimeCheckpointer::WaitForPendingWrites()
+{
+	while (Writer->GetNumQueuedChunks() > 0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+}
+
+} // namespace SpatialGDK
@@ -5,7 +5,9 @@
 #include "AssetRegistryModule.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Engine.h"
+#include "Engine/Level.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/GameModeBase.h"
 #include "Misc/MessageDialog.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "UObject/Class.h"
@@ -19,15 +21,33 @@
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "LoadBalancing/AbstractLBStrategy.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/GeneratedSerializers.h"
 #include "Utils/RepLayoutUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialClassInfoManager);
 
+DECLARE_CYCLE_STAT(TEXT("ClassInfoManager CreateClassInfo"), STAT_ClassInfoManagerCreateClassInfo, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("ClassInfoManager PrewarmClassInfo"), STAT_ClassInfoManagerPrewarmClassInfo, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Lazily built class infos"), STAT_ClassInfoManagerLazilyBuiltClassInfos, STATGROUP_SpatialNet);
+
 bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver)
 {
 	check(InNetDriver != nullptr);
 	NetDriver = InNetDriver;
 
+	// Already loaded when this was kept from the previous map, see bKeepClientConnectionAcrossTravel.
+	if (SchemaDatabase != nullptr)
+	{
+		return true;
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bUseCompactSchemaDatabase && TryLoadCompactSchemaDatabase())
+	{
+		ComponentClassification.AddGeneratedComponents(*SchemaDatabase);
+		return true;
+	}
+
 	FSoftObjectPath SchemaDatabasePath = FSoftObjectPath(FPaths::SetExtension(SpatialConstants::SCHEMA_DATABASE_ASSET_PATH, TEXT(".SchemaDatabase")));
 	SchemaDatabase = Cast<USchemaDatabase>(SchemaDatabasePath.TryLoad());
 
@@ -38,9 +58,78 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver)
 		return false;
 	}
 
+	ComponentClassification.AddGeneratedComponents(*SchemaDatabase);
+
+	return true;
+}
+
+bool USpatialClassInfoManager::TryLoadCompactSchemaDatabase()
+{
+	const FString Filename = SpatialGDK::FCompactSchemaDatabase::GetFilePath();
+
+	TSharedPtr<const SpatialGDK::FCompactSchemaDatabase, ESPMode::ThreadSafe> LoadedDatabase = SpatialGDK::FCompactSchemaDatabase::LoadShared(Filename);
+	if (!LoadedDatabase.IsValid())
+	{
+		UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Compact schema database could not be loaded from %s. Falling back to the SchemaDatabase asset."), *Filename);
+		return false;
+	}
+
+	// The per-class maps of this database are filled in as classes are looked up.
+	SchemaDatabase = NewObject<USchemaDatabase>(this);
+	LoadedDatabase->ReadTables(*SchemaDatabase);
+	CompactSchemaDatabase = MoveTemp(LoadedDatabase);
+
 	return true;
 }
 
+const FActorSchemaData* USpatialClassInfoManager::FindActorSchemaData(const FString& ClassPath) const
+{
+	if (const FActorSchemaData* SchemaData = SchemaDatabase->ActorClassPathToSchema.Find(ClassPath))
+	{
+		return SchemaData;
+	}
+
+	FActorSchemaData SchemaData;
+	if (CompactSchemaDatabase.IsValid() && CompactSchemaDatabase->FindActorSchema(ClassPath, SchemaData))
+	{
+		return &SchemaDatabase->ActorClassPathToSchema.Add(ClassPath, MoveTemp(SchemaData));
+	}
+
+	return nullptr;
+}
+
+const FSubobjectSchemaData* USpatialClassInfoManager::FindSubobjectSchemaData(const FString& ClassPath) const
+{
+	if (const FSubobjectSchemaData* SchemaData = SchemaDatabase->SubobjectClassPathToSchema.Find(ClassPath))
+	{
+		return SchemaData;
+	}
+
+	FSubobjectSchemaData SchemaData;
+	if (CompactSchemaDatabase.IsValid() && CompactSchemaDatabase->FindSubobjectSchema(ClassPath, SchemaData))
+	{
+		return &SchemaDatabase->SubobjectClassPathToSchema.Add(ClassPath, MoveTemp(SchemaData));
+	}
+
+	return nullptr;
+}
+
+const FString* USpatialClassInfoManager::FindClassPathForComponentId(Worker_ComponentId ComponentId) const
+{
+	if (const FString* ClassPath = SchemaDatabase->ComponentIdToClassPath.Find(ComponentId))
+	{
+		return ClassPath;
+	}
+
+	FString ClassPath;
+	if (CompactSchemaDatabase.IsValid() && CompactSchemaDatabase->FindClassPathForComponentId(ComponentId, ClassPath))
+	{
+		return &SchemaDatabase->ComponentIdToClassPath.Add(ComponentId, MoveTemp(ClassPath));
+	}
+
+	return nullptr;
+}
+
 bool USpatialClassInfoManager::ValidateOrExit_IsSupportedClass(const FString& PathName)
 {
 	if (!IsSupportedClass(PathName))
@@ -106,6 +195,8 @@ ERPCType GetRPCType(UFunction* RemoteFunction)
 
 void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ClassInfoManagerCreateClassInfo);
+
 	// Remove PIE prefix on class if it exists to properly look up the class.
 	FString ClassPath = Class->GetPathName();
 	GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
@@ -119,7 +210,15 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		return;
 	}
 
+	if (bClassInfoPrewarmQueued && !bIsPrewarmingClassInfo)
+	{
+		INC_DWORD_STAT(STAT_ClassInfoManagerLazilyBuiltClassInfos);
+		LazilyBuiltClassPaths.Add(ClassPath);
+		UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Building class info for %s on demand. Add it to ClassInfoPrewarmClasses to build it when the map loads instead."), *ClassPath);
+	}
+
 	TArray<UFunction*> RelevantClassFunctions = SpatialGDK::GetClassRPCFunctions(Class);
+	const TArray<FName>& LatencyCriticalRPCs = GetDefault<USpatialGDKSettings>()->LatencyCriticalRPCs;
 
 	for (UFunction* RemoteFunction : RelevantClassFunctions)
 	{
@@ -131,6 +230,7 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 
 		// Index is guaranteed to be the same on Clients & Servers since we process remote functions in the same order.
 		RPCInfo.Index = Info->RPCs.Num();
+		RPCInfo.bLatencyCritical = LatencyCriticalRPCs.Contains(RemoteFunction->GetFName());
 
 		Info->RPCs.Add(RemoteFunction);
 		Info->RPCInfoMap.Add(RemoteFunction, RPCInfo);
@@ -168,6 +268,18 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		}
 	}
 
+	if (TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(Class))
+	{
+		Info->ReplicationPlan = SpatialGDK::CompileReplicationPlan(*RepLayout);
+		SpatialGDK::FGeneratedSerializerRegistry::Get().ApplyToReplicationPlan(*Class, *RepLayout, Info->ReplicationPlan);
+	}
+
+	if (const FCompressedFieldsSchemaData* CompressedFields = SchemaDatabase->ClassPathToCompressedFields.Find(ClassPath))
+	{
+		Info->CompressedFieldIds.Append(CompressedFields->ReplicatedFieldIds);
+		Info->CompressedHandoverFieldIds.Append(CompressedFields->HandoverFieldIds);
+	}
+
 	if (Class->IsChildOf<AActor>())
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
@@ -180,9 +292,12 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 
 void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
+	// Copied, since creating class infos for subobjects below may add entries to the schema database maps.
+	const FActorSchemaData ActorSchemaData = *FindActorSchemaData(ClassPath);
+
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
 	{
-		Worker_ComponentId ComponentId = SchemaDatabase->ActorClassPathToSchema[ClassPath].SchemaComponents[Type];
+		Worker_ComponentId ComponentId = ActorSchemaData.SchemaComponents[Type];
 
 		if (!ShouldTrackHandoverProperties() && Type == SCHEMA_Handover)
 		{
@@ -198,7 +313,7 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 		}
 	});
 
-	for (auto& SubobjectClassDataPair : SchemaDatabase->ActorClassPathToSchema[ClassPath].SubobjectData)
+	for (const auto& SubobjectClassDataPair : ActorSchemaData.SubobjectData)
 	{
 		int32 Offset = SubobjectClassDataPair.Key;
 		FActorSpecificSubobjectSchemaData SubobjectSchemaData = SubobjectClassDataPair.Value;
@@ -235,11 +350,18 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 
 		Info->SubobjectInfo.Add(Offset, ActorSubobjectInfo);
 	}
+
+	Info->bIsSimpleActor = IsSimpleActorClass(*Info);
+}
+
+bool USpatialClassInfoManager::IsSimpleActorClass(const FClassInfo& Info)
+{
+	return Info.SubobjectInfo.Num() == 0 && Info.HandoverProperties.Num() == 0 && Info.RPCs.Num() == 0;
 }
 
 void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
-	for (const auto& DynamicSubobjectData : SchemaDatabase->SubobjectClassPathToSchema[ClassPath].DynamicSubobjectComponents)
+	for (const auto& DynamicSubobjectData : FindSubobjectSchemaData(ClassPath)->DynamicSubobjectComponents)
 	{
 		// Make a copy of the already made FClassInfo for this dynamic subobject
 		TSharedRef<FClassInfo> SpecificDynamicSubobjectInfo = MakeShared<FClassInfo>(Info.Get());
@@ -283,7 +405,7 @@ bool USpatialClassInfoManager::ShouldTrackHandoverProperties() const
 
 void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId)
 {
-	if (FString* ClassPath = SchemaDatabase->ComponentIdToClassPath.Find(ComponentId))
+	if (const FString* ClassPath = FindClassPathForComponentId(ComponentId))
 	{
 		if (UClass* Class = LoadObject<UClass>(nullptr, **ClassPath))
 		{
@@ -294,7 +416,7 @@ void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_Component
 
 bool USpatialClassInfoManager::IsSupportedClass(const FString& PathName) const
 {
-	return SchemaDatabase->ActorClassPathToSchema.Contains(PathName) || SchemaDatabase->SubobjectClassPathToSchema.Contains(PathName);
+	return FindActorSchemaData(PathName) != nullptr || FindSubobjectSchemaData(PathName) != nullptr;
 }
 
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass* Class)
@@ -369,7 +491,7 @@ UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId Compo
 uint32 USpatialClassInfoManager::GetComponentIdForClass(const UClass& Class) const
 {
 	const FString ClassPath = Class.GetPathName();
-	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(Class.GetPathName()))
+	if (const FActorSchemaData* ActorSchemaData = FindActorSchemaData(ClassPath))
 	{
 		return ActorSchemaData->SchemaComponents[SCHEMA_Data];
 	}
@@ -410,6 +532,48 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 	return OutComponentIds;
 }
 
+TArray<Worker_ComponentId> USpatialClassInfoManager::GetDataComponentIdsForActorClassHierarchy(const UClass& BaseClass) const
+{
+	TSet<Worker_ComponentId> ComponentIds;
+
+	check(SchemaDatabase);
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		const UClass* Class = *It;
+		check(Class);
+		if (!Class->IsChildOf(&BaseClass))
+		{
+			continue;
+		}
+
+		const FActorSchemaData* ActorSchemaData = FindActorSchemaData(Class->GetPathName());
+		if (ActorSchemaData == nullptr)
+		{
+			continue;
+		}
+
+		ComponentIds.Add(ActorSchemaData->SchemaComponents[SCHEMA_Data]);
+
+		for (const auto& SubobjectClassDataPair : ActorSchemaData->SubobjectData)
+		{
+			const FActorSpecificSubobjectSchemaData& SubobjectSchemaData = SubobjectClassDataPair.Value;
+			ComponentIds.Add(SubobjectSchemaData.SchemaComponents[SCHEMA_Data]);
+
+			if (const FSubobjectSchemaData* SubobjectClassSchemaData = FindSubobjectSchemaData(SubobjectSchemaData.ClassPath))
+			{
+				for (const FDynamicSubobjectSchemaData& DynamicSubobjectData : SubobjectClassSchemaData->DynamicSubobjectComponents)
+				{
+					ComponentIds.Add(DynamicSubobjectData.SchemaComponents[SCHEMA_Data]);
+				}
+			}
+		}
+	}
+
+	// Classes without replicated properties have no data component.
+	ComponentIds.Remove(SpatialConstants::INVALID_COMPONENT_ID);
+
+	return ComponentIds.Array();
+}
 
 bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset)
 {
@@ -446,6 +610,12 @@ const FRPCInfo& USpatialClassInfoManager::GetRPCInfo(UObject* Object, UFunction*
 {
 	check(Object != nullptr && Function != nullptr);
 
+	const TPair<TWeakObjectPtr<UClass>, TWeakObjectPtr<UFunction>> CacheKey(Object->GetClass(), Function);
+	if (const FRPCInfo* CachedRPCInfo = RPCInfoCache.Find(CacheKey))
+	{
+		return *CachedRPCInfo;
+	}
+
 	const FClassInfo& Info = GetOrCreateClassInfoByObject(Object);
 	const FRPCInfo* RPCInfoPtr = Info.RPCInfoMap.Find(Function);
 
@@ -464,7 +634,7 @@ const FRPCInfo& USpatialClassInfoManager::GetRPCInfo(UObject* Object, UFunction*
 		}
 	}
 	check(RPCInfoPtr != nullptr);
-	return *RPCInfoPtr;
+	return RPCInfoCache.Add(CacheKey, *RPCInfoPtr);
 }
 
 Worker_ComponentId USpatialClassInfoManager::GetComponentIdFromLevelPath(const FString& LevelPath) const
@@ -549,7 +719,98 @@ bool USpatialClassInfoManager::IsNetCullDistanceComponent(Worker_ComponentId Com
 
 bool USpatialClassInfoManager::IsGeneratedQBIMarkerComponent(Worker_ComponentId ComponentId) const
 {
-	return IsSublevelComponent(ComponentId) || IsNetCullDistanceComponent(ComponentId);
+	return ComponentClassification.HasAnyTraits(ComponentId, SpatialConstants::COMPONENT_TRAIT_QBIMarker);
+}
+
+void USpatialClassInfoManager::QueueClassInfoPrewarm(UWorld* World)
+{
+	check(World != nullptr);
+
+	bClassInfoPrewarmQueued = true;
+
+	auto QueueClass = [this](UClass* Class)
+	{
+		if (Class == nullptr || ClassInfoMap.Contains(Class))
+		{
+			return;
+		}
+
+		// Unsupported classes would quit the game in CreateClassInfoForClass, so only classes in the schema database are queued.
+		FString ClassPath = Class->GetPathName();
+		GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
+		if (IsSupportedClass(ClassPath))
+		{
+			ClassesToPrewarm.AddUnique(Class);
+		}
+	};
+
+	for (ULevel* Level : World->GetLevels())
+	{
+		if (Level == nullptr)
+		{
+			continue;
+		}
+
+		for (AActor* Actor : Level->Actors)
+		{
+			if (Actor != nullptr && Actor->GetIsReplicated())
+			{
+				QueueClass(Actor->GetClass());
+			}
+		}
+	}
+
+	if (const AGameModeBase* GameMode = World->GetAuthGameMode())
+	{
+		QueueClass(GameMode->DefaultPawnClass);
+		QueueClass(GameMode->PlayerControllerClass);
+		QueueClass(GameMode->PlayerStateClass);
+		QueueClass(GameMode->GameStateClass);
+	}
+
+	for (const FSoftClassPath& ClassPath : GetDefault<USpatialGDKSettings>()->ClassInfoPrewarmClasses)
+	{
+		UClass* Class = ClassPath.ResolveClass();
+		if (Class == nullptr)
+		{
+			Class = ClassPath.TryLoadClass<UObject>();
+		}
+		QueueClass(Class);
+	}
+
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Queued %d classes for class info prewarming."), ClassesToPrewarm.Num());
+}
+
+void USpatialClassInfoManager::TickClassInfoPrewarm(float TimeBudgetMs)
+{
+	if (ClassesToPrewarm.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ClassInfoManagerPrewarmClassInfo);
+	TGuardValue<bool> PrewarmGuard(bIsPrewarmingClassInfo, true);
+
+	const double EndTime = FPlatformTime::Seconds() + TimeBudgetMs / 1000.0;
+	int32 NumProcessed = 0;
+
+	// At least one class is built per tick, so prewarming always finishes.
+	do
+	{
+		UClass* Class = ClassesToPrewarm[NumProcessed++].Get();
+		if (Class != nullptr && !ClassInfoMap.Contains(Class))
+		{
+			CreateClassInfoForClass(Class);
+		}
+	}
+	while (NumProcessed < ClassesToPrewarm.Num() && FPlatformTime::Seconds() < EndTime);
+
+	ClassesToPrewarm.RemoveAt(0, NumProcessed, false);
+
+	if (ClassesToPrewarm.Num() == 0)
+	{
+		UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Finished prewarming class info."));
+	}
 }
 
 void USpatialClassInfoManager::QuitGame()
@@ -2,10 +2,14 @@
 
 #include "Interop/SpatialDispatcher.h"
 
+#include "Interop/RuntimeCheckpoints.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Interop/SpatialWorkerFlags.h"
+#include "SpatialGDKSettings.h"
 #include "UObject/UObjectIterator.h"
+#include "Utils/HitchCapture.h"
+#include "Utils/OpProcessingBudget.h"
 #include "Utils/OpUtils.h"
 #include "Utils/SpatialMetrics.h"
 
@@ -27,106 +31,166 @@ void SpatialDispatcher::Init(USpatialReceiver* InReceiver, USpatialStaticCompone
 }
 
 void SpatialDispatcher::ProcessOps(Worker_OpList* OpList)
+{
+	ProcessOps(OpList, 0, 0.0, 0);
+}
+
+uint32 SpatialDispatcher::ProcessOps(Worker_OpList* OpList, uint32 FirstOpIndex, double EndTime, uint32 MaxOps)
 {
 	check(Receiver.IsValid());
 	check(StaticComponentView.IsValid());
 
-	for (size_t i = 0; i < OpList->op_count; ++i)
+	// The field IDs are parsed for the whole list, so only when starting on it.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (FirstOpIndex == 0 && (SpatialGDKSettings->bPrefetchComponentFieldIds || SpatialGDKSettings->bPredecodeOpsOnConnectionThread))
 	{
-		Worker_Op* Op = &OpList->ops[i];
+		Receiver->PrefetchComponentUpdateFieldIds(OpList);
+	}
+
+	const SpatialGDK::FOpProcessingBudget Budget(FirstOpIndex, EndTime, MaxOps);
+	uint32 OpIndex = FirstOpIndex;
+	for (; OpIndex < OpList->op_count; ++OpIndex)
+	{
+		if (Budget.ShouldStopBefore(OpIndex, bInCriticalSection))
+		{
+			break;
+		}
+
+		Worker_Op* Op = &OpList->ops[OpIndex];
 
 		if (OpsToSkip.Num() != 0 &&
-			OpsToSkip.Contains(Op))
+			OpsToSkip.Remove(Op) > 0)
 		{
-			OpsToSkip.Remove(Op);
 			continue;
 		}
 
+		if (bCountReceivedBytes)
+		{
+			CountReceivedBytes(Op);
+		}
+
+		if (HitchCapture != nullptr)
+		{
+			HitchCapture->RecordOp(*Op);
+		}
+
+		if (RuntimeCheckpointer != nullptr)
+		{
+			RuntimeCheckpointer->RecordReceivedOp(*Op);
+		}
+
 		if (IsExternalSchemaOp(Op))
 		{
 			ProcessExternalSchemaOp(Op);
 			continue;
 		}
 
-		switch (Op->op_type)
-		{
-		// Critical Section
-		case WORKER_OP_TYPE_CRITICAL_SECTION:
-			Receiver->OnCriticalSection(Op->op.critical_section.in_critical_section != 0);
-			break;
+		ProcessOp(Op);
+	}
 
-		// Entity Lifetime
-		case WORKER_OP_TYPE_ADD_ENTITY:
-			Receiver->OnAddEntity(Op->op.add_entity);
-			break;
-		case WORKER_OP_TYPE_REMOVE_ENTITY:
-			Receiver->OnRemoveEntity(Op->op.remove_entity);
-			StaticComponentView->OnRemoveEntity(Op->op.remove_entity.entity_id);
-			Receiver->DropQueuedRemoveComponentOpsForEntity(Op->op.remove_entity.entity_id);
-			break;
+	Receiver->FlushRemoveComponentOps();
+	Receiver->FlushRetryRPCs();
+	if (OpIndex == OpList->op_count)
+	{
+		Receiver->ClearPrefetchedFieldIds();
+	}
 
-		// Components
-		case WORKER_OP_TYPE_ADD_COMPONENT:
-			StaticComponentView->OnAddComponent(Op->op.add_component);
-			Receiver->OnAddComponent(Op->op.add_component);
-			break;
-		case WORKER_OP_TYPE_REMOVE_COMPONENT:
-			Receiver->OnRemoveComponent(Op->op.remove_component);
-			break;
-		case WORKER_OP_TYPE_COMPONENT_UPDATE:
-			StaticComponentView->OnComponentUpdate(Op->op.component_update);
-			Receiver->OnComponentUpdate(Op->op.component_update);
-			break;
+	return OpIndex;
+}
 
-		// Commands
-		case WORKER_OP_TYPE_COMMAND_REQUEST:
-			Receiver->OnCommandRequest(Op->op.command_request);
-			break;
-		case WORKER_OP_TYPE_COMMAND_RESPONSE:
-			Receiver->OnCommandResponse(Op->op.command_response);
-			break;
+void SpatialDispatcher::CountReceivedBytes(const Worker_Op* Op)
+{
+	if (Op->op_type == WORKER_OP_TYPE_ADD_COMPONENT && Op->op.add_component.data.schema_type != nullptr)
+	{
+		ReceivedBytes += Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Op->op.add_component.data.schema_type));
+	}
+	else if (Op->op_type == WORKER_OP_TYPE_COMPONENT_UPDATE && Op->op.component_update.update.schema_type != nullptr)
+	{
+		Schema_ComponentUpdate* Update = Op->op.component_update.update.schema_type;
+		ReceivedBytes += Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update));
+		ReceivedBytes += Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update));
+	}
+}
 
-		// Authority Change
-		case WORKER_OP_TYPE_AUTHORITY_CHANGE:
-			Receiver->OnAuthorityChange(Op->op.authority_change);
-			break;
+void SpatialDispatcher::ProcessOp(Worker_Op* Op)
+{
+	switch (Op->op_type)
+	{
+	// Critical Section
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+		bInCriticalSection = Op->op.critical_section.in_critical_section != 0;
+		Receiver->OnCriticalSection(bInCriticalSection);
+		break;
 
-		// World Command Responses
-		case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
-			Receiver->OnReserveEntityIdsResponse(Op->op.reserve_entity_ids_response);
-			break;
-		case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
-			Receiver->OnCreateEntityResponse(Op->op.create_entity_response);
-			break;
-		case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
-			break;
-		case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
-			Receiver->OnEntityQueryResponse(Op->op.entity_query_response);
-			break;
+	// Entity Lifetime
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		Receiver->OnAddEntity(Op->op.add_entity);
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		Receiver->OnRemoveEntity(Op->op.remove_entity);
+		StaticComponentView->OnRemoveEntity(Op->op.remove_entity.entity_id);
+		Receiver->DropQueuedRemoveComponentOpsForEntity(Op->op.remove_entity.entity_id);
+		break;
 
-		case WORKER_OP_TYPE_FLAG_UPDATE:
-			SpatialWorkerFlags->ApplyWorkerFlagUpdate(Op->op.flag_update);
-			break;
-		case WORKER_OP_TYPE_LOG_MESSAGE:
-			UE_LOG(LogSpatialView, Log, TEXT("SpatialOS Worker Log: %s"), UTF8_TO_TCHAR(Op->op.log_message.message));
-			break;
-		case WORKER_OP_TYPE_METRICS:
+	// Components
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		StaticComponentView->OnAddComponent(Op->op.add_component);
+		Receiver->OnAddComponent(Op->op.add_component);
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		Receiver->OnRemoveComponent(Op->op.remove_component);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		StaticComponentView->OnComponentUpdate(Op->op.component_update);
+		Receiver->OnComponentUpdate(Op->op.component_update);
+		break;
+
+	// Commands
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+		Receiver->OnCommandRequest(Op->op.command_request);
+		break;
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		Receiver->OnCommandResponse(Op->op.command_response);
+		break;
+
+	// Authority Change
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		Receiver->OnAuthorityChange(Op->op.authority_change);
+		break;
+
+	// World Command Responses
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+		Receiver->OnReserveEntityIdsResponse(Op->op.reserve_entity_ids_response);
+		break;
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+		Receiver->OnCreateEntityResponse(Op->op.create_entity_response);
+		break;
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+		Receiver->OnDeleteEntityResponse(Op->op.delete_entity_response);
+		break;
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+		Receiver->OnEntityQueryResponse(Op->op.entity_query_response);
+		break;
+
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		SpatialWorkerFlags->ApplyWorkerFlagUpdate(Op->op.flag_update);
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+		UE_LOG(LogSpatialView, Log, TEXT("SpatialOS Worker Log: %s"), UTF8_TO_TCHAR(Op->op.log_message.message));
+		break;
+	case WORKER_OP_TYPE_METRICS:
 #if !UE_BUILD_SHIPPING
-			check(SpatialMetrics.IsValid());
-			SpatialMetrics->HandleWorkerMetrics(Op);
+		check(SpatialMetrics.IsValid());
+		SpatialMetrics->HandleWorkerMetrics(Op);
 #endif
-			break;
-		case WORKER_OP_TYPE_DISCONNECT:
-			Receiver->OnDisconnect(Op->op.disconnect);
-			break;
+		break;
+	case WORKER_OP_TYPE_DISCONNECT:
+		Receiver->OnDisconnect(Op->op.disconnect);
+		break;
 
-		default:
-			break;
-		}
+	default:
+		break;
 	}
-
-	Receiver->FlushRemoveComponentOps();
-	Receiver->FlushRetryRPCs();
 }
 
 bool SpatialDispatcher::IsExternalSchemaOp(Worker_Op* Op) const
@@ -0,0 +1,221 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/SpatialFlatComponentStorage.h"
+
+namespace SpatialGDK
+{
+
+Component* FSpatialFlatComponentStorage::GetComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
+{
+	const int32 TypeIndex = GetHandwrittenComponentIndex(ComponentId);
+	if (TypeIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const int32 SlotIndex = FindSlot(EntityId);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return HandwrittenComponents[TypeIndex][SlotIndex].Get();
+}
+
+bool FSpatialFlatComponentStorage::HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
+{
+	const int32 SlotIndex = FindSlot(EntityId);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FComponentState* State = FindComponentState(SlotIndex, ComponentId);
+	return State != nullptr && State->bPresent;
+}
+
+Worker_Authority FSpatialFlatComponentStorage::GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
+{
+	const int32 SlotIndex = FindSlot(EntityId);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+	}
+
+	const FComponentState* State = FindComponentState(SlotIndex, ComponentId);
+	return State != nullptr ? State->Authority : WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+}
+
+void FSpatialFlatComponentStorage::AddComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId, TUniquePtr<Component> Data)
+{
+	const int32 SlotIndex = FindOrAddSlot(EntityId);
+
+	FindOrAddComponentState(SlotIndex, ComponentId).bPresent = true;
+	Slots[SlotIndex].bHasAddedComponent = true;
+
+	const int32 TypeIndex = GetHandwrittenComponentIndex(ComponentId);
+	if (TypeIndex != INDEX_NONE)
+	{
+		HandwrittenComponents[TypeIndex][SlotIndex] = MoveTemp(Data);
+	}
+}
+
+void FSpatialFlatComponentStorage::RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	const int32 SlotIndex = FindSlot(EntityId);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	for (FComponentState& State : Slots[SlotIndex].Components)
+	{
+		if (State.ComponentId == ComponentId)
+		{
+			State.bPresent = false;
+			break;
+		}
+	}
+
+	const int32 TypeIndex = GetHandwrittenComponentIndex(ComponentId);
+	if (TypeIndex != INDEX_NONE)
+	{
+		HandwrittenComponents[TypeIndex][SlotIndex].Reset();
+	}
+
+	// Authority is kept for entities still in view, matching the map based storage which only drops it on entity removal.
+}
+
+void FSpatialFlatComponentStorage::RemoveEntity(Worker_EntityId EntityId)
+{
+	int32 SlotIndex;
+	if (!EntityToSlot.RemoveAndCopyValue(EntityId, SlotIndex))
+	{
+		return;
+	}
+
+	// Move the last slot into the removed one, so the per type arrays stay dense.
+	const int32 LastSlotIndex = Slots.Num() - 1;
+	if (SlotIndex != LastSlotIndex)
+	{
+		EntityToSlot[Slots[LastSlotIndex].EntityId] = SlotIndex;
+	}
+
+	for (TArray<TUniquePtr<Component>>& ComponentArray : HandwrittenComponents)
+	{
+		ComponentArray.RemoveAtSwap(SlotIndex, 1, /* bAllowShrinking */ false);
+	}
+	Slots.RemoveAtSwap(SlotIndex, 1, /* bAllowShrinking */ false);
+}
+
+void FSpatialFlatComponentStorage::SetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Worker_Authority Authority)
+{
+	const int32 SlotIndex = FindOrAddSlot(EntityId);
+	FindOrAddComponentState(SlotIndex, ComponentId).Authority = Authority;
+}
+
+void FSpatialFlatComponentStorage::GetEntityIds(TArray<Worker_EntityId_Key>& OutEntityIds) const
+{
+	OutEntityIds.Reset(EntityToSlot.Num());
+	for (const FEntitySlot& Slot : Slots)
+	{
+		if (Slot.bHasAddedComponent)
+		{
+			OutEntityIds.Add(Slot.EntityId);
+		}
+	}
+}
+
+int32 FSpatialFlatComponentStorage::GetNumEntities() const
+{
+	int32 NumEntities = 0;
+	for (const FEntitySlot& Slot : Slots)
+	{
+		if (Slot.bHasAddedComponent)
+		{
+			NumEntities++;
+		}
+	}
+	return NumEntities;
+}
+
+void FSpatialFlatComponentStorage::GetComponentCounts(TMap<Worker_ComponentId, int32>& OutCounts) const
+{
+	for (const FEntitySlot& Slot : Slots)
+	{
+		for (const FComponentState& State : Slot.Components)
+		{
+			if (State.bPresent)
+			{
+				OutCounts.FindOrAdd(State.ComponentId)++;
+			}
+		}
+	}
+}
+
+SIZE_T FSpatialFlatComponentStorage::GetAllocatedSize() const
+{
+	SIZE_T Size = EntityToSlot.GetAllocatedSize() + Slots.GetAllocatedSize();
+	for (const FEntitySlot& Slot : Slots)
+	{
+		Size += Slot.Components.GetAllocatedSize();
+	}
+	for (const TArray<TUniquePtr<Component>>& ComponentArray : HandwrittenComponents)
+	{
+		Size += ComponentArray.GetAllocatedSize();
+	}
+	return Size;
+}
+
+int32 FSpatialFlatComponentStorage::FindSlot(Worker_EntityId EntityId) const
+{
+	const int32* SlotIndex = EntityToSlot.Find(EntityId);
+	return SlotIndex != nullptr ? *SlotIndex : INDEX_NONE;
+}
+
+int32 FSpatialFlatComponentStorage::FindOrAddSlot(Worker_EntityId EntityId)
+{
+	if (const int32* ExistingSlotIndex = EntityToSlot.Find(EntityId))
+	{
+		return *ExistingSlotIndex;
+	}
+
+	const int32 SlotIndex = Slots.AddDefaulted();
+	for (TArray<TUniquePtr<Component>>& ComponentArray : HandwrittenComponents)
+	{
+		ComponentArray.AddDefaulted();
+	}
+
+	Slots[SlotIndex].EntityId = EntityId;
+	EntityToSlot.Add(EntityId, SlotIndex);
+	return SlotIndex;
+}
+
+const FSpatialFlatComponentStorage::FComponentState* FSpatialFlatComponentStorage::FindComponentState(int32 SlotIndex, Worker_ComponentId ComponentId) const
+{
+	for (const FComponentState& State : Slots[SlotIndex].Components)
+	{
+		if (State.ComponentId == ComponentId)
+		{
+			return &State;
+		}
+	}
+
+	return nullptr;
+}
+
+FSpatialFlatComponentStorage::FComponentState& FSpatialFlatComponentStorage::FindOrAddComponentState(int32 SlotIndex, Worker_ComponentId ComponentId)
+{
+	TArray<FComponentState>& Components = Slots[SlotIndex].Components;
+	for (FComponentState& State : Components)
+	{
+		if (State.ComponentId == ComponentId)
+		{
+			return State;
+		}
+	}
+
+	return Components.Add_GetRef(FComponentState{ ComponentId, WORKER_AUTHORITY_NOT_AUTHORITATIVE, false });
+}
+
+} // namespace SpatialGDK
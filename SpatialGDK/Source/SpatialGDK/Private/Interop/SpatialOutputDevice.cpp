@@ -10,10 +10,17 @@ FSpatialOutputDevice::FSpatialOutputDevice(USpatialWorkerConnection* InConnectio
 	, Connection(InConnection)
 	, LoggerName(InLoggerName)
 	, PIEIndex(InPIEIndex)
+	, MaxLinesPerBatch(FMath::Max(GetDefault<USpatialGDKSettings>()->MaxLogLinesPerBatch, 1u))
 {
 	const TCHAR* CommandLine = FCommandLine::Get();
 	bLogToSpatial = !FParse::Param(CommandLine, TEXT("NoLogToSpatial"));
 
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bAsyncLogForwarding)
+	{
+		LogQueue = MakeUnique<SpatialGDK::FLogForwardingQueue>(SpatialGDKSettings->MaxQueuedLogLines, SpatialGDKSettings->MaxForwardedLogLinesPerSecond, SpatialGDKSettings->LogCategorySampleRates);
+	}
+
 	FOutputDeviceRedirector::Get()->AddOutputDevice(this);
 }
 
@@ -38,10 +45,37 @@ void FSpatialOutputDevice::Serialize(const TCHAR* InData, ELogVerbosity::Type Ve
 			return;
 		}
 #endif //WITH_EDITOR
+		if (LogQueue.IsValid())
+		{
+			LogQueue->Enqueue(ConvertLogLevelToSpatial(Verbosity), Category, InData, FPlatformTime::Seconds());
+			return;
+		}
+
 		Connection->SendLogMessage(ConvertLogLevelToSpatial(Verbosity), LoggerName, InData);
 	}
 }
 
+void FSpatialOutputDevice::FlushQueuedLogs()
+{
+	if (!LogQueue.IsValid() || Connection == nullptr)
+	{
+		return;
+	}
+
+	TArray<SpatialGDK::FLogForwardingQueue::FLogBatch> Batches;
+	const uint32 NumDropped = LogQueue->Drain(MaxLinesPerBatch, Batches);
+
+	for (const SpatialGDK::FLogForwardingQueue::FLogBatch& Batch : Batches)
+	{
+		Connection->SendLogMessage(Batch.Level, LoggerName, *Batch.Message);
+	}
+
+	if (NumDropped > 0)
+	{
+		Connection->SendLogMessage(WORKER_LOG_LEVEL_WARN, LoggerName, *FString::Printf(TEXT("Dropped %u log lines that were sampled out, rate limited or did not fit in the log queue."), NumDropped));
+	}
+}
+
 void FSpatialOutputDevice::AddRedirectCategory(const FName& Category)
 {
 	CategoriesToRedirect.Add(Category);
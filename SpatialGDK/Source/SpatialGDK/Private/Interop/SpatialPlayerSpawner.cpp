@@ -38,6 +38,7 @@ void USpatialPlayerSpawner::Init(USpatialNetDriver* InNetDriver, FTimerManager*
 	TimerManager = InTimerManager;
 
 	NumberOfAttempts = 0;
+	LastSpawnRateReportTime = FPlatformTime::Seconds();
 }
 
 void USpatialPlayerSpawner::SendPlayerSpawnRequest()
@@ -51,10 +52,8 @@ void USpatialPlayerSpawner::SendPlayerSpawnRequest()
 	SpatialSpawnerQuery.constraint = SpatialSpawnerConstraint;
 	SpatialSpawnerQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
 
-	const Worker_RequestId RequestID = NetDriver->Connection->SendEntityQueryRequest(&SpatialSpawnerQuery);
-
 	EntityQueryDelegate SpatialSpawnerQueryDelegate;
-	SpatialSpawnerQueryDelegate.BindLambda([this, RequestID](const Worker_EntityQueryResponseOp& Op)
+	SpatialSpawnerQueryDelegate.BindLambda([this](const Worker_EntityQueryResponseOp& Op)
 	{
 		FString Reason;
 
@@ -71,6 +70,9 @@ void USpatialPlayerSpawner::SendPlayerSpawnRequest()
 			checkf(Op.result_count == 1, TEXT("There should never be more than one SpatialSpawner entity."));
 
 			SpatialGDK::SpawnPlayerRequest SpawnRequest = ObtainPlayerParams();
+			SpawnRequest.RejoinPreviousWorkerId = RejoinPreviousWorkerId;
+			SpawnRequest.RejoinPlayerControllerEntityId = RejoinPlayerControllerEntityId;
+			SpawnRequest.RejoinToken = RejoinPlayerControllerEntityId != SpatialConstants::INVALID_ENTITY_ID ? IssuedRejoinToken : FString();
 			Worker_CommandRequest SpawnPlayerCommandRequest = PlayerSpawner::CreatePlayerSpawnRequest(SpawnRequest);
 			NetDriver->Connection->SendCommandRequest(Op.results[0].entity_id, &SpawnPlayerCommandRequest, SpatialConstants::PLAYER_SPAWNER_SPAWN_PLAYER_COMMAND_ID);
 		}
@@ -83,7 +85,8 @@ void USpatialPlayerSpawner::SendPlayerSpawnRequest()
 	});
 
 	UE_LOG(LogSpatialPlayerSpawner, Log, TEXT("Sending player spawn request"));
-	NetDriver->Receiver->AddEntityQueryDelegate(RequestID, SpatialSpawnerQueryDelegate);
+	// The spawner entity is loaded from the snapshot and never moves, so retries can reuse a recent response.
+	NetDriver->Receiver->SendEntityQuery(SpatialSpawnerQuery, SpatialSpawnerQueryDelegate, SpatialConstants::PLAYER_SPAWNER_QUERY_CACHE_LIFETIME_SECONDS);
 
 	++NumberOfAttempts;
 }
@@ -143,11 +146,34 @@ SpatialGDK::SpawnPlayerRequest USpatialPlayerSpawner::ObtainPlayerParams() const
 	return { LoginURL, UniqueId, OnlinePlatformName, bIsSimulatedPlayer };
 }
 
+void USpatialPlayerSpawner::SetRejoinPlayerController(const PhysicalWorkerName& PreviousWorkerId, Worker_EntityId PlayerControllerEntityId)
+{
+	RejoinPreviousWorkerId = PreviousWorkerId;
+	RejoinPlayerControllerEntityId = PlayerControllerEntityId;
+	NumberOfAttempts = 0;
+}
+
 void USpatialPlayerSpawner::ReceivePlayerSpawnResponseOnClient(const Worker_CommandResponseOp& Op)
 {
 	if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
 	{
 		UE_LOG(LogSpatialPlayerSpawner, Display, TEXT("PlayerSpawn returned from server sucessfully"));
+
+		Schema_Object* ResponseObject = Schema_GetCommandResponseObject(Op.response.schema_type);
+		if (Schema_GetBytesCount(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOIN_TOKEN_ID) > 0)
+		{
+			IssuedRejoinToken = GetStringFromSchema(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOIN_TOKEN_ID);
+		}
+
+		if (RejoinPlayerControllerEntityId != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			const bool bRejoined = GetBoolFromSchema(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOINED_ID);
+
+			RejoinPreviousWorkerId.Empty();
+			RejoinPlayerControllerEntityId = SpatialConstants::INVALID_ENTITY_ID;
+
+			NetDriver->OnClientRejoinSpawnResponse(bRejoined);
+		}
 	}
 	else if (NumberOfAttempts < SpatialConstants::MAX_NUMBER_COMMAND_ATTEMPTS)
 	{
@@ -188,13 +214,66 @@ void USpatialPlayerSpawner::ReceivePlayerSpawnRequestOnServer(const Worker_Comma
 		return;
 	}
 
-	Schema_Object* RequestPayload = Schema_GetCommandRequestObject(Op.request.schema_type);
-	FindPlayerStartAndProcessPlayerSpawn(RequestPayload, ClientWorkerId);
+	FString RejoinToken;
+	if (GetDefault<USpatialGDKSettings>()->bEnableClientFastRejoin)
+	{
+		// Only sent to this worker, so only it can take its player controller back later.
+		RejoinToken = RejoinTokens.Issue(ClientWorkerId);
 
-	const Worker_CommandResponse Response = PlayerSpawner::CreatePlayerSpawnResponse();
+		// A client rejoining within the grace period is handed the player controller it had if it's still around on this server.
+		// Otherwise it spawns a new player like any other client.
+		const SpatialGDK::SpawnPlayerRequest SpawnRequest = PlayerSpawner::ExtractPlayerSpawnParams(Schema_GetCommandRequestObject(Op.request.schema_type));
+		if (SpawnRequest.RejoinPlayerControllerEntityId != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			if (!RejoinTokens.TryConsume(SpawnRequest.RejoinPreviousWorkerId, SpawnRequest.RejoinToken))
+			{
+				UE_LOG(LogSpatialPlayerSpawner, Warning, TEXT("Worker %s asked for the player controller of worker %s without its rejoin token, or before it disconnected. Spawning a new player."),
+					*ClientWorkerId, *SpawnRequest.RejoinPreviousWorkerId);
+			}
+			else if (NetDriver->RejoinClientConnection(SpawnRequest.RejoinPreviousWorkerId, SpawnRequest.RejoinPlayerControllerEntityId, ClientWorkerId))
+			{
+				const Worker_CommandResponse Response = PlayerSpawner::CreatePlayerSpawnResponse(/* bRejoined */ true, RejoinToken);
+				NetDriver->Connection->SendCommandResponse(Op.request_id, &Response);
+				return;
+			}
+		}
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bQueuePlayerSpawnRequests)
+	{
+		// The request is owned by the op list, so it's copied to be spawned on a later tick.
+		QueuedPlayerSpawnRequests.Add(FQueuedPlayerSpawnRequest{ ClientWorkerId, FCommandRequestPtr(Schema_CopyCommandRequest(Op.request.schema_type)) });
+	}
+	else
+	{
+		Schema_Object* RequestPayload = Schema_GetCommandRequestObject(Op.request.schema_type);
+		FindPlayerStartAndProcessPlayerSpawn(RequestPayload, ClientWorkerId);
+	}
+
+	const Worker_CommandResponse Response = PlayerSpawner::CreatePlayerSpawnResponse(/* bRejoined */ false, RejoinToken);
 	NetDriver->Connection->SendCommandResponse(Op.request_id, &Response);
 }
 
+void USpatialPlayerSpawner::OnClientWorkerDisconnected(const PhysicalWorkerName& ClientWorkerId)
+{
+	if (!GetDefault<USpatialGDKSettings>()->bEnableClientFastRejoin)
+	{
+		return;
+	}
+
+	RejoinTokens.OnWorkerDisconnected(ClientWorkerId);
+
+	// The connection of the worker is closed after the grace period, after which there's nothing left to rejoin.
+	FTimerHandle GracePeriodTimer;
+	TimerManager->SetTimer(GracePeriodTimer, [WeakThis = TWeakObjectPtr<USpatialPlayerSpawner>(this), ClientWorkerId]()
+	{
+		if (USpatialPlayerSpawner* Spawner = WeakThis.Get())
+		{
+			Spawner->RejoinTokens.Remove(ClientWorkerId);
+		}
+	}, GetDefault<USpatialGDKSettings>()->ClientRejoinGracePeriod, false);
+}
+
 void USpatialPlayerSpawner::FindPlayerStartAndProcessPlayerSpawn(Schema_Object* SpawnPlayerRequest, const PhysicalWorkerName& ClientWorkerId)
 {
 	// If the load balancing strategy dictates that this worker should have authority over the chosen PlayerStart THEN the spawn is handled locally,
@@ -211,9 +290,10 @@ void USpatialPlayerSpawner::FindPlayerStartAndProcessPlayerSpawn(Schema_Object*
 
 	// Find a PlayerStart Actor on this server.
 	AActor* PlayerStartActor = NetDriver->GetWorld()->GetAuthGameMode()->FindPlayerStart(nullptr, Url.Portal);
+	const FPlayerStartAuthority PlayerStartAuthority = PlayerStartActor != nullptr ? GetPlayerStartAuthority(*PlayerStartActor) : FPlayerStartAuthority{ false, SpatialConstants::INVALID_VIRTUAL_WORKER_ID };
 
 	// If the PlayerStart is authoritative locally, spawn the player locally.
-	if (PlayerStartActor != nullptr && NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*PlayerStartActor))
+	if (PlayerStartActor != nullptr && PlayerStartAuthority.bShouldHaveAuthority)
 	{
 		UE_LOG(LogSpatialPlayerSpawner, Verbose, TEXT("Handling SpawnPlayerRequest request locally. Client worker ID: %s."), *ClientWorkerId);
 		PassSpawnRequestToNetDriver(SpawnPlayerRequest, PlayerStartActor);
@@ -235,9 +315,9 @@ void USpatialPlayerSpawner::FindPlayerStartAndProcessPlayerSpawn(Schema_Object*
 			UE_LOG(LogSpatialPlayerSpawner, Error, TEXT("The server authoritative over the GameMode could not locate any PlayerStart, this is unsupported."));
 		}
 	}
-	else if (!NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*PlayerStartActor))
+	else
 	{
-		VirtualWorkerToForwardTo = NetDriver->LoadBalanceStrategy->WhoShouldHaveAuthority(*PlayerStartActor);
+		VirtualWorkerToForwardTo = PlayerStartAuthority.AuthoritativeVirtualWorker;
 		if (VirtualWorkerToForwardTo == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
 		{
 			UE_LOG(LogSpatialPlayerSpawner, Error, TEXT("Load-balance strategy returned invalid virtual worker ID for selected PlayerStart Actor: %s"),
@@ -266,6 +346,62 @@ void USpatialPlayerSpawner::PassSpawnRequestToNetDriver(const Schema_Object* Pla
 	GameMode->SetPrioritizedPlayerStart(PlayerStart);
 	NetDriver->AcceptNewPlayer(SpawnRequest.LoginURL, SpawnRequest.UniqueId, SpawnRequest.OnlinePlatformName);
 	GameMode->SetPrioritizedPlayerStart(nullptr);
+
+	NumPlayersSpawned++;
+}
+
+USpatialPlayerSpawner::FPlayerStartAuthority USpatialPlayerSpawner::GetPlayerStartAuthority(const AActor& PlayerStart)
+{
+	const bool bCanCache = !NetDriver->LoadBalanceStrategy->RequiresWorkerLoadReports();
+	if (bCanCache)
+	{
+		if (const FPlayerStartAuthority* CachedAuthority = PlayerStartAuthorityCache.Find(&PlayerStart))
+		{
+			return *CachedAuthority;
+		}
+	}
+
+	FPlayerStartAuthority Authority;
+	Authority.bShouldHaveAuthority = NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(PlayerStart);
+	Authority.AuthoritativeVirtualWorker = Authority.bShouldHaveAuthority ? NetDriver->LoadBalanceStrategy->GetLocalVirtualWorkerId() : NetDriver->LoadBalanceStrategy->WhoShouldHaveAuthority(PlayerStart);
+
+	// Strategies which aren't ready yet return an invalid worker, which shouldn't stick.
+	if (bCanCache && (Authority.bShouldHaveAuthority || Authority.AuthoritativeVirtualWorker != SpatialConstants::INVALID_VIRTUAL_WORKER_ID))
+	{
+		PlayerStartAuthorityCache.Add(&PlayerStart, Authority);
+	}
+
+	return Authority;
+}
+
+void USpatialPlayerSpawner::ProcessQueuedPlayerSpawnRequests()
+{
+	if (QueuedPlayerSpawnRequests.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 NumToProcess = FMath::Min(QueuedPlayerSpawnRequests.Num(), static_cast<int32>(GetDefault<USpatialGDKSettings>()->MaxPlayerSpawnsPerTick));
+	for (int32 i = 0; i < NumToProcess; i++)
+	{
+		FQueuedPlayerSpawnRequest& QueuedRequest = QueuedPlayerSpawnRequests[i];
+		FindPlayerStartAndProcessPlayerSpawn(Schema_GetCommandRequestObject(QueuedRequest.Request.Get()), QueuedRequest.ClientWorkerId);
+	}
+
+	QueuedPlayerSpawnRequests.RemoveAt(0, NumToProcess, false);
+
+	UE_CLOG(QueuedPlayerSpawnRequests.Num() > 0, LogSpatialPlayerSpawner, Verbose, TEXT("%d player spawn requests still queued."), QueuedPlayerSpawnRequests.Num());
+}
+
+double USpatialPlayerSpawner::GetPlayerSpawnsPerSecond()
+{
+	const double Now = FPlatformTime::Seconds();
+	const double Elapsed = Now - LastSpawnRateReportTime;
+	const double SpawnsPerSecond = Elapsed > 0.0 ? (NumPlayersSpawned - NumPlayersSpawnedAtLastReport) / Elapsed : 0.0;
+
+	NumPlayersSpawnedAtLastReport = NumPlayersSpawned;
+	LastSpawnRateReportTime = Now;
+	return SpawnsPerSecond;
 }
 
 void USpatialPlayerSpawner::ForwardSpawnRequestToStrategizedServer(const Schema_Object* OriginalPlayerSpawnRequest, AActor* PlayerStart, const PhysicalWorkerName& ClientWorkerId, const VirtualWorkerId SpawningVirtualWorker)
@@ -301,7 +437,7 @@ void USpatialPlayerSpawner::ForwardSpawnRequestToStrategizedServer(const Schema_
 
 	const Worker_RequestId RequestId = NetDriver->Connection->SendCommandRequest(ServerWorkerEntity, &ForwardSpawnPlayerRequest, SpatialConstants::SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID);
 
-	OutgoingForwardPlayerSpawnRequests.Add(RequestId, TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>(ForwardSpawnPlayerSchemaRequest));
+	OutgoingForwardPlayerSpawnRequests.Add(RequestId, FCommandRequestPtr(ForwardSpawnPlayerSchemaRequest));
 }
 
 void USpatialPlayerSpawner::ReceiveForwardedPlayerSpawnRequest(const Worker_CommandRequestOp& Op)
@@ -6,6 +6,7 @@
 #include "Schema/ClientEndpoint.h"
 #include "Schema/MulticastRPCs.h"
 #include "Schema/ServerEndpoint.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SpatialLatencyTracer.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialRPCService);
@@ -17,10 +18,11 @@ SpatialRPCService::SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, cons
 	: ExtractRPCCallback(ExtractRPCCallback)
 	, View(View)
 	, SpatialLatencyTracer(SpatialLatencyTracer)
+	, TimeSource([] { return FPlatformTime::Seconds(); })
 {
 }
 
-EPushRPCResult SpatialRPCService::PushRPC(Worker_EntityId EntityId, ERPCType Type, RPCPayload Payload, bool bCreatedEntity)
+EPushRPCResult SpatialRPCService::PushRPC(Worker_EntityId EntityId, ERPCType Type, const RPCPayload& Payload, bool bCreatedEntity)
 {
 	EntityRPCType EntityType = EntityRPCType(EntityId, Type);
 
@@ -29,16 +31,19 @@ EPushRPCResult SpatialRPCService::PushRPC(Worker_EntityId EntityId, ERPCType Typ
 	if (RPCRingBufferUtils::ShouldQueueOverflowed(Type) && OverflowedRPCs.Contains(EntityType))
 	{
 		// Already has queued RPCs of this type, queue until those are pushed.
-		AddOverflowedRPC(EntityType, MoveTemp(Payload));
-		Result = EPushRPCResult::QueueOverflowed;
+		Result = AddOverflowedRPC(EntityType, RPCPayload(Payload));
 	}
 	else
 	{
-		Result = PushRPCInternal(EntityId, Type, MoveTemp(Payload), bCreatedEntity);
+		Result = PushRPCInternal(EntityId, Type, Payload, bCreatedEntity);
 
 		if (Result == EPushRPCResult::QueueOverflowed)
 		{
-			AddOverflowedRPC(EntityType, MoveTemp(Payload));
+			Result = AddOverflowedRPC(EntityType, RPCPayload(Payload));
+		}
+		else if (Result == EPushRPCResult::DropOverflowed)
+		{
+			DroppedRPCCounts.FindOrAdd(Type)++;
 		}
 	}
 
@@ -49,7 +54,7 @@ EPushRPCResult SpatialRPCService::PushRPC(Worker_EntityId EntityId, ERPCType Typ
 	return Result;
 }
 
-EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPCType Type, RPCPayload&& Payload, bool bCreatedEntity)
+EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPCType Type, const RPCPayload& Payload, bool bCreatedEntity)
 {
 	const Worker_ComponentId RingBufferComponentId = RPCRingBufferUtils::GetRingBufferComponentId(Type);
 
@@ -100,12 +105,47 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 		LastAckedRPCId = 0;
 	}
 
+	const bool bPackRPC = RPCRingBufferUtils::ShouldPackRPCs(Type);
+	if (bPackRPC)
+	{
+		// An element for this entity was already started since the last flush, so the RPC doesn't need a new ID.
+		if (PendingPackedRPCs* PackedRPCs = PendingPackedRPCsToWrite.Find(EntityType))
+		{
+			if (PackedRPCs->EndpointObject == EndpointObject)
+			{
+				RPCRingBufferUtils::AppendPackedRPC(PackedRPCs->Data, Payload);
+#if TRACE_LIB_ACTIVE
+				if (SpatialLatencyTracer != nullptr && Payload.Trace != InvalidTraceKey)
+				{
+					SpatialLatencyTracer->WriteAndEndTrace(Payload.Trace, TEXT("Multiple rpc updates in single update, ending further stack tracing"), true);
+				}
+#endif
+				return EPushRPCResult::Success;
+			}
+		}
+	}
+
 	uint64 NewRPCId = LastSentRPCIds.FindRef(EntityType) + 1;
+	uint32 RingBufferSize = GetRingBufferSize(EntityType);
+
+	// Only resize once every sent RPC has been acked, so that no RPC in flight moves to a different element.
+	if (LastAckedRPCId + 1 == NewRPCId && RingBuffersToGrow.Contains(EntityType))
+	{
+		RingBufferSize = GrowRingBuffer(EntityType, EndpointObject);
+	}
 
 	// Check capacity.
-	if (LastAckedRPCId + RPCRingBufferUtils::GetRingBufferSize(Type) >= NewRPCId)
+	if (LastAckedRPCId + RingBufferSize >= NewRPCId)
 	{
-		RPCRingBufferUtils::WriteRPCToSchema(EndpointObject, Type, NewRPCId, Payload);
+		if (bPackRPC)
+		{
+			PendingPackedRPCs& PackedRPCs = PendingPackedRPCsToWrite.Add(EntityType, PendingPackedRPCs{ EndpointObject, NewRPCId, {} });
+			RPCRingBufferUtils::AppendPackedRPC(PackedRPCs.Data, Payload);
+		}
+		else
+		{
+			RPCRingBufferUtils::WriteRPCToSchema(EndpointObject, Type, RingBufferSize, NewRPCId, Payload);
+		}
 
 #if TRACE_LIB_ACTIVE
 		if (SpatialLatencyTracer != nullptr && Payload.Trace != InvalidTraceKey)
@@ -126,6 +166,11 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 	else
 	{
 		// Overflowed
+		if (GetDefault<USpatialGDKSettings>()->bUseAdaptiveRPCRingBufferSizes && RingBufferSize < GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize)
+		{
+			RingBuffersToGrow.Add(EntityType);
+		}
+
 		if (RPCRingBufferUtils::ShouldQueueOverflowed(Type))
 		{
 			return EPushRPCResult::QueueOverflowed;
@@ -141,23 +186,55 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 
 void SpatialRPCService::PushOverflowedRPCs()
 {
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const double Now = TimeSource();
+
 	for (auto It = OverflowedRPCs.CreateIterator(); It; ++It)
 	{
 		Worker_EntityId EntityId = It.Key().EntityId;
 		ERPCType Type = It.Key().Type;
-		TArray<RPCPayload>& OverflowedRPCArray = It.Value();
+		TArray<OverflowedRPC>& OverflowedRPCArray = It.Value();
+
+		// Queues are FIFO, so the expired RPCs are all at the front.
+		const float TimeToLive = SpatialGDKSettings->GetUnreliableRPCTimeToLive(Type);
+		if (TimeToLive > 0.f)
+		{
+			int32 NumExpired = 0;
+			while (NumExpired < OverflowedRPCArray.Num() && Now - OverflowedRPCArray[NumExpired].TimeQueued > TimeToLive)
+			{
+#if TRACE_LIB_ACTIVE
+				ProcessResultToLatencyTrace(EPushRPCResult::DropOverflowed, OverflowedRPCArray[NumExpired].Payload.Trace);
+#endif
+				NumExpired++;
+			}
+
+			if (NumExpired > 0)
+			{
+				DroppedRPCCounts.FindOrAdd(Type) += NumExpired;
+				NumExpiredRPCs += NumExpired;
+				OverflowedRPCArray.RemoveAt(0, NumExpired);
+				if (OverflowedRPCArray.Num() == 0)
+				{
+					It.RemoveCurrent();
+					continue;
+				}
+			}
+		}
 
 		int NumProcessed = 0;
 		bool bShouldDrop = false;
-		for (RPCPayload& Payload : OverflowedRPCArray)
+		for (OverflowedRPC& QueuedRPC : OverflowedRPCArray)
 		{
-			const EPushRPCResult Result = PushRPCInternal(EntityId, Type, MoveTemp(Payload), false);
+			const RPCPayload& Payload = QueuedRPC.Payload;
+			const EPushRPCResult Result = PushRPCInternal(EntityId, Type, Payload, false);
 
 			switch (Result)
 			{
 			case EPushRPCResult::Success:
 				NumProcessed++;
 				break;
+			case EPushRPCResult::QueueOverflowed:
+				break;
 			case EPushRPCResult::DropOverflowed:
 				checkf(false, TEXT("Shouldn't be able to drop on overflow for RPC type that was previously queued."));
 				break;
@@ -186,6 +263,7 @@ void SpatialRPCService::PushOverflowedRPCs()
 
 		if (NumProcessed == OverflowedRPCArray.Num() || bShouldDrop)
 		{
+			DroppedRPCCounts.FindOrAdd(Type) += OverflowedRPCArray.Num() - NumProcessed;
 			It.RemoveCurrent();
 		}
 		else
@@ -199,7 +277,11 @@ void SpatialRPCService::ClearOverflowedRPCs(Worker_EntityId EntityId)
 {
 	for (uint8 RPCType = static_cast<uint8>(ERPCType::ClientReliable); RPCType <= static_cast<uint8>(ERPCType::NetMulticast); RPCType++)
 	{
-		OverflowedRPCs.Remove(EntityRPCType(EntityId, static_cast<ERPCType>(RPCType)));
+		if (const TArray<OverflowedRPC>* OverflowedRPCArray = OverflowedRPCs.Find(EntityRPCType(EntityId, static_cast<ERPCType>(RPCType))))
+		{
+			DroppedRPCCounts.FindOrAdd(static_cast<ERPCType>(RPCType)) += OverflowedRPCArray->Num();
+			OverflowedRPCs.Remove(EntityRPCType(EntityId, static_cast<ERPCType>(RPCType)));
+		}
 	}
 }
 
@@ -207,6 +289,13 @@ TArray<SpatialRPCService::UpdateToSend> SpatialRPCService::GetRPCsAndAcksToSend(
 {
 	TArray<SpatialRPCService::UpdateToSend> UpdatesToSend;
 
+	WritePendingPackedRPCs();
+
+	if (PendingAcks.Num() > 0)
+	{
+		WritePendingAcks();
+	}
+
 	for (auto& It : PendingComponentUpdatesToSend)
 	{
 		SpatialRPCService::UpdateToSend& UpdateToSend = UpdatesToSend.AddZeroed_GetRef();
@@ -225,6 +314,39 @@ TArray<SpatialRPCService::UpdateToSend> SpatialRPCService::GetRPCsAndAcksToSend(
 	return UpdatesToSend;
 }
 
+TArray<SpatialRPCService::UpdateToSend> SpatialRPCService::GetRPCsAndAcksToSend(Worker_EntityId EntityId)
+{
+	TArray<SpatialRPCService::UpdateToSend> UpdatesToSend;
+
+	WritePendingPackedRPCs(EntityId);
+
+	if (PendingAcks.Num() > 0)
+	{
+		WritePendingAcks(EntityId);
+	}
+
+	for (auto It = PendingComponentUpdatesToSend.CreateIterator(); It; ++It)
+	{
+		if (It.Key().EntityId != EntityId)
+		{
+			continue;
+		}
+
+		SpatialRPCService::UpdateToSend& UpdateToSend = UpdatesToSend.AddZeroed_GetRef();
+		UpdateToSend.EntityId = EntityId;
+		UpdateToSend.Update.component_id = It.Key().ComponentId;
+		UpdateToSend.Update.schema_type = It.Value();
+#if TRACE_LIB_ACTIVE
+		TraceKey Trace = InvalidTraceKey;
+		PendingTraces.RemoveAndCopyValue(It.Key(), Trace);
+		UpdateToSend.Update.Trace = Trace;
+#endif
+		It.RemoveCurrent();
+	}
+
+	return UpdatesToSend;
+}
+
 TArray<FWorkerComponentData> SpatialRPCService::GetRPCComponentsOnEntityCreation(Worker_EntityId EntityId)
 {
 	static Worker_ComponentId EndpointComponentIds[] = {
@@ -235,6 +357,8 @@ TArray<FWorkerComponentData> SpatialRPCService::GetRPCComponentsOnEntityCreation
 
 	TArray<FWorkerComponentData> Components;
 
+	WritePendingPackedRPCs();
+
 	for (Worker_ComponentId EndpointComponentId : EndpointComponentIds)
 	{
 		const EntityComponentId EntityComponent = { EntityId, EndpointComponentId };
@@ -282,6 +406,7 @@ void SpatialRPCService::ExtractRPCsForEntity(Worker_EntityId EntityId, Worker_Co
 		{
 			ExtractRPCsForType(EntityId, ERPCType::ServerReliable);
 			ExtractRPCsForType(EntityId, ERPCType::ServerUnreliable);
+			EchoPingId(EntityId);
 		}
 		break;
 	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
@@ -289,6 +414,7 @@ void SpatialRPCService::ExtractRPCsForEntity(Worker_EntityId EntityId, Worker_Co
 		{
 			ExtractRPCsForType(EntityId, ERPCType::ClientReliable);
 			ExtractRPCsForType(EntityId, ERPCType::ClientUnreliable);
+			NotifyPingIdAcked(EntityId);
 		}
 		break;
 	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
@@ -330,6 +456,8 @@ void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Work
 		LastAckedRPCIds.Add(EntityRPCType(EntityId, ERPCType::ClientUnreliable), Endpoint->UnreliableRPCAck);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ServerReliable), Endpoint->ReliableRPCBuffer.LastSentRPCId);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ServerUnreliable), Endpoint->UnreliableRPCBuffer.LastSentRPCId);
+		RingBufferSizes.Add(EntityRPCType(EntityId, ERPCType::ServerReliable), Endpoint->ReliableRPCBuffer.RingBuffer.Num());
+		RingBufferSizes.Add(EntityRPCType(EntityId, ERPCType::ServerUnreliable), Endpoint->UnreliableRPCBuffer.RingBuffer.Num());
 		break;
 	}
 	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
@@ -339,6 +467,9 @@ void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Work
 		LastAckedRPCIds.Add(EntityRPCType(EntityId, ERPCType::ServerUnreliable), Endpoint->UnreliableRPCAck);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ClientReliable), Endpoint->ReliableRPCBuffer.LastSentRPCId);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ClientUnreliable), Endpoint->UnreliableRPCBuffer.LastSentRPCId);
+		RingBufferSizes.Add(EntityRPCType(EntityId, ERPCType::ClientReliable), Endpoint->ReliableRPCBuffer.RingBuffer.Num());
+		RingBufferSizes.Add(EntityRPCType(EntityId, ERPCType::ClientUnreliable), Endpoint->UnreliableRPCBuffer.RingBuffer.Num());
+		LastEchoedPingIds.Add(EntityId, Endpoint->PingId);
 		break;
 	}
 	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
@@ -376,18 +507,26 @@ void SpatialRPCService::OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker
 	{
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
+		PendingAcks.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
+		PendingAcks.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
+		ClearRingBufferSizes(EntityId, ERPCType::ServerReliable, ERPCType::ServerUnreliable);
 		ClearOverflowedRPCs(EntityId);
+		LastAckedPingIds.Remove(EntityId);
 		break;
 	}
 	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
 	{
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
+		PendingAcks.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
+		PendingAcks.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
+		ClearRingBufferSizes(EntityId, ERPCType::ClientReliable, ERPCType::ClientUnreliable);
 		ClearOverflowedRPCs(EntityId);
+		LastEchoedPingIds.Remove(EntityId);
 		break;
 	}
 	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
@@ -424,7 +563,7 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 	{
 		uint64 FirstRPCIdToRead = LastSeenRPCId + 1;
 
-		uint32 BufferSize = RPCRingBufferUtils::GetRingBufferSize(Type);
+		uint32 BufferSize = Buffer.RingBuffer.Num();
 		if (Buffer.LastSentRPCId > LastSeenRPCId + BufferSize)
 		{
 			UE_LOG(LogSpatialRPCService, Warning, TEXT("SpatialRPCService::ExtractRPCsForType: RPCs were overwritten without being processed! Entity: %lld, RPC type: %s, last seen RPC ID: %d, last sent ID: %d, buffer size: %d"),
@@ -435,7 +574,22 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 		for (uint64 RPCId = FirstRPCIdToRead; RPCId <= Buffer.LastSentRPCId; RPCId++)
 		{
 			const TOptional<RPCPayload>& Element = Buffer.GetRingBufferElement(RPCId);
-			if (Element.IsSet())
+			const TArray<RPCPayload>& PackedElement = Buffer.GetPackedRingBufferElement(RPCId);
+			if (PackedElement.Num() > 0)
+			{
+				// Packed RPCs are only used for unreliable RPCs, so an element is always processed as a whole.
+				bool bKeepExtracting = true;
+				for (const RPCPayload& Payload : PackedElement)
+				{
+					bKeepExtracting &= ExtractRPCCallback.Execute(EntityId, Type, Payload);
+				}
+				LastProcessedRPCId = RPCId;
+				if (!bKeepExtracting)
+				{
+					break;
+				}
+			}
+			else if (Element.IsSet())
 			{
 				bool bKeepExtracting = ExtractRPCCallback.Execute(EntityId, Type, Element.GetValue());
 				if (!bKeepExtracting)
@@ -465,18 +619,139 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 		else
 		{
 			LastAckedRPCIds[EntityTypePair] = LastProcessedRPCId;
-			const EntityComponentId EntityComponentPair = { EntityId, RPCRingBufferUtils::GetAckComponentId(Type) };
 
-			Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponentPair));
+			const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+			if (SpatialGDKSettings->RPCAckDelaySeconds > 0.0f)
+			{
+				PendingAck* Ack = PendingAcks.Find(EntityTypePair);
+				if (Ack == nullptr)
+				{
+					// Every ack up to the last seen ID has been sent.
+					Ack = &PendingAcks.Add(EntityTypePair, PendingAck{ LastSeenRPCId, LastProcessedRPCId, TimeSource() + SpatialGDKSettings->RPCAckDelaySeconds });
+				}
+				Ack->AckId = LastProcessedRPCId;
+
+				// The sender can't reuse the elements of RPCs it hasn't seen acked. Buffers are never smaller than the configured size,
+				// so this overestimates how full the sender's buffer is when it has grown.
+				const uint64 NumRPCsNotSeenAcked = Buffer.LastSentRPCId - Ack->SentAckId;
+				Ack->bBufferFilling = NumRPCsNotSeenAcked >= SpatialConstants::RPC_ACK_FLUSH_BUFFER_FRACTION * SpatialGDKSettings->GetRPCRingBufferSize(Type);
+			}
+			else
+			{
+				const EntityComponentId EntityComponentPair = { EntityId, RPCRingBufferUtils::GetAckComponentId(Type) };
+
+				Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponentPair));
 
-			RPCRingBufferUtils::WriteAckToSchema(EndpointObject, Type, LastProcessedRPCId);
+				RPCRingBufferUtils::WriteAckToSchema(EndpointObject, Type, LastProcessedRPCId);
+			}
 		}
 	}
 }
 
-void SpatialRPCService::AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload)
+void SpatialRPCService::SetPingId(Worker_EntityId EntityId, uint32 PingId)
 {
-	OverflowedRPCs.FindOrAdd(EntityType).Add(MoveTemp(Payload));
+	if (!View->HasAuthority(EntityId, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID))
+	{
+		UE_LOG(LogSpatialRPCService, Verbose, TEXT("SpatialRPCService::SetPingId: No authority over client endpoint. Entity: %lld"), EntityId);
+		return;
+	}
+
+	Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponentId{ EntityId, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID }));
+	RPCRingBufferUtils::WritePingIdToSchema(EndpointObject, PingId);
+}
+
+void SpatialRPCService::EchoPingId(Worker_EntityId EntityId)
+{
+	const ClientEndpoint* Endpoint = View->GetComponentData<ClientEndpoint>(EntityId);
+	if (Endpoint == nullptr)
+	{
+		return;
+	}
+
+	uint32& LastEchoedPingId = LastEchoedPingIds.FindOrAdd(EntityId);
+	if (Endpoint->PingId != LastEchoedPingId)
+	{
+		// Written into the same update as the acks for the RPCs extracted above, if there were any.
+		LastEchoedPingId = Endpoint->PingId;
+		Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponentId{ EntityId, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID }));
+		RPCRingBufferUtils::WritePingIdToSchema(EndpointObject, LastEchoedPingId);
+	}
+}
+
+void SpatialRPCService::NotifyPingIdAcked(Worker_EntityId EntityId)
+{
+	const ServerEndpoint* Endpoint = View->GetComponentData<ServerEndpoint>(EntityId);
+	if (Endpoint == nullptr)
+	{
+		return;
+	}
+
+	uint32& LastAckedPingId = LastAckedPingIds.FindOrAdd(EntityId);
+	if (Endpoint->PingId != LastAckedPingId)
+	{
+		LastAckedPingId = Endpoint->PingId;
+		OnPingIdAcked.Broadcast(EntityId, LastAckedPingId);
+	}
+}
+
+EPushRPCResult SpatialRPCService::AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload)
+{
+	TArray<OverflowedRPC>& OverflowedRPCArray = OverflowedRPCs.FindOrAdd(EntityType);
+
+	// Reliable RPCs are gameplay critical and are never dropped, the queues for unreliable RPCs are bounded.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const bool bIsReliable = EntityType.Type == ERPCType::ClientReliable || EntityType.Type == ERPCType::ServerReliable;
+	if (!bIsReliable && static_cast<uint32>(OverflowedRPCArray.Num()) >= SpatialGDKSettings->MaxOverflowedUnreliableRPCsPerEntity)
+	{
+		DroppedRPCCounts.FindOrAdd(EntityType.Type)++;
+
+		if (SpatialGDKSettings->UnreliableRPCOverflowDropPolicy == EOverflowedRPCDropPolicy::DropNewest)
+		{
+			return EPushRPCResult::DropOverflowed;
+		}
+
+#if TRACE_LIB_ACTIVE
+		ProcessResultToLatencyTrace(EPushRPCResult::DropOverflowed, OverflowedRPCArray[0].Payload.Trace);
+#endif
+		OverflowedRPCArray.RemoveAt(0);
+	}
+
+	OverflowedRPCArray.Add(OverflowedRPC{ MoveTemp(Payload), TimeSource() });
+	return EPushRPCResult::QueueOverflowed;
+}
+
+uint32 SpatialRPCService::GetOverflowedRPCQueueDepth(ERPCType Type) const
+{
+	uint32 QueueDepth = 0;
+	for (const auto& It : OverflowedRPCs)
+	{
+		if (It.Key.Type == Type)
+		{
+			QueueDepth += It.Value.Num();
+		}
+	}
+	return QueueDepth;
+}
+
+double SpatialRPCService::GetOldestOverflowedRPCAge(ERPCType Type) const
+{
+	const double Now = TimeSource();
+
+	double OldestAge = 0.0;
+	for (const auto& It : OverflowedRPCs)
+	{
+		// Queues are FIFO, so the first RPC in each queue is its oldest.
+		if (It.Key.Type == Type && It.Value.Num() > 0)
+		{
+			OldestAge = FMath::Max(OldestAge, Now - It.Value[0].TimeQueued);
+		}
+	}
+	return OldestAge;
+}
+
+uint32 SpatialRPCService::GetDroppedRPCCount(ERPCType Type) const
+{
+	return DroppedRPCCounts.FindRef(Type);
 }
 
 uint64 SpatialRPCService::GetAckFromView(Worker_EntityId EntityId, ERPCType Type)
@@ -542,6 +817,105 @@ Schema_ComponentData* SpatialRPCService::GetOrCreateComponentData(EntityComponen
 	return *ComponentDataPtr;
 }
 
+void SpatialRPCService::WritePendingAcks(Worker_EntityId OnlyEntityId)
+{
+	const double Now = TimeSource();
+
+	// Acks which are due go first, so acks on the same component as them are sent with the updates they create.
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		for (auto It = PendingAcks.CreateIterator(); It; ++It)
+		{
+			if (OnlyEntityId != SpatialConstants::INVALID_ENTITY_ID && It.Key().EntityId != OnlyEntityId)
+			{
+				continue;
+			}
+
+			const EntityComponentId EntityComponentPair = { It.Key().EntityId, RPCRingBufferUtils::GetAckComponentId(It.Key().Type) };
+			const bool bDue = It.Value().bBufferFilling || Now >= It.Value().Deadline;
+			if (Pass == 0 ? !bDue : !PendingComponentUpdatesToSend.Contains(EntityComponentPair))
+			{
+				continue;
+			}
+
+			Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponentPair));
+			RPCRingBufferUtils::WriteAckToSchema(EndpointObject, It.Key().Type, It.Value().AckId);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void SpatialRPCService::WritePendingPackedRPCs(Worker_EntityId OnlyEntityId)
+{
+	for (auto It = PendingPackedRPCsToWrite.CreateIterator(); It; ++It)
+	{
+		if (OnlyEntityId != SpatialConstants::INVALID_ENTITY_ID && It.Key().EntityId != OnlyEntityId)
+		{
+			continue;
+		}
+
+		RPCRingBufferUtils::WritePackedRPCsToSchema(It.Value().EndpointObject, It.Key().Type, GetRingBufferSize(It.Key()), It.Value().RPCId, It.Value().Data);
+		It.RemoveCurrent();
+	}
+}
+
+SIZE_T SpatialRPCService::GetAllocatedSize() const
+{
+	SIZE_T TotalBytes = LastSeenMulticastRPCIds.GetAllocatedSize() + LastAckedRPCIds.GetAllocatedSize() + LastSentRPCIds.GetAllocatedSize()
+		+ RingBufferSizes.GetAllocatedSize() + RingBuffersToGrow.GetAllocatedSize() + LastEchoedPingIds.GetAllocatedSize()
+		+ LastAckedPingIds.GetAllocatedSize() + PendingRPCsOnEntityCreation.GetAllocatedSize() + PendingComponentUpdatesToSend.GetAllocatedSize()
+		+ OverflowedRPCs.GetAllocatedSize() + DroppedRPCCounts.GetAllocatedSize() + PendingPackedRPCsToWrite.GetAllocatedSize()
+		+ PendingAcks.GetAllocatedSize();
+
+	for (const auto& Pair : OverflowedRPCs)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+		for (const OverflowedRPC& RPC : Pair.Value)
+		{
+			TotalBytes += RPC.Payload.PayloadData.GetAllocatedSize();
+		}
+	}
+	for (const auto& Pair : PendingPackedRPCsToWrite)
+	{
+		TotalBytes += Pair.Value.Data.GetAllocatedSize();
+	}
+
+	return TotalBytes;
+}
+
+uint32 SpatialRPCService::GetRingBufferSize(const EntityRPCType& EntityType) const
+{
+	if (const uint32* RingBufferSize = RingBufferSizes.Find(EntityType))
+	{
+		return *RingBufferSize;
+	}
+
+	return RPCRingBufferUtils::GetRingBufferSize(EntityType.Type);
+}
+
+uint32 SpatialRPCService::GrowRingBuffer(const EntityRPCType& EntityType, Schema_Object* EndpointObject)
+{
+	const uint32 RingBufferSize = FMath::Min(GetRingBufferSize(EntityType) * 2, GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize);
+
+	RingBufferSizes.Add(EntityType, RingBufferSize);
+	RingBuffersToGrow.Remove(EntityType);
+	RPCRingBufferUtils::WriteRingBufferSizeToSchema(EndpointObject, EntityType.Type, RingBufferSize);
+
+	UE_LOG(LogSpatialRPCService, Verbose, TEXT("SpatialRPCService::GrowRingBuffer: Ring buffer overflowed, growing it. Entity: %lld, RPC type: %s, new size: %d"),
+		EntityType.EntityId, *SpatialConstants::RPCTypeToString(EntityType.Type), RingBufferSize);
+
+	return RingBufferSize;
+}
+
+void SpatialRPCService::ClearRingBufferSizes(Worker_EntityId EntityId, ERPCType FirstType, ERPCType SecondType)
+{
+	for (ERPCType Type : { FirstType, SecondType })
+	{
+		RingBufferSizes.Remove(EntityRPCType(EntityId, Type));
+		RingBuffersToGrow.Remove(EntityRPCType(EntityId, Type));
+	}
+}
+
 #if TRACE_LIB_ACTIVE
 void SpatialRPCService::ProcessResultToLatencyTrace(const EPushRPCResult Result, const TraceKey Trace)
 {
@@ -2,8 +2,10 @@
 
 #include "Interop/SpatialReceiver.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
@@ -28,15 +30,20 @@
 #include "SpatialConstants.h"
 #include "Utils/ComponentReader.h"
 #include "Utils/ErrorCodeRemapping.h"
+#include "Utils/RPCRingBuffer.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialMetrics.h"
+#include "Utils/SubsystemStats.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialReceiver);
 
 DECLARE_CYCLE_STAT(TEXT("PendingOpsOnChannel"), STAT_SpatialPendingOpsOnChannel, STATGROUP_SpatialNet);
 
 DECLARE_CYCLE_STAT(TEXT("Receiver LeaveCritSection"), STAT_ReceiverLeaveCritSection, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Receiver CritSection Entities"), STAT_ReceiverCritSectionEntities, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Receiver CritSection Buffered Ops"), STAT_ReceiverCritSectionBufferedOps, STATGROUP_SpatialNet);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Receiver CritSection Duration (ms)"), STAT_ReceiverCritSectionDurationMs, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver RemoveEntity"), STAT_ReceiverRemoveEntity, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver AddComponent"), STAT_ReceiverAddComponent, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ComponentUpdate"), STAT_ReceiverComponentUpdate, STATGROUP_SpatialNet);
@@ -49,9 +56,11 @@ DECLARE_CYCLE_STAT(TEXT("Receiver CommandResponse"), STAT_ReceiverCommandRespons
 DECLARE_CYCLE_STAT(TEXT("Receiver AuthorityChange"), STAT_ReceiverAuthChange, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ReserveEntityIds"), STAT_ReceiverReserveEntityIds, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver CreateEntityResponse"), STAT_ReceiverCreateEntityResponse, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("Receiver DeleteEntityResponse"), STAT_ReceiverDeleteEntityResponse, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver EntityQueryResponse"), STAT_ReceiverEntityQueryResponse, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver FlushRemoveComponents"), STAT_ReceiverFlushRemoveComponents, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ReceiveActor"), STAT_ReceiverReceiveActor, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("Receiver ProcessDeferredActorSpawns"), STAT_ReceiverProcessDeferredActorSpawns, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver RemoveActor"), STAT_ReceiverRemoveActor, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ApplyRPC"), STAT_ReceiverApplyRPC, STATGROUP_SpatialNet);
 using namespace SpatialGDK;
@@ -69,7 +78,63 @@ void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTim
 	RPCService = InRPCService;
 
 	IncomingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialReceiver::ApplyRPC));
+	// RPCs waiting for parameters are retried when one of them resolves, or once ApplyRPC applies them anyway.
+	IncomingRPCs.SetUnresolvedRefsTimeout(GetDefault<USpatialGDKSettings>()->QueuedIncomingRPCWaitTime);
 	PeriodicallyProcessIncomingRPCs();
+
+	BuildComponentUpdateHandlers();
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bEnableActorPooling)
+	{
+		ActorPool = MakeUnique<SpatialGDK::FActorPool>(SpatialGDKSettings->MaxPooledActorsPerClass);
+	}
+
+	if (SpatialGDKSettings->bAdaptiveEntityCreationLimit && NetDriver->IsServer())
+	{
+		const int32 MaxLimit = SpatialGDKSettings->MaxCreateEntityRequestsInFlight > 0 ? static_cast<int32>(SpatialGDKSettings->MaxCreateEntityRequestsInFlight) : INT32_MAX;
+		EntityCreationLimiter = MakeUnique<SpatialGDK::FEntityCreationLimiter>(MaxLimit, SpatialGDKSettings->EntityCreationTargetLatencySeconds);
+	}
+}
+
+void USpatialReceiver::BuildComponentUpdateHandlers()
+{
+	ComponentUpdateHandlers.AddDenseRange(0, SpatialConstants::MAX_RESERVED_SPATIAL_SYSTEM_COMPONENT_ID, EComponentUpdateHandler::IgnoreReserved);
+
+	// Hand-written Spatial components, whose data is only read from the static component view.
+	for (const Worker_ComponentId ComponentId : { SpatialConstants::ENTITY_ACL_COMPONENT_ID, SpatialConstants::METADATA_COMPONENT_ID, SpatialConstants::POSITION_COMPONENT_ID,
+		SpatialConstants::PERSISTENCE_COMPONENT_ID, SpatialConstants::INTEREST_COMPONENT_ID, SpatialConstants::SPAWN_DATA_COMPONENT_ID, SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID,
+		SpatialConstants::UNREAL_METADATA_COMPONENT_ID, SpatialConstants::NOT_STREAMED_COMPONENT_ID, SpatialConstants::RPCS_ON_ENTITY_CREATION_ID,
+		SpatialConstants::DEBUG_METRICS_COMPONENT_ID, SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID })
+	{
+		ComponentUpdateHandlers.Add(ComponentId, EComponentUpdateHandler::Ignore);
+	}
+
+	ComponentUpdateHandlers.Add(SpatialConstants::GSM_SHUTDOWN_COMPONENT_ID, EComponentUpdateHandler::GSMShutdown);
+	ComponentUpdateHandlers.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID, EComponentUpdateHandler::Heartbeat);
+	ComponentUpdateHandlers.Add(SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID, EComponentUpdateHandler::DeploymentMap);
+	ComponentUpdateHandlers.Add(SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID, EComponentUpdateHandler::StartupActorManager);
+	ComponentUpdateHandlers.Add(SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID, EComponentUpdateHandler::VirtualWorkerTranslation);
+	ComponentUpdateHandlers.Add(SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID, EComponentUpdateHandler::CrossServerRPC);
+	ComponentUpdateHandlers.Add(SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID, EComponentUpdateHandler::LevelTombstones);
+
+	for (const Worker_ComponentId ComponentId : { SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY, SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY,
+		SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID_LEGACY })
+	{
+		ComponentUpdateHandlers.Add(ComponentId, EComponentUpdateHandler::RPCLegacy);
+	}
+
+	for (const Worker_ComponentId ComponentId : { SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID,
+		SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID })
+	{
+		ComponentUpdateHandlers.Add(ComponentId, EComponentUpdateHandler::LoadBalancing);
+	}
+
+	for (const Worker_ComponentId ComponentId : { SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID,
+		SpatialConstants::MULTICAST_RPCS_COMPONENT_ID })
+	{
+		ComponentUpdateHandlers.Add(ComponentId, EComponentUpdateHandler::RPC);
+	}
 }
 
 void USpatialReceiver::OnCriticalSection(bool InCriticalSection)
@@ -89,15 +154,38 @@ void USpatialReceiver::EnterCriticalSection()
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entering critical section."));
 	check(!bInCriticalSection);
 	bInCriticalSection = true;
+	CriticalSectionStartTime = FPlatformTime::Seconds();
 }
 
 void USpatialReceiver::LeaveCriticalSection()
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverLeaveCritSection);
+	SPATIALGDK_SUBSYSTEM_SCOPE(CriticalSection);
 
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Leaving critical section."));
 	check(bInCriticalSection);
 
+	if (GetDefault<USpatialGDKSettings>()->bPrefetchComponentFieldIds)
+	{
+		PrefetchPendingAddComponentFieldIds();
+	}
+
+	int32 NumBufferedOps = PendingAddActors.Num();
+	for (const TPair<Worker_EntityId_Key, CriticalSectionEntityOps>& EntityOps : PendingOpsByEntity)
+	{
+		NumBufferedOps += EntityOps.Value.AddComponents.Num() + EntityOps.Value.AuthorityChanges.Num();
+	}
+	SET_DWORD_STAT(STAT_ReceiverCritSectionEntities, PendingOpsByEntity.Num());
+	SET_DWORD_STAT(STAT_ReceiverCritSectionBufferedOps, NumBufferedOps);
+	SET_FLOAT_STAT(STAT_ReceiverCritSectionDurationMs, (FPlatformTime::Seconds() - CriticalSectionStartTime) * 1000.0);
+
+	// When not every new entity fits in this tick's spawn budget, make sure the budget goes to the ones the player notices first.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bTimeSliceActorSpawning && ActorsSpawnedThisTick + static_cast<uint32>(PendingAddActors.Num()) > SpatialGDKSettings->MaxActorsSpawnedPerTick)
+	{
+		SortPendingAddActorsBySpawnPriority();
+	}
+
 	for (Worker_EntityId& PendingAddEntity : PendingAddActors)
 	{
 		ReceiveActor(PendingAddEntity);
@@ -105,7 +193,10 @@ void USpatialReceiver::LeaveCriticalSection()
 		{
 			OnEntityAddedDelegate.Broadcast(PendingAddEntity);
 		}
-		PendingAddComponents.RemoveAll([PendingAddEntity](const PendingAddComponentWrapper& Component) {return Component.EntityId == PendingAddEntity;});
+		if (CriticalSectionEntityOps* EntityOps = PendingOpsByEntity.Find(PendingAddEntity))
+		{
+			EntityOps->AddComponents.Empty();
+		}
 	}
 
 	// The reason the AuthorityChange processing is split according to authority is to avoid cases
@@ -113,14 +204,42 @@ void USpatialReceiver::LeaveCriticalSection()
 	// We process Lose Auth -> Add Components -> Gain Auth. A common thing that happens is that on handover we get
 	// ComponentData -> Gain Auth, and with this split you receive data as if you were a client to get the most up-to-date state,
 	// and then gain authority. Similarly, you first lose authority, and then receive data, in the opposite situation.
-	for (Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
+	for (TPair<Worker_EntityId_Key, CriticalSectionEntityOps>& EntityOps : PendingOpsByEntity)
+	{
+		for (Worker_AuthorityChangeOp& PendingAuthorityChange : EntityOps.Value.AuthorityChanges)
+		{
+			if (PendingAuthorityChange.authority != WORKER_AUTHORITY_AUTHORITATIVE)
+			{
+				HandleActorAuthority(PendingAuthorityChange);
+			}
+		}
+	}
+
+	for (TPair<Worker_EntityId_Key, CriticalSectionEntityOps>& EntityOps : PendingOpsByEntity)
+	{
+		HandlePendingAddComponents(EntityOps.Value.AddComponents);
+	}
+
+	for (TPair<Worker_EntityId_Key, CriticalSectionEntityOps>& EntityOps : PendingOpsByEntity)
 	{
-		if (PendingAuthorityChange.authority != WORKER_AUTHORITY_AUTHORITATIVE)
+		for (Worker_AuthorityChangeOp& PendingAuthorityChange : EntityOps.Value.AuthorityChanges)
 		{
-			HandleActorAuthority(PendingAuthorityChange);
+			if (PendingAuthorityChange.authority == WORKER_AUTHORITY_AUTHORITATIVE)
+			{
+				HandleActorAuthority(PendingAuthorityChange);
+			}
 		}
 	}
 
+	// Mark that we've left the critical section.
+	bInCriticalSection = false;
+	PendingAddActors.Empty();
+	PendingOpsByEntity.Empty();
+	ClearPrefetchedFieldIds();
+}
+
+void USpatialReceiver::HandlePendingAddComponents(TArray<PendingAddComponentWrapper>& PendingAddComponents)
+{
 	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
 	{
 		if (ClassInfoManager->IsGeneratedQBIMarkerComponent(PendingAddComponent.ComponentId))
@@ -146,25 +265,104 @@ void USpatialReceiver::LeaveCriticalSection()
 			PendingAddComponent.EntityId, PendingAddComponent.ComponentId);
 		HandleIndividualAddComponent(PendingAddComponent.EntityId, PendingAddComponent.ComponentId, MoveTemp(PendingAddComponent.Data));
 	}
+}
 
-	for (Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
+void USpatialReceiver::PrefetchComponentUpdateFieldIds(const Worker_OpList* OpList)
+{
+	TArray<FPredecodedFieldIds> PredecodedFieldIds;
+	if (NetDriver->Connection != nullptr && NetDriver->Connection->TakePredecodedFieldIds(OpList, PredecodedFieldIds))
 	{
-		if (PendingAuthorityChange.authority == WORKER_AUTHORITY_AUTHORITATIVE)
+		for (FPredecodedFieldIds& FieldIds : PredecodedFieldIds)
 		{
-			HandleActorAuthority(PendingAuthorityChange);
+			PrefetchedFieldIds.Add(FieldIds.Key, MoveTemp(FieldIds.Value));
 		}
+		return;
 	}
 
-	// Mark that we've left the critical section.
-	bInCriticalSection = false;
-	PendingAddActors.Empty();
-	PendingAddComponents.Empty();
-	PendingAuthorityChanges.Empty();
+	TArray<Schema_ComponentUpdate*> ComponentUpdates;
+	for (size_t i = 0; i < OpList->op_count; ++i)
+	{
+		const Worker_Op& Op = OpList->ops[i];
+		if (Op.op_type == WORKER_OP_TYPE_COMPONENT_UPDATE && Op.op.component_update.update.component_id >= SpatialConstants::STARTING_GENERATED_COMPONENT_ID)
+		{
+			ComponentUpdates.Add(Op.op.component_update.update.schema_type);
+		}
+	}
+
+	PrefetchFieldIds({}, ComponentUpdates);
+}
+
+void USpatialReceiver::PrefetchPendingAddComponentFieldIds()
+{
+	TArray<Schema_ComponentData*> ComponentDatas;
+	for (const TPair<Worker_EntityId_Key, CriticalSectionEntityOps>& EntityOps : PendingOpsByEntity)
+	{
+		for (const PendingAddComponentWrapper& PendingAddComponent : EntityOps.Value.AddComponents)
+		{
+			if (PendingAddComponent.ComponentId >= SpatialConstants::STARTING_GENERATED_COMPONENT_ID)
+			{
+				ComponentDatas.Add(PendingAddComponent.Data->ComponentData->schema_type);
+			}
+		}
+	}
+
+	PrefetchFieldIds(ComponentDatas, {});
+}
+
+void USpatialReceiver::PrefetchFieldIds(const TArray<Schema_ComponentData*>& ComponentDatas, const TArray<Schema_ComponentUpdate*>& ComponentUpdates)
+{
+	// Not worth waking up the task graph for a handful of components.
+	static const int32 MinComponentsToParallelize = 16;
+
+	const int32 NumComponents = ComponentDatas.Num() + ComponentUpdates.Num();
+	if (NumComponents == 0)
+	{
+		return;
+	}
+
+	// Reading distinct schema objects is thread safe, anything touching UObjects or the package map is left to the game thread.
+	TArray<TArray<Schema_FieldId>> FieldIds;
+	FieldIds.SetNum(NumComponents);
+	ParallelFor(NumComponents, [&ComponentDatas, &ComponentUpdates, &FieldIds](int32 Index)
+	{
+		if (Index < ComponentDatas.Num())
+		{
+			FieldIds[Index] = ComponentReader::GetComponentDataFieldIds(ComponentDatas[Index]);
+		}
+		else
+		{
+			FieldIds[Index] = ComponentReader::GetComponentUpdateFieldIds(ComponentUpdates[Index - ComponentDatas.Num()]);
+		}
+	}, NumComponents < MinComponentsToParallelize);
+
+	for (int32 Index = 0; Index < NumComponents; ++Index)
+	{
+		const void* SchemaType = Index < ComponentDatas.Num() ? static_cast<const void*>(ComponentDatas[Index]) : static_cast<const void*>(ComponentUpdates[Index - ComponentDatas.Num()]);
+		PrefetchedFieldIds.Add(SchemaType, MoveTemp(FieldIds[Index]));
+	}
+}
+
+bool USpatialReceiver::ConsumePrefetchedFieldIds(const void* SchemaType, TArray<Schema_FieldId>& OutFieldIds)
+{
+	return PrefetchedFieldIds.RemoveAndCopyValue(SchemaType, OutFieldIds);
+}
+
+void USpatialReceiver::ClearPrefetchedFieldIds()
+{
+	PrefetchedFieldIds.Empty();
 }
 
 void USpatialReceiver::OnAddEntity(const Worker_AddEntityOp& Op)
 {
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("AddEntity: %lld"), Op.entity_id);
+
+	if (RejoinCachedEntities.Remove(Op.entity_id) > 0)
+	{
+		// Kept from before a fast rejoin. The cached data is dropped so the view takes what the entity is checked out with now.
+		StaticComponentView->OnRemoveEntity(Op.entity_id);
+		RejoinedEntities.Add(Op.entity_id);
+		LastRejoinedEntityTime = FPlatformTime::Seconds();
+	}
 }
 
 void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
@@ -221,7 +419,14 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 		// This means we need to be inside a critical section, otherwise we may not have all the requisite
 		// information at the point of creating the Actor.
 		check(bInCriticalSection);
-		PendingAddActors.AddUnique(Op.entity_id);
+		{
+			CriticalSectionEntityOps& EntityOps = PendingOpsByEntity.FindOrAdd(Op.entity_id);
+			if (!EntityOps.bAddActor)
+			{
+				EntityOps.bAddActor = true;
+				PendingAddActors.Add(Op.entity_id);
+			}
+		}
 		return;
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
 	case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:
@@ -248,6 +453,12 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 			RPCService->OnCheckoutMulticastRPCComponentOnEntity(Op.entity_id);
 		}
 		return;
+	case SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID:
+		if (NetDriver->CrossServerRPCService.IsValid())
+		{
+			NetDriver->CrossServerRPCService->OnEndpointAdded(Op.entity_id, Schema_GetComponentDataFields(Op.data.schema_type));
+		}
+		return;
 	case SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID:
 		GlobalStateManager->ApplyDeploymentMapData(Op.data);
 		return;
@@ -257,6 +468,12 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 	case SpatialConstants::TOMBSTONE_COMPONENT_ID:
 		RemoveActor(Op.entity_id);
 		return;
+	case SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID:
+		if (NetDriver->StartupActorTombstones.IsValid())
+		{
+			NetDriver->StartupActorTombstones->OnLevelTombstonesAdded(Op.entity_id, Op.data);
+		}
+		return;
 	case SpatialConstants::DORMANT_COMPONENT_ID:
 		if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
 		{
@@ -277,19 +494,14 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 		return;
 	}
 
-	if (Op.data.component_id < SpatialConstants::MAX_RESERVED_SPATIAL_SYSTEM_COMPONENT_ID)
-	{
-		return;
-	}
-
-	if (ClassInfoManager->IsGeneratedQBIMarkerComponent(Op.data.component_id))
+	if (ClassInfoManager->GetComponentClassification().HasAnyTraits(Op.data.component_id, SpatialConstants::COMPONENT_TRAIT_SpatialSystem | SpatialConstants::COMPONENT_TRAIT_QBIMarker))
 	{
 		return;
 	}
 
 	if (bInCriticalSection)
 	{
-		PendingAddComponents.AddUnique(PendingAddComponentWrapper(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data)));
+		PendingOpsByEntity.FindOrAdd(Op.entity_id).AddComponents.AddUnique(PendingAddComponentWrapper(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data)));
 	}
 	else
 	{
@@ -316,11 +528,27 @@ void USpatialReceiver::OnRemoveEntity(const Worker_RemoveEntityOp& Op)
 
 	OnEntityRemovedDelegate.Broadcast(Op.entity_id);
 
+	HeartbeatInterestDisabledEntities.Remove(Op.entity_id);
+
+	DropPendingReliableRPCs(Op.entity_id);
+
+	if (NetDriver->InterestFactory.IsValid())
+	{
+		NetDriver->InterestFactory->InvalidateCachedInterest(Op.entity_id);
+	}
+
+	if (NetDriver->HotEntityTracker.IsValid())
+	{
+		NetDriver->HotEntityTracker->RemoveEntity(Op.entity_id);
+	}
+
 	if (NetDriver->IsServer())
 	{
 		// Check to see if we are removing a system entity for a worker connection. If so clean up the ClientConnection to delete any and all actors for this connection's controller.
 		if (FString* WorkerName = WorkerConnectionEntities.Find(Op.entity_id))
 		{
+			NetDriver->PlayerSpawner->OnClientWorkerDisconnected(*WorkerName);
+
 			TWeakObjectPtr<USpatialNetConnection> ClientConnectionPtr = NetDriver->FindClientConnectionFromWorkerId(*WorkerName);
 			if (USpatialNetConnection* ClientConnection = ClientConnectionPtr.Get())
 			{
@@ -330,7 +558,14 @@ void USpatialReceiver::OnRemoveEntity(const Worker_RemoveEntityOp& Op)
 					if (AuthorityPlayerControllerConnectionMap.Find(PCEntity))
 					{
 						UE_LOG(LogSpatialReceiver, Verbose, TEXT("Worker %s disconnected after its system identity was removed."), *(*WorkerName));
-						CloseClientConnection(ClientConnection, PCEntity);
+						if (GetDefault<USpatialGDKSettings>()->bEnableClientFastRejoin)
+						{
+							CloseClientConnectionAfterRejoinGracePeriod(ClientConnection, PCEntity);
+						}
+						else
+						{
+							CloseClientConnection(ClientConnection, PCEntity);
+						}
 					}
 				}
 			}
@@ -371,6 +606,11 @@ void USpatialReceiver::OnRemoveComponent(const Worker_RemoveComponentOp& Op)
 		RPCService->OnRemoveMulticastRPCComponentForEntity(Op.entity_id);
 	}
 
+	if (Op.component_id == SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID && NetDriver->CrossServerRPCService.IsValid())
+	{
+		NetDriver->CrossServerRPCService->OnEndpointRemoved(Op.entity_id);
+	}
+
 	if (LoadBalanceEnforcer != nullptr && LoadBalanceEnforcer->HandlesComponent(Op.component_id))
 	{
 		LoadBalanceEnforcer->OnLoadBalancingComponentRemoved(Op);
@@ -523,11 +763,26 @@ void USpatialReceiver::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 		}
 	}
 
+	if (Op.component_id == SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_AUTHORITATIVE && NetDriver->CrossServerRPCService.IsValid())
+	{
+		NetDriver->CrossServerRPCService->OnEndpointAuthorityGained(Op.entity_id);
+		return;
+	}
+
+	if (Op.component_id == SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID)
+	{
+		if (Op.authority == WORKER_AUTHORITY_AUTHORITATIVE && NetDriver->StartupActorTombstones.IsValid())
+		{
+			NetDriver->StartupActorTombstones->OnLevelTombstonesAuthorityGained(Op.entity_id);
+		}
+		return;
+	}
+
 	if (bInCriticalSection)
 	{
 		// The actor receiving flow requires authority to be handled after all components have been received, so buffer those if we
 		// are in a critical section to be handled later.
-		PendingAuthorityChanges.Add(Op);
+		PendingOpsByEntity.FindOrAdd(Op.entity_id).AuthorityChanges.Add(Op);
 		return;
 	}
 
@@ -550,6 +805,11 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 				if (NetDriver->IsServer())
 				{
 					AuthorityPlayerControllerConnectionMap.Add(Op.entity_id, Connection);
+
+					if (HeartbeatInterestDisabledEntities.Contains(Op.entity_id))
+					{
+						SetHeartbeatComponentInterest(Op.entity_id, true);
+					}
 				}
 				Connection->InitHeartbeat(TimerManager, Op.entity_id);
 			}
@@ -559,6 +819,11 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 			if (NetDriver->IsServer())
 			{
 				AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+
+				if (GetDefault<USpatialGDKSettings>()->bAggregateServerHeartbeats)
+				{
+					SetHeartbeatComponentInterest(Op.entity_id, false);
+				}
 			}
 			if (USpatialNetConnection* Connection = Cast<USpatialNetConnection>(PlayerController->GetNetConnection()))
 			{
@@ -570,6 +835,12 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 
 void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 {
+	// Another worker may change the interest of the entity while this worker is not authoritative over it.
+	if (Op.component_id == SpatialConstants::POSITION_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE && NetDriver->InterestFactory.IsValid())
+	{
+		NetDriver->InterestFactory->InvalidateCachedInterest(Op.entity_id);
+	}
+
 	if (GlobalStateManager->HandlesComponent(Op.component_id))
 	{
 		GlobalStateManager->AuthorityChanged(Op);
@@ -685,8 +956,16 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 					{
 						UpdateShadowData(Op.entity_id);
 					}
+					else if (!IsValid(Channel) && StaticComponentView->HasComponent(Op.entity_id, SpatialConstants::DORMANT_COMPONENT_ID))
+					{
+						// The actor went dormant on another worker, so it was never marked dormant in our network object list.
+						// Do so now, before OnAuthorityGained can wake it, so the replication loop skips it until it is woken.
+						NetDriver->NotifyActorFullyDormantForConnection(Actor, NetDriver->GetSpatialOSNetConnection());
+					}
 
 					Actor->OnAuthorityGained();
+
+					NetDriver->ScheduleActorForReplication(Actor);
 				}
 				else
 				{
@@ -773,7 +1052,9 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 					// If we have just received authority over the client endpoint, then we are a client.  In that case,
 					// we want to scrape the server endpoint for any server -> client RPCs that are waiting to be called.
 					const Worker_ComponentId ComponentToExtractFrom = Op.component_id == SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID ? SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID : SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
+					BeginIncomingRPCBatch();
 					RPCService->ExtractRPCsForEntity(Op.entity_id, ComponentToExtractFrom);
+					EndIncomingRPCBatch();
 				}
 			}
 			else if (Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
@@ -802,11 +1083,16 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 
 bool USpatialReceiver::IsReceivedEntityTornOff(Worker_EntityId EntityId)
 {
+	CriticalSectionEntityOps* EntityOps = PendingOpsByEntity.Find(EntityId);
+	if (EntityOps == nullptr)
+	{
+		return false;
+	}
+
 	// Check the pending add components, to find the root component for the received entity.
-	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	for (PendingAddComponentWrapper& PendingAddComponent : EntityOps->AddComponents)
 	{
-		if (PendingAddComponent.EntityId != EntityId
-			|| ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId) != SCHEMA_Data)
+		if (ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId) != SCHEMA_Data)
 		{
 			continue;
 		}
@@ -853,6 +1139,12 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 	AActor* EntityActor = Cast<AActor>(PackageMap->GetObjectFromEntityId(EntityId));
 	if (EntityActor != nullptr)
 	{
+		if (RejoinedEntities.Remove(EntityId) > 0)
+		{
+			ApplyRejoinedEntityData(EntityId, *EntityActor);
+			return;
+		}
+
 		UE_LOG(LogSpatialReceiver, Verbose, TEXT("%s: Entity %lld for Actor %s has been checked out on the worker which spawned it."),
 			*NetDriver->Connection->GetWorkerId(), EntityId, *EntityActor->GetName());
 		return;
@@ -869,6 +1161,17 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 		return;
 	}
 
+	// Over this tick's spawn budget, hold the entity and all of its ops like an entity waiting for its class to load.
+	if (SpatialGDKSettings->bTimeSliceActorSpawning)
+	{
+		if (ActorsSpawnedThisTick >= SpatialGDKSettings->MaxActorsSpawnedPerTick)
+		{
+			DeferActorSpawn(EntityId, ClassPath, Class);
+			return;
+		}
+		ActorsSpawnedThisTick++;
+	}
+
 	// Make sure ClassInfo exists
 	const FClassInfo& ActorClassInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Class);
 
@@ -890,8 +1193,9 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 		return;
 	}
 
-	// RemoveActor immediately if we've received the tombstone component.
-	if (NetDriver->StaticComponentView->HasComponent(EntityId, SpatialConstants::TOMBSTONE_COMPONENT_ID))
+	// RemoveActor immediately if we've received the tombstone component, or the actor is in its level's tombstones.
+	if (NetDriver->StaticComponentView->HasComponent(EntityId, SpatialConstants::TOMBSTONE_COMPONENT_ID)
+		|| (NetDriver->StartupActorTombstones.IsValid() && EntityActor->IsNetStartupActor() && NetDriver->StartupActorTombstones->IsTombstoned(*EntityActor)))
 	{
 		UE_LOG(LogSpatialReceiver, Verbose, TEXT("The received actor with entity ID %lld was tombstoned. The actor will not be spawned."), EntityId);
 		// We must first Resolve the EntityId to the Actor in order for RemoveActor to succeed.
@@ -948,15 +1252,15 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 	// Apply initial replicated properties.
 	// This was moved to after FinishingSpawning because components existing only in blueprints aren't added until spawning is complete
 	// Potentially we could split out the initial actor state and the initial component state
-	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	if (CriticalSectionEntityOps* EntityOps = PendingOpsByEntity.Find(EntityId))
 	{
-		if (ClassInfoManager->IsGeneratedQBIMarkerComponent(PendingAddComponent.ComponentId))
+		for (PendingAddComponentWrapper& PendingAddComponent : EntityOps->AddComponents)
 		{
-			continue;
-		}
+			if (ClassInfoManager->IsGeneratedQBIMarkerComponent(PendingAddComponent.ComponentId))
+			{
+				continue;
+			}
 
-		if (PendingAddComponent.EntityId == EntityId)
-		{
 			ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data->ComponentData, *Channel, ActorClassInfo, ObjectsToResolvePendingOpsFor);
 		}
 	}
@@ -1011,6 +1315,36 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 	}
 }
 
+void USpatialReceiver::ApplyRejoinedEntityData(Worker_EntityId EntityId, AActor& EntityActor)
+{
+	USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId);
+	CriticalSectionEntityOps* EntityOps = PendingOpsByEntity.Find(EntityId);
+	if (Channel == nullptr || EntityOps == nullptr)
+	{
+		return;
+	}
+
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Applying data of entity %lld to Actor %s kept through a rejoin."), EntityId, *EntityActor.GetName());
+
+	// The data is applied like any update to an existing actor, so only what changed while the client was away is notified.
+	const FClassInfo& ActorClassInfo = ClassInfoManager->GetOrCreateClassInfoByClass(EntityActor.GetClass());
+	TArray<ObjectPtrRefPair> ObjectsToResolvePendingOpsFor;
+	for (PendingAddComponentWrapper& PendingAddComponent : EntityOps->AddComponents)
+	{
+		if (ClassInfoManager->IsGeneratedQBIMarkerComponent(PendingAddComponent.ComponentId))
+		{
+			continue;
+		}
+
+		ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data->ComponentData, *Channel, ActorClassInfo, ObjectsToResolvePendingOpsFor);
+	}
+
+	for (const ObjectPtrRefPair& ObjectToResolve : ObjectsToResolvePendingOpsFor)
+	{
+		ResolvePendingOperations(ObjectToResolve.Key, ObjectToResolve.Value);
+	}
+}
+
 void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverRemoveActor);
@@ -1032,7 +1366,7 @@ void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
 	if (USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId))
 	{
 		// If we have any pending subobjects on the channel
-		if (ActorChannel->PendingDynamicSubobjects.Num() > 0)
+		if (ActorChannel->HasPendingDynamicSubobjects())
 		{
 			// Then iterate through all pending subobjects and remove entries relating to this entity.
 			for (const auto& Pair : PendingDynamicSubobjectComponents)
@@ -1080,7 +1414,8 @@ void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
 			CleanupRepStateMap(ChannelRefs.Value);
 		}
 
-		ActorChannel->ObjectReferenceMap.Empty();
+		// Reset rather than Empty so a pooled channel reusing this map keeps its allocation.
+		ActorChannel->ObjectReferenceMap.Reset();
 
 		// If the entity is to be deleted after having been torn off, ignore the request (but clean up the channel if it has not been cleaned up already).
 		if (Actor->GetTearOff())
@@ -1093,7 +1428,8 @@ void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
 	// Actor is a startup actor that is a part of the level.  If it's not Tombstone'd, then it
 	// has just fallen out of our view and we should only remove the entity.
 	if (Actor->IsFullNameStableForNetworking() &&
-		StaticComponentView->HasComponent(EntityId, SpatialConstants::TOMBSTONE_COMPONENT_ID) == false)
+		StaticComponentView->HasComponent(EntityId, SpatialConstants::TOMBSTONE_COMPONENT_ID) == false &&
+		!(NetDriver->StartupActorTombstones.IsValid() && NetDriver->StartupActorTombstones->IsTombstoned(*Actor)))
 	{
 		// We can't call CleanupDeletedEntity here as we need the NetDriver to maintain the EntityId
 		// to Actor Channel mapping for the DestroyActor to function correctly
@@ -1101,6 +1437,11 @@ void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
 		return;
 	}
 
+	if (ActorPool.IsValid() && SpatialGDK::FActorPool::IsPoolable(Actor->GetClass()) && ReleaseActorToPool(Actor, EntityId))
+	{
+		return;
+	}
+
 	if (APlayerController* PC = Cast<APlayerController>(Actor))
 	{
 		// Force APlayerController::DestroyNetworkActorHandled to return false
@@ -1165,6 +1506,33 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	check(PackageMap->GetObjectFromEntityId(EntityId) == nullptr);
 }
 
+bool USpatialReceiver::ReleaseActorToPool(AActor* Actor, Worker_EntityId EntityId)
+{
+	USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId);
+	if (ActorChannel == nullptr)
+	{
+		return false;
+	}
+
+	// See DestroyActor.
+	NetDriver->StartIgnoringAuthoritativeDestruction();
+
+	// Close the channel the same way as for a torn off actor, which cleans up the package map without destroying the actor.
+	ActorChannel->ConditionalCleanUp(false, EChannelCloseReason::TearOff);
+	ClearPendingRPCs(EntityId);
+	Sender->ClearPendingRPCs(EntityId);
+
+	if (!ActorPool->Release(Actor) && !Actor->Destroy(true))
+	{
+		UE_LOG(LogSpatialReceiver, Error, TEXT("Failed to destroy actor in RemoveActor %s %lld"), *Actor->GetName(), EntityId);
+	}
+
+	NetDriver->StopIgnoringAuthoritativeDestruction();
+
+	check(PackageMap->GetObjectFromEntityId(EntityId) == nullptr);
+	return true;
+}
+
 AActor* USpatialReceiver::TryGetOrCreateActor(UnrealMetadata* UnrealMetadataComp, SpawnData* SpawnDataComp, NetOwningClientWorker* NetOwningClientWorkerComp)
 {
 	if (UnrealMetadataComp->StablyNamedRef.IsSet())
@@ -1216,7 +1584,16 @@ AActor* USpatialReceiver::CreateActor(UnrealMetadata* UnrealMetadataComp, SpawnD
 
 	FVector SpawnLocation = FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, NetDriver->GetWorld()->OriginLocation);
 
-	AActor* NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
+	AActor* NewActor = nullptr;
+	if (ActorPool.IsValid() && SpatialGDK::FActorPool::IsPoolable(ActorClass))
+	{
+		NewActor = ActorPool->Acquire(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation));
+	}
+
+	if (NewActor == nullptr)
+	{
+		NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
+	}
 	check(NewActor);
 
 	if (NetDriver->IsServer() && bCreatingPlayerController)
@@ -1503,73 +1880,76 @@ void USpatialReceiver::ApplyComponentData(USpatialActorChannel& Channel, UObject
 void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverComponentUpdate);
+
+	if (NetDriver->HotEntityTracker.IsValid())
+	{
+		NetDriver->HotEntityTracker->Record(Op.entity_id, SpatialGDK::EHotEntityCounter::IncomingOps, FPlatformTime::Seconds());
+	}
+
 	if (IsEntityWaitingForAsyncLoad(Op.entity_id))
 	{
 		QueueComponentUpdateOpForAsyncLoad(Op);
 		return;
 	}
 
-	switch (Op.update.component_id)
+	switch (ComponentUpdateHandlers.Find(Op.update.component_id))
 	{
-	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
-	case SpatialConstants::METADATA_COMPONENT_ID:
-	case SpatialConstants::POSITION_COMPONENT_ID:
-	case SpatialConstants::PERSISTENCE_COMPONENT_ID:
-	case SpatialConstants::INTEREST_COMPONENT_ID:
-	case SpatialConstants::SPAWN_DATA_COMPONENT_ID:
-	case SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID:
-	case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:
-	case SpatialConstants::NOT_STREAMED_COMPONENT_ID:
-	case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:
-	case SpatialConstants::DEBUG_METRICS_COMPONENT_ID:
-	case SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID:
-	case SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID:
+	case EComponentUpdateHandler::Generic:
+		break;
+	case EComponentUpdateHandler::Ignore:
 		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity: %d Component: %d - Skipping because this is hand-written Spatial component"), Op.entity_id, Op.update.component_id);
 		return;
-	case SpatialConstants::GSM_SHUTDOWN_COMPONENT_ID:
+	case EComponentUpdateHandler::IgnoreReserved:
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity: %d Component: %d - Skipping because this is a reserved spatial system component"), Op.entity_id, Op.update.component_id);
+		return;
+	case EComponentUpdateHandler::GSMShutdown:
 #if WITH_EDITOR
 		GlobalStateManager->OnShutdownComponentUpdate(Op.update);
 #endif // WITH_EDITOR
 		return;
-	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
+	case EComponentUpdateHandler::Heartbeat:
 		OnHeartbeatComponentUpdate(Op);
 		return;
-	case SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID:
+	case EComponentUpdateHandler::DeploymentMap:
 		NetDriver->GlobalStateManager->ApplyDeploymentMapUpdate(Op.update);
 		return;
-	case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
+	case EComponentUpdateHandler::StartupActorManager:
 		NetDriver->GlobalStateManager->ApplyStartupActorManagerUpdate(Op.update);
 		return;
-	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
-	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
-	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID_LEGACY:
+	case EComponentUpdateHandler::LevelTombstones:
+		if (NetDriver->StartupActorTombstones.IsValid())
+		{
+			NetDriver->StartupActorTombstones->OnLevelTombstonesUpdated(Op.entity_id, Op.update);
+		}
+		return;
+	case EComponentUpdateHandler::RPCLegacy:
 		HandleRPCLegacy(Op);
 		return;
-	case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:
-	case SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID:
-	case SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID:
+	case EComponentUpdateHandler::LoadBalancing:
 		if (LoadBalanceEnforcer != nullptr)
 		{
 			LoadBalanceEnforcer->OnLoadBalancingComponentUpdated(Op);
 		}
 		return;
-	case SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID:
+	case EComponentUpdateHandler::VirtualWorkerTranslation:
 		if (NetDriver->VirtualWorkerTranslator.IsValid())
 		{
 			Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
-			NetDriver->VirtualWorkerTranslator->ApplyVirtualWorkerManagerData(ComponentObject);
+			if (NetDriver->VirtualWorkerTranslator->ApplyVirtualWorkerManagerData(ComponentObject))
+			{
+				// The worker's region moved, so its interest and position need to follow.
+				Sender->UpdateServerWorkerEntityInterestAndPosition();
+			}
 		}
 		return;
-	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:
-	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
-	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
+	case EComponentUpdateHandler::RPC:
 		HandleRPC(Op);
 		return;
-	}
-
-	if (Op.update.component_id < SpatialConstants::MAX_RESERVED_SPATIAL_SYSTEM_COMPONENT_ID)
-	{
-		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity: %d Component: %d - Skipping because this is a reserved spatial system component"), Op.entity_id, Op.update.component_id);
+	case EComponentUpdateHandler::CrossServerRPC:
+		if (NetDriver->CrossServerRPCService.IsValid())
+		{
+			NetDriver->CrossServerRPCService->OnEndpointUpdated(Op.entity_id, Schema_GetComponentUpdateFields(Op.update.schema_type));
+		}
 		return;
 	}
 
@@ -1690,6 +2070,7 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 	const Schema_FieldId EventId = SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID;
 	uint32 EventCount = Schema_GetObjectCount(EventsObject, EventId);
 
+	BeginIncomingRPCBatch();
 	for (uint32 i = 0; i < EventCount; i++)
 	{
 		Schema_Object* EventData = Schema_IndexObject(EventsObject, EventId, i);
@@ -1698,12 +2079,9 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 
 		FUnrealObjectRef ObjectRef(EntityId, Payload.Offset);
 
-		if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
-		{
-			ProcessOrQueueIncomingRPC(ObjectRef, MoveTemp(Payload));
-		}
-
+		ProcessOrQueueIncomingRPC(ObjectRef, MoveTemp(Payload));
 	}
+	EndIncomingRPCBatch();
 }
 
 void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
@@ -1736,7 +2114,9 @@ void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
 			return;
 		}
 	}
+	BeginIncomingRPCBatch();
 	RPCService->ExtractRPCsForEntity(Op.entity_id, Op.update.component_id);
+	EndIncomingRPCBatch();
 }
 
 void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
@@ -1761,6 +2141,19 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 		NetDriver->PlayerSpawner->ReceiveForwardedPlayerSpawnRequest(Op);
 		return;
 	}
+	else if ((Op.request.component_id == SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID && CommandIndex == SpatialConstants::LEVEL_TOMBSTONES_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID)
+		|| (Op.request.component_id == SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID && CommandIndex == SpatialConstants::STARTUP_ACTOR_MANAGER_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID))
+	{
+		if (NetDriver->StartupActorTombstones.IsValid())
+		{
+			NetDriver->StartupActorTombstones->OnTombstoneStartupActorsRequest(Op);
+		}
+		else
+		{
+			Sender->SendCommandFailure(Op.request_id, TEXT("bCompactStartupActorTombstones is disabled on this worker."));
+		}
+		return;
+	}
 	else if (Op.request.component_id == SpatialConstants::RPCS_ON_ENTITY_CREATION_ID && CommandIndex == SpatialConstants::CLEAR_RPCS_ON_ENTITY_CREATION)
 	{
 		Sender->ClearRPCsOnEntityCreation(Op.entity_id);
@@ -1803,6 +2196,12 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 
 	Schema_Object* RequestObject = Schema_GetCommandRequestObject(Op.request.schema_type);
 
+	if (Schema_GetBytesCount(RequestObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID) > 0)
+	{
+		ReceivePackedCommandRPCs(Op, RequestObject);
+		return;
+	}
+
 	RPCPayload Payload(RequestObject);
 	FUnrealObjectRef ObjectRef = FUnrealObjectRef(Op.entity_id, Payload.Offset);
 	UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get();
@@ -1824,6 +2223,34 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 	Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
 }
 
+void USpatialReceiver::ReceivePackedCommandRPCs(const Worker_CommandRequestOp& Op, Schema_Object* RequestObject)
+{
+	TArray<RPCPayload> Payloads;
+	RPCRingBufferUtils::ReadPackedRPCs(GetBytesViewFromSchema(RequestObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID), Payloads);
+
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Received command request with %d packed RPCs (entity: %lld, component: %d)"),
+		Payloads.Num(), Op.entity_id, Op.request.component_id);
+
+	// Queued in the order they were packed, the container keeps that order for RPCs of the same type on the entity.
+	// As with a single command RPC, an RPC whose target object isn't resolved on this worker is dropped.
+	BeginIncomingRPCBatch();
+	for (RPCPayload& Payload : Payloads)
+	{
+		const FUnrealObjectRef ObjectRef(Op.entity_id, Payload.Offset);
+		UObject* TargetObject = nullptr;
+		const FClassInfo* TargetClassInfo = nullptr;
+		if (!ResolveIncomingRPCTarget(ObjectRef, TargetObject, TargetClassInfo))
+		{
+			UE_LOG(LogSpatialReceiver, Warning, TEXT("No target object found for packed RPC (entity: %lld, offset: %u)"), Op.entity_id, Payload.Offset);
+			continue;
+		}
+
+		ProcessOrQueueIncomingRPC(ObjectRef, MoveTemp(Payload));
+	}
+	EndIncomingRPCBatch();
+	Sender->SendEmptyCommandResponse(Op.request.component_id, Op.request.command_index, Op.request_id);
+}
+
 void USpatialReceiver::OnCommandResponse(const Worker_CommandResponseOp& Op)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverCommandResponse);
@@ -1837,6 +2264,15 @@ void USpatialReceiver::OnCommandResponse(const Worker_CommandResponseOp& Op)
 		NetDriver->PlayerSpawner->ReceiveForwardPlayerSpawnResponse(Op);
 		return;
 	}
+	else if ((Op.response.component_id == SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID && Op.response.command_index == SpatialConstants::LEVEL_TOMBSTONES_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID)
+		|| (Op.response.component_id == SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID && Op.response.command_index == SpatialConstants::STARTUP_ACTOR_MANAGER_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID))
+	{
+		if (NetDriver->StartupActorTombstones.IsValid())
+		{
+			NetDriver->StartupActorTombstones->OnTombstoneStartupActorsResponse(Op);
+		}
+		return;
+	}
 
 	ReceiveCommandResponse(Op);
 }
@@ -1857,6 +2293,7 @@ void USpatialReceiver::ReceiveCommandResponse(const Worker_CommandResponseOp& Op
 
 	TSharedRef<FReliableRPCForRetry> ReliableRPC = *ReliableRPCPtr;
 	PendingReliableRPCs.Remove(Op.request_id);
+	Sender->OnReliableRPCResponse(*ReliableRPC);
 	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 	{
 		bool bCanRetry = false;
@@ -1875,10 +2312,6 @@ void USpatialReceiver::ReceiveCommandResponse(const Worker_CommandResponseOp& Op
 
 		if (bCanRetry)
 		{
-			float WaitTime = SpatialConstants::GetCommandRetryWaitTimeSeconds(ReliableRPC->Attempts);
-			UE_LOG(LogSpatialReceiver, Log, TEXT("%s: retrying in %f seconds. Error code: %d Message: %s"),
-				*ReliableRPC->Function->GetName(), WaitTime, (int)Op.status_code, UTF8_TO_TCHAR(Op.message));
-
 			if (!ReliableRPC->TargetObject.IsValid())
 			{
 				UE_LOG(LogSpatialReceiver, Warning, TEXT("%s: target object was destroyed before we could deliver the RPC."),
@@ -1886,15 +2319,19 @@ void USpatialReceiver::ReceiveCommandResponse(const Worker_CommandResponseOp& Op
 				return;
 			}
 
-			// Queue retry
-			FTimerHandle RetryTimer;
-			TimerManager->SetTimer(RetryTimer, [WeakSender = TWeakObjectPtr<USpatialSender>(Sender), ReliableRPC]()
+			// The sender's retry queue applies the backoff, and drops the retry if one is already scheduled for this RPC.
+			const float WaitTime = Sender->EnqueueRetryRPC(ReliableRPC);
+			UE_CLOG(WaitTime >= 0.0f, LogSpatialReceiver, Log, TEXT("%s: retrying in %f seconds. Error code: %d Message: %s"),
+				*ReliableRPC->Function->GetName(), WaitTime, (int)Op.status_code, UTF8_TO_TCHAR(Op.message));
+		}
+		else if (ReliableRPC->PackedFunctions.Num() > 0)
+		{
+			// Report each RPC in a failed batch, as they were sent together.
+			for (UFunction* PackedFunction : ReliableRPC->PackedFunctions)
 			{
-				if (USpatialSender* SpatialSender = WeakSender.Get())
-				{
-					SpatialSender->EnqueueRetryRPC(ReliableRPC);
-				}
-			}, WaitTime, false);
+				UE_LOG(LogSpatialReceiver, Error, TEXT("%s: failed too many times as part of a batch of %d RPCs, giving up (%u attempts). Error code: %d Message: %s"),
+					*PackedFunction->GetName(), ReliableRPC->PackedFunctions.Num(), SpatialConstants::MAX_NUMBER_COMMAND_ATTEMPTS, (int)Op.status_code, UTF8_TO_TCHAR(Op.message));
+			}
 		}
 		else
 		{
@@ -1927,7 +2364,8 @@ void USpatialReceiver::ApplyComponentUpdate(const Worker_ComponentUpdate& Compon
 	}
 }
 
-ERPCResult USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, const FString& SenderWorkerId, bool bApplyWithUnresolvedRefs /* = false */)
+ERPCResult USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, const FString& SenderWorkerId, bool bApplyWithUnresolvedRefs /* = false */,
+	TArray<FUnrealObjectRef>* OutUnresolvedRefs /* = nullptr */)
 {
 	ERPCResult Result = ERPCResult::Unknown;
 
@@ -1936,8 +2374,8 @@ ERPCResult USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction*
 
 	TSet<FUnrealObjectRef> UnresolvedRefs;
 	TSet<FUnrealObjectRef> MappedRefs;
-	RPCPayload PayloadCopy = Payload;
-	FSpatialNetBitReader PayloadReader(PackageMap, PayloadCopy.PayloadData.GetData(), PayloadCopy.CountDataBits(), MappedRefs, UnresolvedRefs);
+	// The reader copies the data into its own buffer, so the payload doesn't need copying first.
+	FSpatialNetBitReader PayloadReader(PackageMap, const_cast<uint8*>(Payload.PayloadData.GetData()), Payload.CountDataBits(), MappedRefs, UnresolvedRefs);
 
 	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
 	RepLayout_ReceivePropertiesForRPC(*RepLayout, PayloadReader, Parms);
@@ -1950,6 +2388,10 @@ ERPCResult USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction*
 	else
 	{
 		Result = ERPCResult::UnresolvedParameters;
+		if (OutUnresolvedRefs != nullptr)
+		{
+			*OutUnresolvedRefs = UnresolvedRefs.Array();
+		}
 	}
 
 	// Destroy the parameters.
@@ -1965,14 +2407,14 @@ FRPCErrorInfo USpatialReceiver::ApplyRPC(const FPendingRPCParams& Params)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverApplyRPC);
 
-	TWeakObjectPtr<UObject> TargetObjectWeakPtr = PackageMap->GetObjectFromUnrealObjectRef(Params.ObjectRef);
-	if (!TargetObjectWeakPtr.IsValid())
+	UObject* TargetObject = nullptr;
+	const FClassInfo* TargetClassInfo = nullptr;
+	if (!ResolveIncomingRPCTarget(Params.ObjectRef, TargetObject, TargetClassInfo))
 	{
 		return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedTargetObject };
 	}
 
-	UObject* TargetObject = TargetObjectWeakPtr.Get();
-	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObjectWeakPtr.Get());
+	const FClassInfo& ClassInfo = *TargetClassInfo;
 	UFunction* Function = ClassInfo.RPCs[Params.Payload.Index];
 	if (Function == nullptr)
 	{
@@ -1985,14 +2427,15 @@ FRPCErrorInfo USpatialReceiver::ApplyRPC(const FPendingRPCParams& Params)
 	{
 		if ((Function->SpatialFunctionFlags & SPATIALFUNC_AllowUnresolvedParameters) == 0)
 		{
-			UE_LOG(LogSpatialReceiver, Warning, TEXT("Executing RPC %s::%s with unresolved references after %f seconds of queueing"), *TargetObjectWeakPtr->GetName(), *Function->GetName(), TimeDiff);
+			UE_LOG(LogSpatialReceiver, Warning, TEXT("Executing RPC %s::%s with unresolved references after %f seconds of queueing"), *TargetObject->GetName(), *Function->GetName(), TimeDiff);
 		}
 		bApplyWithUnresolvedRefs = true;
 	}
 
-	ERPCResult Result = ApplyRPCInternal(TargetObject, Function, Params.Payload, FString{}, bApplyWithUnresolvedRefs);
+	FRPCErrorInfo ErrorInfo{ TargetObject, Function };
+	ErrorInfo.ErrorCode = ApplyRPCInternal(TargetObject, Function, Params.Payload, FString{}, bApplyWithUnresolvedRefs, &ErrorInfo.UnresolvedRefs);
 
-	return FRPCErrorInfo{ TargetObject, Function, Result };
+	return ErrorInfo;
 }
 
 void USpatialReceiver::OnReserveEntityIdsResponse(const Worker_ReserveEntityIdsResponseOp& Op)
@@ -2049,6 +2492,11 @@ void USpatialReceiver::OnCreateEntityResponse(const Worker_CreateEntityResponseO
 		CreateEntityDelegates.Remove(Op.request_id);
 	}
 
+	if (EntityCreationLimiter.IsValid())
+	{
+		EntityCreationLimiter->OnResponse(Op.request_id, static_cast<Worker_StatusCode>(Op.status_code), FPlatformTime::Seconds());
+	}
+
 	TWeakObjectPtr<USpatialActorChannel> Channel = PopPendingActorRequest(Op.request_id);
 
 	// It's possible for the ActorChannel to have been closed by the time we receive a response. Actor validity is checked within the channel.
@@ -2064,6 +2512,21 @@ void USpatialReceiver::OnCreateEntityResponse(const Worker_CreateEntityResponseO
 	}
 }
 
+void USpatialReceiver::OnDeleteEntityResponse(const Worker_DeleteEntityResponseOp& Op)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ReceiverDeleteEntityResponse);
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Delete entity request failed: request id: %d, entity id: %lld, message: %s"), Op.request_id, Op.entity_id, UTF8_TO_TCHAR(Op.message));
+	}
+
+	if (DeleteEntityDelegate* Delegate = DeleteEntityDelegates.Find(Op.request_id))
+	{
+		Delegate->ExecuteIfBound(Op);
+		DeleteEntityDelegates.Remove(Op.request_id);
+	}
+}
+
 void USpatialReceiver::OnEntityQueryResponse(const Worker_EntityQueryResponseOp& Op)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverEntityQueryResponse);
@@ -2072,7 +2535,11 @@ void USpatialReceiver::OnEntityQueryResponse(const Worker_EntityQueryResponseOp&
 		UE_LOG(LogSpatialReceiver, Error, TEXT("EntityQuery failed: request id: %d, message: %s"), Op.request_id, UTF8_TO_TCHAR(Op.message));
 	}
 
-	if (EntityQueryDelegate* RequestDelegate = EntityQueryDelegates.Find(Op.request_id))
+	if (EntityQueryCache.OnQueryResponse(Op, FPlatformTime::Seconds()))
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Executed EntityQueryResponse with shared delegates, request id: %d, number of entities: %d, message: %s"), Op.request_id, Op.result_count, UTF8_TO_TCHAR(Op.message));
+	}
+	else if (EntityQueryDelegate* RequestDelegate = EntityQueryDelegates.Find(Op.request_id))
 	{
 		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Executing EntityQueryResponse with delegate, request id: %d, number of entities: %d, message: %s"), Op.request_id, Op.result_count, UTF8_TO_TCHAR(Op.message));
 		RequestDelegate->ExecuteIfBound(Op);
@@ -2086,6 +2553,25 @@ void USpatialReceiver::OnEntityQueryResponse(const Worker_EntityQueryResponseOp&
 void USpatialReceiver::AddPendingActorRequest(Worker_RequestId RequestId, USpatialActorChannel* Channel)
 {
 	PendingActorRequests.Add(RequestId, Channel);
+
+	if (EntityCreationLimiter.IsValid())
+	{
+		EntityCreationLimiter->OnRequestSent(RequestId, FPlatformTime::Seconds());
+	}
+}
+
+void USpatialReceiver::DropPendingReliableRPCs(Worker_EntityId EntityId)
+{
+	// The target actor is destroyed with the entity, so these can't be retried, and they stop counting towards
+	// MaxReliableRPCRetriesInFlight now rather than once the commands time out.
+	for (auto It = PendingReliableRPCs.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->EntityId == EntityId)
+		{
+			Sender->OnReliableRPCResponse(*It.Value());
+			It.RemoveCurrent();
+		}
+	}
 }
 
 void USpatialReceiver::AddPendingReliableRPC(Worker_RequestId RequestId, TSharedRef<FReliableRPCForRetry> ReliableRPC)
@@ -2098,6 +2584,38 @@ void USpatialReceiver::AddEntityQueryDelegate(Worker_RequestId RequestId, Entity
 	EntityQueryDelegates.Add(RequestId, MoveTemp(Delegate));
 }
 
+void USpatialReceiver::SendEntityQuery(const Worker_EntityQuery& Query, EntityQueryDelegate Delegate, float CacheLifetimeSeconds)
+{
+	const FString QueryKey = SpatialGDK::FEntityQueryCache::GetQueryKey(Query);
+
+	const bool bHadQueuedDelegates = EntityQueryCache.HasQueuedDelegates();
+	if (CacheLifetimeSeconds > 0.f && EntityQueryCache.QueueCachedResponse(QueryKey, CacheLifetimeSeconds, FPlatformTime::Seconds(), Delegate))
+	{
+		if (bHadQueuedDelegates)
+		{
+			return;
+		}
+
+		// Executed on the next tick, so callers see the same order of events as when the query is sent.
+		TimerManager->SetTimerForNextTick([WeakThis = TWeakObjectPtr<USpatialReceiver>(this)]()
+		{
+			if (USpatialReceiver* Receiver = WeakThis.Get())
+			{
+				Receiver->EntityQueryCache.ExecuteQueuedDelegates();
+			}
+		});
+		return;
+	}
+
+	if (EntityQueryCache.AddToInFlightQuery(QueryKey, Delegate, CacheLifetimeSeconds))
+	{
+		return;
+	}
+
+	const Worker_RequestId RequestId = NetDriver->Connection->SendEntityQueryRequest(&Query);
+	EntityQueryCache.OnQuerySent(QueryKey, RequestId, MoveTemp(Delegate), CacheLifetimeSeconds);
+}
+
 void USpatialReceiver::AddReserveEntityIdsDelegate(Worker_RequestId RequestId, ReserveEntityIDsDelegate Delegate)
 {
 	ReserveEntityIDsDelegates.Add(RequestId, MoveTemp(Delegate));
@@ -2108,6 +2626,11 @@ void USpatialReceiver::AddCreateEntityDelegate(Worker_RequestId RequestId, Creat
 	CreateEntityDelegates.Add(RequestId, MoveTemp(Delegate));
 }
 
+void USpatialReceiver::AddDeleteEntityDelegate(Worker_RequestId RequestId, DeleteEntityDelegate Delegate)
+{
+	DeleteEntityDelegates.Add(RequestId, MoveTemp(Delegate));
+}
+
 TWeakObjectPtr<USpatialActorChannel> USpatialReceiver::PopPendingActorRequest(Worker_RequestId RequestId)
 {
 	TWeakObjectPtr<USpatialActorChannel>* ChannelPtr = PendingActorRequests.Find(RequestId);
@@ -2131,12 +2654,57 @@ void USpatialReceiver::ProcessQueuedActorRPCsOnEntityCreation(Worker_EntityId En
 
 void USpatialReceiver::OnDisconnect(Worker_DisconnectOp& Op)
 {
+	if (NetDriver->TryBeginClientRejoin(Op.connection_status_code, UTF8_TO_TCHAR(Op.reason)))
+	{
+		return;
+	}
+
 	if (GEngine != nullptr)
 	{
 		GEngine->BroadcastNetworkFailure(NetDriver->GetWorld(), NetDriver, ENetworkFailure::FromDisconnectOpStatusCode(Op.connection_status_code), UTF8_TO_TCHAR(Op.reason));
 	}
 }
 
+void USpatialReceiver::OnClientRejoinStarted()
+{
+	// The ops of a critical section cut short by the disconnect are sent again on the new connection.
+	bInCriticalSection = false;
+	PendingAddActors.Empty();
+	PendingOpsByEntity.Empty();
+
+	// Request IDs start over on the new connection, so responses to the old requests would be mistaken for new ones.
+	EntityQueryDelegates.Empty();
+	EntityQueryCache.ClearInFlightQueries();
+	ReserveEntityIDsDelegates.Empty();
+	CreateEntityDelegates.Empty();
+	DeleteEntityDelegates.Empty();
+
+	TArray<Worker_EntityId_Key> EntityIds;
+	StaticComponentView->GetEntityIds(EntityIds);
+	RejoinCachedEntities = TSet<Worker_EntityId_Key>(EntityIds);
+	RejoinedEntities.Empty();
+	LastRejoinedEntityTime = 0.0;
+}
+
+void USpatialReceiver::FinishClientRejoinReconcile()
+{
+	UE_LOG(LogSpatialReceiver, Log, TEXT("Rejoin reconciled, removing %d entities which weren't checked out again."), RejoinCachedEntities.Num());
+
+	for (const Worker_EntityId_Key EntityId : RejoinCachedEntities)
+	{
+		// The same as the entity leaving view, without the ops for it.
+		RemoveActor(EntityId);
+
+		const Worker_RemoveEntityOp RemoveEntityOp{ EntityId };
+		OnRemoveEntity(RemoveEntityOp);
+		StaticComponentView->OnRemoveEntity(EntityId);
+		DropQueuedRemoveComponentOpsForEntity(EntityId);
+	}
+
+	RejoinCachedEntities.Empty();
+	RejoinedEntities.Empty();
+}
+
 bool USpatialReceiver::IsPendingOpsOnChannel(USpatialActorChannel& Channel)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialPendingOpsOnChannel);
@@ -2167,17 +2735,68 @@ void USpatialReceiver::ClearPendingRPCs(Worker_EntityId EntityId)
 	IncomingRPCs.DropForEntity(EntityId);
 }
 
+void USpatialReceiver::BeginIncomingRPCBatch()
+{
+	IncomingRPCBatchDepth++;
+}
+
+void USpatialReceiver::EndIncomingRPCBatch()
+{
+	check(IncomingRPCBatchDepth > 0);
+	if (--IncomingRPCBatchDepth > 0)
+	{
+		return;
+	}
+
+	LastIncomingRPCTarget = FIncomingRPCTarget();
+
+	if (IncomingRPCBatchCount > 0 && NetDriver->SpatialMetrics != nullptr)
+	{
+		NetDriver->SpatialMetrics->TrackReceivedRPCs(IncomingRPCBatchCount);
+	}
+	IncomingRPCBatchCount = 0;
+}
+
+bool USpatialReceiver::ResolveIncomingRPCTarget(const FUnrealObjectRef& ObjectRef, UObject*& OutTargetObject, const FClassInfo*& OutClassInfo)
+{
+	if (IncomingRPCBatchDepth > 0 && LastIncomingRPCTarget.ClassInfo != nullptr && LastIncomingRPCTarget.ObjectRef == ObjectRef)
+	{
+		// The object may have been destroyed by an RPC applied earlier in the batch.
+		if (UObject* CachedObject = LastIncomingRPCTarget.Object.Get())
+		{
+			OutTargetObject = CachedObject;
+			OutClassInfo = LastIncomingRPCTarget.ClassInfo;
+			return true;
+		}
+	}
+
+	UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get();
+	if (TargetObject == nullptr)
+	{
+		return false;
+	}
+
+	OutTargetObject = TargetObject;
+	OutClassInfo = &ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+
+	if (IncomingRPCBatchDepth > 0)
+	{
+		LastIncomingRPCTarget = FIncomingRPCTarget{ ObjectRef, TargetObject, OutClassInfo };
+	}
+	return true;
+}
+
 void USpatialReceiver::ProcessOrQueueIncomingRPC(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload InPayload)
 {
-	TWeakObjectPtr<UObject> TargetObjectWeakPtr = PackageMap->GetObjectFromUnrealObjectRef(InTargetObjectRef);
-	if (!TargetObjectWeakPtr.IsValid())
+	UObject* TargetObject = nullptr;
+	const FClassInfo* TargetClassInfo = nullptr;
+	if (!ResolveIncomingRPCTarget(InTargetObjectRef, TargetObject, TargetClassInfo))
 	{
 		UE_LOG(LogSpatialReceiver, Verbose, TEXT("The object has been deleted, dropping the RPC"));
 		return;
 	}
 
-	UObject* TargetObject = TargetObjectWeakPtr.Get();
-	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+	const FClassInfo& ClassInfo = *TargetClassInfo;
 
 	if (InPayload.Index >= static_cast<uint32>(ClassInfo.RPCs.Num()))
 	{
@@ -2195,6 +2814,11 @@ void USpatialReceiver::ProcessOrQueueIncomingRPC(const FUnrealObjectRef& InTarge
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 	ERPCType Type = RPCInfo.Type;
 
+	if (IncomingRPCBatchDepth > 0)
+	{
+		IncomingRPCBatchCount++;
+	}
+
 	IncomingRPCs.ProcessOrQueueRPC(InTargetObjectRef, Type, MoveTemp(InPayload));
 }
 
@@ -2219,10 +2843,13 @@ void USpatialReceiver::ResolvePendingOperations(UObject* Object, const FUnrealOb
 		if (ClassObjectRef.IsValid())
 		{
 			ResolveIncomingOperations(Object, ClassObjectRef);
+			IncomingRPCs.OnObjectRefResolved(ClassObjectRef);
 		}
 	}
 
-	// TODO: UNR-1650 We're trying to resolve all queues, which introduces more overhead.
+	// Only RPCs targeting this entity or waiting for this object as a parameter are retried.
+	IncomingRPCs.MarkEntityReady(ObjectRef.Entity);
+	IncomingRPCs.OnObjectRefResolved(ObjectRef);
 	IncomingRPCs.ProcessRPCs();
 }
 
@@ -2296,7 +2923,7 @@ void USpatialReceiver::ResolveIncomingOperations(UObject* Object, const FUnrealO
 			DependentChannel->ResetShadowData(RepLayout, ShadowData, ReplicatingObject);
 		}
 
-		ResolveObjectReferences(RepLayout, ReplicatingObject, *RepState, RepState->ReferenceMap, ShadowData.GetData(), (uint8*)ReplicatingObject, ReplicatingObject->GetClass()->GetPropertiesSize(), RepNotifies, bSomeObjectsWereMapped);
+		ResolveObjectReferences(RepLayout, ReplicatingObject, *RepState, RepState->ReferenceMap, ShadowData.GetData(), (uint8*)ReplicatingObject, ReplicatingObject->GetClass()->GetPropertiesSize(), RepNotifies, bSomeObjectsWereMapped, RepState->RefToReferenceMapOffsets.Find(ObjectRef));
 
 		if (bSomeObjectsWereMapped)
 		{
@@ -2310,132 +2937,168 @@ void USpatialReceiver::ResolveIncomingOperations(UObject* Object, const FUnrealO
 	}
 }
 
-void USpatialReceiver::ResolveObjectReferences(FRepLayout& RepLayout, UObject* ReplicatedObject, FSpatialObjectRepState& RepState, FObjectReferencesMap& ObjectReferencesMap, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped)
+void USpatialReceiver::ResolveObjectReferences(FRepLayout& RepLayout, UObject* ReplicatedObject, FSpatialObjectRepState& RepState, FObjectReferencesMap& ObjectReferencesMap, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped, const TArray<int32>* OffsetsToResolve /*= nullptr*/)
 {
-	for (auto It = ObjectReferencesMap.CreateIterator(); It; ++It)
+	if (OffsetsToResolve != nullptr)
 	{
-		int32 AbsOffset = It.Key();
+		// Only visit the entries known to hold the reference being resolved.
+		for (int32 AbsOffset : *OffsetsToResolve)
+		{
+			FObjectReferences* ObjectReferences = ObjectReferencesMap.Find(AbsOffset);
+			if (ObjectReferences != nullptr && !ResolveObjectReference(RepLayout, ReplicatedObject, RepState, AbsOffset, *ObjectReferences, StoredData, Data, MaxAbsOffset, RepNotifies, bOutSomeObjectsWereMapped))
+			{
+				ObjectReferencesMap.Remove(AbsOffset);
+			}
+		}
+		return;
+	}
 
-		if (AbsOffset >= MaxAbsOffset)
+	for (auto It = ObjectReferencesMap.CreateIterator(); It; ++It)
+	{
+		if (!ResolveObjectReference(RepLayout, ReplicatedObject, RepState, It.Key(), It.Value(), StoredData, Data, MaxAbsOffset, RepNotifies, bOutSomeObjectsWereMapped))
 		{
-			UE_LOG(LogSpatialReceiver, Error, TEXT("ResolveObjectReferences: Removed unresolved reference: AbsOffset >= MaxAbsOffset: %d"), AbsOffset);
 			It.RemoveCurrent();
-			continue;
 		}
+	}
+}
 
-		FObjectReferences& ObjectReferences = It.Value();
+bool USpatialReceiver::ResolveObjectReference(FRepLayout& RepLayout, UObject* ReplicatedObject, FSpatialObjectRepState& RepState, int32 AbsOffset, FObjectReferences& ObjectReferences, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped)
+{
+	if (AbsOffset >= MaxAbsOffset)
+	{
+		UE_LOG(LogSpatialReceiver, Error, TEXT("ResolveObjectReferences: Removed unresolved reference: AbsOffset >= MaxAbsOffset: %d"), AbsOffset);
+		return false;
+	}
+
+	UProperty* Property = ObjectReferences.Property;
 
-		UProperty* Property = ObjectReferences.Property;
+	// ParentIndex is -1 for handover properties
+	bool bIsHandover = ObjectReferences.ParentIndex == -1;
+	FRepParentCmd* Parent = ObjectReferences.ParentIndex >= 0 ? &RepLayout.Parents[ObjectReferences.ParentIndex] : nullptr;
 
-		// ParentIndex is -1 for handover properties
-		bool bIsHandover = ObjectReferences.ParentIndex == -1;
-		FRepParentCmd* Parent = ObjectReferences.ParentIndex >= 0 ? &RepLayout.Parents[ObjectReferences.ParentIndex] : nullptr;
+	int32 StoredDataOffset = ObjectReferences.ShadowOffset;
 
-		int32 StoredDataOffset = ObjectReferences.ShadowOffset;
+	if (ObjectReferences.Array)
+	{
+		UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+		check(ArrayProperty != nullptr);
 
-		if (ObjectReferences.Array)
+		if (!bIsHandover)
 		{
-			UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
-			check(ArrayProperty != nullptr);
+			Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
+		}
 
-			if (!bIsHandover)
-			{
-				Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
-			}
+		FScriptArray* StoredArray = bIsHandover ? nullptr : (FScriptArray*)(StoredData + StoredDataOffset);
+		FScriptArray* Array = (FScriptArray*)(Data + AbsOffset);
 
-			FScriptArray* StoredArray = bIsHandover ? nullptr : (FScriptArray*)(StoredData + StoredDataOffset);
-			FScriptArray* Array = (FScriptArray*)(Data + AbsOffset);
+		int32 NewMaxOffset = Array->Num() * ArrayProperty->Inner->ElementSize;
 
-			int32 NewMaxOffset = Array->Num() * ArrayProperty->Inner->ElementSize;
+		ResolveObjectReferences(RepLayout, ReplicatedObject, RepState, *ObjectReferences.Array, bIsHandover ? nullptr : (uint8*)StoredArray->GetData(), (uint8*)Array->GetData(), NewMaxOffset, RepNotifies, bOutSomeObjectsWereMapped);
+		return true;
+	}
 
-			ResolveObjectReferences(RepLayout, ReplicatedObject, RepState, *ObjectReferences.Array, bIsHandover ? nullptr : (uint8*)StoredArray->GetData(), (uint8*)Array->GetData(), NewMaxOffset, RepNotifies, bOutSomeObjectsWereMapped);
-			continue;
-		}
+	bool bResolvedSomeRefs = false;
+	UObject* SinglePropObject = nullptr;
+	FUnrealObjectRef SinglePropRef = FUnrealObjectRef::NULL_OBJECT_REF;
 
-		bool bResolvedSomeRefs = false;
-		UObject* SinglePropObject = nullptr;
-		FUnrealObjectRef SinglePropRef = FUnrealObjectRef::NULL_OBJECT_REF;
+	for (auto UnresolvedIt = ObjectReferences.UnresolvedRefs.CreateIterator(); UnresolvedIt; ++UnresolvedIt)
+	{
+		FUnrealObjectRef& ObjectRef = *UnresolvedIt;
 
-		for (auto UnresolvedIt = ObjectReferences.UnresolvedRefs.CreateIterator(); UnresolvedIt; ++UnresolvedIt)
+		bool bUnresolved = false;
+		UObject* Object = FUnrealObjectRef::ToObjectPtr(ObjectRef, PackageMap, bUnresolved);
+		if (!bUnresolved)
 		{
-			FUnrealObjectRef& ObjectRef = *UnresolvedIt;
+			check(Object != nullptr);
 
-			bool bUnresolved = false;
-			UObject* Object = FUnrealObjectRef::ToObjectPtr(ObjectRef, PackageMap, bUnresolved);
-			if (!bUnresolved)
-			{
-				check(Object != nullptr);
-
-				UE_LOG(LogSpatialReceiver, Verbose, TEXT("ResolveObjectReferences: Resolved object ref: Offset: %d, Object ref: %s, PropName: %s, ObjName: %s"), AbsOffset, *ObjectRef.ToString(), *Property->GetNameCPP(), *Object->GetName());
+			UE_LOG(LogSpatialReceiver, Verbose, TEXT("ResolveObjectReferences: Resolved object ref: Offset: %d, Object ref: %s, PropName: %s, ObjName: %s"), AbsOffset, *ObjectRef.ToString(), *Property->GetNameCPP(), *Object->GetName());
 
-				if (ObjectReferences.bSingleProp)
-				{
-					SinglePropObject = Object;
-					SinglePropRef = ObjectRef;
-				}
+			if (ObjectReferences.bSingleProp)
+			{
+				SinglePropObject = Object;
+				SinglePropRef = ObjectRef;
+			}
 
-				UnresolvedIt.RemoveCurrent();
+			UnresolvedIt.RemoveCurrent();
 
-				bResolvedSomeRefs = true;
-			}
+			bResolvedSomeRefs = true;
 		}
+	}
 
-		if (bResolvedSomeRefs)
+	if (bResolvedSomeRefs)
+	{
+		if (!bOutSomeObjectsWereMapped)
 		{
-			if (!bOutSomeObjectsWereMapped)
-			{
-				ReplicatedObject->PreNetReceive();
-				bOutSomeObjectsWereMapped = true;
-			}
+			ReplicatedObject->PreNetReceive();
+			bOutSomeObjectsWereMapped = true;
+		}
 
-			if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
-			{
-				Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
-			}
+		if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
+		{
+			Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
+		}
 
-			if (ObjectReferences.bSingleProp)
-			{
-				UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property);
-				check(ObjectProperty);
+		if (ObjectReferences.bSingleProp)
+		{
+			UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property);
+			check(ObjectProperty);
 
-				ObjectProperty->SetObjectPropertyValue(Data + AbsOffset, SinglePropObject);
-				ObjectReferences.MappedRefs.Add(SinglePropRef);
-			}
-			else if (ObjectReferences.bFastArrayProp)
-			{
-				TSet<FUnrealObjectRef> NewMappedRefs;
-				TSet<FUnrealObjectRef> NewUnresolvedRefs;
-				FSpatialNetBitReader ValueDataReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewMappedRefs, NewUnresolvedRefs);
+			ObjectProperty->SetObjectPropertyValue(Data + AbsOffset, SinglePropObject);
+			ObjectReferences.MappedRefs.Add(SinglePropRef);
+		}
+		else if (ObjectReferences.bFastArrayProp)
+		{
+			TSet<FUnrealObjectRef> NewMappedRefs;
+			TSet<FUnrealObjectRef> NewUnresolvedRefs;
+			FSpatialNetBitReader ValueDataReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewMappedRefs, NewUnresolvedRefs);
 
-				check(Property->IsA<UArrayProperty>());
-				UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(Cast<UArrayProperty>(Property));
+			check(Property->IsA<UArrayProperty>());
+			UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(Cast<UArrayProperty>(Property));
 
-				FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, ReplicatedObject, Parent->ArrayIndex, Parent->Property, NetDeltaStruct);
+			FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, ReplicatedObject, Parent->ArrayIndex, Parent->Property, NetDeltaStruct);
 
-				ObjectReferences.MappedRefs.Append(NewMappedRefs);
-			}
-			else
-			{
-				TSet<FUnrealObjectRef> NewMappedRefs;
-				TSet<FUnrealObjectRef> NewUnresolvedRefs;
-				FSpatialNetBitReader BitReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewMappedRefs, NewUnresolvedRefs);
-				check(Property->IsA<UStructProperty>());
+			ObjectReferences.MappedRefs.Append(NewMappedRefs);
+		}
+		else
+		{
+			TSet<FUnrealObjectRef> NewMappedRefs;
+			TSet<FUnrealObjectRef> NewUnresolvedRefs;
+			FSpatialNetBitReader BitReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewMappedRefs, NewUnresolvedRefs);
+			check(Property->IsA<UStructProperty>());
 
-				bool bHasUnresolved = false;
-				ReadStructProperty(BitReader, Cast<UStructProperty>(Property), NetDriver, Data + AbsOffset, bHasUnresolved);
+			bool bHasUnresolved = false;
+			ReadStructProperty(BitReader, Cast<UStructProperty>(Property), NetDriver, Data + AbsOffset, bHasUnresolved);
 
-				ObjectReferences.MappedRefs.Append(NewMappedRefs);
-			}
+			ObjectReferences.MappedRefs.Append(NewMappedRefs);
+		}
 
-			if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
+		if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
+		{
+			if (Parent->RepNotifyCondition == REPNOTIFY_Always || !Property->Identical(StoredData + StoredDataOffset, Data + AbsOffset))
 			{
-				if (Parent->RepNotifyCondition == REPNOTIFY_Always || !Property->Identical(StoredData + StoredDataOffset, Data + AbsOffset))
-				{
-					RepNotifies.AddUnique(Parent->Property);
-				}
+				RepNotifies.AddUnique(Parent->Property);
 			}
 		}
 	}
+
+	return true;
+}
+
+void USpatialReceiver::SetHeartbeatComponentInterest(Worker_EntityId EntityId, bool bInterested)
+{
+	Worker_InterestOverride InterestOverride{};
+	InterestOverride.component_id = SpatialConstants::HEARTBEAT_COMPONENT_ID;
+	InterestOverride.is_interested = bInterested;
+	NetDriver->Connection->SendComponentInterest(EntityId, { InterestOverride });
+
+	if (bInterested)
+	{
+		HeartbeatInterestDisabledEntities.Remove(EntityId);
+	}
+	else
+	{
+		HeartbeatInterestDisabledEntities.Add(EntityId);
+	}
 }
 
 void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op)
@@ -2450,7 +3113,10 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 	if (ConnectionPtr == nullptr)
 	{
 		// Heartbeat component update on a PlayerController that this server does not have authority over.
-		// TODO: Disable component interest for Heartbeat components this server doesn't care about - UNR-986
+		if (GetDefault<USpatialGDKSettings>()->bAggregateServerHeartbeats && !HeartbeatInterestDisabledEntities.Contains(Op.entity_id))
+		{
+			SetHeartbeatComponentInterest(Op.entity_id, false);
+		}
 		return;
 	}
 
@@ -2473,6 +3139,16 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 		}
 
 		NetConnection->OnHeartbeat();
+
+		// Clients with a bandwidth budget report their throughput in their heartbeat events, the last one being the most recent.
+		Schema_Object* HeartbeatEventObject = Schema_IndexObject(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID, EventCount - 1);
+		if (Schema_GetFloatCount(HeartbeatEventObject, SpatialConstants::HEARTBEAT_EVENT_RECEIVED_BYTES_PER_SECOND_ID) > 0 &&
+			Schema_GetFloatCount(HeartbeatEventObject, SpatialConstants::HEARTBEAT_EVENT_BUDGET_BYTES_PER_SECOND_ID) > 0)
+		{
+			NetConnection->OnClientBandwidthReport(
+				Schema_GetFloat(HeartbeatEventObject, SpatialConstants::HEARTBEAT_EVENT_RECEIVED_BYTES_PER_SECOND_ID),
+				Schema_GetFloat(HeartbeatEventObject, SpatialConstants::HEARTBEAT_EVENT_BUDGET_BYTES_PER_SECOND_ID));
+		}
 	}
 
 	Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
@@ -2490,8 +3166,26 @@ void USpatialReceiver::CloseClientConnection(USpatialNetConnection* ClientConnec
 	AuthorityPlayerControllerConnectionMap.Remove(PlayerControllerEntityId);
 }
 
+void USpatialReceiver::CloseClientConnectionAfterRejoinGracePeriod(USpatialNetConnection* ClientConnection, Worker_EntityId PlayerControllerEntityId)
+{
+	// If the client rejoined as a new worker in the meantime, the connection has been handed to that worker and is kept.
+	const FString WorkerAttribute = ClientConnection->ConnectionOwningWorkerId;
+
+	FTimerHandle GracePeriodTimer;
+	TimerManager->SetTimer(GracePeriodTimer, [WeakThis = TWeakObjectPtr<USpatialReceiver>(this), WeakConnection = TWeakObjectPtr<USpatialNetConnection>(ClientConnection), PlayerControllerEntityId, WorkerAttribute]()
+	{
+		USpatialReceiver* Receiver = WeakThis.Get();
+		USpatialNetConnection* Connection = WeakConnection.Get();
+		if (Receiver != nullptr && Connection != nullptr && Connection->ConnectionOwningWorkerId == WorkerAttribute)
+		{
+			Receiver->CloseClientConnection(Connection, PlayerControllerEntityId);
+		}
+	}, GetDefault<USpatialGDKSettings>()->ClientRejoinGracePeriod, false);
+}
+
 void USpatialReceiver::PeriodicallyProcessIncomingRPCs()
 {
+	// Queued RPCs are retried when what they wait for resolves, this only wakes up the ones which timed out or don't know what they wait for.
 	FTimerHandle IncomingRPCsPeriodicProcessTimer;
 	TimerManager->SetTimer(IncomingRPCsPeriodicProcessTimer, [WeakThis = TWeakObjectPtr<USpatialReceiver>(this)]()
 	{
@@ -2555,6 +3249,7 @@ void USpatialReceiver::StartAsyncLoadingClass(const FString& ClassPath, Worker_E
 	AsyncLoadEntity.ClassPath = ClassPath;
 	AsyncLoadEntity.InitialPendingAddComponents = ExtractAddComponents(EntityId);
 	AsyncLoadEntity.PendingOps = ExtractAuthorityOps(EntityId);
+	AsyncLoadEntity.WaitStartTime = FPlatformTime::Seconds();
 
 	EntitiesWaitingForAsyncLoad.Emplace(EntityId, MoveTemp(AsyncLoadEntity));
 	AsyncLoadingPackages.FindOrAdd(PackagePathName).Add(EntityId);
@@ -2562,8 +3257,58 @@ void USpatialReceiver::StartAsyncLoadingClass(const FString& ClassPath, Worker_E
 	UE_LOG(LogSpatialReceiver, Log, TEXT("Async loading package %s for entity %lld. Already loading: %s"), *PackagePath, EntityId, bAlreadyLoading ? TEXT("true") : TEXT("false"));
 	if (!bAlreadyLoading)
 	{
-		LoadPackageAsync(PackagePath, FLoadPackageAsyncDelegate::CreateUObject(this, &USpatialReceiver::OnAsyncPackageLoaded));
+		if (GetDefault<USpatialGDKSettings>()->bBatchAsyncClassLoads)
+		{
+			PackagesToRequest.Add(PackagePathName);
+		}
+		else
+		{
+			LoadPackageAsync(PackagePath, FLoadPackageAsyncDelegate::CreateUObject(this, &USpatialReceiver::OnAsyncPackageLoaded));
+		}
+	}
+}
+
+void USpatialReceiver::RequestQueuedAsyncLoads()
+{
+	if (PackagesToRequest.Num() == 0)
+	{
+		return;
+	}
+
+	const uint32 BatchId = NextAsyncLoadBatchId++;
+	AsyncLoadBatch& Batch = AsyncLoadBatches.Add(BatchId);
+
+	TArray<FName> Packages = MoveTemp(PackagesToRequest);
+	PackagesToRequest.Reset();
+
+	// The batch is fully set up before any request is made, in case a callback is invoked immediately.
+	for (const FName& PackageName : Packages)
+	{
+		Batch.LoadingPackages.Add(PackageName);
+		PackageToAsyncLoadBatch.Add(PackageName, BatchId);
 	}
+
+	UE_LOG(LogSpatialReceiver, Log, TEXT("Async loading batch %u of %d packages."), BatchId, Packages.Num());
+
+	for (const FName& PackageName : Packages)
+	{
+		LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateUObject(this, &USpatialReceiver::OnAsyncPackageLoaded));
+	}
+}
+
+double USpatialReceiver::GetOldestAsyncLoadWaitTime() const
+{
+	double OldestWaitStartTime = 0.0;
+	for (const auto& WaitingEntityPair : EntitiesWaitingForAsyncLoad)
+	{
+		const EntityWaitingForAsyncLoad& WaitingEntity = WaitingEntityPair.Value;
+		if (!WaitingEntity.bWaitingForSpawnBudget && (OldestWaitStartTime == 0.0 || WaitingEntity.WaitStartTime < OldestWaitStartTime))
+		{
+			OldestWaitStartTime = WaitingEntity.WaitStartTime;
+		}
+	}
+
+	return OldestWaitStartTime == 0.0 ? 0.0 : FPlatformTime::Seconds() - OldestWaitStartTime;
 }
 
 void USpatialReceiver::OnAsyncPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
@@ -2575,32 +3320,215 @@ void USpatialReceiver::OnAsyncPackageLoaded(const FName& PackageName, UPackage*
 		return;
 	}
 
-	if (Result != EAsyncLoadingResult::Succeeded)
+	const bool bSucceeded = Result == EAsyncLoadingResult::Succeeded;
+	if (!bSucceeded)
 	{
 		UE_LOG(LogSpatialReceiver, Error, TEXT("USpatialReceiver::OnAsyncPackageLoaded: Package was not loaded successfully. Package: %s"), *PackageName.ToString());
+	}
+
+	uint32 BatchId = 0;
+	if (PackageToAsyncLoadBatch.RemoveAndCopyValue(PackageName, BatchId))
+	{
+		AsyncLoadBatch& Batch = AsyncLoadBatches.FindChecked(BatchId);
+		Batch.LoadingPackages.Remove(PackageName);
+		if (bSucceeded)
+		{
+			Batch.LoadedEntities.Append(Entities);
+		}
+
+		if (Batch.LoadingPackages.Num() > 0)
+		{
+			return;
+		}
+
+		TArray<Worker_EntityId> LoadedEntities = MoveTemp(Batch.LoadedEntities);
+		AsyncLoadBatches.Remove(BatchId);
+
+		UE_LOG(LogSpatialReceiver, Log, TEXT("Finished async loading batch %u, replaying ops for %d entities."), BatchId, LoadedEntities.Num());
+		ProcessEntitiesWithLoadedClasses(LoadedEntities);
 		return;
 	}
 
+	if (bSucceeded)
+	{
+		UE_LOG(LogSpatialReceiver, Log, TEXT("Finished async loading package %s for %d entities."), *PackageName.ToString(), Entities.Num());
+		ProcessEntitiesWithLoadedClasses(Entities);
+	}
+}
+
+void USpatialReceiver::ProcessEntitiesWithLoadedClasses(TArray<Worker_EntityId>& Entities)
+{
+	// Entities that left view while waiting are skipped.
+	Entities.RemoveAll([this](Worker_EntityId Entity)
+	{
+		const EntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(Entity);
+		return AsyncLoadEntity == nullptr || AsyncLoadEntity->bWaitingForSpawnBudget;
+	});
+
+	// Replay in checkout order, so entities arriving in a batch see each other in the same order as without async loading.
+	Entities.StableSort([this](Worker_EntityId A, Worker_EntityId B)
+	{
+		return EntitiesWaitingForAsyncLoad[A].WaitStartTime < EntitiesWaitingForAsyncLoad[B].WaitStartTime;
+	});
+
+	const double Now = FPlatformTime::Seconds();
 	for (Worker_EntityId Entity : Entities)
 	{
-		if (IsEntityWaitingForAsyncLoad(Entity))
+		// Processing an entity can remove others from view, so they are looked up again.
+		const EntityWaitingForAsyncLoad* AsyncLoadEntity = EntitiesWaitingForAsyncLoad.Find(Entity);
+		if (AsyncLoadEntity != nullptr && !AsyncLoadEntity->bWaitingForSpawnBudget)
+		{
+			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Replaying ops for entity %lld after waiting %.1f ms for class %s."), Entity, (Now - AsyncLoadEntity->WaitStartTime) * 1000.0, *AsyncLoadEntity->ClassPath);
+
+			ProcessEntityWaitingForAsyncLoad(Entity);
+		}
+	}
+}
+
+void USpatialReceiver::ProcessEntityWaitingForAsyncLoad(Worker_EntityId Entity)
+{
+	// Save critical section if we're in one and restore upon leaving this scope.
+	CriticalSectionSaveState CriticalSectionState(*this);
+
+	EntityWaitingForAsyncLoad AsyncLoadEntity = EntitiesWaitingForAsyncLoad.FindAndRemoveChecked(Entity);
+	PendingAddActors.Add(Entity);
+	CriticalSectionEntityOps& EntityOps = PendingOpsByEntity.Add(Entity);
+	EntityOps.AddComponents = MoveTemp(AsyncLoadEntity.InitialPendingAddComponents);
+	EntityOps.bAddActor = true;
+	LeaveCriticalSection();
+
+	for (QueuedOpForAsyncLoad& Op : AsyncLoadEntity.PendingOps)
+	{
+		HandleQueuedOpForAsyncLoad(Op);
+	}
+}
+
+void USpatialReceiver::DeferActorSpawn(Worker_EntityId EntityId, const FString& ClassPath, UClass* Class)
+{
+	if (IsEntityWaitingForAsyncLoad(EntityId))
+	{
+		UE_LOG(LogSpatialReceiver, Error, TEXT("USpatialReceiver::ReceiveActor: Checked out entity but it's already waiting to be spawned! Entity: %lld"), EntityId);
+	}
+
+	EntityWaitingForAsyncLoad DeferredEntity;
+	DeferredEntity.ClassPath = ClassPath;
+	DeferredEntity.InitialPendingAddComponents = ExtractAddComponents(EntityId);
+	DeferredEntity.PendingOps = ExtractAuthorityOps(EntityId);
+	DeferredEntity.bWaitingForSpawnBudget = true;
+	EntitiesWaitingForAsyncLoad.Emplace(EntityId, MoveTemp(DeferredEntity));
+
+	const SpawnData* SpawnDataComp = StaticComponentView->GetComponentData<SpawnData>(EntityId);
+	DeferredActorSpawns.Add({ EntityId, GetActorSpawnPriority(Class), SpawnDataComp != nullptr ? SpawnDataComp->Location : FVector::ZeroVector });
+	bDeferredActorSpawnsNeedSorting = true;
+
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Deferred spawning actor for entity %lld, %d actors already spawned this tick."), EntityId, ActorsSpawnedThisTick);
+}
+
+void USpatialReceiver::SortDeferredActorSpawns()
+{
+	FVector Origin = FVector::ZeroVector;
+	const bool bHasOrigin = GetActorSpawnPriorityOrigin(Origin);
+
+	SortActorSpawnsByPriority(DeferredActorSpawns, Origin, bHasOrigin);
+
+	bDeferredActorSpawnsNeedSorting = false;
+}
+
+void USpatialReceiver::SortPendingAddActorsBySpawnPriority()
+{
+	FVector Origin = FVector::ZeroVector;
+	const bool bHasOrigin = GetActorSpawnPriorityOrigin(Origin);
+
+	TArray<FActorSpawnCandidate> PendingSpawns;
+	PendingSpawns.Reserve(PendingAddActors.Num());
+	for (Worker_EntityId PendingAddEntity : PendingAddActors)
+	{
+		// Only look up classes that are already loaded. Unloaded classes are async loaded, or loaded synchronously, after everything else.
+		float Priority = 0.0f;
+		if (UnrealMetadata* UnrealMetadataComp = StaticComponentView->GetComponentData<UnrealMetadata>(PendingAddEntity))
+		{
+			if (UClass* Class = FindObject<UClass>(nullptr, *UnrealMetadataComp->ClassPath, false))
+			{
+				Priority = GetActorSpawnPriority(Class);
+			}
+		}
+
+		const SpawnData* SpawnDataComp = StaticComponentView->GetComponentData<SpawnData>(PendingAddEntity);
+		PendingSpawns.Add({ PendingAddEntity, Priority, SpawnDataComp != nullptr ? SpawnDataComp->Location : FVector::ZeroVector });
+	}
+
+	SortActorSpawnsByPriority(PendingSpawns, Origin, bHasOrigin);
+
+	for (int32 i = 0; i < PendingSpawns.Num(); i++)
+	{
+		PendingAddActors[i] = PendingSpawns[i].EntityId;
+	}
+}
+
+float USpatialReceiver::GetActorSpawnPriority(UClass* Class)
+{
+	if (const float* CachedPriority = ActorSpawnPriorityByClass.Find(Class))
+	{
+		return *CachedPriority;
+	}
+
+	const float Priority = GetActorSpawnClassPriority(Class, GetDefault<USpatialGDKSettings>()->ActorSpawnClassPriorities);
+	ActorSpawnPriorityByClass.Add(Class, Priority);
+	return Priority;
+}
+
+bool USpatialReceiver::GetActorSpawnPriorityOrigin(FVector& OutOrigin) const
+{
+	// Clients prioritize entities near the local player. Servers have no local player and only use the class priority.
+	APlayerController* PlayerController = NetDriver->GetWorld()->GetFirstPlayerController();
+	if (PlayerController == nullptr || !PlayerController->IsLocalController())
+	{
+		return false;
+	}
+
+	if (const APawn* Pawn = PlayerController->GetPawn())
+	{
+		OutOrigin = Pawn->GetActorLocation();
+	}
+	else
+	{
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(OutOrigin, ViewRotation);
+	}
+
+	OutOrigin = FRepMovement::RebaseOntoZeroOrigin(OutOrigin, PlayerController);
+	return true;
+}
+
+void USpatialReceiver::ProcessDeferredActorSpawns()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ReceiverProcessDeferredActorSpawns);
+
+	if (DeferredActorSpawns.Num() > 0)
+	{
+		if (bDeferredActorSpawnsNeedSorting)
 		{
-			UE_LOG(LogSpatialReceiver, Log, TEXT("Finished async loading package %s for entity %lld."), *PackageName.ToString(), Entity);
+			SortDeferredActorSpawns();
+		}
 
-			// Save critical section if we're in one and restore upon leaving this scope.
-			CriticalSectionSaveState CriticalSectionState(*this);
+		const uint32 MaxActorsSpawnedPerTick = GetDefault<USpatialGDKSettings>()->MaxActorsSpawnedPerTick;
 
-			EntityWaitingForAsyncLoad AsyncLoadEntity = EntitiesWaitingForAsyncLoad.FindAndRemoveChecked(Entity);
-			PendingAddActors.Add(Entity);
-			PendingAddComponents = MoveTemp(AsyncLoadEntity.InitialPendingAddComponents);
-			LeaveCriticalSection();
+		int32 NumProcessed = 0;
+		while (NumProcessed < DeferredActorSpawns.Num() && ActorsSpawnedThisTick < MaxActorsSpawnedPerTick)
+		{
+			const Worker_EntityId EntityId = DeferredActorSpawns[NumProcessed++].EntityId;
 
-			for (QueuedOpForAsyncLoad& Op : AsyncLoadEntity.PendingOps)
+			const EntityWaitingForAsyncLoad* DeferredEntity = EntitiesWaitingForAsyncLoad.Find(EntityId);
+			if (DeferredEntity != nullptr && DeferredEntity->bWaitingForSpawnBudget)
 			{
-				HandleQueuedOpForAsyncLoad(Op);
+				ProcessEntityWaitingForAsyncLoad(EntityId);
 			}
 		}
+
+		DeferredActorSpawns.RemoveAt(0, NumProcessed, false);
 	}
+
+	ActorsSpawnedThisTick = 0;
 }
 
 void USpatialReceiver::MoveMappedObjectToUnmapped(const FUnrealObjectRef& Ref)
@@ -2688,44 +3616,37 @@ void USpatialReceiver::QueueComponentUpdateOpForAsyncLoad(const Worker_Component
 
 TArray<PendingAddComponentWrapper> USpatialReceiver::ExtractAddComponents(Worker_EntityId Entity)
 {
-	TArray<PendingAddComponentWrapper> ExtractedAddComponents;
-	TArray<PendingAddComponentWrapper> RemainingAddComponents;
-
-	for (PendingAddComponentWrapper& AddComponent : PendingAddComponents)
+	CriticalSectionEntityOps* EntityOps = PendingOpsByEntity.Find(Entity);
+	if (EntityOps == nullptr)
 	{
-		if (AddComponent.EntityId == Entity)
-		{
-			ExtractedAddComponents.Add(MoveTemp(AddComponent));
-		}
-		else
-		{
-			RemainingAddComponents.Add(MoveTemp(AddComponent));
-		}
+		return {};
 	}
-	PendingAddComponents = MoveTemp(RemainingAddComponents);
+
+	// Leave the entry in place, so the remaining entities keep their order.
+	TArray<PendingAddComponentWrapper> ExtractedAddComponents = MoveTemp(EntityOps->AddComponents);
+	EntityOps->AddComponents.Reset();
 	return ExtractedAddComponents;
 }
 
 TArray<USpatialReceiver::QueuedOpForAsyncLoad> USpatialReceiver::ExtractAuthorityOps(Worker_EntityId Entity)
 {
 	TArray<QueuedOpForAsyncLoad> ExtractedOps;
-	TArray<Worker_AuthorityChangeOp> RemainingOps;
 
-	for (const Worker_AuthorityChangeOp& Op : PendingAuthorityChanges)
+	CriticalSectionEntityOps* EntityOps = PendingOpsByEntity.Find(Entity);
+	if (EntityOps == nullptr)
 	{
-		if (Op.entity_id == Entity)
-		{
-			QueuedOpForAsyncLoad NewOp = {};
-			NewOp.Op.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
-			NewOp.Op.op.authority_change = Op;
-			ExtractedOps.Add(NewOp);
-		}
-		else
-		{
-			RemainingOps.Add(Op);
-		}
+		return ExtractedOps;
+	}
+
+	ExtractedOps.Reserve(EntityOps->AuthorityChanges.Num());
+	for (const Worker_AuthorityChangeOp& Op : EntityOps->AuthorityChanges)
+	{
+		QueuedOpForAsyncLoad NewOp = {};
+		NewOp.Op.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
+		NewOp.Op.op.authority_change = Op;
+		ExtractedOps.Add(NewOp);
 	}
-	PendingAuthorityChanges = MoveTemp(RemainingOps);
+	EntityOps->AuthorityChanges.Reset();
 	return ExtractedOps;
 }
 
@@ -2755,17 +3676,17 @@ void USpatialReceiver::HandleQueuedOpForAsyncLoad(QueuedOpForAsyncLoad& Op)
 USpatialReceiver::CriticalSectionSaveState::CriticalSectionSaveState(USpatialReceiver& InReceiver)
 	: Receiver(InReceiver)
 	, bInCriticalSection(InReceiver.bInCriticalSection)
+	, CriticalSectionStartTime(InReceiver.CriticalSectionStartTime)
 {
 	if (bInCriticalSection)
 	{
 		PendingAddActors = MoveTemp(Receiver.PendingAddActors);
-		PendingAuthorityChanges = MoveTemp(Receiver.PendingAuthorityChanges);
-		PendingAddComponents = MoveTemp(Receiver.PendingAddComponents);
+		PendingOpsByEntity = MoveTemp(Receiver.PendingOpsByEntity);
 		Receiver.PendingAddActors.Empty();
-		Receiver.PendingAuthorityChanges.Empty();
-		Receiver.PendingAddComponents.Empty();
+		Receiver.PendingOpsByEntity.Empty();
 	}
 	Receiver.bInCriticalSection = true;
+	Receiver.CriticalSectionStartTime = FPlatformTime::Seconds();
 }
 
 USpatialReceiver::CriticalSectionSaveState::~CriticalSectionSaveState()
@@ -2773,10 +3694,10 @@ USpatialReceiver::CriticalSectionSaveState::~CriticalSectionSaveState()
 	if (bInCriticalSection)
 	{
 		Receiver.PendingAddActors = MoveTemp(PendingAddActors);
-		Receiver.PendingAuthorityChanges = MoveTemp(PendingAuthorityChanges);
-		Receiver.PendingAddComponents = MoveTemp(PendingAddComponents);
+		Receiver.PendingOpsByEntity = MoveTemp(PendingOpsByEntity);
 	}
 	Receiver.bInCriticalSection = bInCriticalSection;
+	Receiver.CriticalSectionStartTime = CriticalSectionStartTime;
 }
 
 namespace
@@ -2834,3 +3755,42 @@ void USpatialReceiver::HandleEntityDeletedAuthority(Worker_EntityId EntityId)
 		HandleDeferredEntityDeletion(EntitiesToRetireOnAuthorityGain[Index]);
 	}
 }
+
+SIZE_T USpatialReceiver::GetPendingStateAllocatedSize() const
+{
+	SIZE_T TotalBytes = PendingAddActors.GetAllocatedSize() + PendingOpsByEntity.GetAllocatedSize() + QueuedRemoveComponentOps.GetAllocatedSize()
+		+ PrefetchedFieldIds.GetAllocatedSize() + PendingActorRequests.GetAllocatedSize() + PendingReliableRPCs.GetAllocatedSize()
+		+ EntityQueryDelegates.GetAllocatedSize() + ReserveEntityIDsDelegates.GetAllocatedSize() + CreateEntityDelegates.GetAllocatedSize()
+		+ DeleteEntityDelegates.GetAllocatedSize() + PendingEntitySubobjectDelegations.GetAllocatedSize()
+		+ PendingDynamicSubobjectComponents.GetAllocatedSize() + ObjectRefToRepStateMap.GetAllocatedSize()
+		+ EntitiesWaitingForAsyncLoad.GetAllocatedSize() + AsyncLoadingPackages.GetAllocatedSize() + PackagesToRequest.GetAllocatedSize()
+		+ PackageToAsyncLoadBatch.GetAllocatedSize() + AsyncLoadBatches.GetAllocatedSize() + DeferredActorSpawns.GetAllocatedSize()
+		+ EntitiesToRetireOnAuthorityGain.GetAllocatedSize();
+
+	for (const auto& Pair : PendingOpsByEntity)
+	{
+		TotalBytes += Pair.Value.AddComponents.GetAllocatedSize() + Pair.Value.AuthorityChanges.GetAllocatedSize();
+	}
+	for (const auto& Pair : PrefetchedFieldIds)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+	}
+	for (const auto& Pair : ObjectRefToRepStateMap)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+	}
+	for (const auto& Pair : EntitiesWaitingForAsyncLoad)
+	{
+		TotalBytes += Pair.Value.ClassPath.GetAllocatedSize() + Pair.Value.InitialPendingAddComponents.GetAllocatedSize() + Pair.Value.PendingOps.GetAllocatedSize();
+	}
+	for (const auto& Pair : AsyncLoadingPackages)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+	}
+	for (const auto& Pair : AsyncLoadBatches)
+	{
+		TotalBytes += Pair.Value.LoadingPackages.GetAllocatedSize() + Pair.Value.LoadedEntities.GetAllocatedSize();
+	}
+
+	return TotalBytes;
+}
@@ -14,12 +14,14 @@
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/GlobalStateManager.h"
 #include "Interop/SpatialReceiver.h"
+#include "Interop/StartupActorTombstones.h"
 #include "LoadBalancing/AbstractLBStrategy.h"
 #include "Net/NetworkProfiler.h"
 #include "Schema/AuthorityIntent.h"
 #include "Schema/ClientRPCEndpointLegacy.h"
 #include "Schema/ComponentPresence.h"
 #include "Schema/Interest.h"
+#include "Schema/LevelTombstones.h"
 #include "Schema/RPCPayload.h"
 #include "Schema/ServerRPCEndpointLegacy.h"
 #include "Schema/ServerWorker.h"
@@ -29,12 +31,14 @@
 #include "Utils/ComponentFactory.h"
 #include "Utils/EntityFactory.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/RPCRingBuffer.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialLatencyTracer.h"
 #include "Utils/SpatialMetrics.h"
 #include "Utils/SpatialStatics.h"
+#include "Utils/SubsystemStats.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialSender);
 
@@ -71,6 +75,11 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 
 	OutgoingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialSender::SendRPC));
 
+	if (GetDefault<USpatialGDKSettings>()->bCacheEntityComponentTemplates)
+	{
+		EntityComponentTemplateCache = MakeUnique<SpatialGDK::FEntityComponentTemplateCache>();
+	}
+
 	// Attempt to send RPCs that might have been queued while waiting for authority over entities this worker created.
 	if (GetDefault<USpatialGDKSettings>()->QueuedOutgoingRPCRetryTime > 0.0f)
 	{
@@ -80,7 +89,7 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 
 Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel, uint32& OutBytesWritten)
 {
-	EntityFactory DataFactory(NetDriver, PackageMap, ClassInfoManager, RPCService);
+	EntityFactory DataFactory(NetDriver, PackageMap, ClassInfoManager, RPCService, EntityComponentTemplateCache.Get());
 	TArray<FWorkerComponentData> ComponentDatas = DataFactory.CreateEntityComponents(Channel, OutgoingOnCreateEntityRPCs, OutBytesWritten);
 
 	// If the Actor was loaded rather than dynamically spawned, associate it with its owning sublevel.
@@ -128,15 +137,30 @@ void USpatialSender::PeriodicallyProcessOutgoingRPCs()
 
 void USpatialSender::SendAddComponentForSubobject(USpatialActorChannel* Channel, UObject* Subobject, const FClassInfo& SubobjectInfo, uint32& OutBytesWritten)
 {
-	FRepChangeState SubobjectRepChanges = Channel->CreateInitialRepChangeState(Subobject);
-	FHandoverChangeState SubobjectHandoverChanges = Channel->CreateInitialHandoverChangeState(SubobjectInfo);
+	SendAddComponentsForSubobjects(Channel, { MakeTuple(Subobject, &SubobjectInfo) }, OutBytesWritten);
+}
+
+void USpatialSender::SendAddComponentsForSubobjects(USpatialActorChannel* Channel, const TArray<TPair<UObject*, const FClassInfo*>>& Subobjects, uint32& OutBytesWritten)
+{
+	TArray<FWorkerComponentData> SubobjectDatas;
+	SubobjectDatas.Reserve(Subobjects.Num() * SCHEMA_Count);
+
+	for (const TPair<UObject*, const FClassInfo*>& SubobjectInfoPair : Subobjects)
+	{
+		UObject* Subobject = SubobjectInfoPair.Key;
+		const FClassInfo& SubobjectInfo = *SubobjectInfoPair.Value;
 
-	ComponentFactory DataFactory(false, NetDriver, USpatialLatencyTracer::GetTracer(Subobject));
+		FRepChangeState SubobjectRepChanges = Channel->CreateInitialRepChangeState(Subobject);
+		FHandoverChangeState SubobjectHandoverChanges = Channel->CreateInitialHandoverChangeState(SubobjectInfo);
 
-	TArray<FWorkerComponentData> SubobjectDatas = DataFactory.CreateComponentDatas(Subobject, SubobjectInfo, SubobjectRepChanges, SubobjectHandoverChanges, OutBytesWritten);
-	SendAddComponents(Channel->GetEntityId(), SubobjectDatas);
+		ComponentFactory DataFactory(false, NetDriver, USpatialLatencyTracer::GetTracer(Subobject));
+
+		SubobjectDatas.Append(DataFactory.CreateComponentDatas(Subobject, SubobjectInfo, SubobjectRepChanges, SubobjectHandoverChanges, OutBytesWritten));
+
+		Channel->RemovePendingDynamicSubobject(Subobject);
+	}
 
-	Channel->PendingDynamicSubobjects.Remove(TWeakObjectPtr<UObject>(Subobject));
+	SendAddComponents(Channel->GetEntityId(), MoveTemp(SubobjectDatas));
 }
 
 void USpatialSender::SendAddComponents(Worker_EntityId EntityId, TArray<FWorkerComponentData> ComponentDatas)
@@ -151,6 +175,17 @@ void USpatialSender::SendAddComponents(Worker_EntityId EntityId, TArray<FWorkerC
 	ComponentPresence* Presence = StaticComponentView->GetComponentData<ComponentPresence>(EntityId);
 	Presence->AddComponentDataIds(ComponentDatas);
 	FWorkerComponentUpdate Update = Presence->CreateComponentPresenceUpdate();
+
+	if (IsBatchingEntity(EntityId))
+	{
+		AddToComponentUpdateBatch(Update);
+		for (FWorkerComponentData& ComponentData : ComponentDatas)
+		{
+			ComponentUpdateBatch.Messages.Add({ SpatialGDK::EOutgoingMessageType::AddComponent, {}, ComponentData, SpatialConstants::INVALID_COMPONENT_ID });
+		}
+		return;
+	}
+
 	Connection->SendComponentUpdate(EntityId, &Update);
 
 	for (FWorkerComponentData& ComponentData : ComponentDatas)
@@ -161,29 +196,41 @@ void USpatialSender::SendAddComponents(Worker_EntityId EntityId, TArray<FWorkerC
 
 void USpatialSender::GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info)
 {
-	Worker_EntityId EntityId = Channel->GetEntityId();
+	GainAuthorityThenAddComponents(Channel, { MakeTuple(Object, Info) });
+}
 
-	TSharedRef<FPendingSubobjectAttachment> PendingSubobjectAttachment = MakeShared<FPendingSubobjectAttachment>();
-	PendingSubobjectAttachment->Subobject = Object;
-	PendingSubobjectAttachment->Info = Info;
+void USpatialSender::GainAuthorityThenAddComponents(USpatialActorChannel* Channel, const TArray<TPair<UObject*, const FClassInfo*>>& Subobjects)
+{
+	Worker_EntityId EntityId = Channel->GetEntityId();
 
-	// We collect component IDs related to the dynamic subobject being added to gain authority over.
+	// We collect component IDs related to the dynamic subobjects being added to gain authority over.
 	TArray<Worker_ComponentId> NewComponentIds;
-	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+	NewComponentIds.Reserve(Subobjects.Num() * SCHEMA_Count);
+
+	for (const TPair<UObject*, const FClassInfo*>& SubobjectInfoPair : Subobjects)
 	{
-		Worker_ComponentId ComponentId = Info->SchemaComponents[Type];
-		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+		const FClassInfo* Info = SubobjectInfoPair.Value;
+
+		TSharedRef<FPendingSubobjectAttachment> PendingSubobjectAttachment = MakeShared<FPendingSubobjectAttachment>();
+		PendingSubobjectAttachment->Subobject = SubobjectInfoPair.Key;
+		PendingSubobjectAttachment->Info = Info;
+
+		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
 		{
-			// For each valid ComponentId, we need to wait for its authority delegation before
-			// adding the subobject.
-			PendingSubobjectAttachment->PendingAuthorityDelegations.Add(ComponentId);
-			Receiver->PendingEntitySubobjectDelegations.Add(
-				MakeTuple(static_cast<Worker_EntityId_Key>(EntityId), ComponentId),
-				PendingSubobjectAttachment);
-
-			NewComponentIds.Add(ComponentId);
-		}
-	});
+			Worker_ComponentId ComponentId = Info->SchemaComponents[Type];
+			if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				// For each valid ComponentId, we need to wait for its authority delegation before
+				// adding the subobject.
+				PendingSubobjectAttachment->PendingAuthorityDelegations.Add(ComponentId);
+				Receiver->PendingEntitySubobjectDelegations.Add(
+					MakeTuple(static_cast<Worker_EntityId_Key>(EntityId), ComponentId),
+					PendingSubobjectAttachment);
+
+				NewComponentIds.Add(ComponentId);
+			}
+		});
+	}
 
 	// If this worker is EntityACL authoritative, we can directly update the component IDs to gain authority over.
 	if (StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
@@ -210,20 +257,31 @@ void USpatialSender::GainAuthorityThenAddComponent(USpatialActorChannel* Channel
 }
 
 void USpatialSender::SendRemoveComponentForClassInfo(Worker_EntityId EntityId, const FClassInfo& Info)
+{
+	SendRemoveComponentsForClassInfos(EntityId, { &Info });
+}
+
+void USpatialSender::SendRemoveComponentsForClassInfos(Worker_EntityId EntityId, const TArray<const FClassInfo*>& Infos)
 {
 	TArray<Worker_ComponentId> ComponentsToRemove;
-	ComponentsToRemove.Reserve(SCHEMA_Count);
-	for (Worker_ComponentId SubobjectComponentId : Info.SchemaComponents)
+	ComponentsToRemove.Reserve(Infos.Num() * SCHEMA_Count);
+	for (const FClassInfo* Info : Infos)
 	{
-		if (SubobjectComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+		for (Worker_ComponentId SubobjectComponentId : Info->SchemaComponents)
 		{
-			ComponentsToRemove.Add(SubobjectComponentId);
+			if (SubobjectComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				ComponentsToRemove.Add(SubobjectComponentId);
+			}
 		}
 	}
 
 	SendRemoveComponents(EntityId, ComponentsToRemove);
 
-	PackageMap->RemoveSubobject(FUnrealObjectRef(EntityId, Info.SchemaComponents[SCHEMA_Data]));
+	for (const FClassInfo* Info : Infos)
+	{
+		PackageMap->RemoveSubobject(FUnrealObjectRef(EntityId, Info->SchemaComponents[SCHEMA_Data]));
+	}
 }
 
 void USpatialSender::SendRemoveComponents(Worker_EntityId EntityId, TArray<Worker_ComponentId> ComponentIds)
@@ -232,6 +290,17 @@ void USpatialSender::SendRemoveComponents(Worker_EntityId EntityId, TArray<Worke
 	ComponentPresence* ComponentPresenceData = StaticComponentView->GetComponentData<ComponentPresence>(EntityId);
 	ComponentPresenceData->RemoveComponentIds(ComponentIds);
 	FWorkerComponentUpdate Update = ComponentPresenceData->CreateComponentPresenceUpdate();
+
+	if (IsBatchingEntity(EntityId))
+	{
+		AddToComponentUpdateBatch(Update);
+		for (auto ComponentId : ComponentIds)
+		{
+			ComponentUpdateBatch.Messages.Add({ SpatialGDK::EOutgoingMessageType::RemoveComponent, {}, {}, ComponentId });
+		}
+		return;
+	}
+
 	Connection->SendComponentUpdate(EntityId, &Update);
 
 	for (auto ComponentId : ComponentIds)
@@ -257,6 +326,10 @@ void USpatialSender::RetryServerWorkerEntityCreation(Worker_EntityId EntityId, i
 	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, WorkerIdPermission);
 	ComponentWriteAcl.Add(SpatialConstants::SERVER_WORKER_COMPONENT_ID, WorkerIdPermission);
 	ComponentWriteAcl.Add(SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, WorkerIdPermission);
+	if (NetDriver->CrossServerRPCService.IsValid())
+	{
+		ComponentWriteAcl.Add(SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID, WorkerIdPermission);
+	}
 
 	TArray<FWorkerComponentData> Components;
 	Components.Add(Position().CreatePositionData());
@@ -267,6 +340,10 @@ void USpatialSender::RetryServerWorkerEntityCreation(Worker_EntityId EntityId, i
 	// It is unlikely the load balance strategy would be set up at this point, but we call this function again later when it is ready in order
 	// to set the interest of the server worker according to the strategy.
 	Components.Add(NetDriver->InterestFactory->CreateServerWorkerInterest(NetDriver->LoadBalanceStrategy).CreateInterestData());
+	if (NetDriver->CrossServerRPCService.IsValid())
+	{
+		Components.Add(SpatialGDK::CrossServerRPCService::CreateEndpointData());
+	}
 	Components.Add(ComponentPresence(EntityFactory::GetComponentPresenceList(Components)).CreateComponentPresenceData());
 
 	const Worker_RequestId RequestId = Connection->SendCreateEntityRequest(MoveTemp(Components), &EntityId);
@@ -335,6 +412,22 @@ bool USpatialSender::ValidateOrExit_IsSupportedClass(const FString& PathName)
 	return ClassInfoManager->ValidateOrExit_IsSupportedClass(RemappedPathName);
 }
 
+bool USpatialSender::ValidateOrExit_IsSupportedClass(UClass* Class)
+{
+	if (SupportedClasses.Contains(Class))
+	{
+		return true;
+	}
+
+	if (!ValidateOrExit_IsSupportedClass(Class->GetPathName()))
+	{
+		return false;
+	}
+
+	SupportedClasses.Add(Class);
+	return true;
+}
+
 void USpatialSender::DeleteEntityComponentData(TArray<FWorkerComponentData>& EntityComponents)
 {
 	for (FWorkerComponentData& Component : EntityComponents)
@@ -404,7 +497,8 @@ void USpatialSender::UpdateServerWorkerEntityInterestAndPosition()
 	}
 
 	// Update the interest. If it's ready and not null, also adds interest according to the load balancing strategy.
-	FWorkerComponentUpdate InterestUpdate = NetDriver->InterestFactory->CreateServerWorkerInterest(NetDriver->LoadBalanceStrategy).CreateInterestUpdate();
+	const VirtualWorkerId StandbyForWorkerId = NetDriver->VirtualWorkerTranslator.IsValid() ? NetDriver->VirtualWorkerTranslator->GetLocalStandbyVirtualWorkerId() : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	FWorkerComponentUpdate InterestUpdate = NetDriver->InterestFactory->CreateServerWorkerInterest(NetDriver->LoadBalanceStrategy, StandbyForWorkerId).CreateInterestUpdate();
 	Connection->SendComponentUpdate(NetDriver->WorkerEntityId, &InterestUpdate);
 
 	if (NetDriver->LoadBalanceStrategy != nullptr && NetDriver->LoadBalanceStrategy->IsReady())
@@ -421,11 +515,99 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 	UE_LOG(LogSpatialSender, Verbose, TEXT("Sending component update (object: %s, entity: %lld)"), *Object->GetName(), EntityId);
 
-	USpatialLatencyTracer* Tracer = USpatialLatencyTracer::GetTracer(Object);
-	ComponentFactory UpdateFactory(Channel->GetInterestDirty(), NetDriver, Tracer);
+	if (ComponentUpdateBatch.Channel == Channel && ComponentUpdateBatch.EntityId == EntityId)
+	{
+		for (const FWorkerComponentUpdate& Update : ComponentUpdateBatch.UpdateFactory->CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges, OutBytesWritten))
+		{
+			AddToComponentUpdateBatch(Update);
+		}
+		return;
+	}
 
-	TArray<FWorkerComponentUpdate> ComponentUpdates = UpdateFactory.CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges, OutBytesWritten);
+	TUniquePtr<ComponentFactory> UpdateFactory = CreateUpdateFactory(Channel, USpatialLatencyTracer::GetTracer(Object));
+	TArray<FWorkerComponentUpdate> ComponentUpdates = UpdateFactory->CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges, OutBytesWritten);
+
+	SendComponentUpdatesToEntity(EntityId, ComponentUpdates);
+}
 
+void USpatialSender::BeginComponentUpdateBatch(USpatialActorChannel* Channel)
+{
+	check(ComponentUpdateBatch.Channel == nullptr);
+
+	if (!GetDefault<USpatialGDKSettings>()->bBatchSubobjectComponentUpdates)
+	{
+		return;
+	}
+
+	ComponentUpdateBatch.Channel = Channel;
+	ComponentUpdateBatch.EntityId = Channel->GetEntityId();
+	// The tracer is the same for every object of the actor, as it belongs to the world.
+	ComponentUpdateBatch.UpdateFactory = CreateUpdateFactory(Channel, USpatialLatencyTracer::GetTracer(Channel->Actor));
+}
+
+void USpatialSender::EndComponentUpdateBatch()
+{
+	if (ComponentUpdateBatch.Channel == nullptr)
+	{
+		return;
+	}
+
+	const Worker_EntityId EntityId = ComponentUpdateBatch.EntityId;
+	TArray<FBatchedEntityMessage> Messages = MoveTemp(ComponentUpdateBatch.Messages);
+	ComponentUpdateBatch = FComponentUpdateBatch();
+
+	// Updates between two added or removed components are still sent in one pass.
+	TArray<FWorkerComponentUpdate> ComponentUpdates;
+	for (FBatchedEntityMessage& Message : Messages)
+	{
+		if (Message.Type == SpatialGDK::EOutgoingMessageType::ComponentUpdate)
+		{
+			ComponentUpdates.Add(Message.Update);
+			continue;
+		}
+
+		SendComponentUpdatesToEntity(EntityId, ComponentUpdates);
+		ComponentUpdates.Reset();
+
+		if (Message.Type == SpatialGDK::EOutgoingMessageType::AddComponent)
+		{
+			Connection->SendAddComponent(EntityId, &Message.Data);
+		}
+		else
+		{
+			Connection->SendRemoveComponent(EntityId, Message.ComponentId);
+		}
+	}
+
+	SendComponentUpdatesToEntity(EntityId, ComponentUpdates);
+}
+
+bool USpatialSender::IsBatchingEntity(Worker_EntityId EntityId) const
+{
+	return ComponentUpdateBatch.Channel != nullptr && ComponentUpdateBatch.EntityId == EntityId;
+}
+
+void USpatialSender::AddToComponentUpdateBatch(const FWorkerComponentUpdate& Update)
+{
+	ComponentUpdateBatch.Messages.Add({ SpatialGDK::EOutgoingMessageType::ComponentUpdate, Update, {}, SpatialConstants::INVALID_COMPONENT_ID });
+}
+
+TUniquePtr<ComponentFactory> USpatialSender::CreateUpdateFactory(USpatialActorChannel* Channel, USpatialLatencyTracer* Tracer) const
+{
+	TUniquePtr<ComponentFactory> UpdateFactory = MakeUnique<ComponentFactory>(Channel->GetInterestDirty(), NetDriver, Tracer);
+	if (GetDefault<USpatialGDKSettings>()->bSkipUnchangedFastArrays)
+	{
+		UpdateFactory->SetFastArrayReplicationKeys(&Channel->GetFastArrayReplicationKeys());
+	}
+	if (GetDefault<USpatialGDKSettings>()->bDropUnchangedPropertyWrites)
+	{
+		UpdateFactory->SetLastSentPropertyValues(&Channel->GetLastSentPropertyValues());
+	}
+	return UpdateFactory;
+}
+
+void USpatialSender::SendComponentUpdatesToEntity(Worker_EntityId EntityId, TArray<FWorkerComponentUpdate>& ComponentUpdates)
+{
 	for(int i = 0; i < ComponentUpdates.Num(); i++)
 	{
 		FWorkerComponentUpdate& Update = ComponentUpdates[i];
@@ -443,6 +625,11 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 		Connection->SendComponentUpdate(EntityId, &Update);
 	}
+
+	if (NetDriver->HotEntityTracker.IsValid() && ComponentUpdates.Num() > 0)
+	{
+		NetDriver->HotEntityTracker->Record(EntityId, SpatialGDK::EHotEntityCounter::OutgoingUpdates, FPlatformTime::Seconds(), ComponentUpdates.Num());
+	}
 }
 
 // Apply (and clean up) any updates queued, due to being sent previously when they didn't have authority.
@@ -466,8 +653,54 @@ void USpatialSender::ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId
 	}
 }
 
+void USpatialSender::MergeSubmittedBatches()
+{
+	SubmitQueue->Drain(SubmittedBatchesToMerge);
+
+	for (SpatialGDK::FSubmitBatch& Batch : SubmittedBatchesToMerge)
+	{
+		for (SpatialGDK::FSubmitBatch::FEntry& Entry : Batch.GetEntries())
+		{
+			if (!Entry.Payload.IsSet())
+			{
+				const Worker_ComponentId ComponentId = Entry.Update.component_id;
+				if (!StaticComponentView->HasAuthority(Entry.EntityId, ComponentId))
+				{
+					UE_LOG(LogSpatialSender, Warning, TEXT("USpatialSender::MergeSubmittedBatches: Dropping submitted update without authority. Entity: %lld, component: %d"),
+						Entry.EntityId, ComponentId);
+					continue;
+				}
+
+				Connection->SendComponentUpdate(Entry.EntityId, &Entry.Update);
+				// The connection owns the schema data now.
+				Entry.Update.schema_type = nullptr;
+				continue;
+			}
+
+			if (RPCService == nullptr || Entry.RPCType == ERPCType::CrossServer)
+			{
+				UE_LOG(LogSpatialSender, Warning, TEXT("USpatialSender::MergeSubmittedBatches: Dropping submitted RPC, only ring buffered RPCs can be submitted. Entity: %lld, type: %d"),
+					Entry.EntityId, static_cast<int32>(Entry.RPCType));
+				continue;
+			}
+
+			const EPushRPCResult Result = RPCService->PushRPC(Entry.EntityId, Entry.RPCType, Entry.Payload.GetValue(), false);
+			if (Result != EPushRPCResult::Success && Result != EPushRPCResult::QueueOverflowed)
+			{
+				UE_LOG(LogSpatialSender, Log, TEXT("USpatialSender::MergeSubmittedBatches: Failed to push submitted RPC, result: %d. Entity: %lld, type: %d"),
+					static_cast<int32>(Result), Entry.EntityId, static_cast<int32>(Entry.RPCType));
+			}
+		}
+	}
+
+	// Destroys the schema data of any update which was dropped.
+	SubmittedBatchesToMerge.Reset();
+}
+
 void USpatialSender::FlushRPCService()
 {
+	SPATIALGDK_SUBSYSTEM_SCOPE(RPCServiceFlush);
+
 	if (RPCService != nullptr)
 	{
 		RPCService->PushOverflowedRPCs();
@@ -483,14 +716,55 @@ void USpatialSender::FlushRPCService()
 			Connection->MaybeFlush();
 		}
 	}
+
+	if (SpatialGDK::CrossServerRPCService* CrossServerRPCService = NetDriver->CrossServerRPCService.Get())
+	{
+		CrossServerRPCService->ProcessHeldRPCs();
+		CrossServerRPCService->PushOverflowedRPCs();
+
+		const TArray<SpatialRPCService::UpdateToSend> RPCs = CrossServerRPCService->GetRPCsAndAcksToSend();
+		for (const SpatialRPCService::UpdateToSend& Update : RPCs)
+		{
+			Connection->SendComponentUpdate(Update.EntityId, &Update.Update);
+		}
+
+		if (RPCs.Num())
+		{
+			Connection->MaybeFlush();
+		}
+	}
+}
+
+void USpatialSender::FlushRPCService(Worker_EntityId EntityId)
+{
+	SPATIALGDK_SUBSYSTEM_SCOPE(RPCServiceFlush);
+
+	if (RPCService != nullptr)
+	{
+		for (const SpatialRPCService::UpdateToSend& Update : RPCService->GetRPCsAndAcksToSend(EntityId))
+		{
+			Connection->SendComponentUpdate(Update.EntityId, &Update.Update);
+		}
+	}
 }
 
 RPCPayload USpatialSender::CreateRPCPayloadFromParams(UObject* TargetObject, const FUnrealObjectRef& TargetObjectRef, UFunction* Function, void* Params)
 {
-	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+	return CreateRPCPayloadFromParams(TargetObject, TargetObjectRef, Function, ClassInfoManager->GetRPCInfo(TargetObject, Function), Params);
+}
 
-	FSpatialNetBitWriter PayloadWriter = PackRPCDataToSpatialNetBitWriter(Function, Params);
+RPCPayload USpatialSender::CreateRPCPayloadFromParams(UObject* TargetObject, const FUnrealObjectRef& TargetObjectRef, UFunction* Function, const FRPCInfo& RPCInfo, void* Params)
+{
+	if (!RPCPayloadWriter.IsValid())
+	{
+		RPCPayloadWriter = FSpatialNetBitWriterPool::Acquire(PackageMap);
+	}
+	FSpatialNetBitWriter& PayloadWriter = *RPCPayloadWriter;
+	PayloadWriter.Reset();
+
+	PackRPCDataToSpatialNetBitWriter(Function, Params, PayloadWriter);
 
+	// The payload needs to own its data while the RPC is queued, so this copy is the only allocation per RPC.
 #if TRACE_LIB_ACTIVE
 	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes()), USpatialLatencyTracer::GetTracer(TargetObject)->RetrievePendingTrace(TargetObject, Function));
 #else
@@ -578,11 +852,70 @@ void USpatialSender::SendAuthorityIntentUpdate(const AActor& Actor, VirtualWorke
 		NetDriver->SpatialDebugger->ActorAuthorityIntentChanged(EntityId, NewAuthoritativeVirtualWorkerId);
 	}
 
-	FWorkerComponentUpdate Update = AuthorityIntentComponent->CreateAuthorityIntentUpdate();
-	Connection->SendComponentUpdate(EntityId, &Update);
+	Worker_EntityId HierarchyRootEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	if (const AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(&Actor))
+	{
+		HierarchyRootEntityId = PackageMap->GetEntityIdFromObject(HierarchyRoot);
+	}
+	if (HierarchyRootEntityId == SpatialConstants::INVALID_ENTITY_ID)
+	{
+		HierarchyRootEntityId = EntityId;
+	}
 
-	// Also notify the enforcer directly on the worker that sends the component update, as the update will short circuit
-	NetDriver->LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityId);
+	PendingAuthorityIntentUpdates.Add(EntityId, FPendingAuthorityIntentUpdate{ EntityId, HierarchyRootEntityId });
+}
+
+void USpatialSender::FlushAuthorityIntentUpdates()
+{
+	if (PendingAuthorityIntentUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	AuthorityIntentUpdatesToFlush.Reset();
+	PendingAuthorityIntentUpdates.GenerateValueArray(AuthorityIntentUpdatesToFlush);
+	PendingAuthorityIntentUpdates.Reset();
+
+	// Send the updates of each ownership hierarchy back to back, root first, so the receiving worker and the enforcer handle the hierarchy together.
+	AuthorityIntentUpdatesToFlush.Sort([](const FPendingAuthorityIntentUpdate& Lhs, const FPendingAuthorityIntentUpdate& Rhs)
+	{
+		if (Lhs.HierarchyRootEntityId != Rhs.HierarchyRootEntityId)
+		{
+			return Lhs.HierarchyRootEntityId < Rhs.HierarchyRootEntityId;
+		}
+
+		const bool bLhsIsRoot = Lhs.EntityId == Lhs.HierarchyRootEntityId;
+		const bool bRhsIsRoot = Rhs.EntityId == Rhs.HierarchyRootEntityId;
+		if (bLhsIsRoot != bRhsIsRoot)
+		{
+			return bLhsIsRoot;
+		}
+
+		return Lhs.EntityId < Rhs.EntityId;
+	});
+
+	for (const FPendingAuthorityIntentUpdate& PendingUpdate : AuthorityIntentUpdatesToFlush)
+	{
+		const Worker_EntityId EntityId = PendingUpdate.EntityId;
+
+		// The entity may have been removed, or authority over its intent lost, since the intent changed.
+		if (!StaticComponentView->HasAuthority(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID))
+		{
+			continue;
+		}
+
+		AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<AuthorityIntent>(EntityId);
+		if (AuthorityIntentComponent == nullptr)
+		{
+			continue;
+		}
+
+		FWorkerComponentUpdate Update = AuthorityIntentComponent->CreateAuthorityIntentUpdate();
+		Connection->SendComponentUpdate(EntityId, &Update);
+
+		// Also notify the enforcer directly on the worker that sends the component update, as the update will short circuit
+		NetDriver->LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityId);
+	}
 }
 
 void USpatialSender::SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request)
@@ -595,6 +928,7 @@ void USpatialSender::SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclW
 	const WorkerAttributeSet OwningServerWorkerAttributeSet = { WriteWorkerId };
 
 	EntityAcl* NewAcl = StaticComponentView->GetComponentData<EntityAcl>(Request.EntityId);
+	const EntityAcl OldAcl = *NewAcl;
 	NewAcl->ReadAcl = Request.ReadAcl;
 
 	for (const Worker_ComponentId& ComponentId : Request.ComponentIds)
@@ -615,6 +949,14 @@ void USpatialSender::SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclW
 		NewAcl->ComponentWriteAcl.Add(ComponentId, { OwningServerWorkerAttributeSet });
 	}
 
+	// Ownership changes are queued like authority changes, and often leave the ACL as it was, e.g. when a pawn is possessed and
+	// unpossessed within a tick. The EntityAcl update is the largest component update an entity sends, so don't send it for nothing.
+	if (OldAcl.ReadAcl == NewAcl->ReadAcl && OldAcl.ComponentWriteAcl.OrderIndependentCompareEqual(NewAcl->ComponentWriteAcl))
+	{
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("(%s) Acl WriteAuth for entity %lld already set to %s"), *NetDriver->Connection->GetWorkerId(), Request.EntityId, *Request.OwningWorkerId);
+		return;
+	}
+
 	UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("(%s) Setting Acl WriteAuth for entity %lld to %s"), *NetDriver->Connection->GetWorkerId(), Request.EntityId, *Request.OwningWorkerId);
 
 	FWorkerComponentUpdate Update = NewAcl->CreateEntityAclUpdate();
@@ -646,6 +988,19 @@ FRPCErrorInfo USpatialSender::SendRPC(const FPendingRPCParams& Params)
 		return FRPCErrorInfo{ TargetObject, Function, ERPCResult::NoActorChannel, true };
 	}
 
+	if (SpatialGDK::FHotEntityTracker* HotEntityTracker = NetDriver->HotEntityTracker.Get())
+	{
+		// Dropped RPCs aren't recorded, so a hot entity's unreliable RPCs are capped at the threshold rather than stopped.
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		const double Now = FPlatformTime::Seconds();
+		if (SpatialGDKSettings->bThrottleHotEntities && !Function->HasAnyFunctionFlags(FUNC_NetReliable)
+			&& HotEntityTracker->GetRate(Params.ObjectRef.Entity, SpatialGDK::EHotEntityCounter::OutgoingRPCs, Now) >= SpatialGDKSettings->HotEntityRPCRateThreshold)
+		{
+			return FRPCErrorInfo{ TargetObject, Function, ERPCResult::HotEntityThrottled, true };
+		}
+		HotEntityTracker->Record(Params.ObjectRef.Entity, SpatialGDK::EHotEntityCounter::OutgoingRPCs, Now);
+	}
+
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 	bool bUseRPCRingBuffer = GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer();
 
@@ -690,6 +1045,25 @@ void USpatialSender::SendOnEntityCreationRPC(UObject* TargetObject, UFunction* F
 
 void USpatialSender::SendCrossServerRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef)
 {
+	// Until the worker entity has been created, cross-server RPCs are still sent as commands.
+	SpatialGDK::CrossServerRPCService* CrossServerRPCService = NetDriver->CrossServerRPCService.Get();
+	if (CrossServerRPCService != nullptr && CrossServerRPCService->IsReady())
+	{
+		const EPushRPCResult Result = CrossServerRPCService->PushRPC(TargetObjectRef.Entity, Payload, Function->HasAnyFunctionFlags(FUNC_NetReliable));
+		UE_CLOG(Result == EPushRPCResult::QueueOverflowed, LogSpatialSender, Verbose, TEXT("USpatialSender::SendCrossServerRPC: Cross-server ring buffer full or not yet seen by every server, queuing RPC locally. Actor: %s, entity: %lld, function: %s"),
+			*TargetObject->GetPathName(), TargetObjectRef.Entity, *Function->GetName());
+#if !UE_BUILD_SHIPPING
+		TrackRPC(Channel->Actor, Function, Payload, ERPCType::CrossServer);
+#endif // !UE_BUILD_SHIPPING
+		return;
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bBatchCrossServerRPCs)
+	{
+		BatchCrossServerRPC(TargetObject, Function, Payload, Channel, TargetObjectRef);
+		return;
+	}
+
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
 	Worker_ComponentId ComponentId = SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID;
@@ -704,7 +1078,9 @@ void USpatialSender::SendCrossServerRPC(UObject* TargetObject, UFunction* Functi
 	{
 		UE_LOG(LogSpatialSender, Verbose, TEXT("Sending reliable command request (entity: %lld, component: %d, function: %s, attempt: 1)"),
 			EntityId, CommandRequest.component_id, *Function->GetName());
-		Receiver->AddPendingReliableRPC(RequestId, MakeShared<FReliableRPCForRetry>(TargetObject, Function, ComponentId, RPCInfo.Index, Payload.PayloadData, 0));
+		TSharedRef<FReliableRPCForRetry> ReliableRPC = MakeShared<FReliableRPCForRetry>(TargetObject, Function, ComponentId, RPCInfo.Index, Payload.PayloadData, 0);
+		ReliableRPC->EntityId = EntityId;
+		Receiver->AddPendingReliableRPC(RequestId, ReliableRPC);
 	}
 	else
 	{
@@ -716,6 +1092,77 @@ void USpatialSender::SendCrossServerRPC(UObject* TargetObject, UFunction* Functi
 #endif // !UE_BUILD_SHIPPING
 }
 
+void USpatialSender::BatchCrossServerRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef)
+{
+	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+	const Worker_EntityId EntityId = TargetObjectRef.Entity;
+	check(EntityId != SpatialConstants::INVALID_ENTITY_ID);
+
+	// Reliable RPCs are batched on their own, so retrying a failed batch never resends unreliable RPCs.
+	const bool bReliable = Function->HasAnyFunctionFlags(FUNC_NetReliable);
+	TMap<Worker_EntityId_Key, FCrossServerRPCBatch>& Batches = bReliable ? ReliableCrossServerRPCBatches : UnreliableCrossServerRPCBatches;
+
+	FCrossServerRPCBatch& Batch = Batches.FindOrAdd(EntityId);
+	if (Batch.Functions.Num() == 0)
+	{
+		// The packed RPCs carry their own subobject offsets, so the batch targets the actor.
+		Batch.TargetObject = Channel->Actor;
+	}
+	RPCRingBufferUtils::AppendPackedRPC(Batch.PackedRPCs, Payload);
+	Batch.Functions.Add(Function);
+
+	if (static_cast<uint32>(Batch.Functions.Num()) >= GetDefault<USpatialGDKSettings>()->MaxCrossServerRPCsPerBatch)
+	{
+		SendCrossServerRPCBatch(EntityId, Batch, bReliable);
+		Batches.Remove(EntityId);
+	}
+
+#if !UE_BUILD_SHIPPING
+	TrackRPC(Channel->Actor, Function, Payload, RPCInfo.Type);
+#endif // !UE_BUILD_SHIPPING
+}
+
+void USpatialSender::SendCrossServerRPCBatch(Worker_EntityId EntityId, const FCrossServerRPCBatch& Batch, bool bReliable)
+{
+	UObject* TargetObject = Batch.TargetObject.Get();
+	if (TargetObject == nullptr)
+	{
+		// Target object was destroyed before the batch could be sent
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Dropping %d cross-server RPCs to entity %lld, the target actor was destroyed."), Batch.Functions.Num(), EntityId);
+		return;
+	}
+
+	const Worker_ComponentId ComponentId = SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID;
+	Worker_CommandRequest CommandRequest = CreatePackedRPCCommandRequest(ComponentId, Batch.PackedRPCs);
+	Worker_RequestId RequestId = Connection->SendCommandRequest(EntityId, &CommandRequest, SpatialConstants::UNREAL_RPC_ENDPOINT_COMMAND_ID);
+
+	UE_LOG(LogSpatialSender, Verbose, TEXT("Sending %s command request with %d packed RPCs (entity: %lld, component: %d, first function: %s, attempt: 1)"),
+		bReliable ? TEXT("reliable") : TEXT("unreliable"), Batch.Functions.Num(), EntityId, ComponentId, *Batch.Functions[0]->GetName());
+
+	if (bReliable)
+	{
+		TSharedRef<FReliableRPCForRetry> ReliableRPC = MakeShared<FReliableRPCForRetry>(TargetObject, Batch.Functions[0], ComponentId, 0, Batch.PackedRPCs, 0);
+		ReliableRPC->PackedFunctions = Batch.Functions;
+		ReliableRPC->EntityId = EntityId;
+		Receiver->AddPendingReliableRPC(RequestId, ReliableRPC);
+	}
+}
+
+void USpatialSender::FlushCrossServerRPCBatches()
+{
+	for (const TPair<Worker_EntityId_Key, FCrossServerRPCBatch>& Batch : ReliableCrossServerRPCBatches)
+	{
+		SendCrossServerRPCBatch(Batch.Key, Batch.Value, true);
+	}
+	ReliableCrossServerRPCBatches.Reset();
+
+	for (const TPair<Worker_EntityId_Key, FCrossServerRPCBatch>& Batch : UnreliableCrossServerRPCBatches)
+	{
+		SendCrossServerRPCBatch(Batch.Key, Batch.Value, false);
+	}
+	UnreliableCrossServerRPCBatches.Reset();
+}
+
 FRPCErrorInfo USpatialSender::SendLegacyRPC(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef)
 {
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
@@ -761,7 +1208,15 @@ bool USpatialSender::SendRingBufferedRPC(UObject* TargetObject, UFunction* Funct
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 	const EPushRPCResult Result = RPCService->PushRPC(TargetObjectRef.Entity, RPCInfo.Type, Payload, Channel->bCreatedEntity);
 
-	if (Result == EPushRPCResult::Success)
+	// Packed RPCs are flushed at the end of the tick, so that every RPC of the same type sent to the entity in that tick shares an element.
+	// Latency critical RPCs end the element early, and don't wait for the connection's next flush either. Only the target entity
+	// is flushed, so the RPCs packed for other entities this tick still share their elements.
+	if (Result == EPushRPCResult::Success && RPCInfo.bLatencyCritical)
+	{
+		FlushRPCService(TargetObjectRef.Entity);
+		Connection->Flush();
+	}
+	else if (Result == EPushRPCResult::Success && !RPCRingBufferUtils::ShouldPackRPCs(RPCInfo.Type))
 	{
 		FlushRPCService();
 	}
@@ -830,22 +1285,81 @@ bool USpatialSender::WillHaveAuthorityOverActor(AActor* TargetActor, Worker_Enti
 	return WillHaveAuthorityOverActor;
 }
 
-void USpatialSender::EnqueueRetryRPC(TSharedRef<FReliableRPCForRetry> RetryRPC)
+float USpatialSender::EnqueueRetryRPC(TSharedRef<FReliableRPCForRetry> RetryRPC)
+{
+	if (RetryRPC->bRetryScheduled)
+	{
+		NumDeduplicatedRetryRPCs++;
+		return -1.0f;
+	}
+
+	const float WaitTime = GetRetryWaitTime(*RetryRPC, GetDefault<USpatialGDKSettings>()->ReliableRPCRetryJitter);
+
+	RetryRPC->bRetryScheduled = true;
+	RetryRPCs.HeapPush(FScheduledRetryRPC{ FPlatformTime::Seconds() + WaitTime, RetryRPC });
+
+	return WaitTime;
+}
+
+float USpatialSender::GetRetryWaitTime(const FReliableRPCForRetry& RetryRPC, float Jitter)
 {
-	RetryRPCs.Add(RetryRPC);
+	const FRandomStream TargetStream(static_cast<int32>(HashCombine(GetTypeHash(RetryRPC.TargetObject), GetTypeHash(RetryRPC.Attempts))));
+	return SpatialConstants::GetCommandRetryWaitTimeSeconds(RetryRPC.Attempts) * TargetStream.FRandRange(1.0f - Jitter, 1.0f + Jitter);
 }
 
 void USpatialSender::FlushRetryRPCs()
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderFlushRetryRPCs);
 
-	// Retried RPCs are sorted by their index.
-	RetryRPCs.Sort([](const TSharedRef<FReliableRPCForRetry>& A, const TSharedRef<FReliableRPCForRetry>& B) { return A->RetryIndex < B->RetryIndex; });
-	for (auto& RetryRPC : RetryRPCs)
+	if (RetryRPCs.Num() == 0)
+	{
+		return;
+	}
+
+	// Retries whose target was destroyed, e.g. with its entity leaving this worker's view, would be dropped when due, so they are
+	// dropped now instead of counting towards the retries sent this flush.
+	const int32 NumDropped = RetryRPCs.RemoveAll([](const FScheduledRetryRPC& ScheduledRetry)
+	{
+		if (ScheduledRetry.RPC->TargetObject.IsValid())
+		{
+			return false;
+		}
+		ScheduledRetry.RPC->bRetryScheduled = false;
+		return true;
+	});
+	if (NumDropped > 0)
+	{
+		RetryRPCs.Heapify();
+	}
+
+	const uint32 MaxRetriesInFlight = GetDefault<USpatialGDKSettings>()->MaxReliableRPCRetriesInFlight;
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<TSharedRef<FReliableRPCForRetry>> DueRPCs;
+	while (RetryRPCs.Num() > 0 && RetryRPCs.HeapTop().RetryTime <= Now
+		&& (MaxRetriesInFlight == 0 || NumRetryRPCsInFlight + DueRPCs.Num() < MaxRetriesInFlight))
+	{
+		FScheduledRetryRPC ScheduledRetry = RetryRPCs.HeapTop();
+		RetryRPCs.HeapPopDiscard();
+		DueRPCs.Add(ScheduledRetry.RPC);
+	}
+
+	// Retried RPCs that are due together are sorted by their index.
+	DueRPCs.Sort([](const TSharedRef<FReliableRPCForRetry>& A, const TSharedRef<FReliableRPCForRetry>& B) { return A->RetryIndex < B->RetryIndex; });
+	for (TSharedRef<FReliableRPCForRetry>& RetryRPC : DueRPCs)
 	{
+		RetryRPC->bRetryScheduled = false;
 		RetryReliableRPC(RetryRPC);
 	}
-	RetryRPCs.Empty();
+}
+
+void USpatialSender::OnReliableRPCResponse(FReliableRPCForRetry& ReliableRPC)
+{
+	if (ReliableRPC.bRetryInFlight)
+	{
+		ReliableRPC.bRetryInFlight = false;
+		NumRetryRPCsInFlight--;
+	}
 }
 
 void USpatialSender::RetryReliableRPC(TSharedRef<FReliableRPCForRetry> RetryRPC)
@@ -869,27 +1383,93 @@ void USpatialSender::RetryReliableRPC(TSharedRef<FReliableRPCForRetry> RetryRPC)
 
 	// The number of attempts is used to determine the delay in case the command times out and we need to resend it.
 	RetryRPC->Attempts++;
+	RetryRPC->EntityId = TargetObjectRef.Entity;
 	UE_LOG(LogSpatialSender, Verbose, TEXT("Sending reliable command request (entity: %lld, component: %d, function: %s, attempt: %d)"),
 		TargetObjectRef.Entity, RetryRPC->ComponentId, *RetryRPC->Function->GetName(), RetryRPC->Attempts);
 	Receiver->AddPendingReliableRPC(RequestId, RetryRPC);
+
+	NumRetriedRPCs++;
+	if (!RetryRPC->bRetryInFlight)
+	{
+		RetryRPC->bRetryInFlight = true;
+		NumRetryRPCsInFlight++;
+	}
 }
 
 void USpatialSender::RegisterChannelForPositionUpdate(USpatialActorChannel* Channel)
 {
-	ChannelsToUpdatePosition.Add(Channel);
+	if (Channel->SetPendingPositionUpdate())
+	{
+		ChannelsToUpdatePosition.Add(Channel);
+	}
 }
 
 void USpatialSender::ProcessPositionUpdates()
 {
-	for (auto& Channel : ChannelsToUpdatePosition)
+	FPositionUpdateBatch& Batch = PositionUpdateBatch;
+	const int32 MaxUpdates = ChannelsToUpdatePosition.Num();
+	Batch.Channels.Reset(MaxUpdates);
+	Batch.X.Reset(MaxUpdates);
+	Batch.Y.Reset(MaxUpdates);
+	Batch.Z.Reset(MaxUpdates);
+	Batch.LastX.Reset(MaxUpdates);
+	Batch.LastY.Reset(MaxUpdates);
+	Batch.LastZ.Reset(MaxUpdates);
+
+	// Gather the current and last sent positions of every channel which updates the position of its actor.
+	for (const TWeakObjectPtr<USpatialActorChannel>& WeakChannel : ChannelsToUpdatePosition)
 	{
-		if (Channel.IsValid())
+		USpatialActorChannel* Channel = WeakChannel.Get();
+		if (Channel == nullptr)
+		{
+			continue;
+		}
+
+		Channel->ClearPendingPositionUpdate();
+
+		FVector Position;
+		FVector LastPosition;
+		if (Channel->GetSpatialPositionForUpdate(Position, LastPosition))
 		{
-			Channel->UpdateSpatialPosition();
+			Batch.Channels.Add(Channel);
+			Batch.X.Add(Position.X);
+			Batch.Y.Add(Position.Y);
+			Batch.Z.Add(Position.Z);
+			Batch.LastX.Add(LastPosition.X);
+			Batch.LastY.Add(LastPosition.Y);
+			Batch.LastZ.Add(LastPosition.Z);
 		}
 	}
 
-	ChannelsToUpdatePosition.Empty();
+	ChannelsToUpdatePosition.Reset();
+
+	// Check the distance threshold for all of them at once. Kept free of branches and calls so it auto-vectorizes.
+	const int32 NumCandidates = Batch.Channels.Num();
+	Batch.bMoved.SetNumUninitialized(NumCandidates, /* bAllowShrinking */ false);
+
+	const float ThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
+	const float* RESTRICT X = Batch.X.GetData();
+	const float* RESTRICT Y = Batch.Y.GetData();
+	const float* RESTRICT Z = Batch.Z.GetData();
+	const float* RESTRICT LastX = Batch.LastX.GetData();
+	const float* RESTRICT LastY = Batch.LastY.GetData();
+	const float* RESTRICT LastZ = Batch.LastZ.GetData();
+	uint8* RESTRICT bMoved = Batch.bMoved.GetData();
+	for (int32 i = 0; i < NumCandidates; i++)
+	{
+		const float DX = X[i] - LastX[i];
+		const float DY = Y[i] - LastY[i];
+		const float DZ = Z[i] - LastZ[i];
+		bMoved[i] = (DX * DX + DY * DY + DZ * DZ) >= ThresholdSquared;
+	}
+
+	for (int32 i = 0; i < NumCandidates; i++)
+	{
+		if (bMoved[i])
+		{
+			Batch.Channels[i]->CommitSpatialPositionUpdate(FVector(X[i], Y[i], Z[i]));
+		}
+	}
 }
 
 void USpatialSender::SendCreateEntityRequest(USpatialActorChannel* Channel, uint32& OutBytesWritten)
@@ -944,20 +1524,21 @@ void USpatialSender::ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetO
 	UFunction* Function = ClassInfo.RPCs[InPayload.Index];
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
-	OutgoingRPCs.ProcessOrQueueRPC(InTargetObjectRef, RPCInfo.Type, MoveTemp(InPayload));
+	ProcessOrQueueOutgoingRPC(InTargetObjectRef, RPCInfo.Type, MoveTemp(InPayload));
+}
+
+void USpatialSender::ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, ERPCType RPCType, SpatialGDK::RPCPayload&& InPayload)
+{
+	OutgoingRPCs.ProcessOrQueueRPC(InTargetObjectRef, RPCType, MoveTemp(InPayload));
 
 	// Try to send all pending RPCs unconditionally
 	OutgoingRPCs.ProcessRPCs();
 }
 
-FSpatialNetBitWriter USpatialSender::PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters) const
+void USpatialSender::PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, FSpatialNetBitWriter& PayloadWriter) const
 {
-	FSpatialNetBitWriter PayloadWriter(PackageMap);
-
 	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
 	RepLayout_SendPropertiesForRPC(*RepLayout, PayloadWriter, Parameters);
-
-	return PayloadWriter;
 }
 
 Worker_CommandRequest USpatialSender::CreateRPCCommandRequest(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, Worker_EntityId& OutEntityId)
@@ -986,7 +1567,27 @@ Worker_CommandRequest USpatialSender::CreateRetryRPCCommandRequest(const FReliab
 	CommandRequest.schema_type = Schema_CreateCommandRequest();
 	Schema_Object* RequestObject = Schema_GetCommandRequestObject(CommandRequest.schema_type);
 
-	RPCPayload::WriteToSchemaObject(RequestObject, TargetObjectOffset, RPC.RPCIndex, RPC.Payload.GetData(), RPC.Payload.Num());
+	if (RPC.PackedFunctions.Num() > 0)
+	{
+		AddBytesToSchema(RequestObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID, RPC.Payload.GetData(), RPC.Payload.Num());
+	}
+	else
+	{
+		RPCPayload::WriteToSchemaObject(RequestObject, TargetObjectOffset, RPC.RPCIndex, RPC.Payload.GetData(), RPC.Payload.Num());
+	}
+
+	return CommandRequest;
+}
+
+Worker_CommandRequest USpatialSender::CreatePackedRPCCommandRequest(Worker_ComponentId ComponentId, const TArray<uint8>& PackedRPCs)
+{
+	Worker_CommandRequest CommandRequest = {};
+	CommandRequest.component_id = ComponentId;
+	CommandRequest.command_index = SpatialConstants::UNREAL_RPC_ENDPOINT_COMMAND_ID;
+	CommandRequest.schema_type = Schema_CreateCommandRequest();
+	Schema_Object* RequestObject = Schema_GetCommandRequestObject(CommandRequest.schema_type);
+
+	AddBytesToSchema(RequestObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID, PackedRPCs.GetData(), PackedRPCs.Num());
 
 	return CommandRequest;
 }
@@ -1052,6 +1653,7 @@ void USpatialSender::UpdateClientAuthoritativeComponentAclEntries(Worker_EntityI
 void USpatialSender::UpdateInterestComponent(AActor* Actor)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderUpdateInterestComponent);
+	SPATIALGDK_SUBSYSTEM_SCOPE(InterestUpdate);
 
 	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
 	if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
@@ -1060,13 +1662,33 @@ void USpatialSender::UpdateInterestComponent(AActor* Actor)
 		return;
 	}
 
-	FWorkerComponentUpdate Update = NetDriver->InterestFactory->CreateInterestUpdate(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), EntityId);
+	Worker_ComponentUpdate InterestUpdate;
+	if (!NetDriver->InterestFactory->CreateInterestUpdateIfChanged(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), EntityId, InterestUpdate))
+	{
+		return;
+	}
 
+	FWorkerComponentUpdate Update = InterestUpdate;
 	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
 void USpatialSender::RetireEntity(const Worker_EntityId EntityId, bool bIsNetStartupActor)
 {
+	if (bIsNetStartupActor && NetDriver->StartupActorTombstones.IsValid())
+	{
+		// Resolve the actor before RemoveActor unmaps it, so it can be added to its level's tombstones.
+		AActor* Actor = Cast<AActor>(PackageMap->GetObjectFromEntityId(EntityId));
+		if (Actor != nullptr)
+		{
+			Receiver->RemoveActor(EntityId);
+
+			// The level's tombstones keep the actor from being loaded again, so the entity itself is deleted once they're written.
+			UE_LOG(LogSpatialSender, Log, TEXT("Tombstoning startup actor %s, its entity %lld is deleted once the tombstone is written"), *Actor->GetName(), EntityId);
+			NetDriver->StartupActorTombstones->TombstoneActor(*Actor, EntityId);
+			return;
+		}
+	}
+
 	if (bIsNetStartupActor)
 	{
 		Receiver->RemoveActor(EntityId);
@@ -1114,6 +1736,31 @@ void USpatialSender::CreateTombstoneEntity(AActor* Actor)
 #endif
 }
 
+Worker_EntityId USpatialSender::CreateLevelTombstonesEntity(const SpatialGDK::LevelTombstones& Tombstones)
+{
+	const Worker_EntityId EntityId = PackageMap->AllocateEntityId();
+
+	WriteAclMap ComponentWriteAcl;
+	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+	ComponentWriteAcl.Add(SpatialConstants::METADATA_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+	ComponentWriteAcl.Add(SpatialConstants::PERSISTENCE_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+	ComponentWriteAcl.Add(SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+	ComponentWriteAcl.Add(SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+
+	TArray<FWorkerComponentData> Components;
+	Components.Add(Position().CreatePositionData());
+	Components.Add(Metadata(FString::Printf(TEXT("LevelTombstones:%s"), *Tombstones.LevelPath)).CreateMetadataData());
+	Components.Add(Persistence().CreatePersistenceData());
+	Components.Add(EntityAcl(SpatialConstants::ClientOrServerPermission, ComponentWriteAcl).CreateEntityAclData());
+	Components.Add(Tombstones.CreateLevelTombstonesData());
+	Components.Add(ComponentPresence(EntityFactory::GetComponentPresenceList(Components)).CreateComponentPresenceData());
+
+	CreateEntityWithRetries(EntityId, FString::Printf(TEXT("LevelTombstones:%s"), *Tombstones.LevelPath), MoveTemp(Components));
+
+	return EntityId;
+}
+
 void USpatialSender::AddTombstoneToEntity(const Worker_EntityId EntityId)
 {
 	check(NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::TOMBSTONE_COMPONENT_ID));
@@ -1128,3 +1775,37 @@ void USpatialSender::AddTombstoneToEntity(const Worker_EntityId EntityId)
 	NetDriver->TrackTombstone(EntityId);
 #endif
 }
+
+SIZE_T USpatialSender::GetOutgoingQueuesAllocatedSize() const
+{
+	SIZE_T TotalBytes = OutgoingOnCreateEntityRPCs.GetAllocatedSize() + RetryRPCs.GetAllocatedSize()
+		+ ReliableCrossServerRPCBatches.GetAllocatedSize() + UnreliableCrossServerRPCBatches.GetAllocatedSize()
+		+ UpdatesQueuedUntilAuthorityMap.GetAllocatedSize() + ChannelsToUpdatePosition.GetAllocatedSize()
+		+ PendingAuthorityIntentUpdates.GetAllocatedSize() + AuthorityIntentUpdatesToFlush.GetAllocatedSize();
+
+	for (const auto& Pair : OutgoingOnCreateEntityRPCs)
+	{
+		TotalBytes += Pair.Value.RPCs.GetAllocatedSize();
+		for (const SpatialGDK::RPCPayload& Payload : Pair.Value.RPCs)
+		{
+			TotalBytes += Payload.PayloadData.GetAllocatedSize();
+		}
+	}
+	for (const FScheduledRetryRPC& Retry : RetryRPCs)
+	{
+		TotalBytes += sizeof(FReliableRPCForRetry) + Retry.RPC->Payload.GetAllocatedSize() + Retry.RPC->PackedFunctions.GetAllocatedSize();
+	}
+	for (const TMap<Worker_EntityId_Key, FCrossServerRPCBatch>* Batches : { &ReliableCrossServerRPCBatches, &UnreliableCrossServerRPCBatches })
+	{
+		for (const auto& Pair : *Batches)
+		{
+			TotalBytes += Pair.Value.PackedRPCs.GetAllocatedSize() + Pair.Value.Functions.GetAllocatedSize();
+		}
+	}
+	for (const auto& Pair : UpdatesQueuedUntilAuthorityMap)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+	}
+
+	return TotalBytes;
+}
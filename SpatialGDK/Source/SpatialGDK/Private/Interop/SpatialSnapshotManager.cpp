@@ -4,8 +4,10 @@
 
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/GlobalStateManager.h"
+#include "Interop/RuntimeCheckpoints.h"
 #include "Interop/SpatialReceiver.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSnapshotManager);
@@ -30,60 +32,141 @@ void SpatialSnapshotManager::Init(USpatialWorkerConnection* InConnection, UGloba
 	GlobalStateManager = InGlobalStateManager;
 }
 
+struct SpatialSnapshotManager::FWorldWipe
+{
+	TWeakObjectPtr<USpatialWorkerConnection> Connection;
+	TWeakObjectPtr<USpatialReceiver> Receiver;
+	PostWorldWipeDelegate OnWorldWiped;
+
+	TArray<Worker_EntityId> EntitiesToDelete;
+	int32 NextEntityToDelete = 0;
+	int32 NumRequestsInFlight = 0;
+	int32 MaxRequestsInFlight = 0;
+
+	int32 NumQueries = 0;
+	int32 NumEntitiesDeleted = 0;
+	double StartTime = 0.0;
+};
+
 // WorldWipe will send out an expensive entity query for every entity in the deployment.
 // It does this by sending an entity query for all entities with the Unreal Metadata Component
-// Once it has the response to this query, it will send deletion requests for all found entities.
+// Once it has the response to this query, it will send deletion requests for all found entities, keeping at most
+// MaxWorldWipeDeleteRequestsInFlight requests awaiting a response. Once every request has been answered, the query is repeated
+// to pick up entities whose deletion timed out, until no entities are left.
 // Should only be triggered by the worker which is authoritative over the GSM.
 void SpatialSnapshotManager::WorldWipe(const PostWorldWipeDelegate& PostWorldWipeDelegate)
 {
 	UE_LOG(LogSnapshotManager, Log, TEXT("World wipe for deployment has been triggered. All entities with the UnrealMetaData component will be deleted!"));
 
+	TSharedRef<FWorldWipe> Wipe = MakeShared<FWorldWipe>();
+	Wipe->Connection = Connection;
+	Wipe->Receiver = Receiver;
+	Wipe->OnWorldWiped = PostWorldWipeDelegate;
+	Wipe->MaxRequestsInFlight = FMath::Max<int32>(GetDefault<USpatialGDKSettings>()->MaxWorldWipeDeleteRequestsInFlight, 1);
+	Wipe->StartTime = FPlatformTime::Seconds();
+
+	QueryEntitiesToDelete(Wipe);
+}
+
+void SpatialSnapshotManager::QueryEntitiesToDelete(const TSharedRef<FWorldWipe>& Wipe)
+{
 	Worker_Constraint UnrealMetadataConstraint;
 	UnrealMetadataConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
 	UnrealMetadataConstraint.constraint.component_constraint.component_id = SpatialConstants::UNREAL_METADATA_COMPONENT_ID;
 
+	// Only the entity IDs are needed, so don't request any component data.
+	Worker_ComponentId NoComponentIds[1] = {};
+
 	Worker_EntityQuery WorldQuery{};
 	WorldQuery.constraint = UnrealMetadataConstraint;
 	WorldQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+	WorldQuery.snapshot_result_type_component_id_count = 0;
+	WorldQuery.snapshot_result_type_component_ids = NoComponentIds;
 
 	Worker_RequestId RequestID;
-	check(Connection.IsValid());
-	RequestID = Connection->SendEntityQueryRequest(&WorldQuery);
+	check(Wipe->Connection.IsValid());
+	RequestID = Wipe->Connection->SendEntityQueryRequest(&WorldQuery);
+	Wipe->NumQueries++;
 
 	EntityQueryDelegate WorldQueryDelegate;
-	WorldQueryDelegate.BindLambda([Connection = this->Connection, PostWorldWipeDelegate](const Worker_EntityQueryResponseOp& Op)
+	WorldQueryDelegate.BindLambda([Wipe](const Worker_EntityQueryResponseOp& Op)
 	{
 		if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 		{
 			UE_LOG(LogSnapshotManager, Error, TEXT("SnapshotManager WorldWipe - World entity query failed: %s"), UTF8_TO_TCHAR(Op.message));
 		}
-		else if (Op.result_count == 0)
+		else if (Op.result_count == 0 && Wipe->NumQueries == 1)
 		{
 			UE_LOG(LogSnapshotManager, Error, TEXT("SnapshotManager WorldWipe - No entities found in world entity query"));
 		}
-		else
+		else if (Op.result_count == 0 || Wipe->NumQueries > MaxWorldWipeQueries)
 		{
-			// Send deletion requests for all entities found in the world entity query.
-			DeleteEntities(Op, Connection);
+			if (Op.result_count > 0)
+			{
+				UE_LOG(LogSnapshotManager, Warning, TEXT("SnapshotManager WorldWipe - %u entities are left after %d attempts to delete them."), Op.result_count, MaxWorldWipeQueries);
+			}
+
+			UE_LOG(LogSnapshotManager, Log, TEXT("World wipe finished: %d entities deleted in %.1f seconds."), Wipe->NumEntitiesDeleted, FPlatformTime::Seconds() - Wipe->StartTime);
 
 			// The world is now ready to finish ServerTravel which means loading in a new map.
-			PostWorldWipeDelegate.ExecuteIfBound();
+			Wipe->OnWorldWiped.ExecuteIfBound();
+		}
+		else
+		{
+			UE_LOG(LogSnapshotManager, Log, TEXT("Deleting %u entities."), Op.result_count);
+
+			Wipe->EntitiesToDelete.Reset(Op.result_count);
+			Wipe->NextEntityToDelete = 0;
+			for (uint32_t i = 0; i < Op.result_count; i++)
+			{
+				Wipe->EntitiesToDelete.Add(Op.results[i].entity_id);
+			}
+
+			DeleteEntities(Wipe);
 		}
 	});
 
-	check(Receiver.IsValid());
-	Receiver->AddEntityQueryDelegate(RequestID, WorldQueryDelegate);
+	check(Wipe->Receiver.IsValid());
+	Wipe->Receiver->AddEntityQueryDelegate(RequestID, WorldQueryDelegate);
 }
 
-void SpatialSnapshotManager::DeleteEntities(const Worker_EntityQueryResponseOp& Op, TWeakObjectPtr<USpatialWorkerConnection> Connection)
+// Sends delete requests for the queried entities until MaxRequestsInFlight are awaiting a response. Each response sends the next one.
+void SpatialSnapshotManager::DeleteEntities(const TSharedRef<FWorldWipe>& Wipe)
 {
-	UE_LOG(LogSnapshotManager, Log, TEXT("Deleting %u entities."), Op.result_count);
+	check(Wipe->Connection.IsValid());
+	check(Wipe->Receiver.IsValid());
+
+	while (Wipe->NumRequestsInFlight < Wipe->MaxRequestsInFlight && Wipe->NextEntityToDelete < Wipe->EntitiesToDelete.Num())
+	{
+		const Worker_EntityId EntityId = Wipe->EntitiesToDelete[Wipe->NextEntityToDelete++];
+
+		UE_LOG(LogSnapshotManager, Verbose, TEXT("Sending delete request for: %lld"), EntityId);
+		Worker_RequestId RequestID = Wipe->Connection->SendDeleteEntityRequest(EntityId);
+		Wipe->NumRequestsInFlight++;
+
+		DeleteEntityDelegate OnDeleteEntityResponse;
+		OnDeleteEntityResponse.BindLambda([Wipe](const Worker_DeleteEntityResponseOp& Op)
+		{
+			Wipe->NumRequestsInFlight--;
+			if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
+			{
+				Wipe->NumEntitiesDeleted++;
+			}
+			else
+			{
+				// The entity is picked up again by the next query if it still exists.
+				UE_LOG(LogSnapshotManager, Verbose, TEXT("Delete request for %lld failed: %s"), Op.entity_id, UTF8_TO_TCHAR(Op.message));
+			}
 
-	for (uint32_t i = 0; i < Op.result_count; i++)
+			DeleteEntities(Wipe);
+		});
+		Wipe->Receiver->AddDeleteEntityDelegate(RequestID, OnDeleteEntityResponse);
+	}
+
+	if (Wipe->NumRequestsInFlight == 0 && Wipe->NextEntityToDelete == Wipe->EntitiesToDelete.Num())
 	{
-		UE_LOG(LogSnapshotManager, Verbose, TEXT("Sending delete request for: %i"), Op.results[i].entity_id);
-		check(Connection.IsValid());
-		Connection->SendDeleteEntityRequest(Op.results[i].entity_id);
+		// Query again to check that every entity is gone.
+		QueryEntitiesToDelete(Wipe);
 	}
 }
 
@@ -100,11 +183,113 @@ FString GetSnapshotPath(const FString& SnapshotName)
 	return SnapshotsDirectory + SnapshotName;
 }
 
+struct SpatialSnapshotManager::FStreamingSnapshotLoad
+{
+	~FStreamingSnapshotLoad()
+	{
+		if (Snapshot != nullptr)
+		{
+			Worker_SnapshotInputStream_Destroy(Snapshot);
+		}
+
+		// Entities read but not yet sent, e.g. if the load was aborted.
+		for (TArray<FWorkerComponentData>& EntityComponents : ReservingEntities)
+		{
+			for (FWorkerComponentData& ComponentData : EntityComponents)
+			{
+				Schema_DestroyComponentData(ComponentData.schema_type);
+			}
+		}
+	}
+
+	TWeakObjectPtr<USpatialWorkerConnection> Connection;
+	TWeakObjectPtr<UGlobalStateManager> GlobalStateManager;
+	TWeakObjectPtr<USpatialReceiver> Receiver;
+
+	Worker_SnapshotInputStream* Snapshot = nullptr;
+	// Read after Snapshot, in order.
+	TArray<FString> RemainingSnapshotPaths;
+	// Skips entities which were deleted or already read from a newer chunk, when loading a checkpoint.
+	TOptional<FCheckpointRestoreFilter> CheckpointFilter;
+	int32 BatchSize = 0;
+	int32 MaxRequestsInFlight = 0;
+
+	// The batch of entities waiting on its reserve entity IDs response. Only one batch is reserved at a time.
+	TArray<TArray<FWorkerComponentData>> ReservingEntities;
+	bool bReservingEntityIds = false;
+	bool bFinishedReading = false;
+	bool bAborted = false;
+
+	int32 NumRequestsInFlight = 0;
+	int32 NumEntitiesCreated = 0;
+	int32 NumEntitiesFailed = 0;
+
+	double StartTime = 0.0;
+	double LastProgressLogTime = 0.0;
+};
+
 // LoadSnapshot will take a snapshot name which should be on disk and attempt to read and spawn all of the entities in that snapshot.
+// The snapshot is streamed in batches of SnapshotLoadBatchSize entities. Each batch reserves its entity IDs, and the next batch is read
+// while the previous one's create entity requests are in flight, up to MaxSnapshotCreateEntityRequestsInFlight requests.
 // This should only be called from the worker which has authority over the GSM.
 void SpatialSnapshotManager::LoadSnapshot(const FString& SnapshotName)
 {
-	FString SnapshotPath = GetSnapshotPath(SnapshotName);
+	StartLoadSnapshot({ GetSnapshotPath(SnapshotName) }, {});
+}
+
+// LoadCheckpoint reads the chunks of a checkpoint newest first with the streaming snapshot loader, so each entity is created from
+// the newest chunk it was written to, and entities deleted since are skipped.
+// This should only be called from the worker which has authority over the GSM, on an empty deployment.
+void SpatialSnapshotManager::LoadCheckpoint(const FString& CheckpointDirectory)
+{
+	TArray<FString> SnapshotPaths;
+	TSet<Worker_EntityId> DeletedEntityIds;
+	FFileCheckpointStorage::FindChunks(CheckpointDirectory, SnapshotPaths, DeletedEntityIds);
+
+	UE_LOG(LogSnapshotManager, Log, TEXT("Loading checkpoint '%s': %d chunks, %d deleted entities."), *CheckpointDirectory, SnapshotPaths.Num(), DeletedEntityIds.Num());
+	if (SnapshotPaths.Num() == 0)
+	{
+		UE_LOG(LogSnapshotManager, Error, TEXT("No checkpoint chunks found in '%s'."), *CheckpointDirectory);
+		return;
+	}
+
+	StartLoadSnapshot(MoveTemp(SnapshotPaths), FCheckpointRestoreFilter(MoveTemp(DeletedEntityIds)));
+}
+
+void SpatialSnapshotManager::StartLoadSnapshot(TArray<FString>&& SnapshotPaths, TOptional<FCheckpointRestoreFilter>&& CheckpointFilter)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	TSharedRef<FStreamingSnapshotLoad> Load = MakeShared<FStreamingSnapshotLoad>();
+	Load->Connection = Connection;
+	Load->GlobalStateManager = GlobalStateManager;
+	Load->Receiver = Receiver;
+	Load->RemainingSnapshotPaths = MoveTemp(SnapshotPaths);
+	Load->CheckpointFilter = MoveTemp(CheckpointFilter);
+	Load->BatchSize = FMath::Max<int32>(SpatialGDKSettings->SnapshotLoadBatchSize, 1);
+	Load->MaxRequestsInFlight = FMath::Max<int32>(SpatialGDKSettings->MaxSnapshotCreateEntityRequestsInFlight, Load->BatchSize);
+	Load->StartTime = FPlatformTime::Seconds();
+	Load->LastProgressLogTime = Load->StartTime;
+
+	if (!OpenNextSnapshot(*Load))
+	{
+		return;
+	}
+
+	// TODO: UNR-654
+	// References to entities that are stored within the snapshot need remapping once we know the new entity IDs.
+
+	ContinueLoadSnapshot(Load);
+}
+
+// Opens the next of the remaining snapshots. Returns false if it couldn't be read, which aborts the load.
+bool SpatialSnapshotManager::OpenNextSnapshot(FStreamingSnapshotLoad& Load)
+{
+	check(Load.Snapshot == nullptr);
+	check(Load.RemainingSnapshotPaths.Num() > 0);
+
+	const FString SnapshotPath = Load.RemainingSnapshotPaths[0];
+	Load.RemainingSnapshotPaths.RemoveAt(0);
 
 	UE_LOG(LogSnapshotManager, Log, TEXT("Loading snapshot: '%s'"), *SnapshotPath);
 
@@ -119,93 +304,196 @@ void SpatialSnapshotManager::LoadSnapshot(const FString& SnapshotName)
 	{
 		UE_LOG(LogSnapshotManager, Error, TEXT("Error when attempting to read snapshot '%s': %s"), *SnapshotPath, *Error);
 		Worker_SnapshotInputStream_Destroy(Snapshot);
+		Load.bAborted = true;
+		return false;
+	}
+
+	Load.Snapshot = Snapshot;
+	return true;
+}
+
+// Reads the next batch of entities and reserves entity IDs for it if there is room in the in-flight window, or finishes the load
+// once every entity has been read and created.
+void SpatialSnapshotManager::ContinueLoadSnapshot(const TSharedRef<FStreamingSnapshotLoad>& Load)
+{
+	if (Load->bAborted || Load->bReservingEntityIds)
+	{
+		return;
+	}
+
+	if (Load->bFinishedReading)
+	{
+		if (Load->NumRequestsInFlight == 0)
+		{
+			FinishLoadSnapshot(Load);
+		}
+		return;
+	}
+
+	if (Load->NumRequestsInFlight + Load->BatchSize > Load->MaxRequestsInFlight)
+	{
+		// Wait for create entity responses before reading more of the snapshot.
 		return;
 	}
 
-	TArray<TArray<FWorkerComponentData>> EntitiesToSpawn;
+	Worker_SnapshotInputStream* Snapshot = Load->Snapshot;
+	TArray<TArray<FWorkerComponentData>>& EntitiesToSpawn = Load->ReservingEntities;
+	check(EntitiesToSpawn.Num() == 0);
+	EntitiesToSpawn.Reserve(Load->BatchSize);
 
-	// Get all of the entities from the snapshot.
-	while (Worker_SnapshotInputStream_HasNext(Snapshot) > 0)
+	while (EntitiesToSpawn.Num() < Load->BatchSize && Worker_SnapshotInputStream_HasNext(Snapshot) > 0)
 	{
-		Error = Worker_SnapshotInputStream_GetState(Snapshot).error_message;
+		FString Error = Worker_SnapshotInputStream_GetState(Snapshot).error_message;
 		if (!Error.IsEmpty())
 		{
 			UE_LOG(LogSnapshotManager, Error, TEXT("Error when reading snapshot. Aborting load snapshot: %s"), *Error);
-			Worker_SnapshotInputStream_Destroy(Snapshot);
+			Load->bAborted = true;
 			return;
 		}
 
 		const Worker_Entity* EntityToSpawn = Worker_SnapshotInputStream_ReadEntity(Snapshot);
 
 		Error = Worker_SnapshotInputStream_GetState(Snapshot).error_message;
-		if (Error.IsEmpty())
+		if (!Error.IsEmpty())
 		{
-			TArray<FWorkerComponentData> EntityComponents;
-			for (uint32_t i = 0; i < EntityToSpawn->component_count; ++i)
-			{
-				// Entity component data must be deep copied so that it can be used for CreateEntityRequest.
-				Schema_ComponentData* CopySchemaData = Schema_CopyComponentData(EntityToSpawn->components[i].schema_type);
-				FWorkerComponentData EntityComponentData{};
-				EntityComponentData.component_id = EntityToSpawn->components[i].component_id;
-				EntityComponentData.schema_type = CopySchemaData;
-				EntityComponents.Add(EntityComponentData);
-			}
+			UE_LOG(LogSnapshotManager, Error, TEXT("Error when reading snapshot. Aborting load snapshot: %s"), *Error);
+			Load->bAborted = true;
+			return;
+		}
 
-			EntitiesToSpawn.Add(EntityComponents);
+		if (Load->CheckpointFilter.IsSet() && !Load->CheckpointFilter->ShouldRestore(EntityToSpawn->entity_id))
+		{
+			continue;
 		}
-		else
+
+		TArray<FWorkerComponentData>& EntityComponents = EntitiesToSpawn.AddDefaulted_GetRef();
+		EntityComponents.Reserve(EntityToSpawn->component_count);
+		for (uint32_t i = 0; i < EntityToSpawn->component_count; ++i)
+		{
+			// Entity component data must be deep copied so that it can be used for CreateEntityRequest.
+			Schema_ComponentData* CopySchemaData = Schema_CopyComponentData(EntityToSpawn->components[i].schema_type);
+			FWorkerComponentData EntityComponentData{};
+			EntityComponentData.component_id = EntityToSpawn->components[i].component_id;
+			EntityComponentData.schema_type = CopySchemaData;
+			EntityComponents.Add(EntityComponentData);
+		}
+	}
+
+	if (Worker_SnapshotInputStream_HasNext(Snapshot) <= 0)
+	{
+		Worker_SnapshotInputStream_Destroy(Snapshot);
+		Load->Snapshot = nullptr;
+
+		if (Load->RemainingSnapshotPaths.Num() == 0)
+		{
+			Load->bFinishedReading = true;
+		}
+		else if (!OpenNextSnapshot(*Load))
 		{
-			UE_LOG(LogSnapshotManager, Error, TEXT("Error when reading snapshot. Aborting load snapshot: %s"), *Error);
-			Worker_SnapshotInputStream_Destroy(Snapshot);
 			return;
 		}
 	}
 
-	Worker_SnapshotInputStream_Destroy(Snapshot);
+	if (EntitiesToSpawn.Num() == 0)
+	{
+		ContinueLoadSnapshot(Load);
+		return;
+	}
 
-	// Set up reserve IDs delegate
 	ReserveEntityIDsDelegate SpawnEntitiesDelegate;
-	SpawnEntitiesDelegate.BindLambda([Connection = this->Connection, GlobalStateManager = this->GlobalStateManager, EntitiesToSpawn](const Worker_ReserveEntityIdsResponseOp& Op)
+	SpawnEntitiesDelegate.BindLambda([Load](const Worker_ReserveEntityIdsResponseOp& Op)
+	{
+		CreateEntities(Load, Op);
+	});
+
+	check(Load->Connection.IsValid());
+	Worker_RequestId ReserveRequestID = Load->Connection->SendReserveEntityIdsRequest(EntitiesToSpawn.Num());
+	Load->bReservingEntityIds = true;
+
+	check(Load->Receiver.IsValid());
+	Load->Receiver->AddReserveEntityIdsDelegate(ReserveRequestID, SpawnEntitiesDelegate);
+}
+
+void SpatialSnapshotManager::CreateEntities(const TSharedRef<FStreamingSnapshotLoad>& Load, const Worker_ReserveEntityIdsResponseOp& Op)
+{
+	Load->bReservingEntityIds = false;
+
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 	{
-		UE_LOG(LogSnapshotManager, Log, TEXT("Creating entities in snapshot, number of entities to spawn: %i"), Op.number_of_entity_ids);
+		UE_LOG(LogSnapshotManager, Error, TEXT("Failed to reserve entity IDs for snapshot. Aborting load snapshot: %s"), UTF8_TO_TCHAR(Op.message));
+		Load->bAborted = true;
+		return;
+	}
+
+	TArray<TArray<FWorkerComponentData>> EntitiesToSpawn = MoveTemp(Load->ReservingEntities);
+	Load->ReservingEntities.Reset();
 
-		// Ensure we have the same number of reserved IDs as we have entities to spawn
-		check(EntitiesToSpawn.Num() == Op.number_of_entity_ids);
-		check(GlobalStateManager.IsValid());
-		check(Connection.IsValid());
+	UE_LOG(LogSnapshotManager, Verbose, TEXT("Creating batch of entities in snapshot, number of entities to spawn: %i"), Op.number_of_entity_ids);
 
-		for (uint32_t i = 0; i < Op.number_of_entity_ids; i++)
+	// Ensure we have the same number of reserved IDs as we have entities to spawn
+	check(EntitiesToSpawn.Num() == Op.number_of_entity_ids);
+	check(Load->GlobalStateManager.IsValid());
+	check(Load->Connection.IsValid());
+	check(Load->Receiver.IsValid());
+
+	CreateEntityDelegate OnCreateEntityResponse;
+	OnCreateEntityResponse.BindLambda([Load](const Worker_CreateEntityResponseOp& ResponseOp)
+	{
+		Load->NumRequestsInFlight--;
+		if (ResponseOp.status_code == WORKER_STATUS_CODE_SUCCESS)
 		{
-			// Get an entity to spawn and a reserved EntityID
-			TArray<FWorkerComponentData> EntityToSpawn = EntitiesToSpawn[i];
-			Worker_EntityId ReservedEntityID = Op.first_entity_id + i;
+			Load->NumEntitiesCreated++;
+		}
+		else
+		{
+			Load->NumEntitiesFailed++;
+			UE_LOG(LogSnapshotManager, Warning, TEXT("Failed to create snapshot entity %lld: %s"), ResponseOp.entity_id, UTF8_TO_TCHAR(ResponseOp.message));
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now - Load->LastProgressLogTime >= 5.0)
+		{
+			Load->LastProgressLogTime = Now;
+			UE_LOG(LogSnapshotManager, Log, TEXT("Loading snapshot: %d entities created, %d in flight, %.0f entities/s."),
+				Load->NumEntitiesCreated, Load->NumRequestsInFlight, Load->NumEntitiesCreated / (Now - Load->StartTime));
+		}
+
+		ContinueLoadSnapshot(Load);
+	});
+
+	for (uint32_t i = 0; i < Op.number_of_entity_ids; i++)
+	{
+		// Get an entity to spawn and a reserved EntityID
+		TArray<FWorkerComponentData>& EntityToSpawn = EntitiesToSpawn[i];
+		Worker_EntityId ReservedEntityID = Op.first_entity_id + i;
 
-			// Check if this is the GSM
-			for (auto& ComponentData : EntityToSpawn)
+		// Check if this is the GSM
+		for (auto& ComponentData : EntityToSpawn)
+		{
+			if (ComponentData.component_id == SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID)
 			{
-				if (ComponentData.component_id == SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID)
-				{
-					// Save the new GSM Entity ID.
-					GlobalStateManager->GlobalStateManagerEntityId = ReservedEntityID;
-				}
+				// Save the new GSM Entity ID.
+				Load->GlobalStateManager->GlobalStateManagerEntityId = ReservedEntityID;
 			}
-
-			UE_LOG(LogSnapshotManager, Log, TEXT("Sending entity create request for: %i"), ReservedEntityID);
-			Connection->SendCreateEntityRequest(MoveTemp(EntityToSpawn), &ReservedEntityID);
 		}
 
-		GlobalStateManager->SetDeploymentState();
-		GlobalStateManager->SetAcceptingPlayers(true);
-	});
+		UE_LOG(LogSnapshotManager, Verbose, TEXT("Sending entity create request for: %lld"), ReservedEntityID);
+		Worker_RequestId CreateRequestID = Load->Connection->SendCreateEntityRequest(MoveTemp(EntityToSpawn), &ReservedEntityID);
+		Load->Receiver->AddCreateEntityDelegate(CreateRequestID, OnCreateEntityResponse);
+		Load->NumRequestsInFlight++;
+	}
 
-	// Reserve the Entity IDs
-	check(Connection.IsValid());
-	Worker_RequestId ReserveRequestID = Connection->SendReserveEntityIdsRequest(EntitiesToSpawn.Num());
+	// Read the next batch while this one is being created.
+	ContinueLoadSnapshot(Load);
+}
 
-	// TODO: UNR-654
-	// References to entities that are stored within the snapshot need remapping once we know the new entity IDs.
+void SpatialSnapshotManager::FinishLoadSnapshot(const TSharedRef<FStreamingSnapshotLoad>& Load)
+{
+	const double Duration = FPlatformTime::Seconds() - Load->StartTime;
+	UE_LOG(LogSnapshotManager, Log, TEXT("Finished loading snapshot: %d entities created (%d failed) in %.1f seconds, %.0f entities/s."),
+		Load->NumEntitiesCreated, Load->NumEntitiesFailed, Duration, Load->NumEntitiesCreated / FMath::Max(Duration, 0.001));
 
-	// Add the spawn delegate
-	check(Receiver.IsValid());
-	Receiver->AddReserveEntityIdsDelegate(ReserveRequestID, SpawnEntitiesDelegate);
+	check(Load->GlobalStateManager.IsValid());
+	Load->GlobalStateManager->SetDeploymentState();
+	Load->GlobalStateManager->SetAcceptingPlayers(true);
 }
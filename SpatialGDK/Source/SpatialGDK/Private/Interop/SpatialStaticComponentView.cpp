@@ -17,9 +17,85 @@
 #include "Schema/SpatialDebugging.h"
 #include "Schema/SpawnData.h"
 #include "Schema/UnrealMetadata.h"
+#include "SpatialGDKSettings.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpatialStaticComponentView, Log, All);
+
+namespace
+{
+// Size of the data object stored for a component, or 0 for components without a hand-written data class.
+SIZE_T GetComponentDataSize(Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:					return sizeof(SpatialGDK::EntityAcl);
+	case SpatialConstants::METADATA_COMPONENT_ID:					return sizeof(SpatialGDK::Metadata);
+	case SpatialConstants::POSITION_COMPONENT_ID:					return sizeof(SpatialGDK::Position);
+	case SpatialConstants::PERSISTENCE_COMPONENT_ID:				return sizeof(SpatialGDK::Persistence);
+	case SpatialConstants::WORKER_COMPONENT_ID:						return sizeof(SpatialGDK::Worker);
+	case SpatialConstants::SPAWN_DATA_COMPONENT_ID:					return sizeof(SpatialGDK::SpawnData);
+	case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:			return sizeof(SpatialGDK::UnrealMetadata);
+	case SpatialConstants::INTEREST_COMPONENT_ID:					return sizeof(SpatialGDK::Interest);
+	case SpatialConstants::HEARTBEAT_COMPONENT_ID:					return sizeof(SpatialGDK::Heartbeat);
+	case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:				return sizeof(SpatialGDK::RPCsOnEntityCreation);
+	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:	return sizeof(SpatialGDK::ClientRPCEndpointLegacy);
+	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:	return sizeof(SpatialGDK::ServerRPCEndpointLegacy);
+	case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:			return sizeof(SpatialGDK::AuthorityIntent);
+	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:			return sizeof(SpatialGDK::ClientEndpoint);
+	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:			return sizeof(SpatialGDK::ServerEndpoint);
+	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:				return sizeof(SpatialGDK::MulticastRPCs);
+	case SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID:			return sizeof(SpatialGDK::SpatialDebugging);
+	case SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID:			return sizeof(SpatialGDK::ComponentPresence);
+	case SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID:	return sizeof(SpatialGDK::NetOwningClientWorker);
+	default:														return 0;
+	}
+}
+
+// Components whose data the GDK reads from the view, which are kept whatever StaticComponentViewStoredComponentIds contains.
+bool IsReadByGDK(Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+	case SpatialConstants::WORKER_COMPONENT_ID:
+	case SpatialConstants::SPAWN_DATA_COMPONENT_ID:
+	case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:
+	case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:
+	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
+	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
+	case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:
+	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
+	case SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID:
+	case SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID:
+	case SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID:
+		return true;
+	default:
+		return false;
+	}
+}
+} // anonymous namespace
+
+void USpatialStaticComponentView::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		bUseFlatStorage = SpatialGDKSettings->bUseFlatStaticComponentView;
+		StoredComponentIds.Append(SpatialGDKSettings->StaticComponentViewStoredComponentIds);
+	}
+}
 
 Worker_Authority USpatialStaticComponentView::GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
 {
+	if (bUseFlatStorage)
+	{
+		return FlatStorage.GetAuthority(EntityId, ComponentId);
+	}
+
 	if (const TMap<Worker_ComponentId, Worker_Authority>* ComponentAuthorityMap = EntityComponentAuthorityMap.Find(EntityId))
 	{
 		if (const Worker_Authority* Authority = ComponentAuthorityMap->Find(ComponentId))
@@ -38,6 +114,11 @@ bool USpatialStaticComponentView::HasAuthority(Worker_EntityId EntityId, Worker_
 
 bool USpatialStaticComponentView::HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
 {
+	if (bUseFlatStorage)
+	{
+		return FlatStorage.HasComponent(EntityId, ComponentId);
+	}
+
 	if (auto* EntityComponentStorage = EntityComponentMap.Find(EntityId))
 	{
 		return EntityComponentStorage->Contains(ComponentId);
@@ -55,6 +136,28 @@ void USpatialStaticComponentView::OnAddComponent(const Worker_AddComponentOp& Op
 		return;
 	}
 
+	if (bKeepAllComponentData)
+	{
+		AllComponentData.FindOrAdd(Op.entity_id).Add(Op.data.component_id, SpatialGDK::ComponentData::CreateCopy(Op.data.schema_type, Op.data.component_id));
+	}
+
+	if (bUseFlatStorage)
+	{
+		FlatStorage.AddComponent(Op.entity_id, Op.data.component_id, CreateComponentData(Op));
+		return;
+	}
+
+	EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = CreateComponentData(Op);
+}
+
+TUniquePtr<SpatialGDK::Component> USpatialStaticComponentView::CreateComponentData(const Worker_AddComponentOp& Op) const
+{
+	if (!IsComponentDataStored(Op.data.component_id))
+	{
+		// The component is still recorded as present, and the op is dispatched as normal by the receiver.
+		return nullptr;
+	}
+
 	TUniquePtr<SpatialGDK::Component> Data;
 	switch (Op.data.component_id)
 	{
@@ -119,11 +222,22 @@ void USpatialStaticComponentView::OnAddComponent(const Worker_AddComponentOp& Op
 		// Component is not hand written, but we still want to know the existence of it on this entity.
 		Data = nullptr;
 	}
-	EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = MoveTemp(Data);
+	return Data;
 }
 
 void USpatialStaticComponentView::OnRemoveComponent(const Worker_RemoveComponentOp& Op)
 {
+	if (TMap<Worker_ComponentId, SpatialGDK::ComponentData>* ComponentData = AllComponentData.Find(Op.entity_id))
+	{
+		ComponentData->Remove(Op.component_id);
+	}
+
+	if (bUseFlatStorage)
+	{
+		FlatStorage.RemoveComponent(Op.entity_id, Op.component_id);
+		return;
+	}
+
 	if (auto* ComponentMap = EntityComponentMap.Find(Op.entity_id))
 	{
 		ComponentMap->Remove(Op.component_id);
@@ -132,48 +246,64 @@ void USpatialStaticComponentView::OnRemoveComponent(const Worker_RemoveComponent
 
 void USpatialStaticComponentView::OnRemoveEntity(Worker_EntityId EntityId)
 {
+	AllComponentData.Remove(EntityId);
+
+	if (bUseFlatStorage)
+	{
+		FlatStorage.RemoveEntity(EntityId);
+		return;
+	}
+
 	EntityComponentMap.Remove(EntityId);
 	EntityComponentAuthorityMap.Remove(EntityId);
 }
 
 void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 {
+	if (TMap<Worker_ComponentId, SpatialGDK::ComponentData>* EntityComponentData = AllComponentData.Find(Op.entity_id))
+	{
+		if (SpatialGDK::ComponentData* ComponentData = EntityComponentData->Find(Op.update.component_id))
+		{
+			Schema_ApplyComponentUpdateToData(Op.update.schema_type, ComponentData->GetUnderlying());
+		}
+	}
+
 	SpatialGDK::Component* Component = nullptr;
 
 	switch (Op.update.component_id)
 	{
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::EntityAcl>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::EntityAcl>(Op.entity_id);
 		break;
 	case SpatialConstants::POSITION_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::Position>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::Position>(Op.entity_id);
 		break;
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
-		Component = GetComponentData<SpatialGDK::ClientRPCEndpointLegacy>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::ClientRPCEndpointLegacy>(Op.entity_id);
 		break;
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
-		Component = GetComponentData<SpatialGDK::ServerRPCEndpointLegacy>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::ServerRPCEndpointLegacy>(Op.entity_id);
 		break;
 	case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::AuthorityIntent>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::AuthorityIntent>(Op.entity_id);
 		break;
 	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::ClientEndpoint>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::ClientEndpoint>(Op.entity_id);
 		break;
 	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::ServerEndpoint>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::ServerEndpoint>(Op.entity_id);
 		break;
 	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::MulticastRPCs>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::MulticastRPCs>(Op.entity_id);
 		break;
 	case SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::SpatialDebugging>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::SpatialDebugging>(Op.entity_id);
 		break;
 	case SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::ComponentPresence>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::ComponentPresence>(Op.entity_id);
 		break;
 	case SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID:
-		Component = GetComponentData<SpatialGDK::NetOwningClientWorker>(Op.entity_id);
+		Component = FindComponentData<SpatialGDK::NetOwningClientWorker>(Op.entity_id);
 		break;
 	default:
 		return;
@@ -187,5 +317,164 @@ void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdate
 
 void USpatialStaticComponentView::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 {
+	if (bUseFlatStorage)
+	{
+		FlatStorage.SetAuthority(Op.entity_id, Op.component_id, (Worker_Authority)Op.authority);
+		return;
+	}
+
 	EntityComponentAuthorityMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.component_id) = (Worker_Authority)Op.authority;
 }
+
+void USpatialStaticComponentView::GetEntityIds(TArray<Worker_EntityId_Key>& OutEntityIds) const
+{
+	if (bUseFlatStorage)
+	{
+		FlatStorage.GetEntityIds(OutEntityIds);
+		return;
+	}
+
+	EntityComponentMap.GetKeys(OutEntityIds);
+}
+
+int32 USpatialStaticComponentView::GetNumEntities() const
+{
+	return bUseFlatStorage ? FlatStorage.GetNumEntities() : EntityComponentMap.Num();
+}
+
+SIZE_T USpatialStaticComponentView::GetComponentCounts(TMap<Worker_ComponentId, int32>& OutComponentCounts) const
+{
+	if (bUseFlatStorage)
+	{
+		FlatStorage.GetComponentCounts(OutComponentCounts);
+		return FlatStorage.GetAllocatedSize();
+	}
+
+	SIZE_T ContainerBytes = EntityComponentMap.GetAllocatedSize() + EntityComponentAuthorityMap.GetAllocatedSize();
+	for (const auto& EntityPair : EntityComponentMap)
+	{
+		ContainerBytes += EntityPair.Value.GetAllocatedSize();
+		for (const auto& ComponentPair : EntityPair.Value)
+		{
+			OutComponentCounts.FindOrAdd(ComponentPair.Key)++;
+		}
+	}
+	for (const auto& EntityPair : EntityComponentAuthorityMap)
+	{
+		ContainerBytes += EntityPair.Value.GetAllocatedSize();
+	}
+	return ContainerBytes;
+}
+
+SIZE_T USpatialStaticComponentView::GetComponentDataBytes(Worker_ComponentId ComponentId, int32 Count) const
+{
+	return IsComponentDataStored(ComponentId) ? Count * GetComponentDataSize(ComponentId) : 0;
+}
+
+bool USpatialStaticComponentView::IsComponentDataStored(Worker_ComponentId ComponentId) const
+{
+	return StoredComponentIds.Num() == 0 || StoredComponentIds.Contains(ComponentId) || IsReadByGDK(ComponentId);
+}
+
+SIZE_T USpatialStaticComponentView::GetAllocatedSize() const
+{
+	TMap<Worker_ComponentId, int32> ComponentCounts;
+	SIZE_T TotalBytes = GetComponentCounts(ComponentCounts);
+	for (const auto& Pair : ComponentCounts)
+	{
+		TotalBytes += GetComponentDataBytes(Pair.Key, Pair.Value);
+	}
+	return TotalBytes;
+}
+
+void USpatialStaticComponentView::SetKeepAllComponentData(bool bInKeepAllComponentData)
+{
+	bKeepAllComponentData = bInKeepAllComponentData;
+	if (!bKeepAllComponentData)
+	{
+		AllComponentData.Empty();
+	}
+}
+
+void USpatialStaticComponentView::CreateViewOps(TArray<Worker_Op>& OutOps, TArray<SpatialGDK::ComponentData>& OutData) const
+{
+	Worker_Op CriticalSectionOp{};
+	CriticalSectionOp.op_type = WORKER_OP_TYPE_CRITICAL_SECTION;
+	CriticalSectionOp.op.critical_section.in_critical_section = 1;
+	OutOps.Add(CriticalSectionOp);
+
+	for (const auto& EntityPair : AllComponentData)
+	{
+		const Worker_EntityId EntityId = EntityPair.Key;
+
+		Worker_Op AddEntityOp{};
+		AddEntityOp.op_type = WORKER_OP_TYPE_ADD_ENTITY;
+		AddEntityOp.op.add_entity.entity_id = EntityId;
+		OutOps.Add(AddEntityOp);
+
+		for (const auto& ComponentPair : EntityPair.Value)
+		{
+			// The schema data is heap allocated, so the pointer in the op stays valid as OutData grows.
+			SpatialGDK::ComponentData& Data = OutData.Add_GetRef(ComponentPair.Value.DeepCopy());
+
+			Worker_Op AddComponentOp{};
+			AddComponentOp.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+			AddComponentOp.op.add_component.entity_id = EntityId;
+			AddComponentOp.op.add_component.data.component_id = ComponentPair.Key;
+			AddComponentOp.op.add_component.data.schema_type = Data.GetUnderlying();
+			OutOps.Add(AddComponentOp);
+		}
+
+		for (const auto& ComponentPair : EntityPair.Value)
+		{
+			const Worker_Authority Authority = GetAuthority(EntityId, ComponentPair.Key);
+			if (Authority != WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+			{
+				Worker_Op AuthorityChangeOp{};
+				AuthorityChangeOp.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
+				AuthorityChangeOp.op.authority_change.entity_id = EntityId;
+				AuthorityChangeOp.op.authority_change.component_id = ComponentPair.Key;
+				AuthorityChangeOp.op.authority_change.authority = Authority;
+				OutOps.Add(AuthorityChangeOp);
+			}
+		}
+	}
+
+	CriticalSectionOp.op.critical_section.in_critical_section = 0;
+	OutOps.Add(CriticalSectionOp);
+}
+
+uint64 USpatialStaticComponentView::GetNumReads(Worker_ComponentId ComponentId) const
+{
+	const int32 TypeIndex = SpatialGDK::FSpatialFlatComponentStorage::GetHandwrittenComponentIndex(ComponentId);
+	return TypeIndex != INDEX_NONE ? ReadCounts[TypeIndex].Load() : 0;
+}
+
+void USpatialStaticComponentView::LogMemoryReport() const
+{
+	TMap<Worker_ComponentId, int32> ComponentCounts;
+	const SIZE_T ContainerBytes = GetComponentCounts(ComponentCounts);
+
+	ComponentCounts.KeySort(TLess<Worker_ComponentId>());
+
+	SIZE_T TotalDataBytes = 0;
+	UE_LOG(LogSpatialStaticComponentView, Log, TEXT("Static component view memory report (%s storage, %d entities):"), bUseFlatStorage ? TEXT("flat") : TEXT("map"), GetNumEntities());
+	for (const auto& Pair : ComponentCounts)
+	{
+		const bool bStored = IsComponentDataStored(Pair.Key);
+		const SIZE_T DataBytes = GetComponentDataBytes(Pair.Key, Pair.Value);
+		TotalDataBytes += DataBytes;
+
+		const int32 TypeIndex = SpatialGDK::FSpatialFlatComponentStorage::GetHandwrittenComponentIndex(Pair.Key);
+		if (TypeIndex != INDEX_NONE)
+		{
+			UE_LOG(LogSpatialStaticComponentView, Log, TEXT("  Component %u: %d components, %llu bytes of data, %llu reads%s"), Pair.Key, Pair.Value,
+				static_cast<uint64>(DataBytes), GetNumReads(Pair.Key), bStored ? TEXT("") : TEXT(" (data not stored)"));
+		}
+		else
+		{
+			UE_LOG(LogSpatialStaticComponentView, Log, TEXT("  Component %u: %d components, no data stored"), Pair.Key, Pair.Value);
+		}
+	}
+	UE_LOG(LogSpatialStaticComponentView, Log, TEXT("  Total: %llu bytes of component data, %llu bytes of containers"), static_cast<uint64>(TotalDataBytes), static_cast<uint64>(ContainerBytes));
+}
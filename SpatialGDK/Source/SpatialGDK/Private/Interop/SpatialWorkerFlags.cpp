@@ -22,14 +22,39 @@ void USpatialWorkerFlags::ApplyWorkerFlagUpdate(const Worker_FlagUpdateOp& Op)
 		FString NewValue = FString(UTF8_TO_TCHAR(Op.value));
 		FString& ValueFlag = WorkerFlags.FindOrAdd(NewName);
 		ValueFlag = NewValue;
+		if (TSharedRef<FWorkerFlagValue>* FlagValue = FlagValues.Find(NewName))
+		{
+			(*FlagValue)->Set(NewValue);
+		}
 		OnWorkerFlagsUpdated.Broadcast(NewName, NewValue);
 	}
 	else
 	{
 		WorkerFlags.Remove(NewName);
+		if (TSharedRef<FWorkerFlagValue>* FlagValue = FlagValues.Find(NewName))
+		{
+			(*FlagValue)->Reset();
+		}
 	}
 }
 
+TSharedRef<const FWorkerFlagValue> USpatialWorkerFlags::FindOrAddFlagValue(const FString& InFlagName)
+{
+	if (TSharedRef<FWorkerFlagValue>* FlagValue = FlagValues.Find(InFlagName))
+	{
+		return *FlagValue;
+	}
+
+	TSharedRef<FWorkerFlagValue> FlagValue = MakeShared<FWorkerFlagValue>();
+	if (const FString* ValuePtr = WorkerFlags.Find(InFlagName))
+	{
+		FlagValue->Set(*ValuePtr);
+	}
+	FlagValues.Add(InFlagName, FlagValue);
+
+	return FlagValue;
+}
+
 void USpatialWorkerFlags::BindToOnWorkerFlagsUpdated(const FOnWorkerFlagsUpdatedBP& InDelegate)
 {
 	OnWorkerFlagsUpdated.Add(InDelegate);
@@ -0,0 +1,422 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/StartupActorTombstones.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialPackageMapClient.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Hash/CityHash.h"
+
+DEFINE_LOG_CATEGORY(LogStartupActorTombstones);
+
+namespace SpatialGDK
+{
+
+void FPendingTombstoneDeletions::Add(uint64 TombstoneId, Worker_EntityId EntityId)
+{
+	Entities.AddUnique(TombstoneId, EntityId);
+}
+
+TArray<Worker_EntityId> FPendingTombstoneDeletions::Confirm(const TArray<uint64>& SortedIds)
+{
+	TArray<Worker_EntityId> Confirmed;
+	for (auto It = Entities.CreateIterator(); It; ++It)
+	{
+		if (Algo::BinarySearch(SortedIds, It.Key()) != INDEX_NONE)
+		{
+			Confirmed.Add(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+	return Confirmed;
+}
+
+FStartupActorTombstones::FStartupActorTombstones(USpatialNetDriver* InNetDriver)
+	: NetDriver(InNetDriver)
+{
+	check(NetDriver != nullptr);
+}
+
+uint64 FStartupActorTombstones::GetTombstoneId(const FString& RemappedPathName)
+{
+	return CityHash64(reinterpret_cast<const char*>(*RemappedPathName), RemappedPathName.Len() * sizeof(TCHAR));
+}
+
+uint64 FStartupActorTombstones::GetTombstoneId(const AActor& Actor) const
+{
+	// No path in SpatialOS should contain a PIE prefix.
+	FString PathName = Actor.GetPathName();
+	GEngine->NetworkRemapPath(NetDriver, PathName, false /*bIsReading*/);
+	return GetTombstoneId(PathName);
+}
+
+FString FStartupActorTombstones::GetLevelPath(const ULevel& Level) const
+{
+	FString LevelPath = Level.GetOutermost()->GetName();
+	GEngine->NetworkRemapPath(NetDriver, LevelPath, false /*bIsReading*/);
+	return LevelPath;
+}
+
+bool FStartupActorTombstones::IsTombstoned(const AActor& Actor) const
+{
+	const ULevel* Level = Actor.GetLevel();
+	if (Level == nullptr)
+	{
+		return false;
+	}
+
+	const FLevelTombstoneSet* Set = Levels.Find(GetLevelPath(*Level));
+	return Set != nullptr && Set->Tombstones.Contains(GetTombstoneId(Actor));
+}
+
+void FStartupActorTombstones::TombstoneActor(const AActor& Actor, Worker_EntityId EntityId)
+{
+	check(Actor.IsNetStartupActor());
+
+	const ULevel* Level = Actor.GetLevel();
+	if (Level == nullptr)
+	{
+		UE_LOG(LogStartupActorTombstones, Warning, TEXT("Can't tombstone startup actor %s without a level."), *Actor.GetName());
+		return;
+	}
+
+	const FString LevelPath = GetLevelPath(*Level);
+	FLevelTombstoneSet& Set = FindOrAddLevel(LevelPath);
+	const uint64 TombstoneId = GetTombstoneId(Actor);
+	MergeIds(Set, { TombstoneId }, false /*bFromEntity*/);
+
+	UE_LOG(LogStartupActorTombstones, Verbose, TEXT("Tombstoned startup actor %s in level %s."), *Actor.GetName(), *LevelPath);
+
+	if (EntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		PendingDeletions.Add(TombstoneId, EntityId);
+
+		// The ID may already be on the level's entity, e.g. if another server retired the actor first.
+		if (Algo::BinarySearch(Set.PendingIds, TombstoneId) == INDEX_NONE)
+		{
+			OnIdsWritten(Set, { TombstoneId });
+		}
+	}
+}
+
+void FStartupActorTombstones::DestroyTombstonedActors(ULevel* Level)
+{
+	if (Level == nullptr)
+	{
+		return;
+	}
+
+	const FLevelTombstoneSet* Set = Levels.Find(GetLevelPath(*Level));
+	if (Set == nullptr || Set->Tombstones.ActorIds.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = Level->GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	// Copy the actors as destroying them removes them from the level.
+	TArray<AActor*> LevelActors = Level->Actors;
+	for (AActor* Actor : LevelActors)
+	{
+		if (Actor == nullptr || Actor->IsPendingKill() || !Actor->GetIsReplicated() || !Actor->IsNetStartupActor())
+		{
+			continue;
+		}
+
+		// Actors with an entity are retired through their entity being removed.
+		if (NetDriver->PackageMap->GetEntityIdFromObject(Actor) != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			continue;
+		}
+
+		if (Set->Tombstones.Contains(GetTombstoneId(*Actor)))
+		{
+			UE_LOG(LogStartupActorTombstones, Verbose, TEXT("Destroying tombstoned startup actor %s."), *Actor->GetName());
+			World->DestroyActor(Actor, true /*bNetForce*/);
+		}
+	}
+}
+
+void FStartupActorTombstones::DestroyTombstonedActors(const FString& LevelPath)
+{
+	UWorld* World = NetDriver->GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	for (ULevel* Level : World->GetLevels())
+	{
+		if (Level != nullptr && Level->bIsVisible && GetLevelPath(*Level) == LevelPath)
+		{
+			DestroyTombstonedActors(Level);
+		}
+	}
+}
+
+void FStartupActorTombstones::OnLevelTombstonesAdded(Worker_EntityId EntityId, const Worker_ComponentData& Data)
+{
+	OnEntityTombstones(EntityId, LevelTombstones(Data));
+}
+
+void FStartupActorTombstones::OnLevelTombstonesUpdated(Worker_EntityId EntityId, const Worker_ComponentUpdate& Update)
+{
+	const FString* LevelPath = EntityLevels.Find(EntityId);
+	if (LevelPath == nullptr)
+	{
+		return;
+	}
+
+	LevelTombstones EntityTombstones;
+	EntityTombstones.LevelPath = *LevelPath;
+	EntityTombstones.ApplyComponentUpdate(Update);
+	OnEntityTombstones(EntityId, EntityTombstones);
+}
+
+void FStartupActorTombstones::OnEntityTombstones(Worker_EntityId EntityId, const LevelTombstones& EntityTombstones)
+{
+	EntityLevels.Add(EntityId, EntityTombstones.LevelPath);
+
+	FLevelTombstoneSet& Set = FindOrAddLevel(EntityTombstones.LevelPath);
+	if (Set.EntityId == SpatialConstants::INVALID_ENTITY_ID || EntityId < Set.EntityId)
+	{
+		if (Set.EntityId != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			UE_LOG(LogStartupActorTombstones, Log, TEXT("Found duplicate LevelTombstones entities for level %s, merging into entity %lld."), *EntityTombstones.LevelPath, EntityId);
+		}
+		Set.EntityId = EntityId;
+		Set.bRequestInFlight = false;
+	}
+	Set.bCreationRequested = false;
+
+	MergeIds(Set, EntityTombstones.ActorIds, true /*bFromEntity*/);
+
+	DestroyTombstonedActors(EntityTombstones.LevelPath);
+}
+
+void FStartupActorTombstones::OnLevelTombstonesAuthorityGained(Worker_EntityId EntityId)
+{
+	if (const FString* LevelPath = EntityLevels.Find(EntityId))
+	{
+		// The previous writer may not have seen every ID this worker has, so write the whole union on the next flush.
+		FindOrAddLevel(*LevelPath).bDirty = true;
+	}
+}
+
+void FStartupActorTombstones::OnTombstoneStartupActorsRequest(const Worker_CommandRequestOp& Op)
+{
+	Schema_Object* RequestObject = Schema_GetCommandRequestObject(Op.request.schema_type);
+
+	LevelTombstones Request;
+	Request.ReadFromObject(RequestObject);
+	Request.ActorIds.Sort();
+
+	if (Request.LevelPath.IsEmpty())
+	{
+		UE_LOG(LogStartupActorTombstones, Warning, TEXT("Received tombstone request without a level path on entity %lld."), Op.entity_id);
+		NetDriver->Sender->SendCommandFailure(Op.request_id, TEXT("Missing level path."));
+		return;
+	}
+
+	// The IDs are pending until this worker, or whoever it forwards them to, writes them to the level's entity. The requester
+	// deletes the entities of the actors once it gets the response, so it's only sent then.
+	FLevelTombstoneSet& Set = FindOrAddLevel(Request.LevelPath);
+	MergeIds(Set, Request.ActorIds, false /*bFromEntity*/);
+	Set.PendingResponses.Add(FLevelTombstoneSet::FPendingResponse{ Op.request_id, Op.request.component_id, static_cast<Schema_FieldId>(Op.request.command_index) });
+
+	if (Set.EntityId != SpatialConstants::INVALID_ENTITY_ID && NetDriver->StaticComponentView->HasAuthority(Set.EntityId, SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID))
+	{
+		WriteLevel(Set);
+	}
+	else if (Set.PendingIds.Num() == 0)
+	{
+		OnIdsWritten(Set, Request.ActorIds);
+	}
+}
+
+void FStartupActorTombstones::OnTombstoneStartupActorsResponse(const Worker_CommandResponseOp& Op)
+{
+	FSentRequest Request;
+	if (!SentRequests.RemoveAndCopyValue(Op.request_id, Request))
+	{
+		return;
+	}
+
+	FLevelTombstoneSet* Set = Levels.Find(Request.LevelPath);
+	if (Set == nullptr)
+	{
+		return;
+	}
+
+	if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
+	{
+		MergeIds(*Set, Request.Ids, true /*bFromEntity*/);
+		return;
+	}
+
+	// The IDs are still pending, so they're sent again on the next flush.
+	UE_LOG(LogStartupActorTombstones, Verbose, TEXT("Tombstone request for level %s failed, retrying. Error code: %d Message: %s"),
+		*Request.LevelPath, static_cast<int32>(Op.status_code), UTF8_TO_TCHAR(Op.message));
+	Set->bRequestInFlight = false;
+}
+
+void FStartupActorTombstones::Advance(double CurrentTime)
+{
+	if (CurrentTime - LastFlushTime < FlushIntervalSeconds)
+	{
+		return;
+	}
+	LastFlushTime = CurrentTime;
+
+	for (auto& LevelPair : Levels)
+	{
+		FlushLevel(LevelPair.Key, LevelPair.Value, CurrentTime);
+	}
+}
+
+FStartupActorTombstones::FLevelTombstoneSet& FStartupActorTombstones::FindOrAddLevel(const FString& LevelPath)
+{
+	FLevelTombstoneSet& Set = Levels.FindOrAdd(LevelPath);
+	Set.Tombstones.LevelPath = LevelPath;
+	return Set;
+}
+
+void FStartupActorTombstones::MergeIds(FLevelTombstoneSet& Set, const TArray<uint64>& SortedIds, bool bFromEntity)
+{
+	const int32 NumAdded = Set.Tombstones.MergeActorIds(SortedIds);
+
+	if (bFromEntity)
+	{
+		// Anything the entity already holds no longer needs sending.
+		Set.PendingIds.RemoveAll([&SortedIds](uint64 Id)
+		{
+			return Algo::BinarySearch(SortedIds, Id) != INDEX_NONE;
+		});
+		if (Set.PendingIds.Num() == 0)
+		{
+			Set.bRequestInFlight = false;
+		}
+		OnIdsWritten(Set, SortedIds);
+		return;
+	}
+
+	// IDs already in the union are either on the level's entity or pending already.
+	if (NumAdded > 0)
+	{
+		for (uint64 Id : SortedIds)
+		{
+			const int32 Index = Algo::LowerBound(Set.PendingIds, Id);
+			if (Index == Set.PendingIds.Num() || Set.PendingIds[Index] != Id)
+			{
+				Set.PendingIds.Insert(Id, Index);
+			}
+		}
+	}
+}
+
+void FStartupActorTombstones::FlushLevel(const FString& LevelPath, FLevelTombstoneSet& Set, double CurrentTime)
+{
+	if (!NetDriver->IsServer() || (Set.PendingIds.Num() == 0 && !Set.bDirty))
+	{
+		return;
+	}
+
+	USpatialStaticComponentView* StaticComponentView = NetDriver->StaticComponentView;
+
+	if (Set.EntityId != SpatialConstants::INVALID_ENTITY_ID && StaticComponentView->HasAuthority(Set.EntityId, SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID))
+	{
+		WriteLevel(Set);
+		return;
+	}
+
+	Set.bDirty = false;
+
+	if (Set.PendingIds.Num() == 0 || (Set.bRequestInFlight && CurrentTime - Set.LastRequestTime < RequestRetrySeconds))
+	{
+		return;
+	}
+
+	if (Set.EntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		SendTombstoneRequest(Set.EntityId, SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID,
+			SpatialConstants::LEVEL_TOMBSTONES_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID, LevelPath, Set.PendingIds);
+	}
+	else if (StaticComponentView->HasAuthority(SpatialConstants::INITIAL_GLOBAL_STATE_MANAGER_ENTITY_ID, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID))
+	{
+		// Only the GSM authoritative server creates LevelTombstones entities, so there's a single one per level unless the GSM migrates
+		// while a creation is in flight. Creation requests are retried by the sender, until the entity is checked out.
+		if (Set.bCreationRequested)
+		{
+			return;
+		}
+
+		const Worker_EntityId EntityId = NetDriver->Sender->CreateLevelTombstonesEntity(Set.Tombstones);
+		UE_LOG(LogStartupActorTombstones, Log, TEXT("Creating LevelTombstones entity %lld for level %s."), EntityId, *LevelPath);
+		Set.bCreationRequested = true;
+	}
+	else
+	{
+		SendTombstoneRequest(SpatialConstants::INITIAL_GLOBAL_STATE_MANAGER_ENTITY_ID, SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID,
+			SpatialConstants::STARTUP_ACTOR_MANAGER_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID, LevelPath, Set.PendingIds);
+	}
+
+	Set.bRequestInFlight = true;
+	Set.LastRequestTime = CurrentTime;
+}
+
+void FStartupActorTombstones::WriteLevel(FLevelTombstoneSet& Set)
+{
+	// Lists of primitives aren't merged in component updates, so every update carries the full sorted set.
+	FWorkerComponentUpdate Update = Set.Tombstones.CreateLevelTombstonesUpdate();
+	NetDriver->Connection->SendComponentUpdate(Set.EntityId, &Update);
+
+	Set.PendingIds.Empty();
+	Set.bDirty = false;
+	Set.bRequestInFlight = false;
+
+	OnIdsWritten(Set, Set.Tombstones.ActorIds);
+}
+
+void FStartupActorTombstones::OnIdsWritten(FLevelTombstoneSet& Set, const TArray<uint64>& SortedIds)
+{
+	for (const Worker_EntityId EntityId : PendingDeletions.Confirm(SortedIds))
+	{
+		UE_LOG(LogStartupActorTombstones, Log, TEXT("Sending delete entity request for tombstoned startup actor with EntityId %lld in level %s."), EntityId, *Set.Tombstones.LevelPath);
+		NetDriver->Connection->SendDeleteEntityRequest(EntityId);
+	}
+
+	if (Set.PendingIds.Num() == 0)
+	{
+		for (const FLevelTombstoneSet::FPendingResponse& Response : Set.PendingResponses)
+		{
+			NetDriver->Sender->SendEmptyCommandResponse(Response.ComponentId, Response.CommandIndex, Response.RequestId);
+		}
+		Set.PendingResponses.Empty();
+	}
+}
+
+void FStartupActorTombstones::SendTombstoneRequest(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, const FString& LevelPath, const TArray<uint64>& Ids)
+{
+	Worker_CommandRequest CommandRequest = {};
+	CommandRequest.component_id = ComponentId;
+	CommandRequest.command_index = CommandIndex;
+	CommandRequest.schema_type = Schema_CreateCommandRequest();
+
+	LevelTombstones(LevelPath, Ids).WriteToObject(Schema_GetCommandRequestObject(CommandRequest.schema_type));
+
+	const Worker_RequestId RequestId = NetDriver->Connection->SendCommandRequest(EntityId, &CommandRequest, CommandIndex);
+	SentRequests.Add(RequestId, FSentRequest{ LevelPath, Ids });
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,60 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/ThreadSafeSubmitQueue.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+
+FSubmitBatch::~FSubmitBatch()
+{
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Update.schema_type != nullptr)
+		{
+			Schema_DestroyComponentUpdate(Entry.Update.schema_type);
+		}
+	}
+}
+
+void FSubmitBatch::AddComponentUpdate(Worker_EntityId EntityId, const FWorkerComponentUpdate& Update)
+{
+	check(Update.schema_type != nullptr);
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.EntityId = EntityId;
+	Entry.Update = Update;
+}
+
+void FSubmitBatch::AddRPC(Worker_EntityId EntityId, ERPCType Type, RPCPayload&& Payload)
+{
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.EntityId = EntityId;
+	Entry.RPCType = Type;
+	Entry.Payload.Emplace(MoveTemp(Payload));
+}
+
+void FThreadSafeSubmitQueue::Submit(FSubmitBatch&& Batch)
+{
+	if (Batch.IsEmpty())
+	{
+		return;
+	}
+
+	NumSubmittedEntries.AddExchange(Batch.Num());
+	NumPendingBatches.IncrementExchange();
+	Batches.Enqueue(MoveTemp(Batch));
+}
+
+void FThreadSafeSubmitQueue::Drain(TArray<FSubmitBatch>& OutBatches)
+{
+	FSubmitBatch Batch;
+	while (Batches.Dequeue(Batch))
+	{
+		NumPendingBatches.DecrementExchange();
+		OutBatches.Add(MoveTemp(Batch));
+	}
+}
+
+} // namespace SpatialGDK
@@ -14,3 +14,21 @@ void UAbstractLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtual
 {
 	LocalVirtualWorkerId = InLocalVirtualWorkerId;
 }
+
+void UAbstractLBStrategy::ShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<bool>& OutShouldHaveAuthority) const
+{
+	OutShouldHaveAuthority.Reset(Actors.Num());
+	for (const AActor* Actor : Actors)
+	{
+		OutShouldHaveAuthority.Add(ShouldHaveAuthority(*Actor));
+	}
+}
+
+void UAbstractLBStrategy::WhoShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.Reset(Actors.Num());
+	for (const AActor* Actor : Actors)
+	{
+		OutVirtualWorkerIds.Add(WhoShouldHaveAuthority(*Actor));
+	}
+}
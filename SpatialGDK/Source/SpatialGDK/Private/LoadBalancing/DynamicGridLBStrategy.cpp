@@ -0,0 +1,581 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/DynamicGridLBStrategy.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Utils/SpatialActorUtils.h"
+
+#include "Algo/BinarySearch.h"
+#include "Templates/Tuple.h"
+
+DEFINE_LOG_CATEGORY(LogDynamicGridLBStrategy);
+
+UDynamicGridLBStrategy::UDynamicGridLBStrategy()
+	: Super()
+	, Rows(1)
+	, Cols(1)
+	, WorldWidth(1000000.f)
+	, WorldHeight(1000000.f)
+	, InterestBorder(0.f)
+	, LoadImbalanceThreshold(0.2f)
+	, MaxBoundaryMoveFraction(0.1f)
+	, MinCellSize(1000.f)
+	, LoadSmoothingFactor(0.5f)
+	, bElasticCellCount(false)
+	, MinActiveCells(1)
+	, ScaleUpLoadThreshold(0.8f)
+	, ScaleDownLoadThreshold(0.3f)
+	, ScalingCooldown(60.f)
+	, NumActiveCells(0)
+	, bDrainingLastCell(false)
+	, DrainStepSize(0.f)
+	, bWantsMoreCells(false)
+	, LastScalingTime(0.0)
+	, LocalCellId(0)
+	, bIsStrategyUsedOnLocalWorker(false)
+	, RegionsVersion(0)
+{
+}
+
+void UDynamicGridLBStrategy::Init()
+{
+	Super::Init();
+
+	UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy initialized with Rows = %d and Cols = %d."), Rows, Cols);
+
+	NumActiveCells = bElasticCellCount ? FMath::Clamp(MinActiveCells, 1u, Rows * Cols) : Rows * Cols;
+	LastScalingTime = FPlatformTime::Seconds();
+
+	// Start from the same layout as UGridBasedLBStrategy over the cells in use: rows are perpendicular to the x-axis and columns are
+	// perpendicular to the y-axis. Cells which aren't in use have no area, at the end of their column or of the world.
+	const float WorldWidthMin = -(WorldWidth / 2.f);
+	const uint32 NumActiveCols = FMath::DivideAndRoundUp(NumActiveCells, Rows);
+	const float ColumnWidth = WorldWidth / NumActiveCols;
+
+	ColumnBoundaries.SetNum(Cols + 1);
+	for (uint32 Col = 0; Col <= Cols; ++Col)
+	{
+		ColumnBoundaries[Col] = Col >= NumActiveCols ? WorldWidthMin + WorldWidth : WorldWidthMin + Col * ColumnWidth;
+	}
+
+	RowBoundaries.SetNum(Cols * (Rows + 1));
+	for (uint32 Col = 0; Col < Cols; ++Col)
+	{
+		LayOutColumnRows(Col, FMath::Max(GetNumActiveRows(Col, NumActiveCells), 1u));
+	}
+
+	RegionsVersion++;
+}
+
+uint32 UDynamicGridLBStrategy::GetNumActiveRows(uint32 Col, uint32 NumCells) const
+{
+	return static_cast<uint32>(FMath::Clamp(static_cast<int32>(NumCells) - static_cast<int32>(Col * Rows), 0, static_cast<int32>(Rows)));
+}
+
+void UDynamicGridLBStrategy::LayOutColumnRows(uint32 Col, uint32 NumActiveRows)
+{
+	const float WorldHeightMin = -(WorldHeight / 2.f);
+	const float RowHeight = WorldHeight / NumActiveRows;
+
+	for (uint32 Row = 0; Row <= Rows; ++Row)
+	{
+		RowBoundaries[Col * (Rows + 1) + Row] = Row >= NumActiveRows ? WorldHeightMin + WorldHeight : WorldHeightMin + Row * RowHeight;
+	}
+}
+
+void UDynamicGridLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId)
+{
+	if (!VirtualWorkerIds.Contains(InLocalVirtualWorkerId))
+	{
+		// This worker is simulating a layer which is not part of the grid.
+		LocalCellId = Rows * Cols;
+		bIsStrategyUsedOnLocalWorker = false;
+	}
+	else
+	{
+		LocalCellId = VirtualWorkerIds.IndexOfByKey(InLocalVirtualWorkerId);
+		bIsStrategyUsedOnLocalWorker = true;
+	}
+	LocalVirtualWorkerId = InLocalVirtualWorkerId;
+}
+
+TSet<VirtualWorkerId> UDynamicGridLBStrategy::GetVirtualWorkerIds() const
+{
+	return TSet<VirtualWorkerId>(VirtualWorkerIds);
+}
+
+bool UDynamicGridLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogDynamicGridLBStrategy, Warning, TEXT("DynamicGridLBStrategy not ready to relinquish authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return false;
+	}
+
+	if (!bIsStrategyUsedOnLocalWorker)
+	{
+		return false;
+	}
+
+	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	return GetCellIndex(Actor2DLocation) == static_cast<int32>(LocalCellId);
+}
+
+VirtualWorkerId UDynamicGridLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogDynamicGridLBStrategy, Warning, TEXT("DynamicGridLBStrategy not ready to decide on authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	check(VirtualWorkerIds.Num() == Rows * Cols);
+	const int32 CellIndex = GetCellIndex(FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)));
+	return CellIndex != INDEX_NONE ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
+SpatialGDK::QueryConstraint UDynamicGridLBStrategy::GetWorkerInterestQueryConstraint() const
+{
+	// The interest area is the cell that the worker is authoritative over plus some border region.
+	check(IsReady());
+	check(bIsStrategyUsedOnLocalWorker);
+
+	return GetCellInterestQueryConstraint(LocalCellId);
+}
+
+SpatialGDK::QueryConstraint UDynamicGridLBStrategy::GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const
+{
+	const int32 CellIndex = VirtualWorkerIds.IndexOfByKey(StandbyForWorkerId);
+	if (CellIndex == INDEX_NONE)
+	{
+		return {};
+	}
+
+	return GetCellInterestQueryConstraint(CellIndex);
+}
+
+SpatialGDK::QueryConstraint UDynamicGridLBStrategy::GetCellInterestQueryConstraint(int32 CellIndex) const
+{
+	const FBox2D Interest2D = GetCell(CellIndex).ExpandBy(InterestBorder);
+
+	const FVector2D Center2D = Interest2D.GetCenter();
+	const FVector Center3D{ Center2D.X, Center2D.Y, 0.0f };
+
+	// Cells which aren't in use have no area, their workers keep a small interest area around where the cell would grow from.
+	FVector2D EdgeLengths2D = Interest2D.GetSize();
+	EdgeLengths2D.X = FMath::Max(EdgeLengths2D.X, MinCellSize);
+	EdgeLengths2D.Y = FMath::Max(EdgeLengths2D.Y, MinCellSize);
+	check(EdgeLengths2D.X > 0.0f && EdgeLengths2D.Y > 0.0f);
+	const FVector EdgeLengths3D{ EdgeLengths2D.X, EdgeLengths2D.Y, FLT_MAX };
+
+	SpatialGDK::QueryConstraint Constraint;
+	Constraint.BoxConstraint = SpatialGDK::BoxConstraint{ SpatialGDK::Coordinates::FromFVector(Center3D), SpatialGDK::EdgeLength::FromFVector(EdgeLengths3D) };
+	return Constraint;
+}
+
+FVector UDynamicGridLBStrategy::GetWorkerEntityPosition() const
+{
+	check(IsReady());
+	check(bIsStrategyUsedOnLocalWorker);
+	const FVector2D Centre = GetCell(LocalCellId).GetCenter();
+	return FVector{ Centre.X, Centre.Y, 0.f };
+}
+
+uint32 UDynamicGridLBStrategy::GetMinimumRequiredWorkers() const
+{
+	return Rows * Cols;
+}
+
+void UDynamicGridLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId)
+{
+	UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("Setting VirtualWorkerIds %d to %d"), FirstVirtualWorkerId, LastVirtualWorkerId);
+	for (VirtualWorkerId CurrentVirtualWorkerId = FirstVirtualWorkerId; CurrentVirtualWorkerId <= LastVirtualWorkerId; CurrentVirtualWorkerId++)
+	{
+		VirtualWorkerIds.Add(CurrentVirtualWorkerId);
+	}
+}
+
+void UDynamicGridLBStrategy::ReportWorkerLoad(VirtualWorkerId WorkerId, double Load)
+{
+	if (!VirtualWorkerIds.Contains(WorkerId))
+	{
+		return;
+	}
+
+	if (double* SmoothedLoad = WorkerLoads.Find(WorkerId))
+	{
+		*SmoothedLoad = FMath::Lerp(*SmoothedLoad, Load, static_cast<double>(LoadSmoothingFactor));
+	}
+	else
+	{
+		WorkerLoads.Add(WorkerId, Load);
+	}
+}
+
+bool UDynamicGridLBStrategy::RebalanceRegions()
+{
+	if (Rows * Cols <= 1 || VirtualWorkerIds.Num() != static_cast<int32>(Rows * Cols))
+	{
+		return false;
+	}
+
+	for (uint32 CellIndex = 0; CellIndex < NumActiveCells; ++CellIndex)
+	{
+		if (!WorkerLoads.Contains(VirtualWorkerIds[CellIndex]))
+		{
+			return false;
+		}
+	}
+
+	bool bChanged = bElasticCellCount && UpdateActiveCells();
+
+	// A cell being drained keeps its load in its column, whose cells take it over, but its own boundary is only moved by the drain.
+	const uint32 NumSettledCells = bDrainingLastCell ? NumActiveCells - 1 : NumActiveCells;
+	const uint32 NumSettledCols = FMath::DivideAndRoundUp(NumSettledCells, Rows);
+
+	TArray<double> ColumnLoads;
+	ColumnLoads.SetNumZeroed(Cols);
+	TArray<TArray<double>> CellLoads;
+	CellLoads.SetNum(Cols);
+
+	for (uint32 Col = 0; Col < Cols; ++Col)
+	{
+		CellLoads[Col].SetNumZeroed(Rows);
+		for (uint32 Row = 0; Row < Rows && Col * Rows + Row < NumActiveCells; ++Row)
+		{
+			const double Load = WorkerLoads.FindRef(VirtualWorkerIds[Col * Rows + Row]);
+			CellLoads[Col][Row] = Load;
+			ColumnLoads[Col] += Load;
+		}
+	}
+
+	bChanged |= RebalanceBoundaries(ColumnBoundaries, 0, NumSettledCols, ColumnLoads);
+	for (uint32 Col = 0; Col < NumSettledCols; ++Col)
+	{
+		bChanged |= RebalanceBoundaries(RowBoundaries, Col * (Rows + 1), GetNumActiveRows(Col, NumSettledCells), CellLoads[Col]);
+	}
+
+	if (bChanged)
+	{
+		RegionsVersion++;
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy rebalanced regions (version %d)."), RegionsVersion);
+	}
+
+	return bChanged;
+}
+
+bool UDynamicGridLBStrategy::RebalanceBoundaries(TArray<float>& Boundaries, int32 FirstBoundary, int32 NumRegions, const TArray<double>& RegionLoads) const
+{
+	// Region sizes are measured before any boundary moves, so the result doesn't depend on the order boundaries are visited in.
+	TArray<float> OldBoundaries;
+	OldBoundaries.Append(Boundaries.GetData() + FirstBoundary, NumRegions + 1);
+
+	bool bChanged = false;
+	for (int32 i = 1; i < NumRegions; ++i)
+	{
+		const double LowerLoad = RegionLoads[i - 1];
+		const double UpperLoad = RegionLoads[i];
+		const double TotalLoad = LowerLoad + UpperLoad;
+		if (TotalLoad <= 0.0)
+		{
+			continue;
+		}
+
+		const double Imbalance = (LowerLoad - UpperLoad) / TotalLoad;
+		if (FMath::Abs(Imbalance) <= LoadImbalanceThreshold)
+		{
+			continue;
+		}
+
+		// Shrink the more loaded region.
+		const float LowerSize = OldBoundaries[i] - OldBoundaries[i - 1];
+		const float UpperSize = OldBoundaries[i + 1] - OldBoundaries[i];
+		const float Move = -static_cast<float>(Imbalance) * MaxBoundaryMoveFraction * (Imbalance > 0.0 ? LowerSize : UpperSize);
+
+		// The lower boundary may already have moved this pass, the upper one is clamped against this one when it is visited.
+		const float MinBoundary = Boundaries[FirstBoundary + i - 1] + MinCellSize;
+		const float MaxBoundary = OldBoundaries[i + 1] - MinCellSize;
+		if (MinBoundary > MaxBoundary)
+		{
+			continue;
+		}
+
+		const float NewBoundary = FMath::Clamp(OldBoundaries[i] + Move, MinBoundary, MaxBoundary);
+		if (NewBoundary != Boundaries[FirstBoundary + i])
+		{
+			Boundaries[FirstBoundary + i] = NewBoundary;
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
+bool UDynamicGridLBStrategy::UpdateActiveCells()
+{
+	if (bDrainingLastCell)
+	{
+		return DrainLastActiveCell();
+	}
+
+	bWantsMoreCells = false;
+
+	double TotalLoad = 0.0;
+	for (uint32 CellIndex = 0; CellIndex < NumActiveCells; ++CellIndex)
+	{
+		TotalLoad += WorkerLoads.FindRef(VirtualWorkerIds[CellIndex]);
+	}
+	const double AverageLoad = TotalLoad / NumActiveCells;
+
+	if (AverageLoad > ScaleUpLoadThreshold && NumActiveCells < Rows * Cols)
+	{
+		// The next cell can only be used once a server worker has been assigned to it and reported its load.
+		if (!WorkerLoads.Contains(VirtualWorkerIds[NumActiveCells]))
+		{
+			bWantsMoreCells = true;
+			return false;
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastScalingTime < ScalingCooldown)
+		{
+			return false;
+		}
+
+		// The new cell starts with no area, at the end of its column, and grows as its loaded neighbours shed load to it.
+		const uint32 Col = NumActiveCells / Rows;
+		if (NumActiveCells % Rows == 0)
+		{
+			LayOutColumnRows(Col, 1);
+		}
+		NumActiveCells++;
+		LastScalingTime = Now;
+
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy started using cell %d for virtual worker %d, average load %.2f."),
+			NumActiveCells - 1, VirtualWorkerIds[NumActiveCells - 1], AverageLoad);
+		return false;
+	}
+
+	if (AverageLoad < ScaleDownLoadThreshold && NumActiveCells > FMath::Max(MinActiveCells, 1u)
+		&& TotalLoad / (NumActiveCells - 1) < ScaleUpLoadThreshold)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastScalingTime < ScalingCooldown)
+		{
+			return false;
+		}
+
+		// The drain moves the boundary at the start of the last cell towards its end, at a fixed rate so the migration is spread out.
+		const uint32 LastCell = NumActiveCells - 1;
+		const uint32 Col = LastCell / Rows;
+		const uint32 Row = LastCell % Rows;
+		const float CellSize = Row > 0
+			? RowBoundaries[Col * (Rows + 1) + Row + 1] - RowBoundaries[Col * (Rows + 1) + Row]
+			: ColumnBoundaries[Col + 1] - ColumnBoundaries[Col];
+
+		DrainStepSize = FMath::Max(CellSize * MaxBoundaryMoveFraction, 1.f);
+		bDrainingLastCell = true;
+		LastScalingTime = Now;
+
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy draining cell %d of virtual worker %d, average load %.2f."),
+			LastCell, VirtualWorkerIds[LastCell], AverageLoad);
+		return DrainLastActiveCell();
+	}
+
+	return false;
+}
+
+bool UDynamicGridLBStrategy::DrainLastActiveCell()
+{
+	check(bDrainingLastCell && NumActiveCells > 1);
+
+	// The first cell of a column is only drained once the rest of the column is, so the whole column shrinks.
+	const uint32 LastCell = NumActiveCells - 1;
+	const uint32 Col = LastCell / Rows;
+	const uint32 Row = LastCell % Rows;
+	float& Boundary = Row > 0 ? RowBoundaries[Col * (Rows + 1) + Row] : ColumnBoundaries[Col];
+	const float End = Row > 0 ? RowBoundaries[Col * (Rows + 1) + Row + 1] : ColumnBoundaries[Col + 1];
+
+	Boundary = FMath::Min(Boundary + DrainStepSize, End);
+	if (Boundary >= End)
+	{
+		NumActiveCells--;
+		bDrainingLastCell = false;
+		LastScalingTime = FPlatformTime::Seconds();
+
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy stopped using cell %d of virtual worker %d."), LastCell, VirtualWorkerIds[LastCell]);
+	}
+
+	return true;
+}
+
+bool UDynamicGridLBStrategy::IsVirtualWorkerRequiredToStart(VirtualWorkerId WorkerId) const
+{
+	if (!bElasticCellCount)
+	{
+		return true;
+	}
+
+	const int32 CellIndex = VirtualWorkerIds.IndexOfByKey(WorkerId);
+	return CellIndex == INDEX_NONE || CellIndex < static_cast<int32>(FMath::Max(MinActiveCells, 1u));
+}
+
+void UDynamicGridLBStrategy::ReportWorkerLost(VirtualWorkerId WorkerId)
+{
+	WorkerLoads.Remove(WorkerId);
+
+	const int32 CellIndex = VirtualWorkerIds.IndexOfByKey(WorkerId);
+	if (CellIndex == INDEX_NONE || CellIndex >= static_cast<int32>(NumActiveCells))
+	{
+		return;
+	}
+
+	// Actors in the cell would have no server worker until a replacement is assigned, so a neighbour takes them over.
+	if (!GiveCellToNeighbour(CellIndex))
+	{
+		return;
+	}
+	RegionsVersion++;
+
+	const bool bIsLastActiveCell = CellIndex == static_cast<int32>(NumActiveCells) - 1;
+	if (bElasticCellCount && bIsLastActiveCell && (bDrainingLastCell || NumActiveCells > FMath::Max(MinActiveCells, 1u)))
+	{
+		// The last cell has been given away whole, as if it finished draining.
+		NumActiveCells--;
+		bDrainingLastCell = false;
+		LastScalingTime = FPlatformTime::Seconds();
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy stopped using cell %d, its virtual worker %d was lost."), CellIndex, WorkerId);
+		return;
+	}
+
+	// Rebalancing waits until the cell has a server worker reporting its load again, then it grows back from no area.
+	UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy gave cell %d to a neighbour until its virtual worker %d is reassigned."), CellIndex, WorkerId);
+}
+
+bool UDynamicGridLBStrategy::GiveCellToNeighbour(uint32 CellIndex)
+{
+	const uint32 Col = CellIndex / Rows;
+	const uint32 Row = CellIndex % Rows;
+	const uint32 RowBoundaryIndex = Col * (Rows + 1) + Row;
+
+	if (GetNumActiveRows(Col, NumActiveCells) > 1)
+	{
+		// The row below grows up over the cell, or the row above grows down over the first row.
+		if (Row > 0)
+		{
+			RowBoundaries[RowBoundaryIndex] = RowBoundaries[RowBoundaryIndex + 1];
+		}
+		else
+		{
+			RowBoundaries[RowBoundaryIndex + 1] = RowBoundaries[RowBoundaryIndex];
+		}
+		return true;
+	}
+
+	// The cell is the only one in use in its column, so the neighbouring column takes the whole column.
+	if (Col > 0)
+	{
+		ColumnBoundaries[Col] = ColumnBoundaries[Col + 1];
+		return true;
+	}
+	if (NumActiveCells > Rows)
+	{
+		ColumnBoundaries[Col + 1] = ColumnBoundaries[Col];
+		return true;
+	}
+
+	return false;
+}
+
+uint32 UDynamicGridLBStrategy::GetDesiredWorkerCount() const
+{
+	if (!bElasticCellCount)
+	{
+		return Rows * Cols;
+	}
+
+	if (bDrainingLastCell)
+	{
+		return NumActiveCells - 1;
+	}
+
+	return bWantsMoreCells ? NumActiveCells + 1 : NumActiveCells;
+}
+
+void UDynamicGridLBStrategy::WriteRegionsToSchema(Schema_Object* Object) const
+{
+	Schema_AddFloatList(Object, SpatialConstants::LOAD_BALANCING_REGIONS_COLUMN_BOUNDARIES_ID, ColumnBoundaries.GetData(), ColumnBoundaries.Num());
+	Schema_AddFloatList(Object, SpatialConstants::LOAD_BALANCING_REGIONS_ROW_BOUNDARIES_ID, RowBoundaries.GetData(), RowBoundaries.Num());
+}
+
+bool UDynamicGridLBStrategy::ApplyRegionsFromSchema(Schema_Object* Object)
+{
+	const uint32 ColumnBoundaryCount = Schema_GetFloatCount(Object, SpatialConstants::LOAD_BALANCING_REGIONS_COLUMN_BOUNDARIES_ID);
+	const uint32 RowBoundaryCount = Schema_GetFloatCount(Object, SpatialConstants::LOAD_BALANCING_REGIONS_ROW_BOUNDARIES_ID);
+	if (ColumnBoundaryCount != static_cast<uint32>(ColumnBoundaries.Num()) || RowBoundaryCount != static_cast<uint32>(RowBoundaries.Num()))
+	{
+		UE_LOG(LogDynamicGridLBStrategy, Error, TEXT("Received load balancing regions for a different grid size (%d column and %d row boundaries, expected %d and %d)."),
+			ColumnBoundaryCount, RowBoundaryCount, ColumnBoundaries.Num(), RowBoundaries.Num());
+		return false;
+	}
+
+	TArray<float> NewColumnBoundaries;
+	TArray<float> NewRowBoundaries;
+	NewColumnBoundaries.SetNumUninitialized(ColumnBoundaryCount);
+	NewRowBoundaries.SetNumUninitialized(RowBoundaryCount);
+	Schema_GetFloatList(Object, SpatialConstants::LOAD_BALANCING_REGIONS_COLUMN_BOUNDARIES_ID, NewColumnBoundaries.GetData());
+	Schema_GetFloatList(Object, SpatialConstants::LOAD_BALANCING_REGIONS_ROW_BOUNDARIES_ID, NewRowBoundaries.GetData());
+
+	if (NewColumnBoundaries == ColumnBoundaries && NewRowBoundaries == RowBoundaries)
+	{
+		return false;
+	}
+
+	ColumnBoundaries = MoveTemp(NewColumnBoundaries);
+	RowBoundaries = MoveTemp(NewRowBoundaries);
+	RegionsVersion++;
+
+	UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy applied new regions (version %d)."), RegionsVersion);
+	return true;
+}
+
+UDynamicGridLBStrategy::LBStrategyRegions UDynamicGridLBStrategy::GetLBStrategyRegions() const
+{
+	LBStrategyRegions VirtualWorkerToCell;
+	VirtualWorkerToCell.SetNum(VirtualWorkerIds.Num());
+
+	for (int i = 0; i < VirtualWorkerIds.Num(); i++)
+	{
+		VirtualWorkerToCell[i] = MakeTuple(VirtualWorkerIds[i], GetCell(i));
+	}
+	return VirtualWorkerToCell;
+}
+
+FBox2D UDynamicGridLBStrategy::GetCell(int32 CellIndex) const
+{
+	// Cells are indexed column by column, as in UGridBasedLBStrategy.
+	const int32 Col = CellIndex / Rows;
+	const int32 Row = CellIndex % Rows;
+	const int32 RowBoundaryIndex = Col * (Rows + 1) + Row;
+
+	return FBox2D(FVector2D(RowBoundaries[RowBoundaryIndex], ColumnBoundaries[Col]), FVector2D(RowBoundaries[RowBoundaryIndex + 1], ColumnBoundaries[Col + 1]));
+}
+
+int32 UDynamicGridLBStrategy::GetCellIndex(const FVector2D& Location) const
+{
+	// The last boundary not greater than the location, so that Min(Cell) <= Point < Max(Cell).
+	const int32 Col = Algo::UpperBound(ColumnBoundaries, Location.Y) - 1;
+	if (Col < 0 || Col >= static_cast<int32>(Cols))
+	{
+		return INDEX_NONE;
+	}
+
+	const TArrayView<const float> ColumnRowBoundaries(RowBoundaries.GetData() + Col * (Rows + 1), Rows + 1);
+	const int32 Row = Algo::UpperBound(ColumnRowBoundaries, Location.X) - 1;
+	if (Row < 0 || Row >= static_cast<int32>(Rows))
+	{
+		return INDEX_NONE;
+	}
+
+	return Col * Rows + Row;
+}
@@ -16,8 +16,12 @@ UGridBasedLBStrategy::UGridBasedLBStrategy()
 	, WorldWidth(1000000.f)
 	, WorldHeight(1000000.f)
 	, InterestBorder(0.f)
+	, BoundaryHysteresis(0.f)
 	, LocalCellId(0)
 	, bIsStrategyUsedOnLocalWorker(false)
+	, GridMin(FVector2D::ZeroVector)
+	, RowHeight(0.f)
+	, ColumnWidth(0.f)
 {
 }
 
@@ -30,8 +34,9 @@ void UGridBasedLBStrategy::Init()
 	const float WorldWidthMin = -(WorldWidth / 2.f);
 	const float WorldHeightMin = -(WorldHeight / 2.f);
 
-	const float ColumnWidth = WorldWidth / Cols;
-	const float RowHeight = WorldHeight / Rows;
+	ColumnWidth = WorldWidth / Cols;
+	RowHeight = WorldHeight / Rows;
+	GridMin = FVector2D(WorldHeightMin, WorldWidthMin);
 
 	// We would like the inspector's representation of the load balancing strategy to match our intuition.
 	// +x is forward, so rows are perpendicular to the x-axis and columns are perpendicular to the y-axis.
@@ -98,6 +103,31 @@ bool UGridBasedLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
 	return IsInside(WorkerCells[LocalCellId], Actor2DLocation);
 }
 
+bool UGridBasedLBStrategy::IsNearWorkerBoundary(const AActor& Actor, float Distance) const
+{
+	if (!IsReady() || !bIsStrategyUsedOnLocalWorker)
+	{
+		return true;
+	}
+
+	// If the cell is narrower than twice the distance, the shrunk box is inverted and nothing is inside it.
+	const FBox2D& LocalCell = WorkerCells[LocalCellId];
+	const FBox2D InnerCell(LocalCell.Min + FVector2D(Distance, Distance), LocalCell.Max - FVector2D(Distance, Distance));
+	return !IsInside(InnerCell, FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)));
+}
+
+bool UGridBasedLBStrategy::IsNearLocalRegion(const AActor& Actor, float Distance) const
+{
+	if (!IsReady() || !bIsStrategyUsedOnLocalWorker)
+	{
+		return false;
+	}
+
+	const FBox2D& LocalCell = WorkerCells[LocalCellId];
+	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	return !IsInside(LocalCell, Actor2DLocation) && IsInside(LocalCell.ExpandBy(Distance), Actor2DLocation);
+}
+
 VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
 {
 	if (!IsReady())
@@ -109,16 +139,72 @@ VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor
 	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
 
 	check(VirtualWorkerIds.Num() == WorkerCells.Num());
-	for (int i = 0; i < WorkerCells.Num(); i++)
+	const int32 CellIndex = GetCellIndex(Actor2DLocation);
+	if (CellIndex == INDEX_NONE)
 	{
-		if (IsInside(WorkerCells[i], Actor2DLocation))
-		{
-			UE_LOG(LogGridBasedLBStrategy, Log, TEXT("Actor: %s, grid %d, worker %d for position %f, %f"), *AActor::GetDebugName(&Actor), i, VirtualWorkerIds[i], Actor2DLocation.X, Actor2DLocation.Y);
-			return VirtualWorkerIds[i];
-		}
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	UE_LOG(LogGridBasedLBStrategy, Verbose, TEXT("Actor: %s, grid %d, worker %d for position %f, %f"), *AActor::GetDebugName(&Actor), CellIndex, VirtualWorkerIds[CellIndex], Actor2DLocation.X, Actor2DLocation.Y);
+	return VirtualWorkerIds[CellIndex];
+}
+
+void UGridBasedLBStrategy::ShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<bool>& OutShouldHaveAuthority) const
+{
+	OutShouldHaveAuthority.Init(false, Actors.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy not ready to relinquish authority for %d actors."), Actors.Num());
+		return;
+	}
+
+	if (!bIsStrategyUsedOnLocalWorker)
+	{
+		return;
+	}
+
+	const FBox2D& LocalCell = WorkerCells[LocalCellId];
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		OutShouldHaveAuthority[i] = IsInside(LocalCell, FVector2D(SpatialGDK::GetActorSpatialPosition(Actors[i])));
+	}
+}
+
+void UGridBasedLBStrategy::WhoShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	TArray<FVector2D> Positions;
+	Positions.Reserve(Actors.Num());
+	for (const AActor* Actor : Actors)
+	{
+		Positions.Add(FVector2D(SpatialGDK::GetActorSpatialPosition(Actor)));
+	}
+
+	WhoShouldHaveAuthority(Positions, OutVirtualWorkerIds);
+}
+
+void UGridBasedLBStrategy::WhoShouldHaveAuthority(const TArray<FVector2D>& Positions, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.Reset(Positions.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy not ready to decide on authority for %d positions."), Positions.Num());
+		OutVirtualWorkerIds.Init(SpatialConstants::INVALID_VIRTUAL_WORKER_ID, Positions.Num());
+		return;
 	}
 
-	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	check(VirtualWorkerIds.Num() == WorkerCells.Num());
+	for (const FVector2D& Position : Positions)
+	{
+		const int32 CellIndex = GetCellIndex(Position);
+		OutVirtualWorkerIds.Add(CellIndex != INDEX_NONE ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	}
+}
+
+bool UGridBasedLBStrategy::ShouldRetainAuthority(const AActor& Actor) const
+{
+	return BoundaryHysteresis > 0.f && IsNearLocalRegion(Actor, BoundaryHysteresis);
 }
 
 SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetWorkerInterestQueryConstraint() const
@@ -127,7 +213,23 @@ SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetWorkerInterestQueryConstrai
 	check(IsReady());
 	check(bIsStrategyUsedOnLocalWorker);
 
-	const FBox2D Interest2D = WorkerCells[LocalCellId].ExpandBy(InterestBorder);
+	return GetCellInterestQueryConstraint(LocalCellId);
+}
+
+SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const
+{
+	const int32 CellIndex = VirtualWorkerIds.IndexOfByKey(StandbyForWorkerId);
+	if (CellIndex == INDEX_NONE)
+	{
+		return {};
+	}
+
+	return GetCellInterestQueryConstraint(CellIndex);
+}
+
+SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetCellInterestQueryConstraint(int32 CellIndex) const
+{
+	const FBox2D Interest2D = WorkerCells[CellIndex].ExpandBy(InterestBorder);
 
 	const FVector2D Center2D = Interest2D.GetCenter();
 	const FVector Center3D{ Center2D.X, Center2D.Y, 0.0f};
@@ -169,6 +271,58 @@ bool UGridBasedLBStrategy::IsInside(const FBox2D& Box, const FVector2D& Location
 		&& Location.X < Box.Max.X && Location.Y < Box.Max.Y;
 }
 
+int32 UGridBasedLBStrategy::GetCellIndex(const FVector2D& Location) const
+{
+	const int32 Row = GetCellCoordinate(Location.X, GridMin.X, RowHeight, Rows);
+	const int32 Col = GetCellCoordinate(Location.Y, GridMin.Y, ColumnWidth, Cols);
+	if (Row == INDEX_NONE || Col == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// The boxes remain the source of truth, so that points on or near a cell boundary are assigned exactly as testing every cell would.
+	// Rounding can put the computed cell one off from the box containing the point, so the neighbouring cells are checked too.
+	for (int32 ColOffset = 0; ColOffset < 3; ++ColOffset)
+	{
+		const int32 CandidateCol = Col + (ColOffset == 2 ? -1 : ColOffset);
+		if (CandidateCol < 0 || CandidateCol >= static_cast<int32>(Cols))
+		{
+			continue;
+		}
+
+		for (int32 RowOffset = 0; RowOffset < 3; ++RowOffset)
+		{
+			const int32 CandidateRow = Row + (RowOffset == 2 ? -1 : RowOffset);
+			if (CandidateRow < 0 || CandidateRow >= static_cast<int32>(Rows))
+			{
+				continue;
+			}
+
+			// Cells are added column by column in Init.
+			const int32 CellIndex = CandidateCol * Rows + CandidateRow;
+			if (IsInside(WorkerCells[CellIndex], Location))
+			{
+				return CellIndex;
+			}
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 UGridBasedLBStrategy::GetCellCoordinate(float Value, float GridMinValue, float CellSize, uint32 NumCells)
+{
+	const float Coordinate = (Value - GridMinValue) / CellSize;
+
+	// Written so that NaN positions are rejected.
+	if (!(Coordinate >= -1.f && Coordinate < NumCells + 1.f))
+	{
+		return INDEX_NONE;
+	}
+
+	return FMath::Clamp(FMath::FloorToInt(Coordinate), 0, static_cast<int32>(NumCells) - 1);
+}
+
 UGridBasedLBStrategy::LBStrategyRegions UGridBasedLBStrategy::GetLBStrategyRegions() const
 {
 	LBStrategyRegions VirtualWorkerToCell;
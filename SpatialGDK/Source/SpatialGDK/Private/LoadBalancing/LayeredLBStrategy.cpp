@@ -6,12 +6,15 @@
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "LoadBalancing/GridBasedLBStrategy.h"
 #include "Utils/LayerInfo.h"
+#include "Utils/SchemaUtils.h"
 #include "Utils/SpatialActorUtils.h"
 
 #include "Templates/Tuple.h"
 
 DEFINE_LOG_CATEGORY(LogLayeredLBStrategy);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("LayerLookupCacheMisses"), STAT_LayeredLBStrategyLayerLookupCacheMisses, STATGROUP_SpatialNet);
+
 ULayeredLBStrategy::ULayeredLBStrategy()
 	: Super()
 {
@@ -83,6 +86,8 @@ void ULayeredLBStrategy::Init()
 			ClassPathToLayer.Add(ClassPtr, SpatialConstants::DefaultLayer);
 		}
 	}
+
+	PrecacheLayerNamesForLoadedClasses();
 }
 
 void ULayeredLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId)
@@ -115,11 +120,7 @@ bool ULayeredLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
 		return false;
 	}
 
-	const AActor* RootOwner = &Actor;
-	while (RootOwner->GetOwner() != nullptr && RootOwner->GetOwner()->GetIsReplicated())
-	{
-		RootOwner = RootOwner->GetOwner();
-	}
+	const AActor* RootOwner = GetRootReplicatedOwner(Actor);
 
 	const FName& LayerName = GetLayerNameForActor(*RootOwner);
 	if (!LayerNameToLBStrategy.Contains(LayerName))
@@ -137,6 +138,37 @@ bool ULayeredLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
 	return LayerNameToLBStrategy[LayerName]->ShouldHaveAuthority(Actor);
 }
 
+bool ULayeredLBStrategy::IsNearWorkerBoundary(const AActor& Actor, float Distance) const
+{
+	if (!IsReady())
+	{
+		return true;
+	}
+
+	const FName& LayerName = GetLayerNameForActor(*GetRootReplicatedOwner(Actor));
+	UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(LayerName);
+	return LayerStrategy == nullptr || (*LayerStrategy)->IsNearWorkerBoundary(Actor, Distance);
+}
+
+bool ULayeredLBStrategy::IsNearLocalRegion(const AActor& Actor, float Distance) const
+{
+	if (!IsReady())
+	{
+		return false;
+	}
+
+	const FName& LayerName = GetLayerNameForActor(*GetRootReplicatedOwner(Actor));
+
+	// Actors in a layer this worker is not responsible for never move to it.
+	if (VirtualWorkerIdToLayerName.Contains(LocalVirtualWorkerId) && VirtualWorkerIdToLayerName[LocalVirtualWorkerId] != LayerName)
+	{
+		return false;
+	}
+
+	UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(LayerName);
+	return LayerStrategy != nullptr && (*LayerStrategy)->IsNearLocalRegion(Actor, Distance);
+}
+
 VirtualWorkerId ULayeredLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
 {
 	if (!IsReady())
@@ -145,11 +177,7 @@ VirtualWorkerId ULayeredLBStrategy::WhoShouldHaveAuthority(const AActor& Actor)
 		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 	}
 
-	const AActor* RootOwner = &Actor;
-	while (RootOwner->GetOwner() != nullptr && RootOwner->GetOwner()->GetIsReplicated())
-	{
-		RootOwner = RootOwner->GetOwner();
-	}
+	const AActor* RootOwner = GetRootReplicatedOwner(Actor);
 
 	const FName& LayerName = GetLayerNameForActor(*RootOwner);
 	if (!LayerNameToLBStrategy.Contains(LayerName))
@@ -164,6 +192,142 @@ VirtualWorkerId ULayeredLBStrategy::WhoShouldHaveAuthority(const AActor& Actor)
 	return ReturnedWorkerId;
 }
 
+bool ULayeredLBStrategy::SupportsParallelAuthorityQueries() const
+{
+	for (const TPair<FName, UAbstractLBStrategy*>& LayerStrategy : LayerNameToLBStrategy)
+	{
+		if (LayerStrategy.Value == nullptr || !LayerStrategy.Value->SupportsParallelAuthorityQueries())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void ULayeredLBStrategy::PrepareParallelAuthorityQueries(const TArray<const AActor*>& Actors) const
+{
+	TMap<FName, TArray<int32>> ActorIndicesByLayer;
+	GroupActorsByLayer(Actors, ActorIndicesByLayer);
+
+	TArray<const AActor*> LayerActors;
+	for (const TPair<FName, TArray<int32>>& Layer : ActorIndicesByLayer)
+	{
+		if (UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(Layer.Key))
+		{
+			LayerActors.Reset(Layer.Value.Num());
+			for (int32 ActorIndex : Layer.Value)
+			{
+				LayerActors.Add(GetRootReplicatedOwner(*Actors[ActorIndex]));
+			}
+			(*LayerStrategy)->PrepareParallelAuthorityQueries(LayerActors);
+		}
+	}
+}
+
+void ULayeredLBStrategy::ShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<bool>& OutShouldHaveAuthority) const
+{
+	OutShouldHaveAuthority.Init(false, Actors.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogLayeredLBStrategy, Warning, TEXT("LayeredLBStrategy not ready to relinquish authority for %d actors."), Actors.Num());
+		return;
+	}
+
+	TMap<FName, TArray<int32>> ActorIndicesByLayer;
+	GroupActorsByLayer(Actors, ActorIndicesByLayer);
+
+	const FName* LocalLayerName = VirtualWorkerIdToLayerName.Find(LocalVirtualWorkerId);
+
+	TArray<const AActor*> LayerActors;
+	TArray<bool> LayerResults;
+	for (const TPair<FName, TArray<int32>>& Layer : ActorIndicesByLayer)
+	{
+		// If this worker is not responsible for the layer, none of its actors should be authoritative here.
+		if (LocalLayerName != nullptr && *LocalLayerName != Layer.Key)
+		{
+			continue;
+		}
+
+		UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(Layer.Key);
+		if (LayerStrategy == nullptr)
+		{
+			UE_LOG(LogLayeredLBStrategy, Error, TEXT("LayeredLBStrategy doesn't have a LBStrategy for %d actors in Layer %s."), Layer.Value.Num(), *Layer.Key.ToString());
+			continue;
+		}
+
+		LayerActors.Reset(Layer.Value.Num());
+		for (int32 ActorIndex : Layer.Value)
+		{
+			LayerActors.Add(Actors[ActorIndex]);
+		}
+
+		(*LayerStrategy)->ShouldHaveAuthorityForActors(LayerActors, LayerResults);
+		for (int32 i = 0; i < Layer.Value.Num(); i++)
+		{
+			OutShouldHaveAuthority[Layer.Value[i]] = LayerResults[i];
+		}
+	}
+}
+
+void ULayeredLBStrategy::WhoShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.Init(SpatialConstants::INVALID_VIRTUAL_WORKER_ID, Actors.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogLayeredLBStrategy, Warning, TEXT("LayeredLBStrategy not ready to decide on authority for %d actors."), Actors.Num());
+		return;
+	}
+
+	TMap<FName, TArray<int32>> ActorIndicesByLayer;
+	GroupActorsByLayer(Actors, ActorIndicesByLayer);
+
+	TArray<const AActor*> LayerActors;
+	TArray<VirtualWorkerId> LayerResults;
+	for (const TPair<FName, TArray<int32>>& Layer : ActorIndicesByLayer)
+	{
+		UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(Layer.Key);
+		if (LayerStrategy == nullptr)
+		{
+			UE_LOG(LogLayeredLBStrategy, Error, TEXT("LayeredLBStrategy doesn't have a LBStrategy for %d actors in Layer %s."), Layer.Value.Num(), *Layer.Key.ToString());
+			continue;
+		}
+
+		// As in WhoShouldHaveAuthority, the layer strategy decides based on the root owner.
+		LayerActors.Reset(Layer.Value.Num());
+		for (int32 ActorIndex : Layer.Value)
+		{
+			LayerActors.Add(GetRootReplicatedOwner(*Actors[ActorIndex]));
+		}
+
+		(*LayerStrategy)->WhoShouldHaveAuthorityForActors(LayerActors, LayerResults);
+		for (int32 i = 0; i < Layer.Value.Num(); i++)
+		{
+			OutVirtualWorkerIds[Layer.Value[i]] = LayerResults[i];
+		}
+	}
+}
+
+bool ULayeredLBStrategy::ShouldRetainAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		return false;
+	}
+
+	const FName& LayerName = GetLayerNameForActor(*GetRootReplicatedOwner(Actor));
+
+	// Never hold on to actors in a layer this worker is not responsible for.
+	if (VirtualWorkerIdToLayerName.Contains(LocalVirtualWorkerId) && VirtualWorkerIdToLayerName[LocalVirtualWorkerId] != LayerName)
+	{
+		return false;
+	}
+
+	UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(LayerName);
+	return LayerStrategy != nullptr && (*LayerStrategy)->ShouldRetainAuthority(Actor);
+}
+
 SpatialGDK::QueryConstraint ULayeredLBStrategy::GetWorkerInterestQueryConstraint() const
 {
 	check(IsReady());
@@ -182,6 +346,18 @@ SpatialGDK::QueryConstraint ULayeredLBStrategy::GetWorkerInterestQueryConstraint
 	}
 }
 
+SpatialGDK::QueryConstraint ULayeredLBStrategy::GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const
+{
+	const FName* LayerName = VirtualWorkerIdToLayerName.Find(StandbyForWorkerId);
+	if (LayerName == nullptr)
+	{
+		return {};
+	}
+
+	check(LayerNameToLBStrategy.Contains(*LayerName));
+	return LayerNameToLBStrategy[*LayerName]->GetStandbyInterestQueryConstraint(StandbyForWorkerId);
+}
+
 FVector ULayeredLBStrategy::GetWorkerEntityPosition() const
 {
 	check(IsReady());
@@ -247,6 +423,107 @@ void ULayeredLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtual
 	}
 }
 
+bool ULayeredLBStrategy::RequiresWorkerLoadReports() const
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->RequiresWorkerLoadReports())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void ULayeredLBStrategy::ReportWorkerLoad(VirtualWorkerId WorkerId, double Load)
+{
+	if (const FName* LayerName = VirtualWorkerIdToLayerName.Find(WorkerId))
+	{
+		LayerNameToLBStrategy[*LayerName]->ReportWorkerLoad(WorkerId, Load);
+	}
+}
+
+void ULayeredLBStrategy::ReportWorkerLoadVector(VirtualWorkerId WorkerId, const SpatialGDK::FWorkerLoadVector& LoadVector)
+{
+	if (const FName* LayerName = VirtualWorkerIdToLayerName.Find(WorkerId))
+	{
+		LayerNameToLBStrategy[*LayerName]->ReportWorkerLoadVector(WorkerId, LoadVector);
+	}
+}
+
+bool ULayeredLBStrategy::RebalanceRegions()
+{
+	bool bChanged = false;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		bChanged |= Elem.Value->RebalanceRegions();
+	}
+	return bChanged;
+}
+
+void ULayeredLBStrategy::WriteRegionsToSchema(Schema_Object* Object) const
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->RequiresWorkerLoadReports())
+		{
+			Schema_Object* LayerRegionsObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID);
+			SpatialGDK::AddStringToSchema(LayerRegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_LAYER_NAME_ID, Elem.Key.ToString());
+			Elem.Value->WriteRegionsToSchema(LayerRegionsObject);
+		}
+	}
+}
+
+bool ULayeredLBStrategy::ApplyRegionsFromSchema(Schema_Object* Object)
+{
+	bool bChanged = false;
+
+	const uint32 LayerCount = Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID);
+	for (uint32 i = 0; i < LayerCount; i++)
+	{
+		Schema_Object* LayerRegionsObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID, i);
+		const FName LayerName(*SpatialGDK::GetStringFromSchema(LayerRegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_LAYER_NAME_ID));
+
+		if (UAbstractLBStrategy* const* LayerStrategy = LayerNameToLBStrategy.Find(LayerName))
+		{
+			bChanged |= (*LayerStrategy)->ApplyRegionsFromSchema(LayerRegionsObject);
+		}
+		else
+		{
+			UE_LOG(LogLayeredLBStrategy, Error, TEXT("LayeredLBStrategy received load balancing regions for unknown Layer %s."), *LayerName.ToString());
+		}
+	}
+
+	return bChanged;
+}
+
+bool ULayeredLBStrategy::IsVirtualWorkerRequiredToStart(VirtualWorkerId WorkerId) const
+{
+	if (const FName* LayerName = VirtualWorkerIdToLayerName.Find(WorkerId))
+	{
+		return LayerNameToLBStrategy[*LayerName]->IsVirtualWorkerRequiredToStart(WorkerId);
+	}
+	return true;
+}
+
+void ULayeredLBStrategy::ReportWorkerLost(VirtualWorkerId WorkerId)
+{
+	if (const FName* LayerName = VirtualWorkerIdToLayerName.Find(WorkerId))
+	{
+		LayerNameToLBStrategy[*LayerName]->ReportWorkerLost(WorkerId);
+	}
+}
+
+uint32 ULayeredLBStrategy::GetDesiredWorkerCount() const
+{
+	uint32 DesiredWorkerCount = 0;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		DesiredWorkerCount += Elem.Value->GetDesiredWorkerCount();
+	}
+	return DesiredWorkerCount;
+}
+
 // DEPRECATED
 // This is only included because Scavengers uses the function in SpatialStatics that calls this.
 // Once they are pick up this code, they should be able to switch to another method and we can remove this.
@@ -270,6 +547,39 @@ FName ULayeredLBStrategy::GetLayerNameForClass(const TSubclassOf<AActor> Class)
 		return NAME_None;
 	}
 
+	const FObjectKey ClassKey(Class.Get());
+	if (const FName* Layer = ClassToLayer.Find(ClassKey))
+	{
+		return *Layer;
+	}
+
+	INC_DWORD_STAT(STAT_LayeredLBStrategyLayerLookupCacheMisses);
+
+	const FName LayerName = ResolveLayerNameForClass(Class);
+	ClassToLayer.Add(ClassKey, LayerName);
+	return LayerName;
+}
+
+void ULayeredLBStrategy::PrecacheLayerNamesForLoadedClasses()
+{
+	ClassToLayer.Reset();
+
+	TArray<TSoftClassPtr<AActor>> ConfiguredClasses;
+	ClassPathToLayer.GetKeys(ConfiguredClasses);
+
+	for (const TSoftClassPtr<AActor>& ClassPtr : ConfiguredClasses)
+	{
+		if (UClass* LoadedClass = ClassPtr.Get())
+		{
+			ClassToLayer.Add(FObjectKey(LoadedClass), ResolveLayerNameForClass(LoadedClass));
+		}
+	}
+}
+
+FName ULayeredLBStrategy::ResolveLayerNameForClass(const TSubclassOf<AActor> Class) const
+{
+	check(Class != nullptr);
+
 	UClass* FoundClass = Class;
 	TSoftClassPtr<AActor> ClassPtr = TSoftClassPtr<AActor>(FoundClass);
 
@@ -308,6 +618,24 @@ FName ULayeredLBStrategy::GetLayerNameForActor(const AActor& Actor) const
 	return GetLayerNameForClass(Actor.GetClass());
 }
 
+const AActor* ULayeredLBStrategy::GetRootReplicatedOwner(const AActor& Actor)
+{
+	const AActor* RootOwner = &Actor;
+	while (RootOwner->GetOwner() != nullptr && RootOwner->GetOwner()->GetIsReplicated())
+	{
+		RootOwner = RootOwner->GetOwner();
+	}
+	return RootOwner;
+}
+
+void ULayeredLBStrategy::GroupActorsByLayer(const TArray<const AActor*>& Actors, TMap<FName, TArray<int32>>& OutActorIndicesByLayer) const
+{
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		OutActorIndicesByLayer.FindOrAdd(GetLayerNameForActor(*GetRootReplicatedOwner(*Actors[i]))).Add(i);
+	}
+}
+
 void ULayeredLBStrategy::AddStrategyForLayer(const FName& LayerName, UAbstractLBStrategy* LBStrategy)
 {
 	LayerNameToLBStrategy.Add(LayerName, LBStrategy);
@@ -36,17 +36,10 @@ ActorLockToken UOwnershipLockingPolicy::AcquireLock(AActor* Actor, FString Debug
 	}
 	else
 	{
-		// We want to avoid memory leak if a locked actor is deleted.
-		// To do this, we register with the Actor OnDestroyed delegate with a function that cleans up the internal map.
-		if (!Actor->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted))
-		{
-			Actor->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted);
-		}
+		// This also registers with the OnDestroyed delegate of the Actor, so the internal maps are cleaned up if it is deleted.
+		UpdateSubtreeLockCounts(Actor, 1);
 
-		AActor* OwnershipHierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor);
-		AddOwnershipHierarchyRootInformation(OwnershipHierarchyRoot, Actor);
-		
-		ActorToLockingState.Add(Actor, MigrationLockElement{ 1, OwnershipHierarchyRoot });
+		ActorToLockingState.Add(Actor, MigrationLockElement{ 1 });
 	}
 
 	UE_LOG(LogOwnershipLockingPolicy, Verbose, TEXT("Acquiring migration lock. "
@@ -77,8 +70,7 @@ bool UOwnershipLockingPolicy::ReleaseLock(const ActorLockToken Token)
 		if (ActorLockingState.LockCount == 1)
 		{
 			UE_LOG(LogOwnershipLockingPolicy, Verbose, TEXT("Actor migration no longer locked. Actor: %s"), *Actor->GetName());
-			Actor->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted);
-			RemoveOwnershipHierarchyRootInformation(ActorLockingState.HierarchyRoot, Actor);
+			UpdateSubtreeLockCounts(Actor, -1);
 			CountIt.RemoveCurrent();
 		}
 		else
@@ -100,29 +92,9 @@ bool UOwnershipLockingPolicy::IsLocked(const AActor* Actor) const
 		return false;
 	}
 
-	// Is this Actor explicitly locked or on a locked hierarchy ownership path.
-	if (IsExplicitlyLocked(Actor) || IsLockedHierarchyRoot(Actor))
-	{
-		return true;
-	}
-
-	// Is the hierarchy root of this Actor explicitly locked or on a locked hierarchy ownership path.
-	if (AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor))
-	{
-		return IsExplicitlyLocked(HierarchyRoot) || IsLockedHierarchyRoot(HierarchyRoot);
-	}
-
-	return false;
-}
-
-bool UOwnershipLockingPolicy::IsExplicitlyLocked(const AActor* Actor) const
-{
-	return ActorToLockingState.Contains(Actor);
-}
-
-bool UOwnershipLockingPolicy::IsLockedHierarchyRoot(const AActor* Actor) const
-{
-	return LockedOwnershipRootActorToExplicitlyLockedActors.Contains(Actor);
+	// An Actor is locked if any Actor in its ownership hierarchy is explicitly locked, which is the case if the root has a subtree lock count.
+	const AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor);
+	return SubtreeLockCounts.Contains(HierarchyRoot != nullptr ? HierarchyRoot : Actor);
 }
 
 bool UOwnershipLockingPolicy::AcquireLockFromDelegate(AActor* ActorToLock, const FString& DelegateLockIdentifier)
@@ -155,117 +127,67 @@ void UOwnershipLockingPolicy::OnOwnerUpdated(const AActor* Actor, const AActor*
 {
 	check(Actor != nullptr);
 
-	// If an explicitly locked Actor is changing owner.
-	if (IsExplicitlyLocked(Actor))
+	// Only the explicitly locked Actors in the subtree of the Actor move to a different hierarchy,
+	// so they are removed from the old ownership path and added to the new one.
+	const int32 MovedLockCount = SubtreeLockCounts.FindRef(Actor);
+	if (MovedLockCount == 0 || OldOwner == Actor->GetOwner())
 	{
-		RecalculateLockedActorOwnershipHierarchyInformation(Actor);
+		return;
 	}
 
-	// If a locked hierarchy root is changing owner.
-	if (IsLockedHierarchyRoot(Actor))
+	if (OldOwner != nullptr)
 	{
-		RecalculateAllExplicitlyLockedActorsInThisHierarchy(Actor);
+		UpdateSubtreeLockCounts(OldOwner, -MovedLockCount);
 	}
-	// If an Actor in a locked hierarchy is changing owner (i.e. either the old owner or
-	// the root hierarchy of the old owner is the root of a locked hierarchy), we need to
-	// recalculate ownership hierarchies of all explicitly locked Actors in that hierarchy.
-	else if (OldOwner != nullptr)
-	{
-		const AActor* OldHierarchyRoot = OldOwner->GetOwner() != nullptr ? SpatialGDK::GetHierarchyRoot(OldOwner) : OldOwner;
-		if (IsLockedHierarchyRoot(OldHierarchyRoot))
-		{
-			RecalculateAllExplicitlyLockedActorsInThisHierarchy(OldHierarchyRoot);
-		}
-	}
- }
 
-void UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted(AActor* DestroyedActor)
-{
-	// Find all tokens for this Actor and unlock.
-	for (auto TokenNameActorIterator = TokenToNameAndActor.CreateIterator(); TokenNameActorIterator; ++TokenNameActorIterator)
+	if (const AActor* NewOwner = Actor->GetOwner())
 	{
-		if (TokenNameActorIterator->Value.Actor == DestroyedActor)
-		{
-			TokenNameActorIterator.RemoveCurrent();
-		}
+		UpdateSubtreeLockCounts(NewOwner, MovedLockCount);
 	}
-
-	// Delete Actor from local mapping.
-	MigrationLockElement ActorLockingState = ActorToLockingState.FindAndRemoveChecked(DestroyedActor);
-
-	// Update ownership path Actor mapping to remove this Actor.
-	RemoveOwnershipHierarchyRootInformation(ActorLockingState.HierarchyRoot, DestroyedActor);
 }
 
-void UOwnershipLockingPolicy::OnHierarchyRootActorDeleted(AActor* DeletedHierarchyRoot)
+void UOwnershipLockingPolicy::OnLockedSubtreeActorDeleted(AActor* DestroyedActor)
 {
-	check(LockedOwnershipRootActorToExplicitlyLockedActors.Contains(DeletedHierarchyRoot));
-
-	// For all explicitly locked Actors where this Actor is on the ownership path, recalculate the
-	// ownership path information to account for this Actor's deletion.
-	RecalculateAllExplicitlyLockedActorsInThisHierarchy(DeletedHierarchyRoot);
-	LockedOwnershipRootActorToExplicitlyLockedActors.Remove(DeletedHierarchyRoot);
-}
-
-void UOwnershipLockingPolicy::RecalculateAllExplicitlyLockedActorsInThisHierarchy(const AActor* HierarchyRoot)
-{
-	TArray<const AActor*> ExplicitlyLockedActorsWithThisActorInOwnershipPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindChecked(HierarchyRoot);
-	for (const AActor* ExplicitlyLockedActor : ExplicitlyLockedActorsWithThisActorInOwnershipPath)
+	if (ActorToLockingState.Remove(DestroyedActor) > 0)
 	{
-		RecalculateLockedActorOwnershipHierarchyInformation(ExplicitlyLockedActor);
-	}
-}
-
-void UOwnershipLockingPolicy::RecalculateLockedActorOwnershipHierarchyInformation(const AActor* ExplicitlyLockedActor)
-{
-	// For the old ownership path, update ownership path Actor mapping to explicitly locked Actors to remove this Actor.
-	AActor* OldHierarchyRoot = ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot;
-	RemoveOwnershipHierarchyRootInformation(OldHierarchyRoot, ExplicitlyLockedActor);
-
-	// For the new ownership path, update ownership path Actor mapping to explicitly locked Actors to include this Actor.
-	AActor* NewOwnershipHierarchyRoot = SpatialGDK::GetHierarchyRoot(ExplicitlyLockedActor);
-	ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot = NewOwnershipHierarchyRoot;
-	AddOwnershipHierarchyRootInformation(NewOwnershipHierarchyRoot, ExplicitlyLockedActor);
-}
-
-void UOwnershipLockingPolicy::RemoveOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor)
-{
-	if (HierarchyRoot == nullptr)
-	{
-		return;
+		// Find all tokens for this Actor and unlock.
+		for (auto TokenNameActorIterator = TokenToNameAndActor.CreateIterator(); TokenNameActorIterator; ++TokenNameActorIterator)
+		{
+			if (TokenNameActorIterator->Value.Actor == DestroyedActor)
+			{
+				TokenNameActorIterator.RemoveCurrent();
+			}
+		}
 	}
 
-	// Find Actors in this root Actor's hierarchy which are explicitly locked.
-	TArray<const AActor*>& ExplicitlyLockedActorsWithThisActorOnPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindChecked(HierarchyRoot);
-	check(ExplicitlyLockedActorsWithThisActorOnPath.Num() > 0);
-
-	// If there's only one explicitly locked Actor in the hierarchy, we're removing the only Actor with this root,
-	// so we can stop caring about the root itself. Otherwise, just remove the specific Actor entry in the root's list.
-	if (ExplicitlyLockedActorsWithThisActorOnPath.Num() == 1)
-	{
-		LockedOwnershipRootActorToExplicitlyLockedActors.Remove(HierarchyRoot);
-		HierarchyRoot->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
-	}
-	else
+	// The Actors owned by the destroyed Actor become hierarchy roots and keep their own subtree lock counts,
+	// so all locks in its subtree are removed from the ownership path above it.
+	const int32 LockCount = SubtreeLockCounts.FindAndRemoveChecked(DestroyedActor);
+	if (AActor* Owner = DestroyedActor->GetOwner())
 	{
-		ExplicitlyLockedActorsWithThisActorOnPath.Remove(ExplicitlyLockedActor);
+		UpdateSubtreeLockCounts(Owner, -LockCount);
 	}
 }
 
-void UOwnershipLockingPolicy::AddOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor)
+void UOwnershipLockingPolicy::UpdateSubtreeLockCounts(const AActor* Actor, int32 Delta)
 {
-	if (HierarchyRoot == nullptr)
+	for (AActor* PathActor = const_cast<AActor*>(Actor); PathActor != nullptr && !PathActor->IsPendingKillPending(); PathActor = PathActor->GetOwner())
 	{
-		return;
-	}
+		int32& LockCount = SubtreeLockCounts.FindOrAdd(PathActor);
+		if (LockCount == 0)
+		{
+			// We want to avoid memory leak if an Actor on a locked ownership path is deleted.
+			// To do this, we register with the Actor OnDestroyed delegate with a function that cleans up the internal maps.
+			PathActor->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnLockedSubtreeActorDeleted);
+		}
 
-	// For the hierarchy root of an explicitly locked Actor, we store a reference from the hierarchy root Actor back to
-	// the explicitly locked Actor, as well as binding a deletion delegate to the hierarchy root Actor.
-	TArray<const AActor*>& ExplicitlyLockedActorsWithThisActorOnPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindOrAdd(HierarchyRoot);
-	ExplicitlyLockedActorsWithThisActorOnPath.AddUnique(ExplicitlyLockedActor);
+		LockCount += Delta;
+		check(LockCount >= 0);
 
-	if (!HierarchyRoot->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted))
-	{
-		HierarchyRoot->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+		if (LockCount == 0)
+		{
+			PathActor->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnLockedSubtreeActorDeleted);
+			SubtreeLockCounts.Remove(PathActor);
+		}
 	}
 }
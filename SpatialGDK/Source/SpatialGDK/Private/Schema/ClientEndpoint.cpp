@@ -23,6 +23,7 @@ void ClientEndpoint::ReadFromSchema(Schema_Object* SchemaObject)
 	RPCRingBufferUtils::ReadBufferFromSchema(SchemaObject, UnreliableRPCBuffer);
 	RPCRingBufferUtils::ReadAckFromSchema(SchemaObject, ERPCType::ClientReliable, ReliableRPCAck);
 	RPCRingBufferUtils::ReadAckFromSchema(SchemaObject, ERPCType::ClientUnreliable, UnreliableRPCAck);
+	RPCRingBufferUtils::ReadPingIdFromSchema(SchemaObject, PingId);
 }
 
 } // namespace SpatialGDK
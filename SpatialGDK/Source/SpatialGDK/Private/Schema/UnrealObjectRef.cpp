@@ -8,11 +8,97 @@
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialMetricsDisplay.h"
 
+#include "Misc/ScopeRWLock.h"
+
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/GameStateBase.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUnrealObjectRef, Log, All);
 
+namespace
+{
+struct FCaseSensitivePathKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, /* bInAllowDuplicateKeys */ false>
+{
+	static FORCEINLINE const FString& GetSetKey(const TPair<FString, uint32>& Element)
+	{
+		return Element.Key;
+	}
+
+	static FORCEINLINE bool Matches(const FString& A, const FString& B)
+	{
+		return A.Equals(B, ESearchCase::CaseSensitive);
+	}
+
+	static FORCEINLINE uint32 GetKeyHash(const FString& Key)
+	{
+		return FCrc::StrCrc32(*Key);
+	}
+};
+
+class FUnrealObjectRefPathTable
+{
+public:
+	static FUnrealObjectRefPathTable& Get()
+	{
+		static FUnrealObjectRefPathTable Table;
+		return Table;
+	}
+
+	uint32 FindOrAdd(const FString& Path)
+	{
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const uint32* Id = Ids.Find(Path))
+			{
+				return *Id;
+			}
+		}
+
+		FWriteScopeLock WriteLock(Lock);
+		if (const uint32* Id = Ids.Find(Path))
+		{
+			return *Id;
+		}
+
+		const uint32 NewId = Paths.Add(MakeUnique<FString>(Path));
+		Ids.Add(Path, NewId);
+		return NewId;
+	}
+
+	const FString& GetPath(uint32 Id)
+	{
+		// The strings are heap allocated and never removed, so the reference stays valid after unlocking.
+		FReadScopeLock ReadLock(Lock);
+		return *Paths[Id];
+	}
+
+private:
+	FUnrealObjectRefPathTable()
+	{
+		// Id 0 is the empty path, which default constructed paths refer to.
+		Paths.Add(MakeUnique<FString>());
+		Ids.Add(FString(), 0);
+	}
+
+	FRWLock Lock;
+	TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitivePathKeyFuncs> Ids;
+	TArray<TUniquePtr<FString>> Paths;
+};
+} // anonymous namespace
+
+FUnrealObjectRefPath::FUnrealObjectRefPath(const FString& Path)
+	: Id(FUnrealObjectRefPathTable::Get().FindOrAdd(Path))
+{}
+
+FUnrealObjectRefPath::FUnrealObjectRefPath(const TCHAR* Path)
+	: FUnrealObjectRefPath(FString(Path))
+{}
+
+const FString& FUnrealObjectRefPath::ToString() const
+{
+	return FUnrealObjectRefPathTable::Get().GetPath(Id);
+}
+
 const FUnrealObjectRef FUnrealObjectRef::NULL_OBJECT_REF = FUnrealObjectRef(SpatialConstants::INVALID_ENTITY_ID, 0);
 const FUnrealObjectRef FUnrealObjectRef::UNRESOLVED_OBJECT_REF = FUnrealObjectRef(SpatialConstants::INVALID_ENTITY_ID, 1);
 
@@ -33,7 +119,7 @@ UObject* FUnrealObjectRef::ToObjectPtr(const FUnrealObjectRef& ObjectRef, USpati
 			if (Value == nullptr)
 			{
 				// This could happen if we no longer spawn all of these Actors before starting replication.
-				UE_LOG(LogUnrealObjectRef, Warning, TEXT("Could not load object reference by class path: %s"), **ClassRef.Path);
+				UE_LOG(LogUnrealObjectRef, Warning, TEXT("Could not load object reference by class path: %s"), *ClassRef.Path->ToString());
 				bOutUnresolved = true;
 			}
 			return Value;
@@ -162,11 +248,11 @@ FUnrealObjectRef FUnrealObjectRef::FromSoftObjectPath(const FSoftObjectPath& Obj
 {
 	FUnrealObjectRef PackageRef;
 
-	PackageRef.Path = ObjectPath.GetLongPackageName();
+	PackageRef.Path = FUnrealObjectRefPath(ObjectPath.GetLongPackageName());
 
 	FUnrealObjectRef ObjectRef;
 	ObjectRef.Outer = PackageRef;
-	ObjectRef.Path = ObjectPath.GetAssetName();
+	ObjectRef.Path = FUnrealObjectRefPath(ObjectPath.GetAssetName());
 
 	return ObjectRef;
 }
@@ -185,7 +271,7 @@ FSoftObjectPath FUnrealObjectRef::ToSoftObjectPath(const FUnrealObjectRef& Objec
 	{
 		if (CurRef->Path.IsSet())
 		{
-			FString Path = *CurRef->Path;
+			FString Path = CurRef->Path->ToString();
 			if (!FullPackagePath.IsEmpty())
 			{
 				Path.Append(bSubObjectName ? TEXT(".") : TEXT("/"));
@@ -0,0 +1,71 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SimulatedPlayers/SimulatedPlayerBehaviour.h"
+
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+void USimulatedPlayerBehaviour::StartBehaviour_Implementation(APlayerController* Controller)
+{
+}
+
+void USimulatedPlayerBehaviour::TickBehaviour_Implementation(APlayerController* Controller, float DeltaSeconds)
+{
+}
+
+UWorld* USimulatedPlayerBehaviour::GetWorld() const
+{
+	// Lets Blueprint subclasses call functions that need a world context, the outer is the owning component.
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return nullptr;
+	}
+
+	const UObject* Outer = GetOuter();
+	return Outer != nullptr ? Outer->GetWorld() : nullptr;
+}
+
+USimulatedPlayerWanderBehaviour::USimulatedPlayerWanderBehaviour()
+{
+	// Movement input has to be added every frame the pawn should keep moving.
+	ActivationsPerSecond = 1000.0f;
+}
+
+void USimulatedPlayerWanderBehaviour::StartBehaviour_Implementation(APlayerController* Controller)
+{
+	Origin.Reset();
+}
+
+void USimulatedPlayerWanderBehaviour::TickBehaviour_Implementation(APlayerController* Controller, float DeltaSeconds)
+{
+	APawn* Pawn = Controller->GetPawn();
+	if (Pawn == nullptr)
+	{
+		return;
+	}
+
+	const FVector Location = Pawn->GetActorLocation();
+	if (!Origin.IsSet())
+	{
+		// The pawn may only be possessed some time after the controller began play.
+		Origin = Location;
+		PickNewTarget();
+	}
+
+	FVector ToTarget = Target - Location;
+	ToTarget.Z = 0.0f;
+	if (ToTarget.SizeSquared() <= FMath::Square(AcceptanceRadius))
+	{
+		PickNewTarget();
+		return;
+	}
+
+	Pawn->AddMovementInput(ToTarget.GetSafeNormal());
+	Controller->SetControlRotation(ToTarget.Rotation());
+}
+
+void USimulatedPlayerWanderBehaviour::PickNewTarget()
+{
+	const FVector2D Offset = FMath::RandPointInCircle(WanderRadius);
+	Target = Origin.GetValue() + FVector(Offset.X, Offset.Y, 0.0f);
+}
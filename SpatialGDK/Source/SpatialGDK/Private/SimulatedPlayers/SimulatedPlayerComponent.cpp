@@ -0,0 +1,100 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SimulatedPlayers/SimulatedPlayerComponent.h"
+
+#include "EngineClasses/Components/SpatialPingComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "SimulatedPlayers/SimPlayerBPFunctionLibrary.h"
+#include "SimulatedPlayers/SimulatedPlayerBehaviour.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY(LogSimulatedPlayerComponent);
+
+USimulatedPlayerComponent::USimulatedPlayerComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Behaviours such as moving the pawn have to add their input every frame.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void USimulatedPlayerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	OwningController = Cast<APlayerController>(GetOwner());
+	if (OwningController == nullptr)
+	{
+		UE_LOG(LogSimulatedPlayerComponent, Warning, TEXT("SimulatedPlayerComponent did not find a valid owning PlayerController and will not function correctly. Ensure this component is only attached to a PlayerController."));
+		return;
+	}
+
+	// Only drive the local player controller of a simulated client.
+	if (!OwningController->IsLocalController() || !USimPlayerBPFunctionLibrary::IsSimulatedPlayer(this))
+	{
+		return;
+	}
+
+	for (USimulatedPlayerBehaviour* Behaviour : Behaviours)
+	{
+		if (Behaviour != nullptr)
+		{
+			Behaviour->StartBehaviour(OwningController);
+		}
+	}
+
+	SetComponentTickEnabled(true);
+
+	if (LatencyReportInterval > 0.0f)
+	{
+		GetWorld()->GetTimerManager().SetTimer(LatencyReportTimerHandle, this, &USimulatedPlayerComponent::ReportLatency, LatencyReportInterval, true);
+	}
+}
+
+void USimulatedPlayerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(LatencyReportTimerHandle);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USimulatedPlayerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	for (USimulatedPlayerBehaviour* Behaviour : Behaviours)
+	{
+		if (Behaviour == nullptr)
+		{
+			continue;
+		}
+
+		// Randomize activations so many simulated players with the same profile don't act in lockstep.
+		const float ActivationChance = Behaviour->ActivationsPerSecond * DeltaTime;
+		if (ActivationChance >= 1.0f || FMath::FRand() < ActivationChance)
+		{
+			Behaviour->TickBehaviour(OwningController, DeltaTime);
+		}
+	}
+}
+
+void USimulatedPlayerComponent::ReportLatency() const
+{
+	const USpatialPingComponent* PingComponent = OwningController != nullptr ? OwningController->FindComponentByClass<USpatialPingComponent>() : nullptr;
+	if (PingComponent == nullptr || !PingComponent->GetIsPingEnabled())
+	{
+		UE_LOG(LogSimulatedPlayerComponent, Verbose, TEXT("Cannot report latency of simulated player %s: no enabled SpatialPingComponent on its PlayerController."), *GetNameSafe(OwningController));
+		return;
+	}
+
+	const FSpatialPingAverageData PingData = PingComponent->GetAverageData();
+	UE_LOG(LogSimulatedPlayerComponent, Log, TEXT("Simulated player %s RTT over the last %d pings: avg %.1f ms, p50 %.1f ms, p90 %.1f ms, max %.1f ms. Total: avg %.1f ms over %d pings."),
+		*GetNameSafe(OwningController), PingData.WindowSize,
+		PingData.LastMeasurementsWindowAvg * 1000.0f, PingData.LastMeasurementsWindow50thPercentile * 1000.0f,
+		PingData.LastMeasurementsWindow90thPercentile * 1000.0f, PingData.LastMeasurementsWindowMax * 1000.0f,
+		PingData.TotalAvg * 1000.0f, PingData.TotalNum);
+}
@@ -2,6 +2,8 @@
 
 #include "SpatialGDKConsoleCommands.h"
 
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialStaticComponentView.h"
 #include "SpatialConstants.h"
 #include "Engine/Engine.h"
 
@@ -34,4 +36,46 @@ namespace SpatialGDKConsoleCommands
 		TEXT("Usage: ConnectToLocator <login> <playerToken>"),
 		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_ConnectToLocator)
 	);
+
+	void ConsoleCommand_ComponentViewMemoryReport(const TArray<FString>& Args, UWorld* World)
+	{
+		USpatialNetDriver* NetDriver = World != nullptr ? Cast<USpatialNetDriver>(World->GetNetDriver()) : nullptr;
+		if (NetDriver == nullptr || NetDriver->StaticComponentView == nullptr)
+		{
+			UE_LOG(LogSpatialGDKConsoleCommands, Log, TEXT("ConsoleCommand_ComponentViewMemoryReport requires a world with a SpatialNetDriver."));
+			return;
+		}
+
+		NetDriver->StaticComponentView->LogMemoryReport();
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs ComponentViewMemoryReportCommand = FAutoConsoleCommandWithWorldAndArgs(
+		TEXT("SpatialComponentViewMemoryReport"),
+		TEXT("Usage: SpatialComponentViewMemoryReport. Logs the number of components and bytes per component type in the static component view."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_ComponentViewMemoryReport)
+	);
+
+	void ConsoleCommand_MemoryReport(const TArray<FString>& Args, UWorld* World)
+	{
+		USpatialNetDriver* NetDriver = World != nullptr ? Cast<USpatialNetDriver>(World->GetNetDriver()) : nullptr;
+		if (NetDriver == nullptr)
+		{
+			UE_LOG(LogSpatialGDKConsoleCommands, Log, TEXT("ConsoleCommand_MemoryReport requires a world with a SpatialNetDriver."));
+			return;
+		}
+
+		NetDriver->SampleMemoryUsage();
+		NetDriver->MemoryAccounting.LogReport();
+
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			NetDriver->MemoryAccounting.ResetPeaks();
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs MemoryReportCommand = FAutoConsoleCommandWithWorldAndArgs(
+		TEXT("SpatialMemoryReport"),
+		TEXT("Usage: SpatialMemoryReport [reset]. Logs the current and peak bytes held by each GDK subsystem, optionally resetting the peaks afterwards."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_MemoryReport)
+	);
 }
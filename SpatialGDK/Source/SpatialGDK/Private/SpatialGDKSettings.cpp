@@ -60,11 +60,21 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, EntityPoolInitialReservationCount(3000)
 	, EntityPoolRefreshThreshold(1000)
 	, EntityPoolRefreshCount(2000)
+	, bAdaptiveEntityPool(false)
+	, EntityPoolMaxRefreshCount(20000)
+	, EntityPoolMaxReservationsInFlight(2)
 	, HeartbeatIntervalSeconds(2.0f)
 	, HeartbeatTimeoutSeconds(10.0f)
 	, HeartbeatTimeoutWithEditorSeconds(10000.0f)
+	, ClientInterestBandwidthBudgetBytesPerSecond(0.0f)
+	, MinClientInterestFrequencyScale(0.25f)
 	, ActorReplicationRateLimit(0)
 	, EntityCreationRateLimit(0)
+	, MaxCreateEntityRequestsInFlight(0)
+	, EntityCreationTargetLatencySeconds(1.0f)
+	, ReplicationTimeBudgetMs(0.f)
+	, ReplicationByteBudget(0)
+	, ReplicationStarvationThresholdSeconds(1.f)
 	, bUseIsActorRelevantForConnection(false)
 	, OpsUpdateRate(1000.0f)
 	, bEnableHandover(false)
@@ -73,18 +83,131 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, QueuedOutgoingRPCRetryTime(1.0f)
 	, PositionUpdateFrequency(1.0f)
 	, PositionDistanceThreshold(100.0f) // 1m (100cm)
+	, bAdaptivePositionUpdateFrequency(false)
+	, MinAdaptivePositionUpdateFrequency(0.2f)
+	, AdaptivePositionUpdateFullRateSpeed(600.0f)
+	, AdaptivePositionUpdateObserverDistance(0.0f) // Default disabled
 	, bEnableMetrics(true)
 	, bEnableMetricsDisplay(false)
 	, MetricsReportRate(2.0f)
 	, bUseFrameTimeAsLoad(false)
+	, bReportWorkerLoadVector(false)
+	, WorkerLoadAuthoritativeEntityBudget(0.0f)
+	, WorkerLoadOutgoingBytesPerSecondBudget(0.0f)
+	, WorkerLoadIncomingOpsPerSecondBudget(0.0f)
+	, WorkerLoadMemoryBudgetMB(0.0f)
+	, PrometheusMetricsPort(0)
+	, LatencyTraceSampleRate(1.0f)
+	, MemoryAccountingSampleIntervalSeconds(0.0f)
+	, bEnableHitchCapture(false)
+	, HitchCaptureThresholdMs(100.0f)
+	, HitchCaptureFrameCount(120)
+	, HitchCaptureMinSecondsBetweenReports(30.0f)
+	, bEnableHotEntityTracking(false)
+	, HotEntityWindowSeconds(5.0f)
+	, HotEntityUpdateRateThreshold(100.0f)
+	, HotEntityRPCRateThreshold(60.0f)
+	, bThrottleHotEntities(false)
+	, HotEntityThrottledNetUpdateFrequency(5.0f)
+	, HotEntityThrottleSeconds(10.0f)
 	, bBatchSpatialPositionUpdates(false)
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, ServicesRegion(EServicesRegion::Default)
 	, WorkerLogLevel(ESettingsWorkerLogVerbosity::Warning)
 	, bRunSpatialWorkerConnectionOnGameThread(false)
+	, bUseOpListArena(false)
+	, bUseOutgoingMessageRing(false)
+	, OutgoingMessageRingCapacity(16384)
+	, bCoalesceOutgoingComponentUpdates(false)
+	, bUseOutgoingMessagePriorityLanes(false)
+	, MaxBulkOutgoingMessagesPerFlush(0)
+	, bUseFlatStaticComponentView(false)
+	, bParallelCompareProperties(false)
+	, bSkipUnchangedInterestUpdates(false)
+	, bCacheSerializedInterestQueries(false)
+	, bCacheAlwaysInterestedConstraints(false)
+	, bBatchSubobjectComponentUpdates(false)
+	, bBatchEvaluateAuthority(false)
+	, bPackUnreliableRPCs(false)
+	, bUseAdaptiveRPCRingBufferSizes(false)
+	, bBatchMulticastRPCs(false)
+	, bPrefetchComponentFieldIds(false)
+	, bEnablePushModelReplication(false)
+	, bLazyHandoverShadowData(false)
+	, bCompressHandoverBytesFields(false)
+	, bTimeSliceActorSpawning(false)
+	, bEnableActorPooling(false)
+	, bUseCompactSchemaDatabase(false)
+	, bPrewarmClassInfo(false)
+	, bBatchAsyncClassLoads(false)
+	, bCacheEntityComponentTemplates(false)
+	, bAdaptiveEntityCreationLimit(false)
+	, bSplitWorkerConnectionThreads(false)
+	, bBlockOnWorkerOpList(false)
+	, bPredecodeOpsOnConnectionThread(false)
+	, bPreStageAuthorityHandover(false)
+	, bAggregateServerHeartbeats(false)
+	, bAsyncLogForwarding(false)
+	, MaxQueuedLogLines(4096)
+	, MaxForwardedLogLinesPerSecond(200)
+	, MaxLogLinesPerBatch(32)
+	, bBatchCrossServerRPCs(false)
+	, MaxCrossServerRPCsPerBatch(32)
+	, bUseRingBufferCrossServerRPCs(false)
+	, ReliableRPCRetryJitter(0.2f)
+	, MaxReliableRPCRetriesInFlight(1000)
+	, bSkipUnchangedFastArrays(false)
+	, bDropUnchangedPropertyWrites(false)
+	, bOverlapStartupPhases(false)
+	, bKeepClientConnectionAcrossTravel(false)
+	, bQueuePlayerSpawnRequests(false)
+	, bCacheDevelopmentAuthTokens(false)
+	, bBatchDynamicSubobjectAttachment(false)
+	, bCompactStartupActorTombstones(false)
+	, bCacheActorInterestComponentQueries(false)
+	, bUseActorReplicationSchedule(false)
+	, bThrottleUnobservedActors(false)
+	, UnobservedActorTickInterval(1.0f)
+	, bSkipReplicationOfUnobservedActors(false)
+	, UnobservedActorWakeUpMargin(2000.0f)
+	, ClientObservationUpdateIntervalSeconds(1.0f)
+	, bUseEndpointPings(false)
+	, bUseCompactReplicatedMovement(false)
+	, bTimeSliceOpProcessing(false)
+	, bEnableServerWorkerFailover(false)
+	, bEnableClientFastRejoin(false)
+	, bOptimizeInterestQueries(false)
+	, bParallelizeStartupActorRoleAssignment(false)
+	, MaxWorldWipeDeleteRequestsInFlight(1000)
+	, bPreloadServerTravelMap(false)
+	, SnapshotLoadBatchSize(1000)
+	, MaxSnapshotCreateEntityRequestsInFlight(10000)
+	, bEnableRuntimeCheckpoints(false)
+	, RuntimeCheckpointIntervalSeconds(60.0f)
+	, RuntimeCheckpointChunkSize(1000)
+	, RuntimeCheckpointMaxEntitiesPerSecond(2000.0f)
+	, WorkerOpListTimeoutMs(1)
+	, MaxPooledActorsPerClass(32)
+	, MaxActorsSpawnedPerTick(100)
+	, MaxPlayerSpawnsPerTick(10)
+	, OpProcessingTimeBudgetMs(4.0f)
+	, MaxOpsProcessedPerTick(0)
+	, ServerWorkerHeartbeatTimeout(5.0f)
+	, ClientRejoinGracePeriod(8.0f)
+	, MinCompressedBytesFieldSize(256)
+	, HandoverShadowDataBoundaryDistance(2000.0f)
+	, AuthorityPreStageDistance(2000.0f)
+	, AuthorityMigrationBackoffTime(1.0f)
+	, MaxAuthorityMigrationBackoffMultiplier(1)
+	, ClassInfoPrewarmTimeBudgetMs(2.0f)
 	, bUseRPCRingBuffers(true)
 	, DefaultRPCRingBufferSize(32)
 	, MaxRPCRingBufferSize(32)
+	, bQueueOverflowedUnreliableRPCs(false)
+	, MaxOverflowedUnreliableRPCsPerEntity(16)
+	, UnreliableRPCOverflowDropPolicy(EOverflowedRPCDropPolicy::DropOldest)
+	, DefaultUnreliableRPCTimeToLive(0.0f)
+	, RPCAckDelaySeconds(0.0f)
 	// TODO - UNR 2514 - These defaults are not necessarily optimal - readdress when we have better data
 	, bTcpNoDelay(false)
 	, UdpServerDownstreamUpdateIntervalMS(1)
@@ -96,11 +219,13 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableNetCullDistanceInterest(true)
 	, bEnableNetCullDistanceFrequency(false)
 	, FullFrequencyNetCullDistanceRatio(1.0f)
+	, ClientLevelInterestActivationIntervalSeconds(0.0f)
 	, bUseSecureClientConnection(false)
 	, bUseSecureServerConnection(false)
 	, bEnableClientQueriesOnServer(false)
 	, bUseSpatialView(false)
 	, bEnableMultiWorkerDebuggingWarnings(false)
+	, MaxAclAssignmentsPerTick(0)
 {
 	DefaultReceptionistHost = SpatialConstants::LOCAL_HOST;
 }
@@ -116,6 +241,51 @@ void USpatialGDKSettings::PostInitProperties()
 	CheckCmdLineOverrideBool(CommandLine, TEXT("EnableMultiWorkerDebuggingWarnings"), TEXT("Multi-Worker Debugging Warnings"), bEnableMultiWorkerDebuggingWarnings);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideRPCRingBuffers"), TEXT("RPC ring buffers"), bUseRPCRingBuffers);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideSpatialWorkerConnectionOnGameThread"), TEXT("Spatial worker connection on game thread"), bRunSpatialWorkerConnectionOnGameThread);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideOpListArena"), TEXT("Op list arena"), bUseOpListArena);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideOutgoingMessageRing"), TEXT("Outgoing message ring"), bUseOutgoingMessageRing);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCoalesceOutgoingComponentUpdates"), TEXT("Coalesce outgoing component updates"), bCoalesceOutgoingComponentUpdates);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideFlatStaticComponentView"), TEXT("Flat static component view"), bUseFlatStaticComponentView);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideParallelCompareProperties"), TEXT("Parallel compare properties"), bParallelCompareProperties);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideSkipUnchangedInterestUpdates"), TEXT("Skip unchanged interest updates"), bSkipUnchangedInterestUpdates);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCacheSerializedInterestQueries"), TEXT("Cache serialized interest queries"), bCacheSerializedInterestQueries);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchEvaluateAuthority"), TEXT("Batch evaluate authority"), bBatchEvaluateAuthority);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverridePackUnreliableRPCs"), TEXT("Pack unreliable RPCs"), bPackUnreliableRPCs);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideAdaptiveRPCRingBufferSizes"), TEXT("Adaptive RPC ring buffer sizes"), bUseAdaptiveRPCRingBufferSizes);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchMulticastRPCs"), TEXT("Batch multicast RPCs"), bBatchMulticastRPCs);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverridePrefetchComponentFieldIds"), TEXT("Prefetch component field IDs"), bPrefetchComponentFieldIds);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideEnablePushModelReplication"), TEXT("Push model replication"), bEnablePushModelReplication);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideLazyHandoverShadowData"), TEXT("Lazy handover shadow data"), bLazyHandoverShadowData);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideTimeSliceActorSpawning"), TEXT("Time slice actor spawning"), bTimeSliceActorSpawning);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideEnableActorPooling"), TEXT("Actor pooling"), bEnableActorPooling);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideUseCompactSchemaDatabase"), TEXT("Use compact schema database"), bUseCompactSchemaDatabase);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverridePrewarmClassInfo"), TEXT("Prewarm class info"), bPrewarmClassInfo);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchAsyncClassLoads"), TEXT("Batch async class loads"), bBatchAsyncClassLoads);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCacheEntityComponentTemplates"), TEXT("Cache entity component templates"), bCacheEntityComponentTemplates);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideAdaptiveEntityCreationLimit"), TEXT("Adaptive entity creation limit"), bAdaptiveEntityCreationLimit);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideSplitWorkerConnectionThreads"), TEXT("Split worker connection threads"), bSplitWorkerConnectionThreads);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBlockOnWorkerOpList"), TEXT("Block on worker op list"), bBlockOnWorkerOpList);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverridePredecodeOpsOnConnectionThread"), TEXT("Predecode ops on connection thread"), bPredecodeOpsOnConnectionThread);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverridePreStageAuthorityHandover"), TEXT("Pre-stage authority handover"), bPreStageAuthorityHandover);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideAggregateServerHeartbeats"), TEXT("Aggregate server heartbeats"), bAggregateServerHeartbeats);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideAsyncLogForwarding"), TEXT("Async log forwarding"), bAsyncLogForwarding);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchCrossServerRPCs"), TEXT("Batch cross-server RPCs"), bBatchCrossServerRPCs);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideRingBufferCrossServerRPCs"), TEXT("Ring buffer cross-server RPCs"), bUseRingBufferCrossServerRPCs);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideSkipUnchangedFastArrays"), TEXT("Skip unchanged fast arrays"), bSkipUnchangedFastArrays);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideDropUnchangedPropertyWrites"), TEXT("Drop unchanged property writes"), bDropUnchangedPropertyWrites);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideOverlapStartupPhases"), TEXT("Overlap startup phases"), bOverlapStartupPhases);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideQueuePlayerSpawnRequests"), TEXT("Queue player spawn requests"), bQueuePlayerSpawnRequests);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCacheDevelopmentAuthTokens"), TEXT("Cache development auth tokens"), bCacheDevelopmentAuthTokens);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchDynamicSubobjectAttachment"), TEXT("Batch dynamic subobject attachment"), bBatchDynamicSubobjectAttachment);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCompactStartupActorTombstones"), TEXT("Compact startup actor tombstones"), bCompactStartupActorTombstones);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCacheActorInterestComponentQueries"), TEXT("Cache actor interest component queries"), bCacheActorInterestComponentQueries);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideUseActorReplicationSchedule"), TEXT("Use actor replication schedule"), bUseActorReplicationSchedule);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideUseEndpointPings"), TEXT("Use endpoint pings"), bUseEndpointPings);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideTimeSliceOpProcessing"), TEXT("Time slice op processing"), bTimeSliceOpProcessing);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideEnableServerWorkerFailover"), TEXT("Enable server worker failover"), bEnableServerWorkerFailover);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideEnableClientFastRejoin"), TEXT("Enable client fast rejoin"), bEnableClientFastRejoin);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideOptimizeInterestQueries"), TEXT("Optimize interest queries"), bOptimizeInterestQueries);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideParallelizeStartupActorRoleAssignment"), TEXT("Parallelize startup actor role assignment"), bParallelizeStartupActorRoleAssignment);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideAdaptiveEntityPool"), TEXT("Adaptive entity pool"), bAdaptiveEntityPool);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideNetCullDistanceInterest"), TEXT("Net cull distance interest"), bEnableNetCullDistanceInterest);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideNetCullDistanceInterestFrequency"), TEXT("Net cull distance interest frequency"), bEnableNetCullDistanceFrequency);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideActorRelevantForConnection"), TEXT("Actor relevant for connection"), bUseIsActorRelevantForConnection);
@@ -202,6 +372,105 @@ uint32 USpatialGDKSettings::GetRPCRingBufferSize(ERPCType RPCType) const
 	return DefaultRPCRingBufferSize;
 }
 
+float USpatialGDKSettings::GetUnreliableRPCTimeToLive(ERPCType RPCType) const
+{
+	if (RPCType != ERPCType::ClientUnreliable && RPCType != ERPCType::ServerUnreliable && RPCType != ERPCType::NetMulticast)
+	{
+		return 0.0f;
+	}
+
+	if (const float* TimeToLive = UnreliableRPCTimeToLiveMap.Find(RPCType))
+	{
+		return *TimeToLive;
+	}
+
+	return DefaultUnreliableRPCTimeToLive;
+}
+
+const FSpatialNetworkTransportProfile* FSpatialNetworkTransportProfile::FindBuiltInProfile(FName ProfileName)
+{
+	static const TMap<FName, FSpatialNetworkTransportProfile> BuiltInProfiles = []
+	{
+		TMap<FName, FSpatialNetworkTransportProfile> Profiles;
+
+		// Flush as soon as possible both ways and rebuild lost packets instead of waiting for resends. Compression is skipped to save the time it takes.
+		FSpatialNetworkTransportProfile& LowLatency = Profiles.Add(TEXT("LowLatency"));
+		LowLatency.KcpUpstreamFlushIntervalMillis = 1;
+		LowLatency.KcpDownstreamFlushIntervalMillis = 1;
+		LowLatency.bKcpNonConcessionalFlowControl = true;
+		LowLatency.KcpMultiplexLevel = 32;
+		LowLatency.KcpMinRtoMillis = 10;
+		LowLatency.ErasureCodecOriginalPacketCount = 10;
+		LowLatency.ErasureCodecRecoveryPacketCount = 2;
+		LowLatency.ErasureCodecWindowSize = 16;
+		LowLatency.bCompressDownstream = false;
+		LowLatency.bTcpNoDelay = true;
+
+		// Batch more per flush, compress both ways and allow more bytes in flight.
+		FSpatialNetworkTransportProfile& HighThroughput = Profiles.Add(TEXT("HighThroughput"));
+		HighThroughput.KcpUpstreamFlushIntervalMillis = 10;
+		HighThroughput.KcpDownstreamFlushIntervalMillis = 5;
+		HighThroughput.KcpMultiplexLevel = 32;
+		HighThroughput.bCompressUpstream = true;
+		HighThroughput.TcpMultiplexLevel = 4;
+		HighThroughput.DownstreamWindowSizeBytes = 4 * 1024 * 1024;
+		HighThroughput.UpstreamWindowSizeBytes = 4 * 1024 * 1024;
+
+		// Rebuild packets lost on the radio link, back off resends and tolerate the connection going quiet for a while.
+		FSpatialNetworkTransportProfile& Mobile = Profiles.Add(TEXT("Mobile"));
+		Mobile.KcpUpstreamFlushIntervalMillis = 20;
+		Mobile.KcpDownstreamFlushIntervalMillis = 10;
+		Mobile.KcpMinRtoMillis = 50;
+		Mobile.ErasureCodecOriginalPacketCount = 4;
+		Mobile.ErasureCodecRecoveryPacketCount = 2;
+		Mobile.ErasureCodecWindowSize = 16;
+		Mobile.bCompressUpstream = true;
+		Mobile.HeartbeatIntervalMillis = 5000;
+		Mobile.HeartbeatTimeoutMillis = 30000;
+
+		return Profiles;
+	}();
+
+	return BuiltInProfiles.Find(ProfileName);
+}
+
+const FSpatialNetworkTransportProfile* USpatialGDKSettings::GetNetworkTransportProfile(const FString& WorkerType, FName& OutProfileName) const
+{
+	FString CommandLineProfile;
+	if (FParse::Value(FCommandLine::Get(), TEXT("networkTransportProfile="), CommandLineProfile))
+	{
+		OutProfileName = FName(*CommandLineProfile);
+	}
+	else if (const FName* WorkerTypeProfile = WorkerTypeNetworkTransportProfiles.Find(FName(*WorkerType)))
+	{
+		OutProfileName = *WorkerTypeProfile;
+	}
+	else
+	{
+		return nullptr;
+	}
+
+	if (const FSpatialNetworkTransportProfile* Profile = NetworkTransportProfiles.Find(OutProfileName))
+	{
+		return Profile;
+	}
+
+	if (const FSpatialNetworkTransportProfile* Profile = FSpatialNetworkTransportProfile::FindBuiltInProfile(OutProfileName))
+	{
+		return Profile;
+	}
+
+	UE_LOG(LogSpatialGDKSettings, Warning, TEXT("Unknown network transport profile %s for worker type %s, using the individual network settings."), *OutProfileName.ToString(), *WorkerType);
+	return nullptr;
+}
+
+const FSpatialThreadPolicy& USpatialGDKSettings::GetThreadPolicy(FName ThreadName) const
+{
+	static const FSpatialThreadPolicy DefaultPolicy;
+
+	const FSpatialThreadPolicy* Policy = ThreadPolicies.Find(ThreadName);
+	return Policy != nullptr ? *Policy : DefaultPolicy;
+}
 
 bool USpatialGDKSettings::UseRPCRingBuffer() const
 {
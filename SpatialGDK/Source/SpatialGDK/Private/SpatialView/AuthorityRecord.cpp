@@ -36,9 +36,9 @@ void AuthorityRecord::SetAuthority(Worker_EntityId EntityId, Worker_ComponentId
 
 void AuthorityRecord::Clear()
 {
-	AuthorityGained.Empty();
-	AuthorityLost.Empty();
-	AuthorityLossTemporary.Empty();
+	AuthorityGainedHighWaterMark.Reset(AuthorityGained);
+	AuthorityLostHighWaterMark.Reset(AuthorityLost);
+	AuthorityLossTemporaryHighWaterMark.Reset(AuthorityLossTemporary);
 }
 
 const TArray<EntityComponentId>& AuthorityRecord::GetAuthorityGained() const
@@ -0,0 +1,72 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SpatialView/CallbackDispatcher.h"
+
+namespace SpatialGDK
+{
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnComponentAdded(Worker_ComponentId ComponentId, Callback<EntityComponentData> InCallback)
+{
+	ComponentAddedCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnComponentRemoved(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback)
+{
+	ComponentRemovedCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnComponentUpdate(Worker_ComponentId ComponentId, Callback<EntityComponentUpdate> InCallback)
+{
+	ComponentUpdateCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnComponentCompleteUpdate(Worker_ComponentId ComponentId, Callback<EntityComponentCompleteUpdate> InCallback)
+{
+	ComponentCompleteUpdateCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnAuthorityGained(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback)
+{
+	AuthorityGainedCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnAuthorityLost(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback)
+{
+	AuthorityLostCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+CallbackDispatcher::CallbackId CallbackDispatcher::OnAuthorityLostTemporarily(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback)
+{
+	AuthorityLostTemporarilyCallbacks.Add(ComponentId, NextCallbackId, MoveTemp(InCallback));
+	return NextCallbackId++;
+}
+
+bool CallbackDispatcher::RemoveCallback(CallbackId Id)
+{
+	return ComponentAddedCallbacks.Remove(Id)
+		|| ComponentRemovedCallbacks.Remove(Id)
+		|| ComponentUpdateCallbacks.Remove(Id)
+		|| ComponentCompleteUpdateCallbacks.Remove(Id)
+		|| AuthorityGainedCallbacks.Remove(Id)
+		|| AuthorityLostCallbacks.Remove(Id)
+		|| AuthorityLostTemporarilyCallbacks.Remove(Id);
+}
+
+void CallbackDispatcher::InvokeCallbacks(const ViewDelta& Delta)
+{
+	ComponentAddedCallbacks.Invoke(Delta.GetComponentsAdded());
+	ComponentCompleteUpdateCallbacks.Invoke(Delta.GetCompleteUpdates());
+	ComponentUpdateCallbacks.Invoke(Delta.GetUpdates());
+	AuthorityGainedCallbacks.Invoke(Delta.GetAuthorityGained());
+	AuthorityLostTemporarilyCallbacks.Invoke(Delta.GetAuthorityLostTemporarily());
+	AuthorityLostCallbacks.Invoke(Delta.GetAuthorityLost());
+	ComponentRemovedCallbacks.Invoke(Delta.GetComponentsRemoved());
+}
+
+}  // namespace SpatialGDK
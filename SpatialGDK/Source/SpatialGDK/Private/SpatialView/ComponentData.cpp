@@ -8,7 +8,7 @@ namespace SpatialGDK
 
 void ComponentDataDeleter::operator()(Schema_ComponentData* ComponentData) const noexcept
 {
-	if (ComponentData == nullptr)
+	if (ComponentData == nullptr || !bOwning)
 	{
 		return;
 	}
@@ -38,11 +38,22 @@ ComponentData ComponentData::DeepCopy() const
 	return CreateCopy(Data.Get(), ComponentId);
 }
 
+ComponentData ComponentData::CreateView(Schema_ComponentData* Data, Worker_ComponentId Id)
+{
+	return ComponentData(OwningComponentDataPtr(Data, ComponentDataDeleter{ false }), Id);
+}
+
 Schema_ComponentData* ComponentData::Release() &&
 {
+	check(IsOwning());
 	return Data.Release();
 }
 
+bool ComponentData::IsOwning() const
+{
+	return Data.GetDeleter().bOwning;
+}
+
 bool ComponentData::ApplyUpdate(const ComponentUpdate& Update)
 {
 	check(Update.GetComponentId() == GetComponentId());
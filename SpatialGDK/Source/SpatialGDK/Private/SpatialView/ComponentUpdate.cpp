@@ -7,7 +7,7 @@ namespace SpatialGDK
 
 void ComponentUpdateDeleter::operator()(Schema_ComponentUpdate* ComponentUpdate) const noexcept
 {
-	if (ComponentUpdate == nullptr)
+	if (ComponentUpdate == nullptr || !bOwning)
 	{
 		return;
 	}
@@ -36,11 +36,22 @@ ComponentUpdate ComponentUpdate::DeepCopy() const
 	return CreateCopy(Update.Get(), ComponentId);
 }
 
+ComponentUpdate ComponentUpdate::CreateView(Schema_ComponentUpdate* Update, Worker_ComponentId Id)
+{
+	return ComponentUpdate(OwningComponentUpdatePtr(Update, ComponentUpdateDeleter{ false }), Id);
+}
+
 Schema_ComponentUpdate* ComponentUpdate::Release() &&
 {
+	check(IsOwning());
 	return Update.Release();
 }
 
+bool ComponentUpdate::IsOwning() const
+{
+	return Update.GetDeleter().bOwning;
+}
+
 bool ComponentUpdate::Merge(ComponentUpdate Other)
 {
 	check(Other.GetComponentId() == GetComponentId());
@@ -11,38 +11,33 @@ void EntityComponentRecord::AddComponent(Worker_EntityId EntityId, ComponentData
 
 	// If the component is recorded as removed then transition to complete-updated.
 	// otherwise record it as added.
-	if (ComponentsRemoved.RemoveSingleSwap(Id))
+	if (ComponentsRemoved.Remove(Id))
 	{
 		UpdateRecord.AddComponentDataAsUpdate(EntityId, MoveTemp(Data));
 	}
 	else
 	{
-		ComponentsAdded.Push(EntityComponentData{ EntityId, MoveTemp(Data) });
+		ComponentsAdded.Add(EntityComponentData{ EntityId, MoveTemp(Data) });
 	}
 }
 
 void EntityComponentRecord::RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
 	const EntityComponentId Id = { EntityId, ComponentId };
-	const EntityComponentData* FoundComponentAdded = ComponentsAdded.FindByPredicate(EntityComponentIdEquality{ Id });
 
 	// If the component is recorded as added then erase the record.
 	// Otherwise record it as removed (additionally making sure it isn't recorded as updated).
-	if (FoundComponentAdded)
-	{
-		ComponentsAdded.RemoveAtSwap(FoundComponentAdded - ComponentsAdded.GetData());
-	}
-	else
+	if (!ComponentsAdded.Remove(Id))
 	{
 		UpdateRecord.RemoveComponent(EntityId, ComponentId);
-		ComponentsRemoved.Push(Id);
+		ComponentsRemoved.Add(Id);
 	}
 }
 
 void EntityComponentRecord::AddComponentAsUpdate(Worker_EntityId EntityId, ComponentData Data)
 {
 	const EntityComponentId Id = { EntityId, Data.GetComponentId() };
-	EntityComponentData* FoundComponentAdded = ComponentsAdded.FindByPredicate(EntityComponentIdEquality{ Id });
+	EntityComponentData* FoundComponentAdded = ComponentsAdded.Find(Id);
 
 	// If the entity-component is recorded is added, then merge the update to the added component.
 	// Otherwise handle it as an update.
@@ -59,7 +54,7 @@ void EntityComponentRecord::AddComponentAsUpdate(Worker_EntityId EntityId, Compo
 void EntityComponentRecord::AddUpdate(Worker_EntityId EntityId, ComponentUpdate Update)
 {
 	const EntityComponentId Id = { EntityId, Update.GetComponentId() };
-	EntityComponentData* FoundComponentAdded = ComponentsAdded.FindByPredicate(EntityComponentIdEquality{ Id });
+	EntityComponentData* FoundComponentAdded = ComponentsAdded.Find(Id);
 
 	// If the entity-component is recorded is added, then merge the update to the added component.
 	// Otherwise handle it as an update.
@@ -75,19 +70,19 @@ void EntityComponentRecord::AddUpdate(Worker_EntityId EntityId, ComponentUpdate
 
 void EntityComponentRecord::Clear()
 {
-	ComponentsAdded.Empty();
-	ComponentsRemoved.Empty();
+	ComponentsAdded.Reset();
+	ComponentsRemoved.Reset();
 	UpdateRecord.Clear();
 }
 
 const TArray<EntityComponentData>& EntityComponentRecord::GetComponentsAdded() const
 {
-	return ComponentsAdded;
+	return ComponentsAdded.GetElements();
 }
 
 const TArray<EntityComponentId>& EntityComponentRecord::GetComponentsRemoved() const
 {
-	return ComponentsRemoved;
+	return ComponentsRemoved.GetElements();
 }
 
 const TArray<EntityComponentUpdate>& EntityComponentRecord::GetUpdates() const
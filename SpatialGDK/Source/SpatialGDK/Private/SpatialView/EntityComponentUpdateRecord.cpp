@@ -8,12 +8,12 @@ namespace SpatialGDK
 void EntityComponentUpdateRecord::AddComponentDataAsUpdate(Worker_EntityId EntityId, ComponentData CompleteUpdate)
 {
 	const EntityComponentId Id = {EntityId, CompleteUpdate.GetComponentId()};
-	EntityComponentUpdate* FoundUpdate = Updates.FindByPredicate(EntityComponentIdEquality{Id});
+	EntityComponentUpdate* FoundUpdate = Updates.Find(Id);
 
 	if (FoundUpdate)
 	{
-		CompleteUpdates.Emplace(EntityComponentCompleteUpdate{ EntityId, MoveTemp(CompleteUpdate), MoveTemp(FoundUpdate->Update) });
-		Updates.RemoveAtSwap(FoundUpdate - Updates.GetData());
+		CompleteUpdates.Add(EntityComponentCompleteUpdate{ EntityId, MoveTemp(CompleteUpdate), MoveTemp(FoundUpdate->Update) });
+		Updates.Remove(Id);
 	}
 	else
 	{
@@ -24,7 +24,7 @@ void EntityComponentUpdateRecord::AddComponentDataAsUpdate(Worker_EntityId Entit
 void EntityComponentUpdateRecord::AddComponentUpdate(Worker_EntityId EntityId, ComponentUpdate Update)
 {
 	const EntityComponentId Id = {EntityId, Update.GetComponentId()};
-	EntityComponentCompleteUpdate* FoundCompleteUpdate = CompleteUpdates.FindByPredicate(EntityComponentIdEquality{Id});
+	EntityComponentCompleteUpdate* FoundCompleteUpdate = CompleteUpdates.Find(Id);
 
 	if (FoundCompleteUpdate != nullptr)
 	{
@@ -41,42 +41,33 @@ void EntityComponentUpdateRecord::RemoveComponent(Worker_EntityId EntityId, Work
 {
 	const EntityComponentId Id = {EntityId, ComponentId};
 
-	const EntityComponentUpdate* FoundUpdate = Updates.FindByPredicate(EntityComponentIdEquality{Id});
-	if (FoundUpdate)
-	{
-		Updates.RemoveAtSwap(FoundUpdate - Updates.GetData());
-	}
 	// If the entity-component is recorded as updated, it can't also be completely-updated so we don't need to search for it.
-	else
+	if (!Updates.Remove(Id))
 	{
-		const EntityComponentCompleteUpdate* FoundCompleteUpdate = CompleteUpdates.FindByPredicate(EntityComponentIdEquality{Id});
-		if (FoundCompleteUpdate)
-		{
-			CompleteUpdates.RemoveAtSwap(FoundCompleteUpdate - CompleteUpdates.GetData());
-		}
+		CompleteUpdates.Remove(Id);
 	}
 }
 
 void EntityComponentUpdateRecord::Clear()
 {
-	Updates.Empty();
-	CompleteUpdates.Empty();
+	Updates.Reset();
+	CompleteUpdates.Reset();
 }
 
 const TArray<EntityComponentUpdate>& EntityComponentUpdateRecord::GetUpdates() const
 {
-	return Updates;
+	return Updates.GetElements();
 }
 
 const TArray<EntityComponentCompleteUpdate>& EntityComponentUpdateRecord::GetCompleteUpdates() const
 {
-	return CompleteUpdates;
+	return CompleteUpdates.GetElements();
 }
 
 void EntityComponentUpdateRecord::InsertOrMergeUpdate(Worker_EntityId EntityId, ComponentUpdate Update)
 {
 	const EntityComponentId Id = {EntityId, Update.GetComponentId()};
-	EntityComponentUpdate* FoundUpdate = Updates.FindByPredicate(EntityComponentIdEquality{Id});
+	EntityComponentUpdate* FoundUpdate = Updates.Find(Id);
 
 	if (FoundUpdate != nullptr)
 	{
@@ -84,14 +75,14 @@ void EntityComponentUpdateRecord::InsertOrMergeUpdate(Worker_EntityId EntityId,
 	}
 	else
 	{
-		Updates.Emplace(EntityComponentUpdate{ EntityId, MoveTemp(Update) });
+		Updates.Add(EntityComponentUpdate{ EntityId, MoveTemp(Update) });
 	}
 }
 
 void EntityComponentUpdateRecord::InsertOrSetCompleteUpdate(Worker_EntityId EntityId, ComponentData CompleteUpdate)
 {
 	const EntityComponentId Id = {EntityId, CompleteUpdate.GetComponentId()};
-	EntityComponentCompleteUpdate* FoundCompleteUpdate = CompleteUpdates.FindByPredicate(EntityComponentIdEquality{Id});
+	EntityComponentCompleteUpdate* FoundCompleteUpdate = CompleteUpdates.Find(Id);
 
 	if (FoundCompleteUpdate != nullptr)
 	{
@@ -99,7 +90,7 @@ void EntityComponentUpdateRecord::InsertOrSetCompleteUpdate(Worker_EntityId Enti
 	}
 	else
 	{
-		CompleteUpdates.Emplace(EntityComponentCompleteUpdate{ EntityId, MoveTemp(CompleteUpdate), ComponentUpdate(Id.ComponentId) });
+		CompleteUpdates.Add(EntityComponentCompleteUpdate{ EntityId, MoveTemp(CompleteUpdate), ComponentUpdate(Id.ComponentId) });
 	}
 }
 
@@ -0,0 +1,188 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SpatialView/SubView.h"
+
+namespace SpatialGDK
+{
+
+SubView::SubView(Filter InFilter, const EntityComponentMap& InEntityComponents)
+: SubViewFilter(MoveTemp(InFilter))
+, EntityComponents(InEntityComponents)
+{
+	for (const auto& Pair : EntityComponents)
+	{
+		if (MatchesFilter(Pair.Key))
+		{
+			Entities.Add(Pair.Key);
+		}
+	}
+	CompleteEntities = Entities.Array();
+	CompleteEntities.Sort();
+}
+
+void SubView::Advance(const ViewDelta& Delta)
+{
+	EntitiesAdded.Reset();
+	EntitiesRemoved.Reset();
+	EntitiesRemovedSet.Reset();
+
+	if (bReportInitialEntities)
+	{
+		EntitiesAdded = CompleteEntities;
+		bReportInitialEntities = false;
+	}
+
+	TSet<Worker_EntityId> EntitiesToRefresh;
+	for (const EntityComponentData& Added : Delta.GetComponentsAdded())
+	{
+		EntitiesToRefresh.Add(Added.EntityId);
+	}
+	for (const EntityComponentId& Removed : Delta.GetComponentsRemoved())
+	{
+		EntitiesToRefresh.Add(Removed.EntityId);
+	}
+	if (SubViewFilter.Predicate && SubViewFilter.RefreshComponents.Num() > 0)
+	{
+		for (const EntityComponentUpdate& Update : Delta.GetUpdates())
+		{
+			if (SubViewFilter.RefreshComponents.Contains(Update.Update.GetComponentId()))
+			{
+				EntitiesToRefresh.Add(Update.EntityId);
+			}
+		}
+		for (const EntityComponentCompleteUpdate& Update : Delta.GetCompleteUpdates())
+		{
+			if (SubViewFilter.RefreshComponents.Contains(Update.CompleteUpdate.GetComponentId()))
+			{
+				EntitiesToRefresh.Add(Update.EntityId);
+			}
+		}
+	}
+
+	bool bMembershipChanged = false;
+	for (const Worker_EntityId EntityId : EntitiesToRefresh)
+	{
+		bMembershipChanged |= RefreshEntity(EntityId);
+	}
+
+	if (bMembershipChanged)
+	{
+		CompleteEntities = Entities.Array();
+		CompleteEntities.Sort();
+	}
+
+	FilterElements(Delta.GetAuthorityGained(), AuthorityGained);
+	FilterElements(Delta.GetAuthorityLost(), AuthorityLost);
+	FilterElements(Delta.GetAuthorityLostTemporarily(), AuthorityLostTemporarily);
+	FilterElements(Delta.GetComponentsAdded(), ComponentsAdded);
+	FilterElements(Delta.GetComponentsRemoved(), ComponentsRemoved);
+	FilterElements(Delta.GetUpdates(), Updates);
+	FilterElements(Delta.GetCompleteUpdates(), CompleteUpdates);
+}
+
+const TArray<Worker_EntityId>& SubView::GetCompleteEntities() const
+{
+	return CompleteEntities;
+}
+
+const TArray<Worker_EntityId>& SubView::GetEntitiesAdded() const
+{
+	return EntitiesAdded;
+}
+
+const TArray<Worker_EntityId>& SubView::GetEntitiesRemoved() const
+{
+	return EntitiesRemoved;
+}
+
+const TArray<const EntityComponentId*>& SubView::GetAuthorityGained() const
+{
+	return AuthorityGained;
+}
+
+const TArray<const EntityComponentId*>& SubView::GetAuthorityLost() const
+{
+	return AuthorityLost;
+}
+
+const TArray<const EntityComponentId*>& SubView::GetAuthorityLostTemporarily() const
+{
+	return AuthorityLostTemporarily;
+}
+
+const TArray<const EntityComponentData*>& SubView::GetComponentsAdded() const
+{
+	return ComponentsAdded;
+}
+
+const TArray<const EntityComponentId*>& SubView::GetComponentsRemoved() const
+{
+	return ComponentsRemoved;
+}
+
+const TArray<const EntityComponentUpdate*>& SubView::GetUpdates() const
+{
+	return Updates;
+}
+
+const TArray<const EntityComponentCompleteUpdate*>& SubView::GetCompleteUpdates() const
+{
+	return CompleteUpdates;
+}
+
+bool SubView::IsEntityInSubView(Worker_EntityId EntityId) const
+{
+	return Entities.Contains(EntityId);
+}
+
+bool SubView::MatchesFilter(Worker_EntityId EntityId) const
+{
+	const TSet<Worker_ComponentId>* Components = EntityComponents.Find(EntityId);
+	if (Components == nullptr)
+	{
+		return false;
+	}
+
+	for (const Worker_ComponentId ComponentId : SubViewFilter.RequiredComponents)
+	{
+		if (!Components->Contains(ComponentId))
+		{
+			return false;
+		}
+	}
+
+	return !SubViewFilter.Predicate || SubViewFilter.Predicate(EntityId, *Components);
+}
+
+bool SubView::RefreshEntity(Worker_EntityId EntityId)
+{
+	const bool bWasInSubView = Entities.Contains(EntityId);
+	const bool bIsInSubView = MatchesFilter(EntityId);
+
+	if (bIsInSubView && !bWasInSubView)
+	{
+		Entities.Add(EntityId);
+		EntitiesAdded.Add(EntityId);
+		return true;
+	}
+	else if (!bIsInSubView && bWasInSubView)
+	{
+		Entities.Remove(EntityId);
+		// An initial entity which leaves before it has been reported is never seen by the consumer.
+		if (EntitiesAdded.Remove(EntityId) == 0)
+		{
+			EntitiesRemoved.Add(EntityId);
+			EntitiesRemovedSet.Add(EntityId);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool SubView::IsEntityRelevantToDelta(Worker_EntityId EntityId) const
+{
+	return Entities.Contains(EntityId) || EntitiesRemovedSet.Contains(EntityId);
+}
+
+}  // namespace SpatialGDK
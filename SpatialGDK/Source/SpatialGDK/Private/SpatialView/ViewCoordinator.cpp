@@ -20,6 +20,13 @@ void ViewCoordinator::Advance()
 		View.EnqueueOpList(ConnectionHandler->GetNextOpList());
 	}
 	Delta = View.GenerateViewDelta();
+
+	UpdateEntityComponents();
+	for (const TUniquePtr<SubView>& SubViewPtr : SubViews)
+	{
+		SubViewPtr->Advance(*Delta);
+	}
+	Dispatcher.InvokeCallbacks(*Delta);
 }
 
 void ViewCoordinator::FlushMessagesToSend()
@@ -87,4 +94,39 @@ TUniquePtr<AbstractOpList> ViewCoordinator::GenerateLegacyOpList() const
 	return Delta->GenerateLegacyOpList();
 }
 
+SubView& ViewCoordinator::CreateSubView(SubView::Filter Filter)
+{
+	SubViews.Add(MakeUnique<SubView>(MoveTemp(Filter), EntityComponents));
+	return *SubViews.Last();
+}
+
+const EntityComponentMap& ViewCoordinator::GetEntityComponents() const
+{
+	return EntityComponents;
+}
+
+CallbackDispatcher& ViewCoordinator::GetCallbackDispatcher()
+{
+	return Dispatcher;
+}
+
+void ViewCoordinator::UpdateEntityComponents()
+{
+	for (const EntityComponentData& Added : Delta->GetComponentsAdded())
+	{
+		EntityComponents.FindOrAdd(Added.EntityId).Add(Added.Data.GetComponentId());
+	}
+	for (const EntityComponentId& Removed : Delta->GetComponentsRemoved())
+	{
+		if (TSet<Worker_ComponentId>* Components = EntityComponents.Find(Removed.EntityId))
+		{
+			Components->Remove(Removed.ComponentId);
+			if (Components->Num() == 0)
+			{
+				EntityComponents.Remove(Removed.EntityId);
+			}
+		}
+	}
+}
+
 }  // namespace SpatialGDK
@@ -152,8 +152,9 @@ TUniquePtr<AbstractOpList> ViewDelta::GenerateLegacyOpList() const
 
 void ViewDelta::Clear()
 {
-	CreateEntityResponses.Empty();
+	CreateEntityResponsesHighWaterMark.Reset(CreateEntityResponses);
 	AuthorityChanges.Clear();
+	EntityComponentChanges.Clear();
 }
 
 }  // namespace SpatialGDK
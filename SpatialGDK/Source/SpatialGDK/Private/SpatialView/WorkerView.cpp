@@ -13,7 +13,10 @@ WorkerView::WorkerView()
 
 const ViewDelta* WorkerView::GenerateViewDelta()
 {
+	// The previous delta may reference the op lists it was generated from, so they are released after it is cleared.
 	Delta.Clear();
+	OpListsInDelta.Reset();
+
 	for (const auto& OpList : QueuedOps)
 	{
 		const uint32 OpCount = OpList->GetCount();
@@ -23,6 +26,8 @@ const ViewDelta* WorkerView::GenerateViewDelta()
 		}
 	}
 
+	Swap(OpListsInDelta, QueuedOps);
+
 	return &Delta;
 }
 
@@ -126,18 +131,18 @@ void WorkerView::HandleAddComponent(const Worker_AddComponentOp& Component)
 	const EntityComponentId Id = { Component.entity_id, Component.data.component_id };
 	if (AddedComponents.Contains(Id))
 	{
-		Delta.AddComponentAsUpdate(Id.EntityId, ComponentData::CreateCopy(Component.data.schema_type, Id.ComponentId));
+		Delta.AddComponentAsUpdate(Id.EntityId, ComponentData::CreateView(Component.data.schema_type, Id.ComponentId));
 	}
 	else
 	{
 		AddedComponents.Add(Id);
-		Delta.AddComponent(Id.EntityId, ComponentData::CreateCopy(Component.data.schema_type, Id.ComponentId));
+		Delta.AddComponent(Id.EntityId, ComponentData::CreateView(Component.data.schema_type, Id.ComponentId));
 	}
 }
 
 void WorkerView::HandleComponentUpdate(const Worker_ComponentUpdateOp& Update)
 {
-	Delta.AddUpdate(Update.entity_id, ComponentUpdate::CreateCopy(Update.update.schema_type, Update.update.component_id));
+	Delta.AddUpdate(Update.entity_id, ComponentUpdate::CreateView(Update.update.schema_type, Update.update.component_id));
 }
 
 void WorkerView::HandleRemoveComponent(const Worker_RemoveComponentOp& Component)
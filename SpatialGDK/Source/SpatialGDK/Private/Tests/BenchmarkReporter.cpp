@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/BenchmarkReporter.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FBenchmarkReporter::FBenchmarkReporter(FAutomationTestBase& InTest, const FString& InBenchmarkName)
+	: Test(InTest)
+	, BenchmarkName(InBenchmarkName)
+{
+}
+
+FBenchmarkReporter::~FBenchmarkReporter()
+{
+	if (ResultLines.Num() == 0)
+	{
+		return;
+	}
+
+	FString Contents;
+	for (const FString& Line : ResultLines)
+	{
+		Contents += Line;
+		Contents += LINE_TERMINATOR;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Contents, *GetResultsFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		Test.AddWarning(FString::Printf(TEXT("Failed to write benchmark results to %s"), *GetResultsFilePath()));
+	}
+}
+
+void FBenchmarkReporter::Report(const FString& CaseName, int32 EntityCount, int64 OpCount, double Seconds)
+{
+	const double OpsPerSecond = Seconds > 0.0 ? OpCount / Seconds : 0.0;
+
+	Test.AddInfo(FString::Printf(TEXT("%s %d entities: %lld ops in %.3f ms, %.0f ops per second"),
+		*CaseName, EntityCount, OpCount, Seconds * 1000.0, OpsPerSecond));
+
+	ResultLines.Add(FString::Printf(TEXT("{\"benchmark\": \"%s\", \"case\": \"%s\", \"entities\": %d, \"ops\": %lld, \"seconds\": %.9f, \"ops_per_second\": %.3f}"),
+		*BenchmarkName.ReplaceCharWithEscapedChar(), *CaseName.ReplaceCharWithEscapedChar(), EntityCount, OpCount, Seconds, OpsPerSecond));
+}
+
+FString FBenchmarkReporter::GetResultsFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Automation"), TEXT("GDKBenchmarks.jsonl"));
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/BenchmarkReporter.h"
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/RPCRingBuffer.h"
+
+#include "HAL/PlatformTime.h"
+
+#define RPCRINGBUFFER_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, RPCRingBuffer, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const ERPCType BENCHMARK_RPC_TYPE = ERPCType::ServerReliable;
+	const int32 BENCHMARK_PAYLOAD_SIZE = 64;
+	const int32 BENCHMARK_ENTITY_COUNTS[] = { 1000, 10000, 100000 };
+
+	RPCPayload CreateBenchmarkPayload(uint32 Index)
+	{
+		TArray<uint8> Data;
+		Data.SetNumZeroed(BENCHMARK_PAYLOAD_SIZE);
+		return RPCPayload(0, Index, MoveTemp(Data));
+	}
+} // anonymous namespace
+
+RPCRINGBUFFER_BENCHMARK(GIVEN_one_RPC_per_entity_for_1k_10k_and_100k_entities_WHEN_written_and_read_THEN_throughput_is_reported)
+{
+	FBenchmarkReporter Reporter(*this, TEXT("RPCRingBuffer"));
+	const RPCPayload Payload = CreateBenchmarkPayload(1);
+
+	for (const int32 EntityCount : BENCHMARK_ENTITY_COUNTS)
+	{
+		TArray<Schema_ComponentUpdate*> Updates;
+		Updates.Reserve(EntityCount);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+			RPCRingBufferUtils::WriteRPCToSchema(Schema_GetComponentUpdateFields(Update), BENCHMARK_RPC_TYPE, 1, Payload);
+			Updates.Push(Update);
+		}
+		Reporter.Report(TEXT("WriteRPCToSchema"), EntityCount, EntityCount, FPlatformTime::Seconds() - StartTime);
+
+		int32 RPCsRead = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (Schema_ComponentUpdate* Update : Updates)
+		{
+			RPCRingBuffer Buffer(BENCHMARK_RPC_TYPE);
+			RPCRingBufferUtils::ReadBufferFromSchema(Schema_GetComponentUpdateFields(Update), Buffer);
+			RPCsRead += Buffer.GetRingBufferElement(1).IsSet() ? 1 : 0;
+		}
+		Reporter.Report(TEXT("ReadBufferFromSchema"), EntityCount, EntityCount, FPlatformTime::Seconds() - StartTime);
+		TestEqual(TEXT("Every written RPC is read back"), RPCsRead, EntityCount);
+
+		for (Schema_ComponentUpdate* Update : Updates)
+		{
+			Schema_DestroyComponentUpdate(Update);
+		}
+	}
+
+	return true;
+}
+
+RPCRINGBUFFER_BENCHMARK(GIVEN_1k_10k_and_100k_RPCs_WHEN_packed_and_unpacked_THEN_throughput_is_reported)
+{
+	FBenchmarkReporter Reporter(*this, TEXT("RPCRingBuffer"));
+
+	for (const int32 RPCCount : BENCHMARK_ENTITY_COUNTS)
+	{
+		TArray<RPCPayload> Payloads;
+		Payloads.Reserve(RPCCount);
+		for (int32 i = 0; i < RPCCount; ++i)
+		{
+			Payloads.Push(CreateBenchmarkPayload(i));
+		}
+
+		TArray<uint8> PackedRPCs;
+		double StartTime = FPlatformTime::Seconds();
+		for (const RPCPayload& Payload : Payloads)
+		{
+			RPCRingBufferUtils::AppendPackedRPC(PackedRPCs, Payload);
+		}
+		Reporter.Report(TEXT("AppendPackedRPC"), RPCCount, RPCCount, FPlatformTime::Seconds() - StartTime);
+
+		TArray<RPCPayload> UnpackedPayloads;
+		StartTime = FPlatformTime::Seconds();
+		RPCRingBufferUtils::ReadPackedRPCs(PackedRPCs, UnpackedPayloads);
+		Reporter.Report(TEXT("ReadPackedRPCs"), RPCCount, RPCCount, FPlatformTime::Seconds() - StartTime);
+		TestEqual(TEXT("Every packed RPC is unpacked"), UnpackedPayloads.Num(), RPCCount);
+	}
+
+	return true;
+}
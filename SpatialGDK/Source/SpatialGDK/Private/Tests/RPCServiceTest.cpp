@@ -297,6 +297,42 @@ RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_overflow_client_
 	return true;
 }
 
+RPC_SERVICE_TEST(GIVEN_queueing_overflowed_unreliable_rpcs_WHEN_push_past_the_queue_limit_THEN_oldest_rpcs_are_dropped_and_counted)
+{
+	USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+	const bool bOldQueueOverflowedUnreliableRPCs = SpatialGDKSettings->bQueueOverflowedUnreliableRPCs;
+	const uint32 OldMaxOverflowedUnreliableRPCsPerEntity = SpatialGDKSettings->MaxOverflowedUnreliableRPCsPerEntity;
+	const EOverflowedRPCDropPolicy::Type OldDropPolicy = SpatialGDKSettings->UnreliableRPCOverflowDropPolicy;
+	SpatialGDKSettings->bQueueOverflowedUnreliableRPCs = true;
+	SpatialGDKSettings->MaxOverflowedUnreliableRPCsPerEntity = 2;
+	SpatialGDKSettings->UnreliableRPCOverflowDropPolicy = EOverflowedRPCDropPolicy::DropOldest;
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH);
+
+	// Fill the ring buffer, then push three more RPCs into a queue that only fits two.
+	uint32 RPCsToSend = SpatialGDKSettings->GetRPCRingBufferSize(ERPCType::ClientUnreliable);
+	for (uint32 i = 0; i < RPCsToSend; ++i)
+	{
+		RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientUnreliable, SimplePayload, false);
+	}
+
+	bool bAllQueued = true;
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		bAllQueued &= RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientUnreliable, SimplePayload, false) == SpatialGDK::EPushRPCResult::QueueOverflowed;
+	}
+
+	TestTrue("Push RPC returned expected results", bAllQueued);
+	TestTrue("Overflowed queue is bounded", RPCService.GetOverflowedRPCQueueDepth(ERPCType::ClientUnreliable) == 2);
+	TestTrue("Dropped RPC was counted", RPCService.GetDroppedRPCCount(ERPCType::ClientUnreliable) == 1);
+	TestTrue("Reliable RPCs were not affected", RPCService.GetDroppedRPCCount(ERPCType::ClientReliable) == 0);
+
+	SpatialGDKSettings->bQueueOverflowedUnreliableRPCs = bOldQueueOverflowedUnreliableRPCs;
+	SpatialGDKSettings->MaxOverflowedUnreliableRPCsPerEntity = OldMaxOverflowedUnreliableRPCsPerEntity;
+	SpatialGDKSettings->UnreliableRPCOverflowDropPolicy = OldDropPolicy;
+	return true;
+}
+
 RPC_SERVICE_TEST(GIVEN_authority_over_client_endpoint_WHEN_push_overflow_client_reliable_rpcs_to_the_service_THEN_rpc_push_result_queue_overflowed)
 {
 	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, CLIENT_AUTH);
@@ -384,6 +420,33 @@ RPC_SERVICE_TEST(GIVEN_authority_over_client_endpoint_WHEN_push_server_unreliabl
 	return true;
 }
 
+RPC_SERVICE_TEST(GIVEN_rpcs_pushed_for_two_entities_WHEN_getting_the_updates_of_one_entity_THEN_only_its_updates_are_taken)
+{
+	TArray<Worker_EntityId> EntityIdArray;
+	EntityIdArray.Add(RPCTestEntityId_1);
+	EntityIdArray.Add(RPCTestEntityId_2);
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService(EntityIdArray, CLIENT_AUTH);
+	RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ServerUnreliable, SimplePayload, false);
+	RPCService.PushRPC(RPCTestEntityId_2, ERPCType::ServerUnreliable, SimplePayload, false);
+
+	TArray<SpatialGDK::SpatialRPCService::UpdateToSend> EntityUpdates = RPCService.GetRPCsAndAcksToSend(RPCTestEntityId_1);
+	TestEqual("One update is taken for the flushed entity", EntityUpdates.Num(), 1);
+	if (EntityUpdates.Num() == 1)
+	{
+		TestTrue("The update has the flushed entity's payload", CompareUpdateToSendAndEntityPayload(EntityUpdates[0], EntityPayload(RPCTestEntityId_1, SimplePayload), ERPCType::ServerUnreliable, 1));
+	}
+
+	TArray<SpatialGDK::SpatialRPCService::UpdateToSend> RemainingUpdates = RPCService.GetRPCsAndAcksToSend();
+	TestEqual("The other entity's update is left for the next flush", RemainingUpdates.Num(), 1);
+	if (RemainingUpdates.Num() == 1)
+	{
+		TestTrue("The remaining update is for the other entity", RemainingUpdates[0].EntityId == RPCTestEntityId_2);
+	}
+
+	return true;
+}
+
 RPC_SERVICE_TEST(GIVEN_no_authority_over_rpc_endpoint_WHEN_push_client_reliable_rpcs_to_the_service_THEN_component_data_matches_payload)
 {
 	// Create RPCService with empty component view
@@ -496,3 +559,241 @@ RPC_SERVICE_TEST(GIVEN_receiving_an_rpc_WHEN_return_false_from_extract_callback_
 	TestTrue("Returning false in extraction callback correctly stopped processing RPCs", bTestPassed);
 	return true;
 }
+
+RPC_SERVICE_TEST(GIVEN_client_endpoint_with_packed_rpcs_in_view_and_authority_over_server_endpoint_WHEN_extract_rpcs_from_the_service_THEN_extracted_payloads_match_packed_payloads)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+
+	const SpatialGDK::RPCPayload OtherPayload = SpatialGDK::RPCPayload(2, 3, TArray<uint8>({ 4, 5, 6 }, 3));
+
+	TArray<uint8> FirstPackedRPCs;
+	SpatialGDK::RPCRingBufferUtils::AppendPackedRPC(FirstPackedRPCs, SimplePayload);
+	SpatialGDK::RPCRingBufferUtils::AppendPackedRPC(FirstPackedRPCs, OtherPayload);
+	SpatialGDK::RPCRingBufferUtils::AppendPackedRPC(FirstPackedRPCs, SimplePayload);
+
+	TArray<uint8> SecondPackedRPCs;
+	SpatialGDK::RPCRingBufferUtils::AppendPackedRPC(SecondPackedRPCs, OtherPayload);
+
+	Schema_ComponentData* ClientComponentData = Schema_CreateComponentData();
+	Schema_Object* ClientSchemaObject = Schema_GetComponentDataFields(ClientComponentData);
+	SpatialGDK::RPCRingBufferUtils::WritePackedRPCsToSchema(ClientSchemaObject, ERPCType::ServerUnreliable, 1, FirstPackedRPCs);
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(ClientSchemaObject, ERPCType::ServerUnreliable, 2, SimplePayload);
+	SpatialGDK::RPCRingBufferUtils::WritePackedRPCsToSchema(ClientSchemaObject, ERPCType::ServerUnreliable, 3, SecondPackedRPCs);
+
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		ClientComponentData,
+		GetClientAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID,
+		GetServerAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	const TArray<SpatialGDK::RPCPayload> ExpectedPayloads = { SimplePayload, OtherPayload, SimplePayload, SimplePayload, OtherPayload };
+	int RPCsExtracted = 0;
+	bool bPayloadsMatch = true;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&RPCsExtracted, &bPayloadsMatch, &ExpectedPayloads](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		bPayloadsMatch &= ExpectedPayloads.IsValidIndex(RPCsExtracted) && CompareRPCPayload(Payload, ExpectedPayloads[RPCsExtracted]);
+		bPayloadsMatch &= EntityId == RPCTestEntityId_1 && RPCType == ERPCType::ServerUnreliable;
+		RPCsExtracted++;
+		return true;
+	});
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, RPCDelegate, StaticComponentView);
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	TestTrue("Extracted RPCs match expected packed payloads", (RPCsExtracted == ExpectedPayloads.Num() && bPayloadsMatch));
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_client_endpoint_with_ping_id_in_view_and_authority_over_server_endpoint_WHEN_extract_rpcs_from_the_service_THEN_ping_id_echoed_on_server_endpoint)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+
+	constexpr uint32 PingId = 7;
+	Schema_ComponentData* ClientComponentData = Schema_CreateComponentData();
+	SpatialGDK::RPCRingBufferUtils::WritePingIdToSchema(Schema_GetComponentDataFields(ClientComponentData), PingId);
+
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		ClientComponentData,
+		GetClientAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID,
+		GetServerAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, DefaultRPCDelegate, StaticComponentView);
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	TArray<SpatialGDK::SpatialRPCService::UpdateToSend> UpdateToSendArray = RPCService.GetRPCsAndAcksToSend();
+
+	uint32 EchoedPingId = 0;
+	SpatialGDK::SpatialRPCService::UpdateToSend* Update = UpdateToSendArray.FindByPredicate([](const SpatialGDK::SpatialRPCService::UpdateToSend& UpdateToSend) {
+		return (UpdateToSend.Update.component_id == SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID);
+	});
+	if (Update != nullptr)
+	{
+		SpatialGDK::RPCRingBufferUtils::ReadPingIdFromSchema(Schema_GetComponentUpdateFields(Update->Update.schema_type), EchoedPingId);
+	}
+	TestTrue("Ping ID echoed on the server endpoint", EchoedPingId == PingId);
+
+	// An ID which has already been echoed isn't written again.
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+	TestTrue("Echoed ping ID not written again", RPCService.GetRPCsAndAcksToSend().Num() == 0);
+
+	return true;
+}
+
+namespace
+{
+
+// A server with ServerReliable RPCs 1 to NumRPCs in view on the client endpoint, whose acks are held back by RPCAckDelaySeconds.
+struct FDelayedAckFixture
+{
+	FDelayedAckFixture(uint64 NumRPCs, ExtractRPCDelegate RPCDelegate = DefaultRPCDelegate)
+		: Settings(GetMutableDefault<USpatialGDKSettings>())
+		, OldRPCAckDelaySeconds(Settings->RPCAckDelaySeconds)
+		, StaticComponentView(NewObject<USpatialStaticComponentView>())
+	{
+		Settings->RPCAckDelaySeconds = AckDelaySeconds;
+
+		Schema_ComponentData* ClientComponentData = Schema_CreateComponentData();
+		Schema_Object* ClientSchemaObject = Schema_GetComponentDataFields(ClientComponentData);
+		for (uint64 RPCId = 1; RPCId <= NumRPCs; RPCId++)
+		{
+			SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(ClientSchemaObject, ERPCType::ServerReliable, RPCId, SimplePayload);
+		}
+
+		TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+			RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+			ClientComponentData,
+			GetClientAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+		TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+			RPCTestEntityId_1, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID,
+			GetServerAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+		RPCService = MakeUnique<SpatialGDK::SpatialRPCService>(CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, RPCDelegate, StaticComponentView));
+		RPCService->SetTimeSource([this] { return Now; });
+	}
+
+	~FDelayedAckFixture()
+	{
+		Settings->RPCAckDelaySeconds = OldRPCAckDelaySeconds;
+	}
+
+	// The ack of ServerReliable RPCs sent on the server endpoint, or 0 if there is none.
+	uint64 GetSentAck()
+	{
+		uint64 Ack = 0;
+		for (SpatialGDK::SpatialRPCService::UpdateToSend& Update : RPCService->GetRPCsAndAcksToSend())
+		{
+			if (Update.EntityId == RPCTestEntityId_1 && Update.Update.component_id == SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID)
+			{
+				SpatialGDK::RPCRingBufferUtils::ReadAckFromSchema(Schema_GetComponentUpdateFields(Update.Update.schema_type), ERPCType::ServerReliable, Ack);
+			}
+			Schema_DestroyComponentUpdate(Update.Update.schema_type);
+		}
+		return Ack;
+	}
+
+	static constexpr float AckDelaySeconds = 1.0f;
+
+	USpatialGDKSettings* Settings;
+	float OldRPCAckDelaySeconds;
+	USpatialStaticComponentView* StaticComponentView;
+	TUniquePtr<SpatialGDK::SpatialRPCService> RPCService;
+	double Now = 100.0;
+};
+
+} // anonymous namespace
+
+RPC_SERVICE_TEST(GIVEN_an_ack_delay_WHEN_rpcs_are_extracted_THEN_the_ack_is_only_sent_once_the_delay_has_passed)
+{
+	FDelayedAckFixture Fixture(2);
+	Fixture.RPCService->ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	TestTrue("The ack is held back straight after extracting", Fixture.GetSentAck() == 0);
+
+	Fixture.Now += FDelayedAckFixture::AckDelaySeconds * 0.5f;
+	TestTrue("The ack is held back within the delay", Fixture.GetSentAck() == 0);
+
+	Fixture.Now += FDelayedAckFixture::AckDelaySeconds * 0.5f;
+	TestTrue("The ack is sent once the delay has passed", Fixture.GetSentAck() == 2);
+	TestTrue("The ack is only sent once", Fixture.GetSentAck() == 0);
+
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_a_held_ack_WHEN_more_rpcs_are_extracted_THEN_the_latest_ack_is_sent_at_the_first_deadline)
+{
+	// The first extraction stops after two RPCs, the second one takes the rest.
+	int32 NumRPCsToAccept = 2;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&NumRPCsToAccept](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		return NumRPCsToAccept-- > 0;
+	});
+
+	FDelayedAckFixture Fixture(4, RPCDelegate);
+	Fixture.RPCService->ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	Fixture.Now += FDelayedAckFixture::AckDelaySeconds * 0.75f;
+	NumRPCsToAccept = 2;
+	Fixture.RPCService->ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+	TestTrue("The coalesced ack is still held back", Fixture.GetSentAck() == 0);
+
+	Fixture.Now += FDelayedAckFixture::AckDelaySeconds * 0.25f;
+	TestTrue("Later acks don't push back the deadline, and replace the held ack", Fixture.GetSentAck() == 4);
+
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_a_held_ack_WHEN_rpcs_are_sent_on_its_component_THEN_the_ack_is_sent_with_them)
+{
+	FDelayedAckFixture Fixture(2);
+	Fixture.RPCService->ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	// ClientReliable RPCs are written on the server endpoint, the same component as the ack.
+	Fixture.RPCService->PushRPC(RPCTestEntityId_1, ERPCType::ClientReliable, SimplePayload, false);
+
+	TestTrue("The ack is sent before its deadline with the RPCs", Fixture.GetSentAck() == 2);
+
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_a_due_ack_and_a_held_ack_on_the_same_component_WHEN_getting_updates_THEN_both_are_sent_together)
+{
+	FDelayedAckFixture Fixture(2);
+	Fixture.RPCService->ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	// An unreliable RPC received later, whose ack isn't due when the reliable one is.
+	Fixture.Now += FDelayedAckFixture::AckDelaySeconds * 0.5f;
+	Schema_ComponentUpdate* ClientUpdate = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(Schema_GetComponentUpdateFields(ClientUpdate), ERPCType::ServerUnreliable, 1, SimplePayload);
+	Worker_ComponentUpdateOp UpdateOp = {};
+	UpdateOp.entity_id = RPCTestEntityId_1;
+	UpdateOp.update.component_id = SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
+	UpdateOp.update.schema_type = ClientUpdate;
+	Fixture.StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(ClientUpdate);
+	Fixture.RPCService->ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	Fixture.Now += FDelayedAckFixture::AckDelaySeconds * 0.5f;
+	TArray<SpatialGDK::SpatialRPCService::UpdateToSend> Updates = Fixture.RPCService->GetRPCsAndAcksToSend();
+
+	uint64 ReliableAck = 0;
+	uint64 UnreliableAck = 0;
+	for (SpatialGDK::SpatialRPCService::UpdateToSend& Update : Updates)
+	{
+		const Schema_Object* Fields = Schema_GetComponentUpdateFields(Update.Update.schema_type);
+		SpatialGDK::RPCRingBufferUtils::ReadAckFromSchema(Fields, ERPCType::ServerReliable, ReliableAck);
+		SpatialGDK::RPCRingBufferUtils::ReadAckFromSchema(Fields, ERPCType::ServerUnreliable, UnreliableAck);
+		Schema_DestroyComponentUpdate(Update.Update.schema_type);
+	}
+
+	TestEqual("Both acks go in one update", Updates.Num(), 1);
+	TestTrue("The due reliable ack is sent", ReliableAck == 2);
+	TestTrue("The unreliable ack goes with it", UnreliableAck == 1);
+
+	return true;
+}
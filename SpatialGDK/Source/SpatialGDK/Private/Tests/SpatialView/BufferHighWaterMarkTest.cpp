@@ -0,0 +1,63 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/BufferHighWaterMark.h"
+
+#include "Containers/Array.h"
+
+#define BUFFERHIGHWATERMARK_TEST(TestName) \
+	GDK_TEST(Core, BufferHighWaterMark, TestName)
+
+using namespace SpatialGDK;
+
+BUFFERHIGHWATERMARK_TEST(GIVEN_busy_array_WHEN_reset_THEN_storage_kept)
+{
+	// GIVEN
+	BufferHighWaterMark HighWaterMark;
+	TArray<int32> Array;
+	Array.SetNum(1000);
+	const int32 Capacity = Array.Max();
+
+	// WHEN
+	for (int32 i = 0; i < BufferHighWaterMark::TrimPeriod; ++i)
+	{
+		Array.SetNum(1000);
+		HighWaterMark.Reset(Array);
+	}
+
+	// THEN
+	TestTrue("Array is empty", Array.Num() == 0);
+	TestTrue("Storage kept", Array.Max() == Capacity);
+
+	return true;
+}
+
+BUFFERHIGHWATERMARK_TEST(GIVEN_array_mostly_unused_for_a_trim_period_WHEN_reset_THEN_storage_trimmed)
+{
+	// GIVEN
+	BufferHighWaterMark HighWaterMark;
+	TArray<int32> Array;
+	Array.SetNum(1000);
+	HighWaterMark.Reset(Array);
+
+	// WHEN
+	for (int32 i = 1; i < BufferHighWaterMark::TrimPeriod; ++i)
+	{
+		Array.SetNum(10);
+		HighWaterMark.Reset(Array);
+	}
+	const int32 CapacityAfterFirstPeriod = Array.Max();
+
+	for (int32 i = 0; i < BufferHighWaterMark::TrimPeriod; ++i)
+	{
+		Array.SetNum(10);
+		HighWaterMark.Reset(Array);
+	}
+
+	// THEN
+	TestTrue("Storage kept while the period included the peak", CapacityAfterFirstPeriod >= 1000);
+	TestTrue("Storage trimmed after a quiet period", Array.Max() < 1000);
+
+	return true;
+}
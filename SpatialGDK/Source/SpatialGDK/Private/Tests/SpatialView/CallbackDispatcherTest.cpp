@@ -0,0 +1,85 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/CallbackDispatcher.h"
+
+#define CALLBACKDISPATCHER_TEST(TestName) \
+	GDK_TEST(Core, CallbackDispatcher, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_ComponentId TEST_COMPONENT_ID = 1000;
+const Worker_ComponentId OTHER_COMPONENT_ID = 1001;
+} // anonymous namespace
+
+CALLBACKDISPATCHER_TEST(GIVEN_callback_for_component_WHEN_delta_has_updates_THEN_callback_invoked_in_entity_order_for_that_component_only)
+{
+	// GIVEN
+	CallbackDispatcher Dispatcher;
+	TArray<Worker_EntityId> UpdatedEntities;
+	Dispatcher.OnComponentUpdate(TEST_COMPONENT_ID, [&UpdatedEntities](const EntityComponentUpdate& Update)
+	{
+		UpdatedEntities.Add(Update.EntityId);
+	});
+
+	ViewDelta Delta;
+	Delta.AddUpdate(3, ComponentUpdate{ TEST_COMPONENT_ID });
+	Delta.AddUpdate(1, ComponentUpdate{ TEST_COMPONENT_ID });
+	Delta.AddUpdate(2, ComponentUpdate{ OTHER_COMPONENT_ID });
+	Delta.AddUpdate(2, ComponentUpdate{ TEST_COMPONENT_ID });
+
+	// WHEN
+	Dispatcher.InvokeCallbacks(Delta);
+
+	// THEN
+	const TArray<Worker_EntityId> Expected = { 1, 2, 3 };
+	TestTrue("Callback invoked once per matching update in entity order", UpdatedEntities == Expected);
+
+	return true;
+}
+
+CALLBACKDISPATCHER_TEST(GIVEN_callbacks_for_added_and_authority_WHEN_invoked_THEN_added_dispatched_before_authority)
+{
+	// GIVEN
+	CallbackDispatcher Dispatcher;
+	TArray<FString> Calls;
+	Dispatcher.OnAuthorityGained(TEST_COMPONENT_ID, [&Calls](const EntityComponentId&) { Calls.Add(TEXT("Authority")); });
+	Dispatcher.OnComponentAdded(TEST_COMPONENT_ID, [&Calls](const EntityComponentData&) { Calls.Add(TEXT("Added")); });
+
+	ViewDelta Delta;
+	Delta.AddComponent(1, ComponentData{ TEST_COMPONENT_ID });
+	Delta.SetAuthority(1, TEST_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	// WHEN
+	Dispatcher.InvokeCallbacks(Delta);
+
+	// THEN
+	TestTrue("Added before authority gained", Calls.Num() == 2 && Calls[0] == TEXT("Added") && Calls[1] == TEXT("Authority"));
+
+	return true;
+}
+
+CALLBACKDISPATCHER_TEST(GIVEN_removed_callback_WHEN_invoked_THEN_callback_not_called)
+{
+	// GIVEN
+	CallbackDispatcher Dispatcher;
+	int32 CallCount = 0;
+	const CallbackDispatcher::CallbackId Id = Dispatcher.OnComponentRemoved(TEST_COMPONENT_ID, [&CallCount](const EntityComponentId&) { ++CallCount; });
+
+	ViewDelta Delta;
+	Delta.RemoveComponent(1, TEST_COMPONENT_ID);
+
+	// WHEN
+	const bool bRemoved = Dispatcher.RemoveCallback(Id);
+	Dispatcher.InvokeCallbacks(Delta);
+
+	// THEN
+	TestTrue("Callback removed", bRemoved);
+	TestTrue("Callback not called", CallCount == 0);
+	TestFalse("Removing again fails", Dispatcher.RemoveCallback(Id));
+
+	return true;
+}
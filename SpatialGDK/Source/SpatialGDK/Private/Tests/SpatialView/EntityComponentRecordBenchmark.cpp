@@ -0,0 +1,79 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/EntityComponentRecord.h"
+
+#include "EntityComponentTestUtils.h"
+
+#include "HAL/PlatformTime.h"
+
+#define ENTITYCOMPONENTRECORD_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, EntityComponentRecord, TestName)
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	const Worker_ComponentId BENCHMARK_COMPONENT_ID = 1338;
+	const double BENCHMARK_VALUE = 7331;
+
+	// Simulates a checkout burst: every entity-component is added, updated, and then removed within the same tick.
+	// Returns the average time per op in seconds.
+	double TimeCheckoutBurst(int32 EntityCount)
+	{
+		TArray<ComponentData> Data;
+		TArray<ComponentUpdate> Updates;
+		Data.Reserve(EntityCount);
+		Updates.Reserve(EntityCount);
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Data.Push(CreateTestComponentData(BENCHMARK_COMPONENT_ID, BENCHMARK_VALUE));
+			Updates.Push(CreateTestComponentUpdate(BENCHMARK_COMPONENT_ID, BENCHMARK_VALUE));
+		}
+
+		EntityComponentRecord Record;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Record.AddComponent(i + 1, MoveTemp(Data[i]));
+		}
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Record.AddUpdate(i + 1, MoveTemp(Updates[i]));
+		}
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Record.RemoveComponent(i + 1, BENCHMARK_COMPONENT_ID);
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		return ElapsedTime / (3 * EntityCount);
+	}
+}  // anonymous namespace
+
+ENTITYCOMPONENTRECORD_BENCHMARK(GIVEN_checkout_bursts_of_increasing_size_WHEN_recorded_THEN_time_per_op_does_not_grow_with_burst_size)
+{
+	const int32 SmallBurst = 1000;
+	const int32 LargeBurst = 32000;
+
+	// Warm up allocators before measuring.
+	TimeCheckoutBurst(SmallBurst);
+
+	const double SmallBurstTimePerOp = TimeCheckoutBurst(SmallBurst);
+	const double LargeBurstTimePerOp = TimeCheckoutBurst(LargeBurst);
+
+	for (int32 EntityCount = SmallBurst; EntityCount <= LargeBurst; EntityCount *= 2)
+	{
+		AddInfo(FString::Printf(TEXT("%d entity-components: %.3f us per op"), EntityCount, TimeCheckoutBurst(EntityCount) * 1e6));
+	}
+
+	// A linear search per op would make the large burst roughly 32 times slower per op, leave plenty of headroom for noise.
+	TestTrue(TEXT("Time per op scales sub-linearly with burst size"), LargeBurstTimePerOp < SmallBurstTimePerOp * 8);
+
+	return true;
+}
+
+} // namespace SpatialGDK
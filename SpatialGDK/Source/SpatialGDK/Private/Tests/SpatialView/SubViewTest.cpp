@@ -0,0 +1,118 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/SubView.h"
+
+#define SUBVIEW_TEST(TestName) \
+	GDK_TEST(Core, SubView, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId TEST_ENTITY_ID = 1;
+const Worker_EntityId OTHER_ENTITY_ID = 2;
+const Worker_ComponentId TAG_COMPONENT_ID = 1000;
+const Worker_ComponentId OTHER_COMPONENT_ID = 1001;
+
+void AddComponent(ViewDelta& Delta, EntityComponentMap& EntityComponents, Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	Delta.AddComponent(EntityId, ComponentData{ ComponentId });
+	EntityComponents.FindOrAdd(EntityId).Add(ComponentId);
+}
+
+void RemoveComponent(ViewDelta& Delta, EntityComponentMap& EntityComponents, Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	Delta.RemoveComponent(EntityId, ComponentId);
+	EntityComponents.FindOrAdd(EntityId).Remove(ComponentId);
+}
+} // anonymous namespace
+
+SUBVIEW_TEST(GIVEN_SubView_with_required_component_WHEN_entity_gains_component_THEN_entity_added_and_delta_filtered)
+{
+	// GIVEN
+	EntityComponentMap EntityComponents;
+	SubView TaggedView(SubView::Filter{ { TAG_COMPONENT_ID } }, EntityComponents);
+	ViewDelta Delta;
+
+	// WHEN
+	AddComponent(Delta, EntityComponents, TEST_ENTITY_ID, TAG_COMPONENT_ID);
+	AddComponent(Delta, EntityComponents, OTHER_ENTITY_ID, OTHER_COMPONENT_ID);
+	TaggedView.Advance(Delta);
+
+	// THEN
+	TestTrue("Tagged entity added", TaggedView.GetEntitiesAdded().Num() == 1 && TaggedView.GetEntitiesAdded()[0] == TEST_ENTITY_ID);
+	TestTrue("Only the tagged entity is in the subview", TaggedView.GetCompleteEntities().Num() == 1 && TaggedView.IsEntityInSubView(TEST_ENTITY_ID));
+	TestTrue("Only the tagged entity's component is in the delta", TaggedView.GetComponentsAdded().Num() == 1 && TaggedView.GetComponentsAdded()[0]->EntityId == TEST_ENTITY_ID);
+
+	return true;
+}
+
+SUBVIEW_TEST(GIVEN_entity_in_SubView_WHEN_required_component_removed_THEN_entity_removed_and_removal_reported)
+{
+	// GIVEN
+	EntityComponentMap EntityComponents;
+	SubView TaggedView(SubView::Filter{ { TAG_COMPONENT_ID } }, EntityComponents);
+	ViewDelta Delta;
+	AddComponent(Delta, EntityComponents, TEST_ENTITY_ID, TAG_COMPONENT_ID);
+	TaggedView.Advance(Delta);
+
+	// WHEN
+	Delta.Clear();
+	RemoveComponent(Delta, EntityComponents, TEST_ENTITY_ID, TAG_COMPONENT_ID);
+	TaggedView.Advance(Delta);
+
+	// THEN
+	TestTrue("Entity removed", TaggedView.GetEntitiesRemoved().Num() == 1 && TaggedView.GetEntitiesRemoved()[0] == TEST_ENTITY_ID);
+	TestTrue("Subview is empty", TaggedView.GetCompleteEntities().Num() == 0);
+	TestTrue("Removal of the entity's component is in the delta", TaggedView.GetComponentsRemoved().Num() == 1);
+
+	return true;
+}
+
+SUBVIEW_TEST(GIVEN_SubView_with_predicate_WHEN_refresh_component_updated_THEN_predicate_reevaluated)
+{
+	// GIVEN
+	EntityComponentMap EntityComponents;
+	bool bAccept = false;
+	SubView::Filter Filter;
+	Filter.Predicate = [&bAccept](Worker_EntityId, const TSet<Worker_ComponentId>&) { return bAccept; };
+	Filter.RefreshComponents = { OTHER_COMPONENT_ID };
+	SubView PredicateView(MoveTemp(Filter), EntityComponents);
+
+	ViewDelta Delta;
+	AddComponent(Delta, EntityComponents, TEST_ENTITY_ID, OTHER_COMPONENT_ID);
+	PredicateView.Advance(Delta);
+	TestTrue("Entity rejected by predicate", PredicateView.GetCompleteEntities().Num() == 0);
+
+	// WHEN
+	bAccept = true;
+	Delta.Clear();
+	Delta.AddUpdate(TEST_ENTITY_ID, ComponentUpdate{ OTHER_COMPONENT_ID });
+	PredicateView.Advance(Delta);
+
+	// THEN
+	TestTrue("Entity accepted after refresh", PredicateView.GetEntitiesAdded().Num() == 1 && PredicateView.IsEntityInSubView(TEST_ENTITY_ID));
+	TestTrue("Update in the delta", PredicateView.GetUpdates().Num() == 1);
+
+	return true;
+}
+
+SUBVIEW_TEST(GIVEN_entities_in_view_WHEN_SubView_created_THEN_matching_entities_added_on_first_advance)
+{
+	// GIVEN
+	EntityComponentMap EntityComponents;
+	EntityComponents.Add(TEST_ENTITY_ID, { TAG_COMPONENT_ID });
+	EntityComponents.Add(OTHER_ENTITY_ID, { OTHER_COMPONENT_ID });
+
+	// WHEN
+	SubView TaggedView(SubView::Filter{ { TAG_COMPONENT_ID } }, EntityComponents);
+	ViewDelta Delta;
+	TaggedView.Advance(Delta);
+
+	// THEN
+	TestTrue("Existing tagged entity added", TaggedView.GetEntitiesAdded().Num() == 1 && TaggedView.GetEntitiesAdded()[0] == TEST_ENTITY_ID);
+
+	return true;
+}
@@ -0,0 +1,98 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/BenchmarkReporter.h"
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/OpList/ViewDeltaLegacyOpList.h"
+#include "SpatialView/WorkerView.h"
+
+#include "EntityComponentTestUtils.h"
+
+#include "HAL/PlatformTime.h"
+
+#define WORKERVIEW_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, WorkerView, TestName)
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	const Worker_ComponentId BENCHMARK_COMPONENT_ID = 1339;
+	const double BENCHMARK_VALUE = 7331;
+	const int32 BENCHMARK_ENTITY_COUNTS[] = { 1000, 10000, 100000 };
+
+	Worker_Op CreateAddComponentOp(Worker_EntityId EntityId, const ComponentData& Data)
+	{
+		Worker_Op Op{};
+		Op.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+		Op.op.add_component.entity_id = EntityId;
+		Op.op.add_component.data.component_id = Data.GetComponentId();
+		Op.op.add_component.data.schema_type = Data.GetUnderlying();
+		return Op;
+	}
+
+	Worker_Op CreateComponentUpdateOp(Worker_EntityId EntityId, const ComponentUpdate& Update)
+	{
+		Worker_Op Op{};
+		Op.op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+		Op.op.component_update.entity_id = EntityId;
+		Op.op.component_update.update.component_id = Update.GetComponentId();
+		Op.op.component_update.update.schema_type = Update.GetUnderlying();
+		return Op;
+	}
+}  // anonymous namespace
+
+WORKERVIEW_BENCHMARK(GIVEN_synthetic_checkouts_of_1k_10k_and_100k_entities_WHEN_processed_by_WorkerView_THEN_throughput_is_reported)
+{
+	FBenchmarkReporter Reporter(*this, TEXT("WorkerView"));
+
+	for (const int32 EntityCount : BENCHMARK_ENTITY_COUNTS)
+	{
+		// The view references op data rather than copying it, so the data must outlive the view.
+		TArray<ComponentData> Data;
+		TArray<ComponentUpdate> Updates;
+		TArray<Worker_Op> AddOps;
+		TArray<Worker_Op> UpdateOps;
+		Data.Reserve(EntityCount);
+		Updates.Reserve(EntityCount);
+		AddOps.Reserve(EntityCount);
+		UpdateOps.Reserve(EntityCount);
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Data.Push(CreateTestComponentData(BENCHMARK_COMPONENT_ID, BENCHMARK_VALUE));
+			Updates.Push(CreateTestComponentUpdate(BENCHMARK_COMPONENT_ID, BENCHMARK_VALUE));
+			AddOps.Push(CreateAddComponentOp(i + 1, Data[i]));
+			UpdateOps.Push(CreateComponentUpdateOp(i + 1, Updates[i]));
+		}
+
+		WorkerView View;
+
+		double StartTime = FPlatformTime::Seconds();
+		View.EnqueueOpList(MakeUnique<ViewDeltaLegacyOpList>(MoveTemp(AddOps)));
+		const ViewDelta* Delta = View.GenerateViewDelta();
+		Reporter.Report(TEXT("AddComponentOps"), EntityCount, EntityCount, FPlatformTime::Seconds() - StartTime);
+		TestEqual(TEXT("Every added component is in the view delta"), Delta->GetComponentsAdded().Num(), EntityCount);
+
+		StartTime = FPlatformTime::Seconds();
+		View.EnqueueOpList(MakeUnique<ViewDeltaLegacyOpList>(MoveTemp(UpdateOps)));
+		View.GenerateViewDelta();
+		Reporter.Report(TEXT("ComponentUpdateOps"), EntityCount, EntityCount, FPlatformTime::Seconds() - StartTime);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			View.SendComponentUpdate(i + 1, CreateTestComponentUpdate(BENCHMARK_COMPONENT_ID, BENCHMARK_VALUE));
+		}
+		TUniquePtr<MessagesToSend> Messages = View.FlushLocalChanges();
+		Reporter.Report(TEXT("SendComponentUpdates"), EntityCount, EntityCount, FPlatformTime::Seconds() - StartTime);
+		TestEqual(TEXT("Every local update is flushed"), Messages->ComponentMessages.Num(), EntityCount);
+
+		// Release the deltas' references to the op data before it is destroyed.
+		View.GenerateViewDelta();
+	}
+
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -20,6 +20,16 @@ namespace
 		return Op;
 	}
 
+	Worker_Op CreateAddComponentOp(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentData* Data)
+	{
+		Worker_Op Op{};
+		Op.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+		Op.op.add_component.entity_id = EntityId;
+		Op.op.add_component.data.component_id = ComponentId;
+		Op.op.add_component.data.schema_type = Data;
+		return Op;
+	}
+
 } // anonymous namespace
 
 WORKERVIEW_TEST(GIVEN_WorkerView_with_one_CreateEntityRequest_WHEN_FlushLocalChanges_called_THEN_one_CreateEntityRequest_returned)
@@ -90,3 +100,34 @@ WORKERVIEW_TEST(GIVEN_WorkerView_with_multiple_ops_engued_WHEN_GenerateViewDelta
 
 	return true;
 }
+
+WORKERVIEW_TEST(GIVEN_WorkerView_with_an_AddComponent_op_enqueued_WHEN_GenerateViewDelta_called_THEN_component_data_is_not_copied)
+{
+	// GIVEN
+	const Worker_EntityId EntityId = 1;
+	const Worker_ComponentId ComponentId = 1000;
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+
+	WorkerView View;
+	TArray<Worker_Op> Ops;
+	Ops.Push(CreateAddComponentOp(EntityId, ComponentId, Data));
+	View.EnqueueOpList(MakeUnique<ViewDeltaLegacyOpList>(Ops));
+
+	// WHEN
+	auto ViewDelta = View.GenerateViewDelta();
+
+	// THEN
+	const TArray<EntityComponentData>& ComponentsAdded = ViewDelta->GetComponentsAdded();
+	TestTrue("ViewDelta has one added component", ComponentsAdded.Num() == 1);
+	if (ComponentsAdded.Num() == 1)
+	{
+		TestTrue("Added component references the op data", ComponentsAdded[0].Data.GetUnderlying() == Data);
+		TestFalse("Added component owns its data", ComponentsAdded[0].Data.IsOwning());
+		TestTrue("Deep copy owns its data", ComponentsAdded[0].Data.DeepCopy().IsOwning());
+	}
+
+	View.GenerateViewDelta();
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
@@ -0,0 +1,80 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorPool.h"
+
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialActorPool);
+
+namespace SpatialGDK
+{
+
+FActorPool::FActorPool(uint32 InMaxActorsPerClass)
+	: MaxActorsPerClass(InMaxActorsPerClass)
+{
+}
+
+bool FActorPool::IsPoolable(const UClass* Class)
+{
+	// PlayerControllers are tied to a connection and can't be handed to another player.
+	return Class != nullptr && Class->ImplementsInterface(USpatialPooledActor::StaticClass()) && !Class->IsChildOf<APlayerController>();
+}
+
+bool FActorPool::Release(AActor* Actor)
+{
+	check(Actor != nullptr);
+
+	TArray<TWeakObjectPtr<AActor>>& ActorsForClass = PooledActors.FindOrAdd(Actor->GetClass());
+	ActorsForClass.RemoveAllSwap([](const TWeakObjectPtr<AActor>& PooledActor) { return !PooledActor.IsValid(); });
+
+	if (static_cast<uint32>(ActorsForClass.Num()) >= MaxActorsPerClass)
+	{
+		return false;
+	}
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	ISpatialPooledActor::Execute_OnReturnedToPool(Actor);
+
+	ActorsForClass.Add(Actor);
+
+	UE_LOG(LogSpatialActorPool, Verbose, TEXT("Returned actor %s to the pool, %d pooled actors of its class."), *Actor->GetName(), ActorsForClass.Num());
+
+	return true;
+}
+
+AActor* FActorPool::Acquire(UClass* Class, const FTransform& Transform)
+{
+	TArray<TWeakObjectPtr<AActor>>* ActorsForClass = PooledActors.Find(Class);
+	if (ActorsForClass == nullptr)
+	{
+		return nullptr;
+	}
+
+	while (ActorsForClass->Num() > 0)
+	{
+		AActor* Actor = ActorsForClass->Pop(false).Get();
+		if (Actor == nullptr || Actor->IsPendingKill())
+		{
+			continue;
+		}
+
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(false);
+		Actor->SetActorEnableCollision(true);
+		Actor->SetActorTickEnabled(true);
+
+		ISpatialPooledActor::Execute_OnTakenFromPool(Actor);
+
+		UE_LOG(LogSpatialActorPool, Verbose, TEXT("Took actor %s from the pool."), *Actor->GetName());
+
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,95 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorReplicationSchedule.h"
+
+#include "GameFramework/Actor.h"
+
+namespace SpatialGDK
+{
+
+FActorReplicationSchedule::FActorReplicationSchedule(double InSlotSeconds)
+	: SlotSeconds(InSlotSeconds)
+{
+	check(SlotSeconds > 0.0);
+}
+
+void FActorReplicationSchedule::Schedule(const AActor* Actor, double Time)
+{
+	const FObjectKey Key(Actor);
+	ScheduledTimes.Add(Key, Time);
+
+	const int64 SlotIndex = GetSlotIndex(Time);
+	if (bHasCollected && SlotIndex <= LastCollectedSlot)
+	{
+		ReadyEntries.Add(FEntry{ Key, Time });
+	}
+	else
+	{
+		Slots[SlotIndex & (NumSlots - 1)].Add(FEntry{ Key, Time });
+	}
+}
+
+void FActorReplicationSchedule::Unschedule(const AActor* Actor)
+{
+	// The entry is left in its slot and dropped as stale when the slot is visited.
+	ScheduledTimes.Remove(FObjectKey(Actor));
+}
+
+void FActorReplicationSchedule::CollectDue(double CurrentTime, TArray<AActor*>& OutDueActors)
+{
+	// Entries scheduled while collecting go to the next collection.
+	TArray<FEntry> Ready = MoveTemp(ReadyEntries);
+	ReadyEntries.Reset();
+	CollectDueFromEntries(Ready, CurrentTime, OutDueActors);
+	for (const FEntry& Entry : Ready)
+	{
+		Slots[GetSlotIndex(Entry.Time) & (NumSlots - 1)].Add(Entry);
+	}
+
+	const int64 CurrentSlot = GetSlotIndex(CurrentTime);
+	int64 FirstSlot = bHasCollected ? LastCollectedSlot + 1 : CurrentSlot - NumSlots + 1;
+	// Each slot only needs visiting once per collection, however long it has been since the last one.
+	FirstSlot = FMath::Max(FirstSlot, CurrentSlot - NumSlots + 1);
+
+	for (int64 SlotIndex = FirstSlot; SlotIndex <= CurrentSlot; SlotIndex++)
+	{
+		CollectDueFromEntries(Slots[SlotIndex & (NumSlots - 1)], CurrentTime, OutDueActors);
+	}
+
+	LastCollectedSlot = FMath::Max(LastCollectedSlot, CurrentSlot - 1);
+	bHasCollected = true;
+}
+
+int64 FActorReplicationSchedule::GetSlotIndex(double Time) const
+{
+	return static_cast<int64>(FMath::FloorToDouble(Time / SlotSeconds));
+}
+
+void FActorReplicationSchedule::CollectDueFromEntries(TArray<FEntry>& Entries, double CurrentTime, TArray<AActor*>& OutDueActors)
+{
+	for (int32 i = Entries.Num() - 1; i >= 0; i--)
+	{
+		const FEntry& Entry = Entries[i];
+
+		const double* ScheduledTime = ScheduledTimes.Find(Entry.Actor);
+		if (ScheduledTime == nullptr || *ScheduledTime != Entry.Time)
+		{
+			Entries.RemoveAtSwap(i, 1, false);
+			continue;
+		}
+
+		if (Entry.Time > CurrentTime)
+		{
+			continue;
+		}
+
+		if (AActor* Actor = Cast<AActor>(Entry.Actor.ResolveObjectPtr()))
+		{
+			OutDueActors.Add(Actor);
+		}
+		ScheduledTimes.Remove(Entry.Actor);
+		Entries.RemoveAtSwap(i, 1, false);
+	}
+}
+
+} // namespace SpatialGDK
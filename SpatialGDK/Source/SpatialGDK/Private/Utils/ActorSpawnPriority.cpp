@@ -0,0 +1,36 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorSpawnPriority.h"
+
+namespace SpatialGDK
+{
+
+void SortActorSpawnsByPriority(TArray<FActorSpawnCandidate>& ActorSpawns, const FVector& Origin, bool bHasOrigin)
+{
+	ActorSpawns.StableSort([&Origin, bHasOrigin](const FActorSpawnCandidate& A, const FActorSpawnCandidate& B)
+	{
+		if (A.Priority != B.Priority)
+		{
+			return A.Priority > B.Priority;
+		}
+		return bHasOrigin && FVector::DistSquared(A.Location, Origin) < FVector::DistSquared(B.Location, Origin);
+	});
+}
+
+float GetActorSpawnClassPriority(UClass* Class, const TMap<TSoftClassPtr<AActor>, float>& ClassPriorities)
+{
+	if (ClassPriorities.Num() > 0)
+	{
+		for (UClass* SuperClass = Class; SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
+		{
+			if (const float* ConfiguredPriority = ClassPriorities.Find(TSoftClassPtr<AActor>(SuperClass)))
+			{
+				return *ConfiguredPriority;
+			}
+		}
+	}
+
+	return Class->GetDefaultObject<AActor>()->NetPriority;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,84 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/AtomicHistogram.h"
+
+#include "Algo/BinarySearch.h"
+
+#include <cstring>
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+uint64 DoubleToBits(double Value)
+{
+	uint64 Bits;
+	std::memcpy(&Bits, &Value, sizeof(Bits));
+	return Bits;
+}
+
+double BitsToDouble(uint64 Bits)
+{
+	double Value;
+	std::memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+} // anonymous namespace
+
+FAtomicHistogram::FAtomicHistogram(const TArray<double>& InUpperBounds)
+	: UpperBounds(InUpperBounds)
+	, Counts(MakeUnique<TAtomic<uint32>[]>(InUpperBounds.Num() + 1))
+	, SumBits(DoubleToBits(0.0))
+{
+}
+
+void FAtomicHistogram::Record(double Value)
+{
+	// The first bucket whose upper bound is not below the value, or the overflow bucket.
+	const int32 BucketIndex = Algo::LowerBound(UpperBounds, Value);
+	Counts[BucketIndex].IncrementExchange();
+
+	uint64 ExpectedBits = SumBits.Load();
+	while (!SumBits.CompareExchange(ExpectedBits, DoubleToBits(BitsToDouble(ExpectedBits) + Value)))
+	{
+	}
+}
+
+bool FAtomicHistogram::Consume(HistogramMetric& OutMetric)
+{
+	TArray<uint32> BucketCounts;
+	BucketCounts.SetNumUninitialized(UpperBounds.Num() + 1);
+
+	uint32 TotalSamples = 0;
+	for (int32 i = 0; i < BucketCounts.Num(); i++)
+	{
+		BucketCounts[i] = Counts[i].Exchange(0);
+		TotalSamples += BucketCounts[i];
+	}
+
+	const double Sum = BitsToDouble(SumBits.Exchange(DoubleToBits(0.0)));
+
+	if (TotalSamples == 0)
+	{
+		return false;
+	}
+
+	OutMetric.Sum = Sum;
+	OutMetric.Buckets.Reset(UpperBounds.Num() + 1);
+
+	// Bucket sample counts are cumulative: each counts the observations less than or equal to its upper bound.
+	uint32 CumulativeSamples = 0;
+	for (int32 i = 0; i < UpperBounds.Num(); i++)
+	{
+		CumulativeSamples += BucketCounts[i];
+		OutMetric.Buckets.Add(HistogramMetricBucket{ UpperBounds[i], CumulativeSamples });
+	}
+	OutMetric.Buckets.Add(HistogramMetricBucket{ TNumericLimits<double>::Max(), TotalSamples });
+
+	return true;
+}
+
+} // namespace SpatialGDK
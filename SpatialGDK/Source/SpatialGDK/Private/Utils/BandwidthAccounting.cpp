@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/BandwidthAccounting.h"
+
+#include "Misc/ScopeLock.h"
+
+namespace SpatialGDK
+{
+
+void FBandwidthAccounting::RecordComponentData(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentData* Data)
+{
+	if (bEnabled)
+	{
+		Record(EntityId, ComponentId, Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Data)));
+	}
+}
+
+void FBandwidthAccounting::RecordComponentUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentUpdate* Update)
+{
+	if (bEnabled)
+	{
+		Record(EntityId, ComponentId,
+			Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update)) + Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update)));
+	}
+}
+
+void FBandwidthAccounting::Record(Worker_EntityId EntityId, Worker_ComponentId ComponentId, uint32 NumBytes)
+{
+	FScopeLock Lock(&Mutex);
+	Recorded.FindOrAdd(EntityComponentId{ EntityId, ComponentId }).Add(NumBytes);
+}
+
+TMap<EntityComponentId, FBandwidthStat> FBandwidthAccounting::ConsumeRecorded()
+{
+	TMap<EntityComponentId, FBandwidthStat> Consumed;
+	{
+		FScopeLock Lock(&Mutex);
+		Consumed = MoveTemp(Recorded);
+		Recorded.Reset();
+	}
+	return Consumed;
+}
+
+void FBandwidthReport::Reset()
+{
+	ByComponent.Reset();
+	ByClass.Reset();
+	ByRPC.Reset();
+}
+
+namespace
+{
+
+template <typename KeyType>
+void AppendCsvRows(FString& Csv, const TCHAR* Category, const TMap<KeyType, FBandwidthStat>& Stats, double DurationSeconds, TFunctionRef<FString(const KeyType&)> KeyToString)
+{
+	TArray<TPair<KeyType, FBandwidthStat>> SortedStats = Stats.Array();
+	SortedStats.Sort([](const TPair<KeyType, FBandwidthStat>& A, const TPair<KeyType, FBandwidthStat>& B)
+	{
+		return A.Value.Bytes > B.Value.Bytes;
+	});
+
+	for (const TPair<KeyType, FBandwidthStat>& Stat : SortedStats)
+	{
+		const double BytesPerSecond = DurationSeconds > 0.0 ? Stat.Value.Bytes / DurationSeconds : 0.0;
+		Csv += FString::Printf(TEXT("%s,%s,%llu,%llu,%.2f\n"), Category, *KeyToString(Stat.Key), Stat.Value.Messages, Stat.Value.Bytes, BytesPerSecond);
+	}
+}
+
+} // anonymous namespace
+
+FString FBandwidthReport::ToCsv(double DurationSeconds) const
+{
+	FString Csv = TEXT("Category,Name,Messages,Bytes,BytesPerSecond\n");
+	AppendCsvRows<Worker_ComponentId>(Csv, TEXT("Component"), ByComponent, DurationSeconds, [](const Worker_ComponentId& ComponentId) { return FString::FromInt(ComponentId); });
+	AppendCsvRows<FString>(Csv, TEXT("Class"), ByClass, DurationSeconds, [](const FString& ClassName) { return ClassName; });
+	AppendCsvRows<FString>(Csv, TEXT("RPC"), ByRPC, DurationSeconds, [](const FString& FunctionName) { return FunctionName; });
+	return Csv;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ClientBandwidthBudget.h"
+
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+
+FClientBandwidthBudget::FClientBandwidthBudget(float InMinFrequencyScale)
+	: MinFrequencyScale(FMath::Clamp(InMinFrequencyScale, 1.0f / SpatialConstants::CLIENT_BANDWIDTH_SCALE_QUANTIZATION_STEPS, 1.0f))
+{
+}
+
+bool FClientBandwidthBudget::OnClientReport(float ReceivedBytesPerSecond, float BudgetBytesPerSecond)
+{
+	if (BudgetBytesPerSecond <= 0.0f || ReceivedBytesPerSecond < 0.0f)
+	{
+		return false;
+	}
+
+	const float Steps = SpatialConstants::CLIENT_BANDWIDTH_SCALE_QUANTIZATION_STEPS;
+	float NewScale = FrequencyScale;
+
+	if (ReceivedBytesPerSecond > BudgetBytesPerSecond)
+	{
+		// The received bytes are roughly proportional to the frequency, so scale down by how far over budget the client is.
+		NewScale = FMath::FloorToFloat(FrequencyScale * BudgetBytesPerSecond / ReceivedBytesPerSecond * Steps) / Steps;
+	}
+	else if (ReceivedBytesPerSecond < BudgetBytesPerSecond * SpatialConstants::CLIENT_BANDWIDTH_HEADROOM_FRACTION)
+	{
+		NewScale = FMath::CeilToFloat(FrequencyScale * SpatialConstants::CLIENT_BANDWIDTH_SCALE_UP_FACTOR * Steps) / Steps;
+	}
+
+	NewScale = FMath::Clamp(NewScale, MinFrequencyScale, 1.0f);
+	if (NewScale == FrequencyScale)
+	{
+		return false;
+	}
+
+	FrequencyScale = NewScale;
+	return true;
+}
+
+} // namespace SpatialGDK
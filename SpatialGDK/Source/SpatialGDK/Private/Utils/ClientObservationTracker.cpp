@@ -0,0 +1,91 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ClientObservationTracker.h"
+
+namespace SpatialGDK
+{
+
+FClientObservationTracker::FClientObservationTracker(float InWakeUpMargin)
+	: WakeUpMargin(FMath::Max(InWakeUpMargin, 0.f))
+{
+}
+
+void FClientObservationTracker::SetLocalViewPositions(TArray<FVector>&& Positions)
+{
+	LocalViewPositions = MoveTemp(Positions);
+}
+
+bool FClientObservationTracker::HaveLocalViewPositionsMoved(float Tolerance) const
+{
+	if (LocalViewPositions.Num() != PublishedViewPositions.Num())
+	{
+		return true;
+	}
+
+	const float ToleranceSquared = FMath::Square(Tolerance);
+	for (int32 Index = 0; Index < LocalViewPositions.Num(); Index++)
+	{
+		if (FVector::DistSquared(LocalViewPositions[Index], PublishedViewPositions[Index]) > ToleranceSquared)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FClientObservationTracker::SetRemoteViewPositions(TMap<Worker_EntityId_Key, TArray<FVector>>&& Positions)
+{
+	RemoteViewPositions = MoveTemp(Positions);
+}
+
+void FClientObservationTracker::AppendRemoteViewPositions(TArray<FVector>& OutPositions) const
+{
+	for (const TPair<Worker_EntityId_Key, TArray<FVector>>& Remote : RemoteViewPositions)
+	{
+		OutPositions.Append(Remote.Value);
+	}
+}
+
+bool FClientObservationTracker::IsObserved(const FVector& Location, float NetCullDistanceSquared) const
+{
+	const float RadiusSquared = FMath::Square(FMath::Sqrt(NetCullDistanceSquared) + WakeUpMargin);
+
+	if (IsWithin(LocalViewPositions, Location, RadiusSquared))
+	{
+		return true;
+	}
+
+	for (const TPair<Worker_EntityId_Key, TArray<FVector>>& Remote : RemoteViewPositions)
+	{
+		if (IsWithin(Remote.Value, Location, RadiusSquared))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 FClientObservationTracker::GetNumViewPositions() const
+{
+	int32 NumViewPositions = LocalViewPositions.Num();
+	for (const TPair<Worker_EntityId_Key, TArray<FVector>>& Remote : RemoteViewPositions)
+	{
+		NumViewPositions += Remote.Value.Num();
+	}
+	return NumViewPositions;
+}
+
+bool FClientObservationTracker::IsWithin(const TArray<FVector>& ViewPositions, const FVector& Location, float RadiusSquared)
+{
+	for (const FVector& ViewPosition : ViewPositions)
+	{
+		if (FVector::DistSquared(ViewPosition, Location) <= RadiusSquared)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+} // namespace SpatialGDK
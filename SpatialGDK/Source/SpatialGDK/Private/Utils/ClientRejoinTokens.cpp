@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ClientRejoinTokens.h"
+
+#include "Misc/Guid.h"
+
+namespace SpatialGDK
+{
+
+FString FClientRejoinTokens::Issue(const PhysicalWorkerName& WorkerId)
+{
+	// Made of two GUIDs, as not all of a GUID's bits are random.
+	FRejoinToken& RejoinToken = Tokens.Add(WorkerId);
+	RejoinToken.Token = FGuid::NewGuid().ToString(EGuidFormats::Digits) + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	return RejoinToken.Token;
+}
+
+void FClientRejoinTokens::OnWorkerDisconnected(const PhysicalWorkerName& WorkerId)
+{
+	if (FRejoinToken* RejoinToken = Tokens.Find(WorkerId))
+	{
+		RejoinToken->bWorkerDisconnected = true;
+	}
+}
+
+bool FClientRejoinTokens::TryConsume(const PhysicalWorkerName& PreviousWorkerId, const FString& Token)
+{
+	const FRejoinToken* RejoinToken = Tokens.Find(PreviousWorkerId);
+	if (RejoinToken == nullptr || !RejoinToken->bWorkerDisconnected || Token.IsEmpty() || !RejoinToken->Token.Equals(Token, ESearchCase::CaseSensitive))
+	{
+		return false;
+	}
+
+	Tokens.Remove(PreviousWorkerId);
+	return true;
+}
+
+} // namespace SpatialGDK
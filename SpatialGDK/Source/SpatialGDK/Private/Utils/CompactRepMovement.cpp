@@ -0,0 +1,167 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/CompactRepMovement.h"
+
+#include "UObject/UnrealType.h"
+
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+
+namespace
+{
+	constexpr uint32 SimulatedPhysicSleepFlag = 1 << 0;
+	constexpr uint32 RepPhysicsFlag = 1 << 1;
+
+	float GetVectorScale(EVectorQuantization Level)
+	{
+		switch (Level)
+		{
+		case EVectorQuantization::RoundOneDecimal:
+			return 10.f;
+		case EVectorQuantization::RoundTwoDecimals:
+			return 100.f;
+		default:
+			return 1.f;
+		}
+	}
+
+	void AddLocation(Schema_Object* Object, const FVector& Location, EVectorQuantization Level)
+	{
+		const double Scale = GetVectorScale(Level);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Schema_AddSint64(Object, SpatialConstants::REP_MOVEMENT_LOCATION_ID, static_cast<int64>(FMath::RoundToDouble(Location[Axis] * Scale)));
+		}
+	}
+
+	FVector GetLocation(const Schema_Object* Object, EVectorQuantization Level)
+	{
+		if (Schema_GetSint64Count(Object, SpatialConstants::REP_MOVEMENT_LOCATION_ID) != 3)
+		{
+			return FVector::ZeroVector;
+		}
+
+		const double Scale = GetVectorScale(Level);
+		FVector Location;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Location[Axis] = static_cast<float>(Schema_IndexSint64(Object, SpatialConstants::REP_MOVEMENT_LOCATION_ID, Axis) / Scale);
+		}
+		return Location;
+	}
+
+	// Left out if it rounds to zero.
+	void AddVelocity(Schema_Object* Object, Schema_FieldId FieldId, const FVector& Velocity, EVectorQuantization Level)
+	{
+		const float Scale = GetVectorScale(Level);
+		const FIntVector Quantized(FMath::RoundToInt(Velocity.X * Scale), FMath::RoundToInt(Velocity.Y * Scale), FMath::RoundToInt(Velocity.Z * Scale));
+		if (Quantized == FIntVector::ZeroValue)
+		{
+			return;
+		}
+
+		Schema_AddSint32(Object, FieldId, Quantized.X);
+		Schema_AddSint32(Object, FieldId, Quantized.Y);
+		Schema_AddSint32(Object, FieldId, Quantized.Z);
+	}
+
+	FVector GetVelocity(const Schema_Object* Object, Schema_FieldId FieldId, EVectorQuantization Level)
+	{
+		if (Schema_GetSint32Count(Object, FieldId) != 3)
+		{
+			return FVector::ZeroVector;
+		}
+
+		const float Scale = GetVectorScale(Level);
+		return FVector(Schema_IndexSint32(Object, FieldId, 0) / Scale, Schema_IndexSint32(Object, FieldId, 1) / Scale, Schema_IndexSint32(Object, FieldId, 2) / Scale);
+	}
+
+	// Yaw is packed in the lowest bits, as it is often the only axis which isn't zero.
+	uint64 CompressRotation(const FRotator& Rotation, ERotatorQuantization Level)
+	{
+		if (Level == ERotatorQuantization::ByteComponents)
+		{
+			return (static_cast<uint64>(FRotator::CompressAxisToByte(Rotation.Roll)) << 16)
+				| (static_cast<uint64>(FRotator::CompressAxisToByte(Rotation.Pitch)) << 8)
+				| static_cast<uint64>(FRotator::CompressAxisToByte(Rotation.Yaw));
+		}
+
+		return (static_cast<uint64>(FRotator::CompressAxisToShort(Rotation.Roll)) << 32)
+			| (static_cast<uint64>(FRotator::CompressAxisToShort(Rotation.Pitch)) << 16)
+			| static_cast<uint64>(FRotator::CompressAxisToShort(Rotation.Yaw));
+	}
+
+	FRotator DecompressRotation(uint64 Compressed, ERotatorQuantization Level)
+	{
+		if (Level == ERotatorQuantization::ByteComponents)
+		{
+			return FRotator(FRotator::DecompressAxisFromByte(static_cast<uint8>(Compressed >> 8)),
+				FRotator::DecompressAxisFromByte(static_cast<uint8>(Compressed)),
+				FRotator::DecompressAxisFromByte(static_cast<uint8>(Compressed >> 16)));
+		}
+
+		return FRotator(FRotator::DecompressAxisFromShort(static_cast<uint16>(Compressed >> 16)),
+			FRotator::DecompressAxisFromShort(static_cast<uint16>(Compressed)),
+			FRotator::DecompressAxisFromShort(static_cast<uint16>(Compressed >> 32)));
+	}
+}
+
+namespace SpatialGDK
+{
+namespace CompactRepMovement
+{
+
+bool IsCompactProperty(const UStructProperty* Property)
+{
+	return Property != nullptr && Property->Struct == FRepMovement::StaticStruct() && GetDefault<USpatialGDKSettings>()->bUseCompactReplicatedMovement;
+}
+
+void Write(Schema_Object* Object, Schema_FieldId FieldId, const FRepMovement& Movement)
+{
+	Schema_Object* MovementObject = Schema_AddObject(Object, FieldId);
+
+	const uint32 Flags = (Movement.bSimulatedPhysicSleep ? SimulatedPhysicSleepFlag : 0) | (Movement.bRepPhysics ? RepPhysicsFlag : 0);
+	Schema_AddUint32(MovementObject, SpatialConstants::REP_MOVEMENT_FLAGS_ID, Flags);
+
+	AddLocation(MovementObject, Movement.Location, Movement.LocationQuantizationLevel);
+
+	const uint64 Rotation = CompressRotation(Movement.Rotation, Movement.RotationQuantizationLevel);
+	if (Rotation != 0)
+	{
+		Schema_AddUint64(MovementObject, SpatialConstants::REP_MOVEMENT_ROTATION_ID, Rotation);
+	}
+
+	AddVelocity(MovementObject, SpatialConstants::REP_MOVEMENT_LINEAR_VELOCITY_ID, Movement.LinearVelocity, Movement.VelocityQuantizationLevel);
+	if (Movement.bRepPhysics)
+	{
+		AddVelocity(MovementObject, SpatialConstants::REP_MOVEMENT_ANGULAR_VELOCITY_ID, Movement.AngularVelocity, Movement.VelocityQuantizationLevel);
+	}
+}
+
+void Read(Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, FRepMovement& OutMovement)
+{
+	Schema_Object* MovementObject = Schema_IndexObject(Object, FieldId, Index);
+
+	const uint32 Flags = Schema_GetUint32(MovementObject, SpatialConstants::REP_MOVEMENT_FLAGS_ID);
+	OutMovement.bSimulatedPhysicSleep = (Flags & SimulatedPhysicSleepFlag) != 0;
+	OutMovement.bRepPhysics = (Flags & RepPhysicsFlag) != 0;
+
+	OutMovement.Location = GetLocation(MovementObject, OutMovement.LocationQuantizationLevel);
+	OutMovement.Rotation = Schema_GetUint64Count(MovementObject, SpatialConstants::REP_MOVEMENT_ROTATION_ID) > 0
+		? DecompressRotation(Schema_GetUint64(MovementObject, SpatialConstants::REP_MOVEMENT_ROTATION_ID), OutMovement.RotationQuantizationLevel)
+		: FRotator::ZeroRotator;
+
+	OutMovement.LinearVelocity = GetVelocity(MovementObject, SpatialConstants::REP_MOVEMENT_LINEAR_VELOCITY_ID, OutMovement.VelocityQuantizationLevel);
+	OutMovement.AngularVelocity = OutMovement.bRepPhysics
+		? GetVelocity(MovementObject, SpatialConstants::REP_MOVEMENT_ANGULAR_VELOCITY_ID, OutMovement.VelocityQuantizationLevel)
+		: FVector::ZeroVector;
+}
+
+FOnMovementReceived& OnMovementReceived()
+{
+	static FOnMovementReceived Delegate;
+	return Delegate;
+}
+
+} // namespace CompactRepMovement
+} // namespace SpatialGDK
@@ -0,0 +1,466 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/CompactSchemaDatabase.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/LargeMemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "SpatialConstants.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialCompactSchemaDatabase);
+
+namespace
+{
+
+constexpr uint32 CompactSchemaDatabaseMagic = 0x44534753; // "SGSD"
+constexpr uint32 CompactSchemaDatabaseVersion = 2;
+constexpr uint32 IndexEntrySize = 2 * sizeof(uint32);
+
+struct FSharedCompactSchemaDatabase
+{
+	FCriticalSection Mutex;
+	TSharedPtr<const SpatialGDK::FCompactSchemaDatabase, ESPMode::ThreadSafe> Database;
+	FString Filename;
+	FDateTime TimeStamp;
+};
+
+FSharedCompactSchemaDatabase& GetSharedCompactSchemaDatabase()
+{
+	static FSharedCompactSchemaDatabase SharedDatabase;
+	return SharedDatabase;
+}
+
+void SerializeSchemaComponents(FArchive& Ar, uint32 (&SchemaComponents)[SCHEMA_Count])
+{
+	for (int32 Type = SCHEMA_Begin; Type < SCHEMA_Count; Type++)
+	{
+		Ar << SchemaComponents[Type];
+	}
+}
+
+void SerializeActorSchemaData(FArchive& Ar, FActorSchemaData& SchemaData)
+{
+	Ar << SchemaData.GeneratedSchemaName;
+	SerializeSchemaComponents(Ar, SchemaData.SchemaComponents);
+
+	int32 NumSubobjects = SchemaData.SubobjectData.Num();
+	Ar << NumSubobjects;
+
+	if (Ar.IsSaving())
+	{
+		for (TPair<uint32, FActorSpecificSubobjectSchemaData>& SubobjectPair : SchemaData.SubobjectData)
+		{
+			FString SubobjectName = SubobjectPair.Value.Name.ToString();
+			Ar << SubobjectPair.Key;
+			Ar << SubobjectPair.Value.ClassPath;
+			Ar << SubobjectName;
+			SerializeSchemaComponents(Ar, SubobjectPair.Value.SchemaComponents);
+		}
+	}
+	else
+	{
+		SchemaData.SubobjectData.Reserve(NumSubobjects);
+		for (int32 SubobjectIndex = 0; SubobjectIndex < NumSubobjects && !Ar.IsError(); SubobjectIndex++)
+		{
+			uint32 Offset = 0;
+			FString SubobjectName;
+			FActorSpecificSubobjectSchemaData SubobjectData;
+			Ar << Offset;
+			Ar << SubobjectData.ClassPath;
+			Ar << SubobjectName;
+			SerializeSchemaComponents(Ar, SubobjectData.SchemaComponents);
+			SubobjectData.Name = FName(*SubobjectName);
+			SchemaData.SubobjectData.Add(Offset, MoveTemp(SubobjectData));
+		}
+	}
+}
+
+void SerializeSubobjectSchemaData(FArchive& Ar, FSubobjectSchemaData& SchemaData)
+{
+	Ar << SchemaData.GeneratedSchemaName;
+
+	int32 NumDynamicSubobjects = SchemaData.DynamicSubobjectComponents.Num();
+	Ar << NumDynamicSubobjects;
+
+	if (Ar.IsLoading())
+	{
+		SchemaData.DynamicSubobjectComponents.SetNum(FMath::Max(NumDynamicSubobjects, 0));
+	}
+
+	for (FDynamicSubobjectSchemaData& DynamicSubobjectData : SchemaData.DynamicSubobjectComponents)
+	{
+		SerializeSchemaComponents(Ar, DynamicSubobjectData.SchemaComponents);
+	}
+}
+
+void SerializeTables(FArchive& Ar, USchemaDatabase& SchemaDatabase)
+{
+	Ar << SchemaDatabase.NextAvailableComponentId;
+	Ar << SchemaDatabase.SchemaDescriptorHash;
+	Ar << SchemaDatabase.LevelPathToComponentId;
+	Ar << SchemaDatabase.NetCullDistanceToComponentId;
+	Ar << SchemaDatabase.NetCullDistanceComponentIds;
+	Ar << SchemaDatabase.DataComponentIds;
+	Ar << SchemaDatabase.OwnerOnlyComponentIds;
+	Ar << SchemaDatabase.HandoverComponentIds;
+	Ar << SchemaDatabase.LevelComponentIds;
+
+	int32 NumCompressedFieldClasses = SchemaDatabase.ClassPathToCompressedFields.Num();
+	Ar << NumCompressedFieldClasses;
+	if (Ar.IsLoading())
+	{
+		SchemaDatabase.ClassPathToCompressedFields.Empty(NumCompressedFieldClasses);
+		for (int32 i = 0; i < NumCompressedFieldClasses && !Ar.IsError(); i++)
+		{
+			FString ClassPath;
+			Ar << ClassPath;
+			FCompressedFieldsSchemaData& CompressedFields = SchemaDatabase.ClassPathToCompressedFields.Add(ClassPath);
+			Ar << CompressedFields.ReplicatedFieldIds;
+			Ar << CompressedFields.HandoverFieldIds;
+		}
+	}
+	else
+	{
+		for (auto& ClassCompressedFields : SchemaDatabase.ClassPathToCompressedFields)
+		{
+			Ar << ClassCompressedFields.Key;
+			Ar << ClassCompressedFields.Value.ReplicatedFieldIds;
+			Ar << ClassCompressedFields.Value.HandoverFieldIds;
+		}
+	}
+}
+
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FCompactSchemaDatabase::FCompactSchemaDatabase() = default;
+
+FCompactSchemaDatabase::~FCompactSchemaDatabase()
+{
+	// The region has to be unmapped before the file handle is closed.
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+FString FCompactSchemaDatabase::GetFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectContentDir(), SpatialConstants::COMPACT_SCHEMA_DATABASE_FILE_PATH);
+}
+
+void FCompactSchemaDatabase::Write(const USchemaDatabase& SchemaDatabase, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+
+	FHeader OutHeader;
+	OutHeader.Magic = CompactSchemaDatabaseMagic;
+	OutHeader.Version = CompactSchemaDatabaseVersion;
+	SerializeHeader(Writer, OutHeader);
+
+	TArray<FIndexEntry> ActorIndex;
+	ActorIndex.Reserve(SchemaDatabase.ActorClassPathToSchema.Num());
+	for (const TPair<FString, FActorSchemaData>& ActorPair : SchemaDatabase.ActorClassPathToSchema)
+	{
+		ActorIndex.Add(FIndexEntry{ HashClassPath(ActorPair.Key), static_cast<uint32>(Writer.Tell()) });
+
+		FString ClassPath = ActorPair.Key;
+		FActorSchemaData SchemaData = ActorPair.Value;
+		Writer << ClassPath;
+		SerializeActorSchemaData(Writer, SchemaData);
+	}
+
+	TArray<FIndexEntry> SubobjectIndex;
+	SubobjectIndex.Reserve(SchemaDatabase.SubobjectClassPathToSchema.Num());
+	for (const TPair<FString, FSubobjectSchemaData>& SubobjectPair : SchemaDatabase.SubobjectClassPathToSchema)
+	{
+		SubobjectIndex.Add(FIndexEntry{ HashClassPath(SubobjectPair.Key), static_cast<uint32>(Writer.Tell()) });
+
+		FString ClassPath = SubobjectPair.Key;
+		FSubobjectSchemaData SchemaData = SubobjectPair.Value;
+		Writer << ClassPath;
+		SerializeSubobjectSchemaData(Writer, SchemaData);
+	}
+
+	TArray<FIndexEntry> ComponentIndex;
+	ComponentIndex.Reserve(SchemaDatabase.ComponentIdToClassPath.Num());
+	for (const TPair<uint32, FString>& ComponentPair : SchemaDatabase.ComponentIdToClassPath)
+	{
+		ComponentIndex.Add(FIndexEntry{ ComponentPair.Key, static_cast<uint32>(Writer.Tell()) });
+
+		FString ClassPath = ComponentPair.Value;
+		Writer << ClassPath;
+	}
+
+	auto WriteIndex = [&Writer](TArray<FIndexEntry>& Index, uint32& OutIndexOffset, uint32& OutNumEntries)
+	{
+		// Stable, so records sharing a hash stay in a deterministic order.
+		Index.StableSort([](const FIndexEntry& LHS, const FIndexEntry& RHS) { return LHS.Key < RHS.Key; });
+
+		OutIndexOffset = static_cast<uint32>(Writer.Tell());
+		OutNumEntries = Index.Num();
+		for (FIndexEntry& Entry : Index)
+		{
+			Writer << Entry.Key;
+			Writer << Entry.RecordOffset;
+		}
+	};
+
+	WriteIndex(ActorIndex, OutHeader.ActorIndexOffset, OutHeader.NumActors);
+	WriteIndex(SubobjectIndex, OutHeader.SubobjectIndexOffset, OutHeader.NumSubobjects);
+	WriteIndex(ComponentIndex, OutHeader.ComponentIndexOffset, OutHeader.NumComponents);
+
+	OutHeader.TablesOffset = static_cast<uint32>(Writer.Tell());
+
+	// The tables are stored with sorted component ID lists, so they can be binary searched.
+	USchemaDatabase* Tables = NewObject<USchemaDatabase>();
+	Tables->NextAvailableComponentId = SchemaDatabase.NextAvailableComponentId;
+	Tables->SchemaDescriptorHash = SchemaDatabase.SchemaDescriptorHash;
+	Tables->LevelPathToComponentId = SchemaDatabase.LevelPathToComponentId;
+	Tables->NetCullDistanceToComponentId = SchemaDatabase.NetCullDistanceToComponentId;
+	Tables->NetCullDistanceComponentIds = SchemaDatabase.NetCullDistanceComponentIds;
+	Tables->DataComponentIds = SchemaDatabase.DataComponentIds;
+	Tables->DataComponentIds.Sort();
+	Tables->OwnerOnlyComponentIds = SchemaDatabase.OwnerOnlyComponentIds;
+	Tables->OwnerOnlyComponentIds.Sort();
+	Tables->HandoverComponentIds = SchemaDatabase.HandoverComponentIds;
+	Tables->HandoverComponentIds.Sort();
+	Tables->LevelComponentIds = SchemaDatabase.LevelComponentIds;
+	Tables->LevelComponentIds.Sort();
+	Tables->ClassPathToCompressedFields = SchemaDatabase.ClassPathToCompressedFields;
+	SerializeTables(Writer, *Tables);
+
+	Writer.Seek(0);
+	SerializeHeader(Writer, OutHeader);
+}
+
+bool FCompactSchemaDatabase::WriteToFile(const USchemaDatabase& SchemaDatabase, const FString& Filename)
+{
+	TArray<uint8> OutData;
+	Write(SchemaDatabase, OutData);
+
+	ResetShared();
+
+	if (!FFileHelper::SaveArrayToFile(OutData, *Filename))
+	{
+		UE_LOG(LogSpatialCompactSchemaDatabase, Error, TEXT("Failed to write compact schema database to %s"), *Filename);
+		return false;
+	}
+
+	return true;
+}
+
+bool FCompactSchemaDatabase::Load(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+	if (MappedFile.IsValid())
+	{
+		MappedRegion.Reset(MappedFile->MapRegion());
+		if (MappedRegion.IsValid())
+		{
+			Data = MappedRegion->GetMappedPtr();
+			DataSize = MappedRegion->GetMappedSize();
+		}
+	}
+
+	if (Data == nullptr)
+	{
+		// Mapping isn't supported for files inside pak files on most platforms.
+		if (!FFileHelper::LoadFileToArray(LoadedData, *Filename, FILEREAD_Silent))
+		{
+			return false;
+		}
+		Data = LoadedData.GetData();
+		DataSize = LoadedData.Num();
+	}
+
+	FLargeMemoryReader Reader(Data, DataSize);
+	SerializeHeader(Reader, Header);
+
+	if (Reader.IsError() || Header.Magic != CompactSchemaDatabaseMagic || Header.Version != CompactSchemaDatabaseVersion)
+	{
+		UE_LOG(LogSpatialCompactSchemaDatabase, Error, TEXT("Compact schema database %s is invalid or was written by a different version of the GDK. Please regenerate schema."), *Filename);
+		return false;
+	}
+
+	auto IsIndexInBounds = [this](uint32 IndexOffset, uint32 NumEntries)
+	{
+		return static_cast<int64>(IndexOffset) + static_cast<int64>(NumEntries) * IndexEntrySize <= DataSize;
+	};
+
+	if (!IsIndexInBounds(Header.ActorIndexOffset, Header.NumActors) || !IsIndexInBounds(Header.SubobjectIndexOffset, Header.NumSubobjects)
+		|| !IsIndexInBounds(Header.ComponentIndexOffset, Header.NumComponents) || Header.TablesOffset > DataSize)
+	{
+		UE_LOG(LogSpatialCompactSchemaDatabase, Error, TEXT("Compact schema database %s is truncated. Please regenerate schema."), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogSpatialCompactSchemaDatabase, Log, TEXT("Loaded compact schema database %s (%lld bytes, %s)"), *Filename, DataSize, MappedRegion.IsValid() ? TEXT("mapped") : TEXT("read"));
+	return true;
+}
+
+TSharedPtr<const FCompactSchemaDatabase, ESPMode::ThreadSafe> FCompactSchemaDatabase::LoadShared(const FString& Filename)
+{
+	FSharedCompactSchemaDatabase& Shared = GetSharedCompactSchemaDatabase();
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*Filename);
+
+	// Held while loading, so a worker starting during a prewarm waits for it instead of loading the file as well.
+	FScopeLock Lock(&Shared.Mutex);
+
+	if (Shared.Database.IsValid() && Shared.Filename == Filename && Shared.TimeStamp == TimeStamp)
+	{
+		return Shared.Database;
+	}
+
+	// Unmapped before the file is mapped again, unless a worker is still using it.
+	Shared.Database.Reset();
+
+	TSharedPtr<FCompactSchemaDatabase, ESPMode::ThreadSafe> LoadedDatabase = MakeShared<FCompactSchemaDatabase, ESPMode::ThreadSafe>();
+	if (!LoadedDatabase->Load(Filename))
+	{
+		return nullptr;
+	}
+
+	Shared.Database = LoadedDatabase;
+	Shared.Filename = Filename;
+	Shared.TimeStamp = TimeStamp;
+	return Shared.Database;
+}
+
+void FCompactSchemaDatabase::ResetShared()
+{
+	FSharedCompactSchemaDatabase& Shared = GetSharedCompactSchemaDatabase();
+	FScopeLock Lock(&Shared.Mutex);
+	Shared.Database.Reset();
+}
+
+void FCompactSchemaDatabase::ReadTables(USchemaDatabase& OutSchemaDatabase) const
+{
+	check(Data != nullptr);
+
+	FLargeMemoryReader Reader(Data, DataSize);
+	Reader.Seek(Header.TablesOffset);
+	SerializeTables(Reader, OutSchemaDatabase);
+}
+
+bool FCompactSchemaDatabase::FindActorSchema(const FString& ClassPath, FActorSchemaData& OutSchemaData) const
+{
+	return FindRecord(Header.ActorIndexOffset, Header.NumActors, HashClassPath(ClassPath), [&ClassPath, &OutSchemaData](FArchive& Ar)
+	{
+		FString RecordClassPath;
+		Ar << RecordClassPath;
+		if (RecordClassPath != ClassPath)
+		{
+			return false;
+		}
+
+		SerializeActorSchemaData(Ar, OutSchemaData);
+		return !Ar.IsError();
+	});
+}
+
+bool FCompactSchemaDatabase::FindSubobjectSchema(const FString& ClassPath, FSubobjectSchemaData& OutSchemaData) const
+{
+	return FindRecord(Header.SubobjectIndexOffset, Header.NumSubobjects, HashClassPath(ClassPath), [&ClassPath, &OutSchemaData](FArchive& Ar)
+	{
+		FString RecordClassPath;
+		Ar << RecordClassPath;
+		if (RecordClassPath != ClassPath)
+		{
+			return false;
+		}
+
+		SerializeSubobjectSchemaData(Ar, OutSchemaData);
+		return !Ar.IsError();
+	});
+}
+
+bool FCompactSchemaDatabase::FindClassPathForComponentId(Worker_ComponentId ComponentId, FString& OutClassPath) const
+{
+	return FindRecord(Header.ComponentIndexOffset, Header.NumComponents, ComponentId, [&OutClassPath](FArchive& Ar)
+	{
+		Ar << OutClassPath;
+		return !Ar.IsError();
+	});
+}
+
+void FCompactSchemaDatabase::SerializeHeader(FArchive& Ar, FHeader& InOutHeader)
+{
+	Ar << InOutHeader.Magic;
+	Ar << InOutHeader.Version;
+	Ar << InOutHeader.ActorIndexOffset;
+	Ar << InOutHeader.NumActors;
+	Ar << InOutHeader.SubobjectIndexOffset;
+	Ar << InOutHeader.NumSubobjects;
+	Ar << InOutHeader.ComponentIndexOffset;
+	Ar << InOutHeader.NumComponents;
+	Ar << InOutHeader.TablesOffset;
+}
+
+uint32 FCompactSchemaDatabase::HashClassPath(const FString& ClassPath)
+{
+	return FCrc::StrCrc32(*ClassPath);
+}
+
+bool FCompactSchemaDatabase::FindRecord(uint32 IndexOffset, uint32 NumEntries, uint32 Key, TFunctionRef<bool(FArchive&)> ReadRecord) const
+{
+	if (Data == nullptr)
+	{
+		return false;
+	}
+
+	// Lower bound of Key in the sorted index.
+	uint32 First = 0;
+	uint32 Count = NumEntries;
+	while (Count > 0)
+	{
+		const uint32 Step = Count / 2;
+		if (GetIndexEntry(IndexOffset, First + Step).Key < Key)
+		{
+			First += Step + 1;
+			Count -= Step + 1;
+		}
+		else
+		{
+			Count = Step;
+		}
+	}
+
+	for (uint32 EntryIndex = First; EntryIndex < NumEntries; EntryIndex++)
+	{
+		const FIndexEntry Entry = GetIndexEntry(IndexOffset, EntryIndex);
+		if (Entry.Key != Key)
+		{
+			break;
+		}
+
+		FLargeMemoryReader Reader(Data, DataSize);
+		Reader.Seek(Entry.RecordOffset);
+		if (ReadRecord(Reader))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FCompactSchemaDatabase::FIndexEntry FCompactSchemaDatabase::GetIndexEntry(uint32 IndexOffset, uint32 EntryIndex) const
+{
+	// Entries are read with memcpy since the index isn't guaranteed to be aligned within the file.
+	FIndexEntry Entry;
+	const uint8* EntryData = Data + IndexOffset + static_cast<int64>(EntryIndex) * IndexEntrySize;
+	FMemory::Memcpy(&Entry.Key, EntryData, sizeof(uint32));
+	FMemory::Memcpy(&Entry.RecordOffset, EntryData + sizeof(uint32), sizeof(uint32));
+	return Entry;
+}
+
+} // namespace SpatialGDK
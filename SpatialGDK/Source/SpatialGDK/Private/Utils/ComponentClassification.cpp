@@ -0,0 +1,64 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ComponentClassification.h"
+
+#include "Utils/SchemaDatabase.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+void AddReservedComponents(TComponentIdTable<uint16>& OutTraits)
+{
+	for (Worker_ComponentId ComponentId = 0; ComponentId < SpatialConstants::STARTING_GENERATED_COMPONENT_ID; ++ComponentId)
+	{
+		if (const uint16 ReservedTraits = SpatialConstants::GetReservedComponentTraits(ComponentId))
+		{
+			OutTraits.Add(ComponentId, ReservedTraits);
+		}
+	}
+}
+} // anonymous namespace
+
+FComponentClassification::FComponentClassification()
+	: Traits(SpatialConstants::STARTING_GENERATED_COMPONENT_ID, SpatialConstants::COMPONENT_TRAIT_None)
+{
+	AddReservedComponents(Traits);
+}
+
+void FComponentClassification::AddGeneratedComponents(const USchemaDatabase& SchemaDatabase)
+{
+	// Generated IDs are allocated contiguously from STARTING_GENERATED_COMPONENT_ID, so they are all covered by the dense range.
+	const Worker_ComponentId DenseRangeEnd = FMath::Max(SpatialConstants::STARTING_GENERATED_COMPONENT_ID, SchemaDatabase.NextAvailableComponentId);
+	Traits = TComponentIdTable<uint16>(DenseRangeEnd, SpatialConstants::COMPONENT_TRAIT_None);
+	AddReservedComponents(Traits);
+
+	for (const uint32 ComponentId : SchemaDatabase.DataComponentIds)
+	{
+		AddTrait(ComponentId, SpatialConstants::COMPONENT_TRAIT_Data);
+	}
+	for (const uint32 ComponentId : SchemaDatabase.OwnerOnlyComponentIds)
+	{
+		AddTrait(ComponentId, SpatialConstants::COMPONENT_TRAIT_OwnerOnly);
+	}
+	for (const uint32 ComponentId : SchemaDatabase.HandoverComponentIds)
+	{
+		AddTrait(ComponentId, SpatialConstants::COMPONENT_TRAIT_Handover);
+	}
+	for (const uint32 ComponentId : SchemaDatabase.LevelComponentIds)
+	{
+		AddTrait(ComponentId, SpatialConstants::COMPONENT_TRAIT_QBIMarker);
+	}
+	for (const uint32 ComponentId : SchemaDatabase.NetCullDistanceComponentIds)
+	{
+		AddTrait(ComponentId, SpatialConstants::COMPONENT_TRAIT_QBIMarker);
+	}
+}
+
+void FComponentClassification::AddTrait(Worker_ComponentId ComponentId, uint16 Trait)
+{
+	Traits.Add(ComponentId, Traits.Find(ComponentId) | Trait);
+}
+
+} // namespace SpatialGDK
@@ -14,9 +14,14 @@
 #include "Net/NetworkProfiler.h"
 #include "Schema/Interest.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/CompactRepMovement.h"
+#include "Utils/CompressedBytes.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialLatencyTracer.h"
+#include "Utils/SpatialMetrics.h"
+#include "Utils/SubsystemStats.h"
 
 DEFINE_LOG_CATEGORY(LogComponentFactory);
 
@@ -34,6 +39,40 @@ namespace
 		return nullptr;
 #endif
 	}
+
+	// Arrays of these types use the same schema list encoding as adding each element in turn, so they can be written in one call.
+	bool AddPrimitiveArrayAsList(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Inner, const void* Elements, int32 Num)
+	{
+		if (Inner->IsA<UFloatProperty>())
+		{
+			Schema_AddFloatList(Object, FieldId, static_cast<const float*>(Elements), Num);
+		}
+		else if (Inner->IsA<UDoubleProperty>())
+		{
+			Schema_AddDoubleList(Object, FieldId, static_cast<const double*>(Elements), Num);
+		}
+		else if (Inner->IsA<UIntProperty>())
+		{
+			Schema_AddInt32List(Object, FieldId, static_cast<const int32_t*>(Elements), Num);
+		}
+		else if (Inner->IsA<UInt64Property>())
+		{
+			Schema_AddInt64List(Object, FieldId, static_cast<const int64_t*>(Elements), Num);
+		}
+		else if (Inner->IsA<UUInt32Property>())
+		{
+			Schema_AddUint32List(Object, FieldId, static_cast<const uint32_t*>(Elements), Num);
+		}
+		else if (Inner->IsA<UUInt64Property>())
+		{
+			Schema_AddUint64List(Object, FieldId, static_cast<const uint64_t*>(Elements), Num);
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
 }
 namespace SpatialGDK
 {
@@ -43,9 +82,17 @@ ComponentFactory::ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNet
 	, PackageMap(InNetDriver->PackageMap)
 	, ClassInfoManager(InNetDriver->ClassInfoManager)
 	, bInterestHasChanged(bInterestDirty)
+	, bAlwaysInterestedHasChanged(false)
 	, LatencyTracer(InLatencyTracer)
+	, MinCompressedBytesFieldSize(GetDefault<USpatialGDKSettings>()->MinCompressedBytesFieldSize)
 { }
 
+ComponentFactory::~ComponentFactory()
+{
+	FSpatialNetBitWriterPool::Release(MoveTemp(StructWriter));
+	FSpatialNetBitWriterPool::Release(MoveTemp(FastArrayWriter));
+}
+
 uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FactoryProcessPropertyUpdates);
@@ -55,6 +102,11 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 	// Populate the replicated data component updates from the replicated property changelist.
 	if (Changes.RepChanged.Num() > 0)
 	{
+		const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+		const TArray<FReplicationPlanEntry>& ReplicationPlan = ClassInfo.ReplicationPlan;
+		const bool bUseReplicationPlan = ReplicationPlan.Num() == Changes.RepLayout.Cmds.Num();
+		TGuardValue<const TSet<Schema_FieldId>*> CompressedFieldIdsGuard(CompressedFieldIds, &ClassInfo.CompressedFieldIds);
+
 		FChangelistIterator ChangelistIterator(Changes.RepChanged, 0);
 		FRepHandleIterator HandleIterator(static_cast<UStruct*>(Changes.RepLayout.GetOwner()), ChangelistIterator, Changes.RepLayout.Cmds, Changes.RepLayout.BaseHandleToCmdIndex, 0, 1, 0, Changes.RepLayout.Cmds.Num() - 1);
 		while (HandleIterator.NextHandle())
@@ -103,20 +155,44 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 					{
 						SCOPE_CYCLE_COUNTER(STAT_FactoryProcessFastArrayUpdate);
 
-						FSpatialNetBitWriter ValueDataWriter(PackageMap);
+						bProcessedFastArrayProperty = true;
 
-						if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
+						// The whole array is written to a single bytes field, which SpatialOS stores for workers checking out the entity later,
+						// so a delta can't be sent. Like the native early out on an unchanged key, the array isn't resent until an item or the array is marked dirty.
+						bool bFastArrayUnchanged = false;
+						const FFastArraySerializer* FastArraySerializer = FastArrayReplicationKeys != nullptr ? FSpatialNetDeltaSerializeInfo::GetFastArraySerializer(Object, Parent.ArrayIndex, Parent.Property) : nullptr;
+						if (FastArraySerializer != nullptr)
 						{
-							AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
+							const TPair<TWeakObjectPtr<UObject>, Schema_FieldId> FastArrayKey(Object, HandleIterator.Handle);
+							const int32* LastWrittenKey = FastArrayReplicationKeys->Find(FastArrayKey);
+							bFastArrayUnchanged = !bIsInitialData && LastWrittenKey != nullptr && *LastWrittenKey == FastArraySerializer->ArrayReplicationKey;
+							FastArrayReplicationKeys->Add(FastArrayKey, FastArraySerializer->ArrayReplicationKey);
 						}
 
-						bProcessedFastArrayProperty = true;
+						if (!bFastArrayUnchanged)
+						{
+							FSpatialNetBitWriter& ValueDataWriter = GetFastArrayWriter();
+
+							if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
+							{
+								AddSerializedBytes(ComponentObject, HandleIterator.Handle, ValueDataWriter);
+							}
+						}
 					}
 				}
 
-				if (!bProcessedFastArrayProperty)
+				if (!bProcessedFastArrayProperty && (LastSentPropertyValues == nullptr
+					|| !IsUnchangedSinceLastSent(*LastSentPropertyValues, Object, HandleIterator.Handle, Cmd.Property, Data, bIsInitialData)))
 				{
-					AddProperty(ComponentObject, HandleIterator.Handle, Cmd.Property, Data, ClearedIds);
+					const FWritePropertyFunction WriteProperty = bUseReplicationPlan ? ReplicationPlan[HandleIterator.CmdIndex].Write : nullptr;
+					if (WriteProperty != nullptr)
+					{
+						WriteProperty(Cmd.Property, ComponentObject, HandleIterator.Handle, Data);
+					}
+					else
+					{
+						AddProperty(ComponentObject, HandleIterator.Handle, Cmd.Property, Data, ClearedIds);
+					}
 				}
 
 #if USE_NETWORK_PROFILER
@@ -150,6 +226,7 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /* = nullptr */)
 {
 	const uint32 BytesStart = Schema_GetWriteBufferLength(ComponentObject);
+	TGuardValue<const TSet<Schema_FieldId>*> CompressedFieldIdsGuard(CompressedFieldIds, &Info.CompressedHandoverFieldIds);
 
 	for (uint16 ChangedHandle : Changes)
 	{
@@ -178,12 +255,75 @@ uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject
 	return BytesEnd - BytesStart;
 }
 
+bool ComponentFactory::IsUnchangedSinceLastSent(FLastSentPropertyValues& LastSentValues, UObject* Object, uint16 Handle, UProperty* Property,
+	const uint8* Data, bool bIsInitialData)
+{
+	// Object references are left out, as the same pointer can be written as an unresolved and later a resolved ref.
+	constexpr int32 MaxComparedPropertySize = 16;
+	if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData)
+		|| Property->IsA<UObjectPropertyBase>()
+		|| Property->GetSize() > MaxComparedPropertySize)
+	{
+		return false;
+	}
+
+	const int32 Size = Property->GetSize();
+	TArray<uint8, TInlineAllocator<16>>& LastSentValue = LastSentValues.FindOrAdd(TPair<TWeakObjectPtr<UObject>, uint16>(Object, Handle));
+	if (!bIsInitialData && LastSentValue.Num() == Size && FMemory::Memcmp(LastSentValue.GetData(), Data, Size) == 0)
+	{
+		return true;
+	}
+
+	LastSentValue.SetNumUninitialized(Size, /* bAllowShrinking */ false);
+	FMemory::Memcpy(LastSentValue.GetData(), Data, Size);
+	return false;
+}
+
+FSpatialNetBitWriter& ComponentFactory::GetStructWriter()
+{
+	if (!StructWriter.IsValid())
+	{
+		StructWriter = FSpatialNetBitWriterPool::Acquire(PackageMap);
+	}
+	StructWriter->Reset();
+
+	return *StructWriter;
+}
+
+FSpatialNetBitWriter& ComponentFactory::GetFastArrayWriter()
+{
+	if (!FastArrayWriter.IsValid())
+	{
+		FastArrayWriter = FSpatialNetBitWriterPool::Acquire(PackageMap);
+	}
+	FastArrayWriter->Reset();
+
+	return *FastArrayWriter;
+}
+
+void ComponentFactory::AddSerializedBytes(Schema_Object* Object, Schema_FieldId FieldId, FBitWriter& Writer)
+{
+	if (CompressedFieldIds != nullptr && CompressedFieldIds->Contains(FieldId))
+	{
+		AddCompressibleBytesToSchema(Object, FieldId, Writer.GetData(), Writer.GetNumBytes(), MinCompressedBytesFieldSize);
+		return;
+	}
+
+	AddBytesToSchema(Object, FieldId, Writer);
+}
+
 void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property, const uint8* Data, TArray<Schema_FieldId>* ClearedIds)
 {
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
 	{
+		if (CompactRepMovement::IsCompactProperty(StructProperty))
+		{
+			CompactRepMovement::Write(Object, FieldId, *reinterpret_cast<const FRepMovement*>(Data));
+			return;
+		}
+
 		UScriptStruct* Struct = StructProperty->Struct;
-		FSpatialNetBitWriter ValueDataWriter(PackageMap);
+		FSpatialNetBitWriter& ValueDataWriter = GetStructWriter();
 		bool bHasUnmapped = false;
 
 		if (Struct->StructFlags & STRUCT_NetSerializeNative)
@@ -210,7 +350,7 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 			RepLayout_SerializePropertiesForStruct(*RepLayout, ValueDataWriter, PackageMap, const_cast<uint8*>(Data), bHasUnmapped);
 		}
 
-		AddBytesToSchema(Object, FieldId, ValueDataWriter);
+		AddSerializedBytes(Object, FieldId, ValueDataWriter);
 	}
 	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
 	{
@@ -271,6 +411,7 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 			if (ObjectProperty->PropertyFlags & CPF_AlwaysInterested)
 			{
 				bInterestHasChanged = true;
+				bAlwaysInterestedHasChanged = true;
 			}
 			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromObjectPtr(ObjectValue, PackageMap));
 		}
@@ -289,10 +430,20 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 	}
 	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
 	{
+		// The inner property doesn't carry the AlwaysInterested flag of the array.
+		if (ArrayProperty->PropertyFlags & CPF_AlwaysInterested)
+		{
+			bInterestHasChanged = true;
+			bAlwaysInterestedHasChanged = true;
+		}
+
 		FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
-		for (int i = 0; i < ArrayHelper.Num(); i++)
+		if (ArrayHelper.Num() == 0 || !AddPrimitiveArrayAsList(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(0), ArrayHelper.Num()))
 		{
-			AddProperty(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), ClearedIds);
+			for (int i = 0; i < ArrayHelper.Num(); i++)
+			{
+				AddProperty(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), ClearedIds);
+			}
 		}
 
 		if (ArrayHelper.Num() == 0 && ClearedIds)
@@ -331,6 +482,8 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 
 TArray<FWorkerComponentData> ComponentFactory::CreateComponentDatas(UObject* Object, const FClassInfo& Info, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten)
 {
+	SPATIALGDK_SUBSYSTEM_SCOPE(ComponentFactory);
+
 	TArray<FWorkerComponentData> ComponentDatas;
 
 	if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
@@ -386,6 +539,8 @@ FWorkerComponentData ComponentFactory::CreateHandoverComponentData(Worker_Compon
 
 TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten)
 {
+	SPATIALGDK_SUBSYSTEM_SCOPE(ComponentFactory);
+
 	TArray<FWorkerComponentUpdate> ComponentUpdates;
 
 	if (RepChangeState)
@@ -423,6 +578,11 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 			{
 				ComponentUpdates.Add(HandoverUpdate);
 				OutBytesWritten += BytesWritten;
+
+				if (NetDriver != nullptr && NetDriver->SpatialMetrics != nullptr)
+				{
+					NetDriver->SpatialMetrics->RecordHandoverBytes(*Object->GetClass(), BytesWritten);
+				}
 			}
 		}
 	}
@@ -430,7 +590,16 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 	// Only support Interest for Actors for now.
 	if (Object->IsA<AActor>() && bInterestHasChanged)
 	{
-		ComponentUpdates.Add(NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId));
+		if (bAlwaysInterestedHasChanged)
+		{
+			NetDriver->InterestFactory->InvalidateAlwaysInterestedConstraint(EntityId);
+		}
+
+		Worker_ComponentUpdate InterestUpdate;
+		if (NetDriver->InterestFactory->CreateInterestUpdateIfChanged((AActor*)Object, Info, EntityId, InterestUpdate))
+		{
+			ComponentUpdates.Add(InterestUpdate);
+		}
 	}
 
 	return ComponentUpdates;
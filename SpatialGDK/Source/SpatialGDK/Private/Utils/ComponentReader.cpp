@@ -3,6 +3,7 @@
 #include "Utils/ComponentReader.h"
 
 #include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
 #include "Net/DataReplication.h"
 #include "Net/RepLayout.h"
 #include "UObject/TextProperty.h"
@@ -11,6 +12,8 @@
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "Interop/SpatialConditionMapFilter.h"
 #include "SpatialConstants.h"
+#include "Utils/CompactRepMovement.h"
+#include "Utils/CompressedBytes.h"
 #include "Utils/SchemaUtils.h"
 #include "Utils/RepLayoutUtils.h"
 
@@ -79,6 +82,40 @@ namespace
 		}
 		return false;
 	}
+
+	// Counterpart of the list writes in ComponentFactory: reads every element of a primitive array in one call.
+	bool GetPrimitiveArrayFromList(const Schema_Object* Object, Schema_FieldId FieldId, UProperty* Inner, void* OutElements)
+	{
+		if (Inner->IsA<UFloatProperty>())
+		{
+			Schema_GetFloatList(Object, FieldId, static_cast<float*>(OutElements));
+		}
+		else if (Inner->IsA<UDoubleProperty>())
+		{
+			Schema_GetDoubleList(Object, FieldId, static_cast<double*>(OutElements));
+		}
+		else if (Inner->IsA<UIntProperty>())
+		{
+			Schema_GetInt32List(Object, FieldId, static_cast<int32_t*>(OutElements));
+		}
+		else if (Inner->IsA<UInt64Property>())
+		{
+			Schema_GetInt64List(Object, FieldId, static_cast<int64_t*>(OutElements));
+		}
+		else if (Inner->IsA<UUInt32Property>())
+		{
+			Schema_GetUint32List(Object, FieldId, static_cast<uint32_t*>(OutElements));
+		}
+		else if (Inner->IsA<UUInt64Property>())
+		{
+			Schema_GetUint64List(Object, FieldId, static_cast<uint64_t*>(OutElements));
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
 }
 
 namespace SpatialGDK
@@ -101,9 +138,11 @@ void ComponentReader::ApplyComponentData(const Worker_ComponentData& ComponentDa
 
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData.schema_type);
 
-	TArray<uint32> UpdatedIds;
-	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
-	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
+	TArray<Schema_FieldId> UpdatedIds;
+	if (NetDriver->Receiver == nullptr || !NetDriver->Receiver->ConsumePrefetchedFieldIds(ComponentData.schema_type, UpdatedIds))
+	{
+		UpdatedIds = GetComponentDataFieldIds(ComponentData.schema_type);
+	}
 
 	if (bIsHandover)
 	{
@@ -124,18 +163,11 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& Compone
 
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
-	// Retrieve all the fields that have been updated in this component update
-	TArray<uint32> UpdatedIds;
-	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
-	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
-
-	// Retrieve all the fields that have been cleared (eg. list with no entries)
-	TArray<Schema_FieldId> ClearedIds;
-	ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate.schema_type));
-	Schema_GetComponentUpdateClearedFieldList(ComponentUpdate.schema_type, ClearedIds.GetData());
-
-	// Merge cleared fields into updated fields to ensure they will be processed (Schema_FieldId == uint32)
-	UpdatedIds.Append(ClearedIds);
+	TArray<Schema_FieldId> UpdatedIds;
+	if (NetDriver->Receiver == nullptr || !NetDriver->Receiver->ConsumePrefetchedFieldIds(ComponentUpdate.schema_type, UpdatedIds))
+	{
+		UpdatedIds = GetComponentUpdateFieldIds(ComponentUpdate.schema_type);
+	}
 
 	if (UpdatedIds.Num() > 0)
 	{
@@ -150,6 +182,37 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& Compone
 	}
 }
 
+TArray<Schema_FieldId> ComponentReader::GetComponentDataFieldIds(Schema_ComponentData* ComponentData)
+{
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData);
+
+	TArray<Schema_FieldId> FieldIds;
+	FieldIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
+	Schema_GetUniqueFieldIds(ComponentObject, FieldIds.GetData());
+
+	return FieldIds;
+}
+
+TArray<Schema_FieldId> ComponentReader::GetComponentUpdateFieldIds(Schema_ComponentUpdate* ComponentUpdate)
+{
+	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate);
+
+	// Retrieve all the fields that have been updated in this component update
+	TArray<Schema_FieldId> FieldIds;
+	FieldIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
+	Schema_GetUniqueFieldIds(ComponentObject, FieldIds.GetData());
+
+	// Retrieve all the fields that have been cleared (eg. list with no entries)
+	TArray<Schema_FieldId> ClearedIds;
+	ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate));
+	Schema_GetComponentUpdateClearedFieldList(ComponentUpdate, ClearedIds.GetData());
+
+	// Merge cleared fields into updated fields to ensure they will be processed (Schema_FieldId == uint32)
+	FieldIds.Append(ClearedIds);
+
+	return FieldIds;
+}
+
 void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged)
 {
 	FObjectReplicator* Replicator = Channel.PreReceiveSpatialUpdate(&Object);
@@ -164,6 +227,11 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 	TArray<FHandleToCmdIndex>& BaseHandleToCmdIndex = Replicator->RepLayout->BaseHandleToCmdIndex;
 	TArray<FRepParentCmd>& Parents = Replicator->RepLayout->Parents;
 
+	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Object.GetClass());
+	const TArray<FReplicationPlanEntry>& ReplicationPlan = ClassInfo.ReplicationPlan;
+	const bool bUseReplicationPlan = ReplicationPlan.Num() == Cmds.Num();
+	TGuardValue<const TSet<Schema_FieldId>*> CompressedFieldIdsGuard(CompressedFieldIds, &ClassInfo.CompressedFieldIds);
+
 	bool bIsAuthServer = Channel.IsAuthoritativeServer();
 	bool bAutonomousProxy = Channel.IsClientAutonomousProxy();
 	bool bIsClient = NetDriver->GetNetMode() == NM_Client;
@@ -171,6 +239,7 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 	FSpatialConditionMapFilter ConditionMap(&Channel, bIsClient);
 
 	TArray<UProperty*> RepNotifies;
+	const FRepMovement* ReceivedCompactMovement = nullptr;
 
 	{
 		// Scoped to exclude OnRep callbacks which are already tracked per OnRep function
@@ -225,13 +294,19 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 					{
 						SCOPE_CYCLE_COUNTER(STAT_ReaderApplyFastArrayUpdate);
 
-						TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId);
-						int64 CountBits = ValueData.Num() * 8;
+						// Like struct properties, read straight from the schema buffer and only copy the bytes if they hold references.
+						uint8* ValueData = nullptr;
+						uint32 ValueDataLength = 0;
+						if (!GetSerializedBytes(ComponentObject, FieldId, 0, ValueData, ValueDataLength))
+						{
+							continue;
+						}
+						int64 CountBits = (int64)ValueDataLength * 8;
 						TSet<FUnrealObjectRef> NewMappedRefs;
 						TSet<FUnrealObjectRef> NewUnresolvedRefs;
-						FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewMappedRefs, NewUnresolvedRefs);
+						FSpatialNetBitReader ValueDataReader(PackageMap, ValueData, CountBits, NewMappedRefs, NewUnresolvedRefs);
 
-						if (ValueData.Num() > 0)
+						if (ValueDataLength > 0)
 						{
 							FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, &Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct);
 						}
@@ -243,7 +318,7 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 						{
 							if (bHasReferences)
 							{
-								RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(ValueData, CountBits, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
+								RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(TArray<uint8>(ValueData, ValueDataLength), CountBits, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
 							}
 							else
 							{
@@ -257,11 +332,20 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 						ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
 					}
 				}
+				else if (const FReadPropertyFunction ReadProperty = bUseReplicationPlan ? ReplicationPlan[CmdIndex].Read : nullptr)
+				{
+					ReadProperty(Cmd.Property, ComponentObject, FieldId, 0, Data);
+				}
 				else
 				{
 					ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
 				}
 
+				if (CompactRepMovement::IsCompactProperty(Cast<UStructProperty>(Cmd.Property)))
+				{
+					ReceivedCompactMovement = reinterpret_cast<const FRepMovement*>(Data);
+				}
+
 				if (Cmd.Property->GetFName() == NAME_RemoteRole)
 				{
 					// Downgrade role from AutonomousProxy to SimulatedProxy if we aren't authoritative over
@@ -300,6 +384,11 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 
 	Channel.RemoveRepNotifiesWithUnresolvedObjs(RepNotifies, *Replicator->RepLayout, RootObjectReferencesMap, &Object);
 
+	if (ReceivedCompactMovement != nullptr && Object.IsA<AActor>())
+	{
+		CompactRepMovement::OnMovementReceived().Broadcast(static_cast<AActor&>(Object), *ReceivedCompactMovement);
+	}
+
 	Channel.PostReceiveSpatialUpdate(&Object, RepNotifies);
 }
 
@@ -315,6 +404,7 @@ void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject,
 	}
 
 	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Object.GetClass());
+	TGuardValue<const TSet<Schema_FieldId>*> CompressedFieldIdsGuard(CompressedFieldIds, &ClassInfo.CompressedHandoverFieldIds);
 
 	for (uint32 FieldId : UpdatedIds)
 	{
@@ -347,12 +437,28 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
 	{
-		TArray<uint8> ValueData = IndexBytesFromSchema(Object, FieldId, Index);
+		if (CompactRepMovement::IsCompactProperty(StructProperty))
+		{
+			if (Schema_GetObjectCount(Object, FieldId) > Index)
+			{
+				CompactRepMovement::Read(Object, FieldId, Index, *reinterpret_cast<FRepMovement*>(Data));
+			}
+			return;
+		}
+
+		// Read straight from the schema buffer, the reader makes its own copy of the data. Only structs holding object references
+		// need the bytes kept around, which is rare for the math structs that make up most struct properties.
+		uint8* ValueData = nullptr;
+		uint32 ValueDataLength = 0;
+		if (!GetSerializedBytes(Object, FieldId, Index, ValueData, ValueDataLength))
+		{
+			return;
+		}
 		// A bit hacky, we should probably include the number of bits with the data instead.
-		int64 CountBits = ValueData.Num() * 8;
+		int64 CountBits = (int64)ValueDataLength * 8;
 		TSet<FUnrealObjectRef> NewDynamicRefs;
 		TSet<FUnrealObjectRef> NewUnresolvedRefs;
-		FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewDynamicRefs, NewUnresolvedRefs);
+		FSpatialNetBitReader ValueDataReader(PackageMap, ValueData, CountBits, NewDynamicRefs, NewUnresolvedRefs);
 		bool bHasUnmapped = false;
 
 		ReadStructProperty(ValueDataReader, StructProperty, NetDriver, Data, bHasUnmapped);
@@ -362,7 +468,7 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 		{
 			if (bHasReferences)
 			{
-				InObjectReferencesMap.Add(Offset, FObjectReferences(ValueData, CountBits, MoveTemp(NewDynamicRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, ParentIndex, Property));
+				InObjectReferencesMap.Add(Offset, FObjectReferences(TArray<uint8>(ValueData, CountBits / 8), CountBits, MoveTemp(NewDynamicRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, ParentIndex, Property));
 			}
 			else
 			{
@@ -457,11 +563,11 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 	}
 	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
 	{
-		NameProperty->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
+		NameProperty->SetPropertyValue(Data, IndexNameFromSchema(Object, FieldId, Index));
 	}
 	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
 	{
-		StrProperty->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
+		IndexStringFromSchema(Object, FieldId, Index, *StrProperty->GetPropertyValuePtr(Data));
 	}
 	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
 	{
@@ -484,6 +590,32 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 	}
 }
 
+bool ComponentReader::GetSerializedBytes(Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8*& OutData, uint32& OutLength)
+{
+	if (CompressedFieldIds == nullptr || !CompressedFieldIds->Contains(FieldId))
+	{
+		OutData = const_cast<uint8*>(Schema_IndexBytes(Object, FieldId, Index));
+		OutLength = Schema_IndexBytesLength(Object, FieldId, Index);
+		return true;
+	}
+
+	if (Index >= Schema_GetBytesCount(Object, FieldId))
+	{
+		OutData = nullptr;
+		OutLength = 0;
+		return true;
+	}
+
+	const uint8* Data = nullptr;
+	if (!IndexCompressibleBytesFromSchema(Object, FieldId, Index, DecompressedBytes, Data, OutLength))
+	{
+		return false;
+	}
+
+	OutData = const_cast<uint8*>(Data);
+	return true;
+}
+
 void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyArray);
@@ -507,10 +639,13 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
 	ArrayHelper.Resize(Count);
 
-	for (int i = 0; i < Count; i++)
+	if (Count == 0 || !GetPrimitiveArrayFromList(Object, FieldId, Property->Inner, ArrayHelper.GetRawPtr(0)))
 	{
-		int32 ElementOffset = i * Property->Inner->ElementSize;
-		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex, bOutReferencesChanged);
+		for (int i = 0; i < Count; i++)
+		{
+			int32 ElementOffset = i * Property->Inner->ElementSize;
+			ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex, bOutReferencesChanged);
+		}
 	}
 
 	if (ArrayObjectReferences->Num() > 0)
@@ -0,0 +1,89 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/CompressedBytes.h"
+
+#include "Misc/Compression.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCompressedBytes, Log, All);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+constexpr uint32 CompressedHeaderSize = sizeof(uint8) + sizeof(uint32);
+} // anonymous namespace
+
+void AddCompressibleBytesToSchema(Schema_Object* Object, Schema_FieldId Id, const uint8* Data, uint32 NumBytes, uint32 MinCompressedSize)
+{
+	if (MinCompressedSize > 0 && NumBytes >= MinCompressedSize)
+	{
+		const int32 CompressedBound = FCompression::CompressMemoryBound(NAME_LZ4, NumBytes);
+		uint8* Buffer = Schema_AllocateBuffer(Object, CompressedHeaderSize + CompressedBound);
+
+		int32 CompressedSize = CompressedBound;
+		if (FCompression::CompressMemory(NAME_LZ4, Buffer + CompressedHeaderSize, CompressedSize, Data, NumBytes)
+			&& CompressedHeaderSize + CompressedSize < NumBytes + 1)
+		{
+			Buffer[0] = static_cast<uint8>(ECompressedBytesEncoding::LZ4);
+			FMemory::Memcpy(Buffer + 1, &NumBytes, sizeof(uint32));
+			Schema_AddBytes(Object, Id, Buffer, CompressedHeaderSize + CompressedSize);
+			return;
+		}
+		// The value didn't get smaller, the buffer is owned by the schema object so is just left unused.
+	}
+
+	uint8* Buffer = Schema_AllocateBuffer(Object, NumBytes + 1);
+	Buffer[0] = static_cast<uint8>(ECompressedBytesEncoding::Raw);
+	FMemory::Memcpy(Buffer + 1, Data, NumBytes);
+	Schema_AddBytes(Object, Id, Buffer, NumBytes + 1);
+}
+
+bool IndexCompressibleBytesFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index, TArray<uint8>& Scratch, const uint8*& OutData, uint32& OutNumBytes)
+{
+	const uint8* Bytes = Schema_IndexBytes(Object, Id, Index);
+	const uint32 Length = Schema_IndexBytesLength(Object, Id, Index);
+
+	OutData = nullptr;
+	OutNumBytes = 0;
+
+	if (Length == 0)
+	{
+		UE_LOG(LogCompressedBytes, Error, TEXT("Compressible bytes field %d is missing its encoding."), Id);
+		return false;
+	}
+
+	switch (static_cast<ECompressedBytesEncoding>(Bytes[0]))
+	{
+	case ECompressedBytesEncoding::Raw:
+		OutData = Bytes + 1;
+		OutNumBytes = Length - 1;
+		return true;
+	case ECompressedBytesEncoding::LZ4:
+	{
+		if (Length < CompressedHeaderSize)
+		{
+			break;
+		}
+
+		uint32 UncompressedSize;
+		FMemory::Memcpy(&UncompressedSize, Bytes + 1, sizeof(uint32));
+		Scratch.SetNumUninitialized(UncompressedSize, /* bAllowShrinking */ false);
+		if (!FCompression::UncompressMemory(NAME_LZ4, Scratch.GetData(), UncompressedSize, Bytes + CompressedHeaderSize, Length - CompressedHeaderSize))
+		{
+			break;
+		}
+
+		OutData = Scratch.GetData();
+		OutNumBytes = UncompressedSize;
+		return true;
+	}
+	default:
+		break;
+	}
+
+	UE_LOG(LogCompressedBytes, Error, TEXT("Failed to decode compressible bytes field %d, encoding %d, length %u."), Id, Bytes[0], Length);
+	return false;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityComponentTemplateCache.h"
+
+#include "UObject/Class.h"
+
+namespace SpatialGDK
+{
+
+FEntityComponentTemplateCache::~FEntityComponentTemplateCache()
+{
+	Reset();
+}
+
+FWorkerComponentData FEntityComponentTemplateCache::CopyTemplate(const UClass* Class, Worker_ComponentId ComponentId, TFunctionRef<Worker_ComponentData()> CreateTemplate)
+{
+	FTemplate& Template = Templates.FindOrAdd(FTemplateKey(Class, ComponentId));
+
+	if (Template.Data != nullptr && !Template.Class.IsValid())
+	{
+		Schema_DestroyComponentData(Template.Data);
+		Template.Data = nullptr;
+	}
+
+	if (Template.Data == nullptr)
+	{
+		Worker_ComponentData TemplateData = CreateTemplate();
+		check(TemplateData.component_id == ComponentId);
+
+		Template.Class = Class;
+		Template.Data = TemplateData.schema_type;
+		NumMisses++;
+	}
+	else
+	{
+		NumHits++;
+	}
+
+	Worker_ComponentData Data = {};
+	Data.component_id = ComponentId;
+	Data.schema_type = Schema_CopyComponentData(Template.Data);
+	return Data;
+}
+
+void FEntityComponentTemplateCache::Reset()
+{
+	for (auto& TemplatePair : Templates)
+	{
+		if (TemplatePair.Value.Data != nullptr)
+		{
+			Schema_DestroyComponentData(TemplatePair.Value.Data);
+		}
+	}
+
+	Templates.Empty();
+}
+
+} // namespace SpatialGDK
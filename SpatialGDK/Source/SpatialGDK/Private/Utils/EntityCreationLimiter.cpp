@@ -0,0 +1,49 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityCreationLimiter.h"
+
+namespace SpatialGDK
+{
+
+FEntityCreationLimiter::FEntityCreationLimiter(int32 InMaxLimit, double InTargetLatencySeconds)
+	: MaxLimit(FMath::Max(InMaxLimit, MinLimit))
+	, TargetLatencySeconds(InTargetLatencySeconds)
+{
+	Limit = FMath::Min(static_cast<double>(InitialLimit), MaxLimit);
+}
+
+void FEntityCreationLimiter::OnRequestSent(Worker_RequestId RequestId, double Time)
+{
+	SentRequests.Add(RequestId, FSentRequest{ Time, NumDecreases });
+}
+
+void FEntityCreationLimiter::OnResponse(Worker_RequestId RequestId, Worker_StatusCode StatusCode, double Time)
+{
+	FSentRequest Request;
+	if (!SentRequests.RemoveAndCopyValue(RequestId, Request))
+	{
+		return;
+	}
+
+	const bool bOverloaded = StatusCode == WORKER_STATUS_CODE_TIMEOUT || Time - Request.Time > TargetLatencySeconds;
+	if (bOverloaded)
+	{
+		if (Request.NumDecreasesWhenSent == NumDecreases)
+		{
+			Limit = FMath::Max(FMath::FloorToDouble(Limit * 0.5), static_cast<double>(MinLimit));
+			NumDecreases++;
+			NumSucceededSinceChange = 0;
+		}
+	}
+	else if (StatusCode == WORKER_STATUS_CODE_SUCCESS)
+	{
+		// Grows the limit by one once a full limit's worth of requests has succeeded.
+		if (++NumSucceededSinceChange >= GetLimit())
+		{
+			Limit = FMath::Min(Limit + 1.0, MaxLimit);
+			NumSucceededSinceChange = 0;
+		}
+	}
+}
+
+} // namespace SpatialGDK
@@ -21,6 +21,7 @@
 #include "SpatialCommonTypes.h"
 #include "SpatialConstants.h"
 #include "Utils/ComponentFactory.h"
+#include "Utils/EntityComponentTemplateCache.h"
 #include "Utils/InspectionColors.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/SpatialActorUtils.h"
@@ -36,11 +37,12 @@ DEFINE_LOG_CATEGORY(LogEntityFactory);
 namespace SpatialGDK
 {
 
-EntityFactory::EntityFactory(USpatialNetDriver* InNetDriver, USpatialPackageMapClient* InPackageMap, USpatialClassInfoManager* InClassInfoManager, SpatialRPCService* InRPCService)
+EntityFactory::EntityFactory(USpatialNetDriver* InNetDriver, USpatialPackageMapClient* InPackageMap, USpatialClassInfoManager* InClassInfoManager, SpatialRPCService* InRPCService, FEntityComponentTemplateCache* InTemplateCache)
 	: NetDriver(InNetDriver)
 	, PackageMap(InPackageMap)
 	, ClassInfoManager(InClassInfoManager)
 	, RPCService(InRPCService)
+	, TemplateCache(InTemplateCache)
 { }
 
 TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActorChannel* Channel, FRPCsOnEntityCreationMap& OutgoingOnCreateEntityRPCs, uint32& OutBytesWritten)
@@ -205,9 +207,27 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 
 	TArray<FWorkerComponentData> ComponentDatas;
 	ComponentDatas.Add(Position(Coordinates::FromFVector(GetActorSpatialPosition(Actor))).CreatePositionData());
-	ComponentDatas.Add(Metadata(Class->GetName()).CreateMetadataData());
-	ComponentDatas.Add(SpawnData(Actor).CreateSpawnDataData());
-	ComponentDatas.Add(UnrealMetadata(StablyNamedObjectRef, Class->GetPathName(), bNetStartup).CreateUnrealMetadataData());
+	if (TemplateCache != nullptr)
+	{
+		ComponentDatas.Add(TemplateCache->CopyTemplate(Class, SpatialConstants::METADATA_COMPONENT_ID, [Class]()
+		{
+			return Metadata(Class->GetName()).CreateMetadataData();
+		}));
+		ComponentDatas.Add(SpawnData(Actor).CreateSpawnDataData());
+
+		FWorkerComponentData UnrealMetadataData = TemplateCache->CopyTemplate(Class, SpatialConstants::UNREAL_METADATA_COMPONENT_ID, [Class]()
+		{
+			return UnrealMetadata({}, Class->GetPathName(), {}).CreateUnrealMetadataData();
+		});
+		UnrealMetadata::AddInstanceFields(Schema_GetComponentDataFields(UnrealMetadataData.schema_type), StablyNamedObjectRef, bNetStartup);
+		ComponentDatas.Add(UnrealMetadataData);
+	}
+	else
+	{
+		ComponentDatas.Add(Metadata(Class->GetName()).CreateMetadataData());
+		ComponentDatas.Add(SpawnData(Actor).CreateSpawnDataData());
+		ComponentDatas.Add(UnrealMetadata(StablyNamedObjectRef, Class->GetPathName(), bNetStartup).CreateUnrealMetadataData());
+	}
 	ComponentDatas.Add(NetOwningClientWorker(GetConnectionOwningWorkerId(Channel->Actor)).CreateNetOwningClientWorkerData());
 	ComponentDatas.Add(AuthorityIntent::CreateAuthorityIntentData(IntendedVirtualWorkerId));
 
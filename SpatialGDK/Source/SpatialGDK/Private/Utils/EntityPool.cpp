@@ -5,6 +5,7 @@
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/SpatialMetrics.h"
 
 #include "TimerManager.h"
 
@@ -12,12 +13,28 @@ DEFINE_LOG_CATEGORY(LogSpatialEntityPool);
 
 using namespace SpatialGDK;
 
+namespace
+{
+	// Weight of the latest sample in the smoothed allocation rate and round trip time.
+	constexpr double EntityPoolSmoothingFactor = 0.3;
+	constexpr double AllocationRateSampleSeconds = 1.0;
+}
+
 void UEntityPool::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
 {
 	NetDriver = InNetDriver;
 	Receiver = InNetDriver->Receiver;
 	TimerManager = InTimerManager;
 
+	AllocationSampleStartTime = FPlatformTime::Seconds();
+
+	if (NetDriver->SpatialMetrics != nullptr)
+	{
+		UserSuppliedMetric EmptyPoolStallsDelegate;
+		EmptyPoolStallsDelegate.BindUObject(this, &UEntityPool::GetNumEmptyPoolStalls);
+		NetDriver->SpatialMetrics->SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_ENTITY_POOL_EMPTY_STALLS, EmptyPoolStallsDelegate);
+	}
+
 	ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolInitialReservationCount);
 }
 
@@ -25,13 +42,23 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 {
 	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Sending bulk entity ID Reservation Request for %d IDs"), EntitiesToReserve);
 
-	checkf(!bIsAwaitingResponse, TEXT("Trying to reserve Entity IDs while another reserve request is in flight"));
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const uint32 MaxReservationsInFlight = SpatialGDKSettings->bAdaptiveEntityPool ? SpatialGDKSettings->EntityPoolMaxReservationsInFlight : 1;
+	checkf(NumReservationsInFlight < MaxReservationsInFlight, TEXT("Trying to reserve Entity IDs while %u reserve requests are in flight"), NumReservationsInFlight);
+
+	const double RequestTime = FPlatformTime::Seconds();
 
 	// Set up reserve IDs delegate
 	ReserveEntityIDsDelegate CacheEntityIDsDelegate;
-	CacheEntityIDsDelegate.BindLambda([EntitiesToReserve, this](const Worker_ReserveEntityIdsResponseOp& Op)
+	CacheEntityIDsDelegate.BindLambda([EntitiesToReserve, RequestTime, this](const Worker_ReserveEntityIdsResponseOp& Op)
 	{
-		bIsAwaitingResponse = false;
+		NumReservationsInFlight--;
+		NumEntityIdsInFlight -= EntitiesToReserve;
+
+		const double RoundTripSeconds = FPlatformTime::Seconds() - RequestTime;
+		ReservationRoundTripSeconds = ReservationRoundTripSeconds == 0.0 ? RoundTripSeconds
+			: FMath::Lerp(ReservationRoundTripSeconds, RoundTripSeconds, EntityPoolSmoothingFactor);
+
 		if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 		{
 			// UNR-630 - Temporary hack to avoid failure to reserve entities due to timeout on large maps
@@ -85,7 +112,8 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 
 	// Reserve the Entity IDs
 	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(EntitiesToReserve);
-	bIsAwaitingResponse = true;
+	NumReservationsInFlight++;
+	NumEntityIdsInFlight += EntitiesToReserve;
 
 	// Add the spawn delegate
 	Receiver->AddReserveEntityIdsDelegate(ReserveRequestID, CacheEntityIDsDelegate);
@@ -116,10 +144,10 @@ void UEntityPool::OnEntityRangeExpired(uint32 ExpiringEntityRangeId)
 	else
 	{
 		// Reserve then cleanup
-		if (!bIsAwaitingResponse)
+		if (NumReservationsInFlight == 0)
 		{
 			UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Reserving new Entity range to replace Entity range ID: %d"), ExpiringEntityRangeId);
-			ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount);
+			ReserveEntityIDs(GetRefreshCount());
 		}
 		// Mark this entity range as expired, so it gets cleaned up when we receive a new entity range from Spatial.
 		ReservedEntityIDRanges[FoundEntityRangeIndex].bExpired = true;
@@ -128,36 +156,109 @@ void UEntityPool::OnEntityRangeExpired(uint32 ExpiringEntityRangeId)
 
 Worker_EntityId UEntityPool::GetNextEntityId()
 {
+	RecordAllocation();
+
 	if (ReservedEntityIDRanges.Num() == 0)
 	{
+		NumEmptyPoolStalls++;
+
 		// TODO: Improve error message
 		UE_LOG(LogSpatialEntityPool, Warning, TEXT("Tried to pop an entity ID from the pool when there were no entity IDs. Try altering your Entity Pool configuration"));
+		ReserveEntityIDsIfNeeded(0);
 		return SpatialConstants::INVALID_ENTITY_ID;
 	}
 
 	EntityRange& CurrentEntityRange = ReservedEntityIDRanges[0];
 	Worker_EntityId NextId = CurrentEntityRange.CurrentEntityId++;
 
-	uint32_t TotalRemainingEntityIds = 0;
-	for (EntityRange Range : ReservedEntityIDRanges)
+	const uint32 TotalRemainingEntityIds = GetNumRemainingEntityIds();
+
+	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Popped ID, %i IDs remaining"), TotalRemainingEntityIds);
+
+	ReserveEntityIDsIfNeeded(TotalRemainingEntityIds);
+
+	if (CurrentEntityRange.CurrentEntityId > CurrentEntityRange.LastEntityId)
+	{
+		ReservedEntityIDRanges.RemoveAt(0);
+	}
+
+	return NextId;
+}
+
+uint32 UEntityPool::GetNumRemainingEntityIds() const
+{
+	uint32 TotalRemainingEntityIds = 0;
+	for (const EntityRange& Range : ReservedEntityIDRanges)
 	{
 		TotalRemainingEntityIds += Range.LastEntityId - Range.CurrentEntityId + 1;
 	}
+	return TotalRemainingEntityIds;
+}
 
-	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Popped ID, %i IDs remaining"), TotalRemainingEntityIds);
+void UEntityPool::RecordAllocation()
+{
+	NumAllocationsInSample++;
 
-	if (TotalRemainingEntityIds < GetDefault<USpatialGDKSettings>()->EntityPoolRefreshThreshold && !bIsAwaitingResponse)
+	const double Now = FPlatformTime::Seconds();
+	const double SampleSeconds = Now - AllocationSampleStartTime;
+	if (SampleSeconds >= AllocationRateSampleSeconds)
 	{
-		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold, reserving more entity IDs"));
-		ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount);
+		AllocationRate = FMath::Lerp(AllocationRate, NumAllocationsInSample / SampleSeconds, EntityPoolSmoothingFactor);
+		AllocationSampleStartTime = Now;
+		NumAllocationsInSample = 0;
 	}
+}
 
-	if (CurrentEntityRange.CurrentEntityId > CurrentEntityRange.LastEntityId)
+void UEntityPool::ReserveEntityIDsIfNeeded(uint32 TotalRemainingEntityIds)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	if (!SpatialGDKSettings->bAdaptiveEntityPool)
 	{
-		ReservedEntityIDRanges.RemoveAt(0);
+		if (TotalRemainingEntityIds < SpatialGDKSettings->EntityPoolRefreshThreshold && NumReservationsInFlight == 0)
+		{
+			UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold, reserving more entity IDs"));
+			ReserveEntityIDs(SpatialGDKSettings->EntityPoolRefreshCount);
+		}
+		return;
 	}
 
-	return NextId;
+	// IDs that are already on their way count towards the threshold, so a burst doesn't send a request per allocation.
+	const uint32 RefreshThreshold = GetRefreshThreshold();
+	while (TotalRemainingEntityIds + NumEntityIdsInFlight < RefreshThreshold && NumReservationsInFlight < SpatialGDKSettings->EntityPoolMaxReservationsInFlight)
+	{
+		const uint32 RefreshCount = GetRefreshCount();
+		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold of %u, reserving %u entity IDs (allocation rate %.1f/s)"), RefreshThreshold, RefreshCount, AllocationRate);
+		ReserveEntityIDs(RefreshCount);
+	}
+}
+
+uint32 UEntityPool::GetRefreshThreshold() const
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bAdaptiveEntityPool)
+	{
+		return SpatialGDKSettings->EntityPoolRefreshThreshold;
+	}
+
+	// Enough IDs to keep allocating at the current rate for two round trips.
+	const double IdsUsedWhileWaiting = AllocationRate * ReservationRoundTripSeconds * 2.0;
+	return FMath::Max(SpatialGDKSettings->EntityPoolRefreshThreshold, static_cast<uint32>(FMath::Min(IdsUsedWhileWaiting, static_cast<double>(SpatialGDKSettings->EntityPoolMaxRefreshCount))));
+}
+
+uint32 UEntityPool::GetRefreshCount() const
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bAdaptiveEntityPool)
+	{
+		return SpatialGDKSettings->EntityPoolRefreshCount;
+	}
+
+	// Cover a few seconds of allocation at the current rate, so requests stay infrequent during sustained bursts.
+	constexpr double SecondsOfAllocationPerRequest = 5.0;
+	const double IdsForRate = AllocationRate * SecondsOfAllocationPerRequest;
+	const uint32 MaxRefreshCount = FMath::Max(SpatialGDKSettings->EntityPoolMaxRefreshCount, SpatialGDKSettings->EntityPoolRefreshCount);
+	return FMath::Clamp(static_cast<uint32>(FMath::Min(IdsForRate, static_cast<double>(MaxRefreshCount))), SpatialGDKSettings->EntityPoolRefreshCount, MaxRefreshCount);
 }
 
 FEntityPoolReadyEvent& UEntityPool::GetEntityPoolReadyDelegate()
@@ -0,0 +1,220 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityQueryCache.h"
+
+#include "Misc/SecureHash.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+template <typename T>
+void AppendBytes(TArray<uint8>& OutBytes, const T& Value)
+{
+	OutBytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+}
+
+void AppendConstraint(TArray<uint8>& OutBytes, const Worker_Constraint& Constraint)
+{
+	AppendBytes(OutBytes, Constraint.constraint_type);
+
+	switch (Constraint.constraint_type)
+	{
+	case WORKER_CONSTRAINT_TYPE_ENTITY_ID:
+		AppendBytes(OutBytes, Constraint.constraint.entity_id_constraint.entity_id);
+		break;
+	case WORKER_CONSTRAINT_TYPE_COMPONENT:
+		AppendBytes(OutBytes, Constraint.constraint.component_constraint.component_id);
+		break;
+	case WORKER_CONSTRAINT_TYPE_SPHERE:
+		AppendBytes(OutBytes, Constraint.constraint.sphere_constraint.x);
+		AppendBytes(OutBytes, Constraint.constraint.sphere_constraint.y);
+		AppendBytes(OutBytes, Constraint.constraint.sphere_constraint.z);
+		AppendBytes(OutBytes, Constraint.constraint.sphere_constraint.radius);
+		break;
+	case WORKER_CONSTRAINT_TYPE_AND:
+		AppendBytes(OutBytes, Constraint.constraint.and_constraint.constraint_count);
+		for (uint32 i = 0; i < Constraint.constraint.and_constraint.constraint_count; i++)
+		{
+			AppendConstraint(OutBytes, Constraint.constraint.and_constraint.constraints[i]);
+		}
+		break;
+	case WORKER_CONSTRAINT_TYPE_OR:
+		AppendBytes(OutBytes, Constraint.constraint.or_constraint.constraint_count);
+		for (uint32 i = 0; i < Constraint.constraint.or_constraint.constraint_count; i++)
+		{
+			AppendConstraint(OutBytes, Constraint.constraint.or_constraint.constraints[i]);
+		}
+		break;
+	case WORKER_CONSTRAINT_TYPE_NOT:
+		AppendConstraint(OutBytes, *Constraint.constraint.not_constraint.constraint);
+		break;
+	}
+}
+} // anonymous namespace
+
+FString FEntityQueryCache::GetQueryKey(const Worker_EntityQuery& Query)
+{
+	TArray<uint8> Bytes;
+	AppendConstraint(Bytes, Query.constraint);
+	AppendBytes(Bytes, Query.result_type);
+	if (Query.result_type == WORKER_RESULT_TYPE_SNAPSHOT)
+	{
+		AppendBytes(Bytes, Query.snapshot_result_type_component_id_count);
+		if (Query.snapshot_result_type_component_ids != nullptr)
+		{
+			Bytes.Append(reinterpret_cast<const uint8*>(Query.snapshot_result_type_component_ids), Query.snapshot_result_type_component_id_count * sizeof(Worker_ComponentId));
+		}
+	}
+
+	// Small queries are used as they are, larger ones are hashed to keep the keys short.
+	return Bytes.Num() <= 64 ? BytesToHex(Bytes.GetData(), Bytes.Num()) : FMD5::HashBytes(Bytes.GetData(), Bytes.Num());
+}
+
+bool FEntityQueryCache::AddToInFlightQuery(const FString& QueryKey, EntityQueryDelegate Delegate, double CacheLifetimeSeconds)
+{
+	const Worker_RequestId_Key* RequestId = InFlightRequestIds.Find(QueryKey);
+	if (RequestId == nullptr)
+	{
+		return false;
+	}
+
+	FInFlightQuery& Query = InFlightQueries.FindChecked(*RequestId);
+	Query.Delegates.Add(MoveTemp(Delegate));
+	Query.CacheLifetimeSeconds = FMath::Max(Query.CacheLifetimeSeconds, CacheLifetimeSeconds);
+	return true;
+}
+
+void FEntityQueryCache::OnQuerySent(const FString& QueryKey, Worker_RequestId RequestId, EntityQueryDelegate Delegate, double CacheLifetimeSeconds)
+{
+	InFlightRequestIds.Add(QueryKey, RequestId);
+
+	FInFlightQuery& Query = InFlightQueries.Add(RequestId);
+	Query.QueryKey = QueryKey;
+	Query.Delegates.Add(MoveTemp(Delegate));
+	Query.CacheLifetimeSeconds = CacheLifetimeSeconds;
+}
+
+bool FEntityQueryCache::OnQueryResponse(const Worker_EntityQueryResponseOp& Op, double Now)
+{
+	FInFlightQuery Query;
+	if (!InFlightQueries.RemoveAndCopyValue(Op.request_id, Query))
+	{
+		return false;
+	}
+	InFlightRequestIds.Remove(Query.QueryKey);
+
+	RemoveExpiredResponses(Now);
+
+	if (Op.status_code == WORKER_STATUS_CODE_SUCCESS && Query.CacheLifetimeSeconds > 0.0)
+	{
+		TSharedRef<FCachedResponse> Response = MakeShared<FCachedResponse>();
+		Response->RequestId = Op.request_id;
+		Response->ResultCount = Op.result_count;
+		Response->ResponseTime = Now;
+		Response->ExpiryTime = Now + Query.CacheLifetimeSeconds;
+
+		// Count queries have a result count but no results.
+		const uint32 NumResults = Op.results != nullptr ? Op.result_count : 0;
+		Response->Entities.Reserve(NumResults);
+		for (uint32 i = 0; i < NumResults; i++)
+		{
+			const Worker_Entity& Entity = Op.results[i];
+			FCachedEntity& CachedEntity = Response->Entities.AddDefaulted_GetRef();
+			CachedEntity.EntityId = Entity.entity_id;
+			CachedEntity.Components.Reserve(Entity.component_count);
+			for (uint32 j = 0; j < Entity.component_count; j++)
+			{
+				CachedEntity.Components.Add(ComponentData::CreateCopy(Entity.components[j].schema_type, Entity.components[j].component_id));
+			}
+		}
+
+		CachedResponses.Add(Query.QueryKey, Response);
+	}
+
+	for (const EntityQueryDelegate& Delegate : Query.Delegates)
+	{
+		Delegate.ExecuteIfBound(Op);
+	}
+
+	return true;
+}
+
+bool FEntityQueryCache::QueueCachedResponse(const FString& QueryKey, double MaxAgeSeconds, double Now, EntityQueryDelegate Delegate)
+{
+	RemoveExpiredResponses(Now);
+
+	const TSharedRef<const FCachedResponse>* Response = CachedResponses.Find(QueryKey);
+	if (Response == nullptr || Now - (*Response)->ResponseTime > MaxAgeSeconds)
+	{
+		return false;
+	}
+
+	QueuedDelegates.Emplace(*Response, MoveTemp(Delegate));
+	return true;
+}
+
+void FEntityQueryCache::ExecuteQueuedDelegates()
+{
+	// Delegates can send queries that are answered from the cache, which are executed the next time this is called.
+	TArray<TPair<TSharedRef<const FCachedResponse>, EntityQueryDelegate>> Delegates = MoveTemp(QueuedDelegates);
+	QueuedDelegates.Reset();
+
+	for (const auto& ResponseDelegate : Delegates)
+	{
+		ExecuteWithResponse(*ResponseDelegate.Key, ResponseDelegate.Value);
+	}
+}
+
+void FEntityQueryCache::ClearInFlightQueries()
+{
+	InFlightRequestIds.Empty();
+	InFlightQueries.Empty();
+}
+
+void FEntityQueryCache::ExecuteWithResponse(const FCachedResponse& Response, const EntityQueryDelegate& Delegate)
+{
+	// The data stays owned by the cached response, the op only points to it.
+	TArray<TArray<Worker_ComponentData>> ComponentData;
+	TArray<Worker_Entity> Entities;
+	ComponentData.SetNum(Response.Entities.Num());
+	Entities.SetNum(Response.Entities.Num());
+
+	for (int32 i = 0; i < Response.Entities.Num(); i++)
+	{
+		const FCachedEntity& CachedEntity = Response.Entities[i];
+		for (const SpatialGDK::ComponentData& Component : CachedEntity.Components)
+		{
+			Worker_ComponentData& Data = ComponentData[i].AddZeroed_GetRef();
+			Data.component_id = Component.GetComponentId();
+			Data.schema_type = Component.GetUnderlying();
+		}
+
+		Entities[i].entity_id = CachedEntity.EntityId;
+		Entities[i].component_count = ComponentData[i].Num();
+		Entities[i].components = ComponentData[i].GetData();
+	}
+
+	Worker_EntityQueryResponseOp Op{};
+	Op.request_id = Response.RequestId;
+	Op.status_code = WORKER_STATUS_CODE_SUCCESS;
+	Op.message = "";
+	Op.result_count = Response.ResultCount;
+	Op.results = Entities.Num() > 0 ? Entities.GetData() : nullptr;
+
+	Delegate.ExecuteIfBound(Op);
+}
+
+void FEntityQueryCache::RemoveExpiredResponses(double Now)
+{
+	for (auto It = CachedResponses.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->ExpiryTime <= Now)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/GeneratedSerializers.h"
+
+#include "Net/RepLayout.h"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialGeneratedSerializers);
+
+namespace SpatialGDK
+{
+
+FGeneratedSerializerRegistry& FGeneratedSerializerRegistry::Get()
+{
+	static FGeneratedSerializerRegistry Registry;
+	return Registry;
+}
+
+void FGeneratedSerializerRegistry::Register(const TCHAR* ClassPath, TArrayView<const FGeneratedPropertySerializer> Properties)
+{
+	PropertiesByClassPath.Add(ClassPath, Properties);
+}
+
+void FGeneratedSerializerRegistry::Unregister(const TCHAR* ClassPath)
+{
+	PropertiesByClassPath.Remove(ClassPath);
+}
+
+bool FGeneratedSerializerRegistry::ApplyToReplicationPlan(const UClass& Class, const FRepLayout& RepLayout, TArray<FReplicationPlanEntry>& InOutReplicationPlan) const
+{
+	const TArrayView<const FGeneratedPropertySerializer>* Properties = PropertiesByClassPath.Find(Class.GetPathName());
+	if (Properties == nullptr || InOutReplicationPlan.Num() != RepLayout.Cmds.Num())
+	{
+		return false;
+	}
+
+	TArray<TPair<int32, const FGeneratedPropertySerializer*>> Entries;
+	Entries.Reserve(Properties->Num());
+
+	for (const FGeneratedPropertySerializer& Serializer : *Properties)
+	{
+		const int32 HandleIndex = static_cast<int32>(Serializer.Handle) - 1;
+		const int32 CmdIndex = RepLayout.BaseHandleToCmdIndex.IsValidIndex(HandleIndex) ? RepLayout.BaseHandleToCmdIndex[HandleIndex].CmdIndex : INDEX_NONE;
+		const UProperty* Property = RepLayout.Cmds.IsValidIndex(CmdIndex) ? RepLayout.Cmds[CmdIndex].Property : nullptr;
+
+		if (Property == nullptr
+			|| RepLayout.Cmds[CmdIndex].Type == ERepLayoutCmdType::DynamicArray
+			|| Property->GetName() != Serializer.PropertyName
+			|| Property->GetClass()->GetName() != Serializer.PropertyClassName)
+		{
+			UE_LOG(LogSpatialGeneratedSerializers, Warning, TEXT("The generated serializers of %s don't match its replicated property with handle %d, they will not be used. Generate schema to update them."),
+				*Class.GetPathName(), Serializer.Handle);
+			return false;
+		}
+
+		Entries.Emplace(CmdIndex, &Serializer);
+	}
+
+	for (const TPair<int32, const FGeneratedPropertySerializer*>& Entry : Entries)
+	{
+		InOutReplicationPlan[Entry.Key] = FReplicationPlanEntry{ Entry.Value->Write, Entry.Value->Read };
+	}
+
+	UE_LOG(LogSpatialGeneratedSerializers, Verbose, TEXT("Using %d generated serializers for %s."), Entries.Num(), *Class.GetPathName());
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,84 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HeartbeatManager.h"
+
+#include "EngineClasses/SpatialNetConnection.h"
+
+namespace SpatialGDK
+{
+
+FHeartbeatManager::FHeartbeatManager(double InTimeoutSeconds)
+	: TimeoutSeconds(InTimeoutSeconds)
+{
+}
+
+void FHeartbeatManager::AddConnection(USpatialNetConnection* Connection, double Now)
+{
+	if (const int32* Index = ConnectionIndices.Find(Connection))
+	{
+		// The entry may belong to a destroyed connection whose address has been reused.
+		Connections[*Index] = Connection;
+		LastHeartbeatTimes[*Index] = Now;
+		return;
+	}
+
+	ConnectionIndices.Add(Connection, Connections.Num());
+	ConnectionKeys.Add(Connection);
+	Connections.Add(Connection);
+	LastHeartbeatTimes.Add(Now);
+}
+
+void FHeartbeatManager::RemoveConnection(const USpatialNetConnection* Connection)
+{
+	if (const int32* Index = ConnectionIndices.Find(Connection))
+	{
+		RemoveAtSwap(*Index);
+	}
+}
+
+void FHeartbeatManager::OnHeartbeat(const USpatialNetConnection* Connection, double Now)
+{
+	if (const int32* Index = ConnectionIndices.Find(Connection))
+	{
+		LastHeartbeatTimes[*Index] = Now;
+	}
+}
+
+TArray<USpatialNetConnection*> FHeartbeatManager::RemoveTimedOutConnections(double Now)
+{
+	TArray<USpatialNetConnection*> TimedOutConnections;
+
+	const double OldestValidHeartbeatTime = Now - TimeoutSeconds;
+	for (int32 Index = LastHeartbeatTimes.Num() - 1; Index >= 0; Index--)
+	{
+		if (LastHeartbeatTimes[Index] >= OldestValidHeartbeatTime && Connections[Index].IsValid())
+		{
+			continue;
+		}
+
+		if (USpatialNetConnection* Connection = Connections[Index].Get())
+		{
+			TimedOutConnections.Add(Connection);
+		}
+		RemoveAtSwap(Index);
+	}
+
+	return TimedOutConnections;
+}
+
+void FHeartbeatManager::RemoveAtSwap(int32 Index)
+{
+	ConnectionIndices.Remove(ConnectionKeys[Index]);
+
+	const int32 LastIndex = Connections.Num() - 1;
+	if (Index != LastIndex)
+	{
+		ConnectionIndices[ConnectionKeys[LastIndex]] = Index;
+	}
+
+	ConnectionKeys.RemoveAtSwap(Index);
+	Connections.RemoveAtSwap(Index);
+	LastHeartbeatTimes.RemoveAtSwap(Index);
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,194 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HitchCapture.h"
+
+#include "Utils/OpUtils.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+const TCHAR* const SubsystemNames[] = {
+	TEXT("TickDispatch"),
+	TEXT("CriticalSection"),
+	TEXT("ReplicateActor"),
+	TEXT("ComponentFactory"),
+	TEXT("RPCServiceFlush"),
+	TEXT("InterestUpdate"),
+	TEXT("LoadBalanceEnforcement"),
+	TEXT("ConnectionReceive"),
+	TEXT("ConnectionSend"),
+};
+static_assert(UE_ARRAY_COUNT(SubsystemNames) == static_cast<int32>(EGDKSubsystem::Count), "Every subsystem needs a name");
+
+constexpr int32 MaxComponentsPerFrame = 8;
+
+TAtomic<uint64> SubsystemCycles[static_cast<int32>(EGDKSubsystem::Count)];
+
+uint32 Delta(uint64 Total, uint64 LastTotal)
+{
+	return static_cast<uint32>(FMath::Min<uint64>(Total - LastTotal, MAX_uint32));
+}
+} // anonymous namespace
+
+TAtomic<int32> FHitchCapture::NumSubsystemTimingUsers{ 0 };
+
+FHitchCapture::FHitchCapture(int32 InMaxFrames, float InHitchThresholdMs, float InMinSecondsBetweenHitches)
+	: MaxFrames(FMath::Max(InMaxFrames, 1))
+	, HitchThresholdMs(InHitchThresholdMs)
+	, MinSecondsBetweenHitches(InMinSecondsBetweenHitches)
+{
+	Frames.Reserve(MaxFrames);
+	NumSubsystemTimingUsers++;
+}
+
+FHitchCapture::~FHitchCapture()
+{
+	NumSubsystemTimingUsers--;
+}
+
+void FHitchCapture::AddSubsystemCycles(EGDKSubsystem Subsystem, uint64 Cycles)
+{
+	SubsystemCycles[static_cast<int32>(Subsystem)].AddExchange(Cycles);
+}
+
+void FHitchCapture::RecordOp(const Worker_Op& Op)
+{
+	bool bIsComponentOp = true;
+	switch (Op.op_type)
+	{
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		CurrentFrame.AddEntityOps++;
+		bIsComponentOp = false;
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		CurrentFrame.RemoveEntityOps++;
+		bIsComponentOp = false;
+		break;
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		CurrentFrame.AddComponentOps++;
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		CurrentFrame.RemoveComponentOps++;
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		CurrentFrame.ComponentUpdateOps++;
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		CurrentFrame.AuthorityChangeOps++;
+		break;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		CurrentFrame.CommandOps++;
+		bIsComponentOp = false;
+		break;
+	default:
+		CurrentFrame.OtherOps++;
+		bIsComponentOp = false;
+		break;
+	}
+
+	if (bIsComponentOp)
+	{
+		CurrentFrame.OpsByComponent.FindOrAdd(GetComponentId(&Op))++;
+	}
+}
+
+bool FHitchCapture::EndFrame(uint64 FrameNumber, float FrameTimeSeconds, const FHitchCaptureTotals& Totals, double NowSeconds)
+{
+	const float FrameTimeMs = FrameTimeSeconds * 1000.f;
+	CurrentFrame.FrameNumber = FrameNumber;
+	CurrentFrame.FrameTimeMs = FrameTimeMs;
+
+	// The first frame has nothing to diff against, so its RPCs and messages are left at 0.
+	if (bHasLastTotals)
+	{
+		CurrentFrame.RPCsSent = Delta(Totals.RPCsSent, LastTotals.RPCsSent);
+		CurrentFrame.RPCsReceived = Delta(Totals.RPCsReceived, LastTotals.RPCsReceived);
+		CurrentFrame.OutgoingMessagesQueued = Delta(Totals.OutgoingMessagesQueued, LastTotals.OutgoingMessagesQueued);
+	}
+	CurrentFrame.OutgoingMessageQueueDepth = Totals.OutgoingMessageQueueDepth;
+	LastTotals = Totals;
+	bHasLastTotals = true;
+
+	for (int32 SubsystemIndex = 0; SubsystemIndex < static_cast<int32>(EGDKSubsystem::Count); SubsystemIndex++)
+	{
+		const uint64 Cycles = SubsystemCycles[SubsystemIndex].Exchange(0);
+		CurrentFrame.SubsystemTimeMs[SubsystemIndex] = static_cast<float>(FPlatformTime::ToMilliseconds64(Cycles));
+	}
+
+	if (Frames.Num() < MaxFrames)
+	{
+		Frames.Add(MoveTemp(CurrentFrame));
+	}
+	else
+	{
+		Frames[OldestFrameIndex] = MoveTemp(CurrentFrame);
+		OldestFrameIndex = (OldestFrameIndex + 1) % MaxFrames;
+	}
+	CurrentFrame = FHitchCaptureFrame();
+
+	if (HitchThresholdMs <= 0.f || FrameTimeMs < HitchThresholdMs)
+	{
+		return false;
+	}
+
+	if (LastHitchTime >= 0.0 && NowSeconds - LastHitchTime < MinSecondsBetweenHitches)
+	{
+		return false;
+	}
+
+	LastHitchTime = NowSeconds;
+	return true;
+}
+
+TArray<const FHitchCaptureFrame*> FHitchCapture::GetFrames() const
+{
+	TArray<const FHitchCaptureFrame*> OrderedFrames;
+	OrderedFrames.Reserve(Frames.Num());
+	for (int32 i = 0; i < Frames.Num(); i++)
+	{
+		OrderedFrames.Add(&Frames[(OldestFrameIndex + i) % Frames.Num()]);
+	}
+	return OrderedFrames;
+}
+
+FString FHitchCapture::ToCsv() const
+{
+	FString Csv = TEXT("Frame,FrameTimeMs,AddEntityOps,RemoveEntityOps,AddComponentOps,RemoveComponentOps,ComponentUpdateOps,AuthorityChangeOps,CommandOps,OtherOps,"
+		"RPCsSent,RPCsReceived,OutgoingMessagesQueued,OutgoingMessageQueueDepth");
+	for (const TCHAR* SubsystemName : SubsystemNames)
+	{
+		Csv += FString::Printf(TEXT(",%sMs"), SubsystemName);
+	}
+	Csv += TEXT(",OpsByComponent\n");
+
+	for (const FHitchCaptureFrame* Frame : GetFrames())
+	{
+		Csv += FString::Printf(TEXT("%llu,%.3f,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u"), Frame->FrameNumber, Frame->FrameTimeMs,
+			Frame->AddEntityOps, Frame->RemoveEntityOps, Frame->AddComponentOps, Frame->RemoveComponentOps, Frame->ComponentUpdateOps,
+			Frame->AuthorityChangeOps, Frame->CommandOps, Frame->OtherOps,
+			Frame->RPCsSent, Frame->RPCsReceived, Frame->OutgoingMessagesQueued, Frame->OutgoingMessageQueueDepth);
+		for (float SubsystemTimeMs : Frame->SubsystemTimeMs)
+		{
+			Csv += FString::Printf(TEXT(",%.3f"), SubsystemTimeMs);
+		}
+
+		TArray<TPair<Worker_ComponentId, uint32>> Components = Frame->OpsByComponent.Array();
+		Components.Sort([](const TPair<Worker_ComponentId, uint32>& A, const TPair<Worker_ComponentId, uint32>& B)
+		{
+			return A.Value > B.Value;
+		});
+		Csv += TEXT(",");
+		for (int32 i = 0; i < FMath::Min(Components.Num(), MaxComponentsPerFrame); i++)
+		{
+			Csv += FString::Printf(TEXT("%s%u:%u"), i > 0 ? TEXT(" ") : TEXT(""), Components[i].Key, Components[i].Value);
+		}
+		Csv += TEXT("\n");
+	}
+
+	return Csv;
+}
+
+} // namespace SpatialGDK
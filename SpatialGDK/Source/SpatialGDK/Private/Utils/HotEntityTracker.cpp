@@ -0,0 +1,133 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HotEntityTracker.h"
+
+namespace SpatialGDK
+{
+
+FHotEntityTracker::FHotEntityTracker(float InWindowSeconds)
+	: WindowSeconds(FMath::Max(InWindowSeconds, 0.1f))
+	, BucketSeconds(WindowSeconds / NumBuckets)
+{
+}
+
+int64 FHotEntityTracker::GetBucket(double Now) const
+{
+	return static_cast<int64>(FMath::FloorToDouble(Now / BucketSeconds));
+}
+
+void FHotEntityTracker::Record(Worker_EntityId EntityId, EHotEntityCounter Counter, double Now, uint32 Count /* = 1 */)
+{
+	const int64 Bucket = GetBucket(Now);
+
+	FEntityCounts* EntityCounts = Entities.Find(EntityId);
+	if (EntityCounts == nullptr)
+	{
+		EntityCounts = &Entities.Add(EntityId);
+		EntityCounts->NewestBucket = Bucket;
+	}
+
+	// Clear the buckets that were skipped since the last record, which are reused for the current time.
+	if (Bucket > EntityCounts->NewestBucket)
+	{
+		const int64 NumExpired = FMath::Min<int64>(Bucket - EntityCounts->NewestBucket, NumBuckets);
+		for (int64 Expired = 1; Expired <= NumExpired; Expired++)
+		{
+			const int32 BucketIndex = static_cast<int32>((EntityCounts->NewestBucket + Expired) % NumBuckets);
+			for (uint32(&CounterBuckets)[NumBuckets] : EntityCounts->Counts)
+			{
+				CounterBuckets[BucketIndex] = 0;
+			}
+		}
+		EntityCounts->NewestBucket = Bucket;
+	}
+
+	// Time going backwards is counted in the newest bucket.
+	uint32& BucketCount = EntityCounts->Counts[static_cast<int32>(Counter)][EntityCounts->NewestBucket % NumBuckets];
+	BucketCount = static_cast<uint32>(FMath::Min<uint64>(static_cast<uint64>(BucketCount) + Count, MAX_uint32));
+}
+
+float FHotEntityTracker::GetRate(const FEntityCounts& EntityCounts, EHotEntityCounter Counter, int64 CurrentBucket) const
+{
+	uint64 Total = 0;
+	for (int64 Bucket = CurrentBucket - NumBuckets + 1; Bucket <= CurrentBucket; Bucket++)
+	{
+		// Buckets past the newest one haven't been recorded into, and those a window before it have been cleared.
+		if (Bucket <= EntityCounts.NewestBucket && Bucket > EntityCounts.NewestBucket - NumBuckets)
+		{
+			Total += EntityCounts.Counts[static_cast<int32>(Counter)][Bucket % NumBuckets];
+		}
+	}
+	return Total / WindowSeconds;
+}
+
+float FHotEntityTracker::GetRate(Worker_EntityId EntityId, EHotEntityCounter Counter, double Now) const
+{
+	const FEntityCounts* EntityCounts = Entities.Find(EntityId);
+	return EntityCounts != nullptr ? GetRate(*EntityCounts, Counter, GetBucket(Now)) : 0.f;
+}
+
+TArray<FHotEntity> FHotEntityTracker::GetTopEntities(EHotEntityCounter Counter, int32 K, double Now) const
+{
+	TArray<FHotEntity> TopEntities = GetEntitiesAtOrAbove(Counter, SMALL_NUMBER, Now);
+	TopEntities.Sort([](const FHotEntity& A, const FHotEntity& B)
+	{
+		return A.Rate > B.Rate;
+	});
+	if (TopEntities.Num() > K)
+	{
+		TopEntities.SetNum(FMath::Max(K, 0));
+	}
+	return TopEntities;
+}
+
+TArray<FHotEntity> FHotEntityTracker::GetEntitiesAtOrAbove(EHotEntityCounter Counter, float Threshold, double Now) const
+{
+	const int64 CurrentBucket = GetBucket(Now);
+
+	TArray<FHotEntity> HotEntities;
+	for (const TPair<Worker_EntityId_Key, FEntityCounts>& Entity : Entities)
+	{
+		const float Rate = GetRate(Entity.Value, Counter, CurrentBucket);
+		if (Rate >= Threshold)
+		{
+			HotEntities.Add(FHotEntity{ Entity.Key, Rate });
+		}
+	}
+	return HotEntities;
+}
+
+void FHotEntityTracker::RemoveEntity(Worker_EntityId EntityId)
+{
+	Entities.Remove(EntityId);
+}
+
+void FHotEntityTracker::RemoveInactiveEntities(double Now)
+{
+	const int64 CurrentBucket = GetBucket(Now);
+	for (auto It = Entities.CreateIterator(); It; ++It)
+	{
+		if (It.Value().NewestBucket <= CurrentBucket - NumBuckets)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+const TCHAR* FHotEntityTracker::GetCounterName(EHotEntityCounter Counter)
+{
+	switch (Counter)
+	{
+	case EHotEntityCounter::OutgoingUpdates:
+		return TEXT("OutgoingUpdates");
+	case EHotEntityCounter::OutgoingRPCs:
+		return TEXT("OutgoingRPCs");
+	case EHotEntityCounter::IncomingOps:
+		return TEXT("IncomingOps");
+	default:
+		checkNoEntry();
+		return TEXT("");
+	}
+}
+
+} // namespace SpatialGDK
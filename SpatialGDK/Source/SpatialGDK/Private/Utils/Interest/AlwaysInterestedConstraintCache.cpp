@@ -0,0 +1,30 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/Interest/AlwaysInterestedConstraintCache.h"
+
+namespace SpatialGDK
+{
+
+QueryConstraint FAlwaysInterestedConstraintCache::FindOrBuild(const Worker_EntityId EntityId, TFunctionRef<bool(QueryConstraint&)> BuildConstraint)
+{
+	if (const QueryConstraint* CachedConstraint = CachedConstraints.Find(EntityId))
+	{
+		NumCacheHits++;
+		return *CachedConstraint;
+	}
+
+	QueryConstraint Constraint;
+	if (BuildConstraint(Constraint))
+	{
+		CachedConstraints.Add(EntityId, Constraint);
+	}
+
+	return Constraint;
+}
+
+void FAlwaysInterestedConstraintCache::Invalidate(const Worker_EntityId EntityId)
+{
+	CachedConstraints.Remove(EntityId);
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,541 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/Interest/InterestQueryOptimizer.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+bool HasLeafConstraint(const QueryConstraint& Constraint)
+{
+	return Constraint.SphereConstraint.IsSet()
+		|| Constraint.CylinderConstraint.IsSet()
+		|| Constraint.BoxConstraint.IsSet()
+		|| Constraint.RelativeSphereConstraint.IsSet()
+		|| Constraint.RelativeCylinderConstraint.IsSet()
+		|| Constraint.RelativeBoxConstraint.IsSet()
+		|| Constraint.EntityIdConstraint.IsSet()
+		|| Constraint.ComponentConstraint.IsSet();
+}
+
+bool IsEdgeLengthWithin(const EdgeLength& Inner, const EdgeLength& Outer)
+{
+	return Inner.X <= Outer.X && Inner.Y <= Outer.Y && Inner.Z <= Outer.Z;
+}
+
+bool IsBoxOnly(const QueryConstraint& Constraint)
+{
+	return Constraint.BoxConstraint.IsSet()
+		&& !Constraint.SphereConstraint.IsSet()
+		&& !Constraint.CylinderConstraint.IsSet()
+		&& !Constraint.RelativeSphereConstraint.IsSet()
+		&& !Constraint.RelativeCylinderConstraint.IsSet()
+		&& !Constraint.RelativeBoxConstraint.IsSet()
+		&& !Constraint.EntityIdConstraint.IsSet()
+		&& !Constraint.ComponentConstraint.IsSet()
+		&& Constraint.AndConstraint.Num() == 0
+		&& Constraint.OrConstraint.Num() == 0;
+}
+
+// Boxes built from adjacent cells don't share their edges exactly after converting to spatial coordinates.
+// Merging boxes this far apart at most adds a sliver of this width to the interest region.
+const double BoxAdjacencyToleranceMeters = 0.001;
+
+struct FBoxExtents
+{
+	double Min[3];
+	double Max[3];
+};
+
+FBoxExtents GetBoxExtents(const BoxConstraint& Box)
+{
+	const double Center[3] = { Box.Center.X, Box.Center.Y, Box.Center.Z };
+	const double Edges[3] = { Box.EdgeLength.X, Box.EdgeLength.Y, Box.EdgeLength.Z };
+
+	FBoxExtents Extents;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Extents.Min[Axis] = Center[Axis] - Edges[Axis] * 0.5;
+		Extents.Max[Axis] = Center[Axis] + Edges[Axis] * 0.5;
+	}
+	return Extents;
+}
+
+QueryConstraint MakeBoxConstraint(const FBoxExtents& Extents)
+{
+	QueryConstraint Constraint;
+	Constraint.BoxConstraint = BoxConstraint{
+		Coordinates{ (Extents.Min[0] + Extents.Max[0]) * 0.5, (Extents.Min[1] + Extents.Max[1]) * 0.5, (Extents.Min[2] + Extents.Max[2]) * 0.5 },
+		EdgeLength{ Extents.Max[0] - Extents.Min[0], Extents.Max[1] - Extents.Min[1], Extents.Max[2] - Extents.Min[2] }
+	};
+	return Constraint;
+}
+
+bool IsBoxWithin(const BoxConstraint& Inner, const BoxConstraint& Outer)
+{
+	const FBoxExtents InnerExtents = GetBoxExtents(Inner);
+	const FBoxExtents OuterExtents = GetBoxExtents(Outer);
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (InnerExtents.Min[Axis] < OuterExtents.Min[Axis] || InnerExtents.Max[Axis] > OuterExtents.Max[Axis])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Two boxes can be replaced by their bounding box if they line up on two axes and touch or overlap on the third.
+bool TryMergeBoxes(const FBoxExtents& A, const FBoxExtents& B, FBoxExtents& OutMerged)
+{
+	int32 NumAlignedAxes = 0;
+	int32 UnalignedAxis = INDEX_NONE;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (FMath::Abs(A.Min[Axis] - B.Min[Axis]) <= BoxAdjacencyToleranceMeters && FMath::Abs(A.Max[Axis] - B.Max[Axis]) <= BoxAdjacencyToleranceMeters)
+		{
+			NumAlignedAxes++;
+		}
+		else
+		{
+			UnalignedAxis = Axis;
+		}
+	}
+
+	if (NumAlignedAxes < 2)
+	{
+		return false;
+	}
+
+	if (UnalignedAxis != INDEX_NONE
+		&& (A.Max[UnalignedAxis] + BoxAdjacencyToleranceMeters < B.Min[UnalignedAxis] || B.Max[UnalignedAxis] + BoxAdjacencyToleranceMeters < A.Min[UnalignedAxis]))
+	{
+		return false;
+	}
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		OutMerged.Min[Axis] = FMath::Min(A.Min[Axis], B.Min[Axis]);
+		OutMerged.Max[Axis] = FMath::Max(A.Max[Axis], B.Max[Axis]);
+	}
+	return true;
+}
+
+QueryConstraint MakeConjunction(const TArray<QueryConstraint>& Conjuncts)
+{
+	if (Conjuncts.Num() == 1)
+	{
+		return Conjuncts[0];
+	}
+
+	QueryConstraint Conjunction;
+	Conjunction.AndConstraint = Conjuncts;
+	return Conjunction;
+}
+
+} // anonymous namespace
+
+void InterestQueryOptimizer::OptimizeInterest(Interest& OutInterest)
+{
+	for (auto& ComponentInterestPair : OutInterest.ComponentInterestMap)
+	{
+		OptimizeQueries(ComponentInterestPair.Value.Queries);
+	}
+}
+
+void InterestQueryOptimizer::OptimizeQueries(TArray<Query>& OutQueries)
+{
+	for (Query& QueryToSimplify : OutQueries)
+	{
+		QueryToSimplify.Constraint = SimplifyConstraint(QueryToSimplify.Constraint);
+	}
+
+	// Queries with the same constraint and result only need the highest of their frequencies.
+	for (int32 i = 0; i < OutQueries.Num(); i++)
+	{
+		for (int32 j = OutQueries.Num() - 1; j > i; j--)
+		{
+			if (HasSameResult(OutQueries[i], OutQueries[j]) && OutQueries[i].Constraint == OutQueries[j].Constraint)
+			{
+				if (!IsFrequencyAtLeast(OutQueries[i].Frequency, OutQueries[j].Frequency))
+				{
+					OutQueries[i].Frequency = OutQueries[j].Frequency;
+				}
+				OutQueries.RemoveAt(j);
+			}
+		}
+	}
+
+	// A query contained in another query with at least the same frequency doesn't check out anything more, and the runtime
+	// already uses the highest frequency of all queries matching an entity-component.
+	for (int32 i = OutQueries.Num() - 1; i >= 0; i--)
+	{
+		for (int32 j = 0; j < OutQueries.Num(); j++)
+		{
+			if (i != j
+				&& HasSameResult(OutQueries[i], OutQueries[j])
+				&& IsFrequencyAtLeast(OutQueries[j].Frequency, OutQueries[i].Frequency)
+				&& IsConstraintSubsetOf(OutQueries[i].Constraint, OutQueries[j].Constraint))
+			{
+				OutQueries.RemoveAt(i);
+				break;
+			}
+		}
+	}
+
+	// Queries with the same result and frequency are merged into a single disjunction.
+	for (int32 i = 0; i < OutQueries.Num(); i++)
+	{
+		TArray<QueryConstraint> Disjuncts;
+		for (int32 j = i + 1; j < OutQueries.Num();)
+		{
+			if (HasSameResult(OutQueries[i], OutQueries[j]) && OutQueries[i].Frequency == OutQueries[j].Frequency)
+			{
+				Disjuncts.Add(MoveTemp(OutQueries[j].Constraint));
+				OutQueries.RemoveAt(j);
+			}
+			else
+			{
+				j++;
+			}
+		}
+
+		if (Disjuncts.Num() > 0)
+		{
+			Disjuncts.Insert(MoveTemp(OutQueries[i].Constraint), 0);
+			OutQueries[i].Constraint = SimplifyDisjunction(Disjuncts);
+		}
+	}
+}
+
+int32 InterestQueryOptimizer::CountQueries(const Interest& InInterest)
+{
+	int32 NumQueries = 0;
+	for (const auto& ComponentInterestPair : InInterest.ComponentInterestMap)
+	{
+		NumQueries += ComponentInterestPair.Value.Queries.Num();
+	}
+	return NumQueries;
+}
+
+QueryConstraint InterestQueryOptimizer::SimplifyConstraint(const QueryConstraint& Constraint)
+{
+	if (IsConjunction(Constraint))
+	{
+		return SimplifyConjunction(Constraint.AndConstraint);
+	}
+
+	if (IsDisjunction(Constraint))
+	{
+		return SimplifyDisjunction(Constraint.OrConstraint);
+	}
+
+	return Constraint;
+}
+
+bool InterestQueryOptimizer::IsConstraintSubsetOf(const QueryConstraint& Inner, const QueryConstraint& Outer)
+{
+	if (Inner == Outer)
+	{
+		return true;
+	}
+
+	// These two decompositions are exact, so try them before the ones that are only sufficient.
+	if (IsDisjunction(Inner))
+	{
+		for (const QueryConstraint& Disjunct : Inner.OrConstraint)
+		{
+			if (!IsConstraintSubsetOf(Disjunct, Outer))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	if (IsConjunction(Outer))
+	{
+		for (const QueryConstraint& Conjunct : Outer.AndConstraint)
+		{
+			if (!IsConstraintSubsetOf(Inner, Conjunct))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	if (IsDisjunction(Outer))
+	{
+		for (const QueryConstraint& Disjunct : Outer.OrConstraint)
+		{
+			if (IsConstraintSubsetOf(Inner, Disjunct))
+			{
+				return true;
+			}
+		}
+	}
+
+	if (IsConjunction(Inner))
+	{
+		for (const QueryConstraint& Conjunct : Inner.AndConstraint)
+		{
+			if (IsConstraintSubsetOf(Conjunct, Outer))
+			{
+				return true;
+			}
+		}
+	}
+
+	return IsLeafSubsetOf(Inner, Outer);
+}
+
+bool InterestQueryOptimizer::IsConjunction(const QueryConstraint& Constraint)
+{
+	return Constraint.AndConstraint.Num() > 0 && Constraint.OrConstraint.Num() == 0 && !HasLeafConstraint(Constraint);
+}
+
+bool InterestQueryOptimizer::IsDisjunction(const QueryConstraint& Constraint)
+{
+	return Constraint.OrConstraint.Num() > 0 && Constraint.AndConstraint.Num() == 0 && !HasLeafConstraint(Constraint);
+}
+
+bool InterestQueryOptimizer::IsLeafSubsetOf(const QueryConstraint& Inner, const QueryConstraint& Outer)
+{
+	if (Inner.AndConstraint.Num() > 0 || Inner.OrConstraint.Num() > 0 || Outer.AndConstraint.Num() > 0 || Outer.OrConstraint.Num() > 0)
+	{
+		return false;
+	}
+
+	if (Inner.RelativeSphereConstraint.IsSet() && Outer.RelativeSphereConstraint.IsSet())
+	{
+		return Inner.RelativeSphereConstraint->Radius <= Outer.RelativeSphereConstraint->Radius;
+	}
+
+	if (Inner.RelativeCylinderConstraint.IsSet() && Outer.RelativeCylinderConstraint.IsSet())
+	{
+		return Inner.RelativeCylinderConstraint->Radius <= Outer.RelativeCylinderConstraint->Radius;
+	}
+
+	if (Inner.RelativeBoxConstraint.IsSet() && Outer.RelativeBoxConstraint.IsSet())
+	{
+		return IsEdgeLengthWithin(Inner.RelativeBoxConstraint->EdgeLength, Outer.RelativeBoxConstraint->EdgeLength);
+	}
+
+	if (Inner.SphereConstraint.IsSet() && Outer.SphereConstraint.IsSet())
+	{
+		const Coordinates& InnerCenter = Inner.SphereConstraint->Center;
+		const Coordinates& OuterCenter = Outer.SphereConstraint->Center;
+		const double CenterDistance = FMath::Sqrt(FMath::Square(InnerCenter.X - OuterCenter.X) + FMath::Square(InnerCenter.Y - OuterCenter.Y) + FMath::Square(InnerCenter.Z - OuterCenter.Z));
+		return CenterDistance + Inner.SphereConstraint->Radius <= Outer.SphereConstraint->Radius;
+	}
+
+	// Cylinders are unbounded along the Y (up) axis.
+	if (Inner.CylinderConstraint.IsSet() && Outer.CylinderConstraint.IsSet())
+	{
+		const Coordinates& InnerCenter = Inner.CylinderConstraint->Center;
+		const Coordinates& OuterCenter = Outer.CylinderConstraint->Center;
+		const double CenterDistance = FMath::Sqrt(FMath::Square(InnerCenter.X - OuterCenter.X) + FMath::Square(InnerCenter.Z - OuterCenter.Z));
+		return CenterDistance + Inner.CylinderConstraint->Radius <= Outer.CylinderConstraint->Radius;
+	}
+
+	if (Inner.BoxConstraint.IsSet() && Outer.BoxConstraint.IsSet())
+	{
+		return IsBoxWithin(*Inner.BoxConstraint, *Outer.BoxConstraint);
+	}
+
+	return false;
+}
+
+QueryConstraint InterestQueryOptimizer::SimplifyConjunction(const TArray<QueryConstraint>& Children)
+{
+	TArray<QueryConstraint> Conjuncts;
+	for (const QueryConstraint& Child : Children)
+	{
+		QueryConstraint SimplifiedChild = SimplifyConstraint(Child);
+		if (IsConjunction(SimplifiedChild))
+		{
+			for (const QueryConstraint& Conjunct : SimplifiedChild.AndConstraint)
+			{
+				Conjuncts.AddUnique(Conjunct);
+			}
+		}
+		else
+		{
+			Conjuncts.AddUnique(SimplifiedChild);
+		}
+	}
+
+	// A conjunct containing another conjunct, like the larger of two nested spheres, doesn't constrain the result any further.
+	for (int32 i = Conjuncts.Num() - 1; i >= 0; i--)
+	{
+		for (int32 j = 0; j < Conjuncts.Num(); j++)
+		{
+			if (i != j && IsConstraintSubsetOf(Conjuncts[j], Conjuncts[i]))
+			{
+				Conjuncts.RemoveAt(i);
+				break;
+			}
+		}
+	}
+
+	return MakeConjunction(Conjuncts);
+}
+
+QueryConstraint InterestQueryOptimizer::SimplifyDisjunction(const TArray<QueryConstraint>& Children)
+{
+	TArray<QueryConstraint> Disjuncts;
+	for (const QueryConstraint& Child : Children)
+	{
+		QueryConstraint SimplifiedChild = SimplifyConstraint(Child);
+		if (IsDisjunction(SimplifiedChild))
+		{
+			for (const QueryConstraint& Disjunct : SimplifiedChild.OrConstraint)
+			{
+				Disjuncts.AddUnique(Disjunct);
+			}
+		}
+		else
+		{
+			Disjuncts.AddUnique(SimplifiedChild);
+		}
+	}
+
+	MergeAdjacentBoxes(Disjuncts);
+
+	// A disjunct contained in another disjunct, like the smaller of two nested spheres, doesn't add anything to the result.
+	for (int32 i = Disjuncts.Num() - 1; i >= 0; i--)
+	{
+		for (int32 j = 0; j < Disjuncts.Num(); j++)
+		{
+			if (i != j && IsConstraintSubsetOf(Disjuncts[i], Disjuncts[j]))
+			{
+				Disjuncts.RemoveAt(i);
+				break;
+			}
+		}
+	}
+
+	if (Disjuncts.Num() == 1)
+	{
+		return Disjuncts[0];
+	}
+
+	QueryConstraint Factored;
+	if (FactorCommonConjuncts(Disjuncts, Factored))
+	{
+		return Factored;
+	}
+
+	QueryConstraint Disjunction;
+	Disjunction.OrConstraint = MoveTemp(Disjuncts);
+	return Disjunction;
+}
+
+void InterestQueryOptimizer::MergeAdjacentBoxes(TArray<QueryConstraint>& OutDisjuncts)
+{
+	// Merging two boxes can make the merged box adjacent to another one, so keep going until nothing merges.
+	bool bMerged = true;
+	while (bMerged)
+	{
+		bMerged = false;
+		for (int32 i = 0; i < OutDisjuncts.Num() && !bMerged; i++)
+		{
+			if (!IsBoxOnly(OutDisjuncts[i]))
+			{
+				continue;
+			}
+
+			for (int32 j = i + 1; j < OutDisjuncts.Num(); j++)
+			{
+				FBoxExtents MergedExtents;
+				if (IsBoxOnly(OutDisjuncts[j])
+					&& TryMergeBoxes(GetBoxExtents(*OutDisjuncts[i].BoxConstraint), GetBoxExtents(*OutDisjuncts[j].BoxConstraint), MergedExtents))
+				{
+					OutDisjuncts[i] = MakeBoxConstraint(MergedExtents);
+					OutDisjuncts.RemoveAt(j);
+					bMerged = true;
+					break;
+				}
+			}
+		}
+	}
+}
+
+bool InterestQueryOptimizer::FactorCommonConjuncts(const TArray<QueryConstraint>& Disjuncts, QueryConstraint& OutConstraint)
+{
+	// OR(AND(A, B), AND(A, C)) is rewritten as AND(A, OR(B, C)), so that constraints shared by every merged query,
+	// like the level constraint, are only evaluated once.
+	for (const QueryConstraint& Disjunct : Disjuncts)
+	{
+		if (!IsConjunction(Disjunct))
+		{
+			return false;
+		}
+	}
+
+	TArray<QueryConstraint> CommonConjuncts;
+	for (const QueryConstraint& Conjunct : Disjuncts[0].AndConstraint)
+	{
+		bool bInAllDisjuncts = true;
+		for (int32 i = 1; i < Disjuncts.Num() && bInAllDisjuncts; i++)
+		{
+			bInAllDisjuncts = Disjuncts[i].AndConstraint.Contains(Conjunct);
+		}
+
+		if (bInAllDisjuncts)
+		{
+			CommonConjuncts.AddUnique(Conjunct);
+		}
+	}
+
+	if (CommonConjuncts.Num() == 0)
+	{
+		return false;
+	}
+
+	TArray<QueryConstraint> RemainingDisjuncts;
+	for (const QueryConstraint& Disjunct : Disjuncts)
+	{
+		TArray<QueryConstraint> RemainingConjuncts = Disjunct.AndConstraint;
+		RemainingConjuncts.RemoveAll([&CommonConjuncts](const QueryConstraint& Conjunct) { return CommonConjuncts.Contains(Conjunct); });
+
+		// One of the disjuncts is just the common conjunction, which contains all the other disjuncts.
+		if (RemainingConjuncts.Num() == 0)
+		{
+			OutConstraint = MakeConjunction(CommonConjuncts);
+			return true;
+		}
+
+		RemainingDisjuncts.Add(MakeConjunction(RemainingConjuncts));
+	}
+
+	CommonConjuncts.Add(SimplifyDisjunction(RemainingDisjuncts));
+	OutConstraint = SimplifyConjunction(CommonConjuncts);
+	return true;
+}
+
+bool InterestQueryOptimizer::HasSameResult(const Query& A, const Query& B)
+{
+	return A.FullSnapshotResult == B.FullSnapshotResult && A.ResultComponentIds == B.ResultComponentIds;
+}
+
+bool InterestQueryOptimizer::IsFrequencyAtLeast(const TSchemaOption<float>& Frequency, const TSchemaOption<float>& Other)
+{
+	// An empty frequency means updates aren't rate limited.
+	if (!Frequency.IsSet())
+	{
+		return true;
+	}
+
+	if (!Other.IsSet())
+	{
+		return false;
+	}
+
+	return *Frequency >= *Other;
+}
+
+} // namespace SpatialGDK
@@ -104,6 +104,7 @@ FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraintWit
 	const TMap<float, Worker_ComponentId>& NetCullDistancesToComponentIds = InClassInfoManager->GetNetCullDistanceToComponentIds();
 
 	FrequencyToConstraintsMap FrequencyToConstraints;
+	FrequencyToConstraintsMap LowDetailFrequencyToConstraints;
 
 	for (const auto& DistanceComponentPair : NetCullDistancesToComponentIds)
 	{
@@ -135,27 +136,35 @@ FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraintWit
 			FrequencyCheckoutRadiusConstraint.AndConstraint.Add(FrequencyRadiusConstraint);
 			FrequencyCheckoutRadiusConstraint.AndConstraint.Add(ComponentConstraint);
 
-			AddToFrequencyConstraintMap(DistanceFrequencyPair.Frequency, FrequencyCheckoutRadiusConstraint, FrequencyToConstraints);
+			AddToFrequencyConstraintMap(DistanceFrequencyPair.Frequency, FrequencyCheckoutRadiusConstraint,
+				DistanceFrequencyPair.bLowDetail ? LowDetailFrequencyToConstraints : FrequencyToConstraints);
 		}
 	}
 
 	FrequencyConstraints CheckoutConstraints;
 
+	// Bands are nested, so entities in a full detail band still receive all data components even if they are also in a low detail band.
+	AddFrequencyConstraints(FrequencyToConstraints, false, CheckoutConstraints);
+	AddFrequencyConstraints(LowDetailFrequencyToConstraints, true, CheckoutConstraints);
+
+	return CheckoutConstraints;
+}
+
+void NetCullDistanceInterest::AddFrequencyConstraints(const FrequencyToConstraintsMap& FrequencyToConstraints, const bool bLowDetail, FrequencyConstraints& OutCheckoutConstraints)
+{
 	// De dupe across frequencies.
-	for (auto& FrequencyConstraintsPair : FrequencyToConstraints)
+	for (const auto& FrequencyConstraintsPair : FrequencyToConstraints)
 	{
 		TSchemaOption<float> SpatialFrequency = FrequencyConstraintsPair.Key == FullFrequencyHz ? FullFrequencyOptional : TSchemaOption<float>(FrequencyConstraintsPair.Key);
 		if (FrequencyConstraintsPair.Value.Num() == 1)
 		{
-			CheckoutConstraints.Add({ SpatialFrequency, FrequencyConstraintsPair.Value[0] });
+			OutCheckoutConstraints.Add({ SpatialFrequency, FrequencyConstraintsPair.Value[0], bLowDetail });
 			continue;
 		}
 		QueryConstraint RadiusDisjunct;
 		RadiusDisjunct.OrConstraint.Append(FrequencyConstraintsPair.Value);
-		CheckoutConstraints.Add({ SpatialFrequency, RadiusDisjunct });
+		OutCheckoutConstraints.Add({ SpatialFrequency, RadiusDisjunct, bLowDetail });
 	}
-
-	return CheckoutConstraints;
 }
 
 void NetCullDistanceInterest::AddToFrequencyConstraintMap(const float Frequency, const QueryConstraint& Constraint, FrequencyToConstraintsMap& OutFrequencyToConstraints)
@@ -0,0 +1,107 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/Interest/QuerySchemaCache.h"
+
+namespace SpatialGDK
+{
+
+void FQuerySchemaCache::AddQueryToComponentInterestSchema(Schema_Object* ComponentInterestObject, Schema_FieldId Id, const Query& Value)
+{
+	if (const TArray<uint8>* SerializedQuery = SerializedQueries.Find(Value))
+	{
+		Schema_Object* QueryObject = Schema_AddObject(ComponentInterestObject, Id);
+		const uint8_t Result = Schema_MergeFromBuffer(QueryObject, SerializedQuery->GetData(), SerializedQuery->Num());
+		check(Result != 0);
+
+		NumCacheHits++;
+		return;
+	}
+
+	SpatialGDK::AddQueryToComponentInterestSchema(ComponentInterestObject, Id, Value);
+
+	if (SerializedQueries.Num() >= MaxCachedQueries || ContainsEntityIdConstraint(Value.Constraint))
+	{
+		return;
+	}
+
+	Schema_Object* QueryObject = Schema_IndexObject(ComponentInterestObject, Id, Schema_GetObjectCount(ComponentInterestObject, Id) - 1);
+	TArray<uint8>& SerializedQuery = SerializedQueries.Add(Value);
+	SerializedQuery.SetNumUninitialized(Schema_GetWriteBufferLength(QueryObject));
+	Schema_SerializeToBuffer(QueryObject, SerializedQuery.GetData(), SerializedQuery.Num());
+}
+
+void FQuerySchemaCache::AddComponentInterestToInterestSchema(Schema_Object* InterestObject, Schema_FieldId Id, const ComponentInterest& Value)
+{
+	Schema_Object* ComponentInterestObject = Schema_AddObject(InterestObject, Id);
+
+	for (const Query& QueryEntry : Value.Queries)
+	{
+		AddQueryToComponentInterestSchema(ComponentInterestObject, 1, QueryEntry);
+	}
+}
+
+void FQuerySchemaCache::FillInterestComponentObject(Schema_Object* InterestComponentObject, const Interest& Value)
+{
+	for (const auto& KVPair : Value.ComponentInterestMap)
+	{
+		Schema_Object* KVPairObject = Schema_AddObject(InterestComponentObject, 1);
+		Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
+		AddComponentInterestToInterestSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
+	}
+}
+
+Worker_ComponentData FQuerySchemaCache::CreateInterestData(const Interest& Value)
+{
+	Worker_ComponentData Data = {};
+	Data.component_id = Interest::ComponentId;
+	Data.schema_type = Schema_CreateComponentData();
+
+	FillInterestComponentObject(Schema_GetComponentDataFields(Data.schema_type), Value);
+
+	return Data;
+}
+
+Worker_ComponentUpdate FQuerySchemaCache::CreateInterestUpdate(const Interest& Value)
+{
+	Worker_ComponentUpdate ComponentUpdate = {};
+	ComponentUpdate.component_id = Interest::ComponentId;
+	ComponentUpdate.schema_type = Schema_CreateComponentUpdate();
+
+	FillInterestComponentObject(Schema_GetComponentUpdateFields(ComponentUpdate.schema_type), Value);
+
+	return ComponentUpdate;
+}
+
+void FQuerySchemaCache::Reset()
+{
+	SerializedQueries.Empty();
+	NumCacheHits = 0;
+}
+
+bool FQuerySchemaCache::ContainsEntityIdConstraint(const QueryConstraint& Constraint)
+{
+	if (Constraint.EntityIdConstraint.IsSet())
+	{
+		return true;
+	}
+
+	for (const QueryConstraint& AndConstraint : Constraint.AndConstraint)
+	{
+		if (ContainsEntityIdConstraint(AndConstraint))
+		{
+			return true;
+		}
+	}
+
+	for (const QueryConstraint& OrConstraint : Constraint.OrConstraint)
+	{
+		if (ContainsEntityIdConstraint(OrConstraint))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // namespace SpatialGDK
@@ -10,6 +10,7 @@
 #include "LoadBalancing/AbstractLBStrategy.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/Interest/InterestQueryOptimizer.h"
 #include "Utils/Interest/NetCullDistanceInterest.h"
 
 #include "Engine/World.h"
@@ -21,6 +22,9 @@ DEFINE_LOG_CATEGORY(LogInterestFactory);
 
 DECLARE_STATS_GROUP(TEXT("InterestFactory"), STATGROUP_SpatialInterestFactory, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("AddUserDefinedQueries"), STAT_InterestFactoryAddUserDefinedQueries, STATGROUP_SpatialInterestFactory);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("SkippedInterestUpdates"), STAT_InterestFactorySkippedInterestUpdates, STATGROUP_SpatialInterestFactory);
+DECLARE_CYCLE_STAT(TEXT("SerializeInterest"), STAT_InterestFactorySerializeInterest, STATGROUP_SpatialInterestFactory);
+DECLARE_CYCLE_STAT(TEXT("OptimizeInterest"), STAT_InterestFactoryOptimizeInterest, STATGROUP_SpatialInterestFactory);
 
 namespace SpatialGDK
 {
@@ -36,9 +40,40 @@ void InterestFactory::CreateAndCacheInterestState()
 {
 	ClientCheckoutRadiusConstraint = NetCullDistanceInterest::CreateCheckoutRadiusConstraints(ClassInfoManager);
 	ClientNonAuthInterestResultType = CreateClientNonAuthInterestResultType();
+	ClientLowDetailInterestResultType = CreateClientLowDetailInterestResultType();
 	ClientAuthInterestResultType = CreateClientAuthInterestResultType();
 	ServerNonAuthInterestResultType = CreateServerNonAuthInterestResultType();
 	ServerAuthInterestResultType = CreateServerAuthInterestResultType();
+	CreateNetCullDistanceQueries();
+}
+
+void InterestFactory::CreateNetCullDistanceQueries()
+{
+	const bool bEnableClientQueriesOnServer = GetDefault<USpatialGDKSettings>()->bEnableClientQueriesOnServer;
+
+	// The CheckoutConstraints list contains items with a constraint and a frequency.
+	// They are converted to queries by adding a result type to them.
+	for (const auto& CheckoutRadiusConstraintFrequencyPair : ClientCheckoutRadiusConstraint)
+	{
+		if (!CheckoutRadiusConstraintFrequencyPair.Constraint.IsValid())
+		{
+			continue;
+		}
+
+		Query& ClientQuery = ClientNetCullDistanceQueries.AddDefaulted_GetRef();
+		ClientQuery.Constraint.AndConstraint.Add(CheckoutRadiusConstraintFrequencyPair.Constraint);
+		ClientQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
+		ClientQuery.ResultComponentIds = CheckoutRadiusConstraintFrequencyPair.bLowDetail ? ClientLowDetailInterestResultType : ClientNonAuthInterestResultType;
+
+		// Add the queries to the server as well to ensure that all entities checked out on the client will be present on the server.
+		if (bEnableClientQueriesOnServer)
+		{
+			Query& ServerQuery = ServerNetCullDistanceQueries.AddDefaulted_GetRef();
+			ServerQuery.Constraint = CheckoutRadiusConstraintFrequencyPair.Constraint;
+			ServerQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
+			ServerQuery.ResultComponentIds = ServerNonAuthInterestResultType;
+		}
+	}
 }
 
 SchemaResultType InterestFactory::CreateClientNonAuthInterestResultType()
@@ -54,6 +89,28 @@ SchemaResultType InterestFactory::CreateClientNonAuthInterestResultType()
 	return ClientNonAuthResultType;
 }
 
+SchemaResultType InterestFactory::CreateClientLowDetailInterestResultType()
+{
+	SchemaResultType ClientLowDetailResultType;
+
+	// Add the required unreal components
+	ClientLowDetailResultType.Append(SpatialConstants::REQUIRED_COMPONENTS_FOR_NON_AUTH_CLIENT_INTEREST);
+
+	// Only add the data components of the classes configured to be received in low detail bands, including their subobjects'.
+	for (const TSoftClassPtr<AActor>& LowDetailClass : GetDefault<USpatialGDKSettings>()->LowDetailInterestClasses)
+	{
+		if (const UClass* Class = LowDetailClass.LoadSynchronous())
+		{
+			for (Worker_ComponentId ComponentId : ClassInfoManager->GetDataComponentIdsForActorClassHierarchy(*Class))
+			{
+				ClientLowDetailResultType.AddUnique(ComponentId);
+			}
+		}
+	}
+
+	return ClientLowDetailResultType;
+}
+
 SchemaResultType InterestFactory::CreateClientAuthInterestResultType()
 {
 	SchemaResultType ClientAuthResultType;
@@ -92,15 +149,91 @@ SchemaResultType InterestFactory::CreateServerAuthInterestResultType()
 
 Worker_ComponentData InterestFactory::CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
 {
-	return CreateInterest(InActor, InInfo, InEntityId).CreateInterestData();
+	return SerializeInterestData(CreateInterest(InActor, InInfo, InEntityId));
 }
 
 Worker_ComponentUpdate InterestFactory::CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
 {
-	return CreateInterest(InActor, InInfo, InEntityId).CreateInterestUpdate();
+	return SerializeInterestUpdate(CreateInterest(InActor, InInfo, InEntityId));
+}
+
+bool InterestFactory::CreateInterestUpdateIfChanged(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, Worker_ComponentUpdate& OutUpdate)
+{
+	if (!GetDefault<USpatialGDKSettings>()->bSkipUnchangedInterestUpdates)
+	{
+		OutUpdate = CreateInterestUpdate(InActor, InInfo, InEntityId);
+		return true;
+	}
+
+	Interest NewInterest = CreateInterest(InActor, InInfo, InEntityId);
+
+	// The interest component is sent as a whole, so the update is either skipped entirely or contains every query.
+	if (Interest* CachedInterest = CachedInterests.Find(InEntityId))
+	{
+		if (*CachedInterest == NewInterest)
+		{
+			NumSkippedInterestUpdates++;
+			INC_DWORD_STAT(STAT_InterestFactorySkippedInterestUpdates);
+			return false;
+		}
+	}
+
+	OutUpdate = SerializeInterestUpdate(NewInterest);
+	CachedInterests.Add(InEntityId, MoveTemp(NewInterest));
+	return true;
+}
+
+void InterestFactory::InvalidateCachedInterest(const Worker_EntityId InEntityId)
+{
+	CachedInterests.Remove(InEntityId);
+	ClientInterestQueryCounts.Remove(InEntityId);
+	AlwaysInterestedConstraintCache.Invalidate(InEntityId);
+}
+
+void InterestFactory::InvalidateAlwaysInterestedConstraint(const Worker_EntityId InEntityId)
+{
+	AlwaysInterestedConstraintCache.Invalidate(InEntityId);
+}
+
+int32 InterestFactory::GetMaxClientInterestQueryCount() const
+{
+	int32 MaxQueryCount = 0;
+	for (const auto& QueryCount : ClientInterestQueryCounts)
+	{
+		MaxQueryCount = FMath::Max(MaxQueryCount, QueryCount.Value);
+	}
+	return MaxQueryCount;
+}
+
+void InterestFactory::OptimizeInterest(Interest& OutInterest) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InterestFactoryOptimizeInterest);
+	InterestQueryOptimizer::OptimizeInterest(OutInterest);
+}
+
+Worker_ComponentData InterestFactory::SerializeInterestData(const Interest& InInterest) const
+{
+	if (GetDefault<USpatialGDKSettings>()->bCacheSerializedInterestQueries)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InterestFactorySerializeInterest);
+		return QuerySchemaCache.CreateInterestData(InInterest);
+	}
+
+	return InInterest.CreateInterestData();
+}
+
+Worker_ComponentUpdate InterestFactory::SerializeInterestUpdate(const Interest& InInterest) const
+{
+	if (GetDefault<USpatialGDKSettings>()->bCacheSerializedInterestQueries)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InterestFactorySerializeInterest);
+		return QuerySchemaCache.CreateInterestUpdate(InInterest);
+	}
+
+	return InInterest.CreateInterestUpdate();
 }
 
-Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy)
+Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy, VirtualWorkerId StandbyForWorkerId)
 {
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 
@@ -137,6 +270,18 @@ Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy*
 			NewConstraint.OrConstraint.Add(AlwaysRelevantConstraint);
 			Constraint = NewConstraint;
 		}
+		else if (StandbyForWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			// Keeping the region checked out means taking it over only moves authority.
+			QueryConstraint StandbyConstraint = LBStrategy->GetStandbyInterestQueryConstraint(StandbyForWorkerId);
+			if (StandbyConstraint.IsValid())
+			{
+				QueryConstraint NewConstraint;
+				NewConstraint.OrConstraint.Add(StandbyConstraint);
+				NewConstraint.OrConstraint.Add(AlwaysRelevantConstraint);
+				Constraint = NewConstraint;
+			}
+		}
 	}
 
 	ServerQuery.Constraint = Constraint;
@@ -151,6 +296,20 @@ Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy*
 	ServerQuery.Constraint.ComponentConstraint = SpatialConstants::WORKER_COMPONENT_ID;
 	AddComponentQueryPairToInterestComponent(ServerInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
 
+	// Servers receive cross-server RPCs and their acks through the endpoints on each other's worker entities.
+	if (SpatialGDKSettings->bUseRingBufferCrossServerRPCs && SpatialGDKSettings->UseRPCRingBuffer())
+	{
+		ServerQuery = Query();
+		ServerQuery.ResultComponentIds = SchemaResultType{ SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID };
+		ServerQuery.Constraint.ComponentConstraint = SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID;
+		AddComponentQueryPairToInterestComponent(ServerInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
+	}
+
+	if (SpatialGDKSettings->bOptimizeInterestQueries)
+	{
+		OptimizeInterest(ServerInterest);
+	}
+
 	return ServerInterest;
 }
 
@@ -164,7 +323,7 @@ Interest InterestFactory::CreateInterest(AActor* InActor, const FClassInfo& InIn
 	if (InActor->IsA(APlayerController::StaticClass()))
 	{
 		// Put the "main" interest queries on the player controller
-		AddPlayerControllerActorInterest(ResultInterest, InActor, InInfo);
+		AddPlayerControllerActorInterest(ResultInterest, InActor, InInfo, InEntityId);
 	}
 
 	// Clients need to see owner only and server RPC components on entities they have authority over
@@ -173,14 +332,33 @@ Interest InterestFactory::CreateInterest(AActor* InActor, const FClassInfo& InIn
 	// Every actor needs a self query for the server to the client RPC endpoint
 	AddServerSelfInterest(ResultInterest, InEntityId);
 
+	if (Settings->bOptimizeInterestQueries)
+	{
+		const int32 NumQueriesBeforeOptimization = InterestQueryOptimizer::CountQueries(ResultInterest);
+		OptimizeInterest(ResultInterest);
+
+		if (InActor->IsA(APlayerController::StaticClass()))
+		{
+			const int32 NumQueries = InterestQueryOptimizer::CountQueries(ResultInterest);
+			ClientInterestQueryCounts.Add(InEntityId, NumQueries);
+			UE_LOG(LogInterestFactory, Verbose, TEXT("Client interest for %s (entity %lld) has %d queries, %d before optimization."),
+				*InActor->GetName(), InEntityId, NumQueries, NumQueriesBeforeOptimization);
+		}
+	}
+
 	return ResultInterest;
 }
 
-void InterestFactory::AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo) const
+void InterestFactory::AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
 {
 	QueryConstraint LevelConstraint = CreateLevelConstraints(InActor);
 
-	AddAlwaysRelevantAndInterestedQuery(OutInterest, InActor, InInfo, LevelConstraint);
+	AddAlwaysRelevantAndInterestedQuery(OutInterest, InActor, InInfo, InEntityId, LevelConstraint);
+
+	// The always relevant and always interested queries are kept at full frequency when scaling for the client's bandwidth budget.
+	const Worker_ComponentId ClientAuthorityComponentId = SpatialConstants::GetClientAuthorityComponent(GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer());
+	const ComponentInterest* ClientInterest = OutInterest.ComponentInterestMap.Find(ClientAuthorityComponentId);
+	const int32 FirstScaledQueryIndex = ClientInterest != nullptr ? ClientInterest->Queries.Num() : 0;
 
 	AddUserDefinedQueries(OutInterest, InActor, LevelConstraint);
 
@@ -189,6 +367,32 @@ void InterestFactory::AddPlayerControllerActorInterest(Interest& OutInterest, co
 	{
 		AddNetCullDistanceQueries(OutInterest, LevelConstraint);
 	}
+
+	if (const USpatialNetConnection* Connection = Cast<USpatialNetConnection>(InActor->GetNetConnection()))
+	{
+		const float FrequencyScale = Connection->GetInterestFrequencyScale();
+		if (FrequencyScale < 1.0f)
+		{
+			ScaleClientQueryFrequencies(OutInterest, ClientAuthorityComponentId, FirstScaledQueryIndex, FrequencyScale, Connection->Driver->NetServerMaxTickRate);
+		}
+	}
+}
+
+void InterestFactory::ScaleClientQueryFrequencies(Interest& OutInterest, const Worker_ComponentId ClientAuthorityComponentId, const int32 FirstQueryIndex,
+	const float FrequencyScale, const float MaxFrequency) const
+{
+	ComponentInterest* ClientInterest = OutInterest.ComponentInterestMap.Find(ClientAuthorityComponentId);
+	if (ClientInterest == nullptr)
+	{
+		return;
+	}
+
+	for (int32 QueryIndex = FirstQueryIndex; QueryIndex < ClientInterest->Queries.Num(); QueryIndex++)
+	{
+		TSchemaOption<float>& Frequency = ClientInterest->Queries[QueryIndex].Frequency;
+		// Queries without a frequency are received every tick of the server.
+		Frequency = (Frequency.IsSet() ? Frequency.GetValue() : MaxFrequency) * FrequencyScale;
+	}
 }
 
 void InterestFactory::AddClientSelfInterest(Interest& OutInterest, const Worker_EntityId& EntityId) const
@@ -218,11 +422,12 @@ void InterestFactory::AddServerSelfInterest(Interest& OutInterest, const Worker_
 	AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::ENTITY_ACL_COMPONENT_ID, LoadBalanceQuery);
 }
 
-void InterestFactory::AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const QueryConstraint& LevelConstraint) const
+void InterestFactory::AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId,
+	const QueryConstraint& LevelConstraint) const
 {
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
-	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint(InActor, InInfo);
+	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint(InActor, InInfo, InEntityId);
 	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
 
 	QueryConstraint SystemDefinedConstraints;
@@ -374,42 +579,27 @@ void InterestFactory::GetActorUserDefinedQueryConstraints(const AActor* InActor,
 
 void InterestFactory::AddNetCullDistanceQueries(Interest& OutInterest, const QueryConstraint& LevelConstraint) const
 {
-	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	const Worker_ComponentId ClientAuthorityComponentId = SpatialConstants::GetClientAuthorityComponent(GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer());
 
-	// The CheckoutConstraints list contains items with a constraint and a frequency.
-	// They are then converted to queries by adding a result type to them, and the constraints are conjoined with the level constraint.
-	for (const auto& CheckoutRadiusConstraintFrequencyPair : ClientCheckoutRadiusConstraint)
+	// The queries are prebuilt in CreateNetCullDistanceQueries, only the client queries are conjoined with the level constraint.
+	for (const Query& ClientQuery : ClientNetCullDistanceQueries)
 	{
-		if (!CheckoutRadiusConstraintFrequencyPair.Constraint.IsValid())
-		{
-			continue;
-		}
-
-		Query NewQuery;
-
-		NewQuery.Constraint.AndConstraint.Add(CheckoutRadiusConstraintFrequencyPair.Constraint);
-
 		if (LevelConstraint.IsValid())
 		{
+			Query NewQuery = ClientQuery;
 			NewQuery.Constraint.AndConstraint.Add(LevelConstraint);
+			AddComponentQueryPairToInterestComponent(OutInterest, ClientAuthorityComponentId, NewQuery);
 		}
-
-		NewQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
-		NewQuery.ResultComponentIds = ClientNonAuthInterestResultType;
-
-		AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::GetClientAuthorityComponent(Settings->UseRPCRingBuffer()), NewQuery);
-
-		// Add the queries to the server as well to ensure that all entities checked out on the client will be present on the server.
-		if (Settings->bEnableClientQueriesOnServer)
+		else
 		{
-			Query ServerQuery;
-			ServerQuery.Constraint = CheckoutRadiusConstraintFrequencyPair.Constraint;
-			ServerQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
-			ServerQuery.ResultComponentIds = ServerNonAuthInterestResultType;
-
-			AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
+			AddComponentQueryPairToInterestComponent(OutInterest, ClientAuthorityComponentId, ClientQuery);
 		}
 	}
+
+	for (const Query& ServerQuery : ServerNetCullDistanceQueries)
+	{
+		AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
+	}
 }
 
 void InterestFactory::AddComponentQueryPairToInterestComponent(Interest& OutInterest, const Worker_ComponentId ComponentId, const Query& QueryToAdd) const
@@ -442,23 +632,45 @@ bool InterestFactory::ShouldAddNetCullDistanceInterest(const AActor* InActor) co
 	return true;
 }
 
-QueryConstraint InterestFactory::CreateAlwaysInterestedConstraint(const AActor* InActor, const FClassInfo& InInfo) const
+QueryConstraint InterestFactory::CreateAlwaysInterestedConstraint(const AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
 {
+	if (GetDefault<USpatialGDKSettings>()->bCacheAlwaysInterestedConstraints && InEntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		return AlwaysInterestedConstraintCache.FindOrBuild(InEntityId, [this, InActor, &InInfo](QueryConstraint& OutConstraint)
+		{
+			return BuildAlwaysInterestedConstraint(InActor, InInfo, OutConstraint);
+		});
+	}
+
 	QueryConstraint AlwaysInterestedConstraint;
+	BuildAlwaysInterestedConstraint(InActor, InInfo, AlwaysInterestedConstraint);
+	return AlwaysInterestedConstraint;
+}
+
+bool InterestFactory::BuildAlwaysInterestedConstraint(const AActor* InActor, const FClassInfo& InInfo, QueryConstraint& OutConstraint) const
+{
+	bool bCanCache = true;
 
 	for (const FInterestPropertyInfo& PropertyInfo : InInfo.InterestProperties)
 	{
+		// The component factory only invalidates the cache when it writes the property, which it doesn't do for properties that
+		// are neither replicated nor handed over.
+		if (!PropertyInfo.Property->HasAnyPropertyFlags(CPF_Net | CPF_Handover))
+		{
+			bCanCache = false;
+		}
+
 		uint8* Data = (uint8*)InActor + PropertyInfo.Offset;
 		if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(PropertyInfo.Property))
 		{
-			AddObjectToConstraint(ObjectProperty, Data, AlwaysInterestedConstraint);
+			bCanCache &= AddObjectToConstraint(ObjectProperty, Data, OutConstraint);
 		}
 		else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(PropertyInfo.Property))
 		{
 			FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
 			for (int i = 0; i < ArrayHelper.Num(); i++)
 			{
-				AddObjectToConstraint(Cast<UObjectPropertyBase>(ArrayProperty->Inner), ArrayHelper.GetRawPtr(i), AlwaysInterestedConstraint);
+				bCanCache &= AddObjectToConstraint(Cast<UObjectPropertyBase>(ArrayProperty->Inner), ArrayHelper.GetRawPtr(i), OutConstraint);
 			}
 		}
 		else
@@ -467,7 +679,7 @@ QueryConstraint InterestFactory::CreateAlwaysInterestedConstraint(const AActor*
 		}
 	}
 
-	return AlwaysInterestedConstraint;
+	return bCanCache;
 }
 
 QueryConstraint InterestFactory::CreateAlwaysRelevantConstraint() const
@@ -477,7 +689,8 @@ QueryConstraint InterestFactory::CreateAlwaysRelevantConstraint() const
 	Worker_ComponentId ComponentIds[] = {
 		SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID,
 		SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID,
-		SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID
+		SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID,
+		SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID
 	};
 
 	for (Worker_ComponentId ComponentId : ComponentIds)
@@ -504,10 +717,16 @@ QueryConstraint InterestFactory::CreateLevelConstraints(const AActor* InActor) c
 	check(PlayerController);
 
 	const TSet<FName>& LoadedLevels = PlayerController->NetConnection->ClientVisibleLevelNames;
+	const USpatialNetConnection* SpatialConnection = Cast<USpatialNetConnection>(PlayerController->NetConnection);
 
 	// Create component constraints for every loaded sub-level
 	for (const auto& LevelPath : LoadedLevels)
 	{
+		if (SpatialConnection != nullptr && SpatialConnection->IsLevelInterestPending(LevelPath))
+		{
+			continue;
+		}
+
 		const Worker_ComponentId ComponentId = ClassInfoManager->GetComponentIdFromLevelPath(LevelPath.ToString());
 		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 		{
@@ -525,25 +744,26 @@ QueryConstraint InterestFactory::CreateLevelConstraints(const AActor* InActor) c
 	return LevelConstraint;
 }
 
-void InterestFactory::AddObjectToConstraint(UObjectPropertyBase* Property, uint8* Data, QueryConstraint& OutConstraint) const
+bool InterestFactory::AddObjectToConstraint(UObjectPropertyBase* Property, uint8* Data, QueryConstraint& OutConstraint) const
 {
 	UObject* ObjectOfInterest = Property->GetObjectPropertyValue(Data);
 
 	if (ObjectOfInterest == nullptr)
 	{
-		return;
+		return true;
 	}
 
 	FUnrealObjectRef UnrealObjectRef = PackageMap->GetUnrealObjectRefFromObject(ObjectOfInterest);
 
 	if (!UnrealObjectRef.IsValid())
 	{
-		return;
+		return false;
 	}
 
 	QueryConstraint EntityIdConstraint;
 	EntityIdConstraint.EntityIdConstraint = UnrealObjectRef.Entity;
 	OutConstraint.OrConstraint.Add(EntityIdConstraint);
+	return true;
 }
 
 } // namespace SpatialGDK
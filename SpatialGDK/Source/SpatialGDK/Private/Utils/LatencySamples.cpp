@@ -0,0 +1,59 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LatencySamples.h"
+
+namespace SpatialGDK
+{
+
+void FLatencySamples::Add(double Seconds)
+{
+	bIsSorted = bIsSorted && (Samples.Num() == 0 || Samples.Last() <= Seconds);
+	Samples.Add(Seconds);
+}
+
+void FLatencySamples::Reset()
+{
+	Samples.Reset();
+	bIsSorted = true;
+}
+
+void FLatencySamples::SortIfNeeded() const
+{
+	if (!bIsSorted)
+	{
+		Samples.Sort();
+		bIsSorted = true;
+	}
+}
+
+double FLatencySamples::GetPercentile(double Percentile) const
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	SortIfNeeded();
+
+	const int32 Rank = FMath::CeilToInt(FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * Samples.Num());
+	return Samples[FMath::Clamp(Rank - 1, 0, Samples.Num() - 1)];
+}
+
+double FLatencySamples::GetMax() const
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	SortIfNeeded();
+	return Samples.Last();
+}
+
+FString FLatencySamples::ToJson(const FString& Fields) const
+{
+	return FString::Printf(TEXT("{%s\"samples\": %d, \"p50_ms\": %.3f, \"p90_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f}"),
+		*Fields, Samples.Num(), GetPercentile(50.0) * 1000.0, GetPercentile(90.0) * 1000.0, GetPercentile(99.0) * 1000.0, GetMax() * 1000.0);
+}
+
+} // namespace SpatialGDK
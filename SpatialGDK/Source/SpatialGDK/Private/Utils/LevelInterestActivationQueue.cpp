@@ -0,0 +1,57 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LevelInterestActivationQueue.h"
+
+namespace SpatialGDK
+{
+
+bool FLevelInterestActivationQueue::Add(FName PackageName, const FBox& Bounds)
+{
+	if (Contains(PackageName))
+	{
+		return false;
+	}
+
+	PendingLevels.Add({ PackageName, Bounds });
+	return true;
+}
+
+void FLevelInterestActivationQueue::Remove(FName PackageName)
+{
+	PendingLevels.RemoveAll([PackageName](const FPendingLevel& Pending) { return Pending.PackageName == PackageName; });
+}
+
+bool FLevelInterestActivationQueue::Contains(FName PackageName) const
+{
+	return PendingLevels.ContainsByPredicate([PackageName](const FPendingLevel& Pending) { return Pending.PackageName == PackageName; });
+}
+
+FName FLevelInterestActivationQueue::PopNext(const TOptional<FVector>& Origin)
+{
+	if (PendingLevels.Num() == 0)
+	{
+		return NAME_None;
+	}
+
+	int32 NextIndex = 0;
+	if (Origin.IsSet())
+	{
+		float MinDistanceSquared = MAX_flt;
+		for (int32 Index = 0; Index < PendingLevels.Num(); Index++)
+		{
+			const FBox& Bounds = PendingLevels[Index].Bounds;
+			const float DistanceSquared = Bounds.IsValid ? Bounds.ComputeSquaredDistanceToPoint(Origin.GetValue()) : MAX_flt;
+			if (DistanceSquared < MinDistanceSquared)
+			{
+				MinDistanceSquared = DistanceSquared;
+				NextIndex = Index;
+			}
+		}
+	}
+
+	const FName PackageName = PendingLevels[NextIndex].PackageName;
+	PendingLevels.RemoveAt(NextIndex);
+	return PackageName;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,111 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LogForwardingQueue.h"
+
+#include "Misc/ScopeLock.h"
+
+namespace SpatialGDK
+{
+
+FLogForwardingQueue::FLogForwardingQueue(int32 InCapacity, int32 InMaxLinesPerSecond, const TMap<FName, uint32>& InCategorySampleRates)
+	: MaxLinesPerSecond(FMath::Max(InMaxLinesPerSecond, 0))
+	, RateLimitTokens(MaxLinesPerSecond)
+	, CategorySampleRates(InCategorySampleRates)
+{
+	Lines.SetNum(FMath::Max(InCapacity, 1));
+}
+
+bool FLogForwardingQueue::Enqueue(Worker_LogLevel Level, const FName& Category, const TCHAR* Message, double Now)
+{
+	FScopeLock Lock(&Mutex);
+
+	const bool bImportant = Level == WORKER_LOG_LEVEL_ERROR || Level == WORKER_LOG_LEVEL_FATAL;
+	if (!bImportant && (!ShouldSample(Category) || !ConsumeRateLimitToken(Now)))
+	{
+		NumDropped++;
+		return false;
+	}
+
+	if (Num == Lines.Num())
+	{
+		NumDropped++;
+		return false;
+	}
+
+	FQueuedLine& Line = Lines[(Head + Num) % Lines.Num()];
+	Line.Level = Level;
+	// Assigning keeps the allocation of the line previously in this slot when it is large enough.
+	Line.Message = Message;
+	Num++;
+
+	return true;
+}
+
+uint32 FLogForwardingQueue::Drain(int32 MaxLinesPerBatch, TArray<FLogBatch>& OutBatches)
+{
+	FScopeLock Lock(&Mutex);
+
+	FLogBatch* Batch = nullptr;
+	for (; Num > 0; Num--)
+	{
+		FQueuedLine& Line = Lines[Head];
+		Head = (Head + 1) % Lines.Num();
+
+		if (Batch == nullptr || Batch->Level != Line.Level || Batch->NumLines >= MaxLinesPerBatch)
+		{
+			Batch = &OutBatches.AddDefaulted_GetRef();
+			Batch->Level = Line.Level;
+			Batch->Message = Line.Message;
+			Batch->NumLines = 1;
+			continue;
+		}
+
+		Batch->Message += LINE_TERMINATOR;
+		Batch->Message += Line.Message;
+		Batch->NumLines++;
+	}
+
+	const uint32 Dropped = NumDropped;
+	NumDropped = 0;
+	return Dropped;
+}
+
+int32 FLogForwardingQueue::GetNum() const
+{
+	FScopeLock Lock(&Mutex);
+	return Num;
+}
+
+bool FLogForwardingQueue::ShouldSample(const FName& Category)
+{
+	const uint32* SampleRate = CategorySampleRates.Find(Category);
+	if (SampleRate == nullptr || *SampleRate <= 1)
+	{
+		return true;
+	}
+
+	uint32& LineCount = CategoryLineCounts.FindOrAdd(Category);
+	return LineCount++ % *SampleRate == 0;
+}
+
+bool FLogForwardingQueue::ConsumeRateLimitToken(double Now)
+{
+	if (MaxLinesPerSecond == 0)
+	{
+		return true;
+	}
+
+	// Refills at MaxLinesPerSecond, allowing bursts of up to a second's worth of lines.
+	RateLimitTokens = FMath::Min(RateLimitTokens + (Now - LastRefillTime) * MaxLinesPerSecond, static_cast<double>(MaxLinesPerSecond));
+	LastRefillTime = Now;
+
+	if (RateLimitTokens < 1.0)
+	{
+		return false;
+	}
+
+	RateLimitTokens -= 1.0;
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -76,4 +76,60 @@ Worker_ComponentId GetComponentId(const Worker_Op* Op)
 		return SpatialConstants::INVALID_COMPONENT_ID;
 	}
 }
+
+FOpListIndex::FOpListIndex(const TArray<Worker_OpList*>& InOpLists, std::initializer_list<Worker_OpType> OpTypesToKeep)
+{
+	for (const Worker_OpType OpType : OpTypesToKeep)
+	{
+		KeptOpsByType.Add(OpType);
+	}
+
+	for (const Worker_OpList* OpList : InOpLists)
+	{
+		for (size_t i = 0; i < OpList->op_count; ++i)
+		{
+			Worker_Op* Op = &OpList->ops[i];
+
+			if (!FirstOpByType.Contains(Op->op_type))
+			{
+				FirstOpByType.Add(Op->op_type, Op);
+			}
+
+			const Worker_ComponentId ComponentId = GetComponentId(Op);
+			if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				const uint64 ComponentKey = GetComponentKey(static_cast<Worker_OpType>(Op->op_type), ComponentId);
+				if (!FirstOpByTypeAndComponent.Contains(ComponentKey))
+				{
+					FirstOpByTypeAndComponent.Add(ComponentKey, Op);
+				}
+			}
+
+			if (TArray<Worker_Op*>* KeptOps = KeptOpsByType.Find(Op->op_type))
+			{
+				KeptOps->Add(Op);
+			}
+		}
+	}
+}
+
+Worker_Op* FOpListIndex::FindFirstOpOfType(const Worker_OpType OpType) const
+{
+	Worker_Op* const* Op = FirstOpByType.Find(OpType);
+	return Op != nullptr ? *Op : nullptr;
+}
+
+Worker_Op* FOpListIndex::FindFirstOpOfTypeForComponent(const Worker_OpType OpType, const Worker_ComponentId ComponentId) const
+{
+	Worker_Op* const* Op = FirstOpByTypeAndComponent.Find(GetComponentKey(OpType, ComponentId));
+	return Op != nullptr ? *Op : nullptr;
+}
+
+void FOpListIndex::AppendAllOpsOfType(const Worker_OpType OpType, TArray<Worker_Op*>& FoundOps) const
+{
+	// Only the first op is indexed for types that weren't asked to be kept.
+	const TArray<Worker_Op*>* KeptOps = KeptOpsByType.Find(OpType);
+	checkf(KeptOps != nullptr, TEXT("Op type %d wasn't kept by the FOpListIndex."), static_cast<int32>(OpType));
+	FoundOps.Append(*KeptOps);
+}
 } // namespace SpatialGDK
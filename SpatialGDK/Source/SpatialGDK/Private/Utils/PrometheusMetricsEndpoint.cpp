@@ -0,0 +1,264 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PrometheusMetricsEndpoint.h"
+
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+#include "Utils/SpatialThreadPolicy.h"
+
+DEFINE_LOG_CATEGORY(LogPrometheusMetricsEndpoint);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+const FTimespan AcceptWaitTime = FTimespan::FromMilliseconds(100);
+const FTimespan RequestWaitTime = FTimespan::FromSeconds(1);
+const int32 MaxRequestBytes = 4096;
+
+FString FormatValue(double Value)
+{
+	if (Value >= TNumericLimits<double>::Max())
+	{
+		return TEXT("+Inf");
+	}
+	return FString::SanitizeFloat(Value);
+}
+
+bool SendAll(FSocket& Socket, const uint8* Data, int32 Count)
+{
+	while (Count > 0)
+	{
+		int32 BytesSent = 0;
+		if (!Socket.Send(Data, Count, BytesSent) || BytesSent <= 0)
+		{
+			return false;
+		}
+		Data += BytesSent;
+		Count -= BytesSent;
+	}
+	return true;
+}
+
+} // anonymous namespace
+
+FString FPrometheusMetricsText::ToMetricName(const FString& Key)
+{
+	FString Name = TEXT("spatialgdk_") + Key.ToLower();
+	for (TCHAR& Character : Name)
+	{
+		if (!FChar::IsAlnum(Character) && Character != TEXT('_') && Character != TEXT(':'))
+		{
+			Character = TEXT('_');
+		}
+	}
+	return Name;
+}
+
+void FPrometheusMetricsText::AddHistogram(const HistogramMetric& Metric)
+{
+	FHistogramTotals& Totals = HistogramTotals.FindOrAdd(UTF8_TO_TCHAR(Metric.Key.c_str()));
+
+	// Bounds only change if the histogram was registered again, in which case the totals start over.
+	bool bSameBounds = Totals.UpperBounds.Num() == Metric.Buckets.Num();
+	for (int32 i = 0; bSameBounds && i < Metric.Buckets.Num(); i++)
+	{
+		bSameBounds = Totals.UpperBounds[i] == Metric.Buckets[i].UpperBound;
+	}
+	if (!bSameBounds)
+	{
+		Totals.UpperBounds.Reset(Metric.Buckets.Num());
+		for (const HistogramMetricBucket& Bucket : Metric.Buckets)
+		{
+			Totals.UpperBounds.Add(Bucket.UpperBound);
+		}
+		Totals.CumulativeCounts.Init(0, Metric.Buckets.Num());
+		Totals.Sum = 0.0;
+	}
+
+	for (int32 i = 0; i < Metric.Buckets.Num(); i++)
+	{
+		Totals.CumulativeCounts[i] += Metric.Buckets[i].Samples;
+	}
+	Totals.Sum += Metric.Sum;
+}
+
+FString FPrometheusMetricsText::Update(const SpatialMetrics& Metrics, const TArray<TPair<FString, uint64>>& Counters)
+{
+	for (const HistogramMetric& Metric : Metrics.HistogramMetrics)
+	{
+		AddHistogram(Metric);
+	}
+
+	FString Text;
+
+	if (Metrics.Load.IsSet())
+	{
+		Text += TEXT("# TYPE spatialgdk_worker_load gauge\n");
+		Text += FString::Printf(TEXT("spatialgdk_worker_load %s\n"), *FormatValue(Metrics.Load.GetValue()));
+	}
+
+	for (const GaugeMetric& Metric : Metrics.GaugeMetrics)
+	{
+		const FString Name = ToMetricName(UTF8_TO_TCHAR(Metric.Key.c_str()));
+		Text += FString::Printf(TEXT("# TYPE %s gauge\n%s %s\n"), *Name, *Name, *FormatValue(Metric.Value));
+	}
+
+	for (const TPair<FString, uint64>& Counter : Counters)
+	{
+		const FString Name = ToMetricName(Counter.Key) + TEXT("_total");
+		Text += FString::Printf(TEXT("# TYPE %s counter\n%s %llu\n"), *Name, *Name, Counter.Value);
+	}
+
+	for (const TPair<FString, FHistogramTotals>& Histogram : HistogramTotals)
+	{
+		const FString Name = ToMetricName(Histogram.Key);
+		const FHistogramTotals& Totals = Histogram.Value;
+
+		Text += FString::Printf(TEXT("# TYPE %s histogram\n"), *Name);
+		for (int32 i = 0; i < Totals.UpperBounds.Num(); i++)
+		{
+			Text += FString::Printf(TEXT("%s_bucket{le=\"%s\"} %llu\n"), *Name, *FormatValue(Totals.UpperBounds[i]), Totals.CumulativeCounts[i]);
+		}
+		const uint64 Count = Totals.CumulativeCounts.Num() > 0 ? Totals.CumulativeCounts.Last() : 0;
+		Text += FString::Printf(TEXT("%s_sum %s\n%s_count %llu\n"), *Name, *FormatValue(Totals.Sum), *Name, Count);
+	}
+
+	return Text;
+}
+
+FPrometheusMetricsEndpoint::FPrometheusMetricsEndpoint()
+	: LatestText(MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>())
+{
+}
+
+FPrometheusMetricsEndpoint::~FPrometheusMetricsEndpoint()
+{
+	if (Thread != nullptr)
+	{
+		Thread->Kill(true);
+		delete Thread;
+	}
+
+	if (ListenSocket != nullptr)
+	{
+		ListenSocket->Close();
+		SocketSubsystem->DestroySocket(ListenSocket);
+	}
+}
+
+bool FPrometheusMetricsEndpoint::Start(int32 Port)
+{
+	check(ListenSocket == nullptr);
+
+	SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem == nullptr)
+	{
+		return false;
+	}
+
+	TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+	Address->SetAnyAddress();
+	Address->SetPort(Port);
+
+	ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("PrometheusMetricsEndpoint"), false);
+	if (ListenSocket == nullptr)
+	{
+		return false;
+	}
+
+	ListenSocket->SetReuseAddr();
+	if (!ListenSocket->Bind(*Address) || !ListenSocket->Listen(8))
+	{
+		UE_LOG(LogPrometheusMetricsEndpoint, Warning, TEXT("Failed to listen for metrics scrapes on port %d."), Port);
+		SocketSubsystem->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+		return false;
+	}
+
+	Thread = CreateThreadWithPolicy(this, TEXT("PrometheusMetricsEndpoint"), TPri_BelowNormal);
+	UE_LOG(LogPrometheusMetricsEndpoint, Log, TEXT("Serving metrics at http://<host>:%d/metrics"), Port);
+	return true;
+}
+
+void FPrometheusMetricsEndpoint::Publish(const SpatialMetrics& Metrics, const TArray<TPair<FString, uint64>>& Counters)
+{
+	const FString Text = MetricsText.Update(Metrics, Counters);
+
+	FTCHARToUTF8 Converted(*Text);
+	TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> Body = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+	Body->Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+	FScopeLock Lock(&LatestTextLock);
+	LatestText = Body;
+}
+
+uint32 FPrometheusMetricsEndpoint::Run()
+{
+	while (!bStopping)
+	{
+		bool bHasPendingConnection = false;
+		if (!ListenSocket->WaitForPendingConnection(bHasPendingConnection, AcceptWaitTime) || !bHasPendingConnection)
+		{
+			continue;
+		}
+
+		if (FSocket* ClientSocket = ListenSocket->Accept(TEXT("PrometheusMetricsScrape")))
+		{
+			Serve(*ClientSocket);
+			ClientSocket->Close();
+			SocketSubsystem->DestroySocket(ClientSocket);
+		}
+	}
+
+	return 0;
+}
+
+void FPrometheusMetricsEndpoint::Stop()
+{
+	bStopping = true;
+}
+
+void FPrometheusMetricsEndpoint::Serve(FSocket& ClientSocket)
+{
+	if (!ClientSocket.Wait(ESocketWaitConditions::WaitForRead, RequestWaitTime))
+	{
+		return;
+	}
+
+	// Only the request line matters, which fits in the first read.
+	uint8 Request[MaxRequestBytes + 1];
+	int32 BytesRead = 0;
+	if (!ClientSocket.Recv(Request, MaxRequestBytes, BytesRead) || BytesRead <= 0)
+	{
+		return;
+	}
+	Request[BytesRead] = 0;
+
+	const FString RequestLine = UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Request));
+	const bool bIsMetricsRequest = RequestLine.StartsWith(TEXT("GET /metrics ")) || RequestLine.StartsWith(TEXT("GET /metrics?"));
+
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Body;
+	if (bIsMetricsRequest)
+	{
+		FScopeLock Lock(&LatestTextLock);
+		Body = LatestText;
+	}
+
+	const FString Header = bIsMetricsRequest
+		? FString::Printf(TEXT("HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %d\r\nConnection: close\r\n\r\n"), Body->Num())
+		: FString(TEXT("HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"));
+
+	FTCHARToUTF8 ConvertedHeader(*Header);
+	if (SendAll(ClientSocket, reinterpret_cast<const uint8*>(ConvertedHeader.Get()), ConvertedHeader.Length()) && Body.IsValid())
+	{
+		SendAll(ClientSocket, Body->GetData(), Body->Num());
+	}
+}
+
+} // namespace SpatialGDK
@@ -4,6 +4,7 @@
 
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/AtomicHistogram.h"
 
 DEFINE_LOG_CATEGORY(LogRPCContainer);
 
@@ -42,6 +43,9 @@ namespace
 		case ERPCResult::InvalidRPCType:
 			return TEXT("Invalid RPC Type");
 
+		case ERPCResult::HotEntityThrottled:
+			return TEXT("Unreliable RPC Throttled On Hot Entity");
+
 		case ERPCResult::NoOwningController:
 			return TEXT("No Owning Controller");
 
@@ -59,9 +63,9 @@ namespace
 		}
 	}
 
-	void LogRPCError(const FRPCErrorInfo& ErrorInfo, ERPCQueueType QueueType, const FPendingRPCParams& Params)
+	void LogRPCError(const FRPCErrorInfo& ErrorInfo, ERPCQueueType QueueType, const FPendingRPCParams& Params, const FDateTime& Now)
 	{
-		const FTimespan TimeDiff = FDateTime::Now() - Params.Timestamp;
+		const FTimespan TimeDiff = Now - Params.Timestamp;
 
 		// The format is expected to be:
 		// Function <objectName>::<functionName> sending/execution dropped/queued for <duration>. Reason: <reason>
@@ -98,35 +102,268 @@ FPendingRPCParams::FPendingRPCParams(const FUnrealObjectRef& InTargetObjectRef,
 void FRPCContainer::ProcessOrQueueRPC(const FUnrealObjectRef& TargetObjectRef, ERPCType Type, RPCPayload&& Payload)
 {
 	FPendingRPCParams Params {TargetObjectRef, Type, MoveTemp(Payload)};
+	Params.Timestamp = TimeSource();
 
+	FRPCErrorInfo ErrorInfo;
 	if (!ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, Params.Type))
 	{
-		if (ApplyFunction(Params))
+		if (ApplyFunction(Params, ErrorInfo))
 		{
+			if (QueuedTimeHistogram != nullptr)
+			{
+				QueuedTimeHistogram->Record(0.0);
+			}
 			return;
 		}
 	}
 
-	FArrayOfParams& ArrayOfParams = QueuedRPCs.FindOrAdd(Params.Type).FindOrAdd(Params.ObjectRef.Entity);
-	ArrayOfParams.Push(MoveTemp(Params));
+	const Worker_EntityId EntityId = Params.ObjectRef.Entity;
+	FRPCQueue& Queue = EntityQueues.FindOrAdd(EntityId).Queues[static_cast<int32>(Params.Type)];
+	if (Queue.Head == INDEX_NONE)
+	{
+		// A new queue only waits if applying its first RPC just said so.
+		if (OnApplyFailed(EntityId, Queue, Params, ErrorInfo))
+		{
+			ReadyEntities.Add(EntityId);
+		}
+	}
+	PushRPC(Queue, MoveTemp(Params));
 }
 
-void FRPCContainer::ProcessRPCs(FArrayOfParams& RPCList)
+bool FRPCContainer::OnApplyFailed(Worker_EntityId EntityId, FRPCQueue& Queue, const FPendingRPCParams& Params, const FRPCErrorInfo& ErrorInfo)
 {
-	// TODO: UNR-1651 Find a way to drop queued RPCs
-	int NumProcessedParams = 0;
-	for (auto& Params : RPCList)
+	Queue.bWaitingForTarget = ErrorInfo.ErrorCode == ERPCResult::UnresolvedTargetObject;
+	Queue.bWaitingForRefs = ErrorInfo.ErrorCode == ERPCResult::UnresolvedParameters && ErrorInfo.UnresolvedRefs.Num() > 0;
+	if (Queue.bWaitingForRefs)
 	{
-		if (ApplyFunction(Params))
+		WaitForRefs(EntityId, Params, ErrorInfo.UnresolvedRefs);
+		return false;
+	}
+	return !Queue.bWaitingForTarget;
+}
+
+void FRPCContainer::WaitForRefs(Worker_EntityId EntityId, const FPendingRPCParams& Params, const TArray<FUnrealObjectRef>& Refs)
+{
+	FEntityRPCQueues& Queues = EntityQueues.FindChecked(EntityId);
+	for (const FUnrealObjectRef& Ref : Refs)
+	{
+		bool bAlreadyInSet = false;
+		EntitiesWaitingForRefs.FindOrAdd(Ref).Add(EntityId, &bAlreadyInSet);
+		if (!bAlreadyInSet)
 		{
-			NumProcessedParams++;
+			Queues.WaitingForRefs.Add(Ref);
 		}
-		else
+	}
+
+	// Unreliable RPCs also need to be woken up to expire.
+	float TimeoutSeconds = UnresolvedRefsTimeoutSeconds;
+	const float TimeToLive = GetDefault<USpatialGDKSettings>()->GetUnreliableRPCTimeToLive(Params.Type);
+	if (TimeToLive > 0.f)
+	{
+		TimeoutSeconds = FMath::Min(TimeoutSeconds, TimeToLive);
+	}
+	RefWaitTimeouts.HeapPush(FRefWaitTimeout{ Params.Timestamp + FTimespan::FromSeconds(TimeoutSeconds), EntityId });
+}
+
+void FRPCContainer::StopWaitingForRefs(Worker_EntityId EntityId, FEntityRPCQueues& Queues)
+{
+	for (const FUnrealObjectRef& Ref : Queues.WaitingForRefs)
+	{
+		if (TSet<Worker_EntityId_Key>* WaitingEntities = EntitiesWaitingForRefs.Find(Ref))
+		{
+			WaitingEntities->Remove(EntityId);
+			if (WaitingEntities->Num() == 0)
+			{
+				EntitiesWaitingForRefs.Remove(Ref);
+			}
+		}
+	}
+	Queues.WaitingForRefs.Reset();
+
+	for (FRPCQueue& Queue : Queues.Queues)
+	{
+		Queue.bWaitingForRefs = false;
+	}
+}
+
+void FRPCContainer::WakeTimedOutEntities()
+{
+	const FDateTime Now = TimeSource();
+	while (RefWaitTimeouts.Num() > 0 && RefWaitTimeouts.HeapTop().Time <= Now)
+	{
+		const Worker_EntityId EntityId = RefWaitTimeouts.HeapTop().EntityId;
+		RefWaitTimeouts.HeapPopDiscard();
+
+		FEntityRPCQueues* Queues = EntityQueues.Find(EntityId);
+		if (Queues != nullptr && Queues->WaitingForRefs.Num() > 0)
 		{
-			break;
+			StopWaitingForRefs(EntityId, *Queues);
+			ReadyEntities.Add(EntityId);
 		}
 	}
-	RPCList.RemoveAt(0, NumProcessedParams);
+}
+
+void FRPCContainer::OnObjectRefResolved(const FUnrealObjectRef& ObjectRef)
+{
+	TSet<Worker_EntityId_Key> WaitingEntities;
+	if (!EntitiesWaitingForRefs.RemoveAndCopyValue(ObjectRef, WaitingEntities))
+	{
+		return;
+	}
+
+	for (const Worker_EntityId_Key EntityId : WaitingEntities)
+	{
+		if (FEntityRPCQueues* Queues = EntityQueues.Find(EntityId))
+		{
+			// Queues still waiting for other references register on them again when they are retried.
+			StopWaitingForRefs(EntityId, *Queues);
+			ReadyEntities.Add(EntityId);
+		}
+	}
+}
+
+int32 FRPCContainer::AllocateNode(FPendingRPCParams&& Params)
+{
+	int32 NodeIndex = FreeNodeHead;
+	if (NodeIndex != INDEX_NONE)
+	{
+		FreeNodeHead = Nodes[NodeIndex].Next;
+	}
+	else
+	{
+		NodeIndex = Nodes.AddDefaulted();
+	}
+
+	FQueuedRPCNode& Node = Nodes[NodeIndex];
+	Node.Params.Emplace(MoveTemp(Params));
+	Node.Next = INDEX_NONE;
+	NumQueuedRPCs++;
+	return NodeIndex;
+}
+
+void FRPCContainer::FreeNode(int32 NodeIndex)
+{
+	FQueuedRPCNode& Node = Nodes[NodeIndex];
+	Node.Params.Reset();
+	Node.Generation++;
+	Node.Next = FreeNodeHead;
+	FreeNodeHead = NodeIndex;
+	NumQueuedRPCs--;
+}
+
+void FRPCContainer::PushRPC(FRPCQueue& Queue, FPendingRPCParams&& Params)
+{
+	const int32 NodeIndex = AllocateNode(MoveTemp(Params));
+	if (Queue.Tail == INDEX_NONE)
+	{
+		Queue.Head = NodeIndex;
+	}
+	else
+	{
+		Nodes[Queue.Tail].Next = NodeIndex;
+	}
+	Queue.Tail = NodeIndex;
+}
+
+void FRPCContainer::PopRPC(FRPCQueue& Queue)
+{
+	const int32 NodeIndex = Queue.Head;
+	Queue.Head = Nodes[NodeIndex].Next;
+	if (Queue.Head == INDEX_NONE)
+	{
+		Queue.Tail = INDEX_NONE;
+	}
+	FreeNode(NodeIndex);
+}
+
+void FRPCContainer::ProcessQueue(Worker_EntityId EntityId, int32 TypeIndex)
+{
+	const float TimeToLive = GetDefault<USpatialGDKSettings>()->GetUnreliableRPCTimeToLive(static_cast<ERPCType>(TypeIndex));
+	const FDateTime Now = TimeSource();
+
+	// The processing function may queue or drop RPCs, which can move the nodes and the entity queues, so nothing is held by reference across it.
+	while (FEntityRPCQueues* Queues = EntityQueues.Find(EntityId))
+	{
+		const int32 NodeIndex = Queues->Queues[TypeIndex].Head;
+		if (NodeIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		// Late unreliable RPCs are no use to anyone, so they are dropped rather than sent or executed.
+		if (TimeToLive > 0.f && (Now - Nodes[NodeIndex].Params->Timestamp).GetTotalSeconds() > TimeToLive)
+		{
+			UE_LOG(LogRPCContainer, Verbose, TEXT("Dropping %s RPC on entity %lld queued for longer than its time to live of %.2f seconds"),
+				*SpatialConstants::RPCTypeToString(static_cast<ERPCType>(TypeIndex)), EntityId, TimeToLive);
+			NumExpiredRPCs++;
+			PopRPC(Queues->Queues[TypeIndex]);
+			continue;
+		}
+
+		const uint32 Generation = Nodes[NodeIndex].Generation;
+		FPendingRPCParams Params = MoveTemp(Nodes[NodeIndex].Params.GetValue());
+
+		FRPCErrorInfo ErrorInfo;
+		const bool bApplied = ApplyFunction(Params, ErrorInfo);
+
+		if (Nodes[NodeIndex].Generation != Generation)
+		{
+			// The entity was dropped while its RPC was being applied.
+			return;
+		}
+
+		FRPCQueue& Queue = EntityQueues.FindChecked(EntityId).Queues[TypeIndex];
+		if (!bApplied)
+		{
+			OnApplyFailed(EntityId, Queue, Params, ErrorInfo);
+			Nodes[NodeIndex].Params.GetValue() = MoveTemp(Params);
+			return;
+		}
+
+		if (QueuedTimeHistogram != nullptr)
+		{
+			QueuedTimeHistogram->Record((TimeSource() - Params.Timestamp).GetTotalSeconds());
+		}
+
+		PopRPC(Queue);
+	}
+}
+
+bool FRPCContainer::ProcessRPCs(Worker_EntityId EntityId)
+{
+	for (int32 TypeIndex = 0; TypeIndex < NumRPCTypes; TypeIndex++)
+	{
+		// Queues waiting for parameters are only retried once they're woken up.
+		const FEntityRPCQueues* Queues = EntityQueues.Find(EntityId);
+		if (Queues != nullptr && !Queues->Queues[TypeIndex].bWaitingForRefs)
+		{
+			ProcessQueue(EntityId, TypeIndex);
+		}
+	}
+
+	FEntityRPCQueues* Queues = EntityQueues.Find(EntityId);
+	if (Queues == nullptr)
+	{
+		return false;
+	}
+
+	bool bHasQueuedRPCs = false;
+	bool bCanMakeProgress = false;
+	for (const FRPCQueue& Queue : Queues->Queues)
+	{
+		if (Queue.Head != INDEX_NONE)
+		{
+			bHasQueuedRPCs = true;
+			bCanMakeProgress |= !Queue.bWaitingForTarget && !Queue.bWaitingForRefs;
+		}
+	}
+
+	if (!bHasQueuedRPCs)
+	{
+		EntityQueues.Remove(EntityId);
+	}
+
+	return bCanMakeProgress;
 }
 
 void FRPCContainer::ProcessRPCs()
@@ -139,17 +376,15 @@ void FRPCContainer::ProcessRPCs()
 
 	bAlreadyProcessingRPCs = true;
 
-	for (auto& RPCs : QueuedRPCs)
+	WakeTimedOutEntities();
+
+	// Processing can change the ready set, so walk a snapshot of it.
+	const TArray<Worker_EntityId_Key> EntitiesToProcess = ReadyEntities.Array();
+	for (const Worker_EntityId_Key EntityId : EntitiesToProcess)
 	{
-		FRPCMap& MapOfQueues = RPCs.Value;
-		for (auto It = MapOfQueues.CreateIterator(); It; ++It)
+		if (!ProcessRPCs(EntityId))
 		{
-			FArrayOfParams& RPCList = It.Value();
-			ProcessRPCs(RPCList);
-			if (RPCList.Num() == 0)
-			{
-				It.RemoveCurrent();
-			}
+			ReadyEntities.Remove(EntityId);
 		}
 	}
 
@@ -158,27 +393,75 @@ void FRPCContainer::ProcessRPCs()
 
 void FRPCContainer::DropForEntity(const Worker_EntityId& EntityId)
 {
-	for (auto& RpcMap : QueuedRPCs)
+	FEntityRPCQueues Queues;
+	if (!EntityQueues.RemoveAndCopyValue(EntityId, Queues))
 	{
-		RpcMap.Value.Remove(EntityId);
+		return;
 	}
+
+	StopWaitingForRefs(EntityId, Queues);
+
+	for (const FRPCQueue& Queue : Queues.Queues)
+	{
+		for (int32 NodeIndex = Queue.Head; NodeIndex != INDEX_NONE;)
+		{
+			const int32 NextNodeIndex = Nodes[NodeIndex].Next;
+			FreeNode(NodeIndex);
+			NodeIndex = NextNodeIndex;
+		}
+	}
+	ReadyEntities.Remove(EntityId);
 }
 
-bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const
+void FRPCContainer::MarkEntityReady(const Worker_EntityId& EntityId)
 {
-	if(const FRPCMap* MapOfQueues = QueuedRPCs.Find(Type))
+	if (FEntityRPCQueues* Queues = EntityQueues.Find(EntityId))
 	{
-		if(const FArrayOfParams* RPCList = MapOfQueues->Find(EntityId))
+		for (FRPCQueue& Queue : Queues->Queues)
 		{
-			return (RPCList->Num() > 0);
+			Queue.bWaitingForTarget = false;
 		}
+		ReadyEntities.Add(EntityId);
+	}
+}
+
+bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const
+{
+	if (const FEntityRPCQueues* Queues = EntityQueues.Find(EntityId))
+	{
+		return Queues->Queues[static_cast<int32>(Type)].Head != INDEX_NONE;
 	}
 
 	return false;
 }
+
+SIZE_T FRPCContainer::GetAllocatedSize() const
+{
+	SIZE_T TotalBytes = Nodes.GetAllocatedSize() + EntityQueues.GetAllocatedSize() + ReadyEntities.GetAllocatedSize()
+		+ EntitiesWaitingForRefs.GetAllocatedSize() + RefWaitTimeouts.GetAllocatedSize();
+
+	for (const FQueuedRPCNode& Node : Nodes)
+	{
+		if (Node.Params.IsSet())
+		{
+			TotalBytes += Node.Params->Payload.PayloadData.GetAllocatedSize();
+		}
+	}
+	for (const auto& Pair : EntityQueues)
+	{
+		TotalBytes += Pair.Value.WaitingForRefs.GetAllocatedSize();
+	}
+	for (const auto& Pair : EntitiesWaitingForRefs)
+	{
+		TotalBytes += Pair.Value.GetAllocatedSize();
+	}
+
+	return TotalBytes;
+}
  
 FRPCContainer::FRPCContainer(ERPCQueueType InQueueType)
 	: QueueType(InQueueType)
+	, TimeSource([] { return FDateTime::Now(); })
 {
 }
 
@@ -187,20 +470,20 @@ void FRPCContainer::BindProcessingFunction(const FProcessRPCDelegate& Function)
 	ProcessingFunction = Function;
 }
 
-bool FRPCContainer::ApplyFunction(FPendingRPCParams& Params)
+bool FRPCContainer::ApplyFunction(FPendingRPCParams& Params, FRPCErrorInfo& OutErrorInfo)
 {
 	ensure(ProcessingFunction.IsBound());
-	FRPCErrorInfo ErrorInfo = ProcessingFunction.Execute(Params);
+	OutErrorInfo = ProcessingFunction.Execute(Params);
 
-	if (ErrorInfo.Success())
+	if (OutErrorInfo.Success())
 	{
 		return true;
 	}
 	else
 	{
 #if !UE_BUILD_SHIPPING
-		LogRPCError(ErrorInfo, QueueType, Params);
+		LogRPCError(OutErrorInfo, QueueType, Params, TimeSource());
 #endif
-		return ErrorInfo.bShouldDrop;
+		return OutErrorInfo.bShouldDrop;
 	}
 }
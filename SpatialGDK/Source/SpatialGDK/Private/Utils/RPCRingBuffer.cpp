@@ -4,6 +4,11 @@
 
 #include "SpatialGDKSettings.h"
 
+#include "Serialization/LargeMemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRPCRingBuffer, Log, All);
+
 namespace SpatialGDK
 {
 
@@ -11,6 +16,7 @@ RPCRingBuffer::RPCRingBuffer(ERPCType InType)
 	: Type(InType)
 {
 	RingBuffer.SetNum(RPCRingBufferUtils::GetRingBufferSize(Type));
+	PackedRingBuffer.SetNum(RingBuffer.Num());
 }
 
 namespace RPCRingBufferUtils
@@ -28,6 +34,8 @@ Worker_ComponentId GetRingBufferComponentId(ERPCType Type)
 		return SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
 	case ERPCType::NetMulticast:
 		return SpatialConstants::MULTICAST_RPCS_COMPONENT_ID;
+	case ERPCType::CrossServer:
+		return SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID;
 	default:
 		checkNoEntry();
 		return SpatialConstants::INVALID_COMPONENT_ID;
@@ -35,9 +43,14 @@ Worker_ComponentId GetRingBufferComponentId(ERPCType Type)
 }
 
 RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type)
+{
+	return GetRingBufferDescriptor(Type, GetRingBufferSize(Type));
+}
+
+RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type, uint32 RingBufferSize)
 {
 	RPCRingBufferDescriptor Descriptor;
-	Descriptor.RingBufferSize = GetRingBufferSize(Type);
+	Descriptor.RingBufferSize = RingBufferSize;
 
 	uint32 MaxRingBufferSize = GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize;
 	// In schema, the client and server endpoints will first have a
@@ -46,13 +59,14 @@ RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type)
 	//   Unreliable ring buffer, containing MaxRingBufferSize elements,
 	//   Last sent unreliable RPC,
 	//   followed by reliable and unreliable RPC acks.
-	// MulticastRPCs component will only have one buffer that looks like the reliable buffer above.
+	// MulticastRPCs and CrossServerEndpoint components will only have one buffer that looks like the reliable buffer above.
 	// The numbers below are based on this structure, and have to match the component generated in SchemaGenerator (GenerateRPCEndpointsSchema).
 	switch (Type)
 	{
 	case ERPCType::ClientReliable:
 	case ERPCType::ServerReliable:
 	case ERPCType::NetMulticast:
+	case ERPCType::CrossServer:
 		Descriptor.SchemaFieldStart = 1;
 		Descriptor.LastSentRPCFieldId = 1 + MaxRingBufferSize;
 		break;
@@ -103,6 +117,34 @@ Schema_FieldId GetAckFieldId(ERPCType Type)
 	case ERPCType::ClientUnreliable:
 	case ERPCType::ServerUnreliable:
 		return 1 + 2 * (MaxRingBufferSize + 1) + 1;
+	case ERPCType::CrossServer:
+		// A map from sending server worker entity to the last RPC acked from it, following the ring buffer + last sent id.
+		return 1 + MaxRingBufferSize + 1;
+	default:
+		checkNoEntry();
+		return 0;
+	}
+}
+
+Schema_FieldId GetRingBufferSizeFieldId(ERPCType Type)
+{
+	uint32 MaxRingBufferSize = GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize;
+
+	switch (Type)
+	{
+	case ERPCType::ClientReliable:
+	case ERPCType::ServerReliable:
+		// In the generated schema components, ring buffer sizes follow the two ring buffers and the two acks.
+		return 1 + 2 * (MaxRingBufferSize + 1) + 2;
+	case ERPCType::ClientUnreliable:
+	case ERPCType::ServerUnreliable:
+		return 1 + 2 * (MaxRingBufferSize + 1) + 3;
+	case ERPCType::NetMulticast:
+		// This field follows the ring buffer + last sent id and the initially present multicast RPCs count.
+		return 1 + MaxRingBufferSize + 2;
+	case ERPCType::CrossServer:
+		// This field follows the ring buffer + last sent id and the ack map.
+		return 1 + MaxRingBufferSize + 2;
 	default:
 		checkNoEntry();
 		return 0;
@@ -116,6 +158,13 @@ Schema_FieldId GetInitiallyPresentMulticastRPCsCountFieldId()
 	return 1 + MaxRingBufferSize + 1;
 }
 
+Schema_FieldId GetPingIdFieldId()
+{
+	uint32 MaxRingBufferSize = GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize;
+	// This field follows the two ring buffers, the two acks and the two ring buffer sizes.
+	return 1 + 2 * (MaxRingBufferSize + 1) + 4;
+}
+
 bool ShouldQueueOverflowed(ERPCType Type)
 {
 	switch (Type)
@@ -125,6 +174,7 @@ bool ShouldQueueOverflowed(ERPCType Type)
 		return true;
 	case ERPCType::ClientUnreliable:
 	case ERPCType::ServerUnreliable:
+		return GetDefault<USpatialGDKSettings>()->bQueueOverflowedUnreliableRPCs;
 	case ERPCType::NetMulticast:
 		return false;
 	default:
@@ -133,16 +183,56 @@ bool ShouldQueueOverflowed(ERPCType Type)
 	}
 }
 
+bool ShouldPackRPCs(ERPCType Type)
+{
+	switch (Type)
+	{
+	case ERPCType::ClientUnreliable:
+	case ERPCType::ServerUnreliable:
+		return GetDefault<USpatialGDKSettings>()->bPackUnreliableRPCs;
+	case ERPCType::NetMulticast:
+		return GetDefault<USpatialGDKSettings>()->bBatchMulticastRPCs;
+	default:
+		return false;
+	}
+}
+
 void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer)
 {
-	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(OutBuffer.Type);
+	// The size only ever changes once every RPC sent through the buffer has been acknowledged, so no unread element is lost here.
+	const Schema_FieldId RingBufferSizeFieldId = GetRingBufferSizeFieldId(OutBuffer.Type);
+	if (Schema_GetUint32Count(SchemaObject, RingBufferSizeFieldId) > 0)
+	{
+		uint32 RingBufferSize = Schema_GetUint32(SchemaObject, RingBufferSizeFieldId);
+		RingBufferSize = RingBufferSize > 0 ? FMath::Min(RingBufferSize, GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize) : GetRingBufferSize(OutBuffer.Type);
+		if (RingBufferSize != static_cast<uint32>(OutBuffer.RingBuffer.Num()))
+		{
+			OutBuffer.RingBuffer.Reset();
+			OutBuffer.RingBuffer.SetNum(RingBufferSize);
+			OutBuffer.PackedRingBuffer.Reset();
+			OutBuffer.PackedRingBuffer.SetNum(RingBufferSize);
+		}
+	}
+
+	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(OutBuffer.Type, OutBuffer.RingBuffer.Num());
 
 	for (uint32 RingBufferIndex = 0; RingBufferIndex < Descriptor.RingBufferSize; RingBufferIndex++)
 	{
 		Schema_FieldId FieldId = Descriptor.SchemaFieldStart + RingBufferIndex;
 		if (Schema_GetObjectCount(SchemaObject, FieldId) > 0)
 		{
-			OutBuffer.RingBuffer[RingBufferIndex].Emplace(Schema_GetObject(SchemaObject, FieldId));
+			// An element may have been packed or not the last time it was written, so clear whichever form isn't in this one.
+			Schema_Object* RPCObject = Schema_GetObject(SchemaObject, FieldId);
+			OutBuffer.PackedRingBuffer[RingBufferIndex].Reset();
+			if (Schema_GetBytesCount(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID) > 0)
+			{
+				OutBuffer.RingBuffer[RingBufferIndex].Reset();
+				ReadPackedRPCs(GetBytesViewFromSchema(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID), OutBuffer.PackedRingBuffer[RingBufferIndex]);
+			}
+			else
+			{
+				OutBuffer.RingBuffer[RingBufferIndex].Emplace(RPCObject);
+			}
 		}
 	}
 
@@ -162,9 +252,24 @@ void ReadAckFromSchema(const Schema_Object* SchemaObject, ERPCType Type, uint64&
 	}
 }
 
+void ReadPingIdFromSchema(const Schema_Object* SchemaObject, uint32& OutPingId)
+{
+	const Schema_FieldId PingIdFieldId = GetPingIdFieldId();
+
+	if (Schema_GetUint32Count(SchemaObject, PingIdFieldId) > 0)
+	{
+		OutPingId = Schema_GetUint32(SchemaObject, PingIdFieldId);
+	}
+}
+
 void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const RPCPayload& Payload)
 {
-	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(Type);
+	WriteRPCToSchema(SchemaObject, Type, GetRingBufferSize(Type), RPCId, Payload);
+}
+
+void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint32 RingBufferSize, uint64 RPCId, const RPCPayload& Payload)
+{
+	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(Type, RingBufferSize);
 
 	Schema_Object* RPCObject = Schema_AddObject(SchemaObject, Descriptor.GetRingBufferElementFieldId(RPCId));
 	Payload.WriteToSchemaObject(RPCObject);
@@ -173,6 +278,70 @@ void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId,
 	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
 }
 
+void AppendPackedRPC(TArray<uint8>& PackedRPCs, const RPCPayload& Payload)
+{
+	FMemoryWriter Writer(PackedRPCs, false, true);
+
+	uint32 Offset = Payload.Offset;
+	uint32 Index = Payload.Index;
+	uint32 Size = Payload.PayloadData.Num();
+	Writer.SerializeIntPacked(Offset);
+	Writer.SerializeIntPacked(Index);
+	Writer.SerializeIntPacked(Size);
+	Writer.Serialize(const_cast<uint8*>(Payload.PayloadData.GetData()), Size);
+}
+
+void ReadPackedRPCs(TArrayView<const uint8> PackedRPCs, TArray<RPCPayload>& OutPayloads)
+{
+	FLargeMemoryReader Reader(PackedRPCs.GetData(), PackedRPCs.Num());
+
+	while (!Reader.AtEnd())
+	{
+		uint32 Offset = 0;
+		uint32 Index = 0;
+		uint32 Size = 0;
+		Reader.SerializeIntPacked(Offset);
+		Reader.SerializeIntPacked(Index);
+		Reader.SerializeIntPacked(Size);
+
+		if (Reader.IsError() || Size > Reader.TotalSize() - Reader.Tell())
+		{
+			UE_LOG(LogRPCRingBuffer, Error, TEXT("Failed to read packed RPCs, %d RPCs read before the error."), OutPayloads.Num());
+			return;
+		}
+
+		TArray<uint8> PayloadData;
+		PayloadData.SetNumUninitialized(Size);
+		Reader.Serialize(PayloadData.GetData(), Size);
+
+		OutPayloads.Emplace(Offset, Index, MoveTemp(PayloadData));
+	}
+}
+
+void WriteRingBufferSizeToSchema(Schema_Object* SchemaObject, ERPCType Type, uint32 RingBufferSize)
+{
+	const Schema_FieldId RingBufferSizeFieldId = GetRingBufferSizeFieldId(Type);
+
+	Schema_ClearField(SchemaObject, RingBufferSizeFieldId);
+	Schema_AddUint32(SchemaObject, RingBufferSizeFieldId, RingBufferSize);
+}
+
+void WritePackedRPCsToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const TArray<uint8>& PackedRPCs)
+{
+	WritePackedRPCsToSchema(SchemaObject, Type, GetRingBufferSize(Type), RPCId, PackedRPCs);
+}
+
+void WritePackedRPCsToSchema(Schema_Object* SchemaObject, ERPCType Type, uint32 RingBufferSize, uint64 RPCId, const TArray<uint8>& PackedRPCs)
+{
+	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(Type, RingBufferSize);
+
+	Schema_Object* RPCObject = Schema_AddObject(SchemaObject, Descriptor.GetRingBufferElementFieldId(RPCId));
+	AddBytesToSchema(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID, PackedRPCs.GetData(), PackedRPCs.Num());
+
+	Schema_ClearField(SchemaObject, Descriptor.LastSentRPCFieldId);
+	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
+}
+
 void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack)
 {
 	Schema_FieldId AckFieldId = GetAckFieldId(Type);
@@ -181,6 +350,14 @@ void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack)
 	Schema_AddUint64(SchemaObject, AckFieldId, Ack);
 }
 
+void WritePingIdToSchema(Schema_Object* SchemaObject, uint32 PingId)
+{
+	const Schema_FieldId PingIdFieldId = GetPingIdFieldId();
+
+	Schema_ClearField(SchemaObject, PingIdFieldId);
+	Schema_AddUint32(SchemaObject, PingIdFieldId, PingId);
+}
+
 void MoveLastSentIdToInitiallyPresentCount(Schema_Object* SchemaObject, uint64 LastSentId)
 {
 	// This is a special field that is set when creating a MulticastRPCs component with initial RPCs.
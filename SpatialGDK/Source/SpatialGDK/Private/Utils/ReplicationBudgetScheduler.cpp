@@ -0,0 +1,131 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ReplicationBudgetScheduler.h"
+
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialReplicationBudgetScheduler);
+
+namespace SpatialGDK
+{
+
+FReplicationBudgetScheduler::FReplicationBudgetScheduler(float InTimeBudgetSeconds, uint32 InByteBudget, float InStarvationThresholdSeconds)
+	: TimeBudgetSeconds(InTimeBudgetSeconds)
+	, ByteBudget(InByteBudget)
+	, StarvationThresholdSeconds(InStarvationThresholdSeconds)
+{
+}
+
+void FReplicationBudgetScheduler::BeginTick(double InCurrentTime)
+{
+	CurrentTime = InCurrentTime;
+	TickIndex++;
+
+	BudgetSpent = 0.0;
+	CurrentTickTotalWeight = 0.0;
+	StarvedActorsReplicated = 0;
+}
+
+bool FReplicationBudgetScheduler::ShouldReplicate(const AActor* Actor, float Weight)
+{
+	FActorBudgetState& State = FindOrAddState(Actor);
+
+	const double ClampedWeight = FMath::Max(static_cast<double>(Weight), KINDA_SMALL_NUMBER);
+	CurrentTickTotalWeight += ClampedWeight;
+
+	// Until a full tick of candidates has been seen, each actor is credited the whole budget.
+	const double CreditPerWeight = LastTickTotalWeight > 0.0 ? 1.0 / LastTickTotalWeight : 1.0;
+
+	// Cap the carried over credit so an actor returning from a long idle period cannot claim many ticks of budget at once.
+	const double MaxCredit = FMath::Max(1.0, State.EstimatedCost);
+	State.Credit = FMath::Min(State.Credit + ClampedWeight * CreditPerWeight, MaxCredit);
+
+	if (StarvationThresholdSeconds > 0.f && CurrentTime - State.LastReplicatedTime >= StarvationThresholdSeconds)
+	{
+		StarvedActorsReplicated++;
+		return true;
+	}
+
+	if (BudgetSpent >= 1.0)
+	{
+		return false;
+	}
+
+	return State.Credit >= State.EstimatedCost;
+}
+
+void FReplicationBudgetScheduler::ReportCost(const AActor* Actor, double ElapsedSeconds, int64 BytesWritten)
+{
+	FActorBudgetState& State = FindOrAddState(Actor);
+
+	const double Cost = GetNormalizedCost(ElapsedSeconds, BytesWritten);
+
+	State.Credit = FMath::Max(State.Credit - Cost, -1.0);
+	State.EstimatedCost = FMath::Lerp(State.EstimatedCost, Cost, CostSmoothingFactor);
+	State.LastReplicatedTime = CurrentTime;
+	State.bReplicatedThisTick = true;
+
+	AverageCost = FMath::Lerp(AverageCost, Cost, CostSmoothingFactor);
+	BudgetSpent += Cost;
+}
+
+void FReplicationBudgetScheduler::EndTick()
+{
+	OldestUnreplicatedActorAge = 0.0;
+
+	for (auto It = ActorStates.CreateIterator(); It; ++It)
+	{
+		FActorBudgetState& State = It.Value();
+
+		if (State.LastConsideredTick + StalePruneTicks < TickIndex)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (State.LastConsideredTick == TickIndex && !State.bReplicatedThisTick)
+		{
+			OldestUnreplicatedActorAge = FMath::Max(OldestUnreplicatedActorAge, CurrentTime - State.LastReplicatedTime);
+		}
+
+		State.bReplicatedThisTick = false;
+	}
+
+	LastTickTotalWeight = CurrentTickTotalWeight;
+	LastTickBudgetSpent = BudgetSpent;
+	LastTickStarvedActorsReplicated = StarvedActorsReplicated;
+
+	UE_LOG(LogSpatialReplicationBudgetScheduler, Verbose, TEXT("Replication budget spent: %.2f, starved actors replicated: %d, oldest unreplicated actor age: %.2fs"),
+		LastTickBudgetSpent, LastTickStarvedActorsReplicated, OldestUnreplicatedActorAge);
+}
+
+FReplicationBudgetScheduler::FActorBudgetState& FReplicationBudgetScheduler::FindOrAddState(const AActor* Actor)
+{
+	FActorBudgetState* State = ActorStates.Find(Actor);
+	if (State == nullptr)
+	{
+		// New actors start with the average cost estimate, and count as unreplicated from the moment they are first seen.
+		State = &ActorStates.Add(Actor);
+		State->EstimatedCost = AverageCost;
+		State->LastReplicatedTime = CurrentTime;
+	}
+
+	State->LastConsideredTick = TickIndex;
+	return *State;
+}
+
+double FReplicationBudgetScheduler::GetNormalizedCost(double ElapsedSeconds, int64 BytesWritten) const
+{
+	double Cost = 0.0;
+	if (TimeBudgetSeconds > 0.f)
+	{
+		Cost = FMath::Max(Cost, ElapsedSeconds / TimeBudgetSeconds);
+	}
+	if (ByteBudget > 0)
+	{
+		Cost = FMath::Max(Cost, static_cast<double>(BytesWritten) / ByteBudget);
+	}
+	return Cost;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,183 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ReplicationPlan.h"
+
+#include "Net/RepLayout.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+#include "Utils/SchemaUtils.h"
+
+namespace
+{
+	// Numeric properties are widened to the schema type when written, and narrowed back when read, in the same way as
+	// ComponentFactory::AddProperty and ComponentReader::ApplyProperty.
+	template<typename PropertyType, typename SchemaType, void (*AddToSchema)(Schema_Object*, Schema_FieldId, SchemaType)>
+	void WriteNumericProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+	{
+		AddToSchema(Object, FieldId, static_cast<SchemaType>(static_cast<PropertyType*>(Property)->GetPropertyValue(Data)));
+	}
+
+	template<typename PropertyType, typename SchemaType, SchemaType (*IndexFromSchema)(const Schema_Object*, Schema_FieldId, uint32_t)>
+	void ReadNumericProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+	{
+		static_cast<PropertyType*>(Property)->SetPropertyValue(Data, static_cast<typename PropertyType::TCppType>(IndexFromSchema(Object, FieldId, Index)));
+	}
+
+	template<typename PropertyType, typename SchemaType, void (*AddToSchema)(Schema_Object*, Schema_FieldId, SchemaType), SchemaType (*IndexFromSchema)(const Schema_Object*, Schema_FieldId, uint32_t)>
+	SpatialGDK::FReplicationPlanEntry NumericEntry()
+	{
+		return { &WriteNumericProperty<PropertyType, SchemaType, AddToSchema>, &ReadNumericProperty<PropertyType, SchemaType, IndexFromSchema> };
+	}
+
+	void WriteBoolProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+	{
+		Schema_AddBool(Object, FieldId, (uint8)static_cast<UBoolProperty*>(Property)->GetPropertyValue(Data));
+	}
+
+	void ReadBoolProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+	{
+		static_cast<UBoolProperty*>(Property)->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
+	}
+
+	void WriteNameProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+	{
+		SpatialGDK::AddStringToSchema(Object, FieldId, static_cast<UNameProperty*>(Property)->GetPropertyValue(Data).ToString());
+	}
+
+	void ReadNameProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+	{
+		static_cast<UNameProperty*>(Property)->SetPropertyValue(Data, SpatialGDK::IndexNameFromSchema(Object, FieldId, Index));
+	}
+
+	void WriteStrProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+	{
+		SpatialGDK::AddStringToSchema(Object, FieldId, static_cast<UStrProperty*>(Property)->GetPropertyValue(Data));
+	}
+
+	void ReadStrProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+	{
+		SpatialGDK::IndexStringFromSchema(Object, FieldId, Index, *static_cast<UStrProperty*>(Property)->GetPropertyValuePtr(Data));
+	}
+
+	void WriteTextProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+	{
+		SpatialGDK::AddStringToSchema(Object, FieldId, static_cast<UTextProperty*>(Property)->GetPropertyValue(Data).ToString());
+	}
+
+	void ReadTextProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+	{
+		static_cast<UTextProperty*>(Property)->SetPropertyValue(Data, FText::FromString(SpatialGDK::IndexStringFromSchema(Object, FieldId, Index)));
+	}
+
+	// Only used for enums smaller than 4 bytes, which are always sent as uint32.
+	void WriteSmallEnumProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+	{
+		Schema_AddUint32(Object, FieldId, (uint32)static_cast<UEnumProperty*>(Property)->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(Data));
+	}
+
+	void ReadSmallEnumProperty(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+	{
+		static_cast<UEnumProperty*>(Property)->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
+	}
+}
+
+namespace SpatialGDK
+{
+
+TArray<FReplicationPlanEntry> CompileReplicationPlan(const FRepLayout& RepLayout)
+{
+	TArray<FReplicationPlanEntry> ReplicationPlan;
+	ReplicationPlan.Reserve(RepLayout.Cmds.Num());
+
+	for (const FRepLayoutCmd& Cmd : RepLayout.Cmds)
+	{
+		ReplicationPlan.Add(Cmd.Type == ERepLayoutCmdType::Return || Cmd.Property == nullptr ? FReplicationPlanEntry() : CompileReplicationPlanEntry(Cmd.Property));
+	}
+
+	return ReplicationPlan;
+}
+
+FReplicationPlanEntry CompileReplicationPlanEntry(UProperty* Property)
+{
+	// Checked in the same order as ComponentFactory::AddProperty, so that each property resolves to the same schema type.
+	if (Property->IsA<UStructProperty>())
+	{
+		return {};
+	}
+	if (Property->IsA<UBoolProperty>())
+	{
+		return { &WriteBoolProperty, &ReadBoolProperty };
+	}
+	if (Property->IsA<UFloatProperty>())
+	{
+		return NumericEntry<UFloatProperty, float, &Schema_AddFloat, &Schema_IndexFloat>();
+	}
+	if (Property->IsA<UDoubleProperty>())
+	{
+		return NumericEntry<UDoubleProperty, double, &Schema_AddDouble, &Schema_IndexDouble>();
+	}
+	if (Property->IsA<UInt8Property>())
+	{
+		return NumericEntry<UInt8Property, int32_t, &Schema_AddInt32, &Schema_IndexInt32>();
+	}
+	if (Property->IsA<UInt16Property>())
+	{
+		return NumericEntry<UInt16Property, int32_t, &Schema_AddInt32, &Schema_IndexInt32>();
+	}
+	if (Property->IsA<UIntProperty>())
+	{
+		return NumericEntry<UIntProperty, int32_t, &Schema_AddInt32, &Schema_IndexInt32>();
+	}
+	if (Property->IsA<UInt64Property>())
+	{
+		return NumericEntry<UInt64Property, int64_t, &Schema_AddInt64, &Schema_IndexInt64>();
+	}
+	if (Property->IsA<UByteProperty>())
+	{
+		return NumericEntry<UByteProperty, uint32_t, &Schema_AddUint32, &Schema_IndexUint32>();
+	}
+	if (Property->IsA<UUInt16Property>())
+	{
+		return NumericEntry<UUInt16Property, uint32_t, &Schema_AddUint32, &Schema_IndexUint32>();
+	}
+	if (Property->IsA<UUInt32Property>())
+	{
+		return NumericEntry<UUInt32Property, uint32_t, &Schema_AddUint32, &Schema_IndexUint32>();
+	}
+	if (Property->IsA<UUInt64Property>())
+	{
+		return NumericEntry<UUInt64Property, uint64_t, &Schema_AddUint64, &Schema_IndexUint64>();
+	}
+	if (Property->IsA<UObjectPropertyBase>())
+	{
+		return {};
+	}
+	if (Property->IsA<UNameProperty>())
+	{
+		return { &WriteNameProperty, &ReadNameProperty };
+	}
+	if (Property->IsA<UStrProperty>())
+	{
+		return { &WriteStrProperty, &ReadStrProperty };
+	}
+	if (Property->IsA<UTextProperty>())
+	{
+		return { &WriteTextProperty, &ReadTextProperty };
+	}
+	if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		// Larger enums are written through their underlying property, which the generic path handles.
+		if (EnumProperty->ElementSize < 4)
+		{
+			return { &WriteSmallEnumProperty, &ReadSmallEnumProperty };
+		}
+		return {};
+	}
+
+	// Arrays, and properties that are either unsupported or not serialized, keep using the generic path with its logging.
+	return {};
+}
+
+} // namespace SpatialGDK
@@ -6,13 +6,14 @@
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
 #include "Interop/SpatialStaticComponentView.h"
-#include "LoadBalancing/GridBasedLBStrategy.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
 #include "LoadBalancing/LayeredLBStrategy.h"
 #include "LoadBalancing/WorkerRegion.h"
 #include "Schema/AuthorityIntent.h"
 #include "Schema/SpatialDebugging.h"
 #include "SpatialCommonTypes.h"
 #include "Utils/InspectionColors.h"
+#include "Utils/SpatialMetricsDisplay.h"
 
 #include "Debug/DebugDrawService.h"
 #include "Engine/Engine.h"
@@ -22,6 +23,7 @@
 #include "GenericPlatform/GenericPlatformMath.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "SceneView.h"
 
 using namespace SpatialGDK;
 
@@ -71,6 +73,11 @@ void ASpatialDebugger::Tick(float DeltaSeconds)
 
 	if (!NetDriver->IsServer())
 	{
+		if (bShowWorkerLoadHeatmap && WorkerRegionActors.Num() > 0)
+		{
+			UpdateWorkerLoadHeatmap();
+		}
+
 		for (TMap<Worker_EntityId_Key, TWeakObjectPtr<AActor>>::TIterator It = EntityActorMapping.CreateIterator(); It; ++It)
 		{
 			if (!It->Value.IsValid())
@@ -102,6 +109,19 @@ void ASpatialDebugger::Tick(float DeltaSeconds)
 			});
 		}
 	}
+	else if (HasAuthority())
+	{
+		// Strategies which rebalance move their regions at runtime, so replicate them to the clients again when they change.
+		const ULayeredLBStrategy* LayeredLBStrategy = Cast<ULayeredLBStrategy>(NetDriver->LoadBalanceStrategy);
+		if (LayeredLBStrategy != nullptr && LayeredLBStrategy->IsReady())
+		{
+			const UAbstractLBStrategy* VisualStrategy = LayeredLBStrategy->GetLBStrategyForVisualRendering();
+			if (VisualStrategy->GetRegionsVersion() != WorkerRegionsVersion)
+			{
+				UpdateWorkerRegions(*VisualStrategy);
+			}
+		}
+	}
 }
 
 void ASpatialDebugger::BeginPlay()
@@ -152,21 +172,25 @@ void ASpatialDebugger::OnAuthorityGained()
 			return;
 		}
 
-		if (const UGridBasedLBStrategy* GridBasedLBStrategy = Cast<UGridBasedLBStrategy>(LayeredLBStrategy->GetLBStrategyForVisualRendering()))
-		{
-			const UGridBasedLBStrategy::LBStrategyRegions LBStrategyRegions = GridBasedLBStrategy->GetLBStrategyRegions();
-			WorkerRegions.SetNum(LBStrategyRegions.Num());
-			for (int i = 0; i < LBStrategyRegions.Num(); i++)
-			{
-				const TPair<VirtualWorkerId, FBox2D>& LBStrategyRegion = LBStrategyRegions[i];
-				const PhysicalWorkerName* WorkerName = NetDriver->VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(LBStrategyRegion.Key);
-				FWorkerRegionInfo WorkerRegionInfo;
-				WorkerRegionInfo.Color = (WorkerName == nullptr) ? InvalidServerTintColor : SpatialGDK::GetColorForWorkerName(*WorkerName);
-				WorkerRegionInfo.Extents = LBStrategyRegion.Value;
-				WorkerRegions[i] = WorkerRegionInfo;
-			}
-		}
+		UpdateWorkerRegions(*LayeredLBStrategy->GetLBStrategyForVisualRendering());
+	}
+}
+
+void ASpatialDebugger::UpdateWorkerRegions(const UAbstractLBStrategy& VisualStrategy)
+{
+	const UAbstractLBStrategy::LBStrategyRegions LBStrategyRegions = VisualStrategy.GetLBStrategyRegions();
+	WorkerRegions.SetNum(LBStrategyRegions.Num());
+	for (int i = 0; i < LBStrategyRegions.Num(); i++)
+	{
+		const TPair<VirtualWorkerId, FBox2D>& LBStrategyRegion = LBStrategyRegions[i];
+		const PhysicalWorkerName* WorkerName = NetDriver->VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(LBStrategyRegion.Key);
+		FWorkerRegionInfo WorkerRegionInfo;
+		WorkerRegionInfo.Color = (WorkerName == nullptr) ? InvalidServerTintColor : SpatialGDK::GetColorForWorkerName(*WorkerName);
+		WorkerRegionInfo.Extents = LBStrategyRegion.Value;
+		WorkerRegionInfo.VirtualWorker = LBStrategyRegion.Key;
+		WorkerRegions[i] = WorkerRegionInfo;
 	}
+	WorkerRegionsVersion = VisualStrategy.GetRegionsVersion();
 }
 
 void ASpatialDebugger::CreateWorkerRegions()
@@ -188,6 +212,12 @@ void ASpatialDebugger::CreateWorkerRegions()
 		AWorkerRegion* WorkerRegion = GetWorld()->SpawnActor<AWorkerRegion>(SpawnParams);
 		WorkerRegion->Init(WorkerRegionMaterial, WorkerRegionData.Color, WorkerRegionData.Extents, WorkerRegionVerticalScale);
 		WorkerRegion->SetActorEnableCollision(false);
+		WorkerRegionActors.Add(WorkerRegion);
+	}
+
+	if (bShowWorkerLoadHeatmap)
+	{
+		UpdateWorkerLoadHeatmap();
 	}
 }
 
@@ -199,6 +229,59 @@ void ASpatialDebugger::DestroyWorkerRegions()
 	{
 		WorkerRegion->Destroy();
 	}
+	WorkerRegionActors.Reset();
+}
+
+void ASpatialDebugger::UpdateWorkerLoadHeatmap()
+{
+	if (NetDriver->SpatialMetricsDisplay == nullptr || WorkerRegionActors.Num() != WorkerRegions.Num())
+	{
+		return;
+	}
+
+	auto GetLoad = [this](const FWorkerStats& Stats) -> float
+	{
+		switch (WorkerLoadHeatmapMetric)
+		{
+		case EWorkerLoadHeatmapMetric::EntityCount:
+			return Stats.EntityCount;
+		case EWorkerLoadHeatmapMetric::FrameTime:
+			return Stats.AverageFPS > 0.f ? 1000.f / Stats.AverageFPS : 0.f;
+		case EWorkerLoadHeatmapMetric::OpsReceived:
+			return Stats.OpsReceivedPerSecond;
+		case EWorkerLoadHeatmapMetric::MessagesSent:
+			return Stats.MessagesSentPerSecond;
+		case EWorkerLoadHeatmapMetric::RPCsSent:
+			return Stats.RPCsSentPerSecond;
+		default:
+			return 0.f;
+		}
+	};
+
+	const TArray<FWorkerStats>& WorkerStats = NetDriver->SpatialMetricsDisplay->GetWorkerStats();
+	TArray<TOptional<float>> RegionLoads;
+	RegionLoads.SetNum(WorkerRegions.Num());
+	float MaxLoad = 0.f;
+	for (int32 i = 0; i < WorkerRegions.Num(); i++)
+	{
+		if (const FWorkerStats* Stats = WorkerStats.FindByPredicate([&](const FWorkerStats& S) { return S.VirtualWorker == WorkerRegions[i].VirtualWorker; }))
+		{
+			RegionLoads[i] = GetLoad(*Stats);
+			MaxLoad = FMath::Max(MaxLoad, RegionLoads[i].GetValue());
+		}
+	}
+
+	for (int32 i = 0; i < WorkerRegionActors.Num(); i++)
+	{
+		if (AWorkerRegion* WorkerRegion = WorkerRegionActors[i])
+		{
+			// Regions of workers that have not reported stats keep their worker color.
+			const FColor Color = RegionLoads[i].IsSet()
+				? FLinearColor::LerpUsingHSV(FLinearColor::Green, FLinearColor::Red, MaxLoad > 0.f ? RegionLoads[i].GetValue() / MaxLoad : 0.f).ToFColor(true)
+				: WorkerRegions[i].Color;
+			WorkerRegion->SetColor(Color);
+		}
+	}
 }
 
 void ASpatialDebugger::OnRep_SetWorkerRegions()
@@ -322,20 +405,70 @@ void ASpatialDebugger::ActorAuthorityIntentChanged(Worker_EntityId EntityId, Vir
 	NetDriver->Connection->SendComponentUpdate(EntityId, &DebuggingUpdate);
 }
 
-void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FString& ActorName)
+bool ASpatialDebugger::GetEntityTag(const Worker_EntityId EntityId, AActor* Actor, FEntityTag& OutTag) const
 {
-	SCOPE_CYCLE_COUNTER(STAT_DrawTag);
+	check(NetDriver != nullptr && !NetDriver->IsServer());
+	const SpatialDebugging* DebuggingInfo = NetDriver->StaticComponentView->GetComponentData<SpatialDebugging>(EntityId);
+	if (DebuggingInfo == nullptr)
+	{
+		return false;
+	}
 
-	// TODO: Smarter positioning of elements so they're centered no matter how many are enabled https://improbableio.atlassian.net/browse/UNR-2360.
-	int32 HorizontalOffset = -32.0f;
+	OutTag.EntityId = EntityId;
+	OutTag.Actor = Actor;
+	OutTag.ActorName = Actor->GetName();
+	OutTag.AuthoritativeVirtualWorkerId = DebuggingInfo->AuthoritativeVirtualWorkerId;
+	OutTag.AuthoritativeColor = DebuggingInfo->AuthoritativeColor;
+	OutTag.IntentVirtualWorkerId = DebuggingInfo->IntentVirtualWorkerId;
+	OutTag.IntentColor = DebuggingInfo->IntentColor;
+	OutTag.bIsLocked = DebuggingInfo->IsLocked;
+	return true;
+}
 
-	check(NetDriver != nullptr && !NetDriver->IsServer());
-	if (!NetDriver->StaticComponentView->HasComponent(EntityId, SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID))
+void ASpatialDebugger::GatherEntityTags(UCanvas* Canvas)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GatherTags);
+
+	EntityTags.Reset();
+
+	const FVector PlayerLocation = LocalPawn.IsValid() ? LocalPawn->GetActorLocation() : FVector::ZeroVector;
+	const float MaxRangeSquared = FMath::Square(MaxRange);
+	const FSceneView* SceneView = Canvas != nullptr ? Canvas->SceneView : nullptr;
+
+	for (const TPair<Worker_EntityId_Key, TWeakObjectPtr<AActor>>& EntityActorPair : EntityActorMapping)
 	{
-		return;
+		AActor* Actor = EntityActorPair.Value.Get();
+		if (Actor == nullptr)
+		{
+			continue;
+		}
+
+		const FVector ActorLocation = Actor->GetActorLocation();
+		if (ActorLocation.IsZero() || FVector::DistSquared(PlayerLocation, ActorLocation) > MaxRangeSquared)
+		{
+			continue;
+		}
+
+		// Tags outside the view frustum would fail to project anyway, so they're skipped before looking up their component.
+		if (SceneView != nullptr && !SceneView->ViewFrustum.IntersectSphere(ActorLocation + WorldSpaceActorTagOffset, 0.0f))
+		{
+			continue;
+		}
+
+		FEntityTag Tag;
+		if (GetEntityTag(EntityActorPair.Key, Actor, Tag))
+		{
+			EntityTags.Add(MoveTemp(Tag));
+		}
 	}
+}
 
-	const SpatialDebugging* DebuggingInfo = NetDriver->StaticComponentView->GetComponentData<SpatialDebugging>(EntityId);
+void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const FEntityTag& Tag)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DrawTag);
+
+	// TODO: Smarter positioning of elements so they're centered no matter how many are enabled https://improbableio.atlassian.net/browse/UNR-2360.
+	int32 HorizontalOffset = -32.0f;
 
 	static const float BaseHorizontalOffset(16.0f);
 
@@ -347,7 +480,7 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 	if (bShowLock)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_DrawIcons);
-		const bool bIsLocked = DebuggingInfo->IsLocked;
+		const bool bIsLocked = Tag.bIsLocked;
 		const EIcon LockIcon = bIsLocked ? ICON_LOCKED : ICON_UNLOCKED;
 
 		Canvas->SetDrawColor(FColor::White);
@@ -358,30 +491,30 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 	if (bShowAuth)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_DrawIcons);
-		const FColor& ServerWorkerColor = DebuggingInfo->AuthoritativeColor;
+		const FColor& ServerWorkerColor = Tag.AuthoritativeColor;
 		Canvas->SetDrawColor(FColor::White);
 		Canvas->DrawIcon(Icons[ICON_AUTH], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, 1.0f);
 		HorizontalOffset += BaseHorizontalOffset;
 		Canvas->SetDrawColor(ServerWorkerColor);
-		const float BoxScaleBasedOnNumberSize = 0.75f * GetNumberOfDigitsIn(DebuggingInfo->AuthoritativeVirtualWorkerId);
+		const float BoxScaleBasedOnNumberSize = 0.75f * GetNumberOfDigitsIn(Tag.AuthoritativeVirtualWorkerId);
 		Canvas->DrawScaledIcon(Icons[ICON_BOX], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, FVector(BoxScaleBasedOnNumberSize, 1.f, 1.f));
 		Canvas->SetDrawColor(GetTextColorForBackgroundColor(ServerWorkerColor));
-		Canvas->DrawText(RenderFont, FString::FromInt(DebuggingInfo->AuthoritativeVirtualWorkerId), ScreenLocation.X + HorizontalOffset + 1, ScreenLocation.Y, 1.1f, 1.1f, FontRenderInfo);
+		Canvas->DrawText(RenderFont, FString::FromInt(Tag.AuthoritativeVirtualWorkerId), ScreenLocation.X + HorizontalOffset + 1, ScreenLocation.Y, 1.1f, 1.1f, FontRenderInfo);
 		HorizontalOffset += (BaseHorizontalOffset * BoxScaleBasedOnNumberSize);
 	}
 
 	if (bShowAuthIntent)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_DrawIcons);
-		const FColor& VirtualWorkerColor = DebuggingInfo->IntentColor;
+		const FColor& VirtualWorkerColor = Tag.IntentColor;
 		Canvas->SetDrawColor(FColor::White);
 		Canvas->DrawIcon(Icons[ICON_AUTH_INTENT], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, 1.0f);
 		HorizontalOffset += 16.0f;
 		Canvas->SetDrawColor(VirtualWorkerColor);
-		const float BoxScaleBasedOnNumberSize = 0.75f * GetNumberOfDigitsIn(DebuggingInfo->IntentVirtualWorkerId);
+		const float BoxScaleBasedOnNumberSize = 0.75f * GetNumberOfDigitsIn(Tag.IntentVirtualWorkerId);
 		Canvas->DrawScaledIcon(Icons[ICON_BOX], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, FVector(BoxScaleBasedOnNumberSize, 1.f, 1.f));
 		Canvas->SetDrawColor(GetTextColorForBackgroundColor(VirtualWorkerColor));
-		Canvas->DrawText(RenderFont, FString::FromInt(DebuggingInfo->IntentVirtualWorkerId), ScreenLocation.X + HorizontalOffset + 1, ScreenLocation.Y, 1.1f, 1.1f, FontRenderInfo);
+		Canvas->DrawText(RenderFont, FString::FromInt(Tag.IntentVirtualWorkerId), ScreenLocation.X + HorizontalOffset + 1, ScreenLocation.Y, 1.1f, 1.1f, FontRenderInfo);
 		HorizontalOffset += (BaseHorizontalOffset * BoxScaleBasedOnNumberSize);
 	}
 
@@ -389,13 +522,13 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 	if (bShowEntityId)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_BuildText);
-		Label += FString::Printf(TEXT("%lld "), EntityId);
+		Label += FString::Printf(TEXT("%lld "), Tag.EntityId);
 	}
 
 	if (bShowActorName)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_BuildText);
-		Label += FString::Printf(TEXT("(%s)"), *ActorName);
+		Label += FString::Printf(TEXT("(%s)"), *Tag.ActorName);
 	}
 
 	if (bShowEntityId || bShowActorName)
@@ -434,46 +567,38 @@ void ASpatialDebugger::DrawDebug(UCanvas* Canvas, APlayerController* /* Controll
 
 	DrawDebugLocalPlayer(Canvas);
 
-	FVector PlayerLocation = FVector::ZeroVector;
-
-	if (LocalPawn.IsValid())
+	// Finding the entities to draw tags for goes through every checked out entity, so it's only done every TagGatherInterval.
+	// In between, only the gathered tags are projected and drawn, at their actors' current locations.
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastTagGatherTime >= TagGatherInterval)
 	{
-		PlayerLocation = LocalPawn->GetActorLocation();
+		GatherEntityTags(Canvas);
+		LastTagGatherTime = Now;
 	}
 
-	for (TPair<Worker_EntityId_Key, TWeakObjectPtr<AActor>>& EntityActorPair : EntityActorMapping)
+	if (!LocalPlayerController.IsValid())
 	{
-		const TWeakObjectPtr<AActor> Actor = EntityActorPair.Value;
-		const Worker_EntityId EntityId = EntityActorPair.Key;
+		return;
+	}
 
-		if (Actor != nullptr)
+	for (const FEntityTag& Tag : EntityTags)
+	{
+		const AActor* Actor = Tag.Actor.Get();
+		if (Actor == nullptr)
 		{
-			FVector ActorLocation = Actor->GetActorLocation();
-
-			if (ActorLocation.IsZero())
-			{
-				continue;
-			}
-
-			if (FVector::Dist(PlayerLocation, ActorLocation) > MaxRange)
-			{
-				continue;
-			}
-
-			FVector2D ScreenLocation = FVector2D::ZeroVector;
-			if (LocalPlayerController.IsValid())
-			{
-				SCOPE_CYCLE_COUNTER(STAT_Projection);
-				UGameplayStatics::ProjectWorldToScreen(LocalPlayerController.Get(), ActorLocation + WorldSpaceActorTagOffset, ScreenLocation, false);
-			}
+			continue;
+		}
 
-			if (ScreenLocation.IsZero())
+		FVector2D ScreenLocation = FVector2D::ZeroVector;
+		{
+			SCOPE_CYCLE_COUNTER(STAT_Projection);
+			if (!UGameplayStatics::ProjectWorldToScreen(LocalPlayerController.Get(), Actor->GetActorLocation() + WorldSpaceActorTagOffset, ScreenLocation, false))
 			{
 				continue;
 			}
-
-			DrawTag(Canvas, ScreenLocation, EntityId, Actor->GetName());
 		}
+
+		DrawTag(Canvas, ScreenLocation, Tag);
 	}
 }
 
@@ -498,7 +623,11 @@ void ASpatialDebugger::DrawDebugLocalPlayer(UCanvas* Canvas)
 		if (LocalPlayerActors[i].IsValid())
 		{
 			const Worker_EntityId EntityId = NetDriver->PackageMap->GetEntityIdFromObject(LocalPlayerActors[i].Get());
-			DrawTag(Canvas, ScreenLocation, EntityId, LocalPlayerActors[i]->GetName());
+			FEntityTag Tag;
+			if (GetEntityTag(EntityId, LocalPlayerActors[i].Get(), Tag))
+			{
+				DrawTag(Canvas, ScreenLocation, Tag);
+			}
 			ScreenLocation.Y -= PLAYER_TAG_VERTICAL_OFFSET;
 		}
 	}
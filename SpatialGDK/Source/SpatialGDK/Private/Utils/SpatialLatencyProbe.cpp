@@ -0,0 +1,253 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialLatencyProbe.h"
+
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Net/UnrealNetwork.h"
+#include "Utils/SpatialLatencyTracer.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialLatencyProbe);
+
+ASpatialLatencyProbe::ASpatialLatencyProbe(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+
+	bReplicates = true;
+	bOnlyRelevantToOwner = true;
+
+	// Replies are sent with ForceNetUpdate, so this only bounds how late the property can be when the server is busy.
+	NetUpdateFrequency = 100.f;
+}
+
+void ASpatialLatencyProbe::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(ASpatialLatencyProbe, ProbeState, COND_OwnerOnly);
+}
+
+ASpatialLatencyProbe* ASpatialLatencyProbe::SpawnForPlayer(APlayerController* Controller, TSubclassOf<ASpatialLatencyProbe> ProbeClass)
+{
+	if (Controller == nullptr || !Controller->HasAuthority() || Controller->GetWorld() == nullptr)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Controller;
+	UClass* Class = ProbeClass != nullptr ? ProbeClass.Get() : ASpatialLatencyProbe::StaticClass();
+	return Controller->GetWorld()->SpawnActor<ASpatialLatencyProbe>(Class, SpawnParams);
+}
+
+void ASpatialLatencyProbe::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const double Now = FPlatformTime::Seconds();
+	TimeWhenProbeLastSent = Now;
+	TimeWhenLastReported = Now;
+
+	LoadBytes.SetNumZeroed(FMath::Max(IsOwningClient() ? LoadRPCBytes : LoadPropertyBytes, 0));
+}
+
+void ASpatialLatencyProbe::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	WriteLatencyReport();
+	Super::EndPlay(EndPlayReason);
+}
+
+bool ASpatialLatencyProbe::IsOwningClient() const
+{
+	return GetNetMode() == NM_Client && GetLocalRole() == ROLE_AutonomousProxy;
+}
+
+void ASpatialLatencyProbe::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!IsOwningClient())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	RemoveTimedOutProbes(Now);
+
+	if (Now - TimeWhenProbeLastSent >= ProbeInterval)
+	{
+		TimeWhenProbeLastSent = Now;
+		SendProbe();
+	}
+
+	if (ReportInterval > 0.f && Now - TimeWhenLastReported >= ReportInterval)
+	{
+		WriteLatencyReport();
+	}
+}
+
+void ASpatialLatencyProbe::SendProbe()
+{
+	const int32 ProbeId = ++LastProbeId;
+	PendingProbes.Add(ProbeId, FPendingProbe{ FPlatformTime::Seconds(), false, false });
+
+	FSpatialLatencyPayload Payload;
+	if (bUseLatencyTracer)
+	{
+		FSpatialLatencyPayload StartPayload;
+		if (USpatialLatencyTracer::BeginLatencyTrace(this, FString::Printf(TEXT("LatencyProbe %d"), ProbeId), StartPayload))
+		{
+			USpatialLatencyTracer::ContinueLatencyTraceRPC(this, this, TEXT("ServerProbe"), TEXT("Probe"), StartPayload, Payload);
+		}
+	}
+
+	// Sent first, so the probe queues behind the load as gameplay RPCs would.
+	for (int32 i = 0; i < LoadRPCsPerProbe; i++)
+	{
+		ServerLoad(LoadBytes);
+	}
+
+	ServerProbe(ProbeId, Payload);
+}
+
+void ASpatialLatencyProbe::RemoveTimedOutProbes(double Now)
+{
+	for (auto It = PendingProbes.CreateIterator(); It; ++It)
+	{
+		const FPendingProbe& Probe = It.Value();
+		if (Now - Probe.SentTime < TimeoutLimit)
+		{
+			continue;
+		}
+
+		LostRPCReplies += Probe.bHasRPCReply ? 0 : 1;
+		LostPropertyReplies += Probe.bHasPropertyReply ? 0 : 1;
+		It.RemoveCurrent();
+	}
+}
+
+void ASpatialLatencyProbe::OnProbeReply(int32 ProbeId, bool bIsRPCReply)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (auto It = PendingProbes.CreateIterator(); It; ++It)
+	{
+		FPendingProbe& Probe = It.Value();
+		if (bIsRPCReply)
+		{
+			if (It.Key() != ProbeId)
+			{
+				continue;
+			}
+			RPCRoundTrips.Add(Now - Probe.SentTime);
+			Probe.bHasRPCReply = true;
+		}
+		else
+		{
+			// Property changes the client hasn't seen yet are merged, so an older probe is answered by the first newer state it sees.
+			if (It.Key() > ProbeId || Probe.bHasPropertyReply)
+			{
+				continue;
+			}
+			PropertyRoundTrips.Add(Now - Probe.SentTime);
+			Probe.bHasPropertyReply = true;
+		}
+
+		if (Probe.bHasRPCReply && Probe.bHasPropertyReply)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool ASpatialLatencyProbe::ServerProbe_Validate(int32 ProbeId, const FSpatialLatencyPayload& Payload)
+{
+	return true;
+}
+
+void ASpatialLatencyProbe::ServerProbe_Implementation(int32 ProbeId, const FSpatialLatencyPayload& Payload)
+{
+	FSpatialLatencyPayload ReplyPayload;
+	if (Payload.TraceId.Num() > 0)
+	{
+		USpatialLatencyTracer::ContinueLatencyTraceRPC(this, this, TEXT("ClientProbeReply"), TEXT("Reply"), Payload, ReplyPayload);
+	}
+	ClientProbeReply(ProbeId, ReplyPayload);
+
+	ProbeState.ProbeId = ProbeId;
+	if (LoadBytes.Num() > 0)
+	{
+		LoadBytes[0]++;
+		ProbeState.Load = LoadBytes;
+	}
+	ForceNetUpdate();
+}
+
+void ASpatialLatencyProbe::ClientProbeReply_Implementation(int32 ProbeId, const FSpatialLatencyPayload& Payload)
+{
+	if (Payload.TraceId.Num() > 0)
+	{
+		USpatialLatencyTracer::EndLatencyTrace(this, Payload);
+	}
+	OnProbeReply(ProbeId, true);
+}
+
+bool ASpatialLatencyProbe::ServerLoad_Validate(const TArray<uint8>& Load)
+{
+	return true;
+}
+
+void ASpatialLatencyProbe::ServerLoad_Implementation(const TArray<uint8>& Load)
+{
+}
+
+void ASpatialLatencyProbe::OnRep_ProbeState()
+{
+	OnProbeReply(ProbeState.ProbeId, false);
+}
+
+void ASpatialLatencyProbe::WriteLatencyReport()
+{
+	if (!IsOwningClient())
+	{
+		return;
+	}
+
+	TimeWhenLastReported = FPlatformTime::Seconds();
+
+	if (RPCRoundTrips.Num() == 0 && PropertyRoundTrips.Num() == 0)
+	{
+		return;
+	}
+
+	const FString Fields = FString::Printf(TEXT("\"scenario\": \"%s\", \"build\": \"%s\", \"load_rpcs_per_probe\": %d, \"load_rpc_bytes\": %d, \"load_property_bytes\": %d, "),
+		*ScenarioName.ReplaceCharWithEscapedChar(), *FString(FApp::GetBuildVersion()).ReplaceCharWithEscapedChar(), LoadRPCsPerProbe, LoadRPCBytes, LoadPropertyBytes);
+
+	const FString RPCLine = RPCRoundTrips.ToJson(Fields + FString::Printf(TEXT("\"metric\": \"rpc_round_trip\", \"lost\": %d, "), LostRPCReplies));
+	const FString PropertyLine = PropertyRoundTrips.ToJson(Fields + FString::Printf(TEXT("\"metric\": \"property_round_trip\", \"lost\": %d, "), LostPropertyReplies));
+
+	UE_LOG(LogSpatialLatencyProbe, Log, TEXT("%s"), *RPCLine);
+	UE_LOG(LogSpatialLatencyProbe, Log, TEXT("%s"), *PropertyLine);
+
+	const FString Contents = RPCLine + LINE_TERMINATOR + PropertyLine + LINE_TERMINATOR;
+	if (!FFileHelper::SaveStringToFile(Contents, *GetResultsFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogSpatialLatencyProbe, Warning, TEXT("Failed to write latency results to %s"), *GetResultsFilePath());
+	}
+
+	RPCRoundTrips.Reset();
+	PropertyRoundTrips.Reset();
+	LostRPCReplies = 0;
+	LostPropertyReplies = 0;
+}
+
+FString ASpatialLatencyProbe::GetResultsFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Automation"), TEXT("GDKLatency.jsonl"));
+}
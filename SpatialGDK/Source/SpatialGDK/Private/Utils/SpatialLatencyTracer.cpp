@@ -7,6 +7,7 @@
 #include "EngineClasses/SpatialGameInstance.h"
 #include "GeneralProjectSettings.h"
 #include "Interop/Connection/OutgoingMessages.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 
 #include <sstream>
@@ -15,6 +16,10 @@ DEFINE_LOG_CATEGORY(LogSpatialLatencyTracing);
 
 DECLARE_CYCLE_STAT(TEXT("ContinueLatencyTraceRPC_Internal"), STAT_ContinueLatencyTraceRPC_Internal, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("BeginLatencyTraceRPC_Internal"), STAT_BeginLatencyTraceRPC_Internal, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("LatencyTracerFlushPendingTraceEvents"), STAT_LatencyTracerFlushPendingTraceEvents, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("LatencyTracerLockWait"), STAT_LatencyTracerLockWait, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Latency Tracer Lock Contentions"), STAT_LatencyTracerLockContentions, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Latency Tracer Queued Events"), STAT_LatencyTracerQueuedEvents, STATGROUP_SpatialNet);
 
 namespace
 {
@@ -38,6 +43,30 @@ namespace
 	UEStream UStream;
 
 #if TRACE_LIB_ACTIVE
+	// Scoped lock which records how often, and for how long, the mutex was already held when it was needed.
+	class FTracerScopeLock
+	{
+	public:
+		explicit FTracerScopeLock(FCriticalSection* InMutex)
+			: Mutex(InMutex)
+		{
+			if (!Mutex->TryLock())
+			{
+				INC_DWORD_STAT(STAT_LatencyTracerLockContentions);
+				SCOPE_CYCLE_COUNTER(STAT_LatencyTracerLockWait);
+				Mutex->Lock();
+			}
+		}
+
+		~FTracerScopeLock()
+		{
+			Mutex->Unlock();
+		}
+
+	private:
+		FCriticalSection* Mutex;
+	};
+
 	improbable::trace::SpanContext ReadSpanContext(const void* TraceBytes, const void* SpanBytes)
 	{
 		improbable::trace::TraceId _TraceId;
@@ -56,6 +85,10 @@ USpatialLatencyTracer::USpatialLatencyTracer()
 #if TRACE_LIB_ACTIVE
 	ResetWorkerId();
 	FParse::Value(FCommandLine::Get(), TEXT("traceMetadata"), TraceMetadata);
+
+	SampleRate = GetDefault<USpatialGDKSettings>()->LatencyTraceSampleRate;
+	FParse::Value(FCommandLine::Get(), TEXT("latencyTraceSampleRate="), SampleRate);
+	SampleRate = FMath::Clamp(SampleRate, 0.0f, 1.0f);
 #endif
 }
 
@@ -171,46 +204,88 @@ USpatialLatencyTracer* USpatialLatencyTracer::GetTracer(UObject* WorldContextObj
 	return nullptr;
 }
 
+FString USpatialLatencyTracer::DescribeQueuedTraceEvent(const TCHAR* TraceDesc, double EventTime, double WriteTime)
+{
+	return FString::Printf(TEXT("%s [%.3f ms before written]"), TraceDesc, FMath::Max(WriteTime - EventTime, 0.0) * 1000.0);
+}
+
 #if TRACE_LIB_ACTIVE
 bool USpatialLatencyTracer::IsValidKey(const TraceKey Key)
 {
-	FScopeLock Lock(&Mutex);
+	if (Key == InvalidTraceKey)
+	{
+		return false;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 	return (TraceMap.Find(Key) != nullptr);
 }
 
 TraceKey USpatialLatencyTracer::RetrievePendingTrace(const UObject* Obj, const UFunction* Function)
 {
-	FScopeLock Lock(&Mutex);
+	if (NumTrackedTargets.Load() == 0)
+	{
+		return InvalidTraceKey;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	ActorFuncKey FuncKey{ Cast<AActor>(Obj), Function };
 	TraceKey ReturnKey = InvalidTraceKey;
 	TrackingRPCs.RemoveAndCopyValue(FuncKey, ReturnKey);
+	if (ReturnKey != InvalidTraceKey)
+	{
+		NumTrackedTargets.DecrementExchange();
+	}
 	return ReturnKey;
 }
 
 TraceKey USpatialLatencyTracer::RetrievePendingTrace(const UObject* Obj, const UProperty* Property)
 {
-	FScopeLock Lock(&Mutex);
+	if (NumTrackedTargets.Load() == 0)
+	{
+		return InvalidTraceKey;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	ActorPropertyKey PropKey{ Cast<AActor>(Obj), Property };
 	TraceKey ReturnKey = InvalidTraceKey;
 	TrackingProperties.RemoveAndCopyValue(PropKey, ReturnKey);
+	if (ReturnKey != InvalidTraceKey)
+	{
+		NumTrackedTargets.DecrementExchange();
+	}
 	return ReturnKey;
 }
 
 TraceKey USpatialLatencyTracer::RetrievePendingTrace(const UObject* Obj, const FString& Tag)
 {
-	FScopeLock Lock(&Mutex);
+	if (NumTrackedTargets.Load() == 0)
+	{
+		return InvalidTraceKey;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	ActorTagKey EventKey{ Cast<AActor>(Obj), Tag };
 	TraceKey ReturnKey = InvalidTraceKey;
 	TrackingTags.RemoveAndCopyValue(EventKey, ReturnKey);
+	if (ReturnKey != InvalidTraceKey)
+	{
+		NumTrackedTargets.DecrementExchange();
+	}
 	return ReturnKey;
 }
 
 void USpatialLatencyTracer::WriteToLatencyTrace(const TraceKey Key, const FString& TraceDesc)
 {
-	FScopeLock Lock(&Mutex);
+	if (Key == InvalidTraceKey)
+	{
+		return;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	if (TraceSpan* Trace = TraceMap.Find(Key))
 	{
@@ -220,7 +295,12 @@ void USpatialLatencyTracer::WriteToLatencyTrace(const TraceKey Key, const FStrin
 
 void USpatialLatencyTracer::WriteAndEndTrace(const TraceKey Key, const FString& TraceDesc, bool bOnlyEndIfTraceRootIsRemote)
 {
-	FScopeLock Lock(&Mutex);
+	if (Key == InvalidTraceKey)
+	{
+		return;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	if (TraceSpan* Trace = TraceMap.Find(Key))
 	{
@@ -238,7 +318,12 @@ void USpatialLatencyTracer::WriteAndEndTrace(const TraceKey Key, const FString&
 
 void USpatialLatencyTracer::WriteTraceToSchemaObject(const TraceKey Key, Schema_Object* Obj, const Schema_FieldId FieldId)
 {
-	FScopeLock Lock(&Mutex);
+	if (Key == InvalidTraceKey)
+	{
+		return;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	if (TraceSpan* Trace = TraceMap.Find(Key))
 	{
@@ -255,7 +340,7 @@ void USpatialLatencyTracer::WriteTraceToSchemaObject(const TraceKey Key, Schema_
 
 TraceKey USpatialLatencyTracer::ReadTraceFromSchemaObject(Schema_Object* Obj, const Schema_FieldId FieldId)
 {
-	FScopeLock Lock(&Mutex);
+	FTracerScopeLock Lock(&Mutex);
 
 	if (Schema_GetObjectCount(Obj, FieldId) > 0)
 	{
@@ -303,7 +388,7 @@ TraceKey USpatialLatencyTracer::ReadTraceFromSchemaObject(Schema_Object* Obj, co
 
 FSpatialLatencyPayload USpatialLatencyTracer::RetrievePayload_Internal(const UObject* Obj, const FString& Tag)
 {
-	FScopeLock Lock(&Mutex);
+	FTracerScopeLock Lock(&Mutex);
 
 	 TraceKey Key = RetrievePendingTrace(Obj, Tag);
 	 if (Key != InvalidTraceKey)
@@ -330,19 +415,19 @@ void USpatialLatencyTracer::OnEnqueueMessage(const SpatialGDK::FOutgoingMessage*
 	if (Message->Type == SpatialGDK::EOutgoingMessageType::ComponentUpdate)
 	{
 		const SpatialGDK::FComponentUpdate* ComponentUpdate = static_cast<const SpatialGDK::FComponentUpdate*>(Message);
-		WriteToLatencyTrace(ComponentUpdate->Update.Trace, TEXT("Moved componentUpdate to Worker queue"));
+		QueueTraceEvent(ComponentUpdate->Update.Trace, TEXT("Moved componentUpdate to Worker queue"), false);
 	}
 	else if (Message->Type == SpatialGDK::EOutgoingMessageType::AddComponent)
 	{
 		const SpatialGDK::FAddComponent* ComponentAdd = static_cast<const SpatialGDK::FAddComponent*>(Message);
-		WriteToLatencyTrace(ComponentAdd->Data.Trace, TEXT("Moved componentAdd to Worker queue"));
+		QueueTraceEvent(ComponentAdd->Data.Trace, TEXT("Moved componentAdd to Worker queue"), false);
 	}
 	else if (Message->Type == SpatialGDK::EOutgoingMessageType::CreateEntityRequest)
 	{
 		const SpatialGDK::FCreateEntityRequest* CreateEntityRequest = static_cast<const SpatialGDK::FCreateEntityRequest*>(Message);
 		for (auto& Component : CreateEntityRequest->Components)
 		{
-			WriteToLatencyTrace(Component.Trace, TEXT("Moved createEntityRequest to Worker queue"));
+			QueueTraceEvent(Component.Trace, TEXT("Moved createEntityRequest to Worker queue"), false);
 		}
 	}
 }
@@ -352,29 +437,94 @@ void USpatialLatencyTracer::OnDequeueMessage(const SpatialGDK::FOutgoingMessage*
 	if (Message->Type == SpatialGDK::EOutgoingMessageType::ComponentUpdate)
 	{
 		const SpatialGDK::FComponentUpdate* ComponentUpdate = static_cast<const SpatialGDK::FComponentUpdate*>(Message);
-		WriteAndEndTrace(ComponentUpdate->Update.Trace, TEXT("Sent componentUpdate to Worker SDK"), true);
+		QueueTraceEvent(ComponentUpdate->Update.Trace, TEXT("Sent componentUpdate to Worker SDK"), true);
 	}
 	else if (Message->Type == SpatialGDK::EOutgoingMessageType::AddComponent)
 	{
 		const SpatialGDK::FAddComponent* ComponentAdd = static_cast<const SpatialGDK::FAddComponent*>(Message);
-		WriteAndEndTrace(ComponentAdd->Data.Trace, TEXT("Sent componentAdd to Worker SDK"), true);
+		QueueTraceEvent(ComponentAdd->Data.Trace, TEXT("Sent componentAdd to Worker SDK"), true);
 	}
 	else if (Message->Type == SpatialGDK::EOutgoingMessageType::CreateEntityRequest)
 	{
 		const SpatialGDK::FCreateEntityRequest* CreateEntityRequest = static_cast<const SpatialGDK::FCreateEntityRequest*>(Message);
 		for (auto& Component : CreateEntityRequest->Components)
 		{
-			WriteAndEndTrace(Component.Trace, TEXT("Sent createEntityRequest to Worker SDK"), true);
+			QueueTraceEvent(Component.Trace, TEXT("Sent createEntityRequest to Worker SDK"), true);
 		}
 	}
 }
 
+void USpatialLatencyTracer::QueueTraceEvent(const TraceKey Key, const TCHAR* TraceDesc, bool bEndTrace)
+{
+	if (Key == InvalidTraceKey)
+	{
+		return;
+	}
+
+	PendingTraceEvents.Enqueue(FPendingTraceEvent{ Key, TraceDesc, bEndTrace, FPlatformTime::Seconds() });
+	NumPendingTraceEvents.IncrementExchange();
+}
+
+void USpatialLatencyTracer::FlushPendingTraceEvents()
+{
+	if (NumPendingTraceEvents.Load() == 0)
+	{
+		return;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
+	FlushPendingTraceEvents_Locked();
+}
+
+void USpatialLatencyTracer::FlushPendingTraceEvents_Locked()
+{
+	if (NumPendingTraceEvents.Load() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_LatencyTracerFlushPendingTraceEvents);
+
+	const double WriteTime = FPlatformTime::Seconds();
+
+	// The queue has a single consumer, which the mutex guarantees.
+	FPendingTraceEvent Event;
+	while (PendingTraceEvents.Dequeue(Event))
+	{
+		NumPendingTraceEvents.DecrementExchange();
+		INC_DWORD_STAT(STAT_LatencyTracerQueuedEvents);
+
+		const FString TraceDesc = DescribeQueuedTraceEvent(Event.TraceDesc, Event.EventTime, WriteTime);
+		if (Event.bEndTrace)
+		{
+			WriteAndEndTrace(Event.Key, TraceDesc, true);
+		}
+		else
+		{
+			WriteToLatencyTrace(Event.Key, TraceDesc);
+		}
+	}
+}
+
+bool USpatialLatencyTracer::ShouldSampleNewTrace() const
+{
+	return SampleRate >= 1.0f || (SampleRate > 0.0f && FMath::FRand() < SampleRate);
+}
+
 bool USpatialLatencyTracer::BeginLatencyTrace_Internal(const FString& TraceDesc, FSpatialLatencyPayload& OutLatencyPayload)
 {	 
 	// TODO: UNR-2787 - Improve mutex-related latency
 	// This functions might spike because of the Mutex below
 	SCOPE_CYCLE_COUNTER(STAT_BeginLatencyTraceRPC_Internal);
-	FScopeLock Lock(&Mutex);
+
+	// Head-based sampling: a trace that is not sampled gets an empty payload, which every later call ignores without taking the mutex.
+	if (!ShouldSampleNewTrace())
+	{
+		OutLatencyPayload = FSpatialLatencyPayload{};
+		return false;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
 
 	FString SpanMsg = FormatMessage(TraceDesc, true);
 	TraceSpan NewTrace = improbable::trace::Span::StartSpan(TCHAR_TO_UTF8(*SpanMsg), nullptr);
@@ -407,10 +557,17 @@ bool USpatialLatencyTracer::ContinueLatencyTrace_Internal(const AActor* Actor, c
 		return false;
 	}
 
+	// Traces that were not sampled when they began, or never began, carry no trace ID.
+	if (LatencyPayload.TraceId.Num() == 0)
+	{
+		OutLatencyPayload = LatencyPayload;
+		return false;
+	}
+
 	// We do minimal internal tracking for native rpcs/properties
 	const bool bInternalTracking = GetDefault<UGeneralProjectSettings>()->UsesSpatialNetworking() || Type == ETraceType::Tagged;
 
-	FScopeLock Lock(&Mutex);
+	FTracerScopeLock Lock(&Mutex);
 
 	OutLatencyPayload = LatencyPayload;
 	if (OutLatencyPayload.Key == InvalidTraceKey)
@@ -448,7 +605,15 @@ bool USpatialLatencyTracer::ContinueLatencyTrace_Internal(const AActor* Actor, c
 
 bool USpatialLatencyTracer::EndLatencyTrace_Internal(const FSpatialLatencyPayload& LatencyPayload)
 {
-	FScopeLock Lock(&Mutex);
+	if (LatencyPayload.TraceId.Num() == 0)
+	{
+		return false;
+	}
+
+	FTracerScopeLock Lock(&Mutex);
+
+	// Write the keyframes still queued from the connection thread before the trace is removed.
+	FlushPendingTraceEvents_Locked();
 
 	// Create temp payload to resolve key
 	FSpatialLatencyPayload LocalLatencyPayload = LatencyPayload;
@@ -493,6 +658,7 @@ bool USpatialLatencyTracer::AddTrackingInfo(const AActor* Actor, const FString&
 				if (TrackingRPCs.Find(AFKey) == nullptr)
 				{
 					TrackingRPCs.Add(AFKey, Key);
+					NumTrackedTargets.IncrementExchange();
 					return true;
 				}
 				UE_LOG(LogSpatialLatencyTracing, Warning, TEXT("(%s) : ActorFunc already exists for trace"), *WorkerId);
@@ -505,6 +671,7 @@ bool USpatialLatencyTracer::AddTrackingInfo(const AActor* Actor, const FString&
 				if (TrackingProperties.Find(APKey) == nullptr)
 				{
 					TrackingProperties.Add(APKey, Key);
+					NumTrackedTargets.IncrementExchange();
 					return true;
 				}
 				UE_LOG(LogSpatialLatencyTracing, Warning, TEXT("(%s) : ActorProperty already exists for trace"), *WorkerId);
@@ -516,6 +683,7 @@ bool USpatialLatencyTracer::AddTrackingInfo(const AActor* Actor, const FString&
 				if (TrackingTags.Find(ATKey) == nullptr)
 				{
 					TrackingTags.Add(ATKey, Key);
+					NumTrackedTargets.IncrementExchange();
 					return true;
 				}
 				UE_LOG(LogSpatialLatencyTracing, Warning, TEXT("(%s) : ActorProperty already exists for trace"), *WorkerId);
@@ -0,0 +1,72 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialMemoryAccounting.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialMemoryAccounting);
+
+namespace SpatialGDK
+{
+
+void FSpatialMemoryAccounting::Record(ESpatialMemorySubsystem Subsystem, SIZE_T Bytes)
+{
+	check(Subsystem != ESpatialMemorySubsystem::Count);
+
+	const int32 Index = static_cast<int32>(Subsystem);
+	CurrentBytes[Index] = Bytes;
+	PeakBytes[Index] = FMath::Max(PeakBytes[Index], Bytes);
+}
+
+void FSpatialMemoryAccounting::ResetPeaks()
+{
+	for (int32 Index = 0; Index < NumSubsystems; Index++)
+	{
+		PeakBytes[Index] = CurrentBytes[Index];
+	}
+}
+
+SIZE_T FSpatialMemoryAccounting::GetTotalCurrentBytes() const
+{
+	SIZE_T TotalBytes = 0;
+	for (int32 Index = 0; Index < NumSubsystems; Index++)
+	{
+		TotalBytes += CurrentBytes[Index];
+	}
+	return TotalBytes;
+}
+
+void FSpatialMemoryAccounting::LogReport() const
+{
+	UE_LOG(LogSpatialMemoryAccounting, Log, TEXT("GDK memory report (current / peak bytes):"));
+	for (int32 Index = 0; Index < NumSubsystems; Index++)
+	{
+		UE_LOG(LogSpatialMemoryAccounting, Log, TEXT("  %s: %llu / %llu"), GetSubsystemName(static_cast<ESpatialMemorySubsystem>(Index)),
+			static_cast<uint64>(CurrentBytes[Index]), static_cast<uint64>(PeakBytes[Index]));
+	}
+	UE_LOG(LogSpatialMemoryAccounting, Log, TEXT("  Total: %llu"), static_cast<uint64>(GetTotalCurrentBytes()));
+}
+
+const TCHAR* FSpatialMemoryAccounting::GetSubsystemName(ESpatialMemorySubsystem Subsystem)
+{
+	switch (Subsystem)
+	{
+	case ESpatialMemorySubsystem::StaticComponentView:
+		return TEXT("StaticComponentView");
+	case ESpatialMemorySubsystem::ReceiverPendingState:
+		return TEXT("ReceiverPendingState");
+	case ESpatialMemorySubsystem::RPCContainers:
+		return TEXT("RPCContainers");
+	case ESpatialMemorySubsystem::RPCRingBuffers:
+		return TEXT("RPCRingBuffers");
+	case ESpatialMemorySubsystem::NetGUIDCache:
+		return TEXT("NetGUIDCache");
+	case ESpatialMemorySubsystem::ActorChannelShadowData:
+		return TEXT("ActorChannelShadowData");
+	case ESpatialMemorySubsystem::SenderOutgoingQueues:
+		return TEXT("SenderOutgoingQueues");
+	default:
+		checkNoEntry();
+		return TEXT("Unknown");
+	}
+}
+
+} // namespace SpatialGDK
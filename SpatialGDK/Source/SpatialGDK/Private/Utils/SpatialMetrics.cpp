@@ -4,6 +4,13 @@
 
 #include "Engine/Engine.h"
 #include "EngineGlobals.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialGDKSettings.h"
@@ -28,15 +35,67 @@ void USpatialMetrics::Init(USpatialWorkerConnection* InConnection, float InNetSe
 	bRPCTrackingEnabled = false;
 	RPCTrackingStartTime = 0.0f;
 
+	bBandwidthTrackingEnabled = false;
+	BandwidthTrackingStartTime = 0.0;
+
 	UserSuppliedMetric Delegate;
 	Delegate.BindUObject(this, &USpatialMetrics::GetAverageFPS);
 	SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_DYNAMIC_FPS, Delegate);
+
+	FrameTimeHistogram = &AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_FRAME_TIME,
+		{ 0.008, 0.011, 0.017, 0.025, 0.034, 0.05, 0.067, 0.1, 0.2, 0.5 });
+	OutgoingMessageQueueDepthHistogram = &AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_OUTGOING_MESSAGE_QUEUE_DEPTH,
+		{ 0, 16, 64, 256, 1024, 4096, 16384 });
+
+	OutgoingMessageLaneDepthHistograms.Empty();
+	if (SpatialGDK::FOutgoingMessageLanes* Lanes = Connection->GetOutgoingMessageLanes())
+	{
+		for (int32 LaneIndex = 0; LaneIndex < static_cast<int32>(SpatialGDK::EOutgoingMessageLane::Count); LaneIndex++)
+		{
+			const SpatialGDK::EOutgoingMessageLane Lane = static_cast<SpatialGDK::EOutgoingMessageLane>(LaneIndex);
+			const TCHAR* LaneName = SpatialGDK::FOutgoingMessageLanes::GetLaneName(Lane);
+			OutgoingMessageLaneDepthHistograms.Add(&AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_OUTGOING_MESSAGE_LANE_DEPTH + LaneName,
+				{ 0, 16, 64, 256, 1024, 4096, 16384 }));
+			Lanes->SetWaitTimeHistogram(Lane, &AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_OUTGOING_MESSAGE_LANE_WAIT_TIME + LaneName,
+				{ 0.0, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5 }));
+		}
+	}
+
+	PrometheusMetricsEndpoint.Reset();
+	int32 PrometheusMetricsPort = GetDefault<USpatialGDKSettings>()->PrometheusMetricsPort;
+	FParse::Value(FCommandLine::Get(), TEXT("prometheusMetricsPort="), PrometheusMetricsPort);
+	PrometheusMetricsPort = FMath::Clamp(PrometheusMetricsPort, 0, 65535);
+	if (bIsServer && PrometheusMetricsPort > 0)
+	{
+		PrometheusMetricsEndpoint = MakeUnique<SpatialGDK::FPrometheusMetricsEndpoint>();
+		if (!PrometheusMetricsEndpoint->Start(PrometheusMetricsPort))
+		{
+			UE_LOG(LogSpatialMetrics, Warning, TEXT("Couldn't serve Prometheus metrics on port %d."), PrometheusMetricsPort);
+			PrometheusMetricsEndpoint.Reset();
+		}
+	}
 }
 
 void USpatialMetrics::TickMetrics(float NetDriverTime)
 {
+	if (bBandwidthTrackingEnabled)
+	{
+		// Consumed every tick, so entities are still around to be resolved to their actor class.
+		ConsumeSentBandwidth();
+	}
+
 	FramesSinceLastReport++;
 
+	FrameTimeHistogram->Record(FApp::GetDeltaTime());
+	OutgoingMessageQueueDepthHistogram->Record(Connection->GetOutgoingMessageQueueDepth());
+	if (SpatialGDK::FOutgoingMessageLanes* Lanes = Connection->GetOutgoingMessageLanes())
+	{
+		for (int32 LaneIndex = 0; LaneIndex < OutgoingMessageLaneDepthHistograms.Num(); LaneIndex++)
+		{
+			OutgoingMessageLaneDepthHistograms[LaneIndex]->Record(Lanes->GetDepth(static_cast<SpatialGDK::EOutgoingMessageLane>(LaneIndex)));
+		}
+	}
+
 	TimeSinceLastReport = NetDriverTime - TimeOfLastReport;
 
 	// Check that there has been a sufficient amount of time since the last report.
@@ -46,10 +105,27 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 	}
 
 	AverageFPS = FramesSinceLastReport / TimeSinceLastReport;
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const bool bReportLoadVector = bIsServer && SpatialGDKSettings->bReportWorkerLoadVector;
+	if (bReportLoadVector)
+	{
+		UpdateWorkerLoadVector();
+	}
+
 	if (WorkerLoadDelegate.IsBound())
 	{
 		WorkerLoad = WorkerLoadDelegate.Execute();
 	}
+	else if (bReportLoadVector)
+	{
+		SpatialGDK::FWorkerLoadBudget Budget;
+		Budget.AuthoritativeEntities = SpatialGDKSettings->WorkerLoadAuthoritativeEntityBudget;
+		Budget.OutgoingBytesPerSecond = SpatialGDKSettings->WorkerLoadOutgoingBytesPerSecondBudget;
+		Budget.IncomingOpsPerSecond = SpatialGDKSettings->WorkerLoadIncomingOpsPerSecondBudget;
+		Budget.MemoryUsedMB = SpatialGDKSettings->WorkerLoadMemoryBudgetMB;
+		WorkerLoad = WorkerLoadVector.GetBottleneckLoad(Budget);
+	}
 	else
 	{
 		WorkerLoad = CalculateLoad();
@@ -80,9 +156,41 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 		UserSuppliedMetrics.Remove(KeyToRemove);
 	}
 
+	SpatialGDK::HistogramMetric OpQueueLatency;
+	if (Connection->ConsumeOpQueueLatencyHistogram(OpQueueLatency))
+	{
+		OpQueueLatency.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_OP_QUEUE_LATENCY);
+		Metrics.HistogramMetrics.Add(MoveTemp(OpQueueLatency));
+	}
+
+	for (const TPair<FString, TUniquePtr<SpatialGDK::FAtomicHistogram>>& Histogram : HistogramMetrics)
+	{
+		SpatialGDK::HistogramMetric Metric;
+		if (Histogram.Value->Consume(Metric))
+		{
+			Metric.Key = TCHAR_TO_UTF8(*Histogram.Key);
+			Metrics.HistogramMetrics.Add(MoveTemp(Metric));
+		}
+	}
+
 	TimeOfLastReport = NetDriverTime;
 	FramesSinceLastReport = 0;
 
+	if (PrometheusMetricsEndpoint.IsValid())
+	{
+		const TArray<TPair<FString, uint64>> Counters = {
+			{ TEXT("sent_rpcs"), SentRPCCount },
+			{ TEXT("received_ops"), ReceivedOpCount },
+			{ TEXT("received_rpcs"), ReceivedRPCCount },
+			{ TEXT("received_rpc_batches"), ReceivedRPCBatchCount },
+			{ TEXT("queued_outgoing_messages"), Connection->GetQueuedOutgoingMessageCount() },
+			{ TEXT("merged_component_updates"), Connection->GetMergedComponentUpdateCount() },
+			{ TEXT("sent_component_updates"), Connection->GetSentComponentUpdateCount() },
+			{ TEXT("outgoing_message_ring_full"), Connection->GetOutgoingMessageRingFullCount() },
+		};
+		PrometheusMetricsEndpoint->Publish(Metrics, Counters);
+	}
+
 	Connection->SendMetrics(Metrics);
 }
 
@@ -101,6 +209,23 @@ double USpatialMetrics::CalculateLoad() const
 	return AverageFrameTime / TargetFrameTime;
 }
 
+void USpatialMetrics::UpdateWorkerLoadVector()
+{
+	const uint64 QueuedOutgoingByteCount = Connection->GetQueuedOutgoingByteCount();
+
+	WorkerLoadVector.FrameTimeLoad = CalculateLoad();
+	WorkerLoadVector.AuthoritativeEntityCount = AuthoritativeEntityCountProvider.IsBound() ? AuthoritativeEntityCountProvider.Execute() : 0;
+	if (TimeSinceLastReport > 0.f)
+	{
+		WorkerLoadVector.OutgoingBytesPerSecond = (QueuedOutgoingByteCount - QueuedOutgoingByteCountAtLastReport) / TimeSinceLastReport;
+		WorkerLoadVector.IncomingOpsPerSecond = (ReceivedOpCount - ReceivedOpCountAtLastReport) / TimeSinceLastReport;
+	}
+	WorkerLoadVector.MemoryUsedMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+
+	QueuedOutgoingByteCountAtLastReport = QueuedOutgoingByteCount;
+	ReceivedOpCountAtLastReport = ReceivedOpCount;
+}
+
 void USpatialMetrics::SpatialStartRPCMetrics()
 {
 	if (bRPCTrackingEnabled)
@@ -267,6 +392,10 @@ void USpatialMetrics::SpatialModifySetting(const FString& Name, float Value)
 		{
 			GetMutableDefault<USpatialGDKSettings>()->EntityCreationRateLimit = static_cast<uint32>(Value);
 		}
+		else if (Name == TEXT("MaxCreateEntityRequestsInFlight"))
+		{
+			GetMutableDefault<USpatialGDKSettings>()->MaxCreateEntityRequestsInFlight = static_cast<uint32>(Value);
+		}
 		else if (Name == TEXT("PositionUpdateFrequency"))
 		{
 			GetMutableDefault<USpatialGDKSettings>()->PositionUpdateFrequency = Value;
@@ -291,6 +420,81 @@ void USpatialMetrics::SpatialModifySetting(const FString& Name, float Value)
 	}
 }
 
+void USpatialMetrics::SpatialStartBandwidthMetrics()
+{
+	if (bBandwidthTrackingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Already recording bandwidth metrics"));
+		return;
+	}
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recording bandwidth metrics"));
+
+	BandwidthReport.Reset();
+	bBandwidthTrackingEnabled = true;
+	BandwidthTrackingStartTime = FPlatformTime::Seconds();
+	Connection->GetBandwidthAccounting().SetEnabled(true);
+}
+
+void USpatialMetrics::SpatialStopBandwidthMetrics()
+{
+	if (!bBandwidthTrackingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Could not stop recording bandwidth metrics. Bandwidth metrics not yet started."));
+		return;
+	}
+
+	Connection->GetBandwidthAccounting().SetEnabled(false);
+	ConsumeSentBandwidth();
+	bBandwidthTrackingEnabled = false;
+
+	const double TrackBandwidthInterval = FPlatformTime::Seconds() - BandwidthTrackingStartTime;
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded sent bytes for %d components and %d actor classes over the last %.3f seconds."),
+		BandwidthReport.ByComponent.Num(), BandwidthReport.ByClass.Num(), TrackBandwidthInterval);
+
+	// Log the classes using the most bandwidth, the CSV has everything.
+	static const int32 MaxLoggedClasses = 20;
+	TArray<TPair<FString, SpatialGDK::FBandwidthStat>> SortedClasses = BandwidthReport.ByClass.Array();
+	SortedClasses.Sort([](const TPair<FString, SpatialGDK::FBandwidthStat>& A, const TPair<FString, SpatialGDK::FBandwidthStat>& B)
+	{
+		return A.Value.Bytes > B.Value.Bytes;
+	});
+	for (int32 i = 0; i < FMath::Min(SortedClasses.Num(), MaxLoggedClasses); i++)
+	{
+		const TPair<FString, SpatialGDK::FBandwidthStat>& Stat = SortedClasses[i];
+		UE_LOG(LogSpatialMetrics, Log, TEXT("%s: %llu bytes in %llu messages, %.1f bytes/sec"), *Stat.Key, Stat.Value.Bytes, Stat.Value.Messages,
+			TrackBandwidthInterval > 0.0 ? Stat.Value.Bytes / TrackBandwidthInterval : 0.0);
+	}
+
+	const FString Filename = FPaths::Combine(FPaths::ProfilingDir(), TEXT("SpatialBandwidth"),
+		FString::Printf(TEXT("%s-%s.csv"), *Connection->GetWorkerId(), *FDateTime::Now().ToString()));
+	if (FFileHelper::SaveStringToFile(BandwidthReport.ToCsv(TrackBandwidthInterval), *Filename))
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Wrote bandwidth metrics to %s"), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*Filename));
+	}
+	else
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("Failed to write bandwidth metrics to %s"), *Filename);
+	}
+
+	BandwidthReport.Reset();
+}
+
+void USpatialMetrics::ConsumeSentBandwidth()
+{
+	for (const TPair<SpatialGDK::EntityComponentId, SpatialGDK::FBandwidthStat>& Sent : Connection->GetBandwidthAccounting().ConsumeRecorded())
+	{
+		BandwidthReport.ByComponent.FindOrAdd(Sent.Key.ComponentId).Add(Sent.Value.Bytes, Sent.Value.Messages);
+
+		FString ClassName;
+		if (EntityClassNameProvider.IsBound())
+		{
+			ClassName = EntityClassNameProvider.Execute(Sent.Key.EntityId);
+		}
+		BandwidthReport.ByClass.FindOrAdd(ClassName.IsEmpty() ? TEXT("Unresolved") : ClassName).Add(Sent.Value.Bytes, Sent.Value.Messages);
+	}
+}
+
 void USpatialMetrics::OnModifySettingCommand(Schema_Object* CommandPayload)
 {
 	FString Name = SpatialGDK::GetStringFromSchema(CommandPayload, SpatialConstants::MODIFY_SETTING_PAYLOAD_NAME_ID);
@@ -301,13 +505,25 @@ void USpatialMetrics::OnModifySettingCommand(Schema_Object* CommandPayload)
 
 void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize)
 {
-	if (!bRPCTrackingEnabled)
+	SentRPCCount++;
+
+	if (!bRPCTrackingEnabled && !bBandwidthTrackingEnabled)
 	{
 		return;
 	}
 
 	FString FunctionName = FString::Printf(TEXT("%s::%s"), *Function->GetOuter()->GetName(), *Function->GetName());
 
+	if (bBandwidthTrackingEnabled)
+	{
+		BandwidthReport.ByRPC.FindOrAdd(FunctionName).Add(PayloadSize);
+	}
+
+	if (!bRPCTrackingEnabled)
+	{
+		return;
+	}
+
 	if (RecentRPCs.Find(FunctionName) == nullptr)
 	{
 		RPCStat Stat;
@@ -326,6 +542,11 @@ void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int Pa
 
 void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 {
+	for (uint32 i = 0; i < Op->op.metrics.metrics.gauge_metric_count; i++)
+	{
+		LatestWorkerSDKMetrics.Add(Op->op.metrics.metrics.gauge_metrics[i].key, Op->op.metrics.metrics.gauge_metrics[i].value);
+	}
+
 	if (WorkerMetricsRecieved.IsBound())
 	{
 		int32 NumMetrics = Op->op.metrics.metrics.gauge_metric_count;
@@ -346,6 +567,45 @@ void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 	}
 }
 
+void USpatialMetrics::SpatialLogNetworkStatistics()
+{
+	if (LatestWorkerSDKMetrics.Num() == 0)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("The Worker SDK hasn't reported any metrics yet."));
+		return;
+	}
+
+	TArray<FString> Keys;
+	LatestWorkerSDKMetrics.GetKeys(Keys);
+	Keys.Sort();
+	for (const FString& Key : Keys)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("%s: %f"), *Key, LatestWorkerSDKMetrics[Key]);
+	}
+}
+
+void USpatialMetrics::SpatialHotEntities(int32 Count)
+{
+	if (HotEntityTracker == nullptr)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("SpatialHotEntities: hot entity tracking is disabled, see bEnableHotEntityTracking."));
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Tracking %d entities"), HotEntityTracker->GetNumTrackedEntities());
+	for (int32 CounterIndex = 0; CounterIndex < static_cast<int32>(SpatialGDK::EHotEntityCounter::Count); CounterIndex++)
+	{
+		const SpatialGDK::EHotEntityCounter Counter = static_cast<SpatialGDK::EHotEntityCounter>(CounterIndex);
+		UE_LOG(LogSpatialMetrics, Log, TEXT("%s per second:"), SpatialGDK::FHotEntityTracker::GetCounterName(Counter));
+		for (const SpatialGDK::FHotEntity& HotEntity : HotEntityTracker->GetTopEntities(Counter, Count, Now))
+		{
+			const FString ClassName = EntityClassNameProvider.IsBound() ? EntityClassNameProvider.Execute(HotEntity.EntityId) : FString();
+			UE_LOG(LogSpatialMetrics, Log, TEXT("    %lld (%s): %.1f"), HotEntity.EntityId, *ClassName, HotEntity.Rate);
+		}
+	}
+}
+
 void USpatialMetrics::SetCustomMetric(const FString& Metric, const UserSuppliedMetric& Delegate)
 {
 	UE_LOG(LogSpatialMetrics, Log, TEXT("USpatialMetrics: Adding custom metric %s (%s)"), *Metric, Delegate.GetUObject() ? *GetNameSafe(Delegate.GetUObject()) : TEXT("Not attached to UObject"));
@@ -367,3 +627,25 @@ void USpatialMetrics::RemoveCustomMetric(const FString& Metric)
 		UserSuppliedMetrics.Remove(Metric);
 	}
 }
+
+SpatialGDK::FAtomicHistogram& USpatialMetrics::AddHistogramMetric(const FString& Metric, const TArray<double>& UpperBounds)
+{
+	if (TUniquePtr<SpatialGDK::FAtomicHistogram>* ExistingHistogram = HistogramMetrics.Find(Metric))
+	{
+		return **ExistingHistogram;
+	}
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("USpatialMetrics: Adding histogram metric %s"), *Metric);
+	return *HistogramMetrics.Add(Metric, MakeUnique<SpatialGDK::FAtomicHistogram>(UpperBounds));
+}
+
+void USpatialMetrics::RecordHandoverBytes(const UClass& Class, uint32 Bytes)
+{
+	SpatialGDK::FAtomicHistogram*& Histogram = HandoverBytesHistograms.FindOrAdd(Class.GetFName());
+	if (Histogram == nullptr)
+	{
+		Histogram = &AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_HANDOVER_BYTES + Class.GetName(),
+			{ 16, 64, 256, 1024, 4096, 16384, 65536 });
+	}
+	Histogram->Record(Bytes);
+}
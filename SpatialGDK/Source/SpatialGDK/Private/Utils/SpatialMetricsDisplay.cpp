@@ -6,7 +6,13 @@
 #include "Engine/Canvas.h"
 #include "Engine/Engine.h"
 #include "EngineClasses/SpatialNetDriver.h"
+#include "HAL/FileManager.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "LoadBalancing/LayeredLBStrategy.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Net/UnrealNetwork.h"
 #include "Utils/SpatialMetrics.h"
 
@@ -82,6 +88,74 @@ void ASpatialMetricsDisplay::ServerUpdateWorkerStats_Implementation(const float
 
 	float& WorkerUpdateTime = WorkerStatsLastUpdateTime.FindOrAdd(OneWorkerStats.WorkerName);
 	WorkerUpdateTime = Time;
+
+	RecordLoadSample(Time, OneWorkerStats);
+}
+
+void ASpatialMetricsDisplay::RecordLoadSample(const float Time, const FWorkerStats& OneWorkerStats)
+{
+	// Stats are sent every tick, the history only keeps one sample per worker every LoadSampleInterval.
+	const float* LastSampleTime = WorkerLoadLastSampleTime.Find(OneWorkerStats.WorkerName);
+	if (LastSampleTime != nullptr && Time - *LastSampleTime < LoadSampleInterval)
+	{
+		return;
+	}
+	WorkerLoadLastSampleTime.Add(OneWorkerStats.WorkerName, Time);
+
+	SpatialGDK::FWorkerLoadSample Sample;
+	Sample.Time = Time;
+	Sample.EntityCount = OneWorkerStats.EntityCount;
+	Sample.FrameTimeMs = OneWorkerStats.AverageFPS > 0.f ? 1000.f / OneWorkerStats.AverageFPS : 0.f;
+	Sample.OpsReceivedPerSecond = OneWorkerStats.OpsReceivedPerSecond;
+	Sample.MessagesSentPerSecond = OneWorkerStats.MessagesSentPerSecond;
+	Sample.RPCsSentPerSecond = OneWorkerStats.RPCsSentPerSecond;
+	LoadHistory.AddSample(OneWorkerStats.WorkerName, OneWorkerStats.VirtualWorker, Sample);
+}
+
+void ASpatialMetricsDisplay::UpdateLoadHistoryCells(const USpatialNetDriver& SpatialNetDriver)
+{
+	const ULayeredLBStrategy* LayeredLBStrategy = Cast<ULayeredLBStrategy>(SpatialNetDriver.LoadBalanceStrategy);
+	if (LayeredLBStrategy == nullptr)
+	{
+		return;
+	}
+
+	for (const TPair<VirtualWorkerId, FBox2D>& Region : LayeredLBStrategy->GetLBStrategyForVisualRendering()->GetLBStrategyRegions())
+	{
+		LoadHistory.SetCell(Region.Key, Region.Value);
+	}
+}
+
+void ASpatialMetricsDisplay::SpatialExportWorkerLoad(const FString& Format)
+{
+#if !UE_BUILD_SHIPPING
+	USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(GetWorld()->GetNetDriver());
+	if (SpatialNetDriver == nullptr || SpatialNetDriver->Connection == nullptr || !GetWorld()->IsServer())
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("SpatialExportWorkerLoad can only be run on a server worker."));
+		return;
+	}
+
+	if (Role != ROLE_Authority)
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("SpatialExportWorkerLoad: worker load is aggregated by the server worker with authority over the SpatialMetricsDisplay, not this one."));
+		return;
+	}
+
+	UpdateLoadHistoryCells(*SpatialNetDriver);
+
+	const bool bJson = Format.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	const FString Filename = FPaths::Combine(FPaths::ProfilingDir(), TEXT("SpatialWorkerLoad"),
+		FString::Printf(TEXT("%s-%s.%s"), *SpatialNetDriver->Connection->GetWorkerId(), *FDateTime::Now().ToString(), bJson ? TEXT("json") : TEXT("csv")));
+	if (FFileHelper::SaveStringToFile(bJson ? LoadHistory.ToJson() : LoadHistory.ToCsv(), *Filename))
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Wrote worker load to %s"), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*Filename));
+	}
+	else
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("Failed to write worker load to %s"), *Filename);
+	}
+#endif // !UE_BUILD_SHIPPING
 }
 
 void ASpatialMetricsDisplay::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -220,6 +294,13 @@ void ASpatialMetricsDisplay::Tick(float DeltaSeconds)
 	Stats.AverageFPS = Metrics.GetAverageFPS();
 	Stats.ServerConsiderListSize = SpatialNetDriver->GetConsiderListSize();
 	Stats.ServerReplicationLimit = GetDefault<USpatialGDKSettings>()->ActorReplicationRateLimit;
+	Stats.VirtualWorker = SpatialNetDriver->LoadBalanceStrategy != nullptr ? SpatialNetDriver->LoadBalanceStrategy->GetLocalVirtualWorkerId() : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	Stats.EntityCount = SpatialNetDriver->StaticComponentView->GetNumEntities();
+
+	UpdateLoadRates(*SpatialNetDriver, GetWorld()->GetTimeSeconds());
+	Stats.OpsReceivedPerSecond = OpsReceivedPerSecond;
+	Stats.MessagesSentPerSecond = MessagesSentPerSecond;
+	Stats.RPCsSentPerSecond = RPCsSentPerSecond;
 
 #if USE_SERVER_PERF_COUNTERS
 	float MovementCorrectionsPerSecond = 0.f;
@@ -256,6 +337,29 @@ void ASpatialMetricsDisplay::Tick(float DeltaSeconds)
 #endif // !UE_BUILD_SHIPPING
 }
 
+void ASpatialMetricsDisplay::UpdateLoadRates(const USpatialNetDriver& SpatialNetDriver, const float WorldTime)
+{
+	const LoadCountersRecord Counters{ SpatialNetDriver.SpatialMetrics->GetReceivedOpCount(), SpatialNetDriver.Connection->GetQueuedOutgoingMessageCount(),
+		SpatialNetDriver.SpatialMetrics->GetSentRPCCount(), WorldTime };
+
+	if (!LastLoadCounters.IsSet())
+	{
+		LastLoadCounters = Counters;
+		return;
+	}
+
+	const float WorldTimeDelta = WorldTime - LastLoadCounters->Time;
+	if (WorldTimeDelta < LoadSampleInterval)
+	{
+		return;
+	}
+
+	OpsReceivedPerSecond = (Counters.ReceivedOps - LastLoadCounters->ReceivedOps) / WorldTimeDelta;
+	MessagesSentPerSecond = (Counters.QueuedMessages - LastLoadCounters->QueuedMessages) / WorldTimeDelta;
+	RPCsSentPerSecond = (Counters.SentRPCs - LastLoadCounters->SentRPCs) / WorldTimeDelta;
+	LastLoadCounters = Counters;
+}
+
 bool ASpatialMetricsDisplay::ShouldRemoveStats(const float CurrentTime, const FWorkerStats& OneWorkerStats) const
 {
 	const float* LastUpdateTime = WorkerStatsLastUpdateTime.Find(OneWorkerStats.WorkerName);
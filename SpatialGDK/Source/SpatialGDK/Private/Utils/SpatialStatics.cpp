@@ -3,6 +3,7 @@
 #include "Utils/SpatialStatics.h"
 
 #include "Engine/World.h"
+#include "EngineClasses/SpatialActorChannel.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "EngineClasses/SpatialWorldSettings.h"
@@ -164,3 +165,33 @@ FString USpatialStatics::GetActorEntityIdAsString(const AActor* Actor)
 {
 	return EntityIdToString(GetActorEntityId(Actor));
 }
+
+void USpatialStatics::SetPushModelEnabled(const AActor* Actor, bool bEnabled)
+{
+	if (USpatialActorChannel* Channel = GetActorChannel(Actor))
+	{
+		Channel->SetPushModelEnabled(bEnabled);
+	}
+}
+
+void USpatialStatics::MarkActorPropertiesDirty(const AActor* Actor)
+{
+	if (USpatialActorChannel* Channel = GetActorChannel(Actor))
+	{
+		Channel->MarkPropertiesDirty();
+	}
+}
+
+USpatialActorChannel* USpatialStatics::GetActorChannel(const AActor* Actor)
+{
+	check(Actor);
+	if (const USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(Actor->GetNetDriver()))
+	{
+		const Worker_EntityId EntityId = SpatialNetDriver->PackageMap->GetEntityIdFromObject(Actor);
+		if (EntityId != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			return SpatialNetDriver->GetActorChannelByEntityId(EntityId);
+		}
+	}
+	return nullptr;
+}
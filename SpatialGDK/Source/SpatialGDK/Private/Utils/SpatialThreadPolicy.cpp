@@ -0,0 +1,141 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialThreadPolicy.h"
+
+#include "HAL/PlatformAffinity.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/RunnableThread.h"
+
+#include "SpatialGDKSettings.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialThreadPolicy);
+
+namespace
+{
+
+// The affinity mask has a bit per logical core.
+constexpr int32 MaxAffinityCores = 64;
+
+const TCHAR* GetThreadPriorityName(EThreadPriority Priority)
+{
+	switch (Priority)
+	{
+	case TPri_Lowest:
+		return TEXT("Lowest");
+	case TPri_BelowNormal:
+		return TEXT("BelowNormal");
+	case TPri_SlightlyBelowNormal:
+		return TEXT("SlightlyBelowNormal");
+	case TPri_Normal:
+		return TEXT("Normal");
+	case TPri_AboveNormal:
+		return TEXT("AboveNormal");
+	case TPri_Highest:
+		return TEXT("Highest");
+	case TPri_TimeCritical:
+		return TEXT("TimeCritical");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+FString DescribeAffinity(uint64 AffinityMask)
+{
+	if (AffinityMask == 0)
+	{
+		return TEXT("any core");
+	}
+
+	TArray<FString> Cores;
+	for (int32 Core = 0; Core < MaxAffinityCores; Core++)
+	{
+		if (AffinityMask & (uint64(1) << Core))
+		{
+			Cores.Add(FString::FromInt(Core));
+		}
+	}
+	return FString::Printf(TEXT("cores %s"), *FString::Join(Cores, TEXT(",")));
+}
+
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FRunnableThread* CreateThreadWithPolicy(FRunnable* Runnable, const TCHAR* ThreadName, EThreadPriority DefaultPriority, bool bSupportsBusyPoll)
+{
+	const FSpatialThreadPolicy& Policy = GetDefault<USpatialGDKSettings>()->GetThreadPolicy(ThreadName);
+
+	const int32 NumCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	const uint64 AffinityMask = GetThreadAffinityMask(Policy.AffinityCores, NumCores);
+	const bool bHasInvalidCores = Policy.AffinityCores.ContainsByPredicate([NumCores](int32 Core)
+	{
+		return Core < 0 || Core >= FMath::Min(NumCores, MaxAffinityCores);
+	});
+
+	if (bHasInvalidCores)
+	{
+		UE_LOG(LogSpatialThreadPolicy, Warning, TEXT("Thread %s has affinity cores this host doesn't have, it has %d logical cores. They are ignored."), ThreadName, NumCores);
+	}
+	if (Policy.bBusyPoll && !bSupportsBusyPoll)
+	{
+		UE_LOG(LogSpatialThreadPolicy, Warning, TEXT("Thread %s doesn't support busy polling, the setting is ignored."), ThreadName);
+	}
+	else if (Policy.bBusyPoll && AffinityMask == 0)
+	{
+		UE_LOG(LogSpatialThreadPolicy, Warning, TEXT("Thread %s busy polls without a core affinity, so it competes for a core with every other thread."), ThreadName);
+	}
+
+	const EThreadPriority Priority = GetThreadPriority(Policy, DefaultPriority);
+	FRunnableThread* Thread = FRunnableThread::Create(Runnable, ThreadName, Policy.StackSizeKB * 1024, Priority,
+		AffinityMask != 0 ? AffinityMask : FPlatformAffinity::GetNoAffinityMask());
+
+	if (Thread != nullptr)
+	{
+		UE_LOG(LogSpatialThreadPolicy, Log, TEXT("Started thread %s: priority %s, stack size %s, %s%s."), ThreadName, GetThreadPriorityName(Priority),
+			Policy.StackSizeKB > 0 ? *FString::Printf(TEXT("%u KB"), Policy.StackSizeKB) : TEXT("platform default"), *DescribeAffinity(AffinityMask),
+			Policy.bBusyPoll && bSupportsBusyPoll ? TEXT(", busy polling") : TEXT(""));
+	}
+
+	return Thread;
+}
+
+uint64 GetThreadAffinityMask(const TArray<int32>& Cores, int32 NumCores)
+{
+	const int32 NumMaskCores = FMath::Min(NumCores, MaxAffinityCores);
+
+	uint64 AffinityMask = 0;
+	for (int32 Core : Cores)
+	{
+		if (Core >= 0 && Core < NumMaskCores)
+		{
+			AffinityMask |= uint64(1) << Core;
+		}
+	}
+	return AffinityMask;
+}
+
+EThreadPriority GetThreadPriority(const FSpatialThreadPolicy& Policy, EThreadPriority DefaultPriority)
+{
+	switch (Policy.Priority)
+	{
+	case ESpatialThreadPriority::Lowest:
+		return TPri_Lowest;
+	case ESpatialThreadPriority::BelowNormal:
+		return TPri_BelowNormal;
+	case ESpatialThreadPriority::SlightlyBelowNormal:
+		return TPri_SlightlyBelowNormal;
+	case ESpatialThreadPriority::Normal:
+		return TPri_Normal;
+	case ESpatialThreadPriority::AboveNormal:
+		return TPri_AboveNormal;
+	case ESpatialThreadPriority::Highest:
+		return TPri_Highest;
+	case ESpatialThreadPriority::TimeCritical:
+		return TPri_TimeCritical;
+	default:
+		return DefaultPriority;
+	}
+}
+
+} // namespace SpatialGDK
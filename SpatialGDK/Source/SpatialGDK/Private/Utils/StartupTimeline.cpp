@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/StartupTimeline.h"
+
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialStartupTimeline);
+
+namespace SpatialGDK
+{
+
+void FStartupTimeline::Start()
+{
+	StartTime = FPlatformTime::Seconds();
+	Phases.Reset();
+}
+
+void FStartupTimeline::MarkPhase(const TCHAR* PhaseName)
+{
+	if (HasPhase(PhaseName))
+	{
+		return;
+	}
+
+	Phases.Add(FPhase{ PhaseName, FPlatformTime::Seconds() });
+}
+
+bool FStartupTimeline::HasPhase(const TCHAR* PhaseName) const
+{
+	return Phases.ContainsByPredicate([PhaseName](const FPhase& Phase) { return Phase.Name == PhaseName; });
+}
+
+void FStartupTimeline::LogTimeline(const FString& WorkerDescription) const
+{
+	if (Phases.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogSpatialStartupTimeline, Log, TEXT("%s started up in %.3fs:"), *WorkerDescription, Phases.Last().Time - StartTime);
+
+	double PreviousTime = StartTime;
+	for (const FPhase& Phase : Phases)
+	{
+		UE_LOG(LogSpatialStartupTimeline, Log, TEXT("  %-28s at %8.3fs (+%.3fs)"), *Phase.Name, Phase.Time - StartTime, Phase.Time - PreviousTime);
+		PreviousTime = Phase.Time;
+	}
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,15 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SubsystemStats.h"
+
+DEFINE_STAT(STAT_SpatialGDKTickDispatch);
+DEFINE_STAT(STAT_SpatialGDKCriticalSection);
+DEFINE_STAT(STAT_SpatialGDKReplicateActor);
+DEFINE_STAT(STAT_SpatialGDKComponentFactory);
+DEFINE_STAT(STAT_SpatialGDKRPCServiceFlush);
+DEFINE_STAT(STAT_SpatialGDKInterestUpdate);
+DEFINE_STAT(STAT_SpatialGDKLoadBalanceEnforcement);
+DEFINE_STAT(STAT_SpatialGDKConnectionReceive);
+DEFINE_STAT(STAT_SpatialGDKConnectionSend);
+
+CSV_DEFINE_CATEGORY_MODULE(SPATIALGDK_API, SpatialGDK, true);
@@ -0,0 +1,86 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/WorkerLoadHistory.h"
+
+namespace SpatialGDK
+{
+
+FWorkerLoadHistory::FWorkerLoadHistory(int32 InMaxSamplesPerWorker)
+	: MaxSamplesPerWorker(FMath::Max(InMaxSamplesPerWorker, 1))
+{
+}
+
+void FWorkerLoadHistory::AddSample(const FString& WorkerName, VirtualWorkerId InVirtualWorkerId, const FWorkerLoadSample& Sample)
+{
+	FWorkerSeries& Series = Workers.FindOrAdd(WorkerName);
+	Series.VirtualWorker = InVirtualWorkerId;
+
+	if (Series.Samples.Num() >= MaxSamplesPerWorker)
+	{
+		Series.Samples.RemoveAt(0, Series.Samples.Num() - MaxSamplesPerWorker + 1, /* bAllowShrinking */ false);
+	}
+
+	Series.Samples.Add(Sample);
+}
+
+void FWorkerLoadHistory::RemoveWorker(const FString& WorkerName)
+{
+	Workers.Remove(WorkerName);
+}
+
+void FWorkerLoadHistory::SetCell(VirtualWorkerId InVirtualWorkerId, const FBox2D& Extents)
+{
+	Cells.Add(InVirtualWorkerId, Extents);
+}
+
+const TArray<FWorkerLoadSample>* FWorkerLoadHistory::GetSamples(const FString& WorkerName) const
+{
+	const FWorkerSeries* Series = Workers.Find(WorkerName);
+	return Series != nullptr ? &Series->Samples : nullptr;
+}
+
+FString FWorkerLoadHistory::ToCsv() const
+{
+	FString Csv = TEXT("Worker,VirtualWorkerId,CellMinX,CellMinY,CellMaxX,CellMaxY,Time,EntityCount,FrameTimeMs,OpsIn,OpsOut,RPCs\n");
+	for (const TPair<FString, FWorkerSeries>& Worker : Workers)
+	{
+		const FBox2D* Cell = Cells.Find(Worker.Value.VirtualWorker);
+		const FString CellColumns = Cell != nullptr
+			? FString::Printf(TEXT("%.1f,%.1f,%.1f,%.1f"), Cell->Min.X, Cell->Min.Y, Cell->Max.X, Cell->Max.Y)
+			: TEXT(",,,");
+
+		for (const FWorkerLoadSample& Sample : Worker.Value.Samples)
+		{
+			Csv += FString::Printf(TEXT("%s,%u,%s,%.3f,%d,%.3f,%.1f,%.1f,%.1f\n"), *Worker.Key, Worker.Value.VirtualWorker, *CellColumns,
+				Sample.Time, Sample.EntityCount, Sample.FrameTimeMs, Sample.OpsReceivedPerSecond, Sample.MessagesSentPerSecond, Sample.RPCsSentPerSecond);
+		}
+	}
+	return Csv;
+}
+
+FString FWorkerLoadHistory::ToJson() const
+{
+	TArray<FString> WorkerObjects;
+	for (const TPair<FString, FWorkerSeries>& Worker : Workers)
+	{
+		TArray<FString> SampleObjects;
+		for (const FWorkerLoadSample& Sample : Worker.Value.Samples)
+		{
+			SampleObjects.Add(FString::Printf(TEXT("{\"time\":%.3f,\"entityCount\":%d,\"frameTimeMs\":%.3f,\"opsIn\":%.1f,\"opsOut\":%.1f,\"rpcs\":%.1f}"),
+				Sample.Time, Sample.EntityCount, Sample.FrameTimeMs, Sample.OpsReceivedPerSecond, Sample.MessagesSentPerSecond, Sample.RPCsSentPerSecond));
+		}
+
+		FString CellField;
+		if (const FBox2D* Cell = Cells.Find(Worker.Value.VirtualWorker))
+		{
+			CellField = FString::Printf(TEXT(",\"cell\":{\"minX\":%.1f,\"minY\":%.1f,\"maxX\":%.1f,\"maxY\":%.1f}"), Cell->Min.X, Cell->Min.Y, Cell->Max.X, Cell->Max.Y);
+		}
+
+		WorkerObjects.Add(FString::Printf(TEXT("{\"worker\":\"%s\",\"virtualWorkerId\":%u%s,\"samples\":[%s]}"),
+			*Worker.Key.ReplaceCharWithEscapedChar(), Worker.Value.VirtualWorker, *CellField, *FString::Join(SampleObjects, TEXT(","))));
+	}
+
+	return FString::Printf(TEXT("[%s]"), *FString::Join(WorkerObjects, TEXT(",")));
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,76 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/WorkerLoadVector.h"
+
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+
+double FWorkerLoadVector::GetBottleneckLoad(const FWorkerLoadBudget& Budget, EWorkerLoadDimension* OutDimension /* = nullptr */) const
+{
+	double BottleneckLoad = FrameTimeLoad;
+	EWorkerLoadDimension Bottleneck = EWorkerLoadDimension::FrameTime;
+
+	auto ConsiderDimension = [&BottleneckLoad, &Bottleneck](EWorkerLoadDimension Dimension, double Usage, double DimensionBudget)
+	{
+		if (DimensionBudget > 0.0 && Usage / DimensionBudget > BottleneckLoad)
+		{
+			BottleneckLoad = Usage / DimensionBudget;
+			Bottleneck = Dimension;
+		}
+	};
+
+	ConsiderDimension(EWorkerLoadDimension::AuthoritativeEntities, AuthoritativeEntityCount, Budget.AuthoritativeEntities);
+	ConsiderDimension(EWorkerLoadDimension::OutgoingBytes, OutgoingBytesPerSecond, Budget.OutgoingBytesPerSecond);
+	ConsiderDimension(EWorkerLoadDimension::IncomingOps, IncomingOpsPerSecond, Budget.IncomingOpsPerSecond);
+	ConsiderDimension(EWorkerLoadDimension::Memory, MemoryUsedMB, Budget.MemoryUsedMB);
+
+	if (OutDimension != nullptr)
+	{
+		*OutDimension = Bottleneck;
+	}
+	return BottleneckLoad;
+}
+
+void FWorkerLoadVector::WriteToSchema(Schema_Object* Object) const
+{
+	Schema_AddDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_FRAME_TIME_LOAD_ID, FrameTimeLoad);
+	Schema_AddUint32(Object, SpatialConstants::WORKER_LOAD_VECTOR_AUTHORITATIVE_ENTITY_COUNT_ID, AuthoritativeEntityCount);
+	Schema_AddDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_OUTGOING_BYTES_PER_SECOND_ID, OutgoingBytesPerSecond);
+	Schema_AddDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_INCOMING_OPS_PER_SECOND_ID, IncomingOpsPerSecond);
+	Schema_AddDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_MEMORY_USED_MB_ID, MemoryUsedMB);
+}
+
+FWorkerLoadVector FWorkerLoadVector::ReadFromSchema(const Schema_Object* Object)
+{
+	FWorkerLoadVector LoadVector;
+	LoadVector.FrameTimeLoad = Schema_GetDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_FRAME_TIME_LOAD_ID);
+	LoadVector.AuthoritativeEntityCount = Schema_GetUint32(Object, SpatialConstants::WORKER_LOAD_VECTOR_AUTHORITATIVE_ENTITY_COUNT_ID);
+	LoadVector.OutgoingBytesPerSecond = Schema_GetDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_OUTGOING_BYTES_PER_SECOND_ID);
+	LoadVector.IncomingOpsPerSecond = Schema_GetDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_INCOMING_OPS_PER_SECOND_ID);
+	LoadVector.MemoryUsedMB = Schema_GetDouble(Object, SpatialConstants::WORKER_LOAD_VECTOR_MEMORY_USED_MB_ID);
+	return LoadVector;
+}
+
+const TCHAR* FWorkerLoadVector::GetDimensionName(EWorkerLoadDimension Dimension)
+{
+	switch (Dimension)
+	{
+	case EWorkerLoadDimension::FrameTime:
+		return TEXT("FrameTime");
+	case EWorkerLoadDimension::AuthoritativeEntities:
+		return TEXT("AuthoritativeEntities");
+	case EWorkerLoadDimension::OutgoingBytes:
+		return TEXT("OutgoingBytes");
+	case EWorkerLoadDimension::IncomingOps:
+		return TEXT("IncomingOps");
+	case EWorkerLoadDimension::Memory:
+		return TEXT("Memory");
+	default:
+		checkNoEntry();
+		return TEXT("");
+	}
+}
+
+} // namespace SpatialGDK
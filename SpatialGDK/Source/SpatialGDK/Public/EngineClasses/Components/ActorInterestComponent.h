@@ -25,6 +25,9 @@ public:
 
 	void PopulateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints) const;
 
+	// Drops the constraints built with bCacheActorInterestComponentQueries, for when Queries are changed at runtime.
+	void InvalidateCachedConstraints() { bHasCachedConstraints = false; CachedFrequencyToConstraints.Empty(); }
+
 	/**
 	 * Whether to use NetCullDistanceSquared to generate constraints relative to the Actor that this component is attached to.
 	 */
@@ -37,4 +40,10 @@ public:
 	UPROPERTY(BlueprintReadonly, EditDefaultsOnly, Category = "Interest")
 	TArray<FQueryData> Queries;
 
+private:
+	void CreateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints) const;
+
+	mutable SpatialGDK::FrequencyToConstraintsMap CachedFrequencyToConstraints;
+	mutable bool bHasCachedConstraints = false;
+
 };
@@ -5,12 +5,16 @@
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
 
+#include <WorkerSDK/improbable/c_worker.h>
+
 #include "SpatialPingComponent.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialPingComponent, Log, All);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRecordPing, float, Ping);
 
+class USpatialNetDriver;
+
 USTRUCT(BlueprintType)
 struct FSpatialPingAverageData
 {
@@ -107,9 +111,18 @@ private:
 	UPROPERTY()
 	APlayerController* OwningController;
 
+	// Set while pinging through the RPC endpoints of the owning controller's entity, see bUseEndpointPings.
+	TWeakObjectPtr<USpatialNetDriver> EndpointPingNetDriver;
+	Worker_EntityId EndpointPingEntityId = 0;
+	FDelegateHandle EndpointPingAckedHandle;
+
 	void EnablePing();
 	void DisablePing();
 
+	void StartEndpointPings();
+	void StopEndpointPings();
+	void OnEndpointPingIdAcked(Worker_EntityId EntityId, uint32 PingID);
+
 	void TickPingComponent();
 
 	void SendNewPing();
@@ -119,6 +132,8 @@ private:
 	UFUNCTION()
 	virtual void OnRep_ReplicatedPingID();
 
+	void OnPingReply(uint16 PingID);
+
 	UFUNCTION(Server, Unreliable, WithValidation)
 	virtual void SendServerWorkerPingID(uint16 PingID);
 
@@ -4,6 +4,7 @@
 
 #include "Engine/ActorChannel.h"
 
+#include "EngineClasses/SpatialFastArrayNetSerialize.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialClassInfoManager.h"
@@ -81,6 +82,52 @@ struct FPendingSubobjectAttachment
 	TSet<Worker_ComponentId> PendingAuthorityDelegations;
 };
 
+// The conditions FSpatialConditionMapFilter evaluated for a channel, one bit per ELifetimeCondition, and the flags they were evaluated from.
+struct FSpatialConditionMapCache
+{
+	static constexpr uint8 InvalidFlags = 0xFF;
+
+	uint8 Flags = InvalidFlags;
+	uint32 ConditionMap = 0;
+};
+
+// The compare of one replicator's properties, gathered on the game thread by USpatialActorChannel::GatherPropertyCompares.
+// Running it only touches that replicator's shadow state and changelist, so compares of different replicators can run in parallel.
+struct FSpatialPropertyCompare
+{
+	FRepLayout* RepLayout;
+	FSendingRepState* SendingRepState;
+	FReplicationChangelistMgr* ChangelistMgr;
+	UObject* Object;
+	FReplicationFlags RepFlags;
+	uint32 ReplicationFrame;
+	bool bForceCompareProperties;
+
+	void Run() const;
+};
+
+// Channel state only needed for actors with dynamic subobjects, handover properties or fast arrays.
+// It is allocated with the channel for other actors, and when first used for simple actors (see FClassInfo::bIsSimpleActor),
+// so that the channels of the many simple actors of large maps stay small.
+struct FSpatialActorChannelExtendedState
+{
+	TSet<TWeakObjectPtr<UObject>> PendingDynamicSubobjects;
+
+	// New dynamic subobjects found during ReplicateSubobjects, attached together at the end of the update.
+	TArray<TPair<TWeakObjectPtr<UObject>, const FClassInfo*>> BatchedDynamicSubobjects;
+
+	// Shadow data for Handover properties.
+	// For each object with handover properties, we store a blob of memory which contains
+	// the state of those properties at the last time we sent them, and is used to detect
+	// when those properties change.
+	// With bLazyHandoverShadowData, a blob is emptied while its actor is far from any boundary and
+	// an empty blob is reinitialized, and all its properties resent, the next time it is diffed.
+	TMap<TWeakObjectPtr<UObject>, TSharedRef<TArray<uint8>>> HandoverShadowDataMap;
+
+	// With bSkipUnchangedFastArrays, the replication key each fast array was last sent with.
+	SpatialGDK::FFastArrayReplicationKeys FastArrayReplicationKeys;
+};
+
 // Utility class to manage mapped and unresolved references.
 // Reproduces what is happening with FRepState::GuidReferencesMap, but with FUnrealObjectRef instead of FNetworkGUID
 class FSpatialObjectRepState
@@ -99,8 +146,12 @@ public:
 	TSet< FUnrealObjectRef > ReferencedObj;
 	TSet< FUnrealObjectRef > UnresolvedRefs;
 
+	// Inverted index from each referenced object to the top level ReferenceMap offsets holding it, rebuilt in UpdateRefToRepStateMap.
+	// Lets resolving or unmapping a reference visit only the properties depending on it.
+	TMap< FUnrealObjectRef, TArray<int32> > RefToReferenceMapOffsets;
+
 private:
-	bool MoveMappedObjectToUnmapped_r(const FUnrealObjectRef& ObjRef, FObjectReferencesMap& ObjectReferencesMap);
+	bool MoveMappedObjectToUnmapped_r(const FUnrealObjectRef& ObjRef, FObjectReferences& ObjReferences);
 	void GatherObjectRef(TSet<FUnrealObjectRef>& OutReferenced, TSet<FUnrealObjectRef>& OutUnresolved, const FObjectReferences& References) const;
 
 	FChannelObjectPair ThisObj;
@@ -190,7 +241,17 @@ public:
 	{
 		if (IsAuth && !bIsAuthServer)
 		{
-			AuthorityReceivedTimestamp = FPlatformTime::Cycles64();
+			RecordAuthorityMigration(FPlatformTime::Cycles64());
+			// Other servers may have sent different values while this one wasn't authoritative.
+			if (ExtendedState.IsValid())
+			{
+				ExtendedState->FastArrayReplicationKeys.Empty();
+			}
+			LastSentPropertyValues.Empty();
+		}
+		if (IsAuth != bIsAuthServer)
+		{
+			bAuthorityPreStaged = false;
 		}
 		bIsAuthServer = IsAuth;
 	}
@@ -200,6 +261,11 @@ public:
 		return bIsAuthServer;
 	}
 
+	// Number of times this server gained authority over the actor in quick succession, see AUTHORITY_MIGRATION_REPEAT_WINDOW_SECONDS.
+	uint32 GetRepeatedAuthorityMigrationCount() const { return RepeatedAuthorityMigrationCount; }
+	// Number of times this server gained authority over the actor since the channel was opened.
+	uint32 GetAuthorityMigrationCount() const { return AuthorityMigrationCount; }
+
 	FORCEINLINE FRepLayout& GetObjectRepLayout(UObject* Object)
 	{
 		check(ObjectHasReplicator(Object));
@@ -228,6 +294,14 @@ public:
 
 	bool ReplicateSubobject(UObject* Obj, const FReplicationFlags& RepFlags);
 
+	// Adds the compares which update the changelists of the actor and its existing subobjects for the current replication frame,
+	// so the following ReplicateActor call can reuse them. Must be called on the game thread, the compares can then run on any thread.
+	void GatherPropertyCompares(TArray<FSpatialPropertyCompare>& OutCompares);
+
+	// Stores the load balancing strategy's decision on whether this worker should have authority over the actor,
+	// evaluated for all actors at once by the net driver. It is used by the next ReplicateActor call in the same replication frame.
+	void SetPrecomputedShouldHaveAuthority(bool bShouldHaveAuthority);
+
 	TMap<UObject*, const FClassInfo*> GetHandoverSubobjects();
 
 	FRepChangeState CreateInitialRepChangeState(TWeakObjectPtr<UObject> Object);
@@ -244,15 +318,49 @@ public:
 	void RemoveRepNotifiesWithUnresolvedObjs(TArray<UProperty*>& RepNotifies, const FRepLayout& RepLayout, const FObjectReferencesMap& RefMap, UObject* Object);
 
 	void UpdateShadowData();
+
+	// Used on servers with bPreStageAuthorityHandover, for actors this worker is not authoritative over that are about to move to it.
+	// Creates the replicators and shadow buffers set up when gaining authority, and snapshots the handover properties received from
+	// the authoritative worker, so only those that change before the handover are sent again. Does nothing if already pre-staged.
+	void PreStageAuthority();
+	bool IsAuthorityPreStaged() const { return bAuthorityPreStaged; }
+
 	void UpdateSpatialPositionWithFrequencyCheck();
 	void UpdateSpatialPosition();
 
+	// PositionUpdateFrequency, or with bAdaptivePositionUpdateFrequency the frequency for the current speed of the actor and its distance to clients.
+	float GetPositionUpdateFrequency() const;
+	bool IsPositionUpdateDue() const;
+
+	// UpdateSpatialPosition split in two for USpatialSender::ProcessPositionUpdates, which checks the distance threshold for all channels at once.
+	// Returns false if this channel doesn't update the position of its actor, for example because a parent actor does it.
+	bool GetSpatialPositionForUpdate(FVector& OutPosition, FVector& OutLastPosition) const;
+	void CommitSpatialPositionUpdate(const FVector& NewPosition);
+
+	// Used by USpatialSender to register each channel for a batched position update at most once per tick. Returns false if already registered.
+	bool SetPendingPositionUpdate()
+	{
+		const bool bWasPending = bPendingPositionUpdate;
+		bPendingPositionUpdate = true;
+		return !bWasPending;
+	}
+	void ClearPendingPositionUpdate() { bPendingPositionUpdate = false; }
+
 	void ServerProcessOwnershipChange();
 	void ClientProcessOwnershipChange(bool bNewNetOwned);
 
 	FORCEINLINE void MarkInterestDirty() { bInterestDirty = true; }
 	FORCEINLINE bool GetInterestDirty() const { return bInterestDirty; }
 
+	// Push model: once enabled, property comparison is skipped for this channel until properties are marked dirty.
+	FORCEINLINE void SetPushModelEnabled(bool bEnabled) { bUsePushModel = bEnabled; bPushModelDirty = true; }
+	FORCEINLINE bool IsPushModelEnabled() const { return bUsePushModel; }
+	FORCEINLINE void MarkPropertiesDirty() { bPushModelDirty = true; }
+
+	FORCEINLINE SpatialGDK::FFastArrayReplicationKeys& GetFastArrayReplicationKeys() { return GetExtendedState().FastArrayReplicationKeys; }
+	FORCEINLINE FLastSentPropertyValues& GetLastSentPropertyValues() { return LastSentPropertyValues; }
+	FORCEINLINE FSpatialConditionMapCache& GetConditionMapCache() { return ConditionMapCache; }
+
 	bool IsListening() const;
 
 	// Call when a subobject is deleted to unmap its references and cleanup its cached informations.
@@ -260,6 +368,16 @@ public:
 
 	static void ResetShadowData(FRepLayout& RepLayout, FRepStateStaticBuffer& StaticBuffer, UObject* TargetObject);
 
+	FSpatialActorChannelExtendedState& GetExtendedState();
+
+	bool HasPendingDynamicSubobjects() const { return ExtendedState.IsValid() && ExtendedState->PendingDynamicSubobjects.Num() > 0; }
+	bool IsDynamicSubobjectPending(UObject* Object) const { return ExtendedState.IsValid() && ExtendedState->PendingDynamicSubobjects.Contains(Object); }
+	void RemovePendingDynamicSubobject(UObject* Object);
+
+	// Bytes used by the GDK's own shadow data for the channel: handover shadow data, last sent property values and object reference
+	// state, for the memory report. The engine's replicators are not included.
+	SIZE_T GetShadowDataAllocatedSize() const;
+
 protected:
 	// Begin UChannel interface
 	virtual bool CleanUp(const bool bForDestroy, EChannelCloseReason CloseReason) override;
@@ -267,6 +385,8 @@ protected:
 
 private:
 	void DynamicallyAttachSubobject(UObject* Object);
+	// Sends the subobjects queued by DynamicallyAttachSubobject this update when bBatchDynamicSubobjectAttachment is enabled.
+	void AttachBatchedSubobjects();
 
 	void RetireEntityIfAuthoritative();
 
@@ -274,6 +394,12 @@ private:
 
 	void InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object);
 	FHandoverChangeState GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object);
+	void ReleaseHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object);
+	// Copies the current handover values of the actor and its subobjects into their shadow data, without sending them.
+	void RefreshHandoverShadowData();
+
+	// With bLazyHandoverShadowData, handover properties are only tracked near load balancing boundaries or ahead of an authority change.
+	bool ShouldTrackHandoverData();
 
 	void GetLatestAuthorityChangeFromHierarchy(const AActor* HierarchyActor, uint64& OutTimestamp);
 
@@ -284,17 +410,21 @@ public:
 	// If this actor channel is responsible for creating a new entity, this will be set to true during initial replication.
 	bool bCreatingNewEntity;
 
-	TSet<TWeakObjectPtr<UObject>> PendingDynamicSubobjects;
-
 	TMap<TWeakObjectPtr<UObject>, FSpatialObjectRepState> ObjectReferenceMap;
 
 private:
 	Worker_EntityId EntityId;
 	bool bInterestDirty;
 
+	bool bUsePushModel;
+	bool bPushModelDirty;
+
 	bool bIsAuthServer;
 	bool bIsAuthClient;
 
+	// Reset whenever server authority changes.
+	bool bAuthorityPreStaged = false;
+
 	// Used on the client to track gaining/losing ownership.
 	bool bNetOwned;
 
@@ -318,19 +448,35 @@ private:
 
 	FVector LastPositionSinceUpdate;
 	float TimeWhenPositionLastUpdated;
+	bool bPendingPositionUpdate = false;
 
 	uint8 FramesTillDormancyAllowed = 0;
 
+	// Set through SetPrecomputedShouldHaveAuthority, only valid for the replication frame it was set in.
+	bool bPrecomputedShouldHaveAuthority = false;
+	bool bHasPrecomputedShouldHaveAuthority = false;
+	uint32 PrecomputedShouldHaveAuthorityFrame = 0;
+
+	bool ConsumeShouldHaveAuthority();
+
+	void RecordAuthorityMigration(uint64 Timestamp);
+
 	// This is incremented in ReplicateActor. It represents how many bytes are sent per call to ReplicateActor.
 	// ReplicationBytesWritten is reset back to 0 at the start of ReplicateActor.
 	uint32 ReplicationBytesWritten = 0;
 
-	// Shadow data for Handover properties.
-	// For each object with handover properties, we store a blob of memory which contains
-	// the state of those properties at the last time we sent them, and is used to detect
-	// when those properties change.
+	// Quick access to the shadow data of the actor's handover properties, in the extended state.
 	TArray<uint8>* ActorHandoverShadowData;
-	TMap<TWeakObjectPtr<UObject>, TSharedRef<TArray<uint8>>> HandoverShadowDataMap;
+
+	// Whether the actor's class has no subobjects, handover properties or RPCs, set in SetChannelActor.
+	bool bIsSimpleActor = false;
+	TUniquePtr<FSpatialActorChannelExtendedState> ExtendedState;
+
+	// With bDropUnchangedPropertyWrites, the value each small property was last sent with.
+	FLastSentPropertyValues LastSentPropertyValues;
+
+	// Rep conditions rarely change for a channel, so they're only evaluated again when ownership, role or physics replication changes.
+	FSpatialConditionMapCache ConditionMapCache;
 
 	// Band-aid until we get Actor Sets.
 	// Used on server-side workers only.
@@ -342,4 +488,7 @@ private:
 	// before the actor holding the position for all the hierarchy, it can immediately attempt to migrate back.
 	// Using this timestamp, we can back off attempting migrations for a while.
 	uint64 AuthorityReceivedTimestamp;
+
+	uint32 AuthorityMigrationCount = 0;
+	uint32 RepeatedAuthorityMigrationCount = 0;
 };
@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 
+#include "Engine/NetSerialization.h"
 #include "Utils/RepLayoutUtils.h"
 
+#include <WorkerSDK/improbable/c_schema.h>
+
 class FSpatialNetBitReader;
 class FSpatialNetBitWriter;
 class USpatialNetDriver;
@@ -40,10 +43,15 @@ struct FSpatialNetDeltaSerializeInfo : FNetDeltaSerializeInfo
 		bIsSpatialType = true;
 	}
 
+	static const FFastArraySerializer* GetFastArraySerializer(UObject* Object, int32 ArrayIndex, UProperty* ParentProperty);
+
 	static bool DeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct);
 	static bool DeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct);
 };
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS // TODO: UNR-2371 - Remove when we update our usage of FNetDeltaSerializeInfo
 
+// The ArrayReplicationKey each fast array of an actor channel was last written with, by object and schema field.
+using FFastArrayReplicationKeys = TMap<TPair<TWeakObjectPtr<UObject>, Schema_FieldId>, int32>;
+
 } // namespace SpatialGDK
@@ -7,6 +7,7 @@
 
 #include "SpatialGameInstance.generated.h"
 
+class USpatialClassInfoManager;
 class USpatialLatencyTracer;
 class USpatialConnectionManager;
 class UGlobalStateManager;
@@ -38,6 +39,7 @@ public:
 
 	//~ Begin UGameInstance Interface
 	virtual void Init() override;
+	virtual void NotifyPreClientTravel(const FString& PendingURL, ETravelType TravelType, bool bIsSeamlessTravel) override;
 	//~ End UGameInstance Interface
 
 	// The SpatiaConnectionManager must always be owned by the SpatialGameInstance and so must be created here to prevent TrimMemory from deleting it during Browse.
@@ -46,6 +48,18 @@ public:
 	// Destroying the SpatialConnectionManager disconnects us from SpatialOS.
 	void DestroySpatialConnectionManager();
 
+	// Keeps the connection of a client net driver which is about to travel, along with its ClassInfoManager, for the net driver of the next map
+	// to take over if it connects to the same host. Otherwise it's destroyed once the next map has loaded. Returns false if the connection
+	// can't be kept, in which case it's left to the current net driver. See bKeepClientConnectionAcrossTravel.
+	bool KeepSpatialConnectionForTravel(USpatialClassInfoManager* InClassInfoManager, const FURL& URL);
+
+	// Returns the ClassInfoManager kept with the connection if URL is for the same host, and destroys a kept connection otherwise.
+	USpatialClassInfoManager* TakeSpatialConnectionKeptForTravel(const FURL& URL);
+
+	// Keeps the map package preloaded for a server travel from being garbage collected until the next map has loaded. See bPreloadServerTravelMap.
+	void HoldServerTravelMapPackage(UPackage* Package) { ServerTravelMapPackage = Package; }
+	void ReleaseServerTravelMapPackage() { ServerTravelMapPackage = nullptr; }
+
 	FORCEINLINE USpatialConnectionManager* GetSpatialConnectionManager() { return SpatialConnectionManager; }
 	FORCEINLINE USpatialLatencyTracer* GetSpatialLatencyTracer() { return SpatialLatencyTracer; }
 	FORCEINLINE UGlobalStateManager* GetGlobalStateManager() { return GlobalStateManager; };
@@ -87,6 +101,18 @@ private:
 	bool bShouldConnectUsingCommandLineArgs = true;
 	bool bHasPreviouslyConnectedToSpatial = false;
 
+	// Set while a connection is kept between the net drivers of two maps, see KeepSpatialConnectionForTravel.
+	UPROPERTY()
+	USpatialClassInfoManager* ClassInfoManagerKeptForTravel = nullptr;
+	FString HostKeptForTravel;
+	bool bIsConnectionKeptForTravel = false;
+
+	// A failed connection can't be kept for the next map.
+	bool bHasSpatialNetworkFailure = false;
+
+	UPROPERTY()
+	UPackage* ServerTravelMapPackage = nullptr;
+
 	UPROPERTY()
 	USpatialLatencyTracer* SpatialLatencyTracer = nullptr;
 
@@ -111,6 +137,11 @@ private:
 	UFUNCTION()
 	void OnLevelInitializedNetworkActors(ULevel* LoadedLevel, UWorld* OwningWorld);
 
+	void OnPostLoadMap(UWorld* LoadedWorld);
+	void OnNetworkFailure(UWorld* FailedWorld, UNetDriver* FailedNetDriver, ENetworkFailure::Type FailureType, const FString& ErrorString);
+
+	static FString GetHostForTravel(const FURL& URL);
+
 	// Boolean for whether or not the Spatial connection is ready for normal operations.
 	bool bIsSpatialNetDriverReady;
 };
@@ -36,18 +36,41 @@ public:
 	void OnAclAuthorityChanged(const Worker_AuthorityChangeOp& AuthOp);
 
 	void MaybeQueueAclAssignmentRequest(const Worker_EntityId EntityId);
+	// Queues a request when the net owning client changes, even if this worker is meant to stay authoritative, so the client
+	// entries of the ACL are updated along with any other change to the entity this tick.
+	void QueueOwnershipAclAssignmentRequest(const Worker_EntityId EntityId);
 	// Visible for testing
 	bool AclAssignmentRequestIsQueued(const Worker_EntityId EntityId) const;
 
 	TArray<AclWriteAuthorityRequest> ProcessQueuedAclAssignmentRequests();
 
+	// Limits the number of requests returned by each ProcessQueuedAclAssignmentRequests call, 0 for no limit. When limited,
+	// requests for entities owned by a client are returned first and the rest stay queued, in order, for the next call.
+	void SetMaxAclAssignmentsPerTick(uint32 InMaxAclAssignmentsPerTick) { MaxAclAssignmentsPerTick = InMaxAclAssignmentsPerTick; }
+
+	int32 GetNumQueuedAclAssignmentRequests() const { return AclWriteAuthAssignmentRequests.Num(); }
+
 private:
 	void QueueAclAssignmentRequest(const Worker_EntityId EntityId);
+	void DequeueAclAssignmentRequest(const Worker_EntityId EntityId);
 	bool CanEnforce(Worker_EntityId EntityId) const;
+	// Entities can gain ACL authority on this worker before it sees a new server worker take over their virtual worker, such as
+	// when a standby takes over from a lost server worker. Every entity this worker enforces is checked again when the mapping changes.
+	void QueueRequestsForRemappedVirtualWorkers();
+	bool IsOwnedByClient(Worker_EntityId EntityId) const;
+
+	// Returns false if the request should stay queued and be retried on the next call.
+	bool ProcessAclAssignmentRequest(Worker_EntityId EntityId, TArray<AclWriteAuthorityRequest>& OutPendingRequests) const;
 
 	const PhysicalWorkerName WorkerId;
 	TWeakObjectPtr<const USpatialStaticComponentView> StaticComponentView;
 	const SpatialVirtualWorkerTranslator* VirtualWorkerTranslator;
 
+	// Queued requests in the order they were queued, and the same entity IDs for fast lookups.
 	TArray<Worker_EntityId> AclWriteAuthAssignmentRequests;
+	TSet<Worker_EntityId_Key> QueuedAclAssignmentEntities;
+
+	uint32 MaxAclAssignmentsPerTick = 0;
+
+	uint32 EnforcedMappingVersion = 0;
 };
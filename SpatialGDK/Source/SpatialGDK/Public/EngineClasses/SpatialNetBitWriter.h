@@ -24,3 +24,32 @@ public:
 protected:
 	void SerializeObjectRef(FUnrealObjectRef& ObjectRef);
 };
+
+// Per thread free list of writers, so serializing properties, fast arrays and RPCs reuses buffers that have already grown
+// instead of allocating a new one each time. Acquired writers are reset and bound to the given package map.
+class SPATIALGDK_API FSpatialNetBitWriterPool
+{
+public:
+	static TUniquePtr<FSpatialNetBitWriter> Acquire(USpatialPackageMapClient* InPackageMap);
+	static void Release(TUniquePtr<FSpatialNetBitWriter> Writer);
+
+	// Returns its writer to the pool when it goes out of scope.
+	class SPATIALGDK_API FScopedWriter
+	{
+	public:
+		explicit FScopedWriter(USpatialPackageMapClient* InPackageMap)
+			: Writer(Acquire(InPackageMap))
+		{}
+
+		~FScopedWriter() { Release(MoveTemp(Writer)); }
+
+		FScopedWriter(const FScopedWriter&) = delete;
+		FScopedWriter& operator=(const FScopedWriter&) = delete;
+
+		FSpatialNetBitWriter& operator*() const { return *Writer; }
+		FSpatialNetBitWriter* operator->() const { return Writer.Get(); }
+
+	private:
+		TUniquePtr<FSpatialNetBitWriter> Writer;
+	};
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Schema/Interest.h"
+#include "Utils/ClientBandwidthBudget.h"
+#include "Utils/LevelInterestActivationQueue.h"
 
 #include "CoreMinimal.h"
 #include "Misc/Optional.h"
@@ -15,6 +17,11 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialNetConnection, Log, All);
 
+namespace SpatialGDK
+{
+class FHeartbeatManager;
+}
+
 UCLASS(transient)
 class SPATIALGDK_API USpatialNetConnection : public UIpConnection
 {
@@ -59,6 +66,18 @@ public:
 
 	void ClientNotifyClientHasQuit();
 
+	// Called on the server with the throughput reported in a heartbeat event of the client, when the client has a bandwidth budget set.
+	void OnClientBandwidthReport(float ReceivedBytesPerSecond, float BudgetBytesPerSecond);
+
+	// Whether the level is visible on the client but not added to its interest yet, see ClientLevelInterestActivationIntervalSeconds.
+	bool IsLevelInterestPending(FName PackageName) const;
+
+	// The fraction of their frequency the client's net cull distance and user defined interest queries are sent at.
+	float GetInterestFrequencyScale() const { return BandwidthBudget.IsSet() ? BandwidthBudget->GetFrequencyScale() : 1.0f; }
+
+	// Returns the net driver's heartbeat manager when bAggregateServerHeartbeats is enabled on a server.
+	SpatialGDK::FHeartbeatManager* GetHeartbeatManager() const;
+
 	UPROPERTY()
 	bool bReliableSpatialConnection;
 
@@ -70,4 +89,22 @@ public:
 	// Player lifecycle
 	Worker_EntityId PlayerControllerEntity;
 	FTimerHandle HeartbeatTimer;
+
+private:
+	void AddBandwidthReport(Schema_Object* HeartbeatEventObject);
+
+	void OnLevelMadeVisible(FName PackageName);
+	void OnLevelMadeInvisible(FName PackageName);
+	void ActivateNextPendingLevelInterest();
+
+	// Only used on the server, the levels visible on the client which are waiting to be added to its interest.
+	SpatialGDK::FLevelInterestActivationQueue PendingLevelInterest;
+	FTimerHandle LevelInterestTimer;
+
+	// Only used on the server for client connections which reported their throughput.
+	TOptional<SpatialGDK::FClientBandwidthBudget> BandwidthBudget;
+
+	// Only used on the client, the dispatcher's received byte count when the last heartbeat event was sent.
+	uint64 LastReportedReceivedBytes = 0;
+	double LastReportTime = 0.0;
 };
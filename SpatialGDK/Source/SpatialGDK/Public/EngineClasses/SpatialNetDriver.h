@@ -6,11 +6,22 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslationManager.h"
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/ConnectionConfig.h"
+#include "Interop/CrossServerRPCService.h"
 #include "Interop/SpatialDispatcher.h"
 #include "Interop/SpatialOutputDevice.h"
+#include "Interop/RuntimeCheckpoints.h"
 #include "Interop/SpatialRPCService.h"
 #include "Interop/SpatialSnapshotManager.h"
+#include "Interop/StartupActorTombstones.h"
+#include "Utils/HeartbeatManager.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/ActorReplicationSchedule.h"
+#include "Utils/ClientObservationTracker.h"
+#include "Utils/HitchCapture.h"
+#include "Utils/HotEntityTracker.h"
+#include "Utils/ReplicationBudgetScheduler.h"
+#include "Utils/SpatialMemoryAccounting.h"
+#include "Utils/StartupTimeline.h"
 
 #include "LoadBalancing/AbstractLockingPolicy.h"
 #include "SpatialConstants.h"
@@ -42,6 +53,11 @@ class USpatialStaticComponentView;
 class USpatialWorkerConnection;
 class USpatialWorkerFlags;
 
+namespace SpatialGDK
+{
+class FAtomicHistogram;
+}
+
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialOSNetDriver, Log, All);
 
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Consider List Size"), STAT_SpatialConsiderList, STATGROUP_SpatialNet,);
@@ -77,11 +93,17 @@ public:
 	virtual void Shutdown() override;
 	virtual void NotifyActorFullyDormantForConnection(AActor* Actor, UNetConnection* NetConnection) override;
 	virtual void OnOwnerUpdated(AActor* Actor, AActor* OldOwner) override;
+	virtual void AddNetworkActor(AActor* Actor) override;
+	virtual void ForceNetUpdate(AActor* Actor) override;
 	// End UNetDriver interface.
 
 	void OnConnectionToSpatialOSSucceeded();
 	void OnConnectionToSpatialOSFailed(uint8_t ConnectionStatusCode, const FString& ErrorMessage);
 
+	// Called on a client before it travels to NextURL. Hands the connection to the game instance for the next map's net driver, so
+	// this net driver doesn't close it when it's destroyed. See bKeepClientConnectionAcrossTravel.
+	void KeepSpatialConnectionForTravel(const FURL& NextURL);
+
 #if !UE_BUILD_SHIPPING
 	bool HandleNetDumpCrossServerRPCCommand(const TCHAR* Cmd, FOutputDevice& Ar);
 #endif
@@ -111,6 +133,10 @@ public:
 
 	void RefreshActorDormancy(AActor* Actor, bool bMakeDormant);
 
+	// Makes the actor be considered for replication on the next tick when the actor replication schedule is in use.
+	// Must be called whenever an actor could have become due outside of its NextUpdateTime, e.g. it gained authority or was woken.
+	void ScheduleActorForReplication(AActor* Actor);
+
 	void AddPendingDormantChannel(USpatialActorChannel* Channel);
 	void RemovePendingDormantChannel(USpatialActorChannel* Channel);
 	void RegisterDormantEntityId(Worker_EntityId EntityId);
@@ -124,6 +150,13 @@ public:
 	TWeakObjectPtr<USpatialNetConnection> FindClientConnectionFromWorkerId(const FString& WorkerId);
 	void CleanUpClientConnection(USpatialNetConnection* ClientConnection);
 
+	// Client fast rejoin, see bEnableClientFastRejoin.
+	// Client: starts rejoining after losing the connection, unless it can't be recovered by connecting again. Returns whether it did.
+	bool TryBeginClientRejoin(uint8 ConnectionStatusCode, const FString& Reason);
+	void OnClientRejoinSpawnResponse(bool bRejoined);
+	// Server: hands the connection of the player controller PreviousWorkerId had to NewWorkerId, if this server owns it. Returns whether it did.
+	bool RejoinClientConnection(const FString& PreviousWorkerId, Worker_EntityId PlayerControllerEntityId, const FString& NewWorkerId);
+
 	UPROPERTY()
 	USpatialWorkerConnection* Connection;
 	UPROPERTY()
@@ -159,6 +192,39 @@ public:
 	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer;
 	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator;
 
+	// Only created on servers when a replication time or byte budget is set.
+	TUniquePtr<SpatialGDK::FReplicationBudgetScheduler> ReplicationBudgetScheduler;
+
+	// Only created on servers when bUseActorReplicationSchedule is enabled.
+	TUniquePtr<SpatialGDK::FActorReplicationSchedule> ActorReplicationSchedule;
+
+	// Only created on servers when bAggregateServerHeartbeats is enabled.
+	TUniquePtr<SpatialGDK::FHeartbeatManager> HeartbeatManager;
+
+	// Only created on servers when bThrottleUnobservedActors is enabled.
+	TUniquePtr<SpatialGDK::FClientObservationTracker> ClientObservationTracker;
+
+	// Only created when bEnableHitchCapture is enabled.
+	TUniquePtr<SpatialGDK::FHitchCapture> HitchCapture;
+
+	// Only created when bEnableHotEntityTracking is enabled. Recorded into by the sender and receiver.
+	TUniquePtr<SpatialGDK::FHotEntityTracker> HotEntityTracker;
+
+	// Only created on servers when bEnableRuntimeCheckpoints is enabled. Recorded into by the dispatcher and the connection.
+	TUniquePtr<SpatialGDK::FRuntimeCheckpointer> RuntimeCheckpointer;
+
+	// Only created on servers when bUseRingBufferCrossServerRPCs and RPC ring buffers are enabled.
+	TUniquePtr<SpatialGDK::CrossServerRPCService> CrossServerRPCService;
+
+	// Only created when bCompactStartupActorTombstones is enabled.
+	TUniquePtr<SpatialGDK::FStartupActorTombstones> StartupActorTombstones;
+
+	SpatialGDK::FStartupTimeline StartupTimeline;
+
+	// Sampled by SampleMemoryUsage, every MemoryAccountingSampleIntervalSeconds and for the SpatialMemoryReport console command.
+	SpatialGDK::FSpatialMemoryAccounting MemoryAccounting;
+	void SampleMemoryUsage();
+
 	Worker_EntityId WorkerEntityId = SpatialConstants::INVALID_ENTITY_ID;
 
 	// If this worker is authoritative over the translation, the manager will be instantiated.
@@ -196,6 +262,11 @@ private:
 
 	TMap<Worker_EntityId_Key, USpatialActorChannel*> EntityToActorChannel;
 	TArray<Worker_OpList*> QueuedStartupOpLists;
+
+	// The view of a connection taken over from the previous map, delivered as ops before the queued startup ops.
+	bool bTookSpatialConnectionKeptForTravel = false;
+	TArray<Worker_Op> KeptViewOps;
+	TArray<SpatialGDK::ComponentData> KeptViewComponentData;
 	TSet<Worker_EntityId_Key> DormantEntities;
 	TSet<TWeakObjectPtr<USpatialActorChannel>> PendingDormantChannels;
 
@@ -219,6 +290,7 @@ private:
 	class USpatialGameInstance* GetGameInstance() const;
 
 	void InitiateConnectionToSpatialOS(const FURL& URL);
+	bool ShouldWaitForLocalDeployment() const;
 
 	void InitializeSpatialOutputDevice();
 	void CreateAndInitializeCoreClasses();
@@ -232,7 +304,7 @@ private:
 	void HandleStartupOpQueueing(const TArray<Worker_OpList*>& InOpLists);
 	bool FindAndDispatchStartupOpsServer(const TArray<Worker_OpList*>& InOpLists);
 	bool FindAndDispatchStartupOpsClient(const TArray<Worker_OpList*>& InOpLists);
-	void SelectiveProcessOps(TArray<Worker_Op*> FoundOps);
+	void SelectiveProcessOps(const TArray<Worker_Op*>& FoundOps);
 
 	UFUNCTION()
 	void OnMapLoaded(UWorld* LoadedWorld);
@@ -240,15 +312,26 @@ private:
 	UFUNCTION()
 	void OnLevelAddedToWorld(ULevel* LoadedLevel, UWorld* OwningWorld);
 
+	UFUNCTION()
+	void OnLevelRemovedFromWorld(ULevel* RemovedLevel, UWorld* OwningWorld);
+
 	void OnActorSpawned(AActor* Actor);
 
 	static void SpatialProcessServerTravel(const FString& URL, bool bAbsolute, AGameModeBase* GameMode);
+	static void PreloadServerTravelMap(UWorld* World, const FString& MapName);
 
 #if WITH_SERVER_CODE
 	// SpatialGDK: These functions all exist in UNetDriver, but we need to modify/simplify them in certain ways.
 	// Could have marked them virtual in base class but that's a pointless source change as these functions are not meant to be called from anywhere except USpatialNetDriver::ServerReplicateActors.
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors);
+	// Builds the same consider list as ServerReplicateActors_BuildConsiderList, from the actors due in the actor replication schedule.
+	void ServerReplicateActors_BuildScheduledConsiderList(TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime);
+	void ServerReplicateActors_RescheduleConsideredActors(const TArray<TWeakObjectPtr<AActor>>& ConsideredActors);
+	// Sorts the entries of the priority list which can be processed under the rate limits to its front, see ServerReplicateActors_PrioritizeActors.
+	void SortPrioritizedActors(FActorPriority** PriorityActors, const int32 FinalSortedCount) const;
+	void ServerReplicateActors_ParallelCompareProperties(FActorPriority** PriorityActors, const int32 FinalSortedCount, const int32 MaxActorsToReplicate);
+	void ServerReplicateActors_EvaluateAuthority(FActorPriority** PriorityActors, const int32 FinalSortedCount, const int32 MaxActorsToReplicate);
 	void ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated);
 #endif
 
@@ -256,7 +339,23 @@ private:
 	bool CreateSpatialNetConnection(const FURL& InUrl, const FUniqueNetIdRepl& UniqueId, const FName& OnlinePlatformName, USpatialNetConnection** OutConn);
 
 	void ProcessPendingDormancy();
+	void TickWorkerLoadReports();
+	void TickServerWorkerHeartbeat();
+	void TickClientObservation();
+	void TickHitchCapture();
+	void TickHotEntities();
+	void UpdateHotEntityThrottling(const TSet<Worker_EntityId_Key>& EntitiesSendingTooManyUpdates);
+	void OnClientViewPositionsQueryResponse(const Worker_EntityQueryResponseOp& Op);
+	void UpdateUnobservedActors();
+	bool IsActorObserved(const AActor& Actor) const;
+	bool IsActorUnobservedWithEntity(AActor* Actor) const;
+	void TickClientRejoin();
+	void FailClientRejoin();
+	void PreStageAuthorityHandover();
+	void SweepHeartbeats();
 	void PollPendingLoads();
+	// Processes the op lists in OpBacklog within the budget of bTimeSliceOpProcessing. Returns the number of ops processed.
+	uint32 ProcessOpBacklog();
 
 	// This index is incremented and assigned to every new RPC in ProcessRemoteFunction.
 	// The SpatialSender uses these indexes to retry any failed reliable RPCs
@@ -264,12 +363,54 @@ private:
 	int NextRPCIndex;
 
 	float TimeWhenPositionLastUpdated;
+	float TimeWhenMemoryLastSampled = 0.f;
+	float TimeWhenWorkerLoadLastReported;
+	float TimeWhenAuthorityLastPreStaged;
+	float TimeWhenServerWorkerHeartbeatLastSent;
+	uint64 ServerWorkerHeartbeat;
+
+	// Actors authoritative here which no client observes, with the tick interval they had before they were throttled.
+	TMap<TWeakObjectPtr<AActor>, float> UnobservedActors;
+	float TimeWhenClientObservationLastUpdated = 0.f;
+	bool bClientViewPositionsQueryInFlight = false;
+	// Actors are only throttled once the view positions of the other server workers are known.
+	bool bReceivedRemoteClientViewPositions = false;
+
+	// Entities above one of the hot entity thresholds at the last check, so each is only logged when it becomes hot.
+	TSet<Worker_EntityId_Key> HotEntities;
+	struct FHotActorThrottle
+	{
+		float NetUpdateFrequency;
+		float ThrottledUntil;
+	};
+	// Actors whose NetUpdateFrequency was lowered by bThrottleHotEntities, with the frequency they had before.
+	TMap<TWeakObjectPtr<AActor>, FHotActorThrottle> ThrottledHotActors;
+	float TimeWhenHotEntitiesLastChecked = 0.f;
+
+	// Client fast rejoin. While waiting for the connection, ops aren't processed. Once connected, the rejoin is reconciled after the
+	// spawn response, once entities have stopped being checked out again.
+	bool bWaitingForClientRejoinConnection = false;
+	bool bClientRejoinConnectionInFlight = false;
+	bool bReconcilingClientRejoin = false;
+	double ClientRejoinDeadline = 0.0;
+	double NextClientRejoinAttemptTime = 0.0;
+	double ClientRejoinSpawnResponseTime = 0.0;
+	uint8 ClientRejoinFailureStatusCode = 0;
+	FString ClientRejoinFailureReason;
 
 	// Counter for giving each connected client a unique IP address to satisfy Unreal's requirement of
 	// each client having a unique IP address in the UNetDriver::MappedClientConnections map.
 	// The GDK does not use this address for any networked purpose, only bookkeeping.
 	uint32 UniqueClientIpAddressCounter = 0;
 
+	// Only set when bEnableMetrics is enabled, owned by SpatialMetrics.
+	SpatialGDK::FAtomicHistogram* OpsPerTickHistogram = nullptr;
+	SpatialGDK::FAtomicHistogram* AclAssignmentsPerTickHistogram = nullptr;
+
+	// Received op lists which haven't been fully processed when bTimeSliceOpProcessing is set, and the next op to process in the first.
+	TArray<Worker_OpList*> OpBacklog;
+	uint32 OpBacklogIndex = 0;
+
 	FDelegateHandle SpatialDeploymentStartHandle;
 
 #if !UE_BUILD_SHIPPING
@@ -284,6 +425,22 @@ private:
 	void MakePlayerSpawnRequest();
 
 	FUnrealObjectRef GetCurrentPlayerControllerRef();
+	FString GetEntityClassName(Worker_EntityId EntityId);
+	uint32 GetAuthoritativeEntityCount();
+
+	double GetOldestUnreplicatedActorAge() const;
+	double GetEntityCreationLimit() const;
+	double GetNumQueuedAclAssignments() const;
+	double GetOpBacklogSize() const;
+	double GetNumHotEntities() const { return HotEntities.Num(); }
+
+	void RegisterOverflowedRPCMetrics();
+	double GetOverflowedRPCQueueDepth(ERPCType Type) const;
+	double GetOldestOverflowedRPCAge(ERPCType Type) const;
+	double GetDroppedRPCCount(ERPCType Type) const;
+	double GetExpiredRPCCount() const;
+	double GetDesiredServerWorkerCount() const;
+	double GetMaxClientInterestQueryCount() const;
 
 	// Checks the GSM is acceptingPlayers and that the SessionId on the GSM matches the SessionId on the net-driver.
 	// The SessionId on the net-driver is set by looking at the sessionId option in the URL sent to the client for ServerTravel.
@@ -5,6 +5,7 @@
 #include "Engine/PackageMapClient.h"
 #include "Schema/UnrealMetadata.h"
 #include "Schema/UnrealObjectRef.h"
+#include "Utils/EntityObjectRefTable.h"
 #include "Utils/EntityPool.h"
 
 #include "CoreMinimal.h"
@@ -19,6 +20,13 @@ class USpatialNetDriver;
 class UEntityPool;
 class FTimerManager;
 
+// An FUnrealObjectRef as written by FSpatialNetBitWriter.
+struct FSerializedObjectRef
+{
+	TArray<uint8> Data;
+	int64 NumBits;
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialPackageMapClient : public UPackageMapClient
 {
@@ -70,6 +78,15 @@ public:
 	// Pending object references, being asynchronously loaded.
 	TSet<FNetworkGUID> PendingReferences;
 
+	// Path refs of stably named objects outside of any actor, such as meshes, materials and data assets, don't change while the object
+	// is loaded, so FSpatialNetBitWriter caches their serialized form rather than resolving them each time they're written.
+	const FSerializedObjectRef* FindSerializedStaticObjectRef(const UObject* Object) const;
+	void AddSerializedStaticObjectRef(const UObject* Object, FSerializedObjectRef&& SerializedRef);
+	static bool CanCacheSerializedObjectRef(const UObject* Object, const FUnrealObjectRef& ObjectRef);
+
+	// Called when a level is removed from the world, as objects in it may be reloaded under the same path with different refs.
+	void ClearSerializedStaticObjectRefs() { SerializedStaticObjectRefs.Empty(); }
+
 private:
 	UPROPERTY()
 	UEntityPool* EntityPool;
@@ -78,6 +95,9 @@ private:
 
 	// Entities that have been assigned on this server and not created yet
 	TSet<Worker_EntityId_Key> PendingCreationEntityIds;
+
+	// Weak keys, so an entry for a garbage collected object is never returned for a new object at the same address.
+	TMap<TWeakObjectPtr<const UObject>, FSerializedObjectRef> SerializedStaticObjectRefs;
 };
 
 class SPATIALGDK_API FSpatialNetGUIDCache : public FNetGUIDCache
@@ -103,6 +123,9 @@ public:
 	// to undo the unintended registering of objects when looking them up with static paths.
 	void UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef);
 
+	// Bytes used by the engine's NetGUID lookups and the maps between NetGUIDs and object refs, for the memory report.
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	FNetworkGUID GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef);
 
@@ -112,7 +135,15 @@ private:
 	FNetworkGUID RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient);
 	FNetworkGUID GenerateNewNetGUID(const int32 IsStatic);
 
+	// Refs made of only an entity ID and offset live in EntityObjectRefToNetGUID, refs with a path or outer in UnrealObjectRefToNetGUID.
+	static bool IsEntityObjectRef(const FUnrealObjectRef& ObjectRef);
+	FNetworkGUID* FindNetGUID(const FUnrealObjectRef& ObjectRef);
+	const FNetworkGUID* FindNetGUID(const FUnrealObjectRef& ObjectRef) const;
+	void AddNetGUID(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID);
+	void RemoveNetGUID(const FUnrealObjectRef& ObjectRef);
+
 	TMap<FNetworkGUID, FUnrealObjectRef> NetGUIDToUnrealObjectRef;
 	TMap<FUnrealObjectRef, FNetworkGUID> UnrealObjectRefToNetGUID;
+	SpatialGDK::FEntityObjectRefTable EntityObjectRefToNetGUID;
 };
 
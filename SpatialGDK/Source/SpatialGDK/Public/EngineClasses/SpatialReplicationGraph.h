@@ -9,7 +9,82 @@
 class UActorChannel;
 class UObject;
 
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialReplicationGraph, Log, All);
+
+// Buckets actors into a 2D grid of cells covering each actor's NetCullDistanceSquared, the same distance NetCullDistanceInterest
+// checks out actors for clients with, and gathers the actors in the cells of every client viewer.
+// The GDK replicates all actors through a single SpatialOS connection that has no view location of its own, so the viewers are
+// borrowed from the client connections, like USpatialNetDriver::ServerReplicateActors does, and from the clients of the other
+// server workers, which can check out actors this server is authoritative over.
 UCLASS(Transient)
+class SPATIALGDK_API USpatialReplicationGraphNode_InterestGrid : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	USpatialReplicationGraphNode_InterestGrid();
+
+	//~ Begin UReplicationGraphNode Interface
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	//~ End UReplicationGraphNode Interface
+
+	void SetViewerLocations(TArray<FVector>&& InViewerLocations) { ViewerLocations = MoveTemp(InViewerLocations); }
+
+	bool IsGathered(const AActor* Actor) const { return GatheredActorSet.Contains(const_cast<AActor*>(Actor)); }
+
+	// Size of a grid cell in Unreal units.
+	float CellSize = 10000.0f;
+
+	// Actors whose NetCullDistanceSquared spans more cells than this along an axis are gathered for every viewer instead.
+	int32 MaxCellsPerAxis = 32;
+
+	// Actors out of range of every viewer are still gathered once every this many frames, so their state still reaches SpatialOS.
+	// A slice of the actors is gathered each frame rather than all of them on the same frame. 0 never gathers them.
+	uint32 OutOfRangeReplicationPeriodFrames = 30;
+
+private:
+	struct FActorCells
+	{
+		FIntRect Cells;
+		bool bStatic;
+		bool bUnbounded;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	bool GetCellsForActor(const AActor& Actor, FIntRect& OutCells) const;
+
+	void AddActorToCells(AActor* Actor, const FIntRect& InCells);
+	void RemoveActorFromCells(AActor* Actor, const FIntRect& InCells);
+
+	void GatherActorList(const FActorRepListRefView& ActorList);
+	void GatherOutOfRangeSlice();
+
+	TMap<FIntPoint, FActorRepListRefView> Cells;
+	TMap<FActorRepListType, FActorCells> ActorToCells;
+
+	// Actors gathered for every viewer, because their cull distance covers too many cells.
+	FActorRepListRefView UnboundedActors;
+	FActorRepListRefView AllActors;
+
+	TArray<FVector> ViewerLocations;
+
+	// Rebuilt once per frame in PrepareForReplication, as the GDK only has a single connection to gather for.
+	FActorRepListRefView GatheredActors;
+	TSet<FActorRepListType> GatheredActorSet;
+
+	// Index into AllActors of the next actor to gather out of range.
+	int32 NextOutOfRangeActorIndex = 0;
+};
+
+// Replication graph for the GDK. Actors are routed either to an AlwaysRelevant list, or to a USpatialReplicationGraphNode_InterestGrid
+// so the cost of considering actors each frame is proportional to the actors near the clients on this server rather than to the whole world.
+// Dormancy is tracked per connection by UReplicationGraph, USpatialNetDriver notifies it when a channel closes for dormancy.
+// Enable it by setting ReplicationDriverClassName to this class under [/Script/SpatialGDK.SpatialNetDriver] in DefaultEngine.ini.
+UCLASS(Transient, Config = Engine)
 class SPATIALGDK_API USpatialReplicationGraph : public UReplicationGraph
 {
 	GENERATED_BODY()
@@ -18,6 +93,32 @@ public:
 
 	//~ Begin UReplicationGraph Interface
 	virtual UActorChannel* GetOrCreateSpatialActorChannel(UObject* TargetObject) override;
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
 	//~ End UReplicationGraph Interface
 
+	UPROPERTY(Config)
+	float GridCellSize = 10000.0f;
+
+	UPROPERTY(Config)
+	int32 GridMaxCellsPerAxis = 32;
+
+	UPROPERTY(Config)
+	uint32 OutOfRangeReplicationPeriodFrames = 30;
+
+protected:
+	virtual bool IsAlwaysRelevant(const AActor& Actor) const;
+
+private:
+	void InitClassReplicationInfo(UClass* Class);
+	TArray<FVector> GatherViewerLocations() const;
+
+	UPROPERTY()
+	USpatialReplicationGraphNode_InterestGrid* InterestGridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
 };
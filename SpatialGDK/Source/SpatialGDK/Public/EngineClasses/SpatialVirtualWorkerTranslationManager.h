@@ -2,9 +2,9 @@
 
 #pragma once
 
-#include "Containers/Queue.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialConstants.h"
+#include "Utils/WorkerLoadVector.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 #include <WorkerSDK/improbable/c_schema.h>
@@ -13,7 +13,10 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialVirtualWorkerTranslationManager, Log, All)
 
+DECLARE_DELEGATE(FOnLoadBalancingRegionsChanged);
+
 class SpatialVirtualWorkerTranslator;
+class UAbstractLBStrategy;
 class SpatialOSDispatcherInterface;
 class SpatialOSWorkerInterface;
 
@@ -26,6 +29,16 @@ class SpatialOSWorkerInterface;
 // One UnrealWorker is arbitrarily chosen by SpatialOS to be authoritative for the Translation
 // entity. This class will execute on that worker and will be idle on all other workers.
 //
+// The mapping is published once every virtual worker the strategy requires to start has been
+// assigned. For strategies which require load reports, server workers joining later are assigned
+// to the remaining virtual workers, and the virtual workers of server workers which left are
+// unassigned so a new server worker can take them over.
+//
+// With server worker failover enabled, server workers which aren't needed for a virtual worker are made standbys of the
+// assigned virtual workers, and keep interest on their regions. The manager keeps querying for server workers, and when one
+// is lost, because its entity is gone or it stopped updating its heartbeat, its virtual worker is handed to its standby.
+// The standby already has the region's entities checked out, so taking over only moves authority.
+//
 // This class is currently implemented in the UnrealWorker, but none of the logic must be in
 // Unreal. It could be moved to an independent worker in the future in cloud deployments. It
 // lives here now for convenience and for fast iteration on local deployments.
@@ -43,17 +56,53 @@ public:
 	// The translation manager only cares about changes to the authority of the translation mapping.
 	void AuthorityChanged(const Worker_AuthorityChangeOp& AuthChangeOp);
 
+	// Strategies which require load reports are given the load of every virtual worker each time
+	// QueryForServerWorkerLoads is answered, and the mapping is republished when their regions change.
+	void SetLoadBalanceStrategy(UAbstractLBStrategy* InLoadBalanceStrategy);
+	void QueryForServerWorkerLoads();
+
+	// The load vector last reported by the server worker of the virtual worker, or nullptr if it doesn't report one.
+	const SpatialGDK::FWorkerLoadVector* GetWorkerLoadVector(VirtualWorkerId WorkerId) const { return WorkerLoadVectors.Find(WorkerId); }
+
+	// Server workers are considered lost once their heartbeat hasn't changed for HeartbeatTimeout seconds.
+	void EnableServerWorkerFailover(float HeartbeatTimeout);
+	void QueryForLostServerWorkers();
+
+	FOnLoadBalancingRegionsChanged OnRegionsChanged;
+
 private:
 	SpatialOSDispatcherInterface* Receiver;
 	SpatialOSWorkerInterface* Connection;
 
 	SpatialVirtualWorkerTranslator* Translator;
 
+	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
+
 	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToPhysicalWorkerMapping;
 	TMap<PhysicalWorkerName, VirtualWorkerId> PhysicalToVirtualWorkerMapping;
-	TQueue<VirtualWorkerId> UnassignedVirtualWorkers;
+	// Kept sorted, so virtual workers are assigned in order, after the ones required to start.
+	TArray<VirtualWorkerId> UnassignedVirtualWorkers;
+
+	// At most one standby per assigned virtual worker.
+	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToStandbyWorkerMapping;
+	TMap<PhysicalWorkerName, VirtualWorkerId> StandbyToVirtualWorkerMapping;
+
+	struct FServerWorkerHeartbeat
+	{
+		uint64 Heartbeat;
+		double LastChangedTime;
+	};
+	TMap<PhysicalWorkerName, FServerWorkerHeartbeat> ServerWorkerHeartbeats;
+
+	TMap<VirtualWorkerId, SpatialGDK::FWorkerLoadVector> WorkerLoadVectors;
+
+	bool bServerWorkerFailoverEnabled;
+	float ServerWorkerHeartbeatTimeout;
 
 	bool bWorkerEntityQueryInFlight;
+	bool bMappingPublished;
+	// Set when a worker is assigned, so updates sent only because load balancing regions moved leave the mapping out.
+	bool bMappingDirty;
 
 	// Serialization and deserialization of the mapping.
 	void WriteMappingToSchema(Schema_Object* Object) const;
@@ -62,9 +111,21 @@ private:
 	// based on the response.
 	void QueryForServerWorkerEntities();
 	void ServerWorkerEntityQueryDelegate(const Worker_EntityQueryResponseOp& Op);
-	void ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op);
+	// Workers not in LiveWorkers, when given, are skipped.
+	void ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op, const TSet<PhysicalWorkerName>* LiveWorkers = nullptr);
+	void RebalanceFromQueryResponse(const Worker_EntityQueryResponseOp& Op);
+	void UpdateServerWorkersFromQueryResponse(const Worker_EntityQueryResponseOp& Op);
+	// Returns false if the server worker's heartbeat hasn't changed for longer than the timeout.
+	bool UpdateServerWorkerHeartbeat(const PhysicalWorkerName& Name, uint64 Heartbeat, double Now, TMap<PhysicalWorkerName, FServerWorkerHeartbeat>& OutHeartbeats) const;
 	void SendVirtualWorkerMappingUpdate();
 
 	void AssignWorker(const PhysicalWorkerName& WorkerId, const Worker_EntityId& ServerWorkerEntityId);
+	void UnassignWorker(const PhysicalWorkerName& WorkerId);
+	// Returns true if the worker's virtual worker had a standby, which now has it.
+	bool ReplaceWithStandby(const PhysicalWorkerName& WorkerId);
+	void AssignStandbyWorker(const PhysicalWorkerName& WorkerId, const Worker_EntityId& ServerWorkerEntityId);
+	void UnassignStandbyWorker(const PhysicalWorkerName& WorkerId);
+	bool IsRequiredToStart(VirtualWorkerId Id) const;
+	bool HasUnassignedRequiredWorkers() const;
 };
 
@@ -23,10 +23,12 @@ public:
 		PhysicalWorkerName InPhysicalWorkerName);
 
 	// Returns true if the Translator has received the information needed to map virtual workers to physical workers.
-	// Currently that is only the number of virtual workers desired.
+	// Currently that is only the number of virtual workers desired. Standby workers are ready before they have a virtual worker.
 	bool IsReady() const { return bIsReady; }
 
 	VirtualWorkerId GetLocalVirtualWorkerId() const { return LocalVirtualWorkerId; }
+	// The virtual worker this worker takes over if its server worker is lost, while this worker doesn't have one of its own.
+	VirtualWorkerId GetLocalStandbyVirtualWorkerId() const { return LocalStandbyVirtualWorkerId; }
 	PhysicalWorkerName GetLocalPhysicalWorkerName() const { return LocalPhysicalWorkerName; }
 
 	// Returns the name of the worker currently assigned to VirtualWorkerId id or nullptr if there is
@@ -36,23 +38,47 @@ public:
 	const PhysicalWorkerName* GetPhysicalWorkerForVirtualWorker(VirtualWorkerId Id) const;
 	Worker_EntityId GetServerWorkerEntityForVirtualWorker(VirtualWorkerId Id) const;
 
-	// On receiving a version of the translation state, apply that to the internal mapping.
-	void ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject);
+	// Incremented every time a virtual worker is assigned to a different server worker.
+	uint32 GetMappingVersion() const { return MappingVersion; }
+
+	// On receiving a version of the translation state, apply that to the internal mapping and pass any load balancing
+	// regions on to the strategy. Returns true if the strategy's regions or the local standby virtual worker changed. Updates
+	// without any mapping entries, such as those only moving load balancing regions, leave the current mapping in place.
+	bool ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject);
 
 private:
+	struct FVirtualWorkerMapping
+	{
+		PhysicalWorkerName Name;
+		Worker_EntityId ServerWorkerEntityId = SpatialConstants::INVALID_ENTITY_ID;
+		bool bAssigned = false;
+
+		bool operator==(const FVirtualWorkerMapping& Other) const
+		{
+			return bAssigned == Other.bAssigned && ServerWorkerEntityId == Other.ServerWorkerEntityId && Name == Other.Name;
+		}
+	};
+
 	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
 
-	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToPhysicalWorkerMapping;
+	// Indexed by VirtualWorkerId. Virtual worker IDs are assigned contiguously from 1, so lookups don't need to hash.
+	TArray<FVirtualWorkerMapping> VirtualToPhysicalWorkerMapping;
 
 	bool bIsReady;
+	uint32 MappingVersion = 0;
 
 	// The WorkerId of this worker, for logging purposes.
 	PhysicalWorkerName LocalPhysicalWorkerName;
 	VirtualWorkerId LocalVirtualWorkerId;
+	VirtualWorkerId LocalStandbyVirtualWorkerId;
 
-	// Serialization and deserialization of the mapping.
-	void ApplyMappingFromSchema(Schema_Object* Object);
+	// Serialization and deserialization of the mapping. Returns the number of virtual workers whose mapping changed.
+	int32 ApplyMappingFromSchema(Schema_Object* Object);
+	// Returns true if the local standby virtual worker changed.
+	bool ApplyStandbyMappingFromSchema(Schema_Object* Object);
 	bool IsValidMapping(Schema_Object* Object) const;
 
-	void UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId);
+	void UpdateLocalVirtualWorkerId(VirtualWorkerId Id, const PhysicalWorkerName& Name);
+	// Called when the mapping no longer assigns the local virtual worker to this worker.
+	void ClearLocalVirtualWorkerId();
 };
@@ -53,6 +53,18 @@ struct FConnectionConfig
 			WorkerId = WorkerType + FGuid::NewGuid().ToString();
 		}
 
+		if (const FSpatialNetworkTransportProfile* Profile = SpatialGDKSettings->GetNetworkTransportProfile(WorkerType, NetworkTransportProfileName))
+		{
+			NetworkTransportProfile = *Profile;
+			TcpNoDelay = (Profile->bTcpNoDelay ? 1 : 0);
+			// ClampMax only applies in the editor, values read from config files are clamped here.
+			TcpMultiplexLevel = static_cast<uint8>(FMath::Clamp<uint32>(Profile->TcpMultiplexLevel, 1, MAX_uint8));
+			UdpUpstreamIntervalMS = static_cast<uint8>(FMath::Min<uint32>(Profile->KcpUpstreamFlushIntervalMillis, MAX_uint8));
+			UdpDownstreamIntervalMS = static_cast<uint8>(FMath::Min<uint32>(Profile->KcpDownstreamFlushIntervalMillis, MAX_uint8));
+			UE_LOG(LogTemp, Log, TEXT("Connecting with network transport profile %s"), *NetworkTransportProfileName.ToString());
+			return;
+		}
+
 		TcpNoDelay = (SpatialGDKSettings->bTcpNoDelay ? 1 : 0);
 
 		UdpUpstreamIntervalMS = 10; // Despite flushing on the worker ops thread, WorkerSDK still needs to send periodic data (like ACK, resends and ping).
@@ -119,6 +131,9 @@ public:
 	uint8 TcpNoDelay;
 	uint8 UdpUpstreamIntervalMS;
 	uint8 UdpDownstreamIntervalMS;
+	// Set by PreConnectInit if the worker type connects with a network transport profile, which takes over the settings above.
+	TOptional<FSpatialNetworkTransportProfile> NetworkTransportProfile;
+	FName NetworkTransportProfileName;
 };
 
 class FLocatorConfig : public FConnectionConfig
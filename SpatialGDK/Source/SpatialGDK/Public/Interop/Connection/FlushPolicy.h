@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialGDKSettings.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+enum class EFlushTraffic : uint8
+{
+	RPC,
+	PropertyUpdate,
+	Count
+};
+
+/**
+ * Decides when outgoing messages queued on the worker connection should be flushed, based on a separate FSpatialFlushRule for RPCs
+ * and for property updates. A flush sends everything queued so far, whichever traffic triggered it.
+ * Deadlines are only checked when messages are queued and at the end of each tick.
+ */
+class SPATIALGDK_API FFlushPolicy
+{
+public:
+	FFlushPolicy(const FSpatialFlushRule& RPCRule, const FSpatialFlushRule& PropertyUpdateRule);
+
+	static EFlushTraffic GetTraffic(Worker_ComponentId ComponentId);
+
+	// Records a message queued for sending. Returns true if the queued messages should be flushed now.
+	bool OnMessageQueued(EFlushTraffic Traffic, uint32 NumBytes, double Now);
+
+	// Returns true if the queued messages should be flushed at the end of this tick.
+	bool ShouldFlushAtEndOfTick(double Now) const;
+
+	// Tells the policy that everything queued so far has been flushed.
+	void OnFlushed();
+
+	// The shortest deadline across both rules in seconds, or 0 if neither sets one.
+	double GetShortestDeadline() const;
+
+private:
+	struct FTrafficState
+	{
+		FSpatialFlushRule Rule;
+		uint64 QueuedBytes = 0;
+		double OldestQueuedTime = 0.0;
+		bool bHasQueuedMessages = false;
+	};
+
+	static bool IsDeadlineReached(const FTrafficState& State, double Now);
+
+	FTrafficState Traffic[static_cast<uint8>(EFlushTraffic::Count)];
+};
+
+} // namespace SpatialGDK
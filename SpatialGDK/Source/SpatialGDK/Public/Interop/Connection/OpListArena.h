@@ -0,0 +1,86 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Containers/Array.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Accumulates the ops of every Worker_OpList received within a tick into a single contiguous array.
+ * The Worker_Op structs are copied shallowly, so the source op lists are kept alive (and own all schema data
+ * referenced by the copied ops) until the arena is reset. Storage is retained across resets to avoid reallocating.
+ */
+class FOpListArena
+{
+public:
+	FOpListArena() = default;
+	~FOpListArena()
+	{
+		Reset();
+	}
+
+	FOpListArena(const FOpListArena&) = delete;
+	FOpListArena& operator=(const FOpListArena&) = delete;
+
+	/** Takes ownership of OpList and appends its ops to the contiguous batch. */
+	void Append(Worker_OpList* OpList)
+	{
+		Ops.Append(OpList->ops, OpList->op_count);
+		SourceOpLists.Add(OpList);
+	}
+
+	/** Destroys all source op lists. Allocated storage is kept for the next tick. */
+	void Reset()
+	{
+		for (Worker_OpList* OpList : SourceOpLists)
+		{
+			Worker_OpList_Destroy(OpList);
+		}
+		SourceOpLists.Reset();
+		Ops.Reset();
+	}
+
+	/** Releases ownership of the source op lists to the caller, discarding the contiguous batch. */
+	TArray<Worker_OpList*> ReleaseSourceOpLists()
+	{
+		TArray<Worker_OpList*> Released = MoveTemp(SourceOpLists);
+		SourceOpLists.Reset();
+		Ops.Reset();
+		return Released;
+	}
+
+	/** Returns a view over every op in the arena. Valid until the next call to Reset or ReleaseSourceOpLists. */
+	Worker_OpList* GetBatch()
+	{
+		Batch.op_count = static_cast<uint32_t>(Ops.Num());
+		Batch.ops = Ops.GetData();
+		return &Batch;
+	}
+
+	bool IsEmpty() const
+	{
+		return SourceOpLists.Num() == 0;
+	}
+
+	int32 GetOpCount() const
+	{
+		return Ops.Num();
+	}
+
+	void Swap(FOpListArena& Other)
+	{
+		::Swap(Ops, Other.Ops);
+		::Swap(SourceOpLists, Other.SourceOpLists);
+	}
+
+private:
+	TArray<Worker_Op> Ops;
+	TArray<Worker_OpList*> SourceOpLists;
+	Worker_OpList Batch{};
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,112 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Interop/Connection/OutgoingMessages.h"
+#include "SpatialView/OpList/AbstractOpList.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogOpListRecording, Log, All);
+
+class FArchive;
+
+namespace SpatialGDK
+{
+
+// The entity and component each outgoing message was sent for, recorded alongside the received op lists so the traffic of a replay
+// can be compared with the live run. Fields which don't apply to a message type are left at 0.
+struct FRecordedOutgoingMessage
+{
+	double Time = 0.0;
+	EOutgoingMessageType Type = EOutgoingMessageType::ReserveEntityIdsRequest;
+	Worker_EntityId EntityId = 0;
+	Worker_ComponentId ComponentId = 0;
+};
+
+// Writes every op list a worker receives, and a summary of every message it sends, to a binary file.
+// Op lists are recorded on the thread that receives them and outgoing messages on the thread that sends them, so writes are locked.
+class SPATIALGDK_API FOpListRecorder
+{
+public:
+	~FOpListRecorder();
+
+	bool Open(const FString& Filename);
+	void Close();
+	bool IsOpen() const { return Writer.IsValid(); }
+
+	void RecordOpList(const Worker_OpList& OpList);
+	void RecordOutgoingMessage(const FOutgoingMessage& Message);
+
+private:
+	void WriteOp(const Worker_Op& Op);
+
+	FCriticalSection Mutex;
+	TUniquePtr<FArchive> Writer;
+	double StartTime = 0.0;
+};
+
+// An op list read back from a recording. Owns the ops along with the strings and schema objects they point to.
+class SPATIALGDK_API RecordedOpList : public AbstractOpList
+{
+public:
+	RecordedOpList() = default;
+	virtual ~RecordedOpList() override;
+
+	RecordedOpList(const RecordedOpList&) = delete;
+	RecordedOpList& operator=(const RecordedOpList&) = delete;
+
+	virtual uint32 GetCount() const override { return Ops.Num(); }
+	virtual Worker_Op& operator[](uint32 Index) override { return Ops[Index]; }
+	virtual const Worker_Op& operator[](uint32 Index) const override { return Ops[Index]; }
+
+	// A Worker_OpList view of the ops, valid for as long as this op list. Its ops must not be passed to Worker_OpList_Destroy.
+	Worker_OpList AsWorkerOpList() { return Worker_OpList{ Ops.GetData(), static_cast<uint32>(Ops.Num()) }; }
+
+	double GetTime() const { return Time; }
+
+private:
+	friend class FOpListRecordingReader;
+
+	double Time = 0.0;
+	TArray<Worker_Op> Ops;
+
+	TArray<TArray<ANSICHAR>> Strings;
+	TArray<TArray<const char*>> StringArrays;
+	TArray<TArray<Worker_Entity>> EntityArrays;
+	TArray<TArray<Worker_ComponentData>> ComponentDataArrays;
+
+	TArray<Schema_ComponentData*> ComponentDatas;
+	TArray<Schema_ComponentUpdate*> ComponentUpdates;
+	TArray<Schema_CommandRequest*> CommandRequests;
+	TArray<Schema_CommandResponse*> CommandResponses;
+};
+
+// Reads a recording written by FOpListRecorder, one op list at a time. Outgoing messages recorded before each op list are collected
+// into GetOutgoingMessages as they're read past.
+class SPATIALGDK_API FOpListRecordingReader
+{
+public:
+	~FOpListRecordingReader();
+
+	bool Open(const FString& Filename);
+	void Close();
+
+	// Returns nullptr once the end of the recording is reached, or if it's malformed.
+	TUniquePtr<RecordedOpList> ReadNextOpList();
+
+	const TArray<FRecordedOutgoingMessage>& GetOutgoingMessages() const { return OutgoingMessages; }
+
+private:
+	bool ReadOp(RecordedOpList& OpList, Worker_Op& OutOp);
+	const char* ReadString(RecordedOpList& OpList);
+	Schema_ComponentData* ReadComponentData(RecordedOpList& OpList);
+
+	TUniquePtr<FArchive> Reader;
+	TArray<FRecordedOutgoingMessage> OutgoingMessages;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,123 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "HAL/PlatformTime.h"
+#include "Interop/Connection/OutgoingMessages.h"
+#include "SpatialCommonTypes.h"
+#include "Templates/Atomic.h"
+#include "Templates/UniquePtr.h"
+#include "Utils/AtomicHistogram.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// In the order they are drained.
+enum class EOutgoingMessageLane : uint8
+{
+	// Command responses, authority intent, ACL and heartbeat updates.
+	Control,
+	// RPC endpoint updates and command requests.
+	RPC,
+	// Other component updates, and added and removed components.
+	PropertyUpdate,
+	// Entity creation and deletion, entity ID reservations, queries, interest changes, logs and metrics.
+	Bulk,
+
+	Count
+};
+
+/**
+ * Outgoing messages split into priority lanes, so that time-sensitive messages queued after a burst of entity creations
+ * or interest changes are still passed to the Worker SDK first. Used instead of the outgoing message queue and ring when
+ * bUseOutgoingMessagePriorityLanes is enabled. Messages are enqueued on the game thread and drained on the connection thread.
+ *
+ * Lanes are drained in order, and the bulk lane can be limited to a number of messages per drain. Messages within a lane keep their
+ * order. A message for an entity which still has a message in any lane, such as its creation in the bulk lane or a property update
+ * before an ACL update, is queued in that lane instead of its own, so messages for one entity are always sent in the order queued.
+ */
+class SPATIALGDK_API FOutgoingMessageLanes
+{
+public:
+	static EOutgoingMessageLane GetLane(const FOutgoingMessage& Message);
+	static const TCHAR* GetLaneName(EOutgoingMessageLane Lane);
+
+	// Game thread only.
+	void Enqueue(TUniquePtr<FOutgoingMessage> Message);
+
+	// Connection thread only. Calls Send with each message in lane order, sending at most MaxBulkMessages from the bulk lane
+	// unless it is 0. The messages are destroyed once Send returns.
+	template <typename FuncType>
+	void Drain(FuncType&& Send, uint32 MaxBulkMessages)
+	{
+		const double Now = FPlatformTime::Seconds();
+		for (int32 LaneIndex = 0; LaneIndex < NumLanes; LaneIndex++)
+		{
+			const bool bIsBulk = LaneIndex == static_cast<int32>(EOutgoingMessageLane::Bulk);
+			const uint32 MaxMessages = bIsBulk && MaxBulkMessages > 0 ? MaxBulkMessages : MAX_uint32;
+
+			FQueuedMessage Queued;
+			for (uint32 NumSent = 0; NumSent < MaxMessages && Lanes[LaneIndex].Dequeue(Queued); NumSent++)
+			{
+				Depths[LaneIndex].DecrementExchange();
+				if (WaitTimeHistograms[LaneIndex] != nullptr)
+				{
+					WaitTimeHistograms[LaneIndex]->Record(Now - Queued.QueueTime);
+				}
+
+				Send(Queued.Message.Get());
+				Queued.Message.Reset();
+
+				DrainedSequences[LaneIndex].Store(Queued.Sequence);
+			}
+		}
+	}
+
+	int32 GetDepth(EOutgoingMessageLane Lane) const { return Depths[static_cast<int32>(Lane)].Load(); }
+	int32 GetTotalDepth() const;
+	// Number of messages queued in another lane to keep them behind an earlier message for the same entity.
+	uint64 GetHeldInOtherLaneCount() const { return HeldInOtherLaneCount; }
+
+	// Records how long each message of the lane waited before being drained, in seconds. Must be set before messages are drained.
+	void SetWaitTimeHistogram(EOutgoingMessageLane Lane, FAtomicHistogram* Histogram) { WaitTimeHistograms[static_cast<int32>(Lane)] = Histogram; }
+
+private:
+	static constexpr int32 NumLanes = static_cast<int32>(EOutgoingMessageLane::Count);
+
+	static Worker_EntityId GetEntityId(const FOutgoingMessage& Message);
+
+	struct FQueuedMessage
+	{
+		TUniquePtr<FOutgoingMessage> Message;
+		double QueueTime = 0.0;
+		// Counts up per lane.
+		uint64 Sequence = 0;
+	};
+
+	struct FEntityLastMessage
+	{
+		EOutgoingMessageLane Lane;
+		uint64 Sequence;
+	};
+
+	bool IsDrained(const FEntityLastMessage& LastMessage) const;
+
+	TQueue<FQueuedMessage, EQueueMode::Spsc> Lanes[NumLanes];
+	TAtomic<int32> Depths[NumLanes] = {};
+	FAtomicHistogram* WaitTimeHistograms[NumLanes] = {};
+
+	// The sequence number of the last message drained from each lane, written by the connection thread.
+	TAtomic<uint64> DrainedSequences[NumLanes] = {};
+
+	// Game thread only. The lane and sequence number of the last message queued for each entity, so every message for an entity
+	// is in one lane until they have all been drained. Entries which have been drained are pruned whenever the map has doubled in size.
+	uint64 LastSequences[NumLanes] = {};
+	TMap<Worker_EntityId_Key, FEntityLastMessage> EntityLastMessages;
+	int32 NextPruneSize = 64;
+	uint64 HeldInOtherLaneCount = 0;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,168 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Interop/Connection/OutgoingMessages.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/Atomic.h"
+#include "Templates/TypeCompatibleBytes.h"
+
+namespace SpatialGDK
+{
+
+namespace OutgoingMessageRingPrivate
+{
+template <typename... Types>
+struct TLargestType;
+
+template <typename T>
+struct TLargestType<T>
+{
+	static constexpr SIZE_T Size = sizeof(T);
+	static constexpr SIZE_T Alignment = alignof(T);
+};
+
+template <typename T, typename... Rest>
+struct TLargestType<T, Rest...>
+{
+	static constexpr SIZE_T Size = sizeof(T) > TLargestType<Rest...>::Size ? sizeof(T) : TLargestType<Rest...>::Size;
+	static constexpr SIZE_T Alignment = alignof(T) > TLargestType<Rest...>::Alignment ? alignof(T) : TLargestType<Rest...>::Alignment;
+};
+
+// The message types sent at a high rate, which every ring slot is sized to hold inline.
+using FInlineMessageTypes = TLargestType<
+	FReserveEntityIdsRequest,
+	FDeleteEntityRequest,
+	FAddComponent,
+	FRemoveComponent,
+	FComponentUpdate,
+	FCommandRequest,
+	FCommandResponse>;
+} // namespace OutgoingMessageRingPrivate
+
+/**
+ * Bounded single-producer/single-consumer ring of outgoing messages.
+ * Messages that fit in a slot are constructed in place, larger messages are heap allocated and the slot holds a pointer.
+ * The producer must check IsFull before calling Emplace, and calls Publish to make the emplaced message visible to the consumer.
+ */
+class FOutgoingMessageRing
+{
+public:
+	static constexpr SIZE_T InlineSize = OutgoingMessageRingPrivate::FInlineMessageTypes::Size;
+	static constexpr SIZE_T InlineAlignment = OutgoingMessageRingPrivate::FInlineMessageTypes::Alignment;
+
+	template <typename T>
+	static constexpr bool FitsInline()
+	{
+		return sizeof(T) <= InlineSize && alignof(T) <= InlineAlignment;
+	}
+
+	explicit FOutgoingMessageRing(uint32 InCapacity)
+		: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)))
+		, Mask(Capacity - 1)
+		, Slots(new FSlot[Capacity])
+		, Head(0)
+		, Tail(0)
+	{
+	}
+
+	~FOutgoingMessageRing()
+	{
+		while (ConsumeNext([](FOutgoingMessage*) {}))
+		{
+		}
+	}
+
+	FOutgoingMessageRing(const FOutgoingMessageRing&) = delete;
+	FOutgoingMessageRing& operator=(const FOutgoingMessageRing&) = delete;
+
+	uint32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	// Number of published messages not yet consumed. Approximate when called from a thread other than the producer or consumer.
+	uint32 Num() const
+	{
+		return Head.Load() - Tail.Load();
+	}
+
+	// Producer only.
+	bool IsFull() const
+	{
+		return Head.Load() - Tail.Load() >= Capacity;
+	}
+
+	// Producer only. Constructs a message in the next free slot without making it visible to the consumer.
+	template <typename T, typename... ArgsType>
+	T* Emplace(ArgsType&&... Args)
+	{
+		check(!IsFull());
+
+		FSlot& Slot = Slots[Head.Load() & Mask];
+		T* Message;
+		if (FitsInline<T>())
+		{
+			Message = new (&Slot.Storage) T(Forward<ArgsType>(Args)...);
+			Slot.bHeapAllocated = false;
+		}
+		else
+		{
+			Message = new T(Forward<ArgsType>(Args)...);
+			Slot.bHeapAllocated = true;
+		}
+		Slot.Message = Message;
+		return Message;
+	}
+
+	// Producer only. Makes the last emplaced message visible to the consumer.
+	void Publish()
+	{
+		Head.Store(Head.Load() + 1);
+	}
+
+	// Consumer only. Passes the oldest message to Func and destroys it afterwards. Returns false if the ring was empty.
+	template <typename FuncType>
+	bool ConsumeNext(FuncType&& Func)
+	{
+		const uint32 CurrentTail = Tail.Load();
+		if (CurrentTail == Head.Load())
+		{
+			return false;
+		}
+
+		FSlot& Slot = Slots[CurrentTail & Mask];
+		Func(Slot.Message);
+
+		if (Slot.bHeapAllocated)
+		{
+			delete Slot.Message;
+		}
+		else
+		{
+			Slot.Message->~FOutgoingMessage();
+		}
+		Slot.Message = nullptr;
+
+		Tail.Store(CurrentTail + 1);
+		return true;
+	}
+
+private:
+	struct FSlot
+	{
+		TAlignedBytes<InlineSize, InlineAlignment> Storage;
+		FOutgoingMessage* Message = nullptr;
+		bool bHeapAllocated = false;
+	};
+
+	const uint32 Capacity;
+	const uint32 Mask;
+	TUniquePtr<FSlot[]> Slots;
+
+	// Head is only written by the producer and Tail only by the consumer. Both increase monotonically and wrap around.
+	TAtomic<uint32> Head;
+	TAtomic<uint32> Tail;
+};
+
+} // namespace SpatialGDK
@@ -183,8 +183,11 @@ struct FEntityQueryRequest : FOutgoingMessage
 	{
 		if (EntityQuery.snapshot_result_type_component_ids != nullptr)
 		{
+			// Reserve at least one element so the pointer stays non-null for queries that request no components, i.e. only entity IDs.
+			ComponentIdStorage.Reserve(FMath::Max<uint32>(EntityQuery.snapshot_result_type_component_id_count, 1));
 			ComponentIdStorage.SetNum(EntityQuery.snapshot_result_type_component_id_count);
-			FMemory::Memcpy(static_cast<void*>(ComponentIdStorage.GetData()), static_cast<const void*>(EntityQuery.snapshot_result_type_component_ids), ComponentIdStorage.Num());
+			FMemory::Memcpy(static_cast<void*>(ComponentIdStorage.GetData()), static_cast<const void*>(EntityQuery.snapshot_result_type_component_ids), ComponentIdStorage.Num() * sizeof(Worker_ComponentId));
+			EntityQuery.snapshot_result_type_component_ids = ComponentIdStorage.GetData();
 		}
 
 		TraverseConstraint(&EntityQuery.constraint);
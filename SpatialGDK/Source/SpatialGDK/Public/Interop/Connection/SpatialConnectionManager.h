@@ -21,6 +21,22 @@ enum class ESpatialConnectionType
 	DevAuthFlow
 };
 
+// The tokens the development authentication flow fetches from the locator before connecting.
+struct FDevelopmentAuthTokens
+{
+	struct FLoginToken
+	{
+		FString DeploymentName;
+		FString LoginToken;
+	};
+
+	FString PlayerIdentityToken;
+	TArray<FLoginToken> LoginTokens;
+
+	// Set instead of the tokens if fetching them failed.
+	FString Error;
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialConnectionManager : public UObject
 {
@@ -39,6 +55,11 @@ public:
 
 	void Connect(bool bConnectAsClient, uint32 PlayInEditorID);
 
+	// Replaces a lost connection with a new one made with the same config. The USpatialWorkerConnection is kept, so everything
+	// holding on to it carries on with the new connection. Clients connect as a new worker, as the runtime may not have noticed
+	// the old one is gone yet.
+	void Reconnect();
+
 	FORCEINLINE bool IsConnected() { return bIsConnected; }
 
 	void SetConnectionType(ESpatialConnectionType InConnectionType);
@@ -61,6 +82,10 @@ public:
 
 	void RequestDeploymentLoginTokens();
 
+	// Fetches the player identity and login tokens for the development authentication flow with the current DevAuthConfig in the
+	// background, so a following Connect, for example once a loading screen is done, doesn't have to wait for the locator.
+	void PrefetchDevelopmentAuthTokens();
+
 private:
 	void ConnectToReceptionist(uint32 PlayInEditorID);
 	void ConnectToLocator(FLocatorConfig* InLocatorConfig);
@@ -76,6 +101,11 @@ private:
 	static void OnLoginTokens(void* UserData, const Worker_Alpha_LoginTokensResponse* LoginTokens);
 	void ProcessLoginTokensResponse(const Worker_Alpha_LoginTokensResponse* LoginTokens);
 
+	void FetchDevelopmentAuthTokens(const FString& DevAuthToken, bool bConnectWhenFetched);
+	void OnDevelopmentAuthTokensFetched(const FDevelopmentAuthTokens& Tokens);
+	void ConnectWithLoginTokens(const TArray<FDevelopmentAuthTokens::FLoginToken>& LoginTokens);
+	FString GetDevelopmentAuthTokenCacheKey(const FString& DevAuthToken) const;
+
 private:
 	UPROPERTY()
 	USpatialWorkerConnection* WorkerConnection;
@@ -84,7 +114,11 @@ private:
 
 	bool bIsConnected;
 	bool bConnectAsClient = false;
+	uint32 ConnectedPlayInEditorID = 0;
 
 	ESpatialConnectionType ConnectionType = ESpatialConnectionType::Receptionist;
 	LoginTokenResponseCallback LoginTokenResCallback;
+
+	// Set while connecting with tokens fetched before Connect was called, so they can be dropped if they turn out to be stale.
+	bool bConnectingWithCachedTokens = false;
 };
@@ -3,14 +3,22 @@
 #pragma once
 
 #include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
 #include "HAL/Event.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
+#include "Interop/Connection/FlushPolicy.h"
+#include "Interop/Connection/OpListRecording.h"
+#include "Interop/Connection/OpListArena.h"
+#include "Interop/Connection/OutgoingMessageLanes.h"
+#include "Interop/Connection/OutgoingMessageRing.h"
 #include "Interop/Connection/OutgoingMessages.h"
 #include "Interop/Connection/SpatialOSWorkerInterface.h"
 #include "Interop/Connection/WorkerConnectionCoordinator.h"
 #include "SpatialCommonTypes.h"
+#include "SpatialView/EntityComponentId.h"
 #include "UObject/WeakObjectPtr.h"
+#include "Utils/BandwidthAccounting.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -19,6 +27,17 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialWorkerConnection, Log, All);
 
+class FSpatialWorkerConnectionSendRunnable;
+
+namespace SpatialGDK
+{
+class FRuntimeCheckpointer;
+class USpatialGDKSettings;
+} // namespace SpatialGDK
+
+// The field IDs of a received component update, parsed on the worker connection thread. Keyed by the update's schema object.
+using FPredecodedFieldIds = TPair<const void*, TArray<Schema_FieldId>>;
+
 UCLASS()
 class SPATIALGDK_API USpatialWorkerConnection : public UObject, public FRunnable, public SpatialOSWorkerInterface
 {
@@ -54,12 +73,58 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnDequeueMessage, const SpatialGDK::FOutgoingMessage*);
 	FOnDequeueMessage OnDequeueMessage;
 
-	void QueueLatestOpList();
+	// Returns every op received since the last call as one contiguous op list, only valid when bUseOpListArena is enabled.
+	// The returned op list and the ops it points to are owned by the connection and stay valid until the next call.
+	Worker_OpList* GetOpListBatch();
+
+	// TimeoutMillis is how long to block waiting for ops when none are available.
+	void QueueLatestOpList(uint32 TimeoutMillis = 0);
 	void ProcessOutgoingMessages();
 	void MaybeFlush();
 	void Flush();
+	// Flushes if RPCFlushRule or PropertyUpdateFlushRule asks for it at the end of a tick.
+	void ApplyEndOfTickFlushPolicy();
+
+	// Whether Flush wakes the connection thread, rather than leaving the messages for its next OpsUpdateRate interval. This is the case
+	// when every send flushes, a flush policy is set, or some RPCs are latency critical, see LatencyCriticalRPCs.
+	static bool CanWakeConnectionThread(const USpatialGDKSettings& Settings, bool bHasFlushPolicy);
+
+	// Number of messages that went to the heap-allocated overflow queue because the outgoing message ring was full.
+	uint64 GetOutgoingMessageRingFullCount() const { return OutgoingMessageRingFullCount; }
+	// Number of messages too large to be stored inline in an outgoing message ring slot.
+	uint64 GetOutgoingMessageRingOversizedCount() const { return OutgoingMessageRingOversizedCount; }
+	// Number of messages queued on the game thread that have not been sent to the Worker SDK yet.
+	uint32 GetOutgoingMessageQueueDepth() const;
+	// Number of messages queued on the game thread since the connection was created.
+	uint64 GetQueuedOutgoingMessageCount() const { return QueuedOutgoingMessageCount; }
+	// Bytes of component data and updates queued since the connection was created, only counted with bReportWorkerLoadVector.
+	uint64 GetQueuedOutgoingByteCount() const { return QueuedOutgoingByteCount; }
+
+	// Number of component updates merged into an earlier update for the same entity-component before sending.
+	uint64 GetMergedComponentUpdateCount() const { return MergedComponentUpdateCount.Load(); }
+	// Number of component updates passed to the Worker SDK.
+	uint64 GetSentComponentUpdateCount() const { return SentComponentUpdateCount.Load(); }
+
+	// Moves the histogram of how long received op lists waited before the game thread took them, in seconds, into OutMetric
+	// and starts a new one. Returns false if no op lists were taken since the last call.
+	bool ConsumeOpQueueLatencyHistogram(SpatialGDK::HistogramMetric& OutMetric);
+
+	// Moves out the component update field IDs parsed on the worker connection thread for an op list, or op list batch, returned by
+	// GetOpList or GetOpListBatch this tick. Only filled when bPredecodeOpsOnConnectionThread is enabled.
+	bool TakePredecodedFieldIds(const Worker_OpList* OpList, TArray<FPredecodedFieldIds>& OutFieldIds);
+
+	// Only set when bUseOutgoingMessagePriorityLanes is enabled.
+	SpatialGDK::FOutgoingMessageLanes* GetOutgoingMessageLanes() const { return OutgoingMessageLanes.Get(); }
+
+	// Bytes of component data and updates passed to the Worker SDK, only recorded while enabled.
+	SpatialGDK::FBandwidthAccounting& GetBandwidthAccounting() { return BandwidthAccounting; }
+
+	// Sent component data and updates, and deleted entities, are recorded by the checkpointer while it is set.
+	void SetRuntimeCheckpointer(SpatialGDK::FRuntimeCheckpointer* InRuntimeCheckpointer) { RuntimeCheckpointer = InRuntimeCheckpointer; }
 
 private:
+	friend class FSpatialWorkerConnectionSendRunnable;
+
 	void CacheWorkerAttributes();
 
 	// Begin FRunnable Interface
@@ -69,9 +134,23 @@ private:
 
 	void InitializeOpsProcessingThread();
 
+	// Loop of the dedicated send thread used when bSplitWorkerConnectionThreads is enabled.
+	void RunOutgoingMessagesLoop();
+
 	template <typename T, typename... ArgsType>
 	void QueueOutgoingMessage(ArgsType&&... Args);
 
+	void SendOutgoingMessage(SpatialGDK::FOutgoingMessage* OutgoingMessage);
+
+	void RecordOpQueueLatency(double ReceiveTime, double Now);
+
+	static void PredecodeOpList(const Worker_OpList* OpList, TArray<FPredecodedFieldIds>& OutFieldIds);
+
+	void OnMessageQueuedForFlushPolicy(SpatialGDK::EFlushTraffic Traffic, uint32 NumBytes);
+
+	void CoalesceComponentUpdate(const SpatialGDK::FComponentUpdate& Message);
+	void FlushCoalescedComponentUpdates();
+
 	Worker_Connection* WorkerConnection;
 
 	TArray<FString> CachedWorkerAttributes;
@@ -79,9 +158,90 @@ private:
 	FRunnableThread* OpsProcessingThread;
 	FThreadSafeBool KeepRunning = true;
 
-	TQueue<Worker_OpList*> OpListQueue;
+	// When bSplitWorkerConnectionThreads is enabled, OpsProcessingThread only receives ops, blocking in the Worker SDK until they
+	// arrive, and SendThread sends outgoing messages. Otherwise OpsProcessingThread does both in turn.
+	bool bSplitWorkerConnectionThreads = false;
+	uint32 ReceiveTimeoutMillis = 0;
+
+	// When bBlockOnWorkerOpList is enabled, OpsProcessingThread waits in the Worker SDK for up to this long for ops instead of sleeping.
+	bool bBlockOnWorkerOpList = false;
+	uint32 WorkerOpListTimeoutMillis = 0;
+
+	// Set by the thread policies of the connection threads, see FSpatialThreadPolicy::bBusyPoll. The waits above are skipped when set.
+	bool bBusyPoll = false;
+	bool bSendThreadBusyPoll = false;
+
+	TUniquePtr<FRunnable> SendRunnable;
+	FRunnableThread* SendThread = nullptr;
+
+	struct FReceivedOpList
+	{
+		Worker_OpList* OpList;
+		double ReceiveTime;
+		TArray<FPredecodedFieldIds> PredecodedFieldIds;
+	};
+
+	bool bPredecodeOps = false;
+
+	TQueue<FReceivedOpList> OpListQueue;
+
+	// Used instead of OpListQueue when bUseOpListArena is enabled. The ops thread appends to the pending arena,
+	// the game thread swaps it with the consumed arena once per tick and resets the previous batch in one go.
+	bool bUseOpListArena = false;
+	FCriticalSection OpListArenaMutex;
+	SpatialGDK::FOpListArena PendingOpListArena;
+	SpatialGDK::FOpListArena ConsumedOpListArena;
+	TArray<double> PendingOpListReceiveTimes;
+	TArray<double> ConsumedOpListReceiveTimes;
+	TArray<FPredecodedFieldIds> PendingOpListArenaFieldIds;
+
+	// Field IDs parsed ahead for the op lists handed to the game thread this tick. Only accessed on the game thread.
+	TMap<const Worker_OpList*, TArray<FPredecodedFieldIds>> PredecodedFieldIdsByOpList;
+
+	// Only accessed on the game thread.
+	TArray<SpatialGDK::HistogramMetricBucket> OpQueueLatencyBuckets;
+	double OpQueueLatencySum = 0.0;
+	uint32 OpQueueLatencySamples = 0;
 	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
 
+	// Only created when bUseOutgoingMessageRing is enabled, OutgoingMessagesQueue is then used as the overflow queue.
+	TUniquePtr<SpatialGDK::FOutgoingMessageRing> OutgoingMessageRing;
+	TAtomic<int32> OverflowMessageCount{ 0 };
+	uint64 OutgoingMessageRingFullCount = 0;
+	uint64 OutgoingMessageRingOversizedCount = 0;
+
+	// Only created when bUseOutgoingMessagePriorityLanes is enabled, used instead of the ring and OutgoingMessagesQueue.
+	TUniquePtr<SpatialGDK::FOutgoingMessageLanes> OutgoingMessageLanes;
+	uint32 MaxBulkOutgoingMessagesPerFlush = 0;
+
+	struct FCoalescedComponentUpdate
+	{
+		Worker_EntityId EntityId;
+		FWorkerComponentUpdate Update;
+	};
+
+	// Component updates for the same entity-component within a run of consecutive updates are merged
+	// when bCoalesceOutgoingComponentUpdates is enabled. Only accessed when processing outgoing messages.
+	bool bCoalesceComponentUpdates = false;
+	TArray<FCoalescedComponentUpdate> CoalescedComponentUpdates;
+	TMap<SpatialGDK::EntityComponentId, int32> CoalescedComponentUpdateIndices;
+	uint64 QueuedOutgoingMessageCount = 0;
+	bool bCountQueuedOutgoingBytes = false;
+	uint64 QueuedOutgoingByteCount = 0;
+	TAtomic<uint64> MergedComponentUpdateCount{ 0 };
+	TAtomic<uint64> SentComponentUpdateCount{ 0 };
+
+	SpatialGDK::FBandwidthAccounting BandwidthAccounting;
+
+	// Only created when RPCFlushRule or PropertyUpdateFlushRule is set. Only accessed on the game thread.
+	TUniquePtr<SpatialGDK::FFlushPolicy> FlushPolicy;
+
+	// Only created when the worker is started with -recordOpLists=<file>, to record everything received and sent for offline replay.
+	TUniquePtr<SpatialGDK::FOpListRecorder> OpListRecorder;
+
+	// Owned by the net driver. Only accessed on the game thread.
+	SpatialGDK::FRuntimeCheckpointer* RuntimeCheckpointer = nullptr;
+
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
 
@@ -0,0 +1,120 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Interop/SpatialRPCService.h"
+#include "Schema/RPCPayload.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCrossServerRPCService, Log, All);
+
+class SpatialVirtualWorkerTranslator;
+class USpatialStaticComponentView;
+
+namespace SpatialGDK
+{
+
+// Sends cross-server RPCs through a ring buffer on this server's worker entity, instead of one entity command per RPC.
+// SpatialOS only lets one worker write to a component, so unlike the client and server endpoints the buffer can't live on the
+// target entity. Each server instead writes its own CrossServerEndpoint, with the target entity set on every element, and acks
+// the RPCs of every other server it has seen in the same component. Servers check out each other's endpoints through their
+// worker entity interest, and execute the RPCs targeting entities they are authoritative over.
+// Reliable RPCs are queued until every other server has seen this endpoint, and RPCs arriving for an entity this server is about to
+// gain authority over are held until it has.
+class SPATIALGDK_API CrossServerRPCService
+{
+public:
+	CrossServerRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View);
+	~CrossServerRPCService();
+
+	// Without a translator, RPCs arriving during an authority handover can't be held for the new authoritative server.
+	void SetVirtualWorkerTranslator(const SpatialVirtualWorkerTranslator* InVirtualWorkerTranslator) { VirtualWorkerTranslator = InVirtualWorkerTranslator; }
+
+	// RPCs can only be pushed once this worker is authoritative over the endpoint on its worker entity.
+	bool IsReady() const { return LocalWorkerEntityId != SpatialConstants::INVALID_ENTITY_ID; }
+
+	EPushRPCResult PushRPC(Worker_EntityId TargetEntityId, const RPCPayload& Payload, bool bReliable);
+	void PushOverflowedRPCs();
+
+	// Executes the held RPCs whose target entity this server has gained authority over, and drops those it no longer will.
+	void ProcessHeldRPCs();
+
+	TArray<SpatialRPCService::UpdateToSend> GetRPCsAndAcksToSend();
+
+	static FWorkerComponentData CreateEndpointData();
+
+	void OnEndpointAuthorityGained(Worker_EntityId EntityId);
+
+	// Called with the endpoints of other servers, to extract the RPCs sent to this server and read the acks of the RPCs it sent.
+	void OnEndpointAdded(Worker_EntityId EntityId, Schema_Object* EndpointObject);
+	void OnEndpointUpdated(Worker_EntityId EntityId, Schema_Object* EndpointObject);
+	void OnEndpointRemoved(Worker_EntityId EntityId);
+
+	int32 GetNumOverflowedRPCs() const { return OverflowedRPCs.Num(); }
+	int32 GetNumHeldRPCs() const;
+
+private:
+	struct FCrossServerRPC
+	{
+		Worker_EntityId TargetEntityId;
+		RPCPayload Payload;
+		bool bReliable;
+	};
+
+	struct FReceiverEndpoint
+	{
+		uint64 LastAckedRPCId = 0;
+		bool bHasAcked = false;
+		// Set when this receiver alone holds back reusing the ring buffer, it then stops doing so until it catches up.
+		bool bLagging = false;
+	};
+
+	struct FSenderEndpoint
+	{
+		uint64 LastSeenRPCId = 0;
+		uint32 RingBufferSize = 0;
+	};
+
+	bool HasCapacity() const;
+	bool CanWriteRPC(const FCrossServerRPC& RPC) const;
+	bool HaveAllReceiversSeenEndpoint() const;
+	uint64 GetOldestAckedRPCId() const;
+	bool MarkLaggingReceivers();
+	void WriteRPC(Worker_EntityId TargetEntityId, const RPCPayload& Payload);
+
+	bool IsAuthorityIntendedForThisWorker(Worker_EntityId TargetEntityId) const;
+
+	void ReadAck(Worker_EntityId EntityId, Schema_Object* EndpointObject);
+	void ExtractRPCs(Worker_EntityId EntityId, Schema_Object* EndpointObject);
+
+	Schema_Object* GetOrCreatePendingUpdateFields();
+
+	ExtractRPCDelegate ExtractRPCCallback;
+	const USpatialStaticComponentView* View;
+	const SpatialVirtualWorkerTranslator* VirtualWorkerTranslator = nullptr;
+
+	Worker_EntityId LocalWorkerEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	uint32 RingBufferSize;
+
+	// Sending side.
+	uint64 LastSentRPCId = 0;
+	uint64 LastFlushedRPCId = 0;
+	// Every other server whose endpoint this server has seen, including those which haven't acked this endpoint yet.
+	TMap<Worker_EntityId_Key, FReceiverEndpoint> ReceiverEndpoints;
+	TArray<FCrossServerRPC> OverflowedRPCs;
+
+	// Receiving side, the last seen IDs are written to this server's endpoint as the acks for each other server.
+	TMap<Worker_EntityId_Key, FSenderEndpoint> SenderEndpoints;
+	bool bAcksDirty = false;
+	// RPCs for entities this server is about to gain authority over, in the order they arrived.
+	TMap<Worker_EntityId_Key, TArray<RPCPayload>> HeldRPCs;
+
+	Schema_ComponentUpdate* PendingUpdate = nullptr;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,171 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialView/ComponentData.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogRuntimeCheckpoints, Log, All);
+
+namespace SpatialGDK
+{
+
+struct FCheckpointEntity
+{
+	Worker_EntityId EntityId;
+	TArray<ComponentData> Components;
+};
+
+// Part of a checkpoint, with the latest state of the entities in it. Chunks are ordered by their timestamp, and a restore takes the
+// newest state of each entity from them.
+struct FCheckpointChunk
+{
+	int64 TimestampTicks = 0;
+	uint64 Sequence = 0;
+	TArray<FCheckpointEntity> Entities;
+	// Entities deleted by this worker, which are left out of a restore.
+	TArray<Worker_EntityId> DeletedEntityIds;
+};
+
+// Where checkpoint chunks are stored. Chunks are written on the checkpoint writer thread, one at a time, in sequence order.
+class SPATIALGDK_API FCheckpointStorage
+{
+public:
+	virtual ~FCheckpointStorage() = default;
+
+	// Returns false if the chunk couldn't be stored, the entities in it are then written again by the next checkpoint they change in.
+	virtual bool WriteChunk(const FCheckpointChunk& Chunk) = 0;
+};
+
+// Stores each chunk as a snapshot file, with a list of the deleted entities next to it, so that a checkpoint is restored by the
+// streaming snapshot loader. See SpatialSnapshotManager::LoadCheckpoint.
+class SPATIALGDK_API FFileCheckpointStorage : public FCheckpointStorage
+{
+public:
+	// The writer name keeps the files of the workers writing to the same directory apart.
+	FFileCheckpointStorage(const FString& InDirectory, const FString& InWriterName);
+
+	virtual bool WriteChunk(const FCheckpointChunk& Chunk) override;
+
+	// The snapshot files of the checkpoint in Directory, newest first, and the entities deleted in any of its chunks.
+	static void FindChunks(const FString& Directory, TArray<FString>& OutSnapshotPaths, TSet<Worker_EntityId>& OutDeletedEntityIds);
+
+	static FString GetDefaultDirectory();
+
+private:
+	FString Directory;
+	FString WriterName;
+};
+
+// Decides which entities a restore creates while it reads the chunks of a checkpoint newest first, so that each entity is created from
+// the newest chunk it was written to, and entities deleted since are left out.
+class SPATIALGDK_API FCheckpointRestoreFilter
+{
+public:
+	explicit FCheckpointRestoreFilter(TSet<Worker_EntityId>&& InDeletedEntityIds);
+
+	// True the first time an entity is read, unless it was deleted.
+	bool ShouldRestore(Worker_EntityId EntityId);
+
+private:
+	// The deleted entities, and the entities already restored from a newer chunk.
+	TSet<Worker_EntityId> SkippedEntityIds;
+};
+
+class FCheckpointWriter;
+
+/**
+ * Streams the persistent entities this worker is authoritative over to an FCheckpointStorage in the background, so that the runtime
+ * state can be restored without a runtime snapshot.
+ *
+ * The latest data of the persistent entities in view is kept from the received ops and from the updates this worker sends, as those
+ * aren't looped back. Entities are dirtied when this worker changes them or gains authority over them. Every checkpoint interval, the
+ * dirty entities are copied into chunks, at most MaxEntitiesPerSecond of them, and the chunks are written on their own thread.
+ * Copying only the dirty entities within a budget keeps the game thread's share of a checkpoint small and bounded; the entities of
+ * one checkpoint are consequently copied over several frames, rather than all from the same one.
+ */
+class SPATIALGDK_API FRuntimeCheckpointer
+{
+public:
+	FRuntimeCheckpointer(TUniquePtr<FCheckpointStorage> InStorage, float InIntervalSeconds, int32 InChunkSize, float InMaxEntitiesPerSecond);
+	// Waits for the chunks already copied to be written.
+	~FRuntimeCheckpointer();
+
+	void RecordReceivedOp(const Worker_Op& Op);
+
+	void RecordSentAddComponent(Worker_EntityId EntityId, const Worker_ComponentData& Data);
+	void RecordSentRemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+	void RecordSentComponentUpdate(Worker_EntityId EntityId, const Worker_ComponentUpdate& Update);
+	void RecordSentDeleteEntity(Worker_EntityId EntityId);
+
+	// Starts a checkpoint if the interval has passed, and copies dirty entities into chunks within the rate limit.
+	void Tick(double Now);
+
+	// Starts a checkpoint on the next tick, regardless of the interval.
+	void RequestCheckpoint() { bCheckpointRequested = true; }
+
+	// Blocks until the chunks handed to the writer thread have been written.
+	void WaitForPendingWrites();
+
+	int32 GetNumTrackedEntities() const { return Entities.Num(); }
+	int32 GetNumDirtyEntities() const { return DirtyEntityIds.Num(); }
+
+private:
+	struct FComponentRecord
+	{
+		ComponentData Data;
+		// Applying updates grows the data, so it's copied to its serialized size after a number of them.
+		int32 NumUpdatesApplied = 0;
+	};
+
+	struct FEntityRecord
+	{
+		TMap<Worker_ComponentId, FComponentRecord> Components;
+		bool bPersistent = false;
+		bool bAuthoritative = false;
+	};
+
+	// Updates applied to a component's data before it's compacted.
+	static constexpr int32 MaxUpdatesBeforeCompaction = 32;
+	// Chunks waiting to be written, after which copying waits for the writer.
+	static constexpr int32 MaxQueuedChunks = 4;
+
+	void SetComponentData(FEntityRecord& Entity, Worker_ComponentId ComponentId, const Schema_ComponentData* Data);
+	void ApplyComponentUpdate(FEntityRecord& Entity, Worker_ComponentId ComponentId, Schema_ComponentUpdate* Update);
+	void RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+	void MarkDirty(Worker_EntityId EntityId, const FEntityRecord& Entity);
+
+	void CopyEntity(Worker_EntityId EntityId, const FEntityRecord& Entity);
+	void SubmitChunk();
+
+	TUniquePtr<FCheckpointWriter> Writer;
+	float IntervalSeconds;
+	int32 ChunkSize;
+	float MaxEntitiesPerSecond;
+
+	TMap<Worker_EntityId_Key, FEntityRecord> Entities;
+	// Entities added since the last tick, which are dropped if they turn out not to be persistent.
+	TArray<Worker_EntityId> AddedEntityIds;
+
+	TSet<Worker_EntityId_Key> DirtyEntityIds;
+	TArray<Worker_EntityId> DeletedEntityIds;
+
+	// The dirty entities of the checkpoint in progress, copied from NextCheckpointEntity on.
+	TArray<Worker_EntityId> CheckpointEntityIds;
+	int32 NextCheckpointEntity = 0;
+	bool bCheckpointInProgress = false;
+	bool bCheckpointRequested = false;
+
+	TUniquePtr<FCheckpointChunk> CurrentChunk;
+	uint64 NextChunkSequence = 0;
+
+	double TimeOfLastCheckpoint = 0.0;
+	double TimeOfLastTick = 0.0;
+	float EntityAllowance = 0.f;
+};
+
+} // namespace SpatialGDK
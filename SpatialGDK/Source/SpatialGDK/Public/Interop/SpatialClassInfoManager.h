@@ -3,6 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Utils/CompactSchemaDatabase.h"
+#include "Utils/ComponentClassification.h"
+#include "Utils/ReplicationPlan.h"
 #include "Utils/SchemaDatabase.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -34,6 +37,8 @@ struct FRPCInfo
 {
 	ERPCType Type;
 	uint32 Index;
+	// Set for the functions in LatencyCriticalRPCs.
+	bool bLatencyCritical = false;
 };
 
 struct FHandoverPropertyInfo
@@ -63,12 +68,23 @@ struct FClassInfo
 	TArray<FHandoverPropertyInfo> HandoverProperties;
 	TArray<FInterestPropertyInfo> InterestProperties;
 
+	// One entry per command of the class's rep layout, see SpatialGDK::CompileReplicationPlan.
+	TArray<SpatialGDK::FReplicationPlanEntry> ReplicationPlan;
+
+	// Bytes fields whose values are written with SpatialGDK::AddCompressibleBytesToSchema, see FCompressedFieldsSchemaData.
+	TSet<Schema_FieldId> CompressedFieldIds;
+	TSet<Schema_FieldId> CompressedHandoverFieldIds;
+
 	// For Actors and default Subobjects belonging to Actors
 	Worker_ComponentId SchemaComponents[ESchemaComponentType::SCHEMA_Count] = {};
 
 	// Only for Actors
 	TMap<uint32, TSharedRef<const FClassInfo>> SubobjectInfo;
 
+	// Only for Actors, true if the class has no subobjects, handover properties or RPCs.
+	// Their actor channels only allocate the state needed by other actors when it's used, see FSpatialActorChannelExtendedState.
+	bool bIsSimpleActor = false;
+
 	// Only for default Subobjects belonging to Actors
 	FName SubobjectName;
 
@@ -101,13 +117,20 @@ public:
 	const FClassInfo& GetOrCreateClassInfoByObject(UObject* Object);
 	const FClassInfo& GetClassInfoByComponentId(Worker_ComponentId ComponentId);
 
+	// Whether the info of an actor class has no subobjects, handover properties or RPCs, see FClassInfo::bIsSimpleActor.
+	static bool IsSimpleActorClass(const FClassInfo& Info);
+
 	UClass* GetClassByComponentId(Worker_ComponentId ComponentId);
 	bool GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset);
 	ESchemaComponentType GetCategoryByComponentId(Worker_ComponentId ComponentId);
 
 	Worker_ComponentId GetComponentIdForClass(const UClass& Class) const;
 	TArray<Worker_ComponentId> GetComponentIdsForClassHierarchy(const UClass& BaseClass, const bool bIncludeDerivedTypes = true) const;
+	// The data components of the actor classes derived from BaseClass, of their default subobjects, and of the dynamic subobjects of the
+	// same classes as those default subobjects.
+	TArray<Worker_ComponentId> GetDataComponentIdsForActorClassHierarchy(const UClass& BaseClass) const;
 	
+	// Cached per class and function after the first call, so RPCs called on subobjects or through a parent function don't repeat the search.
 	const FRPCInfo& GetRPCInfo(UObject* Object, UFunction* Function);
 
 	Worker_ComponentId GetComponentIdFromLevelPath(const FString& LevelPath) const;
@@ -125,6 +148,8 @@ public:
 	// Used to check if component is used for qbi tracking only
 	bool IsGeneratedQBIMarkerComponent(Worker_ComponentId ComponentId) const;
 
+	const SpatialGDK::FComponentClassification& GetComponentClassification() const { return ComponentClassification; }
+
 	// Tries to find ClassInfo corresponding to an unused dynamic subobject on the given entity
 	const FClassInfo* GetClassInfoForNewSubobject(const UObject* Object, Worker_EntityId EntityId, USpatialPackageMapClient* PackageMapClient);
 
@@ -133,6 +158,13 @@ public:
 
 	void QuitGame();
 
+	// Queues class info to be built for the replicated classes the world is likely to need, see bPrewarmClassInfo.
+	void QueueClassInfoPrewarm(UWorld* World);
+	void TickClassInfoPrewarm(float TimeBudgetMs);
+
+	// Classes whose class info was built on demand after prewarming was queued. Adding these to ClassInfoPrewarmClasses avoids the hitch.
+	const TArray<FString>& GetLazilyBuiltClassPaths() const { return LazilyBuiltClassPaths; }
+
 private:
 	void CreateClassInfoForClass(UClass* Class);
 	void TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId);
@@ -142,6 +174,13 @@ private:
 
 	bool ShouldTrackHandoverProperties() const;
 
+	bool TryLoadCompactSchemaDatabase();
+
+	// Look up per-class entries, decoding them from the compact schema database on first use if it is loaded.
+	const FActorSchemaData* FindActorSchemaData(const FString& ClassPath) const;
+	const FSubobjectSchemaData* FindSubobjectSchemaData(const FString& ClassPath) const;
+	const FString* FindClassPathForComponentId(Worker_ComponentId ComponentId) const;
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -150,4 +189,17 @@ private:
 	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
 	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
 	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+	// Every copy of a class's info has the same RPCs, so the RPC info only depends on the class of the object.
+	TMap<TPair<TWeakObjectPtr<UClass>, TWeakObjectPtr<UFunction>>, FRPCInfo> RPCInfoCache;
+
+	// Shared with the other workers in the process, see FCompactSchemaDatabase::LoadShared.
+	TSharedPtr<const SpatialGDK::FCompactSchemaDatabase, ESPMode::ThreadSafe> CompactSchemaDatabase;
+
+	// Built from the schema database once it's loaded.
+	SpatialGDK::FComponentClassification ComponentClassification;
+
+	TArray<TWeakObjectPtr<UClass>> ClassesToPrewarm;
+	TArray<FString> LazilyBuiltClassPaths;
+	bool bClassInfoPrewarmQueued = false;
+	bool bIsPrewarmingClassInfo = false;
 };
@@ -24,6 +24,15 @@ public:
 #else
 		RepFlags.bRepPhysics = ActorChannel->Actor->GetReplicatedMovement().bRepPhysics;
 #endif
+		const bool bIsAuthoritativeClient = ActorChannel->IsAuthoritativeClient();
+
+		FSpatialConditionMapCache& Cache = ActorChannel->GetConditionMapCache();
+		const uint8 Flags = (RepFlags.bNetSimulated ? 1 : 0) | (RepFlags.bNetOwner ? 2 : 0) | (RepFlags.bRepPhysics ? 4 : 0) | (bIsAuthoritativeClient ? 8 : 0);
+		if (Cache.Flags == Flags)
+		{
+			ConditionMap = Cache.ConditionMap;
+			return;
+		}
 
 #if 0
 		UE_LOG(LogTemp, Verbose, TEXT("CMF Actor %s (%lld) NetOwner %d Simulated %d RepPhysics %d Client %s"),
@@ -42,34 +51,47 @@ public:
 		const bool bIsPhysics = RepFlags.bRepPhysics ? true : false;
 		const bool bIsReplay = RepFlags.bReplay ? true : false;
 
-		ConditionMap[COND_None] = true;
-		ConditionMap[COND_InitialOnly] = bIsInitial;
+		ConditionMap = 0;
+		SetCondition(COND_None, true);
+		SetCondition(COND_InitialOnly, bIsInitial);
+
+		SetCondition(COND_OwnerOnly, bIsOwner);
+		SetCondition(COND_SkipOwner, !bIsAuthoritativeClient); // TODO: UNR-3714, this is a best-effort measure, but SkipOwner is currently quite broken
 
-		ConditionMap[COND_OwnerOnly] = bIsOwner;
-		ConditionMap[COND_SkipOwner] = !ActorChannel->IsAuthoritativeClient(); // TODO: UNR-3714, this is a best-effort measure, but SkipOwner is currently quite broken
+		SetCondition(COND_SimulatedOnly, bIsSimulated);
+		SetCondition(COND_SimulatedOnlyNoReplay, bIsSimulated && !bIsReplay);
+		SetCondition(COND_AutonomousOnly, !bIsSimulated);
 
-		ConditionMap[COND_SimulatedOnly] = bIsSimulated;
-		ConditionMap[COND_SimulatedOnlyNoReplay] = bIsSimulated && !bIsReplay;
-		ConditionMap[COND_AutonomousOnly] = !bIsSimulated;
+		SetCondition(COND_SimulatedOrPhysics, bIsSimulated || bIsPhysics);
+		SetCondition(COND_SimulatedOrPhysicsNoReplay, (bIsSimulated || bIsPhysics) && !bIsReplay);
 
-		ConditionMap[COND_SimulatedOrPhysics] = bIsSimulated || bIsPhysics;
-		ConditionMap[COND_SimulatedOrPhysicsNoReplay] = (bIsSimulated || bIsPhysics) && !bIsReplay;
+		SetCondition(COND_InitialOrOwner, bIsInitial || bIsOwner);
+		SetCondition(COND_ReplayOrOwner, bIsReplay || bIsOwner);
+		SetCondition(COND_ReplayOnly, bIsReplay);
+		SetCondition(COND_SkipReplay, !bIsReplay);
 
-		ConditionMap[COND_InitialOrOwner] = bIsInitial || bIsOwner;
-		ConditionMap[COND_ReplayOrOwner] = bIsReplay || bIsOwner;
-		ConditionMap[COND_ReplayOnly] = bIsReplay;
-		ConditionMap[COND_SkipReplay] = !bIsReplay;
+		SetCondition(COND_Custom, true);
+		SetCondition(COND_Never, false);
 
-		ConditionMap[COND_Custom] = true;
-		ConditionMap[COND_Never] = false;
+		Cache.Flags = Flags;
+		Cache.ConditionMap = ConditionMap;
 	}
 
 	bool IsRelevant(ELifetimeCondition Condition) const
 	{
-		return ConditionMap[Condition];
+		return (ConditionMap & (1u << Condition)) != 0;
 	}
 
 private:
-	bool ConditionMap[COND_Max];
+	void SetCondition(ELifetimeCondition Condition, bool bIsRelevant)
+	{
+		if (bIsRelevant)
+		{
+			ConditionMap |= 1u << Condition;
+		}
+	}
+
+	// One bit per ELifetimeCondition.
+	uint32 ConditionMap;
 
 };
@@ -15,6 +15,12 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialView, Log, All);
 
+namespace SpatialGDK
+{
+class FHitchCapture;
+class FRuntimeCheckpointer;
+} // namespace SpatialGDK
+
 class USpatialMetrics;
 class USpatialReceiver;
 class USpatialStaticComponentView;
@@ -27,12 +33,26 @@ public:
 
 	void Init(USpatialReceiver* InReceiver, USpatialStaticComponentView* InStaticComponentView, USpatialMetrics* InSpatialMetrics, USpatialWorkerFlags* InSpatialWorkerFlags);
 	void ProcessOps(Worker_OpList* OpList);
+	// Processes the ops of the list from FirstOpIndex until EndTime (in FPlatformTime::Seconds) is reached or MaxOps ops have been processed.
+	// An EndTime or MaxOps of 0 is unbounded. At least one op is processed, and a critical section is always processed to its end.
+	// Returns the index of the first op which wasn't processed, which is the op count once the whole list has been processed.
+	uint32 ProcessOps(Worker_OpList* OpList, uint32 FirstOpIndex, double EndTime, uint32 MaxOps);
 
 	// The following 2 methods should *only* be used by the Startup OpList Queueing flow
 	// from the SpatialNetDriver, and should be temporary since an alternative solution will be available via the Worker SDK soon.
 	void MarkOpToSkip(const Worker_Op* Op);
 	int GetNumOpsToSkip() const;
 
+	// When enabled, the size of the component data and updates received is added up, for clients to report their throughput.
+	void SetCountReceivedBytes(bool bInCountReceivedBytes) { bCountReceivedBytes = bInCountReceivedBytes; }
+	uint64 GetReceivedBytes() const { return ReceivedBytes; }
+
+	// Every processed op is recorded in the capture while it is set.
+	void SetHitchCapture(SpatialGDK::FHitchCapture* InHitchCapture) { HitchCapture = InHitchCapture; }
+
+	// Every processed op is recorded by the checkpointer while it is set.
+	void SetRuntimeCheckpointer(SpatialGDK::FRuntimeCheckpointer* InRuntimeCheckpointer) { RuntimeCheckpointer = InRuntimeCheckpointer; }
+
 	// Each callback method returns a callback ID which is incremented for each registration.
 	// ComponentId must be in the range 1000 - 2000.
 	// Callbacks can be deregistered through passing the corresponding callback ID to the RemoveOpCallback function.
@@ -61,6 +81,8 @@ private:
 
 	bool IsExternalSchemaOp(Worker_Op* Op) const;
 	void ProcessExternalSchemaOp(Worker_Op* Op);
+	void ProcessOp(Worker_Op* Op);
+	void CountReceivedBytes(const Worker_Op* Op);
 	FCallbackId AddGenericOpCallback(Worker_ComponentId ComponentId, Worker_OpType OpType, const TFunction<void(const Worker_Op*)>& Callback);
 	void RunCallbacks(Worker_ComponentId ComponentId, const Worker_Op* Op);
 
@@ -78,5 +100,14 @@ private:
 	FCallbackId NextCallbackId;
 	TMap<Worker_ComponentId, OpTypeToCallbacksMap> ComponentOpTypeToCallbacksMap;
 	TMap<FCallbackId, CallbackIdData> CallbackIdToDataMap;
-	TArray<const Worker_Op*> OpsToSkip;
+	// A set, as every op of the queued startup op lists is checked against it once startup completes.
+	TSet<const Worker_Op*> OpsToSkip;
+	// Whether the last critical section op processed started one, which may have been in an earlier call to ProcessOps.
+	bool bInCriticalSection = false;
+
+	bool bCountReceivedBytes = false;
+	uint64 ReceivedBytes = 0;
+
+	SpatialGDK::FHitchCapture* HitchCapture = nullptr;
+	SpatialGDK::FRuntimeCheckpointer* RuntimeCheckpointer = nullptr;
 };
@@ -0,0 +1,104 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Component.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Templates/UniquePtr.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Alternative storage backend for USpatialStaticComponentView.
+ * Each entity is assigned a slot through a single entity ID lookup. Hand-written component data is kept in one dense array
+ * per component type indexed by slot, and the presence and authority of every component on an entity is kept in a small
+ * contiguous array per slot, so reads don't need further hash lookups.
+ * Slots are kept contiguous: when an entity is removed, the last slot is moved into its place.
+ */
+class SPATIALGDK_API FSpatialFlatComponentStorage
+{
+public:
+	static constexpr int32 NumHandwrittenComponents = 19;
+
+	// Returns the dense index for components with hand-written data classes, or INDEX_NONE for any other component.
+	static int32 GetHandwrittenComponentIndex(Worker_ComponentId ComponentId)
+	{
+		switch (ComponentId)
+		{
+		case SpatialConstants::ENTITY_ACL_COMPONENT_ID:					return 0;
+		case SpatialConstants::METADATA_COMPONENT_ID:					return 1;
+		case SpatialConstants::POSITION_COMPONENT_ID:					return 2;
+		case SpatialConstants::PERSISTENCE_COMPONENT_ID:				return 3;
+		case SpatialConstants::WORKER_COMPONENT_ID:						return 4;
+		case SpatialConstants::SPAWN_DATA_COMPONENT_ID:					return 5;
+		case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:			return 6;
+		case SpatialConstants::INTEREST_COMPONENT_ID:					return 7;
+		case SpatialConstants::HEARTBEAT_COMPONENT_ID:					return 8;
+		case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:				return 9;
+		case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:	return 10;
+		case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:	return 11;
+		case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:			return 12;
+		case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:			return 13;
+		case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:			return 14;
+		case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:				return 15;
+		case SpatialConstants::SPATIAL_DEBUGGING_COMPONENT_ID:			return 16;
+		case SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID:			return 17;
+		case SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID:	return 18;
+		default:														return INDEX_NONE;
+		}
+	}
+
+	Component* GetComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
+	bool HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
+	Worker_Authority GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
+
+	// Data may be null for components without a hand-written data class.
+	void AddComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId, TUniquePtr<Component> Data);
+	void RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+	void RemoveEntity(Worker_EntityId EntityId);
+	void SetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Worker_Authority Authority);
+
+	// Returns every entity that had a component added since it was last removed, matching the map based storage.
+	void GetEntityIds(TArray<Worker_EntityId_Key>& OutEntityIds) const;
+	int32 GetNumEntities() const;
+
+	// Adds the number of present components of each type to OutCounts.
+	void GetComponentCounts(TMap<Worker_ComponentId, int32>& OutCounts) const;
+	// Memory allocated by the storage itself, excluding the component data objects.
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FComponentState
+	{
+		Worker_ComponentId ComponentId;
+		Worker_Authority Authority;
+		bool bPresent;
+	};
+
+	struct FEntitySlot
+	{
+		Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+		bool bHasAddedComponent = false;
+		TArray<FComponentState> Components;
+	};
+
+	int32 FindSlot(Worker_EntityId EntityId) const;
+	int32 FindOrAddSlot(Worker_EntityId EntityId);
+	const FComponentState* FindComponentState(int32 SlotIndex, Worker_ComponentId ComponentId) const;
+	FComponentState& FindOrAddComponentState(int32 SlotIndex, Worker_ComponentId ComponentId);
+
+	TMap<Worker_EntityId_Key, int32> EntityToSlot;
+	TArray<FEntitySlot> Slots;
+
+	// One dense array per hand-written component type, indexed by entity slot.
+	TArray<TUniquePtr<Component>> HandwrittenComponents[NumHandwrittenComponents];
+};
+
+} // namespace SpatialGDK
@@ -104,6 +104,7 @@ public:
 
 /**
  * Creates a constraint that includes all entities within a sphere centered on the specified point.
+ * The point is fixed in the world, use the relative version of this constraint for interest that follows the actor.
  */
 UCLASS(BlueprintType, EditInlineNew, DefaultToInstanced)
 class SPATIALGDK_API USphereConstraint final : public UAbstractQueryConstraint
@@ -126,6 +127,7 @@ public:
 
 /**
  * Creates a constraint that includes all entities within a cylinder centered on the specified point.
+ * The point is fixed in the world, use the relative version of this constraint for interest that follows the actor.
  */
 UCLASS(BlueprintType, EditInlineNew, DefaultToInstanced)
 class SPATIALGDK_API UCylinderConstraint final : public UAbstractQueryConstraint
@@ -148,6 +150,7 @@ public:
 
 /**
  * Creates a constraint that includes all entities within a bounding box centered on the specified point.
+ * The point is fixed in the world, use the relative version of this constraint for interest that follows the actor.
  */
 UCLASS(BlueprintType, EditInlineNew, DefaultToInstanced)
 class SPATIALGDK_API UBoxConstraint final : public UAbstractQueryConstraint
@@ -163,13 +166,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Box Constraint")
 	FVector Center = FVector::ZeroVector;
 
-	/** The size of the box represented by this constraint. */
+	/** The size of the box represented by this constraint in centimeters. */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Meta = (ClampMin = 0.0), Category = "Box Constraint")
 	FVector EdgeLengths = FVector::ZeroVector;
 };
 
 /**
  * Creates a constraint that includes all entities within a sphere centered on the actor.
+ * SpatialOS evaluates it around the entity's current position, so it follows the actor without any interest updates.
  */
 UCLASS(BlueprintType, EditInlineNew, DefaultToInstanced)
 class SPATIALGDK_API URelativeSphereConstraint final : public UAbstractQueryConstraint
@@ -188,6 +192,7 @@ public:
 
 /**
  * Creates a constraint that includes all entities within a cylinder centered on the actor.
+ * SpatialOS evaluates it around the entity's current position, so it follows the actor without any interest updates.
  */
 UCLASS(BlueprintType, EditInlineNew, DefaultToInstanced)
 class SPATIALGDK_API URelativeCylinderConstraint final : public UAbstractQueryConstraint
@@ -206,6 +211,7 @@ public:
 
 /**
  * Creates a constraint that includes all entities within a bounding box centered on the actor.
+ * SpatialOS evaluates it around the entity's current position, so it follows the actor without any interest updates.
  */
 UCLASS(BlueprintType, EditInlineNew, DefaultToInstanced)
 class SPATIALGDK_API URelativeBoxConstraint final : public UAbstractQueryConstraint
@@ -217,7 +223,7 @@ public:
 
 	virtual void CreateConstraint(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::QueryConstraint& OutConstraint) const override;
 
-	/** The size of the box represented by this constraint. */
+	/** The size of the box represented by this constraint in centimeters. */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Meta = (ClampMin = 0.0), Category = "Relative Box Constraint")
 	FVector EdgeLengths = FVector::ZeroVector;
 };
@@ -13,6 +13,7 @@
 DECLARE_DELEGATE_OneParam(EntityQueryDelegate, const Worker_EntityQueryResponseOp&);
 DECLARE_DELEGATE_OneParam(ReserveEntityIDsDelegate, const Worker_ReserveEntityIdsResponseOp&);
 DECLARE_DELEGATE_OneParam(CreateEntityDelegate, const Worker_CreateEntityResponseOp&);
+DECLARE_DELEGATE_OneParam(DeleteEntityDelegate, const Worker_DeleteEntityResponseOp&);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnEntityAddedDelegate, const Worker_EntityId);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnEntityRemovedDelegate, const Worker_EntityId);
@@ -36,10 +37,12 @@ public:
 	virtual void OnCommandResponse(const Worker_CommandResponseOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnCommandResponse, return;);
 	virtual void OnReserveEntityIdsResponse(const Worker_ReserveEntityIdsResponseOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnReserveEntityIdsResponse, return;);
 	virtual void OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnCreateEntityResponse, return;);
+	virtual void OnDeleteEntityResponse(const Worker_DeleteEntityResponseOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnDeleteEntityResponse, return;);
 
 	virtual void AddPendingActorRequest(Worker_RequestId RequestId, USpatialActorChannel* Channel) PURE_VIRTUAL(SpatialOSDispatcherInterface::AddPendingActorRequest, return;);
 	virtual void AddPendingReliableRPC(Worker_RequestId RequestId, TSharedRef<struct FReliableRPCForRetry> ReliableRPC) PURE_VIRTUAL(SpatialOSDispatcherInterface::AddPendingReliableRPC, return;);
 	virtual void AddEntityQueryDelegate(Worker_RequestId RequestId, EntityQueryDelegate Delegate) PURE_VIRTUAL(SpatialOSDispatcherInterface::AddEntityQueryDelegate, return;);
 	virtual void AddReserveEntityIdsDelegate(Worker_RequestId RequestId, ReserveEntityIDsDelegate Delegate) PURE_VIRTUAL(SpatialOSDispatcherInterface::AddReserveEntityIdsDelegate, return;);
 	virtual void AddCreateEntityDelegate(Worker_RequestId RequestId, CreateEntityDelegate Delegate) PURE_VIRTUAL(SpatialOSDispatcherInterface::AddCreateEntityDelegate, return;);
+	virtual void AddDeleteEntityDelegate(Worker_RequestId RequestId, DeleteEntityDelegate Delegate) PURE_VIRTUAL(SpatialOSDispatcherInterface::AddDeleteEntityDelegate, return;);
 };
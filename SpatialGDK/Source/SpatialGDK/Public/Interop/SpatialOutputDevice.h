@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Misc/OutputDevice.h"
+#include "Utils/LogForwardingQueue.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -19,6 +20,10 @@ public:
 	void RemoveRedirectCategory(const FName& Category);
 	void SetVerbosityFilterLevel(ELogVerbosity::Type Verbosity);
 	void Serialize(const TCHAR* InData, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	bool CanBeUsedOnAnyThread() const override { return LogQueue.IsValid(); }
+
+	// Sends the log lines queued with bAsyncLogForwarding. Called on the game thread.
+	void FlushQueuedLogs();
 
 	static Worker_LogLevel ConvertLogLevelToSpatial(ELogVerbosity::Type Verbosity);
 
@@ -30,4 +35,8 @@ protected:
 
 	int32 PIEIndex;
 	bool bLogToSpatial;
+
+	// Only created when bAsyncLogForwarding is enabled.
+	TUniquePtr<SpatialGDK::FLogForwardingQueue> LogQueue;
+	int32 MaxLinesPerBatch;
 };
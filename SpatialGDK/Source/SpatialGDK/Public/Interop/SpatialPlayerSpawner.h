@@ -4,6 +4,7 @@
 
 #include "Schema/PlayerSpawner.h"
 #include "SpatialCommonTypes.h"
+#include "Utils/ClientRejoinTokens.h"
 
 #include "GameFramework/OnlineReplStructs.h"
 #include "Templates/UniquePtr.h"
@@ -34,15 +35,28 @@ public:
 	void SendPlayerSpawnRequest();
 	void ReceivePlayerSpawnResponseOnClient(const Worker_CommandResponseOp& Op);
 
+	// Makes the following spawn requests ask for the player controller the client had as PreviousWorkerId, until a response arrives.
+	void SetRejoinPlayerController(const PhysicalWorkerName& PreviousWorkerId, Worker_EntityId PlayerControllerEntityId);
+
 	FOnPlayerSpawnFailed OnPlayerSpawnFailed;
 
 	// Authoritative server worker
 	void ReceivePlayerSpawnRequestOnServer(const Worker_CommandRequestOp& Op);
 	void ReceiveForwardPlayerSpawnResponse(const Worker_CommandResponseOp& Op);
 
+	// Lets the rejoin token of the worker be used, now that its entity has been removed. See bEnableClientFastRejoin.
+	void OnClientWorkerDisconnected(const PhysicalWorkerName& ClientWorkerId);
+
 	// Non-authoritative server worker
 	void ReceiveForwardedPlayerSpawnRequest(const Worker_CommandRequestOp& Op);
 
+	// Any server. Spawns up to MaxPlayerSpawnsPerTick of the requests queued when bQueuePlayerSpawnRequests is set.
+	void ProcessQueuedPlayerSpawnRequests();
+
+	// Metrics
+	double GetNumQueuedPlayerSpawnRequests() const { return QueuedPlayerSpawnRequests.Num(); }
+	double GetPlayerSpawnsPerSecond();
+
 private:
 	struct ForwardSpawnRequestDeleter
 	{
@@ -56,6 +70,20 @@ private:
 		}
 	};
 
+	using FCommandRequestPtr = TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>;
+
+	struct FQueuedPlayerSpawnRequest
+	{
+		PhysicalWorkerName ClientWorkerId;
+		FCommandRequestPtr Request;
+	};
+
+	struct FPlayerStartAuthority
+	{
+		bool bShouldHaveAuthority;
+		VirtualWorkerId AuthoritativeVirtualWorker;
+	};
+
 	// Client
 	SpatialGDK::SpawnPlayerRequest ObtainPlayerParams() const;
 
@@ -63,6 +91,7 @@ private:
 	void FindPlayerStartAndProcessPlayerSpawn(Schema_Object* Request, const PhysicalWorkerName& ClientWorkerId);
 	void ForwardSpawnRequestToStrategizedServer(const Schema_Object* OriginalPlayerSpawnRequest, AActor* PlayerStart, const PhysicalWorkerName& ClientWorkerId, const VirtualWorkerId SpawningVirtualWorker);
 	void RetryForwardSpawnPlayerRequest(const Worker_EntityId EntityId, const Worker_RequestId RequestId, const bool bShouldTryDifferentPlayerStart = false);
+	FPlayerStartAuthority GetPlayerStartAuthority(const AActor& PlayerStart);
 
 	// Any server
 	void PassSpawnRequestToNetDriver(const Schema_Object* PlayerSpawnData, AActor* PlayerStart);
@@ -72,7 +101,26 @@ private:
 
 	FTimerManager* TimerManager;
 	int NumberOfAttempts;
-	TMap<Worker_RequestId_Key, TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>> OutgoingForwardPlayerSpawnRequests;
+	TMap<Worker_RequestId_Key, FCommandRequestPtr> OutgoingForwardPlayerSpawnRequests;
+
+	// Client, set by SetRejoinPlayerController.
+	PhysicalWorkerName RejoinPreviousWorkerId;
+	Worker_EntityId RejoinPlayerControllerEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	// Client, the token of the last spawn response, presented when rejoining.
+	FString IssuedRejoinToken;
+
+	// Server, issued with each spawn response.
+	SpatialGDK::FClientRejoinTokens RejoinTokens;
 
 	TSet<FString> WorkersWithPlayersSpawned;
+
+	// Requests are answered as they arrive but only spawned from here, so a wave of logins is spread over several ticks.
+	TArray<FQueuedPlayerSpawnRequest> QueuedPlayerSpawnRequests;
+
+	// PlayerStarts don't move, so which worker should own each one only changes if the strategy's regions can move.
+	TMap<TWeakObjectPtr<const AActor>, FPlayerStartAuthority> PlayerStartAuthorityCache;
+
+	uint32 NumPlayersSpawned = 0;
+	uint32 NumPlayersSpawnedAtLastReport = 0;
+	double LastSpawnRateReportTime = 0.0;
 };
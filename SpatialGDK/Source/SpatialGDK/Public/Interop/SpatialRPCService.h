@@ -59,7 +59,8 @@ class SPATIALGDK_API SpatialRPCService
 public:
 	SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View, USpatialLatencyTracer* SpatialLatencyTracer);
 
-	EPushRPCResult PushRPC(Worker_EntityId EntityId, ERPCType Type, RPCPayload Payload, bool bCreatedEntity);
+	// The payload is only copied if the RPC has to be queued, the common case of writing it straight into the ring buffer doesn't copy it.
+	EPushRPCResult PushRPC(Worker_EntityId EntityId, ERPCType Type, const RPCPayload& Payload, bool bCreatedEntity);
 	void PushOverflowedRPCs();
 
 	struct UpdateToSend
@@ -68,6 +69,8 @@ public:
 		FWorkerComponentUpdate Update;
 	};
 	TArray<UpdateToSend> GetRPCsAndAcksToSend();
+	// Only takes the updates for EntityId, leaving those of other entities for the next full flush.
+	TArray<UpdateToSend> GetRPCsAndAcksToSend(Worker_EntityId EntityId);
 	TArray<FWorkerComponentData> GetRPCComponentsOnEntityCreation(Worker_EntityId EntityId);
 
 	// Will also store acked IDs locally.
@@ -81,16 +84,42 @@ public:
 	void OnEndpointAuthorityGained(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 	void OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
+	// Ping IDs are carried on the endpoints, so measuring round trip latency doesn't need RPCs of its own. The client writes
+	// its latest ping ID to the ClientEndpoint with its next RPCs or acks, and the server echoes it back on the ServerEndpoint.
+	// OnPingIdAcked is broadcast on the client when the echoed ID changes.
+	void SetPingId(Worker_EntityId EntityId, uint32 PingId);
+
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPingIdAcked, Worker_EntityId, uint32);
+	FOnPingIdAcked OnPingIdAcked;
+
+	// Backpressure on the overflowed RPC queues, summed over all entities. Dropped RPCs are counted since the service was created.
+	uint32 GetOverflowedRPCQueueDepth(ERPCType Type) const;
+	double GetOldestOverflowedRPCAge(ERPCType Type) const;
+	uint32 GetDroppedRPCCount(ERPCType Type) const;
+	// Overflowed unreliable RPCs dropped for being queued longer than their time to live. These are also counted as dropped.
+	uint32 GetExpiredRPCCount() const { return NumExpiredRPCs; }
+
+	// Bytes used by the ring buffer state kept by the service and the RPCs queued in it, for the memory report. Schema objects
+	// owned by pending updates are counted by the worker SDK, not here.
+	SIZE_T GetAllocatedSize() const;
+
+	// The clock held acks and overflowed RPCs are timed with, FPlatformTime::Seconds unless replaced, e.g. by tests.
+	void SetTimeSource(TFunction<double()> InTimeSource) { TimeSource = MoveTemp(InTimeSource); }
+
 private:
 	// For now, we should drop overflowed RPCs when entity crosses the boundary.
 	// When locking works as intended, we should re-evaluate how this will work (drop after some time?).
 	void ClearOverflowedRPCs(Worker_EntityId EntityId);
 
-	EPushRPCResult PushRPCInternal(Worker_EntityId EntityId, ERPCType Type, RPCPayload&& Payload, bool bCreatedEntity);
+	EPushRPCResult PushRPCInternal(Worker_EntityId EntityId, ERPCType Type, const RPCPayload& Payload, bool bCreatedEntity);
 
 	void ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Type);
 
-	void AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload);
+	void EchoPingId(Worker_EntityId EntityId);
+	void NotifyPingIdAcked(Worker_EntityId EntityId);
+
+	// Returns QueueOverflowed if the RPC was queued, or DropOverflowed if the queue was full and the RPC was dropped instead.
+	EPushRPCResult AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload);
 
 	uint64 GetAckFromView(Worker_EntityId EntityId, ERPCType Type);
 	const RPCRingBuffer& GetBufferFromView(Worker_EntityId EntityId, ERPCType Type);
@@ -98,6 +127,17 @@ private:
 	Schema_ComponentUpdate* GetOrCreateComponentUpdate(EntityComponentId EntityComponentIdPair);
 	Schema_ComponentData* GetOrCreateComponentData(EntityComponentId EntityComponentIdPair);
 
+	// Writes the RPCs packed since the last flush into their ring buffer elements, only those of OnlyEntityId if it's valid.
+	void WritePendingPackedRPCs(Worker_EntityId OnlyEntityId = SpatialConstants::INVALID_ENTITY_ID);
+
+	// Writes the acks held back by RPCAckDelaySeconds which are due, or can go with an update to their component which is being sent anyway.
+	// Only those of OnlyEntityId if it's valid.
+	void WritePendingAcks(Worker_EntityId OnlyEntityId = SpatialConstants::INVALID_ENTITY_ID);
+
+	uint32 GetRingBufferSize(const EntityRPCType& EntityType) const;
+	uint32 GrowRingBuffer(const EntityRPCType& EntityType, Schema_Object* EndpointObject);
+	void ClearRingBufferSizes(Worker_EntityId EntityId, ERPCType FirstType, ERPCType SecondType);
+
 private:
 	ExtractRPCDelegate ExtractRPCCallback;
 	const USpatialStaticComponentView* View;
@@ -110,10 +150,47 @@ private:
 	TMap<EntityRPCType, uint64> LastAckedRPCIds;
 	TMap<EntityRPCType, uint64> LastSentRPCIds;
 
+	// Per entity ring buffer sizes for the buffers we have authority over, and the buffers which have overflowed
+	// since their size last changed. Only used when adaptive ring buffer sizes are enabled.
+	TMap<EntityRPCType, uint32> RingBufferSizes;
+	TSet<EntityRPCType> RingBuffersToGrow;
+
+	// The last ping ID echoed on each ServerEndpoint we have authority over, and the last echoed ID seen on each ClientEndpoint we have authority over.
+	TMap<Worker_EntityId_Key, uint32> LastEchoedPingIds;
+	TMap<Worker_EntityId_Key, uint32> LastAckedPingIds;
+
 	TMap<EntityComponentId, Schema_ComponentData*> PendingRPCsOnEntityCreation;
 
 	TMap<EntityComponentId, Schema_ComponentUpdate*> PendingComponentUpdatesToSend;
-	TMap<EntityRPCType, TArray<RPCPayload>> OverflowedRPCs;
+	struct OverflowedRPC
+	{
+		RPCPayload Payload;
+		double TimeQueued;
+	};
+	TMap<EntityRPCType, TArray<OverflowedRPC>> OverflowedRPCs;
+	TMap<ERPCType, uint32> DroppedRPCCounts;
+	uint32 NumExpiredRPCs = 0;
+
+	// RPCs of types which are packed share one ring buffer element per entity until the updates are sent.
+	struct PendingPackedRPCs
+	{
+		Schema_Object* EndpointObject;
+		uint64 RPCId;
+		TArray<uint8> Data;
+	};
+	TMap<EntityRPCType, PendingPackedRPCs> PendingPackedRPCsToWrite;
+
+	// Acks held back by RPCAckDelaySeconds. The deadline is set when the first unsent ack is held back and isn't pushed back by later ones.
+	struct PendingAck
+	{
+		uint64 SentAckId;
+		uint64 AckId;
+		double Deadline;
+		bool bBufferFilling = false;
+	};
+	TMap<EntityRPCType, PendingAck> PendingAcks;
+
+	TFunction<double()> TimeSource;
 
 #if TRACE_LIB_ACTIVE
 	void ProcessResultToLatencyTrace(const EPushRPCResult Result, const TraceKey Trace);
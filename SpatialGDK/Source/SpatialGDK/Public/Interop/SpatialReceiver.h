@@ -17,6 +17,11 @@
 #include "Schema/StandardLibrary.h"
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialCommonTypes.h"
+#include "Utils/ActorPool.h"
+#include "Utils/ActorSpawnPriority.h"
+#include "Utils/ComponentIdTable.h"
+#include "Utils/EntityCreationLimiter.h"
+#include "Utils/EntityQueryCache.h"
 #include "Utils/RPCContainer.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -77,6 +82,7 @@ public:
 
 	virtual void OnReserveEntityIdsResponse(const Worker_ReserveEntityIdsResponseOp& Op) override;
 	virtual void OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op) override;
+	virtual void OnDeleteEntityResponse(const Worker_DeleteEntityResponseOp& Op) override;
 
 	virtual void AddPendingActorRequest(Worker_RequestId RequestId, USpatialActorChannel* Channel) override;
 	virtual void AddPendingReliableRPC(Worker_RequestId RequestId, TSharedRef<struct FReliableRPCForRetry> ReliableRPC) override;
@@ -84,14 +90,51 @@ public:
 	virtual void AddEntityQueryDelegate(Worker_RequestId RequestId, EntityQueryDelegate Delegate) override;
 	virtual void AddReserveEntityIdsDelegate(Worker_RequestId RequestId, ReserveEntityIDsDelegate Delegate) override;
 	virtual void AddCreateEntityDelegate(Worker_RequestId RequestId, CreateEntityDelegate Delegate) override;
+	virtual void AddDeleteEntityDelegate(Worker_RequestId RequestId, DeleteEntityDelegate Delegate) override;
 
 	virtual void OnEntityQueryResponse(const Worker_EntityQueryResponseOp& Op) override;
 
+	// Sends the query and executes the delegate with its response, like AddEntityQueryDelegate. If an identical query is in flight,
+	// the delegate is executed with its response instead of sending another request. With a CacheLifetimeSeconds above 0, a successful
+	// response received at most that long ago is reused, on the next tick, and this query's response is kept for that long.
+	void SendEntityQuery(const Worker_EntityQuery& Query, EntityQueryDelegate Delegate, float CacheLifetimeSeconds = 0.f);
+
 	void ResolvePendingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef);
 	void FlushRetryRPCs();
 
 	void OnDisconnect(Worker_DisconnectOp& Op);
 
+	// Client fast rejoin, see bEnableClientFastRejoin. The entities in view when the connection was lost are kept, and the data they're
+	// checked out with on the new connection is applied to their existing actors. Those not checked out again by the time the rejoin
+	// is finished are removed.
+	void OnClientRejoinStarted();
+	void FinishClientRejoinReconcile();
+	// Time the last kept entity was checked out again, or 0 if none has been yet.
+	double GetLastRejoinedEntityTime() const { return LastRejoinedEntityTime; }
+
+	// Spawns actors for entities deferred by bTimeSliceActorSpawning, up to the remaining budget for this tick. Called once per tick.
+	void ProcessDeferredActorSpawns();
+
+	// Requests the packages queued by bBatchAsyncClassLoads this tick as one batch. Called once per tick.
+	void RequestQueuedAsyncLoads();
+
+	// Time in seconds the longest waiting entity has been waiting for its class to load.
+	double GetOldestAsyncLoadWaitTime() const;
+
+	// Number of create entity requests sent for actor channels that are still awaiting a response.
+	int32 GetNumPendingActorRequests() const { return PendingActorRequests.Num(); }
+
+	// Only valid when bAdaptiveEntityCreationLimit is set.
+	const SpatialGDK::FEntityCreationLimiter* GetEntityCreationLimiter() const { return EntityCreationLimiter.Get(); }
+
+	// Records how long received RPCs waited to be applied, in seconds, into Histogram.
+	void SetIncomingRPCQueueTimeHistogram(SpatialGDK::FAtomicHistogram* Histogram) { IncomingRPCs.SetQueuedTimeHistogram(Histogram); }
+	uint32 GetNumExpiredRPCs() const { return IncomingRPCs.GetNumExpiredRPCs(); }
+	SIZE_T GetIncomingRPCsAllocatedSize() const { return IncomingRPCs.GetAllocatedSize(); }
+
+	// Bytes used by the ops, requests and entities the receiver is holding on to until they can be handled, for the memory report.
+	SIZE_T GetPendingStateAllocatedSize() const;
+
 	void RemoveActor(Worker_EntityId EntityId);
 	bool IsPendingOpsOnChannel(USpatialActorChannel& Channel);
 
@@ -101,12 +144,44 @@ public:
 	void MoveMappedObjectToUnmapped(const FUnrealObjectRef&);
 
 	void RetireWhenAuthoritive(Worker_EntityId EntityId, Worker_ComponentId ActorClassId, bool bIsNetStartup, bool bNeedsTearOff);
+
+	// Field IDs of generated component data and updates, parsed on worker threads ahead of applying them. The prefetched IDs of a
+	// schema object are moved out when it gets applied, and any left over are cleared once the op list has been processed.
+	void PrefetchComponentUpdateFieldIds(const Worker_OpList* OpList);
+	bool ConsumePrefetchedFieldIds(const void* SchemaType, TArray<Schema_FieldId>& OutFieldIds);
+	void ClearPrefetchedFieldIds();
+
 private:
+	// What OnComponentUpdate does with an update, by component ID. Everything not in the table goes through the generated component path.
+	enum class EComponentUpdateHandler : uint8
+	{
+		Generic,
+		Ignore,
+		IgnoreReserved,
+		GSMShutdown,
+		Heartbeat,
+		DeploymentMap,
+		StartupActorManager,
+		RPCLegacy,
+		LoadBalancing,
+		VirtualWorkerTranslation,
+		RPC,
+		CrossServerRPC,
+		LevelTombstones
+	};
+
+	void BuildComponentUpdateHandlers();
+
 	void EnterCriticalSection();
 	void LeaveCriticalSection();
+	void HandlePendingAddComponents(TArray<PendingAddComponentWrapper>& PendingAddComponents);
 
 	void ReceiveActor(Worker_EntityId EntityId);
 	void DestroyActor(AActor* Actor, Worker_EntityId EntityId);
+	bool ReleaseActorToPool(AActor* Actor, Worker_EntityId EntityId);
+
+	void PrefetchPendingAddComponentFieldIds();
+	void PrefetchFieldIds(const TArray<Schema_ComponentData*>& ComponentDatas, const TArray<Schema_ComponentUpdate*>& ComponentUpdates);
 
 	AActor* TryGetOrCreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData, SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerData);
 	AActor* CreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData, SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerData);
@@ -132,24 +207,40 @@ private:
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject& TargetObject, USpatialActorChannel& Channel, bool bIsHandover);
 
 	FRPCErrorInfo ApplyRPC(const FPendingRPCParams& Params);
-	ERPCResult ApplyRPCInternal(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, const FString& SenderWorkerId, bool bApplyWithUnresolvedRefs = false);
+	ERPCResult ApplyRPCInternal(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, const FString& SenderWorkerId, bool bApplyWithUnresolvedRefs = false,
+		TArray<FUnrealObjectRef>* OutUnresolvedRefs = nullptr);
 
 	void ReceiveCommandResponse(const Worker_CommandResponseOp& Op);
+	void DropPendingReliableRPCs(Worker_EntityId EntityId);
+	void ReceivePackedCommandRPCs(const Worker_CommandRequestOp& Op, Schema_Object* RequestObject);
 
 	bool IsReceivedEntityTornOff(Worker_EntityId EntityId);
 
 	void ProcessOrQueueIncomingRPC(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload InPayload);
 
+	// The RPCs received in one component update or command are processed as a batch. The RPCs are applied in the order they
+	// were received, but the target of consecutive RPCs on the same object is only resolved once.
+	void BeginIncomingRPCBatch();
+	void EndIncomingRPCBatch();
+	bool ResolveIncomingRPCTarget(const FUnrealObjectRef& ObjectRef, UObject*& OutTargetObject, const FClassInfo*& OutClassInfo);
+
 	void ResolveIncomingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef);
 
-	void ResolveObjectReferences(FRepLayout& RepLayout, UObject* ReplicatedObject, FSpatialObjectRepState& RepState, FObjectReferencesMap& ObjectReferencesMap, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped);
+	// If OffsetsToResolve is set, only those entries of ObjectReferencesMap are visited.
+	void ResolveObjectReferences(FRepLayout& RepLayout, UObject* ReplicatedObject, FSpatialObjectRepState& RepState, FObjectReferencesMap& ObjectReferencesMap, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped, const TArray<int32>* OffsetsToResolve = nullptr);
+	// Returns false if the entry is invalid and should be removed from its map.
+	bool ResolveObjectReference(FRepLayout& RepLayout, UObject* ReplicatedObject, FSpatialObjectRepState& RepState, int32 AbsOffset, FObjectReferences& ObjectReferences, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped);
 
 	void ProcessQueuedActorRPCsOnEntityCreation(Worker_EntityId EntityId, SpatialGDK::RPCsOnEntityCreation& QueuedRPCs);
 	void UpdateShadowData(Worker_EntityId EntityId);
 	TWeakObjectPtr<USpatialActorChannel> PopPendingActorRequest(Worker_RequestId RequestId);
 
 	void OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op);
+	void SetHeartbeatComponentInterest(Worker_EntityId EntityId, bool bInterested);
 	void CloseClientConnection(USpatialNetConnection* ClientConnection, Worker_EntityId PlayerControllerEntityId);
+	void CloseClientConnectionAfterRejoinGracePeriod(USpatialNetConnection* ClientConnection, Worker_EntityId PlayerControllerEntityId);
+
+	void ApplyRejoinedEntityData(Worker_EntityId EntityId, AActor& EntityActor);
 
 	void PeriodicallyProcessIncomingRPCs();
 
@@ -161,6 +252,14 @@ private:
 	void OnAsyncPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
 
 	bool IsEntityWaitingForAsyncLoad(Worker_EntityId Entity);
+	void ProcessEntityWaitingForAsyncLoad(Worker_EntityId Entity);
+	void ProcessEntitiesWithLoadedClasses(TArray<Worker_EntityId>& Entities);
+
+	void DeferActorSpawn(Worker_EntityId EntityId, const FString& ClassPath, UClass* Class);
+	void SortDeferredActorSpawns();
+	void SortPendingAddActorsBySpawnPriority();
+	float GetActorSpawnPriority(UClass* Class);
+	bool GetActorSpawnPriorityOrigin(FVector& OutOrigin) const;
 
 	struct QueuedOpForAsyncLoad
 	{
@@ -176,6 +275,14 @@ private:
 	TArray<PendingAddComponentWrapper> ExtractAddComponents(Worker_EntityId Entity);
 	TArray<QueuedOpForAsyncLoad> ExtractAuthorityOps(Worker_EntityId Entity);
 
+	// Ops buffered for one entity while in a critical section, in the order they were received.
+	struct CriticalSectionEntityOps
+	{
+		TArray<PendingAddComponentWrapper> AddComponents;
+		TArray<Worker_AuthorityChangeOp, TInlineAllocator<4>> AuthorityChanges;
+		bool bAddActor = false;
+	};
+
 	struct CriticalSectionSaveState
 	{
 		CriticalSectionSaveState(USpatialReceiver& InReceiver);
@@ -184,9 +291,9 @@ private:
 		USpatialReceiver& Receiver;
 
 		bool bInCriticalSection;
+		double CriticalSectionStartTime;
 		TArray<Worker_EntityId> PendingAddActors;
-		TArray<Worker_AuthorityChangeOp> PendingAuthorityChanges;
-		TArray<PendingAddComponentWrapper> PendingAddComponents;
+		TMap<Worker_EntityId_Key, CriticalSectionEntityOps> PendingOpsByEntity;
 	};
 
 	void HandleQueuedOpForAsyncLoad(QueuedOpForAsyncLoad& Op);
@@ -223,6 +330,9 @@ private:
 
 	SpatialGDK::SpatialRPCService* RPCService;
 
+	// Only set when bEnableActorPooling is set.
+	TUniquePtr<SpatialGDK::FActorPool> ActorPool;
+
 	// Helper struct to manage FSpatialObjectRepState update cycle.
 	struct RepStateUpdateHelper;
 
@@ -232,38 +342,88 @@ private:
 
 	FRPCContainer IncomingRPCs{ ERPCQueueType::Receive };
 
+	struct FIncomingRPCTarget
+	{
+		FUnrealObjectRef ObjectRef;
+		TWeakObjectPtr<UObject> Object;
+		const FClassInfo* ClassInfo = nullptr;
+	};
+	// Only used while a batch is being processed, as the object a ref resolves to can change between batches.
+	FIncomingRPCTarget LastIncomingRPCTarget;
+	int32 IncomingRPCBatchDepth = 0;
+	uint32 IncomingRPCBatchCount = 0;
+
 	bool bInCriticalSection;
+	double CriticalSectionStartTime = 0.0;
 	TArray<Worker_EntityId> PendingAddActors;
-	TArray<Worker_AuthorityChangeOp> PendingAuthorityChanges;
-	TArray<PendingAddComponentWrapper> PendingAddComponents;
+	// Entries are only added while in a critical section, so iterating it visits entities in the order their first op was received.
+	TMap<Worker_EntityId_Key, CriticalSectionEntityOps> PendingOpsByEntity;
 	TArray<Worker_RemoveComponentOp> QueuedRemoveComponentOps;
 
+	TMap<const void*, TArray<Schema_FieldId>> PrefetchedFieldIds;
+
+	// Built in Init, covers every ID below the first generated component ID.
+	SpatialGDK::TComponentIdTable<EComponentUpdateHandler> ComponentUpdateHandlers{ SpatialConstants::STARTING_GENERATED_COMPONENT_ID, EComponentUpdateHandler::Generic };
+
 	TMap<Worker_RequestId_Key, TWeakObjectPtr<USpatialActorChannel>> PendingActorRequests;
+	TUniquePtr<SpatialGDK::FEntityCreationLimiter> EntityCreationLimiter;
 	FReliableRPCMap PendingReliableRPCs;
 
 	TMap<Worker_RequestId_Key, EntityQueryDelegate> EntityQueryDelegates;
+	SpatialGDK::FEntityQueryCache EntityQueryCache;
 	TMap<Worker_RequestId_Key, ReserveEntityIDsDelegate> ReserveEntityIDsDelegates;
 	TMap<Worker_RequestId_Key, CreateEntityDelegate> CreateEntityDelegates;
+	TMap<Worker_RequestId_Key, DeleteEntityDelegate> DeleteEntityDelegates;
 
 	// This will map PlayerController entities to the corresponding SpatialNetConnection
 	// for PlayerControllers that this server has authority over. This is used for player
 	// lifecycle logic (Heartbeat component updates, disconnection logic).
 	TMap<Worker_EntityId_Key, TWeakObjectPtr<USpatialNetConnection>> AuthorityPlayerControllerConnectionMap;
 
+	// PlayerController entities this server has turned Heartbeat component interest off for, with bAggregateServerHeartbeats.
+	TSet<Worker_EntityId_Key> HeartbeatInterestDisabledEntities;
+
 	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, PendingAddComponentWrapper> PendingDynamicSubobjectComponents;
 	TMap<Worker_EntityId_Key, FString> WorkerConnectionEntities;
 
+	// Client fast rejoin. Entities kept from before the connection was lost which haven't been checked out again, and those which
+	// have but whose actor hasn't been given their data yet.
+	TSet<Worker_EntityId_Key> RejoinCachedEntities;
+	TSet<Worker_EntityId_Key> RejoinedEntities;
+	double LastRejoinedEntityTime = 0.0;
+
 	// TODO: Refactor into a separate class so we can add automated tests for this. UNR-2649
 	struct EntityWaitingForAsyncLoad
 	{
 		FString ClassPath;
 		TArray<PendingAddComponentWrapper> InitialPendingAddComponents;
 		TArray<QueuedOpForAsyncLoad> PendingOps;
+		// Set for entities whose class is loaded but which were deferred by bTimeSliceActorSpawning.
+		bool bWaitingForSpawnBudget = false;
+		double WaitStartTime = 0.0;
 	};
 	TMap<Worker_EntityId_Key, EntityWaitingForAsyncLoad> EntitiesWaitingForAsyncLoad;
 	TMap<FName, TArray<Worker_EntityId>> AsyncLoadingPackages;
+
+	// Packages requested together by bBatchAsyncClassLoads. Entities are only replayed once no package of their batch is still loading.
+	struct AsyncLoadBatch
+	{
+		TSet<FName> LoadingPackages;
+		TArray<Worker_EntityId> LoadedEntities;
+	};
+	TArray<FName> PackagesToRequest;
+	TMap<FName, uint32> PackageToAsyncLoadBatch;
+	TMap<uint32, AsyncLoadBatch> AsyncLoadBatches;
+	uint32 NextAsyncLoadBatchId = 0;
 	// END TODO
 
+	// Entities deferred by bTimeSliceActorSpawning, in the order they will be spawned once sorted.
+	// Entries whose entity left view, or was spawned through another entry, are skipped.
+	TArray<SpatialGDK::FActorSpawnCandidate> DeferredActorSpawns;
+	bool bDeferredActorSpawnsNeedSorting = false;
+	TMap<TWeakObjectPtr<UClass>, float> ActorSpawnPriorityByClass;
+	uint32 ActorsSpawnedThisTick = 0;
+
 	struct DeferredRetire
 	{
 		Worker_EntityId EntityId;
@@ -6,10 +6,14 @@
 
 #include "EngineClasses/SpatialLoadBalanceEnforcer.h"
 #include "EngineClasses/SpatialNetBitWriter.h"
+#include "Interop/Connection/OutgoingMessages.h"
 #include "Interop/SpatialClassInfoManager.h"
 #include "Interop/SpatialRPCService.h"
+#include "Interop/ThreadSafeSubmitQueue.h"
 #include "Schema/RPCPayload.h"
 #include "TimerManager.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/EntityComponentTemplateCache.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
 
@@ -29,6 +33,11 @@ class USpatialStaticComponentView;
 class USpatialClassInfoManager;
 class USpatialWorkerConnection;
 
+namespace SpatialGDK
+{
+struct LevelTombstones;
+} // namespace SpatialGDK
+
 struct FReliableRPCForRetry
 {
 	FReliableRPCForRetry(UObject* InTargetObject, UFunction* InFunction, Worker_ComponentId InComponentId, Schema_FieldId InRPCIndex, const TArray<uint8>& InPayload, int InRetryIndex);
@@ -41,6 +50,25 @@ struct FReliableRPCForRetry
 	int Attempts; // For reliable RPCs
 
 	int RetryIndex; // Index for ordering reliable RPCs on subsequent tries
+
+	// Set while a retry is waiting to be sent, so a second failed response for the same RPC doesn't schedule it twice.
+	bool bRetryScheduled = false;
+	// Set while a retry sent for this RPC is awaiting its response, counted against MaxReliableRPCRetriesInFlight.
+	bool bRetryInFlight = false;
+
+	// Set when Payload holds several cross-server RPCs packed into one command request, in the order they were packed.
+	TArray<UFunction*> PackedFunctions;
+
+	// The entity the last attempt was sent to.
+	Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+};
+
+// Cross-server RPCs to a single entity waiting to be sent as one command request, with bBatchCrossServerRPCs.
+struct FCrossServerRPCBatch
+{
+	TWeakObjectPtr<UObject> TargetObject;
+	TArray<uint8> PackedRPCs;
+	TArray<UFunction*> Functions;
 };
 
 struct FPendingRPC
@@ -59,7 +87,7 @@ struct FPendingRPC
 using FChannelObjectPair = TPair<TWeakObjectPtr<USpatialActorChannel>, TWeakObjectPtr<UObject>>;
 using FRPCsOnEntityCreationMap = TMap<TWeakObjectPtr<const UObject>, SpatialGDK::RPCsOnEntityCreation>;
 using FUpdatesQueuedUntilAuthority = TMap<Worker_EntityId_Key, TArray<FWorkerComponentUpdate>>;
-using FChannelsToUpdatePosition = TSet<TWeakObjectPtr<USpatialActorChannel>>;
+using FChannelsToUpdatePosition = TArray<TWeakObjectPtr<USpatialActorChannel>>;
 
 UCLASS()
 class SPATIALGDK_API USpatialSender : public UObject
@@ -71,8 +99,15 @@ public:
 
 	// Actor Updates
 	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, uint32& OutBytesWritten);
+	// With bBatchSubobjectComponentUpdates, the updates of the channel's actor and subobjects between these calls are created by one
+	// component factory, sharing its serialization buffers, and are sent together by EndComponentUpdateBatch. Components added to or
+	// removed from the entity in between are sent with them, in the order they were added or removed.
+	void BeginComponentUpdateBatch(USpatialActorChannel* Channel);
+	void EndComponentUpdateBatch();
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
+	// Authority intent changes take effect locally straight away, and are sent for every changed entity at once by FlushAuthorityIntentUpdates.
 	void SendAuthorityIntentUpdate(const AActor& Actor, VirtualWorkerId NewAuthoritativeVirtualWorkerId);
+	void FlushAuthorityIntentUpdates();
 	void SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request);
 	FRPCErrorInfo SendRPC(const FPendingRPCParams& Params);
 	void SendOnEntityCreationRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef);
@@ -83,8 +118,10 @@ public:
 	void SendEmptyCommandResponse(Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, Worker_RequestId RequestId);
 	void SendCommandFailure(Worker_RequestId RequestId, const FString& Message);
 	void SendAddComponentForSubobject(USpatialActorChannel* Channel, UObject* Subobject, const FClassInfo& Info, uint32& OutBytesWritten);
+	void SendAddComponentsForSubobjects(USpatialActorChannel* Channel, const TArray<TPair<UObject*, const FClassInfo*>>& Subobjects, uint32& OutBytesWritten);
 	void SendAddComponents(Worker_EntityId EntityId, TArray<FWorkerComponentData> ComponentDatas);
 	void SendRemoveComponentForClassInfo(Worker_EntityId EntityId, const FClassInfo& Info);
+	void SendRemoveComponentsForClassInfos(Worker_EntityId EntityId, const TArray<const FClassInfo*>& Infos);
 	void SendRemoveComponents(Worker_EntityId EntityId, TArray<Worker_ComponentId> ComponentIds);
 	void SendInterestBucketComponentChange(const Worker_EntityId EntityId, const Worker_ComponentId OldComponent, const Worker_ComponentId NewComponent);
 	void SendActorTornOffUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
@@ -95,15 +132,38 @@ public:
 	// Creates an entity containing just a tombstone component and the minimal data to resolve an actor.
 	void CreateTombstoneEntity(AActor* Actor);
 
+	// Creates the persistent entity holding the tombstones of a level's startup actors, used with bCompactStartupActorTombstones.
+	Worker_EntityId CreateLevelTombstonesEntity(const SpatialGDK::LevelTombstones& Tombstones);
+
 	void SendRequestToClearRPCsOnEntityCreation(Worker_EntityId EntityId);
 	void ClearRPCsOnEntityCreation(Worker_EntityId EntityId);
 
 	void SendClientEndpointReadyUpdate(Worker_EntityId EntityId);
 	void SendServerEndpointReadyUpdate(Worker_EntityId EntityId);
 
-	void EnqueueRetryRPC(TSharedRef<FReliableRPCForRetry> RetryRPC);
+	// Schedules a retry after the exponential backoff for the RPC's attempts, with jitter. Returns the wait in seconds,
+	// or a negative value if a retry of the RPC is already scheduled.
+	float EnqueueRetryRPC(TSharedRef<FReliableRPCForRetry> RetryRPC);
 	void FlushRetryRPCs();
 	void RetryReliableRPC(TSharedRef<FReliableRPCForRetry> RetryRPC);
+	// Called when a reliable RPC command gets a response, or won't get one this worker waits for.
+	void OnReliableRPCResponse(FReliableRPCForRetry& ReliableRPC);
+
+	// The jitter only depends on the target object and attempt, so retries of the RPCs to one target keep the order they were sent in.
+	static float GetRetryWaitTime(const FReliableRPCForRetry& RetryRPC, float Jitter);
+
+	double GetNumRetriedRPCs() const { return static_cast<double>(NumRetriedRPCs); }
+	double GetNumQueuedRetryRPCs() const { return static_cast<double>(RetryRPCs.Num()); }
+	double GetNumDeduplicatedRetryRPCs() const { return static_cast<double>(NumDeduplicatedRetryRPCs); }
+	uint32 GetNumRetryRPCsInFlight() const { return NumRetryRPCsInFlight; }
+	uint32 GetNumExpiredRPCs() const { return OutgoingRPCs.GetNumExpiredRPCs(); }
+	SIZE_T GetOutgoingRPCsAllocatedSize() const { return OutgoingRPCs.GetAllocatedSize(); }
+
+	// Bytes used by the RPCs, batches and updates waiting to be sent other than OutgoingRPCs, for the memory report.
+	SIZE_T GetOutgoingQueuesAllocatedSize() const;
+
+	// Sends every cross-server RPC batch queued this tick with bBatchCrossServerRPCs.
+	void FlushCrossServerRPCBatches();
 
 	void RegisterChannelForPositionUpdate(USpatialActorChannel* Channel);
 	void ProcessPositionUpdates();
@@ -112,12 +172,22 @@ public:
 	void UpdateInterestComponent(AActor* Actor);
 
 	void ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload&& InPayload);
+	void ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, ERPCType RPCType, SpatialGDK::RPCPayload&& InPayload);
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
 	void FlushRPCService();
+	// Sends the RPCs and acks pending for one entity straight away, such as for a latency critical RPC.
+	void FlushRPCService(Worker_EntityId EntityId);
+
+	// Batches of component updates and RPCs submitted from other threads. Can be kept by those threads, and outlives the sender.
+	TSharedRef<SpatialGDK::FThreadSafeSubmitQueue, ESPMode::ThreadSafe> GetSubmitQueue() const { return SubmitQueue; }
+	// Sends the batches submitted since the last call, in order, for the entity components this worker is authoritative over.
+	void MergeSubmittedBatches();
 
 	SpatialGDK::RPCPayload CreateRPCPayloadFromParams(UObject* TargetObject, const FUnrealObjectRef& TargetObjectRef, UFunction* Function, void* Params);
+	SpatialGDK::RPCPayload CreateRPCPayloadFromParams(UObject* TargetObject, const FUnrealObjectRef& TargetObjectRef, UFunction* Function, const FRPCInfo& RPCInfo, void* Params);
 	void GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info);
+	void GainAuthorityThenAddComponents(USpatialActorChannel* Channel, const TArray<TPair<UObject*, const FClassInfo*>>& Subobjects);
 
 	// Creates an entity authoritative on this server worker, ensuring it will be able to receive updates for the GSM.
 	UFUNCTION()
@@ -128,6 +198,8 @@ public:
 	void ClearPendingRPCs(const Worker_EntityId EntityId);
 
 	bool ValidateOrExit_IsSupportedClass(const FString& PathName);
+	// As above, but remembers the classes which have been validated so that checking them again doesn't build their path.
+	bool ValidateOrExit_IsSupportedClass(UClass* Class);
 
 private:
 	// Create a copy of an array of components. Deep copies all Schema_ComponentData.
@@ -146,11 +218,15 @@ private:
 
 	void PeriodicallyProcessOutgoingRPCs();
 
+	void BatchCrossServerRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef);
+	void SendCrossServerRPCBatch(Worker_EntityId EntityId, const FCrossServerRPCBatch& Batch, bool bReliable);
+
 	// RPC Construction
-	FSpatialNetBitWriter PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters) const;
+	void PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, FSpatialNetBitWriter& PayloadWriter) const;
 
 	Worker_CommandRequest CreateRPCCommandRequest(UObject* TargetObject, const SpatialGDK::RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, Worker_EntityId& OutEntityId);
 	Worker_CommandRequest CreateRetryRPCCommandRequest(const FReliableRPCForRetry& RPC, uint32 TargetObjectOffset);
+	Worker_CommandRequest CreatePackedRPCCommandRequest(Worker_ComponentId ComponentId, const TArray<uint8>& PackedRPCs);
 	FWorkerComponentUpdate CreateRPCEventUpdate(UObject* TargetObject, const SpatialGDK::RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId EventIndext);
 
 	// RPC Tracking
@@ -160,6 +236,11 @@ private:
 
 	bool WillHaveAuthorityOverActor(AActor* TargetActor, Worker_EntityId TargetEntity);
 
+	TUniquePtr<SpatialGDK::ComponentFactory> CreateUpdateFactory(USpatialActorChannel* Channel, USpatialLatencyTracer* Tracer) const;
+	bool IsBatchingEntity(Worker_EntityId EntityId) const;
+	void AddToComponentUpdateBatch(const FWorkerComponentUpdate& Update);
+	void SendComponentUpdatesToEntity(Worker_EntityId EntityId, TArray<FWorkerComponentUpdate>& ComponentUpdates);
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -183,12 +264,78 @@ private:
 
 	SpatialGDK::SpatialRPCService* RPCService;
 
+	TSet<TWeakObjectPtr<UClass>> SupportedClasses;
+
+	// Reused to serialize every outgoing RPC, so that in the steady state its buffer is already big enough and isn't reallocated per RPC.
+	TUniquePtr<FSpatialNetBitWriter> RPCPayloadWriter;
+
+	// Only created when bCacheEntityComponentTemplates is set.
+	TUniquePtr<SpatialGDK::FEntityComponentTemplateCache> EntityComponentTemplateCache;
+
 	FRPCContainer OutgoingRPCs{ ERPCQueueType::Send };
+
+	TSharedRef<SpatialGDK::FThreadSafeSubmitQueue, ESPMode::ThreadSafe> SubmitQueue = MakeShared<SpatialGDK::FThreadSafeSubmitQueue, ESPMode::ThreadSafe>();
+	TArray<SpatialGDK::FSubmitBatch> SubmittedBatchesToMerge;
 	FRPCsOnEntityCreationMap OutgoingOnCreateEntityRPCs;
 
-	TArray<TSharedRef<FReliableRPCForRetry>> RetryRPCs;
+	struct FScheduledRetryRPC
+	{
+		double RetryTime;
+		TSharedRef<FReliableRPCForRetry> RPC;
+
+		bool operator<(const FScheduledRetryRPC& Other) const { return RetryTime < Other.RetryTime; }
+	};
+
+	// A min-heap on retry time, so a flush only looks at the retries which are due.
+	TArray<FScheduledRetryRPC> RetryRPCs;
+	uint32 NumRetryRPCsInFlight = 0;
+	uint64 NumRetriedRPCs = 0;
+	uint64 NumDeduplicatedRetryRPCs = 0;
+
+	TMap<Worker_EntityId_Key, FCrossServerRPCBatch> ReliableCrossServerRPCBatches;
+	TMap<Worker_EntityId_Key, FCrossServerRPCBatch> UnreliableCrossServerRPCBatches;
 
 	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthorityMap;
 
+	// A message to the entity of the batch, only one of Update, Data or ComponentId is set depending on its type.
+	struct FBatchedEntityMessage
+	{
+		SpatialGDK::EOutgoingMessageType Type;
+		FWorkerComponentUpdate Update;
+		FWorkerComponentData Data;
+		Worker_ComponentId ComponentId;
+	};
+
+	// The messages to the channel's entity between BeginComponentUpdateBatch and EndComponentUpdateBatch.
+	struct FComponentUpdateBatch
+	{
+		USpatialActorChannel* Channel = nullptr;
+		Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+		TUniquePtr<SpatialGDK::ComponentFactory> UpdateFactory;
+		TArray<FBatchedEntityMessage> Messages;
+	};
+	FComponentUpdateBatch ComponentUpdateBatch;
+
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
+
+	struct FPendingAuthorityIntentUpdate
+	{
+		Worker_EntityId EntityId;
+		// The entity of the actor's ownership hierarchy root, or the actor's own entity if it has no owner.
+		Worker_EntityId HierarchyRootEntityId;
+	};
+	// One entry per entity, however many times its intent changed since the last flush.
+	TMap<Worker_EntityId_Key, FPendingAuthorityIntentUpdate> PendingAuthorityIntentUpdates;
+	TArray<FPendingAuthorityIntentUpdate> AuthorityIntentUpdatesToFlush;
+
+	// Structure of arrays filled by ProcessPositionUpdates, so the distance threshold is checked in one loop over contiguous
+	// positions that the compiler can vectorize. Kept between ticks so the buffers are not reallocated.
+	struct FPositionUpdateBatch
+	{
+		TArray<USpatialActorChannel*> Channels;
+		TArray<float> X, Y, Z;
+		TArray<float> LastX, LastY, LastZ;
+		TArray<uint8> bMoved;
+	};
+	FPositionUpdateBatch PositionUpdateBatch;
 };
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Interop/RuntimeCheckpoints.h"
 #include "Utils/SchemaUtils.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -26,9 +27,28 @@ public:
 
 	void WorldWipe(const PostWorldWipeDelegate& Delegate);
 	void LoadSnapshot(const FString& SnapshotName);
+	// Loads the newest state of every entity written by runtime checkpoints to CheckpointDirectory, see FRuntimeCheckpointer.
+	void LoadCheckpoint(const FString& CheckpointDirectory);
 
 private:
-	static void DeleteEntities(const Worker_EntityQueryResponseOp& Op, TWeakObjectPtr<USpatialWorkerConnection> Connection);
+	// State of a world wipe in progress. Shared with the response delegates, so it can outlive the snapshot manager.
+	struct FWorldWipe;
+
+	// Number of world entity queries after which a world wipe finishes even if some entities could not be deleted.
+	static constexpr int32 MaxWorldWipeQueries = 4;
+
+	static void QueryEntitiesToDelete(const TSharedRef<FWorldWipe>& Wipe);
+	static void DeleteEntities(const TSharedRef<FWorldWipe>& Wipe);
+
+	// State of a snapshot being loaded. Shared with the response delegates, so it can outlive the snapshot manager.
+	struct FStreamingSnapshotLoad;
+
+	// CheckpointFilter is set when loading the chunks of a checkpoint.
+	void StartLoadSnapshot(TArray<FString>&& SnapshotPaths, TOptional<SpatialGDK::FCheckpointRestoreFilter>&& CheckpointFilter);
+	static bool OpenNextSnapshot(FStreamingSnapshotLoad& Load);
+	static void ContinueLoadSnapshot(const TSharedRef<FStreamingSnapshotLoad>& Load);
+	static void CreateEntities(const TSharedRef<FStreamingSnapshotLoad>& Load, const Worker_ReserveEntityIdsResponseOp& Op);
+	static void FinishLoadSnapshot(const TSharedRef<FStreamingSnapshotLoad>& Load);
 
 	TWeakObjectPtr<USpatialWorkerConnection> Connection;
 	TWeakObjectPtr<UGlobalStateManager> GlobalStateManager;
@@ -2,14 +2,17 @@
 
 #pragma once
 
+#include "Interop/SpatialFlatComponentStorage.h"
 #include "Schema/Component.h"
 #include "Schema/StandardLibrary.h"
 #include "SpatialConstants.h"
+#include "SpatialView/ComponentData.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
 
 #include "Containers/Map.h"
+#include "Templates/Atomic.h"
 #include "Templates/UniquePtr.h"
 #include "UObject/Object.h"
 
@@ -21,20 +24,20 @@ class SPATIALGDK_API USpatialStaticComponentView : public UObject
 	GENERATED_BODY()
 
 public:
+	virtual void PostInitProperties() override;
+
 	bool HasAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
 
 	template <typename T>
 	T* GetComponentData(Worker_EntityId EntityId) const
 	{
-		if (const auto* ComponentStorageMap = EntityComponentMap.Find(EntityId))
+		const int32 TypeIndex = SpatialGDK::FSpatialFlatComponentStorage::GetHandwrittenComponentIndex(T::ComponentId);
+		if (TypeIndex != INDEX_NONE)
 		{
-			if (const TUniquePtr<SpatialGDK::Component>* Component = ComponentStorageMap->Find(T::ComponentId))
-			{
-				return static_cast<T*>(Component->Get());
-			}
+			ReadCounts[TypeIndex]++;
 		}
 
-		return nullptr;
+		return FindComponentData<T>(EntityId);
 	}
 
 	bool HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
@@ -45,11 +48,70 @@ public:
 	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op);
 	void OnAuthorityChange(const Worker_AuthorityChangeOp& Op);
 
-	void GetEntityIds(TArray<Worker_EntityId_Key>& OutEntityIds) const { EntityComponentMap.GetKeys(OutEntityIds); }
+	void GetEntityIds(TArray<Worker_EntityId_Key>& OutEntityIds) const;
+	int32 GetNumEntities() const;
+
+	// Logs the number of components of each type in the view, the memory used by their data and by the view's containers,
+	// and how many times the data of each hand-written component type has been read.
+	// Data sizes only include the hand-written component objects themselves, not memory owned by their members.
+	void LogMemoryReport() const;
+	// The total of the component data and container bytes in the memory report.
+	SIZE_T GetAllocatedSize() const;
+	// Number of GetComponentData calls for a hand-written component type, 0 for any other component.
+	uint64 GetNumReads(Worker_ComponentId ComponentId) const;
+
+	// Keeps a copy of the data of every component in view, generated ones included, for CreateViewOps.
+	void SetKeepAllComponentData(bool bInKeepAllComponentData);
+	// Appends a critical section adding every entity in view with its components and authority, as the runtime would when checking
+	// them out, so that the view of a connection kept across travel can be delivered to the next net driver. OutData owns the
+	// component data that the ops point to. Requires SetKeepAllComponentData to have been enabled before the entities were added.
+	void CreateViewOps(TArray<Worker_Op>& OutOps, TArray<SpatialGDK::ComponentData>& OutData) const;
 
 private:
+	// Returns the bytes used by the view's containers.
+	SIZE_T GetComponentCounts(TMap<Worker_ComponentId, int32>& OutComponentCounts) const;
+	SIZE_T GetComponentDataBytes(Worker_ComponentId ComponentId, int32 Count) const;
+	bool IsComponentDataStored(Worker_ComponentId ComponentId) const;
+
+	// Lookup used by the view itself, which isn't counted as a read.
+	template <typename T>
+	T* FindComponentData(Worker_EntityId EntityId) const
+	{
+		if (bUseFlatStorage)
+		{
+			return static_cast<T*>(FlatStorage.GetComponent(EntityId, T::ComponentId));
+		}
+
+		if (const auto* ComponentStorageMap = EntityComponentMap.Find(EntityId))
+		{
+			if (const TUniquePtr<SpatialGDK::Component>* Component = ComponentStorageMap->Find(T::ComponentId))
+			{
+				return static_cast<T*>(Component->Get());
+			}
+		}
+
+		return nullptr;
+	}
+
 	Worker_Authority GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
+	TUniquePtr<SpatialGDK::Component> CreateComponentData(const Worker_AddComponentOp& Op) const;
+
+	// Set from bUseFlatStaticComponentView. When enabled, FlatStorage is used instead of the maps below.
+	bool bUseFlatStorage = false;
+	SpatialGDK::FSpatialFlatComponentStorage FlatStorage;
+
+	// Set from StaticComponentViewStoredComponentIds. When not empty, the data of other components isn't kept, except for
+	// the components the GDK reads itself.
+	TSet<Worker_ComponentId> StoredComponentIds;
+
+	// Number of GetComponentData calls per hand-written component type, for LogMemoryReport. The view can be read from
+	// worker threads, so the counts are atomic.
+	mutable TAtomic<uint64> ReadCounts[SpatialGDK::FSpatialFlatComponentStorage::NumHandwrittenComponents] = {};
 
 	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, Worker_Authority>> EntityComponentAuthorityMap;
 	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, TUniquePtr<SpatialGDK::Component>>> EntityComponentMap;
+
+	// Set by SetKeepAllComponentData. The latest data of every component, with the received updates applied to it.
+	bool bKeepAllComponentData = false;
+	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, SpatialGDK::ComponentData>> AllComponentData;
 };
@@ -2,12 +2,66 @@
 
 #pragma once
 
+#include "Templates/SharedPointer.h"
+
 #include <WorkerSDK/improbable/c_worker.h>
 #include "SpatialWorkerFlags.generated.h"
 
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnWorkerFlagsUpdatedBP, const FString&, FlagName, const FString&, FlagValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWorkerFlagsUpdated, const FString&, FlagName, const FString&, FlagValue);
 
+// Value of a worker flag parsed into every supported type, shared by all handles to the flag and updated in place when it changes.
+struct FWorkerFlagValue
+{
+	void Set(const FString& InValue)
+	{
+		IntValue = FCString::Atoi(*InValue);
+		FloatValue = FCString::Atof(*InValue);
+		bBoolValue = FCString::ToBool(*InValue);
+		bIsSet = true;
+	}
+
+	void Reset()
+	{
+		*this = FWorkerFlagValue();
+	}
+
+	int32 IntValue = 0;
+	float FloatValue = 0.0f;
+	bool bBoolValue = false;
+	bool bIsSet = false;
+};
+
+/**
+ * Typed handle to a worker flag, resolved once with USpatialWorkerFlags::GetWorkerFlagHandle. Reading it doesn't look up or parse the
+ * flag, so it's cheap enough for per-tick reads. Supports int32, float and bool.
+ */
+template <typename T>
+class TWorkerFlagHandle
+{
+public:
+	TWorkerFlagHandle() = default;
+
+	bool IsSet() const { return Value.IsValid() && Value->bIsSet; }
+
+	// Returns the flag's value, or DefaultValue while the flag isn't set.
+	T Get(T DefaultValue) const { return IsSet() ? GetParsedValue() : DefaultValue; }
+
+private:
+	friend class USpatialWorkerFlags;
+
+	explicit TWorkerFlagHandle(const TSharedRef<const FWorkerFlagValue>& InValue)
+		: Value(InValue) {}
+
+	T GetParsedValue() const;
+
+	TSharedPtr<const FWorkerFlagValue> Value;
+};
+
+template <> inline int32 TWorkerFlagHandle<int32>::GetParsedValue() const { return Value->IntValue; }
+template <> inline float TWorkerFlagHandle<float>::GetParsedValue() const { return Value->FloatValue; }
+template <> inline bool TWorkerFlagHandle<bool>::GetParsedValue() const { return Value->bBoolValue; }
+
 UCLASS()
 class SPATIALGDK_API USpatialWorkerFlags : public UObject
 {
@@ -21,6 +75,16 @@ public:
 	 */
 	bool GetWorkerFlag(const FString& InFlagName, FString& OutFlagValue) const;
 
+	/** Gets a typed handle to a worker flag, which is kept up to date as the flag changes. The flag doesn't need to be set yet.
+	 * @param InFlagName - Name of worker flag
+	 * @return - Handle to read the parsed value of the worker flag with.
+	 */
+	template <typename T>
+	TWorkerFlagHandle<T> GetWorkerFlagHandle(const FString& InFlagName)
+	{
+		return TWorkerFlagHandle<T>(FindOrAddFlagValue(InFlagName));
+	}
+
 	UFUNCTION(BlueprintCallable, Category = "SpatialOS")
 	void BindToOnWorkerFlagsUpdated(const FOnWorkerFlagsUpdatedBP& InDelegate);
 
@@ -30,8 +94,12 @@ public:
 	void ApplyWorkerFlagUpdate(const Worker_FlagUpdateOp& Op);
 
 private:
+	TSharedRef<const FWorkerFlagValue> FindOrAddFlagValue(const FString& InFlagName);
 
 	FOnWorkerFlagsUpdated OnWorkerFlagsUpdated;
 
 	TMap<FString, FString> WorkerFlags;
+
+	// Parsed values of the flags handles have been requested for.
+	TMap<FString, TSharedRef<FWorkerFlagValue>> FlagValues;
 };
@@ -0,0 +1,132 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/LevelTombstones.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogStartupActorTombstones, Log, All);
+
+class AActor;
+class ULevel;
+class USpatialNetDriver;
+
+namespace SpatialGDK
+{
+
+// Entities of retired startup actors, which are only deleted once their tombstone IDs are known to be written to the level's
+// entity, so the actors can't be loaded again if the write is lost.
+class SPATIALGDK_API FPendingTombstoneDeletions
+{
+public:
+	void Add(uint64 TombstoneId, Worker_EntityId EntityId);
+
+	// Removes and returns the entities whose tombstone IDs are in the sorted list.
+	TArray<Worker_EntityId> Confirm(const TArray<uint64>& SortedIds);
+
+	int32 Num() const { return Entities.Num(); }
+
+private:
+	TMultiMap<uint64, Worker_EntityId> Entities;
+};
+
+// Tracks destroyed startup actors with one LevelTombstones entity per level, instead of one tombstone entity per actor.
+// Each set is written by whichever server is authoritative over the level's entity; other servers send the IDs of the
+// actors they destroy to that entity, or to the StartupActorManager on the GSM while no entity exists for the level yet.
+// Every worker checks the sets out as always relevant, and destroys tombstoned actors as their levels are loaded.
+class SPATIALGDK_API FStartupActorTombstones
+{
+public:
+	explicit FStartupActorTombstones(USpatialNetDriver* InNetDriver);
+
+	// Hash of the remapped stable path name of a startup actor, which is what the LevelTombstones sets contain.
+	static uint64 GetTombstoneId(const FString& RemappedPathName);
+	uint64 GetTombstoneId(const AActor& Actor) const;
+	FString GetLevelPath(const ULevel& Level) const;
+
+	bool IsTombstoned(const AActor& Actor) const;
+
+	// Adds the actor to the set for its level, to be sent on the next Advance. Only called on servers. A valid EntityId is deleted
+	// once the tombstone has been written.
+	void TombstoneActor(const AActor& Actor, Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID);
+
+	// Destroys the loaded actors of the level which have been tombstoned and aren't already resolved to an entity.
+	void DestroyTombstonedActors(ULevel* Level);
+
+	void OnLevelTombstonesAdded(Worker_EntityId EntityId, const Worker_ComponentData& Data);
+	void OnLevelTombstonesUpdated(Worker_EntityId EntityId, const Worker_ComponentUpdate& Update);
+	void OnLevelTombstonesAuthorityGained(Worker_EntityId EntityId);
+
+	// Handles the tombstone_startup_actors command on both LevelTombstones entities and the GSM's StartupActorManager. The response
+	// is only sent once the IDs have been written to the level's entity.
+	void OnTombstoneStartupActorsRequest(const Worker_CommandRequestOp& Op);
+	void OnTombstoneStartupActorsResponse(const Worker_CommandResponseOp& Op);
+
+	// Sends pending tombstones at most once per FlushIntervalSeconds.
+	void Advance(double CurrentTime);
+
+	static constexpr double FlushIntervalSeconds = 1.0;
+	// Requests to a worker that isn't observed to apply them within this time are sent again.
+	static constexpr double RequestRetrySeconds = 5.0;
+
+private:
+	struct FLevelTombstoneSet
+	{
+		// Union of the IDs on every entity seen for the level, and the ones tombstoned locally.
+		LevelTombstones Tombstones;
+
+		// There should be a single entity per level, but if duplicates are created the lowest entity ID is written to.
+		Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+
+		// Sorted IDs not yet seen on the level's entity.
+		TArray<uint64> PendingIds;
+		// Requests from other workers, answered once PendingIds have been written.
+		struct FPendingResponse
+		{
+			Worker_RequestId RequestId;
+			Worker_ComponentId ComponentId;
+			Schema_FieldId CommandIndex;
+		};
+		TArray<FPendingResponse> PendingResponses;
+
+		double LastRequestTime = 0.0;
+		bool bRequestInFlight = false;
+		bool bCreationRequested = false;
+		bool bDirty = false;
+	};
+
+	FLevelTombstoneSet& FindOrAddLevel(const FString& LevelPath);
+	void MergeIds(FLevelTombstoneSet& Set, const TArray<uint64>& SortedIds, bool bFromEntity);
+	void OnEntityTombstones(Worker_EntityId EntityId, const LevelTombstones& EntityTombstones);
+
+	void FlushLevel(const FString& LevelPath, FLevelTombstoneSet& Set, double CurrentTime);
+	void WriteLevel(FLevelTombstoneSet& Set);
+	void SendTombstoneRequest(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, const FString& LevelPath, const TArray<uint64>& Ids);
+
+	void OnIdsWritten(FLevelTombstoneSet& Set, const TArray<uint64>& SortedIds);
+
+	void DestroyTombstonedActors(const FString& LevelPath);
+
+	USpatialNetDriver* NetDriver;
+
+	TMap<FString, FLevelTombstoneSet> Levels;
+	TMap<Worker_EntityId_Key, FString> EntityLevels;
+
+	struct FSentRequest
+	{
+		FString LevelPath;
+		TArray<uint64> Ids;
+	};
+	TMap<Worker_RequestId_Key, FSentRequest> SentRequests;
+
+	FPendingTombstoneDeletions PendingDeletions;
+
+	double LastFlushTime = 0.0;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "CoreMinimal.h"
+#include "Schema/RPCPayload.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+#include "Templates/Atomic.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Component updates and RPCs for entities this worker is authoritative over, built on any thread and submitted together with
+ * FThreadSafeSubmitQueue. Entries are sent in the order they were added. A batch is only used by one thread at a time.
+ */
+class SPATIALGDK_API FSubmitBatch
+{
+public:
+	struct FEntry
+	{
+		Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+		// Set for component updates. The batch owns the schema data until it is sent, which clears schema_type.
+		FWorkerComponentUpdate Update{};
+		// Set for RPCs, sent through the RPC ring buffers.
+		ERPCType RPCType = ERPCType::Invalid;
+		TOptional<RPCPayload> Payload;
+	};
+
+	FSubmitBatch() = default;
+	FSubmitBatch(FSubmitBatch&& Other) = default;
+	FSubmitBatch& operator=(FSubmitBatch&& Other) = default;
+	// Destroys the schema data of updates which were never sent.
+	~FSubmitBatch();
+
+	// Takes ownership of the update's schema data.
+	void AddComponentUpdate(Worker_EntityId EntityId, const FWorkerComponentUpdate& Update);
+	void AddRPC(Worker_EntityId EntityId, ERPCType Type, RPCPayload&& Payload);
+
+	bool IsEmpty() const { return Entries.Num() == 0; }
+	int32 Num() const { return Entries.Num(); }
+
+	TArray<FEntry>& GetEntries() { return Entries; }
+
+private:
+	TArray<FEntry> Entries;
+};
+
+/**
+ * Lets gameplay code running on task graph or other worker threads send component updates and RPCs without marshalling back
+ * to the game thread. Batches can be submitted from any thread and are merged into the outgoing path by USpatialSender on the
+ * game thread during TickFlush, where authority is checked and RPCs are pushed to the RPC service.
+ *
+ * Batches are merged in the order they were submitted, and entries within a batch in the order they were added, so the messages
+ * for an entity keep their order as long as the threads submitting them do. Messages sent directly from the game thread during
+ * the tick are sent before the batches merged at the end of it.
+ */
+class SPATIALGDK_API FThreadSafeSubmitQueue
+{
+public:
+	// Thread safe. Empty batches are ignored.
+	void Submit(FSubmitBatch&& Batch);
+
+	// Game thread only. Moves every batch submitted so far into OutBatches, in submission order.
+	void Drain(TArray<FSubmitBatch>& OutBatches);
+
+	// Thread safe.
+	int32 GetNumPendingBatches() const { return NumPendingBatches.Load(); }
+	uint64 GetNumSubmittedEntries() const { return NumSubmittedEntries.Load(); }
+
+private:
+	TQueue<FSubmitBatch, EQueueMode::Mpsc> Batches;
+	TAtomic<int32> NumPendingBatches{ 0 };
+	TAtomic<uint64> NumSubmittedEntries{ 0 };
+};
+
+} // namespace SpatialGDK
@@ -6,7 +6,9 @@
 #include "SpatialConstants.h"
 
 #include "CoreMinimal.h"
+#include "Math/Box2D.h"
 #include "Schema/Interest.h"
+#include "Utils/WorkerLoadVector.h"
 #include "UObject/NoExportTypes.h"
 
 #include "AbstractLBStrategy.generated.h"
@@ -32,6 +34,8 @@ class SPATIALGDK_API UAbstractLBStrategy : public UObject
 public:
 	UAbstractLBStrategy();
 
+	using LBStrategyRegions = TArray<TPair<VirtualWorkerId, FBox2D>>;
+
 	virtual void Init() {}
 
 	bool IsReady() const { return LocalVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID; }
@@ -45,19 +49,65 @@ public:
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const { return false; }
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const PURE_VIRTUAL(UAbstractLBStrategy::WhoShouldHaveAuthority, return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;)
 
+	/**
+	* Batch versions of ShouldHaveAuthority and WhoShouldHaveAuthority, writing one result per actor in the same order.
+	* The default implementations call the single actor versions. Strategies can override them to share work between actors.
+	*/
+	virtual void ShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<bool>& OutShouldHaveAuthority) const;
+	virtual void WhoShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const;
+
+	/**
+	* Whether ShouldHaveAuthorityForActors can be called for separate batches of actors from several threads at once, once
+	* PrepareParallelAuthorityQueries has been called on the game thread with all of those actors. Strategies which fill caches
+	* while deciding on authority fill them for all the actors in PrepareParallelAuthorityQueries.
+	*/
+	virtual bool SupportsParallelAuthorityQueries() const { return false; }
+	virtual void PrepareParallelAuthorityQueries(const TArray<const AActor*>& Actors) const {}
+
+	/**
+	* Called on the worker authoritative over the Actor when ShouldHaveAuthority returned false. Returning true keeps authority
+	* for now, so strategies can add a hysteresis band around their regions for actors moving back and forth across a boundary.
+	*/
+	virtual bool ShouldRetainAuthority(const AActor& Actor) const { return false; }
+
 	/**
 	* Get the query constraints required by this worker based on the load balancing strategy used.
 	*/
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const PURE_VIRTUAL(UAbstractLBStrategy::GetWorkerInterestQueryConstraint, return {};)
 
+	/**
+	* Get the query constraints of a standby worker for the virtual worker it takes over if that virtual worker's server worker is lost.
+	* Usable before this worker has a virtual worker of its own. Strategies without a region per virtual worker return an invalid constraint.
+	*/
+	virtual SpatialGDK::QueryConstraint GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const { return {}; }
+
 	/** True if this load balancing strategy requires handover data to be transmitted. */
 	virtual bool RequiresHandoverData() const PURE_VIRTUAL(UAbstractLBStrategy::RequiresHandover, return false;)
 
+	/**
+	* True if the Actor is within Distance of a region this worker is not authoritative over, so it may soon need to hand over.
+	* Strategies that cannot tell return true.
+	*/
+	virtual bool IsNearWorkerBoundary(const AActor& Actor, float Distance) const { return true; }
+
+	/**
+	* True if the Actor is outside the region this worker is authoritative over but within Distance of it, so authority over it
+	* may soon move to this worker. Strategies that cannot tell return false.
+	*/
+	virtual bool IsNearLocalRegion(const AActor& Actor, float Distance) const { return false; }
+
 	/**
 	* Get a logical worker entity position for this strategy. For example, the centre of a grid square in a grid-based strategy. Optional- otherwise returns the origin.
 	*/
 	virtual FVector GetWorkerEntityPosition() const { return FVector::ZeroVector; }
 
+	/**
+	* Get the region of each virtual worker, for strategies which have one, so they can be visualised. Optional- otherwise returns no regions.
+	* GetRegionsVersion changes whenever the regions do, so users such as the debugger can tell when to get them again.
+	*/
+	virtual LBStrategyRegions GetLBStrategyRegions() const { return {}; }
+	virtual uint32 GetRegionsVersion() const { return 0; }
+
 	/**
 	 * GetMinimumRequiredWorkers and SetVirtualWorkerIds are used to assign ranges of virtual worker IDs which will be managed by this strategy.
 	 * LastVirtualWorkerId - FirstVirtualWorkerId + 1  is guaranteed to be >= GetMinimumRequiredWorkers.
@@ -65,6 +115,29 @@ public:
 	virtual uint32 GetMinimumRequiredWorkers() const PURE_VIRTUAL(UAbstractLBStrategy::GetMinimumRequiredWorkers, return 0;)
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) PURE_VIRTUAL(UAbstractLBStrategy::SetVirtualWorkerIds, return;)
 
+	/**
+	* Strategies whose regions change at runtime based on load. The worker authoritative over the virtual worker translation
+	* reports each virtual worker's load and calls RebalanceRegions, then shares the regions with all other workers
+	* through WriteRegionsToSchema and ApplyRegionsFromSchema. Both return true if the regions changed.
+	*/
+	virtual bool RequiresWorkerLoadReports() const { return false; }
+	virtual void ReportWorkerLoad(VirtualWorkerId WorkerId, double Load) {}
+	// Also called, before ReportWorkerLoad, for workers which report what their load is made of with bReportWorkerLoadVector.
+	virtual void ReportWorkerLoadVector(VirtualWorkerId WorkerId, const SpatialGDK::FWorkerLoadVector& LoadVector) {}
+	virtual bool RebalanceRegions() { return false; }
+	virtual void WriteRegionsToSchema(Schema_Object* Object) const {}
+	virtual bool ApplyRegionsFromSchema(Schema_Object* Object) { return false; }
+
+	/**
+	* Strategies which change how many virtual workers they use at runtime. The translation manager publishes the mapping once every
+	* virtual worker required to start has a server worker, and assigns the others as server workers join. ReportWorkerLost is called on
+	* the worker authoritative over the virtual worker translation when the server worker assigned to a virtual worker leaves.
+	* GetDesiredWorkerCount is the number of server workers the strategy would use for the current load, for scaling the deployment.
+	*/
+	virtual bool IsVirtualWorkerRequiredToStart(VirtualWorkerId WorkerId) const { return true; }
+	virtual void ReportWorkerLost(VirtualWorkerId WorkerId) {}
+	virtual uint32 GetDesiredWorkerCount() const { return GetMinimumRequiredWorkers(); }
+
 protected:
 
 	VirtualWorkerId LocalVirtualWorkerId;
@@ -0,0 +1,169 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2D.h"
+
+#include "DynamicGridLBStrategy.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDynamicGridLBStrategy, Log, All)
+
+/**
+ * A load balancing strategy that starts as a Rows * Cols grid like UGridBasedLBStrategy, but moves cell boundaries
+ * based on the load each virtual worker reports.
+ *
+ * The world is split with two levels of a k-d tree: first into Cols columns along the y-axis, then each column
+ * independently into Rows cells along the x-axis. When rebalancing, every boundary between two neighbouring columns,
+ * and between two neighbouring cells of a column, moves towards the more loaded side by a fraction of that side's size.
+ * Boundaries only move when the load difference exceeds LoadImbalanceThreshold, so small fluctuations don't cause
+ * authority to flip back and forth.
+ *
+ * The worker authoritative over the virtual worker translation gathers load reports and rebalances, then shares the new
+ * boundaries with every other worker through the translation component, so all workers agree on the regions.
+ *
+ * With bElasticCellCount, only some of the cells are used, in cell order, and the others have no area. Another cell is used when
+ * the average load goes over ScaleUpLoadThreshold and its virtual worker has a server worker, and grows as its neighbours shed load
+ * to it. The last cell in use is drained when the average load goes under ScaleDownLoadThreshold, shrinking by MaxBoundaryMoveFraction
+ * of its size per rebalance, so authority migrates gradually. Server workers of unused cells hold no authority and can be stopped.
+ *
+ * Given a Point, for each Cell:
+ * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
+ */
+UCLASS(Blueprintable)
+class SPATIALGDK_API UDynamicGridLBStrategy : public UAbstractLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+	UDynamicGridLBStrategy();
+
+/* UAbstractLBStrategy Interface */
+	virtual void Init() override;
+
+	virtual void SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId) override;
+	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const override;
+
+	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
+	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual bool SupportsParallelAuthorityQueries() const override { return true; }
+
+	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+	virtual SpatialGDK::QueryConstraint GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const override;
+
+	virtual bool RequiresHandoverData() const override { return Rows * Cols > 1; }
+
+	virtual FVector GetWorkerEntityPosition() const override;
+	virtual LBStrategyRegions GetLBStrategyRegions() const override;
+	// Incremented every time the regions change.
+	virtual uint32 GetRegionsVersion() const override { return RegionsVersion; }
+
+	virtual uint32 GetMinimumRequiredWorkers() const override;
+	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
+
+	virtual bool RequiresWorkerLoadReports() const override { return Rows * Cols > 1; }
+	virtual void ReportWorkerLoad(VirtualWorkerId WorkerId, double Load) override;
+	virtual bool RebalanceRegions() override;
+
+	virtual void WriteRegionsToSchema(Schema_Object* Object) const override;
+	virtual bool ApplyRegionsFromSchema(Schema_Object* Object) override;
+
+	virtual bool IsVirtualWorkerRequiredToStart(VirtualWorkerId WorkerId) const override;
+	virtual void ReportWorkerLost(VirtualWorkerId WorkerId) override;
+	virtual uint32 GetDesiredWorkerCount() const override;
+/* End UAbstractLBStrategy Interface */
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	uint32 Rows;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	uint32 Cols;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	float WorldWidth;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	float WorldHeight;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Dynamic Grid Load Balancing")
+	float InterestBorder;
+
+	/** Relative load difference between two neighbouring regions, in [0, 1], below which their boundary is left where it is. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", ClampMax = "1"), Category = "Dynamic Grid Load Balancing")
+	float LoadImbalanceThreshold;
+
+	/** Largest fraction of the more loaded region's size a boundary can move by in one rebalance. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", ClampMax = "0.5"), Category = "Dynamic Grid Load Balancing")
+	float MaxBoundaryMoveFraction;
+
+	/** Regions are never shrunk below this width or height, in cm. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Dynamic Grid Load Balancing")
+	float MinCellSize;
+
+	/** Weight of the latest load report when smoothing each worker's load. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", ClampMax = "1"), Category = "Dynamic Grid Load Balancing")
+	float LoadSmoothingFactor;
+
+	/** Change the number of cells in use, and so the number of server workers with authority, based on load. */
+	UPROPERTY(EditDefaultsOnly, Category = "Dynamic Grid Load Balancing")
+	bool bElasticCellCount;
+
+	/** Number of cells in use at startup, which the number of cells in use never drops below, when bElasticCellCount is set. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1", EditCondition = "bElasticCellCount"), Category = "Dynamic Grid Load Balancing")
+	uint32 MinActiveCells;
+
+	/** Average load of the cells in use above which another cell is used. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", EditCondition = "bElasticCellCount"), Category = "Dynamic Grid Load Balancing")
+	float ScaleUpLoadThreshold;
+
+	/** Average load of the cells in use below which the last one is drained, if the others would stay under ScaleUpLoadThreshold. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", EditCondition = "bElasticCellCount"), Category = "Dynamic Grid Load Balancing")
+	float ScaleDownLoadThreshold;
+
+	/** Minimum time in seconds between changes to the number of cells in use. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", EditCondition = "bElasticCellCount"), Category = "Dynamic Grid Load Balancing")
+	float ScalingCooldown;
+
+private:
+	FBox2D GetCell(int32 CellIndex) const;
+	// The cell plus the interest border.
+	SpatialGDK::QueryConstraint GetCellInterestQueryConstraint(int32 CellIndex) const;
+	int32 GetCellIndex(const FVector2D& Location) const;
+
+	// Moves the boundaries between neighbouring regions of the given sizes and loads. Returns true if any boundary moved.
+	bool RebalanceBoundaries(TArray<float>& Boundaries, int32 FirstBoundary, int32 NumRegions, const TArray<double>& RegionLoads) const;
+
+	// The number of cells in use in a column when the first NumCells cells are in use.
+	uint32 GetNumActiveRows(uint32 Col, uint32 NumCells) const;
+	// Spreads the rows in use of a column evenly over its height.
+	void LayOutColumnRows(uint32 Col, uint32 NumActiveRows);
+	// Decides whether to use another cell or drain the last one, and moves the drained cell's boundary. Returns true if any boundary moved.
+	bool UpdateActiveCells();
+	bool DrainLastActiveCell();
+	// Hands the whole region of a cell in use to a neighbouring cell, leaving it with no area. Returns false if it has no neighbour in use.
+	bool GiveCellToNeighbour(uint32 CellIndex);
+
+	TArray<VirtualWorkerId> VirtualWorkerIds;
+
+	// Cols + 1 boundaries along the y-axis.
+	TArray<float> ColumnBoundaries;
+	// Rows + 1 boundaries along the x-axis for each column, stored column by column.
+	TArray<float> RowBoundaries;
+
+	TMap<VirtualWorkerId, double> WorkerLoads;
+
+	// The first NumActiveCells cells are in use. The last of them is being drained when bDrainingLastCell is set.
+	uint32 NumActiveCells;
+	bool bDrainingLastCell;
+	float DrainStepSize;
+	bool bWantsMoreCells;
+	double LastScalingTime;
+
+	uint32 LocalCellId;
+	bool bIsStrategyUsedOnLocalWorker;
+	uint32 RegionsVersion;
+};
@@ -22,6 +22,8 @@ DECLARE_LOG_CATEGORY_EXTERN(LogGridBasedLBStrategy, Log, All)
  * Given a Point, for each Cell:
  * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
  *
+ * As the cells are uniform, the cell containing a point is computed directly from its position rather than by testing every cell.
+ *
  * Intended Usage: Create a data-only blueprint subclass and change
  * the Cols, Rows, WorldWidth, WorldHeight.
  */
@@ -33,8 +35,6 @@ class SPATIALGDK_API UGridBasedLBStrategy : public UAbstractLBStrategy
 public:
 	UGridBasedLBStrategy();
 
-	using LBStrategyRegions = TArray<TPair<VirtualWorkerId, FBox2D>>;
-
 /* UAbstractLBStrategy Interface */
 	virtual void Init() override;
 
@@ -44,17 +44,29 @@ public:
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
 
+	virtual void ShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<bool>& OutShouldHaveAuthority) const override;
+	virtual void WhoShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const override;
+	virtual bool SupportsParallelAuthorityQueries() const override { return true; }
+
+	virtual bool ShouldRetainAuthority(const AActor& Actor) const override;
+
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+	virtual SpatialGDK::QueryConstraint GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const override;
 
 	virtual bool RequiresHandoverData() const override { return Rows * Cols > 1; }
+	virtual bool IsNearWorkerBoundary(const AActor& Actor, float Distance) const override;
+	virtual bool IsNearLocalRegion(const AActor& Actor, float Distance) const override;
 
 	virtual FVector GetWorkerEntityPosition() const override;
+	virtual LBStrategyRegions GetLBStrategyRegions() const override;
 
 	virtual uint32 GetMinimumRequiredWorkers() const override;
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
 /* End UAbstractLBStrategy Interface */
 
-	LBStrategyRegions GetLBStrategyRegions() const;
+	// Finds the virtual worker that should have authority over each of the given 2D positions, in one call.
+	// Positions outside the grid map to SpatialConstants::INVALID_VIRTUAL_WORKER_ID.
+	void WhoShouldHaveAuthority(const TArray<FVector2D>& Positions, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Grid Based Load Balancing")
@@ -72,6 +84,11 @@ protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
 	float InterestBorder;
 
+	// Distance in cm an actor has to move past the edge of a cell before the worker authoritative over it hands it over.
+	// Should be smaller than InterestBorder, so the worker keeps seeing the actors it is authoritative over.
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
+	float BoundaryHysteresis;
+
 private:
 
 	TArray<VirtualWorkerId> VirtualWorkerIds;
@@ -81,4 +98,16 @@ private:
 	bool bIsStrategyUsedOnLocalWorker;
 
 	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
+
+	// Returns the index in WorkerCells of the cell containing the location, or INDEX_NONE if it is outside the grid.
+	int32 GetCellIndex(const FVector2D& Location) const;
+	static int32 GetCellCoordinate(float Value, float GridMinValue, float CellSize, uint32 NumCells);
+
+	// The cell plus the interest border.
+	SpatialGDK::QueryConstraint GetCellInterestQueryConstraint(int32 CellIndex) const;
+
+	// The grid is laid out with rows along the x-axis and columns along the y-axis, see Init.
+	FVector2D GridMin;
+	float RowHeight;
+	float ColumnWidth;
 };
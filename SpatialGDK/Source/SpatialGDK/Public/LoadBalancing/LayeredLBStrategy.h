@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Math/Box2D.h"
 #include "Math/Vector2D.h"
+#include "UObject/ObjectKey.h"
 
 #include "LayeredLBStrategy.generated.h"
 
@@ -58,14 +59,38 @@ public:
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
 
+	// Actors are grouped by layer first, so each layer's strategy evaluates all of its actors in one call.
+	virtual void ShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<bool>& OutShouldHaveAuthority) const override;
+	virtual void WhoShouldHaveAuthorityForActors(const TArray<const AActor*>& Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const override;
+
+	// Supported if every layer's strategy supports it. The class to layer cache is filled for all actors up front.
+	virtual bool SupportsParallelAuthorityQueries() const override;
+	virtual void PrepareParallelAuthorityQueries(const TArray<const AActor*>& Actors) const override;
+
+	virtual bool ShouldRetainAuthority(const AActor& Actor) const override;
+
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+	virtual SpatialGDK::QueryConstraint GetStandbyInterestQueryConstraint(VirtualWorkerId StandbyForWorkerId) const override;
 
 	virtual bool RequiresHandoverData() const override { return GetMinimumRequiredWorkers() > 1; }
+	virtual bool IsNearWorkerBoundary(const AActor& Actor, float Distance) const override;
+	virtual bool IsNearLocalRegion(const AActor& Actor, float Distance) const override;
 
 	virtual FVector GetWorkerEntityPosition() const override;
 
 	virtual uint32 GetMinimumRequiredWorkers() const override;
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
+
+	// Forwarded to the layer strategies. Regions are written per layer, for the layers which require load reports.
+	virtual bool RequiresWorkerLoadReports() const override;
+	virtual void ReportWorkerLoad(VirtualWorkerId WorkerId, double Load) override;
+	virtual void ReportWorkerLoadVector(VirtualWorkerId WorkerId, const SpatialGDK::FWorkerLoadVector& LoadVector) override;
+	virtual bool RebalanceRegions() override;
+	virtual void WriteRegionsToSchema(Schema_Object* Object) const override;
+	virtual bool ApplyRegionsFromSchema(Schema_Object* Object) override;
+	virtual bool IsVirtualWorkerRequiredToStart(VirtualWorkerId WorkerId) const override;
+	virtual void ReportWorkerLost(VirtualWorkerId WorkerId) override;
+	virtual uint32 GetDesiredWorkerCount() const override;
 	/* End UAbstractLBStrategy Interface */
 
 	// This is provided to support the offloading interface in SpatialStatics. It should be removed once users
@@ -81,6 +106,10 @@ private:
 
 	mutable TMap<TSoftClassPtr<AActor>, FName> ClassPathToLayer;
 
+	// Resolved layer for every class looked up so far, so a lookup is a single hash hit instead of building soft class paths
+	// along the class hierarchy. Keyed by FObjectKey so entries for unloaded or reinstanced classes can never match a new class.
+	mutable TMap<FObjectKey, FName> ClassToLayer;
+
 	TMap<VirtualWorkerId, FName> VirtualWorkerIdToLayerName;
 
 	UPROPERTY()
@@ -90,6 +119,13 @@ private:
 	// or the default actor group, if no mapping is found.
 	FName GetLayerNameForClass(TSubclassOf<AActor> Class) const;
 
+	// Walks the class hierarchy against ClassPathToLayer. Results are cached in ClassToLayer by GetLayerNameForClass.
+	FName ResolveLayerNameForClass(TSubclassOf<AActor> Class) const;
+
+	// Adds the configured classes which are already loaded to ClassToLayer. Other classes are added on their first lookup,
+	// which also covers classes loaded after Init.
+	void PrecacheLayerNamesForLoadedClasses();
+
 	// Returns true if ActorA and ActorB are contained in Layers that are
 	// on the same Server worker type.
 	bool IsSameWorkerType(const AActor* ActorA, const AActor* ActorB) const;
@@ -97,6 +133,12 @@ private:
 	// Returns the name of the Layer this Actor belongs to.
 	FName GetLayerNameForActor(const AActor& Actor) const;
 
+	// Returns the root replicated owner of the actor, which decides the layer for the whole hierarchy.
+	static const AActor* GetRootReplicatedOwner(const AActor& Actor);
+
+	// Groups the actors by the layer of their root owner.
+	void GroupActorsByLayer(const TArray<const AActor*>& Actors, TMap<FName, TArray<int32>>& OutActorIndicesByLayer) const;
+
 	// Add a LBStrategy to our map and do bookkeeping around it.
 	void AddStrategyForLayer(const FName& LayerName, UAbstractLBStrategy* LBStrategy);
 };
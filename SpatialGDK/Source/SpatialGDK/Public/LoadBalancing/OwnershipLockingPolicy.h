@@ -32,7 +32,6 @@ private:
 	struct MigrationLockElement
 	{
 		int32 LockCount;
-		AActor* HierarchyRoot;
 	};
 
 	struct LockNameAndActor
@@ -42,27 +41,25 @@ private:
 	};
 
 	bool CanAcquireLock(const AActor* Actor) const;
-	bool IsExplicitlyLocked(const AActor* Actor) const;
-	bool IsLockedHierarchyRoot(const AActor* Actor) const;
 
+	// Called for every Actor with explicitly locked Actors in its ownership hierarchy subtree.
 	UFUNCTION()
-	void OnExplicitlyLockedActorDeleted(AActor* DestroyedActor);
-
-	UFUNCTION()
-	void OnHierarchyRootActorDeleted(AActor* DestroyedActorRoot);
+	void OnLockedSubtreeActorDeleted(AActor* DestroyedActor);
 
 	virtual bool AcquireLockFromDelegate(AActor* ActorToLock,    const FString& DelegateLockIdentifier) override;
 	virtual bool ReleaseLockFromDelegate(AActor* ActorToRelease, const FString& DelegateLockIdentifier) override;
 
-	void RecalculateAllExplicitlyLockedActorsInThisHierarchy(const AActor* HierarchyRoot);
-	void RecalculateLockedActorOwnershipHierarchyInformation(const AActor* ExplicitlyLockedActor);
-	void AddOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor);
-	void RemoveOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor);
+	// Adds Delta to the subtree lock count of Actor and each of its owners, up to the hierarchy root.
+	// As in SpatialGDK::GetHierarchyRoot, an owner which is being destroyed ends the hierarchy.
+	void UpdateSubtreeLockCounts(const AActor* Actor, int32 Delta);
 
 	TMap<const AActor*, MigrationLockElement> ActorToLockingState;
 	TMap<ActorLockToken, LockNameAndActor> TokenToNameAndActor;
 	TMap<FString, ActorLockToken> DelegateLockingIdentifierToActorLockToken;
-	TMap<const AActor*, TArray<const AActor*>> LockedOwnershipRootActorToExplicitlyLockedActors;
+
+	// Number of explicitly locked Actors in the ownership hierarchy subtree of each Actor, including itself. Actors without any are
+	// not stored. A hierarchy is locked if its root has an entry, so owner changes and lock queries only walk one ownership path.
+	TMap<const AActor*, int32> SubtreeLockCounts;
 
 	ActorLockToken NextToken = 1;
 };
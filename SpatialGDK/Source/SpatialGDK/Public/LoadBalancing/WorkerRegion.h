@@ -18,6 +18,7 @@ public:
 	AWorkerRegion(const FObjectInitializer& ObjectInitializer);
 
 	void Init(UMaterial* Material, const FColor& Color, const FBox2D& Extents, const float VerticalScale);
+	void SetColor(const FColor& Color);
 
 	UPROPERTY()
 	UStaticMeshComponent *Mesh;
@@ -29,5 +30,4 @@ private:
 	void SetOpacity(const float Opacity);
 	void SetHeight(const float Height);
 	void SetPositionAndScale(const FBox2D& Extents, const float VerticalScale);
-	void SetColor(const FColor& Color);
 };
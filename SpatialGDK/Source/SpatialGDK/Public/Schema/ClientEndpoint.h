@@ -24,6 +24,7 @@ struct ClientEndpoint : Component
 	RPCRingBuffer UnreliableRPCBuffer;
 	uint64 ReliableRPCAck = 0;
 	uint64 UnreliableRPCAck = 0;
+	uint32 PingId = 0;
 
 private:
 	void ReadFromSchema(Schema_Object* SchemaObject);
@@ -7,6 +7,7 @@
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
+#include "Algo/BinarySearch.h"
 #include "Containers/Array.h"
 #include "HAL/UnrealMemory.h"
 #include "Templates/UnrealTemplate.h"
@@ -17,23 +18,38 @@
 namespace SpatialGDK
 {
 
+// The component list is stored as a sorted base list, plus the sorted IDs added to and removed from it since it was last written, so
+// attaching or removing a dynamic subobject only sends the IDs that changed. The base list is rewritten once the changes outgrow it.
 struct ComponentPresence : Component
 {
 	static const Worker_ComponentId ComponentId = SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID;
 
+	// The number of changes that are always sent as changes rather than by rewriting the base list.
+	static constexpr int32 MinChangesBeforeRewrite = 8;
+
 	ComponentPresence() = default;
 
 	ComponentPresence(TArray<Worker_ComponentId>&& InComponentList)
-		: ComponentList(MoveTemp(InComponentList)) {}
+		: ComponentList(MoveTemp(InComponentList))
+	{
+		ComponentList.Sort();
+		BaseComponentList = ComponentList;
+	}
 
 	ComponentPresence(const Worker_ComponentData& Data)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
-		CopyListFromComponentObject(ComponentObject);
+		CopyListFromComponentObject(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, BaseComponentList);
+		CopyListFromComponentObject(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_ADDED_COMPONENT_IDS_ID, AddedComponentIds);
+		CopyListFromComponentObject(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_REMOVED_COMPONENT_IDS_ID, RemovedComponentIds);
+		RebuildComponentList();
 	}
 
 	Worker_ComponentData CreateComponentPresenceData()
 	{
+		BaseComponentList = ComponentList;
+		AddedComponentIds.Reset();
+		RemovedComponentIds.Reset();
 		return CreateComponentPresenceData(ComponentList);
 	}
 
@@ -44,20 +60,37 @@ struct ComponentPresence : Component
 		Data.schema_type = Schema_CreateComponentData();
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 
-		uint32 BufferCount = ComponentList.Num();
-		uint32 BufferSize = BufferCount * sizeof(uint32);
-		uint32* Buffer = reinterpret_cast<uint32*>(Schema_AllocateBuffer(ComponentObject, BufferSize));
-		FMemory::Memcpy(Buffer, ComponentList.GetData(), BufferSize);
-		Schema_AddUint32List(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, Buffer, BufferCount);
+		TArray<Worker_ComponentId> SortedComponentList = ComponentList;
+		SortedComponentList.Sort();
+		AddListToComponentObject(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, SortedComponentList);
 
 		return Data;
 	}
 
+	// Sends the IDs added and removed since the base list was last written, or rewrites the base list if that's smaller.
 	Worker_ComponentUpdate CreateComponentPresenceUpdate()
 	{
-		return CreateComponentPresenceUpdate(ComponentList);
+		const int32 NumChanges = AddedComponentIds.Num() + RemovedComponentIds.Num();
+		if (NumChanges > FMath::Max(MinChangesBeforeRewrite, BaseComponentList.Num() / 2))
+		{
+			BaseComponentList = ComponentList;
+			AddedComponentIds.Reset();
+			RemovedComponentIds.Reset();
+			return CreateComponentPresenceUpdate(ComponentList);
+		}
+
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		AddListToComponentUpdate(Update, ComponentObject, SpatialConstants::COMPONENT_PRESENCE_ADDED_COMPONENT_IDS_ID, AddedComponentIds);
+		AddListToComponentUpdate(Update, ComponentObject, SpatialConstants::COMPONENT_PRESENCE_REMOVED_COMPONENT_IDS_ID, RemovedComponentIds);
+
+		return Update;
 	}
 
+	// Rewrites the base list and clears the changes.
 	static Worker_ComponentUpdate CreateComponentPresenceUpdate(const TArray<Worker_ComponentId>& ComponentList)
 	{
 		Worker_ComponentUpdate Update = {};
@@ -65,11 +98,11 @@ struct ComponentPresence : Component
 		Update.schema_type = Schema_CreateComponentUpdate();
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
-		uint32 BufferCount = ComponentList.Num();
-		uint32 BufferSize = BufferCount * sizeof(uint32);
-		uint32* Buffer = reinterpret_cast<uint32*>(Schema_AllocateBuffer(ComponentObject, BufferSize));
-		FMemory::Memcpy(Buffer, ComponentList.GetData(), BufferSize);
-		Schema_AddUint32List(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, Buffer, BufferCount);
+		TArray<Worker_ComponentId> SortedComponentList = ComponentList;
+		SortedComponentList.Sort();
+		AddListToComponentUpdate(Update, ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, SortedComponentList);
+		Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::COMPONENT_PRESENCE_ADDED_COMPONENT_IDS_ID);
+		Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::COMPONENT_PRESENCE_REMOVED_COMPONENT_IDS_ID);
 
 		return Update;
 	}
@@ -77,13 +110,16 @@ struct ComponentPresence : Component
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
-		CopyListFromComponentObject(ComponentObject);
-	}
 
-	void CopyListFromComponentObject(Schema_Object* ComponentObject)
-	{
-		ComponentList.SetNum(Schema_GetUint32Count(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID), true);
-		Schema_GetUint32List(ComponentObject, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, ComponentList.GetData());
+		// Fields which aren't in the update keep their value, as they do in the runtime.
+		TArray<Schema_FieldId> ClearedIds;
+		ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(Update.schema_type));
+		Schema_GetComponentUpdateClearedFieldList(Update.schema_type, ClearedIds.GetData());
+
+		ApplyListUpdate(ComponentObject, ClearedIds, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, BaseComponentList);
+		ApplyListUpdate(ComponentObject, ClearedIds, SpatialConstants::COMPONENT_PRESENCE_ADDED_COMPONENT_IDS_ID, AddedComponentIds);
+		ApplyListUpdate(ComponentObject, ClearedIds, SpatialConstants::COMPONENT_PRESENCE_REMOVED_COMPONENT_IDS_ID, RemovedComponentIds);
+		RebuildComponentList();
 	}
 
 	void AddComponentDataIds(const TArray<FWorkerComponentData>& ComponentDatas)
@@ -102,20 +138,123 @@ struct ComponentPresence : Component
 	{
 		for (const Worker_ComponentId& NewComponentId : ComponentsToAdd)
 		{
-			ComponentList.AddUnique(NewComponentId);
+			if (!InsertSorted(ComponentList, NewComponentId))
+			{
+				continue;
+			}
+
+			// Adding an ID removed since the base list was written undoes the removal.
+			if (!RemoveSorted(RemovedComponentIds, NewComponentId))
+			{
+				InsertSorted(AddedComponentIds, NewComponentId);
+			}
 		}
 	}
 
 	void RemoveComponentIds(const TArray<Worker_ComponentId>& ComponentsToRemove)
 	{
-		ComponentList.RemoveAll([&](Worker_ComponentId PresentComponent)
+		for (const Worker_ComponentId& OldComponentId : ComponentsToRemove)
 		{
-			return ComponentsToRemove.Contains(PresentComponent);
-		});
+			if (!RemoveSorted(ComponentList, OldComponentId))
+			{
+				continue;
+			}
+
+			if (!RemoveSorted(AddedComponentIds, OldComponentId))
+			{
+				InsertSorted(RemovedComponentIds, OldComponentId);
+			}
+		}
 	}
 
-	// List of component IDs that exist on an entity.
+	// Sorted list of component IDs that exist on an entity.
 	TArray<Worker_ComponentId> ComponentList;
+
+	// The lists as they're stored in the component, from which ComponentList is built.
+	TArray<Worker_ComponentId> BaseComponentList;
+	TArray<Worker_ComponentId> AddedComponentIds;
+	TArray<Worker_ComponentId> RemovedComponentIds;
+
+private:
+	void RebuildComponentList()
+	{
+		ComponentList = BaseComponentList;
+		for (Worker_ComponentId RemovedComponentId : RemovedComponentIds)
+		{
+			RemoveSorted(ComponentList, RemovedComponentId);
+		}
+		for (Worker_ComponentId AddedComponentId : AddedComponentIds)
+		{
+			InsertSorted(ComponentList, AddedComponentId);
+		}
+	}
+
+	// Returns false if the ID was already in the list.
+	static bool InsertSorted(TArray<Worker_ComponentId>& List, Worker_ComponentId Id)
+	{
+		const int32 Index = Algo::LowerBound(List, Id);
+		if (Index < List.Num() && List[Index] == Id)
+		{
+			return false;
+		}
+		List.Insert(Id, Index);
+		return true;
+	}
+
+	// Returns false if the ID wasn't in the list.
+	static bool RemoveSorted(TArray<Worker_ComponentId>& List, Worker_ComponentId Id)
+	{
+		const int32 Index = Algo::BinarySearch(List, Id);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+		List.RemoveAt(Index);
+		return true;
+	}
+
+	static void CopyListFromComponentObject(Schema_Object* ComponentObject, Schema_FieldId FieldId, TArray<Worker_ComponentId>& OutList)
+	{
+		OutList.SetNum(Schema_GetUint32Count(ComponentObject, FieldId), true);
+		Schema_GetUint32List(ComponentObject, FieldId, OutList.GetData());
+		// Lists written before they were kept sorted.
+		OutList.Sort();
+	}
+
+	// An empty list, including a rewrite of the base list to nothing, only arrives as a cleared field.
+	static void ApplyListUpdate(Schema_Object* ComponentObject, const TArray<Schema_FieldId>& ClearedIds, Schema_FieldId FieldId, TArray<Worker_ComponentId>& OutList)
+	{
+		if (ClearedIds.Contains(FieldId))
+		{
+			OutList.Reset();
+		}
+		else if (Schema_GetUint32Count(ComponentObject, FieldId) > 0)
+		{
+			CopyListFromComponentObject(ComponentObject, FieldId, OutList);
+		}
+	}
+
+	static void AddListToComponentObject(Schema_Object* ComponentObject, Schema_FieldId FieldId, const TArray<Worker_ComponentId>& List)
+	{
+		uint32 BufferCount = List.Num();
+		uint32 BufferSize = BufferCount * sizeof(uint32);
+		uint32* Buffer = reinterpret_cast<uint32*>(Schema_AllocateBuffer(ComponentObject, BufferSize));
+		FMemory::Memcpy(Buffer, List.GetData(), BufferSize);
+		Schema_AddUint32List(ComponentObject, FieldId, Buffer, BufferCount);
+	}
+
+	// Empty lists have to be cleared explicitly to be sent in an update.
+	static void AddListToComponentUpdate(Worker_ComponentUpdate& Update, Schema_Object* ComponentObject, Schema_FieldId FieldId, const TArray<Worker_ComponentId>& List)
+	{
+		if (List.Num() == 0)
+		{
+			Schema_AddComponentUpdateClearedField(Update.schema_type, FieldId);
+		}
+		else
+		{
+			AddListToComponentObject(ComponentObject, FieldId, List);
+		}
+	}
 };
 
 } // namespace SpatialGDK
@@ -13,33 +13,63 @@ struct SphereConstraint
 {
 	Coordinates Center;
 	double Radius;
+
+	bool operator==(const SphereConstraint& Other) const
+	{
+		return Center == Other.Center && Radius == Other.Radius;
+	}
 };
 
 struct CylinderConstraint
 {
 	Coordinates Center;
 	double Radius;
+
+	bool operator==(const CylinderConstraint& Other) const
+	{
+		return Center == Other.Center && Radius == Other.Radius;
+	}
 };
 
 struct BoxConstraint
 {
 	Coordinates Center;
 	EdgeLength EdgeLength;
+
+	bool operator==(const BoxConstraint& Other) const
+	{
+		return Center == Other.Center && EdgeLength == Other.EdgeLength;
+	}
 };
 
 struct RelativeSphereConstraint
 {
 	double Radius;
+
+	bool operator==(const RelativeSphereConstraint& Other) const
+	{
+		return Radius == Other.Radius;
+	}
 };
 
 struct RelativeCylinderConstraint
 {
 	double Radius;
+
+	bool operator==(const RelativeCylinderConstraint& Other) const
+	{
+		return Radius == Other.Radius;
+	}
 };
 
 struct RelativeBoxConstraint
 {
 	EdgeLength EdgeLength;
+
+	bool operator==(const RelativeBoxConstraint& Other) const
+	{
+		return EdgeLength == Other.EdgeLength;
+	}
 };
 
 struct QueryConstraint
@@ -55,6 +85,20 @@ struct QueryConstraint
 	TArray<QueryConstraint> AndConstraint;
 	TArray<QueryConstraint> OrConstraint;
 
+	bool operator==(const QueryConstraint& Other) const
+	{
+		return SphereConstraint == Other.SphereConstraint
+			&& CylinderConstraint == Other.CylinderConstraint
+			&& BoxConstraint == Other.BoxConstraint
+			&& RelativeSphereConstraint == Other.RelativeSphereConstraint
+			&& RelativeCylinderConstraint == Other.RelativeCylinderConstraint
+			&& RelativeBoxConstraint == Other.RelativeBoxConstraint
+			&& EntityIdConstraint == Other.EntityIdConstraint
+			&& ComponentConstraint == Other.ComponentConstraint
+			&& AndConstraint == Other.AndConstraint
+			&& OrConstraint == Other.OrConstraint;
+	}
+
 	FORCEINLINE bool IsValid() const
 	{
 		if (SphereConstraint.IsSet())
@@ -130,6 +174,14 @@ struct Query
 	// If multiple queries match the same Entity-Component then the highest of all frequencies is
 	// used.
 	TSchemaOption<float> Frequency;
+
+	bool operator==(const Query& Other) const
+	{
+		return Constraint == Other.Constraint
+			&& FullSnapshotResult == Other.FullSnapshotResult
+			&& ResultComponentIds == Other.ResultComponentIds
+			&& Frequency == Other.Frequency;
+	}
 };
 
 // Constraints are typically linked to a corresponding frequency in the GDK use case, but without the result set yet.
@@ -137,6 +189,8 @@ struct FrequencyConstraint
 {
 	TSchemaOption<float> Frequency;
 	QueryConstraint Constraint;
+	// Whether the query should use the low detail result type instead of all data components.
+	bool bLowDetail = false;
 };
 
 // Used for deduping queries across frequencies
@@ -148,8 +202,67 @@ using FrequencyConstraints = TArray<FrequencyConstraint>;
 struct ComponentInterest
 {
 	TArray<Query> Queries;
+
+	bool operator==(const ComponentInterest& Other) const
+	{
+		return Queries == Other.Queries;
+	}
 };
 
+// Structural hashes, so that identical queries built for different actors can be found in maps.
+inline uint32 GetTypeHash(const Coordinates& Value)
+{
+	return HashCombine(HashCombine(::GetTypeHash(Value.X), ::GetTypeHash(Value.Y)), ::GetTypeHash(Value.Z));
+}
+
+inline uint32 GetTypeHash(const SphereConstraint& Value) { return HashCombine(GetTypeHash(Value.Center), ::GetTypeHash(Value.Radius)); }
+inline uint32 GetTypeHash(const CylinderConstraint& Value) { return HashCombine(GetTypeHash(Value.Center), ::GetTypeHash(Value.Radius)); }
+inline uint32 GetTypeHash(const BoxConstraint& Value) { return HashCombine(GetTypeHash(Value.Center), GetTypeHash(Value.EdgeLength)); }
+inline uint32 GetTypeHash(const RelativeSphereConstraint& Value) { return ::GetTypeHash(Value.Radius); }
+inline uint32 GetTypeHash(const RelativeCylinderConstraint& Value) { return ::GetTypeHash(Value.Radius); }
+inline uint32 GetTypeHash(const RelativeBoxConstraint& Value) { return GetTypeHash(Value.EdgeLength); }
+
+template <typename T>
+uint32 GetSchemaOptionHash(const TSchemaOption<T>& Option)
+{
+	using ::GetTypeHash;
+	return Option.IsSet() ? HashCombine(1, GetTypeHash(Option.GetValue())) : 0;
+}
+
+inline uint32 GetTypeHash(const QueryConstraint& Value)
+{
+	uint32 Hash = GetSchemaOptionHash(Value.SphereConstraint);
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.CylinderConstraint));
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.BoxConstraint));
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.RelativeSphereConstraint));
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.RelativeCylinderConstraint));
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.RelativeBoxConstraint));
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.EntityIdConstraint));
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.ComponentConstraint));
+	for (const QueryConstraint& Constraint : Value.AndConstraint)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Constraint));
+	}
+	// Separate the AND and OR lists so moving a constraint from one to the other changes the hash.
+	Hash = HashCombine(Hash, static_cast<uint32>(Value.AndConstraint.Num()));
+	for (const QueryConstraint& Constraint : Value.OrConstraint)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Constraint));
+	}
+	return Hash;
+}
+
+inline uint32 GetTypeHash(const Query& Value)
+{
+	uint32 Hash = HashCombine(GetTypeHash(Value.Constraint), Value.FullSnapshotResult.IsSet() ? (*Value.FullSnapshotResult ? 2 : 1) : 0);
+	Hash = HashCombine(Hash, GetSchemaOptionHash(Value.Frequency));
+	for (Worker_ComponentId ComponentId : Value.ResultComponentIds)
+	{
+		Hash = HashCombine(Hash, ::GetTypeHash(ComponentId));
+	}
+	return Hash;
+}
+
 inline void AddQueryConstraintToQuerySchema(Schema_Object* QueryObject, Schema_FieldId Id, const QueryConstraint& Constraint)
 {
 	Schema_Object* QueryConstraintObject = Schema_AddObject(QueryObject, Id);
@@ -436,6 +549,11 @@ struct Interest : Component
 		return ComponentInterestMap.Num() == 0;
 	}
 
+	bool operator==(const Interest& Other) const
+	{
+		return ComponentInterestMap.OrderIndependentCompareEqual(Other.ComponentInterestMap);
+	}
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
@@ -456,7 +574,7 @@ struct Interest : Component
 		}
 	}
 
-	Worker_ComponentData CreateInterestData()
+	Worker_ComponentData CreateInterestData() const
 	{
 		Worker_ComponentData Data = {};
 		Data.component_id = ComponentId;
@@ -468,7 +586,7 @@ struct Interest : Component
 		return Data;
 	}
 
-	Worker_ComponentUpdate CreateInterestUpdate()
+	Worker_ComponentUpdate CreateInterestUpdate() const
 	{
 		Worker_ComponentUpdate ComponentUpdate = {};
 		ComponentUpdate.component_id = ComponentId;
@@ -480,7 +598,7 @@ struct Interest : Component
 		return ComponentUpdate;
 	}
 
-	void FillComponentData(Schema_Object* InterestComponentObject)
+	void FillComponentData(Schema_Object* InterestComponentObject) const
 	{
 		for (const auto& KVPair : ComponentInterestMap)
 		{
@@ -0,0 +1,133 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Component.h"
+#include "SpatialConstants.h"
+#include "Utils/SchemaUtils.h"
+
+#include "Algo/BinarySearch.h"
+#include "Containers/Array.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/UnrealTemplate.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// Sorted set of tombstone IDs for the startup actors of a single level.
+// The same fields are used by the TombstoneStartupActorsRequest command type.
+struct LevelTombstones : Component
+{
+	static const Worker_ComponentId ComponentId = SpatialConstants::LEVEL_TOMBSTONES_COMPONENT_ID;
+
+	LevelTombstones() = default;
+
+	LevelTombstones(const FString& InLevelPath, TArray<uint64> InActorIds)
+		: LevelPath(InLevelPath), ActorIds(MoveTemp(InActorIds)) {}
+
+	LevelTombstones(const Worker_ComponentData& Data)
+	{
+		ReadFromObject(Schema_GetComponentDataFields(Data.schema_type));
+	}
+
+	Worker_ComponentData CreateLevelTombstonesData() const
+	{
+		Worker_ComponentData Data = {};
+		Data.component_id = ComponentId;
+		Data.schema_type = Schema_CreateComponentData();
+		WriteToObject(Schema_GetComponentDataFields(Data.schema_type));
+
+		return Data;
+	}
+
+	Worker_ComponentUpdate CreateLevelTombstonesUpdate() const
+	{
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		WriteToObject(Schema_GetComponentUpdateFields(Update.schema_type));
+
+		return Update;
+	}
+
+	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
+	{
+		ReadFromObject(Schema_GetComponentUpdateFields(Update.schema_type));
+	}
+
+	void WriteToObject(Schema_Object* Object) const
+	{
+		AddStringToSchema(Object, SpatialConstants::LEVEL_TOMBSTONES_LEVEL_PATH_ID, LevelPath);
+
+		const uint32 BufferCount = ActorIds.Num();
+		const uint32 BufferSize = BufferCount * sizeof(uint64);
+		uint64* Buffer = reinterpret_cast<uint64*>(Schema_AllocateBuffer(Object, BufferSize));
+		FMemory::Memcpy(Buffer, ActorIds.GetData(), BufferSize);
+		Schema_AddUint64List(Object, SpatialConstants::LEVEL_TOMBSTONES_ACTOR_IDS_ID, Buffer, BufferCount);
+	}
+
+	void ReadFromObject(Schema_Object* Object)
+	{
+		if (Schema_GetBytesCount(Object, SpatialConstants::LEVEL_TOMBSTONES_LEVEL_PATH_ID) > 0)
+		{
+			LevelPath = GetStringFromSchema(Object, SpatialConstants::LEVEL_TOMBSTONES_LEVEL_PATH_ID);
+		}
+
+		ActorIds.SetNum(Schema_GetUint64Count(Object, SpatialConstants::LEVEL_TOMBSTONES_ACTOR_IDS_ID), true);
+		Schema_GetUint64List(Object, SpatialConstants::LEVEL_TOMBSTONES_ACTOR_IDS_ID, ActorIds.GetData());
+	}
+
+	// Merges a sorted list of IDs into the sorted ActorIds, dropping duplicates. Returns the number of IDs that were not already present.
+	int32 MergeActorIds(const TArray<uint64>& SortedIds)
+	{
+		TArray<uint64> Merged;
+		Merged.Reserve(ActorIds.Num() + SortedIds.Num());
+
+		auto AddUniqueSorted = [&Merged](uint64 Id)
+		{
+			if (Merged.Num() == 0 || Merged.Last() != Id)
+			{
+				Merged.Add(Id);
+			}
+		};
+
+		int32 ExistingIndex = 0;
+		int32 NewIndex = 0;
+		while (ExistingIndex < ActorIds.Num() || NewIndex < SortedIds.Num())
+		{
+			if (NewIndex >= SortedIds.Num() || (ExistingIndex < ActorIds.Num() && ActorIds[ExistingIndex] < SortedIds[NewIndex]))
+			{
+				AddUniqueSorted(ActorIds[ExistingIndex++]);
+			}
+			else if (ExistingIndex >= ActorIds.Num() || SortedIds[NewIndex] < ActorIds[ExistingIndex])
+			{
+				AddUniqueSorted(SortedIds[NewIndex++]);
+			}
+			else
+			{
+				AddUniqueSorted(ActorIds[ExistingIndex++]);
+				NewIndex++;
+			}
+		}
+
+		const int32 NumAdded = Merged.Num() - ActorIds.Num();
+		ActorIds = MoveTemp(Merged);
+		return NumAdded;
+	}
+
+	bool Contains(uint64 ActorId) const
+	{
+		return Algo::BinarySearch(ActorIds, ActorId) != INDEX_NONE;
+	}
+
+	// Remapped package name of the level these tombstones belong to.
+	FString LevelPath;
+
+	// Sorted tombstone IDs of the destroyed startup actors in the level.
+	TArray<uint64> ActorIds;
+};
+
+} // namespace SpatialGDK
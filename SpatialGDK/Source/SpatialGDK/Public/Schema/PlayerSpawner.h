@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Schema/Component.h"
+#include "SpatialCommonTypes.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
@@ -25,6 +26,11 @@ struct SpawnPlayerRequest
 	FUniqueNetIdRepl UniqueId;
 	FName OnlinePlatformName;
 	bool bIsSimulatedPlayer;
+
+	// Only set by a client rejoining after a lost connection, see bEnableClientFastRejoin.
+	PhysicalWorkerName RejoinPreviousWorkerId;
+	Worker_EntityId RejoinPlayerControllerEntityId = SpatialConstants::INVALID_ENTITY_ID;
+	FString RejoinToken;
 };
 
 struct PlayerSpawner : Component
@@ -46,12 +52,20 @@ struct PlayerSpawner : Component
 		return CommandRequest;
 	}
 
-	static Worker_CommandResponse CreatePlayerSpawnResponse()
+	static Worker_CommandResponse CreatePlayerSpawnResponse(bool bRejoined = false, const FString& RejoinToken = FString())
 	{
 		Worker_CommandResponse CommandResponse = {};
 		CommandResponse.component_id = SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID;
 		CommandResponse.command_index = SpatialConstants::PLAYER_SPAWNER_SPAWN_PLAYER_COMMAND_ID;
 		CommandResponse.schema_type = Schema_CreateCommandResponse();
+
+		Schema_Object* ResponseObject = Schema_GetCommandResponseObject(CommandResponse.schema_type);
+		Schema_AddBool(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOINED_ID, bRejoined);
+		if (!RejoinToken.IsEmpty())
+		{
+			AddStringToSchema(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOIN_TOKEN_ID, RejoinToken);
+		}
+
 		return CommandResponse;
 	}
 
@@ -65,6 +79,13 @@ struct PlayerSpawner : Component
 		AddBytesToSchema(RequestObject, SpatialConstants::SPAWN_PLAYER_UNIQUE_ID, UniqueIdWriter);
 		AddStringToSchema(RequestObject, SpatialConstants::SPAWN_PLAYER_PLATFORM_NAME_ID, SpawnRequest.OnlinePlatformName.ToString());
 		Schema_AddBool(RequestObject, SpatialConstants::SPAWN_PLAYER_IS_SIMULATED_ID, SpawnRequest.bIsSimulatedPlayer);
+
+		if (SpawnRequest.RejoinPlayerControllerEntityId != SpatialConstants::INVALID_ENTITY_ID)
+		{
+			AddStringToSchema(RequestObject, SpatialConstants::SPAWN_PLAYER_REJOIN_WORKER_ID, SpawnRequest.RejoinPreviousWorkerId);
+			Schema_AddEntityId(RequestObject, SpatialConstants::SPAWN_PLAYER_REJOIN_PLAYER_CONTROLLER_ID, SpawnRequest.RejoinPlayerControllerEntityId);
+			AddStringToSchema(RequestObject, SpatialConstants::SPAWN_PLAYER_REJOIN_TOKEN_ID, SpawnRequest.RejoinToken);
+		}
 	}
 
 	static FURL ExtractUrlFromPlayerSpawnParams(const Schema_Object* Payload)
@@ -85,7 +106,15 @@ struct PlayerSpawner : Component
 
 		const bool bIsSimulated = GetBoolFromSchema(CommandRequestPayload, SpatialConstants::SPAWN_PLAYER_IS_SIMULATED_ID);
 
-		return { LoginURL, UniqueId, OnlinePlatformName, bIsSimulated };
+		SpawnPlayerRequest SpawnRequest{ LoginURL, UniqueId, OnlinePlatformName, bIsSimulated };
+		if (Schema_GetEntityIdCount(CommandRequestPayload, SpatialConstants::SPAWN_PLAYER_REJOIN_PLAYER_CONTROLLER_ID) > 0)
+		{
+			SpawnRequest.RejoinPreviousWorkerId = GetStringFromSchema(CommandRequestPayload, SpatialConstants::SPAWN_PLAYER_REJOIN_WORKER_ID);
+			SpawnRequest.RejoinPlayerControllerEntityId = Schema_GetEntityId(CommandRequestPayload, SpatialConstants::SPAWN_PLAYER_REJOIN_PLAYER_CONTROLLER_ID);
+			SpawnRequest.RejoinToken = GetStringFromSchema(CommandRequestPayload, SpatialConstants::SPAWN_PLAYER_REJOIN_TOKEN_ID);
+		}
+
+		return SpawnRequest;
 	}
 
 	static void CopySpawnDataBetweenObjects(const Schema_Object* SpawnPlayerDataSource, Schema_Object* SpawnPlayerDataDestination)
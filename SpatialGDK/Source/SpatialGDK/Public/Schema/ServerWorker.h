@@ -4,9 +4,11 @@
 
 #include "Schema/Component.h"
 #include "Schema/PlayerSpawner.h"
+#include "Schema/StandardLibrary.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
+#include "Utils/WorkerLoadVector.h"
 
 #include "Containers/UnrealString.h"
 
@@ -26,12 +28,14 @@ struct ServerWorker : Component
 	ServerWorker()
 		: WorkerName(SpatialConstants::INVALID_WORKER_NAME)
 		, bReadyToBeginPlay(false)
+		, Load(0.0)
 	{}
 
 	ServerWorker(const PhysicalWorkerName& InWorkerName, const bool bInReadyToBeginPlay)
 	{
 		WorkerName = InWorkerName;
 		bReadyToBeginPlay = bInReadyToBeginPlay;
+		Load = 0.0;
 	}
 
 	ServerWorker(const Worker_ComponentData& Data)
@@ -40,6 +44,7 @@ struct ServerWorker : Component
 
 		WorkerName = GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
 		bReadyToBeginPlay = GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID);
+		Load = GetLoadFromSchema(ComponentObject);
 	}
 
 	Worker_ComponentData CreateServerWorkerData()
@@ -51,6 +56,7 @@ struct ServerWorker : Component
 
 		AddStringToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID, WorkerName);
 		Schema_AddBool(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, bReadyToBeginPlay);
+		Schema_AddDouble(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID, Load);
 
 		return Data;
 	}
@@ -64,6 +70,7 @@ struct ServerWorker : Component
 
 		AddStringToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID, WorkerName);
 		Schema_AddBool(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, bReadyToBeginPlay);
+		Schema_AddDouble(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID, Load);
 
 		return Update;
 	}
@@ -74,6 +81,102 @@ struct ServerWorker : Component
 
 		WorkerName = GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
 		bReadyToBeginPlay = GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID);
+
+		// Load is sent on its own in partial updates, so only apply it when present.
+		if (Schema_GetDoubleCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID) > 0)
+		{
+			Load = Schema_GetDouble(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID);
+		}
+	}
+
+	// Workers which haven't reported a load yet, or entities from before the field existed, have a load of zero.
+	static double GetLoadFromSchema(const Schema_Object* ComponentObject)
+	{
+		return Schema_GetDoubleCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID) > 0
+			? Schema_GetDouble(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID)
+			: 0.0;
+	}
+
+	static Worker_ComponentUpdate CreateServerWorkerLoadUpdate(const double InLoad)
+	{
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		Schema_AddDouble(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID, InLoad);
+
+		return Update;
+	}
+
+	static Worker_ComponentUpdate CreateServerWorkerLoadUpdate(const double InLoad, const FWorkerLoadVector& InLoadVector)
+	{
+		Worker_ComponentUpdate Update = CreateServerWorkerLoadUpdate(InLoad);
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		InLoadVector.WriteToSchema(Schema_AddObject(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_VECTOR_ID));
+
+		return Update;
+	}
+
+	// Returns false for workers which don't report a load vector.
+	static bool GetLoadVectorFromSchema(Schema_Object* ComponentObject, FWorkerLoadVector& OutLoadVector)
+	{
+		if (Schema_GetObjectCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_VECTOR_ID) == 0)
+		{
+			return false;
+		}
+
+		OutLoadVector = FWorkerLoadVector::ReadFromSchema(Schema_GetObject(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_VECTOR_ID));
+		return true;
+	}
+
+	static uint64 GetHeartbeatFromSchema(const Schema_Object* ComponentObject)
+	{
+		return Schema_GetUint64Count(ComponentObject, SpatialConstants::SERVER_WORKER_HEARTBEAT_ID) > 0
+			? Schema_GetUint64(ComponentObject, SpatialConstants::SERVER_WORKER_HEARTBEAT_ID)
+			: 0;
+	}
+
+	static Worker_ComponentUpdate CreateServerWorkerHeartbeatUpdate(const uint64 InHeartbeat)
+	{
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		Schema_AddUint64(ComponentObject, SpatialConstants::SERVER_WORKER_HEARTBEAT_ID, InHeartbeat);
+
+		return Update;
+	}
+
+	static void GetClientViewPositionsFromSchema(Schema_Object* ComponentObject, TArray<FVector>& OutPositions)
+	{
+		const uint32 NumPositions = Schema_GetObjectCount(ComponentObject, SpatialConstants::SERVER_WORKER_CLIENT_VIEW_POSITIONS_ID);
+		OutPositions.Reserve(OutPositions.Num() + NumPositions);
+		for (uint32 Index = 0; Index < NumPositions; Index++)
+		{
+			OutPositions.Add(Coordinates::ToFVector(IndexCoordinateFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_CLIENT_VIEW_POSITIONS_ID, Index)));
+		}
+	}
+
+	static Worker_ComponentUpdate CreateServerWorkerClientViewPositionsUpdate(const TArray<FVector>& Positions)
+	{
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		if (Positions.Num() == 0)
+		{
+			Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::SERVER_WORKER_CLIENT_VIEW_POSITIONS_ID);
+		}
+		for (const FVector& Position : Positions)
+		{
+			AddCoordinateToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_CLIENT_VIEW_POSITIONS_ID, Coordinates::FromFVector(Position));
+		}
+
+		return Update;
 	}
 
 	static Worker_CommandRequest CreateForwardPlayerSpawnRequest(Schema_CommandRequest* SchemaCommandRequest)
@@ -112,6 +215,7 @@ struct ServerWorker : Component
 
 	PhysicalWorkerName WorkerName;
 	bool bReadyToBeginPlay;
+	double Load;
 };
 
 } // namespace SpatialGDK
@@ -43,6 +43,11 @@ struct Coordinates
 		return Location;
 	}
 
+	inline bool operator==(const Coordinates& Right) const
+	{
+		return X == Right.X && Y == Right.Y && Z == Right.Z;
+	}
+
 	inline bool operator!=(const Coordinates& Right) const
 	{
 		return X != Right.X || Y != Right.Y || Z != Right.Z;
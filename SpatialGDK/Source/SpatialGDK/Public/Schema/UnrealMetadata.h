@@ -40,7 +40,7 @@ struct UnrealMetadata : Component
 		{
 			StablyNamedRef = GetObjectRefFromSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_STABLY_NAMED_REF_ID);
 		}
-		ClassPath = GetStringFromSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_CLASS_PATH_ID);
+		IndexStringFromSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_CLASS_PATH_ID, 0, ClassPath);
 
 		if (Schema_GetBoolCount(ComponentObject, SpatialConstants::UNREAL_METADATA_NET_STARTUP_ID) == 1)
 		{
@@ -55,17 +55,23 @@ struct UnrealMetadata : Component
 		Data.schema_type = Schema_CreateComponentData();
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 
-		if (StablyNamedRef.IsSet())
+		AddStringToSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_CLASS_PATH_ID, ClassPath);
+		AddInstanceFields(ComponentObject, StablyNamedRef, bNetStartup);
+
+		return Data;
+	}
+
+	// Adds the fields that differ between Actors of the same class, so data copied from a per-class template can be completed.
+	static void AddInstanceFields(Schema_Object* ComponentObject, const TSchemaOption<FUnrealObjectRef>& InStablyNamedRef, const TSchemaOption<bool>& InbNetStartup)
+	{
+		if (InStablyNamedRef.IsSet())
 		{
-			AddObjectRefToSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_STABLY_NAMED_REF_ID, StablyNamedRef.GetValue());
+			AddObjectRefToSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_STABLY_NAMED_REF_ID, InStablyNamedRef.GetValue());
 		}
-		AddStringToSchema(ComponentObject, SpatialConstants::UNREAL_METADATA_CLASS_PATH_ID, ClassPath);
-		if (bNetStartup.IsSet())
+		if (InbNetStartup.IsSet())
 		{
-			Schema_AddBool(ComponentObject, SpatialConstants::UNREAL_METADATA_NET_STARTUP_ID, bNetStartup.GetValue());
+			Schema_AddBool(ComponentObject, SpatialConstants::UNREAL_METADATA_NET_STARTUP_ID, InbNetStartup.GetValue());
 		}
-
-		return Data;
 	}
 
 	FORCEINLINE UClass* GetNativeEntityClass()
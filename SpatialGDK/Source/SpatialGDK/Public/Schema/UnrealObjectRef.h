@@ -9,6 +9,38 @@
 
 class USpatialPackageMapClient;
 
+// A path in an object ref, interned into a process wide table so that comparing and hashing paths are integer operations.
+// Interned paths are never freed, which is bounded by the number of distinct object and package names that are referenced.
+// Comparison is case-sensitive, as the string comparison of paths it replaces was.
+class SPATIALGDK_API FUnrealObjectRefPath
+{
+public:
+	// The empty path.
+	FUnrealObjectRefPath() = default;
+	FUnrealObjectRefPath(const FString& Path);
+	FUnrealObjectRefPath(const TCHAR* Path);
+
+	const FString& ToString() const;
+
+	FORCEINLINE bool operator==(const FUnrealObjectRefPath& Other) const
+	{
+		return Id == Other.Id;
+	}
+
+	FORCEINLINE bool operator!=(const FUnrealObjectRefPath& Other) const
+	{
+		return Id != Other.Id;
+	}
+
+	friend FORCEINLINE uint32 GetTypeHash(const FUnrealObjectRefPath& Path)
+	{
+		return Path.Id;
+	}
+
+private:
+	uint32 Id = 0;
+};
+
 struct SPATIALGDK_API FUnrealObjectRef
 {
 	FUnrealObjectRef() = default;
@@ -19,7 +51,7 @@ struct SPATIALGDK_API FUnrealObjectRef
 		, Offset(Offset)
 	{}
 
-	FUnrealObjectRef(Worker_EntityId Entity, uint32 Offset, FString Path, FUnrealObjectRef Outer, bool bNoLoadOnClient = false)
+	FUnrealObjectRef(Worker_EntityId Entity, uint32 Offset, FUnrealObjectRefPath Path, FUnrealObjectRef Outer, bool bNoLoadOnClient = false)
 		: Entity(Entity)
 		, Offset(Offset)
 		, Path(Path)
@@ -36,7 +68,8 @@ struct SPATIALGDK_API FUnrealObjectRef
 
 	FORCEINLINE FUnrealObjectRef GetLevelReference() const
 	{
-		if (Path->Equals(TEXT("PersistentLevel")))
+		static const FUnrealObjectRefPath PersistentLevelPath(TEXT("PersistentLevel"));
+		if (*Path == PersistentLevelPath)
 		{
 			return *this;
 		}
@@ -55,7 +88,7 @@ struct SPATIALGDK_API FUnrealObjectRef
 	{
 		return Entity == Other.Entity &&
 			Offset == Other.Offset &&
-			((!Path && !Other.Path) || (Path && Other.Path && Path->Equals(*Other.Path))) &&
+			((!Path && !Other.Path) || (Path && Other.Path && *Path == *Other.Path)) &&
 			((!Outer && !Other.Outer) || (Outer && Other.Outer && *Outer == *Other.Outer)) &&
 			// Intentionally don't compare bNoLoadOnClient since it does not affect equality.
 			bUseClassPathToLoadObject == Other.bUseClassPathToLoadObject;
@@ -84,7 +117,7 @@ struct SPATIALGDK_API FUnrealObjectRef
 
 	Worker_EntityId Entity;
 	uint32 Offset;
-	SpatialGDK::TSchemaOption<FString> Path;
+	SpatialGDK::TSchemaOption<FUnrealObjectRefPath> Path;
 	SpatialGDK::TSchemaOption<FUnrealObjectRef> Outer;
 	bool bNoLoadOnClient = false;
 	// If this field is set to true, we are saying that the Actor will exist at most once on the given worker.
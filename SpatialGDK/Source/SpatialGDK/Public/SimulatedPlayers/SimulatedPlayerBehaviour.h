@@ -0,0 +1,64 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "SimulatedPlayerBehaviour.generated.h"
+
+class APlayerController;
+
+/*
+ A behaviour driving a simulated player, ticked by a USimulatedPlayerComponent on the simulated client.
+ Subclass it in C++ or Blueprint to script game specific load, e.g. firing weapons or sending chat messages through the game's own RPCs.
+ */
+UCLASS(Abstract, Blueprintable, EditInlineNew, DefaultToInstanced)
+class SPATIALGDK_API USimulatedPlayerBehaviour : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// Called once the simulated player's controller has begun play.
+	UFUNCTION(BlueprintNativeEvent, Category = "SpatialOS|SimulatedPlayer")
+	void StartBehaviour(APlayerController* Controller);
+
+	// Called on the frames the behaviour is activated, DeltaSeconds is the length of the frame.
+	UFUNCTION(BlueprintNativeEvent, Category = "SpatialOS|SimulatedPlayer")
+	void TickBehaviour(APlayerController* Controller, float DeltaSeconds);
+
+	// Average number of activations per second, so a profile can mix frequent and rare actions. A rate at or above the frame rate ticks it every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpatialOS|SimulatedPlayer", meta = (ClampMin = "0.0"))
+	float ActivationsPerSecond = 1.0f;
+
+	virtual UWorld* GetWorld() const override;
+};
+
+/*
+ Moves the simulated player's pawn towards random points around where it started, picking a new point once it gets close.
+ */
+UCLASS(meta = (DisplayName = "Wander"))
+class SPATIALGDK_API USimulatedPlayerWanderBehaviour : public USimulatedPlayerBehaviour
+{
+	GENERATED_BODY()
+
+public:
+	USimulatedPlayerWanderBehaviour();
+
+	virtual void StartBehaviour_Implementation(APlayerController* Controller) override;
+	virtual void TickBehaviour_Implementation(APlayerController* Controller, float DeltaSeconds) override;
+
+	// Maximum distance, in Unreal units, of the random points from the pawn's starting location.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpatialOS|SimulatedPlayer", meta = (ClampMin = "0.0"))
+	float WanderRadius = 5000.0f;
+
+	// Distance from the current target at which a new one is picked.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpatialOS|SimulatedPlayer", meta = (ClampMin = "0.0"))
+	float AcceptanceRadius = 200.0f;
+
+private:
+	void PickNewTarget();
+
+	TOptional<FVector> Origin;
+	FVector Target = FVector::ZeroVector;
+};
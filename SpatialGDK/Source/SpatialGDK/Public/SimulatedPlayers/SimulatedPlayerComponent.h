@@ -0,0 +1,47 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+
+#include "SimulatedPlayerComponent.generated.h"
+
+class APlayerController;
+class USimulatedPlayerBehaviour;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSimulatedPlayerComponent, Log, All);
+
+/*
+ Drives a simulated player with a profile of pluggable behaviours, and periodically reports its round-trip latency as measured
+ by a USpatialPingComponent on the same player controller. Does nothing unless the client is a simulated player.
+ This component should be attached to a player controller.
+ */
+UCLASS(ClassGroup = (SpatialGDK), Meta = (BlueprintSpawnableComponent))
+class SPATIALGDK_API USimulatedPlayerComponent : public UActorComponent
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	// The behaviours making up this simulated player's profile, each considered in turn every frame.
+	UPROPERTY(EditAnywhere, Instanced, BlueprintReadOnly, Category = "SpatialOS|SimulatedPlayer")
+	TArray<USimulatedPlayerBehaviour*> Behaviours;
+
+	// The time, in seconds, between latency reports in the log. 0 disables the reports.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpatialOS|SimulatedPlayer", meta = (ClampMin = "0.0"))
+	float LatencyReportInterval = 10.0f;
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Logs the round-trip times measured by the owner's USpatialPingComponent, over its last window of pings and in total.
+	UFUNCTION(BlueprintCallable, Category = "SpatialOS|SimulatedPlayer")
+	void ReportLatency() const;
+
+private:
+	UPROPERTY()
+	APlayerController* OwningController;
+
+	FTimerHandle LatencyReportTimerHandle;
+};
@@ -116,6 +116,10 @@ const Worker_ComponentId SERVER_WORKER_COMPONENT_ID						= 9974;
 const Worker_ComponentId SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID = 9973;
 const Worker_ComponentId COMPONENT_PRESENCE_COMPONENT_ID				= 9972;
 const Worker_ComponentId NET_OWNING_CLIENT_WORKER_COMPONENT_ID			= 9971;
+const Worker_ComponentId CROSS_SERVER_ENDPOINT_COMPONENT_ID				= 9970;
+const Worker_ComponentId LEVEL_TOMBSTONES_COMPONENT_ID					= 9969;
+// Hand-written GDK components are allocated downwards from 9999, so this has to be updated to the lowest one when adding a component.
+const Worker_ComponentId MIN_GDK_COMPONENT_ID							= LEVEL_TOMBSTONES_COMPONENT_ID;
 
 const Worker_ComponentId STARTING_GENERATED_COMPONENT_ID				= 10000;
 
@@ -125,12 +129,20 @@ const Schema_FieldId DEPLOYMENT_MAP_SESSION_ID							= 3;
 const Schema_FieldId DEPLOYMENT_MAP_SCHEMA_HASH							= 4;
 
 const Schema_FieldId STARTUP_ACTOR_MANAGER_CAN_BEGIN_PLAY_ID			= 1;
+const Schema_FieldId STARTUP_ACTOR_MANAGER_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID = 1;
+
+// LevelTombstones Field IDs, shared with the TombstoneStartupActorsRequest type.
+const Schema_FieldId LEVEL_TOMBSTONES_LEVEL_PATH_ID					= 1;
+const Schema_FieldId LEVEL_TOMBSTONES_ACTOR_IDS_ID						= 2;
+const Schema_FieldId LEVEL_TOMBSTONES_TOMBSTONE_STARTUP_ACTORS_COMMAND_ID = 1;
 
 const Schema_FieldId ACTOR_COMPONENT_REPLICATES_ID                      = 1;
 const Schema_FieldId ACTOR_TEAROFF_ID									= 3;
 
 const Schema_FieldId HEARTBEAT_EVENT_ID                                 = 1;
 const Schema_FieldId HEARTBEAT_CLIENT_HAS_QUIT_ID						= 1;
+const Schema_FieldId HEARTBEAT_EVENT_RECEIVED_BYTES_PER_SECOND_ID		= 1;
+const Schema_FieldId HEARTBEAT_EVENT_BUDGET_BYTES_PER_SECOND_ID			= 2;
 
 const Schema_FieldId SHUTDOWN_MULTI_PROCESS_REQUEST_ID					= 1;
 const Schema_FieldId SHUTDOWN_ADDITIONAL_SERVERS_EVENT_ID				= 1;
@@ -159,6 +171,15 @@ const Schema_FieldId UNREAL_RPC_PAYLOAD_OFFSET_ID						= 1;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_INDEX_ID					= 2;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID					= 3;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_TRACE_ID						= 4;
+const Schema_FieldId UNREAL_RPC_PAYLOAD_PACKED_RPCS_ID					= 5;
+const Schema_FieldId UNREAL_RPC_PAYLOAD_TARGET_ENTITY_ID				= 6;
+
+// RepMovement Field IDs
+const Schema_FieldId REP_MOVEMENT_FLAGS_ID								= 1;
+const Schema_FieldId REP_MOVEMENT_LOCATION_ID							= 2;
+const Schema_FieldId REP_MOVEMENT_ROTATION_ID							= 3;
+const Schema_FieldId REP_MOVEMENT_LINEAR_VELOCITY_ID					= 4;
+const Schema_FieldId REP_MOVEMENT_ANGULAR_VELOCITY_ID					= 5;
 
 const Schema_FieldId UNREAL_RPC_TRACE_ID								= 1;
 const Schema_FieldId UNREAL_RPC_SPAN_ID									= 2;
@@ -178,6 +199,11 @@ const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_ID				= 1;
 const Schema_FieldId MAPPING_VIRTUAL_WORKER_ID							= 1;
 const Schema_FieldId MAPPING_PHYSICAL_WORKER_NAME						= 2;
 const Schema_FieldId MAPPING_SERVER_WORKER_ENTITY_ID					= 3;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID	= 2;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_STANDBY_MAPPING_ID		= 3;
+const Schema_FieldId LOAD_BALANCING_REGIONS_LAYER_NAME_ID				= 1;
+const Schema_FieldId LOAD_BALANCING_REGIONS_COLUMN_BOUNDARIES_ID		= 2;
+const Schema_FieldId LOAD_BALANCING_REGIONS_ROW_BOUNDARIES_ID			= 3;
 const PhysicalWorkerName TRANSLATOR_UNSET_PHYSICAL_NAME = FString("UnsetWorkerName");
 
 // WorkerEntity Field IDs.
@@ -194,13 +220,29 @@ const Schema_FieldId SPATIAL_DEBUGGING_IS_LOCKED                         = 5;
 // ServerWorker Field IDs.
 const Schema_FieldId SERVER_WORKER_NAME_ID								 = 1;
 const Schema_FieldId SERVER_WORKER_READY_TO_BEGIN_PLAY_ID				 = 2;
+const Schema_FieldId SERVER_WORKER_LOAD_ID								 = 3;
+const Schema_FieldId SERVER_WORKER_HEARTBEAT_ID							 = 4;
+const Schema_FieldId SERVER_WORKER_CLIENT_VIEW_POSITIONS_ID				 = 5;
+const Schema_FieldId SERVER_WORKER_LOAD_VECTOR_ID						 = 6;
 const Schema_FieldId SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID		 = 1;
 
+// WorkerLoadVector type IDs.
+const Schema_FieldId WORKER_LOAD_VECTOR_FRAME_TIME_LOAD_ID				 = 1;
+const Schema_FieldId WORKER_LOAD_VECTOR_AUTHORITATIVE_ENTITY_COUNT_ID	 = 2;
+const Schema_FieldId WORKER_LOAD_VECTOR_OUTGOING_BYTES_PER_SECOND_ID	 = 3;
+const Schema_FieldId WORKER_LOAD_VECTOR_INCOMING_OPS_PER_SECOND_ID		 = 4;
+const Schema_FieldId WORKER_LOAD_VECTOR_MEMORY_USED_MB_ID				 = 5;
+
 // SpawnPlayerRequest type IDs.
 const Schema_FieldId SPAWN_PLAYER_URL_ID								 = 1;
 const Schema_FieldId SPAWN_PLAYER_UNIQUE_ID								 = 2;
 const Schema_FieldId SPAWN_PLAYER_PLATFORM_NAME_ID						 = 3;
 const Schema_FieldId SPAWN_PLAYER_IS_SIMULATED_ID						 = 4;
+const Schema_FieldId SPAWN_PLAYER_REJOIN_WORKER_ID						 = 5;
+const Schema_FieldId SPAWN_PLAYER_REJOIN_PLAYER_CONTROLLER_ID			 = 6;
+const Schema_FieldId SPAWN_PLAYER_REJOIN_TOKEN_ID						 = 7;
+const Schema_FieldId SPAWN_PLAYER_RESPONSE_REJOINED_ID					 = 1;
+const Schema_FieldId SPAWN_PLAYER_RESPONSE_REJOIN_TOKEN_ID				 = 2;
 
 // ForwardSpawnPlayerRequest type IDs.
 const Schema_FieldId FORWARD_SPAWN_PLAYER_START_ACTOR_ID				 = 1;
@@ -210,6 +252,8 @@ const Schema_FieldId FORWARD_SPAWN_PLAYER_RESPONSE_SUCCESS_ID			 = 1;
 
 // ComponentPresence Field IDs.
 const Schema_FieldId COMPONENT_PRESENCE_COMPONENT_LIST_ID				 = 1;
+const Schema_FieldId COMPONENT_PRESENCE_ADDED_COMPONENT_IDS_ID			 = 2;
+const Schema_FieldId COMPONENT_PRESENCE_REMOVED_COMPONENT_IDS_ID		 = 3;
 
 // NetOwningClientWorker Field IDs.
 const Schema_FieldId NET_OWNING_CLIENT_WORKER_FIELD_ID					 = 1;
@@ -223,6 +267,7 @@ const Schema_FieldId UNREAL_METADATA_NET_STARTUP_ID						 = 3;
 const float ENTITY_RANGE_EXPIRATION_INTERVAL_SECONDS = 180.0f;
 
 const float FIRST_COMMAND_RETRY_WAIT_SECONDS = 0.2f;
+const uint32 MAX_COMMAND_RETRY_WAIT_EXPONENT = 6u;
 const uint32 MAX_NUMBER_COMMAND_ATTEMPTS = 5u;
 const float FORWARD_PLAYER_SPAWN_COMMAND_WAIT_SECONDS = 0.2f;
 
@@ -259,8 +304,8 @@ const FString Ipv4Pattern			= TEXT("^(?:[0-9]{1,3}\\.){3}[0-9]{1,3}$");
 
 inline float GetCommandRetryWaitTimeSeconds(uint32 NumAttempts)
 {
-	// Double the time to wait on each failure.
-	uint32 WaitTimeExponentialFactor = 1u << (NumAttempts - 1);
+	// Double the time to wait on each failure. Commands which retry without an attempt limit stop growing after a while.
+	uint32 WaitTimeExponentialFactor = 1u << FMath::Min(NumAttempts - 1, MAX_COMMAND_RETRY_WAIT_EXPONENT);
 	return FIRST_COMMAND_RETRY_WAIT_SECONDS * WaitTimeExponentialFactor;
 }
 
@@ -269,10 +314,134 @@ const uint16  DEFAULT_PORT = 7777;
 
 const float ENTITY_QUERY_RETRY_WAIT_SECONDS = 3.0f;
 
+const float WORKER_LOAD_REPORT_INTERVAL_SECONDS = 5.0f;
+const float AUTHORITY_PRE_STAGE_INTERVAL_SECONDS = 0.5f;
+const float SERVER_WORKER_HEARTBEAT_INTERVAL_SECONDS = 1.0f;
+const float HEARTBEAT_SWEEP_INTERVAL_SECONDS = 1.0f;
+
+// A client interest frequency scale is lowered when the client receives more than its budget, and raised back by the step factor
+// while it receives less than the headroom fraction of it. Scales are rounded to quantization steps so small fluctuations
+// in throughput don't cause an interest update on every heartbeat.
+const float CLIENT_BANDWIDTH_HEADROOM_FRACTION = 0.75f;
+const float CLIENT_BANDWIDTH_SCALE_UP_FACTOR = 1.25f;
+const float CLIENT_BANDWIDTH_SCALE_QUANTIZATION_STEPS = 8.0f;
+const float CLIENT_REJOIN_RETRY_INTERVAL_SECONDS = 1.0f;
+const float CLIENT_REJOIN_RECONCILE_SETTLE_SECONDS = 1.0f;
+
+const int32 STARTUP_ROLE_ASSIGNMENT_ACTORS_PER_BATCH = 512;
+
+// Gaining authority over an actor within this long of last gaining it counts as a repeated migration.
+const float AUTHORITY_MIGRATION_REPEAT_WINDOW_SECONDS = 10.0f;
+// Number of repeated migrations of an actor after which a server warns that its authority is thrashing.
+const uint32 AUTHORITY_MIGRATION_THRASH_WARNING_COUNT = 5;
+
+// Responses to the player spawner entity query are reused by spawn retries for this long.
+const float PLAYER_SPAWNER_QUERY_CACHE_LIFETIME_SECONDS = 30.0f;
+
+// With RPCAckDelaySeconds, an ack is sent straight away once this fraction of the sender's ring buffer holds RPCs it hasn't been acked.
+const float RPC_ACK_FLUSH_BUFFER_FRACTION = 0.5f;
+
 const Worker_ComponentId MIN_EXTERNAL_SCHEMA_ID = 1000;
 const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
+// Classification of component IDs, combined into a single table by SpatialGDK::FComponentClassification.
+enum EComponentTraits : uint16
+{
+	COMPONENT_TRAIT_None			= 0,
+	// Reserved by SpatialOS, below MAX_RESERVED_SPATIAL_SYSTEM_COMPONENT_ID.
+	COMPONENT_TRAIT_SpatialSystem	= 1 << 0,
+	// Hand-written GDK components, between MAX_RESERVED_SPATIAL_SYSTEM_COMPONENT_ID and STARTING_GENERATED_COMPONENT_ID.
+	COMPONENT_TRAIT_GDKOwned		= 1 << 1,
+	COMPONENT_TRAIT_RPCEndpoint		= 1 << 2,
+	// Components that SpatialLoadBalanceEnforcer reacts to.
+	COMPONENT_TRAIT_LoadBalancing	= 1 << 3,
+	COMPONENT_TRAIT_ExternalSchema	= 1 << 4,
+
+	// Generated components, from the schema database.
+	COMPONENT_TRAIT_Data			= 1 << 5,
+	COMPONENT_TRAIT_OwnerOnly		= 1 << 6,
+	COMPONENT_TRAIT_Handover		= 1 << 7,
+	// Sublevel and net cull distance components, which are only used for interest.
+	COMPONENT_TRAIT_QBIMarker		= 1 << 8,
+};
+
+// Traits of IDs below STARTING_GENERATED_COMPONENT_ID, which don't depend on the schema database.
+constexpr uint16 GetReservedComponentTraits(Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case ENTITY_ACL_COMPONENT_ID:
+		return COMPONENT_TRAIT_SpatialSystem | COMPONENT_TRAIT_LoadBalancing;
+	case CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
+	case SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY:
+	case NETMULTICAST_RPCS_COMPONENT_ID_LEGACY:
+	case CLIENT_ENDPOINT_COMPONENT_ID:
+	case SERVER_ENDPOINT_COMPONENT_ID:
+	case MULTICAST_RPCS_COMPONENT_ID:
+	case SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID:
+	case CROSS_SERVER_ENDPOINT_COMPONENT_ID:
+		return COMPONENT_TRAIT_GDKOwned | COMPONENT_TRAIT_RPCEndpoint;
+	case AUTHORITY_INTENT_COMPONENT_ID:
+	case COMPONENT_PRESENCE_COMPONENT_ID:
+	case NET_OWNING_CLIENT_WORKER_COMPONENT_ID:
+		return COMPONENT_TRAIT_GDKOwned | COMPONENT_TRAIT_LoadBalancing;
+	default:
+		break;
+	}
+
+	if (ComponentId < MAX_RESERVED_SPATIAL_SYSTEM_COMPONENT_ID)
+	{
+		return COMPONENT_TRAIT_SpatialSystem;
+	}
+	if (MIN_EXTERNAL_SCHEMA_ID <= ComponentId && ComponentId <= MAX_EXTERNAL_SCHEMA_ID)
+	{
+		return COMPONENT_TRAIT_ExternalSchema;
+	}
+	if (MIN_GDK_COMPONENT_ID <= ComponentId && ComponentId < STARTING_GENERATED_COMPONENT_ID)
+	{
+		return COMPONENT_TRAIT_GDKOwned;
+	}
+	return COMPONENT_TRAIT_None;
+}
+
+static_assert(GetReservedComponentTraits(POSITION_COMPONENT_ID) == COMPONENT_TRAIT_SpatialSystem, "Position should be a SpatialOS component.");
+static_assert(GetReservedComponentTraits(HEARTBEAT_COMPONENT_ID) == COMPONENT_TRAIT_GDKOwned, "Heartbeat should be a GDK component.");
+static_assert((GetReservedComponentTraits(CLIENT_ENDPOINT_COMPONENT_ID) & COMPONENT_TRAIT_RPCEndpoint) != 0, "The client endpoint should be an RPC endpoint.");
+
 const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+const FString SPATIALOS_METRICS_OLDEST_UNREPLICATED_ACTOR_AGE = TEXT("Dynamic.OldestUnreplicatedActorAge");
+// Suffixed with the RPC type, e.g. Dynamic.OverflowedRPCQueueDepth.ClientReliable.
+const FString SPATIALOS_METRICS_OVERFLOWED_RPC_QUEUE_DEPTH = TEXT("Dynamic.OverflowedRPCQueueDepth");
+const FString SPATIALOS_METRICS_OLDEST_OVERFLOWED_RPC_AGE = TEXT("Dynamic.OldestOverflowedRPCAge");
+const FString SPATIALOS_METRICS_DROPPED_RPCS = TEXT("Dynamic.DroppedRPCs");
+const FString SPATIALOS_METRICS_EXPIRED_RPCS = TEXT("Dynamic.ExpiredRPCs");
+const FString SPATIALOS_METRICS_DESIRED_SERVER_WORKERS = TEXT("Dynamic.DesiredServerWorkers");
+const FString SPATIALOS_METRICS_OLDEST_ASYNC_LOAD_WAIT_TIME = TEXT("Dynamic.OldestAsyncLoadWaitTime");
+const FString SPATIALOS_METRICS_ENTITY_POOL_EMPTY_STALLS = TEXT("Dynamic.EntityPoolEmptyStalls");
+const FString SPATIALOS_METRICS_ENTITY_CREATION_LIMIT = TEXT("Dynamic.EntityCreationLimit");
+const FString SPATIALOS_METRICS_OP_QUEUE_LATENCY = TEXT("Dynamic.OpQueueLatency");
+const FString SPATIALOS_METRICS_FRAME_TIME = TEXT("Dynamic.FrameTime");
+const FString SPATIALOS_METRICS_OPS_PER_TICK = TEXT("Dynamic.OpsPerTick");
+const FString SPATIALOS_METRICS_OP_BACKLOG = TEXT("Dynamic.OpBacklog");
+const FString SPATIALOS_METRICS_INCOMING_RPC_QUEUE_TIME = TEXT("Dynamic.IncomingRPCQueueTime");
+const FString SPATIALOS_METRICS_OUTGOING_MESSAGE_QUEUE_DEPTH = TEXT("Dynamic.OutgoingMessageQueueDepth");
+// Suffixed with the lane name.
+const FString SPATIALOS_METRICS_OUTGOING_MESSAGE_LANE_DEPTH = TEXT("Dynamic.OutgoingMessageLaneDepth.");
+const FString SPATIALOS_METRICS_OUTGOING_MESSAGE_LANE_WAIT_TIME = TEXT("Dynamic.OutgoingMessageLaneWaitTime.");
+// Followed by the class name.
+const FString SPATIALOS_METRICS_HANDOVER_BYTES = TEXT("Dynamic.HandoverBytes.");
+const FString SPATIALOS_METRICS_HOT_ENTITIES = TEXT("Dynamic.HotEntities");
+const FString SPATIALOS_METRICS_QUEUED_ACL_ASSIGNMENTS = TEXT("Dynamic.QueuedAclAssignments");
+const FString SPATIALOS_METRICS_ACL_ASSIGNMENTS_PER_TICK = TEXT("Dynamic.AclAssignmentsPerTick");
+const FString SPATIALOS_METRICS_RELIABLE_RPC_RETRIES = TEXT("Dynamic.ReliableRPCRetries");
+const FString SPATIALOS_METRICS_QUEUED_RELIABLE_RPC_RETRIES = TEXT("Dynamic.QueuedReliableRPCRetries");
+const FString SPATIALOS_METRICS_DEDUPLICATED_RELIABLE_RPC_RETRIES = TEXT("Dynamic.DeduplicatedReliableRPCRetries");
+const FString SPATIALOS_METRICS_QUEUED_PLAYER_SPAWN_REQUESTS = TEXT("Dynamic.QueuedPlayerSpawnRequests");
+const FString SPATIALOS_METRICS_PLAYER_SPAWNS_PER_SECOND = TEXT("Dynamic.PlayerSpawnsPerSecond");
+const FString SPATIALOS_METRICS_MAX_CLIENT_INTEREST_QUERIES = TEXT("Dynamic.MaxClientInterestQueries");
+
+// Property or class metadata marking bytes fields whose values are compressed, see FCompressedFieldsSchemaData.
+const FName SPATIAL_COMPRESSED_METADATA = TEXT("SpatialCompressed");
 
 // URL that can be used to reconnect using the command line arguments.
 const FString RECONNECT_USING_COMMANDLINE_ARGUMENTS = TEXT("0.0.0.0");
@@ -289,6 +458,7 @@ const FString DEVELOPMENT_AUTH_PLAYER_ID = TEXT("Player Id");
 
 const FString SCHEMA_DATABASE_FILE_PATH  = TEXT("Spatial/SchemaDatabase");
 const FString SCHEMA_DATABASE_ASSET_PATH = TEXT("/Game/Spatial/SchemaDatabase");
+const FString COMPACT_SCHEMA_DATABASE_FILE_PATH = TEXT("Spatial/SchemaDatabase.bin");
 
 const FString DEV_LOGIN_TAG = TEXT("dev_login");
 
@@ -300,6 +470,7 @@ const TArray<Worker_ComponentId> REQUIRED_COMPONENTS_FOR_NON_AUTH_CLIENT_INTERES
 	SPAWN_DATA_COMPONENT_ID,
 	RPCS_ON_ENTITY_CREATION_ID,
 	TOMBSTONE_COMPONENT_ID,
+	LEVEL_TOMBSTONES_COMPONENT_ID,
 	DORMANT_COMPONENT_ID,
 
 	// Multicast RPCs
@@ -332,6 +503,7 @@ const TArray<Worker_ComponentId> REQUIRED_COMPONENTS_FOR_NON_AUTH_SERVER_INTERES
 	SPAWN_DATA_COMPONENT_ID,
 	RPCS_ON_ENTITY_CREATION_ID,
 	TOMBSTONE_COMPONENT_ID,
+	LEVEL_TOMBSTONES_COMPONENT_ID,
 	DORMANT_COMPONENT_ID,
 	NET_OWNING_CLIENT_WORKER_COMPONENT_ID,
 
@@ -10,5 +10,7 @@ class UWorld;
 namespace SpatialGDKConsoleCommands
 {
 	void ConsoleCommand_ConnectToLocator(const TArray<FString>& Args, UWorld* World);
+	void ConsoleCommand_ComponentViewMemoryReport(const TArray<FString>& Args, UWorld* World);
+	void ConsoleCommand_MemoryReport(const TArray<FString>& Args, UWorld* World);
 }
 // namespace
@@ -41,6 +41,18 @@ namespace EServicesRegion
 	};
 }
 
+UENUM()
+namespace EOverflowedRPCDropPolicy
+{
+	enum Type
+	{
+		// Drop the oldest queued RPC to make room for the new one.
+		DropOldest,
+		// Drop the new RPC and keep the queued ones.
+		DropNewest
+	};
+}
+
 USTRUCT(BlueprintType)
 struct FDistanceFrequencyPair
 {
@@ -51,6 +63,160 @@ struct FDistanceFrequencyPair
 
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "SpatialGDK")
 	float Frequency;
+
+	/** Entities only in this band are received with the low detail result type, see LowDetailInterestClasses. */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "SpatialGDK")
+	bool bLowDetail = false;
+};
+
+/**
+ * When queued outgoing messages of one kind of traffic are flushed to the Worker SDK, on top of the connection thread's regular sends.
+ * Any rule that applies triggers a flush, and a flush sends everything queued so far.
+ */
+USTRUCT()
+struct FSpatialFlushRule
+{
+	GENERATED_BODY()
+
+	/** Flush at the end of every tick if any messages of this traffic were queued. */
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	bool bFlushAtEndOfTick = false;
+
+	/** Flush as soon as at least this many bytes of this traffic are queued. 0 disables the rule. */
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	uint32 FlushQueuedBytes = 0;
+
+	/** Flush once the oldest queued message of this traffic has waited this long. Checked when messages are queued and at the end of each tick, 0 disables the rule. */
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	uint32 FlushDeadlineMicroseconds = 0;
+
+	bool IsSet() const { return bFlushAtEndOfTick || FlushQueuedBytes > 0 || FlushDeadlineMicroseconds > 0; }
+};
+
+/**
+ * Worker SDK network parameters a worker type connects with, see Worker_NetworkParameters in c_worker.h.
+ * Upstream is the worker to runtime direction, downstream the runtime to worker direction. Fields left at 0 keep the Worker SDK defaults.
+ */
+USTRUCT()
+struct SPATIALGDK_API FSpatialNetworkTransportProfile
+{
+	GENERATED_BODY()
+
+	/** How often KCP flushes messages sent by the worker, in milliseconds. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP", meta = (ClampMax = "255"))
+	uint32 KcpUpstreamFlushIntervalMillis = 10;
+
+	/** How often KCP flushes messages sent to the worker, in milliseconds. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP", meta = (ClampMax = "255"))
+	uint32 KcpDownstreamFlushIntervalMillis = 1;
+
+	/** Resend a packet as soon as two later packets are acknowledged, rather than waiting for its retransmission timeout. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP")
+	bool bKcpFastRetransmission = true;
+
+	/** Resend unacknowledged packets early when there is nothing new to send. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP")
+	bool bKcpEarlyRetransmission = true;
+
+	/** Ignore packet loss when sizing the send window. Lowers latency on lossy links at the cost of more congestion. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP")
+	bool bKcpNonConcessionalFlowControl = false;
+
+	/** The number of KCP streams messages are spread over, so one lost packet only holds up the messages on its stream. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP", meta = (ClampMax = "255"))
+	uint32 KcpMultiplexLevel = 0;
+
+	/** The minimum KCP retransmission timeout, in milliseconds. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP")
+	uint32 KcpMinRtoMillis = 0;
+
+	/** Forward error correction: ErasureCodecRecoveryPacketCount extra packets are sent for every ErasureCodecOriginalPacketCount, so lost packets can be rebuilt without a resend. 0 disables it. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP", meta = (ClampMax = "255"))
+	uint32 ErasureCodecOriginalPacketCount = 0;
+
+	UPROPERTY(EditAnywhere, Config, Category = "KCP", meta = (ClampMax = "255"))
+	uint32 ErasureCodecRecoveryPacketCount = 0;
+
+	/** The number of batches kept around to rebuild packets from. */
+	UPROPERTY(EditAnywhere, Config, Category = "KCP", meta = (ClampMax = "255"))
+	uint32 ErasureCodecWindowSize = 0;
+
+	/** Compress messages sent by the worker. */
+	UPROPERTY(EditAnywhere, Config, Category = "Compression")
+	bool bCompressUpstream = false;
+
+	/** Compress messages sent to the worker. */
+	UPROPERTY(EditAnywhere, Config, Category = "Compression")
+	bool bCompressDownstream = true;
+
+	/** Disable TCP flush delays, the equivalent of TCP_NODELAY. */
+	UPROPERTY(EditAnywhere, Config, Category = "TCP")
+	bool bTcpNoDelay = false;
+
+	/** The number of TCP connections messages are spread over. */
+	UPROPERTY(EditAnywhere, Config, Category = "TCP", meta = (ClampMin = "1", ClampMax = "255"))
+	uint32 TcpMultiplexLevel = 2;
+
+	/** The number of bytes the worker can receive before acknowledging them. */
+	UPROPERTY(EditAnywhere, Config, Category = "Flow Control")
+	uint32 DownstreamWindowSizeBytes = 0;
+
+	/** The number of bytes the worker can send before they're acknowledged. */
+	UPROPERTY(EditAnywhere, Config, Category = "Flow Control")
+	uint32 UpstreamWindowSizeBytes = 0;
+
+	/** How often heartbeats are sent, in milliseconds. */
+	UPROPERTY(EditAnywhere, Config, Category = "Heartbeat")
+	uint32 HeartbeatIntervalMillis = 0;
+
+	/** How long without a heartbeat until the connection is dropped, in milliseconds. */
+	UPROPERTY(EditAnywhere, Config, Category = "Heartbeat")
+	uint32 HeartbeatTimeoutMillis = 0;
+
+	/** The profiles which don't have to be configured: LowLatency for fast paced games, HighThroughput for servers and clients with a lot of entities in view, and Mobile for lossy, high latency links. */
+	static const FSpatialNetworkTransportProfile* FindBuiltInProfile(FName ProfileName);
+};
+
+UENUM()
+namespace ESpatialThreadPriority
+{
+	enum Type
+	{
+		// The priority the GDK creates the thread with when no policy is set for it.
+		Default,
+		Lowest,
+		BelowNormal,
+		SlightlyBelowNormal,
+		Normal,
+		AboveNormal,
+		Highest,
+		TimeCritical
+	};
+}
+
+/** How a thread owned by the GDK is created, see USpatialGDKSettings::ThreadPolicies. */
+USTRUCT()
+struct SPATIALGDK_API FSpatialThreadPolicy
+{
+	GENERATED_BODY()
+
+	/** The stack size of the thread, in kilobytes. 0 uses the platform default. */
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	uint32 StackSizeKB = 0;
+
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	TEnumAsByte<ESpatialThreadPriority::Type> Priority = ESpatialThreadPriority::Default;
+
+	/** The logical cores the thread may run on. Empty lets it run on any core. Cores the host doesn't have are ignored. */
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	TArray<int32> AffinityCores;
+
+	/**
+	 * Spin instead of waiting for work, only yielding to threads that are ready to run. This takes a whole core, so it should only be
+	 * combined with an affinity to a core that isn't used otherwise. Only the worker connection threads support it.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "SpatialGDK")
+	bool bBusyPoll = false;
 };
 
 UCLASS(config = SpatialGDKSettings, defaultconfig)
@@ -87,6 +253,22 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (DisplayName = "Refresh Count"))
 	uint32 EntityPoolRefreshCount;
 
+	/**
+	 * Grow the refresh threshold and refresh count with the observed entity ID allocation rate, so that bursts of actor creation
+	 * don't empty the pool while waiting for a reservation, and allow several reservations to be in flight at once.
+	 * `Pool Refresh Threshold` and `Refresh Count` are used as the minimums.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (DisplayName = "Adaptive Entity Pool"))
+	bool bAdaptiveEntityPool;
+
+	/** Maximum number of entity IDs reserved by one request when `Adaptive Entity Pool` is set. */
+	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (EditCondition = "bAdaptiveEntityPool", DisplayName = "Maximum Refresh Count"))
+	uint32 EntityPoolMaxRefreshCount;
+
+	/** Maximum number of entity ID reservations awaiting a response when `Adaptive Entity Pool` is set. */
+	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (EditCondition = "bAdaptiveEntityPool", ClampMin = "1", DisplayName = "Maximum Reservations In Flight"))
+	uint32 EntityPoolMaxReservationsInFlight;
+
 	/** Specifies the amount of time, in seconds, between heartbeat events sent from a game client to notify the server-worker instances that it's connected. */
 	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (DisplayName = "Heartbeat Interval (seconds)"))
 	float HeartbeatIntervalSeconds;
@@ -104,6 +286,19 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (DisplayName = "Heartbeat Timeout With Editor (seconds)"))
 	float HeartbeatTimeoutWithEditorSeconds;
 
+	/**
+	 * The number of bytes per second a game client can receive. When set, game clients report the bytes they receive with their heartbeat events,
+	 * and the server-worker instance authoritative over their player controller lowers the frequency of their net cull distance and user defined
+	 * interest queries while they receive more than this, so that slow clients aren't sent more updates than they can process.
+	 * Default: `0` (no budget)
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ClampMin = "0", DisplayName = "Client Interest Bandwidth Budget (bytes per second)"))
+	float ClientInterestBandwidthBudgetBytesPerSecond;
+
+	/** The lowest fraction of their frequency that the interest queries of a game client over its bandwidth budget are lowered to. */
+	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ClampMin = "0.125", ClampMax = "1", DisplayName = "Minimum Client Interest Frequency Scale"))
+	float MinClientInterestFrequencyScale;
+
 	/**
 	 * Specifies the maximum number of Actors replicated per tick. Not respected when using the Replication Graph.
 	 * Default: `0` per tick  (no limit)
@@ -122,6 +317,46 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Maximum entities created per tick"))
 	uint32 EntityCreationRateLimit;
 
+	/**
+	* Specifies the maximum number of create entity requests for Actors that can await a response from the SpatialOS Runtime. Not respected when using the Replication Graph.
+	* Once the limit is reached, new entities are only created as responses arrive, so bursts of spawned Actors are spread over several ticks.
+	* Default: `0` (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Maximum create entity requests in flight"))
+	uint32 MaxCreateEntityRequestsInFlight;
+
+	/**
+	* When bAdaptiveEntityCreationLimit is set, create entity responses slower than this count as a sign the SpatialOS Runtime is overloaded.
+	* Default: `1` second
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Entity creation target latency (seconds)", ClampMin = "0.01"))
+	float EntityCreationTargetLatencySeconds;
+
+	/**
+	 * Specifies the time in milliseconds spent replicating Actors per tick. Not respected when using the Replication Graph.
+	 * When a time or byte budget is set, Actors share the budget according to their NetPriority and the cost of their previous replications,
+	 * and Actors that do not fit in the budget carry their share over to later ticks.
+	 * Default: `0` (no limit)
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Replication time budget per tick (ms)"))
+	float ReplicationTimeBudgetMs;
+
+	/**
+	 * Specifies the number of bytes written replicating Actors per tick. Not respected when using the Replication Graph.
+	 * Default: `0` (no limit)
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Replication byte budget per tick"))
+	uint32 ReplicationByteBudget;
+
+	/**
+	 * When a replication budget is set, Actors that have not replicated for this many seconds are replicated regardless of the budget.
+	 * Default: `1` second
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Replication starvation threshold (seconds)"))
+	float ReplicationStarvationThresholdSeconds;
+
+	bool UseReplicationBudget() const { return ReplicationTimeBudgetMs > 0.f || ReplicationByteBudget > 0; }
+
 	/**
 	 * When enabled, only entities which are in the net relevancy range of player controllers will be replicated to SpatialOS. Not respected when using the Replication Graph.
 	 * This should only be used in single server configurations. The state of the world in the inspector will no longer be up to date.
@@ -163,6 +398,28 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates")
 	float PositionDistanceThreshold;
 
+	/**
+	 * Scale each Actor's position update frequency by its speed, between MinAdaptivePositionUpdateFrequency when at rest and
+	 * PositionUpdateFrequency at AdaptivePositionUpdateFullRateSpeed or faster. Also applies to batched position updates.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates")
+	bool bAdaptivePositionUpdateFrequency;
+
+	/** Position update frequency of Actors at rest when bAdaptivePositionUpdateFrequency is enabled.*/
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (EditCondition = "bAdaptivePositionUpdateFrequency", ClampMin = "0.01"))
+	float MinAdaptivePositionUpdateFrequency;
+
+	/** Speed in cm/s from which Actors update their position at PositionUpdateFrequency when bAdaptivePositionUpdateFrequency is enabled.*/
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (EditCondition = "bAdaptivePositionUpdateFrequency", ClampMin = "0.0"))
+	float AdaptivePositionUpdateFullRateSpeed;
+
+	/**
+	 * When bAdaptivePositionUpdateFrequency is enabled and this is greater than 0, Actors further than this many cm away from the view of every
+	 * client connected to this server update their position at MinAdaptivePositionUpdateFrequency, whatever their speed.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (EditCondition = "bAdaptivePositionUpdateFrequency", ClampMin = "0.0"))
+	float AdaptivePositionUpdateObserverDistance;
+
 	/** Metrics about client and server performance can be reported to SpatialOS to monitor a deployments health.*/
 	UPROPERTY(EditAnywhere, config, Category = "Metrics")
 	bool bEnableMetrics;
@@ -183,6 +440,102 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Metrics")
 	bool bUseFrameTimeAsLoad;
 
+	/**
+	 * Measure the entities each server worker is authoritative over, the bytes it sends, the ops it receives and the memory it uses
+	 * alongside its frame time, and publish them for load balancing. The reported load becomes the largest of the frame time load and
+	 * each of these relative to its budget below, so strategies which rebalance on load relieve whichever limit a worker is nearest.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics")
+	bool bReportWorkerLoadVector;
+
+	/** The budgets the load vector is measured against. A budget of 0 leaves that measurement out of the reported load. */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bReportWorkerLoadVector", ClampMin = "0"))
+	float WorkerLoadAuthoritativeEntityBudget;
+
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bReportWorkerLoadVector", ClampMin = "0"))
+	float WorkerLoadOutgoingBytesPerSecondBudget;
+
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bReportWorkerLoadVector", ClampMin = "0"))
+	float WorkerLoadIncomingOpsPerSecondBudget;
+
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bReportWorkerLoadVector", ClampMin = "0", DisplayName = "Worker Load Memory Budget (MB)"))
+	float WorkerLoadMemoryBudgetMB;
+
+	/**
+	 * When greater than 0, server workers serve their metrics in the Prometheus text format at http://<host>:<port>/metrics, so they can
+	 * be scraped in local and self-hosted deployments. Reported every Metrics Report Rate, alongside the metrics sent to SpatialOS.
+	 * Can be overridden with the -prometheusMetricsPort=<port> command line argument.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ClampMin = "0", ClampMax = "65535"))
+	int32 PrometheusMetricsPort;
+
+	/**
+	 * Fraction of latency traces started with BeginLatencyTrace that are recorded. The decision is made once when the trace begins,
+	 * traces that are not sampled return an empty payload and are ignored by every worker they are continued on.
+	 * Can be overridden with the -latencyTraceSampleRate=<rate> command line argument.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float LatencyTraceSampleRate;
+
+	/**
+	 * When greater than 0, how often the memory held by each GDK subsystem is sampled, so that the SpatialMemoryReport console command
+	 * reports peaks as well as current sizes. When 0, memory is only sampled when the report is requested.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ClampMin = "0.0", DisplayName = "Memory Accounting Sample Interval (seconds)"))
+	float MemoryAccountingSampleIntervalSeconds;
+
+	/**
+	 * Keep a rolling record of the ops, RPCs, queued messages and subsystem time of each of the last HitchCaptureFrameCount frames,
+	 * and write it to Saved/Profiling/SpatialHitches when a frame takes at least HitchCaptureThresholdMs.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics")
+	bool bEnableHitchCapture;
+
+	/** Frame time in milliseconds from which a frame is reported as a hitch, when bEnableHitchCapture is set. */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bEnableHitchCapture", ClampMin = "1.0"))
+	float HitchCaptureThresholdMs;
+
+	/** Number of frames written out for each hitch, including the hitch itself. */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bEnableHitchCapture", ClampMin = "1"))
+	int32 HitchCaptureFrameCount;
+
+	/** Minimum time between two hitch reports, so that a worker which is overloaded for a while doesn't write a report every frame. */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bEnableHitchCapture", ClampMin = "0.0", DisplayName = "Min Time Between Hitch Reports (seconds)"))
+	float HitchCaptureMinSecondsBetweenReports;
+
+	/**
+	 * Track the rate of component updates and RPCs sent and ops received for each entity over HotEntityWindowSeconds. Entities above
+	 * HotEntityUpdateRateThreshold or HotEntityRPCRateThreshold are logged, counted in the Dynamic.HotEntities metric and listed by the
+	 * SpatialHotEntities console command.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics")
+	bool bEnableHotEntityTracking;
+
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bEnableHotEntityTracking", ClampMin = "0.1", DisplayName = "Hot Entity Window (seconds)"))
+	float HotEntityWindowSeconds;
+
+	/** Component updates sent per second from which an entity is hot. */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bEnableHotEntityTracking", ClampMin = "1.0"))
+	float HotEntityUpdateRateThreshold;
+
+	/** RPCs sent per second from which an entity is hot. */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (EditCondition = "bEnableHotEntityTracking", ClampMin = "1.0"))
+	float HotEntityRPCRateThreshold;
+
+	/**
+	 * EXPERIMENTAL: With bEnableHotEntityTracking, lower the NetUpdateFrequency of actors sending updates above HotEntityUpdateRateThreshold
+	 * to HotEntityThrottledNetUpdateFrequency for HotEntityThrottleSeconds, and drop their unreliable RPCs while they're above
+	 * HotEntityRPCRateThreshold. Reliable RPCs are never dropped.
+	 */
+	UPROPERTY(Config)
+	bool bThrottleHotEntities;
+
+	UPROPERTY(Config)
+	float HotEntityThrottledNetUpdateFrequency;
+
+	UPROPERTY(Config)
+	float HotEntityThrottleSeconds;
+
 	/** Batch entity position updates to be processed on a single frame.*/
 	UPROPERTY(config)
 	bool bBatchSpatialPositionUpdates;
@@ -218,6 +571,575 @@ public:
 	UPROPERTY(Config)
 	bool bRunSpatialWorkerConnectionOnGameThread;
 
+	/**
+	 * EXPERIMENTAL: Copy the ops of every op list received within a tick into a single contiguous batch on the worker connection thread.
+	 * The game thread processes the batch in one pass and frees it with a single reset on the next tick.
+	 */
+	UPROPERTY(Config)
+	bool bUseOpListArena;
+
+	/**
+	 * EXPERIMENTAL: Queue outgoing messages in a bounded single-producer/single-consumer ring with inline storage instead of
+	 * heap allocating each message. Messages are sent through a heap-allocated overflow queue while the ring is full.
+	 */
+	UPROPERTY(Config)
+	bool bUseOutgoingMessageRing;
+
+	/** Number of slots in the outgoing message ring, rounded up to a power of two. */
+	UPROPERTY(Config)
+	uint32 OutgoingMessageRingCapacity;
+
+	/**
+	 * EXPERIMENTAL: Merge outgoing component updates for the same entity-component that are queued back to back
+	 * before passing them to the Worker SDK. Reduces the number of updates sent when several are produced within one flush.
+	 */
+	UPROPERTY(Config)
+	bool bCoalesceOutgoingComponentUpdates;
+
+	/**
+	 * EXPERIMENTAL: Queue outgoing messages in priority lanes for control messages, RPCs, property updates and bulk work such as entity
+	 * creation and interest changes, and pass them to the Worker SDK in that order, so time-sensitive messages don't wait behind bursts
+	 * of bulk work. Used instead of the outgoing message ring.
+	 */
+	UPROPERTY(Config)
+	bool bUseOutgoingMessagePriorityLanes;
+
+	/** With bUseOutgoingMessagePriorityLanes, the maximum number of bulk messages sent per flush of the connection. 0 sends all of them. */
+	UPROPERTY(Config)
+	uint32 MaxBulkOutgoingMessagesPerFlush;
+
+	/**
+	 * EXPERIMENTAL: Store the static component view in dense per-component-type arrays indexed by an entity slot,
+	 * instead of nested maps, to make authority and component data lookups cheaper.
+	 */
+	UPROPERTY(Config)
+	bool bUseFlatStaticComponentView;
+
+	/**
+	 * EXPERIMENTAL: If not empty, the static component view only keeps the data of these hand-written components.
+	 * Other components are still recorded as present and their ops are dispatched as normal, but their data isn't stored.
+	 * The data of components read by the GDK itself is always kept. The SpatialComponentViewMemoryReport console command
+	 * shows the number of reads and the memory used per component type.
+	 */
+	UPROPERTY(Config)
+	TArray<uint32> StaticComponentViewStoredComponentIds;
+
+	/**
+	 * EXPERIMENTAL: Compare the replicated properties of every actor channel that will be replicated this frame in
+	 * parallel, before the actors are replicated. Building component updates and sending them stays on the game thread.
+	 */
+	UPROPERTY(Config)
+	bool bParallelCompareProperties;
+
+	/**
+	 * EXPERIMENTAL: Remember the interest last sent for each entity this worker is authoritative over, and don't send interest updates
+	 * that would not change it.
+	 */
+	UPROPERTY(Config)
+	bool bSkipUnchangedInterestUpdates;
+
+	/**
+	 * EXPERIMENTAL: Serialize each distinct interest query once and reuse the serialized form for every actor with an identical query,
+	 * instead of rebuilding the schema for every actor.
+	 */
+	UPROPERTY(Config)
+	bool bCacheSerializedInterestQueries;
+
+	/**
+	 * EXPERIMENTAL: Remember the AlwaysInterested constraint built for each player controller, and only rebuild it when one of its
+	 * AlwaysInterested properties is replicated or handed over.
+	 */
+	UPROPERTY(Config)
+	bool bCacheAlwaysInterestedConstraints;
+
+	/**
+	 * EXPERIMENTAL: Create the component updates of an actor and all of its subobjects with one component factory, sharing its
+	 * serialization buffers, and send them together once the actor has replicated, instead of creating and sending them per object.
+	 */
+	UPROPERTY(Config)
+	bool bBatchSubobjectComponentUpdates;
+
+	/**
+	 * EXPERIMENTAL: Evaluate whether this worker should keep authority over every actor about to replicate with a single call to the
+	 * load balancing strategy each tick, instead of one call per actor while replicating it.
+	 */
+	UPROPERTY(Config)
+	bool bBatchEvaluateAuthority;
+
+	/**
+	 * EXPERIMENTAL: Pack all unreliable RPCs of the same type sent to an entity in one tick into a single ring buffer element,
+	 * instead of writing one element per RPC. Latency traces are only kept for the first RPC in each packed element.
+	 */
+	UPROPERTY(Config)
+	bool bPackUnreliableRPCs;
+
+	/**
+	 * EXPERIMENTAL: Start every entity's RPC ring buffers at the size configured for the RPC type, and double the size of a buffer
+	 * (up to MaxRPCRingBufferSize) once it has overflowed and all the RPCs sent through it have been acknowledged. This lets the configured
+	 * sizes be kept small for entities which rarely send RPCs, while busy entities such as player controllers get larger buffers.
+	 */
+	UPROPERTY(Config)
+	bool bUseAdaptiveRPCRingBufferSizes;
+
+	/**
+	 * EXPERIMENTAL: Hold back NetMulticast RPCs until the end of the tick instead of sending an update for each one, and pack all the
+	 * multicasts sent by an actor in that tick into a single ring buffer element. Bursts of multicasts then cost one component update per
+	 * entity per tick and no longer overwrite each other in the ring buffer. Multicasts from the same actor keep their order.
+	 */
+	UPROPERTY(Config)
+	bool bBatchMulticastRPCs;
+
+	/**
+	 * EXPERIMENTAL: Before applying a batch of ops, parse the field IDs of every generated component update in it, and of every
+	 * component received while leaving a critical section, on worker threads. The game thread then only deserializes and applies the
+	 * properties, which spreads out some of the cost of large checkouts.
+	 */
+	UPROPERTY(Config)
+	bool bPrefetchComponentFieldIds;
+
+	/**
+	 * EXPERIMENTAL: Allow actors to opt in to push model replication via USpatialStatics::SetPushModelEnabled. Property comparison is
+	 * skipped for opted-in actors until gameplay code calls USpatialStatics::MarkActorPropertiesDirty after changing a replicated property
+	 * on the actor, its handover properties or any of its replicated subobjects.
+	 */
+	UPROPERTY(Config)
+	bool bEnablePushModelReplication;
+
+	/**
+	 * EXPERIMENTAL: Only snapshot and diff handover properties for actors that are about to change authority, or that are within
+	 * HandoverShadowDataBoundaryDistance of another worker's region. Handover shadow data is released for actors deep inside the local
+	 * region, and all handover properties are sent again once they approach a boundary.
+	 */
+	UPROPERTY(Config)
+	bool bLazyHandoverShadowData;
+
+	/**
+	 * Compress every struct and array handover field once it's at least MinCompressedBytesFieldSize bytes, as if it was marked with the
+	 * SpatialCompressed metadata, so migrating actors with large handover state send less. Requires schema generated with this setting.
+	 */
+	UPROPERTY(Config)
+	bool bCompressHandoverBytesFields;
+
+	/**
+	 * EXPERIMENTAL: Spawn at most MaxActorsSpawnedPerTick actors for newly checked out entities per tick. Newly checked out entities are
+	 * spawned highest priority class first (see ActorSpawnClassPriorities) and then nearest to the local player's pawn, or view point
+	 * without a pawn. Entities over the budget are queued in that order and all of their ops are held until they are spawned. Avoids long
+	 * hitches when joining a game with many entities in view, and spawns what the player is most likely to notice first.
+	 */
+	UPROPERTY(Config)
+	bool bTimeSliceActorSpawning;
+
+	/**
+	 * EXPERIMENTAL: Keep actors of classes implementing ISpatialPooledActor when their entity is removed from view, and reuse them for newly
+	 * checked out entities of the same class instead of spawning a new actor. Useful for short-lived actors such as projectiles.
+	 */
+	UPROPERTY(Config)
+	bool bEnableActorPooling;
+
+	/**
+	 * Load the compact binary schema database written next to the SchemaDatabase asset instead of the asset itself.
+	 * Class entries are then only decoded when a class is first used. Requires Content/Spatial to be staged as a non-asset directory.
+	 */
+	UPROPERTY(Config)
+	bool bUseCompactSchemaDatabase;
+
+	/**
+	 * Build class info for replicated actor classes placed in the map, the game mode's classes and ClassInfoPrewarmClasses after the map loads,
+	 * time sliced by ClassInfoPrewarmTimeBudgetMs, instead of the first time an actor of each class is checked out.
+	 */
+	UPROPERTY(Config)
+	bool bPrewarmClassInfo;
+
+	/**
+	 * Collect the packages requested by bAsyncLoadNewClassesOnEntityCheckout during a tick and request them together at the end of it.
+	 * Entities waiting on any package of a batch are replayed in checkout order once every package in the batch has loaded.
+	 */
+	UPROPERTY(Config)
+	bool bBatchAsyncClassLoads;
+
+	/**
+	 * EXPERIMENTAL: Build the Metadata and UnrealMetadata components of new entities from per-class templates that are serialized once
+	 * and copied for each entity, instead of serializing them again for every Actor.
+	 */
+	UPROPERTY(Config)
+	bool bCacheEntityComponentTemplates;
+
+	/**
+	 * EXPERIMENTAL: Adjust the number of create entity requests for Actors that may await a response at runtime. The limit grows while
+	 * responses arrive within EntityCreationTargetLatencySeconds and halves when requests time out or respond slower than that.
+	 * MaxCreateEntityRequestsInFlight, when set, caps the limit.
+	 */
+	UPROPERTY(Config)
+	bool bAdaptiveEntityCreationLimit;
+
+	/**
+	 * EXPERIMENTAL: Receive ops and send outgoing messages on two separate worker connection threads, so that sending a large number of
+	 * messages never delays receiving ops such as authority changes, and the other way round. The receiving thread waits in the Worker SDK
+	 * until ops arrive instead of polling at OpsUpdateRate. Not used when bRunSpatialWorkerConnectionOnGameThread is set.
+	 */
+	UPROPERTY(Config)
+	bool bSplitWorkerConnectionThreads;
+
+	/**
+	 * EXPERIMENTAL: Make the worker connection thread wait for ops in the Worker SDK for up to WorkerOpListTimeoutMs, instead of sleeping
+	 * for the OpsUpdateRate interval between polls, so received ops are queued for the game thread as soon as they arrive.
+	 * Not used when bSplitWorkerConnectionThreads or bRunSpatialWorkerConnectionOnGameThread is set.
+	 */
+	UPROPERTY(Config)
+	bool bBlockOnWorkerOpList;
+
+	/**
+	 * EXPERIMENTAL: Parse the field IDs of generated component updates on the worker connection thread as op lists are received, while
+	 * the game thread is still running the previous frame, so dispatching them at the start of the next frame only applies the properties.
+	 */
+	UPROPERTY(Config)
+	bool bPredecodeOpsOnConnectionThread;
+
+	/**
+	 * EXPERIMENTAL: Prepare actors this worker is not authoritative over for an authority handover while they are within
+	 * AuthorityPreStageDistance of the local load balancing region. Replicators, shadow data and handover shadow data are set up
+	 * ahead of time, so gaining authority when the actor crosses the boundary only refreshes the shadow data.
+	 */
+	UPROPERTY(Config)
+	bool bPreStageAuthorityHandover;
+
+	/**
+	 * Enable to check the heartbeats of all client connections on a server in a single timer sweep, instead of one timeout timer per connection.
+	 * Servers also stop receiving Heartbeat updates for player controllers they are not authoritative over.
+	 */
+	UPROPERTY(Config)
+	bool bAggregateServerHeartbeats;
+
+	/**
+	 * Enable to queue worker logs forwarded to SpatialOS in a bounded queue instead of sending each line as it is logged.
+	 * Queued lines are sampled per category, rate limited and sent in batches from the net driver tick, from any thread that logs.
+	 */
+	UPROPERTY(Config)
+	bool bAsyncLogForwarding;
+
+	/** Maximum number of log lines waiting to be forwarded with bAsyncLogForwarding, further lines are dropped. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxQueuedLogLines;
+
+	/** Maximum number of log lines below error level forwarded per second with bAsyncLogForwarding. 0 means no limit. */
+	UPROPERTY(Config)
+	uint32 MaxForwardedLogLinesPerSecond;
+
+	/** Maximum number of log lines of the same level combined into a single log message with bAsyncLogForwarding. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxLogLinesPerBatch;
+
+	/** Forwards only one in every N log lines below error level of these categories with bAsyncLogForwarding. */
+	UPROPERTY(Config)
+	TMap<FName, uint32> LogCategorySampleRates;
+
+	/**
+	 * Enable to pack cross-server RPCs sent to the same entity within a tick into a single command request, instead of sending
+	 * one command per RPC. Reliable and unreliable RPCs are batched separately, and a failed reliable batch is retried as a whole.
+	 */
+	UPROPERTY(Config)
+	bool bBatchCrossServerRPCs;
+
+	/** Maximum number of cross-server RPCs packed into a single command request with bBatchCrossServerRPCs. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxCrossServerRPCsPerBatch;
+
+	/**
+	 * Enable to send cross-server RPCs through a ring buffer on each server's worker entity instead of entity commands, when RPC ring buffers are
+	 * enabled. Every server acks the RPCs of every other server, and a ring buffer slot is reused once all of them have, except a server
+	 * which falls a whole ring buffer behind the others. RPCs are executed by the server authoritative over the target entity when the RPC
+	 * arrives, or held by the server gaining authority during a handover. Reliable RPCs are queued until every other server has seen the
+	 * sending server. Takes precedence over bBatchCrossServerRPCs.
+	 */
+	UPROPERTY(Config)
+	bool bUseRingBufferCrossServerRPCs;
+
+	/**
+	 * Each reliable RPC command retry waits for a random time within this fraction either side of its exponential backoff, so that
+	 * commands timing out together, e.g. while a worker restarts, aren't all retried at once.
+	 */
+	UPROPERTY(Config, meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ReliableRPCRetryJitter;
+
+	/** Maximum number of reliable RPC command retries awaiting a response, further retries wait until one completes. 0 means no limit. */
+	UPROPERTY(Config)
+	uint32 MaxReliableRPCRetriesInFlight;
+
+	/**
+	 * Enable to skip resending a FFastArraySerializer whose ArrayReplicationKey hasn't changed since the actor channel last sent it, as native
+	 * replication does. Items changed without MarkItemDirty or MarkArrayDirty are then only sent with the next change that is marked dirty.
+	 * The whole array is still sent when it is marked dirty, as SpatialOS stores it in a single field for workers checking out the entity.
+	 */
+	UPROPERTY(Config)
+	bool bSkipUnchangedFastArrays;
+
+	/**
+	 * Enable to compare small plain old data properties, such as numbers, enums and vectors, against the value the actor channel last sent
+	 * and drop them from component updates when they are equal. Covers properties which are set every frame but keep their value, and are
+	 * flagged as changed by push model or shadow data which was updated by a received update.
+	 */
+	UPROPERTY(Config)
+	bool bDropUnchangedPropertyWrites;
+
+	/**
+	 * EXPERIMENTAL: Overlap independent phases of worker startup. The connection to SpatialOS is started before the SchemaDatabase is
+	 * loaded, and servers build class info while waiting for their startup ops when bPrewarmClassInfo is set. Every phase of startup
+	 * is logged to LogSpatialStartupTimeline whether or not this is enabled.
+	 */
+	UPROPERTY(Config)
+	bool bOverlapStartupPhases;
+
+	/**
+	 * EXPERIMENTAL: Keep a client's connection to SpatialOS, along with its class info and SchemaDatabase, when it travels to a map on the
+	 * same host, such as after a server travel. Only the world is reset, so the client doesn't log in again before checking out the new map.
+	 * A kept connection is closed if the next map isn't on the same host or doesn't connect to SpatialOS. The entities already in view
+	 * are delivered again to the next map, for which the static component view keeps a copy of all of their component data.
+	 */
+	UPROPERTY(Config)
+	bool bKeepClientConnectionAcrossTravel;
+
+	/**
+	 * EXPERIMENTAL: Answer player spawn requests as they arrive but only spawn MaxPlayerSpawnsPerTick of them per tick, so a wave of
+	 * logins after a restart is spread over several ticks instead of hitching the server that owns the player spawner.
+	 */
+	UPROPERTY(Config)
+	bool bQueuePlayerSpawnRequests;
+
+	/**
+	 * Keep the player identity and login tokens fetched by the development authentication flow, and reuse them when the client
+	 * reconnects with the same config. The cached tokens are dropped if a connection made with them fails.
+	 */
+	UPROPERTY(Config)
+	bool bCacheDevelopmentAuthTokens;
+
+	/**
+	 * Attach all the dynamic subobjects an actor starts replicating in one update together: their components are added in one
+	 * add component sequence with a single ComponentPresence update, and authority over them is gained with a single EntityACL update.
+	 */
+	UPROPERTY(Config)
+	bool bBatchDynamicSubobjectAttachment;
+
+	/**
+	 * Track destroyed startup actors with one persistent LevelTombstones entity per level, holding a sorted set of the hashed
+	 * stable names of its destroyed actors, instead of one tombstone entity per actor. Workers destroy tombstoned actors as their
+	 * levels are loaded, and the entities of destroyed startup actors are deleted.
+	 */
+	UPROPERTY(Config)
+	bool bCompactStartupActorTombstones;
+
+	/**
+	 * EXPERIMENTAL: Build the query constraints of each ActorInterestComponent once, and reuse them for every interest update of its
+	 * actor. Actor-relative constraints are evaluated by SpatialOS around the entity's position, so the built constraints don't change
+	 * as the actor moves.
+	 */
+	UPROPERTY(Config)
+	bool bCacheActorInterestComponentQueries;
+
+	/**
+	 * EXPERIMENTAL: Keep the actors the server is authoritative over in a schedule keyed by their next net update time, and only visit the
+	 * actors which are due when building the list of actors to consider for replication each tick, instead of every active network object.
+	 */
+	UPROPERTY(Config)
+	bool bUseActorReplicationSchedule;
+
+	/**
+	 * EXPERIMENTAL: Servers track the positions every client views the world from, sharing those of their own clients with the other
+	 * server workers through their ServerWorker components. Actors this server is authoritative over which are further than their
+	 * NetCullDistance plus UnobservedActorWakeUpMargin from every client are unobserved, and tick at UnobservedActorTickInterval.
+	 * Requires schema generated with this version of the GDK.
+	 */
+	UPROPERTY(Config)
+	bool bThrottleUnobservedActors;
+
+	/** With bThrottleUnobservedActors, the tick interval of unobserved actors, in seconds. Actors with a longer interval keep it. */
+	UPROPERTY(Config)
+	float UnobservedActorTickInterval;
+
+	/** With bThrottleUnobservedActors, also stop replicating unobserved actors which already have an entity until they are observed again. */
+	UPROPERTY(Config)
+	bool bSkipReplicationOfUnobservedActors;
+
+	/** With bThrottleUnobservedActors, the distance beyond an actor's NetCullDistance at which a client wakes it up, in centimeters. */
+	UPROPERTY(Config)
+	float UnobservedActorWakeUpMargin;
+
+	/** With bThrottleUnobservedActors, how often client view positions are published and gathered, and actors throttled, in seconds. */
+	UPROPERTY(Config)
+	float ClientObservationUpdateIntervalSeconds;
+
+	/**
+	 * EXPERIMENTAL: SpatialPingComponent carries its ping IDs on the RPC endpoint components, instead of sending an RPC which the server
+	 * answers with a replicated property. The server echoes the ID back with its RPC acks. Requires the RPC ring buffers, and schema
+	 * generated with this version of the GDK.
+	 */
+	UPROPERTY(Config)
+	bool bUseEndpointPings;
+
+	/**
+	 * EXPERIMENTAL: Send ReplicatedMovement as the GDK's RepMovement schema type, with its location, rotation and velocities quantized to
+	 * the actor's quantization levels and zero values left out, instead of NetSerializing it into bytes. Clients broadcast
+	 * SpatialGDK::CompactRepMovement::OnMovementReceived when it is applied. Requires schema generated with this setting.
+	 */
+	UPROPERTY(Config)
+	bool bUseCompactReplicatedMovement;
+
+	/**
+	 * EXPERIMENTAL: Stop processing received ops each tick once OpProcessingTimeBudgetMs or MaxOpsProcessedPerTick is reached, and carry on
+	 * from the same op on the next tick. Critical sections are always processed as a whole. Spreads out the cost of large bursts of ops,
+	 * such as when checking out many entities, at the cost of applying them later.
+	 */
+	UPROPERTY(Config)
+	bool bTimeSliceOpProcessing;
+
+	/**
+	 * EXPERIMENTAL: Server workers beyond the number of virtual workers the load balancing strategy needs are kept as standbys, each
+	 * with interest on the region of an assigned virtual worker. Server workers send a heartbeat on their ServerWorker component, and
+	 * when one stops for ServerWorkerHeartbeatTimeout, or its entity is gone, its virtual worker is handed to its standby, which already
+	 * has the region's entities checked out.
+	 */
+	UPROPERTY(Config)
+	bool bEnableServerWorkerFailover;
+
+	/**
+	 * EXPERIMENTAL: When a client loses its connection to SpatialOS through a timeout or network error, it keeps its actors and static
+	 * component view and connects again for up to ClientRejoinGracePeriod. Its spawn request then asks for the player controller it had,
+	 * which servers keep for the grace period after the client's worker is gone, and the entities it checks out again are applied to
+	 * the existing actors instead of being spawned. Needs to be set on clients and servers.
+	 */
+	UPROPERTY(Config)
+	bool bEnableClientFastRejoin;
+
+	/**
+	 * EXPERIMENTAL: Rewrite the interest built for each actor, and for server workers, into fewer equivalent queries. Queries with the same
+	 * result type and frequency are merged, queries contained in another query with at least the same frequency are dropped, and nested
+	 * spheres, cylinders and boxes are collapsed. What is checked out, and at which frequency, is unchanged.
+	 */
+	UPROPERTY(Config)
+	bool bOptimizeInterestQueries;
+
+	/**
+	 * EXPERIMENTAL: When a server becomes ready for play, decide which actors it is authoritative over in batches of
+	 * STARTUP_ROLE_ASSIGNMENT_ACTORS_PER_BATCH actors spread over worker threads, if the load balancing strategy supports it. The roles
+	 * are still applied on the game thread. Speeds up server startup and server travel on large maps.
+	 */
+	UPROPERTY(Config)
+	bool bParallelizeStartupActorRoleAssignment;
+
+	/** Maximum number of delete entity requests awaiting a response when wiping the world. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxWorldWipeDeleteRequestsInFlight;
+
+	/**
+	 * EXPERIMENTAL: Asynchronously load the next map of a server travel while the world is being wiped, so it's already in memory when the
+	 * travel finishes. Has no effect in PIE, where the map is duplicated from the editor world instead.
+	 */
+	UPROPERTY(Config)
+	bool bPreloadServerTravelMap;
+
+	/** Number of entities read from the snapshot, and reserved entity IDs for, at a time when loading a snapshot. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 SnapshotLoadBatchSize;
+
+	/** Maximum number of create entity requests awaiting a response when loading a snapshot. Further batches are read once responses arrive. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxSnapshotCreateEntityRequestsInFlight;
+
+	/**
+	 * EXPERIMENTAL: Server workers write the persistent entities they changed, or gained authority over, to RuntimeCheckpointDirectory
+	 * every RuntimeCheckpointIntervalSeconds, in the background. The newest state of every entity written is restored with
+	 * SpatialSnapshotManager::LoadCheckpoint, without needing a runtime snapshot.
+	 */
+	UPROPERTY(Config)
+	bool bEnableRuntimeCheckpoints;
+
+	UPROPERTY(Config, meta = (EditCondition = "bEnableRuntimeCheckpoints", ClampMin = "0.0"))
+	float RuntimeCheckpointIntervalSeconds;
+
+	/** Number of entities written to each checkpoint chunk when bEnableRuntimeCheckpoints is set. */
+	UPROPERTY(Config, meta = (EditCondition = "bEnableRuntimeCheckpoints", ClampMin = "1"))
+	int32 RuntimeCheckpointChunkSize;
+
+	/** Maximum number of entities copied for a checkpoint per second, which bounds the game thread's share of the work. */
+	UPROPERTY(Config, meta = (EditCondition = "bEnableRuntimeCheckpoints", ClampMin = "1.0"))
+	float RuntimeCheckpointMaxEntitiesPerSecond;
+
+	/** Where checkpoint chunks are written. When empty, Saved/SpatialCheckpoints is used. */
+	UPROPERTY(Config, meta = (EditCondition = "bEnableRuntimeCheckpoints"))
+	FString RuntimeCheckpointDirectory;
+
+	/** Maximum time in milliseconds the worker connection thread waits for ops when bBlockOnWorkerOpList is set. Outgoing messages can wait this long to be sent. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 WorkerOpListTimeoutMs;
+
+	/** Maximum number of inactive actors kept per class when bEnableActorPooling is set. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxPooledActorsPerClass;
+
+	/** Number of actors spawned for checked out entities per tick when bTimeSliceActorSpawning is set. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxActorsSpawnedPerTick;
+
+	/**
+	 * Spawn priority of actor classes, and their derived classes, when bTimeSliceActorSpawning is set. Classes without an entry use their
+	 * NetPriority. Higher priorities are spawned first.
+	 */
+	UPROPERTY(Config)
+	TMap<TSoftClassPtr<AActor>, float> ActorSpawnClassPriorities;
+
+	/** Number of queued player spawn requests processed per tick when bQueuePlayerSpawnRequests is set. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxPlayerSpawnsPerTick;
+
+	/** Time in milliseconds spent processing received ops per tick when bTimeSliceOpProcessing is set. 0 leaves the time unbounded. */
+	UPROPERTY(Config, meta = (ClampMin = "0.0"))
+	float OpProcessingTimeBudgetMs;
+
+	/** Number of received ops processed per tick when bTimeSliceOpProcessing is set. 0 leaves the number unbounded. */
+	UPROPERTY(Config)
+	uint32 MaxOpsProcessedPerTick;
+
+	/** Time in seconds without a heartbeat after which a server worker is considered lost, when bEnableServerWorkerFailover is set. */
+	UPROPERTY(Config, meta = (ClampMin = "1.0"))
+	float ServerWorkerHeartbeatTimeout;
+
+	/**
+	 * Time in seconds a disconnected client keeps trying to rejoin, and servers keep its player controller, when bEnableClientFastRejoin
+	 * is set. Servers still clean up the player once HeartbeatTimeoutSeconds passes without a heartbeat, so keep it below that.
+	 */
+	UPROPERTY(Config, meta = (ClampMin = "1.0"))
+	float ClientRejoinGracePeriod;
+
+	/** Values of bytes fields marked with the SpatialCompressed metadata are compressed with LZ4 once they're at least this many bytes. 0 sends them uncompressed. */
+	UPROPERTY(Config)
+	uint32 MinCompressedBytesFieldSize;
+
+	/** Distance in cm from the edge of the local load balancing region within which handover shadow data is kept, when bLazyHandoverShadowData is set. */
+	UPROPERTY(Config)
+	float HandoverShadowDataBoundaryDistance;
+
+	/** Distance in cm outside the local load balancing region within which actors are prepared for gaining authority, when bPreStageAuthorityHandover is set. */
+	UPROPERTY(Config, meta = (ClampMin = "0.0"))
+	float AuthorityPreStageDistance;
+
+	/** Minimum time in seconds a server keeps authority over an actor after gaining it, before the load balancing strategy can move it again. */
+	UPROPERTY(Config, meta = (ClampMin = "0.0"))
+	float AuthorityMigrationBackoffTime;
+
+	/**
+	 * The migration backoff time is multiplied by the number of times this server gained authority over the actor in quick succession,
+	 * up to this many times, so actors bouncing between workers are handed over less and less often. 1 disables the damping.
+	 */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 MaxAuthorityMigrationBackoffMultiplier;
+
+	/** Time in milliseconds spent building class info per tick when bPrewarmClassInfo is set. At least one class is built each tick. */
+	UPROPERTY(Config, meta = (ClampMin = "0.0"))
+	float ClassInfoPrewarmTimeBudgetMs;
+
+	/** Additional classes to build class info for when bPrewarmClassInfo is set, such as those reported as built lazily by the class info manager. */
+	UPROPERTY(Config)
+	TArray<FSoftClassPath> ClassInfoPrewarmClasses;
+
 	/** RPC ring buffers is enabled when either the matching setting is set, or load balancing is enabled */
 	bool UseRPCRingBuffer() const;
 
@@ -247,6 +1169,52 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Max RPC Ring Buffer Size"))
 	uint32 MaxRPCRingBufferSize;
 
+	/**
+	 * Queue unreliable RPCs which don't fit in their ring buffer, instead of dropping them. Reliable RPCs are always queued and never
+	 * dropped, while queued unreliable RPCs are bounded per entity and dropped according to UnreliableRPCOverflowDropPolicy.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Queue Overflowed Unreliable RPCs"))
+	bool bQueueOverflowedUnreliableRPCs;
+
+	/** The maximum number of overflowed unreliable RPCs of each type queued for an entity. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (EditCondition = "bQueueOverflowedUnreliableRPCs", ClampMin = "1", DisplayName = "Max Overflowed Unreliable RPCs Per Entity"))
+	uint32 MaxOverflowedUnreliableRPCsPerEntity;
+
+	/** Which RPC to drop when an entity's overflowed unreliable RPC queue is full. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (EditCondition = "bQueueOverflowedUnreliableRPCs", DisplayName = "Unreliable RPC Overflow Drop Policy"))
+	TEnumAsByte<EOverflowedRPCDropPolicy::Type> UnreliableRPCOverflowDropPolicy;
+
+	/**
+	 * Time in seconds after which an unreliable RPC which is still waiting to be sent or executed is dropped, such as one queued for
+	 * unresolved references or overflowed from its ring buffer. 0 keeps them until they can be processed.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (ClampMin = "0.0", DisplayName = "Default Unreliable RPC Time To Live"))
+	float DefaultUnreliableRPCTimeToLive;
+
+	/** Overrides the default time to live for unreliable RPCs of a type. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Unreliable RPC Time To Live Map"))
+	TMap<ERPCType, float> UnreliableRPCTimeToLiveMap;
+
+	/** Returns 0 for reliable and cross server RPCs, which are never dropped for their age. */
+	float GetUnreliableRPCTimeToLive(ERPCType RPCType) const;
+
+	/**
+	 * EXPERIMENTAL: Time in seconds that acks of received ring buffer RPCs may be held back, so that they are sent with the next RPCs
+	 * going the other way instead of in an update of their own. An ack is sent on its own once it has waited this long, or straight away
+	 * if the sender's ring buffer is filling up. 0 sends acks on the tick the RPCs are received.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (ClampMin = "0.0", DisplayName = "RPC Ack Delay (seconds)"))
+	float RPCAckDelaySeconds;
+
+	/**
+	 * Names of the RPCs, such as those for shooting or activating abilities, which are sent to SpatialOS as soon as they are called
+	 * instead of at the end of the tick and the next flush of the connection. RPCs to the entity sent earlier in the tick are sent
+	 * with them. Only applies to RPCs sent through ring buffers, see bUseRPCRingBuffers. When the list isn't empty, the connection
+	 * thread waits on an event that a flush can wake, rather than sleeping through its OpsUpdateRate interval.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Latency Critical RPCs"))
+	TArray<FName> LatencyCriticalRPCs;
+
 	/** Only valid on Tcp connections - indicates if we should enable TCP_NODELAY - see c_worker.h */
 	UPROPERTY(Config)
 	bool bTcpNoDelay;
@@ -259,10 +1227,46 @@ public:
 	UPROPERTY(Config)
 	uint32 UdpClientDownstreamUpdateIntervalMS;
 
+	/** Network transport profiles worker types can connect with, on top of the built in LowLatency, HighThroughput and Mobile profiles. A profile here replaces a built in one with the same name. */
+	UPROPERTY(Config)
+	TMap<FName, FSpatialNetworkTransportProfile> NetworkTransportProfiles;
+
+	/**
+	 * The network transport profile each worker type connects with. Worker types without one use bTcpNoDelay and the Udp update intervals above.
+	 * A single worker can pick a different profile with -networkTransportProfile=<name>.
+	 */
+	UPROPERTY(Config)
+	TMap<FName, FName> WorkerTypeNetworkTransportProfiles;
+
+	/** Finds the profile a worker of the given type connects with, or returns nullptr if it should use the individual network settings. */
+	const FSpatialNetworkTransportProfile* GetNetworkTransportProfile(const FString& WorkerType, FName& OutProfileName) const;
+
+	/**
+	 * Stack size, priority, core affinity and busy polling of the threads owned by the GDK, by thread name: SpatialWorkerConnectionWorker,
+	 * SpatialWorkerConnectionSender (with bSplitWorkerConnectionThreads), SpatialCheckpointWriter and PrometheusMetricsEndpoint.
+	 * Threads without a policy are created as before. The placement of each thread is logged when it starts.
+	 */
+	UPROPERTY(Config)
+	TMap<FName, FSpatialThreadPolicy> ThreadPolicies;
+
+	/** The policy of the named thread, or the default policy if none is set for it. */
+	const FSpatialThreadPolicy& GetThreadPolicy(FName ThreadName) const;
+
 	/** Will flush worker messages immediately after every RPC. Higher bandwidth but lower latency on RPC calls. */
 	UPROPERTY(Config)
 	bool bWorkerFlushAfterOutgoingNetworkOp;
 
+	/**
+	 * When to flush queued RPC updates, including RPC ring buffer updates. Not used when bWorkerFlushAfterOutgoingNetworkOp is set.
+	 * A deadline shorter than the OpsUpdateRate interval also shortens how long the worker connection thread waits between sends.
+	 */
+	UPROPERTY(Config)
+	FSpatialFlushRule RPCFlushRule;
+
+	/** When to flush queued property updates and added components. Not used when bWorkerFlushAfterOutgoingNetworkOp is set. */
+	UPROPERTY(Config)
+	FSpatialFlushRule PropertyUpdateFlushRule;
+
 	/** Do async loading for new classes when checking out entities. */
 	UPROPERTY(Config)
 	bool bAsyncLoadNewClassesOnEntityCheckout;
@@ -293,6 +1297,23 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableNetCullDistanceFrequency"))
 	TArray<FDistanceFrequencyPair> InterestRangeFrequencyPairs;
 
+	/**
+	 * Actor classes, and their derived classes, whose data components and subobject data components clients still receive for entities
+	 * that are only in low detail interest bands. Other entities in those bands only receive the components needed to keep their actor checked out, and receive
+	 * their replicated state again once they are in a full detail band.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableNetCullDistanceFrequency"))
+	TArray<TSoftClassPtr<AActor>> LowDetailInterestClasses;
+
+	/**
+	 * Minimum time, in seconds, between adding sublevels made visible by a game client to its interest. When a client makes several sublevels
+	 * visible, they are added one at a time, nearest to its pawn first, so that the entities of a dense area are checked out over several
+	 * interest updates instead of all at once. Sublevels made invisible are removed from its interest straight away.
+	 * Default: `0` (sublevels are added as soon as they are visible)
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (ClampMin = "0.0", DisplayName = "Client Level Interest Activation Interval (seconds)"))
+	float ClientLevelInterestActivationIntervalSeconds;
+
 	/** Use TLS encryption for UnrealClient workers connection. May impact performance. Only works in non-editor builds. */
 	UPROPERTY(EditAnywhere, Config, Category = "Connection", meta = (DisplayName = "Use Secure Client Connection In Packaged Builds"))
 	bool bUseSecureClientConnection;
@@ -324,4 +1345,12 @@ public:
 	  */
 	UPROPERTY(Config)
 	bool bEnableMultiWorkerDebuggingWarnings;
+
+	/**
+	  * Maximum number of EntityACL updates sent per tick to move authority to the worker given by each entity's authority intent.
+	  * When a load balancing boundary moves, the remaining entities migrate over the following ticks, client-owned entities first.
+	  * 0 sends every queued update in the same tick.
+	  */
+	UPROPERTY(Config)
+	uint32 MaxAclAssignmentsPerTick;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "SpatialView/BufferHighWaterMark.h"
 #include "SpatialView/EntityComponentId.h"
 #include "Containers/Array.h"
 
@@ -31,7 +32,7 @@ public:
 	//    ignored
 	void SetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Worker_Authority Authority);
 
-	// Remove all records.
+	// Remove all records, keeping the allocated memory for reuse.
 	void Clear();
 
 	// Get all entity-components with an authority change recorded as gained.
@@ -45,6 +46,10 @@ private:
 	TArray<EntityComponentId> AuthorityGained;
 	TArray<EntityComponentId> AuthorityLost;
 	TArray<EntityComponentId> AuthorityLossTemporary;
+
+	BufferHighWaterMark AuthorityGainedHighWaterMark;
+	BufferHighWaterMark AuthorityLostHighWaterMark;
+	BufferHighWaterMark AuthorityLossTemporaryHighWaterMark;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Math/UnrealMathUtility.h"
+
+namespace SpatialGDK
+{
+
+// Tracks how much of a buffer which is reset every tick is used, so that its storage can be kept from tick to tick
+// and only given back after a prolonged period of low activity.
+class BufferHighWaterMark
+{
+public:
+	// Number of resets over which the peak usage is measured.
+	static constexpr int32 TrimPeriod = 600;
+	// Storage is trimmed if the peak usage over a period was less than this fraction of the capacity.
+	static constexpr int32 TrimRatio = 4;
+	// Buffers with at most this capacity are never trimmed.
+	static constexpr int32 MinRetainedCapacity = 64;
+
+	// Records the number of elements used before a reset.
+	// Returns the number of elements to shrink the storage to, or INDEX_NONE if the storage should be kept.
+	int32 OnReset(int32 NumUsed, int32 Capacity)
+	{
+		PeakInPeriod = FMath::Max(PeakInPeriod, NumUsed);
+		if (++ResetsInPeriod < TrimPeriod)
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 Peak = PeakInPeriod;
+		ResetsInPeriod = 0;
+		PeakInPeriod = 0;
+		return Capacity > FMath::Max(Peak * TrimRatio, MinRetainedCapacity) ? Peak : INDEX_NONE;
+	}
+
+	// Resets a TArray, keeping its storage unless it is due to be trimmed.
+	template <typename ArrayType>
+	void Reset(ArrayType& Array)
+	{
+		const int32 TrimSize = OnReset(Array.Num(), Array.Max());
+		if (TrimSize == INDEX_NONE)
+		{
+			Array.Reset();
+		}
+		else
+		{
+			Array.Empty(TrimSize);
+		}
+	}
+
+private:
+	int32 PeakInPeriod = 0;
+	int32 ResetsInPeriod = 0;
+};
+
+} // namespace SpatialGDK
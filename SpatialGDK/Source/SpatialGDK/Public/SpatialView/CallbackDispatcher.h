@@ -0,0 +1,127 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialView/EntityComponentTypes.h"
+#include "SpatialView/IndexedEntityComponentArray.h"
+#include "SpatialView/ViewDelta.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Templates/Function.h"
+
+namespace SpatialGDK
+{
+
+// Registry of per component callbacks for the changes in a view delta.
+// Each delta is scanned once for all registered callbacks. The changes of each kind are dispatched in ascending
+// (entity, component) order, with the kinds in the order: added, complete updates, updates, authority gained,
+// authority lost temporarily, authority lost, removed.
+// Callbacks must not be registered or removed from within a callback.
+class CallbackDispatcher
+{
+public:
+	using CallbackId = uint32;
+
+	template <typename ElementType>
+	using Callback = TFunction<void(const ElementType&)>;
+
+	// Each registration returns a new ID, which can be passed to RemoveCallback.
+	CallbackId OnComponentAdded(Worker_ComponentId ComponentId, Callback<EntityComponentData> InCallback);
+	CallbackId OnComponentRemoved(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback);
+	CallbackId OnComponentUpdate(Worker_ComponentId ComponentId, Callback<EntityComponentUpdate> InCallback);
+	CallbackId OnComponentCompleteUpdate(Worker_ComponentId ComponentId, Callback<EntityComponentCompleteUpdate> InCallback);
+	CallbackId OnAuthorityGained(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback);
+	CallbackId OnAuthorityLost(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback);
+	CallbackId OnAuthorityLostTemporarily(Worker_ComponentId ComponentId, Callback<EntityComponentId> InCallback);
+	bool RemoveCallback(CallbackId Id);
+
+	void InvokeCallbacks(const ViewDelta& Delta);
+
+private:
+	template <typename ElementType>
+	class ComponentCallbacks
+	{
+	public:
+		void Add(Worker_ComponentId ComponentId, CallbackId Id, Callback<ElementType> InCallback)
+		{
+			Callbacks.FindOrAdd(ComponentId).Add(Entry{ Id, MoveTemp(InCallback) });
+		}
+
+		bool Remove(CallbackId Id)
+		{
+			for (auto It = Callbacks.CreateIterator(); It; ++It)
+			{
+				if (It.Value().RemoveAll([Id](const Entry& E) { return E.Id == Id; }) > 0)
+				{
+					if (It.Value().Num() == 0)
+					{
+						It.RemoveCurrent();
+					}
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void Invoke(const TArray<ElementType>& Elements)
+		{
+			if (Callbacks.Num() == 0)
+			{
+				return;
+			}
+
+			Matching.Reset();
+			for (const ElementType& Element : Elements)
+			{
+				const EntityComponentId Id = IndexedEntityComponentArrayPrivate::GetEntityComponentId(Element);
+				if (const TArray<Entry>* ComponentEntries = Callbacks.Find(Id.ComponentId))
+				{
+					Matching.Add(MatchedElement{ Id, &Element, ComponentEntries });
+				}
+			}
+
+			Matching.Sort([](const MatchedElement& Lhs, const MatchedElement& Rhs)
+			{
+				return Lhs.Id.EntityId != Rhs.Id.EntityId ? Lhs.Id.EntityId < Rhs.Id.EntityId : Lhs.Id.ComponentId < Rhs.Id.ComponentId;
+			});
+
+			for (const MatchedElement& Match : Matching)
+			{
+				for (const Entry& ComponentEntry : *Match.Entries)
+				{
+					ComponentEntry.Function(*Match.Element);
+				}
+			}
+		}
+
+	private:
+		struct Entry
+		{
+			CallbackId Id;
+			Callback<ElementType> Function;
+		};
+
+		struct MatchedElement
+		{
+			EntityComponentId Id;
+			const ElementType* Element;
+			const TArray<Entry>* Entries;
+		};
+
+		TMap<Worker_ComponentId, TArray<Entry>> Callbacks;
+		// Kept between deltas to avoid reallocating.
+		TArray<MatchedElement> Matching;
+	};
+
+	CallbackId NextCallbackId = 1;
+
+	ComponentCallbacks<EntityComponentData> ComponentAddedCallbacks;
+	ComponentCallbacks<EntityComponentId> ComponentRemovedCallbacks;
+	ComponentCallbacks<EntityComponentUpdate> ComponentUpdateCallbacks;
+	ComponentCallbacks<EntityComponentCompleteUpdate> ComponentCompleteUpdateCallbacks;
+	ComponentCallbacks<EntityComponentId> AuthorityGainedCallbacks;
+	ComponentCallbacks<EntityComponentId> AuthorityLostCallbacks;
+	ComponentCallbacks<EntityComponentId> AuthorityLostTemporarilyCallbacks;
+};
+
+}  // namespace SpatialGDK
@@ -13,6 +13,9 @@ class ComponentUpdate;
 
 struct ComponentDataDeleter
 {
+	// False when wrapping data owned elsewhere, such as by the op list it was received in.
+	bool bOwning = true;
+
 	void operator()(Schema_ComponentData* ComponentData) const noexcept;
 };
 
@@ -36,12 +39,17 @@ public:
 	ComponentData& operator=(ComponentData&&) = default;
 
 	static ComponentData CreateCopy(const Schema_ComponentData* Data, Worker_ComponentId Id);
+	// Wraps component data without taking ownership. The underlying data must outlive the returned object and anything it is moved to.
+	static ComponentData CreateView(Schema_ComponentData* Data, Worker_ComponentId Id);
 
 	// Creates a copy of the component data.
 	ComponentData DeepCopy() const;
-	// Releases ownership of the component data.
+	// Releases ownership of the component data. Must only be called on owning objects.
 	Schema_ComponentData* Release() &&;
 
+	// Returns false for objects created with CreateView.
+	bool IsOwning() const;
+
 	// Appends the fields from the provided update.
 	// Returns true if the update was successfully applied and false otherwise.
 	// This will cause the size of the component data to increase.
@@ -11,6 +11,9 @@ namespace SpatialGDK
 
 struct ComponentUpdateDeleter
 {
+	// False when wrapping an update owned elsewhere, such as by the op list it was received in.
+	bool bOwning = true;
+
 	void operator()(Schema_ComponentUpdate* ComponentUpdate) const noexcept;
 };
 
@@ -34,12 +37,17 @@ public:
 	ComponentUpdate& operator=(ComponentUpdate&&) = default;
 
 	static ComponentUpdate CreateCopy(const Schema_ComponentUpdate* Update, Worker_ComponentId Id);
+	// Wraps a component update without taking ownership. The underlying update must outlive the returned object and anything it is moved to.
+	static ComponentUpdate CreateView(Schema_ComponentUpdate* Update, Worker_ComponentId Id);
 
 	// Creates a copy of the component update.
 	ComponentUpdate DeepCopy() const;
-	// Releases ownership of the component update.
+	// Releases ownership of the component update. Must only be called on owning objects.
 	Schema_ComponentUpdate* Release() &&;
 
+	// Returns false for objects created with CreateView.
+	bool IsOwning() const;
+
 	// Appends the fields and events from other to the update.
 	bool Merge(ComponentUpdate Update);
 
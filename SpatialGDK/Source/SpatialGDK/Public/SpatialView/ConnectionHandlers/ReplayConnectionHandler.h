@@ -0,0 +1,90 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Interop/Connection/OpListRecording.h"
+#include "SpatialView/ConnectionHandlers/AbstractConnectionHandler.h"
+#include "SpatialView/OpList/AbstractOpList.h"
+#include "Containers/Array.h"
+
+namespace SpatialGDK
+{
+
+// Plays back a recording written by FOpListRecorder without a connection to a deployment, one recorded op list per Advance.
+// Sent messages are dropped, only their count is kept for comparing a replay against the recorded outgoing messages.
+class ReplayConnectionHandler : public AbstractConnectionHandler
+{
+public:
+	explicit ReplayConnectionHandler(const FString& Filename)
+	{
+		bIsValid = Reader.Open(Filename);
+	}
+
+	bool IsValid() const
+	{
+		return bIsValid;
+	}
+
+	bool HasFinished() const
+	{
+		return bFinished;
+	}
+
+	void Advance() override
+	{
+		if (!bIsValid || bFinished)
+		{
+			return;
+		}
+
+		TUniquePtr<RecordedOpList> OpList = Reader.ReadNextOpList();
+		if (!OpList.IsValid())
+		{
+			bFinished = true;
+			return;
+		}
+
+		OpLists.Push(MoveTemp(OpList));
+	}
+
+	uint32 GetOpListCount() override
+	{
+		return OpLists.Num();
+	}
+
+	TUniquePtr<AbstractOpList> GetNextOpList() override
+	{
+		if (OpLists.Num() == 0)
+		{
+			return MakeUnique<RecordedOpList>();
+		}
+
+		TUniquePtr<AbstractOpList> NextOpList = MoveTemp(OpLists[0]);
+		OpLists.RemoveAt(0);
+		return NextOpList;
+	}
+
+	void SendMessages(TUniquePtr<MessagesToSend> Messages) override
+	{
+		NumSentCreateEntityRequests += Messages->CreateEntityRequests.Num();
+	}
+
+	const TArray<FRecordedOutgoingMessage>& GetRecordedOutgoingMessages() const
+	{
+		return Reader.GetOutgoingMessages();
+	}
+
+	int32 GetNumSentCreateEntityRequests() const
+	{
+		return NumSentCreateEntityRequests;
+	}
+
+private:
+	FOpListRecordingReader Reader;
+	TArray<TUniquePtr<AbstractOpList>> OpLists;
+	int32 NumSentCreateEntityRequests = 0;
+	bool bIsValid = false;
+	bool bFinished = false;
+};
+
+}  // namespace SpatialGDK
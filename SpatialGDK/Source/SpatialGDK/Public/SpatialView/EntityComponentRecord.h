@@ -4,6 +4,7 @@
 
 #include "SpatialView/EntityComponentId.h"
 #include "SpatialView/EntityComponentUpdateRecord.h"
+#include "SpatialView/IndexedEntityComponentArray.h"
 #include "Containers/Array.h"
 
 namespace SpatialGDK
@@ -31,8 +32,8 @@ public:
 	const TArray<EntityComponentCompleteUpdate>& GetCompleteUpdates() const;
 
 private:
-	TArray<EntityComponentData> ComponentsAdded;
-	TArray<EntityComponentId> ComponentsRemoved;
+	IndexedEntityComponentArray<EntityComponentData> ComponentsAdded;
+	IndexedEntityComponentArray<EntityComponentId> ComponentsRemoved;
 	EntityComponentUpdateRecord UpdateRecord;
 };
 
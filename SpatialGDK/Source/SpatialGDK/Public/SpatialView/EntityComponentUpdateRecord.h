@@ -4,6 +4,7 @@
 
 #include "SpatialView/EntityComponentId.h"
 #include "SpatialView/EntityComponentTypes.h"
+#include "SpatialView/IndexedEntityComponentArray.h"
 #include "Containers/Array.h"
 
 namespace SpatialGDK
@@ -44,8 +45,8 @@ private:
 	void InsertOrMergeUpdate(Worker_EntityId EntityId, ComponentUpdate Update);
 	void InsertOrSetCompleteUpdate(Worker_EntityId EntityId, ComponentData CompleteUpdate);
 
-	TArray<EntityComponentUpdate> Updates;
-	TArray<EntityComponentCompleteUpdate> CompleteUpdates;
+	IndexedEntityComponentArray<EntityComponentUpdate> Updates;
+	IndexedEntityComponentArray<EntityComponentCompleteUpdate> CompleteUpdates;
 };
 
 } // namespace SpatialGDK
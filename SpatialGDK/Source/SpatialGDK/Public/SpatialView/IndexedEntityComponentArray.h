@@ -0,0 +1,104 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialView/BufferHighWaterMark.h"
+#include "SpatialView/EntityComponentId.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+
+namespace SpatialGDK
+{
+
+namespace IndexedEntityComponentArrayPrivate
+{
+inline EntityComponentId GetEntityComponentId(const EntityComponentId& Id)
+{
+	return Id;
+}
+
+template <typename ElementType>
+EntityComponentId GetEntityComponentId(const ElementType& Element)
+{
+	return Element.GetEntityComponentId();
+}
+} // namespace IndexedEntityComponentArrayPrivate
+
+// An unordered array holding at most one element per entity-component, with a hashed index for constant time lookup and removal.
+// Elements are removed by swapping with the last element, so pointers and indices into the array are invalidated on removal.
+template <typename ElementType>
+class IndexedEntityComponentArray
+{
+public:
+	ElementType* Find(const EntityComponentId& Id)
+	{
+		const int32* Index = Indices.Find(Id);
+		return Index != nullptr ? &Elements[*Index] : nullptr;
+	}
+
+	const ElementType* Find(const EntityComponentId& Id) const
+	{
+		const int32* Index = Indices.Find(Id);
+		return Index != nullptr ? &Elements[*Index] : nullptr;
+	}
+
+	bool Contains(const EntityComponentId& Id) const
+	{
+		return Indices.Contains(Id);
+	}
+
+	// The entity-component must not already be in the array.
+	void Add(ElementType Element)
+	{
+		const EntityComponentId Id = IndexedEntityComponentArrayPrivate::GetEntityComponentId(Element);
+		check(!Indices.Contains(Id));
+		Indices.Add(Id, Elements.Num());
+		Elements.Push(MoveTemp(Element));
+	}
+
+	// Returns true if the entity-component was in the array.
+	bool Remove(const EntityComponentId& Id)
+	{
+		int32 Index;
+		if (!Indices.RemoveAndCopyValue(Id, Index))
+		{
+			return false;
+		}
+
+		const int32 LastIndex = Elements.Num() - 1;
+		if (Index != LastIndex)
+		{
+			Indices[IndexedEntityComponentArrayPrivate::GetEntityComponentId(Elements[LastIndex])] = Index;
+		}
+		Elements.RemoveAtSwap(Index, 1, /* bAllowShrinking */ false);
+		return true;
+	}
+
+	// Removes all elements, keeping the allocated memory for reuse unless the array has been mostly unused for a while.
+	void Reset()
+	{
+		const int32 TrimSize = HighWaterMark.OnReset(Elements.Num(), Elements.Max());
+		if (TrimSize == INDEX_NONE)
+		{
+			Elements.Reset();
+			Indices.Reset();
+		}
+		else
+		{
+			Elements.Empty(TrimSize);
+			Indices.Empty(TrimSize);
+		}
+	}
+
+	const TArray<ElementType>& GetElements() const
+	{
+		return Elements;
+	}
+
+private:
+	TArray<ElementType> Elements;
+	TMap<EntityComponentId, int32> Indices;
+	BufferHighWaterMark HighWaterMark;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,98 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialView/EntityComponentTypes.h"
+#include "SpatialView/ViewDelta.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Templates/Function.h"
+#include <improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// The components of every entity in the view, maintained by the ViewCoordinator.
+using EntityComponentMap = TMap<Worker_EntityId, TSet<Worker_ComponentId>>;
+
+// A filtered part of the view, for consumers that only care about some of the entities the worker sees.
+// An entity is in the subview while it has all of the required components and the predicate, if any, returns true for it.
+// Tag components are plain required components.
+// The predicate is re-evaluated when the entity gains or loses a component, or when one of the refresh components is updated.
+class SubView
+{
+public:
+	using FilterPredicate = TFunction<bool(Worker_EntityId, const TSet<Worker_ComponentId>&)>;
+
+	struct Filter
+	{
+		TArray<Worker_ComponentId> RequiredComponents;
+		FilterPredicate Predicate;
+		TArray<Worker_ComponentId> RefreshComponents;
+	};
+
+	// Entities already in the view which match the filter are reported as added on the first call to Advance.
+	SubView(Filter InFilter, const EntityComponentMap& InEntityComponents);
+
+	// Filters the delta. Must be called after the entity component map has been updated with the delta.
+	void Advance(const ViewDelta& Delta);
+
+	// All entities currently in the subview, in ascending order.
+	const TArray<Worker_EntityId>& GetCompleteEntities() const;
+	// Entities which entered or left the subview in the last delta.
+	const TArray<Worker_EntityId>& GetEntitiesAdded() const;
+	const TArray<Worker_EntityId>& GetEntitiesRemoved() const;
+
+	// The changes in the last delta to entities which are in the subview, or which left it in that delta.
+	// These point into the ViewDelta passed to Advance and are only valid until the next delta is generated.
+	const TArray<const EntityComponentId*>& GetAuthorityGained() const;
+	const TArray<const EntityComponentId*>& GetAuthorityLost() const;
+	const TArray<const EntityComponentId*>& GetAuthorityLostTemporarily() const;
+	const TArray<const EntityComponentData*>& GetComponentsAdded() const;
+	const TArray<const EntityComponentId*>& GetComponentsRemoved() const;
+	const TArray<const EntityComponentUpdate*>& GetUpdates() const;
+	const TArray<const EntityComponentCompleteUpdate*>& GetCompleteUpdates() const;
+
+	bool IsEntityInSubView(Worker_EntityId EntityId) const;
+
+private:
+	bool MatchesFilter(Worker_EntityId EntityId) const;
+	// Returns true if the entity entered or left the subview.
+	bool RefreshEntity(Worker_EntityId EntityId);
+	bool IsEntityRelevantToDelta(Worker_EntityId EntityId) const;
+
+	template <typename T>
+	void FilterElements(const TArray<T>& Elements, TArray<const T*>& OutFiltered) const
+	{
+		OutFiltered.Reset();
+		for (const T& Element : Elements)
+		{
+			if (IsEntityRelevantToDelta(Element.EntityId))
+			{
+				OutFiltered.Add(&Element);
+			}
+		}
+	}
+
+	Filter SubViewFilter;
+	const EntityComponentMap& EntityComponents;
+
+	TSet<Worker_EntityId> Entities;
+	TArray<Worker_EntityId> CompleteEntities;
+	bool bReportInitialEntities = true;
+
+	TArray<Worker_EntityId> EntitiesAdded;
+	TArray<Worker_EntityId> EntitiesRemoved;
+	TSet<Worker_EntityId> EntitiesRemovedSet;
+
+	TArray<const EntityComponentId*> AuthorityGained;
+	TArray<const EntityComponentId*> AuthorityLost;
+	TArray<const EntityComponentId*> AuthorityLostTemporarily;
+	TArray<const EntityComponentData*> ComponentsAdded;
+	TArray<const EntityComponentId*> ComponentsRemoved;
+	TArray<const EntityComponentUpdate*> Updates;
+	TArray<const EntityComponentCompleteUpdate*> CompleteUpdates;
+};
+
+}  // namespace SpatialGDK
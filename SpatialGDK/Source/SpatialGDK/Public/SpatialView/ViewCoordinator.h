@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "SpatialView/CallbackDispatcher.h"
+#include "SpatialView/SubView.h"
 #include "SpatialView/WorkerView.h"
 #include "SpatialView/ConnectionHandlers/AbstractConnectionHandler.h"
 #include "Templates/UniquePtr.h"
@@ -32,10 +34,24 @@ public:
 
 	TUniquePtr<AbstractOpList> GenerateLegacyOpList() const;
 
+	// Creates a subview which is advanced with every delta. The returned reference is valid for the lifetime of the coordinator.
+	SubView& CreateSubView(SubView::Filter Filter);
+
+	const EntityComponentMap& GetEntityComponents() const;
+
+	// Callbacks are invoked at the end of each Advance, after the subviews have been advanced.
+	CallbackDispatcher& GetCallbackDispatcher();
+
 private:
+	void UpdateEntityComponents();
+
 	const ViewDelta* Delta;
 	WorkerView View;
 	TUniquePtr<AbstractConnectionHandler> ConnectionHandler;
+
+	EntityComponentMap EntityComponents;
+	TArray<TUniquePtr<SubView>> SubViews;
+	CallbackDispatcher Dispatcher;
 };
 
 } // namespace SpatialGDK
@@ -4,6 +4,7 @@
 
 #include <WorkerSDK/improbable/c_worker.h>
 #include "SpatialView/AuthorityRecord.h"
+#include "SpatialView/BufferHighWaterMark.h"
 #include "SpatialView/CommandMessages.h"
 #include "SpatialView/EntityComponentRecord.h"
 #include "SpatialView/OpList/AbstractOpList.h"
@@ -14,6 +15,8 @@
 namespace SpatialGDK
 {
 
+// Component data and updates in a view delta generated by a WorkerView may reference the op lists they were received in,
+// and are only valid until the next delta is generated. Use DeepCopy for anything that has to be kept for longer.
 class ViewDelta
 {
 public:
@@ -39,11 +42,13 @@ public:
 	// todo Remove this once the view delta is not read via a legacy op list.
 	TUniquePtr<AbstractOpList> GenerateLegacyOpList() const;
 
+	// Removes everything from the delta. Storage is kept for the next delta, and only trimmed after a prolonged period of low activity.
 	void Clear();
 
 private:
 	// todo wrap world command responses in their own record?
 	TArray<CreateEntityResponse> CreateEntityResponses;
+	BufferHighWaterMark CreateEntityResponsesHighWaterMark;
 
 	AuthorityRecord AuthorityChanges;
 	EntityComponentRecord EntityComponentChanges;
@@ -17,6 +17,7 @@ public:
 
 	// Process queued op lists to create a new view delta.
 	// The view delta will exist until the next call to advance.
+	// The op lists it was generated from are kept alive until then, as the delta references their component data and updates.
 	const ViewDelta* GenerateViewDelta();
 
 	// Add an OpList to generate the next ViewDelta.
@@ -40,6 +41,7 @@ private:
 	void HandleRemoveComponent(const Worker_RemoveComponentOp& Component);
 
 	TArray<TUniquePtr<AbstractOpList>> QueuedOps;
+	TArray<TUniquePtr<AbstractOpList>> OpListsInDelta;
 
 	ViewDelta Delta;
 	TUniquePtr<MessagesToSend> LocalChanges;
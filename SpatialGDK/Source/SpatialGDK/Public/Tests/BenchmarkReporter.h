@@ -0,0 +1,26 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FAutomationTestBase;
+
+// Collects the results of a SpatialGDKSlow benchmark, logs them to the automation test and, when the reporter is destroyed,
+// appends them as JSON lines to Saved/Automation/GDKBenchmarks.jsonl so throughput can be compared across GDK versions.
+// Each line is {"benchmark": ..., "case": ..., "entities": ..., "ops": ..., "seconds": ..., "ops_per_second": ...}.
+class SPATIALGDK_API FBenchmarkReporter
+{
+public:
+	FBenchmarkReporter(FAutomationTestBase& InTest, const FString& InBenchmarkName);
+	~FBenchmarkReporter();
+
+	void Report(const FString& CaseName, int32 EntityCount, int64 OpCount, double Seconds);
+
+	static FString GetResultsFilePath();
+
+private:
+	FAutomationTestBase& Test;
+	FString BenchmarkName;
+	TArray<FString> ResultLines;
+};
@@ -0,0 +1,63 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+
+#include "ActorPool.generated.h"
+
+class AActor;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialActorPool, Log, All);
+
+UINTERFACE(Blueprintable)
+class SPATIALGDK_API USpatialPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Actors implementing this interface are pooled by the receiver when bEnableActorPooling is set, instead of being destroyed
+ * when their entity leaves view and spawned again when a new entity of the same class comes into view.
+ * Replicated properties are overwritten by the initial data of the new entity. Any other state should be reset in OnTakenFromPool.
+ */
+class SPATIALGDK_API ISpatialPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	// Called after the actor has been hidden, had collision and ticking disabled, and its entity has been removed from the package map.
+	UFUNCTION(BlueprintNativeEvent, Category = "SpatialOS")
+	void OnReturnedToPool();
+
+	// Called after the actor has been moved to its new spawn transform and reactivated, before initial replicated data is applied.
+	UFUNCTION(BlueprintNativeEvent, Category = "SpatialOS")
+	void OnTakenFromPool();
+};
+
+namespace SpatialGDK
+{
+
+// Inactive actors kept for reuse, keyed by class.
+class SPATIALGDK_API FActorPool
+{
+public:
+	explicit FActorPool(uint32 InMaxActorsPerClass);
+
+	static bool IsPoolable(const UClass* Class);
+
+	// Deactivates the actor and keeps it for reuse. Returns false if the pool for its class is full, in which case the caller should destroy it.
+	bool Release(AActor* Actor);
+
+	// Returns a reactivated pooled actor of exactly this class moved to Transform, or nullptr if there is none.
+	AActor* Acquire(UClass* Class, const FTransform& Transform);
+
+private:
+	uint32 MaxActorsPerClass;
+
+	// Weak, since pooled actors are still owned by their level and destroyed with it.
+	TMap<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<AActor>>> PooledActors;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,60 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+namespace SpatialGDK
+{
+
+/**
+ * Time wheel of the actors to consider for replication, keyed by the time they are next due.
+ * Collecting the due actors only visits the slots that have elapsed since the last collection, so its cost is proportional to the
+ * number of actors due rather than to the number of actors scheduled. Actors further in the future than one turn of the wheel
+ * are kept in their slot until the wheel comes round to their turn.
+ */
+class SPATIALGDK_API FActorReplicationSchedule
+{
+public:
+	explicit FActorReplicationSchedule(double InSlotSeconds = 1.0 / 60.0);
+
+	// Schedules the actor to be collected once Time has been reached. Replaces any other time the actor was scheduled at.
+	void Schedule(const AActor* Actor, double Time);
+	void Unschedule(const AActor* Actor);
+	bool IsScheduled(const AActor* Actor) const { return ScheduledTimes.Contains(FObjectKey(Actor)); }
+	int32 Num() const { return ScheduledTimes.Num(); }
+
+	// Removes the actors due at or before CurrentTime from the schedule and appends them to OutDueActors, in no particular order.
+	// Actors which have been destroyed since they were scheduled are dropped.
+	void CollectDue(double CurrentTime, TArray<AActor*>& OutDueActors);
+
+private:
+	struct FEntry
+	{
+		FObjectKey Actor;
+		double Time;
+	};
+
+	int64 GetSlotIndex(double Time) const;
+	void CollectDueFromEntries(TArray<FEntry>& Entries, double CurrentTime, TArray<AActor*>& OutDueActors);
+
+	static constexpr int32 NumSlots = 256;
+
+	const double SlotSeconds;
+
+	TArray<FEntry> Slots[NumSlots];
+	// Entries scheduled into a slot which has already been collected.
+	TArray<FEntry> ReadyEntries;
+	// The latest time each actor was scheduled at. Entries which don't match are stale and are dropped when their slot is visited.
+	TMap<FObjectKey, double> ScheduledTimes;
+
+	// Slots up to and including this one have been collected. The slot being collected is revisited next time, as it may hold
+	// entries due later in it.
+	int64 LastCollectedSlot = 0;
+	bool bHasCollected = false;
+};
+
+} // namespace SpatialGDK
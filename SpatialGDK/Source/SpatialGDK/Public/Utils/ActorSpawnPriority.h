@@ -0,0 +1,28 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// A newly checked out entity whose actor is waiting to be spawned, with what it is ordered by when time-slicing actor spawning.
+struct FActorSpawnCandidate
+{
+	Worker_EntityId EntityId;
+	float Priority;
+	FVector Location;
+};
+
+// Sorts the candidates highest priority first and then, when there is an origin, nearest to it first. Candidates which compare equal
+// keep their order, so they're spawned in the order their entities were checked out.
+SPATIALGDK_API void SortActorSpawnsByPriority(TArray<FActorSpawnCandidate>& ActorSpawns, const FVector& Origin, bool bHasOrigin);
+
+// The spawn priority of the most derived of Class and its super classes in ClassPriorities, or the NetPriority of Class without one.
+SPATIALGDK_API float GetActorSpawnClassPriority(UClass* Class, const TMap<TSoftClassPtr<AActor>, float>& ClassPriorities);
+
+} // namespace SpatialGDK
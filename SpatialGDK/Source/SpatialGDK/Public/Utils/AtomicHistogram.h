@@ -0,0 +1,41 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interop/Connection/OutgoingMessages.h"
+#include "Templates/Atomic.h"
+#include "Templates/UniquePtr.h"
+
+namespace SpatialGDK
+{
+
+/**
+ * Histogram with fixed bucket upper bounds that can be recorded into from any thread without locking.
+ * Values above the last bound are counted in an implicit overflow bucket. Consume converts the counts to the cumulative
+ * buckets expected by SpatialOS histogram metrics and resets them. A sample recorded while another thread consumes may be
+ * counted in one report's buckets and the next report's sum, which is acceptable for metrics.
+ */
+class SPATIALGDK_API FAtomicHistogram
+{
+public:
+	// UpperBounds must be sorted in increasing order.
+	explicit FAtomicHistogram(const TArray<double>& InUpperBounds);
+
+	FAtomicHistogram(const FAtomicHistogram&) = delete;
+	FAtomicHistogram& operator=(const FAtomicHistogram&) = delete;
+
+	void Record(double Value);
+
+	// Returns false, leaving OutMetric untouched, if nothing was recorded since the last call.
+	bool Consume(HistogramMetric& OutMetric);
+
+private:
+	TArray<double> UpperBounds;
+	// One count per bound, plus the overflow bucket.
+	TUniquePtr<TAtomic<uint32>[]> Counts;
+	// Bit pattern of the double sum, so it can be updated with a compare-exchange.
+	TAtomic<uint64> SumBits{ 0 };
+};
+
+} // namespace SpatialGDK
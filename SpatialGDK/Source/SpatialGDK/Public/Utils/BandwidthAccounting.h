@@ -0,0 +1,65 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "SpatialView/EntityComponentId.h"
+#include "Templates/Atomic.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+struct FBandwidthStat
+{
+	uint64 Messages = 0;
+	uint64 Bytes = 0;
+
+	void Add(uint64 InBytes, uint64 InMessages = 1)
+	{
+		Bytes += InBytes;
+		Messages += InMessages;
+	}
+};
+
+/**
+ * Counts the schema bytes of component data and updates as they are passed to the Worker SDK, per entity-component.
+ * Recording happens on whichever thread sends outgoing messages and is a single atomic load while disabled.
+ */
+class SPATIALGDK_API FBandwidthAccounting
+{
+public:
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+	bool IsEnabled() const { return bEnabled; }
+
+	void RecordComponentData(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentData* Data);
+	void RecordComponentUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentUpdate* Update);
+
+	// Moves out everything recorded since the last call.
+	TMap<EntityComponentId, FBandwidthStat> ConsumeRecorded();
+
+private:
+	void Record(Worker_EntityId EntityId, Worker_ComponentId ComponentId, uint32 NumBytes);
+
+	TAtomic<bool> bEnabled{ false };
+	FCriticalSection Mutex;
+	TMap<EntityComponentId, FBandwidthStat> Recorded;
+};
+
+/** Sent bytes aggregated per component ID, per actor class and per RPC function. */
+struct SPATIALGDK_API FBandwidthReport
+{
+	TMap<Worker_ComponentId, FBandwidthStat> ByComponent;
+	TMap<FString, FBandwidthStat> ByClass;
+	TMap<FString, FBandwidthStat> ByRPC;
+
+	void Reset();
+
+	// One row per entry, largest first within each category: Category,Name,Messages,Bytes,BytesPerSecond.
+	FString ToCsv(double DurationSeconds) const;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,32 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+/**
+ * Tracks how much of its interest a client is able to receive, from the throughput it reports with its heartbeats.
+ *
+ * The frequency scale multiplies the frequencies of the client's net cull distance and user defined interest queries. It is lowered
+ * in proportion to how far over budget the client is, and raised back gradually once the client has headroom again, so slow clients
+ * receive less often while others keep receiving at full rate.
+ */
+class SPATIALGDK_API FClientBandwidthBudget
+{
+public:
+	explicit FClientBandwidthBudget(float InMinFrequencyScale);
+
+	// Returns true if the frequency scale changed, in which case the client's interest should be updated.
+	bool OnClientReport(float ReceivedBytesPerSecond, float BudgetBytesPerSecond);
+
+	float GetFrequencyScale() const { return FrequencyScale; }
+
+private:
+	float MinFrequencyScale;
+	float FrequencyScale = 1.0f;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * The positions clients view the world from, gathered from the client connections of this server and from the ServerWorker
+ * components of the other server workers, which each publish the view positions of their own clients. An actor is observed while
+ * it is within its NetCullDistance of any of them, the same radius used for the clients' net cull distance interest, extended by a
+ * margin so that actors wake up before a client's interest reaches them.
+ */
+class SPATIALGDK_API FClientObservationTracker
+{
+public:
+	explicit FClientObservationTracker(float InWakeUpMargin);
+
+	// The view positions of the clients connected to this server.
+	void SetLocalViewPositions(TArray<FVector>&& Positions);
+	const TArray<FVector>& GetLocalViewPositions() const { return LocalViewPositions; }
+
+	// Whether the local positions changed in number, or any moved further than Tolerance, since they were last published.
+	bool HaveLocalViewPositionsMoved(float Tolerance) const;
+	void MarkLocalViewPositionsPublished() { PublishedViewPositions = LocalViewPositions; }
+
+	// Replaces the view positions published by every other server worker, keyed by their server worker entity.
+	void SetRemoteViewPositions(TMap<Worker_EntityId_Key, TArray<FVector>>&& Positions);
+	void AppendRemoteViewPositions(TArray<FVector>& OutPositions) const;
+
+	bool IsObserved(const FVector& Location, float NetCullDistanceSquared) const;
+
+	int32 GetNumViewPositions() const;
+
+private:
+	static bool IsWithin(const TArray<FVector>& ViewPositions, const FVector& Location, float RadiusSquared);
+
+	float WakeUpMargin;
+
+	TArray<FVector> LocalViewPositions;
+	TArray<FVector> PublishedViewPositions;
+	TMap<Worker_EntityId_Key, TArray<FVector>> RemoteViewPositions;
+};
+
+} // namespace SpatialGDK
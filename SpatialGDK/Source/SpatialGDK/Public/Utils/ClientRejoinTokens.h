@@ -0,0 +1,43 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialCommonTypes.h"
+
+namespace SpatialGDK
+{
+
+/**
+ * The rejoin tokens the player spawner server has issued, see bEnableClientFastRejoin. Each client worker is sent a random token only
+ * in the response to its own spawn request, so a client asking for another worker's player controller has to present that worker's
+ * token. A token can only be used once the worker it was issued to has disconnected, and only once.
+ */
+class SPATIALGDK_API FClientRejoinTokens
+{
+public:
+	// Issues a new token to the worker, replacing the one it had.
+	FString Issue(const PhysicalWorkerName& WorkerId);
+
+	// The worker's entity was removed, after which its token can be used to rejoin.
+	void OnWorkerDisconnected(const PhysicalWorkerName& WorkerId);
+
+	// Returns whether Token is the one issued to PreviousWorkerId and that worker has disconnected, in which case the token is used up.
+	// A wrong token leaves the issued one as it is, so guessing can't lock the real client out.
+	bool TryConsume(const PhysicalWorkerName& PreviousWorkerId, const FString& Token);
+
+	void Remove(const PhysicalWorkerName& WorkerId) { Tokens.Remove(WorkerId); }
+
+	int32 Num() const { return Tokens.Num(); }
+
+private:
+	struct FRejoinToken
+	{
+		FString Token;
+		bool bWorkerDisconnected = false;
+	};
+
+	TMap<PhysicalWorkerName, FRejoinToken> Tokens;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+class AActor;
+class UStructProperty;
+
+/**
+ * A GDK-native encoding of AActor::ReplicatedMovement, written as the RepMovement schema type with bUseCompactReplicatedMovement
+ * instead of being NetSerialized into a bytes field. Location and velocities are rounded to the actor's quantization levels and
+ * sent as zigzag varints, and rotation is compressed to its rotation quantization level, so small and unchanged values cost few
+ * bytes. Zero rotations and velocities, the common case for actors at rest, are left out.
+ */
+
+namespace SpatialGDK
+{
+namespace CompactRepMovement
+{
+
+// Whether the property is sent with the compact encoding, which is the case for every FRepMovement with bUseCompactReplicatedMovement.
+SPATIALGDK_API bool IsCompactProperty(const UStructProperty* Property);
+
+SPATIALGDK_API void Write(Schema_Object* Object, Schema_FieldId FieldId, const FRepMovement& Movement);
+// Keeps the quantization levels of OutMovement, which like NetSerialize are expected to match those of the sender.
+SPATIALGDK_API void Read(Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, FRepMovement& OutMovement);
+
+// Broadcast on clients after compact replicated movement is applied to an actor, before OnRep_ReplicatedMovement, so that
+// interpolation can pick up the new target before the actor is moved to it.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnMovementReceived, AActor& /*Actor*/, const FRepMovement& /*Movement*/);
+SPATIALGDK_API FOnMovementReceived& OnMovementReceived();
+
+} // namespace CompactRepMovement
+} // namespace SpatialGDK
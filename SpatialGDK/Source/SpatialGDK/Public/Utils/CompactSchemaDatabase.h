@@ -0,0 +1,89 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/SchemaDatabase.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialCompactSchemaDatabase, Log, All);
+
+namespace SpatialGDK
+{
+
+/**
+ * Binary form of USchemaDatabase, written next to the asset when schema is generated.
+ * Class entries are indexed by the CRC of their class path and component IDs are kept in sorted arrays, so a worker can memory map
+ * the file and only decode the entries for classes it actually uses, instead of deserializing every map in the asset at startup.
+ *
+ * Layout: a fixed header, then one serialized record per class, then sorted arrays of (key, record offset) pairs for actor classes,
+ * subobject classes and component IDs, and finally the small tables (levels, net cull distances, component ID lists).
+ */
+class SPATIALGDK_API FCompactSchemaDatabase
+{
+public:
+	FCompactSchemaDatabase();
+	~FCompactSchemaDatabase();
+
+	static FString GetFilePath();
+
+	static void Write(const USchemaDatabase& SchemaDatabase, TArray<uint8>& OutData);
+	static bool WriteToFile(const USchemaDatabase& SchemaDatabase, const FString& Filename);
+
+	// Maps the file if the platform supports it, otherwise reads it into memory.
+	bool Load(const FString& Filename);
+
+	// The database is only read once it's loaded, so every worker in the process shares one copy; with several PIE instances the file
+	// is then mapped and validated once. The copy is loaded again if the file has changed since. Returns null if it can't be loaded.
+	static TSharedPtr<const FCompactSchemaDatabase, ESPMode::ThreadSafe> LoadShared(const FString& Filename);
+	// Drops the shared copy, which has to be done before the file is written or deleted, as a mapped file can't be on some platforms.
+	static void ResetShared();
+
+	// Copies everything apart from the per-class maps, which are looked up on demand.
+	void ReadTables(USchemaDatabase& OutSchemaDatabase) const;
+
+	bool FindActorSchema(const FString& ClassPath, FActorSchemaData& OutSchemaData) const;
+	bool FindSubobjectSchema(const FString& ClassPath, FSubobjectSchemaData& OutSchemaData) const;
+	bool FindClassPathForComponentId(Worker_ComponentId ComponentId, FString& OutClassPath) const;
+
+private:
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint32 ActorIndexOffset = 0;
+		uint32 NumActors = 0;
+		uint32 SubobjectIndexOffset = 0;
+		uint32 NumSubobjects = 0;
+		uint32 ComponentIndexOffset = 0;
+		uint32 NumComponents = 0;
+		uint32 TablesOffset = 0;
+	};
+
+	struct FIndexEntry
+	{
+		uint32 Key;
+		uint32 RecordOffset;
+	};
+
+	static void SerializeHeader(FArchive& Ar, FHeader& Header);
+	static uint32 HashClassPath(const FString& ClassPath);
+
+	// Reads each record stored under Key until ReadRecord accepts one, since class path hashes may collide.
+	bool FindRecord(uint32 IndexOffset, uint32 NumEntries, uint32 Key, TFunctionRef<bool(FArchive&)> ReadRecord) const;
+	FIndexEntry GetIndexEntry(uint32 IndexOffset, uint32 EntryIndex) const;
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	FHeader Header;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> LoadedData;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialConstants.h"
+#include "Utils/ComponentIdTable.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class USchemaDatabase;
+
+namespace SpatialGDK
+{
+
+/**
+ * Table of the SpatialConstants::EComponentTraits of every component ID, so classifying a component in the op handling paths is an
+ * index into an array instead of a chain of comparisons and lookups in the schema database's arrays and sets.
+ * The reserved IDs are filled in from SpatialConstants::GetReservedComponentTraits, and the generated IDs from the schema database.
+ */
+class SPATIALGDK_API FComponentClassification
+{
+public:
+	FComponentClassification();
+
+	void AddGeneratedComponents(const USchemaDatabase& SchemaDatabase);
+
+	uint16 GetTraits(Worker_ComponentId ComponentId) const
+	{
+		return Traits.Find(ComponentId);
+	}
+
+	bool HasAnyTraits(Worker_ComponentId ComponentId, uint16 TraitMask) const
+	{
+		return (Traits.Find(ComponentId) & TraitMask) != 0;
+	}
+
+private:
+	void AddTrait(Worker_ComponentId ComponentId, uint16 Trait);
+
+	TComponentIdTable<uint16> Traits;
+};
+
+} // namespace SpatialGDK
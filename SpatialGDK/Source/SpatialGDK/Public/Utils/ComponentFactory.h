@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "EngineClasses/SpatialFastArrayNetSerialize.h"
+#include "EngineClasses/SpatialNetBitWriter.h"
 #include "Interop/SpatialClassInfoManager.h"
 #include "Schema/Interest.h"
 #include "Utils/RepDataUtils.h"
@@ -29,6 +31,7 @@ class SPATIALGDK_API ComponentFactory
 {
 public:
 	ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNetDriver, USpatialLatencyTracer* LatencyTracer);
+	~ComponentFactory();
 
 	TArray<FWorkerComponentData> CreateComponentDatas(UObject* Object, const FClassInfo& Info, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten);
 	TArray<FWorkerComponentUpdate> CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten);
@@ -37,6 +40,17 @@ public:
 
 	static FWorkerComponentData CreateEmptyComponentData(Worker_ComponentId ComponentId);
 
+	// With bSkipUnchangedFastArrays, fast arrays whose ArrayReplicationKey is the one recorded here aren't serialized again.
+	void SetFastArrayReplicationKeys(FFastArrayReplicationKeys* InFastArrayReplicationKeys) { FastArrayReplicationKeys = InFastArrayReplicationKeys; }
+
+	// With bDropUnchangedPropertyWrites, small plain old data properties equal to the value recorded here aren't written again.
+	void SetLastSentPropertyValues(FLastSentPropertyValues* InLastSentPropertyValues) { LastSentPropertyValues = InLastSentPropertyValues; }
+
+	// Records the value being written in LastSentValues, and returns whether it's the one that was last sent. Always false for properties
+	// which aren't compared, see bDropUnchangedPropertyWrites.
+	static bool IsUnchangedSinceLastSent(FLastSentPropertyValues& LastSentValues, UObject* Object, uint16 Handle, UProperty* Property,
+		const uint8* Data, bool bIsInitialData);
+
 private:
 	FWorkerComponentData CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
 	FWorkerComponentUpdate CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
@@ -49,13 +63,34 @@ private:
 
 	void AddProperty(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property, const uint8* Data, TArray<Schema_FieldId>* ClearedIds);
 
+	// Adds a serialized struct or fast array, compressing it if the field is one of CompressedFieldIds.
+	void AddSerializedBytes(Schema_Object* Object, Schema_FieldId FieldId, FBitWriter& Writer);
+
+	// Return reset writers for serializing a single struct property or fast array.
+	FSpatialNetBitWriter& GetStructWriter();
+	FSpatialNetBitWriter& GetFastArrayWriter();
+
 	USpatialNetDriver* NetDriver;
 	USpatialPackageMapClient* PackageMap;
 	USpatialClassInfoManager* ClassInfoManager;
 
 	bool bInterestHasChanged;
+	bool bAlwaysInterestedHasChanged;
 
 	USpatialLatencyTracer* LatencyTracer;
+
+	// Struct properties, such as vectors and rotators, are serialized one after the other, so they share a writer instead of each
+	// allocating and growing their own. Both writers come from FSpatialNetBitWriterPool and go back to it with the factory, so their
+	// buffers carry over to the next update.
+	TUniquePtr<FSpatialNetBitWriter> StructWriter;
+	TUniquePtr<FSpatialNetBitWriter> FastArrayWriter;
+
+	FFastArrayReplicationKeys* FastArrayReplicationKeys = nullptr;
+	FLastSentPropertyValues* LastSentPropertyValues = nullptr;
+
+	// The compressed fields of the class whose schema object is being filled.
+	const TSet<Schema_FieldId>* CompressedFieldIds = nullptr;
+	uint32 MinCompressedBytesFieldSize;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,73 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Math/UnrealMathUtility.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Maps component IDs to values, with a flat array for IDs below DenseRangeEnd and a hash map for the rest.
+ * The GDK's own components and the SpatialOS standard library use small, densely packed IDs, so lookups for them are a single index
+ * into the array. IDs that were never added map to the default value.
+ */
+template <typename ValueType>
+class TComponentIdTable
+{
+public:
+	explicit TComponentIdTable(Worker_ComponentId DenseRangeEnd, const ValueType& InDefaultValue = ValueType())
+		: DefaultValue(InDefaultValue)
+	{
+		DenseValues.Init(DefaultValue, DenseRangeEnd);
+	}
+
+	void Add(Worker_ComponentId ComponentId, const ValueType& Value)
+	{
+		if (ComponentId < static_cast<Worker_ComponentId>(DenseValues.Num()))
+		{
+			DenseValues[ComponentId] = Value;
+		}
+		else
+		{
+			SparseValues.Add(ComponentId, Value);
+		}
+	}
+
+	// Sets the value of every ID in [Begin, End) that falls in the dense range.
+	void AddDenseRange(Worker_ComponentId Begin, Worker_ComponentId End, const ValueType& Value)
+	{
+		const Worker_ComponentId DenseEnd = FMath::Min(End, static_cast<Worker_ComponentId>(DenseValues.Num()));
+		for (Worker_ComponentId ComponentId = Begin; ComponentId < DenseEnd; ++ComponentId)
+		{
+			DenseValues[ComponentId] = Value;
+		}
+	}
+
+	const ValueType& Find(Worker_ComponentId ComponentId) const
+	{
+		if (ComponentId < static_cast<Worker_ComponentId>(DenseValues.Num()))
+		{
+			return DenseValues[ComponentId];
+		}
+
+		if (SparseValues.Num() == 0)
+		{
+			return DefaultValue;
+		}
+
+		const ValueType* Value = SparseValues.Find(ComponentId);
+		return Value != nullptr ? *Value : DefaultValue;
+	}
+
+private:
+	ValueType DefaultValue;
+	TArray<ValueType> DenseValues;
+	TMap<Worker_ComponentId, ValueType> SparseValues;
+};
+
+} // namespace SpatialGDK
@@ -18,6 +18,10 @@ public:
 	void ApplyComponentData(const Worker_ComponentData& ComponentData, UObject& Object, USpatialActorChannel& Channel, bool bIsHandover, bool& bOutReferencesChanged);
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject& Object, USpatialActorChannel& Channel, bool bIsHandover, bool& bOutReferencesChanged);
 
+	// Only read the schema object, so can be called from any thread.
+	static TArray<Schema_FieldId> GetComponentDataFieldIds(Schema_ComponentData* ComponentData);
+	static TArray<Schema_FieldId> GetComponentUpdateFieldIds(Schema_ComponentUpdate* ComponentUpdate);
+
 private:
 	void ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
 	void ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
@@ -27,11 +31,19 @@ private:
 
 	uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId Id, UProperty* Property);
 
+	// Finds the bytes of a serialized struct or fast array, decompressing them if the field is one of CompressedFieldIds.
+	// The returned data is only valid until the next call.
+	bool GetSerializedBytes(Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8*& OutData, uint32& OutLength);
+
 private:
 	class USpatialPackageMapClient* PackageMap;
 	class USpatialNetDriver* NetDriver;
 	class USpatialClassInfoManager* ClassInfoManager;
 	FObjectReferencesMap& RootObjectReferencesMap;
+
+	// The compressed fields of the class whose schema object is being applied.
+	const TSet<Schema_FieldId>* CompressedFieldIds = nullptr;
+	TArray<uint8> DecompressedBytes;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,27 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+
+// Every value of a bytes field the schema generator marked for compression starts with one of these, see FCompressedFieldsSchemaData.
+// Compressed values follow it with their uncompressed size as a uint32.
+enum class ECompressedBytesEncoding : uint8
+{
+	Raw = 0,
+	LZ4 = 1
+};
+
+// Adds a value to a bytes field marked for compression. Values shorter than MinCompressedSize, or which don't get smaller, are sent raw.
+SPATIALGDK_API void AddCompressibleBytesToSchema(Schema_Object* Object, Schema_FieldId Id, const uint8* Data, uint32 NumBytes, uint32 MinCompressedSize);
+
+// Reads a value written by AddCompressibleBytesToSchema. Raw values point straight into the schema buffer, compressed ones are
+// decompressed into Scratch. Returns false if the value is malformed.
+SPATIALGDK_API bool IndexCompressibleBytesFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index, TArray<uint8>& Scratch, const uint8*& OutData, uint32& OutNumBytes);
+
+} // namespace SpatialGDK
@@ -0,0 +1,54 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Per-class templates of the component data EntityFactory adds to every entity of a class, such as Metadata and UnrealMetadata.
+ * A template is serialized once per class and copied for each new entity, and the copy is patched with the few fields that
+ * are specific to the Actor, so spawning many Actors of the same class doesn't rebuild the same schema objects each time.
+ */
+class SPATIALGDK_API FEntityComponentTemplateCache
+{
+public:
+	FEntityComponentTemplateCache() = default;
+	~FEntityComponentTemplateCache();
+
+	FEntityComponentTemplateCache(const FEntityComponentTemplateCache&) = delete;
+	FEntityComponentTemplateCache& operator=(const FEntityComponentTemplateCache&) = delete;
+
+	// Returns a copy of the template for the class and component, creating the template with CreateTemplate the first time.
+	// The caller owns the returned data.
+	FWorkerComponentData CopyTemplate(const UClass* Class, Worker_ComponentId ComponentId, TFunctionRef<Worker_ComponentData()> CreateTemplate);
+
+	void Reset();
+
+	int32 Num() const { return Templates.Num(); }
+	uint64 GetNumHits() const { return NumHits; }
+	uint64 GetNumMisses() const { return NumMisses; }
+
+private:
+	struct FTemplate
+	{
+		// Class pointers can be reused once a class is garbage collected, so templates are only used while the class is alive.
+		TWeakObjectPtr<const UClass> Class;
+		Schema_ComponentData* Data = nullptr;
+	};
+
+	using FTemplateKey = TPair<const UClass*, Worker_ComponentId>;
+
+	TMap<FTemplateKey, FTemplate> Templates;
+
+	uint64 NumHits = 0;
+	uint64 NumMisses = 0;
+};
+
+} // namespace SpatialGDK
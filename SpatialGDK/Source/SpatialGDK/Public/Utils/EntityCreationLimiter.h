@@ -0,0 +1,49 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Adjusts how many create entity requests may await a response from the runtime, additive increase / multiplicative decrease style.
+ * The limit grows by roughly one request per round trip while responses arrive within the target latency, and halves when a request
+ * times out or its response takes longer than the target. Only requests sent since the last decrease can decrease the limit again,
+ * so one burst of slow responses halves it once rather than collapsing it to the minimum.
+ */
+class SPATIALGDK_API FEntityCreationLimiter
+{
+public:
+	FEntityCreationLimiter(int32 InMaxLimit, double InTargetLatencySeconds);
+
+	void OnRequestSent(Worker_RequestId RequestId, double Time);
+	void OnResponse(Worker_RequestId RequestId, Worker_StatusCode StatusCode, double Time);
+
+	int32 GetLimit() const { return FMath::FloorToInt(Limit); }
+	int32 GetNumInFlight() const { return SentRequests.Num(); }
+
+	static constexpr int32 InitialLimit = 16;
+	static constexpr int32 MinLimit = 1;
+
+private:
+	struct FSentRequest
+	{
+		double Time;
+		uint32 NumDecreasesWhenSent;
+	};
+
+	TMap<Worker_RequestId_Key, FSentRequest> SentRequests;
+
+	double Limit;
+	double MaxLimit;
+	double TargetLatencySeconds;
+	uint32 NumDecreases = 0;
+	int32 NumSucceededSinceChange = 0;
+};
+
+} // namespace SpatialGDK
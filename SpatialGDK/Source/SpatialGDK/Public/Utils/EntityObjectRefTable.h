@@ -0,0 +1,150 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/NetworkGuid.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Open-addressed hash table from (entity ID, offset) pairs to NetGUIDs, using linear probing.
+ * Used by FSpatialNetGUIDCache for object refs that have neither a path nor an outer, which make up nearly all lookups
+ * when reading object properties, so they don't have to go through the string hashing and comparisons of FUnrealObjectRef.
+ */
+class FEntityObjectRefTable
+{
+public:
+	FNetworkGUID* Find(Worker_EntityId EntityId, uint32 Offset)
+	{
+		const int32 SlotIndex = FindSlot(EntityId, Offset);
+		return SlotIndex != INDEX_NONE ? &Slots[SlotIndex].NetGUID : nullptr;
+	}
+
+	const FNetworkGUID* Find(Worker_EntityId EntityId, uint32 Offset) const
+	{
+		return const_cast<FEntityObjectRefTable*>(this)->Find(EntityId, Offset);
+	}
+
+	// Adds the pair, or replaces the NetGUID if it is already in the table.
+	void Add(Worker_EntityId EntityId, uint32 Offset, const FNetworkGUID& NetGUID)
+	{
+		if (FNetworkGUID* Existing = Find(EntityId, Offset))
+		{
+			*Existing = NetGUID;
+			return;
+		}
+
+		// Keep the load factor, including removed slots, at or below one half so probe sequences stay short.
+		if ((NumOccupied + NumRemoved + 1) * 2 > Slots.Num())
+		{
+			Rehash(FMath::Max(MinCapacity, static_cast<int32>(FMath::RoundUpToPowerOfTwo((NumOccupied + 1) * 4))));
+		}
+
+		const uint32 Mask = Slots.Num() - 1;
+		for (uint32 SlotIndex = Hash(EntityId, Offset) & Mask; ; SlotIndex = (SlotIndex + 1) & Mask)
+		{
+			FSlot& Slot = Slots[SlotIndex];
+			if (Slot.State != ESlotState::Occupied)
+			{
+				NumRemoved -= Slot.State == ESlotState::Removed ? 1 : 0;
+				Slot = FSlot{ EntityId, Offset, NetGUID, ESlotState::Occupied };
+				NumOccupied++;
+				return;
+			}
+		}
+	}
+
+	bool Remove(Worker_EntityId EntityId, uint32 Offset)
+	{
+		const int32 SlotIndex = FindSlot(EntityId, Offset);
+		if (SlotIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		Slots[SlotIndex].State = ESlotState::Removed;
+		NumOccupied--;
+		NumRemoved++;
+		return true;
+	}
+
+	int32 Num() const { return NumOccupied; }
+	SIZE_T GetAllocatedSize() const { return Slots.GetAllocatedSize(); }
+
+private:
+	enum class ESlotState : uint8
+	{
+		Empty,
+		Occupied,
+		Removed
+	};
+
+	struct FSlot
+	{
+		Worker_EntityId EntityId = 0;
+		uint32 Offset = 0;
+		FNetworkGUID NetGUID;
+		ESlotState State = ESlotState::Empty;
+	};
+
+	static constexpr int32 MinCapacity = 64;
+
+	static uint32 Hash(Worker_EntityId EntityId, uint32 Offset)
+	{
+		// 64-bit mix (from MurmurHash3's finalizer) so that sequential entity IDs spread across the table.
+		uint64 Key = static_cast<uint64>(EntityId) ^ (static_cast<uint64>(Offset) << 40) ^ (static_cast<uint64>(Offset) >> 24);
+		Key ^= Key >> 33;
+		Key *= 0xff51afd7ed558ccdull;
+		Key ^= Key >> 33;
+		return static_cast<uint32>(Key);
+	}
+
+	int32 FindSlot(Worker_EntityId EntityId, uint32 Offset) const
+	{
+		if (NumOccupied == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint32 Mask = Slots.Num() - 1;
+		for (uint32 SlotIndex = Hash(EntityId, Offset) & Mask; ; SlotIndex = (SlotIndex + 1) & Mask)
+		{
+			const FSlot& Slot = Slots[SlotIndex];
+			if (Slot.State == ESlotState::Empty)
+			{
+				return INDEX_NONE;
+			}
+			if (Slot.State == ESlotState::Occupied && Slot.EntityId == EntityId && Slot.Offset == Offset)
+			{
+				return SlotIndex;
+			}
+		}
+	}
+
+	void Rehash(int32 NewCapacity)
+	{
+		TArray<FSlot> OldSlots = MoveTemp(Slots);
+		Slots.SetNum(NewCapacity);
+		NumOccupied = 0;
+		NumRemoved = 0;
+
+		for (const FSlot& Slot : OldSlots)
+		{
+			if (Slot.State == ESlotState::Occupied)
+			{
+				Add(Slot.EntityId, Slot.Offset, Slot.NetGUID);
+			}
+		}
+	}
+
+	TArray<FSlot> Slots;
+	int32 NumOccupied = 0;
+	int32 NumRemoved = 0;
+};
+
+} // namespace SpatialGDK
@@ -43,9 +43,18 @@ public:
 		return bIsReady;
 	}
 
+	// Number of times an entity ID was requested while the pool was empty.
+	double GetNumEmptyPoolStalls() const { return NumEmptyPoolStalls; }
+
 private:
 	void OnEntityRangeExpired(uint32 ExpiringEntityRangeId);
 
+	uint32 GetNumRemainingEntityIds() const;
+	void RecordAllocation();
+	void ReserveEntityIDsIfNeeded(uint32 TotalRemainingEntityIds);
+	uint32 GetRefreshThreshold() const;
+	uint32 GetRefreshCount() const;
+
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
 
@@ -56,9 +65,19 @@ private:
 	TArray<EntityRange> ReservedEntityIDRanges;
 
 	bool bIsReady;
-	bool bIsAwaitingResponse;
+
+	uint32 NumReservationsInFlight;
+	uint32 NumEntityIdsInFlight;
 
 	uint32 NextEntityRangeId;
 
+	// Smoothed entity ID allocation rate and reservation round trip, used to size reservations when bAdaptiveEntityPool is set.
+	double AllocationRate;
+	double ReservationRoundTripSeconds;
+	double AllocationSampleStartTime;
+	uint32 NumAllocationsInSample;
+
+	uint32 NumEmptyPoolStalls;
+
 	FEntityPoolReadyEvent EntityPoolReadyDelegate;
 };
@@ -0,0 +1,82 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Interop/SpatialOSDispatcherInterface.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialView/ComponentData.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Shares entity query responses between requests for the same query, used by USpatialReceiver::SendEntityQuery.
+ *
+ * Delegates for a query that is identical to one already in flight are added to that request instead of sending another one, and
+ * successful responses can be kept for a while, so that polling for the same entities, such as the GSM or the spawner, doesn't send
+ * a query to the runtime each time.
+ */
+class SPATIALGDK_API FEntityQueryCache
+{
+public:
+	// Identical queries have the same key.
+	static FString GetQueryKey(const Worker_EntityQuery& Query);
+
+	// Adds the delegate to the request of an identical query that is in flight. Returns false if there is none.
+	bool AddToInFlightQuery(const FString& QueryKey, EntityQueryDelegate Delegate, double CacheLifetimeSeconds);
+	void OnQuerySent(const FString& QueryKey, Worker_RequestId RequestId, EntityQueryDelegate Delegate, double CacheLifetimeSeconds);
+
+	// Executes the delegates added for the request, and caches the response if it succeeded and any of them asked for it.
+	// Returns false if the request wasn't sent through the cache.
+	bool OnQueryResponse(const Worker_EntityQueryResponseOp& Op, double Now);
+
+	// Queues the delegate to be executed with the cached response to the query by ExecuteQueuedDelegates, if it was received at most
+	// MaxAgeSeconds ago. Returns false if there is no such response, in which case the query should be sent.
+	bool QueueCachedResponse(const FString& QueryKey, double MaxAgeSeconds, double Now, EntityQueryDelegate Delegate);
+	bool HasQueuedDelegates() const { return QueuedDelegates.Num() > 0; }
+	void ExecuteQueuedDelegates();
+
+	// Request IDs start over on a new connection, so in flight requests have to be forgotten. Cached responses are kept.
+	void ClearInFlightQueries();
+
+	int32 GetNumCachedResponses() const { return CachedResponses.Num(); }
+
+private:
+	struct FInFlightQuery
+	{
+		FString QueryKey;
+		TArray<EntityQueryDelegate> Delegates;
+		double CacheLifetimeSeconds = 0.0;
+	};
+
+	struct FCachedEntity
+	{
+		Worker_EntityId EntityId;
+		TArray<ComponentData> Components;
+	};
+
+	struct FCachedResponse
+	{
+		Worker_RequestId RequestId;
+		uint32 ResultCount;
+		TArray<FCachedEntity> Entities;
+		double ResponseTime;
+		double ExpiryTime;
+	};
+
+	static void ExecuteWithResponse(const FCachedResponse& Response, const EntityQueryDelegate& Delegate);
+	void RemoveExpiredResponses(double Now);
+
+	TMap<FString, Worker_RequestId_Key> InFlightRequestIds;
+	TMap<Worker_RequestId_Key, FInFlightQuery> InFlightQueries;
+
+	// Shared, so that responses queued for a delegate stay valid when they expire before it is executed.
+	TMap<FString, TSharedRef<const FCachedResponse>> CachedResponses;
+	TArray<TPair<TSharedRef<const FCachedResponse>, EntityQueryDelegate>> QueuedDelegates;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,103 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+#include "Utils/ReplicationPlan.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGeneratedSerializers, Log, All);
+
+class FRepLayout;
+
+/**
+ * Serializers generated by the schema generator for the classes in USpatialGDKEditorSettings::GeneratedSerializerClasses.
+ *
+ * Each generated file registers the replicated properties of one class with compile time typed write and read functions, which
+ * USpatialClassInfoManager puts in the class's replication plan instead of the ones resolved from the property types at runtime.
+ * The entries are checked against the class's rep layout first, so a class that changed since its serializers were generated
+ * falls back to the runtime replication plan until schema is generated again.
+ */
+
+namespace SpatialGDK
+{
+
+struct FGeneratedPropertySerializer
+{
+	// The rep handle of the property, which is also its schema field ID.
+	uint16 Handle;
+	const TCHAR* PropertyName;
+	const TCHAR* PropertyClassName;
+	FWritePropertyFunction Write;
+	FReadPropertyFunction Read;
+};
+
+class SPATIALGDK_API FGeneratedSerializerRegistry
+{
+public:
+	static FGeneratedSerializerRegistry& Get();
+
+	void Register(const TCHAR* ClassPath, TArrayView<const FGeneratedPropertySerializer> Properties);
+	void Unregister(const TCHAR* ClassPath);
+
+	// Replaces the replication plan entries of the class's generated properties. Returns false and leaves the plan unchanged if the
+	// class has no generated serializers, or if they don't match its rep layout.
+	bool ApplyToReplicationPlan(const UClass& Class, const FRepLayout& RepLayout, TArray<FReplicationPlanEntry>& InOutReplicationPlan) const;
+
+private:
+	TMap<FString, TArrayView<const FGeneratedPropertySerializer>> PropertiesByClassPath;
+};
+
+// Registers the serializers of one class when the module containing the generated file is loaded.
+struct FGeneratedSerializerRegistration
+{
+	FGeneratedSerializerRegistration(const TCHAR* InClassPath, TArrayView<const FGeneratedPropertySerializer> Properties)
+		: ClassPath(InClassPath)
+	{
+		FGeneratedSerializerRegistry::Get().Register(ClassPath, Properties);
+	}
+
+	// The properties live in the same module, so they can't be used once it is unloaded.
+	~FGeneratedSerializerRegistration()
+	{
+		FGeneratedSerializerRegistry::Get().Unregister(ClassPath);
+	}
+
+private:
+	const TCHAR* ClassPath;
+};
+
+// Used by generated files, in the same way ComponentFactory::AddProperty and ComponentReader::ApplyProperty widen numeric
+// properties to their schema type, but with the C++ type of the property known at compile time.
+namespace GeneratedSerializers
+{
+
+template<typename CppType, typename SchemaType, void (*AddToSchema)(Schema_Object*, Schema_FieldId, SchemaType)>
+void Write(UProperty* /*Property*/, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+{
+	AddToSchema(Object, FieldId, static_cast<SchemaType>(*reinterpret_cast<const CppType*>(Data)));
+}
+
+template<typename CppType, typename SchemaType, SchemaType (*IndexFromSchema)(const Schema_Object*, Schema_FieldId, uint32_t)>
+void Read(UProperty* /*Property*/, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+{
+	*reinterpret_cast<CppType*>(Data) = static_cast<CppType>(IndexFromSchema(Object, FieldId, Index));
+}
+
+// Only for native bools, bitfield bools go through the runtime replication plan.
+inline void WriteNativeBool(UProperty* /*Property*/, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+{
+	Schema_AddBool(Object, FieldId, *reinterpret_cast<const bool*>(Data) ? 1 : 0);
+}
+
+inline void ReadNativeBool(UProperty* /*Property*/, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+{
+	*reinterpret_cast<bool*>(Data) = Schema_IndexBool(Object, FieldId, Index) != 0;
+}
+
+} // namespace GeneratedSerializers
+
+} // namespace SpatialGDK
@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class USpatialNetConnection;
+
+namespace SpatialGDK
+{
+
+/**
+ * Tracks when each client connection on a server last sent a heartbeat, so that all connections can be checked for a timeout
+ * in a single sweep instead of each connection restarting its own timeout timer on every heartbeat.
+ * Last heartbeat times are kept in a flat array that the sweep walks without touching the connections.
+ */
+class SPATIALGDK_API FHeartbeatManager
+{
+public:
+	explicit FHeartbeatManager(double InTimeoutSeconds);
+
+	void AddConnection(USpatialNetConnection* Connection, double Now);
+	void RemoveConnection(const USpatialNetConnection* Connection);
+	void OnHeartbeat(const USpatialNetConnection* Connection, double Now);
+
+	// Stops tracking the connections that have not sent a heartbeat within the timeout and returns them.
+	// Connections that have been destroyed since they were added are dropped without being returned.
+	TArray<USpatialNetConnection*> RemoveTimedOutConnections(double Now);
+
+	int32 GetNumConnections() const { return Connections.Num(); }
+
+private:
+	void RemoveAtSwap(int32 Index);
+
+	TArray<double> LastHeartbeatTimes;
+	TArray<TWeakObjectPtr<USpatialNetConnection>> Connections;
+	// The keys of ConnectionIndices by index, so entries of destroyed connections can still be removed.
+	TArray<const USpatialNetConnection*> ConnectionKeys;
+	TMap<const USpatialNetConnection*, int32> ConnectionIndices;
+
+	double TimeoutSeconds;
+};
+
+} // namespace SpatialGDK
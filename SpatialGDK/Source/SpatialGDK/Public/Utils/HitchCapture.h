@@ -0,0 +1,133 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// One per SPATIALGDK_SUBSYSTEM_SCOPE name, see SubsystemStats.h.
+enum class EGDKSubsystem : uint8
+{
+	TickDispatch,
+	CriticalSection,
+	ReplicateActor,
+	ComponentFactory,
+	RPCServiceFlush,
+	InterestUpdate,
+	LoadBalanceEnforcement,
+	ConnectionReceive,
+	ConnectionSend,
+	Count
+};
+
+// Running totals sampled at the end of each frame, which the capture turns into per-frame values.
+struct FHitchCaptureTotals
+{
+	uint64 RPCsSent = 0;
+	uint64 RPCsReceived = 0;
+	uint64 OutgoingMessagesQueued = 0;
+	uint32 OutgoingMessageQueueDepth = 0;
+};
+
+struct FHitchCaptureFrame
+{
+	uint64 FrameNumber = 0;
+	float FrameTimeMs = 0.f;
+
+	uint32 AddEntityOps = 0;
+	uint32 RemoveEntityOps = 0;
+	uint32 AddComponentOps = 0;
+	uint32 RemoveComponentOps = 0;
+	uint32 ComponentUpdateOps = 0;
+	uint32 AuthorityChangeOps = 0;
+	uint32 CommandOps = 0;
+	uint32 OtherOps = 0;
+	// Add component, remove component, component update and authority change ops.
+	TMap<Worker_ComponentId, uint32> OpsByComponent;
+
+	uint32 RPCsSent = 0;
+	uint32 RPCsReceived = 0;
+	uint32 OutgoingMessagesQueued = 0;
+	uint32 OutgoingMessageQueueDepth = 0;
+
+	// Inclusive, so a ComponentFactory scope inside ReplicateActor counts towards both.
+	float SubsystemTimeMs[static_cast<int32>(EGDKSubsystem::Count)] = {};
+};
+
+/**
+ * Rolling record of what the GDK did in each of the last frames, written out when a frame takes longer than a threshold so server
+ * hitches can be attributed after the fact without a profiler attached.
+ *
+ * Ops are recorded as they're dispatched and the capture is told about each frame ending, with the running totals it turns into
+ * per-frame counts. Subsystem times are accumulated by SPATIALGDK_SUBSYSTEM_SCOPE from any thread while at least one capture exists.
+ * They're process-wide, so in PIE they include the scopes of every net driver.
+ */
+class SPATIALGDK_API FHitchCapture
+{
+public:
+	FHitchCapture(int32 InMaxFrames, float InHitchThresholdMs, float InMinSecondsBetweenHitches);
+	~FHitchCapture();
+
+	FHitchCapture(const FHitchCapture&) = delete;
+	FHitchCapture& operator=(const FHitchCapture&) = delete;
+
+	void RecordOp(const Worker_Op& Op);
+
+	// Closes the current frame and starts the next one. Returns true if the closed frame was a hitch which should be reported,
+	// which is at most once every MinSecondsBetweenHitches.
+	bool EndFrame(uint64 FrameNumber, float FrameTimeSeconds, const FHitchCaptureTotals& Totals, double NowSeconds);
+
+	// Oldest first, at most MaxFrames.
+	TArray<const FHitchCaptureFrame*> GetFrames() const;
+
+	// One row per frame, oldest first. OpsByComponent lists the components with the most ops as ComponentId:Count pairs.
+	FString ToCsv() const;
+
+	static bool IsSubsystemTimingEnabled() { return NumSubsystemTimingUsers.Load(EMemoryOrder::Relaxed) > 0; }
+	static void AddSubsystemCycles(EGDKSubsystem Subsystem, uint64 Cycles);
+
+private:
+	static TAtomic<int32> NumSubsystemTimingUsers;
+
+	int32 MaxFrames;
+	float HitchThresholdMs;
+	float MinSecondsBetweenHitches;
+
+	TArray<FHitchCaptureFrame> Frames;
+	// Index in Frames of the oldest frame once the ring is full.
+	int32 OldestFrameIndex = 0;
+	FHitchCaptureFrame CurrentFrame;
+
+	FHitchCaptureTotals LastTotals;
+	bool bHasLastTotals = false;
+	double LastHitchTime = -1.0;
+};
+
+class FHitchCaptureSubsystemScope
+{
+public:
+	explicit FHitchCaptureSubsystemScope(EGDKSubsystem InSubsystem)
+		: Subsystem(InSubsystem)
+		, StartCycles(FHitchCapture::IsSubsystemTimingEnabled() ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FHitchCaptureSubsystemScope()
+	{
+		if (StartCycles != 0)
+		{
+			FHitchCapture::AddSubsystemCycles(Subsystem, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	EGDKSubsystem Subsystem;
+	uint64 StartCycles;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,74 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+enum class EHotEntityCounter : uint8
+{
+	OutgoingUpdates,
+	OutgoingRPCs,
+	IncomingOps,
+	Count
+};
+
+struct FHotEntity
+{
+	Worker_EntityId EntityId;
+	// Per second, averaged over the tracker's window.
+	float Rate;
+};
+
+/**
+ * Sliding window rates of the component updates and RPCs sent and the ops received for each entity, to find the few entities, such as
+ * an actor with a replicated timer or a looping multicast, that account for an outsized share of a worker's traffic.
+ *
+ * The window is split into a fixed number of buckets, and an entity's buckets are only cycled when something is recorded for it, so
+ * recording is a map lookup and an add. Entities without activity in the window are dropped by RemoveInactiveEntities.
+ */
+class SPATIALGDK_API FHotEntityTracker
+{
+public:
+	static constexpr int32 NumBuckets = 5;
+
+	explicit FHotEntityTracker(float InWindowSeconds);
+
+	void Record(Worker_EntityId EntityId, EHotEntityCounter Counter, double Now, uint32 Count = 1);
+
+	float GetRate(Worker_EntityId EntityId, EHotEntityCounter Counter, double Now) const;
+
+	// The K entities with the highest rate of the counter that are above 0, highest first.
+	TArray<FHotEntity> GetTopEntities(EHotEntityCounter Counter, int32 K, double Now) const;
+
+	// The entities whose rate of the counter is at least Threshold.
+	TArray<FHotEntity> GetEntitiesAtOrAbove(EHotEntityCounter Counter, float Threshold, double Now) const;
+
+	void RemoveEntity(Worker_EntityId EntityId);
+	void RemoveInactiveEntities(double Now);
+
+	int32 GetNumTrackedEntities() const { return Entities.Num(); }
+
+	static const TCHAR* GetCounterName(EHotEntityCounter Counter);
+
+private:
+	struct FEntityCounts
+	{
+		int64 NewestBucket = 0;
+		uint32 Counts[static_cast<int32>(EHotEntityCounter::Count)][NumBuckets] = {};
+	};
+
+	int64 GetBucket(double Now) const;
+	float GetRate(const FEntityCounts& EntityCounts, EHotEntityCounter Counter, int64 CurrentBucket) const;
+
+	float WindowSeconds;
+	float BucketSeconds;
+	TMap<Worker_EntityId_Key, FEntityCounts> Entities;
+};
+
+} // namespace SpatialGDK
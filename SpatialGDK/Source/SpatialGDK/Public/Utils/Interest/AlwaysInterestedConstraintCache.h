@@ -0,0 +1,37 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Interest.h"
+#include "SpatialCommonTypes.h"
+
+#include "Containers/Map.h"
+#include "Templates/Function.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Remembers the AlwaysInterested constraint last built for each player controller entity, so interest rebuilds don't walk the
+ * AlwaysInterested properties again. The component factory invalidates an entity's constraint when it writes one of them.
+ */
+class SPATIALGDK_API FAlwaysInterestedConstraintCache
+{
+public:
+	// Returns the constraint cached for the entity, or builds it. BuildConstraint returns false if the constraint can change without
+	// an AlwaysInterested property being written, in which case it isn't cached.
+	QueryConstraint FindOrBuild(const Worker_EntityId EntityId, TFunctionRef<bool(QueryConstraint&)> BuildConstraint);
+
+	void Invalidate(const Worker_EntityId EntityId);
+
+	int32 GetNumCachedConstraints() const { return CachedConstraints.Num(); }
+	uint64 GetNumCacheHits() const { return NumCacheHits; }
+
+private:
+	TMap<Worker_EntityId_Key, QueryConstraint> CachedConstraints;
+	uint64 NumCacheHits = 0;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,57 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Interest.h"
+
+/**
+ * This class gives static functionality which rewrites interest queries into an equivalent, smaller set of queries.
+ *
+ * The interest factory builds a query for every system defined constraint, every user defined frequency and every net cull distance
+ * frequency bucket. Many of these share a result type and frequency, and the runtime evaluates each query separately. The optimizer:
+ *   - simplifies each constraint: nested conjunctions and disjunctions are flattened, duplicates are removed, spheres, cylinders
+ *     and boxes nested inside another one in the same disjunction (or containing another one in the same conjunction) are dropped,
+ *     boxes in the same disjunction which are adjacent along one axis and line up on the others, like the cells of a grid, are merged
+ *     into their bounding box, and conjunctions shared by every branch of a disjunction are factored out.
+ *   - merges queries with identical constraints and result types, keeping the highest frequency.
+ *   - drops queries whose constraint is contained in the constraint of another query with the same result type and at least the same
+ *     frequency, since the runtime uses the highest frequency of all queries matching an entity-component.
+ *   - merges the remaining queries with the same result type and frequency into a single disjunction.
+ *
+ * Containment is only detected structurally, so the optimizer never changes which entities and components are checked out or the
+ * frequency they are received at, but may miss some merges. The only exception is merging boxes that are up to a millimeter apart,
+ * which fills the gap between them.
+ */
+
+namespace SpatialGDK
+{
+
+class SPATIALGDK_API InterestQueryOptimizer
+{
+public:
+
+	static void OptimizeInterest(Interest& OutInterest);
+	static void OptimizeQueries(TArray<Query>& OutQueries);
+
+	static int32 CountQueries(const Interest& InInterest);
+
+	// visible for testing
+	static QueryConstraint SimplifyConstraint(const QueryConstraint& Constraint);
+	static bool IsConstraintSubsetOf(const QueryConstraint& Inner, const QueryConstraint& Outer);
+
+private:
+
+	static bool IsConjunction(const QueryConstraint& Constraint);
+	static bool IsDisjunction(const QueryConstraint& Constraint);
+	static bool IsLeafSubsetOf(const QueryConstraint& Inner, const QueryConstraint& Outer);
+
+	static QueryConstraint SimplifyConjunction(const TArray<QueryConstraint>& Children);
+	static QueryConstraint SimplifyDisjunction(const TArray<QueryConstraint>& Children);
+	static void MergeAdjacentBoxes(TArray<QueryConstraint>& OutDisjuncts);
+	static bool FactorCommonConjuncts(const TArray<QueryConstraint>& Disjuncts, QueryConstraint& OutConstraint);
+
+	static bool HasSameResult(const Query& A, const Query& B);
+	static bool IsFrequencyAtLeast(const TSchemaOption<float>& Frequency, const TSchemaOption<float>& Other);
+};
+
+} // namespace SpatialGDK
@@ -24,6 +24,7 @@
  * will receive the full frequency. More queries will be added representing bigger circles with lower frequencies depending on the
  * configured frequency <-> distance ratio pairs, until the final circle will be at the configured NCD. This approach will generate
  * n queries per client in total where n is the number of configured frequency buckets.
+ * Buckets marked bLowDetail are kept apart from the others and flagged, so that InterestFactory gives them the low detail result type.
  */
 
 DECLARE_LOG_CATEGORY_EXTERN(LogNetCullDistanceInterest, Log, All);
@@ -52,6 +53,7 @@ private:
 	static float NetCullDistanceSquaredToSpatialDistance(float NetCullDistanceSquared);
 
 	static void AddToFrequencyConstraintMap(const float Frequency, const QueryConstraint& Constraint, FrequencyToConstraintsMap& OutFrequencyToConstraints);
+	static void AddFrequencyConstraints(const FrequencyToConstraintsMap& FrequencyToConstraints, const bool bLowDetail, FrequencyConstraints& OutCheckoutConstraints);
 	static void AddTypeHierarchyToConstraint(const UClass& BaseType, QueryConstraint& OutConstraint, USpatialClassInfoManager* ClassInfoManager);
 };
 
@@ -0,0 +1,47 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Interest.h"
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Interns interest queries by structure and memoizes their serialized schema form.
+ * Most actors of the same class end up with identical level, net cull distance and user defined queries, which can have large
+ * constraint trees and result types. Instead of walking those trees for every actor, the first occurrence of a query is serialized
+ * once, and every later occurrence is merged into the interest component straight from the cached bytes.
+ * Queries containing an entity ID constraint are unique to an entity and are always written directly.
+ */
+class SPATIALGDK_API FQuerySchemaCache
+{
+public:
+	void AddQueryToComponentInterestSchema(Schema_Object* ComponentInterestObject, Schema_FieldId Id, const Query& Value);
+	void AddComponentInterestToInterestSchema(Schema_Object* InterestObject, Schema_FieldId Id, const ComponentInterest& Value);
+	void FillInterestComponentObject(Schema_Object* InterestComponentObject, const Interest& Value);
+
+	Worker_ComponentData CreateInterestData(const Interest& Value);
+	Worker_ComponentUpdate CreateInterestUpdate(const Interest& Value);
+
+	void Reset();
+
+	int32 GetNumCachedQueries() const { return SerializedQueries.Num(); }
+	uint64 GetNumCacheHits() const { return NumCacheHits; }
+
+	// Once full, queries not yet in the cache are written directly.
+	static constexpr int32 MaxCachedQueries = 4096;
+
+private:
+	static bool ContainsEntityIdConstraint(const QueryConstraint& Constraint);
+
+	TMap<Query, TArray<uint8>> SerializedQueries;
+	uint64 NumCacheHits = 0;
+};
+
+} // namespace SpatialGDK
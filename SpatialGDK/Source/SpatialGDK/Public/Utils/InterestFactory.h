@@ -4,6 +4,9 @@
 
 #include "Interop/SpatialClassInfoManager.h"
 #include "Schema/Interest.h"
+#include "SpatialCommonTypes.h"
+#include "Utils/Interest/AlwaysInterestedConstraintCache.h"
+#include "Utils/Interest/QuerySchemaCache.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -45,7 +48,27 @@ public:
 	Worker_ComponentData CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
 	Worker_ComponentUpdate CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
 
-	Interest CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy);
+	// Same as CreateInterestUpdate, but when bSkipUnchangedInterestUpdates is enabled, returns false without creating an update
+	// if the interest is identical to the interest last created for the entity.
+	bool CreateInterestUpdateIfChanged(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, Worker_ComponentUpdate& OutUpdate);
+
+	// Drops the interest cached for the entity, for example because this worker stopped being authoritative over it and can no longer
+	// assume the cached interest is the entity's current interest.
+	void InvalidateCachedInterest(const Worker_EntityId InEntityId);
+
+	// Drops the AlwaysInterested constraint cached for the entity, because one of its AlwaysInterested properties was written.
+	void InvalidateAlwaysInterestedConstraint(const Worker_EntityId InEntityId);
+
+	uint64 GetNumSkippedInterestUpdates() const { return NumSkippedInterestUpdates; }
+
+	// The largest number of queries in the interest last built for a player controller, when bOptimizeInterestQueries is enabled.
+	int32 GetMaxClientInterestQueryCount() const;
+
+	const FQuerySchemaCache& GetQuerySchemaCache() const { return QuerySchemaCache; }
+	const FAlwaysInterestedConstraintCache& GetAlwaysInterestedConstraintCache() const { return AlwaysInterestedConstraintCache; }
+
+	// Standby workers, which don't have a virtual worker yet, also see the region of the virtual worker they stand by for.
+	Interest CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy, VirtualWorkerId StandbyForWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
 
 private:
 	// Shared constraints and result types are created at initialization and reused throughout the lifetime of the factory.
@@ -54,14 +77,18 @@ private:
 	// Builds the result types of necessary components for clients
 	// TODO: create and pull out into result types class
 	SchemaResultType CreateClientNonAuthInterestResultType();
+	SchemaResultType CreateClientLowDetailInterestResultType();
 	SchemaResultType CreateClientAuthInterestResultType();
 	SchemaResultType CreateServerNonAuthInterestResultType();
 	SchemaResultType CreateServerAuthInterestResultType();
 
+	// Builds the net cull distance queries from ClientCheckoutRadiusConstraint and the result types, without a level constraint.
+	void CreateNetCullDistanceQueries();
+
 	Interest CreateInterest(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
 
 	// Defined Constraint AND Level Constraint
-	void AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo) const;
+	void AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
 	// Self interests require the entity ID to know which entity is "self". This would no longer be required if there was a first class self constraint.
 	// The components clients need to see on entities they are have authority over that they don't already see through authority.
 	void AddClientSelfInterest(Interest& OutInterest, const Worker_EntityId& EntityId) const;
@@ -69,7 +96,8 @@ private:
 	void AddServerSelfInterest(Interest& OutInterest, const Worker_EntityId& EntityId) const;
 
 	// Add the always relevant and the always interested query.
-	void AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const QueryConstraint& LevelConstraint) const;
+	void AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId,
+		const QueryConstraint& LevelConstraint) const;
 
 	void AddUserDefinedQueries(Interest& OutInterest, const AActor* InActor, const QueryConstraint& LevelConstraint) const;
 	FrequencyToConstraintsMap GetUserDefinedFrequencyToConstraintsMap(const AActor* InActor) const;
@@ -79,15 +107,29 @@ private:
 
 	void AddComponentQueryPairToInterestComponent(Interest& OutInterest, const Worker_ComponentId ComponentId, const Query& QueryToAdd) const;
 
+	// Multiplies the frequency of the client queries from FirstQueryIndex, for clients over their bandwidth budget.
+	void ScaleClientQueryFrequencies(Interest& OutInterest, const Worker_ComponentId ClientAuthorityComponentId, const int32 FirstQueryIndex,
+		const float FrequencyScale, const float MaxFrequency) const;
+
+	void OptimizeInterest(Interest& OutInterest) const;
+
 	// System Defined Constraints
 	bool ShouldAddNetCullDistanceInterest(const AActor* InActor) const;
-	QueryConstraint CreateAlwaysInterestedConstraint(const AActor* InActor, const FClassInfo& InInfo) const;
+	// Reuses the constraint cached for the entity when bCacheAlwaysInterestedConstraints is enabled.
+	QueryConstraint CreateAlwaysInterestedConstraint(const AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
+	// Returns false if the constraint can change without one of the AlwaysInterested properties being written, so it can't be cached.
+	bool BuildAlwaysInterestedConstraint(const AActor* InActor, const FClassInfo& InInfo, QueryConstraint& OutConstraint) const;
 	QueryConstraint CreateAlwaysRelevantConstraint() const;
 
 	// Only checkout entities that are in loaded sub-levels
 	QueryConstraint CreateLevelConstraints(const AActor* InActor) const;
 
-	void AddObjectToConstraint(UObjectPropertyBase* Property, uint8* Data, QueryConstraint& OutConstraint) const;
+	// Returns false if the object isn't null but doesn't have an entity yet, so the constraint will change once it does.
+	bool AddObjectToConstraint(UObjectPropertyBase* Property, uint8* Data, QueryConstraint& OutConstraint) const;
+
+	// Serializes the interest, through the query schema cache when bCacheSerializedInterestQueries is enabled.
+	Worker_ComponentData SerializeInterestData(const Interest& InInterest) const;
+	Worker_ComponentUpdate SerializeInterestUpdate(const Interest& InInterest) const;
 
 	USpatialClassInfoManager* ClassInfoManager;
 	USpatialPackageMapClient* PackageMap;
@@ -98,9 +140,29 @@ private:
 
 	// Cache the result types of queries.
 	SchemaResultType ClientNonAuthInterestResultType;
+	SchemaResultType ClientLowDetailInterestResultType;
 	SchemaResultType ClientAuthInterestResultType;
 	SchemaResultType ServerNonAuthInterestResultType;
 	SchemaResultType ServerAuthInterestResultType;
+
+	// The net cull distance queries only differ between players by their level constraint, so everything else is built once here.
+	// Server queries are only built when bEnableClientQueriesOnServer is enabled.
+	TArray<Query> ClientNetCullDistanceQueries;
+	TArray<Query> ServerNetCullDistanceQueries;
+
+	// The interest last sent for each entity through CreateInterestUpdateIfChanged.
+	TMap<Worker_EntityId_Key, Interest> CachedInterests;
+	uint64 NumSkippedInterestUpdates = 0;
+
+	// Number of queries in the interest last built for each player controller entity, reported as a metric.
+	mutable TMap<Worker_EntityId_Key, int32> ClientInterestQueryCounts;
+
+	// The AlwaysInterested constraint last built for each player controller entity, when bCacheAlwaysInterestedConstraints is enabled.
+	// Only constraints which can't change without an AlwaysInterested property being written are cached.
+	mutable FAlwaysInterestedConstraintCache AlwaysInterestedConstraintCache;
+
+	// Serializing the interest doesn't change what the factory produces, so the cache is usable from const functions.
+	mutable FQuerySchemaCache QuerySchemaCache;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,34 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+// Latency measurements in seconds, kept in full so percentiles are exact rather than estimated from a histogram.
+class SPATIALGDK_API FLatencySamples
+{
+public:
+	void Add(double Seconds);
+	void Reset();
+
+	int32 Num() const { return Samples.Num(); }
+
+	// Nearest-rank percentile, with Percentile between 0 and 100. Returns 0 if there are no samples.
+	double GetPercentile(double Percentile) const;
+	double GetMax() const;
+
+	// A JSON object with the sample count and the 50th, 90th and 99th percentiles and max in milliseconds,
+	// for Fields to be prepended to, e.g. `"scenario": "Default", `.
+	FString ToJson(const FString& Fields) const;
+
+private:
+	void SortIfNeeded() const;
+
+	mutable TArray<double> Samples;
+	mutable bool bIsSorted = true;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+/**
+ * The levels visible on a client which are waiting to be added to its interest, see ClientLevelInterestActivationIntervalSeconds.
+ * Levels are activated nearest to the client's pawn first, as the player is likely moving into the nearest one. Levels without
+ * bounds, such as levels which aren't loaded on the server, go last.
+ */
+class SPATIALGDK_API FLevelInterestActivationQueue
+{
+public:
+	// Returns false if the level is already pending. Bounds is invalid if the level isn't loaded on this server.
+	bool Add(FName PackageName, const FBox& Bounds);
+	void Remove(FName PackageName);
+	bool Contains(FName PackageName) const;
+	int32 Num() const { return PendingLevels.Num(); }
+
+	// Removes and returns the level to activate next: the nearest to Origin if set, and otherwise the level made visible first.
+	// Returns NAME_None if nothing is pending.
+	FName PopNext(const TOptional<FVector>& Origin);
+
+private:
+	struct FPendingLevel
+	{
+		FName PackageName;
+		FBox Bounds;
+	};
+
+	TArray<FPendingLevel> PendingLevels;
+};
+
+} // namespace SpatialGDK
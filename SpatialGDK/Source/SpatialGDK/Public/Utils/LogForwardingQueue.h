@@ -0,0 +1,67 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Bounded queue of log lines waiting to be forwarded to SpatialOS, filled from any thread that logs and drained on the game thread.
+ * Lines are sampled per category and rate limited with a token bucket before they are queued. Errors and fatal lines skip sampling
+ * and the rate limit, but like every other line are dropped once the queue is full. Draining merges consecutive lines of the same
+ * level into batches, so each batch costs a single SendLogMessage.
+ */
+class SPATIALGDK_API FLogForwardingQueue
+{
+public:
+	struct FLogBatch
+	{
+		Worker_LogLevel Level;
+		FString Message;
+		int32 NumLines;
+	};
+
+	// MaxLinesPerSecond of 0 disables the rate limit. CategorySampleRates forwards one in every N lines of a category.
+	FLogForwardingQueue(int32 InCapacity, int32 InMaxLinesPerSecond, const TMap<FName, uint32>& InCategorySampleRates);
+
+	// Returns false if the line was sampled out, rate limited or the queue was full. Thread safe.
+	bool Enqueue(Worker_LogLevel Level, const FName& Category, const TCHAR* Message, double Now);
+
+	// Moves the queued lines into at most one batch per run of MaxLinesPerBatch lines of the same level.
+	// Returns the number of lines dropped since the last drain.
+	uint32 Drain(int32 MaxLinesPerBatch, TArray<FLogBatch>& OutBatches);
+
+	int32 GetNum() const;
+
+private:
+	struct FQueuedLine
+	{
+		Worker_LogLevel Level;
+		FString Message;
+	};
+
+	bool ShouldSample(const FName& Category);
+	bool ConsumeRateLimitToken(double Now);
+
+	mutable FCriticalSection Mutex;
+
+	// Ring of Capacity lines, allocated up front, starting at Head.
+	TArray<FQueuedLine> Lines;
+	int32 Head = 0;
+	int32 Num = 0;
+	uint32 NumDropped = 0;
+
+	int32 MaxLinesPerSecond;
+	double RateLimitTokens;
+	double LastRefillTime = 0.0;
+
+	TMap<FName, uint32> CategorySampleRates;
+	TMap<FName, uint32> CategoryLineCounts;
+};
+
+} // namespace SpatialGDK
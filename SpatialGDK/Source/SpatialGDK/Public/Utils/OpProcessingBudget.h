@@ -0,0 +1,40 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+// Decides where a time-sliced pass over an op list stops, see SpatialDispatcher::ProcessOps.
+class FOpProcessingBudget
+{
+public:
+	// An EndTime (in FPlatformTime::Seconds) or MaxOps of 0 is unbounded.
+	FOpProcessingBudget(uint32 InFirstOpIndex, double InEndTime, uint32 InMaxOps)
+		: FirstOpIndex(InFirstOpIndex)
+		, EndTime(InEndTime)
+		, MaxOps(InMaxOps)
+	{
+	}
+
+	// Whether to stop before processing the op at OpIndex. The first op is always processed, so that every pass makes progress, and a
+	// pass never stops inside a critical section, so that entities are added with all of their components and authority.
+	bool ShouldStopBefore(uint32 OpIndex, bool bInCriticalSection) const
+	{
+		if (OpIndex == FirstOpIndex || bInCriticalSection)
+		{
+			return false;
+		}
+
+		return (MaxOps > 0 && OpIndex - FirstOpIndex >= MaxOps) || (EndTime > 0.0 && FPlatformTime::Seconds() >= EndTime);
+	}
+
+private:
+	uint32 FirstOpIndex;
+	double EndTime;
+	uint32 MaxOps;
+};
+
+} // namespace SpatialGDK
@@ -12,4 +12,26 @@ void FindFirstOpOfType(const TArray<Worker_OpList*>& InOpLists, const Worker_OpT
 void AppendAllOpsOfType(const TArray<Worker_OpList*>& InOpLists, const Worker_OpType OpType, TArray<Worker_Op*>& FoundOps);
 void FindFirstOpOfTypeForComponent(const TArray<Worker_OpList*>& InOpLists, const Worker_OpType OpType, const Worker_ComponentId ComponentId, Worker_Op** OutOp);
 Worker_ComponentId GetComponentId(const Worker_Op* Op);
+
+// Indexes a set of op lists in a single pass, so looking up the first op of a type, or of a type for a component, doesn't
+// rescan every op. Ops of the types in OpTypesToKeep are all kept, in order, rather than just the first one.
+class SPATIALGDK_API FOpListIndex
+{
+public:
+	FOpListIndex(const TArray<Worker_OpList*>& InOpLists, std::initializer_list<Worker_OpType> OpTypesToKeep = {});
+
+	Worker_Op* FindFirstOpOfType(const Worker_OpType OpType) const;
+	Worker_Op* FindFirstOpOfTypeForComponent(const Worker_OpType OpType, const Worker_ComponentId ComponentId) const;
+	void AppendAllOpsOfType(const Worker_OpType OpType, TArray<Worker_Op*>& FoundOps) const;
+
+private:
+	static uint64 GetComponentKey(const Worker_OpType OpType, const Worker_ComponentId ComponentId)
+	{
+		return (static_cast<uint64>(OpType) << 32) | ComponentId;
+	}
+
+	TMap<uint8, Worker_Op*> FirstOpByType;
+	TMap<uint64, Worker_Op*> FirstOpByTypeAndComponent;
+	TMap<uint8, TArray<Worker_Op*>> KeptOpsByType;
+};
 } // namespace SpatialGDK
@@ -0,0 +1,65 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <algorithm>
+
+namespace SpatialGDK
+{
+
+// How an entry of the prioritized replication list counts towards the entity creation and actor replication rate limits.
+enum class EPrioritizedEntryKind : uint8
+{
+	// Deletions, torn off actors and actors whose channel was just closed, which are handled the same whatever the rate limits.
+	NotRateLimited,
+	// Actors whose entity still has to be created. They count towards the entity creation rate limit while it has room, and otherwise
+	// towards the actor replication rate limit.
+	EntityCreation,
+	// Other actors, which count towards the actor replication rate limit.
+	Replication
+};
+
+/**
+ * Moves the entries which can be processed under the rate limits to the front of Entries in Predicate order, and returns how many there are.
+ * These are every NotRateLimited entry, the EntityCreationRateLimit highest priority EntityCreation entries and the ActorReplicationRateLimit
+ * highest priority of the rest. The other entries follow in no particular order. Both rate limits are used up by the time they are reached,
+ * so processing the entries in this order has the same result as processing them fully sorted.
+ */
+template <typename EntryType, typename GetKindType, typename PredicateType>
+int32 SortPrioritizedEntriesWithinRateLimits(EntryType* Entries, const int32 NumEntries, const uint32 EntityCreationRateLimit, const uint32 ActorReplicationRateLimit,
+	GetKindType GetKind, PredicateType Predicate)
+{
+	EntryType* const End = Entries + NumEntries;
+
+	auto SelectHighestPriority = [&Predicate](EntryType* Begin, EntryType* SelectEnd, const uint32 Limit) -> EntryType*
+	{
+		if (static_cast<uint32>(SelectEnd - Begin) <= Limit)
+		{
+			return SelectEnd;
+		}
+
+		std::nth_element(Begin, Begin + Limit, SelectEnd, Predicate);
+		return Begin + Limit;
+	};
+
+	EntryType* const CreationBegin = std::partition(Entries, End, [&GetKind](const EntryType& Entry)
+	{
+		return GetKind(Entry) == EPrioritizedEntryKind::NotRateLimited;
+	});
+	EntryType* const ReplicationBegin = std::partition(CreationBegin, End, [&GetKind](const EntryType& Entry)
+	{
+		return GetKind(Entry) == EPrioritizedEntryKind::EntityCreation;
+	});
+
+	// The creations which don't fit in the creation rate limit compete with the other actors for the replication rate limit.
+	EntryType* const CreationEnd = SelectHighestPriority(CreationBegin, ReplicationBegin, EntityCreationRateLimit);
+	EntryType* const SelectedEnd = SelectHighestPriority(CreationEnd, End, ActorReplicationRateLimit);
+
+	std::sort(Entries, SelectedEnd, Predicate);
+
+	return static_cast<int32>(SelectedEnd - Entries);
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,82 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Interop/Connection/OutgoingMessages.h"
+#include "Templates/SharedPointer.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogPrometheusMetricsEndpoint, Log, All);
+
+class FRunnableThread;
+class FSocket;
+class ISocketSubsystem;
+
+namespace SpatialGDK
+{
+
+/**
+ * Builds the Prometheus text exposition of the metrics USpatialMetrics reports. Gauges keep their latest value, and the histograms
+ * of each report are added to totals since the worker started, as Prometheus expects cumulative histograms.
+ * Metric names are the report keys lowercased, with characters Prometheus doesn't allow replaced by underscores, prefixed by spatialgdk_.
+ */
+class SPATIALGDK_API FPrometheusMetricsText
+{
+public:
+	// Counters are totals since the worker started, named without the _total suffix, which is added.
+	FString Update(const SpatialMetrics& Metrics, const TArray<TPair<FString, uint64>>& Counters);
+
+	static FString ToMetricName(const FString& Key);
+
+private:
+	struct FHistogramTotals
+	{
+		TArray<double> UpperBounds;
+		TArray<uint64> CumulativeCounts;
+		double Sum = 0.0;
+	};
+
+	void AddHistogram(const HistogramMetric& Metric);
+
+	TMap<FString, FHistogramTotals> HistogramTotals;
+};
+
+/**
+ * Serves the latest metrics text to GET /metrics requests on its own thread, so that scraping never waits on the game thread.
+ * The game thread publishes new text with every metrics report, and the game thread and the endpoint thread only share the
+ * pointer to the latest text.
+ */
+class SPATIALGDK_API FPrometheusMetricsEndpoint : public FRunnable
+{
+public:
+	FPrometheusMetricsEndpoint();
+	virtual ~FPrometheusMetricsEndpoint();
+
+	// Returns false if nothing could listen on the port.
+	bool Start(int32 Port);
+
+	void Publish(const SpatialMetrics& Metrics, const TArray<TPair<FString, uint64>>& Counters);
+
+	// Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// End FRunnable Interface
+
+private:
+	void Serve(FSocket& ClientSocket);
+
+	FPrometheusMetricsText MetricsText;
+
+	ISocketSubsystem* SocketSubsystem = nullptr;
+	FSocket* ListenSocket = nullptr;
+	FRunnableThread* Thread = nullptr;
+	FThreadSafeBool bStopping;
+
+	FCriticalSection LatestTextLock;
+	// UTF-8, ready to be sent as the response body.
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> LatestText;
+};
+
+} // namespace SpatialGDK
@@ -14,6 +14,11 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogRPCContainer, Log, All);
 
+namespace SpatialGDK
+{
+class FAtomicHistogram;
+}
+
 struct FPendingRPCParams;
 struct FRPCErrorInfo;
 DECLARE_DELEGATE_RetVal_OneParam(FRPCErrorInfo, FProcessRPCDelegate, const FPendingRPCParams&)
@@ -34,6 +39,7 @@ enum class ERPCResult : uint8
 	NoNetConnection,
 	NoAuthority,
 	InvalidRPCType,
+	HotEntityThrottled,
 
 	// Specific to packing
 	NoOwningController,
@@ -63,6 +69,10 @@ struct FRPCErrorInfo
 	TWeakObjectPtr<UFunction> Function = nullptr;
 	ERPCResult ErrorCode = ERPCResult::Unknown;
 	bool bShouldDrop = false;
+
+	// With UnresolvedParameters, the references the RPC is waiting for, if known. The RPC is then only retried once one of them
+	// resolves or it times out, instead of on every ProcessRPCs.
+	TArray<FUnrealObjectRef> UnresolvedRefs;
 };
 
 struct SPATIALGDK_API FPendingRPCParams
@@ -98,21 +108,107 @@ public:
 
 	void BindProcessingFunction(const FProcessRPCDelegate& Function);
 	void ProcessOrQueueRPC(const FUnrealObjectRef& InTargetObjectRef, ERPCType InType, SpatialGDK::RPCPayload&& InPayload);
+
+	// Only processes entities that can make progress. Entities whose RPCs are waiting for their own target object to resolve
+	// are skipped until MarkEntityReady is called for them.
 	void ProcessRPCs();
 	void DropForEntity(const Worker_EntityId& EntityId);
 
+	// Call when an object on EntityId resolves, so RPCs waiting for their target object are retried by the next ProcessRPCs.
+	void MarkEntityReady(const Worker_EntityId& EntityId);
+
+	// Call when an object resolves, so RPCs waiting for it as a parameter are retried by the next ProcessRPCs.
+	void OnObjectRefResolved(const FUnrealObjectRef& ObjectRef);
+
+	// RPCs waiting for unresolved parameters are also retried by the first ProcessRPCs once they've been queued for this long.
+	void SetUnresolvedRefsTimeout(float InTimeoutSeconds) { UnresolvedRefsTimeoutSeconds = InTimeoutSeconds; }
+
 	bool ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const;
 
+	// Replaces FDateTime::Now as the clock that queued times, timeouts and times to live are measured with, so tests don't have to wait.
+	void SetTimeSource(TFunction<FDateTime()> InTimeSource) { TimeSource = MoveTemp(InTimeSource); }
+
+	// When set, records how long each applied RPC waited in the container, in seconds. RPCs applied immediately record 0.
+	void SetQueuedTimeHistogram(SpatialGDK::FAtomicHistogram* Histogram) { QueuedTimeHistogram = Histogram; }
+
+	int32 GetNumQueuedRPCs() const { return NumQueuedRPCs; }
+	int32 GetNumReadyEntities() const { return ReadyEntities.Num(); }
+	int32 GetNumRefsWaitedFor() const { return EntitiesWaitingForRefs.Num(); }
+	// Unreliable RPCs dropped because they were queued for longer than their time to live, see USpatialGDKSettings::GetUnreliableRPCTimeToLive.
+	uint32 GetNumExpiredRPCs() const { return NumExpiredRPCs; }
+
+	// Bytes used by the queues and the payloads of the RPCs queued in them.
+	SIZE_T GetAllocatedSize() const;
+
 private:
-	using FArrayOfParams = TArray<FPendingRPCParams>;
-	using FRPCMap = TMap<Worker_EntityId_Key, FArrayOfParams>;
-	using RPCContainerType = TMap<ERPCType, FRPCMap>;
+	static constexpr int32 NumRPCTypes = static_cast<int32>(ERPCType::CrossServer) + 1;
 
-	void ProcessRPCs(FArrayOfParams& RPCList);
-	bool ApplyFunction(FPendingRPCParams& Params);
-	RPCContainerType QueuedRPCs;
+	// Queued RPCs are stored in a single pooled slab of nodes, each entity and RPC type owns an intrusive list of nodes in it.
+	struct FQueuedRPCNode
+	{
+		TOptional<FPendingRPCParams> Params;
+		int32 Next = INDEX_NONE;
+		// Incremented whenever the node is freed, so an RPC being applied can tell whether its entity was dropped meanwhile.
+		uint32 Generation = 0;
+	};
+
+	struct FRPCQueue
+	{
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+		bool bWaitingForTarget = false;
+		bool bWaitingForRefs = false;
+	};
+
+	struct FEntityRPCQueues
+	{
+		FRPCQueue Queues[NumRPCTypes];
+
+		// The references the queues waiting for parameters are registered on in EntitiesWaitingForRefs.
+		TArray<FUnrealObjectRef> WaitingForRefs;
+	};
+
+	struct FRefWaitTimeout
+	{
+		FDateTime Time;
+		Worker_EntityId EntityId;
+
+		bool operator<(const FRefWaitTimeout& Other) const { return Time < Other.Time; }
+	};
+
+	int32 AllocateNode(FPendingRPCParams&& Params);
+	void FreeNode(int32 NodeIndex);
+	void PushRPC(FRPCQueue& Queue, FPendingRPCParams&& Params);
+	void PopRPC(FRPCQueue& Queue);
+
+	// Returns false if the entity has nothing left to do until MarkEntityReady is called for it.
+	bool ProcessRPCs(Worker_EntityId EntityId);
+	void ProcessQueue(Worker_EntityId EntityId, int32 TypeIndex);
+	bool ApplyFunction(FPendingRPCParams& Params, FRPCErrorInfo& OutErrorInfo);
+
+	// Updates the waiting state of the queue after applying its head RPC failed, returning whether the entity can still make progress.
+	bool OnApplyFailed(Worker_EntityId EntityId, FRPCQueue& Queue, const FPendingRPCParams& Params, const FRPCErrorInfo& ErrorInfo);
+	void WaitForRefs(Worker_EntityId EntityId, const FPendingRPCParams& Params, const TArray<FUnrealObjectRef>& Refs);
+	void StopWaitingForRefs(Worker_EntityId EntityId, FEntityRPCQueues& Queues);
+	void WakeTimedOutEntities();
+
+	TArray<FQueuedRPCNode> Nodes;
+	int32 FreeNodeHead = INDEX_NONE;
+	int32 NumQueuedRPCs = 0;
+	uint32 NumExpiredRPCs = 0;
+
+	TMap<Worker_EntityId_Key, FEntityRPCQueues> EntityQueues;
+	TSet<Worker_EntityId_Key> ReadyEntities;
+	TMap<FUnrealObjectRef, TSet<Worker_EntityId_Key>> EntitiesWaitingForRefs;
+	// A min heap on the time, entries may be stale if the entity stopped waiting meanwhile.
+	TArray<FRefWaitTimeout> RefWaitTimeouts;
+	float UnresolvedRefsTimeoutSeconds = 0.0f;
 	FProcessRPCDelegate ProcessingFunction;
 	bool bAlreadyProcessingRPCs = false;
 
+	SpatialGDK::FAtomicHistogram* QueuedTimeHistogram = nullptr;
+
 	ERPCQueueType QueueType = ERPCQueueType::Unknown;
+
+	TFunction<FDateTime()> TimeSource;
 };
@@ -21,8 +21,15 @@ struct RPCRingBuffer
 		return RingBuffer[(RPCId - 1) % RingBuffer.Num()];
 	}
 
+	const TArray<RPCPayload>& GetPackedRingBufferElement(uint64 RPCId) const
+	{
+		return PackedRingBuffer[(RPCId - 1) % PackedRingBuffer.Num()];
+	}
+
 	ERPCType Type;
 	TArray<TOptional<RPCPayload>> RingBuffer;
+	// Elements written with WritePackedRPCsToSchema hold several RPCs, and are stored here instead of in RingBuffer.
+	TArray<TArray<RPCPayload>> PackedRingBuffer;
 	uint64 LastSentRPCId = 0;
 };
 
@@ -48,20 +55,39 @@ namespace RPCRingBufferUtils
 
 Worker_ComponentId GetRingBufferComponentId(ERPCType Type);
 RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type);
+RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type, uint32 RingBufferSize);
 uint32 GetRingBufferSize(ERPCType Type);
 
+// Ring buffers can be sized per entity, up to MaxRPCRingBufferSize. When the size field isn't set, the configured size for the type is used.
+Schema_FieldId GetRingBufferSizeFieldId(ERPCType Type);
+
 Worker_ComponentId GetAckComponentId(ERPCType Type);
 Schema_FieldId GetAckFieldId(ERPCType Type);
 
 Schema_FieldId GetInitiallyPresentMulticastRPCsCountFieldId();
 
+// The client and server endpoints both end with a ping ID. The client writes its latest ping ID to the ClientEndpoint,
+// and the server echoes it back on the ServerEndpoint.
+Schema_FieldId GetPingIdFieldId();
+
 bool ShouldQueueOverflowed(ERPCType Type);
+bool ShouldPackRPCs(ERPCType Type);
 
 void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer);
 void ReadAckFromSchema(const Schema_Object* SchemaObject, ERPCType Type, uint64& OutAck);
+void ReadPingIdFromSchema(const Schema_Object* SchemaObject, uint32& OutPingId);
 
 void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const RPCPayload& Payload);
+void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint32 RingBufferSize, uint64 RPCId, const RPCPayload& Payload);
+void WriteRingBufferSizeToSchema(Schema_Object* SchemaObject, ERPCType Type, uint32 RingBufferSize);
+
+// Packed RPCs are stored back to back in a single bytes field, each as a packed offset, index and size followed by the payload.
+void AppendPackedRPC(TArray<uint8>& PackedRPCs, const RPCPayload& Payload);
+void ReadPackedRPCs(TArrayView<const uint8> PackedRPCs, TArray<RPCPayload>& OutPayloads);
+void WritePackedRPCsToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const TArray<uint8>& PackedRPCs);
+void WritePackedRPCsToSchema(Schema_Object* SchemaObject, ERPCType Type, uint32 RingBufferSize, uint64 RPCId, const TArray<uint8>& PackedRPCs);
 void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack);
+void WritePingIdToSchema(Schema_Object* SchemaObject, uint32 PingId);
 
 void MoveLastSentIdToInitiallyPresentCount(Schema_Object* SchemaObject, uint64 LastSentId);
 
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/Map.h"
 #include "HAL/Platform.h"
 #include "Net/RepLayout.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 // Storage for a changelist created by the replication system when replicating from the server.
 struct FRepChangeState
@@ -15,3 +17,6 @@ struct FRepChangeState
 
 using FHandoverChangeState = TArray<uint16>; // changed handover properties
 using FInterestChangeState = TArray<uint16>; // changed interest properties
+
+// The last sent value of each small plain old data property, by object and handle.
+using FLastSentPropertyValues = TMap<TPair<TWeakObjectPtr<UObject>, uint16>, TArray<uint8, TInlineAllocator<16>>>;
@@ -15,6 +15,39 @@ namespace SpatialGDK
 
 void RepLayout_SerializeProperties(FRepLayout& RepLayout, FArchive& Ar, UPackageMap* Map, const int32 CmdStart, const int32 CmdEnd, void* Data, bool& bHasUnmapped);
 
+inline bool RepLayout_IsBulkSerializableProperty(const UProperty* Property)
+{
+	// Bytes without an enum are serialized as 8 bits, the rest as their full size, so the archive output is the raw memory.
+	if (const UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
+	{
+		return ByteProperty->Enum == nullptr;
+	}
+
+	return Property->IsA<UFloatProperty>() || Property->IsA<UDoubleProperty>()
+		|| Property->IsA<UInt8Property>() || Property->IsA<UInt16Property>() || Property->IsA<UIntProperty>() || Property->IsA<UInt64Property>()
+		|| Property->IsA<UUInt16Property>() || Property->IsA<UUInt32Property>() || Property->IsA<UUInt64Property>();
+}
+
+// Whether the elements of the dynamic array at CmdIndex can be serialized as one block of memory without changing the output:
+// every element is made up of primitive numbers with no padding between them, e.g. TArray<float> or a TArray of a struct of int32s.
+inline bool RepLayout_IsBulkSerializableArray(const FRepLayout& RepLayout, const int32 CmdIndex)
+{
+	const FRepLayoutCmd& Cmd = RepLayout.Cmds[CmdIndex];
+
+	int32 ExpectedOffset = 0;
+	for (int32 InnerIndex = CmdIndex + 1; InnerIndex < Cmd.EndCmd - 1; InnerIndex++)
+	{
+		const FRepLayoutCmd& InnerCmd = RepLayout.Cmds[InnerIndex];
+		if (InnerCmd.Type == ERepLayoutCmdType::DynamicArray || !RepLayout_IsBulkSerializableProperty(InnerCmd.Property) || (int32)InnerCmd.Offset != ExpectedOffset)
+		{
+			return false;
+		}
+		ExpectedOffset += InnerCmd.Property->ElementSize;
+	}
+
+	return ExpectedOffset > 0 && ExpectedOffset == (int32)Cmd.ElementSize;
+}
+
 inline void RepLayout_SerializeProperties_DynamicArray(FRepLayout& RepLayout, FArchive& Ar, UPackageMap* Map, const int32 CmdIndex, uint8* Data, bool& bHasUnmapped)
 {
 	const FRepLayoutCmd& Cmd = RepLayout.Cmds[CmdIndex];
@@ -37,6 +70,12 @@ inline void RepLayout_SerializeProperties_DynamicArray(FRepLayout& RepLayout, FA
 
 	Data = (uint8*)Array->GetData();
 
+	if (Array->Num() > 0 && !Ar.IsByteSwapping() && RepLayout_IsBulkSerializableArray(RepLayout, CmdIndex))
+	{
+		Ar.Serialize(Data, Array->Num() * Cmd.ElementSize);
+		return;
+	}
+
 	for (int32 i = 0; i < Array->Num() && !Ar.IsError(); i++)
 	{
 		RepLayout_SerializeProperties(RepLayout, Ar, Map, CmdIndex + 1, Cmd.EndCmd - 1, Data + i * Cmd.ElementSize, bHasUnmapped);
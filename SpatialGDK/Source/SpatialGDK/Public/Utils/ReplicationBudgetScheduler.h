@@ -0,0 +1,89 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialReplicationBudgetScheduler, Log, All);
+
+namespace SpatialGDK
+{
+
+/**
+ * Decides which prioritized actors are replicated each tick, based on the time and bytes actually spent replicating them.
+ * The per-tick budget is split between candidate actors by weight, deficit round robin style: every time an actor is considered it
+ * is credited its share of a tick's budget, and it may replicate once its accumulated credit covers its estimated cost. Unused
+ * credit carries over to later ticks, so cheap and expensive actors get a fair share of the budget over time.
+ * Actors that have not replicated for longer than the starvation threshold are replicated regardless of credit and remaining budget.
+ */
+class SPATIALGDK_API FReplicationBudgetScheduler
+{
+public:
+	// A budget of 0 disables accounting for that cost.
+	FReplicationBudgetScheduler(float InTimeBudgetSeconds, uint32 InByteBudget, float InStarvationThresholdSeconds);
+
+	void BeginTick(double InCurrentTime);
+
+	// Must be called in priority order for every actor that could replicate this tick. Weight is the actor's share of the budget relative to other candidates.
+	bool ShouldReplicate(const AActor* Actor, float Weight);
+
+	// Records the cost of replicating an actor this tick, whether or not it was scheduled through ShouldReplicate.
+	void ReportCost(const AActor* Actor, double ElapsedSeconds, int64 BytesWritten);
+
+	void EndTick();
+
+	// The longest time, in seconds, an actor considered last tick has gone without replicating.
+	double GetOldestUnreplicatedActorAge() const { return OldestUnreplicatedActorAge; }
+
+	// The fraction of the last tick's budget that was spent. May exceed 1 when starved actors were replicated over budget.
+	double GetBudgetSpent() const { return LastTickBudgetSpent; }
+
+	int32 GetNumStarvedActorsReplicated() const { return LastTickStarvedActorsReplicated; }
+
+private:
+	struct FActorBudgetState
+	{
+		double Credit = 0.0;
+		double EstimatedCost = 0.0;
+		double LastReplicatedTime = 0.0;
+		uint64 LastConsideredTick = 0;
+		bool bReplicatedThisTick = false;
+	};
+
+	FActorBudgetState& FindOrAddState(const AActor* Actor);
+	double GetNormalizedCost(double ElapsedSeconds, int64 BytesWritten) const;
+
+	// Number of ticks an actor can go unconsidered (e.g. while dormant or destroyed) before its state is dropped.
+	static constexpr uint64 StalePruneTicks = 600;
+
+	// Weight applied to the latest sample when updating cost estimates.
+	static constexpr double CostSmoothingFactor = 0.25;
+
+	const float TimeBudgetSeconds;
+	const uint32 ByteBudget;
+	const float StarvationThresholdSeconds;
+
+	TMap<FObjectKey, FActorBudgetState> ActorStates;
+
+	double CurrentTime = 0.0;
+	uint64 TickIndex = 0;
+
+	// Costs are normalized so the whole tick budget is 1.
+	double BudgetSpent = 0.0;
+	double AverageCost = 0.0;
+
+	// Credit is handed out per unit of weight based on the total weight of the previous tick's candidates.
+	double CurrentTickTotalWeight = 0.0;
+	double LastTickTotalWeight = 0.0;
+
+	int32 StarvedActorsReplicated = 0;
+
+	double OldestUnreplicatedActorAge = 0.0;
+	double LastTickBudgetSpent = 0.0;
+	int32 LastTickStarvedActorsReplicated = 0;
+};
+
+} // namespace SpatialGDK
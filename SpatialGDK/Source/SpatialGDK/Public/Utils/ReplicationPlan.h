@@ -0,0 +1,30 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+class FRepLayout;
+
+namespace SpatialGDK
+{
+
+using FWritePropertyFunction = void (*)(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data);
+using FReadPropertyFunction = void (*)(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data);
+
+// How a single rep layout command is written to and read from schema, resolved once per class so that encoding and decoding
+// its value doesn't have to dispatch on the property type. Structs, object references and arrays need to track references or
+// recurse, so their functions are left null and they go through ComponentFactory::AddProperty and ComponentReader::ApplyProperty.
+struct FReplicationPlanEntry
+{
+	FWritePropertyFunction Write = nullptr;
+	FReadPropertyFunction Read = nullptr;
+};
+
+// Returns one entry per command of the rep layout, indexed by command index.
+TArray<FReplicationPlanEntry> CompileReplicationPlan(const FRepLayout& RepLayout);
+FReplicationPlanEntry CompileReplicationPlanEntry(UProperty* Property);
+
+} // namespace SpatialGDK
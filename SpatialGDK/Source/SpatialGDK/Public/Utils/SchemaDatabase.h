@@ -74,6 +74,19 @@ struct FSubobjectSchemaData
 	}
 };
 
+// The bytes fields of a class whose values are compressed, marked with the SpatialCompressed metadata on the property or class.
+USTRUCT()
+struct FCompressedFieldsSchemaData
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<uint32> ReplicatedFieldIds;
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<uint32> HandoverFieldIds;
+};
+
 UCLASS()
 class SPATIALGDK_API USchemaDatabase : public UDataAsset
 {
@@ -101,6 +114,9 @@ public:
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TMap<uint32, FString> ComponentIdToClassPath;
 
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TMap<FString, FCompressedFieldsSchemaData> ClassPathToCompressedFields;
+
 	// These component ID lists for each data type are stored separately as you cannot have nested maps in a UPROPERTY
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TArray<uint32> DataComponentIds;
@@ -119,5 +135,17 @@ public:
 
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	uint32 SchemaDescriptorHash;
+
+	// Hash of the type information each class's schema was generated from, so unchanged classes are not regenerated.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TMap<FString, uint32> ClassPathToContentHash;
+
+	// Hash of the schema files the schema descriptor was compiled from, so the schema compiler is skipped when nothing changed.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint32 SchemaFilesHash;
+
+	// Version of the GDK which generated this database. All schema is regenerated when it changes.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	FString GDKVersion;
 };
 
@@ -38,6 +38,37 @@ inline FString GetStringFromSchema(const Schema_Object* Object, Schema_FieldId I
 	return IndexStringFromSchema(Object, Id, 0);
 }
 
+// Converts a string field into OutString, reusing its allocation.
+inline void IndexStringFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index, FString& OutString)
+{
+	int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
+	const uint8_t* Bytes = Schema_IndexBytes(Object, Id, Index);
+	FUTF8ToTCHAR FStringConversion(reinterpret_cast<const ANSICHAR*>(Bytes), StringLength);
+	OutString.Reset(FStringConversion.Length());
+	OutString.AppendChars(FStringConversion.Get(), FStringConversion.Length());
+}
+
+// Reads a string field as a name without creating a temporary FString.
+inline FName IndexNameFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
+{
+	int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
+	const uint8_t* Bytes = Schema_IndexBytes(Object, Id, Index);
+	FUTF8ToTCHAR FStringConversion(reinterpret_cast<const ANSICHAR*>(Bytes), StringLength);
+	return FName(FStringConversion.Length(), FStringConversion.Get());
+}
+
+// The UTF-8 encoded bytes of a string field, which aren't null terminated.
+// Like the bytes views below, this points into the schema object and must not outlive it.
+inline TArrayView<const ANSICHAR> IndexUtf8StringViewFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
+{
+	return TArrayView<const ANSICHAR>(reinterpret_cast<const ANSICHAR*>(Schema_IndexBytes(Object, Id, Index)), (int32)Schema_IndexBytesLength(Object, Id, Index));
+}
+
+inline TArrayView<const ANSICHAR> GetUtf8StringViewFromSchema(const Schema_Object* Object, Schema_FieldId Id)
+{
+	return IndexUtf8StringViewFromSchema(Object, Id, 0);
+}
+
 inline bool GetBoolFromSchema(const Schema_Object* Object, Schema_FieldId Id)
 {
 	return !!Schema_GetBool(Object, Id);
@@ -66,6 +97,17 @@ inline TArray<uint8> GetBytesFromSchema(const Schema_Object* Object, Schema_Fiel
 	return IndexBytesFromSchema(Object, Id, 0);
 }
 
+// Views of bytes fields, for reading them without copying. They point into the schema object and must not outlive it.
+inline TArrayView<const uint8> IndexBytesViewFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
+{
+	return TArrayView<const uint8>((const uint8*)Schema_IndexBytes(Object, Id, Index), (int32)Schema_IndexBytesLength(Object, Id, Index));
+}
+
+inline TArrayView<const uint8> GetBytesViewFromSchema(const Schema_Object* Object, Schema_FieldId Id)
+{
+	return IndexBytesViewFromSchema(Object, Id, 0);
+}
+
 inline void AddWorkerRequirementSetToSchema(Schema_Object* Object, Schema_FieldId Id, const WorkerRequirementSet& Value)
 {
 	Schema_Object* RequirementSetObject = Schema_AddObject(Object, Id);
@@ -98,10 +140,10 @@ inline WorkerRequirementSet IndexWorkerRequirementSetFromSchema(Schema_Object* O
 
 		for (int32 j = 0; j < AttributeCount; j++)
 		{
-			AttributeSet.Add(IndexStringFromSchema(AttributeSetObject, 1, j));
+			IndexStringFromSchema(AttributeSetObject, 1, j, AttributeSet.AddDefaulted_GetRef());
 		}
 
-		RequirementSet.Add(AttributeSet);
+		RequirementSet.Add(MoveTemp(AttributeSet));
 	}
 
 	return RequirementSet;
@@ -122,7 +164,7 @@ inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const
 	Schema_AddUint32(ObjectRefObject, UNREAL_OBJECT_REF_OFFSET_ID, ObjectRef.Offset);
 	if (ObjectRef.Path)
 	{
-		AddStringToSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID, *ObjectRef.Path);
+		AddStringToSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID, ObjectRef.Path->ToString());
 		Schema_AddBool(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID, ObjectRef.bNoLoadOnClient);
 	}
 	if (ObjectRef.Outer)
@@ -149,7 +191,7 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	ObjectRef.Offset = Schema_GetUint32(ObjectRefObject, UNREAL_OBJECT_REF_OFFSET_ID);
 	if (Schema_GetObjectCount(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID) > 0)
 	{
-		ObjectRef.Path = GetStringFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID);
+		ObjectRef.Path = FUnrealObjectRefPath(GetStringFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID));
 	}
 	if (Schema_GetBoolCount(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID) > 0)
 	{
@@ -20,6 +20,7 @@
 class APawn;
 class APlayerController;
 class APlayerState;
+class UAbstractLBStrategy;
 class USpatialNetDriver;
 class UFont;
 class UTexture2D;
@@ -35,6 +36,7 @@ DECLARE_CYCLE_STAT(TEXT("DrawIcons"), STAT_DrawIcons, STATGROUP_SpatialDebugger)
 DECLARE_CYCLE_STAT(TEXT("DrawText"), STAT_DrawText, STATGROUP_SpatialDebugger);
 DECLARE_CYCLE_STAT(TEXT("BuildText"), STAT_BuildText, STATGROUP_SpatialDebugger);
 DECLARE_CYCLE_STAT(TEXT("SortingActors"), STAT_SortingActors, STATGROUP_SpatialDebugger);
+DECLARE_CYCLE_STAT(TEXT("GatherTags"), STAT_GatherTags, STATGROUP_SpatialDebugger);
 
 USTRUCT()
 struct FWorkerRegionInfo
@@ -46,6 +48,19 @@ struct FWorkerRegionInfo
 
 	UPROPERTY()
 	FBox2D Extents;
+
+	UPROPERTY()
+	uint32 VirtualWorker = 0;
+};
+
+UENUM()
+enum class EWorkerLoadHeatmapMetric : uint8
+{
+	EntityCount,
+	FrameTime,
+	OpsReceived,
+	MessagesSent,
+	RPCsSent
 };
 
 UCLASS(SpatialType=(NotPersistent), Blueprintable, NotPlaceable)
@@ -76,6 +91,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = General, meta = (ToolTip = "Maximum range from local player that tags will be drawn out to"))
 	float MaxRange = 100.0f * 100.0f; // 100m
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = General, meta = (ToolTip = "Seconds between finding the entities in range and in view to draw tags for. Tags follow their actors every frame", ClampMin = "0.0"))
+	float TagGatherInterval = 0.1f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Visualization, meta = (ToolTip = "Show server authority for every entity in range"))
 	bool bShowAuth = false;
 
@@ -97,6 +115,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Visualization, meta = (ToolTip = "Show a transparent Worker Region cuboid representing the area of authority for each server worker"))
 	bool bShowWorkerRegions = false;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Visualization, meta = (ToolTip = "Color each Worker Region by the load its server worker reports to the Spatial Metrics Display, from green for the least loaded to red for the most loaded"))
+	bool bShowWorkerLoadHeatmap = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Visualization, meta = (ToolTip = "The load metric the Worker Region heatmap shows", EditCondition = "bShowWorkerLoadHeatmap"))
+	EWorkerLoadHeatmapMetric WorkerLoadHeatmapMetric = EWorkerLoadHeatmapMetric::FrameTime;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Visualization, meta = (ToolTip = "Texture to use for the Auth Icon"))
 	UTexture2D *AuthTexture;
 
@@ -140,11 +164,31 @@ private:
 	// FDebugDrawDelegate
 	void DrawDebug(UCanvas* Canvas, APlayerController* Controller);
 
-	void DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FString& ActorName);
+	// The data shown in an entity's tag, copied from its SpatialDebugging component when the tags are gathered.
+	struct FEntityTag
+	{
+		Worker_EntityId EntityId;
+		TWeakObjectPtr<AActor> Actor;
+		FString ActorName;
+		VirtualWorkerId AuthoritativeVirtualWorkerId;
+		FColor AuthoritativeColor;
+		VirtualWorkerId IntentVirtualWorkerId;
+		FColor IntentColor;
+		bool bIsLocked;
+	};
+
+	// Returns false if the entity has no SpatialDebugging component.
+	bool GetEntityTag(const Worker_EntityId EntityId, AActor* Actor, FEntityTag& OutTag) const;
+	void GatherEntityTags(UCanvas* Canvas);
+
+	void DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const FEntityTag& Tag);
 	void DrawDebugLocalPlayer(UCanvas* Canvas);
 
+	// Fills WorkerRegions from the regions of the strategy used for visual rendering.
+	void UpdateWorkerRegions(const UAbstractLBStrategy& VisualStrategy);
 	void CreateWorkerRegions();
 	void DestroyWorkerRegions();
+	void UpdateWorkerLoadHeatmap();
 
 	FColor GetTextColorForBackgroundColor(const FColor& BackgroundColor) const;
 	int32 GetNumberOfDigitsIn(int32 SomeNumber) const;
@@ -168,6 +212,17 @@ private:
 	// Mapping of the entities a client has checked out
 	TMap<Worker_EntityId_Key, TWeakObjectPtr<AActor>> EntityActorMapping;
 
+	// Index aligned with WorkerRegions while they are shown.
+	UPROPERTY()
+	TArray<AWorkerRegion*> WorkerRegionActors;
+
+	// The regions version of the strategy used for visual rendering when WorkerRegions were last filled.
+	uint32 WorkerRegionsVersion = 0;
+
+	// The entities in range and in view when the tags were last gathered.
+	TArray<FEntityTag> EntityTags;
+	double LastTagGatherTime = 0.0;
+
 	FDelegateHandle DrawDebugDelegateHandle;
 	FDelegateHandle OnEntityAddedHandle;
 	FDelegateHandle OnEntityRemovedHandle;
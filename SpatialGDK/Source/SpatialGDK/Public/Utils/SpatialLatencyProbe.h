@@ -0,0 +1,133 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Utils/LatencySamples.h"
+#include "Utils/SpatialLatencyPayload.h"
+
+#include "SpatialLatencyProbe.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialLatencyProbe, Log, All);
+
+class APlayerController;
+
+USTRUCT()
+struct FSpatialLatencyProbeState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ProbeId = 0;
+
+	// Junk bytes rewritten with every probe, see LoadPropertyBytes.
+	UPROPERTY()
+	TArray<uint8> Load;
+};
+
+/*
+ Continuously measures client to server to client latency for a latency regression scenario, both as an RPC round trip and as an RPC
+ to the server answered by a replicated property, under a configurable amount of extra load. Percentiles of both are appended as
+ JSON lines to Saved/Automation/GDKLatency.jsonl, tagged with the scenario and the build version, so they can be compared across builds.
+
+ The server spawns one for each player with SpawnForPlayer, e.g. from the PostLogin of the test map's game mode, and the owning client
+ does the measuring. Every time is taken on the client, so there is no clock skew between workers. With bUseLatencyTracer, each RPC
+ round trip is also traced through USpatialLatencyTracer to show which part of it the time went to.
+ */
+UCLASS(SpatialType, Blueprintable)
+class SPATIALGDK_API ASpatialLatencyProbe : public AInfo
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	// The name the results are reported under, e.g. the test map and the load it was run with.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = LatencyProbe)
+	FString ScenarioName = TEXT("Default");
+
+	// The time, in seconds, between probes. Probes are sent without waiting for the reply to the previous one.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = LatencyProbe)
+	float ProbeInterval = 0.1f;
+
+	// The time, in seconds, after which a probe without a reply counts as lost.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = LatencyProbe)
+	float TimeoutLimit = 4.0f;
+
+	// The time, in seconds, between reports. Reports are also written when the probe stops, and 0 only reports then.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = LatencyProbe)
+	float ReportInterval = 60.0f;
+
+	// The number of unreliable RPCs of LoadRPCBytes the client sends to the server with every probe.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "LatencyProbe|Load")
+	int32 LoadRPCsPerProbe = 0;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "LatencyProbe|Load")
+	int32 LoadRPCBytes = 64;
+
+	// The number of bytes of the replicated property the server rewrites with every probe.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "LatencyProbe|Load")
+	int32 LoadPropertyBytes = 0;
+
+	// Trace every RPC round trip with USpatialLatencyTracer, which needs it to be registered with a project.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = LatencyProbe)
+	bool bUseLatencyTracer = false;
+
+	// Spawns a probe owned by Controller. Only does anything on the server.
+	UFUNCTION(BlueprintCallable, Category = "SpatialGDK|LatencyProbe")
+	static ASpatialLatencyProbe* SpawnForPlayer(APlayerController* Controller, TSubclassOf<ASpatialLatencyProbe> ProbeClass);
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	// Writes the percentiles measured since the last report and starts measuring anew. Only does anything on the owning client.
+	UFUNCTION(BlueprintCallable, Category = "SpatialGDK|LatencyProbe")
+	void WriteLatencyReport();
+
+	const SpatialGDK::FLatencySamples& GetRPCRoundTrips() const { return RPCRoundTrips; }
+	const SpatialGDK::FLatencySamples& GetPropertyRoundTrips() const { return PropertyRoundTrips; }
+
+	static FString GetResultsFilePath();
+
+private:
+	bool IsOwningClient() const;
+
+	void SendProbe();
+	void OnProbeReply(int32 ProbeId, bool bIsRPCReply);
+	void RemoveTimedOutProbes(double Now);
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerProbe(int32 ProbeId, const FSpatialLatencyPayload& Payload);
+
+	UFUNCTION(Client, Reliable)
+	void ClientProbeReply(int32 ProbeId, const FSpatialLatencyPayload& Payload);
+
+	UFUNCTION(Server, Unreliable, WithValidation)
+	void ServerLoad(const TArray<uint8>& Load);
+
+	UFUNCTION()
+	void OnRep_ProbeState();
+
+	UPROPERTY(ReplicatedUsing = OnRep_ProbeState)
+	FSpatialLatencyProbeState ProbeState;
+
+	struct FPendingProbe
+	{
+		double SentTime;
+		bool bHasRPCReply;
+		bool bHasPropertyReply;
+	};
+
+	int32 LastProbeId = 0;
+	TMap<int32, FPendingProbe> PendingProbes;
+
+	double TimeWhenProbeLastSent = 0.0;
+	double TimeWhenLastReported = 0.0;
+
+	SpatialGDK::FLatencySamples RPCRoundTrips;
+	SpatialGDK::FLatencySamples PropertyRoundTrips;
+	int32 LostRPCReplies = 0;
+	int32 LostPropertyReplies = 0;
+
+	TArray<uint8> LoadBytes;
+};
@@ -6,6 +6,7 @@
 
 #include "SpatialConstants.h"
 #include "Containers/Map.h"
+#include "Containers/Queue.h"
 #include "Containers/StaticArray.h"
 #include "SpatialLatencyPayload.h"
 
@@ -123,6 +124,9 @@ public:
 	// Internal GDK usage, shouldn't be used by game code
 	static USpatialLatencyTracer* GetTracer(UObject* WorldContextObject);
 
+	// Queued trace events are written after they happened, so the keyframe's description records how long before it they happened.
+	static FString DescribeQueuedTraceEvent(const TCHAR* TraceDesc, double EventTime, double WriteTime);
+
 #if TRACE_LIB_ACTIVE
 
 	bool IsValidKey(TraceKey Key);
@@ -139,9 +143,13 @@ public:
 	void SetWorkerId(const FString& NewWorkerId) { WorkerId = NewWorkerId; }
 	void ResetWorkerId();
 
+	// These can be called from any thread. They only queue the trace events, which are written on the game thread by FlushPendingTraceEvents.
 	void OnEnqueueMessage(const SpatialGDK::FOutgoingMessage*);
 	void OnDequeueMessage(const SpatialGDK::FOutgoingMessage*);
 
+	// Writes the trace events queued by OnEnqueueMessage and OnDequeueMessage. Called once per tick on the game thread.
+	void FlushPendingTraceEvents();
+
 private:
 
 	using ActorFuncKey = TPair<const AActor*, const UFunction*>;
@@ -149,6 +157,21 @@ private:
 	using ActorTagKey = TPair<const AActor*, FString>;
 	using TraceSpan = improbable::trace::Span;
 
+	struct FPendingTraceEvent
+	{
+		TraceKey Key;
+		// Always a string literal, so queuing an event doesn't allocate.
+		const TCHAR* TraceDesc;
+		bool bEndTrace;
+		// FPlatformTime::Seconds() when the event was queued.
+		double EventTime;
+	};
+
+	void QueueTraceEvent(const TraceKey Key, const TCHAR* TraceDesc, bool bEndTrace);
+	void FlushPendingTraceEvents_Locked();
+
+	bool ShouldSampleNewTrace() const;
+
 	bool BeginLatencyTrace_Internal(const FString& TraceDesc, FSpatialLatencyPayload& OutLatencyPayload);
 	bool ContinueLatencyTrace_Internal(const AActor* Actor, const FString& Target, ETraceType::Type Type, const FString& TraceDesc, const FSpatialLatencyPayload& LatencyPayload, FSpatialLatencyPayload& OutLatencyPayload);
 	bool EndLatencyTrace_Internal(const FSpatialLatencyPayload& LatencyPayload);
@@ -168,6 +191,16 @@ private:
 
 	TraceKey NextTraceKey = 1;
 
+	float SampleRate = 1.0f;
+
+	// Number of entries in TrackingRPCs, TrackingProperties and TrackingTags. Read without the mutex so that looking up a pending trace
+	// for every replicated property and RPC costs nothing while no trace is being continued.
+	TAtomic<int32> NumTrackedTargets{ 0 };
+
+	// Trace events from the connection thread, queued so that it never waits on the mutex below.
+	TQueue<FPendingTraceEvent, EQueueMode::Mpsc> PendingTraceEvents;
+	TAtomic<int32> NumPendingTraceEvents{ 0 };
+
 	FCriticalSection Mutex; // This mutex is to protect modifications to the containers below
 
 	TMap<ActorFuncKey, TraceKey> TrackingRPCs;
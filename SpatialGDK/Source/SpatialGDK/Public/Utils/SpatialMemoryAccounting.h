@@ -0,0 +1,53 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialMemoryAccounting, Log, All);
+
+enum class ESpatialMemorySubsystem : uint8
+{
+	StaticComponentView,
+	ReceiverPendingState,
+	RPCContainers,
+	RPCRingBuffers,
+	NetGUIDCache,
+	ActorChannelShadowData,
+	SenderOutgoingQueues,
+
+	Count
+};
+
+namespace SpatialGDK
+{
+
+/**
+ * Current and peak bytes held by each GDK subsystem, as sampled by USpatialNetDriver::SampleMemoryUsage.
+ *
+ * The sizes are those of the containers each subsystem owns and the buffers they point to directly, so they are a lower bound of what
+ * the subsystem holds. Memory allocated by the engine or the worker SDK on the GDK's behalf is not included. Peaks are only as accurate
+ * as the sampling interval, see USpatialGDKSettings::MemoryAccountingSampleIntervalSeconds.
+ */
+class SPATIALGDK_API FSpatialMemoryAccounting
+{
+public:
+	void Record(ESpatialMemorySubsystem Subsystem, SIZE_T Bytes);
+	void ResetPeaks();
+
+	SIZE_T GetCurrentBytes(ESpatialMemorySubsystem Subsystem) const { return CurrentBytes[static_cast<int32>(Subsystem)]; }
+	SIZE_T GetPeakBytes(ESpatialMemorySubsystem Subsystem) const { return PeakBytes[static_cast<int32>(Subsystem)]; }
+	SIZE_T GetTotalCurrentBytes() const;
+
+	void LogReport() const;
+
+	static const TCHAR* GetSubsystemName(ESpatialMemorySubsystem Subsystem);
+
+private:
+	static constexpr int32 NumSubsystems = static_cast<int32>(ESpatialMemorySubsystem::Count);
+
+	SIZE_T CurrentBytes[NumSubsystems] = {};
+	SIZE_T PeakBytes[NumSubsystems] = {};
+};
+
+} // namespace SpatialGDK
@@ -5,6 +5,11 @@
 #include "CoreMinimal.h"
 
 #include "SpatialConstants.h"
+#include "Utils/AtomicHistogram.h"
+#include "Utils/BandwidthAccounting.h"
+#include "Utils/HotEntityTracker.h"
+#include "Utils/PrometheusMetricsEndpoint.h"
+#include "Utils/WorkerLoadVector.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -31,6 +36,8 @@ public:
 
 	double GetAverageFPS() const { return AverageFPS; }
 	double GetWorkerLoad() const { return WorkerLoad; }
+	// What the load of a server worker is made of, measured every report when bReportWorkerLoadVector is enabled.
+	const SpatialGDK::FWorkerLoadVector& GetWorkerLoadVector() const { return WorkerLoadVector; }
 
 	UFUNCTION(Exec)
 	void SpatialStartRPCMetrics();
@@ -40,11 +47,26 @@ public:
 	void SpatialStopRPCMetrics();
 	void OnStopRPCMetricsCommand();
 
+	UFUNCTION(Exec)
+	void SpatialStartBandwidthMetrics();
+
+	UFUNCTION(Exec)
+	void SpatialStopBandwidthMetrics();
+
 	UFUNCTION(Exec)
 	void SpatialModifySetting(const FString& Name, float Value);
 	void OnModifySettingCommand(Schema_Object* CommandPayload);
 
 	void TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize);
+	void TrackReceivedOps(uint32 NumOps) { ReceivedOpCount += NumOps; }
+	// Reported once per batch of received RPCs, see USpatialReceiver::BeginIncomingRPCBatch.
+	void TrackReceivedRPCs(uint32 NumRPCs) { ReceivedRPCCount += NumRPCs; ReceivedRPCBatchCount++; }
+
+	// Totals since the worker started, always counted so load can be reported as rates.
+	uint64 GetSentRPCCount() const { return SentRPCCount; }
+	uint64 GetReceivedOpCount() const { return ReceivedOpCount; }
+	uint64 GetReceivedRPCCount() const { return ReceivedRPCCount; }
+	uint64 GetReceivedRPCBatchCount() const { return ReceivedRPCBatchCount; }
 
 	void HandleWorkerMetrics(Worker_Op* Op);
 
@@ -53,14 +75,44 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(WorkerMetricsDelegate, WorkerMetrics);
 	static WorkerMetricsDelegate WorkerMetricsRecieved;
 
+	// The latest value of every metric the Worker SDK has reported, which include the network statistics of this worker's connection.
+	const WorkerMetrics& GetLatestWorkerSDKMetrics() const { return LatestWorkerSDKMetrics; }
+
+	// Logs the latest metrics the Worker SDK reported, such as the bandwidth and retransmissions of this worker's connection.
+	UFUNCTION(Exec)
+	void SpatialLogNetworkStatistics();
+
+	// Logs the Count entities with the highest rate of sent updates, sent RPCs and received ops, with bEnableHotEntityTracking.
+	UFUNCTION(Exec)
+	void SpatialHotEntities(int32 Count = 10);
+
+	void SetHotEntityTracker(const SpatialGDK::FHotEntityTracker* InHotEntityTracker) { HotEntityTracker = InHotEntityTracker; }
+
 	// Delegate used to poll for the current player controller's reference
 	DECLARE_DELEGATE_RetVal(FUnrealObjectRef, FControllerRefProviderDelegate);
 	FControllerRefProviderDelegate ControllerRefProvider;
 
+	// Delegate used to find the class of the actor an entity was sent for, when aggregating sent bytes per class.
+	DECLARE_DELEGATE_RetVal_OneParam(FString, FEntityClassNameProviderDelegate, Worker_EntityId);
+	FEntityClassNameProviderDelegate EntityClassNameProvider;
+
+	// Delegate used to count the entities this worker is authoritative over, for the load vector.
+	DECLARE_DELEGATE_RetVal(uint32, FAuthoritativeEntityCountProviderDelegate);
+	FAuthoritativeEntityCountProviderDelegate AuthoritativeEntityCountProvider;
+
 	void SetWorkerLoadDelegate(const UserSuppliedMetric& Delegate) { WorkerLoadDelegate = Delegate; }
 	void SetCustomMetric(const FString& Metric, const UserSuppliedMetric& Delegate);
 	void RemoveCustomMetric(const FString& Metric);
+
+	// Registers a histogram reported with the other metrics every MetricsReportRate seconds. The returned histogram is owned by
+	// USpatialMetrics and can be recorded into from any thread. Registering an existing key returns the existing histogram.
+	SpatialGDK::FAtomicHistogram& AddHistogramMetric(const FString& Metric, const TArray<double>& UpperBounds);
+
+	// Records the size of a handover component update into a histogram per object class.
+	void RecordHandoverBytes(const UClass& Class, uint32 Bytes);
 private:
+	void ConsumeSentBandwidth();
+	void UpdateWorkerLoadVector();
 
 	UPROPERTY()
 	USpatialWorkerConnection* Connection;
@@ -77,7 +129,25 @@ private:
 	double WorkerLoad;
 	UserSuppliedMetric WorkerLoadDelegate;
 
+	SpatialGDK::FWorkerLoadVector WorkerLoadVector;
+	uint64 ReceivedOpCountAtLastReport = 0;
+	uint64 QueuedOutgoingByteCountAtLastReport = 0;
+
+	// Only created on server workers with a PrometheusMetricsPort.
+	TUniquePtr<SpatialGDK::FPrometheusMetricsEndpoint> PrometheusMetricsEndpoint;
+
 	TMap<FString, UserSuppliedMetric> UserSuppliedMetrics;
+	WorkerMetrics LatestWorkerSDKMetrics;
+
+	TMap<FString, TUniquePtr<SpatialGDK::FAtomicHistogram>> HistogramMetrics;
+	SpatialGDK::FAtomicHistogram* FrameTimeHistogram;
+	SpatialGDK::FAtomicHistogram* OutgoingMessageQueueDepthHistogram;
+	// Indexed by EOutgoingMessageLane, only filled when the connection uses priority lanes.
+	TArray<SpatialGDK::FAtomicHistogram*> OutgoingMessageLaneDepthHistograms;
+	TMap<FName, SpatialGDK::FAtomicHistogram*> HandoverBytesHistograms;
+
+	// Owned by the net driver.
+	const SpatialGDK::FHotEntityTracker* HotEntityTracker = nullptr;
 
 	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
 	// console command. It will record every sent RPC as well as the size of its payload, and then display
@@ -91,7 +161,18 @@ private:
 		int TotalPayload;
 	};
 	TMap<FString, RPCStat> RecentRPCs;
+	uint64 SentRPCCount = 0;
+	uint64 ReceivedOpCount = 0;
+	uint64 ReceivedRPCCount = 0;
+	uint64 ReceivedRPCBatchCount = 0;
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
+
+	// Bandwidth tracking is activated with "SpatialStartBandwidthMetrics" and stopped with "SpatialStopBandwidthMetrics".
+	// It records the bytes of every component data and update sent by this worker, per component, per actor class and,
+	// from sent RPC payloads, per RPC function. Stopping logs the largest entries and writes all of them to a CSV file.
+	SpatialGDK::FBandwidthReport BandwidthReport;
+	bool bBandwidthTrackingEnabled;
+	double BandwidthTrackingStartTime;
 };
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Containers/Queue.h"
 #include "GameFramework/Info.h"
+#include "Utils/WorkerLoadHistory.h"
 
 #include "SpatialMetricsDisplay.generated.h"
 
@@ -23,6 +24,16 @@ struct FWorkerStats
 	int32 ServerConsiderListSize;
 	UPROPERTY()
 	uint32 ServerReplicationLimit;
+	UPROPERTY()
+	uint32 VirtualWorker;
+	UPROPERTY()
+	int32 EntityCount;
+	UPROPERTY()
+	float OpsReceivedPerSecond;
+	UPROPERTY()
+	float MessagesSentPerSecond;
+	UPROPERTY()
+	float RPCsSentPerSecond;
 
 	bool operator==(const FWorkerStats& other) const
 	{
@@ -46,6 +57,13 @@ public:
 	UFUNCTION(Exec, Category = "SpatialGDK", BlueprintCallable)
 	void SpatialToggleStatDisplay();
 
+	// Writes the load history of every server worker to the profiling directory, as CSV or, if Format is "json", as JSON.
+	// Only the server worker with authority over this actor aggregates the history.
+	UFUNCTION(Exec, Category = "SpatialGDK", BlueprintCallable)
+	void SpatialExportWorkerLoad(const FString& Format);
+
+	const TArray<FWorkerStats>& GetWorkerStats() const { return WorkerStats; }
+
 private:
 
 	FDelegateHandle DrawDebugDelegateHandle;
@@ -60,6 +78,11 @@ private:
 
 	const uint32 DropStatsIfNoUpdateForTime = 10; // seconds
 
+	const float LoadSampleInterval = 1.f; // seconds
+
+	SpatialGDK::FWorkerLoadHistory LoadHistory;
+	TMap<FString, float> WorkerLoadLastSampleTime;
+
 	UFUNCTION(CrossServer, Unreliable, WithValidation)
 	virtual void ServerUpdateWorkerStats(const float Time, const FWorkerStats& OneWorkerStats);
 
@@ -72,4 +95,21 @@ private:
 		float Time;
 	};
 	TQueue<MovementCorrectionRecord> MovementCorrectionRecords;
+
+	// The running totals at the last load sample of this worker, to report the rates since.
+	struct LoadCountersRecord
+	{
+		uint64 ReceivedOps;
+		uint64 QueuedMessages;
+		uint64 SentRPCs;
+		float Time;
+	};
+	TOptional<LoadCountersRecord> LastLoadCounters;
+	float OpsReceivedPerSecond = 0.f;
+	float MessagesSentPerSecond = 0.f;
+	float RPCsSentPerSecond = 0.f;
+
+	void UpdateLoadRates(const class USpatialNetDriver& SpatialNetDriver, const float WorldTime);
+	void RecordLoadSample(const float Time, const FWorkerStats& OneWorkerStats);
+	void UpdateLoadHistoryCells(const class USpatialNetDriver& SpatialNetDriver);
 };
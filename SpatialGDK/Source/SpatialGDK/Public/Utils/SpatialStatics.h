@@ -13,6 +13,7 @@
 #include "SpatialStatics.generated.h"
 
 class AActor;
+class USpatialActorChannel;
 
 // This log category will always log to the spatial runtime and thus also be printed in the SpatialOutput.
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatial, Log, All);
@@ -106,8 +107,24 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SpatialOS")
 	static FString GetActorEntityIdAsString(const AActor* Actor);
 
+	/**
+	 * Opts a replicating actor in or out of push model replication. Requires bEnablePushModelReplication in the SpatialOS runtime settings.
+	 * While enabled, changes to the actor's replicated properties are only sent after MarkActorPropertiesDirty is called.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SpatialOS")
+	static void SetPushModelEnabled(const AActor* Actor, bool bEnabled);
+
+	/**
+	 * Marks the replicated properties of an actor using push model replication as dirty, so they are compared and sent on its next update.
+	 * Call this after changing a replicated property on the actor or on any of its replicated subobjects.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SpatialOS")
+	static void MarkActorPropertiesDirty(const AActor* Actor);
+
 
 private:
 
 	static FName GetCurrentWorkerType(const UObject* WorldContext);
+
+	static USpatialActorChannel* GetActorChannel(const AActor* Actor);
 };
@@ -0,0 +1,27 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialThreadPolicy, Log, All);
+
+class FRunnableThread;
+struct FSpatialThreadPolicy;
+
+namespace SpatialGDK
+{
+
+// Creates a GDK thread with the policy USpatialGDKSettings::ThreadPolicies sets for ThreadName, and logs the stack size, priority and
+// cores it ends up with. DefaultPriority is used when the policy doesn't set one. Busy polling is left to the runnable, which reads
+// FSpatialThreadPolicy::bBusyPoll itself; bSupportsBusyPoll only decides whether setting it for this thread is warned about.
+SPATIALGDK_API FRunnableThread* CreateThreadWithPolicy(FRunnable* Runnable, const TCHAR* ThreadName, EThreadPriority DefaultPriority = TPri_Normal,
+	bool bSupportsBusyPoll = false);
+
+// The affinity mask of the cores, leaving out the ones outside [0, NumCores). 0 if none are left.
+SPATIALGDK_API uint64 GetThreadAffinityMask(const TArray<int32>& Cores, int32 NumCores);
+
+SPATIALGDK_API EThreadPriority GetThreadPriority(const FSpatialThreadPolicy& Policy, EThreadPriority DefaultPriority);
+
+} // namespace SpatialGDK
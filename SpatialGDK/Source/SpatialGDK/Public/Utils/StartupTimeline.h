@@ -0,0 +1,37 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialStartupTimeline, Log, All);
+
+namespace SpatialGDK
+{
+
+/**
+ * Records when each phase of a worker's startup finishes, so the time between starting the net driver and being able to
+ * accept players can be broken down in the logs. Each phase is only recorded the first time it's reached.
+ */
+class SPATIALGDK_API FStartupTimeline
+{
+public:
+	void Start();
+	void MarkPhase(const TCHAR* PhaseName);
+	bool HasPhase(const TCHAR* PhaseName) const;
+
+	// Logs every recorded phase with its offset from Start and the time since the previous phase.
+	void LogTimeline(const FString& WorkerDescription) const;
+
+private:
+	struct FPhase
+	{
+		FString Name;
+		double Time;
+	};
+
+	double StartTime = 0.0;
+	TArray<FPhase> Phases;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,47 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Stats/Stats.h"
+#include "Utils/HitchCapture.h"
+
+#if ENGINE_MINOR_VERSION >= 25
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+/**
+ * Frame time of each GDK subsystem, for attributing server frame time to the GDK.
+ * SPATIALGDK_SUBSYSTEM_SCOPE(Name) records the enclosing scope as the cycle stat STAT_SpatialGDK<Name> in the "SpatialGDK Subsystems"
+ * stat group, the CSV profiler timing stat SpatialGDK/<Name> and, from 4.25, the trace CPU profiler event SpatialGDK_<Name>.
+ * While a SpatialGDK::FHitchCapture exists, the scope is also added to the time of the subsystem in the current hitch capture frame.
+ * Each only costs a check of whether it is enabled when stats, CSV capture, tracing or hitch capture are off.
+ * Per-frame CSVs are captured with the CSV profiler, e.g. the `csvprofile start` and `csvprofile stop` console commands.
+ */
+DECLARE_STATS_GROUP(TEXT("SpatialGDK Subsystems"), STATGROUP_SpatialGDKSubsystems, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TickDispatch"), STAT_SpatialGDKTickDispatch, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CriticalSection"), STAT_SpatialGDKCriticalSection, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ReplicateActor"), STAT_SpatialGDKReplicateActor, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ComponentFactory"), STAT_SpatialGDKComponentFactory, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RPCServiceFlush"), STAT_SpatialGDKRPCServiceFlush, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("InterestUpdate"), STAT_SpatialGDKInterestUpdate, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LoadBalanceEnforcement"), STAT_SpatialGDKLoadBalanceEnforcement, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ConnectionReceive"), STAT_SpatialGDKConnectionReceive, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ConnectionSend"), STAT_SpatialGDKConnectionSend, STATGROUP_SpatialGDKSubsystems, SPATIALGDK_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SPATIALGDK_API, SpatialGDK);
+
+#if ENGINE_MINOR_VERSION >= 25
+#define SPATIALGDK_SUBSYSTEM_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(SpatialGDK_##Name)
+#else
+#define SPATIALGDK_SUBSYSTEM_TRACE_SCOPE(Name)
+#endif
+
+#define SPATIALGDK_SUBSYSTEM_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_SpatialGDK##Name); \
+	CSV_SCOPED_TIMING_STAT(SpatialGDK, Name); \
+	SPATIALGDK_SUBSYSTEM_TRACE_SCOPE(Name); \
+	SpatialGDK::FHitchCaptureSubsystemScope HitchCaptureScope_##Name(SpatialGDK::EGDKSubsystem::Name)
@@ -0,0 +1,61 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Box2D.h"
+#include "SpatialCommonTypes.h"
+
+namespace SpatialGDK
+{
+
+struct FWorkerLoadSample
+{
+	double Time = 0.0;
+	int32 EntityCount = 0;
+	float FrameTimeMs = 0.f;
+	float OpsReceivedPerSecond = 0.f;
+	float MessagesSentPerSecond = 0.f;
+	float RPCsSentPerSecond = 0.f;
+};
+
+/**
+ * The most recent load samples reported by each server worker, with the load balancing grid cell of each worker's virtual worker
+ * when it is known. Filled by the worker aggregating ASpatialMetricsDisplay stats and written out as CSV or JSON.
+ */
+class SPATIALGDK_API FWorkerLoadHistory
+{
+public:
+	static constexpr int32 DefaultMaxSamplesPerWorker = 600;
+
+	explicit FWorkerLoadHistory(int32 InMaxSamplesPerWorker = DefaultMaxSamplesPerWorker);
+
+	// Drops the oldest sample of the worker once it has MaxSamplesPerWorker samples.
+	void AddSample(const FString& WorkerName, VirtualWorkerId InVirtualWorkerId, const FWorkerLoadSample& Sample);
+	void RemoveWorker(const FString& WorkerName);
+
+	void SetCell(VirtualWorkerId InVirtualWorkerId, const FBox2D& Extents);
+
+	// Returns nullptr if the worker has not reported any samples.
+	const TArray<FWorkerLoadSample>* GetSamples(const FString& WorkerName) const;
+
+	// One row per sample: Worker,VirtualWorkerId,CellMinX,CellMinY,CellMaxX,CellMaxY,Time,EntityCount,FrameTimeMs,OpsIn,OpsOut,RPCs.
+	// The cell columns are empty for workers without a known cell.
+	FString ToCsv() const;
+
+	// An array of workers, each with its cell, if known, and an array of samples.
+	FString ToJson() const;
+
+private:
+	struct FWorkerSeries
+	{
+		VirtualWorkerId VirtualWorker;
+		TArray<FWorkerLoadSample> Samples;
+	};
+
+	int32 MaxSamplesPerWorker;
+	TMap<FString, FWorkerSeries> Workers;
+	TMap<VirtualWorkerId, FBox2D> Cells;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,49 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+
+enum class EWorkerLoadDimension : uint8
+{
+	FrameTime,
+	AuthoritativeEntities,
+	OutgoingBytes,
+	IncomingOps,
+	Memory
+};
+
+// The usage each dimension of a worker's load is measured against. Dimensions with a budget of zero or less aren't counted.
+struct FWorkerLoadBudget
+{
+	double AuthoritativeEntities = 0.0;
+	double OutgoingBytesPerSecond = 0.0;
+	double IncomingOpsPerSecond = 0.0;
+	double MemoryUsedMB = 0.0;
+};
+
+// What a server worker is busy with, measured over a metrics report interval, so load balancing can tell which limit a worker is near.
+struct SPATIALGDK_API FWorkerLoadVector
+{
+	// The load from frame time alone, as USpatialMetrics::CalculateLoad returns it.
+	double FrameTimeLoad = 0.0;
+	uint32 AuthoritativeEntityCount = 0;
+	double OutgoingBytesPerSecond = 0.0;
+	double IncomingOpsPerSecond = 0.0;
+	double MemoryUsedMB = 0.0;
+
+	// The load of the dimension the worker is closest to the limit of, with OutDimension set to that dimension if given.
+	double GetBottleneckLoad(const FWorkerLoadBudget& Budget, EWorkerLoadDimension* OutDimension = nullptr) const;
+
+	void WriteToSchema(Schema_Object* Object) const;
+	static FWorkerLoadVector ReadFromSchema(const Schema_Object* Object);
+
+	static const TCHAR* GetDimensionName(EWorkerLoadDimension Dimension);
+};
+
+} // namespace SpatialGDK
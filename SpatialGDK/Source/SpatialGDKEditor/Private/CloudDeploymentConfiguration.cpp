@@ -31,6 +31,7 @@ void FCloudDeploymentConfiguration::InitFromSettings()
 	BuildConfiguration = Settings->GetAssemblyBuildConfiguration().ToString();
 	bBuildClientWorker = Settings->IsBuildClientWorkerEnabled();
 	bForceAssemblyOverwrite = Settings->IsForceAssemblyOverwriteEnabled();
+	bSkipUnchangedAssemblyUpload = Settings->bSkipUnchangedAssemblyUpload;
 
 	BuildServerExtraArgs = Settings->BuildServerExtraArgs;
 	BuildClientExtraArgs = Settings->BuildClientExtraArgs;
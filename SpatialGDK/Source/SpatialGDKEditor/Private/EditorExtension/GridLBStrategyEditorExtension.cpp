@@ -3,6 +3,7 @@
 #include "GridLBStrategyEditorExtension.h"
 #include "SpatialGDKEditorSettings.h"
 #include "SpatialRuntimeLoadBalancingStrategies.h"
+#include "Utils/GridLoadProfile.h"
 
 class UGridBasedLBStrategy_Spy : public UGridBasedLBStrategy
 {
@@ -27,3 +28,25 @@ bool FGridLBStrategyEditorExtension::GetDefaultLaunchConfiguration(const UGridBa
 
 	return true;
 }
+
+bool FGridLBStrategyEditorExtension::ApplyLoadBasedLayout(UGridBasedLBStrategy* StrategyDefaults, const FGridLoadProfile& Profile, uint32 MaxWorkers, float TargetLoadPerWorker)
+{
+	UGridBasedLBStrategy_Spy* StrategySpy = static_cast<UGridBasedLBStrategy_Spy*>(StrategyDefaults);
+
+	const FGridLayoutProposal Proposal = ProposeGridLayout(Profile, StrategySpy->WorldWidth, StrategySpy->WorldHeight, StrategySpy->Rows * StrategySpy->Cols, MaxWorkers, TargetLoadPerWorker);
+
+	UE_LOG(LogSpatialGDKEditorLBExtension, Log, TEXT("Proposed %u rows and %u columns for %s, the busiest cell has a load of %.1f out of %.1f."),
+		Proposal.Rows, Proposal.Cols, *StrategyDefaults->GetClass()->GetName(), Proposal.MaxCellLoad, Profile.GetTotalLoad());
+
+	if (Proposal.Rows == StrategySpy->Rows && Proposal.Cols == StrategySpy->Cols)
+	{
+		return false;
+	}
+
+	StrategyDefaults->Modify();
+	StrategySpy->Rows = Proposal.Rows;
+	StrategySpy->Cols = Proposal.Cols;
+	StrategyDefaults->MarkPackageDirty();
+
+	return true;
+}
@@ -5,8 +5,14 @@
 #include "EditorExtension/LBStrategyEditorExtension.h"
 #include "LoadBalancing/GridBasedLBStrategy.h"
 
+struct FGridLoadProfile;
+
 class FGridLBStrategyEditorExtension : public FLBStrategyEditorExtensionTemplate<UGridBasedLBStrategy, FGridLBStrategyEditorExtension>
 {
 public:
 	bool GetDefaultLaunchConfiguration(const UGridBasedLBStrategy* Strategy, UAbstractRuntimeLoadBalancingStrategy*& OutConfiguration, FIntPoint& OutWorldDimensions) const;
+
+	// Sets the rows and columns of the strategy's class defaults to the layout proposed for the load profile, see ProposeGridLayout.
+	// Returns whether the layout changed.
+	static bool ApplyLoadBasedLayout(UGridBasedLBStrategy* StrategyDefaults, const FGridLoadProfile& Profile, uint32 MaxWorkers, float TargetLoadPerWorker);
 };
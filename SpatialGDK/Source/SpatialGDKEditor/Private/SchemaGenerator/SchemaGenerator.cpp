@@ -10,6 +10,7 @@
 #include "Interop/SpatialClassInfoManager.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/CodeWriter.h"
+#include "Utils/CompactRepMovement.h"
 #include "Utils/ComponentIdGenerator.h"
 #include "Utils/DataTypeUtilities.h"
 #include "SpatialGDKEditorSchemaGenerator.h"
@@ -47,8 +48,7 @@ FString PropertyToSchemaType(UProperty* Property)
 	if (Property->IsA(UStructProperty::StaticClass()))
 	{
 		UStructProperty* StructProp = Cast<UStructProperty>(Property);
-		UScriptStruct* Struct = StructProp->Struct;
-		DataType = TEXT("bytes");
+		DataType = SpatialGDK::CompactRepMovement::IsCompactProperty(StructProp) ? TEXT("RepMovement") : TEXT("bytes");
 	}
 	else if (Property->IsA(UBoolProperty::StaticClass()))
 	{
@@ -235,7 +235,7 @@ void GenerateSubobjectSchemaForActorIncludes(FCodeWriter& Writer, TSharedPtr<FUn
 }
 
 // Generates schema for all statically attached subobjects on an Actor.
-void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass* ActorClass, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FActorSchemaData& ActorSchemaData, const FActorSchemaData* ExistingSchemaData)
+void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass* ActorClass, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FActorSchemaData& ActorSchemaData, const FActorSchemaData* ExistingSchemaData, FCodeWriterFileBatch& OutFiles)
 {
 	FCodeWriter Writer;
 
@@ -291,7 +291,7 @@ void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass*
 
 	if (bHasComponents)
 	{
-		Writer.WriteToFile(FString::Printf(TEXT("%s%sComponents.schema"), *SchemaPath, *ClassPathToSchemaName[ActorClass->GetPathName()]));
+		OutFiles.Add(Writer, FString::Printf(TEXT("%s%sComponents.schema"), *SchemaPath, *ClassPathToSchemaName[ActorClass->GetPathName()]));
 	}
 }
 
@@ -309,6 +309,8 @@ FString GetRPCFieldPrefix(ERPCType RPCType)
 		return TEXT("client_to_server_unreliable");
 	case ERPCType::NetMulticast:
 		return TEXT("multicast");
+	case ERPCType::CrossServer:
+		return TEXT("cross_server");
 	default:
 		checkNoEntry();
 	}
@@ -346,12 +348,30 @@ void GenerateRPCEndpoint(FCodeWriter& Writer, FString EndpointName, Worker_Compo
 		Writer.Printf("uint32 initially_present_multicast_rpc_count = {0};", FieldId++);
 	}
 
+	if (ComponentId == SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID)
+	{
+		// Each server acks the cross-server RPCs of every other server on its own endpoint, as no other worker can write to it.
+		Writer.Printf("map<EntityId, uint64> last_acked_cross_server_rpc_ids = {0};", FieldId++);
+	}
+
+	// Ring buffers can be sized per entity, up to MaxRPCRingBufferSize.
+	for (ERPCType SentRPCType : SentRPCTypes)
+	{
+		Writer.Printf("uint32 {0}_rpc_ring_buffer_size = {1};", GetRPCFieldPrefix(SentRPCType), FieldId++);
+	}
+
+	if (ComponentId == SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID || ComponentId == SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID)
+	{
+		// Written by the client and echoed back by the server, to measure round trip latency without sending RPCs.
+		Writer.Printf("uint32 ping_id = {0};", FieldId++);
+	}
+
 	Writer.Outdent().Print("}");
 }
 
 } // anonymous namespace
 
-void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath)
+void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FCodeWriterFileBatch& OutFiles)
 {
 	FCodeWriter Writer;
 
@@ -369,7 +389,7 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		for (auto& PropertyPair : PropertyGroup.Value)
 		{
 			UProperty* Property = PropertyPair.Value->Property;
-			if (Property->IsA<UObjectPropertyBase>())
+			if (Property->IsA<UObjectPropertyBase>() || SpatialGDK::CompactRepMovement::IsCompactProperty(Cast<UStructProperty>(Property)))
 			{
 				bShouldIncludeCoreTypes = true;
 			}
@@ -525,12 +545,12 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		SubobjectSchemaData.DynamicSubobjectComponents.Add(MoveTemp(DynamicSubobjectComponents));
 	}
 
-	Writer.WriteToFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
+	OutFiles.Add(Writer, FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
 	SubobjectSchemaData.GeneratedSchemaName = ClassPathToSchemaName[Class->GetPathName()];
 	SubobjectClassPathToSchema.Add(Class->GetPathName(), SubobjectSchemaData);
 }
 
-void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath)
+void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FCodeWriterFileBatch& OutFiles)
 {
 	const FActorSchemaData* const SchemaData = ActorClassPathToSchema.Find(Class->GetPathName());
 
@@ -636,7 +656,7 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 		Writer.Outdent().Print("}");
 	}
 
-	GenerateSubobjectSchemaForActor(IdGenerator, Class, TypeInfo, SchemaPath, ActorSchemaData, ActorClassPathToSchema.Find(Class->GetPathName()));
+	GenerateSubobjectSchemaForActor(IdGenerator, Class, TypeInfo, SchemaPath, ActorSchemaData, ActorClassPathToSchema.Find(Class->GetPathName()), OutFiles);
 
 	ActorClassPathToSchema.Add(Class->GetPathName(), ActorSchemaData);
 
@@ -656,7 +676,7 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 		}
 	}
 
-	Writer.WriteToFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
+	OutFiles.Add(Writer, FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
 }
 
 void GenerateRPCEndpointsSchema(FString SchemaPath)
@@ -674,6 +694,7 @@ void GenerateRPCEndpointsSchema(FString SchemaPath)
 	GenerateRPCEndpoint(Writer, TEXT("ClientEndpoint"), SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID, { ERPCType::ServerReliable, ERPCType::ServerUnreliable }, { ERPCType::ClientReliable, ERPCType::ClientUnreliable });
 	GenerateRPCEndpoint(Writer, TEXT("ServerEndpoint"), SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID, { ERPCType::ClientReliable, ERPCType::ClientUnreliable }, { ERPCType::ServerReliable, ERPCType::ServerUnreliable });
 	GenerateRPCEndpoint(Writer, TEXT("MulticastRPCs"), SpatialConstants::MULTICAST_RPCS_COMPONENT_ID, { ERPCType::NetMulticast }, {});
+	GenerateRPCEndpoint(Writer, TEXT("CrossServerEndpoint"), SpatialConstants::CROSS_SERVER_ENDPOINT_COMPONENT_ID, { ERPCType::CrossServer }, {});
 
 	Writer.WriteToFile(FString::Printf(TEXT("%srpc_endpoints.schema"), *SchemaPath));
 }
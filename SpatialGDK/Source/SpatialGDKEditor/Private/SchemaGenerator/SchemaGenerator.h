@@ -10,6 +10,7 @@ using ComponentIdPerType = Worker_ComponentId[ESchemaComponentType::SCHEMA_Count
 DECLARE_LOG_CATEGORY_EXTERN(LogSchemaGenerator, Log, All);
 
 class FCodeWriter;
+class FCodeWriterFileBatch;
 struct FComponentIdGenerator;
 
 extern TArray<UClass*> SchemaGeneratedClasses;
@@ -19,10 +20,10 @@ extern TMap<FString, Worker_ComponentId> LevelPathToComponentId;
 extern TMap<ESchemaComponentType, TSet<Worker_ComponentId>> SchemaComponentTypeToComponents;
 extern TMap<float, Worker_ComponentId> NetCullDistanceToComponentId;
 
-// Generates schema for an Actor
-void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
+// Generates schema for an Actor. The schema files are added to OutFiles rather than written to disk.
+void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FCodeWriterFileBatch& OutFiles);
 // Generates schema for a Subobject class - the schema type and the dynamic schema components
-void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
+void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FCodeWriterFileBatch& OutFiles);
 
 // Generates schema for RPC endpoints.
 void GenerateRPCEndpointsSchema(FString SchemaPath);
@@ -0,0 +1,240 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SerializerGenerator.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialGDKSerializerGenerator);
+
+namespace
+{
+const TCHAR* GeneratedFilePrefix = TEXT("SpatialSerializers_");
+
+struct FSerializerFunctions
+{
+	FString Write;
+	FString Read;
+};
+
+FSerializerFunctions NumericSerializer(const TCHAR* CppType, const TCHAR* SchemaType, const TCHAR* SchemaTypeName)
+{
+	return {
+		FString::Printf(TEXT("&Write<%s, %s, &Schema_Add%s>"), CppType, SchemaType, SchemaTypeName),
+		FString::Printf(TEXT("&Read<%s, %s, &Schema_Index%s>"), CppType, SchemaType, SchemaTypeName)
+	};
+}
+
+// Mirrors SpatialGDK::CompileReplicationPlanEntry, so that each property is written with the same schema type as at runtime.
+bool GetSerializerFunctions(UProperty* Property, FSerializerFunctions& OutFunctions)
+{
+	if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
+	{
+		if (!BoolProperty->IsNativeBool())
+		{
+			return false;
+		}
+		OutFunctions = { TEXT("&WriteNativeBool"), TEXT("&ReadNativeBool") };
+		return true;
+	}
+	if (Property->IsA<UFloatProperty>())
+	{
+		OutFunctions = NumericSerializer(TEXT("float"), TEXT("float"), TEXT("Float"));
+		return true;
+	}
+	if (Property->IsA<UDoubleProperty>())
+	{
+		OutFunctions = NumericSerializer(TEXT("double"), TEXT("double"), TEXT("Double"));
+		return true;
+	}
+	if (Property->IsA<UInt8Property>())
+	{
+		OutFunctions = NumericSerializer(TEXT("int8"), TEXT("int32_t"), TEXT("Int32"));
+		return true;
+	}
+	if (Property->IsA<UInt16Property>())
+	{
+		OutFunctions = NumericSerializer(TEXT("int16"), TEXT("int32_t"), TEXT("Int32"));
+		return true;
+	}
+	if (Property->IsA<UIntProperty>())
+	{
+		OutFunctions = NumericSerializer(TEXT("int32"), TEXT("int32_t"), TEXT("Int32"));
+		return true;
+	}
+	if (Property->IsA<UInt64Property>())
+	{
+		OutFunctions = NumericSerializer(TEXT("int64"), TEXT("int64_t"), TEXT("Int64"));
+		return true;
+	}
+	if (Property->IsA<UByteProperty>())
+	{
+		OutFunctions = NumericSerializer(TEXT("uint8"), TEXT("uint32_t"), TEXT("Uint32"));
+		return true;
+	}
+	if (Property->IsA<UUInt16Property>())
+	{
+		OutFunctions = NumericSerializer(TEXT("uint16"), TEXT("uint32_t"), TEXT("Uint32"));
+		return true;
+	}
+	if (Property->IsA<UUInt32Property>())
+	{
+		OutFunctions = NumericSerializer(TEXT("uint32"), TEXT("uint32_t"), TEXT("Uint32"));
+		return true;
+	}
+	if (Property->IsA<UUInt64Property>())
+	{
+		OutFunctions = NumericSerializer(TEXT("uint64"), TEXT("uint64_t"), TEXT("Uint64"));
+		return true;
+	}
+	if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		// Enums smaller than 4 bytes are always sent as uint32, larger ones are written through their underlying property.
+		if (EnumProperty->ElementSize == 1)
+		{
+			OutFunctions = NumericSerializer(TEXT("uint8"), TEXT("uint32_t"), TEXT("Uint32"));
+			return true;
+		}
+		if (EnumProperty->ElementSize == 2)
+		{
+			OutFunctions = NumericSerializer(TEXT("uint16"), TEXT("uint32_t"), TEXT("Uint32"));
+			return true;
+		}
+	}
+	return false;
+}
+
+FString GetClassIdentifier(const UStruct& Type)
+{
+	FString Identifier = Type.GetName();
+	for (TCHAR& Character : Identifier)
+	{
+		if (!FChar::IsAlnum(Character))
+		{
+			Character = TEXT('_');
+		}
+	}
+
+	// Classes with the same name can live in different packages.
+	return FString::Printf(TEXT("%s_%08X"), *Identifier, GetTypeHash(Type.GetPathName()));
+}
+} // anonymous namespace
+
+FString GenerateSerializerSource(TSharedPtr<FUnrealType> TypeInfo, int32& OutNumProperties)
+{
+	const FString ClassPath = TypeInfo->Type->GetPathName();
+	const FString Identifier = GetClassIdentifier(*TypeInfo->Type);
+
+	TMap<uint16, TSharedPtr<FUnrealProperty>> PropertiesByHandle;
+	for (const auto& Group : GetFlatRepData(TypeInfo))
+	{
+		PropertiesByHandle.Append(Group.Value);
+	}
+	PropertiesByHandle.KeySort(TLess<uint16>());
+
+	TArray<FString> Entries;
+	for (const auto& HandleProperty : PropertiesByHandle)
+	{
+		UProperty* Property = HandleProperty.Value->Property;
+		FSerializerFunctions Functions;
+		if (HandleProperty.Value->ReplicationData->RepLayoutType == ERepLayoutCmdType::DynamicArray || !GetSerializerFunctions(Property, Functions))
+		{
+			continue;
+		}
+
+		Entries.Add(FString::Printf(TEXT("\t{ %d, TEXT(\"%s\"), TEXT(\"%s\"), %s, %s },"),
+			HandleProperty.Key, *Property->GetName(), *Property->GetClass()->GetName(), *Functions.Write, *Functions.Read));
+	}
+
+	OutNumProperties = Entries.Num();
+	if (Entries.Num() == 0)
+	{
+		return FString();
+	}
+
+	TArray<FString> Lines;
+	Lines.Add(TEXT("// Copyright (c) Improbable Worlds Ltd, All Rights Reserved"));
+	Lines.Add(TEXT(""));
+	Lines.Add(FString::Printf(TEXT("// Generated by the SpatialGDK schema generator for %s. Do not edit, generate schema to update it."), *ClassPath));
+	Lines.Add(TEXT(""));
+	Lines.Add(TEXT("#include \"Utils/GeneratedSerializers.h\""));
+	Lines.Add(TEXT(""));
+	Lines.Add(TEXT("namespace"));
+	Lines.Add(TEXT("{"));
+	Lines.Add(TEXT("using namespace SpatialGDK::GeneratedSerializers;"));
+	Lines.Add(TEXT(""));
+	Lines.Add(FString::Printf(TEXT("const SpatialGDK::FGeneratedPropertySerializer %s_Properties[] ="), *Identifier));
+	Lines.Add(TEXT("{"));
+	Lines.Append(Entries);
+	Lines.Add(TEXT("};"));
+	Lines.Add(TEXT(""));
+	Lines.Add(FString::Printf(TEXT("SpatialGDK::FGeneratedSerializerRegistration %s_Registration(TEXT(\"%s\"), MakeArrayView(%s_Properties));"), *Identifier, *ClassPath, *Identifier));
+	Lines.Add(TEXT("} // anonymous namespace"));
+	Lines.Add(TEXT(""));
+
+	return FString::Join(Lines, TEXT("\n"));
+}
+
+bool GenerateSerializersForClasses(const TArray<TSharedPtr<FUnrealType>>& TypeInfos, const FString& OutputFolder)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.MakeDirectory(*OutputFolder, /* Tree */ true))
+	{
+		UE_LOG(LogSpatialGDKSerializerGenerator, Error, TEXT("Could not create the generated serializers folder %s."), *OutputFolder);
+		return false;
+	}
+
+	TSet<FString> GeneratedFiles;
+	int32 NumChangedFiles = 0;
+	bool bSuccess = true;
+
+	for (const TSharedPtr<FUnrealType>& TypeInfo : TypeInfos)
+	{
+		int32 NumProperties = 0;
+		const FString Source = GenerateSerializerSource(TypeInfo, NumProperties);
+		if (NumProperties == 0)
+		{
+			UE_LOG(LogSpatialGDKSerializerGenerator, Warning, TEXT("%s has no replicated properties that serializers can be generated for."), *TypeInfo->Type->GetPathName());
+			continue;
+		}
+
+		const FString FileName = FString::Printf(TEXT("%s%s.cpp"), GeneratedFilePrefix, *GetClassIdentifier(*TypeInfo->Type));
+		const FString FilePath = FPaths::Combine(OutputFolder, FileName);
+		GeneratedFiles.Add(FileName);
+
+		// Only touch files that changed, so the game module isn't rebuilt after every schema generation.
+		FString ExistingSource;
+		if (FFileHelper::LoadFileToString(ExistingSource, *FilePath) && ExistingSource == Source)
+		{
+			continue;
+		}
+
+		if (!FFileHelper::SaveStringToFile(Source, *FilePath))
+		{
+			UE_LOG(LogSpatialGDKSerializerGenerator, Error, TEXT("Could not write generated serializers to %s. The file might be read-only."), *FilePath);
+			bSuccess = false;
+			continue;
+		}
+		NumChangedFiles++;
+	}
+
+	TArray<FString> ExistingFiles;
+	FileManager.FindFiles(ExistingFiles, *FPaths::Combine(OutputFolder, FString::Printf(TEXT("%s*.cpp"), GeneratedFilePrefix)), /* Files */ true, /* Directories */ false);
+	for (const FString& ExistingFile : ExistingFiles)
+	{
+		if (!GeneratedFiles.Contains(ExistingFile))
+		{
+			FileManager.Delete(*FPaths::Combine(OutputFolder, ExistingFile));
+			NumChangedFiles++;
+		}
+	}
+
+	if (NumChangedFiles > 0)
+	{
+		UE_LOG(LogSpatialGDKSerializerGenerator, Display, TEXT("Updated %d generated serializer files in %s. Rebuild the game module to use them."), NumChangedFiles, *OutputFolder);
+	}
+
+	return bSuccess;
+}
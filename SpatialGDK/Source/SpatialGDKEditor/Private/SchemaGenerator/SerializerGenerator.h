@@ -0,0 +1,17 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TypeStructure.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKSerializerGenerator, Log, All);
+
+// Returns the C++ source registering the generated serializers of the class with SpatialGDK::FGeneratedSerializerRegistry.
+// Properties that can't be serialized with compile time types, such as structs, object references and arrays, are left out.
+FString GenerateSerializerSource(TSharedPtr<FUnrealType> TypeInfo, int32& OutNumProperties);
+
+// Generates a source file for each class in OutputFolder, only rewriting the ones that changed, and deletes the files of classes
+// that are no longer generated.
+bool GenerateSerializersForClasses(const TArray<TSharedPtr<FUnrealType>>& TypeInfos, const FString& OutputFolder);
@@ -4,6 +4,7 @@
 
 #include "AssetRegistryModule.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Components/SceneComponent.h"
 #include "Editor.h"
 #include "Engine/LevelScriptActor.h"
@@ -12,8 +13,10 @@
 #include "GeneralProjectSettings.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Hash/CityHash.h"
+#include "Interfaces/IPluginManager.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
@@ -25,15 +28,18 @@
 #include "Interop/SpatialClassInfoManager.h"
 #include "Misc/ScopedSlowTask.h"
 #include "SchemaGenerator.h"
+#include "SerializerGenerator.h"
 #include "Settings/ProjectPackagingSettings.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKEditorSettings.h"
+#include "SpatialGDKSettings.h"
 #include "SpatialGDKServicesConstants.h"
 #include "SpatialGDKServicesModule.h"
 #include "TypeStructure.h"
 #include "UObject/StrongObjectPtr.h"
 #include "Utils/CodeWriter.h"
 #include "Utils/ComponentIdGenerator.h"
+#include "Utils/CompactSchemaDatabase.h"
 #include "Utils/DataTypeUtilities.h"
 #include "Utils/SchemaDatabase.h"
 
@@ -59,6 +65,13 @@ TMap<FString, TSet<FString>> PotentialSchemaNameCollisions;
 // QBI
 TMap<float, Worker_ComponentId> NetCullDistanceToComponentId;
 
+// Compressed bytes fields
+TMap<FString, FCompressedFieldsSchemaData> ClassPathToCompressedFields;
+
+// Incremental generation
+TMap<FString, uint32> ClassPathToContentHash;
+uint32 SchemaFilesHash = 0;
+
 const FString RelativeSchemaDatabaseFilePath = FPaths::SetExtension(FPaths::Combine(FPaths::ProjectContentDir(), SpatialConstants::SCHEMA_DATABASE_FILE_PATH), FPackageName::GetAssetPackageExtension());
 
 namespace SpatialGDKEditor
@@ -75,18 +88,220 @@ void OnStatusOutput(const FString& Message)
 	UE_LOG(LogSpatialGDKSchemaGenerator, Log, TEXT("%s"), *Message);
 }
 
-void GenerateCompleteSchemaFromClass(const FString& SchemaPath, FComponentIdGenerator& IdGenerator, TSharedPtr<FUnrealType> TypeInfo)
+void GenerateCompleteSchemaFromClass(const FString& SchemaPath, FComponentIdGenerator& IdGenerator, TSharedPtr<FUnrealType> TypeInfo, FCodeWriterFileBatch& OutFiles)
 {
 	UClass* Class = Cast<UClass>(TypeInfo->Type);
 
 	if (Class->IsChildOf<AActor>())
 	{
-		GenerateActorSchema(IdGenerator, Class, TypeInfo, SchemaPath);
+		GenerateActorSchema(IdGenerator, Class, TypeInfo, SchemaPath, OutFiles);
 	}
 	else
 	{
-		GenerateSubobjectSchema(IdGenerator, Class, TypeInfo, SchemaPath + TEXT("Subobjects/"));
+		GenerateSubobjectSchema(IdGenerator, Class, TypeInfo, SchemaPath + TEXT("Subobjects/"), OutFiles);
+	}
+}
+
+// Creates the type info for each class on worker threads. Classes[i]'s type info is returned at index i.
+TArray<TSharedPtr<FUnrealType>> CreateUnrealTypeInfos(const TArray<UClass*>& Classes)
+{
+	// Set up the CDOs and replication data on the game thread, so that creating the type infos only has to read the classes.
+	// CreateUnrealTypeInfo still does this under a lock for any nested classes that haven't been set up.
+	for (UClass* Class : Classes)
+	{
+		Class->GetDefaultObject();
+		Class->SetUpRuntimeReplicationData();
+	}
+
+	TArray<TSharedPtr<FUnrealType>> TypeInfos;
+	TypeInfos.SetNum(Classes.Num());
+
+	// Parent and static array index start at 0 for checksum calculations.
+	ParallelFor(Classes.Num(), [&Classes, &TypeInfos](int32 Index)
+	{
+		TypeInfos[Index] = CreateUnrealTypeInfo(Classes[Index], 0, 0);
+	});
+
+	return TypeInfos;
+}
+
+FString GetGDKVersion()
+{
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("SpatialGDK"));
+	return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString();
+}
+
+// Hashes everything in the type info that ends up in the generated schema, including the type info of subobjects and structs,
+// so a class is regenerated when any of them change.
+uint32 HashTypeContent(TSharedPtr<FUnrealType> TypeInfo)
+{
+	const FString TypePath = TypeInfo->Type->GetPathName();
+	uint32 Hash = GetTypeHash(TypePath);
+	Hash = HashCombine(Hash, GetTypeHash(TypeInfo->Name));
+
+	if (const FString* SchemaName = ClassPathToSchemaName.Find(TypePath))
+	{
+		Hash = HashCombine(Hash, GetTypeHash(*SchemaName));
+	}
+
+	if (UClass* Class = Cast<UClass>(TypeInfo->Type))
+	{
+		if (Class->IsChildOf<AActor>())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Class->GetDefaultObject<AActor>()->NetCullDistanceSquared));
+		}
+	}
+
+	for (const auto& PropertyPair : TypeInfo->Properties)
+	{
+		const TSharedPtr<FUnrealProperty>& Property = PropertyPair.Value;
+
+		FString ExtendedTypeText;
+		const FString TypeText = Property->Property->GetCPPType(&ExtendedTypeText);
+		Hash = HashCombine(Hash, GetTypeHash(TypeText));
+		Hash = HashCombine(Hash, GetTypeHash(ExtendedTypeText));
+		Hash = HashCombine(Hash, Property->CompatibleChecksum);
+		Hash = HashCombine(Hash, GetTypeHash(Property->StaticArrayIndex));
+
+		if (Property->ReplicationData.IsValid())
+		{
+			const FUnrealRepData& RepData = *Property->ReplicationData;
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint32>(RepData.RepLayoutType)));
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint32>(RepData.Condition)));
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint32>(RepData.RepNotifyCondition)));
+			Hash = HashCombine(Hash, GetTypeHash(RepData.Handle));
+			Hash = HashCombine(Hash, GetTypeHash(RepData.RoleSwapHandle));
+			Hash = HashCombine(Hash, GetTypeHash(RepData.ArrayIndex));
+		}
+
+		if (Property->HandoverData.IsValid())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Property->HandoverData->Handle));
+		}
+
+		if (Property->Type.IsValid())
+		{
+			Hash = HashCombine(Hash, HashTypeContent(Property->Type));
+		}
+	}
+
+	return Hash;
+}
+
+// Only bytes fields, structs and arrays of structs, can be compressed. They are if the property, a struct it's nested in or its class is
+// marked with the SpatialCompressed metadata.
+bool IsCompressedBytesField(TSharedPtr<FUnrealProperty> Property, bool bClassCompressed)
+{
+	const UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property->Property);
+	const UStructProperty* StructProperty = Cast<UStructProperty>(ArrayProperty != nullptr ? ArrayProperty->Inner : Property->Property);
+	const bool bIsBytesField = StructProperty != nullptr && !SpatialGDK::CompactRepMovement::IsCompactProperty(StructProperty);
+	if (!bIsBytesField)
+	{
+		return false;
+	}
+
+	if (bClassCompressed)
+	{
+		return true;
+	}
+
+	for (const TSharedPtr<FUnrealProperty>& ChainProperty : GetPropertyChain(Property))
+	{
+		if (ChainProperty->Property->HasMetaData(SpatialConstants::SPATIAL_COMPRESSED_METADATA))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UpdateCompressedFields(TSharedPtr<FUnrealType> TypeInfo)
+{
+	UClass* Class = Cast<UClass>(TypeInfo->Type);
+
+	bool bClassCompressed = false;
+	for (UClass* SuperClass = Class; SuperClass != nullptr && !bClassCompressed; SuperClass = SuperClass->GetSuperClass())
+	{
+		bClassCompressed = SuperClass->HasMetaData(SpatialConstants::SPATIAL_COMPRESSED_METADATA);
 	}
+
+	FCompressedFieldsSchemaData CompressedFields;
+
+	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
+	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
+	{
+		for (auto& RepProp : RepData[Group])
+		{
+			if (IsCompressedBytesField(RepProp.Value, bClassCompressed))
+			{
+				CompressedFields.ReplicatedFieldIds.Add(RepProp.Value->ReplicationData->Handle);
+			}
+		}
+	}
+
+	// Handover fields are numbered in the order they're written to schema, see GenerateActorSchema.
+	const bool bHandoverCompressed = bClassCompressed || GetDefault<USpatialGDKSettings>()->bCompressHandoverBytesFields;
+	uint32 HandoverFieldId = 0;
+	for (auto& Prop : GetFlatHandoverData(TypeInfo))
+	{
+		HandoverFieldId++;
+		if (IsCompressedBytesField(Prop.Value, bHandoverCompressed))
+		{
+			CompressedFields.HandoverFieldIds.Add(HandoverFieldId);
+		}
+	}
+
+	if (CompressedFields.ReplicatedFieldIds.Num() == 0 && CompressedFields.HandoverFieldIds.Num() == 0)
+	{
+		ClassPathToCompressedFields.Remove(Class->GetPathName());
+		return;
+	}
+
+	CompressedFields.ReplicatedFieldIds.Sort();
+	ClassPathToCompressedFields.Add(Class->GetPathName(), MoveTemp(CompressedFields));
+}
+
+// A class's schema is up to date if it was generated from the same type info and its schema file still exists.
+bool IsSchemaUpToDate(TSharedPtr<FUnrealType> TypeInfo, const FString& SchemaPath, uint32 ContentHash)
+{
+	UClass* Class = Cast<UClass>(TypeInfo->Type);
+	const FString& ClassPath = Class->GetPathName();
+
+	const uint32* PreviousContentHash = ClassPathToContentHash.Find(ClassPath);
+	if (PreviousContentHash == nullptr || *PreviousContentHash != ContentHash)
+	{
+		return false;
+	}
+
+	const bool bIsActor = Class->IsChildOf<AActor>();
+	if (bIsActor ? !ActorClassPathToSchema.Contains(ClassPath) : !SubobjectClassPathToSchema.Contains(ClassPath))
+	{
+		return false;
+	}
+
+	const FString SchemaFilePath = FString::Printf(TEXT("%s%s%s.schema"), *SchemaPath, bIsActor ? TEXT("") : TEXT("Subobjects/"), *ClassPathToSchemaName[ClassPath]);
+	return FPaths::FileExists(SchemaFilePath);
+}
+
+uint32 HashSchemaFiles(const FString& SchemaDir)
+{
+	TArray<FString> SchemaFiles;
+	IFileManager::Get().FindFilesRecursive(SchemaFiles, *SchemaDir, TEXT("*.schema"), true, false);
+	SchemaFiles.Sort();
+
+	uint32 Hash = 0;
+	TArray<uint8> FileContents;
+	for (const FString& SchemaFile : SchemaFiles)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(SchemaFile));
+		if (FFileHelper::LoadFileToArray(FileContents, *SchemaFile))
+		{
+			Hash = FCrc::MemCrc32(FileContents.GetData(), FileContents.Num(), Hash);
+		}
+	}
+
+	return Hash;
 }
 
 bool CheckSchemaNameValidity(const FString& Name, const FString& Identifier, const FString& Category)
@@ -246,13 +461,18 @@ bool ValidateIdentifierNames(TArray<TSharedPtr<FUnrealType>>& TypeInfos)
 
 void GenerateSchemaFromClasses(const TArray<TSharedPtr<FUnrealType>>& TypeInfos, const FString& CombinedSchemaPath, FComponentIdGenerator& IdGenerator)
 {
-	// Generate the actual schema.
-	FScopedSlowTask Progress((float)TypeInfos.Num(), LOCTEXT("GenerateSchemaFromClasses", "Generating Schema..."));
+	// Generate the actual schema. Component IDs are assigned in class order on this thread so they stay deterministic,
+	// and the files are written afterwards in parallel.
+	FScopedSlowTask Progress((float)TypeInfos.Num() + 1.f, LOCTEXT("GenerateSchemaFromClasses", "Generating Schema..."));
+	FCodeWriterFileBatch SchemaFiles;
 	for (const auto& TypeInfo : TypeInfos)
 	{
 		Progress.EnterProgressFrame(1.f);
-		GenerateCompleteSchemaFromClass(CombinedSchemaPath, IdGenerator, TypeInfo);
+		GenerateCompleteSchemaFromClass(CombinedSchemaPath, IdGenerator, TypeInfo, SchemaFiles);
 	}
+
+	Progress.EnterProgressFrame(1.f);
+	SchemaFiles.WriteAll();
 }
 
 void WriteLevelComponent(FCodeWriter& Writer, const FString& LevelName, Worker_ComponentId ComponentId, const FString& ClassPath)
@@ -466,6 +686,13 @@ bool SaveSchemaDatabase(const FString& PackagePath)
 	SchemaDatabase->LevelComponentIds.Reset(LevelPathToComponentId.Num());
 	LevelPathToComponentId.GenerateValueArray(SchemaDatabase->LevelComponentIds);
 
+	ClassPathToContentHash.KeySort([](const FString& LHS, const FString& RHS) { return LHS < RHS; });
+	SchemaDatabase->ClassPathToContentHash = ClassPathToContentHash;
+	ClassPathToCompressedFields.KeySort([](const FString& LHS, const FString& RHS) { return LHS < RHS; });
+	SchemaDatabase->ClassPathToCompressedFields = ClassPathToCompressedFields;
+	SchemaDatabase->SchemaFilesHash = SchemaFilesHash;
+	SchemaDatabase->GDKVersion = GetGDKVersion();
+
 
 	FString CompiledSchemaDir = FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("build/assembly/schema"));
 
@@ -517,7 +744,8 @@ bool SaveSchemaDatabase(const FString& PackagePath)
 		FMessageDialog::Debugf(FText::FromString(FString::Printf(TEXT("Unable to save Schema Database to '%s'! The file may be locked by another process."), *FullPath)));
 		return false;
 	}
-	return true;
+
+	return SpatialGDK::FCompactSchemaDatabase::WriteToFile(*SchemaDatabase, SpatialGDK::FCompactSchemaDatabase::GetFilePath());
 }
 
 bool IsSupportedClass(const UClass* SupportedClass)
@@ -657,6 +885,9 @@ void ResetSchemaGeneratorState()
 	NextAvailableComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
 	SchemaGeneratedClasses.Empty();
 	NetCullDistanceToComponentId.Empty();
+	ClassPathToContentHash.Empty();
+	ClassPathToCompressedFields.Empty();
+	SchemaFilesHash = 0;
 }
 
  void ResetSchemaGeneratorStateAndCleanupFolders()
@@ -700,6 +931,21 @@ bool LoadGeneratorStateFromSchemaDatabase(const FString& FileName)
 		LevelPathToComponentId = SchemaDatabase->LevelPathToComponentId;
 		NextAvailableComponentId = SchemaDatabase->NextAvailableComponentId;
 		NetCullDistanceToComponentId = SchemaDatabase->NetCullDistanceToComponentId;
+		ClassPathToCompressedFields = SchemaDatabase->ClassPathToCompressedFields;
+
+		// Keep the component IDs, but regenerate and recompile all schema if the database was generated by a different GDK version.
+		const FString GDKVersion = GetGDKVersion();
+		if (SchemaDatabase->GDKVersion == GDKVersion)
+		{
+			ClassPathToContentHash = SchemaDatabase->ClassPathToContentHash;
+			SchemaFilesHash = SchemaDatabase->SchemaFilesHash;
+		}
+		else
+		{
+			UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Schema database was generated by GDK version '%s', current version is '%s'. Regenerating all schema."), *SchemaDatabase->GDKVersion, *GDKVersion);
+			ClassPathToContentHash.Empty();
+			SchemaFilesHash = 0;
+		}
 
 		// Component Id generation was updated to be non-destructive, if we detect an old schema database, delete it.
 		if (ActorClassPathToSchema.Num() > 0 && NextAvailableComponentId == SpatialConstants::STARTING_GENERATED_COMPONENT_ID)
@@ -761,6 +1007,10 @@ bool DeleteSchemaDatabase(const FString& PackagePath)
 		}
 	}
 
+	// The compact database is regenerated along with the asset, so a stale one is just removed.
+	SpatialGDK::FCompactSchemaDatabase::ResetShared();
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*SpatialGDK::FCompactSchemaDatabase::GetFilePath());
+
 	return true;
 }
 
@@ -882,6 +1132,59 @@ bool RunSchemaCompiler()
 	}
 }
 
+bool RunSchemaCompilerIfSchemaChanged()
+{
+	const FString SchemaDir = FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("schema"));
+	const FString SchemaDescriptorPath = FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("build/assembly/schema/schema.descriptor"));
+
+	const uint32 NewSchemaFilesHash = HashSchemaFiles(SchemaDir);
+	if (NewSchemaFilesHash == SchemaFilesHash && FPaths::FileExists(SchemaDescriptorPath))
+	{
+		UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Schema is unchanged since it was last compiled, not running the schema compiler."));
+		return true;
+	}
+
+	if (!RunSchemaCompiler())
+	{
+		return false;
+	}
+
+	SchemaFilesHash = NewSchemaFilesHash;
+	return true;
+}
+
+bool GenerateSerializersForConfiguredClasses()
+{
+	const USpatialGDKEditorSettings* SpatialGDKEditorSettings = GetDefault<USpatialGDKEditorSettings>();
+	const FString OutputFolder = SpatialGDKEditorSettings->GetGeneratedSerializersFolder();
+
+	TArray<UClass*> Classes;
+	for (const TSoftClassPtr<UObject>& ClassPtr : SpatialGDKEditorSettings->GetGeneratedSerializerClasses())
+	{
+		if (UClass* Class = ClassPtr.LoadSynchronous())
+		{
+			Classes.AddUnique(Class);
+		}
+		else if (!ClassPtr.IsNull())
+		{
+			UE_LOG(LogSpatialGDKSchemaGenerator, Warning, TEXT("Could not load %s to generate serializers for it."), *ClassPtr.ToString());
+		}
+	}
+
+	// Still run when no classes are configured if files were generated before, so they are deleted.
+	if (Classes.Num() == 0 && !FPaths::DirectoryExists(OutputFolder))
+	{
+		return true;
+	}
+
+	return GenerateSerializersForClasses(CreateUnrealTypeInfos(Classes), OutputFolder);
+}
+
+FString GenerateSerializerSourceForClass(UClass* Class, int32& OutNumProperties)
+{
+	return GenerateSerializerSource(CreateUnrealTypeInfos({ Class })[0], OutNumProperties);
+}
+
 bool SpatialGDKGenerateSchema()
 {
 	SchemaGeneratedClasses.Empty();
@@ -899,7 +1202,12 @@ bool SpatialGDKGenerateSchema()
 	GenerateSchemaForRPCEndpoints();
 	GenerateSchemaForNCDs();
 
-	if (!RunSchemaCompiler())
+	if (!GenerateSerializersForConfiguredClasses())
+	{
+		return false;
+	}
+
+	if (!RunSchemaCompilerIfSchemaChanged())
 	{
 		return false;
 	}
@@ -920,19 +1228,32 @@ bool SpatialGDKGenerateSchemaForClasses(TSet<UClass*> Classes, FString SchemaOut
 		return A.GetPathName() < B.GetPathName();
 	});
 
-	// Generate Type Info structs for all classes
+	// Generate Type Info structs for all classes, in parallel.
+	TArray<UClass*> CandidateClasses;
+	for (const auto& Class : Classes)
+	{
+		if (!SchemaGeneratedClasses.Contains(Class))
+		{
+			CandidateClasses.Add(Class);
+		}
+	}
+	const TArray<TSharedPtr<FUnrealType>> CandidateTypeInfos = CreateUnrealTypeInfos(CandidateClasses);
+
+	// Then order them the same way as when generating them one by one: each class followed by the supported classes nested in it.
 	TArray<TSharedPtr<FUnrealType>> TypeInfos;
+	TArray<int32> NestedTypeInfoIndices;
+	TArray<UClass*> NestedClasses;
 
-	for (const auto& Class : Classes)
+	for (int32 CandidateIndex = 0; CandidateIndex < CandidateClasses.Num(); CandidateIndex++)
 	{
+		UClass* Class = CandidateClasses[CandidateIndex];
 		if (SchemaGeneratedClasses.Contains(Class))
 		{
 			continue;
 		}
 
 		SchemaGeneratedClasses.Add(Class);
-		// Parent and static array index start at 0 for checksum calculations.
-		TSharedPtr<FUnrealType> TypeInfo = CreateUnrealTypeInfo(Class, 0, 0);
+		TSharedPtr<FUnrealType> TypeInfo = CandidateTypeInfos[CandidateIndex];
 		TypeInfos.Add(TypeInfo);
 		VisitAllObjects(TypeInfo, [&](TSharedPtr<FUnrealType> TypeNode)
 		{
@@ -940,7 +1261,17 @@ bool SpatialGDKGenerateSchemaForClasses(TSet<UClass*> Classes, FString SchemaOut
 			{
 				if (!SchemaGeneratedClasses.Contains(NestedClass) && IsSupportedClass(NestedClass))
 				{
-					TypeInfos.Add(CreateUnrealTypeInfo(NestedClass, 0, 0));
+					const int32 NestedCandidateIndex = CandidateClasses.Find(NestedClass);
+					if (NestedCandidateIndex != INDEX_NONE)
+					{
+						TypeInfos.Add(CandidateTypeInfos[NestedCandidateIndex]);
+					}
+					else
+					{
+						// Created below, together with the other nested classes that weren't passed in.
+						NestedTypeInfoIndices.Add(TypeInfos.Add(nullptr));
+						NestedClasses.Add(NestedClass);
+					}
 					SchemaGeneratedClasses.Add(NestedClass);
 				}
 			}
@@ -948,6 +1279,12 @@ bool SpatialGDKGenerateSchemaForClasses(TSet<UClass*> Classes, FString SchemaOut
 		});
 	}
 
+	const TArray<TSharedPtr<FUnrealType>> NestedTypeInfos = CreateUnrealTypeInfos(NestedClasses);
+	for (int32 NestedIndex = 0; NestedIndex < NestedTypeInfos.Num(); NestedIndex++)
+	{
+		TypeInfos[NestedTypeInfoIndices[NestedIndex]] = NestedTypeInfos[NestedIndex];
+	}
+
 	if (!ValidateIdentifierNames(TypeInfos))
 	{
 		return false;
@@ -967,9 +1304,26 @@ bool SpatialGDKGenerateSchemaForClasses(TSet<UClass*> Classes, FString SchemaOut
 		return false;
 	}
 
+	// Only generate schema for classes whose type info changed since it was last generated.
+	TArray<TSharedPtr<FUnrealType>> ChangedTypeInfos;
+	for (const auto& TypeInfo : TypeInfos)
+	{
+		// Metadata isn't part of the content hash, so which fields are compressed is updated for unchanged classes too.
+		UpdateCompressedFields(TypeInfo);
+
+		const uint32 ContentHash = HashTypeContent(TypeInfo);
+		if (!IsSchemaUpToDate(TypeInfo, SchemaOutputPath, ContentHash))
+		{
+			ClassPathToContentHash.Add(TypeInfo->Type->GetPathName(), ContentHash);
+			ChangedTypeInfos.Add(TypeInfo);
+		}
+	}
+
+	UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Generating schema for %d classes, %d classes are unchanged."), ChangedTypeInfos.Num(), TypeInfos.Num() - ChangedTypeInfos.Num());
+
 	FComponentIdGenerator IdGenerator = FComponentIdGenerator(NextAvailableComponentId);
 
-	GenerateSchemaFromClasses(TypeInfos, SchemaOutputPath, IdGenerator);
+	GenerateSchemaFromClasses(ChangedTypeInfos, SchemaOutputPath, IdGenerator);
 
 	NextAvailableComponentId = IdGenerator.Peek();
 
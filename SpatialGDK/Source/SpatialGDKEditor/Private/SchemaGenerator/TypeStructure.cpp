@@ -4,11 +4,15 @@
 
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SCS_Node.h"
+#include "Misc/ScopeLock.h"
 #include "SpatialGDKEditorSchemaGenerator.h"
 #include "Utils/RepLayoutUtils.h"
 
 using namespace SpatialGDKEditor::Schema;
 
+// Guards setting up classes, since type infos can be created on several threads at once.
+static FCriticalSection ClassSetupCriticalSection;
+
 TArray<EReplicatedPropertyGroup> GetAllReplicatedPropertyGroups()
 {
 	static TArray<EReplicatedPropertyGroup> Groups = {REP_MultiClient, REP_SingleClient};
@@ -79,6 +83,15 @@ TSharedPtr<FUnrealType> CreateUnrealTypeInfo(UStruct* Type, uint32 ParentChecksu
 	// Struct types will set this to nullptr.
 	UClass* Class = Cast<UClass>(Type);
 
+	if (Class != nullptr)
+	{
+		// Creating the CDO and setting up replication data modify the class. Both only happen once per class, so the rest of the
+		// type info creation only reads it.
+		FScopeLock Lock(&ClassSetupCriticalSection);
+		Class->GetDefaultObject();
+		Class->SetUpRuntimeReplicationData();
+	}
+
 	// Create type node.
 	TSharedPtr<FUnrealType> TypeNode = MakeShared<FUnrealType>();
 	TypeNode->Type = Type;
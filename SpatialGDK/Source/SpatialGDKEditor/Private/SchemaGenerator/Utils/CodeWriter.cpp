@@ -1,7 +1,11 @@
 // Copyright (c) Improbable Worlds Ltd, All Rights Reserved
 
 #include "CodeWriter.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 FCodeWriter::FCodeWriter() : Scope(0)
 {
@@ -117,6 +121,36 @@ void FCodeWriter::WriteToFile(const FString& Filename)
 	FFileHelper::SaveStringToFile(OutputSource, *Filename);
 }
 
+void FCodeWriterFileBatch::Add(FCodeWriter& Writer, const FString& Filename)
+{
+	check(Writer.Scope == 0);
+	Files.Emplace(Filename, MoveTemp(Writer.OutputSource));
+	Writer.OutputSource.Reset();
+}
+
+void FCodeWriterFileBatch::WriteAll()
+{
+	// Create the directories up front so the writers don't race to create them.
+	TSet<FString> Directories;
+	for (const auto& File : Files)
+	{
+		Directories.Add(FPaths::GetPath(File.Key));
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	for (const FString& Directory : Directories)
+	{
+		PlatformFile.CreateDirectoryTree(*Directory);
+	}
+
+	ParallelFor(Files.Num(), [this](int32 Index)
+	{
+		FFileHelper::SaveStringToFile(Files[Index].Value, *Files[Index].Key);
+	});
+
+	Files.Empty();
+}
+
 void FCodeWriter::Dump()
 {
 	UE_LOG(LogTemp, Warning, TEXT("%s"), *OutputSource);
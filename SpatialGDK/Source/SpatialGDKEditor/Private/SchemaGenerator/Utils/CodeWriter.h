@@ -25,6 +25,20 @@ struct FFunctionSignature
 	}
 };
 
+class FCodeWriter;
+
+// Collects generated files so they can be written to disk together, in parallel, once generation has finished.
+class FCodeWriterFileBatch
+{
+public:
+	// Moves the source written so far out of Writer.
+	void Add(FCodeWriter& Writer, const FString& Filename);
+	void WriteAll();
+
+private:
+	TArray<TPair<FString, FString>> Files;
+};
+
 class FCodeWriter
 {
 public:
@@ -53,6 +67,8 @@ public:
 	FCodeWriter& operator=(const FCodeWriter& other) = delete;
 
 private:
+	friend class FCodeWriterFileBatch;
+
 	FString OutputSource;
 	int Scope;
 };
@@ -21,6 +21,7 @@
 #include "EngineUtils.h"
 #include "HAL/PlatformFile.h"
 #include "HAL/PlatformFilemanager.h"
+#include "Misc/ScopedSlowTask.h"
 #include "UObject/UObjectIterator.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -28,6 +29,8 @@
 
 using namespace SpatialGDK;
 
+#define LOCTEXT_NAMESPACE "SpatialGDKSnapshotGenerator"
+
 DEFINE_LOG_CATEGORY(LogSpatialGDKSnapshot);
 
 TArray<Worker_ComponentData> UnpackedComponentData;
@@ -210,26 +213,46 @@ bool ValidateAndCreateSnapshotGenerationPath(FString& SavePath)
 	return true;
 }
 
-bool RunUserSnapshotGenerationOverrides(Worker_SnapshotOutputStream* OutputStream, Worker_EntityId& NextAvailableEntityID)
+TArray<UClass*> GetUserSnapshotGenerationClasses()
 {
+	TArray<UClass*> SnapshotGenerationClasses;
 	for (TObjectIterator<UClass> SnapshotGenerationClass; SnapshotGenerationClass; ++SnapshotGenerationClass)
 	{
 		if (SnapshotGenerationClass->IsChildOf(USnapshotGenerationTemplate::StaticClass()) && *SnapshotGenerationClass != USnapshotGenerationTemplate::StaticClass())
 		{
 			UE_LOG(LogSpatialGDKSnapshot, Log, TEXT("Found user snapshot generation class: %s"), *SnapshotGenerationClass->GetName());
-			USnapshotGenerationTemplate *SnapshotGenerationObj = NewObject<USnapshotGenerationTemplate>(GetTransientPackage(), *SnapshotGenerationClass);
-			if (!SnapshotGenerationObj->WriteToSnapshotOutput(OutputStream, NextAvailableEntityID))
-			{
-				UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Failure returned in user snapshot generation override method from class: %s"), *SnapshotGenerationClass->GetName());
-				return false;
-			}
+			SnapshotGenerationClasses.Add(*SnapshotGenerationClass);
+		}
+	}
+	return SnapshotGenerationClasses;
+}
+
+bool RunUserSnapshotGenerationOverrides(Worker_SnapshotOutputStream* OutputStream, Worker_EntityId& NextAvailableEntityID, const TArray<UClass*>& SnapshotGenerationClasses, FScopedSlowTask& Progress)
+{
+	for (UClass* SnapshotGenerationClass : SnapshotGenerationClasses)
+	{
+		Progress.EnterProgressFrame(1.f, FText::Format(LOCTEXT("RunUserSnapshotGeneration", "Writing {0} to snapshot..."), FText::FromString(SnapshotGenerationClass->GetName())));
+
+		USnapshotGenerationTemplate *SnapshotGenerationObj = NewObject<USnapshotGenerationTemplate>(GetTransientPackage(), SnapshotGenerationClass);
+		if (!SnapshotGenerationObj->WriteToSnapshotOutput(OutputStream, NextAvailableEntityID))
+		{
+			UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Failure returned in user snapshot generation override method from class: %s"), *SnapshotGenerationClass->GetName());
+			return false;
 		}
+
+		UE_LOG(LogSpatialGDKSnapshot, Log, TEXT("User snapshot generation class %s done, next available entity ID: %lld"), *SnapshotGenerationClass->GetName(), NextAvailableEntityID);
 	}
 	return true;
 }
 
 bool FillSnapshot(Worker_SnapshotOutputStream* OutputStream, UWorld* World)
 {
+	const TArray<UClass*> SnapshotGenerationClasses = GetUserSnapshotGenerationClasses();
+
+	// One frame for the GDK's own entities, then one per user snapshot generation class, which is where large maps spend their time.
+	FScopedSlowTask Progress(1.f + SnapshotGenerationClasses.Num(), LOCTEXT("FillSnapshot", "Generating snapshot..."));
+	Progress.EnterProgressFrame(1.f);
+
 	if (!CreateSpawnerEntity(OutputStream))
 	{
 		UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Error generating Spawner in snapshot: %s"), UTF8_TO_TCHAR(Worker_SnapshotOutputStream_GetState(OutputStream).error_message));
@@ -249,7 +272,7 @@ bool FillSnapshot(Worker_SnapshotOutputStream* OutputStream, UWorld* World)
 	}
 
 	Worker_EntityId NextAvailableEntityID = SpatialConstants::FIRST_AVAILABLE_ENTITY_ID;
-	if (!RunUserSnapshotGenerationOverrides(OutputStream, NextAvailableEntityID))
+	if (!RunUserSnapshotGenerationOverrides(OutputStream, NextAvailableEntityID, SnapshotGenerationClasses, Progress))
 	{
 		UE_LOG(LogSpatialGDKSnapshot, Error, TEXT("Error running user defined snapshot generation overrides in snapshot: %s"), UTF8_TO_TCHAR(Worker_SnapshotOutputStream_GetState(OutputStream).error_message));
 		return false;
@@ -287,3 +310,5 @@ bool SpatialGDKGenerateSnapshot(UWorld* World, FString SnapshotPath)
 
 	return bSuccess;
 }
+
+#undef LOCTEXT_NAMESPACE
@@ -2,13 +2,16 @@
 
 #include "SpatialGDKDefaultLaunchConfigGenerator.h"
 
+#include "EditorExtension/GridLBStrategyEditorExtension.h"
 #include "EditorExtension/LBStrategyEditorExtension.h"
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "LoadBalancing/AbstractLBStrategy.h"
+#include "LoadBalancing/GridBasedLBStrategy.h"
 #include "SpatialGDKEditorModule.h"
 #include "SpatialGDKSettings.h"
 #include "SpatialGDKEditorSettings.h"
 #include "SpatialRuntimeLoadBalancingStrategies.h"
+#include "Utils/GridLoadProfile.h"
 
 #include "Editor.h"
 #include "ISettingsModule.h"
@@ -93,6 +96,31 @@ bool WriteLoadbalancingSection(TSharedRef<TJsonWriter<>> Writer, const FName& Wo
 	return true;
 }
 
+bool IsActorOfAnyClass(const AActor& Actor, const TSet<TSoftClassPtr<AActor>>& ActorClasses)
+{
+	for (const TSoftClassPtr<AActor>& ActorClass : ActorClasses)
+	{
+		// The classes of placed actors are loaded, so unloaded classes can't match.
+		if (ActorClass.IsValid() && Actor.IsA(ActorClass.Get()))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool IsActorInAnyWorkerLayer(const AActor& Actor, const ASpatialWorldSettings& WorldSettings)
+{
+	for (const auto& Layer : WorldSettings.WorkerLayers)
+	{
+		if (IsActorOfAnyClass(Actor, Layer.Value.ActorClasses))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 } // anonymous namespace
 
 void SetLevelEditorPlaySettingsWorkerType(const FWorkerTypeLaunchSection& InWorker)
@@ -168,6 +196,73 @@ uint32 GetWorkerCountFromWorldSettings(const UWorld& World)
 	return NumWorkers;
 }
 
+void ApplyLoadBasedGridLayoutsFromWorldSettings(UWorld& World)
+{
+	const USpatialGDKEditorSettings* SpatialGDKEditorSettings = GetDefault<USpatialGDKEditorSettings>();
+	const ASpatialWorldSettings* WorldSettings = Cast<ASpatialWorldSettings>(World.GetWorldSettings());
+
+	if (!SpatialGDKEditorSettings->bSizeGridStrategiesFromLoad || WorldSettings == nullptr || !WorldSettings->bEnableMultiWorker)
+	{
+		return;
+	}
+
+	// The layers using each grid strategy, with nullptr for the default layer.
+	TMap<UClass*, TArray<const FLayerInfo*>> GridStrategyLayers;
+	if (WorldSettings->DefaultLayerLoadBalanceStrategy != nullptr && WorldSettings->DefaultLayerLoadBalanceStrategy->IsChildOf<UGridBasedLBStrategy>())
+	{
+		GridStrategyLayers.FindOrAdd(WorldSettings->DefaultLayerLoadBalanceStrategy).Add(nullptr);
+	}
+	for (const auto& Layer : WorldSettings->WorkerLayers)
+	{
+		if (Layer.Value.LoadBalanceStrategy != nullptr && Layer.Value.LoadBalanceStrategy->IsChildOf<UGridBasedLBStrategy>())
+		{
+			GridStrategyLayers.FindOrAdd(Layer.Value.LoadBalanceStrategy).Add(&Layer.Value);
+		}
+	}
+
+	if (GridStrategyLayers.Num() == 0)
+	{
+		return;
+	}
+
+	FGridLoadProfile RecordedProfile;
+	const FString& ProfilePath = SpatialGDKEditorSettings->GridLoadProfilePath.FilePath;
+	const bool bUseRecordedProfile = !ProfilePath.IsEmpty();
+	if (bUseRecordedProfile && !FGridLoadProfile::LoadFromFile(ProfilePath, RecordedProfile))
+	{
+		return;
+	}
+
+	for (const auto& GridStrategy : GridStrategyLayers)
+	{
+		const TArray<const FLayerInfo*>& Layers = GridStrategy.Value;
+
+		// A recorded profile has no class information, so every layer gets all of it. Otherwise only the actors of the layers
+		// using the strategy count.
+		const FGridLoadProfile Profile = bUseRecordedProfile ? RecordedProfile : FGridLoadProfile::FromActorDensity(World, [WorldSettings, &Layers](const AActor& Actor)
+		{
+			const bool bInDefaultLayer = IsActorOfAnyClass(Actor, WorldSettings->ExplicitDefaultActorClasses) || !IsActorInAnyWorkerLayer(Actor, *WorldSettings);
+			for (const FLayerInfo* Layer : Layers)
+			{
+				if (Layer == nullptr ? bInDefaultLayer : (!bInDefaultLayer && IsActorOfAnyClass(Actor, Layer->ActorClasses)))
+				{
+					return true;
+				}
+			}
+			return false;
+		});
+
+		if (Profile.Samples.Num() == 0)
+		{
+			UE_LOG(LogSpatialGDKDefaultLaunchConfigGenerator, Warning, TEXT("The load profile of %s on map %s is empty, keeping its layout."), *GridStrategy.Key->GetName(), *World.GetMapName());
+			continue;
+		}
+
+		FGridLBStrategyEditorExtension::ApplyLoadBasedLayout(GridStrategy.Key->GetDefaultObject<UGridBasedLBStrategy>(), Profile,
+			SpatialGDKEditorSettings->MaxGridWorkers, SpatialGDKEditorSettings->GridTargetLoadPerWorker);
+	}
+}
+
 bool TryGetLoadBalancingStrategyFromWorldSettings(const UWorld& World, UAbstractRuntimeLoadBalancingStrategy*& OutStrategy, FIntPoint& OutWorldDimension)
 {
 	const ASpatialWorldSettings* WorldSettings = Cast<ASpatialWorldSettings>(World.GetWorldSettings());
@@ -208,6 +303,8 @@ bool FillWorkerConfigurationFromCurrentMap(FWorkerTypeLaunchSection& OutWorker,
 	UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
 	check(EditorWorld != nullptr);
 
+	ApplyLoadBasedGridLayoutsFromWorldSettings(*EditorWorld);
+
 	OutWorker = SpatialGDKEditorSettings->LaunchConfigDesc.ServerWorkerConfig;
 	OutWorker.NumEditorInstances = GetWorkerCountFromWorldSettings(*EditorWorld);
 
@@ -11,6 +11,7 @@
 #include "UnrealEdMisc.h"
 
 #include "SpatialGDKEditorModule.h"
+#include "SpatialGDKEditorSettings.h"
 #include "SpatialGDKServicesConstants.h"
 #include "SpatialGDKServicesModule.h"
 #include "SpatialGDKSettings.h"
@@ -60,27 +61,109 @@ void FSpatialGDKPackageAssembly::UploadAssembly(const FString& AssemblyName, boo
 	LaunchTask(SpatialGDKServicesConstants::SpatialExe, Args, WorkingDir);
 }
 
+void FSpatialGDKPackageAssembly::HashArtifactsAndUploadAssembly()
+{
+	bIsHashingArtifacts = true;
+	UploadProgressDetails = TEXT("hashing worker archives");
+	SetStepState(EPackageAssemblyStep::UPLOAD_ASSEMBLY, EPackageAssemblyStepState::RUNNING);
+
+	// The worker archives can be several GB, so hash them on the thread pool rather than stalling the editor.
+	const FString WorkerFolder = GetDefault<USpatialGDKEditorSettings>()->GetBuiltWorkerFolder();
+	Async(EAsyncExecution::ThreadPool, [this, WorkerFolder]()
+	{
+		FAssemblyArtifactHashes Hashes = FAssemblyArtifactHashes::HashArchives(WorkerFolder);
+		AsyncTask(ENamedThreads::GameThread, [this, Hashes = MoveTemp(Hashes)]() mutable
+		{
+			OnArtifactsHashed(MoveTemp(Hashes));
+		});
+	});
+}
+
+void FSpatialGDKPackageAssembly::OnArtifactsHashed(FAssemblyArtifactHashes&& InArtifactHashes)
+{
+	bIsHashingArtifacts = false;
+	if (Status == EPackageAssemblyStatus::CANCELED)
+	{
+		return;
+	}
+
+	ArtifactHashes = MoveTemp(InArtifactHashes);
+
+	FAssemblyArtifactHashes UploadedArtifactHashes;
+	const bool bWasUploaded = FAssemblyArtifactHashes::LoadFromCache(GetUploadedAssemblyCachePath(), GetUploadedAssemblyCacheKey(), UploadedArtifactHashes);
+
+	const TArray<FString> ChangedArchives = ArtifactHashes.GetChangedArchives(UploadedArtifactHashes);
+	for (const TPair<FString, FString>& Artifact : ArtifactHashes.Hashes)
+	{
+		UE_LOG(LogSpatialGDKEditorPackageAssembly, Display, TEXT("Worker archive %s %s since the last upload of assembly %s."),
+			*Artifact.Key, ChangedArchives.Contains(Artifact.Key) ? TEXT("changed") : TEXT("is unchanged"), *CloudDeploymentConfiguration.AssemblyName);
+	}
+
+	if (bWasUploaded && ArtifactHashes.IsUnchangedFrom(UploadedArtifactHashes) && CloudDeploymentConfiguration.bSkipUnchangedAssemblyUpload)
+	{
+		UploadProgressDetails = TEXT("unchanged since the last upload");
+		SetStepState(EPackageAssemblyStep::UPLOAD_ASSEMBLY, EPackageAssemblyStepState::SKIPPED);
+		OnAllStepsCompleted();
+		return;
+	}
+
+	UploadProgressDetails = FString::Printf(TEXT("%d of %d worker archives changed"), ChangedArchives.Num(), ArtifactHashes.Hashes.Num());
+	SetStepState(EPackageAssemblyStep::UPLOAD_ASSEMBLY, EPackageAssemblyStepState::RUNNING);
+	UploadAssembly(CloudDeploymentConfiguration.AssemblyName, CloudDeploymentConfiguration.bForceAssemblyOverwrite);
+}
+
+FString FSpatialGDKPackageAssembly::GetUploadedAssemblyCachePath()
+{
+	return FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir()), TEXT("Improbable/UploadedAssemblies.json"));
+}
+
+FString FSpatialGDKPackageAssembly::GetUploadedAssemblyCacheKey() const
+{
+	return FString::Printf(TEXT("%s%s/%s"), CloudDeploymentConfiguration.bUseChinaPlatform ? TEXT("cn/") : TEXT(""), *FSpatialGDKServicesModule::GetProjectName(), *CloudDeploymentConfiguration.AssemblyName);
+}
+
+void FSpatialGDKPackageAssembly::SaveUploadedArtifactHashes() const
+{
+	if (!ArtifactHashes.SaveToCache(GetUploadedAssemblyCachePath(), GetUploadedAssemblyCacheKey()))
+	{
+		UE_LOG(LogSpatialGDKEditorPackageAssembly, Warning, TEXT("Could not save the hashes of the uploaded assembly to %s."), *GetUploadedAssemblyCachePath());
+	}
+}
+
 void FSpatialGDKPackageAssembly::BuildAndUploadAssembly(const FCloudDeploymentConfiguration& InCloudDeploymentConfiguration)
 {
 	if (CanBuild())
 	{
 		Status = EPackageAssemblyStatus::NONE;
 		CloudDeploymentConfiguration = InCloudDeploymentConfiguration;
+		CurrentStep = EPackageAssemblyStep::NONE;
+		StepProgress.Empty();
+		UploadProgressDetails.Empty();
+		ArtifactHashes.Hashes.Empty();
 
-		Steps.Enqueue(EPackageAssemblyStep::BUILD_SERVER);
+		// The build steps run one at a time, since each runs BuildCookRun on the same project and UnrealBuildTool does not allow
+		// concurrent builds. The archives are hashed in parallel once they are all built.
+		TArray<EPackageAssemblyStep> AssemblySteps;
+		AssemblySteps.Add(EPackageAssemblyStep::BUILD_SERVER);
 		if (CloudDeploymentConfiguration.bBuildClientWorker)
 		{
-			Steps.Enqueue(EPackageAssemblyStep::BUILD_CLIENT);
+			AssemblySteps.Add(EPackageAssemblyStep::BUILD_CLIENT);
 		}
 		if (CloudDeploymentConfiguration.bSimulatedPlayersEnabled)
 		{
-			Steps.Enqueue(EPackageAssemblyStep::BUILD_SIMULATED_PLAYERS);
+			AssemblySteps.Add(EPackageAssemblyStep::BUILD_SIMULATED_PLAYERS);
+		}
+		AssemblySteps.Add(EPackageAssemblyStep::UPLOAD_ASSEMBLY);
+
+		for (EPackageAssemblyStep Step : AssemblySteps)
+		{
+			Steps.Enqueue(Step);
+			StepProgress.Add(FStepProgress{ Step, EPackageAssemblyStepState::PENDING });
 		}
-		Steps.Enqueue(EPackageAssemblyStep::UPLOAD_ASSEMBLY);
 
 		AsyncTask(ENamedThreads::GameThread, [this]()
 		{
-			ShowTaskStartedNotification(TEXT("Building Assembly"));
+			ShowTaskStartedNotification(FString::Printf(TEXT("Building Assembly\n%s"), *GetProgressText()));
 			NextStep();
 		});
 	}
@@ -98,30 +181,34 @@ bool FSpatialGDKPackageAssembly::NextStep()
 	if (Steps.Dequeue(Target))
 	{
 		bHasStepsRemaining = true;
+		CurrentStep = Target;
 		switch (Target)
 		{
 		case EPackageAssemblyStep::BUILD_SERVER:
 			AsyncTask(ENamedThreads::GameThread, [this]()
 			{
+				SetStepState(EPackageAssemblyStep::BUILD_SERVER, EPackageAssemblyStepState::RUNNING);
 				BuildAssembly(FString::Printf(TEXT("%sServer"), FApp::GetProjectName()), LinuxPlatform, CloudDeploymentConfiguration.BuildConfiguration, CloudDeploymentConfiguration.BuildServerExtraArgs);
 			});
 			break;
 		case EPackageAssemblyStep::BUILD_CLIENT:
 			AsyncTask(ENamedThreads::GameThread, [this]()
 			{
+				SetStepState(EPackageAssemblyStep::BUILD_CLIENT, EPackageAssemblyStepState::RUNNING);
 				BuildAssembly(FApp::GetProjectName(), Win64Platform, CloudDeploymentConfiguration.BuildConfiguration, CloudDeploymentConfiguration.BuildClientExtraArgs);
 			});
 			break;
 		case EPackageAssemblyStep::BUILD_SIMULATED_PLAYERS:
 			AsyncTask(ENamedThreads::GameThread, [this]()
 			{
+				SetStepState(EPackageAssemblyStep::BUILD_SIMULATED_PLAYERS, EPackageAssemblyStepState::RUNNING);
 				BuildAssembly(FString::Printf(TEXT("%sSimulatedPlayer"), FApp::GetProjectName()), LinuxPlatform, CloudDeploymentConfiguration.BuildConfiguration, CloudDeploymentConfiguration.BuildSimulatedPlayerExtraArgs);
 			});
 			break;
 		case EPackageAssemblyStep::UPLOAD_ASSEMBLY:
 			AsyncTask(ENamedThreads::GameThread, [this]()
 			{
-				UploadAssembly(CloudDeploymentConfiguration.AssemblyName, CloudDeploymentConfiguration.bForceAssemblyOverwrite);
+				HashArtifactsAndUploadAssembly();
 			});
 			break;
 		default:
@@ -133,23 +220,32 @@ bool FSpatialGDKPackageAssembly::NextStep()
 
 void FSpatialGDKPackageAssembly::OnTaskCompleted(int32 TaskResult)
 {
+	const EPackageAssemblyStep CompletedStep = CurrentStep;
 	if (TaskResult == 0)
 	{
+		AsyncTask(ENamedThreads::GameThread, [this, CompletedStep]()
+		{
+			if (CompletedStep == EPackageAssemblyStep::UPLOAD_ASSEMBLY)
+			{
+				SaveUploadedArtifactHashes();
+			}
+			SetStepState(CompletedStep, EPackageAssemblyStepState::SUCCEEDED);
+		});
+
 		if (!NextStep())
 		{
 			AsyncTask(ENamedThreads::GameThread, [this]()
 			{
-				FString NotificationMessage = FString::Printf(TEXT("Assembly successfully uploaded to project: %s"), *FSpatialGDKServicesModule::GetProjectName());
-				ShowTaskEndedNotification(NotificationMessage, SNotificationItem::CS_Success);
-				OnSuccess.ExecuteIfBound();
+				OnAllStepsCompleted();
 			});
 		}
 	}
 	else
 	{
-		AsyncTask(ENamedThreads::GameThread, [this]()
+		AsyncTask(ENamedThreads::GameThread, [this, CompletedStep]()
 		{
-			FString NotificationMessage = FString::Printf(TEXT("Failed assembly upload to project: %s"), *FSpatialGDKServicesModule::GetProjectName());
+			SetStepState(CompletedStep, EPackageAssemblyStepState::FAILED);
+			FString NotificationMessage = FString::Printf(TEXT("Failed assembly upload to project: %s\n%s"), *FSpatialGDKServicesModule::GetProjectName(), *GetProgressText());
 			ShowTaskEndedNotification(NotificationMessage, SNotificationItem::CS_Fail);
 			if (Status == EPackageAssemblyStatus::ASSEMBLY_EXISTS)
 			{
@@ -168,6 +264,20 @@ void FSpatialGDKPackageAssembly::OnTaskCompleted(int32 TaskResult)
 	}
 }
 
+void FSpatialGDKPackageAssembly::OnAllStepsCompleted()
+{
+	const bool bUploadSkipped = StepProgress.ContainsByPredicate([](const FStepProgress& Progress)
+	{
+		return Progress.Step == EPackageAssemblyStep::UPLOAD_ASSEMBLY && Progress.State == EPackageAssemblyStepState::SKIPPED;
+	});
+
+	FString NotificationMessage = bUploadSkipped
+		? FString::Printf(TEXT("Assembly is unchanged, using the assembly previously uploaded to project: %s"), *FSpatialGDKServicesModule::GetProjectName())
+		: FString::Printf(TEXT("Assembly successfully uploaded to project: %s"), *FSpatialGDKServicesModule::GetProjectName());
+	ShowTaskEndedNotification(FString::Printf(TEXT("%s\n%s"), *NotificationMessage, *GetProgressText()), SNotificationItem::CS_Success);
+	OnSuccess.ExecuteIfBound();
+}
+
 void FSpatialGDKPackageAssembly::OnTaskOutput(FString Message)
 {
 	//UNR-3486 parse for assembly name conflict so we can display a message to the user
@@ -196,10 +306,85 @@ void FSpatialGDKPackageAssembly::OnTaskCanceled()
 
 void FSpatialGDKPackageAssembly::HandleCancelButtonClicked()
 {
-	if (PackageAssemblyTask.IsValid())
+	if (PackageAssemblyTask.IsValid() && PackageAssemblyTask->IsRunning())
 	{
 		PackageAssemblyTask->Cancel(true);
 	}
+	else if (bIsHashingArtifacts)
+	{
+		// No process is running while the worker archives are hashed.
+		OnTaskCanceled();
+	}
+}
+
+void FSpatialGDKPackageAssembly::SetStepState(EPackageAssemblyStep Step, EPackageAssemblyStepState State)
+{
+	check(IsInGameThread());
+
+	for (FStepProgress& Progress : StepProgress)
+	{
+		if (Progress.Step == Step)
+		{
+			Progress.State = State;
+		}
+	}
+
+	TSharedPtr<SNotificationItem> Notification = TaskNotificationPtr.Pin();
+	if (Notification.IsValid() && Notification->GetCompletionState() == SNotificationItem::CS_Pending)
+	{
+		Notification->SetText(FText::AsCultureInvariant(FString::Printf(TEXT("Building Assembly\n%s"), *GetProgressText())));
+	}
+}
+
+FString FSpatialGDKPackageAssembly::GetProgressText() const
+{
+	TArray<FString> Lines;
+	for (const FStepProgress& Progress : StepProgress)
+	{
+		FString Line = FString::Printf(TEXT("%s: %s"), GetStepDisplayName(Progress.Step), GetStepStateDisplayName(Progress.State));
+		if (Progress.Step == EPackageAssemblyStep::UPLOAD_ASSEMBLY && !UploadProgressDetails.IsEmpty())
+		{
+			Line += FString::Printf(TEXT(" (%s)"), *UploadProgressDetails);
+		}
+		Lines.Add(Line);
+	}
+	return FString::Join(Lines, TEXT("\n"));
+}
+
+const TCHAR* FSpatialGDKPackageAssembly::GetStepDisplayName(EPackageAssemblyStep Step)
+{
+	switch (Step)
+	{
+	case EPackageAssemblyStep::BUILD_SERVER:
+		return TEXT("Server worker");
+	case EPackageAssemblyStep::BUILD_CLIENT:
+		return TEXT("Client worker");
+	case EPackageAssemblyStep::BUILD_SIMULATED_PLAYERS:
+		return TEXT("Simulated player worker");
+	case EPackageAssemblyStep::UPLOAD_ASSEMBLY:
+		return TEXT("Upload");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FSpatialGDKPackageAssembly::GetStepStateDisplayName(EPackageAssemblyStepState State)
+{
+	switch (State)
+	{
+	case EPackageAssemblyStepState::PENDING:
+		return TEXT("pending");
+	case EPackageAssemblyStepState::RUNNING:
+		return TEXT("in progress");
+	case EPackageAssemblyStepState::SUCCEEDED:
+		return TEXT("done");
+	case EPackageAssemblyStepState::SKIPPED:
+		return TEXT("skipped");
+	case EPackageAssemblyStepState::FAILED:
+		return TEXT("failed");
+	default:
+		return TEXT("unknown");
+	}
 }
 
 void FSpatialGDKPackageAssembly::ShowTaskStartedNotification(const FString& NotificationText)
@@ -0,0 +1,120 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/AssemblyArtifactHashes.h"
+
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialGDKAssemblyArtifactHashes);
+
+namespace
+{
+TSharedPtr<FJsonObject> LoadCache(const FString& CachePath)
+{
+	FString Contents;
+	if (!FFileHelper::LoadFileToString(Contents, *CachePath))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Contents);
+	if (!FJsonSerializer::Deserialize(JsonReader, RootObject) || !RootObject.IsValid())
+	{
+		UE_LOG(LogSpatialGDKAssemblyArtifactHashes, Warning, TEXT("Could not parse %s, the assembly will be uploaded."), *CachePath);
+		return nullptr;
+	}
+	return RootObject;
+}
+} // anonymous namespace
+
+FAssemblyArtifactHashes FAssemblyArtifactHashes::HashArchives(const FString& Folder)
+{
+	// Every archive in the folder is part of the uploaded assembly, including ones left over from previous builds.
+	TArray<FString> ArchiveNames;
+	IFileManager::Get().FindFiles(ArchiveNames, *FPaths::Combine(Folder, TEXT("*.zip")), /* Files */ true, /* Directories */ false);
+
+	TArray<FString> Hashes;
+	Hashes.SetNum(ArchiveNames.Num());
+	ParallelFor(ArchiveNames.Num(), [&Folder, &ArchiveNames, &Hashes](int32 Index)
+	{
+		const FMD5Hash Hash = FMD5Hash::HashFile(*FPaths::Combine(Folder, ArchiveNames[Index]));
+		if (Hash.IsValid())
+		{
+			Hashes[Index] = LexToString(Hash);
+		}
+	});
+
+	FAssemblyArtifactHashes Result;
+	for (int32 Index = 0; Index < ArchiveNames.Num(); Index++)
+	{
+		Result.Hashes.Add(ArchiveNames[Index], Hashes[Index]);
+	}
+	return Result;
+}
+
+bool FAssemblyArtifactHashes::LoadFromCache(const FString& CachePath, const FString& Key, FAssemblyArtifactHashes& OutArtifactHashes)
+{
+	const TSharedPtr<FJsonObject> RootObject = LoadCache(CachePath);
+	const TSharedPtr<FJsonObject>* AssemblyObject;
+	if (!RootObject.IsValid() || !RootObject->TryGetObjectField(Key, AssemblyObject))
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*AssemblyObject)->Values)
+	{
+		FString Hash;
+		if (Field.Value.IsValid() && Field.Value->TryGetString(Hash))
+		{
+			OutArtifactHashes.Hashes.Add(Field.Key, Hash);
+		}
+	}
+	return true;
+}
+
+bool FAssemblyArtifactHashes::SaveToCache(const FString& CachePath, const FString& Key) const
+{
+	TSharedPtr<FJsonObject> RootObject = LoadCache(CachePath);
+	if (!RootObject.IsValid())
+	{
+		RootObject = MakeShared<FJsonObject>();
+	}
+
+	TSharedPtr<FJsonObject> AssemblyObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FString>& Artifact : Hashes)
+	{
+		AssemblyObject->SetStringField(Artifact.Key, Artifact.Value);
+	}
+	RootObject->SetObjectField(Key, AssemblyObject);
+
+	FString Contents;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&Contents);
+	return FJsonSerializer::Serialize(RootObject.ToSharedRef(), JsonWriter) && FFileHelper::SaveStringToFile(Contents, *CachePath);
+}
+
+TArray<FString> FAssemblyArtifactHashes::GetChangedArchives(const FAssemblyArtifactHashes& Uploaded) const
+{
+	TArray<FString> ChangedArchives;
+	for (const TPair<FString, FString>& Artifact : Hashes)
+	{
+		const FString* UploadedHash = Uploaded.Hashes.Find(Artifact.Key);
+		if (Artifact.Value.IsEmpty() || UploadedHash == nullptr || *UploadedHash != Artifact.Value)
+		{
+			ChangedArchives.Add(Artifact.Key);
+		}
+	}
+	return ChangedArchives;
+}
+
+bool FAssemblyArtifactHashes::IsUnchangedFrom(const FAssemblyArtifactHashes& Uploaded) const
+{
+	return Hashes.Num() > 0 && Hashes.Num() == Uploaded.Hashes.Num() && GetChangedArchives(Uploaded).Num() == 0;
+}
@@ -0,0 +1,193 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/GridLoadProfile.h"
+
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialGDKGridLoadProfile);
+
+namespace
+{
+int32 GetCellCoordinate(float Value, float GridMin, float CellSize, uint32 NumCells)
+{
+	return FMath::Clamp(FMath::FloorToInt((Value - GridMin) / CellSize), 0, static_cast<int32>(NumCells) - 1);
+}
+
+// How far the cells of a layout are from being square, 0 for square cells.
+float GetCellAspectError(float WorldWidth, float WorldHeight, uint32 Rows, uint32 Cols)
+{
+	const float CellWidth = WorldWidth / Cols;
+	const float CellHeight = WorldHeight / Rows;
+	return FMath::Abs(FMath::Loge(CellWidth / CellHeight));
+}
+
+bool IsBetterLayout(const FGridLayoutProposal& Candidate, float CandidateAspectError, const FGridLayoutProposal& Best, float BestAspectError)
+{
+	if (!FMath::IsNearlyEqual(Candidate.MaxCellLoad, Best.MaxCellLoad))
+	{
+		return Candidate.MaxCellLoad < Best.MaxCellLoad;
+	}
+	if (Candidate.GetNumWorkers() != Best.GetNumWorkers())
+	{
+		return Candidate.GetNumWorkers() < Best.GetNumWorkers();
+	}
+	return CandidateAspectError < BestAspectError;
+}
+
+// Finds the rows and columns with the least loaded busiest cell for the given number of workers.
+FGridLayoutProposal ProposeGridLayoutForWorkerCount(const FGridLoadProfile& Profile, float WorldWidth, float WorldHeight, uint32 NumWorkers)
+{
+	FGridLayoutProposal Best;
+	float BestAspectError = TNumericLimits<float>::Max();
+	bool bHasBest = false;
+
+	for (uint32 Rows = 1; Rows <= NumWorkers; ++Rows)
+	{
+		if (NumWorkers % Rows != 0)
+		{
+			continue;
+		}
+
+		FGridLayoutProposal Candidate;
+		Candidate.Rows = Rows;
+		Candidate.Cols = NumWorkers / Rows;
+		Candidate.MaxCellLoad = GetMaxGridCellLoad(Profile, WorldWidth, WorldHeight, Candidate.Rows, Candidate.Cols);
+		const float CandidateAspectError = GetCellAspectError(WorldWidth, WorldHeight, Candidate.Rows, Candidate.Cols);
+
+		if (!bHasBest || IsBetterLayout(Candidate, CandidateAspectError, Best, BestAspectError))
+		{
+			Best = Candidate;
+			BestAspectError = CandidateAspectError;
+			bHasBest = true;
+		}
+	}
+
+	return Best;
+}
+} // anonymous namespace
+
+bool FGridLoadProfile::LoadFromFile(const FString& FilePath, FGridLoadProfile& OutProfile)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+	{
+		UE_LOG(LogSpatialGDKGridLoadProfile, Error, TEXT("Could not read grid load profile %s."), *FilePath);
+		return false;
+	}
+
+	OutProfile.Samples.Empty(Lines.Num());
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		const FString Line = Lines[LineIndex].TrimStartAndEnd();
+		if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+		{
+			continue;
+		}
+
+		TArray<FString> Fields;
+		Line.ParseIntoArray(Fields, TEXT(","));
+		if (Fields.Num() != 3 || !Fields[0].TrimStartAndEnd().IsNumeric() || !Fields[1].TrimStartAndEnd().IsNumeric() || !Fields[2].TrimStartAndEnd().IsNumeric())
+		{
+			// Allow a header line.
+			if (LineIndex != 0)
+			{
+				UE_LOG(LogSpatialGDKGridLoadProfile, Warning, TEXT("Ignoring line %d of grid load profile %s, expected \"X,Y,Load\": %s"), LineIndex + 1, *FilePath, *Line);
+			}
+			continue;
+		}
+
+		FSample Sample;
+		Sample.Location = FVector2D(FCString::Atof(*Fields[0]), FCString::Atof(*Fields[1]));
+		Sample.Load = FCString::Atof(*Fields[2]);
+		if (Sample.Load > 0.f)
+		{
+			OutProfile.Samples.Add(Sample);
+		}
+	}
+
+	return true;
+}
+
+FGridLoadProfile FGridLoadProfile::FromActorDensity(UWorld& World, TFunctionRef<bool(const AActor&)> ActorFilter)
+{
+	FGridLoadProfile Profile;
+	for (TActorIterator<AActor> It(&World); It; ++It)
+	{
+		const AActor* Actor = *It;
+		if (Actor->GetIsReplicated() && !Actor->IsEditorOnly() && ActorFilter(*Actor))
+		{
+			const FVector Location = Actor->GetActorLocation();
+			Profile.Samples.Add(FSample{ FVector2D(Location.X, Location.Y), 1.f });
+		}
+	}
+	return Profile;
+}
+
+float FGridLoadProfile::GetTotalLoad() const
+{
+	float TotalLoad = 0.f;
+	for (const FSample& Sample : Samples)
+	{
+		TotalLoad += Sample.Load;
+	}
+	return TotalLoad;
+}
+
+float GetMaxGridCellLoad(const FGridLoadProfile& Profile, float WorldWidth, float WorldHeight, uint32 Rows, uint32 Cols)
+{
+	check(Rows > 0 && Cols > 0);
+
+	TArray<float> CellLoads;
+	CellLoads.SetNumZeroed(Rows * Cols);
+
+	const float RowHeight = WorldHeight / Rows;
+	const float ColumnWidth = WorldWidth / Cols;
+	for (const FGridLoadProfile::FSample& Sample : Profile.Samples)
+	{
+		const int32 Row = GetCellCoordinate(Sample.Location.X, -WorldHeight / 2.f, RowHeight, Rows);
+		const int32 Col = GetCellCoordinate(Sample.Location.Y, -WorldWidth / 2.f, ColumnWidth, Cols);
+		CellLoads[Col * Rows + Row] += Sample.Load;
+	}
+
+	float MaxCellLoad = 0.f;
+	for (float CellLoad : CellLoads)
+	{
+		MaxCellLoad = FMath::Max(MaxCellLoad, CellLoad);
+	}
+	return MaxCellLoad;
+}
+
+FGridLayoutProposal ProposeGridLayout(const FGridLoadProfile& Profile, float WorldWidth, float WorldHeight, uint32 NumWorkers, uint32 MaxWorkers, float TargetLoadPerWorker)
+{
+	MaxWorkers = FMath::Max(MaxWorkers, 1u);
+
+	if (TargetLoadPerWorker <= 0.f)
+	{
+		return ProposeGridLayoutForWorkerCount(Profile, WorldWidth, WorldHeight, FMath::Clamp(NumWorkers, 1u, MaxWorkers));
+	}
+
+	FGridLayoutProposal Best;
+	float BestAspectError = TNumericLimits<float>::Max();
+	for (uint32 Workers = 1; Workers <= MaxWorkers; ++Workers)
+	{
+		const FGridLayoutProposal Candidate = ProposeGridLayoutForWorkerCount(Profile, WorldWidth, WorldHeight, Workers);
+		if (Candidate.MaxCellLoad <= TargetLoadPerWorker)
+		{
+			return Candidate;
+		}
+
+		const float CandidateAspectError = GetCellAspectError(WorldWidth, WorldHeight, Candidate.Rows, Candidate.Cols);
+		if (Workers == 1 || IsBetterLayout(Candidate, CandidateAspectError, Best, BestAspectError))
+		{
+			Best = Candidate;
+			BestAspectError = CandidateAspectError;
+		}
+	}
+
+	UE_LOG(LogSpatialGDKGridLoadProfile, Warning, TEXT("No grid of up to %u workers keeps every cell within a load of %.1f, the busiest cell of the proposed layout has a load of %.1f."),
+		MaxWorkers, TargetLoadPerWorker, Best.MaxCellLoad);
+	return Best;
+}
@@ -34,6 +34,7 @@ struct SPATIALGDKEDITOR_API FCloudDeploymentConfiguration
 	FString BuildConfiguration;
 	bool bBuildClientWorker = false;
 	bool bForceAssemblyOverwrite = false;
+	bool bSkipUnchangedAssemblyUpload = false;
 
 	FString BuildServerExtraArgs;
 	FString BuildClientExtraArgs;
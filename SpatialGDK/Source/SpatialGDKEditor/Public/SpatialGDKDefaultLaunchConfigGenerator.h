@@ -17,6 +17,9 @@ void SPATIALGDKEDITOR_API SetLevelEditorPlaySettingsWorkerType(const FWorkerType
 
 uint32 SPATIALGDKEDITOR_API GetWorkerCountFromWorldSettings(const UWorld& World);
 
+/** Resize the grid based load balancing strategies of the map to balance its expected load, if enabled in the editor settings. */
+void SPATIALGDKEDITOR_API ApplyLoadBasedGridLayoutsFromWorldSettings(UWorld& World);
+
 bool SPATIALGDKEDITOR_API TryGetLoadBalancingStrategyFromWorldSettings(const UWorld& World, UAbstractRuntimeLoadBalancingStrategy*& OutStrategy, FIntPoint& OutWorldDimension);
 
 bool SPATIALGDKEDITOR_API FillWorkerConfigurationFromCurrentMap(FWorkerTypeLaunchSection& OutWorker, FIntPoint& OutWorldDimensions);
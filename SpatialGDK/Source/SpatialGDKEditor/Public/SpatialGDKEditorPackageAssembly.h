@@ -6,6 +6,7 @@
 #include "Widgets/Notifications/SNotificationList.h"
 
 #include "CloudDeploymentConfiguration.h"
+#include "Utils/AssemblyArtifactHashes.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKEditorPackageAssembly, Log, All);
 
@@ -40,9 +41,30 @@ private:
 		ASSEMBLY_EXISTS,
 	};
 
+	enum class EPackageAssemblyStepState
+	{
+		PENDING = 0,
+		RUNNING,
+		SUCCEEDED,
+		SKIPPED,
+		FAILED,
+	};
+
+	struct FStepProgress
+	{
+		EPackageAssemblyStep Step;
+		EPackageAssemblyStepState State;
+	};
+
 	EPackageAssemblyStatus Status = EPackageAssemblyStatus::NONE;
 
 	TQueue<EPackageAssemblyStep> Steps;
+	EPackageAssemblyStep CurrentStep = EPackageAssemblyStep::NONE;
+	TArray<FStepProgress> StepProgress;
+	FString UploadProgressDetails;
+
+	FAssemblyArtifactHashes ArtifactHashes;
+	bool bIsHashingArtifacts = false;
 
 	TSharedPtr<FMonitoredProcess> PackageAssemblyTask;
 	TWeakPtr<SNotificationItem> TaskNotificationPtr;
@@ -53,13 +75,25 @@ private:
 
 	void BuildAssembly(const FString& ProjectName, const FString& Platform, const FString& Configuration, const FString& AdditionalArgs);
 	void UploadAssembly(const FString& AssemblyName, bool bForceAssemblyOverwrite);
+	void HashArtifactsAndUploadAssembly();
+	void OnArtifactsHashed(FAssemblyArtifactHashes&& InArtifactHashes);
+
+	static FString GetUploadedAssemblyCachePath();
+	FString GetUploadedAssemblyCacheKey() const;
+	void SaveUploadedArtifactHashes() const;
 
 	bool NextStep();
 
+	void SetStepState(EPackageAssemblyStep Step, EPackageAssemblyStepState State);
+	FString GetProgressText() const;
+	static const TCHAR* GetStepDisplayName(EPackageAssemblyStep Step);
+	static const TCHAR* GetStepStateDisplayName(EPackageAssemblyStepState State);
+
 	void ShowTaskStartedNotification(const FString& NotificationText);
 	void ShowTaskEndedNotification(const FString& NotificationText, SNotificationItem::ECompletionState CompletionState);
 	void HandleCancelButtonClicked();
 	void OnTaskCompleted(int32 TaskResult);
+	void OnAllStepsCompleted();
 	void OnTaskOutput(FString Message);
 	void OnTaskCanceled();
 };
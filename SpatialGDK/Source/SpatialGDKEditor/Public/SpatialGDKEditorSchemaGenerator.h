@@ -18,6 +18,8 @@ namespace SpatialGDKEditor
 		
 		SPATIALGDKEDITOR_API bool SpatialGDKGenerateSchemaForClasses(TSet<UClass*> Classes, FString SchemaOutputPath = "");
 
+		SPATIALGDKEDITOR_API FString GenerateSerializerSourceForClass(UClass* Class, int32& OutNumProperties);
+
 		SPATIALGDKEDITOR_API void GenerateSchemaForSublevels();
 
 		SPATIALGDKEDITOR_API void GenerateSchemaForSublevels(const FString& SchemaOutputPath, const TMultiMap<FName, FName>& LevelNamesToPaths);
@@ -51,5 +53,7 @@ namespace SpatialGDKEditor
 		SPATIALGDKEDITOR_API void CopyWellKnownSchemaFiles(const FString& GDKSchemaCopyDir, const FString& CoreSDKSchemaCopyDir);
 		
 		SPATIALGDKEDITOR_API bool RunSchemaCompiler();
+
+		SPATIALGDKEDITOR_API bool RunSchemaCompilerIfSchemaChanged();
 	}
 }
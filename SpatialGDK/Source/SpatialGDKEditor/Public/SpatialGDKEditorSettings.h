@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/EngineTypes.h"
+#include "Misc/App.h"
 #include "Misc/Paths.h"
 #include "UObject/Package.h"
 
@@ -336,6 +337,30 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (DisplayName = "Auto-start local deployment"))
 	bool bAutoStartLocalDeployment;
 
+	/** Keep the local deployment running between automation tests that use PIE, instead of stopping it after each one. It is still restarted when its launch configuration, schema or worker configurations change. */
+	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (DisplayName = "Keep local deployment between automation tests"))
+	bool bKeepLocalDeploymentBetweenAutomationTests;
+
+	/**
+	 * When generating a launch configuration, set the rows and columns of the map's grid based load balancing strategies to a layout
+	 * that balances the expected load of the map between workers. The change is made to the strategy's class defaults, save the
+	 * strategy to keep it.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (DisplayName = "Size grid strategies from expected load"))
+	bool bSizeGridStrategiesFromLoad;
+
+	/** Recorded load with one "X,Y,Load" sample per line, in Unreal units. If empty, each replicated actor placed in the map counts as one unit of load. */
+	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (EditCondition = "bSizeGridStrategiesFromLoad", DisplayName = "Grid load profile", FilePathFilter = "csv"))
+	FFilePath GridLoadProfilePath;
+
+	/** The load a single server should handle. If 0, the strategy's number of workers is kept and only its rows and columns change. */
+	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (EditCondition = "bSizeGridStrategiesFromLoad", DisplayName = "Grid target load per worker", ClampMin = "0"))
+	float GridTargetLoadPerWorker;
+
+	/** The most workers a grid sized from the expected load can use. */
+	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (EditCondition = "bSizeGridStrategiesFromLoad", DisplayName = "Maximum grid workers", ClampMin = "1"))
+	uint32 MaxGridWorkers;
+
 private:
 	/** Name of your SpatialOS snapshot file that will be generated. */
 	UPROPERTY(EditAnywhere, config, Category = "Snapshots", meta = (DisplayName = "Snapshot to save"))
@@ -351,6 +376,17 @@ private:
 	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (Tooltip = "Additional arguments passed to Cook And Generate Schema"))
 	FString CookAndGenerateAdditionalArguments;
 
+	/**
+	 * Classes to generate C++ serializers for when generating schema, such as characters and projectiles. Their numeric, enum and
+	 * native bool replicated properties are then written and read by functions compiled for their type instead of resolved at runtime.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (DisplayName = "Classes with generated serializers"))
+	TArray<TSoftClassPtr<UObject>> GeneratedSerializerClasses;
+
+	/** Folder in a game module to write the generated serializers to. If empty, Source/<Project>/SpatialGenerated is used. */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (DisplayName = "Generated serializers folder"))
+	FDirectoryPath GeneratedSerializersFolder;
+
 	/** Add flags to the `spatial local launch` command; they alter the deployment’s behavior. Select the trash icon to remove all the flags.*/
 	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (DisplayName = "Command line flags for local launch"))
 	TArray<FString> SpatialOSCommandLineLaunchFlags;
@@ -396,6 +432,13 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Assembly", meta = (DisplayName = "Force Assembly Overwrite"))
 	bool bForceAssemblyOverwrite;
 
+	/**
+	 * Skip the upload when every worker archive has the same content hash as when this assembly name was last uploaded from this project,
+	 * and start the deployment with the uploaded assembly. Disable this if the assembly may have been overwritten from another machine.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Assembly", meta = (DisplayName = "Skip Upload of Unchanged Assembly"))
+	bool bSkipUnchangedAssemblyUpload;
+
 	/** Whether to build client worker as part of the assembly */
 	UPROPERTY(EditAnywhere, config, Category = "Assembly", meta = (DisplayName = "Build Client Worker"))
 	bool bBuildClientWorker;
@@ -528,6 +571,18 @@ public:
 		return FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("schema/unreal/generated/"));
 	}
 
+	FORCEINLINE const TArray<TSoftClassPtr<UObject>>& GetGeneratedSerializerClasses() const
+	{
+		return GeneratedSerializerClasses;
+	}
+
+	FORCEINLINE FString GetGeneratedSerializersFolder() const
+	{
+		return GeneratedSerializersFolder.Path.IsEmpty()
+			? FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::GameSourceDir()), FApp::GetProjectName(), TEXT("SpatialGenerated"))
+			: GeneratedSerializersFolder.Path;
+	}
+
 	FORCEINLINE FString GetBuiltWorkerFolder() const
 	{
 		return FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("build/assembly/worker/"));
@@ -0,0 +1,33 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKAssemblyArtifactHashes, Log, All);
+
+/**
+ * Content hashes of the worker archives of an assembly, keyed by archive file name, used to tell whether an assembly changed since
+ * it was last uploaded.
+ *
+ * The hashes of uploaded assemblies are cached in a JSON file with one object of archive hashes per assembly key.
+ */
+struct SPATIALGDKEDITOR_API FAssemblyArtifactHashes
+{
+	TMap<FString, FString> Hashes;
+
+	// MD5 hashes every .zip archive in Folder, in parallel. Archives which couldn't be read get an empty hash, which never matches.
+	static FAssemblyArtifactHashes HashArchives(const FString& Folder);
+
+	// Returns false if the cache couldn't be read or has no hashes for Key.
+	static bool LoadFromCache(const FString& CachePath, const FString& Key, FAssemblyArtifactHashes& OutArtifactHashes);
+	// Replaces the hashes for Key in the cache, keeping those of other assemblies.
+	bool SaveToCache(const FString& CachePath, const FString& Key) const;
+
+	// The archives which weren't in Uploaded or whose hash differs from it.
+	TArray<FString> GetChangedArchives(const FAssemblyArtifactHashes& Uploaded) const;
+
+	// Whether Uploaded has exactly the same archives with the same hashes. An archive which was uploaded but no longer exists also
+	// changes the assembly.
+	bool IsUnchangedFrom(const FAssemblyArtifactHashes& Uploaded) const;
+};
@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Vector2D.h"
+#include "Templates/Function.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKGridLoadProfile, Log, All);
+
+class AActor;
+class UWorld;
+
+/**
+ * Expected server load at positions in the world, used to propose the layout of a UGridBasedLBStrategy.
+ *
+ * A profile is either read from a CSV file with one "X,Y,Load" sample per line, in Unreal units, or estimated from the replicated
+ * actors placed in a map that pass the filter, each of which counts as one unit of load.
+ */
+struct SPATIALGDKEDITOR_API FGridLoadProfile
+{
+	struct FSample
+	{
+		FVector2D Location;
+		float Load;
+	};
+
+	TArray<FSample> Samples;
+
+	static bool LoadFromFile(const FString& FilePath, FGridLoadProfile& OutProfile);
+	static FGridLoadProfile FromActorDensity(UWorld& World, TFunctionRef<bool(const AActor&)> ActorFilter);
+
+	float GetTotalLoad() const;
+};
+
+struct SPATIALGDKEDITOR_API FGridLayoutProposal
+{
+	uint32 Rows = 1;
+	uint32 Cols = 1;
+
+	// Load of the busiest cell of the layout.
+	float MaxCellLoad = 0.f;
+
+	uint32 GetNumWorkers() const { return Rows * Cols; }
+};
+
+/**
+ * Proposes the rows and columns of a grid of WorldWidth by WorldHeight centered on the origin, laid out like UGridBasedLBStrategy:
+ * rows split the x-axis (WorldHeight) and columns split the y-axis (WorldWidth). Samples outside the grid count towards the
+ * closest cell.
+ *
+ * With a positive TargetLoadPerWorker, the proposal uses the fewest workers, up to MaxWorkers, for which the busiest cell stays
+ * within the target, or the layout with the least loaded busiest cell if none do. Otherwise, the proposal keeps NumWorkers
+ * and picks the rows and columns with the least loaded busiest cell. Ties go to the layout with the squarest cells.
+ */
+FGridLayoutProposal SPATIALGDKEDITOR_API ProposeGridLayout(const FGridLoadProfile& Profile, float WorldWidth, float WorldHeight, uint32 NumWorkers, uint32 MaxWorkers, float TargetLoadPerWorker);
+
+float SPATIALGDKEDITOR_API GetMaxGridCellLoad(const FGridLoadProfile& Profile, float WorldWidth, float WorldHeight, uint32 Rows, uint32 Cols);
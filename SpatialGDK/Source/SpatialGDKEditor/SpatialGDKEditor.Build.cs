@@ -26,6 +26,7 @@ public class SpatialGDKEditor : ModuleRules
  				"IOSRuntimeSettings",
  				"LauncherServices",
  				"Json",
+				"Projects",
 				"PropertyEditor",
 				"Slate",
 				"SlateCore",
@@ -10,6 +10,7 @@
 #include "Engine/World.h"
 #include "Engine/WorldComposition.h"
 #include "FileHelpers.h"
+#include "HAL/PlatformProcess.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/Paths.h"
 
@@ -56,6 +57,7 @@ int32 UGenerateSchemaAndSnapshotsCommandlet::Main(const FString& Args)
 		}
 	}
 
+	TArray<FString> MapPaths;
 	if (Params.Contains(MapPathsParamName))
 	{
 		FString MapNameParam = *Params.Find(MapPathsParamName);
@@ -71,7 +73,7 @@ int32 UGenerateSchemaAndSnapshotsCommandlet::Main(const FString& Args)
 		FString RemainingMapPaths = MapNameParam;
 		while (RemainingMapPaths.Split(TEXT(";"), &ThisMapName, &RemainingMapPaths))
 		{
-			if (!GenerateSnapshotForPath(SpatialGDKEditor, ThisMapName))
+			if (!CollectMapsForPath(ThisMapName, MapPaths))
 			{
 				return 1;	// Error
 			}
@@ -79,7 +81,7 @@ int32 UGenerateSchemaAndSnapshotsCommandlet::Main(const FString& Args)
 		// When we get to this point, one of two things is true:
 		// 1) RemainingMapPaths was NEVER split, and should be interpreted as a single map name
 		// 2) RemainingMapPaths was split n times, and the last map that needs to be run after the loop is still in it
-		if (!GenerateSnapshotForPath(SpatialGDKEditor, RemainingMapPaths))
+		if (!CollectMapsForPath(RemainingMapPaths, MapPaths))
 		{
 			return 1;	// Error
 		}
@@ -87,18 +89,42 @@ int32 UGenerateSchemaAndSnapshotsCommandlet::Main(const FString& Args)
 	else
 	{
 		// Default to everything in the project
-		if (!GenerateSnapshotForPath(SpatialGDKEditor, TEXT("")))
+		if (!CollectMapsForPath(TEXT(""), MapPaths))
 		{
 			return 1;	// Error
 		}
 	}
 
+	int32 MaxWorkers = 1;
+	if (const FString* MaxWorkersParam = Params.Find(ParallelWorkersParamName))
+	{
+		MaxWorkers = FMath::Max(1, FCString::Atoi(**MaxWorkersParam));
+	}
+
+	if (MaxWorkers > 1 && MapPaths.Num() > 1)
+	{
+		if (!GenerateSnapshotsInChildProcesses(MapPaths, MaxWorkers, Switches, Params))
+		{
+			return 1;	// Error
+		}
+	}
+	else
+	{
+		for (const FString& MapPath : MapPaths)
+		{
+			if (!GenerateSnapshotForMap(SpatialGDKEditor, MapPath))
+			{
+				return 1;	// Error
+			}
+		}
+	}
+
 	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Schema & Snapshot Generation Commandlet Complete"));
 
 	return 0;
 }
 
-bool UGenerateSchemaAndSnapshotsCommandlet::GenerateSnapshotForPath(FSpatialGDKEditor& InSpatialGDKEditor, const FString& InPath)
+bool UGenerateSchemaAndSnapshotsCommandlet::CollectMapsForPath(const FString& InPath, TArray<FString>& OutMapPaths)
 {
 	// Massage input to allow some flexibility in command line path argument:
 	// 	/Game/Path/MapName = Single map
@@ -133,7 +159,7 @@ bool UGenerateSchemaAndSnapshotsCommandlet::GenerateSnapshotForPath(FSpatialGDKE
 			MapPathToLoad = LongPackageName;
 		}
 		UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Selecting direct map %s"), *MapPathToLoad);
-		return GenerateSnapshotForMap(InSpatialGDKEditor, MapPathToLoad);
+		OutMapPaths.AddUnique(MapPathToLoad);
 	}
 	else if (CorrectedPath.EndsWith(TEXT("/")))
 	{
@@ -153,10 +179,7 @@ bool UGenerateSchemaAndSnapshotsCommandlet::GenerateSnapshotForPath(FSpatialGDKE
 		{
 			FString MapPath = AssetData.PackageName.ToString();
 			UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Selecting map %s"), *MapPath);
-			if (!GenerateSnapshotForMap(InSpatialGDKEditor, MapPath))
-			{
-				return false;
-			}
+			OutMapPaths.AddUnique(MapPath);
 		}
 	}
 	else
@@ -171,6 +194,99 @@ bool UGenerateSchemaAndSnapshotsCommandlet::GenerateSnapshotForPath(FSpatialGDKE
 	return true;
 }
 
+bool UGenerateSchemaAndSnapshotsCommandlet::GenerateSnapshotsInChildProcesses(const TArray<FString>& InMapPaths, int32 MaxWorkers, const TArray<FString>& Switches, const TMap<FString, FString>& Params)
+{
+	// Each map is loaded and snapshotted in its own commandlet process, so maps don't have to wait on each other's loading.
+	// Schema was already handled by this process, so the children always skip it.
+	FString ForwardedArgs = TEXT("-SkipSchema");
+	for (const FString& Switch : Switches)
+	{
+		if (Switch != TEXT("SkipSchema"))
+		{
+			ForwardedArgs += FString::Printf(TEXT(" -%s"), *Switch);
+		}
+	}
+	for (const TPair<FString, FString>& Param : Params)
+	{
+		if (Param.Key != MapPathsParamName && Param.Key != ParallelWorkersParamName)
+		{
+			ForwardedArgs += FString::Printf(TEXT(" -%s=%s"), *Param.Key, *Param.Value);
+		}
+	}
+
+	const FString Executable = FPlatformProcess::ExecutablePath();
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+	struct FSnapshotWorker
+	{
+		FString MapPath;
+		FProcHandle ProcHandle;
+	};
+
+	TArray<FSnapshotWorker> RunningWorkers;
+	TArray<FString> FailedMaps;
+	int32 NextMapIndex = 0;
+
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Generating %d snapshots in up to %d child processes"), InMapPaths.Num(), MaxWorkers);
+
+	while (NextMapIndex < InMapPaths.Num() || RunningWorkers.Num() > 0)
+	{
+		while (NextMapIndex < InMapPaths.Num() && RunningWorkers.Num() < MaxWorkers)
+		{
+			const FString& MapPath = InMapPaths[NextMapIndex++];
+			const FString Arguments = FString::Printf(TEXT("\"%s\" -run=GenerateSchemaAndSnapshots -%s=%s %s -unattended -nopause -nosplash -stdout"),
+				*ProjectPath, *MapPathsParamName, *MapPath, *ForwardedArgs);
+
+			FProcHandle ProcHandle = FPlatformProcess::CreateProc(*Executable, *Arguments, false, true, true, nullptr, 0 /*PriorityModifier*/, nullptr, nullptr);
+			if (!ProcHandle.IsValid())
+			{
+				UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Failed to start snapshot generation process for map %s"), *MapPath);
+				FailedMaps.Add(MapPath);
+				continue;
+			}
+
+			UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Started snapshot generation for map %s"), *MapPath);
+			RunningWorkers.Add(FSnapshotWorker{ MapPath, ProcHandle });
+		}
+
+		for (int32 WorkerIndex = RunningWorkers.Num() - 1; WorkerIndex >= 0; WorkerIndex--)
+		{
+			FSnapshotWorker& Worker = RunningWorkers[WorkerIndex];
+			if (FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			{
+				continue;
+			}
+
+			int32 ReturnCode = 1;
+			FPlatformProcess::GetProcReturnCode(Worker.ProcHandle, &ReturnCode);
+			FPlatformProcess::CloseProc(Worker.ProcHandle);
+
+			if (ReturnCode == 0)
+			{
+				UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Snapshot generation succeeded for map %s"), *Worker.MapPath);
+			}
+			else
+			{
+				UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Snapshot generation failed for map %s (exit code %d)"), *Worker.MapPath, ReturnCode);
+				FailedMaps.Add(Worker.MapPath);
+			}
+
+			RunningWorkers.RemoveAtSwap(WorkerIndex);
+		}
+
+		FPlatformProcess::Sleep(0.1f);
+	}
+
+	if (FailedMaps.Num() > 0)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Snapshot generation failed for %d of %d maps: %s"), FailedMaps.Num(), InMapPaths.Num(), *FString::Join(FailedMaps, TEXT(", ")));
+		return false;
+	}
+
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Generated snapshots for all %d maps"), InMapPaths.Num());
+	return true;
+}
+
 bool UGenerateSchemaAndSnapshotsCommandlet::GenerateSnapshotForMap(FSpatialGDKEditor& InSpatialGDKEditor, const FString& InMapName)
 {
 	// Check if this map path has already been generated and early exit if so
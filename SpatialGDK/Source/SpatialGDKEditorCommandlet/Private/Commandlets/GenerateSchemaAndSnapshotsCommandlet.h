@@ -22,11 +22,13 @@ public:
 private:
 	const FString MapPathsParamName = TEXT("MapPaths");	// Commandline Argument Name used to declare the paths to generate schema/snapshots against
 	const FString AssetPathGameDirName = TEXT("/Game");	// Root asset path directory name that maps will ultimately be found in
+	const FString ParallelWorkersParamName = TEXT("ParallelSnapshotWorkers");	// Commandline Argument Name used to generate snapshots in up to this many child processes
 
 	TArray<FString> GeneratedMapPaths;
 
 private:
-	bool GenerateSnapshotForPath(FSpatialGDKEditor& InSpatialGDKEditor, const FString& InPath);
+	bool CollectMapsForPath(const FString& InPath, TArray<FString>& OutMapPaths);
+	bool GenerateSnapshotsInChildProcesses(const TArray<FString>& InMapPaths, int32 MaxWorkers, const TArray<FString>& Switches, const TMap<FString, FString>& Params);
 	bool GenerateSnapshotForMap(FSpatialGDKEditor& InSpatialGDKEditor, const FString& InMapName);
 
 	bool GenerateSchema(FSpatialGDKEditor& InSpatialGDKEditor);
@@ -47,12 +47,16 @@
 #include "SpatialGDKEditorToolbarStyle.h"
 #include "SpatialGDKCloudDeploymentConfiguration.h"
 #include "SpatialRuntimeLoadBalancingStrategies.h"
+#include "Utils/CompactSchemaDatabase.h"
 #include "Utils/LaunchConfigurationEditor.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialGDKEditorToolbar);
 
 #define LOCTEXT_NAMESPACE "FSpatialGDKEditorToolbarModule"
 
+// How old the cached local deployment status may be when deciding whether to start a deployment.
+static const double MaxDeploymentStatusAgeSeconds(1.0);
+
 FSpatialGDKEditorToolbarModule::FSpatialGDKEditorToolbarModule()
 : bStopSpatialOnExit(false)
 , bSchemaBuildError(false)
@@ -98,16 +102,24 @@ void FSpatialGDKEditorToolbarModule::StartupModule()
 	{
 		if (GIsAutomationTesting && GetDefault<UGeneralProjectSettings>()->UsesSpatialNetworking())
 		{
-			LocalDeploymentManager->IsServiceRunningAndInCorrectDirectory();
-			LocalDeploymentManager->GetLocalDeploymentStatus();
-
+			// The deployment status is refreshed on a background thread before it is used.
 			VerifyAndStartDeployment();
 		}
+
+		if (GetDefault<UGeneralProjectSettings>()->UsesSpatialNetworking() && GetDefault<USpatialGDKSettings>()->bUseCompactSchemaDatabase)
+		{
+			// Loaded while the editor sets up the PIE worlds, so the workers share it rather than each loading it as they start.
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, []
+			{
+				SpatialGDK::FCompactSchemaDatabase::LoadShared(SpatialGDK::FCompactSchemaDatabase::GetFilePath());
+			});
+		}
 	});
 
 	FEditorDelegates::EndPIE.AddLambda([this](bool bIsSimulatingInEditor)
 	{
-		if (GIsAutomationTesting && GetDefault<UGeneralProjectSettings>()->UsesSpatialNetworking())
+		if (GIsAutomationTesting && GetDefault<UGeneralProjectSettings>()->UsesSpatialNetworking()
+			&& !GetDefault<USpatialGDKEditorSettings>()->bKeepLocalDeploymentBetweenAutomationTests)
 		{
 			LocalDeploymentManager->TryStopLocalDeployment();
 		}
@@ -750,6 +762,8 @@ void FSpatialGDKEditorToolbarModule::VerifyAndStartDeployment()
 
 		LaunchConfig = FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir()), FString::Printf(TEXT("Improbable/%s_LocalLaunchConfig.json"), *EditorWorld->GetMapName()));
 
+		ApplyLoadBasedGridLayoutsFromWorldSettings(*EditorWorld);
+
 		FSpatialLaunchConfigDescription LaunchConfigDescription = SpatialGDKEditorSettings->LaunchConfigDesc;
 		USingleWorkerRuntimeStrategy* DefaultStrategy = USingleWorkerRuntimeStrategy::StaticClass()->GetDefaultObject<USingleWorkerRuntimeStrategy>();
 		UAbstractRuntimeLoadBalancingStrategy* LoadBalancingStrat = DefaultStrategy;
@@ -807,6 +821,9 @@ void FSpatialGDKEditorToolbarModule::VerifyAndStartDeployment()
 			FPlatformProcess::Sleep(0.1f);
 		}
 
+		// The cached status may be out of date, e.g. if the deployment was stopped outside the editor. Refreshing here keeps the CLI off the game thread.
+		LocalDeploymentManager->RefreshServiceStatusIfStale(MaxDeploymentStatusAgeSeconds);
+
 		// If schema or worker configurations have been changed then we must restart the deployment.
 		if (LocalDeploymentManager->IsRedeployRequired() && LocalDeploymentManager->IsLocalDeploymentRunning())
 		{
@@ -816,8 +833,17 @@ void FSpatialGDKEditorToolbarModule::VerifyAndStartDeployment()
 		}
 		else if (LocalDeploymentManager->IsLocalDeploymentRunning())
 		{
-			// A good local deployment is already running.
-			return;
+			const FString ConfigHash = FLocalDeploymentManager::GetDeploymentConfigHash(LaunchConfig, RuntimeVersion, LaunchFlags, SnapshotName, GetOptionalExposedRuntimeIP());
+			if (!LocalDeploymentManager->HasDeploymentConfigChanged(ConfigHash))
+			{
+				// A good local deployment is already running.
+				return;
+			}
+
+			// E.g. a different map was opened, or the launch config or launch flags were edited.
+			UE_LOG(LogSpatialGDKEditorToolbar, Display, TEXT("Local deployment launch configuration changed, local deployment must restart."));
+			OnShowTaskStartNotification(TEXT("Local deployment restarting."));
+			LocalDeploymentManager->TryStopLocalDeployment();
 		}
 
 		FLocalDeploymentManager::LocalDeploymentCallback CallBack = [this](bool bSuccess)
@@ -13,7 +13,9 @@
 #include "Internationalization/Internationalization.h"
 #include "IPAddress.h"
 #include "Json/Public/Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/SecureHash.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "SpatialCommandUtils.h"
@@ -98,7 +100,7 @@ void FLocalDeploymentManager::StartUpWorkerConfigDirectoryWatcher()
 	if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
 	{
 		// Watch the worker config directory for changes.
-		FString WorkerConfigDirectory = FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("workers"));
+		FString WorkerConfigDirectory = GetWorkerConfigDirectory();
 
 		if (FPaths::DirectoryExists(WorkerConfigDirectory))
 		{
@@ -114,29 +116,96 @@ void FLocalDeploymentManager::StartUpWorkerConfigDirectoryWatcher()
 
 void FLocalDeploymentManager::OnWorkerConfigDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
 {
-	UE_LOG(LogSpatialDeploymentManager, Log, TEXT("Worker config files updated. Regenerating worker descriptors ('spatial worker build build-config')."));
-	WorkerBuildConfigAsync();
+	// Saving from an editor or syncing from source control changes several files in a burst, so wait for the changes to settle.
+	if (GEditor != nullptr)
+	{
+		GEditor->GetTimerManager()->SetTimer(WorkerConfigBuildDebounceTimer, [this]()
+		{
+			UE_LOG(LogSpatialDeploymentManager, Log, TEXT("Worker config files updated. Regenerating worker descriptors ('spatial worker build build-config')."));
+			WorkerBuildConfigAsync();
+		}, WorkerConfigBuildDebounceSeconds, false);
+	}
+	else
+	{
+		WorkerBuildConfigAsync();
+	}
 }
 
 void FLocalDeploymentManager::WorkerBuildConfigAsync()
 {
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]
+	// Only one build runs at a time, a build requested meanwhile runs once the current one finishes.
+	bWorkerConfigBuildPending = true;
+	if (bBuildingWorkerConfig.Exchange(true))
 	{
-		FString WorkerBuildConfigResult;
-		int32 ExitCode;
-		bool bSuccess = SpatialCommandUtils::BuildWorkerConfig(bIsInChina, SpatialGDKServicesConstants::SpatialOSDirectory, WorkerBuildConfigResult, ExitCode);
+		return;
+	}
 
-		if (bSuccess)
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]
+	{
+		do
 		{
-			UE_LOG(LogSpatialDeploymentManager, Display, TEXT("Building worker configurations succeeded!"));
+			bWorkerConfigBuildPending = false;
+
+			const FString WorkerConfigHash = GetWorkerConfigHash();
+			if (WorkerConfigHash == LastBuiltWorkerConfigHash)
+			{
+				UE_LOG(LogSpatialDeploymentManager, Verbose, TEXT("Worker configurations are unchanged since they were last built, skipping 'spatial worker build build-config'."));
+				continue;
+			}
+
+			FString WorkerBuildConfigResult;
+			int32 ExitCode;
+			bool bSuccess = SpatialCommandUtils::BuildWorkerConfig(bIsInChina, SpatialGDKServicesConstants::SpatialOSDirectory, WorkerBuildConfigResult, ExitCode);
+
+			if (bSuccess)
+			{
+				UE_LOG(LogSpatialDeploymentManager, Display, TEXT("Building worker configurations succeeded!"));
+				LastBuiltWorkerConfigHash = WorkerConfigHash;
+			}
+			else
+			{
+				UE_LOG(LogSpatialDeploymentManager, Error, TEXT("Building worker configurations failed. Please ensure your .worker.json files are correct. Result: %s"), *WorkerBuildConfigResult);
+			}
 		}
-		else
+		while (bWorkerConfigBuildPending);
+
+		bBuildingWorkerConfig = false;
+
+		// A build requested after the last check above but before the flag was cleared would otherwise be lost.
+		if (bWorkerConfigBuildPending)
 		{
-			UE_LOG(LogSpatialDeploymentManager, Error, TEXT("Building worker configurations failed. Please ensure your .worker.json files are correct. Result: %s"), *WorkerBuildConfigResult);
+			WorkerBuildConfigAsync();
 		}
 	});
 }
 
+FString FLocalDeploymentManager::GetWorkerConfigDirectory()
+{
+	return FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("workers"));
+}
+
+FString FLocalDeploymentManager::GetWorkerConfigHash()
+{
+	TArray<FString> WorkerConfigFiles;
+	IFileManager::Get().FindFilesRecursive(WorkerConfigFiles, *GetWorkerConfigDirectory(), TEXT("*.json"), true /* Files */, false /* Directories */);
+	WorkerConfigFiles.Sort();
+
+	FMD5 Md5;
+	for (const FString& WorkerConfigFile : WorkerConfigFiles)
+	{
+		TArray<uint8> Contents;
+		FFileHelper::LoadFileToArray(Contents, *WorkerConfigFile);
+
+		const FTCHARToUTF8 FileName(*WorkerConfigFile);
+		Md5.Update(reinterpret_cast<const uint8*>(FileName.Get()), FileName.Length());
+		Md5.Update(Contents.GetData(), Contents.Num());
+	}
+
+	uint8 Digest[16];
+	Md5.Final(Digest);
+	return BytesToHex(Digest, sizeof(Digest));
+}
+
 void FLocalDeploymentManager::RefreshServiceStatus()
 {
 	if(!bLocalDeploymentManagerEnabled)
@@ -146,8 +215,7 @@ void FLocalDeploymentManager::RefreshServiceStatus()
 
 	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]
 	{
-		IsServiceRunningAndInCorrectDirectory();
-		GetLocalDeploymentStatus();
+		UpdateServiceStatus(0.0);
 
 		// Timers must be started on the game thread.
 		AsyncTask(ENamedThreads::GameThread, [this]
@@ -166,6 +234,45 @@ void FLocalDeploymentManager::RefreshServiceStatus()
 	});
 }
 
+void FLocalDeploymentManager::UpdateServiceStatus(double MaxAgeSeconds)
+{
+	FScopeLock StatusLock(&ServiceStatusMutex);
+
+	// Another thread may have refreshed the status while this one waited for the lock.
+	if (GetServiceStatusAgeSeconds() <= MaxAgeSeconds)
+	{
+		return;
+	}
+
+	IsServiceRunningAndInCorrectDirectory();
+	GetLocalDeploymentStatus();
+
+	LastServiceStatusUpdateCycles = FPlatformTime::Cycles64();
+}
+
+void FLocalDeploymentManager::RefreshServiceStatusIfStale(double MaxAgeSeconds)
+{
+	ensureMsgf(!IsInGameThread(), TEXT("Refreshing the spatial service status shells out to the spatial CLI and would block the game thread."));
+
+	if (!bLocalDeploymentManagerEnabled || GetServiceStatusAgeSeconds() <= MaxAgeSeconds)
+	{
+		return;
+	}
+
+	UpdateServiceStatus(MaxAgeSeconds);
+}
+
+double FLocalDeploymentManager::GetServiceStatusAgeSeconds() const
+{
+	const uint64 LastUpdateCycles = LastServiceStatusUpdateCycles;
+	if (LastUpdateCycles == 0)
+	{
+		return DBL_MAX;
+	}
+
+	return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LastUpdateCycles);
+}
+
 bool FLocalDeploymentManager::CheckIfPortIsBound(int32 Port)
 {
 	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
@@ -400,9 +507,12 @@ void FLocalDeploymentManager::TryStartLocalDeployment(FString LaunchConfig, FStr
 	}
 
 	LocalRunningDeploymentID.Empty();
+	LocalRunningDeploymentConfigHash.Empty();
 
 	bStartingDeployment = true;
 
+	const FString ConfigHash = GetDeploymentConfigHash(LaunchConfig, RuntimeVersion, LaunchArgs, SnapshotName, RuntimeIPToExpose);
+
 	// Stop the currently running service if the runtime IP is to be exposed, but is different from the one specified
 	if (ExposedRuntimeIP != RuntimeIPToExpose)
 	{
@@ -420,12 +530,16 @@ void FLocalDeploymentManager::TryStartLocalDeployment(FString LaunchConfig, FStr
 
 
 	AttemptSpatialAuthResult = Async(EAsyncExecution::Thread, [this]() { return SpatialCommandUtils::AttemptSpatialAuth(bIsInChina); },
-		[this, LaunchConfig, RuntimeVersion, LaunchArgs, SnapshotName, RuntimeIPToExpose, CallBack]()
+		[this, LaunchConfig, RuntimeVersion, LaunchArgs, SnapshotName, RuntimeIPToExpose, ConfigHash, CallBack]()
 	{
 		bool bSuccess = AttemptSpatialAuthResult.IsReady() && AttemptSpatialAuthResult.Get() == true;
 		if (bSuccess)
 		{
 			bSuccess = FinishLocalDeployment(LaunchConfig, RuntimeVersion, LaunchArgs, SnapshotName, RuntimeIPToExpose);
+			if (bSuccess && bLocalDeploymentRunning)
+			{
+				LocalRunningDeploymentConfigHash = ConfigHash;
+			}
 		}
 		else
 		{
@@ -488,6 +602,7 @@ bool FLocalDeploymentManager::TryStopLocalDeployment()
 		{
 			UE_LOG(LogSpatialDeploymentManager, Log, TEXT("Successfully stopped local deplyoment"));
 			LocalRunningDeploymentID.Empty();
+			LocalRunningDeploymentConfigHash.Empty();
 			bLocalDeploymentRunning = false;
 			bSuccess = true;
 		}
@@ -771,6 +886,21 @@ void FLocalDeploymentManager::SetRedeployRequired()
 	bRedeployRequired = true;
 }
 
+FString FLocalDeploymentManager::GetDeploymentConfigHash(const FString& LaunchConfig, const FString& RuntimeVersion, const FString& LaunchArgs, const FString& SnapshotName, const FString& RuntimeIPToExpose)
+{
+	// The launch config is regenerated on every start, so compare its contents rather than its timestamp.
+	FString LaunchConfigContents;
+	FFileHelper::LoadFileToString(LaunchConfigContents, *LaunchConfig);
+
+	const FString ConfigDescription = FString::Join(TArray<FString>{ LaunchConfig, LaunchConfigContents, RuntimeVersion, LaunchArgs, SnapshotName, RuntimeIPToExpose }, TEXT("\n"));
+	return FMD5::HashAnsiString(*ConfigDescription);
+}
+
+bool FLocalDeploymentManager::HasDeploymentConfigChanged(const FString& ConfigHash) const
+{
+	return bLocalDeploymentRunning && !LocalRunningDeploymentConfigHash.IsEmpty() && LocalRunningDeploymentConfigHash != ConfigHash;
+}
+
 bool FLocalDeploymentManager::ShouldWaitForDeployment() const
 {
 	if (bAutoDeploy)
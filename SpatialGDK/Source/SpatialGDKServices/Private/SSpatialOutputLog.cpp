@@ -20,6 +20,10 @@ DEFINE_LOG_CATEGORY(LogSpatialOutputLog);
 static const FString LocalDeploymentLogsDir(FPaths::Combine(SpatialGDKServicesConstants::SpatialOSDirectory, TEXT("logs/localdeployment")));
 static const FString LaunchLogFilename(TEXT("launch.log"));
 static const float PollTimeInterval(0.05f);
+// When opening an existing log file larger than this, only its tail is shown.
+static const int64 InitialTailBytes(16 * 1024 * 1024);
+// Bounds how much of a quickly growing log file is read and formatted per poll.
+static const int64 MaxBytesPerPoll(4 * 1024 * 1024);
 
 void FArchiveLogFileReader::UpdateFileSize()
 {
@@ -181,8 +185,25 @@ void SSpatialOutputLog::ResetPollingLogFile(const FString& LogFilePath)
 	// FILEREAD_AllowWrite is required as we must match the permissions of the other processes writing to our log file in order to read from it.
 	LogReader = CreateLogFileReader(*LogFilePath, FILEREAD_AllowWrite, PLATFORM_FILE_READER_BUFFER_SIZE);
 
+	PartialLogLineBytes.Reset();
+	bSkipFirstPartialLogLine = false;
+
 	if (LogReader.IsValid())
 	{
+		// Only show the tail of a large log, such as the launch.log of a long running local deployment.
+		const int64 SkippedBytes = LogReader->TotalSize() - InitialTailBytes;
+		if (SkippedBytes > 0)
+		{
+			LogReader->Seek(SkippedBytes);
+			bSkipFirstPartialLogLine = true;
+
+			const FString SkippedMessage = FString::Printf(TEXT("Skipped the first %lld MB of %s, open the file to see earlier log lines."), SkippedBytes / (1024 * 1024), *LogFilePath);
+			AsyncTask(ENamedThreads::GameThread, [this, SkippedMessage]
+			{
+				Serialize(*SkippedMessage, ELogVerbosity::Warning, FName(TEXT("SpatialOutputLog")));
+			});
+		}
+
 		PollLogFile(LogFilePath);
 	}
 	else
@@ -209,29 +230,62 @@ void SSpatialOutputLog::PollLogFile(const FString& LogFilePath)
 		// Find out the current size of the log file. This is a cheaper operation than opening a new file reader on every poll.
 		LogReader->UpdateFileSize();
 
-		const int32 SizeDifference = LogReader->TotalSize() - LogReader->Tell();
+		// Only the bytes appended since the last poll are read.
+		const int64 SizeDifference = FMath::Min(LogReader->TotalSize() - LogReader->Tell(), MaxBytesPerPoll);
 
 		// New log lines have been added, serialize them.
 		if (SizeDifference > 0)
 		{
-			uint8* Ch = static_cast<uint8*>(FMemory::Malloc(SizeDifference));
+			const int32 PreviousNum = PartialLogLineBytes.Num();
+			PartialLogLineBytes.AddUninitialized(static_cast<int32>(SizeDifference));
+			LogReader->Serialize(PartialLogLineBytes.GetData() + PreviousNum, SizeDifference);
+
+			// The last line may still be being written, so only convert up to the last line break and keep the rest for the next poll.
+			// Searching the bytes rather than the converted string also keeps multi-byte characters cut by the read together.
+			int32 CompleteNum = 0;
+			for (int32 i = PartialLogLineBytes.Num() - 1; i >= PreviousNum; i--)
+			{
+				if (PartialLogLineBytes[i] == '\n')
+				{
+					CompleteNum = i + 1;
+					break;
+				}
+			}
 
-			LogReader->Serialize(Ch, SizeDifference);
+			if (CompleteNum == 0 && PartialLogLineBytes.Num() >= MaxBytesPerPoll)
+			{
+				// A single line longer than a whole poll, print what has been read rather than buffering it forever.
+				CompleteNum = PartialLogLineBytes.Num();
+			}
 
-			FString ReadResult;
-			FFileHelper::BufferToString(ReadResult, Ch, SizeDifference);
+			int32 StartIndex = 0;
+			if (bSkipFirstPartialLogLine && CompleteNum > 0)
+			{
+				bSkipFirstPartialLogLine = false;
+				while (StartIndex < CompleteNum && PartialLogLineBytes[StartIndex++] != '\n') {}
+			}
 
-			TArray<FString> LogLines;
+			if (CompleteNum > StartIndex)
+			{
+				FString ReadResult;
+				FFileHelper::BufferToString(ReadResult, PartialLogLineBytes.GetData() + StartIndex, CompleteNum - StartIndex);
 
-			// All log lines begin with 'time='. We use this as our log line delimiter.
-			ReadResult.ParseIntoArray(LogLines, TEXT("time="), true);
+				TArray<FString> LogLines;
 
-			for (const FString& LogLine : LogLines)
-			{
-				FormatAndPrintRawLogLine(LogLine);
+				// All log lines begin with 'time='. We use this as our log line delimiter.
+				ReadResult.ParseIntoArray(LogLines, TEXT("time="), true);
+
+				TArray<FFormattedLogLine> FormattedLines;
+				FormattedLines.Reserve(LogLines.Num());
+				for (const FString& LogLine : LogLines)
+				{
+					FormatRawLogLine(LogLine, FormattedLines);
+				}
+
+				PrintLogLines(MoveTemp(FormattedLines));
 			}
 
-			FMemory::Free(Ch);
+			PartialLogLineBytes.RemoveAt(0, CompleteNum, false);
 		}
 
 		StartPollTimer(LogFilePath);
@@ -255,9 +309,26 @@ void SSpatialOutputLog::StartPollTimer(const FString& LogFilePath)
 	});
 }
 
-void SSpatialOutputLog::FormatAndPrintRawErrorLine(const FString& LogLine)
+void SSpatialOutputLog::PrintLogLines(TArray<FFormattedLogLine>&& LogLines)
 {
-	const FRegexPattern ErrorPattern = FRegexPattern(TEXT("level=(.*) msg=(.*) code=(.*) code_string=(.*) error=(.*) stack=(.*)"));
+	if (LogLines.Num() == 0)
+	{
+		return;
+	}
+
+	// Serialization must be done on the game thread. All the lines of a poll are printed in one task.
+	AsyncTask(ENamedThreads::GameThread, [this, LogLines = MoveTemp(LogLines)]
+	{
+		for (const FFormattedLogLine& LogLine : LogLines)
+		{
+			Serialize(*LogLine.Message, LogLine.Verbosity, LogLine.Category);
+		}
+	});
+}
+
+void SSpatialOutputLog::FormatRawErrorLine(const FString& LogLine, TArray<FFormattedLogLine>& OutLines)
+{
+	static const FRegexPattern ErrorPattern = FRegexPattern(TEXT("level=(.*) msg=(.*) code=(.*) code_string=(.*) error=(.*) stack=(.*)"));
 	FRegexMatcher ErrorMatcher(ErrorPattern, LogLine);
 
 	if (!ErrorMatcher.FindNext())
@@ -279,23 +350,19 @@ void SSpatialOutputLog::FormatAndPrintRawErrorLine(const FString& LogLine)
 	// Format the log message to be easy to read.
 	FString LogMessage = FString::Printf(TEXT("%s \n Code: %s \n Code String: %s \n Error: %s \n Stack: %s"), *Message, *ErrorCode, *ErrorCodeString, *ErrorMessage, *Stack);
 
-	// Serialization must be done on the game thread.
-	AsyncTask(ENamedThreads::GameThread, [this, LogMessage]
-	{
-		Serialize(*LogMessage, ELogVerbosity::Error, FName(TEXT("SpatialService")));
-	});
+	OutLines.Add({ MoveTemp(LogMessage), ELogVerbosity::Error, FName(TEXT("SpatialService")) });
 }
 
-void SSpatialOutputLog::FormatAndPrintRawLogLine(const FString& LogLine)
+void SSpatialOutputLog::FormatRawLogLine(const FString& LogLine, TArray<FFormattedLogLine>& OutLines)
 {
 	// Log lines have the format time=LOG_TIME level=LOG_LEVEL logger=LOG_CATEGORY msg=LOG_MESSAGE
-	const FRegexPattern LogPattern = FRegexPattern(TEXT("level=(.*) msg=\"(.*)\" loggerName=(.*\\.)?(.*)"));
+	static const FRegexPattern LogPattern = FRegexPattern(TEXT("level=(.*) msg=\"(.*)\" loggerName=(.*\\.)?(.*)"));
 	FRegexMatcher LogMatcher(LogPattern, LogLine);
 
 	if (!LogMatcher.FindNext())
 	{
 		// If this log line did not match the log line regex then it is an error line which is parsed differently.
-		FormatAndPrintRawErrorLine(LogLine);
+		FormatRawErrorLine(LogLine, OutLines);
 		return;
 	}
 
@@ -307,7 +374,7 @@ void SSpatialOutputLog::FormatAndPrintRawLogLine(const FString& LogLine)
 	// msg=[WORKER_NAME:WORKER_TYPE] ... e.g. msg=[UnrealWorkerF5C56488482FEDC37B10E382770067E3:UnrealWorker]
 	if (LogCategory == TEXT("WorkerLogMessageHandler") || LogCategory == TEXT("Runtime"))
 	{
-		const FRegexPattern WorkerLogPattern = FRegexPattern(TEXT("\\[([^:]*):([^\\]]*)\\] (.*)"));
+		static const FRegexPattern WorkerLogPattern = FRegexPattern(TEXT("\\[([^:]*):([^\\]]*)\\] (.*)"));
 		FRegexMatcher WorkerLogMatcher(WorkerLogPattern, LogMessage);
 
 		if (WorkerLogMatcher.FindNext())
@@ -348,11 +415,7 @@ void SSpatialOutputLog::FormatAndPrintRawLogLine(const FString& LogLine)
 		LogVerbosity = ELogVerbosity::Log;
 	}
 
-	// Serialization must be done on the game thread.
-	AsyncTask(ENamedThreads::GameThread, [this, LogMessage, LogVerbosity, LogCategory]
-	{
-		Serialize(*LogMessage, LogVerbosity, FName(*LogCategory));
-	});
+	OutLines.Add({ MoveTemp(LogMessage), LogVerbosity, FName(*LogCategory) });
 }
 
 #undef LOCTEXT_NAMESPACE
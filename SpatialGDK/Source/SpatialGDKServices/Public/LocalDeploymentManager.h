@@ -5,7 +5,9 @@
 #include "Async/Future.h"
 #include "CoreMinimal.h"
 #include "FileCache.h"
+#include "HAL/CriticalSection.h"
 #include "Modules/ModuleManager.h"
+#include "Templates/Atomic.h"
 #include "Templates/SharedPointer.h"
 #include "TimerManager.h"
 
@@ -24,6 +26,13 @@ public:
 
 	void SPATIALGDKSERVICES_API RefreshServiceStatus();
 
+	// Runs the service and deployment status probes if the cached status is older than MaxAgeSeconds.
+	// The probes shell out to the spatial CLI, so this must not be called on the game thread.
+	void SPATIALGDKSERVICES_API RefreshServiceStatusIfStale(double MaxAgeSeconds);
+
+	// Age of the cached service and deployment status read by the Is* getters. Never blocks.
+	double SPATIALGDKSERVICES_API GetServiceStatusAgeSeconds() const;
+
 	bool CheckIfPortIsBound(int32 Port);
 	bool KillProcessBlockingPort(int32 Port);
 	bool LocalDeploymentPreRunChecks();
@@ -51,6 +60,13 @@ public:
 	bool SPATIALGDKSERVICES_API IsRedeployRequired() const;
 	void SPATIALGDKSERVICES_API SetRedeployRequired();
 
+	// Hash of the launch config file contents and the other arguments a local deployment is started with.
+	static FString SPATIALGDKSERVICES_API GetDeploymentConfigHash(const FString& LaunchConfig, const FString& RuntimeVersion, const FString& LaunchArgs, const FString& SnapshotName, const FString& RuntimeIPToExpose);
+
+	// Whether the running local deployment was started by this editor with a different configuration than ConfigHash.
+	// Deployments this editor did not start are assumed to be up to date.
+	bool SPATIALGDKSERVICES_API HasDeploymentConfigChanged(const FString& ConfigHash) const;
+
 	// Helper function to inform a client or server whether it should wait for a local deployment to become active.
 	bool SPATIALGDKSERVICES_API ShouldWaitForDeployment() const;
 
@@ -70,6 +86,12 @@ private:
 
 	bool FinishLocalDeployment(FString LaunchConfig, FString RuntimeVersion, FString LaunchArgs, FString SnapshotName, FString RuntimeIPToExpose);
 
+	void UpdateServiceStatus(double MaxAgeSeconds);
+
+	static FString GetWorkerConfigDirectory();
+	// Hash of the names and contents of the worker config files, the inputs of 'spatial worker build build-config'.
+	static FString GetWorkerConfigHash();
+
 	TFuture<bool> AttemptSpatialAuthResult;
 
 	static const int32 ExitCodeSuccess = 0;
@@ -79,21 +101,36 @@ private:
 	// This is the frequency at which check the 'spatial service status' to ensure we have the correct state as the user can change spatial service outside of the editor.
 	static const int32 RefreshFrequency = 3;
 
+	// Worker config changes arriving within this long of each other are built once.
+	static constexpr float WorkerConfigBuildDebounceSeconds = 0.5f;
+
 	bool bLocalDeploymentManagerEnabled = true;
 
-	bool bLocalDeploymentRunning;
-	bool bSpatialServiceRunning;
-	bool bSpatialServiceInProjectDirectory;
+	// Written by the status probes and deployment commands on background threads, read by the toolbar on the game thread.
+	TAtomic<bool> bLocalDeploymentRunning;
+	TAtomic<bool> bSpatialServiceRunning;
+	TAtomic<bool> bSpatialServiceInProjectDirectory;
+
+	TAtomic<bool> bStartingDeployment;
+	TAtomic<bool> bStoppingDeployment;
+
+	TAtomic<bool> bStartingSpatialService;
+	TAtomic<bool> bStoppingSpatialService;
 
-	bool bStartingDeployment;
-	bool bStoppingDeployment;
+	// Serializes the status probes, so the periodic refresh and on demand refreshes never run the CLI at the same time.
+	FCriticalSection ServiceStatusMutex;
+	TAtomic<uint64> LastServiceStatusUpdateCycles{ 0 };
 
-	bool bStartingSpatialService;
-	bool bStoppingSpatialService;
+	FTimerHandle WorkerConfigBuildDebounceTimer;
+	TAtomic<bool> bBuildingWorkerConfig{ false };
+	TAtomic<bool> bWorkerConfigBuildPending{ false };
+	// Only accessed by the worker config build task, of which at most one runs at a time.
+	FString LastBuiltWorkerConfigHash;
 
 	FString ExposedRuntimeIP;
 
 	FString LocalRunningDeploymentID;
+	FString LocalRunningDeploymentConfigHash;
 
 	bool bRedeployRequired = false;
 	bool bAutoDeploy = false;
@@ -41,8 +41,16 @@ private:
 	void PollLogFile(const FString& LogFilePath);
 	void CloseLogReader();
 
-	void FormatAndPrintRawLogLine(const FString& LogLine);
-	void FormatAndPrintRawErrorLine(const FString& LogLine);
+	struct FFormattedLogLine
+	{
+		FString Message;
+		ELogVerbosity::Type Verbosity;
+		FName Category;
+	};
+
+	void FormatRawLogLine(const FString& LogLine, TArray<FFormattedLogLine>& OutLines);
+	void FormatRawErrorLine(const FString& LogLine, TArray<FFormattedLogLine>& OutLines);
+	void PrintLogLines(TArray<FFormattedLogLine>&& LogLines);
 
 	void StartUpLogDirectoryWatcher(const FString& LogDirectory);
 	void ShutdownLogDirectoryWatcher(const FString& LogDirectory);
@@ -56,4 +64,9 @@ private:
 	FTimerHandle PollTimer;
 	TUniquePtr<FArchiveLogFileReader> LogReader;
 	FCriticalSection LogReaderMutex;
+
+	// Bytes read after the last complete log line, kept until the rest of the line has been written. Guarded by LogReaderMutex.
+	TArray<uint8> PartialLogLineBytes;
+	// Set when starting to read in the middle of a log file, so the line cut off at the start is skipped.
+	bool bSkipFirstPartialLogLine = false;
 };
@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+
+#include "CoreMinimal.h"
+
+#define SPATIALACTORCHANNEL_TEST(TestName) \
+	GDK_TEST(Core, USpatialActorChannel, TestName)
+
+SPATIALACTORCHANNEL_TEST(GIVEN_a_channel_without_dynamic_subobjects_WHEN_querying_pending_subobjects_THEN_no_extended_state_is_allocated)
+{
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+	UObject* Subobject = NewObject<UObject>();
+	const SIZE_T InitialSize = Channel->GetShadowDataAllocatedSize();
+
+	TestFalse("No dynamic subobjects are pending", Channel->HasPendingDynamicSubobjects());
+	TestFalse("The subobject isn't pending", Channel->IsDynamicSubobjectPending(Subobject));
+	Channel->RemovePendingDynamicSubobject(Subobject);
+
+	TestTrue("The extended state wasn't allocated", Channel->GetShadowDataAllocatedSize() == InitialSize);
+
+	return true;
+}
+
+SPATIALACTORCHANNEL_TEST(GIVEN_a_channel_WHEN_a_dynamic_subobject_is_pending_THEN_the_extended_state_is_allocated_and_tracks_it)
+{
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+	UObject* Subobject = NewObject<UObject>();
+	const SIZE_T InitialSize = Channel->GetShadowDataAllocatedSize();
+
+	Channel->GetExtendedState().PendingDynamicSubobjects.Add(Subobject);
+
+	TestTrue("The extended state was allocated", Channel->GetShadowDataAllocatedSize() >= InitialSize + sizeof(FSpatialActorChannelExtendedState));
+	TestTrue("A dynamic subobject is pending", Channel->HasPendingDynamicSubobjects());
+	TestTrue("The subobject is pending", Channel->IsDynamicSubobjectPending(Subobject));
+
+	Channel->RemovePendingDynamicSubobject(Subobject);
+
+	TestFalse("No dynamic subobjects are pending once it's removed", Channel->HasPendingDynamicSubobjects());
+	TestFalse("The subobject isn't pending once it's removed", Channel->IsDynamicSubobjectPending(Subobject));
+
+	return true;
+}
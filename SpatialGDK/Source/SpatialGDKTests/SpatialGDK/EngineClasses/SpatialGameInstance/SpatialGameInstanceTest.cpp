@@ -0,0 +1,53 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialGameInstance.h"
+
+#include "CoreMinimal.h"
+#include "UObject/Package.h"
+
+#define SPATIALGAMEINSTANCE_TEST(TestName) \
+	GDK_TEST(Core, USpatialGameInstance, TestName)
+
+namespace
+{
+
+// Collects garbage while only the game instance is rooted, and returns whether the package it was given survived.
+bool DoesPackageSurviveGarbageCollection(USpatialGameInstance* GameInstance, UPackage* Package)
+{
+	TWeakObjectPtr<UPackage> WeakPackage = Package;
+
+	GameInstance->AddToRoot();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	GameInstance->RemoveFromRoot();
+
+	return WeakPackage.IsValid();
+}
+
+} // anonymous namespace
+
+SPATIALGAMEINSTANCE_TEST(GIVEN_a_preloaded_server_travel_map_package_WHEN_holding_it_THEN_it_is_not_garbage_collected)
+{
+	USpatialGameInstance* GameInstance = NewObject<USpatialGameInstance>();
+	UPackage* Package = NewObject<UPackage>(nullptr, TEXT("/Temp/SpatialGDKTests/HeldServerTravelMap"), RF_Transient);
+
+	GameInstance->HoldServerTravelMapPackage(Package);
+
+	TestTrue("The held package survived garbage collection", DoesPackageSurviveGarbageCollection(GameInstance, Package));
+
+	return true;
+}
+
+SPATIALGAMEINSTANCE_TEST(GIVEN_a_held_server_travel_map_package_WHEN_releasing_it_THEN_it_is_garbage_collected)
+{
+	USpatialGameInstance* GameInstance = NewObject<USpatialGameInstance>();
+	UPackage* Package = NewObject<UPackage>(nullptr, TEXT("/Temp/SpatialGDKTests/ReleasedServerTravelMap"), RF_Transient);
+
+	GameInstance->HoldServerTravelMapPackage(Package);
+	GameInstance->ReleaseServerTravelMapPackage();
+
+	TestFalse("The released package was garbage collected", DoesPackageSurviveGarbageCollection(GameInstance, Package));
+
+	return true;
+}
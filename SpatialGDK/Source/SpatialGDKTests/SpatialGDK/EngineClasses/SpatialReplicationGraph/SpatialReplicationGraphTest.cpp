@@ -0,0 +1,93 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialReplicationGraph.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#define INTERESTGRID_TEST(TestName) \
+	GDK_TEST(Core, USpatialReplicationGraphNode_InterestGrid, TestName)
+
+namespace
+{
+
+// Actors created without a root component stay at the origin.
+TArray<AActor*> AddActorsAtOrigin(USpatialReplicationGraphNode_InterestGrid& Grid, int32 NumActors)
+{
+	TArray<AActor*> Actors;
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		AActor* Actor = NewObject<AActor>();
+		Actor->NetCullDistanceSquared = FMath::Square(100.0f);
+		Grid.NotifyAddNetworkActor(FNewReplicatedActorInfo(Actor));
+		Actors.Add(Actor);
+	}
+	return Actors;
+}
+
+} // anonymous namespace
+
+INTERESTGRID_TEST(GIVEN_a_viewer_near_actors_WHEN_preparing_for_replication_THEN_they_are_gathered_every_frame)
+{
+	USpatialReplicationGraphNode_InterestGrid* Grid = NewObject<USpatialReplicationGraphNode_InterestGrid>();
+	Grid->CellSize = 1000.0f;
+	Grid->OutOfRangeReplicationPeriodFrames = 0;
+	const TArray<AActor*> Actors = AddActorsAtOrigin(*Grid, 2);
+
+	Grid->SetViewerLocations({ FVector(10.0f, 10.0f, 0.0f) });
+
+	bool bAllGathered = true;
+	for (int32 Frame = 0; Frame < 3; Frame++)
+	{
+		Grid->PrepareForReplication();
+		bAllGathered &= Grid->IsGathered(Actors[0]) && Grid->IsGathered(Actors[1]);
+	}
+	TestTrue("Actors near the viewer are gathered every frame", bAllGathered);
+
+	Grid->SetViewerLocations({ FVector(100000.0f, 0.0f, 0.0f) });
+	Grid->PrepareForReplication();
+	TestFalse("Actors away from every viewer are not gathered", Grid->IsGathered(Actors[0]) || Grid->IsGathered(Actors[1]));
+
+	return true;
+}
+
+INTERESTGRID_TEST(GIVEN_actors_out_of_range_WHEN_preparing_for_replication_THEN_a_slice_of_them_is_gathered_each_frame)
+{
+	USpatialReplicationGraphNode_InterestGrid* Grid = NewObject<USpatialReplicationGraphNode_InterestGrid>();
+	Grid->CellSize = 1000.0f;
+	Grid->OutOfRangeReplicationPeriodFrames = 3;
+	const TArray<AActor*> Actors = AddActorsAtOrigin(*Grid, 6);
+
+	Grid->SetViewerLocations({ FVector(100000.0f, 0.0f, 0.0f) });
+
+	TMap<AActor*, int32> TimesGathered;
+	bool bSpreadOverFrames = true;
+	for (uint32 Frame = 0; Frame < Grid->OutOfRangeReplicationPeriodFrames; Frame++)
+	{
+		Grid->PrepareForReplication();
+
+		int32 NumGatheredThisFrame = 0;
+		for (AActor* Actor : Actors)
+		{
+			if (Grid->IsGathered(Actor))
+			{
+				TimesGathered.FindOrAdd(Actor)++;
+				NumGatheredThisFrame++;
+			}
+		}
+		bSpreadOverFrames &= NumGatheredThisFrame == 2;
+	}
+
+	TestTrue("Each frame only gathers its share of the out of range actors", bSpreadOverFrames);
+
+	bool bEachGatheredOnce = TimesGathered.Num() == Actors.Num();
+	for (const TPair<AActor*, int32>& ActorTimesGathered : TimesGathered)
+	{
+		bEachGatheredOnce &= ActorTimesGathered.Value == 1;
+	}
+	TestTrue("Every out of range actor is gathered once per period", bEachGatheredOnce);
+
+	return true;
+}
@@ -8,6 +8,7 @@
 #include "SpatialConstants.h"
 #include "SpatialGDKTests/SpatialGDK/Interop/Connection/SpatialOSWorkerInterface/SpatialOSWorkerConnectionSpy.h"
 #include "SpatialGDKTests/SpatialGDK/Interop/SpatialOSDispatcherInterface/SpatialOSDispatcherSpy.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/AbstractLBStrategy/LBStrategyStub.h"
 #include "Utils/SchemaUtils.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -40,6 +41,17 @@ EntityQueryDelegate* SetupQueryDelegateTests(SpatialVirtualWorkerTranslationMana
 	return Delegate;
 }
 
+Worker_ComponentData CreateReadyServerWorkerData(const PhysicalWorkerName& WorkerName)
+{
+	Worker_ComponentData ServerWorkerData = {};
+	ServerWorkerData.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+	ServerWorkerData.schema_type = Schema_CreateComponentData();
+	Schema_Object* ServerWorkerObject = Schema_GetComponentDataFields(ServerWorkerData.schema_type);
+	SpatialGDK::AddStringToSchema(ServerWorkerObject, SpatialConstants::SERVER_WORKER_NAME_ID, WorkerName);
+	Schema_AddBool(ServerWorkerObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, 1);
+	return ServerWorkerData;
+}
+
 }  // anonymous namespace
 
 VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_an_authority_change_THEN_query_for_worker_entities_when_appropriate)
@@ -140,3 +152,97 @@ VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_a_successful_query_with_invalid_worke
 
 	return true;
 }
+
+VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_a_strategy_not_requiring_all_workers_to_start_WHEN_the_required_workers_are_found_THEN_stop_querying)
+{
+	TUniquePtr<SpatialOSWorkerConnectionSpy> Connection = MakeUnique<SpatialOSWorkerConnectionSpy>();
+	TUniquePtr<SpatialOSDispatcherSpy> Dispatcher = MakeUnique<SpatialOSDispatcherSpy>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(nullptr, SpatialConstants::TRANSLATOR_UNSET_PHYSICAL_NAME);
+	TUniquePtr<SpatialVirtualWorkerTranslationManager> Manager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Dispatcher.Get(), Connection.Get(), Translator.Get());
+
+	ULBStrategyStub* Strategy = NewObject<ULBStrategyStub>();
+	Strategy->NumVirtualWorkersRequiredToStart = 1;
+
+	EntityQueryDelegate* Delegate = SetupQueryDelegateTests(Manager.Get(), Dispatcher.Get(), Connection.Get());
+
+	// A single server worker which is ready to begin play.
+	Worker_ComponentData ServerWorkerData = {};
+	ServerWorkerData.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+	ServerWorkerData.schema_type = Schema_CreateComponentData();
+	Schema_Object* ServerWorkerObject = Schema_GetComponentDataFields(ServerWorkerData.schema_type);
+	SpatialGDK::AddStringToSchema(ServerWorkerObject, SpatialConstants::SERVER_WORKER_NAME_ID, TEXT("ServerWorker1"));
+	Schema_AddBool(ServerWorkerObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, 1);
+
+	Worker_Entity Worker;
+	Worker.entity_id = 1001;
+	Worker.component_count = 1;
+	Worker.components = &ServerWorkerData;
+
+	Worker_EntityQueryResponseOp ResponseOp;
+	ResponseOp.status_code = WORKER_STATUS_CODE_SUCCESS;
+	ResponseOp.result_count = 1;
+	ResponseOp.message = "Successfully returned 1 entity";
+	ResponseOp.results = &Worker;
+
+	// Two virtual workers, of which only the first is needed to start.
+	Manager->SetNumberOfVirtualWorkers(2);
+	Manager->SetLoadBalanceStrategy(Strategy);
+
+	Delegate->ExecuteIfBound(ResponseOp);
+	TestTrue("Once the workers required to start are assigned, the TranslationManager published the mapping instead of querying again.", Connection->GetLastEntityQuery() == nullptr);
+
+	Schema_DestroyComponentData(ServerWorkerData.schema_type);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_failover_enabled_WHEN_a_server_worker_is_lost_THEN_its_standby_takes_over_its_virtual_worker)
+{
+	TUniquePtr<SpatialOSWorkerConnectionSpy> Connection = MakeUnique<SpatialOSWorkerConnectionSpy>();
+	TUniquePtr<SpatialOSDispatcherSpy> Dispatcher = MakeUnique<SpatialOSDispatcherSpy>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(nullptr, TEXT("ServerWorker2"));
+	TUniquePtr<SpatialVirtualWorkerTranslationManager> Manager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Dispatcher.Get(), Connection.Get(), Translator.Get());
+
+	EntityQueryDelegate* Delegate = SetupQueryDelegateTests(Manager.Get(), Dispatcher.Get(), Connection.Get());
+
+	Worker_ComponentData ServerWorkerData[2] = { CreateReadyServerWorkerData(TEXT("ServerWorker1")), CreateReadyServerWorkerData(TEXT("ServerWorker2")) };
+
+	Worker_Entity Workers[2];
+	for (int32 i = 0; i < 2; i++)
+	{
+		Workers[i].entity_id = 1001 + i;
+		Workers[i].component_count = 1;
+		Workers[i].components = &ServerWorkerData[i];
+	}
+
+	Worker_EntityQueryResponseOp ResponseOp;
+	ResponseOp.status_code = WORKER_STATUS_CODE_SUCCESS;
+	ResponseOp.result_count = 2;
+	ResponseOp.message = "Successfully returned 2 entities";
+	ResponseOp.results = Workers;
+
+	// One virtual worker and two server workers, so the second one stands by.
+	Manager->SetNumberOfVirtualWorkers(1);
+	Manager->EnableServerWorkerFailover(60.f);
+
+	Delegate->ExecuteIfBound(ResponseOp);
+	Delegate->ExecuteIfBound(ResponseOp);
+	TestTrue("The server worker which wasn't assigned a virtual worker is standing by for one.", Translator->GetLocalStandbyVirtualWorkerId() == 1);
+	TestTrue("The translator is ready while standing by.", Translator->IsReady());
+
+	// The first server worker's entity is gone.
+	ResponseOp.result_count = 1;
+	ResponseOp.message = "Successfully returned 1 entity";
+	ResponseOp.results = &Workers[1];
+	Delegate->ExecuteIfBound(ResponseOp);
+
+	const PhysicalWorkerName* WorkerName = Translator->GetPhysicalWorkerForVirtualWorker(1);
+	TestTrue("The standby took over the lost server worker's virtual worker.", WorkerName != nullptr && *WorkerName == TEXT("ServerWorker2"));
+	TestTrue("The translator has the virtual worker it took over.", Translator->GetLocalVirtualWorkerId() == 1);
+	TestTrue("The translator is no longer standing by.", Translator->GetLocalStandbyVirtualWorkerId() == SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+
+	Schema_DestroyComponentData(ServerWorkerData[0].schema_type);
+	Schema_DestroyComponentData(ServerWorkerData[1].schema_type);
+
+	return true;
+}
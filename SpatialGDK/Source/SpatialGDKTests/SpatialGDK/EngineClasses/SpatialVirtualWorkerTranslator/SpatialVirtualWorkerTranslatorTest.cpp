@@ -252,3 +252,60 @@ VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_valid_mapping_WHEN_try_to_change_local
 
 	return true;
 }
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_valid_mapping_WHEN_the_local_virtual_worker_is_reassigned_THEN_clear_the_local_virtual_worker_id)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	// Create a valid initial mapping.
+	Schema_Object* FirstValidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 2, "ValidWorkerTwo");
+
+	Translator->ApplyVirtualWorkerManagerData(FirstValidDataObject);
+	const uint32 FirstMappingVersion = Translator->GetMappingVersion();
+
+	// Virtual worker 1 is handed to another server worker, as happens when this worker was considered lost.
+	Schema_Object* SecondValidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SecondValidDataObject, 1, "ValidWorkerThree");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SecondValidDataObject, 2, "ValidWorkerTwo");
+
+	AddExpectedError(TEXT("is no longer assigned to this worker"), EAutomationExpectedErrorFlags::Contains, 1);
+	Translator->ApplyVirtualWorkerManagerData(SecondValidDataObject);
+
+	const PhysicalWorkerName* VirtualWorker1PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(1);
+	TestNotNull("There is a mapping for virtual worker 1", VirtualWorker1PhysicalName);
+	TestEqual<FString>("Virtual worker 1 is ValidWorkerThree", *VirtualWorker1PhysicalName, "ValidWorkerThree");
+
+	TestEqual<VirtualWorkerId>("Local virtual worker ID was cleared.", Translator->GetLocalVirtualWorkerId(), SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	TestEqual<VirtualWorkerId>("LBStrategy stub no longer has a local virtual worker ID.", LBStrategyStub->GetVirtualWorkerId(), SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	TestFalse("LBStrategy stub is no longer ready to claim authority.", LBStrategyStub->IsReady());
+	TestTrue("Mapping version changed so authority is reassigned.", Translator->GetMappingVersion() != FirstMappingVersion);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_a_mapping_with_a_gap_in_virtual_worker_ids_WHEN_looking_up_workers_THEN_only_mapped_ids_are_found)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerThree");
+
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, 3, "ValidWorkerThree");
+
+	Translator->ApplyVirtualWorkerManagerData(DataObject);
+
+	const PhysicalWorkerName* VirtualWorker3PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(3);
+	TestNotNull("There is a mapping for virtual worker 3", VirtualWorker3PhysicalName);
+	TestEqual<FString>("Virtual worker 3 is ValidWorkerThree", *VirtualWorker3PhysicalName, "ValidWorkerThree");
+
+	TestNull("There is no mapping for virtual worker 0", Translator->GetPhysicalWorkerForVirtualWorker(0));
+	TestNull("There is no mapping for virtual worker 2", Translator->GetPhysicalWorkerForVirtualWorker(2));
+	TestNull("There is no mapping for virtual worker 4", Translator->GetPhysicalWorkerForVirtualWorker(4));
+
+	TestEqual<VirtualWorkerId>("Local virtual worker ID is known.", Translator->GetLocalVirtualWorkerId(), 3);
+
+	return true;
+}
@@ -0,0 +1,79 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/FlushPolicy.h"
+
+#include "CoreMinimal.h"
+
+#define FLUSHPOLICY_TEST(TestName) \
+	GDK_TEST(Core, FFlushPolicy, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+FSpatialFlushRule MakeRule(bool bFlushAtEndOfTick, uint32 FlushQueuedBytes, uint32 FlushDeadlineMicroseconds)
+{
+	FSpatialFlushRule Rule;
+	Rule.bFlushAtEndOfTick = bFlushAtEndOfTick;
+	Rule.FlushQueuedBytes = FlushQueuedBytes;
+	Rule.FlushDeadlineMicroseconds = FlushDeadlineMicroseconds;
+	return Rule;
+}
+
+} // anonymous namespace
+
+FLUSHPOLICY_TEST(GIVEN_a_byte_threshold_WHEN_enough_bytes_are_queued_THEN_a_flush_is_requested)
+{
+	FFlushPolicy Policy(MakeRule(false, 100, 0), FSpatialFlushRule());
+
+	TestFalse(TEXT("Below the threshold"), Policy.OnMessageQueued(EFlushTraffic::RPC, 60, 0.0));
+	TestTrue(TEXT("At the threshold"), Policy.OnMessageQueued(EFlushTraffic::RPC, 40, 0.0));
+
+	Policy.OnFlushed();
+	TestFalse(TEXT("Bytes are reset by a flush"), Policy.OnMessageQueued(EFlushTraffic::RPC, 60, 0.0));
+
+	return true;
+}
+
+FLUSHPOLICY_TEST(GIVEN_separate_rules_WHEN_messages_are_queued_THEN_each_traffic_uses_its_own_rule)
+{
+	FFlushPolicy Policy(MakeRule(false, 100, 0), FSpatialFlushRule());
+
+	TestFalse(TEXT("Property updates have no rule"), Policy.OnMessageQueued(EFlushTraffic::PropertyUpdate, 1000, 0.0));
+	TestFalse(TEXT("Property updates do not count towards the RPC threshold"), Policy.OnMessageQueued(EFlushTraffic::RPC, 60, 0.0));
+	TestFalse(TEXT("Property updates are not flushed at the end of the tick"), Policy.ShouldFlushAtEndOfTick(0.0));
+
+	return true;
+}
+
+FLUSHPOLICY_TEST(GIVEN_a_deadline_WHEN_the_oldest_message_has_waited_long_enough_THEN_a_flush_is_requested)
+{
+	FFlushPolicy Policy(FSpatialFlushRule(), MakeRule(false, 0, 500));
+
+	TestFalse(TEXT("First message"), Policy.OnMessageQueued(EFlushTraffic::PropertyUpdate, 10, 1.0));
+	TestFalse(TEXT("Before the deadline"), Policy.OnMessageQueued(EFlushTraffic::PropertyUpdate, 10, 1.0004));
+	TestFalse(TEXT("End of tick before the deadline"), Policy.ShouldFlushAtEndOfTick(1.0004));
+	TestTrue(TEXT("End of tick after the deadline"), Policy.ShouldFlushAtEndOfTick(1.0006));
+	TestTrue(TEXT("Message after the deadline"), Policy.OnMessageQueued(EFlushTraffic::PropertyUpdate, 10, 1.0006));
+	TestEqual(TEXT("Shortest deadline"), Policy.GetShortestDeadline(), 0.0005);
+
+	return true;
+}
+
+FLUSHPOLICY_TEST(GIVEN_flush_at_end_of_tick_WHEN_nothing_was_queued_THEN_no_flush_is_requested)
+{
+	FFlushPolicy Policy(MakeRule(true, 0, 0), FSpatialFlushRule());
+
+	TestFalse(TEXT("Nothing queued"), Policy.ShouldFlushAtEndOfTick(0.0));
+
+	Policy.OnMessageQueued(EFlushTraffic::RPC, 10, 0.0);
+	TestTrue(TEXT("RPC queued"), Policy.ShouldFlushAtEndOfTick(0.0));
+
+	Policy.OnFlushed();
+	TestFalse(TEXT("Flushed"), Policy.ShouldFlushAtEndOfTick(0.0));
+
+	return true;
+}
@@ -0,0 +1,130 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/OpListRecording.h"
+#include "SpatialView/ConnectionHandlers/ReplayConnectionHandler.h"
+
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#define OPLISTRECORDING_TEST(TestName) \
+	GDK_TEST(Core, FOpListRecorder, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId TestEntityId = 42;
+const Worker_ComponentId TestComponentId = 1000;
+const Schema_FieldId TestFieldId = 1;
+
+FString GetRecordingFilename()
+{
+	return FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir()), TEXT("Improbable/OpListRecordingTest.bin"));
+}
+} // anonymous namespace
+
+OPLISTRECORDING_TEST(GIVEN_a_recorded_op_list_WHEN_reading_it_back_THEN_the_ops_match)
+{
+	const FString Filename = GetRecordingFilename();
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_AddUint32(Schema_GetComponentDataFields(Data), TestFieldId, 7);
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update), TestFieldId, 8);
+	Schema_AddComponentUpdateClearedField(Update, TestFieldId + 1);
+
+	Worker_Op Ops[3] = {};
+	Ops[0].op_type = WORKER_OP_TYPE_ADD_ENTITY;
+	Ops[0].op.add_entity.entity_id = TestEntityId;
+	Ops[1].op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+	Ops[1].op.add_component.entity_id = TestEntityId;
+	Ops[1].op.add_component.data.component_id = TestComponentId;
+	Ops[1].op.add_component.data.schema_type = Data;
+	Ops[2].op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+	Ops[2].op.component_update.entity_id = TestEntityId;
+	Ops[2].op.component_update.update.component_id = TestComponentId;
+	Ops[2].op.component_update.update.schema_type = Update;
+	const Worker_OpList OpList{ Ops, 3 };
+
+	{
+		FOpListRecorder Recorder;
+		TestTrue("Opened the recording", Recorder.Open(Filename));
+		Recorder.RecordOutgoingMessage(FDeleteEntityRequest(TestEntityId));
+		Recorder.RecordOpList(OpList);
+	}
+
+	Schema_DestroyComponentData(Data);
+	Schema_DestroyComponentUpdate(Update);
+
+	FOpListRecordingReader Reader;
+	TestTrue("Opened the recording for reading", Reader.Open(Filename));
+
+	TUniquePtr<RecordedOpList> ReadOpList = Reader.ReadNextOpList();
+	TestTrue("Read an op list", ReadOpList.IsValid());
+	if (ReadOpList.IsValid())
+	{
+		TestEqual("Op count", ReadOpList->GetCount(), 3u);
+
+		const Worker_Op& AddComponent = (*ReadOpList)[1];
+		TestEqual("Add component entity", AddComponent.op.add_component.entity_id, TestEntityId);
+		TestEqual("Add component field", Schema_GetUint32(Schema_GetComponentDataFields(AddComponent.op.add_component.data.schema_type), TestFieldId), 7u);
+
+		const Worker_Op& ComponentUpdate = (*ReadOpList)[2];
+		Schema_ComponentUpdate* ReadUpdate = ComponentUpdate.op.component_update.update.schema_type;
+		TestEqual("Component update field", Schema_GetUint32(Schema_GetComponentUpdateFields(ReadUpdate), TestFieldId), 8u);
+		TestEqual("Cleared field count", Schema_GetComponentUpdateClearedFieldCount(ReadUpdate), 1u);
+	}
+
+	TestEqual("Outgoing message count", Reader.GetOutgoingMessages().Num(), 1);
+	if (Reader.GetOutgoingMessages().Num() == 1)
+	{
+		TestEqual("Outgoing message entity", Reader.GetOutgoingMessages()[0].EntityId, TestEntityId);
+	}
+
+	TestFalse("Read past the end of the recording", Reader.ReadNextOpList().IsValid());
+
+	Reader.Close();
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+OPLISTRECORDING_TEST(GIVEN_a_recording_WHEN_replaying_it_THEN_one_op_list_is_queued_per_advance)
+{
+	const FString Filename = GetRecordingFilename();
+
+	Worker_Op Op = {};
+	Op.op_type = WORKER_OP_TYPE_REMOVE_ENTITY;
+	Op.op.remove_entity.entity_id = TestEntityId;
+	const Worker_OpList OpList{ &Op, 1 };
+
+	{
+		FOpListRecorder Recorder;
+		Recorder.Open(Filename);
+		Recorder.RecordOpList(OpList);
+		Recorder.RecordOpList(OpList);
+	}
+
+	{
+		ReplayConnectionHandler Handler(Filename);
+		TestTrue("Replay is valid", Handler.IsValid());
+
+		Handler.Advance();
+		TestEqual("Op lists after the first advance", Handler.GetOpListCount(), 1u);
+		Handler.Advance();
+		TestEqual("Op lists after the second advance", Handler.GetOpListCount(), 2u);
+		Handler.Advance();
+		TestTrue("Replay has finished", Handler.HasFinished());
+
+		TUniquePtr<AbstractOpList> First = Handler.GetNextOpList();
+		TestEqual("Replayed entity", (*First)[0].op.remove_entity.entity_id, TestEntityId);
+	}
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
@@ -0,0 +1,125 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/OutgoingMessageLanes.h"
+#include "SpatialConstants.h"
+
+#include "CoreMinimal.h"
+
+#define OUTGOINGMESSAGELANES_TEST(TestName) \
+	GDK_TEST(Core, FOutgoingMessageLanes, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const Worker_ComponentId PROPERTY_COMPONENT_ID = 10000;
+
+TUniquePtr<FOutgoingMessage> MakeUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = ComponentId;
+	return MakeUnique<FComponentUpdate>(EntityId, Update);
+}
+
+// Returns the message types in the order they were drained.
+TArray<EOutgoingMessageType> DrainTypes(FOutgoingMessageLanes& Lanes, uint32 MaxBulkMessages = 0)
+{
+	TArray<EOutgoingMessageType> Types;
+	Lanes.Drain([&Types](FOutgoingMessage* Message)
+	{
+		Types.Add(Message->Type);
+	}, MaxBulkMessages);
+	return Types;
+}
+
+} // anonymous namespace
+
+OUTGOINGMESSAGELANES_TEST(GIVEN_bulk_messages_queued_first_WHEN_draining_THEN_rpc_update_for_another_entity_is_sent_first)
+{
+	FOutgoingMessageLanes Lanes;
+
+	Lanes.Enqueue(MakeUnique<FDeleteEntityRequest>(1));
+	Lanes.Enqueue(MakeUnique<FDeleteEntityRequest>(2));
+	Lanes.Enqueue(MakeUpdate(3, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID));
+
+	TestEqual("Bulk lane depth", Lanes.GetDepth(EOutgoingMessageLane::Bulk), 2);
+	TestEqual("RPC lane depth", Lanes.GetDepth(EOutgoingMessageLane::RPC), 1);
+
+	const TArray<EOutgoingMessageType> Types = DrainTypes(Lanes);
+
+	TestTrue("RPC update drained before bulk messages", Types == TArray<EOutgoingMessageType>{ EOutgoingMessageType::ComponentUpdate,
+		EOutgoingMessageType::DeleteEntityRequest, EOutgoingMessageType::DeleteEntityRequest });
+	TestEqual("Total depth", Lanes.GetTotalDepth(), 0);
+
+	return true;
+}
+
+OUTGOINGMESSAGELANES_TEST(GIVEN_update_queued_after_entity_creation_WHEN_draining_THEN_update_is_sent_after_creation)
+{
+	FOutgoingMessageLanes Lanes;
+
+	const Worker_EntityId EntityId = 1;
+	Lanes.Enqueue(MakeUnique<FCreateEntityRequest>(TArray<FWorkerComponentData>(), &EntityId));
+	Lanes.Enqueue(MakeUpdate(EntityId, PROPERTY_COMPONENT_ID));
+
+	TestEqual("Update held behind the creation", Lanes.GetHeldInOtherLaneCount(), 1ull);
+
+	const TArray<EOutgoingMessageType> Types = DrainTypes(Lanes);
+
+	TestTrue("Creation drained before update", Types == TArray<EOutgoingMessageType>{ EOutgoingMessageType::CreateEntityRequest,
+		EOutgoingMessageType::ComponentUpdate });
+
+	// Once the creation is drained, updates for the entity use their own lane again.
+	Lanes.Enqueue(MakeUpdate(EntityId, PROPERTY_COMPONENT_ID));
+	TestEqual("Property update lane depth", Lanes.GetDepth(EOutgoingMessageLane::PropertyUpdate), 1);
+
+	return true;
+}
+
+OUTGOINGMESSAGELANES_TEST(GIVEN_property_and_rpc_updates_queued_before_an_acl_update_WHEN_draining_THEN_they_are_sent_in_order)
+{
+	FOutgoingMessageLanes Lanes;
+
+	const Worker_EntityId EntityId = 1;
+	Lanes.Enqueue(MakeUpdate(EntityId, PROPERTY_COMPONENT_ID));
+	Lanes.Enqueue(MakeUpdate(EntityId, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID));
+	Lanes.Enqueue(MakeUpdate(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID));
+	Lanes.Enqueue(MakeUpdate(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID));
+	Lanes.Enqueue(MakeUpdate(2, SpatialConstants::ENTITY_ACL_COMPONENT_ID));
+
+	TestEqual("Messages held behind the property update", Lanes.GetHeldInOtherLaneCount(), 3ull);
+
+	TArray<Worker_ComponentId> ComponentIds;
+	Lanes.Drain([&ComponentIds](FOutgoingMessage* Message)
+	{
+		ComponentIds.Add(static_cast<FComponentUpdate*>(Message)->Update.component_id);
+	}, 0);
+
+	TestTrue("Other entities still use the control lane, and the entity's messages keep their order", ComponentIds == TArray<Worker_ComponentId>{
+		SpatialConstants::ENTITY_ACL_COMPONENT_ID, PROPERTY_COMPONENT_ID, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		SpatialConstants::ENTITY_ACL_COMPONENT_ID, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID });
+
+	return true;
+}
+
+OUTGOINGMESSAGELANES_TEST(GIVEN_a_bulk_limit_WHEN_draining_THEN_at_most_that_many_bulk_messages_are_sent)
+{
+	FOutgoingMessageLanes Lanes;
+
+	for (Worker_EntityId EntityId = 1; EntityId <= 5; EntityId++)
+	{
+		Lanes.Enqueue(MakeUnique<FDeleteEntityRequest>(EntityId));
+	}
+	Lanes.Enqueue(MakeUpdate(10, PROPERTY_COMPONENT_ID));
+
+	TestEqual("Messages drained on first flush", DrainTypes(Lanes, 2).Num(), 3);
+	TestEqual("Bulk messages left", Lanes.GetDepth(EOutgoingMessageLane::Bulk), 3);
+	TestEqual("Messages drained on second flush", DrainTypes(Lanes, 2).Num(), 2);
+	TestEqual("Messages drained on third flush", DrainTypes(Lanes, 2).Num(), 1);
+	TestEqual("Total depth", Lanes.GetTotalDepth(), 0);
+
+	return true;
+}
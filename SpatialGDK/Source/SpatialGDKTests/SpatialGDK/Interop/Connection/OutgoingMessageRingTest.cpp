@@ -0,0 +1,114 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/OutgoingMessageRing.h"
+
+#include "CoreMinimal.h"
+
+#define OUTGOINGMESSAGERING_TEST(TestName) \
+	GDK_TEST(Core, FOutgoingMessageRing, TestName)
+
+using namespace SpatialGDK;
+
+OUTGOINGMESSAGERING_TEST(GIVEN_an_empty_ring_WHEN_consuming_THEN_nothing_is_consumed)
+{
+	FOutgoingMessageRing Ring(4);
+
+	bool bConsumed = Ring.ConsumeNext([](FOutgoingMessage*) {});
+
+	TestFalse("Consumed a message", bConsumed);
+	TestFalse("Ring is full", Ring.IsFull());
+
+	return true;
+}
+
+OUTGOINGMESSAGERING_TEST(GIVEN_a_capacity_WHEN_constructing_THEN_capacity_is_rounded_up_to_a_power_of_two)
+{
+	FOutgoingMessageRing Ring(5);
+
+	TestEqual("Capacity", Ring.GetCapacity(), 8u);
+
+	return true;
+}
+
+OUTGOINGMESSAGERING_TEST(GIVEN_published_messages_WHEN_consuming_THEN_they_are_consumed_in_order)
+{
+	FOutgoingMessageRing Ring(4);
+
+	for (Worker_EntityId EntityId = 1; EntityId <= 3; EntityId++)
+	{
+		Ring.Emplace<FDeleteEntityRequest>(EntityId);
+		Ring.Publish();
+	}
+
+	TArray<Worker_EntityId> ConsumedEntityIds;
+	while (Ring.ConsumeNext([&ConsumedEntityIds](FOutgoingMessage* Message)
+	{
+		ConsumedEntityIds.Add(static_cast<FDeleteEntityRequest*>(Message)->EntityId);
+	}))
+	{
+	}
+
+	TestEqual("Number of consumed messages", ConsumedEntityIds.Num(), 3);
+	TestTrue("Messages consumed in order", ConsumedEntityIds == TArray<Worker_EntityId>{ 1, 2, 3 });
+
+	return true;
+}
+
+OUTGOINGMESSAGERING_TEST(GIVEN_an_unpublished_message_WHEN_consuming_THEN_nothing_is_consumed)
+{
+	FOutgoingMessageRing Ring(4);
+
+	Ring.Emplace<FDeleteEntityRequest>(1);
+
+	bool bConsumed = Ring.ConsumeNext([](FOutgoingMessage*) {});
+	TestFalse("Consumed an unpublished message", bConsumed);
+
+	Ring.Publish();
+
+	bConsumed = Ring.ConsumeNext([](FOutgoingMessage*) {});
+	TestTrue("Consumed the published message", bConsumed);
+
+	return true;
+}
+
+OUTGOINGMESSAGERING_TEST(GIVEN_a_full_ring_WHEN_consuming_a_message_THEN_it_is_no_longer_full)
+{
+	FOutgoingMessageRing Ring(2);
+
+	Ring.Emplace<FDeleteEntityRequest>(1);
+	Ring.Publish();
+	Ring.Emplace<FDeleteEntityRequest>(2);
+	Ring.Publish();
+
+	TestTrue("Ring is full", Ring.IsFull());
+
+	Ring.ConsumeNext([](FOutgoingMessage*) {});
+
+	TestFalse("Ring is full", Ring.IsFull());
+
+	return true;
+}
+
+OUTGOINGMESSAGERING_TEST(GIVEN_a_message_with_allocated_members_WHEN_consuming_THEN_its_contents_are_intact)
+{
+	FOutgoingMessageRing Ring(2);
+
+	TestTrue("Component updates fit inline", FOutgoingMessageRing::FitsInline<FComponentUpdate>());
+
+	SpatialMetrics Metrics;
+	Metrics.Load = 0.5;
+	Ring.Emplace<FMetrics>(Metrics);
+	Ring.Publish();
+
+	double ConsumedLoad = 0.0;
+	Ring.ConsumeNext([&ConsumedLoad](FOutgoingMessage* Message)
+	{
+		ConsumedLoad = static_cast<FMetrics*>(Message)->Metrics.Load.GetValue();
+	});
+
+	TestEqual("Consumed load", ConsumedLoad, 0.5);
+
+	return true;
+}
@@ -2,6 +2,8 @@
 
 #include "Tests/TestDefinitions.h"
 #include "Interop/Connection/SpatialConnectionManager.h"
+#include "Interop/Connection/ConnectionConfig.h"
+#include "SpatialGDKSettings.h"
 #include "CoreMinimal.h"
 
 #define CONNECTIONMANAGER_TEST(TestName) \
@@ -324,3 +326,55 @@ CONNECTIONMANAGER_TEST(SetupFromCommandLine_Receptionist_URLAndExternalBridge)
 
 	return true;
 }
+
+CONNECTIONMANAGER_TEST(PreConnectInit_NetworkTransportProfile_CommandLine)
+{
+	// GIVEN
+	FTemporaryCommandLine TemporaryCommandLine("-networkTransportProfile=LowLatency");
+	FConnectionConfig Config;
+	Config.WorkerType = TEXT("SomeWorkerType");
+
+	// WHEN
+	Config.PreConnectInit(false);
+
+	// THEN
+	const FSpatialNetworkTransportProfile* LowLatency = FSpatialNetworkTransportProfile::FindBuiltInProfile(TEXT("LowLatency"));
+	TestEqual("NetworkTransportProfileName", Config.NetworkTransportProfileName, FName(TEXT("LowLatency")));
+	TestTrue("NetworkTransportProfile", Config.NetworkTransportProfile.IsSet());
+	TestTrue("UdpUpstreamIntervalMS", Config.UdpUpstreamIntervalMS == LowLatency->KcpUpstreamFlushIntervalMillis);
+	TestTrue("TcpNoDelay", Config.TcpNoDelay == 1);
+
+	return true;
+}
+
+CONNECTIONMANAGER_TEST(PreConnectInit_NetworkTransportProfile_ClampedToWorkerSDKRange)
+{
+	// GIVEN
+	FTemporaryCommandLine TemporaryCommandLine("");
+	USpatialGDKSettings* Settings = GetMutableDefault<USpatialGDKSettings>();
+	const TMap<FName, FSpatialNetworkTransportProfile> OldProfiles = Settings->NetworkTransportProfiles;
+	const TMap<FName, FName> OldWorkerTypeProfiles = Settings->WorkerTypeNetworkTransportProfiles;
+
+	FSpatialNetworkTransportProfile& Profile = Settings->NetworkTransportProfiles.Add(TEXT("OutOfRange"));
+	Profile.KcpUpstreamFlushIntervalMillis = 1000;
+	Profile.KcpDownstreamFlushIntervalMillis = 300;
+	Profile.TcpMultiplexLevel = 0;
+	Settings->WorkerTypeNetworkTransportProfiles.Add(TEXT("SomeWorkerType"), TEXT("OutOfRange"));
+
+	FConnectionConfig Config;
+	Config.WorkerType = TEXT("SomeWorkerType");
+
+	// WHEN
+	Config.PreConnectInit(false);
+
+	// THEN
+	TestEqual("NetworkTransportProfileName", Config.NetworkTransportProfileName, FName(TEXT("OutOfRange")));
+	TestTrue("UdpUpstreamIntervalMS", Config.UdpUpstreamIntervalMS == MAX_uint8);
+	TestTrue("UdpDownstreamIntervalMS", Config.UdpDownstreamIntervalMS == MAX_uint8);
+	TestTrue("TcpMultiplexLevel", Config.TcpMultiplexLevel == 1);
+
+	Settings->NetworkTransportProfiles = OldProfiles;
+	Settings->WorkerTypeNetworkTransportProfiles = OldWorkerTypeProfiles;
+
+	return true;
+}
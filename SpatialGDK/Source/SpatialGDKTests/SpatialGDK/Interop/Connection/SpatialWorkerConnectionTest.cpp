@@ -5,6 +5,7 @@
 #include "Interop/Connection/SpatialConnectionManager.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialOutputDevice.h"
+#include "SpatialGDKSettings.h"
 #include "SpatialGDKTests/SpatialGDKServices/LocalDeploymentManager/LocalDeploymentManagerUtilities.h"
 
 #include "CoreMinimal.h"
@@ -357,3 +358,23 @@ WORKERCONNECTION_TEST(GIVEN_valid_worker_connection_WHEN_delete_entity_request_s
 
 	return true;
 }
+
+WORKERCONNECTION_TEST(GIVEN_latency_critical_rpcs_WHEN_deciding_whether_a_flush_wakes_the_connection_thread_THEN_it_does)
+{
+	USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+	const bool bOldWorkerFlushAfterOutgoingNetworkOp = SpatialGDKSettings->bWorkerFlushAfterOutgoingNetworkOp;
+	const TArray<FName> OldLatencyCriticalRPCs = SpatialGDKSettings->LatencyCriticalRPCs;
+	SpatialGDKSettings->bWorkerFlushAfterOutgoingNetworkOp = false;
+
+	SpatialGDKSettings->LatencyCriticalRPCs.Empty();
+	TestFalse("Without latency critical RPCs or a flush policy, the thread isn't woken", USpatialWorkerConnection::CanWakeConnectionThread(*SpatialGDKSettings, false));
+	TestTrue("A flush policy wakes the thread", USpatialWorkerConnection::CanWakeConnectionThread(*SpatialGDKSettings, true));
+
+	SpatialGDKSettings->LatencyCriticalRPCs.Add(TEXT("ServerFire"));
+	TestTrue("Latency critical RPCs wake the thread", USpatialWorkerConnection::CanWakeConnectionThread(*SpatialGDKSettings, false));
+
+	SpatialGDKSettings->bWorkerFlushAfterOutgoingNetworkOp = bOldWorkerFlushAfterOutgoingNetworkOp;
+	SpatialGDKSettings->LatencyCriticalRPCs = OldLatencyCriticalRPCs;
+
+	return true;
+}
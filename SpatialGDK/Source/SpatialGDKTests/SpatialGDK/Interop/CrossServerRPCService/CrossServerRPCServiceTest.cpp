@@ -0,0 +1,220 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
+#include "Interop/CrossServerRPCService.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/AuthorityIntent.h"
+#include "SpatialGDKSettings.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/AbstractLBStrategy/LBStrategyStub.h"
+#include "Tests/TestingComponentViewHelpers.h"
+#include "Tests/TestingSchemaHelpers.h"
+#include "Utils/RPCRingBuffer.h"
+
+#include "CoreMinimal.h"
+
+#define CROSSSERVERRPCSERVICE_TEST(TestName) \
+	GDK_TEST(Core, CrossServerRPCService, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+constexpr Worker_EntityId ServerOneEntityId = 1;
+constexpr Worker_EntityId ServerTwoEntityId = 2;
+constexpr Worker_EntityId ServerThreeEntityId = 3;
+constexpr Worker_EntityId TargetEntityId = 100;
+
+const PhysicalWorkerName ServerTwoWorkerName = TEXT("ServerTwo");
+constexpr VirtualWorkerId ServerTwoVirtualWorkerId = 2;
+
+uint32 GetRingBufferSize()
+{
+	return FMath::Min(RPCRingBufferUtils::GetRingBufferSize(ERPCType::CrossServer), GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize);
+}
+
+RPCPayload CreatePayload()
+{
+	return RPCPayload(0, 0, TArray<uint8>());
+}
+
+ExtractRPCDelegate CreateExtractRPCDelegate(TArray<Worker_EntityId>& ExtractedRPCs)
+{
+	return ExtractRPCDelegate::CreateLambda([&ExtractedRPCs](Worker_EntityId EntityId, ERPCType Type, const RPCPayload& Payload)
+	{
+		ExtractedRPCs.Add(EntityId);
+		return true;
+	});
+}
+
+void SeeEndpoint(CrossServerRPCService& Service, Worker_EntityId EndpointEntityId)
+{
+	FWorkerComponentData Data = CrossServerRPCService::CreateEndpointData();
+	Service.OnEndpointAdded(EndpointEntityId, Schema_GetComponentDataFields(Data.schema_type));
+	Schema_DestroyComponentData(Data.schema_type);
+}
+
+// Sends the pending update of a server to the servers which can see its endpoint, an empty list drops it.
+void DeliverUpdates(CrossServerRPCService& Sender, const TArray<CrossServerRPCService*>& Receivers)
+{
+	for (SpatialRPCService::UpdateToSend& Update : Sender.GetRPCsAndAcksToSend())
+	{
+		for (CrossServerRPCService* Receiver : Receivers)
+		{
+			Receiver->OnEndpointUpdated(Update.EntityId, Schema_GetComponentUpdateFields(Update.Update.schema_type));
+		}
+		Schema_DestroyComponentUpdate(Update.Update.schema_type);
+	}
+}
+
+void AddTargetEntity(USpatialStaticComponentView& View, Worker_Authority EndpointAuthority)
+{
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(View, TargetEntityId, SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID, EndpointAuthority);
+}
+
+void SetEndpointAuthority(USpatialStaticComponentView& View, Worker_Authority EndpointAuthority)
+{
+	Worker_AuthorityChangeOp AuthorityChangeOp;
+	AuthorityChangeOp.entity_id = TargetEntityId;
+	AuthorityChangeOp.component_id = SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID;
+	AuthorityChangeOp.authority = EndpointAuthority;
+	View.OnAuthorityChange(AuthorityChangeOp);
+}
+
+TUniquePtr<SpatialVirtualWorkerTranslator> CreateServerTwoTranslator()
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(NewObject<ULBStrategyStub>(), ServerTwoWorkerName);
+
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, ServerTwoVirtualWorkerId, ServerTwoWorkerName);
+	Translator->ApplyVirtualWorkerManagerData(DataObject);
+
+	return Translator;
+}
+
+} // anonymous namespace
+
+CROSSSERVERRPCSERVICE_TEST(GIVEN_a_server_which_has_not_seen_the_endpoint_WHEN_pushing_a_reliable_RPC_THEN_it_is_queued_until_that_server_acks)
+{
+	TArray<Worker_EntityId> ExtractedRPCs;
+	USpatialStaticComponentView* ServerTwoView = NewObject<USpatialStaticComponentView>();
+	AddTargetEntity(*ServerTwoView, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	CrossServerRPCService ServerOne(CreateExtractRPCDelegate(ExtractedRPCs), NewObject<USpatialStaticComponentView>());
+	CrossServerRPCService ServerTwo(CreateExtractRPCDelegate(ExtractedRPCs), ServerTwoView);
+	ServerOne.OnEndpointAuthorityGained(ServerOneEntityId);
+	ServerTwo.OnEndpointAuthorityGained(ServerTwoEntityId);
+
+	// Server one sees server two before server two has seen server one.
+	SeeEndpoint(ServerOne, ServerTwoEntityId);
+
+	TestTrue("The reliable RPC was queued", ServerOne.PushRPC(TargetEntityId, CreatePayload(), true) == EPushRPCResult::QueueOverflowed);
+	DeliverUpdates(ServerOne, {});
+
+	SeeEndpoint(ServerTwo, ServerOneEntityId);
+	DeliverUpdates(ServerTwo, { &ServerOne });
+
+	ServerOne.PushOverflowedRPCs();
+	TestEqual("The reliable RPC was written once server two acked", ServerOne.GetNumOverflowedRPCs(), 0);
+
+	DeliverUpdates(ServerOne, { &ServerTwo });
+	TestEqual("Server two executed the RPC", ExtractedRPCs.Num(), 1);
+
+	return true;
+}
+
+CROSSSERVERRPCSERVICE_TEST(GIVEN_a_server_which_has_never_acked_WHEN_the_ring_buffer_is_full_THEN_further_RPCs_are_queued)
+{
+	TArray<Worker_EntityId> ExtractedRPCs;
+	CrossServerRPCService ServerOne(CreateExtractRPCDelegate(ExtractedRPCs), NewObject<USpatialStaticComponentView>());
+	ServerOne.OnEndpointAuthorityGained(ServerOneEntityId);
+	SeeEndpoint(ServerOne, ServerTwoEntityId);
+
+	bool bAllWritten = true;
+	for (uint32 i = 0; i < GetRingBufferSize(); i++)
+	{
+		bAllWritten &= ServerOne.PushRPC(TargetEntityId, CreatePayload(), false) == EPushRPCResult::Success;
+	}
+	TestTrue("A whole ring buffer of unreliable RPCs was written", bAllWritten);
+
+	DeliverUpdates(ServerOne, {});
+
+	TestTrue("The next RPC waits for server two to ack", ServerOne.PushRPC(TargetEntityId, CreatePayload(), false) == EPushRPCResult::QueueOverflowed);
+
+	return true;
+}
+
+CROSSSERVERRPCSERVICE_TEST(GIVEN_authority_over_the_target_is_moving_to_a_server_WHEN_it_receives_an_RPC_THEN_the_RPC_is_held_until_it_gains_authority)
+{
+	TArray<Worker_EntityId> ExtractedRPCs;
+	USpatialStaticComponentView* ServerTwoView = NewObject<USpatialStaticComponentView>();
+	AddTargetEntity(*ServerTwoView, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*ServerTwoView, TargetEntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	ServerTwoView->GetComponentData<AuthorityIntent>(TargetEntityId)->VirtualWorkerId = ServerTwoVirtualWorkerId;
+
+	TUniquePtr<SpatialVirtualWorkerTranslator> ServerTwoTranslator = CreateServerTwoTranslator();
+
+	CrossServerRPCService ServerOne(CreateExtractRPCDelegate(ExtractedRPCs), NewObject<USpatialStaticComponentView>());
+	CrossServerRPCService ServerTwo(CreateExtractRPCDelegate(ExtractedRPCs), ServerTwoView);
+	ServerTwo.SetVirtualWorkerTranslator(ServerTwoTranslator.Get());
+	ServerOne.OnEndpointAuthorityGained(ServerOneEntityId);
+	ServerTwo.OnEndpointAuthorityGained(ServerTwoEntityId);
+	SeeEndpoint(ServerOne, ServerTwoEntityId);
+	SeeEndpoint(ServerTwo, ServerOneEntityId);
+	DeliverUpdates(ServerTwo, { &ServerOne });
+
+	TestTrue("The RPC was written", ServerOne.PushRPC(TargetEntityId, CreatePayload(), true) == EPushRPCResult::Success);
+	DeliverUpdates(ServerOne, { &ServerTwo });
+
+	TestEqual("The RPC was not executed before the handover", ExtractedRPCs.Num(), 0);
+	TestEqual("The RPC was held", ServerTwo.GetNumHeldRPCs(), 1);
+
+	SetEndpointAuthority(*ServerTwoView, WORKER_AUTHORITY_AUTHORITATIVE);
+	ServerTwo.ProcessHeldRPCs();
+
+	TestEqual("The RPC was executed after the handover", ExtractedRPCs.Num(), 1);
+	TestEqual("No RPCs are held", ServerTwo.GetNumHeldRPCs(), 0);
+
+	return true;
+}
+
+CROSSSERVERRPCSERVICE_TEST(GIVEN_one_server_stops_acking_WHEN_a_whole_ring_buffer_of_RPCs_is_queued_THEN_the_RPCs_are_written_for_the_other_servers)
+{
+	TArray<Worker_EntityId> ExtractedRPCs;
+	CrossServerRPCService ServerOne(CreateExtractRPCDelegate(ExtractedRPCs), NewObject<USpatialStaticComponentView>());
+	CrossServerRPCService ServerTwo(CreateExtractRPCDelegate(ExtractedRPCs), NewObject<USpatialStaticComponentView>());
+	CrossServerRPCService ServerThree(CreateExtractRPCDelegate(ExtractedRPCs), NewObject<USpatialStaticComponentView>());
+	ServerOne.OnEndpointAuthorityGained(ServerOneEntityId);
+	ServerTwo.OnEndpointAuthorityGained(ServerTwoEntityId);
+	ServerThree.OnEndpointAuthorityGained(ServerThreeEntityId);
+	SeeEndpoint(ServerOne, ServerTwoEntityId);
+	SeeEndpoint(ServerOne, ServerThreeEntityId);
+	SeeEndpoint(ServerTwo, ServerOneEntityId);
+	SeeEndpoint(ServerThree, ServerOneEntityId);
+	DeliverUpdates(ServerTwo, { &ServerOne });
+	DeliverUpdates(ServerThree, { &ServerOne });
+
+	const uint32 RingBufferSize = GetRingBufferSize();
+	for (uint32 i = 0; i < RingBufferSize; i++)
+	{
+		ServerOne.PushRPC(TargetEntityId, CreatePayload(), false);
+	}
+	DeliverUpdates(ServerOne, { &ServerTwo, &ServerThree });
+
+	// Server three acks everything, server two's acks never arrive.
+	DeliverUpdates(ServerThree, { &ServerOne });
+	DeliverUpdates(ServerTwo, {});
+
+	for (uint32 i = 0; i < RingBufferSize; i++)
+	{
+		ServerOne.PushRPC(TargetEntityId, CreatePayload(), false);
+	}
+	TestEqual("The RPCs were queued behind server two", ServerOne.GetNumOverflowedRPCs(), static_cast<int32>(RingBufferSize));
+
+	ServerOne.PushOverflowedRPCs();
+	TestEqual("The RPCs were written without waiting for server two", ServerOne.GetNumOverflowedRPCs(), 0);
+
+	return true;
+}
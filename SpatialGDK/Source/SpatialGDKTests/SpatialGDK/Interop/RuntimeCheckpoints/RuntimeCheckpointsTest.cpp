@@ -0,0 +1,295 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/RuntimeCheckpoints.h"
+#include "SpatialConstants.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#define RUNTIME_CHECKPOINTS_TEST(TestName) \
+	GDK_TEST(Core, RuntimeCheckpoints, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		const Worker_ComponentId TestComponentId = 1000;
+		const Schema_FieldId TestFieldId = 1;
+
+		struct FWrittenChunks
+		{
+			TArray<TArray<Worker_EntityId>> EntityIds;
+			TArray<uint32> TestFieldValues;
+			TArray<Worker_EntityId> DeletedEntityIds;
+		};
+
+		class FTestCheckpointStorage : public FCheckpointStorage
+		{
+		public:
+			explicit FTestCheckpointStorage(const TSharedRef<FWrittenChunks>& InWritten)
+				: Written(InWritten)
+			{
+			}
+
+			virtual bool WriteChunk(const FCheckpointChunk& Chunk) override
+			{
+				TArray<Worker_EntityId>& EntityIds = Written->EntityIds.AddDefaulted_GetRef();
+				for (const FCheckpointEntity& Entity : Chunk.Entities)
+				{
+					EntityIds.Add(Entity.EntityId);
+					for (const ComponentData& Component : Entity.Components)
+					{
+						if (Component.GetComponentId() == TestComponentId)
+						{
+							Written->TestFieldValues.Add(Schema_GetUint32(Component.GetFields(), TestFieldId));
+						}
+					}
+				}
+				Written->DeletedEntityIds.Append(Chunk.DeletedEntityIds);
+				return true;
+			}
+
+		private:
+			TSharedRef<FWrittenChunks> Written;
+		};
+
+		void AddEntity(FRuntimeCheckpointer& Checkpointer, Worker_EntityId EntityId, bool bPersistent, bool bAuthoritative)
+		{
+			Worker_Op Op{};
+			Op.op_type = WORKER_OP_TYPE_ADD_ENTITY;
+			Op.op.add_entity.entity_id = EntityId;
+			Checkpointer.RecordReceivedOp(Op);
+
+			TArray<Worker_ComponentId> ComponentIds = { SpatialConstants::POSITION_COMPONENT_ID, TestComponentId };
+			if (bPersistent)
+			{
+				ComponentIds.Add(SpatialConstants::PERSISTENCE_COMPONENT_ID);
+			}
+			for (Worker_ComponentId ComponentId : ComponentIds)
+			{
+				Op = {};
+				Op.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+				Op.op.add_component.entity_id = EntityId;
+				Op.op.add_component.data.component_id = ComponentId;
+				Op.op.add_component.data.schema_type = Schema_CreateComponentData();
+				if (ComponentId == TestComponentId)
+				{
+					Schema_AddUint32(Schema_GetComponentDataFields(Op.op.add_component.data.schema_type), TestFieldId, 1);
+				}
+				Checkpointer.RecordReceivedOp(Op);
+				Schema_DestroyComponentData(Op.op.add_component.data.schema_type);
+			}
+
+			if (bAuthoritative)
+			{
+				Op = {};
+				Op.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
+				Op.op.authority_change.entity_id = EntityId;
+				Op.op.authority_change.component_id = SpatialConstants::POSITION_COMPONENT_ID;
+				Op.op.authority_change.authority = WORKER_AUTHORITY_AUTHORITATIVE;
+				Checkpointer.RecordReceivedOp(Op);
+			}
+		}
+
+		void Checkpoint(FRuntimeCheckpointer& Checkpointer)
+		{
+			Checkpointer.RequestCheckpoint();
+			Checkpointer.Tick(FPlatformTime::Seconds() + 1.0);
+			Checkpointer.WaitForPendingWrites();
+		}
+
+		FCheckpointEntity MakeCheckpointEntity(Worker_EntityId EntityId, uint32 TestFieldValue)
+		{
+			FCheckpointEntity Entity;
+			Entity.EntityId = EntityId;
+			Entity.Components.Emplace(SpatialConstants::POSITION_COMPONENT_ID);
+			Entity.Components.Emplace(TestComponentId);
+			Schema_AddUint32(Entity.Components.Last().GetFields(), TestFieldId, TestFieldValue);
+			return Entity;
+		}
+
+		// Reads the snapshot files newest first, the way SpatialSnapshotManager::LoadCheckpoint does, and returns the test field value
+		// of each entity restored.
+		TMap<Worker_EntityId, uint32> RestoreCheckpoint(const TArray<FString>& SnapshotPaths, TSet<Worker_EntityId>&& DeletedEntityIds,
+			int32& OutNumRestored)
+		{
+			TMap<Worker_EntityId, uint32> Restored;
+			OutNumRestored = 0;
+			FCheckpointRestoreFilter Filter(MoveTemp(DeletedEntityIds));
+
+			Worker_ComponentVtable DefaultVtable{};
+			Worker_SnapshotParameters Parameters{};
+			Parameters.default_component_vtable = &DefaultVtable;
+
+			for (const FString& SnapshotPath : SnapshotPaths)
+			{
+				Worker_SnapshotInputStream* Snapshot = Worker_SnapshotInputStream_Create(TCHAR_TO_UTF8(*SnapshotPath), &Parameters);
+				while (Worker_SnapshotInputStream_HasNext(Snapshot) > 0)
+				{
+					const Worker_Entity* Entity = Worker_SnapshotInputStream_ReadEntity(Snapshot);
+					if (Entity == nullptr || !Filter.ShouldRestore(Entity->entity_id))
+					{
+						continue;
+					}
+
+					OutNumRestored++;
+					for (uint32 i = 0; i < Entity->component_count; i++)
+					{
+						if (Entity->components[i].component_id == TestComponentId)
+						{
+							Restored.Add(Entity->entity_id, Schema_GetUint32(Schema_GetComponentDataFields(Entity->components[i].schema_type), TestFieldId));
+						}
+					}
+				}
+				Worker_SnapshotInputStream_Destroy(Snapshot);
+			}
+
+			return Restored;
+		}
+	} // anonymous namespace
+
+	RUNTIME_CHECKPOINTS_TEST(GIVEN_authoritative_and_other_entities_WHEN_checkpointed_THEN_only_authoritative_persistent_entities_are_written)
+	{
+		TSharedRef<FWrittenChunks> Written = MakeShared<FWrittenChunks>();
+		FRuntimeCheckpointer Checkpointer(MakeUnique<FTestCheckpointStorage>(Written), 60.f, 100, 1000.f);
+
+		AddEntity(Checkpointer, 1, /* bPersistent */ true, /* bAuthoritative */ true);
+		AddEntity(Checkpointer, 2, /* bPersistent */ false, /* bAuthoritative */ true);
+		AddEntity(Checkpointer, 3, /* bPersistent */ true, /* bAuthoritative */ false);
+		Checkpoint(Checkpointer);
+
+		TestEqual("Chunks written", Written->EntityIds.Num(), 1);
+		TestTrue("Entities written", Written->EntityIds.Num() == 1 && Written->EntityIds[0] == TArray<Worker_EntityId>{ 1 });
+		TestEqual("Non-persistent entities aren't tracked", Checkpointer.GetNumTrackedEntities(), 2);
+
+		return true;
+	}
+
+	RUNTIME_CHECKPOINTS_TEST(GIVEN_a_sent_update_WHEN_checkpointed_again_THEN_the_entity_is_written_with_the_update_applied)
+	{
+		TSharedRef<FWrittenChunks> Written = MakeShared<FWrittenChunks>();
+		FRuntimeCheckpointer Checkpointer(MakeUnique<FTestCheckpointStorage>(Written), 60.f, 100, 1000.f);
+
+		AddEntity(Checkpointer, 1, /* bPersistent */ true, /* bAuthoritative */ true);
+		AddEntity(Checkpointer, 2, /* bPersistent */ true, /* bAuthoritative */ true);
+		Checkpoint(Checkpointer);
+
+		Worker_ComponentUpdate Update{};
+		Update.component_id = TestComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		Schema_AddUint32(Schema_GetComponentUpdateFields(Update.schema_type), TestFieldId, 2);
+		Checkpointer.RecordSentComponentUpdate(2, Update);
+		Schema_DestroyComponentUpdate(Update.schema_type);
+
+		TestEqual("Dirty entities", Checkpointer.GetNumDirtyEntities(), 1);
+		Checkpoint(Checkpointer);
+
+		TestEqual("Chunks written", Written->EntityIds.Num(), 2);
+		TestTrue("Only the updated entity is written again", Written->EntityIds.Num() == 2 && Written->EntityIds[1] == TArray<Worker_EntityId>{ 2 });
+		TestTrue("The update is applied", Written->TestFieldValues.Num() == 3 && Written->TestFieldValues.Last() == 2);
+
+		return true;
+	}
+
+	RUNTIME_CHECKPOINTS_TEST(GIVEN_more_dirty_entities_than_the_rate_limit_WHEN_ticked_THEN_they_are_written_over_several_ticks)
+	{
+		TSharedRef<FWrittenChunks> Written = MakeShared<FWrittenChunks>();
+		FRuntimeCheckpointer Checkpointer(MakeUnique<FTestCheckpointStorage>(Written), 60.f, 2, 3.f);
+
+		for (Worker_EntityId EntityId = 1; EntityId <= 5; EntityId++)
+		{
+			AddEntity(Checkpointer, EntityId, /* bPersistent */ true, /* bAuthoritative */ true);
+		}
+
+		const double Now = FPlatformTime::Seconds() + 1.0;
+		Checkpointer.RequestCheckpoint();
+		Checkpointer.Tick(Now);
+		Checkpointer.WaitForPendingWrites();
+
+		// The third entity copied waits in a chunk that isn't full yet.
+		int32 NumWritten = 0;
+		for (const TArray<Worker_EntityId>& EntityIds : Written->EntityIds)
+		{
+			TestTrue("Chunk size", EntityIds.Num() <= 2);
+			NumWritten += EntityIds.Num();
+		}
+		TestEqual("Entities written in the first second", NumWritten, 2);
+
+		Checkpointer.Tick(Now + 1.0);
+		Checkpointer.WaitForPendingWrites();
+
+		NumWritten = 0;
+		for (const TArray<Worker_EntityId>& EntityIds : Written->EntityIds)
+		{
+			NumWritten += EntityIds.Num();
+		}
+		TestEqual("Entities written in total", NumWritten, 5);
+
+		return true;
+	}
+
+	RUNTIME_CHECKPOINTS_TEST(GIVEN_a_deleted_entity_WHEN_checkpointed_THEN_its_deletion_is_written)
+	{
+		TSharedRef<FWrittenChunks> Written = MakeShared<FWrittenChunks>();
+		FRuntimeCheckpointer Checkpointer(MakeUnique<FTestCheckpointStorage>(Written), 60.f, 100, 1000.f);
+
+		AddEntity(Checkpointer, 1, /* bPersistent */ true, /* bAuthoritative */ true);
+		AddEntity(Checkpointer, 2, /* bPersistent */ true, /* bAuthoritative */ true);
+		Checkpointer.RecordSentDeleteEntity(2);
+		Checkpoint(Checkpointer);
+
+		TestTrue("Entities written", Written->EntityIds.Num() == 1 && Written->EntityIds[0] == TArray<Worker_EntityId>{ 1 });
+		TestTrue("Deleted entities", Written->DeletedEntityIds == TArray<Worker_EntityId>{ 2 });
+
+		return true;
+	}
+
+	RUNTIME_CHECKPOINTS_TEST(GIVEN_an_entity_written_to_several_chunks_WHEN_the_checkpoint_is_restored_THEN_its_newest_state_is_restored_once)
+	{
+		const FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RuntimeCheckpointsTest"));
+		IFileManager::Get().DeleteDirectory(*Directory, /* RequireExists */ false, /* Tree */ true);
+
+		{
+			FFileCheckpointStorage Storage(Directory, TEXT("TestWorker"));
+
+			FCheckpointChunk OldChunk;
+			OldChunk.TimestampTicks = 1;
+			OldChunk.Entities.Add(MakeCheckpointEntity(1, 1));
+			TestTrue("Wrote the oldest chunk", Storage.WriteChunk(OldChunk));
+
+			FCheckpointChunk NewChunk;
+			NewChunk.TimestampTicks = 2;
+			NewChunk.Sequence = 1;
+			NewChunk.Entities.Add(MakeCheckpointEntity(1, 2));
+			NewChunk.Entities.Add(MakeCheckpointEntity(2, 1));
+			TestTrue("Wrote the newer chunk", Storage.WriteChunk(NewChunk));
+
+			FCheckpointChunk DeletionChunk;
+			DeletionChunk.TimestampTicks = 3;
+			DeletionChunk.Sequence = 2;
+			DeletionChunk.DeletedEntityIds.Add(2);
+			TestTrue("Wrote the deletion chunk", Storage.WriteChunk(DeletionChunk));
+		}
+
+		TArray<FString> SnapshotPaths;
+		TSet<Worker_EntityId> DeletedEntityIds;
+		FFileCheckpointStorage::FindChunks(Directory, SnapshotPaths, DeletedEntityIds);
+
+		TestEqual("Snapshot files found", SnapshotPaths.Num(), 2);
+		TestTrue("Snapshot files are newest first", SnapshotPaths.Num() == 2 && SnapshotPaths[0] > SnapshotPaths[1]);
+		TestTrue("Deleted entities found", DeletedEntityIds.Num() == 1 && DeletedEntityIds.Contains(2));
+
+		int32 NumRestored = 0;
+		const TMap<Worker_EntityId, uint32> Restored = RestoreCheckpoint(SnapshotPaths, MoveTemp(DeletedEntityIds), NumRestored);
+
+		TestEqual("Entities restored", NumRestored, 1);
+		TestTrue("The newest state of the entity is restored", Restored.Num() == 1 && Restored.FindRef(1) == 2);
+		TestFalse("The deleted entity isn't restored", Restored.Contains(2));
+
+		IFileManager::Get().DeleteDirectory(*Directory, /* RequireExists */ false, /* Tree */ true);
+
+		return true;
+	}
+}
@@ -0,0 +1,69 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/SchemaDatabase.h"
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+
+#define CLASSINFOMANAGER_TEST(TestName) \
+	GDK_TEST(Core, USpatialClassInfoManager, TestName)
+
+CLASSINFOMANAGER_TEST(GIVEN_an_actor_class_with_subobjects_WHEN_getting_its_data_components_THEN_subobject_and_dynamic_subobject_components_are_included)
+{
+	const FString SubobjectClassPath = UActorComponent::StaticClass()->GetPathName();
+
+	USpatialClassInfoManager* ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	ClassInfoManager->SchemaDatabase = NewObject<USchemaDatabase>();
+
+	FActorSchemaData& ActorSchemaData = ClassInfoManager->SchemaDatabase->ActorClassPathToSchema.Add(APawn::StaticClass()->GetPathName());
+	ActorSchemaData.SchemaComponents[SCHEMA_Data] = 10000;
+	ActorSchemaData.SchemaComponents[SCHEMA_OwnerOnly] = 10001;
+
+	FActorSpecificSubobjectSchemaData& SubobjectSchemaData = ActorSchemaData.SubobjectData.Add(1);
+	SubobjectSchemaData.ClassPath = SubobjectClassPath;
+	SubobjectSchemaData.SchemaComponents[SCHEMA_Data] = 10002;
+	SubobjectSchemaData.SchemaComponents[SCHEMA_Handover] = 10003;
+
+	FSubobjectSchemaData& SubobjectClassSchemaData = ClassInfoManager->SchemaDatabase->SubobjectClassPathToSchema.Add(SubobjectClassPath);
+	SubobjectClassSchemaData.DynamicSubobjectComponents.AddDefaulted_GetRef().SchemaComponents[SCHEMA_Data] = 10004;
+	SubobjectClassSchemaData.DynamicSubobjectComponents.AddDefaulted_GetRef().SchemaComponents[SCHEMA_Data] = 10005;
+
+	TArray<Worker_ComponentId> ComponentIds = ClassInfoManager->GetDataComponentIdsForActorClassHierarchy(*APawn::StaticClass());
+	ComponentIds.Sort();
+
+	const TArray<Worker_ComponentId> ExpectedComponentIds = { 10000, 10002, 10004, 10005 };
+	TestTrue("Only the data components of the actor and its default and dynamic subobjects are returned", ComponentIds == ExpectedComponentIds);
+
+	return true;
+}
+
+CLASSINFOMANAGER_TEST(GIVEN_an_actor_class_info_without_subobjects_handover_properties_or_RPCs_WHEN_checking_if_it_is_simple_THEN_returns_true)
+{
+	FClassInfo Info;
+	Info.Class = APawn::StaticClass();
+
+	TestTrue("The class is simple", USpatialClassInfoManager::IsSimpleActorClass(Info));
+
+	return true;
+}
+
+CLASSINFOMANAGER_TEST(GIVEN_an_actor_class_info_with_subobjects_handover_properties_or_RPCs_WHEN_checking_if_it_is_simple_THEN_returns_false)
+{
+	FClassInfo WithSubobject;
+	WithSubobject.SubobjectInfo.Add(1, MakeShared<FClassInfo>());
+	TestFalse("A class with a subobject isn't simple", USpatialClassInfoManager::IsSimpleActorClass(WithSubobject));
+
+	FClassInfo WithHandoverProperty;
+	WithHandoverProperty.HandoverProperties.AddDefaulted();
+	TestFalse("A class with a handover property isn't simple", USpatialClassInfoManager::IsSimpleActorClass(WithHandoverProperty));
+
+	FClassInfo WithRPC;
+	WithRPC.RPCs.Add(nullptr);
+	TestFalse("A class with an RPC isn't simple", USpatialClassInfoManager::IsSimpleActorClass(WithRPC));
+
+	return true;
+}
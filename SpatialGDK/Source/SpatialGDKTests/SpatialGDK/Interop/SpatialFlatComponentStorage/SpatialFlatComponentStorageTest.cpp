@@ -0,0 +1,124 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialFlatComponentStorage.h"
+#include "Schema/StandardLibrary.h"
+
+#include "CoreMinimal.h"
+
+#define FLATCOMPONENTSTORAGE_TEST(TestName) \
+	GDK_TEST(Core, FSpatialFlatComponentStorage, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId TestEntityId = 1;
+const Worker_EntityId OtherTestEntityId = 2;
+const Worker_ComponentId GeneratedComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+} // anonymous namespace
+
+FLATCOMPONENTSTORAGE_TEST(GIVEN_empty_storage_WHEN_querying_THEN_nothing_is_found)
+{
+	FSpatialFlatComponentStorage Storage;
+
+	TestFalse("Has component", Storage.HasComponent(TestEntityId, SpatialConstants::POSITION_COMPONENT_ID));
+	TestNull("Component data", Storage.GetComponent(TestEntityId, SpatialConstants::POSITION_COMPONENT_ID));
+	TestEqual("Authority", Storage.GetAuthority(TestEntityId, SpatialConstants::POSITION_COMPONENT_ID), WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	return true;
+}
+
+FLATCOMPONENTSTORAGE_TEST(GIVEN_a_handwritten_component_WHEN_added_THEN_its_data_is_returned)
+{
+	FSpatialFlatComponentStorage Storage;
+
+	Storage.AddComponent(TestEntityId, Position::ComponentId, MakeUnique<Position>(Coordinates{ 1.0, 2.0, 3.0 }));
+
+	Position* Data = static_cast<Position*>(Storage.GetComponent(TestEntityId, Position::ComponentId));
+	TestTrue("Has component", Storage.HasComponent(TestEntityId, Position::ComponentId));
+	TestNotNull("Component data", Data);
+	if (Data != nullptr)
+	{
+		TestEqual("Coordinates", Data->Coords.X, 1.0);
+	}
+	TestFalse("Other entity has component", Storage.HasComponent(OtherTestEntityId, Position::ComponentId));
+
+	return true;
+}
+
+FLATCOMPONENTSTORAGE_TEST(GIVEN_a_generated_component_WHEN_added_THEN_it_is_present_without_data)
+{
+	FSpatialFlatComponentStorage Storage;
+
+	Storage.AddComponent(TestEntityId, GeneratedComponentId, nullptr);
+
+	TestTrue("Has component", Storage.HasComponent(TestEntityId, GeneratedComponentId));
+	TestNull("Component data", Storage.GetComponent(TestEntityId, GeneratedComponentId));
+
+	return true;
+}
+
+FLATCOMPONENTSTORAGE_TEST(GIVEN_an_authoritative_component_WHEN_the_component_is_removed_THEN_authority_is_kept_until_the_entity_is_removed)
+{
+	FSpatialFlatComponentStorage Storage;
+
+	Storage.AddComponent(TestEntityId, GeneratedComponentId, nullptr);
+	Storage.SetAuthority(TestEntityId, GeneratedComponentId, WORKER_AUTHORITY_AUTHORITATIVE);
+	Storage.RemoveComponent(TestEntityId, GeneratedComponentId);
+
+	TestFalse("Has component", Storage.HasComponent(TestEntityId, GeneratedComponentId));
+	TestEqual("Authority after component removal", Storage.GetAuthority(TestEntityId, GeneratedComponentId), WORKER_AUTHORITY_AUTHORITATIVE);
+
+	Storage.RemoveEntity(TestEntityId);
+
+	TestEqual("Authority after entity removal", Storage.GetAuthority(TestEntityId, GeneratedComponentId), WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	return true;
+}
+
+FLATCOMPONENTSTORAGE_TEST(GIVEN_a_removed_entity_WHEN_a_new_entity_reuses_its_slot_THEN_no_state_is_carried_over)
+{
+	FSpatialFlatComponentStorage Storage;
+
+	Storage.AddComponent(TestEntityId, Position::ComponentId, MakeUnique<Position>());
+	Storage.SetAuthority(TestEntityId, Position::ComponentId, WORKER_AUTHORITY_AUTHORITATIVE);
+	Storage.RemoveEntity(TestEntityId);
+
+	Storage.AddComponent(OtherTestEntityId, GeneratedComponentId, nullptr);
+
+	TestFalse("Has removed entity's component", Storage.HasComponent(OtherTestEntityId, Position::ComponentId));
+	TestNull("Removed entity's component data", Storage.GetComponent(OtherTestEntityId, Position::ComponentId));
+	TestEqual("Removed entity's authority", Storage.GetAuthority(OtherTestEntityId, Position::ComponentId), WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TArray<Worker_EntityId_Key> EntityIds;
+	Storage.GetEntityIds(EntityIds);
+	TestTrue("Entity ids", EntityIds == TArray<Worker_EntityId_Key>{ OtherTestEntityId });
+
+	return true;
+}
+
+FLATCOMPONENTSTORAGE_TEST(GIVEN_two_entities_WHEN_the_first_is_removed_THEN_the_other_keeps_its_data_and_counts_are_updated)
+{
+	FSpatialFlatComponentStorage Storage;
+
+	Storage.AddComponent(TestEntityId, Position::ComponentId, MakeUnique<Position>());
+	Storage.AddComponent(OtherTestEntityId, Position::ComponentId, MakeUnique<Position>());
+	Storage.AddComponent(OtherTestEntityId, GeneratedComponentId, nullptr);
+	Storage.SetAuthority(OtherTestEntityId, Position::ComponentId, WORKER_AUTHORITY_AUTHORITATIVE);
+	Component* OtherPosition = Storage.GetComponent(OtherTestEntityId, Position::ComponentId);
+
+	Storage.RemoveEntity(TestEntityId);
+
+	TestTrue("Other entity's data moved with it", Storage.GetComponent(OtherTestEntityId, Position::ComponentId) == OtherPosition);
+	TestTrue("Other entity has generated component", Storage.HasComponent(OtherTestEntityId, GeneratedComponentId));
+	TestEqual("Other entity's authority", Storage.GetAuthority(OtherTestEntityId, Position::ComponentId), WORKER_AUTHORITY_AUTHORITATIVE);
+
+	TMap<Worker_ComponentId, int32> Counts;
+	Storage.GetComponentCounts(Counts);
+	TestTrue("Position count", Counts.FindRef(Position::ComponentId) == 1);
+	TestTrue("Generated component count", Counts.FindRef(GeneratedComponentId) == 1);
+
+	return true;
+}
@@ -53,6 +53,9 @@ void SpatialOSDispatcherSpy::OnReserveEntityIdsResponse(const Worker_ReserveEnti
 void SpatialOSDispatcherSpy::OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op)
 {}
 
+void SpatialOSDispatcherSpy::OnDeleteEntityResponse(const Worker_DeleteEntityResponseOp& Op)
+{}
+
 void SpatialOSDispatcherSpy::AddPendingActorRequest(Worker_RequestId RequestId, USpatialActorChannel* Channel)
 {}
 
@@ -70,6 +73,9 @@ void SpatialOSDispatcherSpy::AddReserveEntityIdsDelegate(Worker_RequestId Reques
 void SpatialOSDispatcherSpy::AddCreateEntityDelegate(Worker_RequestId RequestId, CreateEntityDelegate Delegate)
 {}
 
+void SpatialOSDispatcherSpy::AddDeleteEntityDelegate(Worker_RequestId RequestId, DeleteEntityDelegate Delegate)
+{}
+
 void SpatialOSDispatcherSpy::OnEntityQueryResponse(const Worker_EntityQueryResponseOp& Op)
 {}
 
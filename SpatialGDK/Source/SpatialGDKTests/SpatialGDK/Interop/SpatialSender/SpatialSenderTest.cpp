@@ -0,0 +1,115 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Tests/TestingComponentViewHelpers.h"
+#include "Utils/ComponentFactory.h"
+
+#include "CoreMinimal.h"
+
+#define SPATIALSENDER_TEST(TestName) \
+	GDK_TEST(Core, USpatialSender, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+constexpr Worker_EntityId BatchedEntityId = 1;
+
+TSharedRef<FReliableRPCForRetry> CreateRetryRPC(UObject* TargetObject, int RetryIndex)
+{
+	return MakeShared<FReliableRPCForRetry>(TargetObject, nullptr, SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID, 0, TArray<uint8>(), RetryIndex);
+}
+
+} // anonymous namespace
+
+SPATIALSENDER_TEST(GIVEN_two_RPCs_to_the_same_target_WHEN_getting_their_retry_wait_times_THEN_they_have_the_same_jitter)
+{
+	UObject* TargetObject = NewObject<UObject>();
+	const TSharedRef<FReliableRPCForRetry> FirstRPC = CreateRetryRPC(TargetObject, 0);
+	const TSharedRef<FReliableRPCForRetry> SecondRPC = CreateRetryRPC(TargetObject, 1);
+
+	const float Jitter = 0.5f;
+	const float FirstWaitTime = USpatialSender::GetRetryWaitTime(*FirstRPC, Jitter);
+	const float BaseWaitTime = SpatialConstants::GetCommandRetryWaitTimeSeconds(FirstRPC->Attempts);
+
+	TestEqual("Both RPCs wait as long", USpatialSender::GetRetryWaitTime(*SecondRPC, Jitter), FirstWaitTime);
+	TestTrue("The wait is within the jitter", FirstWaitTime >= BaseWaitTime * (1.0f - Jitter) && FirstWaitTime <= BaseWaitTime * (1.0f + Jitter));
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_a_scheduled_retry_WHEN_its_target_is_destroyed_THEN_flushing_drops_it)
+{
+	USpatialSender* Sender = NewObject<USpatialSender>();
+	UObject* TargetObject = NewObject<UObject>();
+	const TSharedRef<FReliableRPCForRetry> RetryRPC = CreateRetryRPC(TargetObject, 0);
+
+	Sender->EnqueueRetryRPC(RetryRPC);
+	TestTrue("The retry was scheduled", Sender->GetNumQueuedRetryRPCs() == 1.0);
+
+	TargetObject->MarkPendingKill();
+	Sender->FlushRetryRPCs();
+
+	TestTrue("The retry was dropped", Sender->GetNumQueuedRetryRPCs() == 0.0);
+	TestFalse("The RPC can be scheduled again", RetryRPC->bRetryScheduled);
+	TestTrue("Nothing is in flight", Sender->GetNumRetryRPCsInFlight() == 0);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_a_component_update_batch_WHEN_components_are_added_and_removed_THEN_they_are_sent_with_the_batch_in_order)
+{
+	USpatialGDKSettings* Settings = GetMutableDefault<USpatialGDKSettings>();
+	const bool bOldBatchSubobjectComponentUpdates = Settings->bBatchSubobjectComponentUpdates;
+	const float OldQueuedOutgoingRPCRetryTime = Settings->QueuedOutgoingRPCRetryTime;
+	Settings->bBatchSubobjectComponentUpdates = true;
+	Settings->QueuedOutgoingRPCRetryTime = 0.0f;
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+	NetDriver->Connection = NewObject<USpatialWorkerConnection>();
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*NetDriver->StaticComponentView, BatchedEntityId, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	TArray<EOutgoingMessageType> SentMessageTypes;
+	NetDriver->Connection->OnEnqueueMessage.AddLambda([&SentMessageTypes](const FOutgoingMessage* Message)
+	{
+		SentMessageTypes.Add(Message->Type);
+	});
+
+	USpatialSender* Sender = NewObject<USpatialSender>();
+	Sender->Init(NetDriver, nullptr, nullptr);
+
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+	Channel->SetEntityId(BatchedEntityId);
+
+	const Worker_ComponentId RemovedComponentId = 10000;
+	const Worker_ComponentId AddedComponentId = 10001;
+
+	Sender->BeginComponentUpdateBatch(Channel);
+	Sender->SendRemoveComponents(BatchedEntityId, { RemovedComponentId });
+	Sender->SendAddComponents(BatchedEntityId, { ComponentFactory::CreateEmptyComponentData(AddedComponentId) });
+
+	TestEqual("Nothing is sent while the batch is open", SentMessageTypes.Num(), 0);
+
+	Sender->EndComponentUpdateBatch();
+
+	const TArray<EOutgoingMessageType> ExpectedMessageTypes = {
+		EOutgoingMessageType::ComponentUpdate, EOutgoingMessageType::RemoveComponent,
+		EOutgoingMessageType::ComponentUpdate, EOutgoingMessageType::AddComponent
+	};
+	TestTrue("The removal and addition are sent with their ComponentPresence updates, in order", SentMessageTypes == ExpectedMessageTypes);
+
+	Settings->bBatchSubobjectComponentUpdates = bOldBatchSubobjectComponentUpdates;
+	Settings->QueuedOutgoingRPCRetryTime = OldQueuedOutgoingRPCRetryTime;
+
+	return true;
+}
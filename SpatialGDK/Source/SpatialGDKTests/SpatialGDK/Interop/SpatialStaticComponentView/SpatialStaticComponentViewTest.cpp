@@ -0,0 +1,131 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/AuthorityIntent.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialGDKSettings.h"
+#include "Tests/TestingComponentViewHelpers.h"
+
+#include "Async/ParallelFor.h"
+#include "CoreMinimal.h"
+
+#define STATICCOMPONENTVIEW_TEST(TestName) \
+	GDK_TEST(Core, USpatialStaticComponentView, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId TestEntityId = 1;
+
+// Creates a view which only stores the given components, on top of the ones the GDK reads itself.
+USpatialStaticComponentView* CreateViewStoring(const TArray<uint32>& StoredComponentIds)
+{
+	USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+	const TArray<uint32> OldStoredComponentIds = SpatialGDKSettings->StaticComponentViewStoredComponentIds;
+	SpatialGDKSettings->StaticComponentViewStoredComponentIds = StoredComponentIds;
+
+	USpatialStaticComponentView* View = NewObject<USpatialStaticComponentView>();
+
+	SpatialGDKSettings->StaticComponentViewStoredComponentIds = OldStoredComponentIds;
+	return View;
+}
+} // anonymous namespace
+
+STATICCOMPONENTVIEW_TEST(GIVEN_a_stored_component_list_WHEN_adding_components_THEN_only_listed_and_GDK_components_keep_their_data)
+{
+	USpatialStaticComponentView* View = CreateViewStoring({ SpatialConstants::METADATA_COMPONENT_ID });
+
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*View, TestEntityId, SpatialConstants::PERSISTENCE_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*View, TestEntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TestTrue("Unlisted component is present", View->HasComponent(TestEntityId, SpatialConstants::PERSISTENCE_COMPONENT_ID));
+	TestNull("Unlisted component data isn't stored", View->GetComponentData<Persistence>(TestEntityId));
+	TestNotNull("Component read by the GDK is stored although it isn't listed", View->GetComponentData<AuthorityIntent>(TestEntityId));
+
+	return true;
+}
+
+STATICCOMPONENTVIEW_TEST(GIVEN_an_empty_stored_component_list_WHEN_adding_components_THEN_all_hand_written_data_is_stored)
+{
+	USpatialStaticComponentView* View = CreateViewStoring({});
+
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*View, TestEntityId, SpatialConstants::PERSISTENCE_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TestNotNull("Component data is stored", View->GetComponentData<Persistence>(TestEntityId));
+
+	return true;
+}
+
+STATICCOMPONENTVIEW_TEST(GIVEN_a_view_WHEN_reading_component_data_from_several_threads_THEN_every_read_is_counted)
+{
+	USpatialStaticComponentView* View = CreateViewStoring({});
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*View, TestEntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	const int32 NumReads = 10000;
+	ParallelFor(NumReads, [View](int32)
+	{
+		View->GetComponentData<AuthorityIntent>(TestEntityId);
+	});
+
+	TestTrue("Every read was counted", View->GetNumReads(SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID) == static_cast<uint64>(NumReads));
+	TestTrue("Other components weren't read", View->GetNumReads(SpatialConstants::PERSISTENCE_COMPONENT_ID) == 0);
+
+	return true;
+}
+
+STATICCOMPONENTVIEW_TEST(GIVEN_a_view_keeping_all_component_data_WHEN_creating_view_ops_for_travel_THEN_entities_are_added_with_their_latest_data_and_authority)
+{
+	const Worker_ComponentId GeneratedComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+	const Schema_FieldId FieldId = 1;
+
+	USpatialStaticComponentView* View = CreateViewStoring({});
+	View->SetKeepAllComponentData(true);
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_AddUint32(Schema_GetComponentDataFields(Data), FieldId, 1);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*View, TestEntityId, GeneratedComponentId, Data, WORKER_AUTHORITY_AUTHORITATIVE);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*View, TestEntityId, SpatialConstants::PERSISTENCE_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	Worker_ComponentUpdateOp UpdateOp{};
+	UpdateOp.entity_id = TestEntityId;
+	UpdateOp.update.component_id = GeneratedComponentId;
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), FieldId, 2);
+	View->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+
+	TArray<Worker_Op> Ops;
+	TArray<ComponentData> OpData;
+	View->CreateViewOps(Ops, OpData);
+
+	// Critical section, entity, two components, one authority change and the end of the critical section.
+	TestEqual("Number of ops", Ops.Num(), 6);
+	if (Ops.Num() != 6)
+	{
+		return true;
+	}
+
+	TestTrue("Ops start a critical section", Ops[0].op_type == WORKER_OP_TYPE_CRITICAL_SECTION && Ops[0].op.critical_section.in_critical_section != 0);
+	TestTrue("The entity is added", Ops[1].op_type == WORKER_OP_TYPE_ADD_ENTITY && Ops[1].op.add_entity.entity_id == TestEntityId);
+	TestTrue("Ops end the critical section", Ops[5].op_type == WORKER_OP_TYPE_CRITICAL_SECTION && Ops[5].op.critical_section.in_critical_section == 0);
+
+	bool bFoundGeneratedComponent = false;
+	for (const Worker_Op& Op : Ops)
+	{
+		if (Op.op_type == WORKER_OP_TYPE_ADD_COMPONENT && Op.op.add_component.data.component_id == GeneratedComponentId)
+		{
+			bFoundGeneratedComponent = true;
+			TestTrue("Generated component has the updated data", Schema_GetUint32(Schema_GetComponentDataFields(Op.op.add_component.data.schema_type), FieldId) == 2);
+		}
+		else if (Op.op_type == WORKER_OP_TYPE_AUTHORITY_CHANGE)
+		{
+			TestTrue("Authority is only delivered for the authoritative component", Op.op.authority_change.component_id == GeneratedComponentId);
+		}
+	}
+	TestTrue("Generated component is added", bFoundGeneratedComponent);
+
+	return true;
+}
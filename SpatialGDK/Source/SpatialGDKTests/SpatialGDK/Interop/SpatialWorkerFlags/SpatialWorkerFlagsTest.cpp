@@ -94,3 +94,41 @@ SPATIALWORKERFLAGS_TEST(GIVEN_a_bound_delegate_WHEN_unbind_the_delegate_THEN_bou
 
 	return true;
 }
+
+SPATIALWORKERFLAGS_TEST(GIVEN_a_worker_flag_handle_WHEN_the_flag_is_updated_THEN_the_handle_reads_the_parsed_value)
+{
+	USpatialWorkerFlags* SpatialWorkerFlags = NewObject<USpatialWorkerFlags>();
+	const TWorkerFlagHandle<int32> IntHandle = SpatialWorkerFlags->GetWorkerFlagHandle<int32>("test");
+	const TWorkerFlagHandle<float> FloatHandle = SpatialWorkerFlags->GetWorkerFlagHandle<float>("test");
+
+	TestFalse("Handle to an unset flag is not set", IntHandle.IsSet());
+	TestEqual("Handle to an unset flag returns the default", IntHandle.Get(3), 3);
+
+	Worker_FlagUpdateOp OpAddFlag = CreateWorkerFlagUpdateOp("test", "10.5");
+	SpatialWorkerFlags->ApplyWorkerFlagUpdate(OpAddFlag);
+
+	TestTrue("Handle is set once the flag is added", IntHandle.IsSet());
+	TestEqual("Int handle reads the parsed flag", IntHandle.Get(3), 10);
+	TestEqual("Float handle reads the parsed flag", FloatHandle.Get(0.0f), 10.5f);
+
+	Worker_FlagUpdateOp OpRemoveFlag = CreateWorkerFlagUpdateOp("test", nullptr);
+	SpatialWorkerFlags->ApplyWorkerFlagUpdate(OpRemoveFlag);
+
+	TestFalse("Handle is unset once the flag is removed", FloatHandle.IsSet());
+	TestEqual("Handle to a removed flag returns the default", FloatHandle.Get(1.0f), 1.0f);
+
+	return true;
+}
+
+SPATIALWORKERFLAGS_TEST(GIVEN_a_set_worker_flag_WHEN_getting_a_handle_THEN_the_handle_reads_the_current_value)
+{
+	USpatialWorkerFlags* SpatialWorkerFlags = NewObject<USpatialWorkerFlags>();
+	Worker_FlagUpdateOp OpAddFlag = CreateWorkerFlagUpdateOp("test", "true");
+	SpatialWorkerFlags->ApplyWorkerFlagUpdate(OpAddFlag);
+
+	const TWorkerFlagHandle<bool> BoolHandle = SpatialWorkerFlags->GetWorkerFlagHandle<bool>("test");
+
+	TestTrue("Bool handle reads the parsed flag", BoolHandle.Get(false));
+
+	return true;
+}
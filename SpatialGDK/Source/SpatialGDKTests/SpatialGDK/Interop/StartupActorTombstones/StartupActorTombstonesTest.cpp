@@ -0,0 +1,31 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/StartupActorTombstones.h"
+
+#include "CoreMinimal.h"
+
+#define STARTUPACTORTOMBSTONES_TEST(TestName) \
+	GDK_TEST(Core, FStartupActorTombstones, TestName)
+
+using namespace SpatialGDK;
+
+STARTUPACTORTOMBSTONES_TEST(GIVEN_retired_startup_actor_entities_WHEN_only_some_tombstones_are_confirmed_THEN_only_their_entities_are_deleted)
+{
+	FPendingTombstoneDeletions PendingDeletions;
+	PendingDeletions.Add(10, 100);
+	PendingDeletions.Add(20, 200);
+	PendingDeletions.Add(30, 300);
+
+	TestEqual("Nothing is deleted before any tombstone is written", PendingDeletions.Confirm({}).Num(), 0);
+
+	const TArray<Worker_EntityId> Deleted = PendingDeletions.Confirm({ 5, 10, 30 });
+	TestTrue("The entities of the written tombstones are deleted", Deleted.Num() == 2 && Deleted.Contains(100) && Deleted.Contains(300));
+	TestEqual("The other entity still waits for its tombstone", PendingDeletions.Num(), 1);
+
+	TestTrue("An entity is only deleted once", PendingDeletions.Confirm({ 10, 30 }).Num() == 0);
+	TestTrue("The last entity is deleted with its tombstone", PendingDeletions.Confirm({ 20 }) == TArray<Worker_EntityId>{ 200 });
+
+	return true;
+}
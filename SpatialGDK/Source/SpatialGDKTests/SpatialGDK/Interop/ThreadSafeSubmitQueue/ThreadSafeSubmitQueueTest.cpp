@@ -0,0 +1,118 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/ThreadSafeSubmitQueue.h"
+
+#include "Async/Async.h"
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define THREADSAFESUBMITQUEUE_TEST(TestName) \
+	GDK_TEST(Core, FThreadSafeSubmitQueue, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+// The component ID is used as a sequence number to check the order entries are drained in.
+FWorkerComponentUpdate MakeUpdate(Worker_ComponentId Sequence)
+{
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = Sequence;
+	Update.schema_type = Schema_CreateComponentUpdate();
+	return Update;
+}
+
+} // anonymous namespace
+
+THREADSAFESUBMITQUEUE_TEST(GIVEN_an_empty_batch_WHEN_submitting_THEN_nothing_is_queued)
+{
+	FThreadSafeSubmitQueue Queue;
+
+	Queue.Submit(FSubmitBatch());
+
+	TArray<FSubmitBatch> Batches;
+	Queue.Drain(Batches);
+
+	TestEqual("Pending batches", Queue.GetNumPendingBatches(), 0);
+	TestEqual("Drained batches", Batches.Num(), 0);
+
+	return true;
+}
+
+THREADSAFESUBMITQUEUE_TEST(GIVEN_updates_and_rpcs_in_a_batch_WHEN_draining_THEN_entries_keep_their_order)
+{
+	FThreadSafeSubmitQueue Queue;
+
+	FSubmitBatch Batch;
+	Batch.AddComponentUpdate(1, MakeUpdate(100));
+	Batch.AddRPC(1, ERPCType::ClientReliable, RPCPayload(0, 7, TArray<uint8>()));
+	Batch.AddComponentUpdate(1, MakeUpdate(101));
+	Queue.Submit(MoveTemp(Batch));
+
+	TArray<FSubmitBatch> Batches;
+	Queue.Drain(Batches);
+
+	TestEqual("Drained batches", Batches.Num(), 1);
+	TestEqual("Submitted entries", Queue.GetNumSubmittedEntries(), 3ull);
+
+	TArray<FSubmitBatch::FEntry>& Entries = Batches[0].GetEntries();
+	TestEqual("Number of entries", Entries.Num(), 3);
+	TestEqual("First entry is the first update", Entries[0].Update.component_id, 100u);
+	TestTrue("Second entry is the RPC", Entries[1].Payload.IsSet() && Entries[1].Payload->Index == 7);
+	TestEqual("Third entry is the second update", Entries[2].Update.component_id, 101u);
+
+	return true;
+}
+
+THREADSAFESUBMITQUEUE_TEST(GIVEN_batches_submitted_from_several_threads_WHEN_draining_THEN_each_entity_keeps_its_order)
+{
+	constexpr int32 NumThreads = 4;
+	constexpr int32 NumBatchesPerThread = 200;
+
+	FThreadSafeSubmitQueue Queue;
+
+	TArray<TFuture<void>> Producers;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
+	{
+		// Each thread sends updates for its own entity.
+		const Worker_EntityId EntityId = ThreadIndex + 1;
+		Producers.Add(Async(EAsyncExecution::Thread, TFunction<void()>([&Queue, EntityId] {
+			for (int32 Sequence = 0; Sequence < NumBatchesPerThread; Sequence++)
+			{
+				FSubmitBatch Batch;
+				Batch.AddComponentUpdate(EntityId, MakeUpdate(Sequence));
+				Queue.Submit(MoveTemp(Batch));
+			}
+		})));
+	}
+
+	for (TFuture<void>& Producer : Producers)
+	{
+		Producer.Wait();
+	}
+
+	TArray<FSubmitBatch> Batches;
+	Queue.Drain(Batches);
+
+	TestEqual("Drained batches", Batches.Num(), NumThreads * NumBatchesPerThread);
+
+	TMap<Worker_EntityId_Key, int32> NextSequence;
+	bool bInOrder = true;
+	for (FSubmitBatch& Batch : Batches)
+	{
+		for (const FSubmitBatch::FEntry& Entry : Batch.GetEntries())
+		{
+			int32& Expected = NextSequence.FindOrAdd(Entry.EntityId);
+			bInOrder &= static_cast<int32>(Entry.Update.component_id) == Expected;
+			Expected++;
+		}
+	}
+
+	TestTrue("Updates for each entity drained in order", bInOrder);
+
+	return true;
+}
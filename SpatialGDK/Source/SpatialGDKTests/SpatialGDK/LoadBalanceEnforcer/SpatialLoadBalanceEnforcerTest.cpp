@@ -6,6 +6,7 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Schema/AuthorityIntent.h"
+#include "Schema/NetOwningClientWorker.h"
 #include "SpatialGDKTests/SpatialGDK/LoadBalancing/AbstractLBStrategy/LBStrategyStub.h"
 #include "Tests/TestingComponentViewHelpers.h"
 #include "Tests/TestingSchemaHelpers.h"
@@ -483,3 +484,64 @@ LOADBALANCEENFORCER_TEST(GIVEN_component_presence_component_removal_WHEN_request
 
 	return true;
 }
+
+LOADBALANCEENFORCER_TEST(GIVEN_a_per_tick_limit_WHEN_more_requests_are_queued_THEN_return_client_owned_entities_first_and_keep_the_rest_queued)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdTwo, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	StaticComponentView->GetComponentData<SpatialGDK::NetOwningClientWorker>(EntityIdTwo)->WorkerId = FString(TEXT("ClientWorker"));
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+	LoadBalanceEnforcer->SetMaxAclAssignmentsPerTick(1);
+
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdTwo);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	bool bSuccess = ACLRequests.Num() == 1 && ACLRequests[0].EntityId == EntityIdTwo;
+	bSuccess &= LoadBalanceEnforcer->AclAssignmentRequestIsQueued(EntityIdOne);
+	bSuccess &= !LoadBalanceEnforcer->AclAssignmentRequestIsQueued(EntityIdTwo);
+
+	ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	bSuccess &= ACLRequests.Num() == 1 && ACLRequests[0].EntityId == EntityIdOne;
+	bSuccess &= LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests() == 0;
+
+	TestTrue("LoadBalanceEnforcer returned expected ACL assignment results", bSuccess);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_authoritative_entity_WHEN_ownership_changes_twice_THEN_return_one_acl_assignment_request_for_this_worker)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerOne, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+
+	// This worker is already authoritative, so only an ownership change queues a request.
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	bool bSuccess = !LoadBalanceEnforcer->AclAssignmentRequestIsQueued(EntityIdOne);
+
+	LoadBalanceEnforcer->QueueOwnershipAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->QueueOwnershipAclAssignmentRequest(EntityIdOne);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	bSuccess &= ACLRequests.Num() == 1;
+	if (ACLRequests.Num() == 1)
+	{
+		bSuccess &= ACLRequests[0].EntityId == EntityIdOne;
+		bSuccess &= ACLRequests[0].OwningWorkerId == ValidWorkerOne;
+	}
+
+	TestTrue("LoadBalanceEnforcer returned one ACL assignment for the ownership changes", bSuccess);
+
+	return true;
+}
@@ -20,4 +20,11 @@ public:
 	{
 		return LocalVirtualWorkerId;
 	}
+
+	virtual bool IsVirtualWorkerRequiredToStart(VirtualWorkerId WorkerId) const override
+	{
+		return WorkerId <= NumVirtualWorkersRequiredToStart;
+	}
+
+	uint32 NumVirtualWorkersRequiredToStart = MAX_uint32;
 };
@@ -0,0 +1,173 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/DynamicGridLBStrategy.h"
+#include "TestDynamicGridLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Tests/TestDefinitions.h"
+
+#define DYNAMICGRIDLBSTRATEGY_TEST(TestName) \
+	GDK_TEST(Core, UDynamicGridLBStrategy, TestName)
+
+namespace
+{
+
+constexpr float TestWorldSize = 30000.f;
+
+UDynamicGridLBStrategy* CreateStrategy(uint32 Rows, uint32 Cols, bool bElasticCellCount)
+{
+	UDynamicGridLBStrategy* Strat = UTestDynamicGridLBStrategy::Create(Rows, Cols, TestWorldSize, TestWorldSize, bElasticCellCount);
+	Strat->Init();
+	Strat->SetVirtualWorkerIds(1, Strat->GetMinimumRequiredWorkers());
+	return Strat;
+}
+
+FBox2D GetCellOf(const UDynamicGridLBStrategy& Strat, VirtualWorkerId WorkerId)
+{
+	for (const TPair<VirtualWorkerId, FBox2D>& Region : Strat.GetLBStrategyRegions())
+	{
+		if (Region.Key == WorkerId)
+		{
+			return Region.Value;
+		}
+	}
+	return FBox2D(ForceInit);
+}
+
+// An elastic strategy with two rows, which has started using its second cell.
+UDynamicGridLBStrategy* CreateScaledUpStrategy()
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(2, 1, true);
+	Strat->ReportWorkerLoad(1, 1.0);
+	Strat->ReportWorkerLoad(2, 0.0);
+	Strat->RebalanceRegions();
+	return Strat;
+}
+
+} // anonymous namespace
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_an_elastic_grid_under_high_load_WHEN_the_next_cell_has_no_worker_THEN_another_worker_is_wanted)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(2, 1, true);
+	Strat->ReportWorkerLoad(1, 1.0);
+
+	TestFalse("Nothing changed", Strat->RebalanceRegions());
+	TestEqual("A second worker is wanted", Strat->GetDesiredWorkerCount(), 2u);
+	TestEqual("The second cell has no area", GetCellOf(*Strat, 2).GetArea(), 0.f);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_an_elastic_grid_under_high_load_WHEN_the_next_cell_has_a_worker_THEN_it_is_used_and_grows)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(2, 1, true);
+	const float FirstCellArea = GetCellOf(*Strat, 1).GetArea();
+
+	Strat->ReportWorkerLoad(1, 1.0);
+	Strat->ReportWorkerLoad(2, 0.0);
+
+	TestTrue("The regions changed", Strat->RebalanceRegions());
+	TestEqual("Both workers are wanted", Strat->GetDesiredWorkerCount(), 2u);
+	TestTrue("The second cell took over part of the first one", GetCellOf(*Strat, 2).GetArea() > 0.f);
+	TestTrue("The first cell shrank", GetCellOf(*Strat, 1).GetArea() < FirstCellArea);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_an_elastic_grid_under_low_load_WHEN_rebalancing_THEN_the_last_cell_is_drained_gradually)
+{
+	UDynamicGridLBStrategy* Strat = CreateScaledUpStrategy();
+	const float SecondCellArea = GetCellOf(*Strat, 2).GetArea();
+	TestTrue("The second cell is in use", SecondCellArea > 0.f);
+
+	Strat->ReportWorkerLoad(1, 0.0);
+	Strat->ReportWorkerLoad(2, 0.0);
+	TestTrue("The regions changed", Strat->RebalanceRegions());
+	TestEqual("Only one worker is wanted while draining", Strat->GetDesiredWorkerCount(), 1u);
+	TestTrue("The second cell shrank, but not all at once", GetCellOf(*Strat, 2).GetArea() < SecondCellArea && GetCellOf(*Strat, 2).GetArea() > 0.f);
+
+	int32 NumRebalances = 1;
+	while (GetCellOf(*Strat, 2).GetArea() > 0.f && NumRebalances < 100)
+	{
+		Strat->RebalanceRegions();
+		NumRebalances++;
+	}
+
+	TestEqual("The second cell was drained", GetCellOf(*Strat, 2).GetArea(), 0.f);
+	TestEqual("The first cell covers the world", GetCellOf(*Strat, 1).GetArea(), TestWorldSize * TestWorldSize);
+	TestEqual("Only one worker is wanted", Strat->GetDesiredWorkerCount(), 1u);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_a_grid_WHEN_the_worker_of_a_middle_cell_is_lost_THEN_a_neighbour_takes_over_its_region)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(3, 1, false);
+	const FBox2D LostCell = GetCellOf(*Strat, 2);
+
+	Strat->ReportWorkerLost(2);
+
+	TestEqual("The lost cell has no area", GetCellOf(*Strat, 2).GetArea(), 0.f);
+	TestTrue("The cell below covers the lost cell", GetCellOf(*Strat, 1).IsInside(LostCell.GetCenter()));
+	TestEqual("The cell above is unchanged", GetCellOf(*Strat, 3).GetArea(), TestWorldSize * TestWorldSize / 3.f);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_a_grid_WHEN_the_worker_of_the_first_cell_is_lost_THEN_the_next_cell_takes_over_its_region)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(3, 1, false);
+	const FBox2D LostCell = GetCellOf(*Strat, 1);
+
+	Strat->ReportWorkerLost(1);
+
+	TestEqual("The lost cell has no area", GetCellOf(*Strat, 1).GetArea(), 0.f);
+	TestTrue("The next cell covers the lost cell", GetCellOf(*Strat, 2).IsInside(LostCell.GetCenter()));
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_a_grid_with_one_row_WHEN_the_worker_of_a_column_is_lost_THEN_the_neighbouring_column_takes_over_its_region)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(1, 2, false);
+	const FBox2D LostCell = GetCellOf(*Strat, 2);
+
+	Strat->ReportWorkerLost(2);
+
+	TestEqual("The lost cell has no area", GetCellOf(*Strat, 2).GetArea(), 0.f);
+	TestTrue("The neighbouring column covers the lost cell", GetCellOf(*Strat, 1).IsInside(LostCell.GetCenter()));
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_an_elastic_grid_WHEN_the_worker_of_the_last_cell_in_use_is_lost_THEN_the_cell_stops_being_used)
+{
+	UDynamicGridLBStrategy* Strat = CreateScaledUpStrategy();
+
+	Strat->ReportWorkerLost(2);
+
+	TestEqual("The lost cell has no area", GetCellOf(*Strat, 2).GetArea(), 0.f);
+	TestEqual("The first cell covers the world", GetCellOf(*Strat, 1).GetArea(), TestWorldSize * TestWorldSize);
+	TestEqual("One worker is wanted", Strat->GetDesiredWorkerCount(), 1u);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_a_grid_WHEN_rebalancing_THEN_the_regions_version_only_changes_with_the_regions)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(2, 1, true);
+	// The debugger only sees the strategy through the abstract interface.
+	const UAbstractLBStrategy& AbstractStrat = *Strat;
+	const uint32 StartVersion = AbstractStrat.GetRegionsVersion();
+
+	Strat->ReportWorkerLoad(1, 1.0);
+	TestFalse("Nothing changed", Strat->RebalanceRegions());
+	TestEqual("The regions version is unchanged", AbstractStrat.GetRegionsVersion(), StartVersion);
+
+	Strat->ReportWorkerLoad(2, 0.0);
+	TestTrue("The regions changed", Strat->RebalanceRegions());
+	TestNotEqual("The regions version changed", AbstractStrat.GetRegionsVersion(), StartVersion);
+	TestEqual("Every cell has a region", AbstractStrat.GetLBStrategyRegions().Num(), 2);
+
+	return true;
+}
@@ -0,0 +1,20 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDynamicGridLBStrategy.h"
+
+UDynamicGridLBStrategy* UTestDynamicGridLBStrategy::Create(uint32 InRows, uint32 InCols, float InWorldWidth, float InWorldHeight, bool bInElasticCellCount)
+{
+	UTestDynamicGridLBStrategy* Strat = NewObject<UTestDynamicGridLBStrategy>();
+
+	Strat->Rows = InRows;
+	Strat->Cols = InCols;
+
+	Strat->WorldWidth = InWorldWidth;
+	Strat->WorldHeight = InWorldHeight;
+
+	Strat->bElasticCellCount = bInElasticCellCount;
+	Strat->MinActiveCells = 1;
+	Strat->ScalingCooldown = 0.f;
+
+	return Strat;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/GridBasedLBStrategy.h"
+#include "TestGridBasedLBStrategy.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Tests/BenchmarkReporter.h"
+#include "Tests/TestDefinitions.h"
+
+#define GRIDBASEDLBSTRATEGY_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, UGridBasedLBStrategy, TestName)
+
+namespace
+{
+	const float BENCHMARK_WORLD_SIZE = 100000.0f;
+	const int32 BENCHMARK_ENTITY_COUNTS[] = { 1000, 10000, 100000 };
+} // anonymous namespace
+
+GRIDBASEDLBSTRATEGY_BENCHMARK(GIVEN_4x4_grid_WHEN_authority_decided_for_1k_10k_and_100k_positions_THEN_throughput_is_reported)
+{
+	FBenchmarkReporter Reporter(*this, TEXT("GridBasedLBStrategy"));
+
+	UGridBasedLBStrategy* Strategy = UTestGridBasedLBStrategy::Create(4, 4, BENCHMARK_WORLD_SIZE, BENCHMARK_WORLD_SIZE);
+	Strategy->Init();
+	Strategy->SetVirtualWorkerIds(1, Strategy->GetMinimumRequiredWorkers());
+	Strategy->SetLocalVirtualWorkerId(1);
+
+	// A fixed seed keeps the workload identical between runs.
+	FRandomStream Random(1337);
+
+	for (const int32 EntityCount : BENCHMARK_ENTITY_COUNTS)
+	{
+		TArray<FVector2D> Positions;
+		Positions.Reserve(EntityCount);
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			Positions.Emplace(Random.FRandRange(-BENCHMARK_WORLD_SIZE / 2, BENCHMARK_WORLD_SIZE / 2), Random.FRandRange(-BENCHMARK_WORLD_SIZE / 2, BENCHMARK_WORLD_SIZE / 2));
+		}
+
+		TArray<VirtualWorkerId> VirtualWorkerIds;
+		const double StartTime = FPlatformTime::Seconds();
+		Strategy->WhoShouldHaveAuthority(Positions, VirtualWorkerIds);
+		Reporter.Report(TEXT("WhoShouldHaveAuthority"), EntityCount, EntityCount, FPlatformTime::Seconds() - StartTime);
+
+		TestEqual(TEXT("Every position is assigned a virtual worker"), VirtualWorkerIds.Num(), EntityCount);
+	}
+
+	return true;
+}
@@ -5,6 +5,7 @@
 #include "SpatialConstants.h"
 #include "TestGridBasedLBStrategy.h"
 
+#include "Async/ParallelFor.h"
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
@@ -43,9 +44,9 @@ UWorld* GetAnyGameWorld()
 	return World;
 }
 
-void CreateStrategy(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight, uint32 LocalWorkerId)
+void CreateStrategy(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight, uint32 LocalWorkerId, float BoundaryHysteresis = 0.f)
 {
-	Strat = UTestGridBasedLBStrategy::Create(Rows, Cols, WorldWidth, WorldHeight);
+	Strat = UTestGridBasedLBStrategy::Create(Rows, Cols, WorldWidth, WorldHeight, 0.f, BoundaryHysteresis);
 	Strat->Init();
 	Strat->SetVirtualWorkerIds(1, Strat->GetMinimumRequiredWorkers());
 	Strat->SetLocalVirtualWorkerId(LocalWorkerId);
@@ -68,6 +69,13 @@ bool FCreateStrategy::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FCreateStrategyWithHysteresis, uint32, Rows, uint32, LocalWorkerId, float, BoundaryHysteresis);
+bool FCreateStrategyWithHysteresis::Update()
+{
+	CreateStrategy(Rows, 1, 10000.f, 10000.f, LocalWorkerId, BoundaryHysteresis);
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND(FWaitForWorld);
 bool FWaitForWorld::Update()
 {
@@ -122,6 +130,73 @@ bool FCheckShouldRelinquishAuthority::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FCheckIsNearLocalRegion, FAutomationTestBase*, Test, FName, Handle, float, Distance, bool, bExpected);
+bool FCheckIsNearLocalRegion::Update()
+{
+	bool bActual = Strat->IsNearLocalRegion(*TestActors[Handle], Distance);
+
+	Test->TestEqual(FString::Printf(TEXT("Is Near Local Region. Actual: %d, Expected: %d"), bActual, bExpected), bActual, bExpected);
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FCheckIsNearWorkerBoundary, FAutomationTestBase*, Test, FName, Handle, float, Distance, bool, bExpected);
+bool FCheckIsNearWorkerBoundary::Update()
+{
+	bool bActual = Strat->IsNearWorkerBoundary(*TestActors[Handle], Distance);
+
+	Test->TestEqual(FString::Printf(TEXT("Is Near Worker Boundary. Actual: %d, Expected: %d"), bActual, bExpected), bActual, bExpected);
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckParallelAuthorityQueriesMatchShouldHaveAuthority, FAutomationTestBase*, Test, int32, ActorsPerBatch);
+bool FCheckParallelAuthorityQueriesMatchShouldHaveAuthority::Update()
+{
+	Test->TestTrue(TEXT("Grid strategies support parallel authority queries"), Strat->SupportsParallelAuthorityQueries());
+
+	TArray<const AActor*> Actors;
+	for (const TPair<FName, AActor*>& TestActor : TestActors)
+	{
+		Actors.Add(TestActor.Value);
+	}
+
+	// Queried the way UGlobalStateManager::SetAllActorRolesBasedOnLBStrategy does, each batch writing only its own results.
+	Strat->PrepareParallelAuthorityQueries(Actors);
+	TArray<bool> ShouldHaveAuthority;
+	ShouldHaveAuthority.SetNumZeroed(Actors.Num());
+	ParallelFor(FMath::DivideAndRoundUp(Actors.Num(), ActorsPerBatch), [&Actors, &ShouldHaveAuthority, ActorsPerBatch](int32 BatchIndex)
+	{
+		const int32 FirstActorIndex = BatchIndex * ActorsPerBatch;
+		const TArray<const AActor*> BatchActors(Actors.GetData() + FirstActorIndex, FMath::Min(ActorsPerBatch, Actors.Num() - FirstActorIndex));
+
+		TArray<bool> BatchShouldHaveAuthority;
+		Strat->ShouldHaveAuthorityForActors(BatchActors, BatchShouldHaveAuthority);
+		for (int32 i = 0; i < BatchActors.Num(); i++)
+		{
+			ShouldHaveAuthority[FirstActorIndex + i] = BatchShouldHaveAuthority[i];
+		}
+	});
+
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		Test->TestEqual(FString::Printf(TEXT("Parallel ShouldHaveAuthority matches single actor for %s"), *Actors[i]->GetName()),
+			ShouldHaveAuthority[i], Strat->ShouldHaveAuthority(*Actors[i]));
+	}
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FCheckShouldRetainAuthority, FAutomationTestBase*, Test, FName, Handle, bool, bExpected);
+bool FCheckShouldRetainAuthority::Update()
+{
+	bool bActual = Strat->ShouldRetainAuthority(*TestActors[Handle]);
+
+	Test->TestEqual(FString::Printf(TEXT("Should Retain Authority. Actual: %d, Expected: %d"), bActual, bExpected), bActual, bExpected);
+
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FCheckWhoShouldHaveAuthority, FAutomationTestBase*, Test, FName, Handle, uint32, ExpectedVirtualWorker);
 bool FCheckWhoShouldHaveAuthority::Update()
 {
@@ -311,6 +386,73 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_moving_actor_WHEN_actor_crosses_boundary_THEN_sho
 	return true;
 }
 
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_moving_actor_WHEN_actor_approaches_local_cell_THEN_is_near_local_region_within_distance)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(2, 1, 10000.f, 10000.f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(500.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearLocalRegion(this, "Actor1", 100.f, false));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(50.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearLocalRegion(this, "Actor1", 100.f, true));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(-2.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearLocalRegion(this, "Actor1", 100.f, false));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_moving_actor_WHEN_actor_approaches_cell_edge_THEN_is_near_worker_boundary_within_distance)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(2, 1, 10000.f, 10000.f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(-2500.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearWorkerBoundary(this, "Actor1", 100.f, false));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(-50.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearWorkerBoundary(this, "Actor1", 100.f, true));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(-2500.f, 4950.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearWorkerBoundary(this, "Actor1", 100.f, true));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_local_worker_outside_the_grid_WHEN_is_near_worker_boundary_called_THEN_returns_true)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(2, 1, 10000.f, 10000.f, 3));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(-2500.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckIsNearWorkerBoundary(this, "Actor1", 100.f, true));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_boundary_hysteresis_WHEN_actor_crosses_boundary_THEN_should_retain_authority_within_hysteresis)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategyWithHysteresis(2, 1, 100.f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(50.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRelinquishAuthority(this, "Actor1", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRetainAuthority(this, "Actor1", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(150.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRetainAuthority(this, "Actor1", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
 GRIDBASEDLBSTRATEGY_TEST(GIVEN_two_actors_WHEN_actors_are_in_same_cell_THEN_should_belong_to_same_worker_id)
 {
 	AutomationOpenMap("/Engine/Maps/Entry");
@@ -343,3 +485,68 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_two_cells_WHEN_actor_in_one_cell_THEN_strategy_re
 	return true;
 }
 
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_actors_in_every_cell_WHEN_authority_queried_in_parallel_batches_THEN_matches_single_actor_results)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(2, 2, 10000.f, 10000.f, 3));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	for (int32 i = 0; i < 16; i++)
+	{
+		const FName Handle = *FString::Printf(TEXT("Actor%d"), i);
+		ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation(Handle, FVector(-3750.f + (i % 4) * 2500.f, -3750.f + (i / 4) * 2500.f, 0.f)));
+		ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor(Handle));
+	}
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckParallelAuthorityQueriesMatchShouldHaveAuthority(this, 3));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_eight_by_eight_grid_WHEN_positions_classified_in_batch_THEN_matches_the_worker_region_containing_each_position)
+{
+	CreateStrategy(8, 8, 10000.f, 10000.f, 1);
+
+	const UGridBasedLBStrategy::LBStrategyRegions Regions = Strat->GetLBStrategyRegions();
+
+	// Sample on and around every cell boundary, as well as outside the grid.
+	TArray<FVector2D> Positions;
+	for (float X = -5500.f; X <= 5500.f; X += 125.f)
+	{
+		for (float Y = -5500.f; Y <= 5500.f; Y += 125.f)
+		{
+			Positions.Add(FVector2D(X, Y));
+			Positions.Add(FVector2D(X - KINDA_SMALL_NUMBER, Y + KINDA_SMALL_NUMBER));
+		}
+	}
+
+	TArray<VirtualWorkerId> VirtualWorkerIds;
+	Strat->WhoShouldHaveAuthority(Positions, VirtualWorkerIds);
+	TestEqual("One virtual worker per position", VirtualWorkerIds.Num(), Positions.Num());
+
+	for (int32 i = 0; i < Positions.Num(); i++)
+	{
+		const FVector2D& Position = Positions[i];
+
+		VirtualWorkerId ExpectedVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		for (const TPair<VirtualWorkerId, FBox2D>& Region : Regions)
+		{
+			if (Position.X >= Region.Value.Min.X && Position.Y >= Region.Value.Min.Y
+				&& Position.X < Region.Value.Max.X && Position.Y < Region.Value.Max.Y)
+			{
+				ExpectedVirtualWorkerId = Region.Key;
+				break;
+			}
+		}
+
+		if (!TestEqual(FString::Printf(TEXT("Virtual worker for position %s"), *Position.ToString()), VirtualWorkerIds[i], ExpectedVirtualWorkerId))
+		{
+			break;
+		}
+	}
+
+	Strat = nullptr;
+
+	return true;
+}
@@ -7,6 +7,7 @@
 #include "SpatialGDKSettings.h"
 #include "TestLayeredLBStrategy.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "GameFramework/DefaultPawn.h"
 #include "GameFramework/GameStateBase.h"
@@ -242,6 +243,72 @@ bool FCheckShouldHaveAuthMatchesWhoShouldHaveAuth::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckBatchAuthMatchesSingleActorAuth, TSharedPtr<TestData>, TestData, FAutomationTestBase*, Test);
+bool FCheckBatchAuthMatchesSingleActorAuth::Update()
+{
+	const auto Strat = TestData->Strat;
+
+	TArray<const AActor*> Actors;
+	for (const auto& TestActor : TestData->TestActors)
+	{
+		Actors.Add(TestActor.Value);
+	}
+
+	TArray<bool> ShouldHaveAuthority;
+	TArray<VirtualWorkerId> VirtualWorkerIds;
+	Strat->ShouldHaveAuthorityForActors(Actors, ShouldHaveAuthority);
+	Strat->WhoShouldHaveAuthorityForActors(Actors, VirtualWorkerIds);
+
+	Test->TestEqual(TEXT("ShouldHaveAuthorityForActors returns one result per actor"), ShouldHaveAuthority.Num(), Actors.Num());
+	Test->TestEqual(TEXT("WhoShouldHaveAuthorityForActors returns one result per actor"), VirtualWorkerIds.Num(), Actors.Num());
+
+	for (int32 i = 0; i < Actors.Num() && i < ShouldHaveAuthority.Num() && i < VirtualWorkerIds.Num(); i++)
+	{
+		Test->TestEqual(
+			FString::Printf(TEXT("Batch ShouldHaveAuthority matches single actor for %s"), *Actors[i]->GetName()),
+			ShouldHaveAuthority[i], Strat->ShouldHaveAuthority(*Actors[i]));
+		Test->TestEqual(
+			FString::Printf(TEXT("Batch WhoShouldHaveAuthority matches single actor for %s"), *Actors[i]->GetName()),
+			VirtualWorkerIds[i], Strat->WhoShouldHaveAuthority(*Actors[i]));
+	}
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckParallelAuthMatchesSingleActorAuth, TSharedPtr<TestData>, TestData, FAutomationTestBase*, Test);
+bool FCheckParallelAuthMatchesSingleActorAuth::Update()
+{
+	const ULayeredLBStrategy* Strat = TestData->Strat;
+
+	Test->TestTrue(TEXT("Supports parallel authority queries when every layer does"), Strat->SupportsParallelAuthorityQueries());
+
+	TArray<const AActor*> Actors;
+	for (const auto& TestActor : TestData->TestActors)
+	{
+		Actors.Add(TestActor.Value);
+	}
+
+	// One actor per batch, so every lookup of the layer cache can happen on a different thread.
+	Strat->PrepareParallelAuthorityQueries(Actors);
+	TArray<bool> ShouldHaveAuthority;
+	ShouldHaveAuthority.SetNumZeroed(Actors.Num());
+	ParallelFor(Actors.Num(), [Strat, &Actors, &ShouldHaveAuthority](int32 ActorIndex)
+	{
+		TArray<bool> BatchShouldHaveAuthority;
+		Strat->ShouldHaveAuthorityForActors({ Actors[ActorIndex] }, BatchShouldHaveAuthority);
+		ShouldHaveAuthority[ActorIndex] = BatchShouldHaveAuthority[0];
+	});
+
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		Test->TestEqual(
+			FString::Printf(TEXT("Parallel ShouldHaveAuthority matches single actor for %s"), *Actors[i]->GetName()),
+			ShouldHaveAuthority[i], Strat->ShouldHaveAuthority(*Actors[i]));
+	}
+
+	return true;
+}
+
 LAYEREDLBSTRATEGY_TEST(GIVEN_strat_is_not_ready_WHEN_local_virtual_worker_id_is_set_THEN_is_ready)
 {
 	AutomationOpenMap("/Engine/Maps/Entry");
@@ -430,3 +497,56 @@ LAYEREDLBSTRATEGY_TEST(GIVEN_two_actors_of_different_types_and_same_positions_ma
 	return true;
 }
 
+LAYEREDLBSTRATEGY_TEST(GIVEN_actors_in_different_layers_WHEN_authority_evaluated_in_batch_THEN_matches_single_actor_results)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = TSharedPtr<TestData>(new TestData);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetDefaultLayer(Data, UGridBasedLBStrategy::StaticClass()));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UTwoByFourLBGridStrategy::StaticClass(), {ALayer1Pawn::StaticClass()}));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UTwoByFourLBGridStrategy::StaticClass(), {ALayer2Pawn::StaticClass()}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategy(Data, {}));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategyLocalWorker(Data, 2));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer1PawnAtLocation(Data, TEXT("Layer1Actor1"), FVector::ZeroVector));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer1PawnAtLocation(Data, TEXT("Layer1Actor2"), FVector(-1000.f, -1000.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer2PawnAtLocation(Data, TEXT("Layer2Actor1"), FVector::ZeroVector));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer2PawnAtLocation(Data, TEXT("Layer2Actor2"), FVector(1000.f, 1000.f, 0.f)));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckBatchAuthMatchesSingleActorAuth(Data, this));
+
+	return true;
+}
+
+LAYEREDLBSTRATEGY_TEST(GIVEN_layers_of_grid_strats_WHEN_authority_queried_in_parallel_THEN_matches_single_actor_results)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = TSharedPtr<TestData>(new TestData);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetDefaultLayer(Data, UGridBasedLBStrategy::StaticClass()));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UTwoByFourLBGridStrategy::StaticClass(), {ALayer1Pawn::StaticClass()}));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UTwoByFourLBGridStrategy::StaticClass(), {ALayer2Pawn::StaticClass()}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategy(Data, {}));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategyLocalWorker(Data, 2));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer1PawnAtLocation(Data, TEXT("Layer1Actor1"), FVector::ZeroVector));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer1PawnAtLocation(Data, TEXT("Layer1Actor2"), FVector(-1000.f, -1000.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer1PawnAtLocation(Data, TEXT("Layer1Actor3"), FVector(1000.f, -1000.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer2PawnAtLocation(Data, TEXT("Layer2Actor1"), FVector::ZeroVector));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer2PawnAtLocation(Data, TEXT("Layer2Actor2"), FVector(1000.f, 1000.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnLayer2PawnAtLocation(Data, TEXT("Layer2Actor3"), FVector(-1000.f, 1000.f, 0.f)));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckParallelAuthMatchesSingleActorAuth(Data, this));
+
+	return true;
+}
@@ -11,6 +11,7 @@
 #include "Engine/EngineTypes.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/DefaultPawn.h"
+#include "HAL/PlatformTime.h"
 #include "Improbable/SpatialEngineDelegates.h"
 #include "Tests/AutomationCommon.h"
 #include "Templates/SharedPointer.h"
@@ -19,6 +20,9 @@
 #define OWNERSHIPLOCKINGPOLICY_TEST(TestName) \
 	GDK_TEST(Core, UOwnershipLockingPolicy, TestName)
 
+#define OWNERSHIPLOCKINGPOLICY_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, UOwnershipLockingPolicy, TestName)
+
 namespace
 {
 
@@ -290,6 +294,77 @@ bool FTestIsLocked::Update()
 	return true;
 }
 
+// Owner changes and lock queries in an inventory-like hierarchy: a deep ownership chain with many items owned by its leaf,
+// one of which is locked, while items keep moving between the chain and a second root.
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FRunDeepHierarchyBenchmark, FAutomationTestBase*, Test, TSharedPtr<TestData>, Data);
+bool FRunDeepHierarchyBenchmark::Update()
+{
+	const int32 ChainDepth = 256;
+	const int32 NumItems = 256;
+	const int32 NumIterations = 20;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.bNoFail = true;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	TArray<AActor*> Chain;
+	for (int32 i = 0; i < ChainDepth; i++)
+	{
+		AActor* Actor = Data->TestWorld->SpawnActor<ADefaultPawn>(SpawnParams);
+		if (Chain.Num() > 0)
+		{
+			Actor->SetOwner(Chain.Last());
+			Data->LockingPolicy->OnOwnerUpdated(Actor, nullptr);
+		}
+		Chain.Add(Actor);
+	}
+
+	AActor* OtherRoot = Data->TestWorld->SpawnActor<ADefaultPawn>(SpawnParams);
+
+	TArray<AActor*> Items;
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		AActor* Item = Data->TestWorld->SpawnActor<ADefaultPawn>(SpawnParams);
+		Item->SetOwner(Chain.Last());
+		Data->LockingPolicy->OnOwnerUpdated(Item, nullptr);
+		Items.Add(Item);
+	}
+
+	const ActorLockToken Token = Data->LockingPolicy->AcquireLock(Items[0], TEXT("Benchmark lock"));
+
+	int32 NumOwnerUpdates = 0;
+	int32 NumLockedQueries = 0;
+	int32 NumQueries = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		for (AActor* Item : Items)
+		{
+			AActor* OldOwner = Item->GetOwner();
+			Item->SetOwner(OldOwner == OtherRoot ? Chain.Last() : OtherRoot);
+			Data->LockingPolicy->OnOwnerUpdated(Item, OldOwner);
+			NumOwnerUpdates++;
+
+			NumLockedQueries += Data->LockingPolicy->IsLocked(Chain[0]) ? 1 : 0;
+			NumLockedQueries += Data->LockingPolicy->IsLocked(OtherRoot) ? 1 : 0;
+			NumQueries += 2;
+		}
+	}
+	const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+	Test->AddInfo(FString::Printf(TEXT("Hierarchy depth %d: %.2f us per owner change and two lock queries"), ChainDepth, ElapsedTime / NumOwnerUpdates * 1e6));
+
+	// The locked item is always in exactly one of the two hierarchies.
+	Test->TestEqual(TEXT("Exactly one hierarchy is locked at a time"), NumLockedQueries, NumQueries / 2);
+	Test->TestTrue(TEXT("Items are locked through their hierarchy"), Data->LockingPolicy->IsLocked(Items[1]) == Data->LockingPolicy->IsLocked(Items[0]));
+
+	Data->LockingPolicy->ReleaseLock(Token);
+	Test->TestFalse(TEXT("Chain root is not locked after releasing the lock"), Data->LockingPolicy->IsLocked(Chain[0]));
+	Test->TestFalse(TEXT("Other root is not locked after releasing the lock"), Data->LockingPolicy->IsLocked(OtherRoot));
+
+	return true;
+}
+
 void SpawnABCDHierarchy(FAutomationTestBase* Test, TSharedPtr<TestData> Data)
 {
 	//        A 
@@ -986,6 +1061,51 @@ OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_AcquireLock_is_called_on_hierarchy_root_WHEN_h
 	return true;
 }
 
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_AcquireLock_is_called_on_Actors_in_two_branches_WHEN_one_branch_switches_owner_THEN_IsLocked_returns_correctly_for_all_Actors)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	SpawnABCDEHierarchy(this, Data);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAcquireLock(this, Data, "C", "First lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FAcquireLock(this, Data, "D", "Second lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnership(Data, "B", "E"));
+
+	//             A                          E
+	//             |                          |
+	//    D (explicitly locked)               B
+	//                                        |
+	//                                C (explicitly locked)
+
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "A", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "E", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FReleaseLock(this, Data, "D", "Second lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "A", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "D", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "B", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "E", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FReleaseLock(this, Data, "C", "First lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "E", false));
+
+	return true;
+}
+
+OWNERSHIPLOCKINGPOLICY_BENCHMARK(GIVEN_a_deep_ownership_hierarchy_WHEN_items_keep_switching_owner_THEN_IsLocked_stays_correct)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FRunDeepHierarchyBenchmark(this, Data));
+
+	return true;
+}
+
 // AcquireLockDelegate and ReleaseLockDelegate
 
 OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_Actor_is_not_locked_WHEN_ReleaseLock_delegate_is_executed_THEN_it_errors_and_returns_false)
@@ -0,0 +1,102 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Schema/ComponentPresence.h"
+
+#define COMPONENT_PRESENCE_TEST(TestName) \
+	GDK_TEST(Core, ComponentPresence, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		void ApplyUpdate(ComponentPresence& Writer, ComponentPresence& Reader, bool& bOutRewroteList)
+		{
+			Worker_ComponentUpdate Update = Writer.CreateComponentPresenceUpdate();
+			bOutRewroteList = Schema_GetUint32Count(Schema_GetComponentUpdateFields(Update.schema_type), SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID) > 0;
+			Reader.ApplyComponentUpdate(Update);
+			Schema_DestroyComponentUpdate(Update.schema_type);
+		}
+	} // anonymous namespace
+
+	COMPONENT_PRESENCE_TEST(GIVEN_a_few_changes_WHEN_update_is_applied_THEN_only_changes_are_sent)
+	{
+		ComponentPresence Writer(TArray<Worker_ComponentId>{ 30, 10, 20 });
+		Worker_ComponentData Data = Writer.CreateComponentPresenceData();
+		ComponentPresence Reader(Data);
+		Schema_DestroyComponentData(Data.schema_type);
+
+		TestTrue("The list is sorted", Reader.ComponentList == TArray<Worker_ComponentId>{ 10, 20, 30 });
+
+		bool bRewroteList = false;
+		Writer.AddComponentIds({ 25, 40 });
+		ApplyUpdate(Writer, Reader, bRewroteList);
+		TestFalse("Adding does not rewrite the list", bRewroteList);
+		TestTrue("Added IDs are applied", Reader.ComponentList == TArray<Worker_ComponentId>{ 10, 20, 25, 30, 40 });
+
+		Writer.RemoveComponentIds({ 20, 40 });
+		ApplyUpdate(Writer, Reader, bRewroteList);
+		TestFalse("Removing does not rewrite the list", bRewroteList);
+		TestTrue("Removed IDs are applied", Reader.ComponentList == TArray<Worker_ComponentId>{ 10, 25, 30 });
+		TestTrue("Removing an added ID cancels it", Writer.AddedComponentIds == TArray<Worker_ComponentId>{ 25 });
+		TestTrue("Removing a base ID is sent", Writer.RemovedComponentIds == TArray<Worker_ComponentId>{ 20 });
+
+		return true;
+	}
+
+	COMPONENT_PRESENCE_TEST(GIVEN_more_changes_than_the_list_WHEN_update_is_applied_THEN_list_is_rewritten)
+	{
+		ComponentPresence Writer(TArray<Worker_ComponentId>{ 1, 2 });
+		ComponentPresence Reader(TArray<Worker_ComponentId>{ 1, 2 });
+
+		TArray<Worker_ComponentId> NewComponentIds;
+		for (Worker_ComponentId Id = 100; Id < 100 + ComponentPresence::MinChangesBeforeRewrite + 1; Id++)
+		{
+			NewComponentIds.Add(Id);
+		}
+		Writer.AddComponentIds(NewComponentIds);
+
+		bool bRewroteList = false;
+		ApplyUpdate(Writer, Reader, bRewroteList);
+		TestTrue("The list is rewritten", bRewroteList);
+		TestTrue("Reader has every ID", Reader.ComponentList == Writer.ComponentList);
+		TestEqual("Reader has no changes left", Reader.AddedComponentIds.Num() + Reader.RemovedComponentIds.Num(), 0);
+
+		Writer.RemoveComponentIds({ 1 });
+		ApplyUpdate(Writer, Reader, bRewroteList);
+		TestFalse("Changes after the rewrite are sent as changes", bRewroteList);
+		TestTrue("Reader matches writer", Reader.ComponentList == Writer.ComponentList);
+
+		return true;
+	}
+
+	COMPONENT_PRESENCE_TEST(GIVEN_every_id_is_removed_WHEN_list_is_rewritten_THEN_reader_list_is_cleared)
+	{
+		TArray<Worker_ComponentId> ComponentIds;
+		for (Worker_ComponentId Id = 100; Id < 100 + ComponentPresence::MinChangesBeforeRewrite + 1; Id++)
+		{
+			ComponentIds.Add(Id);
+		}
+		ComponentPresence Writer(CopyTemp(ComponentIds));
+		ComponentPresence Reader(CopyTemp(ComponentIds));
+
+		Writer.RemoveComponentIds(ComponentIds);
+
+		bool bRewroteList = false;
+		Worker_ComponentUpdate Update = Writer.CreateComponentPresenceUpdate();
+		TArray<Schema_FieldId> ClearedIds;
+		ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(Update.schema_type));
+		Schema_GetComponentUpdateClearedFieldList(Update.schema_type, ClearedIds.GetData());
+		bRewroteList = ClearedIds.Contains(SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID);
+		Reader.ApplyComponentUpdate(Update);
+		Schema_DestroyComponentUpdate(Update.schema_type);
+
+		TestTrue("The empty list is rewritten by clearing it", bRewroteList);
+		TestEqual("Reader base list is cleared", Reader.BaseComponentList.Num(), 0);
+		TestEqual("Reader has no changes left", Reader.AddedComponentIds.Num() + Reader.RemovedComponentIds.Num(), 0);
+		TestEqual("Reader list is empty", Reader.ComponentList.Num(), 0);
+
+		return true;
+	}
+}
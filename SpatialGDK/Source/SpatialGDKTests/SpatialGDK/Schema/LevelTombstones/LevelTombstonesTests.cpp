@@ -0,0 +1,65 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#include "Tests/TestDefinitions.h"
+#include "Interop/StartupActorTombstones.h"
+#include "Schema/LevelTombstones.h"
+
+#define LEVELTOMBSTONES_TEST(TestName) \
+	GDK_TEST(Core, LevelTombstones, TestName)
+
+using namespace SpatialGDK;
+
+LEVELTOMBSTONES_TEST(GIVEN_a_sorted_set_WHEN_merging_overlapping_ids_THEN_the_set_stays_sorted_and_unique)
+{
+	LevelTombstones Tombstones(TEXT("/Game/Maps/TestLevel"), { 2, 5, 9 });
+
+	const int32 NumAdded = Tombstones.MergeActorIds({ 1, 5, 5, 7, 12 });
+
+	TestEqual(TEXT("Only new IDs are counted"), NumAdded, 3);
+	TestTrue(TEXT("Merged IDs"), Tombstones.ActorIds == TArray<uint64>{ 1, 2, 5, 7, 9, 12 });
+	TestTrue(TEXT("Contains a merged ID"), Tombstones.Contains(7));
+	TestFalse(TEXT("Doesn't contain an unmerged ID"), Tombstones.Contains(6));
+
+	return true;
+}
+
+LEVELTOMBSTONES_TEST(GIVEN_level_tombstones_WHEN_written_to_component_data_THEN_they_can_be_read_back)
+{
+	const LevelTombstones Tombstones(TEXT("/Game/Maps/TestLevel"), { 3, 8, 21 });
+
+	Worker_ComponentData Data = Tombstones.CreateLevelTombstonesData();
+	const LevelTombstones ReadTombstones(Data);
+	Schema_DestroyComponentData(Data.schema_type);
+
+	TestEqual(TEXT("Level path"), ReadTombstones.LevelPath, Tombstones.LevelPath);
+	TestTrue(TEXT("Actor IDs"), ReadTombstones.ActorIds == Tombstones.ActorIds);
+
+	return true;
+}
+
+LEVELTOMBSTONES_TEST(GIVEN_level_tombstones_WHEN_an_update_is_applied_THEN_the_ids_are_replaced)
+{
+	LevelTombstones Tombstones(TEXT("/Game/Maps/TestLevel"), { 3 });
+	const LevelTombstones UpdatedTombstones(TEXT("/Game/Maps/TestLevel"), { 3, 4, 10 });
+
+	Worker_ComponentUpdate Update = UpdatedTombstones.CreateLevelTombstonesUpdate();
+	Tombstones.ApplyComponentUpdate(Update);
+	Schema_DestroyComponentUpdate(Update.schema_type);
+
+	TestTrue(TEXT("Actor IDs"), Tombstones.ActorIds == UpdatedTombstones.ActorIds);
+
+	return true;
+}
+
+LEVELTOMBSTONES_TEST(GIVEN_stable_actor_paths_WHEN_hashing_them_THEN_ids_are_deterministic_and_distinct)
+{
+	const FString PathA = TEXT("/Game/Maps/TestLevel.TestLevel:PersistentLevel.Door_1");
+	const FString PathB = TEXT("/Game/Maps/TestLevel.TestLevel:PersistentLevel.Door_2");
+
+	TestTrue(TEXT("Same path hashes to the same ID"), FStartupActorTombstones::GetTombstoneId(PathA) == FStartupActorTombstones::GetTombstoneId(FString(PathA)));
+	TestTrue(TEXT("Different paths hash to different IDs"), FStartupActorTombstones::GetTombstoneId(PathA) != FStartupActorTombstones::GetTombstoneId(PathB));
+
+	return true;
+}
@@ -0,0 +1,57 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#include "Tests/TestDefinitions.h"
+#include "Schema/PlayerSpawner.h"
+#include "SpatialConstants.h"
+
+#define PLAYERSPAWNER_TEST(TestName) \
+	GDK_TEST(Core, PlayerSpawner, TestName)
+
+using namespace SpatialGDK;
+
+PLAYERSPAWNER_TEST(GIVEN_a_spawn_request_of_a_rejoining_client_WHEN_extracting_it_THEN_the_previous_player_controller_is_kept)
+{
+	SpawnPlayerRequest SpawnRequest{ FURL(), FUniqueNetIdRepl(), FName(TEXT("Platform")), false };
+	SpawnRequest.RejoinPreviousWorkerId = TEXT("UnrealClientPrevious");
+	SpawnRequest.RejoinPlayerControllerEntityId = 42;
+	SpawnRequest.RejoinToken = TEXT("Token");
+
+	Worker_CommandRequest CommandRequest = PlayerSpawner::CreatePlayerSpawnRequest(SpawnRequest);
+	const SpawnPlayerRequest Extracted = PlayerSpawner::ExtractPlayerSpawnParams(Schema_GetCommandRequestObject(CommandRequest.schema_type));
+	Schema_DestroyCommandRequest(CommandRequest.schema_type);
+
+	TestEqual("Previous worker ID is kept", Extracted.RejoinPreviousWorkerId, FString(TEXT("UnrealClientPrevious")));
+	TestEqual("Player controller entity is kept", Extracted.RejoinPlayerControllerEntityId, static_cast<Worker_EntityId>(42));
+	TestEqual("Rejoin token is kept", Extracted.RejoinToken, FString(TEXT("Token")));
+	TestEqual("Platform name is kept", Extracted.OnlinePlatformName, FName(TEXT("Platform")));
+
+	return true;
+}
+
+PLAYERSPAWNER_TEST(GIVEN_a_spawn_request_of_a_new_client_WHEN_extracting_it_THEN_no_player_controller_is_asked_for)
+{
+	SpawnPlayerRequest SpawnRequest{ FURL(), FUniqueNetIdRepl(), FName(), false };
+
+	Worker_CommandRequest CommandRequest = PlayerSpawner::CreatePlayerSpawnRequest(SpawnRequest);
+	const SpawnPlayerRequest Extracted = PlayerSpawner::ExtractPlayerSpawnParams(Schema_GetCommandRequestObject(CommandRequest.schema_type));
+	Schema_DestroyCommandRequest(CommandRequest.schema_type);
+
+	TestEqual("No player controller entity", Extracted.RejoinPlayerControllerEntityId, SpatialConstants::INVALID_ENTITY_ID);
+	TestTrue("No previous worker ID", Extracted.RejoinPreviousWorkerId.IsEmpty());
+
+	return true;
+}
+
+PLAYERSPAWNER_TEST(GIVEN_a_spawn_response_with_a_rejoin_token_WHEN_reading_it_THEN_the_token_is_kept)
+{
+	Worker_CommandResponse Response = PlayerSpawner::CreatePlayerSpawnResponse(/* bRejoined */ false, TEXT("Token"));
+	Schema_Object* ResponseObject = Schema_GetCommandResponseObject(Response.schema_type);
+
+	TestEqual("Rejoin token", GetStringFromSchema(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOIN_TOKEN_ID), FString(TEXT("Token")));
+	TestFalse("Not rejoined", GetBoolFromSchema(ResponseObject, SpatialConstants::SPAWN_PLAYER_RESPONSE_REJOINED_ID));
+	Schema_DestroyCommandResponse(Response.schema_type);
+
+	return true;
+}
@@ -30,3 +30,19 @@ UNREALOBJECTREF_TEST(GIVEN_a_softpointer_WHEN_making_an_object_ref_from_it_THEN_
 }
 
 // TODO : [UNR-2691] Add tests involving the PackageMapClient, with entity Id and actual assets to generate the path to/from (needs a NetDriver right now).
+
+UNREALOBJECTREF_TEST(GIVEN_two_refs_with_equal_paths_WHEN_comparing_and_hashing_THEN_they_match_case_sensitively)
+{
+	const FUnrealObjectRef Outer(0, 0, FString(TEXT("/Game/Maps/TestMap")), FUnrealObjectRef());
+	const FUnrealObjectRef Ref(0, 0, FString(TEXT("PersistentLevel")), Outer);
+	const FUnrealObjectRef SameRef(0, 0, FString(TEXT("PersistentLevel")), Outer);
+	const FUnrealObjectRef DifferentCaseRef(0, 0, FString(TEXT("persistentlevel")), Outer);
+
+	TestTrue("Refs with equal paths are equal", Ref == SameRef);
+	TestTrue("Refs with equal paths hash the same", GetTypeHash(Ref) == GetTypeHash(SameRef));
+	TestTrue("Paths differing in case are different", Ref != DifferentCaseRef);
+	TestTrue("Interned path keeps its string", Ref.Path->ToString() == TEXT("PersistentLevel") && DifferentCaseRef.Path->ToString().Equals(TEXT("persistentlevel"), ESearchCase::CaseSensitive));
+	TestTrue("Level reference found by interned path", Ref.GetLevelReference() == Ref);
+
+	return true;
+}
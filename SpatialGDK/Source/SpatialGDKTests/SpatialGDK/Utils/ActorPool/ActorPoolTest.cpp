@@ -0,0 +1,183 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "PooledActorSpy.h"
+#include "Utils/ActorPool.h"
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/GameStateBase.h"
+#include "Tests/AutomationCommon.h"
+
+#define ACTORPOOL_TEST(TestName) \
+	GDK_TEST(Core, FActorPool, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+UWorld* TestWorld;
+
+// Copied from AutomationCommon::GetAnyGameWorld().
+UWorld* GetAnyGameWorld()
+{
+	UWorld* World = nullptr;
+	const TIndirectArray<FWorldContext>& WorldContexts = GEngine->GetWorldContexts();
+	for (const FWorldContext& Context : WorldContexts)
+	{
+		if ((Context.WorldType == EWorldType::PIE || Context.WorldType == EWorldType::Game)
+			&& (Context.World() != nullptr))
+		{
+			World = Context.World();
+			break;
+		}
+	}
+
+	return World;
+}
+
+APooledActorSpy* SpawnPooledActor()
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.bNoFail = true;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return TestWorld->SpawnActor<APooledActorSpy>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FWaitForWorld);
+bool FWaitForWorld::Update()
+{
+	TestWorld = GetAnyGameWorld();
+
+	if (TestWorld && TestWorld->AreActorsInitialized())
+	{
+		AGameStateBase* GameState = TestWorld->GetGameState();
+		if (GameState && GameState->HasMatchStarted())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FCleanup);
+bool FCleanup::Update()
+{
+	TestWorld = nullptr;
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FCheckReleasedActorIsReused, FAutomationTestBase*, Test);
+bool FCheckReleasedActorIsReused::Update()
+{
+	FActorPool Pool(1);
+	APooledActorSpy* Actor = SpawnPooledActor();
+
+	Test->TestTrue("The actor was pooled", Pool.Release(Actor));
+	Test->TestTrue("The pooled actor is hidden", Actor->IsHidden());
+	Test->TestEqual("The actor was told it was returned to the pool", Actor->TimesReturnedToPool, 1);
+
+	const FVector NewLocation(100.f, 200.f, 300.f);
+	AActor* AcquiredActor = Pool.Acquire(APooledActorSpy::StaticClass(), FTransform(NewLocation));
+
+	Test->TestTrue("The pooled actor was reused", AcquiredActor == Actor);
+	Test->TestFalse("The reused actor is shown", Actor->IsHidden());
+	Test->TestEqual("The reused actor was moved to the spawn transform", Actor->GetActorLocation(), NewLocation);
+	Test->TestEqual("The actor was told it was taken from the pool", Actor->TimesTakenFromPool, 1);
+	Test->TestNull("The pool is empty", Pool.Acquire(APooledActorSpy::StaticClass(), FTransform::Identity));
+
+	Actor->Destroy();
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FCheckFullPoolRejectsActors, FAutomationTestBase*, Test);
+bool FCheckFullPoolRejectsActors::Update()
+{
+	FActorPool Pool(1);
+	APooledActorSpy* FirstActor = SpawnPooledActor();
+	APooledActorSpy* SecondActor = SpawnPooledActor();
+
+	Test->TestTrue("The first actor was pooled", Pool.Release(FirstActor));
+	Test->TestFalse("The second actor was not pooled", Pool.Release(SecondActor));
+	Test->TestFalse("The second actor is still shown", SecondActor->IsHidden());
+	Test->TestEqual("The second actor was not told it was returned to the pool", SecondActor->TimesReturnedToPool, 0);
+
+	FirstActor->Destroy();
+	SecondActor->Destroy();
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FCheckDestroyedActorIsNotReused, FAutomationTestBase*, Test);
+bool FCheckDestroyedActorIsNotReused::Update()
+{
+	FActorPool Pool(1);
+	APooledActorSpy* Actor = SpawnPooledActor();
+
+	Pool.Release(Actor);
+	Actor->Destroy();
+
+	Test->TestNull("The destroyed actor was not reused", Pool.Acquire(APooledActorSpy::StaticClass(), FTransform::Identity));
+
+	return true;
+}
+
+} // anonymous namespace
+
+ACTORPOOL_TEST(GIVEN_classes_WHEN_checking_if_poolable_THEN_only_classes_implementing_the_pooled_actor_interface_are)
+{
+	TestTrue("Actors implementing the interface are poolable", FActorPool::IsPoolable(APooledActorSpy::StaticClass()));
+	TestFalse("Other actors are not poolable", FActorPool::IsPoolable(ADefaultPawn::StaticClass()));
+	TestFalse("No class is not poolable", FActorPool::IsPoolable(nullptr));
+
+	return true;
+}
+
+ACTORPOOL_TEST(GIVEN_an_empty_pool_WHEN_acquiring_an_actor_THEN_none_is_returned)
+{
+	FActorPool Pool(1);
+
+	TestNull("No actor was returned", Pool.Acquire(APooledActorSpy::StaticClass(), FTransform::Identity));
+
+	return true;
+}
+
+ACTORPOOL_TEST(GIVEN_a_released_actor_WHEN_acquiring_an_actor_of_its_class_THEN_it_is_reused)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckReleasedActorIsReused(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+ACTORPOOL_TEST(GIVEN_a_full_pool_WHEN_releasing_another_actor_THEN_it_is_not_pooled)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckFullPoolRejectsActors(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+ACTORPOOL_TEST(GIVEN_a_pooled_actor_is_destroyed_WHEN_acquiring_an_actor_of_its_class_THEN_none_is_returned)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckDestroyedActorIsNotReused(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
@@ -0,0 +1,13 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "PooledActorSpy.h"
+
+void APooledActorSpy::OnReturnedToPool_Implementation()
+{
+	TimesReturnedToPool++;
+}
+
+void APooledActorSpy::OnTakenFromPool_Implementation()
+{
+	TimesTakenFromPool++;
+}
@@ -0,0 +1,22 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Utils/ActorPool.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include "PooledActorSpy.generated.h"
+
+UCLASS()
+class APooledActorSpy : public AActor, public ISpatialPooledActor
+{
+	GENERATED_BODY()
+public:
+	virtual void OnReturnedToPool_Implementation() override;
+	virtual void OnTakenFromPool_Implementation() override;
+
+	int32 TimesReturnedToPool = 0;
+	int32 TimesTakenFromPool = 0;
+};
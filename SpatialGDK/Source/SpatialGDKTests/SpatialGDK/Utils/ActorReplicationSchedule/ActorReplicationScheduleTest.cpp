@@ -0,0 +1,101 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ActorReplicationSchedule.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#define ACTORREPLICATIONSCHEDULE_TEST(TestName) \
+	GDK_TEST(Core, FActorReplicationSchedule, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const double SlotSeconds = 0.1;
+} // anonymous namespace
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_scheduled_actors_WHEN_collecting_THEN_only_due_actors_are_returned)
+{
+	FActorReplicationSchedule Schedule(SlotSeconds);
+	AActor* SoonActor = NewObject<AActor>();
+	AActor* LaterActor = NewObject<AActor>();
+	Schedule.Schedule(SoonActor, 0.25);
+	Schedule.Schedule(LaterActor, 1.5);
+
+	TArray<AActor*> DueActors;
+	Schedule.CollectDue(0.2, DueActors);
+	TestEqual("No actors due before their time", DueActors.Num(), 0);
+
+	Schedule.CollectDue(0.3, DueActors);
+	TestTrue("Soon actor due", DueActors.Num() == 1 && DueActors[0] == SoonActor);
+	TestFalse("Due actor removed from the schedule", Schedule.IsScheduled(SoonActor));
+	TestTrue("Later actor still scheduled", Schedule.IsScheduled(LaterActor));
+
+	DueActors.Reset();
+	Schedule.CollectDue(2.0, DueActors);
+	TestTrue("Later actor due", DueActors.Num() == 1 && DueActors[0] == LaterActor);
+
+	return true;
+}
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_rescheduled_actor_WHEN_collecting_THEN_actor_is_returned_once_at_its_latest_time)
+{
+	FActorReplicationSchedule Schedule(SlotSeconds);
+	AActor* Actor = NewObject<AActor>();
+	Schedule.Schedule(Actor, 1.0);
+	Schedule.Schedule(Actor, 0.5);
+
+	TArray<AActor*> DueActors;
+	Schedule.CollectDue(0.6, DueActors);
+	Schedule.CollectDue(1.1, DueActors);
+
+	TestTrue("Actor collected once", DueActors.Num() == 1 && DueActors[0] == Actor);
+	TestEqual("Schedule is empty", Schedule.Num(), 0);
+
+	return true;
+}
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_actor_scheduled_in_a_collected_slot_or_beyond_one_turn_WHEN_collecting_THEN_actor_is_returned_when_due)
+{
+	FActorReplicationSchedule Schedule(SlotSeconds);
+	AActor* PastActor = NewObject<AActor>();
+	AActor* FarActor = NewObject<AActor>();
+
+	TArray<AActor*> DueActors;
+	Schedule.CollectDue(1.0, DueActors);
+
+	// 256 slots of 0.1s cover 25.6s, so the far actor's slot is visited once before it is due.
+	Schedule.Schedule(PastActor, 0.5);
+	Schedule.Schedule(FarActor, 1.0 + 30.0);
+
+	Schedule.CollectDue(1.05, DueActors);
+	TestTrue("Actor scheduled in the past is due", DueActors.Num() == 1 && DueActors[0] == PastActor);
+
+	DueActors.Reset();
+	Schedule.CollectDue(1.0 + 5.0, DueActors);
+	Schedule.CollectDue(1.0 + 29.0, DueActors);
+	TestEqual("Far actor not due a turn early", DueActors.Num(), 0);
+
+	Schedule.CollectDue(1.0 + 31.0, DueActors);
+	TestTrue("Far actor due", DueActors.Num() == 1 && DueActors[0] == FarActor);
+
+	return true;
+}
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_unscheduled_actor_WHEN_collecting_THEN_actor_is_not_returned)
+{
+	FActorReplicationSchedule Schedule(SlotSeconds);
+	AActor* Actor = NewObject<AActor>();
+	Schedule.Schedule(Actor, 0.1);
+	Schedule.Unschedule(Actor);
+
+	TArray<AActor*> DueActors;
+	Schedule.CollectDue(1.0, DueActors);
+
+	TestEqual("No actors due", DueActors.Num(), 0);
+
+	return true;
+}
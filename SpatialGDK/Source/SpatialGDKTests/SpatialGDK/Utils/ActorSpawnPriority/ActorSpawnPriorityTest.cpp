@@ -0,0 +1,100 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ActorSpawnPriority.h"
+
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/SpectatorPawn.h"
+
+#define ACTOR_SPAWN_PRIORITY_TEST(TestName) \
+	GDK_TEST(Core, ActorSpawnPriority, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+TArray<Worker_EntityId> GetEntityIds(const TArray<FActorSpawnCandidate>& ActorSpawns)
+{
+	TArray<Worker_EntityId> EntityIds;
+	for (const FActorSpawnCandidate& ActorSpawn : ActorSpawns)
+	{
+		EntityIds.Add(ActorSpawn.EntityId);
+	}
+	return EntityIds;
+}
+
+} // anonymous namespace
+
+ACTOR_SPAWN_PRIORITY_TEST(GIVEN_candidates_of_different_priorities_WHEN_sorted_THEN_the_highest_priority_is_first_whatever_the_distance)
+{
+	TArray<FActorSpawnCandidate> ActorSpawns = {
+		{ 1, 1.0f, FVector(10.0f, 0.0f, 0.0f) },
+		{ 2, 3.0f, FVector(5000.0f, 0.0f, 0.0f) },
+		{ 3, 2.0f, FVector::ZeroVector }
+	};
+
+	SortActorSpawnsByPriority(ActorSpawns, FVector::ZeroVector, /* bHasOrigin */ true);
+
+	TestTrue("Sorted by priority", GetEntityIds(ActorSpawns) == TArray<Worker_EntityId>{ 2, 3, 1 });
+
+	return true;
+}
+
+ACTOR_SPAWN_PRIORITY_TEST(GIVEN_candidates_of_the_same_priority_and_an_origin_WHEN_sorted_THEN_the_nearest_to_the_origin_is_first)
+{
+	const FVector Origin(1000.0f, 1000.0f, 0.0f);
+	TArray<FActorSpawnCandidate> ActorSpawns = {
+		{ 1, 1.0f, FVector::ZeroVector },
+		{ 2, 1.0f, FVector(1100.0f, 1000.0f, 0.0f) },
+		{ 3, 1.0f, FVector(1500.0f, 1000.0f, 0.0f) }
+	};
+
+	SortActorSpawnsByPriority(ActorSpawns, Origin, /* bHasOrigin */ true);
+
+	TestTrue("Sorted by distance to the origin", GetEntityIds(ActorSpawns) == TArray<Worker_EntityId>{ 2, 3, 1 });
+
+	return true;
+}
+
+ACTOR_SPAWN_PRIORITY_TEST(GIVEN_candidates_of_the_same_priority_and_no_origin_WHEN_sorted_THEN_they_keep_their_checkout_order)
+{
+	// Servers have no local player, so candidates of the same priority are spawned in the order their entities were checked out.
+	TArray<FActorSpawnCandidate> ActorSpawns = {
+		{ 1, 1.0f, FVector(5000.0f, 0.0f, 0.0f) },
+		{ 2, 2.0f, FVector(3000.0f, 0.0f, 0.0f) },
+		{ 3, 1.0f, FVector::ZeroVector },
+		{ 4, 1.0f, FVector(1000.0f, 0.0f, 0.0f) }
+	};
+
+	SortActorSpawnsByPriority(ActorSpawns, FVector::ZeroVector, /* bHasOrigin */ false);
+
+	TestTrue("Sorted by priority only", GetEntityIds(ActorSpawns) == TArray<Worker_EntityId>{ 2, 1, 3, 4 });
+
+	return true;
+}
+
+ACTOR_SPAWN_PRIORITY_TEST(GIVEN_no_configured_priorities_WHEN_getting_a_class_priority_THEN_its_net_priority_is_returned)
+{
+	const TMap<TSoftClassPtr<AActor>, float> ClassPriorities;
+
+	TestEqual("Actor priority", GetActorSpawnClassPriority(AActor::StaticClass(), ClassPriorities), GetDefault<AActor>()->NetPriority);
+	TestEqual("Pawn priority", GetActorSpawnClassPriority(APawn::StaticClass(), ClassPriorities), GetDefault<APawn>()->NetPriority);
+
+	return true;
+}
+
+ACTOR_SPAWN_PRIORITY_TEST(GIVEN_configured_priorities_for_a_class_hierarchy_WHEN_getting_a_class_priority_THEN_the_most_derived_configured_class_wins)
+{
+	TMap<TSoftClassPtr<AActor>, float> ClassPriorities;
+	ClassPriorities.Add(TSoftClassPtr<AActor>(APawn::StaticClass()), 5.0f);
+	ClassPriorities.Add(TSoftClassPtr<AActor>(ADefaultPawn::StaticClass()), 7.0f);
+
+	TestEqual("A configured class uses its priority", GetActorSpawnClassPriority(APawn::StaticClass(), ClassPriorities), 5.0f);
+	TestEqual("A configured class overrides its super class", GetActorSpawnClassPriority(ADefaultPawn::StaticClass(), ClassPriorities), 7.0f);
+	TestEqual("A derived class uses its nearest configured super class", GetActorSpawnClassPriority(ASpectatorPawn::StaticClass(), ClassPriorities), 7.0f);
+	TestEqual("An unrelated class uses its net priority", GetActorSpawnClassPriority(AActor::StaticClass(), ClassPriorities), GetDefault<AActor>()->NetPriority);
+
+	return true;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/Interest/AlwaysInterestedConstraintCache.h"
+
+#define ALWAYS_INTERESTED_CONSTRAINT_CACHE_TEST(TestName) \
+	GDK_TEST(Core, FAlwaysInterestedConstraintCache, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		constexpr Worker_EntityId PlayerControllerEntityId = 10;
+
+		// Builds an entity ID constraint on InterestedEntityId, counting how many times it was built.
+		TFunction<bool(QueryConstraint&)> MakeBuilder(const Worker_EntityId& InterestedEntityId, int32& NumBuilds, bool bCanCache = true)
+		{
+			return [&InterestedEntityId, &NumBuilds, bCanCache](QueryConstraint& OutConstraint)
+			{
+				QueryConstraint EntityIdConstraint;
+				EntityIdConstraint.EntityIdConstraint = InterestedEntityId;
+				OutConstraint.OrConstraint.Add(EntityIdConstraint);
+				NumBuilds++;
+				return bCanCache;
+			};
+		}
+	} // anonymous namespace
+
+	ALWAYS_INTERESTED_CONSTRAINT_CACHE_TEST(GIVEN_a_cached_constraint_WHEN_rebuilding_interest_THEN_the_cached_constraint_is_reused)
+	{
+		FAlwaysInterestedConstraintCache Cache;
+		Worker_EntityId InterestedEntityId = 100;
+		int32 NumBuilds = 0;
+		const TFunction<bool(QueryConstraint&)> Builder = MakeBuilder(InterestedEntityId, NumBuilds);
+
+		const QueryConstraint First = Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+
+		// Without an invalidation the property is assumed unchanged, even if the actor's value is different.
+		InterestedEntityId = 200;
+		const QueryConstraint Second = Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+
+		TestEqual("The constraint was only built once", NumBuilds, 1);
+		TestTrue("The cached constraint was returned", Second == First);
+		TestTrue("One cache hit was counted", Cache.GetNumCacheHits() == 1);
+
+		return true;
+	}
+
+	ALWAYS_INTERESTED_CONSTRAINT_CACHE_TEST(GIVEN_a_cached_constraint_WHEN_an_AlwaysInterested_property_is_written_THEN_the_constraint_is_rebuilt)
+	{
+		FAlwaysInterestedConstraintCache Cache;
+		Worker_EntityId InterestedEntityId = 100;
+		int32 NumBuilds = 0;
+		const TFunction<bool(QueryConstraint&)> Builder = MakeBuilder(InterestedEntityId, NumBuilds);
+
+		Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+
+		// The component factory invalidates the entity's constraint when bAlwaysInterestedHasChanged is set for its update.
+		InterestedEntityId = 200;
+		Cache.Invalidate(PlayerControllerEntityId);
+		const QueryConstraint Rebuilt = Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+
+		TestEqual("The constraint was built again", NumBuilds, 2);
+		TestTrue("The rebuilt constraint has the new value", Rebuilt.OrConstraint.Num() == 1 && Rebuilt.OrConstraint[0].EntityIdConstraint.IsSet()
+			&& Rebuilt.OrConstraint[0].EntityIdConstraint.GetValue() == 200);
+		TestEqual("The rebuilt constraint was cached", Cache.GetNumCachedConstraints(), 1);
+
+		return true;
+	}
+
+	ALWAYS_INTERESTED_CONSTRAINT_CACHE_TEST(GIVEN_a_cached_constraint_WHEN_another_entity_is_invalidated_THEN_the_constraint_is_still_reused)
+	{
+		FAlwaysInterestedConstraintCache Cache;
+		Worker_EntityId InterestedEntityId = 100;
+		int32 NumBuilds = 0;
+		const TFunction<bool(QueryConstraint&)> Builder = MakeBuilder(InterestedEntityId, NumBuilds);
+
+		Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+		Cache.Invalidate(PlayerControllerEntityId + 1);
+		Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+
+		TestEqual("The constraint was only built once", NumBuilds, 1);
+
+		return true;
+	}
+
+	ALWAYS_INTERESTED_CONSTRAINT_CACHE_TEST(GIVEN_a_constraint_which_can_change_without_a_write_WHEN_rebuilding_interest_THEN_it_is_built_every_time)
+	{
+		FAlwaysInterestedConstraintCache Cache;
+		Worker_EntityId InterestedEntityId = 100;
+		int32 NumBuilds = 0;
+		const TFunction<bool(QueryConstraint&)> Builder = MakeBuilder(InterestedEntityId, NumBuilds, false);
+
+		Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+		Cache.FindOrBuild(PlayerControllerEntityId, Builder);
+
+		TestEqual("The constraint was built each time", NumBuilds, 2);
+		TestEqual("Nothing was cached", Cache.GetNumCachedConstraints(), 0);
+
+		return true;
+	}
+} // namespace SpatialGDK
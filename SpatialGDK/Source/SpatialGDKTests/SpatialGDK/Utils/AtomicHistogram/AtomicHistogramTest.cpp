@@ -0,0 +1,74 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/AtomicHistogram.h"
+
+#include "CoreMinimal.h"
+
+#define ATOMICHISTOGRAM_TEST(TestName) \
+	GDK_TEST(Core, FAtomicHistogram, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const TArray<double> TestUpperBounds = { 1.0, 2.0, 4.0 };
+
+} // anonymous namespace
+
+ATOMICHISTOGRAM_TEST(GIVEN_nothing_was_recorded_WHEN_consumed_THEN_returns_false)
+{
+	FAtomicHistogram Histogram(TestUpperBounds);
+
+	HistogramMetric Metric;
+	TestFalse(TEXT("Consume returned false"), Histogram.Consume(Metric));
+	TestEqual(TEXT("Metric untouched"), Metric.Buckets.Num(), 0);
+
+	return true;
+}
+
+ATOMICHISTOGRAM_TEST(GIVEN_values_were_recorded_WHEN_consumed_THEN_buckets_are_cumulative_and_include_overflow)
+{
+	FAtomicHistogram Histogram(TestUpperBounds);
+	Histogram.Record(0.5);
+	Histogram.Record(1.0);
+	Histogram.Record(3.0);
+	Histogram.Record(10.0);
+
+	HistogramMetric Metric;
+	TestTrue(TEXT("Consume returned true"), Histogram.Consume(Metric));
+	TestEqual(TEXT("Sum"), Metric.Sum, 14.5);
+
+	if (!TestEqual(TEXT("One bucket per bound plus overflow"), Metric.Buckets.Num(), 4))
+	{
+		return true;
+	}
+
+	TestEqual(TEXT("Bucket 1.0"), Metric.Buckets[0].Samples, 2u);
+	TestEqual(TEXT("Bucket 2.0"), Metric.Buckets[1].Samples, 2u);
+	TestEqual(TEXT("Bucket 4.0"), Metric.Buckets[2].Samples, 3u);
+	TestEqual(TEXT("Overflow bucket"), Metric.Buckets[3].Samples, 4u);
+	TestEqual(TEXT("Overflow bound"), Metric.Buckets[3].UpperBound, TNumericLimits<double>::Max());
+
+	return true;
+}
+
+ATOMICHISTOGRAM_TEST(GIVEN_a_histogram_was_consumed_WHEN_consumed_again_THEN_returns_false)
+{
+	FAtomicHistogram Histogram(TestUpperBounds);
+	Histogram.Record(1.5);
+
+	HistogramMetric Metric;
+	Histogram.Consume(Metric);
+
+	HistogramMetric SecondMetric;
+	TestFalse(TEXT("Counts were reset"), Histogram.Consume(SecondMetric));
+
+	Histogram.Record(1.5);
+	TestTrue(TEXT("Records after a consume are reported"), Histogram.Consume(SecondMetric));
+	TestEqual(TEXT("Sum only includes the new sample"), SecondMetric.Sum, 1.5);
+
+	return true;
+}
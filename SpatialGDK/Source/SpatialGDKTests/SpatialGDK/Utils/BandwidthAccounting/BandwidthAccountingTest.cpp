@@ -0,0 +1,76 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/BandwidthAccounting.h"
+
+#include "CoreMinimal.h"
+
+#define BANDWIDTHACCOUNTING_TEST(TestName) \
+	GDK_TEST(Core, FBandwidthAccounting, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const Worker_EntityId TestEntityId = 1;
+const Worker_ComponentId TestComponentId = 10000;
+const Schema_FieldId TestFieldId = 1;
+
+} // anonymous namespace
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_accounting_is_disabled_WHEN_an_update_is_recorded_THEN_nothing_is_recorded)
+{
+	FBandwidthAccounting Accounting;
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update), TestFieldId, 1);
+	Accounting.RecordComponentUpdate(TestEntityId, TestComponentId, Update);
+	Schema_DestroyComponentUpdate(Update);
+
+	TestEqual(TEXT("Nothing recorded"), Accounting.ConsumeRecorded().Num(), 0);
+
+	return true;
+}
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_accounting_is_enabled_WHEN_updates_are_recorded_THEN_bytes_are_summed_per_entity_component)
+{
+	FBandwidthAccounting Accounting;
+	Accounting.SetEnabled(true);
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update), TestFieldId, 1);
+	const uint32 UpdateBytes = Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update)) + Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update));
+	Accounting.RecordComponentUpdate(TestEntityId, TestComponentId, Update);
+	Accounting.RecordComponentUpdate(TestEntityId, TestComponentId, Update);
+	Schema_DestroyComponentUpdate(Update);
+
+	TMap<EntityComponentId, FBandwidthStat> Recorded = Accounting.ConsumeRecorded();
+	const FBandwidthStat* Stat = Recorded.Find(EntityComponentId{ TestEntityId, TestComponentId });
+	if (TestNotNull(TEXT("Entity-component recorded"), Stat))
+	{
+		TestEqual(TEXT("Messages"), Stat->Messages, 2ull);
+		TestEqual(TEXT("Bytes"), Stat->Bytes, 2ull * UpdateBytes);
+	}
+
+	TestEqual(TEXT("Consuming clears the recorded bytes"), Accounting.ConsumeRecorded().Num(), 0);
+
+	return true;
+}
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_a_report_WHEN_written_as_csv_THEN_rows_are_sorted_by_bytes_within_each_category)
+{
+	FBandwidthReport Report;
+	Report.ByClass.FindOrAdd(TEXT("SmallActor")).Add(10);
+	Report.ByClass.FindOrAdd(TEXT("LargeActor")).Add(100);
+	Report.ByComponent.FindOrAdd(TestComponentId).Add(110, 2);
+
+	const FString Csv = Report.ToCsv(2.0);
+
+	TestTrue(TEXT("Header"), Csv.StartsWith(TEXT("Category,Name,Messages,Bytes,BytesPerSecond\n")));
+	TestTrue(TEXT("Component row"), Csv.Contains(TEXT("Component,10000,2,110,55.00\n")));
+	TestTrue(TEXT("Largest class first"), Csv.Find(TEXT("Class,LargeActor,1,100,50.00")) < Csv.Find(TEXT("Class,SmallActor,1,10,5.00")));
+
+	return true;
+}
@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ClientBandwidthBudget.h"
+
+#define CLIENT_BANDWIDTH_BUDGET_TEST(TestName) \
+	GDK_TEST(Core, ClientBandwidthBudget, TestName)
+
+namespace SpatialGDK
+{
+	CLIENT_BANDWIDTH_BUDGET_TEST(GIVEN_client_within_budget_WHEN_reported_THEN_frequency_scale_is_unchanged)
+	{
+		FClientBandwidthBudget Budget(0.25f);
+
+		TestFalse("The scale doesn't change", Budget.OnClientReport(900.0f, 1000.0f));
+		TestEqual("The scale is full", Budget.GetFrequencyScale(), 1.0f);
+
+		return true;
+	}
+
+	CLIENT_BANDWIDTH_BUDGET_TEST(GIVEN_client_over_budget_WHEN_reported_THEN_frequency_scale_is_lowered_proportionally)
+	{
+		FClientBandwidthBudget Budget(0.25f);
+
+		TestTrue("The scale changes", Budget.OnClientReport(2000.0f, 1000.0f));
+		TestEqual("The scale is halved", Budget.GetFrequencyScale(), 0.5f);
+
+		return true;
+	}
+
+	CLIENT_BANDWIDTH_BUDGET_TEST(GIVEN_client_far_over_budget_WHEN_reported_THEN_frequency_scale_is_clamped_to_minimum)
+	{
+		FClientBandwidthBudget Budget(0.25f);
+
+		Budget.OnClientReport(100000.0f, 1000.0f);
+		TestEqual("The scale is the minimum", Budget.GetFrequencyScale(), 0.25f);
+
+		return true;
+	}
+
+	CLIENT_BANDWIDTH_BUDGET_TEST(GIVEN_client_with_headroom_WHEN_reported_THEN_frequency_scale_is_raised_back_to_full)
+	{
+		FClientBandwidthBudget Budget(0.25f);
+		Budget.OnClientReport(4000.0f, 1000.0f);
+
+		int32 NumReports = 0;
+		while (Budget.OnClientReport(100.0f, 1000.0f))
+		{
+			NumReports++;
+		}
+
+		TestTrue("The scale is raised over a few reports", NumReports > 1);
+		TestEqual("The scale is full again", Budget.GetFrequencyScale(), 1.0f);
+
+		return true;
+	}
+} // namespace SpatialGDK
@@ -0,0 +1,98 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ClientObservationTracker.h"
+
+#include "CoreMinimal.h"
+
+#define CLIENTOBSERVATIONTRACKER_TEST(TestName) \
+	GDK_TEST(Core, FClientObservationTracker, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const float NetCullDistanceSquared = FMath::Square(1000.f);
+const float WakeUpMargin = 200.f;
+
+} // anonymous namespace
+
+CLIENTOBSERVATIONTRACKER_TEST(GIVEN_no_view_positions_WHEN_checking_an_actor_THEN_it_is_unobserved)
+{
+	FClientObservationTracker Tracker(WakeUpMargin);
+
+	TestFalse("Actor is observed", Tracker.IsObserved(FVector::ZeroVector, NetCullDistanceSquared));
+
+	return true;
+}
+
+CLIENTOBSERVATIONTRACKER_TEST(GIVEN_a_local_view_position_WHEN_checking_actors_THEN_only_actors_within_net_cull_distance_and_margin_are_observed)
+{
+	FClientObservationTracker Tracker(WakeUpMargin);
+	Tracker.SetLocalViewPositions({ FVector::ZeroVector });
+
+	TestTrue("Actor within net cull distance is observed", Tracker.IsObserved(FVector(900.f, 0.f, 0.f), NetCullDistanceSquared));
+	TestTrue("Actor within wake-up margin is observed", Tracker.IsObserved(FVector(1150.f, 0.f, 0.f), NetCullDistanceSquared));
+	TestFalse("Actor beyond wake-up margin is observed", Tracker.IsObserved(FVector(1250.f, 0.f, 0.f), NetCullDistanceSquared));
+
+	return true;
+}
+
+CLIENTOBSERVATIONTRACKER_TEST(GIVEN_remote_view_positions_WHEN_checking_an_actor_THEN_they_are_merged_with_local_ones)
+{
+	FClientObservationTracker Tracker(WakeUpMargin);
+	Tracker.SetLocalViewPositions({ FVector::ZeroVector });
+
+	TMap<Worker_EntityId_Key, TArray<FVector>> RemoteViewPositions;
+	RemoteViewPositions.Add(2, { FVector(10000.f, 0.f, 0.f) });
+	Tracker.SetRemoteViewPositions(MoveTemp(RemoteViewPositions));
+
+	TestTrue("Actor near a remote client is observed", Tracker.IsObserved(FVector(10500.f, 0.f, 0.f), NetCullDistanceSquared));
+	TestEqual("Number of view positions", Tracker.GetNumViewPositions(), 2);
+
+	// The other worker's clients have moved away.
+	Tracker.SetRemoteViewPositions(TMap<Worker_EntityId_Key, TArray<FVector>>());
+
+	TestFalse("Actor near a remote client is observed", Tracker.IsObserved(FVector(10500.f, 0.f, 0.f), NetCullDistanceSquared));
+
+	return true;
+}
+
+CLIENTOBSERVATIONTRACKER_TEST(GIVEN_remote_view_positions_WHEN_appending_them_THEN_every_remote_worker_s_positions_are_appended)
+{
+	FClientObservationTracker Tracker(WakeUpMargin);
+	Tracker.SetLocalViewPositions({ FVector::ZeroVector });
+
+	TMap<Worker_EntityId_Key, TArray<FVector>> RemoteViewPositions;
+	RemoteViewPositions.Add(2, { FVector(10000.f, 0.f, 0.f) });
+	RemoteViewPositions.Add(3, { FVector(0.f, 10000.f, 0.f), FVector(0.f, 20000.f, 0.f) });
+	Tracker.SetRemoteViewPositions(MoveTemp(RemoteViewPositions));
+
+	TArray<FVector> Positions = { FVector(1.f, 1.f, 1.f) };
+	Tracker.AppendRemoteViewPositions(Positions);
+
+	TestEqual("Remote positions are appended to the existing ones", Positions.Num(), 4);
+	TestFalse("Local positions are not appended", Positions.Contains(FVector::ZeroVector));
+	TestTrue("Positions of the second worker are appended", Positions.Contains(FVector(0.f, 20000.f, 0.f)));
+
+	return true;
+}
+
+CLIENTOBSERVATIONTRACKER_TEST(GIVEN_published_view_positions_WHEN_they_move_THEN_only_moves_beyond_the_tolerance_need_publishing)
+{
+	FClientObservationTracker Tracker(WakeUpMargin);
+
+	Tracker.SetLocalViewPositions({ FVector::ZeroVector });
+	TestTrue("New client needs publishing", Tracker.HaveLocalViewPositionsMoved(50.f));
+	Tracker.MarkLocalViewPositionsPublished();
+
+	Tracker.SetLocalViewPositions({ FVector(20.f, 0.f, 0.f) });
+	TestFalse("Small move needs publishing", Tracker.HaveLocalViewPositionsMoved(50.f));
+
+	Tracker.SetLocalViewPositions({ FVector(100.f, 0.f, 0.f) });
+	TestTrue("Large move needs publishing", Tracker.HaveLocalViewPositionsMoved(50.f));
+
+	return true;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ClientRejoinTokens.h"
+
+#define CLIENTREJOINTOKENS_TEST(TestName) \
+	GDK_TEST(Core, FClientRejoinTokens, TestName)
+
+namespace SpatialGDK
+{
+
+CLIENTREJOINTOKENS_TEST(GIVEN_a_disconnected_client_WHEN_it_rejoins_with_its_token_THEN_the_rejoin_is_accepted_once)
+{
+	FClientRejoinTokens Tokens;
+	const FString Token = Tokens.Issue(TEXT("ClientA"));
+	Tokens.OnWorkerDisconnected(TEXT("ClientA"));
+
+	TestTrue("Rejoin accepted", Tokens.TryConsume(TEXT("ClientA"), Token));
+	TestFalse("Token can't be used again", Tokens.TryConsume(TEXT("ClientA"), Token));
+
+	return true;
+}
+
+CLIENTREJOINTOKENS_TEST(GIVEN_another_client_WHEN_it_asks_for_a_player_controller_without_the_token_THEN_the_rejoin_is_rejected)
+{
+	FClientRejoinTokens Tokens;
+	const FString VictimToken = Tokens.Issue(TEXT("ClientA"));
+	const FString AttackerToken = Tokens.Issue(TEXT("ClientB"));
+	Tokens.OnWorkerDisconnected(TEXT("ClientA"));
+
+	TestFalse("No token", Tokens.TryConsume(TEXT("ClientA"), FString()));
+	TestFalse("Own token", Tokens.TryConsume(TEXT("ClientA"), AttackerToken));
+	TestFalse("Guessed token", Tokens.TryConsume(TEXT("ClientA"), TEXT("00000000000000000000000000000000")));
+	TestTrue("The real client can still rejoin", Tokens.TryConsume(TEXT("ClientA"), VictimToken));
+
+	return true;
+}
+
+CLIENTREJOINTOKENS_TEST(GIVEN_a_client_that_is_still_connected_WHEN_its_token_is_presented_THEN_the_rejoin_is_rejected)
+{
+	FClientRejoinTokens Tokens;
+	const FString Token = Tokens.Issue(TEXT("ClientA"));
+
+	TestFalse("Rejoin rejected while connected", Tokens.TryConsume(TEXT("ClientA"), Token));
+
+	Tokens.OnWorkerDisconnected(TEXT("ClientA"));
+	TestTrue("Rejoin accepted once disconnected", Tokens.TryConsume(TEXT("ClientA"), Token));
+
+	return true;
+}
+
+CLIENTREJOINTOKENS_TEST(GIVEN_a_reissued_token_WHEN_the_old_one_is_presented_THEN_the_rejoin_is_rejected)
+{
+	FClientRejoinTokens Tokens;
+	const FString OldToken = Tokens.Issue(TEXT("ClientA"));
+	const FString NewToken = Tokens.Issue(TEXT("ClientA"));
+	Tokens.OnWorkerDisconnected(TEXT("ClientA"));
+
+	TestTrue("Tokens differ", OldToken != NewToken);
+	TestFalse("Old token rejected", Tokens.TryConsume(TEXT("ClientA"), OldToken));
+	TestTrue("New token accepted", Tokens.TryConsume(TEXT("ClientA"), NewToken));
+
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialConstants.h"
+#include "Utils/CompactRepMovement.h"
+
+#define COMPACT_REP_MOVEMENT_TEST(TestName) \
+	GDK_TEST(Core, CompactRepMovement, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		const Schema_FieldId TestFieldId = 1;
+
+		FRepMovement RoundTrip(const FRepMovement& Movement)
+		{
+			Schema_ComponentData* ComponentData = Schema_CreateComponentData();
+			Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData);
+
+			CompactRepMovement::Write(ComponentObject, TestFieldId, Movement);
+
+			FRepMovement Received;
+			Received.LocationQuantizationLevel = Movement.LocationQuantizationLevel;
+			Received.VelocityQuantizationLevel = Movement.VelocityQuantizationLevel;
+			Received.RotationQuantizationLevel = Movement.RotationQuantizationLevel;
+			CompactRepMovement::Read(ComponentObject, TestFieldId, 0, Received);
+
+			Schema_DestroyComponentData(ComponentData);
+			return Received;
+		}
+	} // anonymous namespace
+
+	COMPACT_REP_MOVEMENT_TEST(GIVEN_moving_actor_WHEN_written_and_read_THEN_movement_is_quantized)
+	{
+		FRepMovement Movement;
+		Movement.LocationQuantizationLevel = EVectorQuantization::RoundOneDecimal;
+		Movement.Location = FVector(1234.56f, -78.91f, 0.04f);
+		Movement.LinearVelocity = FVector(600.f, 0.f, -12.f);
+		Movement.Rotation = FRotator(0.f, 90.f, 0.f);
+
+		const FRepMovement Received = RoundTrip(Movement);
+
+		TestTrue("Location is rounded to one decimal", Received.Location.Equals(FVector(1234.6f, -78.9f, 0.f), 0.001f));
+		TestTrue("Linear velocity is received", Received.LinearVelocity.Equals(Movement.LinearVelocity, 0.001f));
+		TestTrue("Rotation is received", Received.Rotation.Equals(Movement.Rotation, 0.01f));
+		TestFalse("Physics flag is not set", Received.bRepPhysics);
+
+		return true;
+	}
+
+	COMPACT_REP_MOVEMENT_TEST(GIVEN_actor_at_rest_WHEN_written_THEN_rotation_and_velocities_are_left_out)
+	{
+		FRepMovement Movement;
+		Movement.Location = FVector(100.f, 200.f, 300.f);
+
+		Schema_ComponentData* ComponentData = Schema_CreateComponentData();
+		Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData);
+		CompactRepMovement::Write(ComponentObject, TestFieldId, Movement);
+		Schema_Object* MovementObject = Schema_GetObject(ComponentObject, TestFieldId);
+
+		TestEqual("Location is written", (int32)Schema_GetSint64Count(MovementObject, SpatialConstants::REP_MOVEMENT_LOCATION_ID), 3);
+		TestEqual("Rotation is left out", (int32)Schema_GetUint64Count(MovementObject, SpatialConstants::REP_MOVEMENT_ROTATION_ID), 0);
+		TestEqual("Linear velocity is left out", (int32)Schema_GetSint32Count(MovementObject, SpatialConstants::REP_MOVEMENT_LINEAR_VELOCITY_ID), 0);
+		TestEqual("Angular velocity is left out", (int32)Schema_GetSint32Count(MovementObject, SpatialConstants::REP_MOVEMENT_ANGULAR_VELOCITY_ID), 0);
+
+		FRepMovement Received;
+		Received.Rotation = FRotator(10.f, 20.f, 30.f);
+		Received.LinearVelocity = FVector(1.f, 2.f, 3.f);
+		CompactRepMovement::Read(ComponentObject, TestFieldId, 0, Received);
+
+		TestTrue("Location is received", Received.Location.Equals(Movement.Location));
+		TestTrue("Missing rotation is read as zero", Received.Rotation.IsNearlyZero());
+		TestTrue("Missing velocity is read as zero", Received.LinearVelocity.IsZero());
+
+		Schema_DestroyComponentData(ComponentData);
+
+		return true;
+	}
+} // namespace SpatialGDK
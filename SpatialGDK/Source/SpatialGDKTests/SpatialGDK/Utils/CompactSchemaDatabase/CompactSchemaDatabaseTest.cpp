@@ -0,0 +1,137 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/CompactSchemaDatabase.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/Paths.h"
+
+#define COMPACTSCHEMADATABASE_TEST(TestName) \
+	GDK_TEST(Core, FCompactSchemaDatabase, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const FString ActorClassPath = TEXT("/Game/Characters/Character.Character_C");
+const FString SubobjectClassPath = TEXT("/Script/Engine.SceneComponent");
+
+USchemaDatabase* CreateTestSchemaDatabase()
+{
+	USchemaDatabase* SchemaDatabase = NewObject<USchemaDatabase>();
+
+	FActorSchemaData ActorSchemaData;
+	ActorSchemaData.GeneratedSchemaName = TEXT("Character");
+	ActorSchemaData.SchemaComponents[SCHEMA_Data] = 10000;
+	ActorSchemaData.SchemaComponents[SCHEMA_OwnerOnly] = 10001;
+
+	FActorSpecificSubobjectSchemaData SubobjectData;
+	SubobjectData.ClassPath = SubobjectClassPath;
+	SubobjectData.Name = FName(TEXT("Root"));
+	SubobjectData.SchemaComponents[SCHEMA_Data] = 10002;
+	ActorSchemaData.SubobjectData.Add(1, SubobjectData);
+	SchemaDatabase->ActorClassPathToSchema.Add(ActorClassPath, ActorSchemaData);
+
+	FSubobjectSchemaData SubobjectSchemaData;
+	SubobjectSchemaData.GeneratedSchemaName = TEXT("SceneComponent");
+	SubobjectSchemaData.DynamicSubobjectComponents.AddDefaulted(2);
+	SubobjectSchemaData.DynamicSubobjectComponents[1].SchemaComponents[SCHEMA_Data] = 10003;
+	SchemaDatabase->SubobjectClassPathToSchema.Add(SubobjectClassPath, SubobjectSchemaData);
+
+	SchemaDatabase->ComponentIdToClassPath.Add(10000, ActorClassPath);
+	SchemaDatabase->ComponentIdToClassPath.Add(10003, SubobjectClassPath);
+	SchemaDatabase->LevelPathToComponentId.Add(TEXT("/Game/Maps/SubLevel"), 10004);
+	SchemaDatabase->LevelComponentIds = { 10004 };
+	SchemaDatabase->DataComponentIds = { 10003, 10000, 10002 };
+	SchemaDatabase->SchemaDescriptorHash = 1234;
+
+	return SchemaDatabase;
+}
+
+FString GetTestFilePath()
+{
+	return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("CompactSchemaDatabaseTest.bin"));
+}
+
+} // anonymous namespace
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_written_compact_schema_database_WHEN_looking_up_classes_THEN_the_schema_data_matches)
+{
+	const FString Filename = GetTestFilePath();
+	TestTrue("Written", FCompactSchemaDatabase::WriteToFile(*CreateTestSchemaDatabase(), Filename));
+
+	FCompactSchemaDatabase CompactSchemaDatabase;
+	TestTrue("Loaded", CompactSchemaDatabase.Load(Filename));
+
+	FActorSchemaData ActorSchemaData;
+	TestTrue("Actor found", CompactSchemaDatabase.FindActorSchema(ActorClassPath, ActorSchemaData));
+	TestEqual("Actor schema name", ActorSchemaData.GeneratedSchemaName, FString(TEXT("Character")));
+	TestEqual("Actor owner only component", ActorSchemaData.SchemaComponents[SCHEMA_OwnerOnly], 10001u);
+	TestTrue("Actor subobject found", ActorSchemaData.SubobjectData.Contains(1));
+	TestEqual("Actor subobject name", ActorSchemaData.SubobjectData.FindRef(1).Name, FName(TEXT("Root")));
+
+	FSubobjectSchemaData SubobjectSchemaData;
+	TestTrue("Subobject found", CompactSchemaDatabase.FindSubobjectSchema(SubobjectClassPath, SubobjectSchemaData));
+	TestEqual("Dynamic subobject component", SubobjectSchemaData.GetDynamicSubobjectComponentId(1, SCHEMA_Data), 10003u);
+
+	FString ClassPath;
+	TestTrue("Component found", CompactSchemaDatabase.FindClassPathForComponentId(10003, ClassPath));
+	TestEqual("Component class path", ClassPath, SubobjectClassPath);
+
+	FActorSchemaData MissingSchemaData;
+	TestFalse("Unknown actor found", CompactSchemaDatabase.FindActorSchema(TEXT("/Game/Unknown.Unknown_C"), MissingSchemaData));
+	TestFalse("Subobject found as actor", CompactSchemaDatabase.FindActorSchema(SubobjectClassPath, MissingSchemaData));
+	TestFalse("Unknown component found", CompactSchemaDatabase.FindClassPathForComponentId(10002, ClassPath));
+
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Filename);
+
+	return true;
+}
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_written_compact_schema_database_WHEN_reading_tables_THEN_component_id_lists_are_sorted)
+{
+	const FString Filename = GetTestFilePath();
+	TestTrue("Written", FCompactSchemaDatabase::WriteToFile(*CreateTestSchemaDatabase(), Filename));
+
+	FCompactSchemaDatabase CompactSchemaDatabase;
+	TestTrue("Loaded", CompactSchemaDatabase.Load(Filename));
+
+	USchemaDatabase* Tables = NewObject<USchemaDatabase>();
+	CompactSchemaDatabase.ReadTables(*Tables);
+
+	TestEqual("Schema hash", Tables->SchemaDescriptorHash, 1234u);
+	TestEqual("Level component", Tables->LevelPathToComponentId.FindRef(TEXT("/Game/Maps/SubLevel")), 10004u);
+	TestTrue("Data component ids sorted", Tables->DataComponentIds == TArray<uint32>({ 10000, 10002, 10003 }));
+	TestEqual("Actor classes are not read with the tables", Tables->ActorClassPathToSchema.Num(), 0);
+
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Filename);
+
+	return true;
+}
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_shared_compact_schema_database_WHEN_the_file_is_written_again_THEN_it_is_loaded_again)
+{
+	const FString Filename = GetTestFilePath();
+	TestTrue("Written", FCompactSchemaDatabase::WriteToFile(*CreateTestSchemaDatabase(), Filename));
+
+	TSharedPtr<const FCompactSchemaDatabase, ESPMode::ThreadSafe> First = FCompactSchemaDatabase::LoadShared(Filename);
+	TestTrue("Loaded", First.IsValid());
+	TestTrue("Shared", FCompactSchemaDatabase::LoadShared(Filename) == First);
+
+	First.Reset();
+	TestTrue("Written again", FCompactSchemaDatabase::WriteToFile(*CreateTestSchemaDatabase(), Filename));
+
+	TSharedPtr<const FCompactSchemaDatabase, ESPMode::ThreadSafe> Second = FCompactSchemaDatabase::LoadShared(Filename);
+	TestTrue("Loaded again", Second.IsValid());
+	FString ClassPath;
+	TestTrue("Component found", Second->FindClassPathForComponentId(10003, ClassPath));
+
+	Second.Reset();
+	FCompactSchemaDatabase::ResetShared();
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Filename);
+
+	return true;
+}
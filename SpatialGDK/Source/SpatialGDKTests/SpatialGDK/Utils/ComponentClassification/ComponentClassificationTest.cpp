@@ -0,0 +1,51 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ComponentClassification.h"
+#include "Utils/SchemaDatabase.h"
+
+#include "CoreMinimal.h"
+
+#define COMPONENTCLASSIFICATION_TEST(TestName) \
+	GDK_TEST(Core, FComponentClassification, TestName)
+
+using namespace SpatialGDK;
+
+COMPONENTCLASSIFICATION_TEST(GIVEN_no_schema_database_WHEN_classifying_reserved_components_THEN_they_have_their_reserved_traits)
+{
+	FComponentClassification Classification;
+
+	TestEqual("Position is a SpatialOS component", Classification.GetTraits(SpatialConstants::POSITION_COMPONENT_ID), (uint16)SpatialConstants::COMPONENT_TRAIT_SpatialSystem);
+	TestTrue("The ACL is a load balancing component", Classification.HasAnyTraits(SpatialConstants::ENTITY_ACL_COMPONENT_ID, SpatialConstants::COMPONENT_TRAIT_LoadBalancing));
+	TestTrue("The server endpoint is an RPC endpoint", Classification.HasAnyTraits(SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID, SpatialConstants::COMPONENT_TRAIT_RPCEndpoint));
+	TestEqual("Heartbeat is a GDK component", Classification.GetTraits(SpatialConstants::HEARTBEAT_COMPONENT_ID), (uint16)SpatialConstants::COMPONENT_TRAIT_GDKOwned);
+	TestEqual("External schema IDs are classified", Classification.GetTraits(SpatialConstants::MIN_EXTERNAL_SCHEMA_ID), (uint16)SpatialConstants::COMPONENT_TRAIT_ExternalSchema);
+	TestEqual("Generated IDs have no traits", Classification.GetTraits(SpatialConstants::STARTING_GENERATED_COMPONENT_ID), (uint16)SpatialConstants::COMPONENT_TRAIT_None);
+
+	return true;
+}
+
+COMPONENTCLASSIFICATION_TEST(GIVEN_schema_database_WHEN_classifying_generated_components_THEN_they_have_the_traits_of_their_lists)
+{
+	USchemaDatabase* SchemaDatabase = NewObject<USchemaDatabase>();
+	SchemaDatabase->DataComponentIds = { 10000, 10003 };
+	SchemaDatabase->OwnerOnlyComponentIds = { 10001 };
+	SchemaDatabase->HandoverComponentIds = { 10002 };
+	SchemaDatabase->LevelComponentIds = { 10004 };
+	SchemaDatabase->NetCullDistanceComponentIds = { 20000 };
+	SchemaDatabase->NextAvailableComponentId = 10005;
+
+	FComponentClassification Classification;
+	Classification.AddGeneratedComponents(*SchemaDatabase);
+
+	TestEqual("Data components are classified", Classification.GetTraits(10003), (uint16)SpatialConstants::COMPONENT_TRAIT_Data);
+	TestEqual("Owner only components are classified", Classification.GetTraits(10001), (uint16)SpatialConstants::COMPONENT_TRAIT_OwnerOnly);
+	TestEqual("Handover components are classified", Classification.GetTraits(10002), (uint16)SpatialConstants::COMPONENT_TRAIT_Handover);
+	TestTrue("Sublevel components are QBI markers", Classification.HasAnyTraits(10004, SpatialConstants::COMPONENT_TRAIT_QBIMarker));
+	TestTrue("IDs past the dense range are classified", Classification.HasAnyTraits(20000, SpatialConstants::COMPONENT_TRAIT_QBIMarker));
+	TestEqual("Reserved components keep their traits", Classification.GetTraits(SpatialConstants::POSITION_COMPONENT_ID), (uint16)SpatialConstants::COMPONENT_TRAIT_SpatialSystem);
+	TestEqual("Unknown IDs have no traits", Classification.GetTraits(30000), (uint16)SpatialConstants::COMPONENT_TRAIT_None);
+
+	return true;
+}
@@ -0,0 +1,52 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "GameFramework/Actor.h"
+#include "Utils/ComponentFactory.h"
+
+#define COMPONENTFACTORY_TEST(TestName) \
+	GDK_TEST(Core, ComponentFactory, TestName)
+
+namespace SpatialGDK
+{
+
+COMPONENTFACTORY_TEST(GIVEN_a_sent_plain_old_data_property_WHEN_writing_it_again_THEN_only_changed_values_are_written)
+{
+	AActor* Actor = NewObject<AActor>();
+	UProperty* Property = AActor::StaticClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(AActor, CustomTimeDilation));
+	const uint16 Handle = 1;
+
+	FLastSentPropertyValues LastSentValues;
+	float Value = 1.f;
+	const uint8* Data = reinterpret_cast<const uint8*>(&Value);
+
+	TestFalse("First write is sent", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, Handle, Property, Data, false));
+	TestTrue("Unchanged write is dropped", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, Handle, Property, Data, false));
+
+	Value = 2.f;
+	TestFalse("Changed write is sent", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, Handle, Property, Data, false));
+	TestTrue("Write unchanged since the change is dropped", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, Handle, Property, Data, false));
+
+	TestFalse("Initial data is always written", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, Handle, Property, Data, true));
+	TestFalse("Same value of another handle is sent", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, Handle + 1, Property, Data, false));
+
+	return true;
+}
+
+COMPONENTFACTORY_TEST(GIVEN_an_object_reference_property_WHEN_writing_the_same_value_THEN_it_is_always_written)
+{
+	AActor* Actor = NewObject<AActor>();
+	UProperty* Property = AActor::StaticClass()->FindPropertyByName(TEXT("Owner"));
+
+	FLastSentPropertyValues LastSentValues;
+	AActor* Owner = nullptr;
+	const uint8* Data = reinterpret_cast<const uint8*>(&Owner);
+
+	TestFalse("First write is sent", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, 1, Property, Data, false));
+	TestFalse("Same reference is sent again", ComponentFactory::IsUnchangedSinceLastSent(LastSentValues, Actor, 1, Property, Data, false));
+
+	return true;
+}
+
+} // namespace SpatialGDK
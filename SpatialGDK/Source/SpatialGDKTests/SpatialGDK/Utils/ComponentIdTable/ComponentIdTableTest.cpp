@@ -0,0 +1,111 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ComponentIdTable.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#define COMPONENTIDTABLE_TEST(TestName) \
+	GDK_TEST(Core, TComponentIdTable, TestName)
+
+#define COMPONENTIDTABLE_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, TComponentIdTable, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const Worker_ComponentId DenseRangeEnd = 10000;
+const int32 DefaultValue = -1;
+
+// A typical mix of updates: mostly generated components, with some GDK components in between.
+TArray<Worker_ComponentId> MakeLookupIds(int32 NumLookups)
+{
+	TArray<Worker_ComponentId> ComponentIds;
+	ComponentIds.Reserve(NumLookups);
+	for (int32 i = 0; i < NumLookups; i++)
+	{
+		ComponentIds.Add(i % 4 == 0 ? 50 + i % 20 : DenseRangeEnd + i % 2000);
+	}
+	return ComponentIds;
+}
+
+} // anonymous namespace
+
+COMPONENTIDTABLE_TEST(GIVEN_values_in_and_outside_the_dense_range_WHEN_looked_up_THEN_each_value_is_found)
+{
+	TComponentIdTable<int32> Table(DenseRangeEnd, DefaultValue);
+	Table.Add(54, 1);
+	Table.Add(DenseRangeEnd + 1, 2);
+
+	TestEqual(TEXT("Dense value"), Table.Find(54), 1);
+	TestEqual(TEXT("Sparse value"), Table.Find(DenseRangeEnd + 1), 2);
+
+	return true;
+}
+
+COMPONENTIDTABLE_TEST(GIVEN_an_id_that_was_never_added_WHEN_looked_up_THEN_the_default_value_is_returned)
+{
+	TComponentIdTable<int32> Table(DenseRangeEnd, DefaultValue);
+	Table.Add(DenseRangeEnd + 1, 2);
+
+	TestEqual(TEXT("Missing dense value"), Table.Find(1), DefaultValue);
+	TestEqual(TEXT("Missing sparse value"), Table.Find(DenseRangeEnd + 2), DefaultValue);
+
+	return true;
+}
+
+COMPONENTIDTABLE_TEST(GIVEN_a_dense_range_WHEN_individual_ids_are_added_afterwards_THEN_they_override_the_range)
+{
+	TComponentIdTable<int32> Table(DenseRangeEnd, DefaultValue);
+	Table.AddDenseRange(0, 100, 3);
+	Table.Add(54, 1);
+
+	TestEqual(TEXT("Overridden value"), Table.Find(54), 1);
+	TestEqual(TEXT("Range value"), Table.Find(99), 3);
+	TestEqual(TEXT("Past the range"), Table.Find(100), DefaultValue);
+
+	return true;
+}
+
+COMPONENTIDTABLE_BENCHMARK(GIVEN_a_mix_of_component_ids_WHEN_looked_up_THEN_the_table_is_not_slower_than_a_map)
+{
+	const int32 NumLookups = 1000000;
+	const TArray<Worker_ComponentId> ComponentIds = MakeLookupIds(NumLookups);
+
+	TComponentIdTable<int32> Table(DenseRangeEnd, DefaultValue);
+	TMap<Worker_ComponentId, int32> Map;
+	for (Worker_ComponentId ComponentId = 50; ComponentId < 70; ComponentId++)
+	{
+		Table.Add(ComponentId, ComponentId);
+		Map.Add(ComponentId, ComponentId);
+	}
+
+	int64 TableSum = 0;
+	const double TableStartTime = FPlatformTime::Seconds();
+	for (const Worker_ComponentId ComponentId : ComponentIds)
+	{
+		TableSum += Table.Find(ComponentId);
+	}
+	const double TableTime = FPlatformTime::Seconds() - TableStartTime;
+
+	int64 MapSum = 0;
+	const double MapStartTime = FPlatformTime::Seconds();
+	for (const Worker_ComponentId ComponentId : ComponentIds)
+	{
+		const int32* Value = Map.Find(ComponentId);
+		MapSum += Value != nullptr ? *Value : DefaultValue;
+	}
+	const double MapTime = FPlatformTime::Seconds() - MapStartTime;
+
+	AddInfo(FString::Printf(TEXT("Table: %.2f ns per lookup, map: %.2f ns per lookup"), TableTime / NumLookups * 1e9, MapTime / NumLookups * 1e9));
+
+	TestEqual(TEXT("Both find the same values"), TableSum, MapSum);
+	// Leave headroom for noise, the table is usually several times faster.
+	TestTrue(TEXT("Table lookups are not slower than map lookups"), TableTime < MapTime * 1.5);
+
+	return true;
+}
@@ -0,0 +1,91 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/CompressedBytes.h"
+
+#include "CoreMinimal.h"
+
+#define COMPRESSEDBYTES_TEST(TestName) \
+	GDK_TEST(Core, CompressedBytes, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const Schema_FieldId TestFieldId = 1;
+const uint32 MinCompressedSize = 64;
+
+TArray<uint8> MakeRepetitiveBytes(int32 NumBytes)
+{
+	TArray<uint8> Bytes;
+	for (int32 i = 0; i < NumBytes; i++)
+	{
+		Bytes.Add(static_cast<uint8>(i % 4));
+	}
+	return Bytes;
+}
+
+} // anonymous namespace
+
+COMPRESSEDBYTES_TEST(GIVEN_a_large_repetitive_value_WHEN_added_THEN_it_is_compressed_and_reads_back_unchanged)
+{
+	const TArray<uint8> Value = MakeRepetitiveBytes(1024);
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Object = Schema_GetComponentDataFields(Data);
+	AddCompressibleBytesToSchema(Object, TestFieldId, Value.GetData(), Value.Num(), MinCompressedSize);
+
+	TestTrue("Value was compressed", Schema_GetBytesLength(Object, TestFieldId) < static_cast<uint32>(Value.Num()));
+	TestEqual("Encoding", Schema_GetBytes(Object, TestFieldId)[0], static_cast<uint8>(ECompressedBytesEncoding::LZ4));
+
+	TArray<uint8> Scratch;
+	const uint8* ReadData = nullptr;
+	uint32 ReadNumBytes = 0;
+	TestTrue("Value was read", IndexCompressibleBytesFromSchema(Object, TestFieldId, 0, Scratch, ReadData, ReadNumBytes));
+	TestEqual("Read size", ReadNumBytes, static_cast<uint32>(Value.Num()));
+	TestTrue("Read value matches", ReadNumBytes == static_cast<uint32>(Value.Num()) && FMemory::Memcmp(ReadData, Value.GetData(), Value.Num()) == 0);
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+COMPRESSEDBYTES_TEST(GIVEN_a_value_below_the_threshold_WHEN_added_THEN_it_is_sent_raw)
+{
+	const TArray<uint8> Value = MakeRepetitiveBytes(MinCompressedSize - 1);
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Object = Schema_GetComponentDataFields(Data);
+	AddCompressibleBytesToSchema(Object, TestFieldId, Value.GetData(), Value.Num(), MinCompressedSize);
+
+	TestEqual("Encoding", Schema_GetBytes(Object, TestFieldId)[0], static_cast<uint8>(ECompressedBytesEncoding::Raw));
+	TestEqual("Stored size", Schema_GetBytesLength(Object, TestFieldId), static_cast<uint32>(Value.Num() + 1));
+
+	TArray<uint8> Scratch;
+	const uint8* ReadData = nullptr;
+	uint32 ReadNumBytes = 0;
+	TestTrue("Value was read", IndexCompressibleBytesFromSchema(Object, TestFieldId, 0, Scratch, ReadData, ReadNumBytes));
+	TestTrue("Read value matches", ReadNumBytes == static_cast<uint32>(Value.Num()) && FMemory::Memcmp(ReadData, Value.GetData(), Value.Num()) == 0);
+	TestEqual("Raw values aren't copied", Scratch.Num(), 0);
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+COMPRESSEDBYTES_TEST(GIVEN_a_value_without_an_encoding_WHEN_read_THEN_it_is_rejected)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Object = Schema_GetComponentDataFields(Data);
+	const uint8 Malformed[] = { 0xFF, 1, 2, 3 };
+	Schema_AddBytes(Object, TestFieldId, Malformed, sizeof(Malformed));
+
+	TArray<uint8> Scratch;
+	const uint8* ReadData = nullptr;
+	uint32 ReadNumBytes = 0;
+	AddExpectedError(TEXT("Failed to decode compressible bytes field"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse("Value was rejected", IndexCompressibleBytesFromSchema(Object, TestFieldId, 0, Scratch, ReadData, ReadNumBytes));
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
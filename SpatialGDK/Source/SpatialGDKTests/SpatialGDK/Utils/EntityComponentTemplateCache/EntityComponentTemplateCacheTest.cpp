@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Schema/UnrealMetadata.h"
+#include "Utils/EntityComponentTemplateCache.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#define ENTITYCOMPONENTTEMPLATECACHE_TEST(TestName) \
+	GDK_TEST(Core, FEntityComponentTemplateCache, TestName)
+
+using namespace SpatialGDK;
+
+ENTITYCOMPONENTTEMPLATECACHE_TEST(GIVEN_a_cached_template_WHEN_copied_twice_THEN_the_template_is_only_created_once)
+{
+	FEntityComponentTemplateCache TemplateCache;
+	const UClass* Class = AActor::StaticClass();
+
+	int32 NumTemplatesCreated = 0;
+	auto CreateTemplate = [Class, &NumTemplatesCreated]()
+	{
+		NumTemplatesCreated++;
+		return UnrealMetadata({}, Class->GetPathName(), {}).CreateUnrealMetadataData();
+	};
+
+	FWorkerComponentData FirstCopy = TemplateCache.CopyTemplate(Class, SpatialConstants::UNREAL_METADATA_COMPONENT_ID, CreateTemplate);
+	FWorkerComponentData SecondCopy = TemplateCache.CopyTemplate(Class, SpatialConstants::UNREAL_METADATA_COMPONENT_ID, CreateTemplate);
+
+	TestEqual("The template was created once", NumTemplatesCreated, 1);
+	TestEqual("One copy hit the cache", TemplateCache.GetNumHits(), static_cast<uint64>(1));
+	TestTrue("Each copy owns its own data", FirstCopy.schema_type != SecondCopy.schema_type);
+	TestEqual("The copy has the class path of the template", UnrealMetadata(SecondCopy).ClassPath, Class->GetPathName());
+
+	Schema_DestroyComponentData(FirstCopy.schema_type);
+	Schema_DestroyComponentData(SecondCopy.schema_type);
+
+	return true;
+}
+
+ENTITYCOMPONENTTEMPLATECACHE_TEST(GIVEN_a_copied_template_WHEN_instance_fields_are_added_THEN_they_are_only_in_the_copy)
+{
+	FEntityComponentTemplateCache TemplateCache;
+	const UClass* Class = AActor::StaticClass();
+
+	auto CreateTemplate = [Class]()
+	{
+		return UnrealMetadata({}, Class->GetPathName(), {}).CreateUnrealMetadataData();
+	};
+
+	FWorkerComponentData PatchedCopy = TemplateCache.CopyTemplate(Class, SpatialConstants::UNREAL_METADATA_COMPONENT_ID, CreateTemplate);
+	UnrealMetadata::AddInstanceFields(Schema_GetComponentDataFields(PatchedCopy.schema_type), {}, true);
+
+	FWorkerComponentData PlainCopy = TemplateCache.CopyTemplate(Class, SpatialConstants::UNREAL_METADATA_COMPONENT_ID, CreateTemplate);
+
+	const UnrealMetadata PatchedMetadata(PatchedCopy);
+	const UnrealMetadata PlainMetadata(PlainCopy);
+
+	TestTrue("The patched copy has bNetStartup set", PatchedMetadata.bNetStartup.IsSet() && PatchedMetadata.bNetStartup.GetValue());
+	TestEqual("The patched copy keeps the class path", PatchedMetadata.ClassPath, Class->GetPathName());
+	TestFalse("The template was not modified", PlainMetadata.bNetStartup.IsSet());
+
+	Schema_DestroyComponentData(PatchedCopy.schema_type);
+	Schema_DestroyComponentData(PlainCopy.schema_type);
+
+	return true;
+}
@@ -0,0 +1,84 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/EntityCreationLimiter.h"
+
+#include "CoreMinimal.h"
+
+#define ENTITYCREATIONLIMITER_TEST(TestName) \
+	GDK_TEST(Core, FEntityCreationLimiter, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const double TargetLatency = 1.0;
+
+// Sends and answers a full limit's worth of requests, Latency seconds after they were sent.
+void RunRoundTrip(FEntityCreationLimiter& Limiter, Worker_RequestId& NextRequestId, double& Time, double Latency, Worker_StatusCode StatusCode)
+{
+	const Worker_RequestId FirstRequestId = NextRequestId;
+	const int32 NumRequests = Limiter.GetLimit();
+	for (int32 i = 0; i < NumRequests; i++)
+	{
+		Limiter.OnRequestSent(NextRequestId++, Time);
+	}
+
+	Time += Latency;
+	for (Worker_RequestId RequestId = FirstRequestId; RequestId < NextRequestId; RequestId++)
+	{
+		Limiter.OnResponse(RequestId, StatusCode, Time);
+	}
+}
+
+} // anonymous namespace
+
+ENTITYCREATIONLIMITER_TEST(GIVEN_fast_responses_WHEN_a_round_trip_completes_THEN_the_limit_grows_by_one)
+{
+	FEntityCreationLimiter Limiter(INT32_MAX, TargetLatency);
+	Worker_RequestId NextRequestId = 1;
+	double Time = 0.0;
+
+	RunRoundTrip(Limiter, NextRequestId, Time, TargetLatency * 0.5, WORKER_STATUS_CODE_SUCCESS);
+
+	TestEqual("The limit grew by one", Limiter.GetLimit(), FEntityCreationLimiter::InitialLimit + 1);
+	TestEqual("No requests are in flight", Limiter.GetNumInFlight(), 0);
+
+	return true;
+}
+
+ENTITYCREATIONLIMITER_TEST(GIVEN_a_burst_of_timeouts_WHEN_responses_arrive_THEN_the_limit_halves_once)
+{
+	FEntityCreationLimiter Limiter(INT32_MAX, TargetLatency);
+	Worker_RequestId NextRequestId = 1;
+	double Time = 0.0;
+
+	RunRoundTrip(Limiter, NextRequestId, Time, TargetLatency * 0.5, WORKER_STATUS_CODE_TIMEOUT);
+
+	TestEqual("The limit halved", Limiter.GetLimit(), FEntityCreationLimiter::InitialLimit / 2);
+
+	RunRoundTrip(Limiter, NextRequestId, Time, TargetLatency * 2.0, WORKER_STATUS_CODE_SUCCESS);
+
+	TestEqual("Slow responses to requests sent after the decrease halve it again", Limiter.GetLimit(), FEntityCreationLimiter::InitialLimit / 4);
+
+	return true;
+}
+
+ENTITYCREATIONLIMITER_TEST(GIVEN_a_max_limit_WHEN_responses_are_fast_THEN_the_limit_does_not_exceed_it)
+{
+	const int32 MaxLimit = FEntityCreationLimiter::InitialLimit + 2;
+	FEntityCreationLimiter Limiter(MaxLimit, TargetLatency);
+	Worker_RequestId NextRequestId = 1;
+	double Time = 0.0;
+
+	for (int32 i = 0; i < 10; i++)
+	{
+		RunRoundTrip(Limiter, NextRequestId, Time, TargetLatency * 0.5, WORKER_STATUS_CODE_SUCCESS);
+	}
+
+	TestEqual("The limit is capped", Limiter.GetLimit(), MaxLimit);
+
+	return true;
+}
@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/EntityObjectRefTable.h"
+
+#include "CoreMinimal.h"
+
+#define ENTITYOBJECTREFTABLE_TEST(TestName) \
+	GDK_TEST(Core, FEntityObjectRefTable, TestName)
+
+using namespace SpatialGDK;
+
+ENTITYOBJECTREFTABLE_TEST(GIVEN_an_empty_table_WHEN_finding_THEN_nothing_is_found)
+{
+	FEntityObjectRefTable Table;
+
+	TestNull("Found NetGUID", Table.Find(1, 0));
+	TestEqual("Number of entries", Table.Num(), 0);
+
+	return true;
+}
+
+ENTITYOBJECTREFTABLE_TEST(GIVEN_added_entries_WHEN_finding_THEN_entity_id_and_offset_are_both_matched)
+{
+	FEntityObjectRefTable Table;
+
+	Table.Add(1, 0, FNetworkGUID(10));
+	Table.Add(1, 2, FNetworkGUID(12));
+	Table.Add(2, 0, FNetworkGUID(20));
+
+	TestTrue("Actor ref found", Table.Find(1, 0) != nullptr && *Table.Find(1, 0) == FNetworkGUID(10));
+	TestTrue("Subobject ref found", Table.Find(1, 2) != nullptr && *Table.Find(1, 2) == FNetworkGUID(12));
+	TestTrue("Other entity found", Table.Find(2, 0) != nullptr && *Table.Find(2, 0) == FNetworkGUID(20));
+	TestNull("Unknown offset found", Table.Find(2, 2));
+
+	return true;
+}
+
+ENTITYOBJECTREFTABLE_TEST(GIVEN_an_existing_entry_WHEN_adding_it_again_THEN_the_net_guid_is_replaced)
+{
+	FEntityObjectRefTable Table;
+
+	Table.Add(1, 0, FNetworkGUID(10));
+	Table.Add(1, 0, FNetworkGUID(11));
+
+	TestEqual("Number of entries", Table.Num(), 1);
+	TestTrue("NetGUID replaced", *Table.Find(1, 0) == FNetworkGUID(11));
+
+	return true;
+}
+
+ENTITYOBJECTREFTABLE_TEST(GIVEN_many_entries_WHEN_removing_half_of_them_THEN_the_rest_are_still_found)
+{
+	FEntityObjectRefTable Table;
+
+	const int32 NumEntities = 1000;
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		Table.Add(EntityId, 0, FNetworkGUID(static_cast<uint32>(EntityId)));
+	}
+
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId += 2)
+	{
+		TestTrue("Entry removed", Table.Remove(EntityId, 0));
+	}
+
+	TestEqual("Number of entries", Table.Num(), NumEntities / 2);
+	TestFalse("Removed entry removed again", Table.Remove(1, 0));
+
+	bool bAllFound = true;
+	for (Worker_EntityId EntityId = 2; EntityId <= NumEntities; EntityId += 2)
+	{
+		const FNetworkGUID* NetGUID = Table.Find(EntityId, 0);
+		bAllFound &= NetGUID != nullptr && *NetGUID == FNetworkGUID(static_cast<uint32>(EntityId));
+		bAllFound &= Table.Find(EntityId - 1, 0) == nullptr;
+	}
+	TestTrue("Remaining entries found and removed entries not found", bAllFound);
+
+	return true;
+}
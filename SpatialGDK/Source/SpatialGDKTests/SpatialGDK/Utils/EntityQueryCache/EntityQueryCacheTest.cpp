@@ -0,0 +1,112 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialConstants.h"
+#include "Utils/EntityQueryCache.h"
+
+#include "CoreMinimal.h"
+
+#define ENTITYQUERYCACHE_TEST(TestName) \
+	GDK_TEST(Core, FEntityQueryCache, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+Worker_EntityQuery MakeComponentQuery(Worker_Constraint& OutConstraint, Worker_ComponentId ComponentId)
+{
+	OutConstraint = {};
+	OutConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
+	OutConstraint.constraint.component_constraint.component_id = ComponentId;
+
+	Worker_EntityQuery Query{};
+	Query.constraint = OutConstraint;
+	Query.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+	return Query;
+}
+
+Worker_EntityQueryResponseOp MakeResponse(Worker_RequestId RequestId, Worker_Entity* Entities, uint32 NumEntities)
+{
+	Worker_EntityQueryResponseOp Op{};
+	Op.request_id = RequestId;
+	Op.status_code = WORKER_STATUS_CODE_SUCCESS;
+	Op.message = "";
+	Op.result_count = NumEntities;
+	Op.results = Entities;
+	return Op;
+}
+
+EntityQueryDelegate MakeRecordingDelegate(TArray<Worker_EntityId>& OutEntityIds)
+{
+	EntityQueryDelegate Delegate;
+	Delegate.BindLambda([&OutEntityIds](const Worker_EntityQueryResponseOp& Op)
+	{
+		for (uint32 i = 0; i < Op.result_count; i++)
+		{
+			OutEntityIds.Add(Op.results[i].entity_id);
+		}
+	});
+	return Delegate;
+}
+
+} // anonymous namespace
+
+ENTITYQUERYCACHE_TEST(GIVEN_queries_for_the_same_and_different_components_WHEN_getting_their_keys_THEN_only_identical_queries_share_a_key)
+{
+	Worker_Constraint FirstConstraint, SecondConstraint, OtherConstraint;
+	const Worker_EntityQuery First = MakeComponentQuery(FirstConstraint, SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID);
+	const Worker_EntityQuery Second = MakeComponentQuery(SecondConstraint, SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID);
+	const Worker_EntityQuery Other = MakeComponentQuery(OtherConstraint, SpatialConstants::PLAYER_SPAWNER_COMPONENT_ID);
+
+	TestEqual("Identical queries share a key", FEntityQueryCache::GetQueryKey(First), FEntityQueryCache::GetQueryKey(Second));
+	TestNotEqual("Different queries have different keys", FEntityQueryCache::GetQueryKey(First), FEntityQueryCache::GetQueryKey(Other));
+
+	return true;
+}
+
+ENTITYQUERYCACHE_TEST(GIVEN_identical_query_in_flight_WHEN_response_received_THEN_all_delegates_are_executed)
+{
+	FEntityQueryCache Cache;
+	TArray<Worker_EntityId> FirstResults, SecondResults;
+
+	TestFalse("No query is in flight", Cache.AddToInFlightQuery(TEXT("Key"), MakeRecordingDelegate(FirstResults), 0.0));
+	Cache.OnQuerySent(TEXT("Key"), 1, MakeRecordingDelegate(FirstResults), 0.0);
+	TestTrue("The second delegate is added to the query in flight", Cache.AddToInFlightQuery(TEXT("Key"), MakeRecordingDelegate(SecondResults), 0.0));
+
+	Worker_Entity Entity{};
+	Entity.entity_id = 5;
+	TestTrue("The response is handled", Cache.OnQueryResponse(MakeResponse(1, &Entity, 1), 0.0));
+	TestFalse("Other responses aren't handled", Cache.OnQueryResponse(MakeResponse(2, nullptr, 0), 0.0));
+
+	TestTrue("The first delegate received the result", FirstResults.Num() == 1 && FirstResults[0] == 5);
+	TestTrue("The second delegate received the result", SecondResults.Num() == 1 && SecondResults[0] == 5);
+	TestEqual("Responses aren't cached without a lifetime", Cache.GetNumCachedResponses(), 0);
+
+	return true;
+}
+
+ENTITYQUERYCACHE_TEST(GIVEN_cached_response_WHEN_queued_within_and_after_its_lifetime_THEN_it_is_only_reused_within_its_lifetime)
+{
+	FEntityQueryCache Cache;
+	TArray<Worker_EntityId> Results;
+
+	Cache.OnQuerySent(TEXT("Key"), 1, EntityQueryDelegate(), 10.0);
+
+	Worker_Entity Entity{};
+	Entity.entity_id = 7;
+	Cache.OnQueryResponse(MakeResponse(1, &Entity, 1), 100.0);
+	TestEqual("The response is cached", Cache.GetNumCachedResponses(), 1);
+
+	TestTrue("A recent response is reused", Cache.QueueCachedResponse(TEXT("Key"), 10.0, 105.0, MakeRecordingDelegate(Results)));
+	TestEqual("Cached responses are only delivered when queued delegates are executed", Results.Num(), 0);
+	Cache.ExecuteQueuedDelegates();
+	TestTrue("The delegate received the cached result", Results.Num() == 1 && Results[0] == 7);
+
+	TestFalse("A response older than the requested age isn't reused", Cache.QueueCachedResponse(TEXT("Key"), 2.0, 105.0, MakeRecordingDelegate(Results)));
+	TestFalse("An expired response isn't reused", Cache.QueueCachedResponse(TEXT("Key"), 100.0, 111.0, MakeRecordingDelegate(Results)));
+	TestEqual("The expired response is removed", Cache.GetNumCachedResponses(), 0);
+
+	return true;
+}
@@ -0,0 +1,101 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/GeneratedSerializers.h"
+#include "Utils/ReplicationPlan.h"
+
+#include "GameFramework/Actor.h"
+#include "Net/RepLayout.h"
+
+#define GENERATEDSERIALIZERS_TEST(TestName) \
+	GDK_TEST(Core, FGeneratedSerializerRegistry, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+void WriteStub(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+{
+}
+
+void ReadStub(UProperty* Property, Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, uint8* Data)
+{
+}
+
+// A generated serializer of the property with the first rep handle.
+FGeneratedPropertySerializer CreateFirstPropertySerializer(const TCHAR* PropertyName, const TCHAR* PropertyClassName)
+{
+	return FGeneratedPropertySerializer{ 1, PropertyName, PropertyClassName, &WriteStub, &ReadStub };
+}
+
+UProperty* GetFirstProperty(const FRepLayout& RepLayout, int32& OutCmdIndex)
+{
+	OutCmdIndex = RepLayout.BaseHandleToCmdIndex[0].CmdIndex;
+	return RepLayout.Cmds[OutCmdIndex].Property;
+}
+
+} // anonymous namespace
+
+GENERATEDSERIALIZERS_TEST(GIVEN_generated_serializers_matching_the_rep_layout_WHEN_applied_THEN_they_replace_the_plan_entries)
+{
+	UClass* Class = AActor::StaticClass();
+	TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(Class, nullptr, ECreateRepLayoutFlags::None);
+
+	int32 CmdIndex = INDEX_NONE;
+	const UProperty* Property = GetFirstProperty(*RepLayout, CmdIndex);
+	const FString PropertyName = Property->GetName();
+	const FString PropertyClassName = Property->GetClass()->GetName();
+	const FString ClassPath = Class->GetPathName();
+	const FGeneratedPropertySerializer Serializers[] = { CreateFirstPropertySerializer(*PropertyName, *PropertyClassName) };
+	FGeneratedSerializerRegistration Registration(*ClassPath, MakeArrayView(Serializers));
+
+	TArray<FReplicationPlanEntry> ReplicationPlan = CompileReplicationPlan(*RepLayout);
+	const bool bApplied = FGeneratedSerializerRegistry::Get().ApplyToReplicationPlan(*Class, *RepLayout, ReplicationPlan);
+
+	TestTrue("The generated serializers were applied", bApplied);
+	TestTrue("The generated write function is used", ReplicationPlan[CmdIndex].Write == &WriteStub);
+	TestTrue("The generated read function is used", ReplicationPlan[CmdIndex].Read == &ReadStub);
+
+	return true;
+}
+
+GENERATEDSERIALIZERS_TEST(GIVEN_generated_serializers_for_a_class_that_changed_WHEN_applied_THEN_the_runtime_plan_is_kept)
+{
+	UClass* Class = AActor::StaticClass();
+	TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(Class, nullptr, ECreateRepLayoutFlags::None);
+
+	int32 CmdIndex = INDEX_NONE;
+	const UProperty* Property = GetFirstProperty(*RepLayout, CmdIndex);
+	const FString PropertyName = Property->GetName();
+	const FString ClassPath = Class->GetPathName();
+	// As if the property's type changed since the serializers were generated.
+	const FGeneratedPropertySerializer Serializers[] = { CreateFirstPropertySerializer(*PropertyName, TEXT("NotThePropertyClass")) };
+	FGeneratedSerializerRegistration Registration(*ClassPath, MakeArrayView(Serializers));
+
+	AddExpectedError(TEXT("don't match its replicated property"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	const TArray<FReplicationPlanEntry> RuntimeReplicationPlan = CompileReplicationPlan(*RepLayout);
+	TArray<FReplicationPlanEntry> ReplicationPlan = RuntimeReplicationPlan;
+	const bool bApplied = FGeneratedSerializerRegistry::Get().ApplyToReplicationPlan(*Class, *RepLayout, ReplicationPlan);
+
+	TestFalse("The generated serializers were not applied", bApplied);
+	TestTrue("The runtime write function is kept", ReplicationPlan[CmdIndex].Write == RuntimeReplicationPlan[CmdIndex].Write);
+	TestTrue("The runtime read function is kept", ReplicationPlan[CmdIndex].Read == RuntimeReplicationPlan[CmdIndex].Read);
+
+	return true;
+}
+
+GENERATEDSERIALIZERS_TEST(GIVEN_no_generated_serializers_for_a_class_WHEN_applied_THEN_the_runtime_plan_is_kept)
+{
+	UClass* Class = AActor::StaticClass();
+	TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(Class, nullptr, ECreateRepLayoutFlags::None);
+
+	TArray<FReplicationPlanEntry> ReplicationPlan = CompileReplicationPlan(*RepLayout);
+	const bool bApplied = FGeneratedSerializerRegistry::Get().ApplyToReplicationPlan(*Class, *RepLayout, ReplicationPlan);
+
+	TestFalse("Nothing was applied", bApplied);
+
+	return true;
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetConnection.h"
+#include "Utils/HeartbeatManager.h"
+
+#include "CoreMinimal.h"
+
+#define HEARTBEATMANAGER_TEST(TestName) \
+	GDK_TEST(Core, FHeartbeatManager, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const double TestTimeoutSeconds = 10.0;
+
+} // anonymous namespace
+
+HEARTBEATMANAGER_TEST(GIVEN_a_connection_without_heartbeats_WHEN_the_timeout_passes_THEN_it_is_returned_once)
+{
+	FHeartbeatManager HeartbeatManager(TestTimeoutSeconds);
+	USpatialNetConnection* Connection = NewObject<USpatialNetConnection>();
+	HeartbeatManager.AddConnection(Connection, 0.0);
+
+	TestEqual(TEXT("Not timed out before the timeout"), HeartbeatManager.RemoveTimedOutConnections(5.0).Num(), 0);
+
+	TArray<USpatialNetConnection*> TimedOutConnections = HeartbeatManager.RemoveTimedOutConnections(11.0);
+	TestEqual(TEXT("One connection timed out"), TimedOutConnections.Num(), 1);
+	TestTrue(TEXT("The added connection timed out"), TimedOutConnections.Num() == 1 && TimedOutConnections[0] == Connection);
+	TestEqual(TEXT("Timed out connection is no longer tracked"), HeartbeatManager.GetNumConnections(), 0);
+	TestEqual(TEXT("Not returned again"), HeartbeatManager.RemoveTimedOutConnections(30.0).Num(), 0);
+
+	return true;
+}
+
+HEARTBEATMANAGER_TEST(GIVEN_a_connection_WHEN_it_sends_heartbeats_THEN_it_does_not_time_out)
+{
+	FHeartbeatManager HeartbeatManager(TestTimeoutSeconds);
+	USpatialNetConnection* Connection = NewObject<USpatialNetConnection>();
+	USpatialNetConnection* SilentConnection = NewObject<USpatialNetConnection>();
+	HeartbeatManager.AddConnection(Connection, 0.0);
+	HeartbeatManager.AddConnection(SilentConnection, 0.0);
+
+	HeartbeatManager.OnHeartbeat(Connection, 8.0);
+
+	TArray<USpatialNetConnection*> TimedOutConnections = HeartbeatManager.RemoveTimedOutConnections(12.0);
+	TestTrue(TEXT("Only the silent connection timed out"), TimedOutConnections.Num() == 1 && TimedOutConnections[0] == SilentConnection);
+	TestEqual(TEXT("Connection sending heartbeats is still tracked"), HeartbeatManager.GetNumConnections(), 1);
+
+	return true;
+}
+
+HEARTBEATMANAGER_TEST(GIVEN_connections_WHEN_one_is_removed_THEN_only_the_others_time_out)
+{
+	FHeartbeatManager HeartbeatManager(TestTimeoutSeconds);
+	USpatialNetConnection* FirstConnection = NewObject<USpatialNetConnection>();
+	USpatialNetConnection* SecondConnection = NewObject<USpatialNetConnection>();
+	USpatialNetConnection* ThirdConnection = NewObject<USpatialNetConnection>();
+	HeartbeatManager.AddConnection(FirstConnection, 0.0);
+	HeartbeatManager.AddConnection(SecondConnection, 0.0);
+	HeartbeatManager.AddConnection(ThirdConnection, 5.0);
+
+	HeartbeatManager.RemoveConnection(FirstConnection);
+	// Heartbeats for a removed connection are ignored.
+	HeartbeatManager.OnHeartbeat(FirstConnection, 20.0);
+	TestEqual(TEXT("Two connections tracked"), HeartbeatManager.GetNumConnections(), 2);
+
+	TArray<USpatialNetConnection*> TimedOutConnections = HeartbeatManager.RemoveTimedOutConnections(12.0);
+	TestTrue(TEXT("Only the second connection timed out"), TimedOutConnections.Num() == 1 && TimedOutConnections[0] == SecondConnection);
+
+	TimedOutConnections = HeartbeatManager.RemoveTimedOutConnections(16.0);
+	TestTrue(TEXT("Third connection timed out after the moved entry kept its time"), TimedOutConnections.Num() == 1 && TimedOutConnections[0] == ThirdConnection);
+
+	return true;
+}
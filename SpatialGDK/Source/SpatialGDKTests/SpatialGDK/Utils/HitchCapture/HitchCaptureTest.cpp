@@ -0,0 +1,80 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/HitchCapture.h"
+
+#define HITCH_CAPTURE_TEST(TestName) \
+	GDK_TEST(Core, HitchCapture, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		Worker_Op MakeComponentUpdateOp(Worker_ComponentId ComponentId)
+		{
+			Worker_Op Op = {};
+			Op.op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+			Op.op.component_update.update.component_id = ComponentId;
+			return Op;
+		}
+	} // anonymous namespace
+
+	HITCH_CAPTURE_TEST(GIVEN_more_frames_than_capacity_WHEN_frames_end_THEN_only_latest_frames_are_kept_in_order)
+	{
+		FHitchCapture Capture(3, 100.f, 0.f);
+
+		for (uint64 Frame = 1; Frame <= 5; Frame++)
+		{
+			Capture.EndFrame(Frame, 0.016f, FHitchCaptureTotals(), 0.0);
+		}
+
+		TArray<const FHitchCaptureFrame*> Frames = Capture.GetFrames();
+		TestEqual("Only the capacity is kept", Frames.Num(), 3);
+		TestEqual("Oldest kept frame", Frames[0]->FrameNumber, (uint64)3);
+		TestEqual("Newest frame", Frames[2]->FrameNumber, (uint64)5);
+
+		return true;
+	}
+
+	HITCH_CAPTURE_TEST(GIVEN_ops_and_totals_WHEN_frame_ends_THEN_frame_has_per_frame_counts)
+	{
+		FHitchCapture Capture(4, 100.f, 0.f);
+
+		FHitchCaptureTotals Totals;
+		Totals.RPCsSent = 10;
+		Capture.EndFrame(1, 0.016f, Totals, 0.0);
+
+		Worker_Op AddEntityOp = {};
+		AddEntityOp.op_type = WORKER_OP_TYPE_ADD_ENTITY;
+		Capture.RecordOp(AddEntityOp);
+		Capture.RecordOp(MakeComponentUpdateOp(1000));
+		Capture.RecordOp(MakeComponentUpdateOp(1000));
+		Capture.RecordOp(MakeComponentUpdateOp(1001));
+
+		Totals.RPCsSent = 14;
+		Totals.OutgoingMessageQueueDepth = 7;
+		Capture.EndFrame(2, 0.016f, Totals, 0.0);
+
+		const FHitchCaptureFrame& Frame = *Capture.GetFrames().Last();
+		TestEqual("Add entity ops", Frame.AddEntityOps, 1u);
+		TestEqual("Component update ops", Frame.ComponentUpdateOps, 3u);
+		TestEqual("Ops on the busiest component", Frame.OpsByComponent.FindRef(1000), 2u);
+		TestEqual("RPCs sent during the frame", Frame.RPCsSent, 4u);
+		TestEqual("Queue depth at the end of the frame", Frame.OutgoingMessageQueueDepth, 7u);
+
+		return true;
+	}
+
+	HITCH_CAPTURE_TEST(GIVEN_repeated_hitches_WHEN_frames_end_THEN_hitches_are_reported_at_most_once_per_interval)
+	{
+		FHitchCapture Capture(4, 100.f, 10.f);
+
+		TestFalse("A normal frame is not a hitch", Capture.EndFrame(1, 0.05f, FHitchCaptureTotals(), 1.0));
+		TestTrue("A slow frame is a hitch", Capture.EndFrame(2, 0.2f, FHitchCaptureTotals(), 2.0));
+		TestFalse("A second hitch within the interval is not reported", Capture.EndFrame(3, 0.2f, FHitchCaptureTotals(), 5.0));
+		TestTrue("A hitch after the interval is reported", Capture.EndFrame(4, 0.2f, FHitchCaptureTotals(), 12.0));
+
+		return true;
+	}
+} // namespace SpatialGDK
@@ -0,0 +1,73 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/HotEntityTracker.h"
+
+#define HOT_ENTITY_TRACKER_TEST(TestName) \
+	GDK_TEST(Core, HotEntityTracker, TestName)
+
+namespace SpatialGDK
+{
+	HOT_ENTITY_TRACKER_TEST(GIVEN_records_within_window_WHEN_rate_is_read_THEN_rate_is_averaged_over_window)
+	{
+		FHotEntityTracker Tracker(5.f);
+
+		for (int32 i = 0; i < 50; i++)
+		{
+			Tracker.Record(1, EHotEntityCounter::OutgoingUpdates, 100.0 + i * 0.1);
+		}
+
+		TestEqual("50 updates over a 5 second window", Tracker.GetRate(1, EHotEntityCounter::OutgoingUpdates, 104.95), 10.f);
+		TestEqual("Other counters are unaffected", Tracker.GetRate(1, EHotEntityCounter::OutgoingRPCs, 104.95), 0.f);
+
+		return true;
+	}
+
+	HOT_ENTITY_TRACKER_TEST(GIVEN_records_older_than_window_WHEN_rate_is_read_THEN_they_are_not_counted)
+	{
+		FHotEntityTracker Tracker(5.f);
+
+		Tracker.Record(1, EHotEntityCounter::OutgoingRPCs, 100.0, 100);
+		Tracker.Record(1, EHotEntityCounter::OutgoingRPCs, 108.0, 5);
+
+		TestEqual("Only the recent RPCs are counted", Tracker.GetRate(1, EHotEntityCounter::OutgoingRPCs, 108.0), 1.f);
+		TestEqual("Nothing is counted once the window has passed", Tracker.GetRate(1, EHotEntityCounter::OutgoingRPCs, 120.0), 0.f);
+
+		Tracker.RemoveInactiveEntities(120.0);
+		TestEqual("Inactive entities are removed", Tracker.GetNumTrackedEntities(), 0);
+
+		return true;
+	}
+
+	HOT_ENTITY_TRACKER_TEST(GIVEN_a_hot_entity_WHEN_it_is_removed_THEN_its_counts_are_dropped)
+	{
+		FHotEntityTracker Tracker(5.f);
+
+		Tracker.Record(1, EHotEntityCounter::OutgoingRPCs, 100.0, 100);
+		Tracker.Record(2, EHotEntityCounter::OutgoingRPCs, 100.0, 100);
+		Tracker.RemoveEntity(1);
+
+		TestEqual("The removed entity has no rate", Tracker.GetRate(1, EHotEntityCounter::OutgoingRPCs, 100.0), 0.f);
+		TestEqual("Other entities are still tracked", Tracker.GetNumTrackedEntities(), 1);
+		TestEqual("Only the remaining entity is hot", Tracker.GetEntitiesAtOrAbove(EHotEntityCounter::OutgoingRPCs, 1.f, 100.0).Num(), 1);
+
+		return true;
+	}
+
+	HOT_ENTITY_TRACKER_TEST(GIVEN_several_entities_WHEN_top_entities_are_requested_THEN_highest_rates_are_returned_first)
+	{
+		FHotEntityTracker Tracker(5.f);
+
+		Tracker.Record(1, EHotEntityCounter::IncomingOps, 100.0, 10);
+		Tracker.Record(2, EHotEntityCounter::IncomingOps, 100.0, 50);
+		Tracker.Record(3, EHotEntityCounter::IncomingOps, 100.0, 30);
+
+		TArray<FHotEntity> TopEntities = Tracker.GetTopEntities(EHotEntityCounter::IncomingOps, 2, 100.0);
+		TestEqual("Only K entities are returned", TopEntities.Num(), 2);
+		TestEqual("Hottest entity first", TopEntities[0].EntityId, (Worker_EntityId)2);
+		TestEqual("Second hottest entity next", TopEntities[1].EntityId, (Worker_EntityId)3);
+
+		return true;
+	}
+} // namespace SpatialGDK
@@ -0,0 +1,169 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/Interest/InterestQueryOptimizer.h"
+
+#define INTEREST_QUERY_OPTIMIZER_TEST(TestName) \
+	GDK_TEST(Core, InterestQueryOptimizer, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		QueryConstraint MakeCylinderConstraint(double Radius)
+		{
+			QueryConstraint Constraint;
+			Constraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ Radius };
+			return Constraint;
+		}
+
+		QueryConstraint MakeComponentConstraint(Worker_ComponentId ComponentId)
+		{
+			QueryConstraint Constraint;
+			Constraint.ComponentConstraint = ComponentId;
+			return Constraint;
+		}
+
+		QueryConstraint MakeBoxConstraint(const Coordinates& Center, const EdgeLength& Edges)
+		{
+			QueryConstraint Constraint;
+			Constraint.BoxConstraint = BoxConstraint{ Center, Edges };
+			return Constraint;
+		}
+
+		Query MakeQuery(const QueryConstraint& Constraint, const TSchemaOption<float>& Frequency)
+		{
+			Query NewQuery;
+			NewQuery.Constraint = Constraint;
+			NewQuery.Frequency = Frequency;
+			NewQuery.ResultComponentIds = SchemaResultType{ 1, 2, 3 };
+			return NewQuery;
+		}
+	} // anonymous namespace
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_disjunction_of_nested_cylinders_WHEN_simplified_THEN_only_largest_cylinder_is_kept)
+	{
+		QueryConstraint Constraint;
+		Constraint.OrConstraint.Add(MakeCylinderConstraint(10.0));
+		Constraint.OrConstraint.Add(MakeCylinderConstraint(50.0));
+		Constraint.OrConstraint.Add(MakeCylinderConstraint(20.0));
+
+		QueryConstraint Simplified = InterestQueryOptimizer::SimplifyConstraint(Constraint);
+
+		TestTrue("Only the largest cylinder is kept", Simplified == MakeCylinderConstraint(50.0));
+
+		return true;
+	}
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_disjunction_of_grid_cell_boxes_WHEN_simplified_THEN_boxes_are_merged_into_bounding_box)
+	{
+		// A 2x2 grid of 10m cells around the origin.
+		QueryConstraint Constraint;
+		Constraint.OrConstraint.Add(MakeBoxConstraint(Coordinates{ -5.0, 0.0, -5.0 }, EdgeLength{ 10.0, 1000.0, 10.0 }));
+		Constraint.OrConstraint.Add(MakeBoxConstraint(Coordinates{ 5.0, 0.0, -5.0 }, EdgeLength{ 10.0, 1000.0, 10.0 }));
+		Constraint.OrConstraint.Add(MakeBoxConstraint(Coordinates{ -5.0, 0.0, 5.0 }, EdgeLength{ 10.0, 1000.0, 10.0 }));
+		Constraint.OrConstraint.Add(MakeBoxConstraint(Coordinates{ 5.0, 0.0, 5.0 }, EdgeLength{ 10.0, 1000.0, 10.0 }));
+
+		QueryConstraint Simplified = InterestQueryOptimizer::SimplifyConstraint(Constraint);
+
+		TestTrue("The cells are merged into one box", Simplified == MakeBoxConstraint(Coordinates{ 0.0, 0.0, 0.0 }, EdgeLength{ 20.0, 1000.0, 20.0 }));
+
+		return true;
+	}
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_disjunction_of_separate_boxes_WHEN_simplified_THEN_only_contained_box_is_removed)
+	{
+		const QueryConstraint Outer = MakeBoxConstraint(Coordinates{ 0.0, 0.0, 0.0 }, EdgeLength{ 20.0, 20.0, 20.0 });
+		const QueryConstraint Inner = MakeBoxConstraint(Coordinates{ 2.0, 0.0, 2.0 }, EdgeLength{ 4.0, 4.0, 4.0 });
+		const QueryConstraint Separate = MakeBoxConstraint(Coordinates{ 0.0, 0.0, 100.0 }, EdgeLength{ 20.0, 20.0, 20.0 });
+
+		QueryConstraint Constraint;
+		Constraint.OrConstraint.Add(Outer);
+		Constraint.OrConstraint.Add(Inner);
+		Constraint.OrConstraint.Add(Separate);
+
+		QueryConstraint Expected;
+		Expected.OrConstraint.Add(Outer);
+		Expected.OrConstraint.Add(Separate);
+
+		TestTrue("Only the contained box is removed", InterestQueryOptimizer::SimplifyConstraint(Constraint) == Expected);
+
+		return true;
+	}
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_disjunction_of_conjunctions_with_shared_conjunct_WHEN_simplified_THEN_shared_conjunct_is_factored_out)
+	{
+		const QueryConstraint LevelConstraint = MakeComponentConstraint(100);
+
+		QueryConstraint First;
+		First.AndConstraint.Add(MakeComponentConstraint(1));
+		First.AndConstraint.Add(LevelConstraint);
+
+		QueryConstraint Second;
+		Second.AndConstraint.Add(MakeComponentConstraint(2));
+		Second.AndConstraint.Add(LevelConstraint);
+
+		QueryConstraint Constraint;
+		Constraint.OrConstraint.Add(First);
+		Constraint.OrConstraint.Add(Second);
+
+		QueryConstraint Expected;
+		QueryConstraint ExpectedDisjunction;
+		ExpectedDisjunction.OrConstraint.Add(MakeComponentConstraint(1));
+		ExpectedDisjunction.OrConstraint.Add(MakeComponentConstraint(2));
+		Expected.AndConstraint.Add(LevelConstraint);
+		Expected.AndConstraint.Add(ExpectedDisjunction);
+
+		TestTrue("The level constraint is factored out", InterestQueryOptimizer::SimplifyConstraint(Constraint) == Expected);
+
+		return true;
+	}
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_queries_with_same_result_and_frequency_WHEN_optimized_THEN_they_are_merged)
+	{
+		TArray<Query> Queries;
+		Queries.Add(MakeQuery(MakeComponentConstraint(1), TSchemaOption<float>()));
+		Queries.Add(MakeQuery(MakeComponentConstraint(2), 5.f));
+		Queries.Add(MakeQuery(MakeComponentConstraint(3), TSchemaOption<float>()));
+
+		InterestQueryOptimizer::OptimizeQueries(Queries);
+
+		QueryConstraint ExpectedConstraint;
+		ExpectedConstraint.OrConstraint.Add(MakeComponentConstraint(1));
+		ExpectedConstraint.OrConstraint.Add(MakeComponentConstraint(3));
+
+		TestEqual("Two queries are left", Queries.Num(), 2);
+		TestTrue("The full frequency queries are merged", Queries[0] == MakeQuery(ExpectedConstraint, TSchemaOption<float>()));
+		TestTrue("The rate limited query is kept apart", Queries[1] == MakeQuery(MakeComponentConstraint(2), 5.f));
+
+		return true;
+	}
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_query_contained_in_higher_frequency_query_WHEN_optimized_THEN_contained_query_is_dropped)
+	{
+		TArray<Query> Queries;
+		Queries.Add(MakeQuery(MakeCylinderConstraint(50.0), 2.f));
+		Queries.Add(MakeQuery(MakeCylinderConstraint(100.0), 10.f));
+
+		InterestQueryOptimizer::OptimizeQueries(Queries);
+
+		TestEqual("One query is left", Queries.Num(), 1);
+		TestTrue("The containing query is kept", Queries[0] == MakeQuery(MakeCylinderConstraint(100.0), 10.f));
+
+		return true;
+	}
+
+	INTEREST_QUERY_OPTIMIZER_TEST(GIVEN_query_contained_in_lower_frequency_query_WHEN_optimized_THEN_both_queries_are_kept)
+	{
+		TArray<Query> Queries;
+		Queries.Add(MakeQuery(MakeCylinderConstraint(50.0), TSchemaOption<float>()));
+		Queries.Add(MakeQuery(MakeCylinderConstraint(100.0), 10.f));
+
+		InterestQueryOptimizer::OptimizeQueries(Queries);
+
+		TestEqual("Both queries are left", Queries.Num(), 2);
+
+		return true;
+	}
+} // namespace SpatialGDK
@@ -0,0 +1,48 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/LatencySamples.h"
+
+#define LATENCY_SAMPLES_TEST(TestName) \
+	GDK_TEST(Core, LatencySamples, TestName)
+
+namespace SpatialGDK
+{
+	LATENCY_SAMPLES_TEST(GIVEN_no_samples_WHEN_percentiles_are_read_THEN_they_are_zero)
+	{
+		FLatencySamples Samples;
+
+		TestEqual("No samples", Samples.Num(), 0);
+		TestEqual("50th percentile", Samples.GetPercentile(50.0), 0.0);
+		TestEqual("Max", Samples.GetMax(), 0.0);
+
+		return true;
+	}
+
+	LATENCY_SAMPLES_TEST(GIVEN_unordered_samples_WHEN_percentiles_are_read_THEN_nearest_rank_is_returned)
+	{
+		FLatencySamples Samples;
+
+		// 100 down to 1, so the samples have to be sorted.
+		for (int32 i = 100; i >= 1; i--)
+		{
+			Samples.Add(i * 0.001);
+		}
+
+		TestEqual("0th percentile is the smallest sample", Samples.GetPercentile(0.0), 0.001);
+		TestEqual("50th percentile", Samples.GetPercentile(50.0), 0.050);
+		TestEqual("90th percentile", Samples.GetPercentile(90.0), 0.090);
+		TestEqual("99th percentile", Samples.GetPercentile(99.0), 0.099);
+		TestEqual("99.5th percentile rounds up", Samples.GetPercentile(99.5), 0.100);
+		TestEqual("Max", Samples.GetMax(), 0.100);
+
+		Samples.Add(0.5);
+		TestEqual("Samples added after reading are included", Samples.GetMax(), 0.5);
+
+		Samples.Reset();
+		TestEqual("Reset removes every sample", Samples.Num(), 0);
+
+		return true;
+	}
+}
@@ -0,0 +1,89 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/LevelInterestActivationQueue.h"
+
+#define LEVEL_INTEREST_ACTIVATION_QUEUE_TEST(TestName) \
+	GDK_TEST(Core, LevelInterestActivationQueue, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const FName NearLevel(TEXT("/Game/Maps/NearLevel"));
+const FName FarLevel(TEXT("/Game/Maps/FarLevel"));
+const FName UnloadedLevel(TEXT("/Game/Maps/UnloadedLevel"));
+
+FBox MakeBounds(const FVector& Center)
+{
+	return FBox::BuildAABB(Center, FVector(100.0f));
+}
+
+} // anonymous namespace
+
+LEVEL_INTEREST_ACTIVATION_QUEUE_TEST(GIVEN_levels_at_different_distances_WHEN_popping_with_an_origin_THEN_the_nearest_level_is_returned_first)
+{
+	FLevelInterestActivationQueue Queue;
+	Queue.Add(FarLevel, MakeBounds(FVector(10000.0f, 0.0f, 0.0f)));
+	Queue.Add(NearLevel, MakeBounds(FVector(1000.0f, 0.0f, 0.0f)));
+
+	const TOptional<FVector> Origin(FVector::ZeroVector);
+	TestEqual("The nearest level is activated first", Queue.PopNext(Origin), NearLevel);
+	TestEqual("The farther level is activated next", Queue.PopNext(Origin), FarLevel);
+	TestEqual("No levels are left", Queue.Num(), 0);
+
+	return true;
+}
+
+LEVEL_INTEREST_ACTIVATION_QUEUE_TEST(GIVEN_a_level_without_bounds_WHEN_popping_with_an_origin_THEN_it_is_returned_last)
+{
+	FLevelInterestActivationQueue Queue;
+	Queue.Add(UnloadedLevel, FBox(ForceInit));
+	Queue.Add(FarLevel, MakeBounds(FVector(10000.0f, 0.0f, 0.0f)));
+
+	const TOptional<FVector> Origin(FVector::ZeroVector);
+	TestEqual("The level with bounds is activated first", Queue.PopNext(Origin), FarLevel);
+	TestEqual("The level without bounds is activated last", Queue.PopNext(Origin), UnloadedLevel);
+
+	return true;
+}
+
+LEVEL_INTEREST_ACTIVATION_QUEUE_TEST(GIVEN_no_origin_WHEN_popping_THEN_levels_are_returned_in_the_order_they_were_added)
+{
+	FLevelInterestActivationQueue Queue;
+	Queue.Add(FarLevel, MakeBounds(FVector(10000.0f, 0.0f, 0.0f)));
+	Queue.Add(NearLevel, MakeBounds(FVector(1000.0f, 0.0f, 0.0f)));
+
+	TestEqual("The level added first is activated first", Queue.PopNext(TOptional<FVector>()), FarLevel);
+	TestEqual("The level added second is activated next", Queue.PopNext(TOptional<FVector>()), NearLevel);
+
+	return true;
+}
+
+LEVEL_INTEREST_ACTIVATION_QUEUE_TEST(GIVEN_a_pending_level_WHEN_adding_it_again_THEN_it_is_only_pending_once)
+{
+	FLevelInterestActivationQueue Queue;
+	TestTrue("The level is added", Queue.Add(NearLevel, MakeBounds(FVector::ZeroVector)));
+	TestFalse("Adding the level again is ignored", Queue.Add(NearLevel, MakeBounds(FVector::ZeroVector)));
+	TestEqual("The level is pending once", Queue.Num(), 1);
+
+	return true;
+}
+
+LEVEL_INTEREST_ACTIVATION_QUEUE_TEST(GIVEN_a_pending_level_WHEN_removing_it_THEN_it_is_no_longer_pending)
+{
+	FLevelInterestActivationQueue Queue;
+	Queue.Add(NearLevel, MakeBounds(FVector::ZeroVector));
+	Queue.Add(FarLevel, MakeBounds(FVector(10000.0f, 0.0f, 0.0f)));
+
+	Queue.Remove(NearLevel);
+
+	TestFalse("The removed level is not pending", Queue.Contains(NearLevel));
+	TestTrue("The other level is still pending", Queue.Contains(FarLevel));
+	TestEqual("Only the other level is activated", Queue.PopNext(TOptional<FVector>(FVector::ZeroVector)), FarLevel);
+	TestEqual("Nothing is returned once no levels are pending", Queue.PopNext(TOptional<FVector>()), FName(NAME_None));
+
+	return true;
+}
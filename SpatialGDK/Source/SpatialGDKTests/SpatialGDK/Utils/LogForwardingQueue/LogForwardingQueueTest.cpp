@@ -0,0 +1,87 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/LogForwardingQueue.h"
+
+#include "CoreMinimal.h"
+
+#define LOGFORWARDINGQUEUE_TEST(TestName) \
+	GDK_TEST(Core, FLogForwardingQueue, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const FName TestCategory = TEXT("LogTest");
+
+} // anonymous namespace
+
+LOGFORWARDINGQUEUE_TEST(GIVEN_lines_of_mixed_levels_WHEN_drained_THEN_consecutive_lines_of_a_level_are_batched)
+{
+	FLogForwardingQueue Queue(16, 0, {});
+	Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("a"), 0.0);
+	Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("b"), 0.0);
+	Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("c"), 0.0);
+	Queue.Enqueue(WORKER_LOG_LEVEL_WARN, TestCategory, TEXT("d"), 0.0);
+
+	TArray<FLogForwardingQueue::FLogBatch> Batches;
+	const uint32 NumDropped = Queue.Drain(2, Batches);
+
+	TestEqual(TEXT("Nothing dropped"), NumDropped, 0u);
+	TestEqual(TEXT("Three batches"), Batches.Num(), 3);
+	if (Batches.Num() == 3)
+	{
+		TestEqual(TEXT("First batch is capped at two lines"), Batches[0].Message, FString::Printf(TEXT("a%sb"), LINE_TERMINATOR));
+		TestEqual(TEXT("Second batch"), Batches[1].Message, FString(TEXT("c")));
+		TestEqual(TEXT("Warning batch level"), static_cast<int32>(Batches[2].Level), static_cast<int32>(WORKER_LOG_LEVEL_WARN));
+	}
+	TestEqual(TEXT("Queue is empty"), Queue.GetNum(), 0);
+
+	return true;
+}
+
+LOGFORWARDINGQUEUE_TEST(GIVEN_a_full_queue_WHEN_lines_are_enqueued_THEN_they_are_dropped_and_counted)
+{
+	FLogForwardingQueue Queue(2, 0, {});
+	TestTrue(TEXT("First line queued"), Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("a"), 0.0));
+	TestTrue(TEXT("Second line queued"), Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("b"), 0.0));
+	TestFalse(TEXT("Third line dropped"), Queue.Enqueue(WORKER_LOG_LEVEL_ERROR, TestCategory, TEXT("c"), 0.0));
+
+	TArray<FLogForwardingQueue::FLogBatch> Batches;
+	TestEqual(TEXT("One line dropped"), Queue.Drain(8, Batches), 1u);
+
+	// The ring wraps around once drained.
+	TestTrue(TEXT("Line queued after drain"), Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("d"), 0.0));
+	Batches.Reset();
+	TestEqual(TEXT("Drop count was reset"), Queue.Drain(8, Batches), 0u);
+	TestTrue(TEXT("Wrapped line drained"), Batches.Num() == 1 && Batches[0].Message == TEXT("d"));
+
+	return true;
+}
+
+LOGFORWARDINGQUEUE_TEST(GIVEN_a_rate_limit_and_sample_rate_WHEN_lines_are_enqueued_THEN_errors_are_never_limited)
+{
+	TMap<FName, uint32> SampleRates;
+	SampleRates.Add(TestCategory, 2);
+	FLogForwardingQueue Queue(64, 3, SampleRates);
+
+	int32 NumQueued = 0;
+	for (int32 i = 0; i < 10; i++)
+	{
+		NumQueued += Queue.Enqueue(WORKER_LOG_LEVEL_INFO, TestCategory, TEXT("info"), 0.0) ? 1 : 0;
+	}
+	TestEqual(TEXT("Half sampled out, then capped by the rate limit"), NumQueued, 3);
+
+	TestTrue(TEXT("Errors skip sampling and the rate limit"), Queue.Enqueue(WORKER_LOG_LEVEL_ERROR, TestCategory, TEXT("error"), 0.0));
+
+	NumQueued = 0;
+	for (int32 i = 0; i < 10; i++)
+	{
+		NumQueued += Queue.Enqueue(WORKER_LOG_LEVEL_INFO, FName(TEXT("LogOther")), TEXT("info"), 1.0) ? 1 : 0;
+	}
+	TestEqual(TEXT("Rate limit refilled after a second"), NumQueued, 3);
+
+	return true;
+}
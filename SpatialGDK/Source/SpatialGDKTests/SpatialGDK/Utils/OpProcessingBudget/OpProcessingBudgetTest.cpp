@@ -0,0 +1,117 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/OpProcessingBudget.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define OP_PROCESSING_BUDGET_TEST(TestName) \
+	GDK_TEST(Core, OpProcessingBudget, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+// Walks the ops from FirstOpIndex the way SpatialDispatcher::ProcessOps does, tracking critical sections across passes in
+// bInCriticalSection, and returns the index of the first op which wasn't processed.
+uint32 ProcessOps(const TArray<Worker_OpType>& Ops, uint32 FirstOpIndex, double EndTime, uint32 MaxOps, bool& bInCriticalSection)
+{
+	const FOpProcessingBudget Budget(FirstOpIndex, EndTime, MaxOps);
+	uint32 OpIndex = FirstOpIndex;
+	for (; OpIndex < static_cast<uint32>(Ops.Num()); ++OpIndex)
+	{
+		if (Budget.ShouldStopBefore(OpIndex, bInCriticalSection))
+		{
+			break;
+		}
+
+		if (Ops[OpIndex] == WORKER_OP_TYPE_CRITICAL_SECTION)
+		{
+			bInCriticalSection = !bInCriticalSection;
+		}
+	}
+	return OpIndex;
+}
+
+const TArray<Worker_OpType> OpsWithCriticalSection = {
+	WORKER_OP_TYPE_COMPONENT_UPDATE,
+	WORKER_OP_TYPE_CRITICAL_SECTION,
+	WORKER_OP_TYPE_ADD_ENTITY,
+	WORKER_OP_TYPE_ADD_COMPONENT,
+	WORKER_OP_TYPE_ADD_COMPONENT,
+	WORKER_OP_TYPE_AUTHORITY_CHANGE,
+	WORKER_OP_TYPE_CRITICAL_SECTION,
+	WORKER_OP_TYPE_COMPONENT_UPDATE
+};
+
+} // anonymous namespace
+
+OP_PROCESSING_BUDGET_TEST(GIVEN_an_unbounded_budget_WHEN_processing_ops_THEN_the_whole_list_is_processed)
+{
+	bool bInCriticalSection = false;
+	TestEqual("Ops processed", ProcessOps(OpsWithCriticalSection, 0, 0.0, 0, bInCriticalSection), static_cast<uint32>(OpsWithCriticalSection.Num()));
+
+	return true;
+}
+
+OP_PROCESSING_BUDGET_TEST(GIVEN_a_max_ops_budget_WHEN_processing_ops_outside_a_critical_section_THEN_processing_stops_at_the_budget)
+{
+	const TArray<Worker_OpType> Ops = { WORKER_OP_TYPE_COMPONENT_UPDATE, WORKER_OP_TYPE_COMPONENT_UPDATE, WORKER_OP_TYPE_COMPONENT_UPDATE,
+		WORKER_OP_TYPE_COMPONENT_UPDATE, WORKER_OP_TYPE_COMPONENT_UPDATE };
+
+	bool bInCriticalSection = false;
+	const uint32 FirstPassEnd = ProcessOps(Ops, 0, 0.0, 2, bInCriticalSection);
+	TestEqual("The first pass stops after two ops", FirstPassEnd, 2u);
+
+	const uint32 SecondPassEnd = ProcessOps(Ops, FirstPassEnd, 0.0, 2, bInCriticalSection);
+	TestEqual("The second pass resumes from the first unprocessed op", SecondPassEnd, 4u);
+
+	TestEqual("The last pass processes the rest", ProcessOps(Ops, SecondPassEnd, 0.0, 2, bInCriticalSection), 5u);
+
+	return true;
+}
+
+OP_PROCESSING_BUDGET_TEST(GIVEN_a_budget_which_ends_inside_a_critical_section_WHEN_processing_ops_THEN_the_critical_section_is_processed_to_its_end)
+{
+	bool bInCriticalSection = false;
+	const uint32 FirstPassEnd = ProcessOps(OpsWithCriticalSection, 0, 0.0, 3, bInCriticalSection);
+
+	TestEqual("Processing stops after the op ending the critical section", FirstPassEnd, 7u);
+	TestFalse("Not in a critical section", bInCriticalSection);
+
+	return true;
+}
+
+OP_PROCESSING_BUDGET_TEST(GIVEN_a_pass_resumed_inside_a_critical_section_WHEN_processing_ops_THEN_the_critical_section_is_processed_to_its_end)
+{
+	// As if an earlier pass had run out of budget between the critical section starting and an entity being added.
+	bool bInCriticalSection = true;
+	const uint32 PassEnd = ProcessOps(OpsWithCriticalSection, 2, 0.0, 1, bInCriticalSection);
+
+	TestEqual("Processing stops after the op ending the critical section", PassEnd, 7u);
+
+	return true;
+}
+
+OP_PROCESSING_BUDGET_TEST(GIVEN_an_end_time_which_has_passed_WHEN_processing_ops_THEN_one_op_is_processed)
+{
+	const TArray<Worker_OpType> Ops = { WORKER_OP_TYPE_COMPONENT_UPDATE, WORKER_OP_TYPE_COMPONENT_UPDATE, WORKER_OP_TYPE_COMPONENT_UPDATE };
+	const double EndTime = FPlatformTime::Seconds() - 1.0;
+
+	bool bInCriticalSection = false;
+	TestEqual("The first pass processes one op", ProcessOps(Ops, 0, EndTime, 0, bInCriticalSection), 1u);
+	TestEqual("A resumed pass processes one op", ProcessOps(Ops, 1, EndTime, 0, bInCriticalSection), 2u);
+
+	return true;
+}
+
+OP_PROCESSING_BUDGET_TEST(GIVEN_an_end_time_in_the_future_WHEN_processing_ops_THEN_the_whole_list_is_processed)
+{
+	bool bInCriticalSection = false;
+	const double EndTime = FPlatformTime::Seconds() + 60.0;
+	TestEqual("Ops processed", ProcessOps(OpsWithCriticalSection, 0, EndTime, 0, bInCriticalSection), static_cast<uint32>(OpsWithCriticalSection.Num()));
+
+	return true;
+}
@@ -0,0 +1,163 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/PrioritizedEntrySelection.h"
+
+#include "Math/RandomStream.h"
+
+#define PRIORITIZED_ENTRY_SELECTION_TEST(TestName) \
+	GDK_TEST(Core, PrioritizedEntrySelection, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+struct FTestEntry
+{
+	int32 Id;
+	int32 Priority;
+	EPrioritizedEntryKind Kind;
+};
+
+EPrioritizedEntryKind GetKind(const FTestEntry& Entry)
+{
+	return Entry.Kind;
+}
+
+// Highest priority first, like FCompareFActorPriority.
+bool IsHigherPriority(const FTestEntry& A, const FTestEntry& B)
+{
+	return A.Priority > B.Priority;
+}
+
+int32 SortWithinRateLimits(TArray<FTestEntry>& Entries, uint32 EntityCreationRateLimit, uint32 ActorReplicationRateLimit)
+{
+	return SortPrioritizedEntriesWithinRateLimits(Entries.GetData(), Entries.Num(), EntityCreationRateLimit, ActorReplicationRateLimit, &GetKind, &IsHigherPriority);
+}
+
+// The ids of the entries handled, in order, when processing them the way ServerReplicateActors_ProcessPrioritizedActors does.
+TArray<int32> Process(const TArray<FTestEntry>& Entries, uint32 EntityCreationRateLimit, uint32 ActorReplicationRateLimit)
+{
+	TArray<int32> HandledIds;
+	uint32 NumCreated = 0;
+	uint32 NumReplicated = 0;
+	for (const FTestEntry& Entry : Entries)
+	{
+		if (Entry.Kind == EPrioritizedEntryKind::NotRateLimited)
+		{
+			HandledIds.Add(Entry.Id);
+		}
+		else if (Entry.Kind == EPrioritizedEntryKind::EntityCreation && NumCreated < EntityCreationRateLimit)
+		{
+			HandledIds.Add(Entry.Id);
+			NumCreated++;
+		}
+		else if (NumReplicated < ActorReplicationRateLimit)
+		{
+			HandledIds.Add(Entry.Id);
+			NumReplicated++;
+		}
+	}
+	return HandledIds;
+}
+
+} // anonymous namespace
+
+PRIORITIZED_ENTRY_SELECTION_TEST(GIVEN_existing_actors_ahead_of_a_creation_WHEN_sorting_within_rate_limits_THEN_the_creation_is_selected)
+{
+	TArray<FTestEntry> Entries = {
+		{ 1, 10, EPrioritizedEntryKind::Replication },
+		{ 2, 9, EPrioritizedEntryKind::Replication },
+		{ 3, 8, EPrioritizedEntryKind::Replication },
+		{ 4, 1, EPrioritizedEntryKind::EntityCreation }
+	};
+
+	const int32 NumSelected = SortWithinRateLimits(Entries, 1, 2);
+
+	TestEqual("The creation and the two highest priority actors were selected", NumSelected, 3);
+	TestEqual("First entry", Entries[0].Id, 1);
+	TestEqual("Second entry", Entries[1].Id, 2);
+	TestEqual("Third entry", Entries[2].Id, 4);
+
+	return true;
+}
+
+PRIORITIZED_ENTRY_SELECTION_TEST(GIVEN_more_creations_than_the_creation_rate_limit_WHEN_sorting_within_rate_limits_THEN_the_others_compete_for_the_replication_rate_limit)
+{
+	TArray<FTestEntry> Entries = {
+		{ 1, 5, EPrioritizedEntryKind::EntityCreation },
+		{ 2, 4, EPrioritizedEntryKind::Replication },
+		{ 3, 7, EPrioritizedEntryKind::EntityCreation },
+		{ 4, 6, EPrioritizedEntryKind::EntityCreation },
+		{ 5, 3, EPrioritizedEntryKind::Replication }
+	};
+
+	const int32 NumSelected = SortWithinRateLimits(Entries, 1, 2);
+
+	// Entry 3 is created, and entries 4 and 1 outrank entry 2 for the replication rate limit.
+	TestEqual("One creation and two other entries were selected", NumSelected, 3);
+	TestEqual("First entry", Entries[0].Id, 3);
+	TestEqual("Second entry", Entries[1].Id, 4);
+	TestEqual("Third entry", Entries[2].Id, 1);
+
+	return true;
+}
+
+PRIORITIZED_ENTRY_SELECTION_TEST(GIVEN_entries_which_are_not_rate_limited_WHEN_sorting_within_rate_limits_THEN_they_are_all_selected_in_priority_order)
+{
+	TArray<FTestEntry> Entries = {
+		{ 1, 1, EPrioritizedEntryKind::NotRateLimited },
+		{ 2, 5, EPrioritizedEntryKind::Replication },
+		{ 3, 3, EPrioritizedEntryKind::NotRateLimited },
+		{ 4, 4, EPrioritizedEntryKind::Replication }
+	};
+
+	const int32 NumSelected = SortWithinRateLimits(Entries, 1, 1);
+
+	TestEqual("Both entries which are not rate limited and the highest priority actor were selected", NumSelected, 3);
+	TestEqual("First entry", Entries[0].Id, 2);
+	TestEqual("Second entry", Entries[1].Id, 3);
+	TestEqual("Third entry", Entries[2].Id, 1);
+
+	return true;
+}
+
+PRIORITIZED_ENTRY_SELECTION_TEST(GIVEN_random_entries_WHEN_processing_the_entries_sorted_within_rate_limits_THEN_the_same_entries_are_handled_as_when_fully_sorted)
+{
+	FRandomStream Random(1234);
+
+	for (int32 Iteration = 0; Iteration < 100; Iteration++)
+	{
+		TArray<FTestEntry> Entries;
+		const int32 NumEntries = Random.RandRange(0, 50);
+		for (int32 Id = 0; Id < NumEntries; Id++)
+		{
+			Entries.Add({ Id, Random.RandRange(0, 20), static_cast<EPrioritizedEntryKind>(Random.RandRange(0, 2)) });
+		}
+		const uint32 EntityCreationRateLimit = Random.RandRange(1, 10);
+		const uint32 ActorReplicationRateLimit = Random.RandRange(1, 10);
+
+		// Stable, so that entries of equal priority keep an order both sorts can agree on.
+		for (int32 i = 0; i < Entries.Num(); i++)
+		{
+			Entries[i].Priority = Entries[i].Priority * NumEntries + i;
+		}
+
+		TArray<FTestEntry> FullySorted = Entries;
+		FullySorted.Sort(&IsHigherPriority);
+
+		SortWithinRateLimits(Entries, EntityCreationRateLimit, ActorReplicationRateLimit);
+
+		const TArray<int32> Expected = Process(FullySorted, EntityCreationRateLimit, ActorReplicationRateLimit);
+		const TArray<int32> Actual = Process(Entries, EntityCreationRateLimit, ActorReplicationRateLimit);
+		if (Actual != Expected)
+		{
+			AddError(FString::Printf(TEXT("Iteration %d handled different entries than the full sort"), Iteration));
+			break;
+		}
+	}
+
+	return true;
+}
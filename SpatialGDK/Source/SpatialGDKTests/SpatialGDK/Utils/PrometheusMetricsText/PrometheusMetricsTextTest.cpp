@@ -0,0 +1,90 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/PrometheusMetricsEndpoint.h"
+
+#define PROMETHEUS_METRICS_TEXT_TEST(TestName) \
+	GDK_TEST(Core, PrometheusMetricsText, TestName)
+
+namespace SpatialGDK
+{
+	namespace
+	{
+		HistogramMetric MakeHistogram(uint32 SamplesUnderOne, uint32 TotalSamples, double Sum)
+		{
+			HistogramMetric Metric;
+			Metric.Key = "Frame Time";
+			Metric.Sum = Sum;
+			Metric.Buckets.Add(HistogramMetricBucket{ 1.0, SamplesUnderOne });
+			Metric.Buckets.Add(HistogramMetricBucket{ TNumericLimits<double>::Max(), TotalSamples });
+			return Metric;
+		}
+	} // anonymous namespace
+
+	PROMETHEUS_METRICS_TEXT_TEST(GIVEN_a_report_key_WHEN_converted_to_a_metric_name_THEN_disallowed_characters_are_replaced)
+	{
+		TestEqual("Metric name", FPrometheusMetricsText::ToMetricName(TEXT("Dynamic.FPS")), FString(TEXT("spatialgdk_dynamic_fps")));
+		TestEqual("Metric name", FPrometheusMetricsText::ToMetricName(TEXT("Outgoing Lane-Depth:RPC")), FString(TEXT("spatialgdk_outgoing_lane_depth:rpc")));
+
+		return true;
+	}
+
+	PROMETHEUS_METRICS_TEXT_TEST(GIVEN_gauges_and_counters_WHEN_updated_THEN_they_are_typed_and_counters_are_suffixed)
+	{
+		SpatialMetrics Metrics;
+		Metrics.Load = 0.5;
+		Metrics.GaugeMetrics.Add(GaugeMetric{ "fps", 30.0 });
+
+		FPrometheusMetricsText MetricsText;
+		const FString Text = MetricsText.Update(Metrics, { { TEXT("sent_rpcs"), 12 } });
+
+		TestTrue("Load", Text.Contains(TEXT("# TYPE spatialgdk_worker_load gauge\nspatialgdk_worker_load 0.5\n")));
+		TestTrue("Gauge", Text.Contains(TEXT("# TYPE spatialgdk_fps gauge\nspatialgdk_fps 30.0\n")));
+		TestTrue("Counter", Text.Contains(TEXT("# TYPE spatialgdk_sent_rpcs_total counter\nspatialgdk_sent_rpcs_total 12\n")));
+
+		return true;
+	}
+
+	PROMETHEUS_METRICS_TEXT_TEST(GIVEN_histograms_in_two_reports_WHEN_updated_THEN_the_buckets_are_totals_since_the_first)
+	{
+		FPrometheusMetricsText MetricsText;
+
+		SpatialMetrics FirstMetrics;
+		FirstMetrics.HistogramMetrics.Add(MakeHistogram(2, 3, 2.5));
+		MetricsText.Update(FirstMetrics, {});
+
+		SpatialMetrics SecondMetrics;
+		SecondMetrics.HistogramMetrics.Add(MakeHistogram(1, 4, 6.0));
+		const FString Text = MetricsText.Update(SecondMetrics, {});
+
+		TestTrue("Type", Text.Contains(TEXT("# TYPE spatialgdk_frame_time histogram\n")));
+		TestTrue("Bucket", Text.Contains(TEXT("spatialgdk_frame_time_bucket{le=\"1.0\"} 3\n")));
+		TestTrue("Overflow bucket", Text.Contains(TEXT("spatialgdk_frame_time_bucket{le=\"+Inf\"} 7\n")));
+		TestTrue("Sum", Text.Contains(TEXT("spatialgdk_frame_time_sum 8.5\n")));
+		TestTrue("Count", Text.Contains(TEXT("spatialgdk_frame_time_count 7\n")));
+
+		return true;
+	}
+
+	PROMETHEUS_METRICS_TEXT_TEST(GIVEN_a_histogram_with_new_bounds_WHEN_updated_THEN_its_totals_start_over)
+	{
+		FPrometheusMetricsText MetricsText;
+
+		SpatialMetrics FirstMetrics;
+		FirstMetrics.HistogramMetrics.Add(MakeHistogram(2, 3, 2.5));
+		MetricsText.Update(FirstMetrics, {});
+
+		SpatialMetrics SecondMetrics;
+		HistogramMetric Rebounded = MakeHistogram(1, 1, 0.5);
+		Rebounded.Buckets[0].UpperBound = 2.0;
+		SecondMetrics.HistogramMetrics.Add(MoveTemp(Rebounded));
+		const FString Text = MetricsText.Update(SecondMetrics, {});
+
+		TestTrue("Bucket", Text.Contains(TEXT("spatialgdk_frame_time_bucket{le=\"2.0\"} 1\n")));
+		TestFalse("Old bucket", Text.Contains(TEXT("le=\"1.0\"")));
+		TestTrue("Count", Text.Contains(TEXT("spatialgdk_frame_time_count 1\n")));
+
+		return true;
+	}
+}
@@ -215,3 +215,146 @@ RPCCONTAINER_TEST(GIVEN_a_container_with_one_value_WHEN_processing_after_RPCQueu
     return true;
 }
 
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_a_value_waiting_for_its_target_WHEN_processed_THEN_it_is_only_retried_once_its_entity_is_ready)
+{
+	UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+	FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+	const Worker_EntityId EntityId = Params.ObjectRef.Entity;
+
+	int32 NumAttempts = 0;
+	bool bTargetResolved = false;
+	FRPCContainer RPCs(ERPCQueueType::Receive);
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&NumAttempts, &bTargetResolved](const FPendingRPCParams&)
+	{
+		NumAttempts++;
+		return FRPCErrorInfo{ nullptr, nullptr, bTargetResolved ? ERPCResult::Success : ERPCResult::UnresolvedTargetObject };
+	}));
+
+	RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.Type, MoveTemp(Params.Payload));
+	RPCs.ProcessRPCs();
+
+	TestEqual("Waiting value is not retried before its entity is ready", NumAttempts, 1);
+	TestEqual("No entity is ready", RPCs.GetNumReadyEntities(), 0);
+	TestTrue("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(EntityId, AnySchemaComponentType));
+
+	bTargetResolved = true;
+	RPCs.MarkEntityReady(EntityId);
+	RPCs.ProcessRPCs();
+
+	TestEqual("Value is retried once its entity is ready", NumAttempts, 2);
+	TestFalse("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(EntityId, AnySchemaComponentType));
+	TestEqual("Nothing is queued", RPCs.GetNumQueuedRPCs(), 0);
+
+	return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_a_value_waiting_for_a_parameter_WHEN_processed_THEN_it_is_only_retried_once_the_parameter_resolves)
+{
+	UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+	FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+	const Worker_EntityId EntityId = Params.ObjectRef.Entity;
+	const FUnrealObjectRef ParameterRef{ EntityId + 1, 0 };
+	const FUnrealObjectRef OtherRef{ EntityId + 2, 0 };
+
+	int32 NumAttempts = 0;
+	bool bParameterResolved = false;
+	FRPCContainer RPCs(ERPCQueueType::Receive);
+	RPCs.SetUnresolvedRefsTimeout(1000.0f);
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&NumAttempts, &bParameterResolved, &ParameterRef](const FPendingRPCParams&)
+	{
+		NumAttempts++;
+		FRPCErrorInfo ErrorInfo{ nullptr, nullptr, bParameterResolved ? ERPCResult::Success : ERPCResult::UnresolvedParameters };
+		if (!bParameterResolved)
+		{
+			ErrorInfo.UnresolvedRefs.Add(ParameterRef);
+		}
+		return ErrorInfo;
+	}));
+
+	RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.Type, MoveTemp(Params.Payload));
+	RPCs.ProcessRPCs();
+	RPCs.OnObjectRefResolved(OtherRef);
+	RPCs.ProcessRPCs();
+
+	TestEqual("Waiting value is not retried before its parameter resolves", NumAttempts, 1);
+	TestEqual("No entity is ready", RPCs.GetNumReadyEntities(), 0);
+	TestEqual("One reference is waited for", RPCs.GetNumRefsWaitedFor(), 1);
+
+	bParameterResolved = true;
+	RPCs.OnObjectRefResolved(ParameterRef);
+	RPCs.ProcessRPCs();
+
+	TestEqual("Value is retried once its parameter resolves", NumAttempts, 2);
+	TestEqual("Nothing is queued", RPCs.GetNumQueuedRPCs(), 0);
+	TestEqual("No reference is waited for", RPCs.GetNumRefsWaitedFor(), 0);
+
+	return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_a_value_waiting_for_a_parameter_WHEN_it_times_out_THEN_it_is_retried)
+{
+	UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+	FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+	const FUnrealObjectRef ParameterRef{ Params.ObjectRef.Entity + 1, 0 };
+
+	int32 NumAttempts = 0;
+	FDateTime Now(2020, 1, 1);
+	FRPCContainer RPCs(ERPCQueueType::Receive);
+	RPCs.SetTimeSource([&Now] { return Now; });
+	RPCs.SetUnresolvedRefsTimeout(0.1f);
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&NumAttempts, &ParameterRef](const FPendingRPCParams&)
+	{
+		NumAttempts++;
+		FRPCErrorInfo ErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedParameters };
+		ErrorInfo.UnresolvedRefs.Add(ParameterRef);
+		return ErrorInfo;
+	}));
+
+	RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.Type, MoveTemp(Params.Payload));
+	RPCs.ProcessRPCs();
+	TestEqual("Waiting value is not retried before it times out", NumAttempts, 1);
+
+	Now += FTimespan::FromSeconds(0.05);
+	RPCs.ProcessRPCs();
+	TestEqual("Waiting value is not retried within its timeout", NumAttempts, 1);
+
+	Now += FTimespan::FromSeconds(0.1);
+	RPCs.ProcessRPCs();
+	TestEqual("Value is retried once it times out", NumAttempts, 2);
+
+	return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_an_unreliable_value_WHEN_processing_after_its_time_to_live_THEN_it_is_dropped_and_counted)
+{
+	USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+	const float OldDefaultUnreliableRPCTimeToLive = SpatialGDKSettings->DefaultUnreliableRPCTimeToLive;
+	SpatialGDKSettings->DefaultUnreliableRPCTimeToLive = 0.1f;
+
+	UObjectStub* TargetObject = NewObject<UObjectStub>();
+	FPendingRPCParams UnreliableParams = CreateMockParameters(TargetObject, ERPCType::ClientUnreliable);
+	FPendingRPCParams ReliableParams = CreateMockParameters(TargetObject, ERPCType::ClientReliable);
+	FDateTime Now(2020, 1, 1);
+	FRPCContainer RPCs(ERPCQueueType::Send);
+	RPCs.SetTimeSource([&Now] { return Now; });
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(TargetObject, &UObjectStub::ProcessRPC));
+
+	RPCs.ProcessOrQueueRPC(UnreliableParams.ObjectRef, UnreliableParams.Type, MoveTemp(UnreliableParams.Payload));
+	RPCs.ProcessOrQueueRPC(ReliableParams.ObjectRef, ReliableParams.Type, MoveTemp(ReliableParams.Payload));
+
+	Now += FTimespan::FromSeconds(0.05);
+	RPCs.ProcessRPCs();
+	TestTrue("Unreliable value is kept within its time to live", RPCs.ObjectHasRPCsQueuedOfType(UnreliableParams.ObjectRef.Entity, ERPCType::ClientUnreliable));
+
+	Now += FTimespan::FromSeconds(0.1);
+	RPCs.ProcessRPCs();
+
+	TestFalse("Unreliable value has been dropped", RPCs.ObjectHasRPCsQueuedOfType(UnreliableParams.ObjectRef.Entity, ERPCType::ClientUnreliable));
+	TestTrue("Reliable value is still queued", RPCs.ObjectHasRPCsQueuedOfType(ReliableParams.ObjectRef.Entity, ERPCType::ClientReliable));
+	TestEqual("Expired values are counted", RPCs.GetNumExpiredRPCs(), 1u);
+
+	SpatialGDKSettings->DefaultUnreliableRPCTimeToLive = OldDefaultUnreliableRPCTimeToLive;
+
+	return true;
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ReplicationBudgetScheduler.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#define REPLICATIONBUDGETSCHEDULER_TEST(TestName) \
+	GDK_TEST(Core, FReplicationBudgetScheduler, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const uint32 ByteBudget = 100;
+	const float StarvationThresholdSeconds = 1.f;
+
+	// Replicates the actor if the scheduler allows it, spending BytesWritten of the budget.
+	bool TryReplicate(FReplicationBudgetScheduler& Scheduler, const AActor* Actor, int64 BytesWritten)
+	{
+		if (!Scheduler.ShouldReplicate(Actor, 1.f))
+		{
+			return false;
+		}
+
+		Scheduler.ReportCost(Actor, 0.0, BytesWritten);
+		return true;
+	}
+} // anonymous namespace
+
+REPLICATIONBUDGETSCHEDULER_TEST(GIVEN_actors_within_budget_WHEN_scheduling_THEN_all_actors_replicate)
+{
+	FReplicationBudgetScheduler Scheduler(0.f, ByteBudget, StarvationThresholdSeconds);
+	AActor* ActorA = NewObject<AActor>();
+	AActor* ActorB = NewObject<AActor>();
+
+	Scheduler.BeginTick(0.0);
+	TestTrue("Actor A replicated", TryReplicate(Scheduler, ActorA, ByteBudget / 4));
+	TestTrue("Actor B replicated", TryReplicate(Scheduler, ActorB, ByteBudget / 4));
+	Scheduler.EndTick();
+
+	TestEqual("Budget spent", Scheduler.GetBudgetSpent(), 0.5);
+	TestEqual("Oldest unreplicated actor age", Scheduler.GetOldestUnreplicatedActorAge(), 0.0);
+
+	return true;
+}
+
+REPLICATIONBUDGETSCHEDULER_TEST(GIVEN_an_exhausted_budget_WHEN_scheduling_THEN_remaining_actors_are_deferred_to_the_next_tick)
+{
+	FReplicationBudgetScheduler Scheduler(0.f, ByteBudget, StarvationThresholdSeconds);
+	AActor* ActorA = NewObject<AActor>();
+	AActor* ActorB = NewObject<AActor>();
+
+	Scheduler.BeginTick(0.0);
+	TestTrue("Actor A replicated", TryReplicate(Scheduler, ActorA, ByteBudget));
+	TestFalse("Actor B replicated", TryReplicate(Scheduler, ActorB, ByteBudget));
+	Scheduler.EndTick();
+
+	Scheduler.BeginTick(0.1);
+	TestTrue("Deferred actor B replicated", TryReplicate(Scheduler, ActorB, ByteBudget));
+	Scheduler.EndTick();
+
+	return true;
+}
+
+REPLICATIONBUDGETSCHEDULER_TEST(GIVEN_a_deferred_actor_WHEN_ending_the_tick_THEN_its_age_is_reported)
+{
+	FReplicationBudgetScheduler Scheduler(0.f, ByteBudget, StarvationThresholdSeconds);
+	AActor* ActorA = NewObject<AActor>();
+	AActor* ActorB = NewObject<AActor>();
+
+	Scheduler.BeginTick(0.0);
+	TryReplicate(Scheduler, ActorA, ByteBudget);
+	TryReplicate(Scheduler, ActorB, ByteBudget);
+	Scheduler.EndTick();
+
+	Scheduler.BeginTick(0.5);
+	TestTrue("Actor A replicated", TryReplicate(Scheduler, ActorA, ByteBudget));
+	TestFalse("Actor B replicated", TryReplicate(Scheduler, ActorB, ByteBudget));
+	Scheduler.EndTick();
+
+	TestEqual("Oldest unreplicated actor age", Scheduler.GetOldestUnreplicatedActorAge(), 0.5);
+
+	return true;
+}
+
+REPLICATIONBUDGETSCHEDULER_TEST(GIVEN_a_starved_actor_WHEN_the_budget_is_exhausted_THEN_it_still_replicates)
+{
+	FReplicationBudgetScheduler Scheduler(0.f, ByteBudget, StarvationThresholdSeconds);
+	AActor* ActorA = NewObject<AActor>();
+	AActor* ActorB = NewObject<AActor>();
+
+	Scheduler.BeginTick(0.0);
+	TryReplicate(Scheduler, ActorA, ByteBudget);
+	TryReplicate(Scheduler, ActorB, ByteBudget);
+	Scheduler.EndTick();
+
+	Scheduler.BeginTick(StarvationThresholdSeconds + 0.5);
+	TestTrue("Actor A replicated", TryReplicate(Scheduler, ActorA, ByteBudget));
+	TestTrue("Starved actor B replicated", TryReplicate(Scheduler, ActorB, ByteBudget));
+	Scheduler.EndTick();
+
+	TestEqual("Starved actors replicated", Scheduler.GetNumStarvedActorsReplicated(), 1);
+	TestTrue("Budget exceeded", Scheduler.GetBudgetSpent() > 1.0);
+
+	return true;
+}
@@ -0,0 +1,22 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/SpatialLatencyTracer.h"
+
+#include "CoreMinimal.h"
+
+#define LATENCYTRACER_TEST(TestName) \
+	GDK_TEST(Core, USpatialLatencyTracer, TestName)
+
+LATENCYTRACER_TEST(GIVEN_a_queued_trace_event_WHEN_it_is_written_later_THEN_the_description_records_when_it_happened)
+{
+	const double EventTime = 100.0;
+
+	TestEqual("The delay since the event is recorded", USpatialLatencyTracer::DescribeQueuedTraceEvent(TEXT("Sent componentUpdate to Worker SDK"), EventTime, EventTime + 0.0125),
+		FString(TEXT("Sent componentUpdate to Worker SDK [12.500 ms before written]")));
+	TestEqual("An event written straight away has no delay", USpatialLatencyTracer::DescribeQueuedTraceEvent(TEXT("Moved componentAdd to Worker queue"), EventTime, EventTime),
+		FString(TEXT("Moved componentAdd to Worker queue [0.000 ms before written]")));
+
+	return true;
+}
@@ -0,0 +1,42 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/SpatialMemoryAccounting.h"
+
+#define SPATIAL_MEMORY_ACCOUNTING_TEST(TestName) \
+	GDK_TEST(Core, SpatialMemoryAccounting, TestName)
+
+namespace SpatialGDK
+{
+	SPATIAL_MEMORY_ACCOUNTING_TEST(GIVEN_samples_growing_then_shrinking_WHEN_recorded_THEN_current_is_latest_and_peak_is_largest)
+	{
+		FSpatialMemoryAccounting Accounting;
+
+		Accounting.Record(ESpatialMemorySubsystem::RPCContainers, 100);
+		Accounting.Record(ESpatialMemorySubsystem::RPCContainers, 400);
+		Accounting.Record(ESpatialMemorySubsystem::RPCContainers, 250);
+
+		TestEqual("The current size is the latest sample", Accounting.GetCurrentBytes(ESpatialMemorySubsystem::RPCContainers), static_cast<SIZE_T>(250));
+		TestEqual("The peak size is the largest sample", Accounting.GetPeakBytes(ESpatialMemorySubsystem::RPCContainers), static_cast<SIZE_T>(400));
+		TestEqual("Other subsystems are not affected", Accounting.GetPeakBytes(ESpatialMemorySubsystem::NetGUIDCache), static_cast<SIZE_T>(0));
+
+		return true;
+	}
+
+	SPATIAL_MEMORY_ACCOUNTING_TEST(GIVEN_recorded_samples_WHEN_peaks_are_reset_THEN_peaks_are_current_sizes_and_total_is_summed)
+	{
+		FSpatialMemoryAccounting Accounting;
+
+		Accounting.Record(ESpatialMemorySubsystem::StaticComponentView, 1000);
+		Accounting.Record(ESpatialMemorySubsystem::StaticComponentView, 600);
+		Accounting.Record(ESpatialMemorySubsystem::NetGUIDCache, 50);
+
+		Accounting.ResetPeaks();
+
+		TestEqual("The peak is reset to the current size", Accounting.GetPeakBytes(ESpatialMemorySubsystem::StaticComponentView), static_cast<SIZE_T>(600));
+		TestEqual("The total is summed over subsystems", Accounting.GetTotalCurrentBytes(), static_cast<SIZE_T>(650));
+
+		return true;
+	}
+} // namespace SpatialGDK
@@ -0,0 +1,54 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SpatialMetrics.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+
+#define SPATIALMETRICS_TEST(TestName) \
+	GDK_TEST(Core, USpatialMetrics, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+// The histogram RecordHandoverBytes registered for Class. Registering an existing histogram metric returns it.
+FAtomicHistogram& GetHandoverBytesHistogram(USpatialMetrics& Metrics, const UClass& Class)
+{
+	return Metrics.AddHistogramMetric(SpatialConstants::SPATIALOS_METRICS_HANDOVER_BYTES + Class.GetName(), {});
+}
+
+} // anonymous namespace
+
+SPATIALMETRICS_TEST(GIVEN_handover_updates_of_two_classes_WHEN_recording_their_sizes_THEN_each_class_has_its_own_histogram)
+{
+	USpatialMetrics* Metrics = NewObject<USpatialMetrics>();
+
+	Metrics->RecordHandoverBytes(*AActor::StaticClass(), 10);
+	Metrics->RecordHandoverBytes(*AActor::StaticClass(), 100);
+	Metrics->RecordHandoverBytes(*APawn::StaticClass(), 5000);
+
+	HistogramMetric ActorMetric;
+	if (!TestTrue(TEXT("The actor histogram has samples"), GetHandoverBytesHistogram(*Metrics, *AActor::StaticClass()).Consume(ActorMetric)))
+	{
+		return true;
+	}
+	TestEqual(TEXT("Actor handover bytes sum"), ActorMetric.Sum, 110.0);
+	if (TestTrue(TEXT("The actor histogram has handover size buckets"), ActorMetric.Buckets.Num() > 2))
+	{
+		TestEqual(TEXT("Actor updates of at most 16 bytes"), ActorMetric.Buckets[0].Samples, 1u);
+		TestEqual(TEXT("Actor updates of at most 256 bytes"), ActorMetric.Buckets[2].Samples, 2u);
+	}
+
+	HistogramMetric PawnMetric;
+	if (TestTrue(TEXT("The pawn histogram has samples"), GetHandoverBytesHistogram(*Metrics, *APawn::StaticClass()).Consume(PawnMetric)))
+	{
+		TestEqual(TEXT("Pawn handover bytes sum"), PawnMetric.Sum, 5000.0);
+	}
+
+	return true;
+}
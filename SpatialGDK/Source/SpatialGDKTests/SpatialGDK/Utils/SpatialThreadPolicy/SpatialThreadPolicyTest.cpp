@@ -0,0 +1,96 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "HAL/RunnableThread.h"
+
+#include "SpatialGDKSettings.h"
+#include "Utils/SpatialThreadPolicy.h"
+
+#define SPATIAL_THREAD_POLICY_TEST(TestName) \
+	GDK_TEST(Core, SpatialThreadPolicy, TestName)
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+const TCHAR* const TestThreadName = TEXT("SpatialThreadPolicyTestThread");
+
+class FExitingRunnable : public FRunnable
+{
+public:
+	virtual uint32 Run() override { return 0; }
+};
+
+} // anonymous namespace
+
+SPATIAL_THREAD_POLICY_TEST(GIVEN_affinity_cores_WHEN_building_the_mask_THEN_cores_the_host_does_not_have_are_left_out)
+{
+	TestTrue("Cores in range", GetThreadAffinityMask({ 0, 2, 3 }, 8) == uint64(0xD));
+	TestTrue("Out of range cores", GetThreadAffinityMask({ -1, 1, 8 }, 8) == uint64(0x2));
+	TestTrue("Duplicate cores", GetThreadAffinityMask({ 5, 5 }, 8) == uint64(0x20));
+	TestTrue("Highest representable core", GetThreadAffinityMask({ 63, 64 }, 128) == uint64(1) << 63);
+	TestTrue("No cores", GetThreadAffinityMask({}, 8) == uint64(0));
+
+	return true;
+}
+
+SPATIAL_THREAD_POLICY_TEST(GIVEN_a_thread_policy_WHEN_getting_its_priority_THEN_the_default_is_only_used_when_it_sets_none)
+{
+	FSpatialThreadPolicy Policy;
+	TestTrue("Default priority", GetThreadPriority(Policy, TPri_BelowNormal) == TPri_BelowNormal);
+
+	Policy.Priority = ESpatialThreadPriority::TimeCritical;
+	TestTrue("Set priority", GetThreadPriority(Policy, TPri_BelowNormal) == TPri_TimeCritical);
+
+	return true;
+}
+
+SPATIAL_THREAD_POLICY_TEST(GIVEN_a_configured_thread_policy_WHEN_creating_the_thread_THEN_the_policy_is_applied)
+{
+	USpatialGDKSettings* Settings = GetMutableDefault<USpatialGDKSettings>();
+	const TMap<FName, FSpatialThreadPolicy> OldThreadPolicies = Settings->ThreadPolicies;
+	Settings->ThreadPolicies.FindOrAdd(TestThreadName).Priority = ESpatialThreadPriority::BelowNormal;
+
+	FExitingRunnable Runnable;
+	FRunnableThread* Thread = CreateThreadWithPolicy(&Runnable, TestThreadName, TPri_Highest);
+
+	TestNotNull("The thread was created", Thread);
+	if (Thread != nullptr)
+	{
+		TestTrue("The policy's priority was used instead of the default", Thread->GetThreadPriority() == TPri_BelowNormal);
+		Thread->WaitForCompletion();
+		delete Thread;
+	}
+
+	Settings->ThreadPolicies = OldThreadPolicies;
+
+	return true;
+}
+
+SPATIAL_THREAD_POLICY_TEST(GIVEN_busy_polling_is_set_for_a_thread_which_does_not_support_it_WHEN_creating_the_thread_THEN_it_warns)
+{
+	USpatialGDKSettings* Settings = GetMutableDefault<USpatialGDKSettings>();
+	const TMap<FName, FSpatialThreadPolicy> OldThreadPolicies = Settings->ThreadPolicies;
+	Settings->ThreadPolicies.FindOrAdd(TestThreadName).bBusyPoll = true;
+
+	AddExpectedError(TEXT("doesn't support busy polling"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	FExitingRunnable Runnable;
+	FRunnableThread* Thread = CreateThreadWithPolicy(&Runnable, TestThreadName, TPri_Normal, false);
+
+	TestNotNull("The thread was still created", Thread);
+	if (Thread != nullptr)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+	}
+
+	Settings->ThreadPolicies = OldThreadPolicies;
+
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,70 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/WorkerLoadHistory.h"
+
+#include "CoreMinimal.h"
+
+#define WORKERLOADHISTORY_TEST(TestName) \
+	GDK_TEST(Core, FWorkerLoadHistory, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const FString TestWorkerName = TEXT("unrealworker0");
+const VirtualWorkerId TestVirtualWorkerId = 1;
+
+FWorkerLoadSample MakeSample(double Time, int32 EntityCount)
+{
+	FWorkerLoadSample Sample;
+	Sample.Time = Time;
+	Sample.EntityCount = EntityCount;
+	return Sample;
+}
+
+} // anonymous namespace
+
+WORKERLOADHISTORY_TEST(GIVEN_a_full_history_WHEN_a_sample_is_added_THEN_the_oldest_sample_is_dropped)
+{
+	FWorkerLoadHistory History(2);
+	History.AddSample(TestWorkerName, TestVirtualWorkerId, MakeSample(1.0, 10));
+	History.AddSample(TestWorkerName, TestVirtualWorkerId, MakeSample(2.0, 20));
+	History.AddSample(TestWorkerName, TestVirtualWorkerId, MakeSample(3.0, 30));
+
+	const TArray<FWorkerLoadSample>* Samples = History.GetSamples(TestWorkerName);
+	if (TestNotNull(TEXT("Worker has samples"), Samples))
+	{
+		TestEqual(TEXT("Sample count"), Samples->Num(), 2);
+		TestEqual(TEXT("Oldest kept sample"), (*Samples)[0].EntityCount, 20);
+		TestEqual(TEXT("Newest sample"), (*Samples)[1].EntityCount, 30);
+	}
+
+	History.RemoveWorker(TestWorkerName);
+	TestNull(TEXT("Removed worker has no samples"), History.GetSamples(TestWorkerName));
+
+	return true;
+}
+
+WORKERLOADHISTORY_TEST(GIVEN_a_worker_with_a_cell_WHEN_exported_THEN_the_cell_is_written_with_each_sample)
+{
+	FWorkerLoadHistory History(10);
+	History.SetCell(TestVirtualWorkerId, FBox2D(FVector2D(0.f, 0.f), FVector2D(100.f, 200.f)));
+	History.AddSample(TestWorkerName, TestVirtualWorkerId, MakeSample(1.0, 10));
+
+	TArray<FString> CsvLines;
+	History.ToCsv().ParseIntoArrayLines(CsvLines);
+	TestEqual(TEXT("Header and one row"), CsvLines.Num(), 2);
+	if (CsvLines.Num() == 2)
+	{
+		TestTrue(TEXT("Row has the worker and cell"), CsvLines[1].StartsWith(TEXT("unrealworker0,1,0.0,0.0,100.0,200.0,1.000,10,")));
+	}
+
+	const FString Json = History.ToJson();
+	TestTrue(TEXT("JSON has the cell"), Json.Contains(TEXT("\"cell\":{\"minX\":0.0,\"minY\":0.0,\"maxX\":100.0,\"maxY\":200.0}")));
+	TestTrue(TEXT("JSON has the sample"), Json.Contains(TEXT("\"entityCount\":10")));
+
+	return true;
+}
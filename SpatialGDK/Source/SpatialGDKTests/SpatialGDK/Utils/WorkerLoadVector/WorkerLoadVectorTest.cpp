@@ -0,0 +1,74 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/WorkerLoadVector.h"
+
+#define WORKER_LOAD_VECTOR_TEST(TestName) \
+	GDK_TEST(Core, WorkerLoadVector, TestName)
+
+namespace SpatialGDK
+{
+	WORKER_LOAD_VECTOR_TEST(GIVEN_no_budgets_WHEN_bottleneck_load_is_read_THEN_it_is_the_frame_time_load)
+	{
+		FWorkerLoadVector LoadVector;
+		LoadVector.FrameTimeLoad = 0.5;
+		LoadVector.AuthoritativeEntityCount = 100000;
+		LoadVector.OutgoingBytesPerSecond = 1e9;
+
+		EWorkerLoadDimension Dimension;
+		TestEqual("Load", LoadVector.GetBottleneckLoad(FWorkerLoadBudget(), &Dimension), 0.5);
+		TestTrue("Bottleneck is frame time", Dimension == EWorkerLoadDimension::FrameTime);
+
+		return true;
+	}
+
+	WORKER_LOAD_VECTOR_TEST(GIVEN_a_dimension_over_its_budget_WHEN_bottleneck_load_is_read_THEN_it_is_that_dimension)
+	{
+		FWorkerLoadVector LoadVector;
+		LoadVector.FrameTimeLoad = 0.5;
+		LoadVector.AuthoritativeEntityCount = 800;
+		LoadVector.OutgoingBytesPerSecond = 1500000.0;
+		LoadVector.MemoryUsedMB = 1024.0;
+
+		FWorkerLoadBudget Budget;
+		Budget.AuthoritativeEntities = 1000.0;
+		Budget.OutgoingBytesPerSecond = 1000000.0;
+		Budget.MemoryUsedMB = 4096.0;
+
+		EWorkerLoadDimension Dimension;
+		TestEqual("Load", LoadVector.GetBottleneckLoad(Budget, &Dimension), 1.5);
+		TestTrue("Bottleneck is outgoing bytes", Dimension == EWorkerLoadDimension::OutgoingBytes);
+
+		LoadVector.OutgoingBytesPerSecond = 0.0;
+		TestEqual("Load once bytes are within budget", LoadVector.GetBottleneckLoad(Budget, &Dimension), 0.8);
+		TestTrue("Bottleneck is authoritative entities", Dimension == EWorkerLoadDimension::AuthoritativeEntities);
+
+		return true;
+	}
+
+	WORKER_LOAD_VECTOR_TEST(GIVEN_a_load_vector_WHEN_written_to_and_read_from_schema_THEN_it_is_unchanged)
+	{
+		FWorkerLoadVector LoadVector;
+		LoadVector.FrameTimeLoad = 0.75;
+		LoadVector.AuthoritativeEntityCount = 321;
+		LoadVector.OutgoingBytesPerSecond = 65536.0;
+		LoadVector.IncomingOpsPerSecond = 1200.0;
+		LoadVector.MemoryUsedMB = 2048.5;
+
+		Schema_ComponentData* Data = Schema_CreateComponentData();
+		Schema_Object* Object = Schema_GetComponentDataFields(Data);
+		LoadVector.WriteToSchema(Object);
+
+		const FWorkerLoadVector ReadLoadVector = FWorkerLoadVector::ReadFromSchema(Object);
+		Schema_DestroyComponentData(Data);
+
+		TestEqual("Frame time load", ReadLoadVector.FrameTimeLoad, LoadVector.FrameTimeLoad);
+		TestEqual("Authoritative entity count", ReadLoadVector.AuthoritativeEntityCount, LoadVector.AuthoritativeEntityCount);
+		TestEqual("Outgoing bytes per second", ReadLoadVector.OutgoingBytesPerSecond, LoadVector.OutgoingBytesPerSecond);
+		TestEqual("Incoming ops per second", ReadLoadVector.IncomingOpsPerSecond, LoadVector.IncomingOpsPerSecond);
+		TestEqual("Memory used", ReadLoadVector.MemoryUsedMB, LoadVector.MemoryUsedMB);
+
+		return true;
+	}
+}
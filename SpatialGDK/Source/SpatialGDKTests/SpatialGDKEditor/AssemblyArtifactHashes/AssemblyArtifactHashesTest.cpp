@@ -0,0 +1,145 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/AssemblyArtifactHashes.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#define ASSEMBLY_ARTIFACT_HASHES_TEST(TestName) \
+	GDK_TEST(SpatialGDKEditor, AssemblyArtifactHashes, TestName)
+
+namespace
+{
+FString GetTestDirectory()
+{
+	return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("AssemblyArtifactHashesTest"));
+}
+
+FString GetCachePath()
+{
+	return FPaths::Combine(GetTestDirectory(), TEXT("UploadedAssemblies.json"));
+}
+
+void ResetTestDirectory()
+{
+	IFileManager::Get().DeleteDirectory(*GetTestDirectory(), /* RequireExists */ false, /* Tree */ true);
+	IFileManager::Get().MakeDirectory(*GetTestDirectory(), /* Tree */ true);
+}
+
+bool WriteArchive(const FString& ArchiveName, const FString& Contents)
+{
+	return FFileHelper::SaveStringToFile(Contents, *FPaths::Combine(GetTestDirectory(), ArchiveName));
+}
+
+FAssemblyArtifactHashes MakeHashes(const TMap<FString, FString>& Hashes)
+{
+	FAssemblyArtifactHashes ArtifactHashes;
+	ArtifactHashes.Hashes = Hashes;
+	return ArtifactHashes;
+}
+} // anonymous namespace
+
+ASSEMBLY_ARTIFACT_HASHES_TEST(GIVEN_worker_archives_in_a_folder_WHEN_hashed_THEN_every_archive_is_hashed_by_its_contents)
+{
+	ResetTestDirectory();
+	TestTrue("Wrote the server archive", WriteArchive(TEXT("UnrealWorker@Linux.zip"), TEXT("server")));
+	TestTrue("Wrote the client archive", WriteArchive(TEXT("UnrealClient@Windows.zip"), TEXT("client")));
+	TestTrue("Wrote the simulated player archive", WriteArchive(TEXT("SimulatedPlayer@Linux.zip"), TEXT("server")));
+	TestTrue("Wrote a file which isn't an archive", WriteArchive(TEXT("Build.log"), TEXT("log")));
+
+	const FAssemblyArtifactHashes ArtifactHashes = FAssemblyArtifactHashes::HashArchives(GetTestDirectory());
+
+	TestEqual("Only archives are hashed", ArtifactHashes.Hashes.Num(), 3);
+	const FString* ServerHash = ArtifactHashes.Hashes.Find(TEXT("UnrealWorker@Linux.zip"));
+	const FString* ClientHash = ArtifactHashes.Hashes.Find(TEXT("UnrealClient@Windows.zip"));
+	const FString* SimulatedPlayerHash = ArtifactHashes.Hashes.Find(TEXT("SimulatedPlayer@Linux.zip"));
+	TestTrue("Every archive has a hash", ServerHash != nullptr && ClientHash != nullptr && SimulatedPlayerHash != nullptr && !ServerHash->IsEmpty());
+	TestTrue("Archives with the same contents have the same hash", ServerHash != nullptr && SimulatedPlayerHash != nullptr && *ServerHash == *SimulatedPlayerHash);
+	TestTrue("Archives with different contents have different hashes", ServerHash != nullptr && ClientHash != nullptr && *ServerHash != *ClientHash);
+
+	IFileManager::Get().DeleteDirectory(*GetTestDirectory(), /* RequireExists */ false, /* Tree */ true);
+
+	return true;
+}
+
+ASSEMBLY_ARTIFACT_HASHES_TEST(GIVEN_hashes_saved_for_two_assemblies_WHEN_loaded_THEN_each_assembly_has_its_own_hashes)
+{
+	ResetTestDirectory();
+
+	const FAssemblyArtifactHashes FirstAssembly = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("a") }, { TEXT("UnrealClient@Windows.zip"), TEXT("b") } });
+	const FAssemblyArtifactHashes SecondAssembly = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("c") } });
+	TestTrue("Saved the first assembly", FirstAssembly.SaveToCache(GetCachePath(), TEXT("Project/First")));
+	TestTrue("Saved the second assembly", SecondAssembly.SaveToCache(GetCachePath(), TEXT("Project/Second")));
+
+	FAssemblyArtifactHashes LoadedFirstAssembly;
+	FAssemblyArtifactHashes LoadedSecondAssembly;
+	TestTrue("Loaded the first assembly", FAssemblyArtifactHashes::LoadFromCache(GetCachePath(), TEXT("Project/First"), LoadedFirstAssembly));
+	TestTrue("Loaded the second assembly", FAssemblyArtifactHashes::LoadFromCache(GetCachePath(), TEXT("Project/Second"), LoadedSecondAssembly));
+	TestTrue("The first assembly's hashes are kept", LoadedFirstAssembly.Hashes.OrderIndependentCompareEqual(FirstAssembly.Hashes));
+	TestTrue("The second assembly's hashes are kept", LoadedSecondAssembly.Hashes.OrderIndependentCompareEqual(SecondAssembly.Hashes));
+
+	FAssemblyArtifactHashes NeverUploaded;
+	TestFalse("An assembly which was never uploaded has no hashes", FAssemblyArtifactHashes::LoadFromCache(GetCachePath(), TEXT("Project/Third"), NeverUploaded));
+
+	IFileManager::Get().DeleteDirectory(*GetTestDirectory(), /* RequireExists */ false, /* Tree */ true);
+
+	return true;
+}
+
+ASSEMBLY_ARTIFACT_HASHES_TEST(GIVEN_no_cache_file_WHEN_loading_hashes_THEN_returns_false)
+{
+	ResetTestDirectory();
+
+	FAssemblyArtifactHashes ArtifactHashes;
+	TestFalse("Nothing is loaded", FAssemblyArtifactHashes::LoadFromCache(GetCachePath(), TEXT("Project/Assembly"), ArtifactHashes));
+	TestEqual("No hashes", ArtifactHashes.Hashes.Num(), 0);
+
+	IFileManager::Get().DeleteDirectory(*GetTestDirectory(), /* RequireExists */ false, /* Tree */ true);
+
+	return true;
+}
+
+ASSEMBLY_ARTIFACT_HASHES_TEST(GIVEN_the_same_archives_as_the_upload_WHEN_compared_THEN_the_assembly_is_unchanged)
+{
+	const FAssemblyArtifactHashes Uploaded = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("a") }, { TEXT("UnrealClient@Windows.zip"), TEXT("b") } });
+	const FAssemblyArtifactHashes Current = MakeHashes({ { TEXT("UnrealClient@Windows.zip"), TEXT("b") }, { TEXT("UnrealWorker@Linux.zip"), TEXT("a") } });
+
+	TestEqual("No archive changed", Current.GetChangedArchives(Uploaded).Num(), 0);
+	TestTrue("The assembly is unchanged", Current.IsUnchangedFrom(Uploaded));
+
+	return true;
+}
+
+ASSEMBLY_ARTIFACT_HASHES_TEST(GIVEN_a_rebuilt_archive_WHEN_compared_THEN_only_that_archive_changed)
+{
+	const FAssemblyArtifactHashes Uploaded = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("a") }, { TEXT("UnrealClient@Windows.zip"), TEXT("b") } });
+	const FAssemblyArtifactHashes Current = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("c") }, { TEXT("UnrealClient@Windows.zip"), TEXT("b") } });
+
+	TestTrue("The rebuilt archive changed", Current.GetChangedArchives(Uploaded) == TArray<FString>{ TEXT("UnrealWorker@Linux.zip") });
+	TestFalse("The assembly changed", Current.IsUnchangedFrom(Uploaded));
+
+	return true;
+}
+
+ASSEMBLY_ARTIFACT_HASHES_TEST(GIVEN_added_removed_or_unreadable_archives_WHEN_compared_THEN_the_assembly_changed)
+{
+	const FAssemblyArtifactHashes Uploaded = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("a") } });
+
+	const FAssemblyArtifactHashes Added = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("a") }, { TEXT("UnrealClient@Windows.zip"), TEXT("b") } });
+	TestTrue("The added archive changed", Added.GetChangedArchives(Uploaded) == TArray<FString>{ TEXT("UnrealClient@Windows.zip") });
+	TestFalse("Adding an archive changes the assembly", Added.IsUnchangedFrom(Uploaded));
+
+	const FAssemblyArtifactHashes Removed = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("a") } });
+	const FAssemblyArtifactHashes UploadedWithClient = Added;
+	TestFalse("Removing an archive changes the assembly", Removed.IsUnchangedFrom(UploadedWithClient));
+
+	const FAssemblyArtifactHashes Unreadable = MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("") } });
+	TestFalse("An archive which couldn't be hashed changes the assembly", Unreadable.IsUnchangedFrom(MakeHashes({ { TEXT("UnrealWorker@Linux.zip"), TEXT("") } })));
+
+	TestFalse("An assembly without archives is never unchanged", MakeHashes({}).IsUnchangedFrom(MakeHashes({})));
+
+	return true;
+}
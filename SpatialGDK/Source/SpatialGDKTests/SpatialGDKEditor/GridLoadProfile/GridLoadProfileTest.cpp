@@ -0,0 +1,95 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/GridLoadProfile.h"
+
+#define GRID_LOAD_PROFILE_TEST(TestName) \
+	GDK_TEST(SpatialGDKEditor, GridLoadProfile, TestName)
+
+namespace
+{
+const float WorldSize = 1000.f;
+
+FGridLoadProfile MakeProfile(const TArray<FVector2D>& Locations)
+{
+	FGridLoadProfile Profile;
+	for (const FVector2D& Location : Locations)
+	{
+		Profile.Samples.Add(FGridLoadProfile::FSample{ Location, 1.f });
+	}
+	return Profile;
+}
+} // anonymous namespace
+
+GRID_LOAD_PROFILE_TEST(GIVEN_load_spread_along_x_WHEN_proposing_layout_for_fixed_worker_count_THEN_rows_split_the_load)
+{
+	// Four clusters along the x-axis, all at y = 0.
+	const FGridLoadProfile Profile = MakeProfile({ FVector2D(-400.f, 0.f), FVector2D(-100.f, 0.f), FVector2D(100.f, 0.f), FVector2D(400.f, 0.f) });
+
+	const FGridLayoutProposal Proposal = ProposeGridLayout(Profile, WorldSize, WorldSize, 4, 16, 0.f);
+
+	TestEqual("Rows", Proposal.Rows, 4u);
+	TestEqual("Cols", Proposal.Cols, 1u);
+	TestEqual("Max cell load", Proposal.MaxCellLoad, 1.f);
+
+	return true;
+}
+
+GRID_LOAD_PROFILE_TEST(GIVEN_uniform_load_WHEN_proposing_layout_for_fixed_worker_count_THEN_cells_are_square)
+{
+	TArray<FVector2D> Locations;
+	for (float X = -450.f; X < 500.f; X += 100.f)
+	{
+		for (float Y = -450.f; Y < 500.f; Y += 100.f)
+		{
+			Locations.Add(FVector2D(X, Y));
+		}
+	}
+	const FGridLoadProfile Profile = MakeProfile(Locations);
+
+	const FGridLayoutProposal Proposal = ProposeGridLayout(Profile, WorldSize, WorldSize, 4, 16, 0.f);
+
+	TestEqual("Rows", Proposal.Rows, 2u);
+	TestEqual("Cols", Proposal.Cols, 2u);
+
+	return true;
+}
+
+GRID_LOAD_PROFILE_TEST(GIVEN_target_load_per_worker_WHEN_proposing_layout_THEN_fewest_workers_within_target_are_used)
+{
+	// Two samples in each quadrant.
+	const FGridLoadProfile Profile = MakeProfile({
+		FVector2D(-250.f, -250.f), FVector2D(-200.f, -200.f),
+		FVector2D(250.f, -250.f), FVector2D(200.f, -200.f),
+		FVector2D(-250.f, 250.f), FVector2D(-200.f, 200.f),
+		FVector2D(250.f, 250.f), FVector2D(200.f, 200.f) });
+
+	const FGridLayoutProposal Proposal = ProposeGridLayout(Profile, WorldSize, WorldSize, 1, 16, 2.f);
+
+	TestEqual("Workers", Proposal.GetNumWorkers(), 4u);
+	TestEqual("Max cell load", Proposal.MaxCellLoad, 2.f);
+
+	return true;
+}
+
+GRID_LOAD_PROFILE_TEST(GIVEN_unreachable_target_load_WHEN_proposing_layout_THEN_worker_count_is_capped)
+{
+	const FGridLoadProfile Profile = MakeProfile({ FVector2D(10.f, 10.f), FVector2D(20.f, 20.f), FVector2D(-300.f, 300.f) });
+
+	const FGridLayoutProposal Proposal = ProposeGridLayout(Profile, WorldSize, WorldSize, 1, 4, 1.f);
+
+	TestTrue("At most the maximum number of workers are used", Proposal.GetNumWorkers() <= 4u);
+	TestEqual("Max cell load", Proposal.MaxCellLoad, 2.f);
+
+	return true;
+}
+
+GRID_LOAD_PROFILE_TEST(GIVEN_samples_outside_the_grid_WHEN_computing_cell_load_THEN_they_count_towards_closest_cell)
+{
+	const FGridLoadProfile Profile = MakeProfile({ FVector2D(-5000.f, 0.f), FVector2D(-400.f, 0.f), FVector2D(400.f, 0.f) });
+
+	TestEqual("Max cell load", GetMaxGridCellLoad(Profile, WorldSize, WorldSize, 2, 1), 2.f);
+
+	return true;
+}
@@ -113,3 +113,12 @@ class ASpatialTypeActorWithSubobject : public AActor
 	UPROPERTY(Replicated)
 	USpatialTypeObjectStub* SpatialActorSubobject;
 };
+
+UCLASS(SpatialType)
+class ASpatialTypeActorWithHandoverStruct : public AActor
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Handover)
+	FVector HandoverVector;
+};
@@ -356,6 +356,35 @@ private:
 	uint32 CachedMaxRPCRingBufferSize;
 };
 
+class SchemaHandoverCompressionTestFixture : public SchemaTestFixture
+{
+public:
+	explicit SchemaHandoverCompressionTestFixture(bool bCompressHandoverBytesFields)
+	{
+		USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+		bCachedCompressHandoverBytesFields = SpatialGDKSettings->bCompressHandoverBytesFields;
+		SpatialGDKSettings->bCompressHandoverBytesFields = bCompressHandoverBytesFields;
+	}
+	~SchemaHandoverCompressionTestFixture()
+	{
+		GetMutableDefault<USpatialGDKSettings>()->bCompressHandoverBytesFields = bCachedCompressHandoverBytesFields;
+	}
+
+private:
+	bool bCachedCompressHandoverBytesFields;
+};
+
+// Generates schema for Class and returns the compressed fields saved to the schema database for it, if any.
+const FCompressedFieldsSchemaData* GenerateAndFindCompressedFields(UClass* Class)
+{
+	SpatialGDKEditor::Schema::SpatialGDKGenerateSchemaForClasses({ Class }, SchemaOutputFolder);
+	SpatialGDKEditor::Schema::SaveSchemaDatabase(DatabaseOutputFile);
+
+	FSoftObjectPath SchemaDatabasePath = FSoftObjectPath(FPaths::SetExtension(DatabaseOutputFile, TEXT(".SchemaDatabase")));
+	const USchemaDatabase* SchemaDatabase = Cast<USchemaDatabase>(SchemaDatabasePath.TryLoad());
+	return SchemaDatabase != nullptr ? SchemaDatabase->ClassPathToCompressedFields.Find(Class->GetPathName()) : nullptr;
+}
+
 } // anonymous namespace
 
 SCHEMA_GENERATOR_TEST(GIVEN_spatial_type_class_WHEN_checked_if_supported_THEN_is_supported)
@@ -808,6 +837,33 @@ SCHEMA_GENERATOR_TEST(GIVEN_schema_database_exists_WHEN_tried_to_load_THEN_loade
 	return true;
 }
 
+SCHEMA_GENERATOR_TEST(GIVEN_schema_database_for_unchanged_class_WHEN_generated_schema_for_this_class_THEN_schema_file_is_not_rewritten)
+{
+	SchemaTestFixture Fixture;
+
+	// GIVEN
+	UClass* CurrentClass = ASpatialTypeActor::StaticClass();
+	TSet<UClass*> Classes = { CurrentClass };
+
+	SpatialGDKEditor::Schema::SpatialGDKGenerateSchemaForClasses(Classes, SchemaOutputFolder);
+	SpatialGDKEditor::Schema::SaveSchemaDatabase(DatabaseOutputFile);
+
+	const FString SchemaFilePath = FPaths::SetExtension(FPaths::Combine(SchemaOutputFolder, CurrentClass->GetName()), TEXT(".schema"));
+	const FString MarkedSchema = LoadSchemaFileForClass(SchemaOutputFolder, CurrentClass) + TEXT("// Not regenerated");
+	FFileHelper::SaveStringToFile(MarkedSchema, *SchemaFilePath);
+
+	SpatialGDKEditor::Schema::ResetSchemaGeneratorState();
+	SpatialGDKEditor::Schema::LoadGeneratorStateFromSchemaDatabase(SchemaDatabaseFileName);
+
+	// WHEN
+	SpatialGDKEditor::Schema::SpatialGDKGenerateSchemaForClasses(Classes, SchemaOutputFolder);
+
+	// THEN
+	TestEqual("Schema file of unchanged class was not rewritten", LoadSchemaFileForClass(SchemaOutputFolder, CurrentClass), MarkedSchema);
+
+	return true;
+}
+
 SCHEMA_GENERATOR_TEST(GIVEN_schema_database_does_not_exist_WHEN_tried_to_load_THEN_not_loaded)
 {
 	SchemaTestFixture Fixture;
@@ -999,3 +1055,58 @@ SCHEMA_GENERATOR_TEST(GIVEN_no_schema_exists_WHEN_generating_schema_for_rpc_endp
 
 	return true;
 }
+
+SCHEMA_GENERATOR_TEST(GIVEN_a_class_with_numeric_and_bool_properties_WHEN_generating_serializers_THEN_the_source_registers_typed_serializers)
+{
+	int32 NumProperties = 0;
+	const FString Source = SpatialGDKEditor::Schema::GenerateSerializerSourceForClass(USchemaGenObjectStub::StaticClass(), NumProperties);
+
+	TestEqual("Both replicated properties have serializers", NumProperties, 2);
+	TestTrue("The int property is written as int32", Source.Contains(TEXT("TEXT(\"IntValue\"), TEXT(\"IntProperty\"), &Write<int32, int32_t, &Schema_AddInt32>, &Read<int32, int32_t, &Schema_IndexInt32>")));
+	TestTrue("The native bool property uses the bool functions", Source.Contains(TEXT("TEXT(\"BoolValue\"), TEXT(\"BoolProperty\"), &WriteNativeBool, &ReadNativeBool")));
+	TestTrue("The serializers are registered for the class", Source.Contains(FString::Printf(TEXT("TEXT(\"%s\"), MakeArrayView("), *USchemaGenObjectStub::StaticClass()->GetPathName())));
+
+	return true;
+}
+
+SCHEMA_GENERATOR_TEST(GIVEN_a_class_without_replicated_properties_WHEN_generating_serializers_THEN_no_source_is_generated)
+{
+	int32 NumProperties = 0;
+	const FString Source = SpatialGDKEditor::Schema::GenerateSerializerSourceForClass(USpatialTypeObjectStub::StaticClass(), NumProperties);
+
+	TestEqual("No properties have serializers", NumProperties, 0);
+	TestTrue("The source is empty", Source.IsEmpty());
+
+	return true;
+}
+
+SCHEMA_GENERATOR_TEST(GIVEN_compressed_handover_bytes_fields_WHEN_generating_schema_for_a_class_with_a_handover_struct_THEN_the_handover_field_is_compressed)
+{
+	SchemaHandoverCompressionTestFixture Fixture(true);
+
+	// WHEN
+	const FCompressedFieldsSchemaData* CompressedFields = GenerateAndFindCompressedFields(ASpatialTypeActorWithHandoverStruct::StaticClass());
+
+	// THEN
+	if (!TestNotNull("The class has compressed fields in the schema database", CompressedFields))
+	{
+		return true;
+	}
+	TestEqual("No replicated fields are compressed", CompressedFields->ReplicatedFieldIds.Num(), 0);
+	TestTrue("The handover struct field is compressed", CompressedFields->HandoverFieldIds == TArray<uint32>({ 1 }));
+
+	return true;
+}
+
+SCHEMA_GENERATOR_TEST(GIVEN_uncompressed_handover_bytes_fields_WHEN_generating_schema_for_a_class_with_a_handover_struct_THEN_no_field_is_compressed)
+{
+	SchemaHandoverCompressionTestFixture Fixture(false);
+
+	// WHEN
+	const FCompressedFieldsSchemaData* CompressedFields = GenerateAndFindCompressedFields(ASpatialTypeActorWithHandoverStruct::StaticClass());
+
+	// THEN
+	TestNull("The class has no compressed fields in the schema database", CompressedFields);
+
+	return true;
+}
@@ -25,6 +25,7 @@ public class SpatialGDKTests : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"EngineSettings",
+				"ReplicationGraph",
 				"UnrealEd",
 				"Json",
 				"JsonUtilities"